@@ -55,8 +55,10 @@ typename Publisher<SpecT>::SharedPtr create_publisher_impl(NodeT * node)
 {
   // This function is a wrapper for the following.
   // https://github.com/ros2/rclcpp/blob/48068130edbb43cdd61076dc1851672ff1a80408/rclcpp/include/rclcpp/node.hpp#L167-L205
-  auto publisher =
-    node->template create_publisher<typename SpecT::Message>(SpecT::name, get_qos<SpecT>());
+  rclcpp::PublisherOptions options;
+  options.use_intra_process_comm = get_intra_process_setting<SpecT>();
+  auto publisher = node->template create_publisher<typename SpecT::Message>(
+    SpecT::name, get_qos<SpecT>(), options);
   return Publisher<SpecT>::make_shared(publisher);
 }
 
@@ -67,8 +69,10 @@ typename Subscription<SpecT>::SharedPtr create_subscription_impl(
 {
   // This function is a wrapper for the following.
   // https://github.com/ros2/rclcpp/blob/48068130edbb43cdd61076dc1851672ff1a80408/rclcpp/include/rclcpp/node.hpp#L207-L238
+  rclcpp::SubscriptionOptions options;
+  options.use_intra_process_comm = get_intra_process_setting<SpecT>();
   auto subscription = node->template create_subscription<typename SpecT::Message>(
-    SpecT::name, get_qos<SpecT>(), std::forward<CallbackT>(callback));
+    SpecT::name, get_qos<SpecT>(), std::forward<CallbackT>(callback), options);
   return Subscription<SpecT>::make_shared(subscription);
 }
 
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__COMPONENT_INTERFACE_UTILS__RCLCPP__INTERFACE_HPP_
 #define AUTOWARE__COMPONENT_INTERFACE_UTILS__RCLCPP__INTERFACE_HPP_
 
+#include <autoware/component_interface_utils/statistics.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <tier4_system_msgs/msg/service_log.hpp>
@@ -63,6 +64,17 @@ struct NodeInterface
     logger->publish(msg);
   }
 
+  void record_latency(
+    const std::string & type, const std::string & name, const LatencyHistogram::Duration & latency)
+  {
+    InterfaceStatistics::instance().add_latency(node_name, name, type, latency);
+  }
+
+  void record_error(const std::string & type, const std::string & name)
+  {
+    InterfaceStatistics::instance().add_error(node_name, name, type);
+  }
+
   rclcpp::Node * node;
   rclcpp::Publisher<ServiceLog>::SharedPtr logger;
   std::string node_name;
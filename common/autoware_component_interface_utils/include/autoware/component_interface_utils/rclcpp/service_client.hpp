@@ -21,6 +21,7 @@
 
 #include <tier4_system_msgs/msg/service_log.hpp>
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <utility>
@@ -52,6 +53,7 @@ public:
   {
     if (!client_->service_is_ready()) {
       interface_->log(ServiceLog::ERROR_UNREADY, SpecType::name);
+      interface_->record_error("client", SpecType::name);
       throw ServiceUnready(SpecT::name);
     }
 
@@ -60,6 +62,7 @@ public:
       const auto duration = std::chrono::duration<double, std::ratio<1>>(timeout.value());
       if (future.wait_for(duration) != std::future_status::ready) {
         interface_->log(ServiceLog::ERROR_TIMEOUT, SpecType::name);
+        interface_->record_error("client", SpecType::name);
         throw ServiceTimeout(SpecT::name);
       }
     }
@@ -81,7 +84,10 @@ public:
     using rosidl_generator_traits::to_yaml;
 #endif
 
-    const auto wrapped = [this, callback](typename WrapType::SharedFuture future) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto wrapped = [this, callback, start](typename WrapType::SharedFuture future) {
+      const auto latency = std::chrono::steady_clock::now() - start;
+      interface_->record_latency("client", SpecType::name, latency);
       interface_->log(ServiceLog::CLIENT_RESPONSE, SpecType::name, to_yaml(*future.get()));
       callback(future);
     };
@@ -21,6 +21,7 @@
 
 #include <tier4_system_msgs/msg/service_log.hpp>
 
+#include <chrono>
 #include <string>
 
 namespace autoware::component_interface_utils
@@ -74,6 +75,7 @@ public:
 #endif
       // If the response has status, convert it from the exception.
       interface_->log(ServiceLog::SERVER_REQUEST, SpecType::name, to_yaml(*request));
+      const auto start = std::chrono::steady_clock::now();
       if constexpr (!has_status_type<typename SpecT::Service::Response>::value) {
         callback(request, response);
       } else {
@@ -83,6 +85,8 @@ public:
           error.set(response->status);
         }
       }
+      const auto latency = std::chrono::steady_clock::now() - start;
+      interface_->record_latency("server", SpecType::name, latency);
       interface_->log(ServiceLog::SERVER_RESPONSE, SpecType::name, to_yaml(*response));
     };
     return wrapped;
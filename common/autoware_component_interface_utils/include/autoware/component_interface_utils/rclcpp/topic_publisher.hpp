@@ -17,10 +17,13 @@
 
 #include <rclcpp/publisher.hpp>
 
+#include <memory>
+#include <utility>
+
 namespace autoware::component_interface_utils
 {
 
-/// The wrapper class of rclcpp::Publisher. This is for future use and no functionality now.
+/// The wrapper class of rclcpp::Publisher.
 template <class SpecT>
 class Publisher
 {
@@ -38,6 +41,12 @@ public:
   /// Publish a message.
   void publish(const typename SpecT::Message & msg) { publisher_->publish(msg); }
 
+  /// Publish a message without copy if the intra-process communication is enabled.
+  void publish(std::unique_ptr<typename SpecT::Message> msg)
+  {
+    publisher_->publish(std::move(msg));
+  }
+
 private:
   RCLCPP_DISABLE_COPY(Publisher)
   typename WrapType::SharedPtr publisher_;
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__COMPONENT_INTERFACE_UTILS__SPECS_HPP_
 #define AUTOWARE__COMPONENT_INTERFACE_UTILS__SPECS_HPP_
 
+#include <rclcpp/intra_process_setting.hpp>
 #include <rclcpp/qos.hpp>
 
 namespace autoware::component_interface_utils
@@ -29,6 +30,16 @@ rclcpp::QoS get_qos()
   return qos;
 }
 
+/// Get the intra-process setting, which is not supported with transient local durability.
+template <class SpecT>
+rclcpp::IntraProcessSetting get_intra_process_setting()
+{
+  if (SpecT::durability == RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL) {
+    return rclcpp::IntraProcessSetting::Disable;
+  }
+  return rclcpp::IntraProcessSetting::NodeDefault;
+}
+
 }  // namespace autoware::component_interface_utils
 
 #endif  // AUTOWARE__COMPONENT_INTERFACE_UTILS__SPECS_HPP_
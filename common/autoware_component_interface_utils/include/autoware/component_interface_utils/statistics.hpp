@@ -0,0 +1,158 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__COMPONENT_INTERFACE_UTILS__STATISTICS_HPP_
+#define AUTOWARE__COMPONENT_INTERFACE_UTILS__STATISTICS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace autoware::component_interface_utils
+{
+
+/// The histogram of call latencies with fixed buckets.
+class LatencyHistogram
+{
+public:
+  using Duration = std::chrono::duration<double, std::milli>;
+
+  /// The upper bounds of the buckets in milliseconds. The last bucket has no upper bound.
+  static constexpr std::array<double, 12> bounds = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+  using Counts = std::array<size_t, bounds.size() + 1>;
+
+  /// Add a latency.
+  void add(const Duration & latency)
+  {
+    const double value = latency.count();
+    const auto bucket = std::lower_bound(bounds.begin(), bounds.end(), value) - bounds.begin();
+    ++counts_.at(bucket);
+    ++count_;
+    sum_ += value;
+    max_ = std::max(max_, value);
+  }
+
+  /// Get the number of the latencies.
+  size_t count() const { return count_; }
+
+  /// Get the mean latency in milliseconds.
+  double mean() const { return count_ == 0 ? 0.0 : sum_ / static_cast<double>(count_); }
+
+  /// Get the max latency in milliseconds.
+  double max() const { return max_; }
+
+  /// Get the number of the latencies in each bucket.
+  const Counts & counts() const { return counts_; }
+
+  /// Get the upper bound of the bucket containing the quantile, which is limited by the max.
+  double quantile(const double q) const
+  {
+    if (count_ == 0) {
+      return 0.0;
+    }
+    const auto rank = static_cast<size_t>(std::ceil(q * static_cast<double>(count_)));
+    const auto target = std::clamp(rank, size_t{1}, count_);
+    size_t accumulated = 0;
+    for (size_t i = 0; i < bounds.size(); ++i) {
+      accumulated += counts_.at(i);
+      if (target <= accumulated) {
+        return std::min(bounds.at(i), max_);
+      }
+    }
+    return max_;
+  }
+
+private:
+  Counts counts_{};
+  size_t count_ = 0;
+  double sum_ = 0.0;
+  double max_ = 0.0;
+};
+
+/// The latency statistics of the interfaces in this process, which are shared by all nodes.
+class InterfaceStatistics
+{
+public:
+  struct Entry
+  {
+    std::string node;
+    std::string name;
+    std::string type;
+    LatencyHistogram latency;
+    size_t errors = 0;
+  };
+
+  /// Get the instance of this process.
+  static InterfaceStatistics & instance()
+  {
+    static InterfaceStatistics statistics;
+    return statistics;
+  }
+
+  /// Add a latency of the interface.
+  void add_latency(
+    const std::string & node, const std::string & name, const std::string & type,
+    const LatencyHistogram::Duration & latency)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    get_entry(node, name, type).latency.add(latency);
+  }
+
+  /// Add an error of the interface, such as a timeout.
+  void add_error(const std::string & node, const std::string & name, const std::string & type)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++get_entry(node, name, type).errors;
+  }
+
+  /// Get the copy of the statistics of all interfaces.
+  std::vector<Entry> entries() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Entry> result;
+    result.reserve(entries_.size());
+    for (const auto & [key, entry] : entries_) {
+      result.push_back(entry);
+    }
+    return result;
+  }
+
+private:
+  InterfaceStatistics() = default;
+
+  Entry & get_entry(const std::string & node, const std::string & name, const std::string & type)
+  {
+    const auto [iter, inserted] = entries_.try_emplace(std::make_tuple(node, name, type));
+    if (inserted) {
+      iter->second.node = node;
+      iter->second.name = name;
+      iter->second.type = type;
+    }
+    return iter->second;
+  }
+
+  mutable std::mutex mutex_;
+  std::map<std::tuple<std::string, std::string, std::string>, Entry> entries_;
+};
+
+}  // namespace autoware::component_interface_utils
+
+#endif  // AUTOWARE__COMPONENT_INTERFACE_UTILS__STATISTICS_HPP_
@@ -14,6 +14,7 @@
 
 #include "autoware/component_interface_utils/rclcpp/exceptions.hpp"
 #include "autoware/component_interface_utils/specs.hpp"
+#include "autoware/component_interface_utils/statistics.hpp"
 #include "autoware/component_interface_utils/status.hpp"
 #include "gtest/gtest.h"
 
@@ -74,3 +75,30 @@ TEST(interface, utils)
     EXPECT_EQ(status_in.status.success, status_copy->status.success);
   }
 }
+
+TEST(interface, statistics)
+{
+  using autoware::component_interface_utils::LatencyHistogram;
+  using Duration = LatencyHistogram::Duration;
+
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.5), 0.0);
+
+  histogram.add(Duration(0.5));
+  histogram.add(Duration(3.0));
+  histogram.add(Duration(4.0));
+  histogram.add(Duration(8000.0));
+  EXPECT_EQ(histogram.count(), 4u);
+  EXPECT_DOUBLE_EQ(histogram.mean(), 2001.875);
+  EXPECT_DOUBLE_EQ(histogram.max(), 8000.0);
+  EXPECT_EQ(histogram.counts().front(), 1u);
+  EXPECT_EQ(histogram.counts().at(2), 2u);
+  EXPECT_EQ(histogram.counts().back(), 1u);
+
+  // The quantiles are the upper bounds of the buckets, or the max in the last bucket.
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.25), 1.0);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.5), 5.0);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.75), 5.0);
+  EXPECT_DOUBLE_EQ(histogram.quantile(1.0), 8000.0);
+}
@@ -19,14 +19,46 @@
 #include <geometry_msgs/msg/point.hpp>
 #include <tier4_map_msgs/msg/map_projector_info.hpp>
 
+#include <lanelet2_io/Projection.h>
+
+#include <memory>
+#include <vector>
+
+namespace lanelet::projection
+{
+class MGRSProjector;
+}  // namespace lanelet::projection
+
 namespace autoware::geography_utils
 {
 using MapProjectorInfo = tier4_map_msgs::msg::MapProjectorInfo;
 using GeoPoint = geographic_msgs::msg::GeoPoint;
 using LocalPoint = geometry_msgs::msg::Point;
 
+// projector of a map, which is built once and reused for all the points projected on the map
+class Projector
+{
+public:
+  explicit Projector(const MapProjectorInfo & projector_info);
+
+  LocalPoint forward(const GeoPoint & geo_point) const;
+  GeoPoint reverse(const LocalPoint & local_point) const;
+  std::vector<LocalPoint> forward(const std::vector<GeoPoint> & geo_points) const;
+  std::vector<GeoPoint> reverse(const std::vector<LocalPoint> & local_points) const;
+
+private:
+  MapProjectorInfo projector_info_;
+  std::unique_ptr<lanelet::Projector> projector_;
+  // projector_ downcasted for the MGRS map, or nullptr for the other types
+  const lanelet::projection::MGRSProjector * mgrs_projector_;
+};
+
 LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo & projector_info);
 GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info);
+std::vector<LocalPoint> project_forward(
+  const std::vector<GeoPoint> & geo_points, const MapProjectorInfo & projector_info);
+std::vector<GeoPoint> project_reverse(
+  const std::vector<LocalPoint> & local_points, const MapProjectorInfo & projector_info);
 
 }  // namespace autoware::geography_utils
 
@@ -15,26 +15,34 @@
 #include <GeographicLib/Geoid.hpp>
 #include <autoware/geography_utils/height.hpp>
 
-#include <map>
 #include <stdexcept>
 #include <string>
-#include <utility>
 
 namespace autoware::geography_utils
 {
 
+namespace
+{
+// the geoid model is loaded once per thread, as GeographicLib::Geoid is not thread safe
+const GeographicLib::Geoid & get_egm2008()
+{
+  thread_local const GeographicLib::Geoid egm2008("egm2008-1");
+  return egm2008;
+}
+}  // namespace
+
 double convert_wgs84_to_egm2008(const double height, const double latitude, const double longitude)
 {
-  GeographicLib::Geoid egm2008("egm2008-1");
   // cSpell: ignore ELLIPSOIDTOGEOID
-  return egm2008.ConvertHeight(latitude, longitude, height, GeographicLib::Geoid::ELLIPSOIDTOGEOID);
+  return get_egm2008().ConvertHeight(
+    latitude, longitude, height, GeographicLib::Geoid::ELLIPSOIDTOGEOID);
 }
 
 double convert_egm2008_to_wgs84(const double height, const double latitude, const double longitude)
 {
-  GeographicLib::Geoid egm2008("egm2008-1");
   // cSpell: ignore GEOIDTOELLIPSOID
-  return egm2008.ConvertHeight(latitude, longitude, height, GeographicLib::Geoid::GEOIDTOELLIPSOID);
+  return get_egm2008().ConvertHeight(
+    latitude, longitude, height, GeographicLib::Geoid::GEOIDTOELLIPSOID);
 }
 
 double convert_height(
@@ -44,20 +52,18 @@ double convert_height(
   if (source_vertical_datum == target_vertical_datum) {
     return height;
   }
-  std::map<std::pair<std::string, std::string>, HeightConversionFunction> conversion_map;
-  conversion_map[{"WGS84", "EGM2008"}] = convert_wgs84_to_egm2008;
-  conversion_map[{"EGM2008", "WGS84"}] = convert_egm2008_to_wgs84;
-
-  auto key = std::make_pair(source_vertical_datum, target_vertical_datum);
-  if (conversion_map.find(key) != conversion_map.end()) {
-    return conversion_map[key](height, latitude, longitude);
-  } else {
-    std::string error_message =
-      "Invalid conversion types: " + std::string(source_vertical_datum.c_str()) + " to " +
-      std::string(target_vertical_datum.c_str());
-
-    throw std::invalid_argument(error_message);
+  if (source_vertical_datum == "WGS84" && target_vertical_datum == "EGM2008") {
+    return convert_wgs84_to_egm2008(height, latitude, longitude);
   }
+  if (source_vertical_datum == "EGM2008" && target_vertical_datum == "WGS84") {
+    return convert_egm2008_to_wgs84(height, latitude, longitude);
+  }
+
+  std::string error_message =
+    "Invalid conversion types: " + std::string(source_vertical_datum.c_str()) + " to " +
+    std::string(target_vertical_datum.c_str());
+
+  throw std::invalid_argument(error_message);
 }
 
 }  // namespace autoware::geography_utils
@@ -58,6 +58,12 @@ public:
     calcSplineCoefficients(base_keys, base_values);
   }
 
+  //!< @brief calculate the spline coefficients of base_values over base_keys.
+  //!< @details the coefficient buffers are reused, so recalculating the coefficients of the same
+  //            instance does not allocate unless the number of the base keys grows
+  void calcSplineCoefficients(
+    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+
   //!< @brief get values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
@@ -77,20 +83,36 @@ public:
   std::vector<double> getSplineInterpolatedQuadDiffValues(
     const std::vector<double> & query_keys) const;
 
+  //!< @brief get values, 1st and 2nd differential values of spline interpolation in one pass.
+  //!< @details the outputs are resized to the size of query_keys, so buffers passed repeatedly
+  //            are reused without allocation. nullptr outputs are not calculated.
+  void getSplineInterpolatedValues(
+    const std::vector<double> & query_keys, std::vector<double> * values,
+    std::vector<double> * diff_values = nullptr,
+    std::vector<double> * quad_diff_values = nullptr) const;
+
+  //!< @brief get value, 1st and 2nd differential value of spline interpolation on a single key.
+  //!< @details the key must be within the base keys with the same tolerance as the vector
+  //            queries. nullptr outputs are not calculated.
+  void getSplineInterpolatedValue(
+    const double query_key, double * value, double * diff_value = nullptr,
+    double * quad_diff_value = nullptr) const;
+
   size_t getSize() const { return base_keys_.size(); }
 
 private:
-  Eigen::VectorXd a_;
-  Eigen::VectorXd b_;
-  Eigen::VectorXd c_;
-  Eigen::VectorXd d_;
+  std::vector<double> a_;
+  std::vector<double> b_;
+  std::vector<double> c_;
+  std::vector<double> d_;
 
   std::vector<double> base_keys_;
 
-  void calcSplineCoefficients(
-    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+  // work buffers of calcSplineCoefficients, kept to be reused in the next calculation
+  std::vector<double> h_;
+  std::vector<double> v_;
 
-  Eigen::Index get_index(const double & key) const;
+  size_t get_index(const double & key) const;
 };
 }  // namespace autoware::interpolation
 
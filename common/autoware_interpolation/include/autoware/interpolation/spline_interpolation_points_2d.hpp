@@ -46,8 +46,16 @@ public:
   SplineInterpolationPoints2d() = default;
   template <typename T>
   explicit SplineInterpolationPoints2d(const std::vector<T> & points)
+  {
+    calcSplineCoefficients(points);
+  }
+
+  // recalculate the spline coefficients reusing the buffers of this instance
+  template <typename T>
+  void calcSplineCoefficients(const std::vector<T> & points)
   {
     std::vector<geometry_msgs::msg::Point> points_inner;
+    points_inner.reserve(points.size());
     for (const auto & p : points) {
       points_inner.push_back(autoware::universe_utils::getPoint(p));
     }
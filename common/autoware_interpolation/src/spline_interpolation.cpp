@@ -14,44 +14,41 @@
 
 #include "autoware/interpolation/spline_interpolation.hpp"
 
-#include <cstdint>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace autoware::interpolation
 {
-Eigen::VectorXd solve_tridiagonal_matrix_algorithm(
-  const Eigen::Ref<const Eigen::VectorXd> & a, const Eigen::Ref<const Eigen::VectorXd> & b,
-  const Eigen::Ref<const Eigen::VectorXd> & c, const Eigen::Ref<const Eigen::VectorXd> & d)
+namespace
 {
-  const auto n = d.size();
-
-  if (n == 1) {
-    return d.array() / b.array();
-  }
-
-  Eigen::VectorXd c_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd d_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
-
-  // Forward sweep
-  c_prime(0) = c(0) / b(0);
-  d_prime(0) = d(0) / b(0);
-
-  for (auto i = 1; i < n; i++) {
-    const double m = 1.0 / (b(i) - a(i - 1) * c_prime(i - 1));
-    c_prime(i) = i < n - 1 ? c(i) * m : 0;
-    d_prime(i) = (d(i) - a(i - 1) * d_prime(i - 1)) * m;
-  }
-
-  // Back substitution
-  x(n - 1) = d_prime(n - 1);
-
-  for (int64_t i = n - 2; i >= 0; i--) {
-    x(i) = d_prime(i) - c_prime(i) * x(i + 1);
+// lower bound of key in base_keys searched forward from start_idx, which is the lower bound of the
+// previous query key. Since the query keys are sorted, the lower bounds are found by walking
+// forward, and the binary search is used only when the next lower bound is far.
+size_t findLowerBoundFrom(
+  const std::vector<double> & base_keys, const double key, const size_t start_idx)
+{
+  constexpr size_t max_linear_search_num = 8;
+  size_t idx = start_idx;
+  for (size_t i = 0; i < max_linear_search_num; ++i) {
+    if (idx == base_keys.size() || !(base_keys[idx] < key)) {
+      return idx;
+    }
+    ++idx;
   }
+  return std::distance(
+    base_keys.begin(),
+    std::lower_bound(base_keys.begin() + static_cast<std::ptrdiff_t>(idx), base_keys.end(), key));
+}
 
-  return x;
+size_t toSegmentIndex(const size_t lower_bound_idx, const size_t base_keys_size)
+{
+  return static_cast<size_t>(std::clamp(
+    static_cast<int>(lower_bound_idx) - 1, 0, static_cast<int>(base_keys_size) - 2));
 }
+}  // namespace
 
 std::vector<double> spline(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
@@ -137,12 +134,10 @@ std::vector<double> splineByAkima(
   return res;
 }
 
-Eigen::Index SplineInterpolation::get_index(const double & key) const
+size_t SplineInterpolation::get_index(const double & key) const
 {
   const auto it = std::lower_bound(base_keys_.begin(), base_keys_.end(), key);
-  return std::clamp(
-    static_cast<int>(std::distance(base_keys_.begin(), it)) - 1, 0,
-    static_cast<int>(base_keys_.size()) - 2);
+  return toSegmentIndex(std::distance(base_keys_.begin(), it), base_keys_.size());
 }
 
 void SplineInterpolation::calcSplineCoefficients(
@@ -150,98 +145,146 @@ void SplineInterpolation::calcSplineCoefficients(
 {
   // throw exceptions for invalid arguments
   autoware::interpolation::validateKeysAndValues(base_keys, base_values);
-  const Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(
-    base_keys.data(), static_cast<Eigen::Index>(base_keys.size()));
-  const Eigen::VectorXd y = Eigen::Map<const Eigen::VectorXd>(
-    base_values.data(), static_cast<Eigen::Index>(base_values.size()));
-
-  const auto n = x.size();
+  const auto & x = base_keys;
+  const auto & y = base_values;
+
+  const size_t n = x.size();
+  a_.resize(n - 1);
+  b_.resize(n - 1);
+  c_.resize(n - 1);
+  d_.resize(n - 1);
+  base_keys_ = base_keys;
 
   if (n == 2) {
-    a_ = Eigen::VectorXd::Zero(1);
-    b_ = Eigen::VectorXd::Zero(1);
-    c_ = Eigen::VectorXd::Zero(1);
-    d_ = Eigen::VectorXd::Zero(1);
+    a_[0] = 0.0;
+    b_[0] = 0.0;
     c_[0] = (y[1] - y[0]) / (x[1] - x[0]);
     d_[0] = y[0];
-    base_keys_ = base_keys;
     return;
   }
 
-  // Create Tridiagonal matrix
-  Eigen::VectorXd v(n);
-  const Eigen::VectorXd h = x.segment(1, n - 1) - x.segment(0, n - 1);
-  const Eigen::VectorXd a = h.segment(1, n - 3);
-  const Eigen::VectorXd b = 2 * (h.segment(0, n - 2) + h.segment(1, n - 2));
-  const Eigen::VectorXd c = h.segment(1, n - 3);
-  const Eigen::VectorXd y_diff = y.segment(1, n - 1) - y.segment(0, n - 1);
-  const Eigen::VectorXd d = 6 * (y_diff.segment(1, n - 2).array() / h.tail(n - 2).array() -
-                                 y_diff.segment(0, n - 2).array() / h.head(n - 2).array());
+  h_.resize(n - 1);
+  for (size_t i = 0; i < n - 1; ++i) {
+    h_[i] = x[i + 1] - x[i];
+  }
+
+  // Solve the tridiagonal matrix of the 2nd differential values v_[1], ..., v_[n - 2] by the
+  // Thomas algorithm. The diagonal is 2 * (h_[i] + h_[i + 1]) and the off-diagonal is h_[i + 1].
+  // b_ and c_ hold the coefficients of the forward sweep until they are overwritten below.
+  const size_t m = n - 2;
+  const auto rhs = [&](const size_t i) {
+    return 6 * ((y[i + 2] - y[i + 1]) / h_[i + 1] - (y[i + 1] - y[i]) / h_[i]);
+  };
+  const auto diag = [&](const size_t i) { return 2 * (h_[i] + h_[i + 1]); };
+  auto & c_prime = b_;
+  auto & d_prime = c_;
+  v_.assign(n, 0.0);
+  if (m == 1) {
+    v_[1] = rhs(0) / diag(0);
+  } else {
+    // Forward sweep
+    c_prime[0] = h_[1] / diag(0);
+    d_prime[0] = rhs(0) / diag(0);
+    for (size_t i = 1; i < m; ++i) {
+      const double inv = 1.0 / (diag(i) - h_[i] * c_prime[i - 1]);
+      c_prime[i] = i < m - 1 ? h_[i + 1] * inv : 0;
+      d_prime[i] = (rhs(i) - h_[i] * d_prime[i - 1]) * inv;
+    }
 
-  // Solve tridiagonal matrix
-  v.segment(1, n - 2) = solve_tridiagonal_matrix_algorithm(a, b, c, d);
-  v[0] = 0;
-  v[n - 1] = 0;
+    // Back substitution
+    v_[m] = d_prime[m - 1];
+    for (size_t i = m - 1; i > 0; --i) {
+      v_[i] = d_prime[i - 1] - c_prime[i - 1] * v_[i + 1];
+    }
+  }
 
   // Calculate spline coefficients
-  a_ = (v.tail(n - 1) - v.head(n - 1)).array() / 6.0 / (x.tail(n - 1) - x.head(n - 1)).array();
-  b_ = v.segment(0, n - 1) / 2.0;
-  c_ = (y.tail(n - 1) - y.head(n - 1)).array() / (x.tail(n - 1) - x.head(n - 1)).array() -
-       (x.tail(n - 1) - x.head(n - 1)).array() *
-         (2 * v.segment(0, n - 1).array() + v.segment(1, n - 1).array()) / 6.0;
-  d_ = y.head(n - 1);
-  base_keys_ = base_keys;
+  for (size_t i = 0; i < n - 1; ++i) {
+    a_[i] = (v_[i + 1] - v_[i]) / 6.0 / h_[i];
+    b_[i] = v_[i] / 2.0;
+    c_[i] = (y[i + 1] - y[i]) / h_[i] - h_[i] * (2 * v_[i] + v_[i + 1]) / 6.0;
+    d_[i] = y[i];
+  }
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
   const std::vector<double> & query_keys) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = autoware::interpolation::validateKeys(base_keys_, query_keys);
   std::vector<double> interpolated_values;
-  interpolated_values.reserve(query_keys.size());
-
-  for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
-    const auto dx = key - base_keys_[idx];
-    interpolated_values.emplace_back(
-      a_[idx] * dx * dx * dx + b_[idx] * dx * dx + c_[idx] * dx + d_[idx]);
-  }
-
+  getSplineInterpolatedValues(query_keys, &interpolated_values);
   return interpolated_values;
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
   const std::vector<double> & query_keys) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = autoware::interpolation::validateKeys(base_keys_, query_keys);
   std::vector<double> interpolated_diff_values;
-  interpolated_diff_values.reserve(query_keys.size());
-
-  for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
-    const auto dx = key - base_keys_[idx];
-    interpolated_diff_values.emplace_back(3 * a_[idx] * dx * dx + 2 * b_[idx] * dx + c_[idx]);
-  }
-
+  getSplineInterpolatedValues(query_keys, nullptr, &interpolated_diff_values);
   return interpolated_diff_values;
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
   const std::vector<double> & query_keys) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = autoware::interpolation::validateKeys(base_keys_, query_keys);
   std::vector<double> interpolated_quad_diff_values;
-  interpolated_quad_diff_values.reserve(query_keys.size());
+  getSplineInterpolatedValues(query_keys, nullptr, nullptr, &interpolated_quad_diff_values);
+  return interpolated_quad_diff_values;
+}
 
-  for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
-    const auto dx = key - base_keys_[idx];
-    interpolated_quad_diff_values.emplace_back(6 * a_[idx] * dx + 2 * b_[idx]);
+void SplineInterpolation::getSplineInterpolatedValues(
+  const std::vector<double> & query_keys, std::vector<double> * values,
+  std::vector<double> * diff_values, std::vector<double> * quad_diff_values) const
+{
+  // throw exceptions for invalid arguments
+  autoware::interpolation::validateQueryKeys(base_keys_, query_keys);
+  for (auto * output : {values, diff_values, quad_diff_values}) {
+    if (output) {
+      output->resize(query_keys.size());
+    }
   }
 
-  return interpolated_quad_diff_values;
+  size_t lower_bound_idx = 0;
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    const double key = query_keys[i];
+    lower_bound_idx = findLowerBoundFrom(base_keys_, key, lower_bound_idx);
+    const size_t idx = toSegmentIndex(lower_bound_idx, base_keys_.size());
+    const double dx = key - base_keys_[idx];
+    if (values) {
+      (*values)[i] = a_[idx] * dx * dx * dx + b_[idx] * dx * dx + c_[idx] * dx + d_[idx];
+    }
+    if (diff_values) {
+      (*diff_values)[i] = 3 * a_[idx] * dx * dx + 2 * b_[idx] * dx + c_[idx];
+    }
+    if (quad_diff_values) {
+      (*quad_diff_values)[i] = 6 * a_[idx] * dx + 2 * b_[idx];
+    }
+  }
+}
+
+void SplineInterpolation::getSplineInterpolatedValue(
+  const double query_key, double * value, double * diff_value, double * quad_diff_value) const
+{
+  // throw exceptions for invalid arguments with the same tolerance as validateQueryKeys
+  if (base_keys_.size() < 2) {
+    throw std::invalid_argument(
+      "The size of points is less than 2. base_keys.size() = " +
+      std::to_string(base_keys_.size()));
+  }
+  constexpr double epsilon = 1e-3;
+  if (query_key < base_keys_.front() - epsilon || base_keys_.back() + epsilon < query_key) {
+    throw std::invalid_argument("query_keys is out of base_keys");
+  }
+
+  const size_t idx = get_index(query_key);
+  const double dx = query_key - base_keys_[idx];
+  if (value) {
+    *value = a_[idx] * dx * dx * dx + b_[idx] * dx * dx + c_[idx] * dx + d_[idx];
+  }
+  if (diff_value) {
+    *diff_value = 3 * a_[idx] * dx * dx + 2 * b_[idx] * dx + c_[idx];
+  }
+  if (quad_diff_value) {
+    *quad_diff_value = 6 * a_[idx] * dx + 2 * b_[idx];
+  }
 }
 }  // namespace autoware::interpolation
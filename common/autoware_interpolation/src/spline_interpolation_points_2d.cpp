@@ -18,6 +18,16 @@
 
 namespace autoware::interpolation
 {
+namespace
+{
+double calcCurvature(
+  const double diff_x, const double diff_y, const double quad_diff_x, const double quad_diff_y)
+{
+  return (diff_x * quad_diff_y - quad_diff_x * diff_y) /
+         std::pow(std::pow(diff_x, 2) + std::pow(diff_y, 2), 1.5);
+}
+}  // namespace
+
 std::vector<double> calcEuclidDist(const std::vector<double> & x, const std::vector<double> & y)
 {
   if (x.size() != y.size()) {
@@ -109,14 +119,10 @@ geometry_msgs::msg::Point SplineInterpolationPoints2d::getSplineInterpolatedPoin
     whole_s = base_s_vec_.back();
   }
 
-  const double x = spline_x_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double y = spline_y_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double z = spline_z_.getSplineInterpolatedValues({whole_s}).at(0);
-
   geometry_msgs::msg::Point geom_point;
-  geom_point.x = x;
-  geom_point.y = y;
-  geom_point.z = z;
+  spline_x_.getSplineInterpolatedValue(whole_s, &geom_point.x);
+  spline_y_.getSplineInterpolatedValue(whole_s, &geom_point.y);
+  spline_z_.getSplineInterpolatedValue(whole_s, &geom_point.z);
   return geom_point;
 }
 
@@ -129,18 +135,27 @@ double SplineInterpolationPoints2d::getSplineInterpolatedYaw(const size_t idx, c
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  double diff_x;
+  double diff_y;
+  spline_x_.getSplineInterpolatedValue(whole_s, nullptr, &diff_x);
+  spline_y_.getSplineInterpolatedValue(whole_s, nullptr, &diff_y);
 
   return std::atan2(diff_y, diff_x);
 }
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedYaws() const
 {
+  if (base_s_vec_.empty()) {
+    return {};
+  }
+
+  // evaluate all the base keys at once, which are sorted
+  std::vector<double> diff_x_vec;
   std::vector<double> yaw_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double yaw = getSplineInterpolatedYaw(i, 0.0);
-    yaw_vec.push_back(yaw);
+  spline_x_.getSplineInterpolatedValues(base_s_vec_, nullptr, &diff_x_vec);
+  spline_y_.getSplineInterpolatedValues(base_s_vec_, nullptr, &yaw_vec);
+  for (size_t i = 0; i < yaw_vec.size(); ++i) {
+    yaw_vec[i] = std::atan2(yaw_vec[i], diff_x_vec[i]);
   }
   return yaw_vec;
 }
@@ -155,22 +170,34 @@ double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  double diff_x;
+  double diff_y;
+  double quad_diff_x;
+  double quad_diff_y;
+  spline_x_.getSplineInterpolatedValue(whole_s, nullptr, &diff_x, &quad_diff_x);
+  spline_y_.getSplineInterpolatedValue(whole_s, nullptr, &diff_y, &quad_diff_y);
 
-  const double quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
-  const double quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
-
-  return (diff_x * quad_diff_y - quad_diff_x * diff_y) /
-         std::pow(std::pow(diff_x, 2) + std::pow(diff_y, 2), 1.5);
+  return calcCurvature(diff_x, diff_y, quad_diff_x, quad_diff_y);
 }
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures() const
 {
-  std::vector<double> curvature_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double curvature = getSplineInterpolatedCurvature(i, 0.0);
-    curvature_vec.push_back(curvature);
+  if (base_s_vec_.empty()) {
+    return {};
+  }
+
+  // evaluate all the base keys at once, which are sorted
+  std::vector<double> diff_x_vec;
+  std::vector<double> diff_y_vec;
+  std::vector<double> quad_diff_x_vec;
+  std::vector<double> quad_diff_y_vec;
+  spline_x_.getSplineInterpolatedValues(base_s_vec_, nullptr, &diff_x_vec, &quad_diff_x_vec);
+  spline_y_.getSplineInterpolatedValues(base_s_vec_, nullptr, &diff_y_vec, &quad_diff_y_vec);
+
+  std::vector<double> curvature_vec(base_s_vec_.size());
+  for (size_t i = 0; i < curvature_vec.size(); ++i) {
+    curvature_vec[i] =
+      calcCurvature(diff_x_vec[i], diff_y_vec[i], quad_diff_x_vec[i], quad_diff_y_vec[i]);
   }
   return curvature_vec;
 }
@@ -205,8 +232,8 @@ void SplineInterpolationPoints2d::calcSplineCoefficientsInner(
   const auto & base_z_vec = base.at(3);
 
   // calculate spline coefficients
-  spline_x_ = SplineInterpolation(base_s_vec_, base_x_vec);
-  spline_y_ = SplineInterpolation(base_s_vec_, base_y_vec);
-  spline_z_ = SplineInterpolation(base_s_vec_, base_z_vec);
+  spline_x_.calcSplineCoefficients(base_s_vec_, base_x_vec);
+  spline_y_.calcSplineCoefficients(base_s_vec_, base_y_vec);
+  spline_z_.calcSplineCoefficients(base_s_vec_, base_z_vec);
 }
 }  // namespace autoware::interpolation
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <stdexcept>
 #include <vector>
 
 constexpr double epsilon = 1e-6;
@@ -277,3 +278,50 @@ TEST(spline_interpolation, SplineInterpolation)
     }
   }
 }
+
+TEST(spline_interpolation, SplineInterpolationBatched)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+  const std::vector<double> query_keys{-1.5, 0.0, 0.0, 8.0, 12.0, 18.0, 20.0};
+
+  SplineInterpolation s(base_keys, base_values);
+  const auto ans_values = s.getSplineInterpolatedValues(query_keys);
+  const auto ans_diff_values = s.getSplineInterpolatedDiffValues(query_keys);
+  const auto ans_quad_diff_values = s.getSplineInterpolatedQuadDiffValues(query_keys);
+
+  {  // values and differential values in one call
+    std::vector<double> values;
+    std::vector<double> diff_values;
+    std::vector<double> quad_diff_values;
+    s.getSplineInterpolatedValues(query_keys, &values, &diff_values, &quad_diff_values);
+    EXPECT_EQ(values, ans_values);
+    EXPECT_EQ(diff_values, ans_diff_values);
+    EXPECT_EQ(quad_diff_values, ans_quad_diff_values);
+
+    // outputs are resized
+    std::vector<double> short_values{0.0};
+    s.getSplineInterpolatedValues({0.0, 8.0}, &short_values);
+    EXPECT_EQ(short_values.size(), 2u);
+  }
+
+  {  // single key
+    for (size_t i = 0; i < query_keys.size(); ++i) {
+      double value;
+      double diff_value;
+      double quad_diff_value;
+      s.getSplineInterpolatedValue(query_keys.at(i), &value, &diff_value, &quad_diff_value);
+      EXPECT_EQ(value, ans_values.at(i));
+      EXPECT_EQ(diff_value, ans_diff_values.at(i));
+      EXPECT_EQ(quad_diff_value, ans_quad_diff_values.at(i));
+    }
+    double value;
+    EXPECT_THROW(s.getSplineInterpolatedValue(21.0, &value), std::invalid_argument);
+  }
+
+  {  // recalculation on the same instance
+    SplineInterpolation reused_s(base_keys, {0.0, 1.0, 0.0, 1.0, 0.0, 1.0});
+    reused_s.calcSplineCoefficients(base_keys, base_values);
+    EXPECT_EQ(reused_s.getSplineInterpolatedValues(query_keys), ans_values);
+  }
+}
@@ -84,6 +84,10 @@ private:
   int max_delay_step_;  //!< @brief maximum number of delay steps
   int dim_x_;           //!< @brief dimension of latest state
   int dim_x_ex_;        //!< @brief dimension of extended state with dime delay
+
+  Eigen::MatrixXd PCT_;  //!< @brief buffer of P * C_ex' for updateWithDelay
+  Eigen::MatrixXd K_;    //!< @brief buffer of the kalman gain for updateWithDelay
+  Eigen::MatrixXd CP_;   //!< @brief buffer of C_ex * P for updateWithDelay
 };
 }  // namespace autoware::kalman_filter
 #endif  // AUTOWARE__KALMAN_FILTER__TIME_DELAY_KALMAN_FILTER_HPP_
@@ -14,6 +14,8 @@
 
 #include "autoware/kalman_filter/time_delay_kalman_filter.hpp"
 
+#include <algorithm>
+
 namespace autoware::kalman_filter
 {
 TimeDelayKalmanFilter::TimeDelayKalmanFilter()
@@ -34,6 +36,11 @@ void TimeDelayKalmanFilter::init(
     x_.block(i * dim_x_, 0, dim_x_, 1) = x;
     P_.block(i * dim_x_, i * dim_x_, dim_x_, dim_x_) = P0;
   }
+
+  // allocated once, a measurement larger than the state resizes them in updateWithDelay
+  PCT_ = Eigen::MatrixXd::Zero(dim_x_ex_, dim_x_);
+  K_ = Eigen::MatrixXd::Zero(dim_x_ex_, dim_x_);
+  CP_ = Eigen::MatrixXd::Zero(dim_x_, dim_x_ex_);
 }
 
 Eigen::MatrixXd TimeDelayKalmanFilter::getLatestX() const
@@ -65,19 +72,23 @@ bool TimeDelayKalmanFilter::predictWithDelay(
 
   const int d_dim_x = dim_x_ex_ - dim_x_;
 
-  /* slide states in the time direction */
-  Eigen::MatrixXd x_tmp = Eigen::MatrixXd::Zero(dim_x_ex_, 1);
-  x_tmp.block(0, 0, dim_x_, 1) = x_next;
-  x_tmp.block(dim_x_, 0, d_dim_x, 1) = x_.block(0, 0, d_dim_x, 1);
-  x_ = x_tmp;
+  /* slide states in the time direction, in place from the oldest one */
+  std::copy_backward(x_.data(), x_.data() + d_dim_x, x_.data() + dim_x_ex_);
+  x_.block(0, 0, dim_x_, 1) = x_next;
 
-  /* update P with delayed measurement A matrix structure */
-  Eigen::MatrixXd P_tmp = Eigen::MatrixXd::Zero(dim_x_ex_, dim_x_ex_);
-  P_tmp.block(0, 0, dim_x_, dim_x_) = A * P_.block(0, 0, dim_x_, dim_x_) * A.transpose() + Q;
-  P_tmp.block(0, dim_x_, dim_x_, d_dim_x) = A * P_.block(0, 0, dim_x_, d_dim_x);
-  P_tmp.block(dim_x_, 0, d_dim_x, dim_x_) = P_.block(0, 0, d_dim_x, dim_x_) * A.transpose();
-  P_tmp.block(dim_x_, dim_x_, d_dim_x, d_dim_x) = P_.block(0, 0, d_dim_x, d_dim_x);
-  P_ = P_tmp;
+  /*
+   * update P with delayed measurement A matrix structure, in place:
+   * P22 = P11 is slid first, then the other blocks are computed from it
+   */
+  // column j is moved to column j + dim_x_, so that no column is overwritten before it is moved
+  for (int j = d_dim_x - 1; j >= 0; --j) {
+    P_.block(dim_x_, j + dim_x_, d_dim_x, 1) = P_.block(0, j, d_dim_x, 1);
+  }
+  P_.block(0, dim_x_, dim_x_, d_dim_x).noalias() = A * P_.block(dim_x_, dim_x_, dim_x_, d_dim_x);
+  P_.block(dim_x_, 0, d_dim_x, dim_x_).noalias() =
+    P_.block(dim_x_, dim_x_, d_dim_x, dim_x_) * A.transpose();
+  P_.block(0, 0, dim_x_, dim_x_).noalias() = P_.block(0, dim_x_, dim_x_, dim_x_) * A.transpose();
+  P_.block(0, 0, dim_x_, dim_x_) += Q;
 
   return true;
 }
@@ -92,16 +103,36 @@ bool TimeDelayKalmanFilter::updateWithDelay(
   }
 
   const int dim_y = y.rows();
+  if (
+    C.cols() != dim_x_ || R.rows() != R.cols() || R.rows() != C.rows() || dim_y != C.rows()) {
+    return false;
+  }
+  if (dim_y > PCT_.cols()) {
+    PCT_.resize(dim_x_ex_, dim_y);
+    K_.resize(dim_x_ex_, dim_y);
+    CP_.resize(dim_y, dim_x_ex_);
+  }
+
+  /*
+   * update with the extended measurement matrix C_ex = [0 ... C ... 0], whose only non-zero block
+   * is at the delayed state, so only the columns and rows of P at that state are multiplied
+   */
+  const int delay_index = dim_x_ * delay_step;
+  auto PCT = PCT_.leftCols(dim_y);
+  auto K = K_.leftCols(dim_y);
+  auto CP = CP_.topRows(dim_y);
 
-  /* set measurement matrix */
-  Eigen::MatrixXd C_ex = Eigen::MatrixXd::Zero(dim_y, dim_x_ex_);
-  C_ex.block(0, dim_x_ * delay_step, dim_y, dim_x_) = C;
+  PCT.noalias() = P_.block(0, delay_index, dim_x_ex_, dim_x_) * C.transpose();
+  K.noalias() = PCT * (R + C * PCT.middleRows(delay_index, dim_x_)).inverse();
 
-  /* update */
-  if (!update(y, C_ex, R)) {
+  if (isnan(K.array()).any() || isinf(K.array()).any()) {
     return false;
   }
 
+  x_.noalias() += K * (y - C * x_.block(delay_index, 0, dim_x_, 1));
+  CP.noalias() = C * P_.block(delay_index, 0, dim_x_, dim_x_ex_);
+  P_.noalias() -= K * CP;
+
   return true;
 }
 }  // namespace autoware::kalman_filter
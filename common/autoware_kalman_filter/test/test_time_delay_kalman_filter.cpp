@@ -121,3 +121,76 @@ TEST(time_delay_kalman_filter, td_kf)
   EXPECT_NEAR(P_update(1, 1), P_update_expected(1, 1), 1e-5);
   EXPECT_NEAR(P_update(2, 2), P_update_expected(2, 2), 1e-5);
 }
+
+TEST(time_delay_kalman_filter, same_as_dense_extended_filter)
+{
+  const int dim_x = 4;
+  const int max_delay_step = 6;
+  const int dim_x_ex = dim_x * max_delay_step;
+
+  Eigen::MatrixXd x0(dim_x, 1);
+  x0 << 1.0, -2.0, 0.5, 3.0;
+  const Eigen::MatrixXd P0 = Eigen::MatrixXd::Identity(dim_x, dim_x) * 0.5;
+  TimeDelayKalmanFilter td_kf;
+  td_kf.init(x0, P0, max_delay_step);
+
+  // the extended filter with dense matrices
+  Eigen::MatrixXd x_ex = Eigen::MatrixXd::Zero(dim_x_ex, 1);
+  Eigen::MatrixXd P_ex = Eigen::MatrixXd::Zero(dim_x_ex, dim_x_ex);
+  for (int i = 0; i < max_delay_step; ++i) {
+    x_ex.block(i * dim_x, 0, dim_x, 1) = x0;
+    P_ex.block(i * dim_x, i * dim_x, dim_x, dim_x) = P0;
+  }
+
+  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(dim_x, dim_x);
+  A(0, 2) = 0.1;
+  A(1, 3) = 0.1;
+  const Eigen::MatrixXd Q = Eigen::MatrixXd::Identity(dim_x, dim_x) * 0.01;
+  Eigen::MatrixXd C2 = Eigen::MatrixXd::Zero(2, dim_x);
+  C2(0, 0) = 1.0;
+  C2(1, 1) = 1.0;
+  const Eigen::MatrixXd R2 = Eigen::MatrixXd::Identity(2, 2) * 0.1;
+  Eigen::MatrixXd C3 = Eigen::MatrixXd::Zero(3, dim_x);
+  C3(0, 1) = 1.0;
+  C3(1, 2) = 1.0;
+  C3(2, 3) = 1.0;
+  const Eigen::MatrixXd R3 = Eigen::MatrixXd::Identity(3, 3) * 0.2;
+
+  for (int step = 0; step < 20; ++step) {
+    const Eigen::MatrixXd x_next = A * x_ex.block(0, 0, dim_x, 1);
+    ASSERT_TRUE(td_kf.predictWithDelay(x_next, A, Q));
+
+    Eigen::MatrixXd A_ex = Eigen::MatrixXd::Zero(dim_x_ex, dim_x_ex);
+    A_ex.block(0, 0, dim_x, dim_x) = A;
+    A_ex.block(dim_x, 0, dim_x_ex - dim_x, dim_x_ex - dim_x).setIdentity();
+    Eigen::MatrixXd Q_ex = Eigen::MatrixXd::Zero(dim_x_ex, dim_x_ex);
+    Q_ex.block(0, 0, dim_x, dim_x) = Q;
+    x_ex = A_ex * x_ex;
+    P_ex = A_ex * P_ex * A_ex.transpose() + Q_ex;
+
+    // alternate the measurement sizes, so that the buffers of the gain are reused
+    const Eigen::MatrixXd & C = (step % 2 == 0) ? C2 : C3;
+    const Eigen::MatrixXd & R = (step % 2 == 0) ? R2 : R3;
+    const int delay_step = step % max_delay_step;
+    const Eigen::MatrixXd y = Eigen::MatrixXd::Constant(C.rows(), 1, 0.1 * step);
+    ASSERT_TRUE(td_kf.updateWithDelay(y, C, R, delay_step));
+
+    Eigen::MatrixXd C_ex = Eigen::MatrixXd::Zero(C.rows(), dim_x_ex);
+    C_ex.block(0, delay_step * dim_x, C.rows(), dim_x) = C;
+    const Eigen::MatrixXd PCT = P_ex * C_ex.transpose();
+    const Eigen::MatrixXd K = PCT * ((R + C_ex * PCT).inverse());
+    x_ex = x_ex + K * (y - C_ex * x_ex);
+    P_ex = P_ex - K * (C_ex * P_ex);
+
+    Eigen::MatrixXd x_result;
+    Eigen::MatrixXd P_result;
+    td_kf.getX(x_result);
+    td_kf.getP(P_result);
+    EXPECT_TRUE(x_result.isApprox(x_ex, 1e-9));
+    EXPECT_TRUE(P_result.isApprox(P_ex, 1e-9));
+  }
+
+  // a measurement of the wrong size is rejected
+  EXPECT_FALSE(td_kf.updateWithDelay(
+    Eigen::MatrixXd::Zero(2, 1), Eigen::MatrixXd::Zero(2, dim_x + 1), R2, 0));
+}
@@ -42,6 +42,15 @@ autoware_planning_msgs::msg::Trajectory convertToTrajectory(
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & trajectory,
   const std_msgs::msg::Header & header = std_msgs::msg::Header{});
 
+/**
+ * @brief Convert std::vector<autoware_planning_msgs::msg::TrajectoryPoint> to
+ * autoware_planning_msgs::msg::Trajectory, moving the points into the message instead of copying
+ * them.
+ */
+autoware_planning_msgs::msg::Trajectory convertToTrajectory(
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> && trajectory,
+  const std_msgs::msg::Header & header = std_msgs::msg::Header{});
+
 /**
  * @brief Convert autoware_planning_msgs::msg::Trajectory to
  * std::vector<autoware_planning_msgs::msg::TrajectoryPoint>.
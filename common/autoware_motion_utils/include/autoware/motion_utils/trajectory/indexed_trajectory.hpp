@@ -0,0 +1,533 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MOTION_UTILS__TRAJECTORY__INDEXED_TRAJECTORY_HPP_
+#define AUTOWARE__MOTION_UTILS__TRAJECTORY__INDEXED_TRAJECTORY_HPP_
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::motion_utils
+{
+/**
+ * @brief view of points of trajectory, path, ... with the prefix arc lengths, the next non
+ * overlapping points and a uniform grid of the points calculated once
+ * @details the member functions return the same values as the free functions of the same names
+ * for the points, except the rounding error of the arc lengths calculated from the prefix sums.
+ * The nearest point is searched in the cells around the given point instead of all the points.
+ * The points are not copied, so they must outlive the view and must not be modified.
+ * @param T container of the points, e.g. std::vector<autoware_planning_msgs::msg::TrajectoryPoint>
+ */
+template <class T>
+class IndexedTrajectory
+{
+public:
+  explicit IndexedTrajectory(const T & points, const double cell_size = 2.0)
+  : points_(&points), cell_size_(cell_size)
+  {
+    validateNonEmpty(points);
+
+    arc_lengths_.resize(points.size(), 0.0);
+    for (size_t i = 1; i < points.size(); ++i) {
+      arc_lengths_.at(i) = arc_lengths_.at(i - 1) +
+                           autoware::universe_utils::calcDistance2d(points.at(i - 1), points.at(i));
+    }
+
+    // same as the points kept by removeOverlapPoints
+    next_distinct_indices_.resize(points.size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      for (size_t j = i + 1; j < points.size(); ++j) {
+        if (!isOverlapped(i, j)) {
+          next_distinct_indices_.at(i) = j;
+          break;
+        }
+      }
+    }
+    distinct_ranks_.resize(points.size(), std::nullopt);
+    for (size_t i = 0; i < points.size(); i = next_distinct_indices_.at(i)) {
+      distinct_ranks_.at(i) = distinct_indices_.size();
+      distinct_indices_.push_back(i);
+    }
+
+    min_cell_x_ = min_cell_y_ = std::numeric_limits<int64_t>::max();
+    max_cell_x_ = max_cell_y_ = std::numeric_limits<int64_t>::min();
+    for (size_t i = 0; i < points.size(); ++i) {
+      const auto p = autoware::universe_utils::getPoint(points.at(i));
+      const auto cell_x = toCellIndex(p.x);
+      const auto cell_y = toCellIndex(p.y);
+      cells_[toCellKey(cell_x, cell_y)].push_back(i);
+      min_cell_x_ = std::min(min_cell_x_, cell_x);
+      min_cell_y_ = std::min(min_cell_y_, cell_y);
+      max_cell_x_ = std::max(max_cell_x_, cell_x);
+      max_cell_y_ = std::max(max_cell_y_, cell_y);
+    }
+  }
+
+  const T & points() const { return *points_; }
+
+  /**
+   * @brief same as findNearestIndex(points, point)
+   */
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const
+  {
+    return *findNearestIndexImpl(
+      point, std::numeric_limits<double>::max(), [](const size_t) { return true; });
+  }
+
+  /**
+   * @brief same as findNearestIndex(points, pose, max_dist, max_yaw)
+   */
+  std::optional<size_t> findNearestIndex(
+    const geometry_msgs::msg::Pose & pose,
+    const double max_dist = std::numeric_limits<double>::max(),
+    const double max_yaw = std::numeric_limits<double>::max()) const
+  {
+    return findNearestIndexImpl(pose.position, max_dist, [&](const size_t i) {
+      const auto yaw = autoware::universe_utils::calcYawDeviation(
+        autoware::universe_utils::getPose(points_->at(i)), pose);
+      return std::fabs(yaw) <= max_yaw;
+    });
+  }
+
+  /**
+   * @brief same as calcLongitudinalOffsetToSegment(points, seg_idx, p_target, throw_exception)
+   */
+  double calcLongitudinalOffsetToSegment(
+    const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+    const bool throw_exception = false) const
+  {
+    if (seg_idx >= points_->size() - 1) {
+      return handleError<std::out_of_range>(
+        std::string(__func__) +
+          ": Failed to calculate longitudinal offset because the given segment index is out of "
+          "the points size.",
+        throw_exception);
+    }
+    const size_t next_idx = next_distinct_indices_.at(seg_idx);
+    if (next_idx >= points_->size()) {
+      return handleError<std::runtime_error>(
+        std::string(__func__) +
+          ": Longitudinal offset calculation is not supported for the same points.",
+        throw_exception);
+    }
+    return calcLongitudinalOffset(seg_idx, next_idx, p_target);
+  }
+
+  /**
+   * @brief same as findNearestSegmentIndex(points, point)
+   */
+  size_t findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const
+  {
+    return toSegmentIndex(findNearestIndex(point), point);
+  }
+
+  /**
+   * @brief same as findNearestSegmentIndex(points, pose, max_dist, max_yaw)
+   */
+  std::optional<size_t> findNearestSegmentIndex(
+    const geometry_msgs::msg::Pose & pose,
+    const double max_dist = std::numeric_limits<double>::max(),
+    const double max_yaw = std::numeric_limits<double>::max()) const
+  {
+    const auto nearest_idx = findNearestIndex(pose, max_dist, max_yaw);
+    if (!nearest_idx) {
+      return std::nullopt;
+    }
+    return toSegmentIndex(*nearest_idx, pose.position);
+  }
+
+  /**
+   * @brief same as calcLateralOffset(points, p_target, seg_idx, throw_exception)
+   */
+  double calcLateralOffset(
+    const geometry_msgs::msg::Point & p_target, const size_t seg_idx,
+    const bool throw_exception = false) const
+  {
+    if (distinct_indices_.size() == 1) {
+      return handleError<std::runtime_error>(
+        std::string(__func__) +
+          ": Lateral offset calculation is not supported for the same points.",
+        throw_exception);
+    }
+    const size_t front_rank = std::min(seg_idx, distinct_indices_.size() - 2);
+    const auto p_front =
+      autoware::universe_utils::getPoint(points_->at(distinct_indices_.at(front_rank)));
+    const auto p_back =
+      autoware::universe_utils::getPoint(points_->at(distinct_indices_.at(front_rank + 1)));
+
+    const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0.0};
+    const Eigen::Vector3d target_vec{p_target.x - p_front.x, p_target.y - p_front.y, 0.0};
+    const Eigen::Vector3d cross_vec = segment_vec.cross(target_vec);
+    return cross_vec(2) / segment_vec.norm();
+  }
+
+  /**
+   * @brief same as calcLateralOffset(points, p_target, throw_exception)
+   */
+  double calcLateralOffset(
+    const geometry_msgs::msg::Point & p_target, const bool throw_exception = false) const
+  {
+    if (distinct_indices_.size() == 1) {
+      return calcLateralOffset(p_target, 0, throw_exception);
+    }
+
+    // the nearest segment of the points without the overlapping points
+    const size_t nearest_idx = *findNearestIndexImpl(
+      p_target, std::numeric_limits<double>::max(),
+      [&](const size_t i) { return distinct_ranks_.at(i).has_value(); });
+    const size_t nearest_rank = *distinct_ranks_.at(nearest_idx);
+    size_t seg_rank = nearest_rank;
+    if (nearest_rank == 0) {
+      seg_rank = 0;
+    } else if (nearest_rank == distinct_indices_.size() - 1) {
+      seg_rank = distinct_indices_.size() - 2;
+    } else if (
+      calcLongitudinalOffset(nearest_idx, distinct_indices_.at(nearest_rank + 1), p_target) <= 0) {
+      seg_rank = nearest_rank - 1;
+    }
+    return calcLateralOffset(p_target, seg_rank, throw_exception);
+  }
+
+  /**
+   * @brief same as calcSignedArcLength(points, src_idx, dst_idx)
+   */
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+  {
+    return arc_lengths_.at(dst_idx) - arc_lengths_.at(src_idx);
+  }
+
+  /**
+   * @brief same as calcSignedArcLength(points, src_point, dst_idx)
+   */
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const
+  {
+    const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+    return calcSignedArcLength(src_seg_idx, dst_idx) -
+           calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+  }
+
+  /**
+   * @brief same as calcSignedArcLength(points, src_idx, dst_point)
+   */
+  double calcSignedArcLength(
+    const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const
+  {
+    return -calcSignedArcLength(dst_point, src_idx);
+  }
+
+  /**
+   * @brief same as calcSignedArcLength(points, src_point, dst_point)
+   */
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const
+  {
+    const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+    const size_t dst_seg_idx = findNearestSegmentIndex(dst_point);
+    return calcSignedArcLength(src_seg_idx, dst_seg_idx) -
+           calcLongitudinalOffsetToSegment(src_seg_idx, src_point) +
+           calcLongitudinalOffsetToSegment(dst_seg_idx, dst_point);
+  }
+
+  /**
+   * @brief same as calcArcLength(points)
+   */
+  double calcArcLength() const { return arc_lengths_.back(); }
+
+  /**
+   * @brief same as findFirstNearestIndexWithSoftConstraints(points, pose, dist_threshold,
+   * yaw_threshold)
+   */
+  size_t findFirstNearestIndexWithSoftConstraints(
+    const geometry_msgs::msg::Pose & pose,
+    const double dist_threshold = std::numeric_limits<double>::max(),
+    const double yaw_threshold = std::numeric_limits<double>::max()) const
+  {
+    // the points within the distance threshold are too many to be searched in the cells
+    const auto within_dist_indices = findIndicesWithinDistance(pose.position, dist_threshold);
+    if (!within_dist_indices) {
+      return autoware::motion_utils::findFirstNearestIndexWithSoftConstraints(
+        *points_, pose, dist_threshold, yaw_threshold);
+    }
+
+    std::vector<size_t> within_yaw_indices;
+    for (const auto i : *within_dist_indices) {
+      const auto yaw = autoware::universe_utils::calcYawDeviation(
+        autoware::universe_utils::getPose(points_->at(i)), pose);
+      if (std::abs(yaw) <= yaw_threshold) {
+        within_yaw_indices.push_back(i);
+      }
+    }
+
+    // the nearest point in the first sequence of the points within the constraints
+    const auto find_first_nearest_index = [&](const std::vector<size_t> & indices) {
+      double min_squared_dist = std::numeric_limits<double>::max();
+      size_t min_idx = indices.front();
+      for (size_t k = 0; k < indices.size(); ++k) {
+        if (0 < k && indices.at(k) != indices.at(k - 1) + 1) {
+          break;
+        }
+        const auto squared_dist = autoware::universe_utils::calcSquaredDistance2d(
+          points_->at(indices.at(k)), pose.position);
+        if (squared_dist < min_squared_dist) {
+          min_squared_dist = squared_dist;
+          min_idx = indices.at(k);
+        }
+      }
+      return min_idx;
+    };
+    if (!within_yaw_indices.empty()) {
+      return find_first_nearest_index(within_yaw_indices);
+    }
+    if (!within_dist_indices->empty()) {
+      return find_first_nearest_index(*within_dist_indices);
+    }
+
+    return findNearestIndex(pose.position);
+  }
+
+  /**
+   * @brief same as findFirstNearestSegmentIndexWithSoftConstraints(points, pose, dist_threshold,
+   * yaw_threshold)
+   */
+  size_t findFirstNearestSegmentIndexWithSoftConstraints(
+    const geometry_msgs::msg::Pose & pose,
+    const double dist_threshold = std::numeric_limits<double>::max(),
+    const double yaw_threshold = std::numeric_limits<double>::max()) const
+  {
+    return toSegmentIndex(
+      findFirstNearestIndexWithSoftConstraints(pose, dist_threshold, yaw_threshold), pose.position);
+  }
+
+private:
+  bool isOverlapped(const size_t i, const size_t j) const
+  {
+    constexpr double eps = 1.0E-08;
+    const auto p_i = autoware::universe_utils::getPoint(points_->at(i));
+    const auto p_j = autoware::universe_utils::getPoint(points_->at(j));
+    return std::abs(p_i.x - p_j.x) < eps && std::abs(p_i.y - p_j.y) < eps;
+  }
+
+  int64_t toCellIndex(const double value) const
+  {
+    return static_cast<int64_t>(std::floor(value / cell_size_));
+  }
+
+  static uint64_t toCellKey(const int64_t x, const int64_t y)
+  {
+    return (static_cast<uint64_t>(x) << 32) ^ static_cast<uint32_t>(y);
+  }
+
+  template <class ExceptionT>
+  double handleError(const std::string & message, const bool throw_exception) const
+  {
+    const std::string error_message("[autoware_motion_utils] " + message);
+    autoware::universe_utils::print_backtrace();
+    if (throw_exception) {
+      throw ExceptionT(error_message);
+    }
+    RCLCPP_DEBUG(
+      get_logger(),
+      "%s Return NaN since no_throw option is enabled. The maintainer must check the code.",
+      error_message.c_str());
+    return std::nan("");
+  }
+
+  double calcLongitudinalOffset(
+    const size_t front_idx, const size_t back_idx, const geometry_msgs::msg::Point & p_target) const
+  {
+    const auto p_front = autoware::universe_utils::getPoint(points_->at(front_idx));
+    const auto p_back = autoware::universe_utils::getPoint(points_->at(back_idx));
+
+    const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0};
+    const Eigen::Vector3d target_vec{p_target.x - p_front.x, p_target.y - p_front.y, 0};
+    return segment_vec.dot(target_vec) / segment_vec.norm();
+  }
+
+  size_t toSegmentIndex(const size_t nearest_idx, const geometry_msgs::msg::Point & point) const
+  {
+    if (nearest_idx == 0) {
+      return 0;
+    }
+    if (nearest_idx == points_->size() - 1) {
+      return points_->size() - 2;
+    }
+    if (calcLongitudinalOffsetToSegment(nearest_idx, point) <= 0) {
+      return nearest_idx - 1;
+    }
+    return nearest_idx;
+  }
+
+  /**
+   * @brief the index of the nearest point among the valid points within max_dist, where the first
+   * index is taken among the points of the same distance
+   * @details the cells are searched from the cell of the point in the order of the chebyshev
+   * distance until the points in the remaining cells cannot be nearer than the nearest one. If
+   * the cells to search are more than the points, all the points are searched instead.
+   */
+  template <class IsValid>
+  std::optional<size_t> findNearestIndexImpl(
+    const geometry_msgs::msg::Point & point, const double max_dist, const IsValid & is_valid) const
+  {
+    const double max_squared_dist = max_dist * max_dist;
+    double min_squared_dist = std::numeric_limits<double>::max();
+    std::optional<size_t> min_idx = std::nullopt;
+    const auto update = [&](const size_t i) {
+      const auto squared_dist =
+        autoware::universe_utils::calcSquaredDistance2d(points_->at(i), point);
+      if (
+        squared_dist > max_squared_dist || squared_dist > min_squared_dist ||
+        (squared_dist == min_squared_dist && min_idx && *min_idx < i) || !is_valid(i)) {
+        return;
+      }
+      min_squared_dist = squared_dist;
+      min_idx = i;
+    };
+
+    // the rings from the first one overlapping the cells of the points to the last one covering
+    // all of them
+    const auto cell_x = toCellIndex(point.x);
+    const auto cell_y = toCellIndex(point.y);
+    const int64_t min_ring = std::max(
+      {min_cell_x_ - cell_x, cell_x - max_cell_x_, min_cell_y_ - cell_y, cell_y - max_cell_y_,
+       int64_t{0}});
+    const int64_t max_ring = std::max(
+      {std::abs(cell_x - min_cell_x_), std::abs(cell_x - max_cell_x_),
+       std::abs(cell_y - min_cell_y_), std::abs(cell_y - max_cell_y_)});
+
+    size_t searched_cells_num = 0;
+    const auto search_cell = [&](const int64_t x, const int64_t y) {
+      ++searched_cells_num;
+      if (const auto cell = cells_.find(toCellKey(x, y)); cell != cells_.end()) {
+        for (const auto i : cell->second) {
+          update(i);
+        }
+      }
+    };
+    for (int64_t ring = min_ring; ring <= max_ring; ++ring) {
+      if (searched_cells_num > points_->size()) {
+        min_idx = std::nullopt;
+        min_squared_dist = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < points_->size(); ++i) {
+          update(i);
+        }
+        return min_idx;
+      }
+
+      // the cells on the border of the ring
+      const auto min_x = std::max(cell_x - ring, min_cell_x_);
+      const auto max_x = std::min(cell_x + ring, max_cell_x_);
+      const auto min_y = std::max(cell_y - ring, min_cell_y_);
+      const auto max_y = std::min(cell_y + ring, max_cell_y_);
+      for (auto x = min_x; x <= max_x; ++x) {
+        if (x == cell_x - ring || x == cell_x + ring) {
+          for (auto y = min_y; y <= max_y; ++y) {
+            search_cell(x, y);
+          }
+          continue;
+        }
+        if (min_cell_y_ <= cell_y - ring) {
+          search_cell(x, cell_y - ring);
+        }
+        if (cell_y + ring <= max_cell_y_) {
+          search_cell(x, cell_y + ring);
+        }
+      }
+
+      // the points in the outer rings are farther than ring * cell_size_
+      const double outer_squared_dist = std::pow(ring * cell_size_, 2);
+      if (
+        (min_idx && min_squared_dist < outer_squared_dist) ||
+        max_squared_dist < outer_squared_dist) {
+        break;
+      }
+    }
+    return min_idx;
+  }
+
+  /**
+   * @brief sorted indices of the points within the distance, std::nullopt if the cells to search
+   * are more than the points
+   */
+  std::optional<std::vector<size_t>> findIndicesWithinDistance(
+    const geometry_msgs::msg::Point & point, const double dist) const
+  {
+    if (!(dist / cell_size_ < static_cast<double>(points_->size()))) {
+      return std::nullopt;
+    }
+    const auto min_x = std::max(toCellIndex(point.x - dist), min_cell_x_);
+    const auto max_x = std::min(toCellIndex(point.x + dist), max_cell_x_);
+    const auto min_y = std::max(toCellIndex(point.y - dist), min_cell_y_);
+    const auto max_y = std::min(toCellIndex(point.y + dist), max_cell_y_);
+    if (
+      max_x >= min_x && max_y >= min_y &&
+      static_cast<double>(max_x - min_x + 1) * static_cast<double>(max_y - min_y + 1) >
+        static_cast<double>(points_->size())) {
+      return std::nullopt;
+    }
+
+    const double squared_dist = dist * dist;
+    std::vector<size_t> indices;
+    for (auto x = min_x; x <= max_x; ++x) {
+      for (auto y = min_y; y <= max_y; ++y) {
+        const auto cell = cells_.find(toCellKey(x, y));
+        if (cell == cells_.end()) {
+          continue;
+        }
+        for (const auto i : cell->second) {
+          const auto squared_dist_to_point =
+            autoware::universe_utils::calcSquaredDistance2d(points_->at(i), point);
+          if (squared_dist_to_point <= squared_dist) {
+            indices.push_back(i);
+          }
+        }
+      }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  }
+
+  const T * points_;
+  double cell_size_;
+
+  std::vector<double> arc_lengths_;
+  //! index of the next point not overlapping with the point, the size of the points if not found
+  std::vector<size_t> next_distinct_indices_;
+  //! indices of the points kept by removeOverlapPoints(points, 0)
+  std::vector<size_t> distinct_indices_;
+  //! rank of the point in distinct_indices_, std::nullopt if the point is removed as overlapping
+  std::vector<std::optional<size_t>> distinct_ranks_;
+
+  std::unordered_map<uint64_t, std::vector<size_t>> cells_;
+  int64_t min_cell_x_;
+  int64_t min_cell_y_;
+  int64_t max_cell_x_;
+  int64_t max_cell_y_;
+};
+
+extern template class IndexedTrajectory<std::vector<autoware_planning_msgs::msg::PathPoint>>;
+extern template class IndexedTrajectory<std::vector<tier4_planning_msgs::msg::PathPointWithLaneId>>;
+extern template class IndexedTrajectory<std::vector<autoware_planning_msgs::msg::TrajectoryPoint>>;
+}  // namespace autoware::motion_utils
+
+#endif  // AUTOWARE__MOTION_UTILS__TRAJECTORY__INDEXED_TRAJECTORY_HPP_
@@ -25,6 +25,46 @@
 
 namespace autoware::motion_utils
 {
+namespace
+{
+// segment indices and ratios of the query keys on the base keys, which are shared by all the
+// linearly interpolated fields so that each output point is filled in one pass. The keys are
+// validated and the indices are searched in the same way as autoware::interpolation::lerp.
+struct LerpIndices
+{
+  std::vector<size_t> indices;
+  std::vector<double> ratios;
+};
+
+LerpIndices calcLerpIndices(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys)
+{
+  const auto validated_query_keys = autoware::interpolation::validateKeys(base_keys, query_keys);
+
+  LerpIndices lerp_indices;
+  lerp_indices.indices.reserve(validated_query_keys.size());
+  lerp_indices.ratios.reserve(validated_query_keys.size());
+  size_t key_index = 0;
+  for (const auto query_key : validated_query_keys) {
+    while (base_keys.at(key_index + 1) < query_key) {
+      ++key_index;
+    }
+    lerp_indices.indices.push_back(key_index);
+    lerp_indices.ratios.push_back(
+      (query_key - base_keys.at(key_index)) /
+      (base_keys.at(key_index + 1) - base_keys.at(key_index)));
+  }
+  return lerp_indices;
+}
+
+double lerpAt(const LerpIndices & lerp_indices, const size_t i, const std::vector<double> & values)
+{
+  const size_t idx = lerp_indices.indices.at(i);
+  return autoware::interpolation::lerp(
+    values.at(idx), values.at(idx + 1), lerp_indices.ratios.at(i));
+}
+}  // namespace
+
 std::vector<geometry_msgs::msg::Point> resamplePointVector(
   const std::vector<geometry_msgs::msg::Point> & points,
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
@@ -279,80 +319,64 @@ tier4_planning_msgs::msg::PathWithLaneId resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampling_arclength);
-  };
-
-  auto closest_segment_indices =
+  const auto closest_segment_indices =
     autoware::interpolation::calc_closest_segment_indices(input_arclength, resampling_arclength);
-
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
-  };
+  const auto lerp_indices = calcLerpIndices(input_arclength, resampling_arclength);
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampling_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_is_final = zoh(is_final);
-
-  // interpolate lane_ids
-  std::vector<std::vector<int64_t>> interpolated_lane_ids;
-  interpolated_lane_ids.resize(resampling_arclength.size());
+
+  if (interpolated_pose.size() != resampling_arclength.size()) {
+    std::cerr
+      << "[autoware_motion_utils]: Resampled pose size is different from resampled arclength"
+      << std::endl;
+    return input_path;
+  }
+
+  tier4_planning_msgs::msg::PathWithLaneId resampled_path;
+  resampled_path.header = input_path.header;
+  resampled_path.left_bound = input_path.left_bound;
+  resampled_path.right_bound = input_path.right_bound;
+  resampled_path.points.resize(interpolated_pose.size());
   constexpr double epsilon = 1e-6;
-  for (size_t i = 0; i < resampling_arclength.size(); ++i) {
-    const size_t seg_idx = std::min(closest_segment_indices.at(i), input_path.points.size() - 2);
+  for (size_t i = 0; i < resampled_path.points.size(); ++i) {
+    const size_t zoh_idx = closest_segment_indices.at(i);
+
+    auto & path_point = resampled_path.points.at(i).point;
+    path_point.pose = interpolated_pose.at(i);
+    path_point.longitudinal_velocity_mps =
+      use_zero_order_hold_for_v ? v_lon.at(zoh_idx) : lerpAt(lerp_indices, i, v_lon);
+    path_point.lateral_velocity_mps =
+      use_zero_order_hold_for_v ? v_lat.at(zoh_idx) : lerpAt(lerp_indices, i, v_lat);
+    path_point.heading_rate_rps = lerpAt(lerp_indices, i, heading_rate);
+    path_point.is_final = is_final.at(zoh_idx);
+
+    // interpolate lane_ids
+    auto & interpolated_lane_ids = resampled_path.points.at(i).lane_ids;
+    const size_t seg_idx = std::min(zoh_idx, input_path.points.size() - 2);
     const auto & prev_lane_ids = input_path.points.at(seg_idx).lane_ids;
     const auto & next_lane_ids = input_path.points.at(seg_idx + 1).lane_ids;
 
     if (std::abs(input_arclength.at(seg_idx) - resampling_arclength.at(i)) <= epsilon) {
-      interpolated_lane_ids.at(i).insert(
-        interpolated_lane_ids.at(i).end(), prev_lane_ids.begin(), prev_lane_ids.end());
+      interpolated_lane_ids = prev_lane_ids;
     } else if (std::abs(input_arclength.at(seg_idx + 1) - resampling_arclength.at(i)) <= epsilon) {
-      interpolated_lane_ids.at(i).insert(
-        interpolated_lane_ids.at(i).end(), next_lane_ids.begin(), next_lane_ids.end());
+      interpolated_lane_ids = next_lane_ids;
     } else {
       // extract lane_ids those prev_lane_ids and next_lane_ids have in common
       for (const auto target_lane_id : prev_lane_ids) {
         if (
           std::find(next_lane_ids.begin(), next_lane_ids.end(), target_lane_id) !=
           next_lane_ids.end()) {
-          interpolated_lane_ids.at(i).push_back(target_lane_id);
+          interpolated_lane_ids.push_back(target_lane_id);
         }
       }
       // If there are no common lane_ids, the prev_lane_ids is assigned.
-      if (interpolated_lane_ids.at(i).empty()) {
-        interpolated_lane_ids.at(i).insert(
-          interpolated_lane_ids.at(i).end(), prev_lane_ids.begin(), prev_lane_ids.end());
+      if (interpolated_lane_ids.empty()) {
+        interpolated_lane_ids = prev_lane_ids;
       }
     }
   }
 
-  if (interpolated_pose.size() != resampling_arclength.size()) {
-    std::cerr
-      << "[autoware_motion_utils]: Resampled pose size is different from resampled arclength"
-      << std::endl;
-    return input_path;
-  }
-
-  tier4_planning_msgs::msg::PathWithLaneId resampled_path;
-  resampled_path.header = input_path.header;
-  resampled_path.left_bound = input_path.left_bound;
-  resampled_path.right_bound = input_path.right_bound;
-  resampled_path.points.resize(interpolated_pose.size());
-  for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_planning_msgs::msg::PathPoint path_point;
-    path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    path_point.is_final = interpolated_is_final.at(i);
-    resampled_path.points.at(i).point = path_point;
-    resampled_path.points.at(i).lane_ids = interpolated_lane_ids.at(i);
-  }
-
   return resampled_path;
 }
 
@@ -462,25 +486,15 @@ autoware_planning_msgs::msg::Path resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-
   std::vector<size_t> closest_segment_indices;
   if (use_zero_order_hold_for_v) {
     closest_segment_indices =
       autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
   }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
-  };
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
+  const auto lerp_indices = calcLerpIndices(input_arclength, resampled_arclength);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr
@@ -495,12 +509,15 @@ autoware_planning_msgs::msg::Path resamplePath(
   resampled_path.right_bound = input_path.right_bound;
   resampled_path.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_planning_msgs::msg::PathPoint path_point;
+    auto & path_point = resampled_path.points.at(i);
     path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    resampled_path.points.at(i) = path_point;
+    path_point.longitudinal_velocity_mps = use_zero_order_hold_for_v
+                                             ? v_lon.at(closest_segment_indices.at(i))
+                                             : lerpAt(lerp_indices, i, v_lon);
+    path_point.lateral_velocity_mps = use_zero_order_hold_for_v
+                                        ? v_lat.at(closest_segment_indices.at(i))
+                                        : lerpAt(lerp_indices, i, v_lat);
+    path_point.heading_rate_rps = lerpAt(lerp_indices, i, heading_rate);
   }
 
   return resampled_path;
@@ -637,30 +654,15 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-
   std::vector<size_t> closest_segment_indices;
   if (use_zero_order_hold_for_twist) {
     closest_segment_indices =
       autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
   }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
-  };
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_acceleration =
-    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
-  const auto interpolated_front_wheel_angle = lerp(front_wheel_angle);
-  const auto interpolated_rear_wheel_angle = lerp(rear_wheel_angle);
-  const auto interpolated_time_from_start = lerp(time_from_start);
+  const auto lerp_indices = calcLerpIndices(input_arclength, resampled_arclength);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr
@@ -673,16 +675,21 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   resampled_trajectory.header = input_trajectory.header;
   resampled_trajectory.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_trajectory.points.size(); ++i) {
-    autoware_planning_msgs::msg::TrajectoryPoint traj_point;
+    const auto twist = [&](const std::vector<double> & values) {
+      return use_zero_order_hold_for_twist ? values.at(closest_segment_indices.at(i))
+                                           : lerpAt(lerp_indices, i, values);
+    };
+
+    auto & traj_point = resampled_trajectory.points.at(i);
     traj_point.pose = interpolated_pose.at(i);
-    traj_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    traj_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    traj_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    traj_point.acceleration_mps2 = interpolated_acceleration.at(i);
-    traj_point.front_wheel_angle_rad = interpolated_front_wheel_angle.at(i);
-    traj_point.rear_wheel_angle_rad = interpolated_rear_wheel_angle.at(i);
-    traj_point.time_from_start = rclcpp::Duration::from_seconds(interpolated_time_from_start.at(i));
-    resampled_trajectory.points.at(i) = traj_point;
+    traj_point.longitudinal_velocity_mps = twist(v_lon);
+    traj_point.lateral_velocity_mps = twist(v_lat);
+    traj_point.heading_rate_rps = lerpAt(lerp_indices, i, heading_rate);
+    traj_point.acceleration_mps2 = twist(acceleration);
+    traj_point.front_wheel_angle_rad = lerpAt(lerp_indices, i, front_wheel_angle);
+    traj_point.rear_wheel_angle_rad = lerpAt(lerp_indices, i, rear_wheel_angle);
+    traj_point.time_from_start =
+      rclcpp::Duration::from_seconds(lerpAt(lerp_indices, i, time_from_start));
   }
 
   return resampled_trajectory;
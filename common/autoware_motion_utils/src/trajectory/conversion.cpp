@@ -15,6 +15,7 @@
 #include "autoware/motion_utils/trajectory/conversion.hpp"
 
 #include <algorithm>
+#include <utility>
 
 namespace autoware::motion_utils
 {
@@ -35,7 +36,17 @@ autoware_planning_msgs::msg::Trajectory convertToTrajectory(
 {
   autoware_planning_msgs::msg::Trajectory output{};
   output.header = header;
-  for (const auto & pt : trajectory) output.points.push_back(pt);
+  output.points = trajectory;
+  return output;
+}
+
+autoware_planning_msgs::msg::Trajectory convertToTrajectory(
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> && trajectory,
+  const std_msgs::msg::Header & header)
+{
+  autoware_planning_msgs::msg::Trajectory output{};
+  output.header = header;
+  output.points = std::move(trajectory);
   return output;
 }
 
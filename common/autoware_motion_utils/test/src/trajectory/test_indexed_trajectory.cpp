@@ -0,0 +1,147 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/indexed_trajectory.hpp"
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware::motion_utils::IndexedTrajectory;
+using autoware::universe_utils::createPoint;
+using autoware::universe_utils::createQuaternionFromYaw;
+using TrajectoryPointArray = std::vector<autoware_planning_msgs::msg::TrajectoryPoint>;
+
+constexpr double epsilon = 1e-6;
+
+// a curve with an overlapping point in the middle, which is skipped as removeOverlapPoints does
+TrajectoryPointArray generateTestPoints()
+{
+  TrajectoryPointArray points;
+  double x = 0.0;
+  double y = 0.0;
+  for (size_t i = 0; i < 50; ++i) {
+    const double yaw = 0.05 * i;
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    p.pose.position = createPoint(x, y, 0.0);
+    p.pose.orientation = createQuaternionFromYaw(yaw);
+    points.push_back(p);
+    if (i == 20) {
+      points.push_back(p);
+    }
+    x += 0.7 * std::cos(yaw);
+    y += 0.7 * std::sin(yaw);
+  }
+  return points;
+}
+
+std::vector<geometry_msgs::msg::Pose> generateTestPoses()
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (int i = -10; i <= 40; i += 3) {
+    for (int j = -10; j <= 40; j += 4) {
+      geometry_msgs::msg::Pose pose;
+      pose.position = createPoint(i * 0.9, j * 0.8, 0.0);
+      pose.orientation = createQuaternionFromYaw(0.1 * (i + j));
+      poses.push_back(pose);
+    }
+  }
+  return poses;
+}
+}  // namespace
+
+TEST(indexed_trajectory, nearestIndex)
+{
+  using autoware::motion_utils::findFirstNearestIndexWithSoftConstraints;
+  using autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints;
+  using autoware::motion_utils::findNearestIndex;
+  using autoware::motion_utils::findNearestSegmentIndex;
+
+  const auto points = generateTestPoints();
+  for (const double cell_size : {0.5, 2.0, 10.0}) {
+    const IndexedTrajectory indexed_points(points, cell_size);
+    for (const auto & pose : generateTestPoses()) {
+      EXPECT_EQ(
+        indexed_points.findNearestIndex(pose.position), findNearestIndex(points, pose.position));
+      EXPECT_EQ(indexed_points.findNearestIndex(pose), findNearestIndex(points, pose));
+      EXPECT_EQ(
+        indexed_points.findNearestIndex(pose, 3.0, 0.5), findNearestIndex(points, pose, 3.0, 0.5));
+      EXPECT_EQ(
+        indexed_points.findNearestSegmentIndex(pose.position),
+        findNearestSegmentIndex(points, pose.position));
+      EXPECT_EQ(
+        indexed_points.findNearestSegmentIndex(pose, 3.0, 0.5),
+        findNearestSegmentIndex(points, pose, 3.0, 0.5));
+      EXPECT_EQ(
+        indexed_points.findFirstNearestIndexWithSoftConstraints(pose),
+        findFirstNearestIndexWithSoftConstraints(points, pose));
+      EXPECT_EQ(
+        indexed_points.findFirstNearestIndexWithSoftConstraints(pose, 3.0, 0.5),
+        findFirstNearestIndexWithSoftConstraints(points, pose, 3.0, 0.5));
+      EXPECT_EQ(
+        indexed_points.findFirstNearestSegmentIndexWithSoftConstraints(pose),
+        findFirstNearestSegmentIndexWithSoftConstraints(points, pose));
+      EXPECT_EQ(
+        indexed_points.findFirstNearestSegmentIndexWithSoftConstraints(pose, 3.0, 0.5),
+        findFirstNearestSegmentIndexWithSoftConstraints(points, pose, 3.0, 0.5));
+    }
+  }
+}
+
+TEST(indexed_trajectory, offsetAndArcLength)
+{
+  using autoware::motion_utils::calcArcLength;
+  using autoware::motion_utils::calcLateralOffset;
+  using autoware::motion_utils::calcLongitudinalOffsetToSegment;
+  using autoware::motion_utils::calcSignedArcLength;
+
+  const auto points = generateTestPoints();
+  const IndexedTrajectory indexed_points(points);
+  EXPECT_NEAR(indexed_points.calcArcLength(), calcArcLength(points), epsilon);
+
+  const auto poses = generateTestPoses();
+  for (size_t i = 0; i < poses.size(); ++i) {
+    const auto & p = poses.at(i).position;
+    const auto & other_p = poses.at(poses.size() - 1 - i).position;
+    const size_t idx = i % points.size();
+    const size_t seg_idx = i % (points.size() - 1);
+
+    EXPECT_NEAR(
+      indexed_points.calcSignedArcLength(idx, seg_idx), calcSignedArcLength(points, idx, seg_idx),
+      epsilon);
+    EXPECT_NEAR(
+      indexed_points.calcSignedArcLength(p, idx), calcSignedArcLength(points, p, idx), epsilon);
+    EXPECT_NEAR(
+      indexed_points.calcSignedArcLength(idx, p), calcSignedArcLength(points, idx, p), epsilon);
+    EXPECT_NEAR(
+      indexed_points.calcSignedArcLength(p, other_p), calcSignedArcLength(points, p, other_p),
+      epsilon);
+    EXPECT_DOUBLE_EQ(indexed_points.calcLateralOffset(p), calcLateralOffset(points, p));
+    EXPECT_DOUBLE_EQ(
+      indexed_points.calcLateralOffset(p, seg_idx), calcLateralOffset(points, p, seg_idx));
+
+    EXPECT_DOUBLE_EQ(
+      indexed_points.calcLongitudinalOffsetToSegment(seg_idx, p),
+      calcLongitudinalOffsetToSegment(points, seg_idx, p));
+  }
+
+  EXPECT_THROW(
+    indexed_points.calcLongitudinalOffsetToSegment(points.size() - 1, poses.front().position, true),
+    std::out_of_range);
+}
@@ -803,6 +803,17 @@ TEST(trajectory, convertToTrajectory)
     const auto traj = convertToTrajectory(traj_input);
     EXPECT_EQ(traj.points.size(), traj_input.size());
   }
+
+  // Move
+  {
+    const auto traj_input = generateTestTrajectoryPointArray(50, 1.0);
+    auto moved_input = traj_input;
+    std_msgs::msg::Header header;
+    header.frame_id = "map";
+    const auto traj = convertToTrajectory(std::move(moved_input), header);
+    EXPECT_EQ(traj.header.frame_id, "map");
+    EXPECT_EQ(traj.points, traj_input);
+  }
 }
 
 TEST(trajectory, convertToTrajectoryPointArray)
@@ -0,0 +1,124 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/object_recognition_utils/matching.hpp"
+
+#include <autoware/universe_utils/geometry/geometry.hpp>
+
+#include <autoware_perception_msgs/msg/detected_object.hpp>
+#include <geometry_msgs/msg/point32.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+using autoware::object_recognition_utils::get2dGeneralizedIoU;
+using autoware::object_recognition_utils::get2dIoU;
+using autoware_perception_msgs::msg::DetectedObject;
+using autoware_perception_msgs::msg::Shape;
+
+namespace
+{
+DetectedObject createObject(
+  const double x, const double y, const double yaw, const double length, const double width,
+  const bool as_polygon)
+{
+  DetectedObject object;
+  auto & pose = object.kinematics.pose_with_covariance.pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation = autoware::universe_utils::createQuaternionFromYaw(yaw);
+  object.shape.dimensions.z = 1.5;
+  if (!as_polygon) {
+    object.shape.type = Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = length;
+    object.shape.dimensions.y = width;
+    return object;
+  }
+
+  // the same box as the footprint in the object coordinate
+  object.shape.type = Shape::POLYGON;
+  for (const auto & [sign_x, sign_y] :
+       std::vector<std::pair<double, double>>{{1.0, 1.0}, {-1.0, 1.0}, {-1.0, -1.0}, {1.0, -1.0}}) {
+    geometry_msgs::msg::Point32 point;
+    point.x = static_cast<float>(sign_x * length / 2.0);
+    point.y = static_cast<float>(sign_y * width / 2.0);
+    object.shape.footprint.points.push_back(point);
+  }
+  return object;
+}
+
+// pairs of a fixed seed of the overlapping objects, as the tracker and measurement pairs passing
+// the distance gate
+std::vector<std::pair<DetectedObject, DetectedObject>> createPairs(
+  const size_t num_pairs, const bool as_polygon)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> yaw_distribution(-M_PI, M_PI);
+  std::uniform_real_distribution<double> length_distribution(3.5, 5.0);
+  std::normal_distribution<double> noise_distribution(0.0, 0.5);
+
+  std::vector<std::pair<DetectedObject, DetectedObject>> pairs;
+  pairs.reserve(num_pairs);
+  for (size_t i = 0; i < num_pairs; ++i) {
+    const double yaw = yaw_distribution(generator);
+    const double length = length_distribution(generator);
+    pairs.emplace_back(
+      createObject(0.0, 0.0, yaw, length, 1.8, as_polygon),
+      createObject(
+        noise_distribution(generator), noise_distribution(generator),
+        yaw + 0.2 * noise_distribution(generator), length + noise_distribution(generator), 1.8,
+        as_polygon));
+  }
+  return pairs;
+}
+
+template <class Function>
+void run(benchmark::State & state, const bool as_polygon, Function function)
+{
+  const auto pairs = createPairs(1000, as_polygon);
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto & [source_object, target_object] : pairs) {
+      sum += function(source_object, target_object);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * pairs.size());
+}
+
+void BM_Get2dIoU(benchmark::State & state, const bool as_polygon)
+{
+  run(state, as_polygon, [](const DetectedObject & source, const DetectedObject & target) {
+    return get2dIoU(source, target);
+  });
+}
+
+void BM_Get2dGeneralizedIoU(benchmark::State & state, const bool as_polygon)
+{
+  run(state, as_polygon, [](const DetectedObject & source, const DetectedObject & target) {
+    return get2dGeneralizedIoU(source, target);
+  });
+}
+}  // namespace
+
+// the bounding boxes take the allocation free path, and the polygons of the same boxes take the
+// boost geometry path
+BENCHMARK_CAPTURE(BM_Get2dIoU, bounding_box, false)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Get2dIoU, polygon, true)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Get2dGeneralizedIoU, bounding_box, false)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Get2dGeneralizedIoU, polygon, true)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,184 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef AUTOWARE__OBJECT_RECOGNITION_UTILS__BOUNDING_BOX_OVERLAP_HPP_
+#define AUTOWARE__OBJECT_RECOGNITION_UTILS__BOUNDING_BOX_OVERLAP_HPP_
+
+#include <autoware_perception_msgs/msg/shape.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+namespace autoware::object_recognition_utils
+{
+/**
+ * @brief convex polygon of at most 8 vertices in counter clockwise order, kept on the stack. It
+ * is the footprint of a bounding box, or the intersection of two of them.
+ */
+struct ConvexPolygon2d
+{
+  static constexpr size_t max_size = 8;
+  std::array<double, max_size> x;
+  std::array<double, max_size> y;
+  size_t size{0};
+
+  void push_back(const double px, const double py)
+  {
+    x[size] = px;
+    y[size] = py;
+    ++size;
+  }
+};
+
+/**
+ * @brief footprint of a bounding box, with the same corners as universe_utils::toPolygon2d
+ */
+inline ConvexPolygon2d toConvexPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_perception_msgs::msg::Shape & shape)
+{
+  // first two rows and columns of the rotation matrix of the normalized orientation
+  const auto & q = pose.orientation;
+  const double norm2 = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+  const double s = norm2 > 0.0 ? 2.0 / norm2 : 0.0;
+  const double r00 = 1.0 - s * (q.y * q.y + q.z * q.z);
+  const double r01 = s * (q.x * q.y - q.w * q.z);
+  const double r10 = s * (q.x * q.y + q.w * q.z);
+  const double r11 = 1.0 - s * (q.x * q.x + q.z * q.z);
+
+  const double half_x = shape.dimensions.x / 2.0;
+  const double half_y = shape.dimensions.y / 2.0;
+  constexpr std::array<double, 4> signs_x = {1.0, -1.0, -1.0, 1.0};
+  constexpr std::array<double, 4> signs_y = {1.0, 1.0, -1.0, -1.0};
+  // the corners are counter clockwise unless the box is upside down
+  const bool is_clockwise = r00 * r11 - r01 * r10 < 0.0;
+  ConvexPolygon2d polygon;
+  for (size_t i = 0; i < 4; ++i) {
+    const size_t j = is_clockwise ? 3 - i : i;
+    const double dx = signs_x[j] * half_x;
+    const double dy = signs_y[j] * half_y;
+    polygon.push_back(
+      pose.position.x + r00 * dx + r01 * dy, pose.position.y + r10 * dx + r11 * dy);
+  }
+  return polygon;
+}
+
+inline double getArea(const ConvexPolygon2d & polygon)
+{
+  double area = 0.0;
+  for (size_t i = 0; i < polygon.size; ++i) {
+    const size_t j = (i + 1) % polygon.size;
+    area += polygon.x[i] * polygon.y[j] - polygon.x[j] * polygon.y[i];
+  }
+  return std::abs(area) * 0.5;
+}
+
+/**
+ * @brief area of the intersection of two convex polygons, by clipping the first one with each
+ * edge of the second one
+ */
+inline double getIntersectionArea(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon)
+{
+  if (source_polygon.size < 3 || target_polygon.size < 3) return 0.0;
+
+  // the clipped polygon gains at most one vertex per edge, so two boxes stay within 8 vertices
+  if (source_polygon.size + target_polygon.size > ConvexPolygon2d::max_size) return 0.0;
+
+  ConvexPolygon2d clipped = source_polygon;
+  for (size_t i = 0; i < target_polygon.size && clipped.size > 0; ++i) {
+    const size_t j = (i + 1) % target_polygon.size;
+    const double edge_x = target_polygon.x[j] - target_polygon.x[i];
+    const double edge_y = target_polygon.y[j] - target_polygon.y[i];
+    // positive on the inner side of the edge
+    const auto side = [&](const double px, const double py) {
+      return edge_x * (py - target_polygon.y[i]) - edge_y * (px - target_polygon.x[i]);
+    };
+
+    ConvexPolygon2d next;
+    for (size_t k = 0; k < clipped.size; ++k) {
+      const size_t l = (k + 1) % clipped.size;
+      const double side_k = side(clipped.x[k], clipped.y[k]);
+      const double side_l = side(clipped.x[l], clipped.y[l]);
+      if (side_k >= 0.0) {
+        next.push_back(clipped.x[k], clipped.y[k]);
+      }
+      if ((side_k >= 0.0) != (side_l >= 0.0)) {
+        const double t = side_k / (side_k - side_l);
+        next.push_back(
+          clipped.x[k] + t * (clipped.x[l] - clipped.x[k]),
+          clipped.y[k] + t * (clipped.y[l] - clipped.y[k]));
+      }
+    }
+    clipped = next;
+  }
+  return clipped.size < 3 ? 0.0 : getArea(clipped);
+}
+
+/**
+ * @brief area of the convex hull of two convex polygons, by the monotone chain algorithm
+ */
+inline double getConvexHullArea(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon)
+{
+  constexpr size_t max_points = 2 * ConvexPolygon2d::max_size;
+  std::array<std::pair<double, double>, max_points> points;
+  size_t num_points = 0;
+  for (const auto * polygon : {&source_polygon, &target_polygon}) {
+    for (size_t i = 0; i < polygon->size; ++i) {
+      points[num_points++] = {polygon->x[i], polygon->y[i]};
+    }
+  }
+  if (num_points < 3) return 0.0;
+  std::sort(points.begin(), points.begin() + num_points);
+
+  const auto cross = [](
+                       const std::pair<double, double> & o, const std::pair<double, double> & a,
+                       const std::pair<double, double> & b) {
+    return (a.first - o.first) * (b.second - o.second) -
+           (a.second - o.second) * (b.first - o.first);
+  };
+  std::array<std::pair<double, double>, 2 * max_points> hull;
+  size_t hull_size = 0;
+  // lower hull
+  for (size_t i = 0; i < num_points; ++i) {
+    while (hull_size >= 2 && cross(hull[hull_size - 2], hull[hull_size - 1], points[i]) <= 0.0) {
+      --hull_size;
+    }
+    hull[hull_size++] = points[i];
+  }
+  // upper hull
+  const size_t lower_size = hull_size + 1;
+  for (size_t i = num_points - 1; i > 0; --i) {
+    while (hull_size >= lower_size &&
+           cross(hull[hull_size - 2], hull[hull_size - 1], points[i - 1]) <= 0.0) {
+      --hull_size;
+    }
+    hull[hull_size++] = points[i - 1];
+  }
+
+  double area = 0.0;
+  for (size_t i = 0; i + 1 < hull_size; ++i) {
+    area += hull[i].first * hull[i + 1].second - hull[i + 1].first * hull[i].second;
+  }
+  return std::abs(area) * 0.5;
+}
+
+}  // namespace autoware::object_recognition_utils
+
+#endif  // AUTOWARE__OBJECT_RECOGNITION_UTILS__BOUNDING_BOX_OVERLAP_HPP_
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__OBJECT_RECOGNITION_UTILS__MATCHING_HPP_
 #define AUTOWARE__OBJECT_RECOGNITION_UTILS__MATCHING_HPP_
 
+#include "autoware/object_recognition_utils/bounding_box_overlap.hpp"
 #include "autoware/object_recognition_utils/geometry.hpp"
 #include "autoware/universe_utils/geometry/boost_geometry.hpp"
 #include "autoware/universe_utils/geometry/boost_polygon_utils.hpp"
@@ -65,8 +66,33 @@ inline double getUnionArea(const Polygon2d & source_polygon, const Polygon2d & t
 }
 
 template <class T1, class T2>
-double get2dIoU(const T1 source_object, const T2 target_object, const double min_union_area = 0.01)
+bool areBoundingBoxes(const T1 & source_object, const T2 & target_object)
 {
+  using autoware_perception_msgs::msg::Shape;
+  return source_object.shape.type == Shape::BOUNDING_BOX &&
+         target_object.shape.type == Shape::BOUNDING_BOX;
+}
+
+template <class T1, class T2>
+double get2dIoU(
+  const T1 & source_object, const T2 & target_object, const double min_union_area = 0.01)
+{
+  // allocation free path for the bounding boxes
+  if (areBoundingBoxes(source_object, target_object)) {
+    const auto source_polygon = toConvexPolygon2d(getPose(source_object), source_object.shape);
+    const double source_area = getArea(source_polygon);
+    if (source_area < MIN_AREA) return 0.0;
+    const auto target_polygon = toConvexPolygon2d(getPose(target_object), target_object.shape);
+    const double target_area = getArea(target_polygon);
+    if (target_area < MIN_AREA) return 0.0;
+
+    const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+    if (intersection_area < MIN_AREA) return 0.0;
+    const double union_area = source_area + target_area - intersection_area;
+
+    return union_area < min_union_area ? 0.0 : std::min(1.0, intersection_area / union_area);
+  }
+
   const auto source_polygon = autoware::universe_utils::toPolygon2d(source_object);
   if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   const auto target_polygon = autoware::universe_utils::toPolygon2d(target_object);
@@ -84,6 +110,23 @@ double get2dIoU(const T1 source_object, const T2 target_object, const double min
 template <class T1, class T2>
 double get2dGeneralizedIoU(const T1 & source_object, const T2 & target_object)
 {
+  // allocation free path for the bounding boxes
+  if (areBoundingBoxes(source_object, target_object)) {
+    const auto source_polygon = toConvexPolygon2d(getPose(source_object), source_object.shape);
+    const double source_area = getArea(source_polygon);
+    if (source_area < MIN_AREA) return 0.0;
+    const auto target_polygon = toConvexPolygon2d(getPose(target_object), target_object.shape);
+    const double target_area = getArea(target_polygon);
+    if (target_area < MIN_AREA) return 0.0;
+
+    const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+    const double union_area = source_area + target_area - intersection_area;
+    const double convex_shape_area = getConvexHullArea(source_polygon, target_polygon);
+
+    const double iou = union_area < 0.01 ? 0.0 : std::min(1.0, intersection_area / union_area);
+    return iou - (convex_shape_area - union_area) / convex_shape_area;
+  }
+
   const auto source_polygon = autoware::universe_utils::toPolygon2d(source_object);
   if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   const auto target_polygon = autoware::universe_utils::toPolygon2d(target_object);
@@ -98,8 +141,22 @@ double get2dGeneralizedIoU(const T1 & source_object, const T2 & target_object)
 }
 
 template <class T1, class T2>
-double get2dPrecision(const T1 source_object, const T2 target_object)
+double get2dPrecision(const T1 & source_object, const T2 & target_object)
 {
+  // allocation free path for the bounding boxes
+  if (areBoundingBoxes(source_object, target_object)) {
+    const auto source_polygon = toConvexPolygon2d(getPose(source_object), source_object.shape);
+    const double source_area = getArea(source_polygon);
+    if (source_area < MIN_AREA) return 0.0;
+    const auto target_polygon = toConvexPolygon2d(getPose(target_object), target_object.shape);
+    if (getArea(target_polygon) < MIN_AREA) return 0.0;
+
+    const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+    if (intersection_area < MIN_AREA) return 0.0;
+
+    return std::min(1.0, intersection_area / source_area);
+  }
+
   const auto source_polygon = autoware::universe_utils::toPolygon2d(source_object);
   const double source_area = boost::geometry::area(source_polygon);
   if (source_area < MIN_AREA) return 0.0;
@@ -113,8 +170,22 @@ double get2dPrecision(const T1 source_object, const T2 target_object)
 }
 
 template <class T1, class T2>
-double get2dRecall(const T1 source_object, const T2 target_object)
+double get2dRecall(const T1 & source_object, const T2 & target_object)
 {
+  // allocation free path for the bounding boxes
+  if (areBoundingBoxes(source_object, target_object)) {
+    const auto source_polygon = toConvexPolygon2d(getPose(source_object), source_object.shape);
+    if (getArea(source_polygon) < MIN_AREA) return 0.0;
+    const auto target_polygon = toConvexPolygon2d(getPose(target_object), target_object.shape);
+    const double target_area = getArea(target_polygon);
+    if (target_area < MIN_AREA) return 0.0;
+
+    const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+    if (intersection_area < MIN_AREA) return 0.0;
+
+    return std::min(1.0, intersection_area / target_area);
+  }
+
   const auto source_polygon = autoware::universe_utils::toPolygon2d(source_object);
   if (boost::geometry::area(source_polygon) < MIN_AREA) return 0.0;
   const auto target_polygon = autoware::universe_utils::toPolygon2d(target_object);
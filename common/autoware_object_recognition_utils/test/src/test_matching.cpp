@@ -284,3 +284,53 @@ TEST(matching, test_get2dRecall)
     EXPECT_DOUBLE_EQ(reversed_recall, quart_circle * 4);
   }
 }
+
+TEST(matching, test_bounding_box_overlap)
+{
+  using autoware::object_recognition_utils::get2dGeneralizedIoU;
+  using autoware::object_recognition_utils::get2dIoU;
+  using autoware::object_recognition_utils::get2dPrecision;
+  using autoware::object_recognition_utils::get2dRecall;
+  using autoware::object_recognition_utils::getConvexShapeArea;
+  using autoware::object_recognition_utils::getIntersectionArea;
+  using autoware::object_recognition_utils::getUnionArea;
+  using autoware::universe_utils::toPolygon2d;
+  using autoware_perception_msgs::msg::DetectedObject;
+
+  DetectedObject source_obj;
+  source_obj.kinematics.pose_with_covariance.pose = createPose(0.3, -0.2, 0.4);
+  source_obj.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+  source_obj.shape.dimensions.x = 4.5;
+  source_obj.shape.dimensions.y = 1.8;
+
+  // compare with the boost::geometry results of the polygons, while the target box moves around
+  for (int i = 0; i < 50; ++i) {
+    DetectedObject target_obj;
+    target_obj.kinematics.pose_with_covariance.pose =
+      createPose(-3.0 + 0.13 * i, 2.0 - 0.09 * i, 0.21 * i);
+    target_obj.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    target_obj.shape.dimensions.x = 1.0 + 0.07 * i;
+    target_obj.shape.dimensions.y = 0.8 + 0.03 * i;
+
+    const auto source_polygon = toPolygon2d(source_obj);
+    const auto target_polygon = toPolygon2d(target_obj);
+    const double source_area = boost::geometry::area(source_polygon);
+    const double target_area = boost::geometry::area(target_polygon);
+    const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+    const double union_area = getUnionArea(source_polygon, target_polygon);
+    const double convex_shape_area = getConvexShapeArea(source_polygon, target_polygon);
+
+    const bool is_overlapped = intersection_area >= autoware::object_recognition_utils::MIN_AREA;
+    const double iou = intersection_area / union_area;
+    EXPECT_NEAR(get2dIoU(source_obj, target_obj), is_overlapped ? iou : 0.0, epsilon);
+    EXPECT_NEAR(
+      get2dGeneralizedIoU(source_obj, target_obj),
+      iou - (convex_shape_area - union_area) / convex_shape_area, epsilon);
+    EXPECT_NEAR(
+      get2dPrecision(source_obj, target_obj),
+      is_overlapped ? intersection_area / source_area : 0.0, epsilon);
+    EXPECT_NEAR(
+      get2dRecall(source_obj, target_obj),
+      is_overlapped ? intersection_area / target_area : 0.0, epsilon);
+  }
+}
@@ -19,6 +19,7 @@
 #include "osqp/glob_opts.h"  // for 'c_int' type ('long' or 'long long')
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <vector>
 
@@ -39,6 +40,13 @@ struct OSQP_INTERFACE_PUBLIC CSC_Matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat);
 /// \brief Calculate upper trapezoidal CSC matrix from square Eigen matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat);
+/// \brief Calculate CSC matrix from Eigen sparse matrix
+/// \details the explicitly stored zeros are kept so that the sparsity pattern of the result only
+/// depends on the structure of the sparse matrix
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate upper trapezoidal CSC matrix from square Eigen sparse matrix
+/// \details the explicitly stored zeros are kept as in calCSCMatrix
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat);
 /// \brief Print the given CSC matrix to the standard output
 OSQP_INTERFACE_PUBLIC void printCSCMatrix(const CSC_Matrix & csc_mat);
 
@@ -50,6 +50,9 @@ private:
   bool m_work_initialized = false;
   // Exitflag
   int64_t m_exitflag;
+  // Matrices of the current workspace, used to check if it can be updated in place
+  CSC_Matrix m_P_csc;
+  CSC_Matrix m_A_csc;
 
   // Runs the solver on the stored problem.
   std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> solve();
@@ -131,6 +134,21 @@ public:
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
 
+  /// \brief Updates the stored problem in place if the sparsity patterns of P and A are the same
+  /// as in the current workspace, or sets up the problem otherwise.
+  /// \details P and A are only updated if their values changed, so when only the vectors change
+  /// the factorization of the current workspace is reused.
+  /// \param P (n,n) upper trapezoidal CSC matrix defining relations between parameters.
+  /// \param A (m,n) CSC matrix defining parameter constraints relative to the lower and upper
+  /// bound.
+  /// \param q (n) vector defining the linear cost of the problem.
+  /// \param l (m) vector defining the lower bound problem constraint.
+  /// \param u (m) vector defining the upper bound problem constraint.
+  /// \return true if the current workspace was updated in place, false if the problem was set up.
+  bool updateOrInitializeProblem(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+
   // Setter functions for warm start
   bool setWarmStart(
     const std::vector<double> & primal_variables, const std::vector<double> & dual_variables);
@@ -181,6 +199,12 @@ public:
   }
   /// \brief Get the runtime of the latest problem solved
   inline double getRunTime() const { return m_latest_work_info.run_time; }
+  /// \brief Get the setup time of the workspace of the latest problem solved
+  inline double getSetupTime() const { return m_latest_work_info.setup_time; }
+  /// \brief Get the time spent updating the workspace before the latest problem solved
+  inline double getUpdateTime() const { return m_latest_work_info.update_time; }
+  /// \brief Get the solve time of the latest problem solved
+  inline double getSolveTime() const { return m_latest_work_info.solve_time; }
   /// \brief Get the objective value the latest problem solved
   inline double getObjVal() const { return m_latest_work_info.obj_val; }
   /// \brief Returns flag asserting interface condition (Healthy condition: 0).
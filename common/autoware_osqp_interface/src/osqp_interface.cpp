@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace autoware::osqp_interface
@@ -88,15 +89,14 @@ void OSQPInterface::updateP(const Eigen::MatrixXd & P_new)
   // Convert dynamic 'int' arrays to 'c_int' arrays (OSQP input type)
   c_int P_elem_N = P_sparse.nonZeros();
   */
-  CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P_new);
-  osqp_update_P(
-    m_work.get(), P_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(P_csc.m_vals.size()));
+  updateCscP(calCSCMatrixTrapezoidal(P_new));
 }
 
 void OSQPInterface::updateCscP(const CSC_Matrix & P_csc)
 {
   osqp_update_P(
     m_work.get(), P_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(P_csc.m_vals.size()));
+  m_P_csc.m_vals = P_csc.m_vals;
 }
 
 void OSQPInterface::updateA(const Eigen::MatrixXd & A_new)
@@ -108,16 +108,14 @@ void OSQPInterface::updateA(const Eigen::MatrixXd & A_new)
   // Convert dynamic 'int' arrays to 'c_int' arrays (OSQP input type)
   c_int A_elem_N = A_sparse.nonZeros();
   */
-  CSC_Matrix A_csc = calCSCMatrix(A_new);
-  osqp_update_A(
-    m_work.get(), A_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(A_csc.m_vals.size()));
-  return;
+  updateCscA(calCSCMatrix(A_new));
 }
 
 void OSQPInterface::updateCscA(const CSC_Matrix & A_csc)
 {
   osqp_update_A(
     m_work.get(), A_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(A_csc.m_vals.size()));
+  m_A_csc.m_vals = A_csc.m_vals;
 }
 
 void OSQPInterface::updateQ(const std::vector<double> & q_new)
@@ -355,10 +353,46 @@ int64_t OSQPInterface::initializeProblem(
   m_exitflag = osqp_setup(&workspace, m_data.get(), m_settings.get());
   m_work.reset(workspace);
   m_work_initialized = true;
+  m_P_csc = std::move(P_csc);
+  m_A_csc = std::move(A_csc);
 
   return m_exitflag;
 }
 
+bool OSQPInterface::updateOrInitializeProblem(
+  const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  const auto has_same_pattern = [](const CSC_Matrix & mat1, const CSC_Matrix & mat2) {
+    return mat1.m_row_idxs == mat2.m_row_idxs && mat1.m_col_idxs == mat2.m_col_idxs;
+  };
+  const bool can_update = m_work_initialized && m_param_n == static_cast<int64_t>(q.size()) &&
+                          m_data->m == static_cast<c_int>(l.size()) &&
+                          has_same_pattern(m_P_csc, P) && has_same_pattern(m_A_csc, A);
+  if (!can_update) {
+    initializeProblem(P, A, q, l, u);
+    return false;
+  }
+
+  // NOTE: updating P or A refactorizes the KKT matrix, so it is skipped if the values are unchanged
+  const bool is_P_changed = m_P_csc.m_vals != P.m_vals;
+  const bool is_A_changed = m_A_csc.m_vals != A.m_vals;
+  if (is_P_changed && is_A_changed) {
+    osqp_update_P_A(
+      m_work.get(), P.m_vals.data(), OSQP_NULL, static_cast<c_int>(P.m_vals.size()),
+      A.m_vals.data(), OSQP_NULL, static_cast<c_int>(A.m_vals.size()));
+    m_P_csc.m_vals = P.m_vals;
+    m_A_csc.m_vals = A.m_vals;
+  } else if (is_P_changed) {
+    updateCscP(P);
+  } else if (is_A_changed) {
+    updateCscA(A);
+  }
+  updateQ(q);
+  updateBounds(l, u);
+  return true;
+}
+
 std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t>
 OSQPInterface::solve()
 {
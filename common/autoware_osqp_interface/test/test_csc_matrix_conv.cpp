@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,56 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::osqp_interface::calCSCMatrix;
+  using autoware::osqp_interface::calCSCMatrixTrapezoidal;
+  using autoware::osqp_interface::CSC_Matrix;
+
+  // same as the dense matrices, with an explicitly stored zero at (1, 1)
+  std::vector<Eigen::Triplet<double>> triplets{
+    {0, 0, 1.0}, {1, 1, 0.0}, {0, 2, 3.0}, {1, 1, 6.0}, {1, 2, 7.0}, {1, 1, -6.0}};
+  Eigen::SparseMatrix<double> rect(2, 4);
+  rect.setFromTriplets(triplets.begin(), triplets.end());
+  Eigen::MatrixXd dense_rect(2, 4);
+  dense_rect << 1.0, 0.0, 3.0, 0.0, 0.0, 0.0, 7.0, 0.0;
+
+  const CSC_Matrix rect_m = calCSCMatrix(rect);
+  ASSERT_EQ(rect_m.m_vals.size(), size_t(4));
+  EXPECT_EQ(rect_m.m_vals[0], 1.0);
+  EXPECT_EQ(rect_m.m_vals[1], 0.0);
+  EXPECT_EQ(rect_m.m_vals[2], 3.0);
+  EXPECT_EQ(rect_m.m_vals[3], 7.0);
+  ASSERT_EQ(rect_m.m_row_idxs.size(), size_t(4));
+  EXPECT_EQ(rect_m.m_row_idxs[0], c_int(0));
+  EXPECT_EQ(rect_m.m_row_idxs[1], c_int(1));
+  EXPECT_EQ(rect_m.m_row_idxs[2], c_int(0));
+  EXPECT_EQ(rect_m.m_row_idxs[3], c_int(1));
+  ASSERT_EQ(rect_m.m_col_idxs.size(), size_t(5));  // nb of columns + 1
+  EXPECT_EQ(rect_m.m_col_idxs[0], c_int(0));
+  EXPECT_EQ(rect_m.m_col_idxs[1], c_int(1));
+  EXPECT_EQ(rect_m.m_col_idxs[2], c_int(2));
+  EXPECT_EQ(rect_m.m_col_idxs[3], c_int(4));
+  EXPECT_EQ(rect_m.m_col_idxs[4], c_int(4));
+  // the dense conversion drops the zero
+  EXPECT_EQ(calCSCMatrix(dense_rect).m_vals.size(), size_t(3));
+
+  Eigen::MatrixXd dense_square(3, 3);
+  dense_square << 0.0, 2.0, 0.0, 4.0, 5.0, 6.0, 0.0, 0.0, 0.0;
+  const Eigen::SparseMatrix<double> square = dense_square.sparseView();
+  const CSC_Matrix square_m = calCSCMatrixTrapezoidal(square);
+  const CSC_Matrix dense_square_m = calCSCMatrixTrapezoidal(dense_square);
+  EXPECT_EQ(square_m.m_vals, dense_square_m.m_vals);
+  EXPECT_EQ(square_m.m_row_idxs, dense_square_m.m_row_idxs);
+  EXPECT_EQ(square_m.m_col_idxs, dense_square_m.m_col_idxs);
+
+  try {
+    const CSC_Matrix rect_m1 = calCSCMatrixTrapezoidal(rect);
+    FAIL() << "calCSCMatrixTrapezoidal should fail with non-square inputs";
+  } catch (const std::invalid_argument & e) {
+    EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
+  }
+}
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::osqp_interface::calCSCMatrix;
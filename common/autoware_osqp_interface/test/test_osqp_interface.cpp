@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <tuple>
 #include <vector>
@@ -159,5 +160,28 @@ TEST(TestOsqpInterface, BasicQp)
     check_result(result);
     EXPECT_EQ(osqp.getTakenIter(), 1);
   }
+
+  {
+    // Update the problem in place when the sparsity pattern is unchanged
+    const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+    const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+    CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P_sparse);
+    CSC_Matrix A_csc = calCSCMatrix(A_sparse);
+    std::vector<double> q_ini(2, 0.0);
+    autoware::osqp_interface::OSQPInterface osqp(1e-6);
+    EXPECT_FALSE(osqp.updateOrInitializeProblem(P_csc, A_csc, q_ini, l, u));
+    osqp.optimize();
+
+    EXPECT_TRUE(osqp.updateOrInitializeProblem(P_csc, A_csc, q, l, u));
+    std::tuple<std::vector<double>, std::vector<double>, int, int, int> result = osqp.optimize();
+    check_result(result);
+
+    // a different pattern sets up the problem again
+    CSC_Matrix P_diag_csc = calCSCMatrixTrapezoidal(Eigen::MatrixXd::Identity(2, 2));
+    EXPECT_FALSE(osqp.updateOrInitializeProblem(P_diag_csc, A_csc, q, l, u));
+    EXPECT_FALSE(osqp.updateOrInitializeProblem(P_csc, A_csc, q, l, u));
+    result = osqp.optimize();
+    check_result(result);
+  }
 }
 }  // namespace
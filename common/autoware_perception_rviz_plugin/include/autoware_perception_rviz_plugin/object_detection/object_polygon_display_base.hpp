@@ -18,7 +18,11 @@
 #include "autoware_perception_rviz_plugin/object_detection/object_polygon_detail.hpp"
 #include "autoware_perception_rviz_plugin/visibility_control.hpp"
 
+#include <OgreQuaternion.h>
+#include <OgreVector3.h>
 #include <rviz_common/display.hpp>
+#include <rviz_common/display_context.hpp>
+#include <rviz_common/frame_manager_iface.hpp>
 #include <rviz_common/properties/color_property.hpp>
 #include <rviz_common/properties/enum_property.hpp>
 #include <rviz_common/properties/float_property.hpp>
@@ -31,6 +35,7 @@
 #include <bitset>
 #include <list>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -91,6 +96,11 @@ public:
       this},
 
     m_line_width_property{"Line Width", 0.03, "Line width of object-shape", this},
+    m_detail_range_property{
+      "Detail Range", 0.0,
+      "Range from base_link within which the objects are visualized with all the enabled markers. "
+      "Only the shape and the label are visualized beyond it. 0 disables the range.",
+      this},
     m_default_topic{default_topic}
   {
     m_display_type_property = new rviz_common::properties::EnumProperty(
@@ -483,6 +493,46 @@ protected:
 
   double get_line_width() { return m_line_width_property.getFloat(); }
 
+  /// \brief Get the ego position in the frame of the given header to check the detail range
+  /// \param header Header of the object msg
+  /// \return Ego position, or nullopt if the detail range is disabled or base_link is not available
+  std::optional<Ogre::Vector3> get_ego_position(const std_msgs::msg::Header & header) const
+  {
+    if (m_detail_range_property.getFloat() <= 0.0) {
+      return std::nullopt;
+    }
+
+    // both of base_link and the msg frame are given in the fixed frame
+    Ogre::Vector3 ego_position;
+    Ogre::Quaternion ego_orientation;
+    Ogre::Vector3 frame_position;
+    Ogre::Quaternion frame_orientation;
+    auto * frame_manager = this->context_->getFrameManager();
+    if (
+      !frame_manager->getTransform("base_link", ego_position, ego_orientation) ||
+      !frame_manager->getTransform(header, frame_position, frame_orientation)) {
+      return std::nullopt;
+    }
+    return frame_orientation.Inverse() * (ego_position - frame_position);
+  }
+
+  /// \brief Check if the object is visualized with all the enabled markers
+  /// \param ego_position Ego position given by get_ego_position()
+  /// \param position Object position in the msg frame
+  /// \return False if the object is beyond the detail range
+  bool is_within_detail_range(
+    const std::optional<Ogre::Vector3> & ego_position,
+    const geometry_msgs::msg::Point & position) const
+  {
+    if (!ego_position) {
+      return true;
+    }
+    const double detail_range = m_detail_range_property.getFloat();
+    const double dx = position.x - ego_position->x;
+    const double dy = position.y - ego_position->y;
+    return dx * dx + dy * dy <= detail_range * detail_range;
+  }
+
   double get_confidence_interval() const
   {
     switch (m_confidence_interval_property->getOptionInt()) {
@@ -567,6 +617,8 @@ private:
 
   // Property to decide line width of object shape
   rviz_common::properties::FloatProperty m_line_width_property;
+  // Property to decide range within which objects are visualized with all the enabled markers
+  rviz_common::properties::FloatProperty m_detail_range_property;
   // Default topic name to be visualized
   std::string m_default_topic;
 
@@ -24,6 +24,7 @@
 
 #include <condition_variable>
 #include <list>
+#include <optional>
 #include <queue>
 #include <set>
 #include <string>
@@ -120,7 +121,7 @@ private:
   }
 
   std::vector<visualization_msgs::msg::Marker::SharedPtr> createMarkers(
-    PredictedObjects::ConstSharedPtr msg);
+    PredictedObjects::ConstSharedPtr msg, const std::optional<Ogre::Vector3> & ego_position);
   void workerThread();
 
   void messageProcessorThreadJob();
@@ -142,6 +143,7 @@ private:
   std::queue<std::function<void()>> jobs;
 
   PredictedObjects::ConstSharedPtr msg;
+  std::optional<Ogre::Vector3> ego_position;
   bool consumed{false};
   std::mutex mutex;
   std::condition_variable condition;
@@ -31,6 +31,7 @@ DetectedObjectsDisplay::DetectedObjectsDisplay() : ObjectPolygonDisplayBase("det
 void DetectedObjectsDisplay::processMessage(DetectedObjects::ConstSharedPtr msg)
 {
   clear_markers();
+  const auto ego_position = get_ego_position(msg->header);
   int id = 0;
   for (const auto & object : msg->objects) {
     // TODO(Satoshi Tanaka): fixing from string label to one string
@@ -59,6 +60,12 @@ void DetectedObjectsDisplay::processMessage(DetectedObjects::ConstSharedPtr msg)
       add_marker(label_marker_ptr);
     }
 
+    // Only the shape and the label beyond the detail range
+    if (!is_within_detail_range(
+          ego_position, object.kinematics.pose_with_covariance.pose.position)) {
+      continue;
+    }
+
     // Get marker for pose covariance
     auto pose_with_covariance_marker =
       get_pose_covariance_marker_ptr(object.kinematics.pose_with_covariance);
@@ -54,10 +54,11 @@ void PredictedObjectsDisplay::messageProcessorThreadJob()
   // Receiving
   std::unique_lock<std::mutex> lock(mutex);
   auto tmp_msg = this->msg;
+  const auto tmp_ego_position = this->ego_position;
   this->msg.reset();
   lock.unlock();
 
-  auto tmp_markers = createMarkers(tmp_msg);
+  auto tmp_markers = createMarkers(tmp_msg, tmp_ego_position);
 
   lock.lock();
   markers = tmp_markers;
@@ -66,7 +67,7 @@ void PredictedObjectsDisplay::messageProcessorThreadJob()
 }
 
 std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay::createMarkers(
-  PredictedObjects::ConstSharedPtr msg)
+  PredictedObjects::ConstSharedPtr msg, const std::optional<Ogre::Vector3> & ego_position)
 {
   update_id_map(msg);
 
@@ -96,6 +97,12 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
       markers.push_back(marker_ptr);
     }
 
+    // Only the shape and the label beyond the detail range
+    if (!is_within_detail_range(
+          ego_position, object.kinematics.initial_pose_with_covariance.pose.position)) {
+      continue;
+    }
+
     // Get marker for id
     geometry_msgs::msg::Point uuid_vis_position;
     uuid_vis_position.x = object.kinematics.initial_pose_with_covariance.pose.position.x - 0.5;
@@ -265,10 +272,17 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
 
 void PredictedObjectsDisplay::processMessage(PredictedObjects::ConstSharedPtr msg)
 {
+  const auto ego_position = get_ego_position(msg->header);
   std::unique_lock<std::mutex> lock(mutex);
 
+  // The pending job takes the latest msg, so the msgs arriving faster than the markers are created
+  // are skipped instead of being queued up
+  const bool is_job_pending = static_cast<bool>(this->msg);
   this->msg = msg;
-  queueJob(std::bind(&PredictedObjectsDisplay::messageProcessorThreadJob, this));
+  this->ego_position = ego_position;
+  if (!is_job_pending) {
+    queueJob(std::bind(&PredictedObjectsDisplay::messageProcessorThreadJob, this));
+  }
 }
 
 void PredictedObjectsDisplay::update(float wall_dt, float ros_dt)
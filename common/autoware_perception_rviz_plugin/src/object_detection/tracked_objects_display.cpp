@@ -51,6 +51,7 @@ void TrackedObjectsDisplay::processMessage(TrackedObjects::ConstSharedPtr msg)
   clear_markers();
   update_id_map(msg);
 
+  const auto ego_position = get_ego_position(msg->header);
   const auto showing_dynamic_status = get_object_dynamics_to_visualize();
   for (const auto & object : msg->objects) {
     // Filter by object dynamic status
@@ -80,6 +81,12 @@ void TrackedObjectsDisplay::processMessage(TrackedObjects::ConstSharedPtr msg)
       add_marker(label_marker_ptr);
     }
 
+    // Only the shape and the label beyond the detail range
+    if (!is_within_detail_range(
+          ego_position, object.kinematics.pose_with_covariance.pose.position)) {
+      continue;
+    }
+
     // Get marker for id
     geometry_msgs::msg::Point uuid_vis_position;
     uuid_vis_position.x = object.kinematics.pose_with_covariance.pose.position.x - 0.5;
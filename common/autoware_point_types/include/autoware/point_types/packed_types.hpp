@@ -0,0 +1,108 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINT_TYPES__PACKED_TYPES_HPP_
+#define AUTOWARE__POINT_TYPES__PACKED_TYPES_HPP_
+
+#include "autoware/point_types/types.hpp"
+
+#include <point_cloud_msg_wrapper/point_cloud_msg_wrapper.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+namespace autoware::point_types
+{
+/// The resolution of the packed positions [m]. The positions within about 327 m from the origin
+/// of the frame are representable, and the ones beyond are saturated.
+constexpr float packed_position_resolution = 0.01F;
+
+/// PointXYZIRC quantized for the transport between the processes, whose position is the fixed
+/// point of packed_position_resolution relative to the origin of the frame. It has 10 bytes per
+/// point against 16 of PointXYZIRC.
+struct PointXYZIRCPacked
+{
+  std::int16_t x{0};
+  std::int16_t y{0};
+  std::int16_t z{0};
+  std::uint8_t intensity{0U};
+  std::uint8_t return_type{0U};
+  std::uint16_t channel{0U};
+
+  friend bool operator==(const PointXYZIRCPacked & p1, const PointXYZIRCPacked & p2) noexcept
+  {
+    return p1.x == p2.x && p1.y == p2.y && p1.z == p2.z && p1.intensity == p2.intensity &&
+           p1.return_type == p2.return_type && p1.channel == p2.channel;
+  }
+};
+
+static_assert(sizeof(PointXYZIRCPacked) == 10, "PointXYZIRCPacked must not be padded");
+
+enum class PointXYZIRCPackedIndex { X, Y, Z, Intensity, ReturnType, Channel };
+
+using PointXYZIRCPackedGenerator = PointXYZIRCGenerator;
+
+/// Quantize a position to the nearest fixed point, saturating the out of range one. It is branch
+/// free so that the loops of pack_points are vectorized.
+inline std::int16_t pack_position(const float value)
+{
+  constexpr float limit = 32767.0F;
+  const float scaled = value / packed_position_resolution + std::copysign(0.5F, value);
+  return static_cast<std::int16_t>(std::min(std::max(scaled, -limit), limit));
+}
+
+inline float unpack_position(const std::int16_t value)
+{
+  return static_cast<float>(value) * packed_position_resolution;
+}
+
+/// Pack the points into the output, which must have room for num_points points.
+inline void pack_points(
+  const PointXYZIRC * input, const std::size_t num_points, PointXYZIRCPacked * output)
+{
+  for (std::size_t i = 0; i < num_points; ++i) {
+    output[i].x = pack_position(input[i].x);
+    output[i].y = pack_position(input[i].y);
+    output[i].z = pack_position(input[i].z);
+    output[i].intensity = input[i].intensity;
+    output[i].return_type = input[i].return_type;
+    output[i].channel = input[i].channel;
+  }
+}
+
+/// Unpack the points into the output, which must have room for num_points points.
+inline void unpack_points(
+  const PointXYZIRCPacked * input, const std::size_t num_points, PointXYZIRC * output)
+{
+  for (std::size_t i = 0; i < num_points; ++i) {
+    output[i].x = unpack_position(input[i].x);
+    output[i].y = unpack_position(input[i].y);
+    output[i].z = unpack_position(input[i].z);
+    output[i].intensity = input[i].intensity;
+    output[i].return_type = input[i].return_type;
+    output[i].channel = input[i].channel;
+  }
+}
+
+}  // namespace autoware::point_types
+
+POINT_CLOUD_REGISTER_POINT_STRUCT(
+  autoware::point_types::PointXYZIRCPacked,
+  (std::int16_t, x, x)(std::int16_t, y, y)(std::int16_t, z, z)(std::uint8_t, intensity, intensity)(
+    std::uint8_t, return_type, return_type)(std::uint16_t, channel, channel))
+
+#endif  // AUTOWARE__POINT_TYPES__PACKED_TYPES_HPP_
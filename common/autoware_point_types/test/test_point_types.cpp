@@ -12,11 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "autoware/point_types/packed_types.hpp"
 #include "autoware/point_types/types.hpp"
 
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <vector>
 
 TEST(PointEquality, PointXYZI)
 {
@@ -45,6 +47,53 @@ TEST(PointEquality, PointXYZIRCAEDT)
   EXPECT_EQ(pt0, pt1);
 }
 
+TEST(PointEquality, PointXYZIRCPacked)
+{
+  using autoware::point_types::PointXYZIRCPacked;
+
+  PointXYZIRCPacked pt0{0, 1, 2, 3, 4, 5};
+  PointXYZIRCPacked pt1{0, 1, 2, 3, 4, 5};
+  EXPECT_EQ(pt0, pt1);
+}
+
+TEST(PackedPoints, RoundTrip)
+{
+  using autoware::point_types::packed_position_resolution;
+  using autoware::point_types::PointXYZIRC;
+  using autoware::point_types::PointXYZIRCPacked;
+
+  const std::vector<PointXYZIRC> points{
+    {0.0F, 0.0F, 0.0F, 0, 1, 2},
+    {1.234F, -5.678F, 0.005F, 255, 2, 127},
+    {-300.0F, 300.0F, -2.004F, 10, 3, 65535}};
+  std::vector<PointXYZIRCPacked> packed_points(points.size());
+  autoware::point_types::pack_points(points.data(), points.size(), packed_points.data());
+  std::vector<PointXYZIRC> unpacked_points(points.size());
+  autoware::point_types::unpack_points(
+    packed_points.data(), packed_points.size(), unpacked_points.data());
+
+  // the positions are rounded to the nearest fixed point, and the others are kept as they are
+  const float tolerance = packed_position_resolution / 2.0F + 1e-4F;
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(unpacked_points.at(i).x, points.at(i).x, tolerance);
+    EXPECT_NEAR(unpacked_points.at(i).y, points.at(i).y, tolerance);
+    EXPECT_NEAR(unpacked_points.at(i).z, points.at(i).z, tolerance);
+    EXPECT_EQ(unpacked_points.at(i).intensity, points.at(i).intensity);
+    EXPECT_EQ(unpacked_points.at(i).return_type, points.at(i).return_type);
+    EXPECT_EQ(unpacked_points.at(i).channel, points.at(i).channel);
+  }
+}
+
+TEST(PackedPoints, Saturation)
+{
+  using autoware::point_types::pack_position;
+
+  EXPECT_EQ(pack_position(1000.0F), std::numeric_limits<std::int16_t>::max());
+  EXPECT_EQ(pack_position(-1000.0F), -std::numeric_limits<std::int16_t>::max());
+  EXPECT_EQ(pack_position(0.004F), 0);
+  EXPECT_EQ(pack_position(-0.006F), -1);
+}
+
 TEST(PointEquality, FloatEq)
 {
   // test template
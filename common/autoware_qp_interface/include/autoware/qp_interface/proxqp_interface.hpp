@@ -45,11 +45,19 @@ public:
 private:
   proxsuite::proxqp::Settings<double> settings_{};
   std::shared_ptr<proxsuite::proxqp::sparse::QP<double, int>> qp_ptr_{nullptr};
+  // The previous problem is updated only if the sparsity structure of P and A is the same.
+  Eigen::SparseMatrix<double> P_prev_;
+  Eigen::SparseMatrix<double> A_prev_;
 
   void initializeProblemImpl(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) override;
 
+  void initializeSparseProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l,
+    const std::vector<double> & u) override;
+
   std::vector<double> optimizeImpl() override;
 };
 }  // namespace autoware::qp_interface
@@ -16,6 +16,7 @@
 #define AUTOWARE__QP_INTERFACE__QP_INTERFACE_HPP_
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 
 #include <optional>
 #include <string>
@@ -31,6 +32,16 @@ public:
   std::vector<double> optimize(
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u);
+  std::vector<double> optimize(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
+  // Sets the initial guess of the primal variables for the next optimization. It is used instead
+  // of the previous result if its size is the number of the variables.
+  void setInitialPrimalVariables(const std::vector<double> & primal_variables)
+  {
+    initial_primal_variables_ = primal_variables;
+  }
 
   virtual bool isSolved() const = 0;
   virtual int getIterationNumber() const = 0;
@@ -51,10 +62,20 @@ protected:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u) = 0;
 
+  void initializeProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
+  // The solvers not supporting the sparse matrices solve the dense problem by default.
+  virtual void initializeSparseProblemImpl(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
   virtual std::vector<double> optimizeImpl() = 0;
 
   std::optional<size_t> variables_num_{std::nullopt};
   std::optional<size_t> constraints_num_{std::nullopt};
+  std::optional<std::vector<double>> initial_primal_variables_{std::nullopt};
 };
 }  // namespace autoware::qp_interface
 
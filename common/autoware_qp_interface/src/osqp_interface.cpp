@@ -351,6 +351,12 @@ std::vector<double> OSQPInterface::getDualSolution() const
 
 std::vector<double> OSQPInterface::optimizeImpl()
 {
+  if (
+    initial_primal_variables_ &&
+    static_cast<int64_t>(initial_primal_variables_->size()) == param_n_) {
+    setPrimalVariables(*initial_primal_variables_);
+  }
+
   osqp_solve(work_.get());
 
   double * sol_x = work_->solution->x;
@@ -372,6 +378,7 @@ std::vector<double> OSQPInterface::optimize(
 {
   initializeCSCProblemImpl(P, A, q, l, u);
   const auto result = optimizeImpl();
+  initial_primal_variables_ = std::nullopt;
 
   // show polish status if not successful
   const int status_polish = static_cast<int>(latest_work_info_.status_polish);
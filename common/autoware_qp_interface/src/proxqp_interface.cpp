@@ -14,10 +14,24 @@
 
 #include "autoware/qp_interface/proxqp_interface.hpp"
 
+#include <algorithm>
+
 namespace autoware::qp_interface
 {
 using proxsuite::proxqp::QPSolverOutput;
 
+namespace
+{
+bool hasSameStructure(const Eigen::SparseMatrix<double> & a, const Eigen::SparseMatrix<double> & b)
+{
+  if (a.rows() != b.rows() || a.cols() != b.cols() || a.nonZeros() != b.nonZeros()) {
+    return false;
+  }
+  return std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.outerSize() + 1, b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(), b.innerIndexPtr());
+}
+}  // namespace
+
 ProxQPInterface::ProxQPInterface(
   const bool enable_warm_start, const int max_iteration, const double eps_abs, const double eps_rel,
   const bool verbose)
@@ -32,6 +46,13 @@ ProxQPInterface::ProxQPInterface(
 void ProxQPInterface::initializeProblemImpl(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeSparseProblemImpl(P.sparseView(), A.sparseView(), q, l, u);
+}
+
+void ProxQPInterface::initializeSparseProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
 {
   const size_t variables_num = q.size();
   const size_t constraints_num = l.size();
@@ -44,7 +65,9 @@ void ProxQPInterface::initializeProblemImpl(
       || !variables_num_ ||
       *variables_num_ != variables_num
       // The number of constraints is the same as the previous one
-      || !constraints_num_ || *constraints_num_ != constraints_num) {
+      || !constraints_num_ || *constraints_num_ != constraints_num
+      // The sparsity structure is the same as the previous one
+      || !hasSameStructure(P, P_prev_) || !hasSameStructure(A, A_prev_)) {
       return false;
     }
     return true;
@@ -61,8 +84,10 @@ void ProxQPInterface::initializeProblemImpl(
 
   qp_ptr_->settings = settings_;
 
-  Eigen::SparseMatrix<double> P_sparse(variables_num, constraints_num);
-  P_sparse = P.sparseView();
+  P_prev_ = P;
+  A_prev_ = A;
+  P_prev_.makeCompressed();
+  A_prev_.makeCompressed();
 
   // NOTE: const std vector cannot be converted to eigen vector
   std::vector<double> non_const_q = q;
@@ -77,10 +102,10 @@ void ProxQPInterface::initializeProblemImpl(
 
   if (enable_warm_start) {
     qp_ptr_->update(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+      P_prev_, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A_prev_, eigen_l, eigen_u);
   } else {
     qp_ptr_->init(
-      P_sparse, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A.sparseView(), eigen_l, eigen_u);
+      P_prev_, eigen_q, proxsuite::nullopt, proxsuite::nullopt, A_prev_, eigen_l, eigen_u);
   }
 }
 
@@ -142,7 +167,14 @@ std::string ProxQPInterface::getStatus() const
 
 std::vector<double> ProxQPInterface::optimizeImpl()
 {
-  qp_ptr_->solve();
+  if (initial_primal_variables_ && initial_primal_variables_->size() == *variables_num_) {
+    qp_ptr_->settings.initial_guess = proxsuite::proxqp::InitialGuessStatus::WARM_START;
+    const Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(
+      initial_primal_variables_->data(), initial_primal_variables_->size());
+    qp_ptr_->solve(x, proxsuite::nullopt, proxsuite::nullopt);
+  } else {
+    qp_ptr_->solve();
+  }
 
   std::vector<double> result;
   for (Eigen::Index i = 0; i < qp_ptr_->results.x.size(); ++i) {
@@ -20,8 +20,11 @@
 
 namespace autoware::qp_interface
 {
-void QPInterface::initializeProblem(
-  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+namespace
+{
+template <typename MatrixT>
+void checkArguments(
+  const MatrixT & P, const MatrixT & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
 {
   // check if arguments are valid
@@ -51,6 +54,14 @@ void QPInterface::initializeProblem(
        << ", u.size() = " << u.size();
     throw std::invalid_argument(ss.str());
   }
+}
+}  // namespace
+
+void QPInterface::initializeProblem(
+  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  checkArguments(P, A, q, l, u);
 
   initializeProblemImpl(P, A, q, l, u);
 
@@ -58,12 +69,43 @@ void QPInterface::initializeProblem(
   constraints_num_ = l.size();
 }
 
+void QPInterface::initializeProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  checkArguments(P, A, q, l, u);
+
+  initializeSparseProblemImpl(P, A, q, l, u);
+
+  variables_num_ = q.size();
+  constraints_num_ = l.size();
+}
+
+void QPInterface::initializeSparseProblemImpl(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeProblemImpl(Eigen::MatrixXd(P), Eigen::MatrixXd(A), q, l, u);
+}
+
 std::vector<double> QPInterface::optimize(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
 {
   initializeProblem(P, A, q, l, u);
   const auto result = optimizeImpl();
+  initial_primal_variables_ = std::nullopt;
+
+  return result;
+}
+
+std::vector<double> QPInterface::optimize(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  initializeProblem(P, A, q, l, u);
+  const auto result = optimizeImpl();
+  initial_primal_variables_ = std::nullopt;
 
   return result;
 }
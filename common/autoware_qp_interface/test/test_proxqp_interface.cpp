@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 
 #include <tuple>
 #include <vector>
@@ -79,5 +80,23 @@ TEST(TestProxqpInterface, BasicQp)
       EXPECT_EQ(proxqp.getIterationNumber(), 0);
     }
   }
+
+  {
+    // Define sparse problem during optimization with warm start and initial guess
+    const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+    const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+    autoware::qp_interface::ProxQPInterface proxqp(true, 4000, 1e-9, 1e-9, false);
+    {
+      const auto solution = proxqp.QPInterface::optimize(P_sparse, A_sparse, q, l, u);
+      const auto status = proxqp.getStatus();
+      check_result(solution, status);
+    }
+    {
+      proxqp.setInitialPrimalVariables({0.0, 1.0});
+      const auto solution = proxqp.QPInterface::optimize(P_sparse, A_sparse, q, l, u);
+      const auto status = proxqp.getStatus();
+      check_result(solution, status);
+    }
+  }
 }
 }  // namespace
@@ -50,6 +50,16 @@ struct sDifferenceAnBn
   std::vector<double> Bn;
 };
 
+// (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2), a first order section has b2 = a2 = 0
+struct sSecondOrderSection
+{
+  double b0{1.};
+  double b1{};
+  double b2{};
+  double a1{};
+  double a2{};
+};
+
 class ButterworthFilter
 {
 public:
@@ -76,6 +86,10 @@ public:
   [[nodiscard]] std::vector<double> getAn() const;
   [[nodiscard]] std::vector<double> getBn() const;
 
+  // Get the discrete time transfer function as a cascade of second order sections, which stays
+  // accurate for the higher orders unlike An and Bn. Call computeDiscreteTimeTF beforehand.
+  [[nodiscard]] std::vector<sSecondOrderSection> getSecondOrderSections() const;
+
   // computes continuous time transfer function
   void computeContinuousTimeTF(bool const & use_sampling_frequency = false);
 
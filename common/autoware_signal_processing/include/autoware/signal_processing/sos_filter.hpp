@@ -0,0 +1,67 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__SIGNAL_PROCESSING__SOS_FILTER_HPP_
+#define AUTOWARE__SIGNAL_PROCESSING__SOS_FILTER_HPP_
+
+#include "autoware/signal_processing/butterworth.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace autoware::signal_processing
+{
+/**
+ * @brief Filters multiple channels through the same cascade of second order sections, e.g. the
+ * ones of ButterworthFilter::getSecondOrderSections(). The states of a section are stored channel
+ * by channel, so that a sample of all the channels is filtered in a single vectorized pass.
+ */
+class MultiChannelSOSFilter
+{
+public:
+  MultiChannelSOSFilter(const std::vector<sSecondOrderSection> & sections, size_t num_channels);
+
+  // Filters a sample of all the channels, where input and output have num_channels values and may
+  // be the same
+  void filter(const double * input, double * output);
+  std::vector<double> filter(const std::vector<double> & input);
+
+  // Resets the channels to zero, or to the steady state of the constant inputs of each channel
+  void reset();
+  void reset(const std::vector<double> & steady_input);
+
+  [[nodiscard]] size_t getNumChannels() const { return num_channels_; }
+
+private:
+  std::vector<sSecondOrderSection> sections_;
+  size_t num_channels_;
+
+  // transposed direct form II states, [section][channel]
+  std::vector<double> z1_;
+  std::vector<double> z2_;
+};
+
+/**
+ * @brief Filters the signals forward and backward through the sections, which cancels the phase
+ * delay. Each pass starts from the steady state of the first sample to reduce the edge transient.
+ * @param signals [in] channels of the same length
+ */
+std::vector<std::vector<double>> filtfilt(
+  const std::vector<sSecondOrderSection> & sections,
+  const std::vector<std::vector<double>> & signals);
+std::vector<double> filtfilt(
+  const std::vector<sSecondOrderSection> & sections, const std::vector<double> & signal);
+}  // namespace autoware::signal_processing
+
+#endif  // AUTOWARE__SIGNAL_PROCESSING__SOS_FILTER_HPP_
@@ -325,6 +325,45 @@ std::vector<double> ButterworthFilter::getBn() const
 {
   return AnBn_.Bn;
 }
+
+/**
+ * @brief Pairs the complex conjugate discrete time roots (and the real roots two by two) into the
+ * second order sections. All the zeros are at -1, and the gain is put in the first section.
+ * */
+std::vector<sSecondOrderSection> ButterworthFilter::getSecondOrderSections() const
+{
+  const double imag_tol{1e-10};
+
+  std::vector<sSecondOrderSection> sections;
+  std::vector<double> real_roots;
+  for (size_t i = 0; i < static_cast<size_t>(filter_specs_.N); ++i) {
+    const auto & dr = dt_tf_.discrete_time_roots_[i];
+    if (std::abs(dr.imag()) <= imag_tol) {
+      real_roots.push_back(dr.real());
+    } else if (dr.imag() > 0.0) {
+      // (1 - p z^-1)(1 - conj(p) z^-1) and the zeros (1 + z^-1)^2
+      sections.push_back({1., 2., 1., -2. * dr.real(), std::norm(dr)});
+    }
+  }
+
+  for (size_t i = 0; i + 1 < real_roots.size(); i += 2) {
+    sections.push_back(
+      {1., 2., 1., -(real_roots[i] + real_roots[i + 1]), real_roots[i] * real_roots[i + 1]});
+  }
+  if (real_roots.size() % 2 == 1) {
+    sections.push_back({1., 1., 0., -real_roots.back(), 0.});
+  }
+
+  if (!sections.empty()) {
+    const double gain = dt_tf_.discrete_time_gain_.real();
+    auto & first_section = sections.front();
+    first_section.b0 *= gain;
+    first_section.b1 *= gain;
+    first_section.b2 *= gain;
+  }
+  return sections;
+}
+
 sDifferenceAnBn ButterworthFilter::getAnBn() const
 {
   return AnBn_;
@@ -0,0 +1,141 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/signal_processing/sos_filter.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace autoware::signal_processing
+{
+MultiChannelSOSFilter::MultiChannelSOSFilter(
+  const std::vector<sSecondOrderSection> & sections, const size_t num_channels)
+: sections_(sections),
+  num_channels_(num_channels),
+  z1_(sections.size() * num_channels, 0.0),
+  z2_(sections.size() * num_channels, 0.0)
+{
+}
+
+void MultiChannelSOSFilter::filter(const double * input, double * output)
+{
+  if (input != output) {
+    std::copy(input, input + num_channels_, output);
+  }
+  for (size_t i = 0; i < sections_.size(); ++i) {
+    const auto & s = sections_[i];
+    double * z1 = z1_.data() + i * num_channels_;
+    double * z2 = z2_.data() + i * num_channels_;
+    // the channels are independent, so that this loop is vectorized
+    for (size_t c = 0; c < num_channels_; ++c) {
+      const double x = output[c];
+      const double y = s.b0 * x + z1[c];
+      z1[c] = s.b1 * x - s.a1 * y + z2[c];
+      z2[c] = s.b2 * x - s.a2 * y;
+      output[c] = y;
+    }
+  }
+}
+
+std::vector<double> MultiChannelSOSFilter::filter(const std::vector<double> & input)
+{
+  if (input.size() != num_channels_) {
+    throw std::invalid_argument("input size does not match the number of channels");
+  }
+  std::vector<double> output(num_channels_);
+  filter(input.data(), output.data());
+  return output;
+}
+
+void MultiChannelSOSFilter::reset()
+{
+  std::fill(z1_.begin(), z1_.end(), 0.0);
+  std::fill(z2_.begin(), z2_.end(), 0.0);
+}
+
+void MultiChannelSOSFilter::reset(const std::vector<double> & steady_input)
+{
+  if (steady_input.size() != num_channels_) {
+    throw std::invalid_argument("input size does not match the number of channels");
+  }
+  for (size_t c = 0; c < num_channels_; ++c) {
+    double x = steady_input[c];
+    for (size_t i = 0; i < sections_.size(); ++i) {
+      // the output of a constant input is scaled by the DC gain of the section
+      const auto & s = sections_[i];
+      const double y = x * (s.b0 + s.b1 + s.b2) / (1.0 + s.a1 + s.a2);
+      z2_[i * num_channels_ + c] = s.b2 * x - s.a2 * y;
+      z1_[i * num_channels_ + c] = s.b1 * x - s.a1 * y + z2_[i * num_channels_ + c];
+      x = y;
+    }
+  }
+}
+
+std::vector<std::vector<double>> filtfilt(
+  const std::vector<sSecondOrderSection> & sections,
+  const std::vector<std::vector<double>> & signals)
+{
+  const size_t num_channels = signals.size();
+  const size_t length = signals.empty() ? 0 : signals.front().size();
+  for (const auto & signal : signals) {
+    if (signal.size() != length) {
+      throw std::invalid_argument("signals do not have the same length");
+    }
+  }
+  if (length == 0) {
+    return signals;
+  }
+
+  // interleave the channels, so that a sample of all the channels is filtered at once
+  std::vector<double> samples(length * num_channels);
+  for (size_t c = 0; c < num_channels; ++c) {
+    for (size_t k = 0; k < length; ++k) {
+      samples[k * num_channels + c] = signals[c][k];
+    }
+  }
+
+  MultiChannelSOSFilter sos_filter(sections, num_channels);
+  std::vector<double> steady_input(num_channels);
+
+  // forward pass
+  std::copy(samples.begin(), samples.begin() + num_channels, steady_input.begin());
+  sos_filter.reset(steady_input);
+  for (size_t k = 0; k < length; ++k) {
+    double * sample = samples.data() + k * num_channels;
+    sos_filter.filter(sample, sample);
+  }
+
+  // backward pass
+  std::copy(samples.end() - num_channels, samples.end(), steady_input.begin());
+  sos_filter.reset(steady_input);
+  for (size_t k = length; k-- > 0;) {
+    double * sample = samples.data() + k * num_channels;
+    sos_filter.filter(sample, sample);
+  }
+
+  std::vector<std::vector<double>> filtered_signals(num_channels, std::vector<double>(length));
+  for (size_t c = 0; c < num_channels; ++c) {
+    for (size_t k = 0; k < length; ++k) {
+      filtered_signals[c][k] = samples[k * num_channels + c];
+    }
+  }
+  return filtered_signals;
+}
+
+std::vector<double> filtfilt(
+  const std::vector<sSecondOrderSection> & sections, const std::vector<double> & signal)
+{
+  return filtfilt(sections, std::vector<std::vector<double>>{signal}).front();
+}
+}  // namespace autoware::signal_processing
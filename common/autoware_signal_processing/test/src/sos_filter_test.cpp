@@ -0,0 +1,114 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/signal_processing/butterworth.hpp"
+#include "autoware/signal_processing/sos_filter.hpp"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+using autoware::signal_processing::ButterworthFilter;
+using autoware::signal_processing::filtfilt;
+using autoware::signal_processing::MultiChannelSOSFilter;
+using autoware::signal_processing::sSecondOrderSection;
+
+namespace
+{
+std::vector<sSecondOrderSection> designSections(
+  const int order, const double cut_off_frq_hz, const double sampling_frq_hz)
+{
+  ButterworthFilter bf;
+  bf.setOrder(order);
+  bf.setCutOffFrequency(cut_off_frq_hz, sampling_frq_hz);
+  bf.computeContinuousTimeTF(true);
+  bf.computeDiscreteTimeTF(true);
+  return bf.getSecondOrderSections();
+}
+}  // namespace
+
+TEST(SOSFilter, matchDifferenceEquation)
+{
+  for (const int order : {1, 2, 3, 4, 5}) {
+    ButterworthFilter bf;
+    bf.setOrder(order);
+    bf.setCutOffFrequency(10., 100.);
+    bf.computeContinuousTimeTF(true);
+    bf.computeDiscreteTimeTF(true);
+    const auto An = bf.getAn();
+    const auto Bn = bf.getBn();
+
+    // the impulse response of the cascade and of An * y = Bn * u
+    MultiChannelSOSFilter sos_filter(bf.getSecondOrderSections(), 1);
+    std::vector<double> u(50, 0.0);
+    std::vector<double> y(u.size(), 0.0);
+    u[0] = 1.0;
+    for (size_t k = 0; k < u.size(); ++k) {
+      for (size_t i = 0; i < Bn.size() && i <= k; ++i) {
+        y[k] += Bn[i] * u[k - i];
+      }
+      for (size_t i = 1; i < An.size() && i <= k; ++i) {
+        y[k] -= An[i] * y[k - i];
+      }
+      EXPECT_NEAR(sos_filter.filter({u[k]}).front(), y[k], 1e-12) << "order " << order;
+    }
+  }
+}
+
+TEST(SOSFilter, filterChannelsIndependently)
+{
+  const auto sections = designSections(4, 5., 100.);
+  MultiChannelSOSFilter multi_channel_filter(sections, 3);
+  std::vector<MultiChannelSOSFilter> single_channel_filters(3, MultiChannelSOSFilter(sections, 1));
+
+  for (int k = 0; k < 100; ++k) {
+    const std::vector<double> input{std::sin(0.1 * k), std::cos(0.3 * k), k % 7 - 3.0};
+    const auto output = multi_channel_filter.filter(input);
+    for (size_t c = 0; c < input.size(); ++c) {
+      EXPECT_DOUBLE_EQ(output[c], single_channel_filters[c].filter({input[c]}).front());
+    }
+  }
+}
+
+TEST(SOSFilter, resetToSteadyState)
+{
+  MultiChannelSOSFilter sos_filter(designSections(3, 5., 100.), 2);
+  sos_filter.reset({1.5, -2.0});
+  for (int k = 0; k < 10; ++k) {
+    const auto output = sos_filter.filter({1.5, -2.0});
+    EXPECT_NEAR(output[0], 1.5, 1e-12);
+    EXPECT_NEAR(output[1], -2.0, 1e-12);
+  }
+}
+
+TEST(SOSFilter, filtfilt)
+{
+  const auto sections = designSections(2, 5., 100.);
+
+  // a constant stays, and a slow sine passes without the phase delay
+  std::vector<double> constant(200, 3.0);
+  std::vector<double> slow_sine(200);
+  for (size_t k = 0; k < slow_sine.size(); ++k) {
+    slow_sine[k] = std::sin(2.0 * M_PI * 0.5 * k / 100.);
+  }
+  const auto filtered = filtfilt(sections, {constant, slow_sine});
+  ASSERT_EQ(filtered.size(), 2u);
+  for (size_t k = 0; k < constant.size(); ++k) {
+    EXPECT_NEAR(filtered[0][k], 3.0, 1e-9);
+  }
+  for (size_t k = 20; k + 20 < slow_sine.size(); ++k) {
+    EXPECT_NEAR(filtered[1][k], slow_sine[k], 1e-2);
+  }
+  EXPECT_EQ(filtfilt(sections, slow_sine), filtered[1]);
+}
@@ -167,6 +167,9 @@ TrafficLightElement parse(const YAML::Node & node);
 template <>
 OperationModeState parse(const YAML::Node & node);
 
+template <>
+LaneletRoute parse(const YAML::Node & node);
+
 /**
  * @brief Parses a YAML file and converts it into an object of type T.
  *
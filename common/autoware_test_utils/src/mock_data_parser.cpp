@@ -378,16 +378,31 @@ OperationModeState parse(const YAML::Node & node)
   return msg;
 }
 
+template <>
+LaneletRoute parse(const YAML::Node & node)
+{
+  LaneletRoute lanelet_route;
+  if (node["header"]) {
+    lanelet_route.header = parse<Header>(node["header"]);
+  }
+  lanelet_route.start_pose = (node["start_pose"]) ? parse<Pose>(node["start_pose"]) : Pose();
+  lanelet_route.goal_pose = (node["goal_pose"]) ? parse<Pose>(node["goal_pose"]) : Pose();
+  lanelet_route.segments = parse<std::vector<LaneletSegment>>(node["segments"]);
+  if (node["uuid"]) {
+    lanelet_route.uuid = parse<UUID>(node["uuid"]);
+  }
+  if (node["allow_modification"]) {
+    lanelet_route.allow_modification = node["allow_modification"].as<bool>();
+  }
+  return lanelet_route;
+}
+
 template <>
 LaneletRoute parse(const std::string & filename)
 {
   LaneletRoute lanelet_route;
   try {
-    YAML::Node config = YAML::LoadFile(filename);
-
-    lanelet_route.start_pose = (config["start_pose"]) ? parse<Pose>(config["start_pose"]) : Pose();
-    lanelet_route.goal_pose = (config["goal_pose"]) ? parse<Pose>(config["goal_pose"]) : Pose();
-    lanelet_route.segments = parse<std::vector<LaneletSegment>>(config["segments"]);
+    lanelet_route = parse<LaneletRoute>(YAML::LoadFile(filename));
   } catch (const std::exception & e) {
     RCLCPP_DEBUG(rclcpp::get_logger("autoware_test_utils"), "Exception caught: %s", e.what());
   }
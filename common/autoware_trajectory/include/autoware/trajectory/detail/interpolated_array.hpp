@@ -65,10 +65,18 @@ public:
 
   InterpolatedArray(InterpolatedArray && other) = default;
 
-  bool build(const std::vector<double> & bases, const std::vector<T> & values)
+  /**
+   * @brief Build the array from the bases and values.
+   * @details The arguments are taken by value so that the callers can move their buffers into
+   * the array instead of copying them.
+   * @param bases The bases values.
+   * @param values The values at the bases.
+   * @return True if the interpolator was built successfully, false otherwise.
+   */
+  bool build(std::vector<double> bases, std::vector<T> values)
   {
-    bases_ = bases;
-    values_ = values;
+    bases_ = std::move(bases);
+    values_ = std::move(values);
     return interpolator_->build(bases_, values_);
   }
 
@@ -201,6 +209,12 @@ public:
    * @return A pair containing the axis and values.
    */
   std::pair<std::vector<double>, std::vector<T>> get_data() const { return {bases_, values_}; }
+
+  /**
+   * @brief Get the bases of the array without copying the values.
+   * @return The bases.
+   */
+  [[nodiscard]] const std::vector<double> & get_bases() const { return bases_; }
 };
 
 }  // namespace autoware::trajectory::detail
@@ -246,6 +246,15 @@ public:
    */
   [[nodiscard]] std::vector<PointType> restore(const size_t & min_points = 100) const;
 
+  /**
+   * @brief Restore the trajectory points into the given buffer
+   * @details The buffer is resized to the number of the restored points, so passing the same
+   * buffer repeatedly reuses its memory.
+   * @param points Buffer of the restored points
+   * @param min_points Minimum number of points
+   */
+  void restore(std::vector<PointType> & points, const size_t & min_points = 100) const;
+
   void crop(const double & start, const double & length);
 
   class Builder
@@ -18,6 +18,9 @@
 
 #include <autoware_planning_msgs/msg/path_point.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace autoware::trajectory
 {
 
@@ -29,6 +32,10 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
   std::vector<double> longitudinal_velocity_mps_values;
   std::vector<double> lateral_velocity_mps_values;
   std::vector<double> heading_rate_rps_values;
+  poses.reserve(points.size());
+  longitudinal_velocity_mps_values.reserve(points.size());
+  lateral_velocity_mps_values.reserve(points.size());
+  heading_rate_rps_values.reserve(points.size());
 
   for (const auto & point : points) {
     poses.emplace_back(point.pose);
@@ -40,9 +47,10 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
   bool is_valid = true;
 
   is_valid &= Trajectory<geometry_msgs::msg::Pose>::build(poses);
-  is_valid &= this->longitudinal_velocity_mps.build(bases_, longitudinal_velocity_mps_values);
-  is_valid &= this->lateral_velocity_mps.build(bases_, lateral_velocity_mps_values);
-  is_valid &= this->heading_rate_rps.build(bases_, heading_rate_rps_values);
+  is_valid &=
+    this->longitudinal_velocity_mps.build(bases_, std::move(longitudinal_velocity_mps_values));
+  is_valid &= this->lateral_velocity_mps.build(bases_, std::move(lateral_velocity_mps_values));
+  is_valid &= this->heading_rate_rps.build(bases_, std::move(heading_rate_rps_values));
 
   return is_valid;
 }
@@ -60,30 +68,31 @@ PointType Trajectory<PointType>::compute(double s) const
 
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
 {
-  auto get_bases = [](const auto & interpolated_array) {
-    auto [bases, values] = interpolated_array.get_data();
-    return bases;
-  };
+  std::vector<PointType> points;
+  restore(points, min_points);
+  return points;
+}
 
+void Trajectory<PointType>::restore(
+  std::vector<PointType> & points, const size_t & min_points) const
+{
   auto bases = detail::merge_vectors(
-    bases_, get_bases(this->longitudinal_velocity_mps), get_bases(this->lateral_velocity_mps),
-    get_bases(this->heading_rate_rps));
+    bases_, this->longitudinal_velocity_mps.get_bases(), this->lateral_velocity_mps.get_bases(),
+    this->heading_rate_rps.get_bases());
 
   bases = detail::crop_bases(bases, start_, end_);
   bases = detail::fill_bases(bases, min_points);
 
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
+  points.resize(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    const double s = bases[i];
+    auto & p = points[i];
     p.pose = Trajectory<geometry_msgs::msg::Pose>::compute(s);
     p.longitudinal_velocity_mps = static_cast<float>(this->longitudinal_velocity_mps.compute(s));
     p.lateral_velocity_mps = static_cast<float>(this->lateral_velocity_mps.compute(s));
     p.heading_rate_rps = static_cast<float>(this->heading_rate_rps.compute(s));
-    points.emplace_back(p);
+    p.is_final = false;
   }
-
-  return points;
 }
 
 }  // namespace autoware::trajectory
@@ -16,6 +16,9 @@
 
 #include "autoware/trajectory/detail/utils.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace autoware::trajectory
 {
 
@@ -25,6 +28,8 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
 {
   std::vector<autoware_planning_msgs::msg::PathPoint> path_points;
   std::vector<std::vector<int64_t>> lane_ids_values;
+  path_points.reserve(points.size());
+  lane_ids_values.reserve(points.size());
 
   for (const auto & point : points) {
     path_points.emplace_back(point.point);
@@ -32,7 +37,7 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
   }
   bool is_valid = true;
   is_valid &= BaseClass::build(path_points);
-  is_valid &= lane_ids.build(bases_, lane_ids_values);
+  is_valid &= lane_ids.build(bases_, std::move(lane_ids_values));
   return is_valid;
 }
 
@@ -47,27 +52,27 @@ PointType Trajectory<PointType>::compute(double s) const
 
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
 {
-  auto get_bases = [](const auto & interpolated_array) {
-    auto [bases, values] = interpolated_array.get_data();
-    return bases;
-  };
+  std::vector<PointType> points;
+  restore(points, min_points);
+  return points;
+}
 
+void Trajectory<PointType>::restore(
+  std::vector<PointType> & points, const size_t & min_points) const
+{
   auto bases = detail::merge_vectors(
-    bases_, get_bases(this->longitudinal_velocity_mps), get_bases(this->lateral_velocity_mps),
-    get_bases(this->heading_rate_rps), get_bases(this->lane_ids));
+    bases_, this->longitudinal_velocity_mps.get_bases(), this->lateral_velocity_mps.get_bases(),
+    this->heading_rate_rps.get_bases(), this->lane_ids.get_bases());
 
   bases = detail::crop_bases(bases, start_, end_);
   bases = detail::fill_bases(bases, min_points);
 
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
-    p.point = BaseClass::compute(s);
-    p.lane_ids = lane_ids.compute(s);
-    points.emplace_back(p);
+  points.resize(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    auto & p = points[i];
+    p.point = BaseClass::compute(bases[i]);
+    p.lane_ids = lane_ids.compute(bases[i]);
   }
-  return points;
 }
 
 }  // namespace autoware::trajectory
@@ -33,6 +33,11 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
   std::vector<double> xs;
   std::vector<double> ys;
   std::vector<double> zs;
+  bases_.clear();
+  bases_.reserve(points.size());
+  xs.reserve(points.size());
+  ys.reserve(points.size());
+  zs.reserve(points.size());
 
   bases_.emplace_back(0.0);
   xs.emplace_back(points[0].x);
@@ -110,19 +115,24 @@ double Trajectory<PointType>::curvature(double s) const
 }
 
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
+{
+  std::vector<PointType> points;
+  restore(points, min_points);
+  return points;
+}
+
+void Trajectory<PointType>::restore(
+  std::vector<PointType> & points, const size_t & min_points) const
 {
   auto bases = detail::crop_bases(bases_, start_, end_);
   bases = detail::fill_bases(bases, min_points);
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
-    p.x = x_interpolator_->compute(s);
-    p.y = y_interpolator_->compute(s);
-    p.z = z_interpolator_->compute(s);
-    points.emplace_back(p);
+  points.resize(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    auto & p = points[i];
+    p.x = x_interpolator_->compute(bases[i]);
+    p.y = y_interpolator_->compute(bases[i]);
+    p.z = z_interpolator_->compute(bases[i]);
   }
-  return points;
 }
 
 void Trajectory<PointType>::crop(const double & start, const double & length)
@@ -85,18 +85,23 @@ void Trajectory<PointType>::align_orientation_with_trajectory_direction()
 }
 
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
+{
+  std::vector<PointType> points;
+  restore(points, min_points);
+  return points;
+}
+
+void Trajectory<PointType>::restore(
+  std::vector<PointType> & points, const size_t & min_points) const
 {
   auto bases = detail::crop_bases(bases_, start_, end_);
   bases = detail::fill_bases(bases, min_points);
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
-    p.position = BaseClass::compute(s);
-    p.orientation = orientation_interpolator_->compute(s);
-    points.emplace_back(p);
+  points.resize(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    auto & p = points[i];
+    p.position = BaseClass::compute(bases[i]);
+    p.orientation = orientation_interpolator_->compute(bases[i]);
   }
-  return points;
 }
 
 }  // namespace autoware::trajectory
@@ -135,6 +135,16 @@ TEST_F(TrajectoryTest, restore)
     auto points = trajectory->restore(0);
     EXPECT_EQ(11, points.size());
   }
+
+  {  // restore into a buffer larger than the result
+    const auto expected_points = trajectory->restore(0);
+    std::vector<tier4_planning_msgs::msg::PathPointWithLaneId> points(20);
+    trajectory->restore(points, 0);
+    ASSERT_EQ(expected_points.size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(expected_points.at(i), points.at(i));
+    }
+  }
 }
 
 TEST_F(TrajectoryTest, crossed)
@@ -16,6 +16,7 @@
 #define AUTOWARE__UNIVERSE_UTILS__GEOMETRY__BOOST_POLYGON_UTILS_HPP_
 
 #include "autoware/universe_utils/geometry/boost_geometry.hpp"
+#include "autoware/universe_utils/geometry/fixed_convex_polygon_2d.hpp"
 
 #include <autoware_perception_msgs/msg/detected_object.hpp>
 #include <autoware_perception_msgs/msg/predicted_object.hpp>
@@ -45,6 +46,10 @@ Polygon2d toPolygon2d(const autoware_perception_msgs::msg::PredictedObject & obj
 Polygon2d toFootprint(
   const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
   const double base_to_rear, const double width);
+/// @brief same as toFootprint() but nothing is allocated on the heap
+alt::FixedConvexPolygon2d<4> toFixedFootprint(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width);
 double getArea(const autoware_perception_msgs::msg::Shape & shape);
 Polygon2d expandPolygon(const Polygon2d & input_polygon, const double offset);
 }  // namespace autoware::universe_utils
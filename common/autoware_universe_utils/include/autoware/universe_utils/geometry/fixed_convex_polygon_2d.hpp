@@ -0,0 +1,326 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__GEOMETRY__FIXED_CONVEX_POLYGON_2D_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__GEOMETRY__FIXED_CONVEX_POLYGON_2D_HPP_
+
+#include "autoware/universe_utils/geometry/alt_geometry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+namespace alt
+{
+/**
+ * @brief convex polygon whose vertices are stored in an array of fixed capacity
+ * @details unlike ConvexPolygon2d, nothing is allocated on the heap, so the polygon can be created
+ * in the loops of the collision checks. The vertices are stored in clockwise order without the
+ * closing point.
+ * @tparam N maximum number of the vertices
+ */
+template <std::size_t N>
+class FixedConvexPolygon2d
+{
+  static_assert(N >= 3, "a polygon needs at least 3 vertices");
+
+public:
+  /**
+   * @brief create a polygon from the vertices in [first, last)
+   * @details the closing point is ignored if any, and the vertices are reordered clockwise
+   * @return std::nullopt if the number of the vertices is less than 3 or more than N, or the
+   * polygon is not convex
+   */
+  template <typename Iterator>
+  static std::optional<FixedConvexPolygon2d> create(Iterator first, Iterator last) noexcept
+  {
+    FixedConvexPolygon2d poly;
+    for (auto it = first; it != last; ++it) {
+      const Point2d point(*it);
+      const bool is_closing_point = poly.size_ > 0 && std::next(it) == last &&
+                                    point.x() == poly.vertices_[0].x() &&
+                                    point.y() == poly.vertices_[0].y();
+      if (is_closing_point) {
+        break;
+      }
+      if (poly.size_ == N) {
+        return std::nullopt;
+      }
+      poly.vertices_[poly.size_++] = point;
+    }
+    if (poly.size_ < 3) {
+      return std::nullopt;
+    }
+
+    // keep the first vertex as inverseClockwise() does
+    if (poly.signed_area() > 0.0) {
+      const auto begin = poly.vertices_.begin();
+      std::reverse(std::next(begin), std::next(begin, poly.size_));
+    }
+    for (std::size_t i = 0; i < poly.size_; ++i) {
+      const auto & p1 = poly[i];
+      const auto & p2 = poly[(i + 1) % poly.size_];
+      const auto & p3 = poly[(i + 2) % poly.size_];
+      if ((p2 - p1).cross(p3 - p2) > 0.0) {
+        return std::nullopt;
+      }
+    }
+    return poly;
+  }
+
+  static std::optional<FixedConvexPolygon2d> create(
+    const autoware::universe_utils::Polygon2d & polygon) noexcept
+  {
+    return create(polygon.outer().begin(), polygon.outer().end());
+  }
+
+  std::size_t size() const noexcept { return size_; }
+
+  const Point2d & operator[](const std::size_t i) const noexcept { return vertices_[i]; }
+
+  const Point2d * begin() const noexcept { return vertices_.data(); }
+
+  const Point2d * end() const noexcept { return vertices_.data() + size_; }
+
+  autoware::universe_utils::Polygon2d to_boost() const
+  {
+    autoware::universe_utils::Polygon2d polygon;
+    polygon.outer().reserve(size_ + 1);
+    for (std::size_t i = 0; i <= size_; ++i) {
+      const auto & p = vertices_[i % size_];
+      polygon.outer().emplace_back(p.x(), p.y());
+    }
+    return polygon;
+  }
+
+private:
+  FixedConvexPolygon2d() = default;
+
+  // negative if the vertices are in clockwise order
+  double signed_area() const noexcept
+  {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < size_; ++i) {
+      sum += vertices_[i].cross(vertices_[(i + 1) % size_]);
+    }
+    return sum / 2.0;
+  }
+
+  std::array<Point2d, N> vertices_;
+  std::size_t size_{0};
+};
+}  // namespace alt
+
+namespace detail
+{
+/// @brief project a polygon onto an axis and return the minimum and maximum values
+template <std::size_t N>
+std::pair<double, double> project(
+  const alt::FixedConvexPolygon2d<N> & poly, const alt::Vector2d & axis) noexcept
+{
+  double min = std::numeric_limits<double>::max();
+  double max = std::numeric_limits<double>::lowest();
+  for (const auto & p : poly) {
+    const double projection = p.dot(axis);
+    min = std::min(min, projection);
+    max = std::max(max, projection);
+  }
+  return {min, max};
+}
+
+/// @brief check if any edge normal of poly separates poly and other
+template <std::size_t N, std::size_t M>
+bool has_separating_axis(
+  const alt::FixedConvexPolygon2d<N> & poly, const alt::FixedConvexPolygon2d<M> & other) noexcept
+{
+  for (std::size_t i = 0; i < poly.size(); ++i) {
+    const auto edge = poly[(i + 1) % poly.size()] - poly[i];
+    const alt::Vector2d axis = {edge.y(), -edge.x()};
+    const auto [min1, max1] = project(poly, axis);
+    const auto [min2, max2] = project(other, axis);
+    if (max1 < min2 || max2 < min1) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool intersects(const Box2d & box1, const Box2d & box2) noexcept
+{
+  return box1.min_corner().x() <= box2.max_corner().x() &&
+         box2.min_corner().x() <= box1.max_corner().x() &&
+         box1.min_corner().y() <= box2.max_corner().y() &&
+         box2.min_corner().y() <= box1.max_corner().y();
+}
+}  // namespace detail
+
+template <std::size_t N>
+double area(const alt::FixedConvexPolygon2d<N> & poly) noexcept
+{
+  double area = 0.0;
+  for (std::size_t i = 1; i + 1 < poly.size(); ++i) {
+    area += (poly[i + 1] - poly[0]).cross(poly[i] - poly[0]) / 2;
+  }
+  return area;
+}
+
+/// @brief axis-aligned bounding box of the polygon
+template <std::size_t N>
+Box2d bounding_box(const alt::FixedConvexPolygon2d<N> & poly) noexcept
+{
+  double min_x = poly[0].x();
+  double min_y = poly[0].y();
+  double max_x = min_x;
+  double max_y = min_y;
+  for (const auto & p : poly) {
+    min_x = std::min(min_x, p.x());
+    min_y = std::min(min_y, p.y());
+    max_x = std::max(max_x, p.x());
+    max_y = std::max(max_y, p.y());
+  }
+  return {{min_x, min_y}, {max_x, max_y}};
+}
+
+template <std::size_t N>
+bool covered_by(const alt::Point2d & point, const alt::FixedConvexPolygon2d<N> & poly) noexcept
+{
+  // the inside of a clockwise polygon is on the right of every edge
+  for (std::size_t i = 0; i < poly.size(); ++i) {
+    if ((poly[(i + 1) % poly.size()] - poly[i]).cross(point - poly[i]) > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief check if 2 polygons intersect using the separating axis theorem
+ * @details polygons touching each other are considered to intersect as sat::intersects() does
+ */
+template <std::size_t N, std::size_t M>
+bool intersects(
+  const alt::FixedConvexPolygon2d<N> & poly1, const alt::FixedConvexPolygon2d<M> & poly2) noexcept
+{
+  return !detail::has_separating_axis(poly1, poly2) && !detail::has_separating_axis(poly2, poly1);
+}
+
+template <std::size_t N>
+double distance(const alt::Point2d & point, const alt::FixedConvexPolygon2d<N> & poly)
+{
+  if (covered_by(point, poly)) {
+    return 0.0;
+  }
+
+  double min_distance = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < poly.size(); ++i) {
+    min_distance = std::min(min_distance, distance(point, poly[i], poly[(i + 1) % poly.size()]));
+  }
+  return min_distance;
+}
+
+template <std::size_t N, std::size_t M>
+double distance(
+  const alt::FixedConvexPolygon2d<N> & poly1, const alt::FixedConvexPolygon2d<M> & poly2)
+{
+  if (intersects(poly1, poly2)) {
+    return 0.0;
+  }
+
+  // the closest points of disjoint convex polygons include a vertex of either of them
+  double min_distance = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < poly2.size(); ++i) {
+    const auto & seg_start = poly2[i];
+    const auto & seg_end = poly2[(i + 1) % poly2.size()];
+    for (const auto & p : poly1) {
+      min_distance = std::min(min_distance, distance(p, seg_start, seg_end));
+    }
+  }
+  for (std::size_t i = 0; i < poly1.size(); ++i) {
+    const auto & seg_start = poly1[i];
+    const auto & seg_end = poly1[(i + 1) % poly1.size()];
+    for (const auto & p : poly2) {
+      min_distance = std::min(min_distance, distance(p, seg_start, seg_end));
+    }
+  }
+  return min_distance;
+}
+
+/**
+ * @brief indices of the polygons intersecting poly
+ * @details the polygons whose bounding box does not intersect that of poly are skipped before the
+ * separating axis test
+ */
+template <std::size_t N, std::size_t M>
+std::vector<std::size_t> intersecting_indices(
+  const alt::FixedConvexPolygon2d<N> & poly,
+  const std::vector<alt::FixedConvexPolygon2d<M>> & polys)
+{
+  const auto box = bounding_box(poly);
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < polys.size(); ++i) {
+    if (detail::intersects(box, bounding_box(polys[i])) && intersects(poly, polys[i])) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+/**
+ * @brief pairs of the indices of the intersecting polygons in polys1 and polys2, sorted by the
+ * index in polys1 and then polys2
+ * @details the bounding boxes of polys2 are sorted by their minimum x so that only the polygons
+ * overlapping in the x range are tested for each polygon in polys1
+ */
+template <std::size_t N, std::size_t M>
+std::vector<std::pair<std::size_t, std::size_t>> intersecting_pairs(
+  const std::vector<alt::FixedConvexPolygon2d<N>> & polys1,
+  const std::vector<alt::FixedConvexPolygon2d<M>> & polys2)
+{
+  std::vector<Box2d> boxes2;
+  boxes2.reserve(polys2.size());
+  for (const auto & poly : polys2) {
+    boxes2.push_back(bounding_box(poly));
+  }
+  std::vector<std::size_t> sorted_indices2(polys2.size());
+  std::iota(sorted_indices2.begin(), sorted_indices2.end(), 0);
+  std::sort(sorted_indices2.begin(), sorted_indices2.end(), [&](const auto a, const auto b) {
+    return boxes2[a].min_corner().x() < boxes2[b].min_corner().x();
+  });
+
+  std::vector<std::pair<std::size_t, std::size_t>> index_pairs;
+  for (std::size_t i = 0; i < polys1.size(); ++i) {
+    const auto box1 = bounding_box(polys1[i]);
+    const auto begin_size = index_pairs.size();
+    for (const auto j : sorted_indices2) {
+      if (boxes2[j].min_corner().x() > box1.max_corner().x()) {
+        break;
+      }
+      if (detail::intersects(box1, boxes2[j]) && intersects(polys1[i], polys2[j])) {
+        index_pairs.emplace_back(i, j);
+      }
+    }
+    std::sort(std::next(index_pairs.begin(), begin_size), index_pairs.end());
+  }
+  return index_pairs;
+}
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__GEOMETRY__FIXED_CONVEX_POLYGON_2D_HPP_
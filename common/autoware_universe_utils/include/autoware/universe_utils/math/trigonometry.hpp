@@ -16,6 +16,7 @@
 #define AUTOWARE__UNIVERSE_UTILS__MATH__TRIGONOMETRY_HPP_
 
 #include <utility>
+#include <vector>
 
 namespace autoware::universe_utils
 {
@@ -28,6 +29,29 @@ std::pair<float, float> sin_and_cos(float radian);
 
 float opencv_fast_atan2(float dy, float dx);
 
+/**
+ * @brief sin_and_cos() of each angle
+ * @details the results are the same as those of sin_and_cos(), but the quadrant is handled without
+ * branches so that the loop is cheaper for many angles, e.g. the points of a point cloud.
+ * @param[in] radians angles [rad]
+ * @param[out] sin_values sine of the angles, resized to the size of radians
+ * @param[out] cos_values cosine of the angles, resized to the size of radians
+ */
+void sin_and_cos(
+  const std::vector<float> & radians, std::vector<float> & sin_values,
+  std::vector<float> & cos_values);
+
+/**
+ * @brief opencv_fast_atan2() of each pair of dy and dx
+ * @details the results are the same as those of opencv_fast_atan2(). The loop has no branches, so
+ * it can be vectorized by the compiler.
+ * @param[in] dys y components, which must have the same size as dxs
+ * @param[in] dxs x components
+ * @param[out] radians angles in [0, 2 * pi) [rad], resized to the size of dxs
+ */
+void opencv_fast_atan2(
+  const std::vector<float> & dys, const std::vector<float> & dxs, std::vector<float> & radians);
+
 }  // namespace autoware::universe_utils
 
 #endif  // AUTOWARE__UNIVERSE_UTILS__MATH__TRIGONOMETRY_HPP_
@@ -140,39 +140,46 @@ private:
     const std::string & target_frame, const std::string & source_frame,
     Eigen::Matrix4f & eigen_transform)
   {
-    if (
-      std::find(warn_frames.begin(), warn_frames.end(), target_frame) != warn_frames.end() ||
-      std::find(warn_frames.begin(), warn_frames.end(), source_frame) != warn_frames.end()) {
-      RCLCPP_WARN(
-        node_->get_logger(), "Using %s -> %s transform. This may not be a static transform.",
-        target_frame.c_str(), source_frame.c_str());
+    // Most nodes query the same pair on every call, so check it without hashing or copying the
+    // frame names
+    if (last_key_ && last_key_->first == target_frame && last_key_->second == source_frame) {
+      eigen_transform = *last_transform_;
+      return true;
     }
 
     auto key = std::make_pair(target_frame, source_frame);
-    auto key_inv = std::make_pair(source_frame, target_frame);
 
     // Check if the transform is already in the buffer
     auto it = buffer_.find(key);
     if (it != buffer_.end()) {
       eigen_transform = it->second;
+      cacheLastKey(*it);
       return true;
     }
 
     // Check if the inverse transform is already in the buffer
-    auto it_inv = buffer_.find(key_inv);
+    auto it_inv = buffer_.find(std::make_pair(source_frame, target_frame));
     if (it_inv != buffer_.end()) {
       eigen_transform = it_inv->second.inverse();
-      buffer_[key] = eigen_transform;
+      cacheLastKey(*buffer_.emplace(std::move(key), eigen_transform).first);
       return true;
     }
 
     // Check if transform is needed
     if (target_frame == source_frame) {
       eigen_transform = Eigen::Matrix4f::Identity();
-      buffer_[key] = eigen_transform;
+      cacheLastKey(*buffer_.emplace(std::move(key), eigen_transform).first);
       return true;
     }
 
+    if (
+      std::find(warn_frames.begin(), warn_frames.end(), target_frame) != warn_frames.end() ||
+      std::find(warn_frames.begin(), warn_frames.end(), source_frame) != warn_frames.end()) {
+      RCLCPP_WARN(
+        node_->get_logger(), "Using %s -> %s transform. This may not be a static transform.",
+        target_frame.c_str(), source_frame.c_str());
+    }
+
     // Get the transform from the TF tree
     tf_listener_ = std::make_unique<autoware::universe_utils::TransformListener>(node_);
     auto tf = tf_listener_->getTransform(
@@ -186,10 +193,17 @@ private:
       return false;
     }
     pcl_ros::transformAsMatrix(*tf, eigen_transform);
-    buffer_[key] = eigen_transform;
+    cacheLastKey(*buffer_.emplace(std::move(key), eigen_transform).first);
     return true;
   }
 
+  void cacheLastKey(const TFMap::value_type & element)
+  {
+    // the references to the elements of std::unordered_map stay valid after the insertions
+    last_key_ = &element.first;
+    last_transform_ = &element.second;
+  }
+
   /** @brief Retrieves a transform between two dynamic frames.
    *
    * This function attempts to retrieve a transform between the target frame and the source frame.
@@ -218,6 +232,8 @@ private:
   }
 
   TFMap buffer_;
+  const Key * last_key_{nullptr};  //!< Key of the last transform queried in buffer_
+  const Eigen::Matrix4f * last_transform_{nullptr};
   rclcpp::Node * const node_;
   std::unique_ptr<autoware::universe_utils::TransformListener> tf_listener_;
   std::function<bool(const std::string &, const std::string &, Eigen::Matrix4f &)> get_transform_;
@@ -16,9 +16,14 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace autoware::universe_utils
@@ -42,7 +47,8 @@ namespace polling_policy
  * @brief Polling policy that keeps the latest received message.
  *
  * This policy retains the latest received message and provides it when requested. If a new message
- * is received, it overwrites the previously stored message.
+ * is received, it overwrites the previously stored message. The message is kept by the policy, so
+ * the subscription can be shared by several consumers.
  *
  * @tparam MessageT The message type.
  */
@@ -51,8 +57,13 @@ class Latest
 {
 private:
   typename MessageT::ConstSharedPtr data_{nullptr};  ///< Data pointer to store the latest data
+  std::shared_ptr<MessageT> buffer_{nullptr};  ///< Message to take into, reused until taken
+  std::mutex take_mutex_;                      ///< Serializes the takes of the consumers
 
 protected:
+  static constexpr bool is_shareable = true;
+
+
   /**
    * @brief Check the QoS settings for the subscription.
    *
@@ -72,6 +83,9 @@ public:
   /**
    * @brief Retrieve the latest data. If no new data has been received, the previously received data
    *
+   * If another consumer of the shared subscription is taking the data, this does not wait for it
+   * and returns the data received so far.
+   *
    * @return typename MessageT::ConstSharedPtr The latest data.
    */
   typename MessageT::ConstSharedPtr takeData();
@@ -85,7 +99,13 @@ public:
 template <typename MessageT>
 class Newest
 {
+private:
+  std::shared_ptr<MessageT> buffer_{nullptr};  ///< Message to take into, reused until taken
+
 protected:
+  static constexpr bool is_shareable = false;
+
+
   /**
    * @brief Check the QoS settings for the subscription.
    *
@@ -118,7 +138,13 @@ public:
 template <typename MessageT>
 class All
 {
+private:
+  std::shared_ptr<MessageT> buffer_{nullptr};  ///< Message to take into, reused until taken
+
 protected:
+  static constexpr bool is_shareable = false;
+
+
   /**
    * @brief Check the QoS settings for the subscription.
    *
@@ -135,6 +161,49 @@ public:
   std::vector<typename MessageT::ConstSharedPtr> takeData();
 };
 
+/**
+ * @brief Polling policy that keeps the window of the recently received messages.
+ *
+ * The size of the window is the depth of the QoS. The messages are kept by the policy, so the
+ * subscription can be shared by several consumers.
+ *
+ * @tparam MessageT The message type.
+ */
+template <typename MessageT>
+class Window
+{
+private:
+  size_t window_size_{1};
+  std::deque<typename MessageT::ConstSharedPtr> data_;  ///< Messages of the window, oldest first
+  std::shared_ptr<MessageT> buffer_{nullptr};  ///< Message to take into, reused until taken
+  std::mutex take_mutex_;                      ///< Serializes the takes of the consumers
+
+protected:
+  static constexpr bool is_shareable = true;
+
+  /**
+   * @brief Check the QoS settings for the subscription, and set the size of the window.
+   *
+   * @param qos The QoS profile to check.
+   * @throws std::invalid_argument If the QoS depth is 0.
+   */
+  void checkQoS(const rclcpp::QoS & qos)
+  {
+    if (qos.get_rmw_qos_profile().depth < 1) {
+      throw std::invalid_argument("InterProcessPollingSubscriber with Window needs depth >= 1");
+    }
+    window_size_ = qos.get_rmw_qos_profile().depth;
+  }
+
+public:
+  /**
+   * @brief Retrieve the messages of the window, including the ones received in the previous calls.
+   *
+   * @return std::vector<typename MessageT::ConstSharedPtr> The messages, oldest first.
+   */
+  std::vector<typename MessageT::ConstSharedPtr> takeData();
+};
+
 }  // namespace polling_policy
 
 /**
@@ -193,6 +262,38 @@ public:
       node, topic_name, qos);
   }
 
+  /**
+   * @brief Create a subscription shared with the other callers for the same node and topic.
+   *
+   * The modules of a node polling the same topic then take the messages from one subscription. The
+   * QoS of the first caller is used. Only the policies keeping the messages can be shared, as the
+   * others hand each message to only one consumer.
+   *
+   * @param node The node to attach the subscriber to.
+   * @param topic_name The topic name to subscribe to.
+   * @param qos The QoS profile to use for the subscription.
+   * @return SharedPtr The subscription shared for the node and topic.
+   */
+  static SharedPtr create_shared_subscription(
+    rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos = rclcpp::QoS{1})
+  {
+    static_assert(
+      PollingPolicy<MessageT>::is_shareable,
+      "The polling policy hands each message to only one consumer, so it can not be shared");
+    using Key = std::pair<const rclcpp::Node *, std::string>;
+    static std::mutex mutex;
+    static std::map<Key, std::weak_ptr<InterProcessPollingSubscriber>> subscriptions;
+
+    const Key key{node, node->get_node_topics_interface()->resolve_topic_name(topic_name)};
+    std::lock_guard<std::mutex> lock(mutex);
+    if (const auto subscription = subscriptions[key].lock()) {
+      return subscription;
+    }
+    const auto subscription = create_subscription(node, topic_name, qos);
+    subscriptions[key] = subscription;
+    return subscription;
+  }
+
   typename rclcpp::Subscription<MessageT>::SharedPtr subscriber() { return subscriber_; }
 };
 
@@ -204,14 +305,20 @@ typename MessageT::ConstSharedPtr Latest<MessageT>::takeData()
 {
   auto & subscriber =
     static_cast<InterProcessPollingSubscriber<MessageT, Latest> *>(this)->subscriber_;
-  auto new_data = std::make_shared<MessageT>();
-  rclcpp::MessageInfo message_info;
-  const bool success = subscriber->take(*new_data, message_info);
-  if (success) {
-    data_ = new_data;
+  std::unique_lock<std::mutex> lock(take_mutex_, std::try_to_lock);
+  if (lock.owns_lock()) {
+    if (!buffer_) {
+      buffer_ = std::make_shared<MessageT>();
+    }
+    rclcpp::MessageInfo message_info;
+    const bool success = subscriber->take(*buffer_, message_info);
+    if (success) {
+      std::atomic_store(&data_, typename MessageT::ConstSharedPtr{std::move(buffer_)});
+      buffer_ = nullptr;
+    }
   }
 
-  return data_;
+  return std::atomic_load(&data_);
 }
 
 template <typename MessageT>
@@ -219,11 +326,13 @@ typename MessageT::ConstSharedPtr Newest<MessageT>::takeData()
 {
   auto & subscriber =
     static_cast<InterProcessPollingSubscriber<MessageT, Newest> *>(this)->subscriber_;
-  auto new_data = std::make_shared<MessageT>();
+  if (!buffer_) {
+    buffer_ = std::make_shared<MessageT>();
+  }
   rclcpp::MessageInfo message_info;
-  const bool success = subscriber->take(*new_data, message_info);
+  const bool success = subscriber->take(*buffer_, message_info);
   if (success) {
-    return new_data;
+    return std::exchange(buffer_, nullptr);
   }
   return nullptr;
 }
@@ -236,9 +345,11 @@ std::vector<typename MessageT::ConstSharedPtr> All<MessageT>::takeData()
   std::vector<typename MessageT::ConstSharedPtr> data;
   rclcpp::MessageInfo message_info;
   for (;;) {
-    auto datum = std::make_shared<MessageT>();
-    if (subscriber->take(*datum, message_info)) {
-      data.push_back(datum);
+    if (!buffer_) {
+      buffer_ = std::make_shared<MessageT>();
+    }
+    if (subscriber->take(*buffer_, message_info)) {
+      data.push_back(std::exchange(buffer_, nullptr));
     } else {
       break;
     }
@@ -246,6 +357,28 @@ std::vector<typename MessageT::ConstSharedPtr> All<MessageT>::takeData()
   return data;
 }
 
+template <typename MessageT>
+std::vector<typename MessageT::ConstSharedPtr> Window<MessageT>::takeData()
+{
+  auto & subscriber =
+    static_cast<InterProcessPollingSubscriber<MessageT, Window> *>(this)->subscriber_;
+  std::lock_guard<std::mutex> lock(take_mutex_);
+  rclcpp::MessageInfo message_info;
+  for (;;) {
+    if (!buffer_) {
+      buffer_ = std::make_shared<MessageT>();
+    }
+    if (!subscriber->take(*buffer_, message_info)) {
+      break;
+    }
+    data_.push_back(std::exchange(buffer_, nullptr));
+    if (data_.size() > window_size_) {
+      data_.pop_front();
+    }
+  }
+  return {data_.begin(), data_.end()};
+}
+
 }  // namespace polling_policy
 
 }  // namespace autoware::universe_utils
@@ -16,7 +16,9 @@
 
 #include <cstddef>
 #include <list>
+#include <iterator>
 #include <optional>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -40,6 +42,8 @@ private:
   std::list<std::pair<Key, Value>> cache_list_;  ///< List to maintain the order of elements.
   Map<Key, typename std::list<std::pair<Key, Value>>::iterator>
     cache_map_;  ///< Map for fast access to elements.
+  size_t hit_count_{0};   ///< The number of the cache hits.
+  size_t miss_count_{0};  ///< The number of the cache misses.
 
 public:
   /**
@@ -65,20 +69,54 @@ public:
    * @param key The key to insert.
    * @param value The value to insert.
    */
-  void put(const Key & key, const Value & value)
+  void put(const Key & key, const Value & value) { emplace(key, value); }
+
+  /**
+   * @brief Insert a key-value pair into the cache, moving the value.
+   *
+   * @param key The key to insert.
+   * @param value The value to insert.
+   */
+  void put(const Key & key, Value && value) { emplace(key, std::move(value)); }
+
+  /**
+   * @brief Insert a key and the value constructed from the arguments into the cache.
+   *
+   * Once the cache is full, the list node and the map node of the least recently used element are
+   * reused for the new element, so no memory is allocated.
+   *
+   * @param key The key to insert.
+   * @param args The arguments to construct the value.
+   */
+  template <typename... Args>
+  void emplace(const Key & key, Args &&... args)
   {
     auto it = cache_map_.find(key);
     if (it != cache_map_.end()) {
-      cache_list_.erase(it->second);
+      it->second->second = Value(std::forward<Args>(args)...);
+      cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
+      return;
+    }
+    if (capacity_ == 0) {
+      return;
     }
-    cache_list_.push_front({key, value});
-    cache_map_[key] = cache_list_.begin();
 
-    if (cache_map_.size() > capacity_) {
-      auto last = cache_list_.back();
-      cache_map_.erase(last.first);
-      cache_list_.pop_back();
+    if (cache_map_.size() < capacity_) {
+      cache_list_.emplace_front(
+        std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+      cache_map_.emplace(key, cache_list_.begin());
+      return;
     }
+
+    Value value(std::forward<Args>(args)...);
+    auto node = cache_map_.extract(cache_list_.back().first);
+    cache_list_.splice(cache_list_.begin(), cache_list_, std::prev(cache_list_.end()));
+    cache_list_.front().first = key;
+    cache_list_.front().second = std::move(value);
+    node.key() = key;
+    node.mapped() = cache_list_.begin();
+    cache_map_.insert(std::move(node));
   }
 
   /**
@@ -91,15 +129,49 @@ public:
    * @return The value associated with the key, or std::nullopt if the key does not exist.
    */
   std::optional<Value> get(const Key & key)
+  {
+    const auto * value = find(key);
+    if (value == nullptr) {
+      return std::nullopt;
+    }
+    return *value;
+  }
+
+  /**
+   * @brief Retrieve a pointer to a value in the cache without copying it.
+   *
+   * If the key exists, the element is moved to the front. The pointer is valid until the element
+   * is removed from the cache.
+   *
+   * @param key The key to retrieve.
+   * @return The pointer to the value associated with the key, or nullptr if the key does not exist.
+   */
+  Value * find(const Key & key)
   {
     auto it = cache_map_.find(key);
     if (it == cache_map_.end()) {
-      return std::nullopt;
+      ++miss_count_;
+      return nullptr;
     }
+    ++hit_count_;
     cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
-    return it->second->second;
+    return &it->second->second;
   }
 
+  /**
+   * @brief Get the number of the calls of get() and find() which found the key.
+   *
+   * @return The number of the cache hits.
+   */
+  [[nodiscard]] size_t hit_count() const { return hit_count_; }
+
+  /**
+   * @brief Get the number of the calls of get() and find() which did not find the key.
+   *
+   * @return The number of the cache misses.
+   */
+  [[nodiscard]] size_t miss_count() const { return miss_count_; }
+
   /**
    * @brief Clear the cache.
    *
@@ -22,6 +22,7 @@
 #include <tier4_debug_msgs/msg/processing_time_node.hpp>
 #include <tier4_debug_msgs/msg/processing_time_tree.hpp>
 
+#include <chrono>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -140,6 +141,15 @@ public:
    */
   void add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr publisher);
 
+  /**
+   * @brief Measure only one in every interval trees of the tracks
+   * @details the tracks in the other trees only count their depth without reading the clock or
+   * allocating the nodes, so that the tracks can be left in the hot loops
+   *
+   * @param interval Sampling interval, where 1 measures every tree
+   */
+  void set_sampling_interval(const size_t interval);
+
   /**
    * @brief Start tracking the processing time of a function
    *
@@ -171,9 +181,12 @@ private:
     current_time_node_;                            //!< Shared pointer to the current time node
   std::shared_ptr<ProcessingTimeNode> root_node_;  //!< Shared pointer to the root time node
   std::thread::id root_node_thread_id_;            //!< ID of the thread that started the tracking
-  autoware::universe_utils::StopWatch<
-    std::chrono::milliseconds, std::chrono::microseconds, std::chrono::steady_clock>
-    stop_watch_;  //!< StopWatch object for tracking the processing time
+  std::vector<std::chrono::steady_clock::time_point>
+    start_times_;  //!< Start times of the tracks from the root to the current time node
+
+  size_t sampling_interval_{1};  //!< Interval of the trees to be measured
+  size_t root_track_count_{0};   //!< Number of the trees started so far
+  size_t skipped_depth_{0};      //!< Depth of the tracks in the tree which is not measured
 
   std::vector<std::function<void(const std::shared_ptr<ProcessingTimeNode> &)>>
     reporters_;  //!< Vector of functions for reporting the processing times
@@ -20,6 +20,8 @@
 
 #include <tf2/utils.h>
 
+#include <array>
+
 namespace
 {
 namespace bg = boost::geometry;
@@ -204,27 +206,40 @@ Polygon2d toFootprint(
   const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
   const double base_to_rear, const double width)
 {
-  Polygon2d polygon;
-  const auto point0 =
-    autoware::universe_utils::calcOffsetPose(base_link_pose, base_to_front, width / 2.0, 0.0)
-      .position;
-  const auto point1 =
-    autoware::universe_utils::calcOffsetPose(base_link_pose, base_to_front, -width / 2.0, 0.0)
-      .position;
-  const auto point2 =
-    autoware::universe_utils::calcOffsetPose(base_link_pose, -base_to_rear, -width / 2.0, 0.0)
-      .position;
-  const auto point3 =
-    autoware::universe_utils::calcOffsetPose(base_link_pose, -base_to_rear, width / 2.0, 0.0)
-      .position;
-
-  appendPointToPolygon(polygon, point0);
-  appendPointToPolygon(polygon, point1);
-  appendPointToPolygon(polygon, point2);
-  appendPointToPolygon(polygon, point3);
-  appendPointToPolygon(polygon, point0);
+  return toFixedFootprint(base_link_pose, base_to_front, base_to_rear, width).to_boost();
+}
 
-  return isClockwise(polygon) ? polygon : inverseClockwise(polygon);
+alt::FixedConvexPolygon2d<4> toFixedFootprint(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width)
+{
+  // the first 2 rows of the rotation matrix computed in the same way as tf2::Matrix3x3, so that
+  // the vertices are the same as those given by calcOffsetPose()
+  const auto & q = base_link_pose.orientation;
+  const double s = 2.0 / (q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+  const double xs = q.x * s;
+  const double ys = q.y * s;
+  const double zs = q.z * s;
+  const double xx = q.x * xs;
+  const double xy = q.x * ys;
+  const double yy = q.y * ys;
+  const double zz = q.z * zs;
+  const double wz = q.w * zs;
+  const double r00 = 1.0 - (yy + zz);
+  const double r01 = xy - wz;
+  const double r10 = xy + wz;
+  const double r11 = 1.0 - (xx + zz);
+
+  const auto & position = base_link_pose.position;
+  const auto offset_point = [&](const double x, const double y) {
+    return alt::Point2d{r00 * x + r01 * y + position.x, r10 * x + r11 * y + position.y};
+  };
+  const std::array<alt::Point2d, 4> vertices = {
+    offset_point(base_to_front, width / 2.0), offset_point(base_to_front, -width / 2.0),
+    offset_point(-base_to_rear, -width / 2.0), offset_point(-base_to_rear, width / 2.0)};
+
+  // a rectangle is always convex
+  return alt::FixedConvexPolygon2d<4>::create(vertices.begin(), vertices.end()).value();
 }
 
 double getArea(const autoware_perception_msgs::msg::Shape & shape)
@@ -17,7 +17,9 @@
 #include "autoware/universe_utils/math/constants.hpp"
 #include "autoware/universe_utils/math/sin_table.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace autoware::universe_utils
 {
@@ -72,6 +74,35 @@ std::pair<float, float> sin_and_cos(float radian)
   }
 }
 
+void sin_and_cos(
+  const std::vector<float> & radians, std::vector<float> & sin_values,
+  std::vector<float> & cos_values)
+{
+  constexpr float tmp =
+    (180.f / static_cast<float>(autoware::universe_utils::pi)) * (discrete_arcs_num_360 / 360.f);
+
+  sin_values.resize(radians.size());
+  cos_values.resize(radians.size());
+  for (size_t i = 0; i < radians.size(); ++i) {
+    const float degree = radians[i] * tmp;
+    // the same as the double modulo of sin_and_cos() since discrete_arcs_num_360 is a power of 2
+    const size_t idx =
+      static_cast<size_t>(static_cast<int>(std::round(degree))) & (discrete_arcs_num_360 - 1);
+
+    // the sine and cosine in the first quadrant are swapped in the odd quadrants, and negated
+    // depending on the quadrant, as the branches of the scalar sin_and_cos()
+    const size_t quadrant = idx / discrete_arcs_num_90;
+    const size_t remainder = idx - quadrant * discrete_arcs_num_90;
+    const float a = g_sin_table[remainder];
+    const float b = g_sin_table[discrete_arcs_num_90 - remainder];
+    const bool is_odd_quadrant = quadrant % 2 == 1;
+    const float sin_abs = is_odd_quadrant ? b : a;
+    const float cos_abs = is_odd_quadrant ? a : b;
+    sin_values[i] = quadrant < 2 ? sin_abs : -sin_abs;
+    cos_values[i] = (quadrant == 0 || quadrant == 3) ? cos_abs : -cos_abs;
+  }
+}
+
 // This code is modified from a part of the OpenCV project
 // (https://github.com/opencv/opencv/blob/4.x/modules/core/src/mathfuncs_core.simd.hpp). It is
 // subject to the license terms in the LICENSE file found in the top-level directory of this
@@ -125,4 +156,33 @@ float opencv_fast_atan2(float dy, float dx)
   return a;
 }
 
+void opencv_fast_atan2(
+  const std::vector<float> & dys, const std::vector<float> & dxs, std::vector<float> & radians)
+{
+  radians.resize(dxs.size());
+  for (size_t i = 0; i < dxs.size(); ++i) {
+    const float ax = std::abs(dxs[i]);
+    const float ay = std::abs(dys[i]);
+
+    // the same arithmetic as opencv_fast_atan2(), where the branches are replaced by min/max and
+    // the blends with 0 or 1. They give exactly the same values and let the compiler vectorize the
+    // loop.
+    const float is_x_major = ax >= ay;
+    const float is_x_negative = dxs[i] < 0;
+    const float is_y_negative = dys[i] < 0;
+    const float c = std::min(ax, ay) / (std::max(ax, ay) + detail_fast_atan2::atan2_DBL_EPSILON);
+    const float c2 = c * c;
+    const float poly = (((detail_fast_atan2::atan2_p7 * c2 + detail_fast_atan2::atan2_p5) * c2 +
+                         detail_fast_atan2::atan2_p3) *
+                          c2 +
+                        detail_fast_atan2::atan2_p1) *
+                       c;
+    float a = is_x_major * poly + (1.f - is_x_major) * (90.f - poly);
+    a = is_x_negative * (180.f - a) + (1.f - is_x_negative) * a;
+    a = is_y_negative * (360.f - a) + (1.f - is_y_negative) * a;
+
+    radians[i] = a * autoware::universe_utils::pi / 180.f;
+  }
+}
+
 }  // namespace autoware::universe_utils
@@ -127,12 +127,24 @@ void TimeKeeper::add_reporter(rclcpp::Publisher<ProcessingTimeDetail>::SharedPtr
   });
 }
 
+void TimeKeeper::set_sampling_interval(const size_t interval)
+{
+  if (interval == 0) {
+    throw std::invalid_argument("The sampling interval of TimeKeeper must be positive");
+  }
+  sampling_interval_ = interval;
+}
+
 void TimeKeeper::start_track(const std::string & func_name)
 {
-  if (current_time_node_ == nullptr) {
+  if (current_time_node_ == nullptr && skipped_depth_ == 0) {
+    root_node_thread_id_ = std::this_thread::get_id();
+    if (root_track_count_++ % sampling_interval_ != 0) {
+      skipped_depth_ = 1;
+      return;
+    }
     current_time_node_ = std::make_shared<ProcessingTimeNode>(func_name);
     root_node_ = current_time_node_;
-    root_node_thread_id_ = std::this_thread::get_id();
   } else {
     if (root_node_thread_id_ != std::this_thread::get_id()) {
       RCLCPP_WARN(
@@ -140,13 +152,20 @@ void TimeKeeper::start_track(const std::string & func_name)
         "TimeKeeper::start_track() is called from a different thread. Ignoring the call.");
       return;
     }
+    if (skipped_depth_ > 0) {
+      ++skipped_depth_;
+      return;
+    }
     current_time_node_ = current_time_node_->add_child(func_name);
   }
-  stop_watch_.tic(func_name);
+  start_times_.push_back(std::chrono::steady_clock::now());
 }
 
 void TimeKeeper::comment(const std::string & comment)
 {
+  if (skipped_depth_ > 0) {
+    return;
+  }
   if (current_time_node_ == nullptr) {
     throw std::runtime_error("You must call start_track() first, but comment() is called");
   }
@@ -158,12 +177,18 @@ void TimeKeeper::end_track(const std::string & func_name)
   if (root_node_thread_id_ != std::this_thread::get_id()) {
     return;
   }
+  if (skipped_depth_ > 0) {
+    --skipped_depth_;
+    return;
+  }
   if (current_time_node_->get_name() != func_name) {
     throw std::runtime_error(fmt::format(
       "You must call end_track({}) first, but end_track({}) is called",
       current_time_node_->get_name(), func_name));
   }
-  const double processing_time = stop_watch_.toc(func_name);
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_times_.back();
+  const double processing_time = std::chrono::duration<double, std::milli>(elapsed_time).count();
+  start_times_.pop_back();
   current_time_node_->set_time(processing_time);
   current_time_node_ = current_time_node_->get_parent_node().lock();
 
@@ -0,0 +1,154 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/geometry/boost_polygon_utils.hpp"
+#include "autoware/universe_utils/geometry/fixed_convex_polygon_2d.hpp"
+#include "autoware/universe_utils/geometry/geometry.hpp"
+#include "autoware/universe_utils/geometry/random_convex_polygon.hpp"
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+constexpr double epsilon = 1e-6;
+
+using autoware::universe_utils::alt::FixedConvexPolygon2d;
+using autoware::universe_utils::alt::Point2d;
+
+TEST(fixed_convex_polygon_2d, create)
+{
+  {  // counter-clockwise vertices with the closing point
+    const std::vector<Point2d> vertices = {
+      {0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}, {0.0, 0.0}};
+    const auto poly = FixedConvexPolygon2d<4>::create(vertices.begin(), vertices.end());
+    ASSERT_TRUE(poly);
+    ASSERT_EQ(poly->size(), 4u);
+    EXPECT_DOUBLE_EQ((*poly)[0].x(), 0.0);
+    EXPECT_DOUBLE_EQ((*poly)[0].y(), 0.0);
+    EXPECT_DOUBLE_EQ((*poly)[1].x(), 0.0);
+    EXPECT_DOUBLE_EQ((*poly)[1].y(), 1.0);
+    EXPECT_DOUBLE_EQ((*poly)[3].x(), 1.0);
+    EXPECT_DOUBLE_EQ((*poly)[3].y(), 0.0);
+  }
+
+  {  // too many vertices
+    const std::vector<Point2d> vertices = {{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {1.0, 0.0}};
+    EXPECT_FALSE(FixedConvexPolygon2d<3>::create(vertices.begin(), vertices.end()));
+  }
+
+  {  // too few vertices
+    const std::vector<Point2d> vertices = {{0.0, 0.0}, {0.0, 1.0}, {0.0, 0.0}};
+    EXPECT_FALSE(FixedConvexPolygon2d<3>::create(vertices.begin(), vertices.end()));
+  }
+
+  {  // concave polygon
+    const std::vector<Point2d> vertices = {{0.0, 0.0}, {1.0, 2.0}, {1.0, 0.5}, {2.0, 0.0}};
+    EXPECT_FALSE(FixedConvexPolygon2d<4>::create(vertices.begin(), vertices.end()));
+  }
+}
+
+TEST(fixed_convex_polygon_2d, compareWithBoost)
+{
+  using autoware::universe_utils::area;
+  using autoware::universe_utils::distance;
+  using autoware::universe_utils::intersects;
+
+  std::vector<autoware::universe_utils::Polygon2d> boost_polygons;
+  std::vector<FixedConvexPolygon2d<8>> polygons;
+  for (size_t i = 0; i < 100; ++i) {
+    const auto boost_polygon = autoware::universe_utils::random_convex_polygon(3 + i % 6, 5.0);
+    const auto polygon = FixedConvexPolygon2d<8>::create(boost_polygon);
+    ASSERT_TRUE(polygon);
+    boost_polygons.push_back(boost_polygon);
+    polygons.push_back(*polygon);
+  }
+
+  for (size_t i = 0; i < polygons.size(); ++i) {
+    EXPECT_NEAR(area(polygons.at(i)), boost::geometry::area(boost_polygons.at(i)), epsilon);
+
+    const Point2d point = {0.1 * i - 5.0, 5.0 - 0.1 * i};
+    EXPECT_NEAR(
+      distance(point, polygons.at(i)),
+      boost::geometry::distance(
+        autoware::universe_utils::Point2d(point.x(), point.y()), boost_polygons.at(i)),
+      epsilon);
+
+    for (size_t j = 0; j < polygons.size(); ++j) {
+      EXPECT_EQ(
+        intersects(polygons.at(i), polygons.at(j)),
+        boost::geometry::intersects(boost_polygons.at(i), boost_polygons.at(j)));
+      EXPECT_NEAR(
+        distance(polygons.at(i), polygons.at(j)),
+        boost::geometry::distance(boost_polygons.at(i), boost_polygons.at(j)), epsilon);
+    }
+  }
+}
+
+TEST(fixed_convex_polygon_2d, batchIntersects)
+{
+  using autoware::universe_utils::intersecting_indices;
+  using autoware::universe_utils::intersecting_pairs;
+  using autoware::universe_utils::intersects;
+
+  std::vector<FixedConvexPolygon2d<8>> polygons1;
+  std::vector<FixedConvexPolygon2d<4>> polygons2;
+  for (size_t i = 0; i < 50; ++i) {
+    polygons1.push_back(
+      *FixedConvexPolygon2d<8>::create(autoware::universe_utils::random_convex_polygon(8, 5.0)));
+    polygons2.push_back(
+      *FixedConvexPolygon2d<4>::create(autoware::universe_utils::random_convex_polygon(4, 5.0)));
+  }
+
+  std::vector<std::pair<size_t, size_t>> expected_pairs;
+  for (size_t i = 0; i < polygons1.size(); ++i) {
+    std::vector<size_t> expected_indices;
+    for (size_t j = 0; j < polygons2.size(); ++j) {
+      if (intersects(polygons1.at(i), polygons2.at(j))) {
+        expected_indices.push_back(j);
+        expected_pairs.emplace_back(i, j);
+      }
+    }
+    EXPECT_EQ(intersecting_indices(polygons1.at(i), polygons2), expected_indices);
+  }
+  EXPECT_EQ(intersecting_pairs(polygons1, polygons2), expected_pairs);
+}
+
+TEST(fixed_convex_polygon_2d, toFixedFootprint)
+{
+  using autoware::universe_utils::toFixedFootprint;
+  using autoware::universe_utils::toFootprint;
+
+  geometry_msgs::msg::Pose pose;
+  pose.position = autoware::universe_utils::createPoint(1.0, 2.0, 0.0);
+  for (const double yaw : {-2.0, 0.0, 0.5, M_PI_4, 3.0}) {
+    pose.orientation = autoware::universe_utils::createQuaternionFromYaw(yaw);
+    const auto footprint = toFixedFootprint(pose, 4.0, 1.0, 2.0);
+    const auto boost_footprint = toFootprint(pose, 4.0, 1.0, 2.0);
+    ASSERT_EQ(footprint.size() + 1, boost_footprint.outer().size());
+    for (size_t i = 0; i < footprint.size(); ++i) {
+      EXPECT_DOUBLE_EQ(footprint[i].x(), boost_footprint.outer().at(i).x());
+      EXPECT_DOUBLE_EQ(footprint[i].y(), boost_footprint.outer().at(i).y());
+      const auto offset_point = autoware::universe_utils::calcOffsetPose(
+                                  pose, i < 2 ? 4.0 : -1.0, (i == 0 || i == 3) ? 1.0 : -1.0, 0.0)
+                                  .position;
+      EXPECT_NEAR(footprint[i].x(), offset_point.x, epsilon);
+      EXPECT_NEAR(footprint[i].y(), offset_point.y, epsilon);
+    }
+  }
+}
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <vector>
 
 TEST(trigonometry, sin)
 {
@@ -75,3 +76,42 @@ TEST(trigonometry, opencv_fast_atan2)
       << "fast atan2 = " << fast_atan << ", std::atan2 = " << std_atan;
   }
 }
+
+TEST(trigonometry, sin_and_cos_batch)
+{
+  std::vector<float> radians;
+  for (int i = -1000; i <= 1000; ++i) {
+    radians.push_back(0.0123f * static_cast<float>(i));
+  }
+
+  std::vector<float> sin_values;
+  std::vector<float> cos_values;
+  autoware::universe_utils::sin_and_cos(radians, sin_values, cos_values);
+  ASSERT_EQ(sin_values.size(), radians.size());
+  ASSERT_EQ(cos_values.size(), radians.size());
+  for (size_t i = 0; i < radians.size(); ++i) {
+    const auto sin_and_cos = autoware::universe_utils::sin_and_cos(radians.at(i));
+    EXPECT_FLOAT_EQ(sin_values.at(i), sin_and_cos.first);
+    EXPECT_FLOAT_EQ(cos_values.at(i), sin_and_cos.second);
+  }
+}
+
+TEST(trigonometry, opencv_fast_atan2_batch)
+{
+  std::vector<float> dys;
+  std::vector<float> dxs;
+  for (int i = -20; i <= 20; ++i) {
+    for (int j = -20; j <= 20; ++j) {
+      dys.push_back(0.5f * static_cast<float>(i));
+      dxs.push_back(0.5f * static_cast<float>(j));
+    }
+  }
+
+  std::vector<float> radians;
+  autoware::universe_utils::opencv_fast_atan2(dys, dxs, radians);
+  ASSERT_EQ(radians.size(), dxs.size());
+  for (size_t i = 0; i < dxs.size(); ++i) {
+    EXPECT_FLOAT_EQ(
+      radians.at(i), autoware::universe_utils::opencv_fast_atan2(dys.at(i), dxs.at(i)));
+  }
+}
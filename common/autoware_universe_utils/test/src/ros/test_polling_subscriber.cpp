@@ -0,0 +1,101 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/ros/polling_subscriber.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <std_msgs/msg/header.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using autoware::universe_utils::InterProcessPollingSubscriber;
+using std_msgs::msg::Header;
+using LatestSubscriber = InterProcessPollingSubscriber<Header>;
+using WindowSubscriber =
+  InterProcessPollingSubscriber<Header, autoware::universe_utils::polling_policy::Window>;
+
+namespace
+{
+Header createHeader(const std::string & frame_id)
+{
+  Header header;
+  header.frame_id = frame_id;
+  return header;
+}
+
+// polls until the condition holds, as the messages are delivered asynchronously
+template <class Condition>
+bool waitFor(Condition condition)
+{
+  for (int i = 0; i < 100; ++i) {
+    if (condition()) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+}  // namespace
+
+TEST(PollingSubscriber, SharedLatestSubscription)
+{
+  auto node = std::make_shared<rclcpp::Node>("polling_subscriber_shared_latest_node");
+  auto publisher = node->create_publisher<Header>("shared_latest_topic", 1);
+
+  const auto first_subscriber =
+    LatestSubscriber::create_shared_subscription(node.get(), "shared_latest_topic");
+  const auto second_subscriber =
+    LatestSubscriber::create_shared_subscription(node.get(), "shared_latest_topic");
+  EXPECT_EQ(first_subscriber, second_subscriber);
+
+  publisher->publish(createHeader("first"));
+  ASSERT_TRUE(waitFor([&]() { return first_subscriber->takeData() != nullptr; }));
+
+  // the message taken by one consumer is kept for the others
+  const auto data = second_subscriber->takeData();
+  ASSERT_NE(data, nullptr);
+  EXPECT_EQ(data->frame_id, "first");
+}
+
+TEST(PollingSubscriber, Window)
+{
+  auto node = std::make_shared<rclcpp::Node>("polling_subscriber_window_node");
+  auto publisher = node->create_publisher<Header>("window_topic", 3);
+  const auto subscriber =
+    WindowSubscriber::create_subscription(node.get(), "window_topic", rclcpp::QoS{2});
+
+  std::vector<Header::ConstSharedPtr> data;
+  publisher->publish(createHeader("first"));
+  ASSERT_TRUE(waitFor([&]() {
+    data = subscriber->takeData();
+    return data.size() == 1;
+  }));
+
+  // the window keeps the messages of the previous calls, up to its size
+  publisher->publish(createHeader("second"));
+  publisher->publish(createHeader("third"));
+  ASSERT_TRUE(waitFor([&]() {
+    data = subscriber->takeData();
+    return !data.empty() && data.back()->frame_id == "third";
+  }));
+  ASSERT_EQ(data.size(), 2u);
+  EXPECT_EQ(data.front()->frame_id, "second");
+}
@@ -18,6 +18,8 @@
 #include <chrono>
 #include <cstdint>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <utility>
 
 using autoware::universe_utils::LRUCache;
@@ -76,3 +78,47 @@ TEST(FibonacciLRUCacheTest, CompareResultsAndPerformance)
     cache.clear();
   }
 }
+
+TEST(LRUCacheTest, EvictLeastRecentlyUsed)
+{
+  LRUCache<int, std::string> cache(2);
+  cache.put(1, "one");
+  cache.put(2, "two");
+  EXPECT_EQ(*cache.get(1), "one");
+
+  // 2 is the least recently used
+  cache.put(3, "three");
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(3));
+
+  // updating the value also marks it as recently used
+  cache.put(1, "uno");
+  cache.put(4, "four");
+  EXPECT_EQ(*cache.get(1), "uno");
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(*cache.get(4), "four");
+  EXPECT_FALSE(cache.get(3));
+
+  EXPECT_EQ(cache.hit_count(), 3u);
+  EXPECT_EQ(cache.miss_count(), 1u);
+}
+
+TEST(LRUCacheTest, MoveOnlyValue)
+{
+  LRUCache<int, std::unique_ptr<int>> cache(2);
+  cache.put(1, std::make_unique<int>(1));
+  cache.emplace(2, new int(2));
+  cache.emplace(3, std::make_unique<int>(3));
+
+  EXPECT_EQ(cache.find(1), nullptr);
+  ASSERT_NE(cache.find(2), nullptr);
+  EXPECT_EQ(**cache.find(2), 2);
+  ASSERT_NE(cache.find(3), nullptr);
+  EXPECT_EQ(**cache.find(3), 3);
+
+  // the pointer refers to the value in the cache
+  **cache.find(3) = 30;
+  EXPECT_EQ(**cache.find(3), 30);
+}
@@ -20,6 +20,8 @@
 
 #include <chrono>
 #include <sstream>
+#include <stdexcept>
+#include <string>
 #include <thread>
 
 class TimeKeeperTest : public ::testing::Test
@@ -90,3 +92,25 @@ TEST_F(TimeKeeperTest, MultiThreadWarning)
     err.find("TimeKeeper::start_track() is called from a different thread. Ignoring the call.") !=
     std::string::npos);
 }
+
+TEST_F(TimeKeeperTest, SamplingInterval)
+{
+  using autoware::universe_utils::ScopedTimeTrack;
+
+  EXPECT_THROW(time_keeper->set_sampling_interval(0), std::invalid_argument);
+  time_keeper->set_sampling_interval(3);
+
+  for (size_t i = 0; i < 7; ++i) {
+    ScopedTimeTrack st{"main_func", *time_keeper};
+    ScopedTimeTrack st_child{"funcA", *time_keeper};
+    time_keeper->comment("iteration " + std::to_string(i));
+  }
+
+  // only the 1st, 4th and 7th trees are reported
+  const std::string output = oss.str();
+  EXPECT_NE(output.find("iteration 0"), std::string::npos);
+  EXPECT_EQ(output.find("iteration 1"), std::string::npos);
+  EXPECT_EQ(output.find("iteration 2"), std::string::npos);
+  EXPECT_NE(output.find("iteration 3"), std::string::npos);
+  EXPECT_NE(output.find("iteration 6"), std::string::npos);
+}
@@ -23,10 +23,18 @@
 #include <tvm_vendor/tvm/runtime/packed_func.h>
 #include <tvm_vendor/tvm/runtime/registry.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -184,6 +192,202 @@ private:
   PostProcessorType post_processor_{};
 };
 
+/**
+ * @class AsyncPipeline
+ * @brief Inference Pipeline running each of the 3 stages on its own thread, so that the stages
+ * of the consecutive inputs overlap.
+ *
+ * The stages return the tensors they own and reuse on every call, which are handed to the next
+ * stage without a copy. A stage therefore runs again only after the next stage is done with its
+ * previous output: the preprocessing and the postprocessing of the consecutive inputs overlap,
+ * and the inference runs alone on the device.
+ */
+template <class PreProcessorType, class InferenceEngineType, class PostProcessorType>
+class AsyncPipeline
+{
+  using InputType = decltype(std::declval<PreProcessorType>().input_type_indicator_);
+  using OutputType = decltype(std::declval<PostProcessorType>().output_type_indicator_);
+
+public:
+  /**
+   * @brief Construct a new AsyncPipeline object and start the stage threads
+   *
+   * @param pre_processor a PreProcessor object
+   * @param inference_engine a InferenceEngine object
+   * @param post_processor a PostProcessor object
+   * @param max_queue_size the number of the inputs waiting for the preprocessing, beyond which
+   * schedule blocks
+   */
+  AsyncPipeline(
+    PreProcessorType pre_processor, InferenceEngineType inference_engine,
+    PostProcessorType post_processor, const size_t max_queue_size = 1)
+  : pre_processor_(pre_processor),
+    inference_engine_(inference_engine),
+    post_processor_(post_processor),
+    max_queue_size_(std::max<size_t>(max_queue_size, 1))
+  {
+    pre_processor_thread_ = std::thread([this]() { runPreProcessor(); });
+    inference_engine_thread_ = std::thread([this]() { runInferenceEngine(); });
+    post_processor_thread_ = std::thread([this]() { runPostProcessor(); });
+  }
+
+  AsyncPipeline(const AsyncPipeline &) = delete;
+  AsyncPipeline & operator=(const AsyncPipeline &) = delete;
+
+  /**
+   * @brief Stop the stage threads. The outputs of the inputs not processed yet are not set.
+   */
+  ~AsyncPipeline()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    condition_.notify_all();
+    pre_processor_thread_.join();
+    inference_engine_thread_.join();
+    post_processor_thread_.join();
+  }
+
+  /**
+   * @brief push the input into the pipeline. Blocks while the queue of the inputs is full.
+   *
+   * @param input The data to push into the pipeline
+   * @return The future of the pipeline output, which rethrows the exception of a stage
+   */
+  std::future<OutputType> schedule(const InputType & input)
+  {
+    Job job{input, {}, {}};
+    auto output = job.output.get_future();
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stopped_ || input_queue_.size() < max_queue_size_; });
+      input_queue_.push_back(std::move(job));
+    }
+    condition_.notify_all();
+    return output;
+  }
+
+private:
+  struct Job
+  {
+    InputType input;
+    TVMArrayContainerVector tensor;
+    std::promise<OutputType> output;
+  };
+
+  void runPreProcessor()
+  {
+    while (true) {
+      // the preprocessor output is overwritten, so wait for the inference to be done with it
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(
+        lock, [this]() { return stopped_ || (!input_queue_.empty() && !pre_processed_job_); });
+      if (stopped_) {
+        return;
+      }
+      auto job = std::move(input_queue_.front());
+      input_queue_.pop_front();
+      lock.unlock();
+      condition_.notify_all();
+
+      try {
+        job.tensor = pre_processor_.schedule(job.input);
+      } catch (...) {
+        job.output.set_exception(std::current_exception());
+        continue;
+      }
+
+      lock.lock();
+      pre_processed_job_ = std::move(job);
+      lock.unlock();
+      condition_.notify_all();
+    }
+  }
+
+  void runInferenceEngine()
+  {
+    while (true) {
+      // the inference output is overwritten, so wait for the postprocessor to be done with it
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(
+        lock, [this]() { return stopped_ || (pre_processed_job_ && !inferred_job_); });
+      if (stopped_) {
+        return;
+      }
+      auto & job = *pre_processed_job_;
+      lock.unlock();
+
+      std::exception_ptr exception;
+      try {
+        job.tensor = inference_engine_.schedule(job.tensor);
+      } catch (...) {
+        exception = std::current_exception();
+      }
+
+      lock.lock();
+      if (exception) {
+        job.output.set_exception(exception);
+      } else {
+        inferred_job_ = std::move(job);
+      }
+      pre_processed_job_.reset();
+      lock.unlock();
+      condition_.notify_all();
+    }
+  }
+
+  void runPostProcessor()
+  {
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stopped_ || inferred_job_.has_value(); });
+      if (stopped_) {
+        return;
+      }
+      auto & job = *inferred_job_;
+      lock.unlock();
+
+      std::optional<OutputType> output;
+      std::exception_ptr exception;
+      try {
+        output = post_processor_.schedule(job.tensor);
+      } catch (...) {
+        exception = std::current_exception();
+      }
+
+      lock.lock();
+      auto finished_job = std::move(job);
+      inferred_job_.reset();
+      lock.unlock();
+      condition_.notify_all();
+
+      if (exception) {
+        finished_job.output.set_exception(exception);
+      } else {
+        finished_job.output.set_value(std::move(*output));
+      }
+    }
+  }
+
+  PreProcessorType pre_processor_{};
+  InferenceEngineType inference_engine_{};
+  PostProcessorType post_processor_{};
+  size_t max_queue_size_{1};
+
+  // the jobs between the stages, each of which is held until the next stage is done with it
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopped_{false};
+  std::deque<Job> input_queue_;
+  std::optional<Job> pre_processed_job_;
+  std::optional<Job> inferred_job_;
+
+  std::thread pre_processor_thread_;
+  std::thread inference_engine_thread_;
+  std::thread post_processor_thread_;
+};
+
 // NetworkNode
 typedef struct
 {
@@ -25,6 +25,7 @@
 #include <rclcpp/node.hpp>
 
 #include <geometry_msgs/msg/polygon.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
@@ -35,7 +36,6 @@
 #include <pcl/PCLPointCloud2.h>
 #include <pcl/filters/crop_hull.h>
 #include <pcl/filters/extract_indices.h>
-#include <pcl/filters/passthrough.h>
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/point_types.h>
 #include <pcl/registration/gicp.h>
@@ -280,36 +280,38 @@ void AEB::onImu(const Imu::ConstSharedPtr input_msg)
 void AEB::onPointCloud(const PointCloud2::ConstSharedPtr input_msg)
 {
   autoware::universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
-  PointCloud::Ptr pointcloud_ptr(new PointCloud);
-  pcl::fromROSMsg(*input_msg, *pointcloud_ptr);
-
+  Eigen::Affine3f affine = Eigen::Affine3f::Identity();
   if (input_msg->header.frame_id != "base_link") {
-    RCLCPP_ERROR_STREAM(
-      get_logger(),
+    RCLCPP_ERROR_STREAM_THROTTLE(
+      get_logger(), *get_clock(), 5000,
       "[AEB]: Input point cloud frame is not base_link and it is " << input_msg->header.frame_id);
     // transform pointcloud
     const auto logger = get_logger();
     const auto transform_stamped =
       utils::getTransform("base_link", input_msg->header.frame_id, tf_buffer_, logger);
     if (!transform_stamped.has_value()) return;
-
-    // transform by using eigen matrix
-    PointCloud2 transformed_points{};
-    const Eigen::Matrix4f affine_matrix =
-      tf2::transformToEigen(transform_stamped.value().transform).matrix().cast<float>();
-    pcl_ros::transformPointCloud(affine_matrix, *input_msg, transformed_points);
-    pcl::fromROSMsg(transformed_points, *pointcloud_ptr);
+    affine = tf2::transformToEigen(transform_stamped.value().transform).cast<float>();
   }
 
-  // apply z-axis filter for removing False Positive points
+  // transform the points and apply z-axis filter for removing False Positive points in a single
+  // pass over the input buffer
+  const float min_height = detection_range_min_height_;
+  const float max_height = vehicle_info_.vehicle_height_m + detection_range_max_height_margin_;
   PointCloud::Ptr height_filtered_pointcloud_ptr(new PointCloud);
-  pcl::PassThrough<pcl::PointXYZ> height_filter;
-  height_filter.setInputCloud(pointcloud_ptr);
-  height_filter.setFilterFieldName("z");
-  height_filter.setFilterLimits(
-    detection_range_min_height_,
-    vehicle_info_.vehicle_height_m + detection_range_max_height_margin_);
-  height_filter.filter(*height_filtered_pointcloud_ptr);
+  height_filtered_pointcloud_ptr->reserve(input_msg->width * input_msg->height);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*input_msg, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*input_msg, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*input_msg, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f point = affine * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
+    // written so that NaN coordinates are also rejected
+    const bool is_valid = std::isfinite(point.x()) && std::isfinite(point.y()) &&
+                          min_height <= point.z() && point.z() <= max_height;
+    if (!is_valid) {
+      continue;
+    }
+    height_filtered_pointcloud_ptr->push_back(pcl::PointXYZ(point.x(), point.y(), point.z()));
+  }
 
   pcl::VoxelGrid<pcl::PointXYZ> filter;
   PointCloud::Ptr no_height_filtered_pointcloud_ptr(new PointCloud);
@@ -34,6 +34,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -74,17 +75,14 @@ public:
     NearbyObjectTypeFilters nearby_object_type_filters;
   };
 
-  struct TimestampedObject
-  {
-    unique_identifier_msgs::msg::UUID object_id;
-    rclcpp::Time timestamp;
-  };
+  // last time each object is seen, keyed by the hex string of the object id
+  using TimestampedObjects = std::unordered_map<std::string, rclcpp::Time>;
 
 private:
   PredictedObjects filterObjects(const PredictedObjects & objects);
 
   void removeOldObjects(
-    std::vector<TimestampedObject> & container, const rclcpp::Time & current_time,
+    TimestampedObjects & container, const rclcpp::Time & current_time,
     const rclcpp::Duration & duration_sec);
 
   bool shouldBeExcluded(
@@ -126,8 +124,8 @@ private:
   OperationModeState::ConstSharedPtr operation_mode_ptr_;
   rclcpp::Time last_obstacle_found_stamp_;
   std::shared_ptr<PredictedObjects> filtered_object_ptr_;
-  std::vector<TimestampedObject> observed_objects_;
-  std::vector<TimestampedObject> ignored_objects_;
+  TimestampedObjects observed_objects_;
+  TimestampedObjects ignored_objects_;
 
   // Diagnostic Updater
   diagnostic_updater::Updater updater_;
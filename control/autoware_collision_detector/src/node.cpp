@@ -25,19 +25,21 @@
 #include <boost/geometry/geometries/linestring.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 
-#include <pcl/common/transforms.h>
-#include <pcl/point_cloud.h>
-#include <pcl_conversions/pcl_conversions.h>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #define EIGEN_MPL2_ONLY
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include <algorithm>
+#include <cmath>
+
 namespace autoware::collision_detector
 {
 namespace bg = boost::geometry;
 using Point2d = bg::model::d2::point_xy<double>;
 using Polygon2d = bg::model::polygon<Point2d>;
+using Box2d = bg::model::box<Point2d>;
 using autoware::universe_utils::createPoint;
 using autoware::universe_utils::pose2transform;
 
@@ -121,6 +123,21 @@ Polygon2d createSelfPolygon(const VehicleInfo & vehicle_info)
 
   return ego_polygon;
 }
+
+/**
+ * @brief distance from the ego polygon created by createSelfPolygon() to the box, which is the
+ * same as bg::distance() since both of them are axis aligned in base_link
+ */
+double calcDistanceToSelfPolygon(const VehicleInfo & vehicle_info, const Box2d & box)
+{
+  const double dx = std::max(
+    {vehicle_info.min_longitudinal_offset_m - box.max_corner().x(), 0.0,
+     box.min_corner().x() - vehicle_info.max_longitudinal_offset_m});
+  const double dy = std::max(
+    {vehicle_info.min_lateral_offset_m - box.max_corner().y(), 0.0,
+     box.min_corner().y() - vehicle_info.max_lateral_offset_m});
+  return std::hypot(dx, dy);
+}
 }  // namespace
 
 CollisionDetectorNode::CollisionDetectorNode(const rclcpp::NodeOptions & node_options)
@@ -205,67 +222,42 @@ PredictedObjects CollisionDetectorNode::filterObjects(const PredictedObjects & i
 
     const bool is_within_range_and_filtering_class = is_within_range && should_be_excluded;
 
+    const auto object_id = autoware::universe_utils::toHexString(object.object_id);
+
     // If the object is not within range or not a class to be filtered, add it directly
     if (!is_within_range_and_filtering_class) {
       filtered_objects.objects.push_back(object);
 
       // Update observed_objects_
-      auto observed_it = std::find_if(
-        observed_objects_.begin(), observed_objects_.end(),
-        [&object](const auto & observed_object) {
-          return observed_object.object_id == object.object_id;
-        });
-      if (observed_it != observed_objects_.end()) {
-        observed_it->timestamp = current_object_time;
-      } else {
-        observed_objects_.push_back({object.object_id, current_object_time});
-      }
+      observed_objects_[object_id] = current_object_time;
 
       continue;
     }
 
     // Check if the object exists in ignored_objects_
-    auto ignored_it = std::find_if(
-      ignored_objects_.begin(), ignored_objects_.end(), [&object](const auto & ignored_object) {
-        return ignored_object.object_id == object.object_id;
-      });
+    const auto ignored_it = ignored_objects_.find(object_id);
     const bool was_ignored = (ignored_it != ignored_objects_.end());
 
     // If the object was ignored and is still within the ignore period, continue filtering
     if (
-      was_ignored && (current_object_time - ignored_it->timestamp) <
+      was_ignored && (current_object_time - ignored_it->second) <
                        rclcpp::Duration::from_seconds(node_param_.keep_ignoring_time)) {
-      // Check if the object exists in observed_objects_
-      auto observed_it = std::find_if(
-        observed_objects_.begin(), observed_objects_.end(),
-        [&object](const auto & observed_object) {
-          return observed_object.object_id == object.object_id;
-        });
-      const bool was_observed = (observed_it != observed_objects_.end());
-      if (was_observed) {
-        observed_it->timestamp = current_object_time;
-      } else {
-        // Add as a newly observed object and to the ignore list
-        observed_objects_.push_back({object.object_id, current_object_time});
-      }
+      // Update observed_objects_, or add as a newly observed object
+      observed_objects_[object_id] = current_object_time;
       continue;
     }
 
     // Check if the object exists in observed_objects_
-    auto observed_it = std::find_if(
-      observed_objects_.begin(), observed_objects_.end(), [&object](const auto & observed_object) {
-        return observed_object.object_id == object.object_id;
-      });
-    const bool was_observed = (observed_it != observed_objects_.end());
-
-    if (was_observed) {
-      observed_it->timestamp = current_object_time;
+    const auto [observed_it, is_newly_observed] =
+      observed_objects_.try_emplace(object_id, current_object_time);
+
+    if (!is_newly_observed) {
+      observed_it->second = current_object_time;
       // Add without exclusion check
       filtered_objects.objects.push_back(object);
     } else {
-      // Add as a newly observed object and to the ignore list
-      observed_objects_.push_back({object.object_id, current_object_time});
-      ignored_objects_.push_back({object.object_id, current_object_time});
+      // Add to the ignore list as a newly observed object, keeping the time it was first ignored
+      ignored_objects_.try_emplace(object_id, current_object_time);
       // Continue filtering
       continue;
     }
@@ -275,14 +267,16 @@ PredictedObjects CollisionDetectorNode::filterObjects(const PredictedObjects & i
 }
 
 void CollisionDetectorNode::removeOldObjects(
-  std::vector<TimestampedObject> & container, const rclcpp::Time & current_time,
+  TimestampedObjects & container, const rclcpp::Time & current_time,
   const rclcpp::Duration & duration_sec)
 {
-  container.erase(
-    std::remove_if(
-      container.begin(), container.end(),
-      [&](const TimestampedObject & obj) { return (current_time - obj.timestamp) > duration_sec; }),
-    container.end());
+  for (auto it = container.begin(); it != container.end();) {
+    if ((current_time - it->second) > duration_sec) {
+      it = container.erase(it);
+    } else {
+      ++it;
+    }
+  }
 }
 
 bool CollisionDetectorNode::shouldBeExcluded(
@@ -405,19 +399,20 @@ boost::optional<Obstacle> CollisionDetectorNode::getNearestObstacleByPointCloud(
   }
 
   Eigen::Affine3f isometry = tf2::transformToEigen(transform_stamped.get().transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud;
-  pcl::fromROSMsg(*pointcloud_ptr_, transformed_pointcloud);
-  pcl::transformPointCloud(transformed_pointcloud, transformed_pointcloud, isometry);
-
-  const auto ego_polygon = createSelfPolygon(vehicle_info_);
 
-  for (const auto & p : transformed_pointcloud) {
-    Point2d boost_point(p.x, p.y);
+  // transform the points one by one without converting the whole pointcloud
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*pointcloud_ptr_, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*pointcloud_ptr_, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*pointcloud_ptr_, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f p = isometry * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
+    const Point2d boost_point(p.x(), p.y());
 
-    const auto distance_to_object = bg::distance(ego_polygon, boost_point);
+    const auto distance_to_object =
+      calcDistanceToSelfPolygon(vehicle_info_, Box2d(boost_point, boost_point));
 
     if (distance_to_object < minimum_distance) {
-      nearest_point = createPoint(p.x, p.y, p.z);
+      nearest_point = createPoint(p.x(), p.y(), p.z());
       minimum_distance = distance_to_object;
     }
   }
@@ -466,6 +461,13 @@ boost::optional<Obstacle> CollisionDetectorNode::getNearestObstacleByDynamicObje
       }
     }();
 
+    // the distance to the bounding box is a lower bound of the distance to the polygon
+    Box2d object_box;
+    bg::envelope(object_polygon, object_box);
+    if (calcDistanceToSelfPolygon(vehicle_info_, object_box) >= minimum_distance) {
+      continue;
+    }
+
     const auto distance_to_object = bg::distance(ego_polygon, object_polygon);
 
     if (distance_to_object < minimum_distance) {
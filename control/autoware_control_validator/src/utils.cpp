@@ -15,10 +15,12 @@
 #include "autoware/control_validator/utils.hpp"
 
 #include "autoware/motion_utils/trajectory/conversion.hpp"
+#include "autoware/motion_utils/trajectory/indexed_trajectory.hpp"
 #include "autoware/motion_utils/trajectory/interpolation.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/universe_utils/geometry/geometry.hpp"
 
+#include <iterator>
 #include <vector>
 
 namespace autoware::control_validator
@@ -67,20 +69,22 @@ bool remove_front_trajectory_point(
   const TrajectoryPoints & trajectory_points, TrajectoryPoints & modified_trajectory_points,
   const TrajectoryPoints & predicted_trajectory_points)
 {
-  bool predicted_trajectory_point_removed = false;
+  size_t num_removed_points = 0;
   for (const auto & point : predicted_trajectory_points) {
     if (
       autoware::motion_utils::calcLongitudinalOffsetToSegment(
         trajectory_points, 0, point.pose.position) < 0.0) {
-      modified_trajectory_points.erase(modified_trajectory_points.begin());
-
-      predicted_trajectory_point_removed = true;
+      ++num_removed_points;
     } else {
       break;
     }
   }
+  // erase the points at once instead of shifting the remaining points for each of them
+  modified_trajectory_points.erase(
+    modified_trajectory_points.begin(),
+    std::next(modified_trajectory_points.begin(), num_removed_points));
 
-  return predicted_trajectory_point_removed;
+  return num_removed_points > 0;
 }
 
 Trajectory align_trajectory_with_reference_trajectory(
@@ -160,13 +164,15 @@ double calc_max_lateral_distance(
   const auto alined_predicted_trajectory =
     align_trajectory_with_reference_trajectory(reference_trajectory, predicted_trajectory);
   double max_dist = 0;
+  // index the reference trajectory once instead of searching all of it for every predicted point
+  const autoware::motion_utils::IndexedTrajectory indexed_reference_trajectory(
+    reference_trajectory.points);
   for (const auto & point : alined_predicted_trajectory.points) {
     const auto p0 = autoware::universe_utils::getPoint(point);
     // find nearest segment
-    const size_t nearest_segment_idx =
-      autoware::motion_utils::findNearestSegmentIndex(reference_trajectory.points, p0);
-    const double temp_dist = std::abs(autoware::motion_utils::calcLateralOffset(
-      reference_trajectory.points, p0, nearest_segment_idx));
+    const size_t nearest_segment_idx = indexed_reference_trajectory.findNearestSegmentIndex(p0);
+    const double temp_dist =
+      std::abs(indexed_reference_trajectory.calcLateralOffset(p0, nearest_segment_idx));
     if (temp_dist > max_dist) {
       max_dist = temp_dist;
     }
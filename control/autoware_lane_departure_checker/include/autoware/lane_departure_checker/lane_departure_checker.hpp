@@ -170,17 +170,24 @@ private:
   double calcMaxSearchLengthForBoundaries(const Trajectory & trajectory) const;
 
   static SegmentRtree extractUncrossableBoundaries(
-    const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-    const double max_search_length, const std::vector<std::string> & boundary_types_to_detect);
+    const lanelet::LaneletMap & lanelet_map,
+    const std::vector<std::string> & boundary_types_to_detect);
+
+  // rebuild the segments only when the map or the boundary types have changed
+  const SegmentRtree & getUncrossableBoundaries(const Input & input);
 
   bool willCrossBoundary(
-    const std::vector<LinearRing2d> & vehicle_footprints,
-    const SegmentRtree & uncrossable_segments) const;
+    const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+    const geometry_msgs::msg::Point & ego_point, const double max_search_length) const;
 
   lanelet::BasicPolygon2d toBasicPolygon2D(const LinearRing2d & footprint_hull) const;
   autoware::universe_utils::Polygon2d toPolygon2D(const lanelet::BasicPolygon2d & poly) const;
 
   mutable std::shared_ptr<universe_utils::TimeKeeper> time_keeper_;
+
+  SegmentRtree uncrossable_boundaries_;
+  lanelet::LaneletMapPtr uncrossable_boundaries_map_{};
+  std::vector<std::string> uncrossable_boundary_types_{};
 };
 }  // namespace autoware::lane_departure_checker
 
@@ -31,7 +31,6 @@
 
 using autoware::motion_utils::calcArcLength;
 using autoware::universe_utils::LinearRing2d;
-using autoware::universe_utils::LineString2d;
 using autoware::universe_utils::MultiPoint2d;
 using autoware::universe_utils::MultiPolygon2d;
 using autoware::universe_utils::Point2d;
@@ -149,10 +148,9 @@ Output LaneDepartureChecker::update(const Input & input)
 
   const double max_search_length_for_boundaries =
     calcMaxSearchLengthForBoundaries(*input.predicted_trajectory);
-  const auto uncrossable_boundaries = extractUncrossableBoundaries(
-    *input.lanelet_map, input.predicted_trajectory->points.front().pose.position,
-    max_search_length_for_boundaries, input.boundary_types_to_detect);
-  output.will_cross_boundary = willCrossBoundary(output.vehicle_footprints, uncrossable_boundaries);
+  output.will_cross_boundary = willCrossBoundary(
+    output.vehicle_footprints, getUncrossableBoundaries(input),
+    input.predicted_trajectory->points.front().pose.position, max_search_length_for_boundaries);
   output.processing_time_map["willCrossBoundary"] = stop_watch.toc(true);
 
   return output;
@@ -242,7 +240,7 @@ LaneDepartureChecker::getFusedLaneletPolygonForPath(
     const auto & p = route_lanelet.polygon2d().basicPolygon();
     autoware::universe_utils::Polygon2d poly = toPolygon2D(p);
     boost::geometry::union_(lanelet_unions, poly, result);
-    lanelet_unions = result;
+    lanelet_unions.swap(result);
     result.clear();
   }
 
@@ -276,7 +274,7 @@ bool LaneDepartureChecker::updateFusedLaneletPolygonForPath(
     const auto & p = route_lanelet.polygon2d().basicPolygon();
     autoware::universe_utils::Polygon2d poly = toPolygon2D(p);
     boost::geometry::union_(lanelet_unions, poly, result);
-    lanelet_unions = result;
+    lanelet_unions.swap(result);
     result.clear();
     fused_lanelets_id.push_back(route_lanelet.id());
   }
@@ -393,8 +391,8 @@ double LaneDepartureChecker::calcMaxSearchLengthForBoundaries(const Trajectory &
 }
 
 SegmentRtree LaneDepartureChecker::extractUncrossableBoundaries(
-  const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-  const double max_search_length, const std::vector<std::string> & boundary_types_to_detect)
+  const lanelet::LaneletMap & lanelet_map,
+  const std::vector<std::string> & boundary_types_to_detect)
 {
   const auto has_types =
     [](const lanelet::ConstLineString3d & ls, const std::vector<std::string> & types) {
@@ -403,35 +401,50 @@ SegmentRtree LaneDepartureChecker::extractUncrossableBoundaries(
       return (type != no_type && std::find(types.begin(), types.end(), type) != types.end());
     };
 
-  SegmentRtree uncrossable_segments_in_range;
-  LineString2d line;
-  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  std::vector<Segment2d> uncrossable_segments;
   for (const auto & ls : lanelet_map.lineStringLayer) {
     if (has_types(ls, boundary_types_to_detect)) {
-      line.clear();
-      for (const auto & p : ls) line.push_back(Point2d{p.x(), p.y()});
-      for (auto segment_idx = 0LU; segment_idx + 1 < line.size(); ++segment_idx) {
-        const Segment2d segment = {line[segment_idx], line[segment_idx + 1]};
-        if (boost::geometry::distance(segment, ego_p) < max_search_length) {
-          uncrossable_segments_in_range.insert(segment);
-        }
+      for (auto segment_idx = 0LU; segment_idx + 1 < ls.size(); ++segment_idx) {
+        const auto & p1 = ls[segment_idx];
+        const auto & p2 = ls[segment_idx + 1];
+        uncrossable_segments.emplace_back(Point2d{p1.x(), p1.y()}, Point2d{p2.x(), p2.y()});
       }
     }
   }
-  return uncrossable_segments_in_range;
+  // the packing algorithm used by the range constructor gives a better tree than insert()
+  return SegmentRtree(uncrossable_segments.begin(), uncrossable_segments.end());
+}
+
+const SegmentRtree & LaneDepartureChecker::getUncrossableBoundaries(const Input & input)
+{
+  if (
+    input.lanelet_map != uncrossable_boundaries_map_ ||
+    input.boundary_types_to_detect != uncrossable_boundary_types_) {
+    universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+    uncrossable_boundaries_ =
+      extractUncrossableBoundaries(*input.lanelet_map, input.boundary_types_to_detect);
+    uncrossable_boundaries_map_ = input.lanelet_map;
+    uncrossable_boundary_types_ = input.boundary_types_to_detect;
+  }
+  return uncrossable_boundaries_;
 }
 
 bool LaneDepartureChecker::willCrossBoundary(
-  const std::vector<LinearRing2d> & vehicle_footprints,
-  const SegmentRtree & uncrossable_segments) const
+  const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+  const geometry_msgs::msg::Point & ego_point, const double max_search_length) const
 {
   universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  const auto is_in_range = [&](const Segment2d & segment) {
+    return boost::geometry::distance(segment, ego_p) < max_search_length;
+  };
   for (const auto & footprint : vehicle_footprints) {
-    std::vector<Segment2d> intersection_result;
-    uncrossable_segments.query(
-      boost::geometry::index::intersects(footprint), std::back_inserter(intersection_result));
-    if (!intersection_result.empty()) {
+    // stop at the first crossed segment instead of collecting all of them
+    const auto query_it = uncrossable_segments.qbegin(
+      boost::geometry::index::intersects(footprint) &&
+      boost::geometry::index::satisfies(is_in_range));
+    if (query_it != uncrossable_segments.qend()) {
       return true;
     }
   }
@@ -186,6 +186,11 @@ struct MPCMatrix
   MatrixXd R2ex;
   MatrixXd Uref_ex;
 
+  // discrete matrices of each prediction step, used to calculate the cost block by block
+  std::vector<MatrixXd> Ad_vec;
+  std::vector<MatrixXd> Bd_vec;
+  std::vector<MatrixXd> CtQC_vec;  // Cd' * Q_adaptive * Cd
+
   MPCMatrix() = default;
 };
 
@@ -305,6 +310,18 @@ private:
     const double start_time, const MPCTrajectory & input,
     const Odometry & current_kinematics) const;
 
+  /**
+   * @brief Calculate the state cost terms of the condensed QP, H = Bex' * Cex' * Qex * Cex * Bex
+   * and f = (Cex * (Aex * x0 + Wex))' * Qex * Cex * Bex.
+   * @details Cex and Qex are block diagonal and Bex is block lower triangular, so the blocks are
+   * calculated with a backward recursion over the prediction steps, in O(N^2) block products
+   * instead of the O(N^3) products of the dense matrices.
+   * @param m The MPC matrix.
+   * @param x0 The initial state vector.
+   * @return A pair of the (symmetric) H matrix and the f row vector.
+   */
+  std::pair<MatrixXd, MatrixXd> calcStateCost(const MPCMatrix & m, const VectorXd & x0) const;
+
   /**
    * @brief Add weights related to lateral jerk, steering rate, and steering acceleration to the R
    * matrix.
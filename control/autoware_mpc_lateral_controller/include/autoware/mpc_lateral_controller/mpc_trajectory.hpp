@@ -74,6 +74,11 @@ public:
    */
   MPCTrajectoryPoint back();
 
+  /**
+   * @brief reserve for all values
+   */
+  void reserve(const size_t size);
+
   /**
    * @brief clear for all values
    */
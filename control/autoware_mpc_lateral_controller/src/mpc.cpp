@@ -442,6 +442,9 @@ MPCMatrix MPC::generateMPCMatrix(
   const int DIM_Y = m_vehicle_model_ptr->getDimY();
 
   MPCMatrix m;
+  m.Ad_vec.reserve(N);
+  m.Bd_vec.reserve(N);
+  m.CtQC_vec.reserve(N);
   m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
   m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
   m.Wex = MatrixXd::Zero(DIM_X * N, 1);
@@ -517,6 +520,9 @@ MPCMatrix MPC::generateMPCMatrix(
     m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
     m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q_adaptive;
     m.R1ex.block(idx_u_i, idx_u_i, DIM_U, DIM_U) = R_adaptive;
+    m.Ad_vec.push_back(Ad);
+    m.Bd_vec.push_back(Bd);
+    m.CtQC_vec.push_back(Cd.transpose() * Q_adaptive * Cd);
 
     // get reference input (feed-forward)
     m_vehicle_model_ptr->setCurvature(ref_smooth_k);
@@ -577,15 +583,9 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
   const int DIM_U_N = m_param.prediction_horizon * m_vehicle_model_ptr->getDimU();
 
   // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
-  const MatrixXd CB = m.Cex * m.Bex;
-  const MatrixXd QCB = m.Qex * CB;
-  // MatrixXd H = CB.transpose() * QCB + m.R1ex + m.R2ex; // This calculation is heavy. looking for
-  // a good way.  //NOLINT
-  MatrixXd H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
-  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
-  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
-  H.triangularView<Eigen::Lower>() = H.transpose();
-  MatrixXd f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+  auto [H, f] = calcStateCost(m, x0);
+  H += m.R1ex + m.R2ex;
+  f -= m.Uref_ex.transpose() * m.R1ex;
   addSteerWeightF(prediction_dt, f);
 
   MatrixXd A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
@@ -624,6 +624,42 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
   return {true, Uex};
 }
 
+std::pair<MatrixXd, MatrixXd> MPC::calcStateCost(const MPCMatrix & m, const VectorXd & x0) const
+{
+  const int N = m_param.prediction_horizon;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+
+  // Bex(j, k) = Ad_j * ... * Ad_k+1 * Bd_k, so with the backward recursion
+  //   L_k(j) = CtQC_j * Bex(j, k) + Ad_j+1' * L_k(j+1),
+  // the block (j, k) of B' * C' * Q * C * B is Bd_j' * L_k(j) for j >= k.
+  MatrixXd H = MatrixXd::Zero(DIM_U * N, DIM_U * N);
+  MatrixXd L(DIM_X, DIM_U);
+  for (int k = 0; k < N; ++k) {
+    for (int j = N - 1; j >= k; --j) {
+      const MatrixXd CtQCB = m.CtQC_vec.at(j) * m.Bex.block(j * DIM_X, k * DIM_U, DIM_X, DIM_U);
+      L = j == N - 1 ? CtQCB : CtQCB + m.Ad_vec.at(j + 1).transpose() * L;
+      H.block(j * DIM_U, k * DIM_U, DIM_U, DIM_U) = m.Bd_vec.at(j).transpose() * L;
+      if (j != k) {
+        H.block(k * DIM_U, j * DIM_U, DIM_U, DIM_U) =
+          H.block(j * DIM_U, k * DIM_U, DIM_U, DIM_U).transpose();
+      }
+    }
+  }
+
+  // same recursion with the states predicted without input
+  const VectorXd X_free = m.Aex * x0 + m.Wex;
+  MatrixXd f = MatrixXd::Zero(1, DIM_U * N);
+  VectorXd mu(DIM_X);
+  for (int j = N - 1; j >= 0; --j) {
+    const VectorXd CtQCX = m.CtQC_vec.at(j) * X_free.segment(j * DIM_X, DIM_X);
+    mu = j == N - 1 ? CtQCX : CtQCX + m.Ad_vec.at(j + 1).transpose() * mu;
+    f.block(0, j * DIM_U, 1, DIM_U) = (m.Bd_vec.at(j).transpose() * mu).transpose();
+  }
+
+  return {H, f};
+}
+
 void MPC::addSteerWeightR(const double prediction_dt, MatrixXd & R) const
 {
   const int N = m_param.prediction_horizon;
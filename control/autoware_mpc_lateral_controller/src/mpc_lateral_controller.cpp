@@ -281,8 +281,6 @@ trajectory_follower::LateralOutput MpcLateralController::run(
 
   m_is_mpc_solved = is_mpc_solved;  // for diagnostic updater
 
-  diag_updater_->force_update();
-
   // reset previous MPC result
   // Note: When a large deviation from the trajectory occurs, the optimization stops and
   // the vehicle will return to the path by re-planning the trajectory or external operation.
@@ -74,6 +74,18 @@ MPCTrajectoryPoint MPCTrajectory::at(const size_t i) const
   return p;
 }
 
+void MPCTrajectory::reserve(const size_t size)
+{
+  x.reserve(size);
+  y.reserve(size);
+  z.reserve(size);
+  yaw.reserve(size);
+  vx.reserve(size);
+  k.reserve(size);
+  smooth_k.reserve(size);
+  relative_time.reserve(size);
+}
+
 void MPCTrajectory::clear()
 {
   x.clear();
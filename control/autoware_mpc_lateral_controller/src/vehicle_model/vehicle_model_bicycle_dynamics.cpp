@@ -116,6 +116,7 @@ MPCTrajectory DynamicsBicycleModel::calculatePredictedTrajectoryInFrenetCoordina
 
   Eigen::VectorXd Xex = a_d * x0 + b_d * Uex + w_d;
   MPCTrajectory mpc_predicted_trajectory;
+  mpc_predicted_trajectory.reserve(reference_trajectory.size());
   const auto DIM_X = getDimX();
   const auto & t = reference_trajectory;
 
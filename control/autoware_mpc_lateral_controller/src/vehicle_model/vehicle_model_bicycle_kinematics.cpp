@@ -82,8 +82,9 @@ MPCTrajectory KinematicsBicycleModel::calculatePredictedTrajectoryInWorldCoordin
   const auto & t = reference_trajectory;
 
   // create initial state in the world coordinate
-  Eigen::VectorXd state_w = [&]() {
-    Eigen::VectorXd state = Eigen::VectorXd::Zero(3);
+  // the state is fixed-size so that the rollout does not allocate on every step
+  Eigen::Vector3d state_w = [&]() {
+    Eigen::Vector3d state = Eigen::Vector3d::Zero();
     const auto lateral_error_0 = x0(0);
     const auto yaw_error_0 = x0(1);
     state(0, 0) = t.x.at(0) - std::sin(t.yaw.at(0)) * lateral_error_0;  // world-x
@@ -94,22 +95,23 @@ MPCTrajectory KinematicsBicycleModel::calculatePredictedTrajectoryInWorldCoordin
 
   // update state in the world coordinate
   const auto updateState = [&](
-                             const Eigen::VectorXd & state_w, const double & input, const double dt,
+                             const Eigen::Vector3d & state_w, const double & input, const double dt,
                              const double velocity) {
     const auto yaw = state_w(2);
 
-    Eigen::VectorXd dstate = Eigen::VectorXd::Zero(4);
+    Eigen::Vector3d dstate;
     dstate(0) = velocity * std::cos(yaw);
     dstate(1) = velocity * std::sin(yaw);
     dstate(2) = velocity * std::tan(input) / m_wheelbase;
 
     // Note: don't do "return state_w + dstate * dt", which does not work due to the lazy evaluation
     // in Eigen.
-    const Eigen::VectorXd next_state = state_w + dstate * dt;
+    const Eigen::Vector3d next_state = state_w + dstate * dt;
     return next_state;
   };
 
   MPCTrajectory mpc_predicted_trajectory;
+  mpc_predicted_trajectory.reserve(reference_trajectory.size());
   const auto DIM_U = getDimU();
 
   for (size_t i = 0; i < reference_trajectory.size(); ++i) {
@@ -131,6 +133,7 @@ MPCTrajectory KinematicsBicycleModel::calculatePredictedTrajectoryInFrenetCoordi
 
   Eigen::VectorXd Xex = a_d * x0 + b_d * Uex + w_d;
   MPCTrajectory mpc_predicted_trajectory;
+  mpc_predicted_trajectory.reserve(reference_trajectory.size());
   const auto DIM_X = getDimX();
   const auto & t = reference_trajectory;
 
@@ -18,15 +18,18 @@
 #include <autoware/universe_utils/math/normalization.hpp>
 #include <autoware/universe_utils/math/unit_conversion.hpp>
 #include <autoware/universe_utils/system/stop_watch.hpp>
-#include <pcl_ros/transforms.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tf2_eigen/tf2_eigen.hpp>
 
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
 #include <boost/geometry.hpp>
 
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2/utils.h>
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 namespace
@@ -35,13 +38,18 @@ pcl::PointCloud<pcl::PointXYZ> get_transformed_point_cloud(
   const sensor_msgs::msg::PointCloud2 & pointcloud_msg,
   const geometry_msgs::msg::Transform & transform)
 {
-  const Eigen::Matrix4f transform_matrix = tf2::transformToEigen(transform).matrix().cast<float>();
-
-  sensor_msgs::msg::PointCloud2 transformed_msg;
-  pcl_ros::transformPointCloud(transform_matrix, pointcloud_msg, transformed_msg);
+  const Eigen::Affine3f affine = tf2::transformToEigen(transform).cast<float>();
 
+  // transform the points while reading them instead of going through another PointCloud2
   pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud;
-  pcl::fromROSMsg(transformed_msg, transformed_pointcloud);
+  transformed_pointcloud.reserve(pointcloud_msg.width * pointcloud_msg.height);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(pointcloud_msg, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(pointcloud_msg, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(pointcloud_msg, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f point = affine * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
+    transformed_pointcloud.push_back(pcl::PointXYZ(point.x(), point.y(), point.z()));
+  }
 
   return transformed_pointcloud;
 }
@@ -51,11 +59,31 @@ pcl::PointCloud<pcl::PointXYZ> filter_point_cloud_by_trajectory(
   const autoware_planning_msgs::msg::Trajectory & trajectory, const double radius)
 {
   pcl::PointCloud<pcl::PointXYZ> filtered_pointcloud;
+  if (trajectory.points.empty()) {
+    return filtered_pointcloud;
+  }
+
+  // points outside of the bounding box of the trajectory expanded by the radius are skipped
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & trajectory_point : trajectory.points) {
+    min_x = std::min(min_x, trajectory_point.pose.position.x - radius);
+    min_y = std::min(min_y, trajectory_point.pose.position.y - radius);
+    max_x = std::max(max_x, trajectory_point.pose.position.x + radius);
+    max_y = std::max(max_y, trajectory_point.pose.position.y + radius);
+  }
+
+  const double squared_radius = radius * radius;
   for (const auto & point : pointcloud.points) {
+    if (point.x < min_x || max_x < point.x || point.y < min_y || max_y < point.y) {
+      continue;
+    }
     for (const auto & trajectory_point : trajectory.points) {
       const double dx = trajectory_point.pose.position.x - point.x;
       const double dy = trajectory_point.pose.position.y - point.y;
-      if (std::hypot(dx, dy) < radius) {
+      if (dx * dx + dy * dy < squared_radius) {
         filtered_pointcloud.points.push_back(point);
         break;
       }
@@ -241,9 +269,14 @@ bool has_collision(
   const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
   const LinearRing2d & vehicle_footprint)
 {
+  autoware::universe_utils::Box2d footprint_box;
+  boost::geometry::envelope(vehicle_footprint, footprint_box);
   for (const auto & point : obstacle_pointcloud.points) {
-    if (boost::geometry::within(
-          autoware::universe_utils::Point2d{point.x, point.y}, vehicle_footprint)) {
+    const autoware::universe_utils::Point2d point2d{point.x, point.y};
+    if (!boost::geometry::covered_by(point2d, footprint_box)) {
+      continue;
+    }
+    if (boost::geometry::within(point2d, vehicle_footprint)) {
       RCLCPP_WARN(
         rclcpp::get_logger("obstacle_collision_checker"), "Collide to Point x: %f y: %f", point.x,
         point.y);
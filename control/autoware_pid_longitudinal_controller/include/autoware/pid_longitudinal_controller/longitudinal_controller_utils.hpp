@@ -78,17 +78,17 @@ Pose calcPoseAfterTimeDelay(
   const double current_acc);
 
 /**
- * @brief apply linear interpolation to trajectory point that is nearest to a certain point
+ * @brief apply linear interpolation to trajectory point on the given segment that is nearest to a
+ * certain point
  * @param [in] points trajectory points
+ * @param [in] seg_idx index of the segment to interpolate
  * @param [in] point Interpolated point is nearest to this point.
  */
 template <class T>
 std::pair<TrajectoryPoint, size_t> lerpTrajectoryPoint(
-  const T & points, const Pose & pose, const double max_dist, const double max_yaw)
+  const T & points, const size_t seg_idx, const Pose & pose)
 {
   TrajectoryPoint interpolated_point;
-  const size_t seg_idx = autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
-    points, pose, max_dist, max_yaw);
 
   const double len_to_interpolated =
     autoware::motion_utils::calcLongitudinalOffsetToSegment(points, seg_idx, pose.position);
@@ -121,6 +121,20 @@ std::pair<TrajectoryPoint, size_t> lerpTrajectoryPoint(
   return std::make_pair(interpolated_point, seg_idx);
 }
 
+/**
+ * @brief apply linear interpolation to trajectory point that is nearest to a certain point
+ * @param [in] points trajectory points
+ * @param [in] point Interpolated point is nearest to this point.
+ */
+template <class T>
+std::pair<TrajectoryPoint, size_t> lerpTrajectoryPoint(
+  const T & points, const Pose & pose, const double max_dist, const double max_yaw)
+{
+  const size_t seg_idx = autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
+    points, pose, max_dist, max_yaw);
+  return lerpTrajectoryPoint(points, seg_idx, pose);
+}
+
 /**
  * @brief limit variable whose differential is within a certain value
  * @param [in] input_val current value
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__PID_LONGITUDINAL_CONTROLLER__PID_LONGITUDINAL_CONTROLLER_HPP_
 #define AUTOWARE__PID_LONGITUDINAL_CONTROLLER__PID_LONGITUDINAL_CONTROLLER_HPP_
 
+#include "autoware/motion_utils/trajectory/indexed_trajectory.hpp"
 #include "autoware/pid_longitudinal_controller/debug_values.hpp"
 #include "autoware/pid_longitudinal_controller/longitudinal_controller_utils.hpp"
 #include "autoware/pid_longitudinal_controller/lowpass_filter.hpp"
@@ -114,6 +115,10 @@ private:
   nav_msgs::msg::Odometry m_current_kinematic_state;
   geometry_msgs::msg::AccelWithCovarianceStamped m_current_accel;
   autoware_planning_msgs::msg::Trajectory m_trajectory;
+  // index of m_trajectory built when a new trajectory is set
+  std::optional<autoware::motion_utils::IndexedTrajectory<
+    std::vector<autoware_planning_msgs::msg::TrajectoryPoint>>>
+    m_indexed_trajectory;
   OperationModeState m_current_operation_mode;
 
   // vehicle info
@@ -222,7 +227,7 @@ private:
   double m_ego_nearest_yaw_threshold;
 
   // buffer of send command
-  std::vector<autoware_control_msgs::msg::Longitudinal> m_ctrl_cmd_vec;
+  std::deque<autoware_control_msgs::msg::Longitudinal> m_ctrl_cmd_vec;
 
   // for calculating dt
   std::shared_ptr<rclcpp::Time> m_prev_control_time{nullptr};
@@ -382,6 +387,13 @@ private:
     const autoware_planning_msgs::msg::Trajectory & traj,
     const geometry_msgs::msg::Pose & pose) const;
 
+  /**
+   * @brief interpolate point of m_trajectory that is nearest to vehicle using its index
+   * @param [in] point vehicle position
+   */
+  std::pair<autoware_planning_msgs::msg::TrajectoryPoint, size_t>
+  calcInterpolatedTrajPointAndSegment(const geometry_msgs::msg::Pose & pose) const;
+
   /**
    * @brief calculate predicted velocity after time delay based on past control commands
    * @param [in] current_motion current velocity and acceleration of the vehicle
@@ -245,6 +245,11 @@ void PidLongitudinalController::setCurrentOperationMode(const OperationModeState
 
 void PidLongitudinalController::setTrajectory(const autoware_planning_msgs::msg::Trajectory & msg)
 {
+  // the same trajectory is given every cycle until a new one arrives
+  if (m_indexed_trajectory && msg == m_trajectory) {
+    return;
+  }
+
   if (!longitudinal_utils::isValidTrajectory(msg)) {
     RCLCPP_ERROR_THROTTLE(logger_, *clock_, 3000, "received invalid trajectory. ignore.");
     return;
@@ -256,6 +261,7 @@ void PidLongitudinalController::setTrajectory(const autoware_planning_msgs::msg:
   }
 
   m_trajectory = msg;
+  m_indexed_trajectory.emplace(m_trajectory.points);
 }
 
 rcl_interfaces::msg::SetParametersResult PidLongitudinalController::paramCallback(
@@ -450,9 +456,6 @@ trajectory_follower::LongitudinalOutput PidLongitudinalController::run(
   // publish debug data
   publishDebugData(ctrl_cmd, control_data);
 
-  // diagnostic
-  diag_updater_->force_update();
-
   return output;
 }
 
@@ -470,8 +473,7 @@ PidLongitudinalController::ControlData PidLongitudinalController::getControlData
   control_data.interpolated_traj = m_trajectory;
 
   // calculate the interpolated point and segment
-  const auto current_interpolated_pose =
-    calcInterpolatedTrajPointAndSegment(control_data.interpolated_traj, current_pose);
+  const auto current_interpolated_pose = calcInterpolatedTrajPointAndSegment(current_pose);
 
   // Insert the interpolated point
   control_data.interpolated_traj.points.insert(
@@ -1000,7 +1002,7 @@ void PidLongitudinalController::storeAccelCmd(const double accel)
     return;
   }
   if ((clock_->now() - m_ctrl_cmd_vec.at(1).stamp).seconds() > m_delay_compensation_time) {
-    m_ctrl_cmd_vec.erase(m_ctrl_cmd_vec.begin());
+    m_ctrl_cmd_vec.pop_front();
   }
 }
 
@@ -1065,6 +1067,19 @@ PidLongitudinalController::calcInterpolatedTrajPointAndSegment(
     traj.points, pose, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
 }
 
+std::pair<autoware_planning_msgs::msg::TrajectoryPoint, size_t>
+PidLongitudinalController::calcInterpolatedTrajPointAndSegment(
+  const geometry_msgs::msg::Pose & pose) const
+{
+  if (!m_indexed_trajectory) {
+    return calcInterpolatedTrajPointAndSegment(m_trajectory, pose);
+  }
+
+  const size_t seg_idx = m_indexed_trajectory->findFirstNearestSegmentIndexWithSoftConstraints(
+    pose, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
+  return longitudinal_utils::lerpTrajectoryPoint(m_trajectory.points, seg_idx, pose);
+}
+
 PidLongitudinalController::StateAfterDelay PidLongitudinalController::predictedStateAfterDelay(
   const Motion current_motion, const double delay_compensation_time) const
 {
@@ -1089,13 +1104,13 @@ PidLongitudinalController::StateAfterDelay PidLongitudinalController::predictedS
     return StateAfterDelay{pred_vel, pred_acc, running_distance};
   }
 
+  const auto now = clock_->now();
   for (std::size_t i = 0; i < m_ctrl_cmd_vec.size(); ++i) {
-    if ((clock_->now() - m_ctrl_cmd_vec.at(i).stamp).seconds() < delay_compensation_time) {
+    if ((now - m_ctrl_cmd_vec.at(i).stamp).seconds() < delay_compensation_time) {
       // add velocity to accel * dt
       const double time_to_next_acc =
         (i == m_ctrl_cmd_vec.size() - 1)
-          ? std::min(
-              (clock_->now() - m_ctrl_cmd_vec.back().stamp).seconds(), delay_compensation_time)
+          ? std::min((now - m_ctrl_cmd_vec.back().stamp).seconds(), delay_compensation_time)
           : std::min(
               (rclcpp::Time(m_ctrl_cmd_vec.at(i + 1).stamp) -
                rclcpp::Time(m_ctrl_cmd_vec.at(i).stamp))
@@ -32,55 +32,36 @@ Eigen::VectorXd sigmoid(const Eigen::VectorXd & v)
 }
 Eigen::VectorXd relu(const Eigen::VectorXd & x)
 {
-  Eigen::VectorXd x_ = x;
-  for (int i = 0; i < x.size(); i++) {
-    if (x[i] < 0) {
-      x_[i] = 0;
-    }
-  }
-  return x_;
+  return (x.array() < 0).select(0.0, x);
 }
 Eigen::MatrixXd d_relu_product(const Eigen::MatrixXd & m, const Eigen::VectorXd & x)
 {
-  Eigen::MatrixXd result = Eigen::MatrixXd::Zero(m.rows(), m.cols());
+  Eigen::MatrixXd result = m;
   for (int i = 0; i < m.cols(); i++) {
-    if (x[i] >= 0) {
-      result.col(i) = m.col(i);
+    if (!(x[i] >= 0)) {
+      result.col(i).setZero();
     }
   }
   return result;
 }
+// the derivatives below compute cosh once per element and scale all the columns at once
 Eigen::MatrixXd d_tanh_product(const Eigen::MatrixXd & m, const Eigen::VectorXd & x)
 {
-  Eigen::MatrixXd result = Eigen::MatrixXd(m.rows(), m.cols());
-  for (int i = 0; i < m.cols(); i++) {
-    result.col(i) = m.col(i) / (std::cosh(x[i]) * std::cosh(x[i]));
-  }
-  return result;
+  const Eigen::ArrayXd cosh_square = x.array().cosh().square();
+  return m.array().rowwise() / cosh_square.transpose();
 }
 Eigen::VectorXd d_tanh_product_vec(const Eigen::VectorXd & v, const Eigen::VectorXd & x)
 {
-  Eigen::VectorXd result = Eigen::VectorXd(v.size());
-  for (int i = 0; i < v.size(); i++) {
-    result[i] = v[i] / (std::cosh(x[i]) * std::cosh(x[i]));
-  }
-  return result;
+  return v.array() / x.array().cosh().square();
 }
 Eigen::MatrixXd d_sigmoid_product(const Eigen::MatrixXd & m, const Eigen::VectorXd & x)
 {
-  Eigen::MatrixXd result = Eigen::MatrixXd(m.rows(), m.cols());
-  for (int i = 0; i < m.cols(); i++) {
-    result.col(i) = 0.25 * m.col(i) / (std::cosh(0.5 * x[i]) * std::cosh(0.5 * x[i]));
-  }
-  return result;
+  const Eigen::ArrayXd cosh_square = (0.5 * x.array()).cosh().square();
+  return (0.25 * m.array()).rowwise() / cosh_square.transpose();
 }
 Eigen::VectorXd d_sigmoid_product_vec(const Eigen::VectorXd & v, const Eigen::VectorXd & x)
 {
-  Eigen::VectorXd result = Eigen::VectorXd(v.size());
-  for (int i = 0; i < v.size(); i++) {
-    result[i] = 0.25 * v[i] / (std::cosh(0.5 * x[i]) * std::cosh(0.5 * x[i]));
-  }
-  return result;
+  return 0.25 * v.array() / (0.5 * x.array()).cosh().square();
 }
 
 Eigen::VectorXd get_polynomial_features(const Eigen::VectorXd & x, const int deg, const int dim)
@@ -20,6 +20,7 @@
 #include "autoware/universe_utils/ros/marker_helper.hpp"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <memory>
 #include <string>
@@ -190,18 +191,30 @@ void Controller::callbackTimerControl()
   }
 
   // 3. run controllers
-  stop_watch_.tic("lateral");
-  const auto lat_out = lateral_controller_->run(*input_data);
-  publishProcessingTime(stop_watch_.toc("lateral"), pub_processing_time_lat_ms_);
-
-  stop_watch_.tic("longitudinal");
+  // the lateral controller runs on another thread since the controllers do not depend on each other
+  // until they are synchronized
+  auto lat_future = std::async(std::launch::async, [this, &input_data]() {
+    StopWatch<std::chrono::milliseconds> stop_watch;
+    auto lat_out = lateral_controller_->run(*input_data);
+    return std::make_pair(std::move(lat_out), stop_watch.toc());
+  });
+
+  StopWatch<std::chrono::milliseconds> lon_stop_watch;
   const auto lon_out = longitudinal_controller_->run(*input_data);
-  publishProcessingTime(stop_watch_.toc("longitudinal"), pub_processing_time_lon_ms_);
+  const double lon_processing_time_ms = lon_stop_watch.toc();
+
+  const auto [lat_out, lat_processing_time_ms] = lat_future.get();
+  publishProcessingTime(lat_processing_time_ms, pub_processing_time_lat_ms_);
+  publishProcessingTime(lon_processing_time_ms, pub_processing_time_lon_ms_);
 
   // 4. sync with each other controllers
   longitudinal_controller_->sync(lat_out.sync_data);
   lateral_controller_->sync(lon_out.sync_data);
 
+  // the diagnostics of both controllers are updated here so that the tasks are not run while the
+  // other controller is running
+  diag_updater_->force_update();
+
   // TODO(Horibe): Think specification. This comes from the old implementation.
   if (isTimeOut(lon_out, lat_out)) return;
 
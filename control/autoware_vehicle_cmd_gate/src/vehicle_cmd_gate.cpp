@@ -293,7 +293,7 @@ rcl_interfaces::msg::SetParametersResult VehicleCmdGate::onParameter(
 }
 
 bool VehicleCmdGate::isHeartbeatTimeout(
-  const std::shared_ptr<rclcpp::Time> & heartbeat_received_time, const double timeout)
+  const std::optional<rclcpp::Time> & heartbeat_received_time, const double timeout)
 {
   if (timeout == 0.0) {
     return false;
@@ -757,7 +757,7 @@ Control VehicleCmdGate::createEmergencyStopControlCmd() const
 void VehicleCmdGate::onExternalEmergencyStopHeartbeat(
   [[maybe_unused]] Heartbeat::ConstSharedPtr msg)
 {
-  external_emergency_stop_heartbeat_received_time_ = std::make_shared<rclcpp::Time>(this->now());
+  external_emergency_stop_heartbeat_received_time_ = this->now();
 }
 
 void VehicleCmdGate::onGateMode(GateMode::ConstSharedPtr msg)
@@ -790,13 +790,13 @@ void VehicleCmdGate::onMrmState(MrmState::ConstSharedPtr msg)
     (msg->state == MrmState::MRM_OPERATING || msg->state == MrmState::MRM_SUCCEEDED ||
      msg->state == MrmState::MRM_FAILED) &&
     (msg->behavior == MrmState::EMERGENCY_STOP);
-  emergency_state_heartbeat_received_time_ = std::make_shared<rclcpp::Time>(this->now());
+  emergency_state_heartbeat_received_time_ = this->now();
 }
 
 double VehicleCmdGate::getDt()
 {
   if (!prev_time_) {
-    prev_time_ = std::make_shared<rclcpp::Time>(this->now());
+    prev_time_ = this->now();
     return 0.0;
   }
 
@@ -954,7 +954,13 @@ void VehicleCmdGate::publishMarkers(const IsFilterActivated & filter_activated)
 
   filter_activated_flag.stamp = now();
   filter_activated_flag_pub_->publish(filter_activated_flag);
-  filter_activated_marker_raw_pub_->publish(createMarkerArray(filter_activated));
+  // the raw marker is created on every control command, so skip it if nobody is listening
+  if (
+    filter_activated_marker_raw_pub_->get_subscription_count() +
+      filter_activated_marker_raw_pub_->get_intra_process_subscription_count() >
+    0) {
+    filter_activated_marker_raw_pub_->publish(createMarkerArray(filter_activated));
+  }
 }
 }  // namespace autoware::vehicle_cmd_gate
 
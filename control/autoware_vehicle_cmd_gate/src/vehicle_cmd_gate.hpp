@@ -52,6 +52,7 @@
 #include <visualization_msgs/msg/marker_array.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -146,12 +147,12 @@ private:
   int filter_activated_count_ = 0;
 
   // Heartbeat
-  std::shared_ptr<rclcpp::Time> emergency_state_heartbeat_received_time_;
+  std::optional<rclcpp::Time> emergency_state_heartbeat_received_time_;
   bool is_emergency_state_heartbeat_timeout_ = false;
-  std::shared_ptr<rclcpp::Time> external_emergency_stop_heartbeat_received_time_;
+  std::optional<rclcpp::Time> external_emergency_stop_heartbeat_received_time_;
   bool is_external_emergency_stop_heartbeat_timeout_ = false;
   bool isHeartbeatTimeout(
-    const std::shared_ptr<rclcpp::Time> & heartbeat_received_time, const double timeout);
+    const std::optional<rclcpp::Time> & heartbeat_received_time, const double timeout);
 
   // Check initialization
   bool isDataReady();
@@ -252,7 +253,7 @@ private:
   Longitudinal createLongitudinalStopControlCmd() const;
   Control createEmergencyStopControlCmd() const;
 
-  std::shared_ptr<rclcpp::Time> prev_time_;
+  std::optional<rclcpp::Time> prev_time_;
   double getDt();
   Control getActualStatusAsCommand();
 
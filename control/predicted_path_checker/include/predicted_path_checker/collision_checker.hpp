@@ -45,6 +45,7 @@ namespace autoware::motion::control::predicted_path_checker
 using autoware_planning_msgs::msg::Trajectory;
 using autoware_planning_msgs::msg::TrajectoryPoint;
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
+using autoware::universe_utils::Box2d;
 using autoware::universe_utils::Point2d;
 using autoware::universe_utils::Polygon2d;
 using autoware_perception_msgs::msg::PredictedObject;
@@ -96,8 +97,10 @@ private:
     const Pose & base_pose, const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min,
     const double z_max);
 
+  // object_polygons and object_boxes are those of dynamic_objects, computed once per trajectory
   boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>> checkDynamicObjects(
     const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+    const std::vector<Polygon2d> & object_polygons, const std::vector<Box2d> & object_boxes,
     const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max);
 
   void updatePredictedObjectHistory(const rclcpp::Time & now)
@@ -50,6 +50,20 @@ CollisionChecker::checkTrajectoryForCollision(
     return boost::none;
   }
 
+  // the object polygons do not depend on the trajectory point, so convert them only once
+  std::vector<Polygon2d> object_polygons;
+  std::vector<Box2d> object_boxes;
+  object_polygons.reserve(dynamic_objects->objects.size());
+  object_boxes.reserve(dynamic_objects->objects.size());
+  for (const auto & obj : dynamic_objects->objects) {
+    object_polygons.push_back(utils::convertObjToPolygon(obj));
+    Box2d box;
+    if (!object_polygons.back().outer().empty()) {
+      bg::envelope(object_polygons.back(), box);
+    }
+    object_boxes.push_back(box);
+  }
+
   for (size_t i = 0; i < predicted_trajectory_array.size() - 1; i++) {
     // create one step circle center for vehicle
     const auto & p_front = predicted_trajectory_array.at(i).pose;
@@ -73,8 +87,9 @@ CollisionChecker::checkTrajectoryForCollision(
     auto found_collision_at_history =
       checkObstacleHistory(p_front, one_step_move_vehicle_polygon2d, z_min, z_max);
 
-    auto found_collision_at_dynamic_objects =
-      checkDynamicObjects(p_front, dynamic_objects, one_step_move_vehicle_polygon2d, z_min, z_max);
+    auto found_collision_at_dynamic_objects = checkDynamicObjects(
+      p_front, dynamic_objects, object_polygons, object_boxes, one_step_move_vehicle_polygon2d,
+      z_min, z_max);
 
     if (found_collision_at_dynamic_objects || found_collision_at_history) {
       double distance_to_current = std::numeric_limits<double>::max();
@@ -155,11 +170,14 @@ CollisionChecker::checkObstacleHistory(
 boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>>
 CollisionChecker::checkDynamicObjects(
   const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+  const std::vector<Polygon2d> & object_polygons, const std::vector<Box2d> & object_boxes,
   const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max)
 {
   if (dynamic_objects->objects.empty()) {
     return boost::none;
   }
+  Box2d vehicle_box;
+  bg::envelope(one_step_move_vehicle_polygon2d, vehicle_box);
   double min_norm_collision_norm = 0.0;
   bool is_init = false;
   size_t nearest_collision_object_index = 0;
@@ -172,11 +190,14 @@ CollisionChecker::checkDynamicObjects(
         continue;
       }
     }
-    const auto object_polygon = utils::convertObjToPolygon(obj);
+    const auto & object_polygon = object_polygons.at(i);
     if (object_polygon.outer().empty()) {
       // unsupported type
       continue;
     }
+    if (bg::disjoint(vehicle_box, object_boxes.at(i))) {
+      continue;
+    }
 
     const auto found_collision_points =
       bg::intersects(one_step_move_vehicle_polygon2d, object_polygon);
@@ -216,7 +237,7 @@ CollisionChecker::checkDynamicObjects(
   }
   if (is_init) {
     const auto & obj = dynamic_objects->objects.at(nearest_collision_object_index);
-    const auto obstacle_polygon = utils::convertObjToPolygon(obj);
+    const auto & obstacle_polygon = object_polygons.at(nearest_collision_object_index);
     if (param_.enable_z_axis_obstacle_filtering) {
       debug_ptr_->pushPolyhedron(obstacle_polygon, z_min, z_max, PolygonType::Collision);
     } else {
@@ -52,10 +52,11 @@ class ControlEvaluatorNode : public rclcpp::Node
 {
 public:
   explicit ControlEvaluatorNode(const rclcpp::NodeOptions & node_options);
+  // The nearest pose of the trajectory is searched once and shared by the deviation metrics.
   DiagnosticStatus generateLateralDeviationDiagnosticStatus(
-    const Trajectory & traj, const Point & ego_point);
+    const Pose & nearest_pose, const Point & ego_point);
   DiagnosticStatus generateYawDeviationDiagnosticStatus(
-    const Trajectory & traj, const Pose & ego_pose);
+    const Pose & nearest_pose, const Pose & ego_pose);
   DiagnosticStatus generateGoalLongitudinalDeviationDiagnosticStatus(const Pose & ego_pose);
   DiagnosticStatus generateGoalLateralDeviationDiagnosticStatus(const Pose & ego_pose);
   DiagnosticStatus generateGoalYawDeviationDiagnosticStatus(const Pose & ego_pose);
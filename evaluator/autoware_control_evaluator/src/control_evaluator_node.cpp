@@ -15,6 +15,7 @@
 #include "autoware/control_evaluator/control_evaluator_node.hpp"
 
 #include "autoware/evaluator_utils/evaluator_utils.hpp"
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
 
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
@@ -155,9 +156,9 @@ DiagnosticStatus ControlEvaluatorNode::generateKinematicStateDiagnosticStatus(
 }
 
 DiagnosticStatus ControlEvaluatorNode::generateLateralDeviationDiagnosticStatus(
-  const Trajectory & traj, const Point & ego_point)
+  const Pose & nearest_pose, const Point & ego_point)
 {
-  const double lateral_deviation = metrics::calcLateralDeviation(traj, ego_point);
+  const double lateral_deviation = metrics::calcLateralDeviation(nearest_pose, ego_point);
 
   DiagnosticStatus status;
   status.level = status.OK;
@@ -171,9 +172,9 @@ DiagnosticStatus ControlEvaluatorNode::generateLateralDeviationDiagnosticStatus(
 }
 
 DiagnosticStatus ControlEvaluatorNode::generateYawDeviationDiagnosticStatus(
-  const Trajectory & traj, const Pose & ego_pose)
+  const Pose & nearest_pose, const Pose & ego_pose)
 {
-  const double yaw_deviation = metrics::calcYawDeviation(traj, ego_pose);
+  const double yaw_deviation = metrics::calcYawDeviation(nearest_pose, ego_pose);
 
   DiagnosticStatus status;
   status.level = status.OK;
@@ -260,9 +261,12 @@ void ControlEvaluatorNode::onTimer()
   // calculate deviation metrics
   if (odom && traj && !traj->points.empty()) {
     const Pose ego_pose = odom->pose.pose;
+    const size_t nearest_index =
+      autoware::motion_utils::findNearestIndex(traj->points, ego_pose.position);
+    const Pose & nearest_pose = traj->points.at(nearest_index).pose;
     metrics_msg.status.push_back(
-      generateLateralDeviationDiagnosticStatus(*traj, ego_pose.position));
-    metrics_msg.status.push_back(generateYawDeviationDiagnosticStatus(*traj, ego_pose));
+      generateLateralDeviationDiagnosticStatus(nearest_pose, ego_pose.position));
+    metrics_msg.status.push_back(generateYawDeviationDiagnosticStatus(nearest_pose, ego_pose));
   }
 
   getRouteData();
@@ -14,16 +14,19 @@
 
 #include "autoware/planning_evaluator/metrics/deviation_metrics.hpp"
 
-#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware/motion_utils/trajectory/indexed_trajectory.hpp"
 #include "autoware/universe_utils/geometry/geometry.hpp"
 #include "autoware/universe_utils/geometry/pose_deviation.hpp"
 
+#include <vector>
+
 namespace planning_diagnostics
 {
 namespace metrics
 {
 using autoware_planning_msgs::msg::Trajectory;
 using autoware_planning_msgs::msg::TrajectoryPoint;
+using IndexedTrajectory = autoware::motion_utils::IndexedTrajectory<std::vector<TrajectoryPoint>>;
 
 Stat<double> calcLateralDeviation(const Trajectory & ref, const Trajectory & traj)
 {
@@ -36,9 +39,9 @@ Stat<double> calcLateralDeviation(const Trajectory & ref, const Trajectory & tra
   /** TODO(Maxime CLEMENT):
    * need more precise calculation, e.g., lateral distance from spline of the reference traj
    */
-  for (TrajectoryPoint p : traj.points) {
-    const size_t nearest_index =
-      autoware::motion_utils::findNearestIndex(ref.points, p.pose.position);
+  const IndexedTrajectory indexed_ref(ref.points);
+  for (const TrajectoryPoint & p : traj.points) {
+    const size_t nearest_index = indexed_ref.findNearestIndex(p.pose.position);
     stat.add(autoware::universe_utils::calcLateralDeviation(
       ref.points[nearest_index].pose, p.pose.position));
   }
@@ -56,9 +59,9 @@ Stat<double> calcYawDeviation(const Trajectory & ref, const Trajectory & traj)
   /** TODO(Maxime CLEMENT):
    * need more precise calculation, e.g., yaw distance from spline of the reference traj
    */
-  for (TrajectoryPoint p : traj.points) {
-    const size_t nearest_index =
-      autoware::motion_utils::findNearestIndex(ref.points, p.pose.position);
+  const IndexedTrajectory indexed_ref(ref.points);
+  for (const TrajectoryPoint & p : traj.points) {
+    const size_t nearest_index = indexed_ref.findNearestIndex(p.pose.position);
     stat.add(autoware::universe_utils::calcYawDeviation(ref.points[nearest_index].pose, p.pose));
   }
   return stat;
@@ -73,9 +76,9 @@ Stat<double> calcVelocityDeviation(const Trajectory & ref, const Trajectory & tr
   }
 
   // TODO(Maxime CLEMENT) need more precise calculation
-  for (TrajectoryPoint p : traj.points) {
-    const size_t nearest_index =
-      autoware::motion_utils::findNearestIndex(ref.points, p.pose.position);
+  const IndexedTrajectory indexed_ref(ref.points);
+  for (const TrajectoryPoint & p : traj.points) {
+    const size_t nearest_index = indexed_ref.findNearestIndex(p.pose.position);
     stat.add(p.longitudinal_velocity_mps - ref.points[nearest_index].longitudinal_velocity_mps);
   }
   return stat;
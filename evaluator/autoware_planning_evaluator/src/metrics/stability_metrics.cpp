@@ -14,20 +14,49 @@
 
 #include "autoware/planning_evaluator/metrics/stability_metrics.hpp"
 
-#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware/motion_utils/trajectory/indexed_trajectory.hpp"
 #include "autoware/universe_utils/geometry/geometry.hpp"
 
-#include <Eigen/Core>
-
 #include "autoware_planning_msgs/msg/trajectory_point.hpp"
 
 #include <algorithm>
+#include <vector>
 
 namespace planning_diagnostics
 {
 namespace metrics
 {
+using autoware::universe_utils::calcDistance2d;
 using autoware_planning_msgs::msg::TrajectoryPoint;
+using IndexedTrajectory = autoware::motion_utils::IndexedTrajectory<std::vector<TrajectoryPoint>>;
+
+namespace
+{
+/**
+ * @brief find the index of the locally nearest point by walking the points from the given index
+ * @param [in] points points to walk
+ * @param [in] point target point
+ * @param [in] start_idx index where the walk starts
+ * @return index of the point whose neighbors are not nearer to the target point
+ */
+size_t findLocalNearestIndex(
+  const std::vector<TrajectoryPoint> & points, const geometry_msgs::msg::Point & point,
+  const size_t start_idx)
+{
+  const auto squared_dist = [&](const size_t i) {
+    return autoware::universe_utils::calcSquaredDistance2d(points.at(i), point);
+  };
+  size_t idx = start_idx;
+  // overlapping points are passed through while walking forward
+  while (idx + 1 < points.size() && squared_dist(idx + 1) <= squared_dist(idx)) {
+    ++idx;
+  }
+  while (idx > 0 && squared_dist(idx - 1) < squared_dist(idx)) {
+    --idx;
+  }
+  return idx;
+}
+}  // namespace
 
 Stat<double> calcFrechetDistance(const Trajectory & traj1, const Trajectory & traj2)
 {
@@ -37,53 +66,91 @@ Stat<double> calcFrechetDistance(const Trajectory & traj1, const Trajectory & tr
     return stat;
   }
 
-  Eigen::MatrixXd ca = Eigen::MatrixXd::Zero(traj1.points.size(), traj2.points.size());
-
+  // only the previous row of the coupling distances is needed to calculate the current one
+  std::vector<double> prev_ca(traj2.points.size());
+  std::vector<double> ca(traj2.points.size());
   for (size_t i = 0; i < traj1.points.size(); ++i) {
     for (size_t j = 0; j < traj2.points.size(); ++j) {
-      const double dist =
-        autoware::universe_utils::calcDistance2d(traj1.points[i], traj2.points[j]);
+      const double dist = calcDistance2d(traj1.points[i], traj2.points[j]);
       if (i > 0 && j > 0) {
-        ca(i, j) = std::max(std::min(ca(i - 1, j), std::min(ca(i - 1, j - 1), ca(i, j - 1))), dist);
+        ca[j] = std::max(std::min(prev_ca[j], std::min(prev_ca[j - 1], ca[j - 1])), dist);
       } else if (i > 0 /*&& j == 0*/) {
-        ca(i, j) = std::max(ca(i - 1, 0), dist);
+        ca[j] = std::max(prev_ca[0], dist);
       } else if (j > 0 /*&& i == 0*/) {
-        ca(i, j) = std::max(ca(0, j - 1), dist);
+        ca[j] = std::max(ca[j - 1], dist);
       } else { /* i == j == 0 */
-        ca(i, j) = dist;
+        ca[j] = dist;
       }
     }
+    std::swap(prev_ca, ca);
   }
-  stat.add(ca(traj1.points.size() - 1, traj2.points.size() - 1));
+  stat.add(prev_ca.back());
   return stat;
 }
 
 Stat<double> calcLateralDistance(const Trajectory & traj1, const Trajectory & traj2)
 {
   Stat<double> stat;
-  if (traj1.points.empty()) {
+  if (traj1.points.empty() || traj2.points.empty()) {
     return stat;
   }
-  for (const auto & point : traj2.points) {
-    const auto p0 = autoware::universe_utils::getPoint(point);
-    // find nearest segment
-    const size_t nearest_segment_idx =
-      autoware::motion_utils::findNearestSegmentIndex(traj1.points, p0);
+  if (traj1.points.size() == 1) {
+    for (const auto & point : traj2.points) {
+      stat.add(calcDistance2d(traj1.points.front(), point));
+    }
+    return stat;
+  }
+
+  // the points of traj2 are matched with traj1 at the same arc length from the first point of
+  // traj2, and the nearest segment is searched from there. Both walks only go forward along the
+  // trajectories in most cases, so the nearest segments are not searched in all the points.
+  const IndexedTrajectory indexed_traj1(traj1.points);
+  double arc_length = indexed_traj1.calcSignedArcLength(
+    0, autoware::universe_utils::getPoint(traj2.points.front()));
+  size_t aligned_idx = 0;
+  for (size_t i = 0; i < traj2.points.size(); ++i) {
+    const auto p0 = autoware::universe_utils::getPoint(traj2.points[i]);
+    if (i > 0) {
+      arc_length += calcDistance2d(traj2.points[i - 1], traj2.points[i]);
+    }
+    while (aligned_idx + 1 < traj1.points.size() &&
+           indexed_traj1.calcSignedArcLength(0, aligned_idx + 1) <= arc_length) {
+      ++aligned_idx;
+    }
+
+    // find nearest segment. The locally nearest point can be different from the nearest one when
+    // the point is away from traj1 by more than the interval of the points or is beyond the ends of
+    // traj1, in which case the nearest point is searched in all the points.
+    size_t nearest_idx = findLocalNearestIndex(traj1.points, p0, aligned_idx);
+    if (
+      nearest_idx == 0 || nearest_idx == traj1.points.size() - 1 ||
+      calcDistance2d(traj1.points[nearest_idx], p0) >
+        std::max(
+          calcDistance2d(traj1.points[nearest_idx - 1], traj1.points[nearest_idx]),
+          calcDistance2d(traj1.points[nearest_idx], traj1.points[nearest_idx + 1]))) {
+      nearest_idx = indexed_traj1.findNearestIndex(p0);
+    }
+    size_t nearest_segment_idx = nearest_idx;
+    if (
+      nearest_idx == traj1.points.size() - 1 ||
+      (nearest_idx > 0 && indexed_traj1.calcLongitudinalOffsetToSegment(nearest_idx, p0) <= 0)) {
+      nearest_segment_idx = nearest_idx - 1;
+    }
+
     double dist;
     // distance to segment
     if (
       nearest_segment_idx == traj1.points.size() - 2 &&
-      autoware::motion_utils::calcLongitudinalOffsetToSegment(
-        traj1.points, nearest_segment_idx, p0) >
-        autoware::universe_utils::calcDistance2d(
+      indexed_traj1.calcLongitudinalOffsetToSegment(nearest_segment_idx, p0) >
+        calcDistance2d(
           traj1.points[nearest_segment_idx], traj1.points[nearest_segment_idx + 1])) {
       // distance to last point
-      dist = autoware::universe_utils::calcDistance2d(traj1.points.back(), p0);
+      dist = calcDistance2d(traj1.points.back(), p0);
     } else if (  // NOLINT
-      nearest_segment_idx == 0 && autoware::motion_utils::calcLongitudinalOffsetToSegment(
-                                    traj1.points, nearest_segment_idx, p0) <= 0) {
+      nearest_segment_idx == 0 &&
+      indexed_traj1.calcLongitudinalOffsetToSegment(nearest_segment_idx, p0) <= 0) {
       // distance to first point
-      dist = autoware::universe_utils::calcDistance2d(traj1.points.front(), p0);
+      dist = calcDistance2d(traj1.points.front(), p0);
     } else {
       // orthogonal distance
       const auto p1 = autoware::universe_utils::getPoint(traj1.points[nearest_segment_idx]);
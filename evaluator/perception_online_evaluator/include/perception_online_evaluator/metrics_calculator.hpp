@@ -107,8 +107,8 @@ public:
 
   void updateObjectsCountMap(const PredictedObjects & objects, const tf2_ros::Buffer & tf_buffer);
 
-  HistoryPathMap getHistoryPathMap() const { return history_path_map_; }
-  ObjectDataMap getDebugObjectData() const { return debug_target_object_; }
+  const HistoryPathMap & getHistoryPathMap() const { return history_path_map_; }
+  const ObjectDataMap & getDebugObjectData() const { return debug_target_object_; }
 
 private:
   std::shared_ptr<Parameters> parameters_;
@@ -116,6 +116,8 @@ private:
   // Store predicted objects information and calculation results
   ObjectMap object_map_;
   HistoryPathMap history_path_map_;
+  // number of objects stored at each stamp, so that the stamps of all objects are looked up at once
+  std::map<rclcpp::Time, size_t> stamp_object_counts_;
 
   rclcpp::Time current_stamp_;
 
@@ -125,6 +127,7 @@ private:
   mutable ObjectDataMap debug_target_object_;
 
   // Functions to calculate history path
+  bool needsHistoryPath() const;
   void updateHistoryPath();
   std::vector<Pose> averageFilterPath(
     const std::vector<Pose> & path, const size_t window_size) const;
@@ -152,7 +155,7 @@ private:
   // Extract object
   rclcpp::Time getClosestStamp(const rclcpp::Time stamp) const;
   std::optional<StampObjectMapIterator> getClosestObjectIterator(
-    const std::string & uuid, const rclcpp::Time & stamp) const;
+    const std::string & uuid, const rclcpp::Time & closest_stamp) const;
   std::optional<PredictedObject> getObjectByStamp(
     const std::string uuid, const rclcpp::Time stamp) const;
   std::optional<std::pair<rclcpp::Time, PredictedObject>> getPreviousObjectByStamp(
@@ -41,7 +41,10 @@ public:
       max_ = value;
     }
     ++count_;
-    mean_ = mean_ + (value - mean_) / count_;
+    // update the mean and the sum of squared differences by Welford's algorithm
+    const long double delta = value - mean_;
+    mean_ = mean_ + delta / count_;
+    squared_sum_ = squared_sum_ + delta * (value - mean_);
   }
 
   /**
@@ -49,6 +52,11 @@ public:
    */
   long double mean() const { return mean_; }
 
+  /**
+   * @brief get the population variance
+   */
+  long double variance() const { return count_ == 0 ? 0.0 : squared_sum_ / count_; }
+
   /**
    * @brief get the minimum value
    */
@@ -71,6 +79,7 @@ private:
   T min_ = std::numeric_limits<T>::max();
   T max_ = std::numeric_limits<T>::min();
   long double mean_ = 0.0;
+  long double squared_sum_ = 0.0;
   unsigned int count_ = 0;
 };
 
@@ -103,21 +103,11 @@ bool MetricsCalculator::hasPassedTime(const std::string uuid, const rclcpp::Time
 
 bool MetricsCalculator::hasPassedTime(const rclcpp::Time stamp) const
 {
-  std::vector<rclcpp::Time> timestamps;
-  for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    if (!stamp_and_objects.empty()) {
-      timestamps.push_back(stamp_and_objects.begin()->first);
-    }
-  }
-
-  auto it = std::min_element(timestamps.begin(), timestamps.end());
-  if (it != timestamps.end()) {
-    rclcpp::Time oldest_stamp = *it;
-    if (oldest_stamp > stamp) {
-      return false;
-    }
+  // the oldest stamp of all objects
+  if (stamp_object_counts_.empty()) {
+    return true;
   }
-  return true;
+  return stamp_object_counts_.begin()->first <= stamp;
 }
 
 rclcpp::Time MetricsCalculator::getClosestStamp(const rclcpp::Time stamp) const
@@ -126,30 +116,22 @@ rclcpp::Time MetricsCalculator::getClosestStamp(const rclcpp::Time stamp) const
   rclcpp::Duration min_duration =
     rclcpp::Duration::from_nanoseconds(std::numeric_limits<int64_t>::max());
 
-  for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    if (!stamp_and_objects.empty()) {
-      auto it = std::lower_bound(
-        stamp_and_objects.begin(), stamp_and_objects.end(), stamp,
-        [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-      // check the upper bound
-      if (it != stamp_and_objects.end()) {
-        const auto duration = it->first - stamp;
-        if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
-          min_duration = duration;
-          closest_stamp = it->first;
-        }
-      }
+  const auto it = stamp_object_counts_.lower_bound(stamp);
 
-      // check the lower bound (if it is not the first element)
-      if (it != stamp_and_objects.begin()) {
-        const auto prev_it = std::prev(it);
-        const auto duration = stamp - prev_it->first;
-        if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
-          min_duration = duration;
-          closest_stamp = prev_it->first;
-        }
-      }
+  // check the upper bound
+  if (it != stamp_object_counts_.end()) {
+    const auto duration = it->first - stamp;
+    min_duration = duration;
+    closest_stamp = it->first;
+  }
+
+  // check the lower bound (if it is not the first element)
+  if (it != stamp_object_counts_.begin()) {
+    const auto prev_it = std::prev(it);
+    const auto duration = stamp - prev_it->first;
+    if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
+      min_duration = duration;
+      closest_stamp = prev_it->first;
     }
   }
 
@@ -157,15 +139,11 @@ rclcpp::Time MetricsCalculator::getClosestStamp(const rclcpp::Time stamp) const
 }
 
 std::optional<StampObjectMapIterator> MetricsCalculator::getClosestObjectIterator(
-  const std::string & uuid, const rclcpp::Time & stamp) const
+  const std::string & uuid, const rclcpp::Time & closest_stamp) const
 {
-  const auto closest_stamp = getClosestStamp(stamp);
-  const auto it = std::lower_bound(
-    object_map_.at(uuid).begin(), object_map_.at(uuid).end(), closest_stamp,
-    [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-  return it != object_map_.at(uuid).end() ? std::optional<StampObjectMapIterator>(it)
-                                          : std::nullopt;
+  const auto & stamp_and_objects = object_map_.at(uuid);
+  const auto it = stamp_and_objects.lower_bound(closest_stamp);
+  return it != stamp_and_objects.end() ? std::optional<StampObjectMapIterator>(it) : std::nullopt;
 }
 
 std::optional<PredictedObject> MetricsCalculator::getObjectByStamp(
@@ -174,10 +152,11 @@ std::optional<PredictedObject> MetricsCalculator::getObjectByStamp(
   constexpr double eps = 0.01;
   constexpr double close_time_threshold = 0.1;
 
-  const auto obj_it_opt = getClosestObjectIterator(uuid, stamp);
+  const auto closest_stamp = getClosestStamp(stamp);
+  const auto obj_it_opt = getClosestObjectIterator(uuid, closest_stamp);
   if (obj_it_opt.has_value()) {
     const auto it = obj_it_opt.value();
-    if (std::abs((it->first - getClosestStamp(stamp)).seconds()) < eps) {
+    if (std::abs((it->first - closest_stamp).seconds()) < eps) {
       const double time_diff = std::abs((it->first - stamp).seconds());
       if (time_diff < close_time_threshold) {
         return it->second;
@@ -190,12 +169,13 @@ std::optional<PredictedObject> MetricsCalculator::getObjectByStamp(
 std::optional<std::pair<rclcpp::Time, PredictedObject>> MetricsCalculator::getPreviousObjectByStamp(
   const std::string uuid, const rclcpp::Time stamp) const
 {
-  const auto obj_it_opt = getClosestObjectIterator(uuid, stamp);
+  const auto closest_stamp = getClosestStamp(stamp);
+  const auto obj_it_opt = getClosestObjectIterator(uuid, closest_stamp);
   if (obj_it_opt.has_value()) {
     auto it = obj_it_opt.value();
     if (it != object_map_.at(uuid).begin()) {
       // If it is exactly the closest stamp, move one back to get the previous
-      if (it->first == getClosestStamp(stamp)) {
+      if (it->first == closest_stamp) {
         --it;
       } else {
         // If it is not the closest stamp, it already points to the previous one due to lower_bound
@@ -213,12 +193,9 @@ PredictedObjects MetricsCalculator::getObjectsByStamp(const rclcpp::Time stamp)
   PredictedObjects objects;
   objects.header.stamp = stamp;
   for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    auto it = std::lower_bound(
-      stamp_and_objects.begin(), stamp_and_objects.end(), closest_stamp,
-      [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-    // add the object only if the element pointed to by lower_bound is equal to stamp
-    if (it != stamp_and_objects.end() && it->first == closest_stamp) {
+    // add the object only if it exists at the closest stamp
+    const auto it = stamp_and_objects.find(closest_stamp);
+    if (it != stamp_and_objects.end()) {
       objects.objects.push_back(it->second);
     }
   }
@@ -243,7 +220,7 @@ MetricStatMap MetricsCalculator::calcLateralDeviationMetrics(
         continue;
       }
       const auto object_pose = object.kinematics.initial_pose_with_covariance.pose;
-      const auto history_path = history_path_map_.at(uuid).second;
+      const auto & history_path = history_path_map_.at(uuid).second;
       if (history_path.empty()) {
         continue;
       }
@@ -272,7 +249,7 @@ MetricStatMap MetricsCalculator::calcYawDeviationMetrics(
         continue;
       }
       const auto object_pose = object.kinematics.initial_pose_with_covariance.pose;
-      const auto history_path = history_path_map_.at(uuid).second;
+      const auto & history_path = history_path_map_.at(uuid).second;
       if (history_path.empty()) {
         continue;
       }
@@ -315,10 +292,9 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
   const PredictedObjects & objects, const double time_horizon) const
 {
   // Step 1: For each object and its predicted paths, calculate the deviation between each predicted
-  // path pose and the corresponding historical path pose. Store the deviations in
+  // path pose and the corresponding historical path pose. Store the statistics of the deviations in
   // deviation_map_for_paths.
-  std::unordered_map<std::string, std::unordered_map<size_t, std::vector<double>>>
-    deviation_map_for_paths;
+  std::unordered_map<std::string, std::unordered_map<size_t, Stat<double>>> deviation_map_for_paths;
 
   // For debugging: Save the pairs of predicted path pose and history path pose.
   std::unordered_map<std::string, std::vector<std::pair<Pose, Pose>>>
@@ -327,9 +303,9 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
   const auto stamp = objects.header.stamp;
   for (const auto & object : objects.objects) {
     const auto uuid = autoware::universe_utils::toHexString(object.object_id);
-    const auto predicted_paths = object.kinematics.predicted_paths;
+    const auto & predicted_paths = object.kinematics.predicted_paths;
     for (size_t i = 0; i < predicted_paths.size(); i++) {
-      const auto predicted_path = predicted_paths[i];
+      const auto & predicted_path = predicted_paths[i];
       const std::string path_id = uuid + "_" + std::to_string(i);
       for (size_t j = 0; j < predicted_path.path.size(); j++) {
         const double time_duration =
@@ -346,12 +322,12 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
         if (!history_object_opt.has_value()) {
           continue;
         }
-        const auto history_object = history_object_opt.value();
-        const auto history_pose = history_object.kinematics.initial_pose_with_covariance.pose;
+        const auto & history_pose =
+          history_object_opt->kinematics.initial_pose_with_covariance.pose;
         const Pose & p = predicted_path.path[j];
         const double distance =
           autoware::universe_utils::calcDistance2d(p.position, history_pose.position);
-        deviation_map_for_paths[uuid][i].push_back(distance);
+        deviation_map_for_paths[uuid][i].add(distance);
 
         // Save debug information
         debug_predicted_path_pairs_map[path_id].push_back(std::make_pair(p, history_pose));
@@ -360,16 +336,15 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
   }
 
   // Step 2: For each object, select the predicted path with the smallest mean deviation.
-  // Store the selected path's deviations in deviation_map_for_objects.
-  std::unordered_map<std::string, std::vector<double>> deviation_map_for_objects;
+  // Store the selected path's deviation statistics in deviation_map_for_objects.
+  std::unordered_map<std::string, Stat<double>> deviation_map_for_objects;
   for (const auto & [uuid, deviation_map] : deviation_map_for_paths) {
     std::optional<std::pair<size_t, double>> min_deviation;
     for (const auto & [i, deviations] : deviation_map) {
-      if (deviations.empty()) {
+      if (deviations.count() == 0) {
         continue;
       }
-      const double sum = std::accumulate(deviations.begin(), deviations.end(), 0.0);
-      const double mean = sum / deviations.size();
+      const double mean = deviations.mean();
       if (!min_deviation.has_value() || mean < min_deviation.value().second) {
         min_deviation = std::make_pair(i, mean);
       }
@@ -396,18 +371,9 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
   // path. Store the results in the PredictedPathDeviationMetrics structure.
   PredictedPathDeviationMetrics metrics;
   for (const auto & [object_id, object_path_deviations] : deviation_map_for_objects) {
-    if (!object_path_deviations.empty()) {
-      const double sum_of_deviations =
-        std::accumulate(object_path_deviations.begin(), object_path_deviations.end(), 0.0);
-      const double mean_deviation = sum_of_deviations / object_path_deviations.size();
-      metrics.mean.add(mean_deviation);
-      double sum_of_squared_deviations = 0.0;
-      for (const auto path_point_deviation : object_path_deviations) {
-        sum_of_squared_deviations += std::pow(path_point_deviation - mean_deviation, 2);
-      }
-      const double variance_deviation = sum_of_squared_deviations / object_path_deviations.size();
-
-      metrics.variance.add(variance_deviation);
+    if (object_path_deviations.count() > 0) {
+      metrics.mean.add(object_path_deviations.mean());
+      metrics.variance.add(object_path_deviations.variance());
     }
   }
 
@@ -500,7 +466,11 @@ void MetricsCalculator::setPredictedObjects(
       updateObjects(uuid, current_stamp_, object);
     }
     deleteOldObjects(current_stamp_);
-    updateHistoryPath();
+    if (needsHistoryPath()) {
+      updateHistoryPath();
+    } else {
+      history_path_map_.clear();
+    }
   }
 
   // store objects to calculate object count
@@ -511,22 +481,24 @@ void MetricsCalculator::deleteOldObjects(const rclcpp::Time stamp)
 {
   // delete the data older than 2*time_delay_
   const double time_delay = getTimeDelay();
-  for (auto & [uuid, stamp_and_objects] : object_map_) {
-    for (auto it = stamp_and_objects.begin(); it != stamp_and_objects.end();) {
-      if (it->first < stamp - rclcpp::Duration::from_seconds(time_delay * 2)) {
-        it = stamp_and_objects.erase(it);
-      } else {
-        break;
+  const auto oldest_stamp = stamp - rclcpp::Duration::from_seconds(time_delay * 2);
+  for (auto object_it = object_map_.begin(); object_it != object_map_.end();) {
+    auto & [uuid, stamp_and_objects] = *object_it;
+    for (auto it = stamp_and_objects.begin();
+         it != stamp_and_objects.end() && it->first < oldest_stamp;) {
+      const auto count_it = stamp_object_counts_.find(it->first);
+      if (--count_it->second == 0) {
+        stamp_object_counts_.erase(count_it);
       }
+      it = stamp_and_objects.erase(it);
     }
-  }
 
-  const auto object_map = object_map_;
-  for (const auto & [uuid, stamp_and_objects] : object_map) {
     if (stamp_and_objects.empty()) {
-      object_map_.erase(uuid);
       history_path_map_.erase(uuid);
       debug_target_object_.erase(uuid);  // debug
+      object_it = object_map_.erase(object_it);
+    } else {
+      ++object_it;
     }
   }
 }
@@ -534,7 +506,23 @@ void MetricsCalculator::deleteOldObjects(const rclcpp::Time stamp)
 void MetricsCalculator::updateObjects(
   const std::string uuid, const rclcpp::Time stamp, const PredictedObject & object)
 {
-  object_map_[uuid][stamp] = object;
+  const auto [it, inserted] = object_map_[uuid].insert_or_assign(stamp, object);
+  if (inserted) {
+    ++stamp_object_counts_[stamp];
+  }
+}
+
+bool MetricsCalculator::needsHistoryPath() const
+{
+  // the history path is used only by the deviation metrics and the debug markers
+  const auto & metrics = parameters_->metrics;
+  const auto uses_metric = [&metrics](const Metric metric) {
+    return std::find(metrics.begin(), metrics.end(), metric) != metrics.end();
+  };
+  const auto & p = parameters_->debug_marker_parameters;
+  return uses_metric(Metric::lateral_deviation) || uses_metric(Metric::yaw_deviation) ||
+         p.show_history_path || p.show_history_path_arrows || p.show_smoothed_history_path ||
+         p.show_smoothed_history_path_arrows;
 }
 
 void MetricsCalculator::updateHistoryPath()
@@ -200,6 +200,9 @@ class GroundSegmentationPipeline:
                     {
                         "voxel_size_x": 0.25,
                         "voxel_size_y": 0.25,
+                        "use_raster_index": False,
+                        "raster_resolution": 0.5,
+                        "raster_tile_margin": 50.0,
                     }
                 ],
                 # cannot use intra process because vector map filter uses transient local.
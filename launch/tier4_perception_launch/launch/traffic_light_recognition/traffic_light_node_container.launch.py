@@ -155,7 +155,7 @@ def create_traffic_light_node_container(namespace, context, *args, **kwargs):
                 plugin="autoware::image_preprocessor::ImageTransportDecompressor",
                 name="traffic_light_image_decompressor",
                 namespace=namespace,
-                parameters=[{"encoding": "rgb8"}],
+                parameters=[{"encoding": "rgb8", "decoder_backend": "auto"}],
                 remappings=[
                     (
                         "~/input/compressed_image",
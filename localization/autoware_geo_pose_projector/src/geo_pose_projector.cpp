@@ -33,8 +33,10 @@ GeoPoseProjector::GeoPoseProjector(const rclcpp::NodeOptions & options)
   // Subscribe to map_projector_info topic
   const auto adaptor = autoware::component_interface_utils::NodeAdaptor(this);
   adaptor.init_sub(
-    sub_map_projector_info_,
-    [this](const MapProjectorInfo::Message::ConstSharedPtr msg) { projector_info_ = *msg; });
+    sub_map_projector_info_, [this](const MapProjectorInfo::Message::ConstSharedPtr msg) {
+      projector_info_ = *msg;
+      projector_.reset();
+    });
 
   // Subscribe to geo_pose topic
   geo_pose_sub_ = create_subscription<GeoPoseWithCovariance>(
@@ -65,8 +67,10 @@ void GeoPoseProjector::on_geo_pose(const GeoPoseWithCovariance::ConstSharedPtr m
   gps_point.latitude = msg->pose.pose.position.latitude;
   gps_point.longitude = msg->pose.pose.position.longitude;
   gps_point.altitude = msg->pose.pose.position.altitude;
-  geometry_msgs::msg::Point position =
-    autoware::geography_utils::project_forward(gps_point, projector_info_.value());
+  if (!projector_) {
+    projector_.emplace(projector_info_.value());
+  }
+  geometry_msgs::msg::Point position = projector_->forward(gps_point);
   position.z = autoware::geography_utils::convert_height(
     position.z, gps_point.latitude, gps_point.longitude, MapProjectorInfo::Message::WGS84,
     projector_info_.value().vertical_datum);
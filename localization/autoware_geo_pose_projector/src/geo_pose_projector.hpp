@@ -17,6 +17,7 @@
 
 #include <autoware/component_interface_specs/map.hpp>
 #include <autoware/component_interface_utils/rclcpp.hpp>
+#include <autoware/geography_utils/projection.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <geographic_msgs/msg/geo_pose_with_covariance_stamped.hpp>
@@ -51,6 +52,8 @@ private:
   std::unique_ptr<tf2_ros::TransformBroadcaster> tf_broadcaster_;
 
   std::optional<MapProjectorInfo::Message> projector_info_ = std::nullopt;
+  // projector built from projector_info_ on the first geo pose, not to build it on every geo pose
+  std::optional<autoware::geography_utils::Projector> projector_ = std::nullopt;
 
   const bool publish_tf_;
 
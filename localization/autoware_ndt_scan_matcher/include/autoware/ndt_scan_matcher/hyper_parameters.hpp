@@ -122,6 +122,7 @@ public:
     ndt.max_iterations = static_cast<int>(node->declare_parameter<int64_t>("ndt.max_iterations"));
     ndt.num_threads = static_cast<int>(node->declare_parameter<int64_t>("ndt.num_threads"));
     ndt.num_threads = std::max(ndt.num_threads, 1);
+    ndt.use_gpu = node->declare_parameter<bool>("ndt.use_gpu");
     ndt_regularization_enable = node->declare_parameter<bool>("ndt.regularization.enable");
     ndt.regularization_scale_factor =
       static_cast<float>(node->declare_parameter<float>("ndt.regularization.scale_factor"));
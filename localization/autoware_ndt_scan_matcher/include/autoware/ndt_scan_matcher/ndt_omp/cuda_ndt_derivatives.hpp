@@ -0,0 +1,118 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef AUTOWARE__NDT_SCAN_MATCHER__NDT_OMP__CUDA_NDT_DERIVATIVES_HPP_
+#define AUTOWARE__NDT_SCAN_MATCHER__NDT_OMP__CUDA_NDT_DERIVATIVES_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace pclomp
+{
+
+/** \brief Leaves of one grid of the target on the GPU.
+ * \note The leaves are copied once and never modified, so the grid is shared like the host grid.
+ */
+class CudaNdtGrid
+{
+public:
+  struct DeviceBuffers;
+
+  /** \brief Copy the leaves of a grid to the GPU.
+   * \param[in] voxel_ids voxel of the centroid of each leaf relative to min_voxel, in ascending
+   * order
+   * \param[in] centroids x, y and z of the centroid of each leaf
+   * \param[in] means x, y and z of the mean of each leaf
+   * \param[in] inverse_covariances row-major inverse covariance of each leaf
+   * \param[in] min_voxel lower bound of the voxels of the centroids
+   * \param[in] max_voxel upper bound of the voxels of the centroids
+   * \return nullptr if a CUDA operation failed
+   */
+  static std::shared_ptr<const CudaNdtGrid> create(
+    const std::vector<int64_t> & voxel_ids, const std::vector<float> & centroids,
+    const std::vector<double> & means, const std::vector<double> & inverse_covariances,
+    const std::array<int, 3> & min_voxel, const std::array<int, 3> & max_voxel);
+
+  ~CudaNdtGrid();
+
+  const DeviceBuffers & getDeviceBuffers() const { return *buffers_; }
+
+private:
+  CudaNdtGrid();
+
+  std::unique_ptr<DeviceBuffers> buffers_;
+};
+
+struct CudaNdtDerivativesParameters
+{
+  // The precomputed angular gradient and hessian, without the zero last column
+  double j_ang[8][3];
+  double h_ang[15][3];
+  // The normalization constants of the point distribution, Equation 6.8 [Magnusson 2009]
+  double gauss_d1;
+  double gauss_d2;
+  // The inverse of the leaf size of the target grids
+  double inverse_leaf_size[3];
+  // The radius of the neighbor search
+  double radius;
+  bool compute_hessian;
+};
+
+struct CudaNdtDerivativesResult
+{
+  double score;
+  double nearest_voxel_score;
+  size_t found_neighborhood_voxel_num;
+  int total_neighborhood_count;
+  double score_gradient[6];
+  // Row-major
+  double hessian[36];
+};
+
+/** \brief Score, gradient and hessian of the NDT on the GPU.
+ * \note Each point searches the leaves within the radius in the grids whose bounds overlap it, like
+ * MultiVoxelGridCovariance::radiusSearch, and the terms of its neighbors are reduced per block, so
+ * the result does not depend on the scheduling. The leaves found and the terms are the same as the
+ * ones of the CPU, up to rounding.
+ */
+class CudaNdtDerivatives
+{
+public:
+  CudaNdtDerivatives();
+  ~CudaNdtDerivatives();
+
+  /**
+   * \param[in] grids the grids of the target
+   * \param[in] points x, y and z of each point of the input source
+   * \param[in] transformed_points x, y and z of each point of the input source, transformed by the
+   * current pose
+   * \return false if a CUDA operation failed
+   */
+  bool compute(
+    const std::vector<std::shared_ptr<const CudaNdtGrid>> & grids,
+    const std::vector<float> & points, const std::vector<float> & transformed_points,
+    const CudaNdtDerivativesParameters & parameters, CudaNdtDerivativesResult & result);
+
+private:
+  struct DeviceBuffers;
+  std::unique_ptr<DeviceBuffers> buffers_;
+};
+
+}  // namespace pclomp
+
+#endif  // AUTOWARE__NDT_SCAN_MATCHER__NDT_OMP__CUDA_NDT_DERIVATIVES_HPP_
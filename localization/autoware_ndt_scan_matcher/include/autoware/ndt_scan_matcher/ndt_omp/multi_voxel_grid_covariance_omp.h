@@ -63,9 +63,9 @@
 // clang-format on
 #include <pcl/filters/boost.h>
 #include <pcl/filters/voxel_grid.h>
-#include <pcl/kdtree/kdtree_flann.h>
 #include <pcl/point_types.h>
 
+#include <cmath>
 #include <future>
 #include <map>
 #include <memory>
@@ -262,8 +262,24 @@ public:
     Eigen::Vector4i div_mul;
   };
 
-  // Each grid contains a vector of leaves and a kdtree built from those leaves
-  using GridNodeType = std::vector<Leaf>;
+  // Each grid contains a vector of leaves and a hash of those leaves keyed by the voxel of their
+  // centroids, both built when the grid is filtered. A grid is never modified after that, so
+  // adding or removing other grids leaves it untouched, and the copies of a
+  // MultiVoxelGridCovariance share the grids instead of cloning them.
+  struct GridNode
+  {
+    // Leaves sorted by the voxel of their centroids
+    std::vector<Leaf> leaves;
+    // Voxel of the centroid of each leaf, as an index relative to min_voxel
+    std::vector<int64_t> leaf_voxel_ids;
+    // Index of the first leaf of each occupied voxel
+    std::unordered_map<int64_t, int> voxel_to_leaf;
+    // Bounds of the voxels of the centroids
+    Eigen::Vector3i min_voxel{Eigen::Vector3i::Zero()};
+    Eigen::Vector3i max_voxel{Eigen::Vector3i::Zero()};
+  };
+
+  using GridNodeType = GridNode;
   using GridNodePtr = std::shared_ptr<GridNodeType>;
 
 public:
@@ -295,7 +311,9 @@ public:
    */
   void removeCloud(const std::string & grid_id);
 
-  /** \brief Build KdTrees from the NDT voxel for later radius search
+  /** \brief Drop the removed grids and make the added ones searchable
+   * \note Each grid is indexed when it is filtered, so this does not rebuild anything for the
+   * grids that were already loaded.
    */
   void createKdtree();
 
@@ -330,6 +348,11 @@ public:
   // Return the string indices of currently loaded map pieces
   std::vector<std::string> getCurrentMapIDs() const;
 
+  // Return the grids of currently loaded map pieces, which are never modified once loaded
+  const std::vector<GridNodePtr> & getGridList() const { return grid_list_; }
+
+  Eigen::Array4f getInverseLeafSize() const { return inverse_leaf_size_; }
+
   void setThreadNum(int thread_num)
   {
     sync();
@@ -409,16 +432,20 @@ protected:
 
   int64_t getLeafID(const PointT & point, const BoundingBox & bbox) const;
 
+  /** \brief Sort the leaves of the grid by the voxel of their centroids and hash them. */
+  void buildVoxelIndex(GridNodeType & node) const;
+
+  inline int getVoxelCoordinate(double value, int axis) const
+  {
+    return static_cast<int>(std::floor(value * static_cast<double>(inverse_leaf_size_[axis])));
+  }
+
   /** \brief Minimum points contained with in a voxel to allow it to be usable. */
   int min_points_per_voxel_;
 
   /** \brief Minimum allowable ratio between eigenvalues to prevent singular covariance matrices. */
   double min_covar_eigvalue_mult_;
 
-  // The point cloud containing the centroids of leaves
-  // Used to build a kdtree for radius search
-  PointCloudPtr voxel_centroids_ptr_;
-
   // Thread pooling, for parallel processing
   int thread_num_;
   std::vector<std::future<bool>> thread_futs_;
@@ -428,11 +455,8 @@ protected:
   // A map to convert string index to integer index, used for grids
   std::map<std::string, int> sid_to_iid_;
   // Grids of leaves are held in a vector for faster access speed
+  // A radius search only looks up the voxel hashes of the grids whose bounds overlap the query
   std::vector<GridNodePtr> grid_list_;
-  // A kdtree built from the leaves of grids
-  pcl::KdTreeFLANN<PointT> kdtree_;
-  // To access leaf by the search results by kdtree
-  std::vector<LeafConstPtr> leaf_ptrs_;
 };
 }  // namespace pclomp
 
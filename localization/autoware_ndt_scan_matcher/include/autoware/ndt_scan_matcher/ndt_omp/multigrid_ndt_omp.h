@@ -57,6 +57,7 @@
 
 // cspell:ignore multigrid, Magnusson, Thuente, Todor, Stoyanov, Okorn
 
+#include "cuda_ndt_derivatives.hpp"
 #include "multi_voxel_grid_covariance_omp.h"
 #include "ndt_struct.hpp"
 
@@ -67,7 +68,9 @@
 
 #include <pcl/registration/registration.h>
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace pclomp
@@ -175,6 +178,7 @@ public:
   inline void createVoxelKdtree()
   {
     target_cells_.createKdtree();
+    updateCudaGrids();
     target_cloud_updated_ = false;
   }
 
@@ -298,6 +302,16 @@ public:
     return ndt_result;
   }
 
+  /** \brief Align the input source from each of the initial guesses concurrently.
+   * \note Each hypothesis is aligned by a copy of this instance, which shares the read-only target
+   * grids but has its own scratch buffers, so this instance is left unchanged. The threads given by
+   * the params are split between the hypotheses aligned at once and the OpenMP loops of each of
+   * them.
+   * \param[in] initial_guesses the initial transformations of the input source
+   * \return the result of each hypothesis, in the order of the initial guesses
+   */
+  std::vector<NdtResult> alignBatch(const std::vector<Eigen::Matrix4f> & initial_guesses);
+
   /** \brief Set the transformation epsilon (maximum allowable translation squared
    * difference between two consecutive transformations) in order for an optimization to
    * be considered as having converged to the final solution. \param[in] epsilon the
@@ -331,6 +345,9 @@ public:
 
   NdtParams getParams() const { return params_; }
 
+  /** \brief Whether this was built with CUDA, otherwise params_.use_gpu is ignored. */
+  static bool isBuiltWithCuda();
+
   pcl::PointCloud<PointTarget> getVoxelPCD() const { return target_cells_.getVoxelPCD(); }
 
   std::vector<std::string> getCurrentMapIDs() const { return target_cells_.getCurrentMapIDs(); }
@@ -393,6 +410,21 @@ protected:
     const Eigen::Matrix<double, 24, 6> & point_hessian, const Eigen::Vector3d & x_trans,
     const Eigen::Matrix3d & c_inv, bool compute_hessian = true) const;
 
+  /** \brief Compute the score, gradient and hessian of the input source on the GPU, like the loop
+   * over the points of computeDerivatives.
+   * \param[in] trans_cloud transformed point cloud
+   * \param[in] compute_hessian flag to calculate hessian, unnecessary for step calculation.
+   * \param[out] result the sums over the points
+   * \return false if this was built without CUDA, the target grids are not on the GPU or a CUDA
+   * operation failed, in which case the derivatives are computed on the CPU
+   */
+  bool computeDerivativesCuda(
+    const PointCloudSource & trans_cloud, bool compute_hessian, CudaNdtDerivativesResult & result);
+
+  /** \brief Copy the grids of the target which are not on the GPU yet, and drop the removed ones.
+   */
+  void updateCudaGrids();
+
   /** \brief Precompute angular components of derivatives.
    * \note Equation 6.19 and 6.21 [Magnusson 2009].
    * \param[in] p the current transform vector
@@ -522,6 +554,30 @@ protected:
     return (g_a - mu * g_0);
   }
 
+  /** \brief Thread-wise sums and point derivatives of computeDerivatives and computeHessian.
+   * \note Each one starts on its own cache line, so that the threads do not write to the same
+   * lines.
+   */
+  struct alignas(64) ThreadDerivatives
+  {
+    ThreadDerivatives()
+    {
+      point_gradient.setZero();
+      point_gradient.block<3, 3>(0, 0).setIdentity();
+    }
+
+    double score{0.0};
+    double nearest_voxel_score{0.0};
+    size_t found_neighborhood_voxel_num{0};
+    int neighborhood_count{0};
+    Eigen::Matrix<double, 6, 1> score_gradient{Eigen::Matrix<double, 6, 1>::Zero()};
+    Eigen::Matrix<double, 6, 6> hessian{Eigen::Matrix<double, 6, 6>::Zero()};
+    Eigen::Matrix<double, 4, 6> point_gradient;
+    Eigen::Matrix<double, 24, 6> point_hessian{Eigen::Matrix<double, 24, 6>::Zero()};
+    // Reused by the points of the thread, as a search only clears it
+    std::vector<TargetGridLeafConstPtr> neighborhood;
+  };
+
   /** \brief The voxel grid generated from target cloud containing point means and covariances. */
   TargetGrid target_cells_;
 
@@ -564,6 +620,14 @@ protected:
 
   NdtParams params_;
 
+  /** \brief The target grids on the GPU, in the order of the grids of target_cells_. The grids are
+   * never modified once copied, so they are shared by the copies of this instance, like the host
+   * grids. */
+  std::vector<std::pair<typename TargetGrid::GridNodePtr, std::shared_ptr<const CudaNdtGrid>>>
+    cuda_grids_;
+  /** \brief The device buffers of the input source, not shared by the copies of this instance. */
+  std::shared_ptr<CudaNdtDerivatives> cuda_derivatives_;
+
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
@@ -96,6 +96,8 @@ struct NdtParams
   NeighborSearchMethod search_method{};
   int num_threads{};
   float regularization_scale_factor{};
+  // compute the derivatives on the GPU, which is ignored when built without CUDA
+  bool use_gpu{};
 
   // line search is false by default
   // "use_lines_search = true" is not tested well
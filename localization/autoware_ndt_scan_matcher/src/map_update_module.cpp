@@ -212,6 +212,9 @@ void MapUpdateModule::update_map(
     dummy_ptr.reset();
   }
 
+  // The copy shares the voxel grids of the target with ndt_ptr_ instead of cloning them, so its
+  // cost does not grow with the size of the map. The next update adds and removes grids in
+  // secondary_ndt_ptr_ without touching the ones used by ndt_ptr_.
   secondary_ndt_ptr_.reset(new NdtType);
   *secondary_ndt_ptr_ = *ndt_ptr_;
 
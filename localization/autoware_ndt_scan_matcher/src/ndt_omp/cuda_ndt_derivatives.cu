@@ -0,0 +1,447 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/ndt_scan_matcher/ndt_omp/cuda_ndt_derivatives.hpp"
+
+#include <cuda_runtime.h>
+#include <thrust/device_vector.h>
+#include <thrust/system_error.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace pclomp
+{
+namespace
+{
+constexpr int threads_per_block = 256;
+constexpr int warp_size = 32;
+constexpr int warps_per_block = threads_per_block / warp_size;
+// The sums are the score, the nearest voxel score, the number of points with neighbors, the number
+// of neighbors, the score gradient and the upper triangle of the hessian
+constexpr int gradient_offset = 4;
+constexpr int hessian_offset = gradient_offset + 6;
+constexpr int sum_size = hessian_offset + 21;
+
+unsigned int numBlocks(const int num_threads)
+{
+  return (num_threads + threads_per_block - 1) / threads_per_block;
+}
+
+__host__ __device__ inline int upperIndex(const int i, const int j)
+{
+  return i * 6 - i * (i - 1) / 2 + (j - i);
+}
+
+struct GridView
+{
+  const int64_t * voxel_ids;
+  const float3 * centroids;
+  const double * means;
+  const double * inverse_covariances;
+  int leaf_num;
+  int3 min_voxel;
+  int3 max_voxel;
+};
+
+__device__ inline int voxelCoordinate(const double value, const double inverse_leaf_size)
+{
+  return static_cast<int>(floor(value * inverse_leaf_size));
+}
+
+// Update the sums with a neighbor of a point, like
+// MultiGridNormalDistributionsTransform::updateDerivatives
+__device__ double updateDerivatives(
+  const double (&point_gradient)[3][6], const double (&point_hessian)[3][3][3],
+  const double (&x_trans)[3], const double * c_inv, const CudaNdtDerivativesParameters & parameters,
+  double * sums)
+{
+  double x_trans_c_inv[3];
+  for (int k = 0; k < 3; ++k) {
+    x_trans_c_inv[k] =
+      x_trans[0] * c_inv[k] + x_trans[1] * c_inv[3 + k] + x_trans[2] * c_inv[6 + k];
+  }
+  const double x_trans_c_inv_x_trans =
+    x_trans_c_inv[0] * x_trans[0] + x_trans_c_inv[1] * x_trans[1] + x_trans_c_inv[2] * x_trans[2];
+
+  // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9 [Magnusson 2009]
+  double e_x_cov_x = exp(-parameters.gauss_d2 * x_trans_c_inv_x_trans * 0.5);
+  // Calculate probability of transformed points existence, Equation 6.9 [Magnusson 2009]
+  const double score_inc = -parameters.gauss_d1 * e_x_cov_x;
+
+  e_x_cov_x = parameters.gauss_d2 * e_x_cov_x;
+
+  // Error checking for invalid values.
+  if (e_x_cov_x > 1 || e_x_cov_x < 0 || e_x_cov_x != e_x_cov_x) return 0.0;
+
+  // Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
+  e_x_cov_x *= parameters.gauss_d1;
+
+  double c_inv_point_gradient[3][6];
+  double x_trans_c_inv_point_gradient[6];
+  for (int j = 0; j < 6; ++j) {
+    for (int r = 0; r < 3; ++r) {
+      c_inv_point_gradient[r][j] = c_inv[r * 3] * point_gradient[0][j] +
+                                   c_inv[r * 3 + 1] * point_gradient[1][j] +
+                                   c_inv[r * 3 + 2] * point_gradient[2][j];
+    }
+    x_trans_c_inv_point_gradient[j] = x_trans[0] * c_inv_point_gradient[0][j] +
+                                      x_trans[1] * c_inv_point_gradient[1][j] +
+                                      x_trans[2] * c_inv_point_gradient[2][j];
+    // Update gradient, Equation 6.12 [Magnusson 2009]
+    sums[gradient_offset + j] += e_x_cov_x * x_trans_c_inv_point_gradient[j];
+  }
+
+  if (parameters.compute_hessian) {
+    // Update hessian, Equation 6.13 [Magnusson 2009]
+    for (int i = 0; i < 6; ++i) {
+      for (int j = i; j < 6; ++j) {
+        double hessian_ij =
+          -parameters.gauss_d2 * x_trans_c_inv_point_gradient[i] * x_trans_c_inv_point_gradient[j] +
+          point_gradient[0][j] * c_inv_point_gradient[0][i] +
+          point_gradient[1][j] * c_inv_point_gradient[1][i] +
+          point_gradient[2][j] * c_inv_point_gradient[2][i];
+        if (i >= 3) {
+          const double(&h)[3] = point_hessian[i - 3][j - 3];
+          hessian_ij +=
+            x_trans_c_inv[0] * h[0] + x_trans_c_inv[1] * h[1] + x_trans_c_inv[2] * h[2];
+        }
+        sums[hessian_offset + upperIndex(i, j)] += e_x_cov_x * hessian_ij;
+      }
+    }
+  }
+
+  return score_inc;
+}
+
+// Search the neighbors of a point like MultiVoxelGridCovariance::radiusSearch, and update the sums
+// with them like MultiGridNormalDistributionsTransform::computeDerivatives
+__device__ void accumulatePoint(
+  const float3 point, const float3 transformed_point, const GridView * grids, const int num_grids,
+  const CudaNdtDerivativesParameters & parameters, double * sums)
+{
+  const double query[3] = {transformed_point.x, transformed_point.y, transformed_point.z};
+  if (!isfinite(query[0]) || !isfinite(query[1]) || !isfinite(query[2])) return;
+
+  int min_voxel[3];
+  int max_voxel[3];
+  for (int axis = 0; axis < 3; ++axis) {
+    min_voxel[axis] =
+      voxelCoordinate(query[axis] - parameters.radius, parameters.inverse_leaf_size[axis]);
+    max_voxel[axis] =
+      voxelCoordinate(query[axis] + parameters.radius, parameters.inverse_leaf_size[axis]);
+  }
+  const double sqr_radius = parameters.radius * parameters.radius;
+
+  // Compute derivative of transform function w.r.t. transform vector, J_E and H_E in
+  // Equations 6.18 and 6.20 [Magnusson 2009]
+  const double x[3] = {point.x, point.y, point.z};
+  double x_j_ang[8];
+  for (int k = 0; k < 8; ++k) {
+    x_j_ang[k] =
+      parameters.j_ang[k][0] * x[0] + parameters.j_ang[k][1] * x[1] + parameters.j_ang[k][2] * x[2];
+  }
+  const double point_gradient[3][6] = {
+    {1.0, 0.0, 0.0, 0.0, x_j_ang[2], x_j_ang[5]},
+    {0.0, 1.0, 0.0, x_j_ang[0], x_j_ang[3], x_j_ang[6]},
+    {0.0, 0.0, 1.0, x_j_ang[1], x_j_ang[4], x_j_ang[7]}};
+
+  // Vectors a to f from Equation 6.21 [Magnusson 2009], at the rows and columns 3 to 5
+  double point_hessian[3][3][3] = {};
+  if (parameters.compute_hessian) {
+    double x_h_ang[15];
+    for (int k = 0; k < 15; ++k) {
+      x_h_ang[k] = parameters.h_ang[k][0] * x[0] + parameters.h_ang[k][1] * x[1] +
+                   parameters.h_ang[k][2] * x[2];
+    }
+    const double vectors[6][3] = {
+      {0.0, x_h_ang[0], x_h_ang[1]},         {0.0, x_h_ang[2], x_h_ang[3]},
+      {0.0, x_h_ang[4], x_h_ang[5]},         {x_h_ang[6], x_h_ang[7], x_h_ang[8]},
+      {x_h_ang[9], x_h_ang[10], x_h_ang[11]}, {x_h_ang[12], x_h_ang[13], x_h_ang[14]}};
+    const int vector_indices[3][3] = {{0, 1, 2}, {1, 3, 4}, {2, 4, 5}};
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        for (int k = 0; k < 3; ++k) {
+          point_hessian[i][j][k] = vectors[vector_indices[i][j]][k];
+        }
+      }
+    }
+  }
+
+  double sum_score_pt = 0.0;
+  double nearest_voxel_score_pt = 0.0;
+  int neighborhood_count = 0;
+
+  for (int g = 0; g < num_grids; ++g) {
+    const GridView & grid = grids[g];
+    if (
+      grid.leaf_num == 0 || min_voxel[0] > grid.max_voxel.x || min_voxel[1] > grid.max_voxel.y ||
+      min_voxel[2] > grid.max_voxel.z || max_voxel[0] < grid.min_voxel.x ||
+      max_voxel[1] < grid.min_voxel.y || max_voxel[2] < grid.min_voxel.z) {
+      continue;
+    }
+
+    const int begin[3] = {
+      max(min_voxel[0], grid.min_voxel.x), max(min_voxel[1], grid.min_voxel.y),
+      max(min_voxel[2], grid.min_voxel.z)};
+    const int end[3] = {
+      min(max_voxel[0], grid.max_voxel.x), min(max_voxel[1], grid.max_voxel.y),
+      min(max_voxel[2], grid.max_voxel.z)};
+    const int64_t x_num = grid.max_voxel.x - grid.min_voxel.x + 1;
+    const int64_t xy_num = x_num * (grid.max_voxel.y - grid.min_voxel.y + 1);
+
+    for (int vz = begin[2]; vz <= end[2]; ++vz) {
+      for (int vy = begin[1]; vy <= end[1]; ++vy) {
+        for (int vx = begin[0]; vx <= end[0]; ++vx) {
+          const int64_t voxel_id = (vx - grid.min_voxel.x) + (vy - grid.min_voxel.y) * x_num +
+                                   (vz - grid.min_voxel.z) * xy_num;
+
+          // The first leaf of the voxel
+          int lower = 0;
+          int upper = grid.leaf_num;
+          while (lower < upper) {
+            const int middle = (lower + upper) / 2;
+            if (grid.voxel_ids[middle] < voxel_id) {
+              lower = middle + 1;
+            } else {
+              upper = middle;
+            }
+          }
+
+          for (int i = lower; i < grid.leaf_num && grid.voxel_ids[i] == voxel_id; ++i) {
+            const float3 centroid = grid.centroids[i];
+            const double dx = static_cast<double>(centroid.x) - query[0];
+            const double dy = static_cast<double>(centroid.y) - query[1];
+            const double dz = static_cast<double>(centroid.z) - query[2];
+            if (dx * dx + dy * dy + dz * dz > sqr_radius) continue;
+
+            const double * mean = grid.means + 3 * i;
+            const double x_trans[3] = {query[0] - mean[0], query[1] - mean[1], query[2] - mean[2]};
+            const double score_pt = updateDerivatives(
+              point_gradient, point_hessian, x_trans, grid.inverse_covariances + 9 * i,
+              parameters, sums);
+            sum_score_pt += score_pt;
+            nearest_voxel_score_pt = max(nearest_voxel_score_pt, score_pt);
+            ++neighborhood_count;
+          }
+        }
+      }
+    }
+  }
+
+  if (neighborhood_count == 0) return;
+
+  sums[0] += sum_score_pt;
+  sums[1] += nearest_voxel_score_pt;
+  sums[2] += 1.0;
+  sums[3] += neighborhood_count;
+}
+
+__global__ void computeDerivativesKernel(
+  const float3 * points, const float3 * transformed_points, const int num_points,
+  const GridView * grids, const int num_grids, const CudaNdtDerivativesParameters parameters,
+  double * block_sums)
+{
+  double sums[sum_size];
+  for (int k = 0; k < sum_size; ++k) {
+    sums[k] = 0.0;
+  }
+
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < num_points) {
+    accumulatePoint(points[i], transformed_points[i], grids, num_grids, parameters, sums);
+  }
+
+  // Reduce within each warp and then over the warps in order, so that the result does not depend
+  // on the scheduling
+  __shared__ double warp_sums[warps_per_block][sum_size];
+  const int lane = threadIdx.x % warp_size;
+  const int warp = threadIdx.x / warp_size;
+  for (int k = 0; k < sum_size; ++k) {
+    double sum = sums[k];
+    for (int offset = warp_size / 2; offset > 0; offset /= 2) {
+      sum += __shfl_down_sync(0xffffffff, sum, offset);
+    }
+    if (lane == 0) warp_sums[warp][k] = sum;
+  }
+  __syncthreads();
+
+  if (threadIdx.x < sum_size) {
+    double sum = 0.0;
+    for (int w = 0; w < warps_per_block; ++w) {
+      sum += warp_sums[w][threadIdx.x];
+    }
+    block_sums[blockIdx.x * sum_size + threadIdx.x] = sum;
+  }
+}
+}  // namespace
+
+struct CudaNdtGrid::DeviceBuffers
+{
+  thrust::device_vector<int64_t> voxel_ids;
+  thrust::device_vector<float3> centroids;
+  thrust::device_vector<double> means;
+  thrust::device_vector<double> inverse_covariances;
+  GridView view{};
+};
+
+CudaNdtGrid::CudaNdtGrid() : buffers_(std::make_unique<DeviceBuffers>())
+{
+}
+
+CudaNdtGrid::~CudaNdtGrid() = default;
+
+std::shared_ptr<const CudaNdtGrid> CudaNdtGrid::create(
+  const std::vector<int64_t> & voxel_ids, const std::vector<float> & centroids,
+  const std::vector<double> & means, const std::vector<double> & inverse_covariances,
+  const std::array<int, 3> & min_voxel, const std::array<int, 3> & max_voxel)
+{
+  std::shared_ptr<CudaNdtGrid> grid(new CudaNdtGrid);
+  auto & b = *grid->buffers_;
+  const int leaf_num = static_cast<int>(voxel_ids.size());
+
+  try {
+    b.voxel_ids = voxel_ids;
+    b.centroids.resize(leaf_num);
+    b.means = means;
+    b.inverse_covariances = inverse_covariances;
+    if (
+      cudaMemcpy(
+        thrust::raw_pointer_cast(b.centroids.data()), centroids.data(), leaf_num * sizeof(float3),
+        cudaMemcpyHostToDevice) != cudaSuccess) {
+      return nullptr;
+    }
+  } catch (const thrust::system_error &) {
+    return nullptr;
+  }
+
+  if (cudaGetLastError() != cudaSuccess) {
+    return nullptr;
+  }
+
+  b.view.voxel_ids = thrust::raw_pointer_cast(b.voxel_ids.data());
+  b.view.centroids = thrust::raw_pointer_cast(b.centroids.data());
+  b.view.means = thrust::raw_pointer_cast(b.means.data());
+  b.view.inverse_covariances = thrust::raw_pointer_cast(b.inverse_covariances.data());
+  b.view.leaf_num = leaf_num;
+  b.view.min_voxel = make_int3(min_voxel[0], min_voxel[1], min_voxel[2]);
+  b.view.max_voxel = make_int3(max_voxel[0], max_voxel[1], max_voxel[2]);
+  return grid;
+}
+
+struct CudaNdtDerivatives::DeviceBuffers
+{
+  cudaStream_t stream{nullptr};
+  // reused for the next iterations, as device_vector only reallocates to grow
+  thrust::device_vector<float3> points;
+  thrust::device_vector<float3> transformed_points;
+  thrust::device_vector<GridView> grids;
+  thrust::device_vector<double> block_sums;
+};
+
+CudaNdtDerivatives::CudaNdtDerivatives() : buffers_(std::make_unique<DeviceBuffers>())
+{
+  if (cudaStreamCreateWithFlags(&buffers_->stream, cudaStreamNonBlocking) != cudaSuccess) {
+    buffers_->stream = nullptr;
+  }
+}
+
+CudaNdtDerivatives::~CudaNdtDerivatives()
+{
+  if (buffers_->stream) {
+    cudaStreamDestroy(buffers_->stream);
+  }
+}
+
+bool CudaNdtDerivatives::compute(
+  const std::vector<std::shared_ptr<const CudaNdtGrid>> & grids,
+  const std::vector<float> & points, const std::vector<float> & transformed_points,
+  const CudaNdtDerivativesParameters & parameters, CudaNdtDerivativesResult & result)
+{
+  result = CudaNdtDerivativesResult{};
+  const int num_points = static_cast<int>(points.size() / 3);
+  if (num_points == 0) {
+    return true;
+  }
+
+  std::vector<GridView> grid_views;
+  grid_views.reserve(grids.size());
+  for (const auto & grid : grids) {
+    grid_views.push_back(grid->getDeviceBuffers().view);
+  }
+  const int num_grids = static_cast<int>(grid_views.size());
+
+  auto & b = *buffers_;
+  const auto stream = b.stream;
+  const unsigned int num_blocks = numBlocks(num_points);
+  std::vector<double> block_sums(num_blocks * sum_size);
+  try {
+    b.points.resize(num_points);
+    b.transformed_points.resize(num_points);
+    b.grids.resize(std::max(num_grids, 1));
+    b.block_sums.resize(block_sums.size());
+    auto * points_d = thrust::raw_pointer_cast(b.points.data());
+    auto * transformed_points_d = thrust::raw_pointer_cast(b.transformed_points.data());
+    auto * grids_d = thrust::raw_pointer_cast(b.grids.data());
+    auto * block_sums_d = thrust::raw_pointer_cast(b.block_sums.data());
+    cudaMemcpyAsync(
+      points_d, points.data(), num_points * sizeof(float3), cudaMemcpyHostToDevice, stream);
+    cudaMemcpyAsync(
+      transformed_points_d, transformed_points.data(), num_points * sizeof(float3),
+      cudaMemcpyHostToDevice, stream);
+    cudaMemcpyAsync(
+      grids_d, grid_views.data(), num_grids * sizeof(GridView), cudaMemcpyHostToDevice, stream);
+
+    computeDerivativesKernel<<<num_blocks, threads_per_block, 0, stream>>>(
+      points_d, transformed_points_d, num_points, grids_d, num_grids, parameters, block_sums_d);
+
+    cudaMemcpyAsync(
+      block_sums.data(), block_sums_d, block_sums.size() * sizeof(double), cudaMemcpyDeviceToHost,
+      stream);
+    cudaStreamSynchronize(stream);
+  } catch (const thrust::system_error &) {
+    return false;
+  }
+
+  if (cudaGetLastError() != cudaSuccess) {
+    return false;
+  }
+
+  // Sum the blocks in order
+  double sums[sum_size] = {};
+  for (unsigned int block = 0; block < num_blocks; ++block) {
+    for (int k = 0; k < sum_size; ++k) {
+      sums[k] += block_sums[block * sum_size + k];
+    }
+  }
+
+  result.score = sums[0];
+  result.nearest_voxel_score = sums[1];
+  result.found_neighborhood_voxel_num = static_cast<size_t>(sums[2]);
+  result.total_neighborhood_count = static_cast<int>(sums[3]);
+  for (int i = 0; i < 6; ++i) {
+    result.score_gradient[i] = sums[gradient_offset + i];
+    for (int j = i; j < 6; ++j) {
+      const double hessian_ij = sums[hessian_offset + upperIndex(i, j)];
+      result.hessian[i * 6 + j] = hessian_ij;
+      result.hessian[j * 6 + i] = hessian_ij;
+    }
+  }
+  return true;
+}
+
+}  // namespace pclomp
@@ -38,14 +38,9 @@ ResultOfMultiNdtCovarianceEstimation estimate_xy_covariance_by_multi_ndt(
   const Eigen::Vector2d ndt_pose_2d(ndt_result.pose(0, 3), ndt_result.pose(1, 3));
   std::vector<Eigen::Vector2d> ndt_pose_2d_vec{ndt_pose_2d};
 
-  // multiple searches
-  std::vector<NdtResult> ndt_results;
-  for (const Eigen::Matrix4f & curr_pose : poses_to_search) {
-    auto sub_output_cloud = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
-    ndt_ptr->align(*sub_output_cloud, curr_pose);
-    const NdtResult sub_ndt_result = ndt_ptr->getResult();
-    ndt_results.push_back(sub_ndt_result);
-
+  // multiple searches, run concurrently
+  const std::vector<NdtResult> ndt_results = ndt_ptr->alignBatch(poses_to_search);
+  for (const NdtResult & sub_ndt_result : ndt_results) {
     const Eigen::Matrix4f sub_ndt_pose = sub_ndt_result.pose;
     const Eigen::Vector2d sub_ndt_pose_2d = sub_ndt_pose.topRightCorner<2, 1>().cast<double>();
     ndt_pose_2d_vec.emplace_back(sub_ndt_pose_2d);
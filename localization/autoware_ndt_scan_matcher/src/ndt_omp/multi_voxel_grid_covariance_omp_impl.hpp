@@ -59,8 +59,11 @@
 #include <pcl/common/common.h>
 #include <pcl/filters/boost.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -72,20 +75,11 @@ template <typename PointT>
 MultiVoxelGridCovariance<PointT>::MultiVoxelGridCovariance(const MultiVoxelGridCovariance & other)
 : pcl::VoxelGrid<PointT>(other),
   sid_to_iid_(other.sid_to_iid_),
-  grid_list_(other.grid_list_),
-  kdtree_(other.kdtree_),
-  leaf_ptrs_(other.leaf_ptrs_)
+  grid_list_(other.grid_list_)
 {
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
 
-  // Deep copy
-  voxel_centroids_ptr_.reset(new PointCloud);
-
-  if (other.voxel_centroids_ptr_) {
-    *voxel_centroids_ptr_ = *other.voxel_centroids_ptr_;
-  }
-
   setThreadNum(other.thread_num_);
   last_check_tid_ = -1;
 }
@@ -94,11 +88,8 @@ template <typename PointT>
 MultiVoxelGridCovariance<PointT>::MultiVoxelGridCovariance(
   MultiVoxelGridCovariance && other) noexcept
 : pcl::VoxelGrid<PointT>(std::move(other)),
-  voxel_centroids_ptr_(std::move(other.voxel_centroids_ptr_)),
   sid_to_iid_(std::move(other.sid_to_iid_)),
-  grid_list_(std::move(other.grid_list_)),
-  kdtree_(std::move(other.kdtree_)),
-  leaf_ptrs_(std::move(other.leaf_ptrs_))
+  grid_list_(std::move(other.grid_list_))
 {
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
@@ -112,21 +103,11 @@ MultiVoxelGridCovariance<PointT> & pclomp::MultiVoxelGridCovariance<PointT>::ope
   const MultiVoxelGridCovariance & other)
 {
   pcl::VoxelGrid<PointT>::operator=(other);
-  voxel_centroids_ptr_ = other.voxel_centroids_ptr_;
   sid_to_iid_ = other.sid_to_iid_;
   grid_list_ = other.grid_list_;
-  kdtree_ = other.kdtree_;
-  leaf_ptrs_ = other.leaf_ptrs_;
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
 
-  // Deep copy
-  voxel_centroids_ptr_.reset(new PointCloud);
-
-  if (other.voxel_centroids_ptr_) {
-    *voxel_centroids_ptr_ = *other.voxel_centroids_ptr_;
-  }
-
   setThreadNum(other.thread_num_);
   last_check_tid_ = -1;
 
@@ -137,11 +118,8 @@ template <typename PointT>
 MultiVoxelGridCovariance<PointT> & pclomp::MultiVoxelGridCovariance<PointT>::operator=(
   MultiVoxelGridCovariance && other) noexcept
 {
-  voxel_centroids_ptr_ = std::move(other.voxel_centroids_ptr_);
   sid_to_iid_ = std::move(other.sid_to_iid_);
   grid_list_ = std::move(other.grid_list_);
-  kdtree_ = std::move(other.kdtree_);
-  leaf_ptrs_ = std::move(other.leaf_ptrs_);
 
   min_points_per_voxel_ = other.min_points_per_voxel_;
   min_covar_eigvalue_mult_ = other.min_covar_eigvalue_mult_;
@@ -201,45 +179,20 @@ void MultiVoxelGridCovariance<PointT>::createKdtree()
   sync();
 
   // Rebuild the grid_list_ and sid_to_iid_ to delete the data related to the removed clouds
+  // The voxel index of each grid was built along with the grid, so nothing else is rebuilt
   const int new_grid_num = sid_to_iid_.size();
   std::vector<GridNodePtr> new_grid_list(new_grid_num);
   int new_pos = 0;
-  int total_leaf_num = 0;
 
   for (auto & it : sid_to_iid_) {
     int & old_pos = it.second;
-    auto & grid_ptr = grid_list_[old_pos];
 
-    new_grid_list[new_pos] = grid_ptr;
+    new_grid_list[new_pos] = grid_list_[old_pos];
     old_pos = new_pos;
     ++new_pos;
-    total_leaf_num = grid_ptr->size();
   }
 
   grid_list_ = std::move(new_grid_list);
-
-  // Rebuild the voxel_centroids_ptr_
-  voxel_centroids_ptr_.reset(new PointCloud);
-  voxel_centroids_ptr_->reserve(total_leaf_num);
-  leaf_ptrs_.clear();
-  leaf_ptrs_.reserve(total_leaf_num);
-
-  for (const auto & grid_ptr : grid_list_) {
-    for (const auto & leaf : *grid_ptr) {
-      PointT new_leaf;
-
-      new_leaf.x = leaf.centroid_[0];
-      new_leaf.y = leaf.centroid_[1];
-      new_leaf.z = leaf.centroid_[2];
-      voxel_centroids_ptr_->push_back(new_leaf);
-      leaf_ptrs_.push_back(&leaf);
-    }
-  }
-
-  // Rebuild the kdtree_ of leaves
-  if (voxel_centroids_ptr_->size() > 0) {
-    kdtree_.setInputCloud(voxel_centroids_ptr_);
-  }
 }
 
 template <typename PointT>
@@ -249,19 +202,68 @@ int MultiVoxelGridCovariance<PointT>::radiusSearch(
 {
   k_leaves.clear();
 
-  // Search from the kdtree to find neighbors of @point
-  std::vector<float> k_sqr_distances;
-  std::vector<int> k_indices;
-  const int k = kdtree_.radiusSearch(point, radius, k_indices, k_sqr_distances, max_nn);
-
-  if (k <= 0) {
+  if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z)) {
     return 0;
   }
 
-  k_leaves.reserve(k);
+  // The voxels which may contain the centroid of a leaf within the radius
+  const Eigen::Vector3d query(point.x, point.y, point.z);
+  Eigen::Vector3i min_voxel;
+  Eigen::Vector3i max_voxel;
+  for (int axis = 0; axis < 3; ++axis) {
+    min_voxel[axis] = getVoxelCoordinate(query[axis] - radius, axis);
+    max_voxel[axis] = getVoxelCoordinate(query[axis] + radius, axis);
+  }
+  const double sqr_radius = radius * radius;
+
+  const auto sqr_distance = [&query](const Leaf & leaf) {
+    return (leaf.centroid_.template head<3>().template cast<double>() - query).squaredNorm();
+  };
+
+  for (const auto & grid_ptr : grid_list_) {
+    const GridNodeType & grid = *grid_ptr;
+
+    if (
+      grid.leaves.empty() || (min_voxel.array() > grid.max_voxel.array()).any() ||
+      (max_voxel.array() < grid.min_voxel.array()).any()) {
+      continue;
+    }
 
-  for (auto & nn_idx : k_indices) {
-    k_leaves.push_back(leaf_ptrs_[nn_idx]);
+    const Eigen::Vector3i begin = min_voxel.cwiseMax(grid.min_voxel);
+    const Eigen::Vector3i end = max_voxel.cwiseMin(grid.max_voxel);
+    const int64_t x_num = grid.max_voxel[0] - grid.min_voxel[0] + 1;
+    const int64_t xy_num = x_num * (grid.max_voxel[1] - grid.min_voxel[1] + 1);
+
+    for (int z = begin[2]; z <= end[2]; ++z) {
+      for (int y = begin[1]; y <= end[1]; ++y) {
+        for (int x = begin[0]; x <= end[0]; ++x) {
+          const int64_t voxel_id = (x - grid.min_voxel[0]) + (y - grid.min_voxel[1]) * x_num +
+                                   (z - grid.min_voxel[2]) * xy_num;
+          const auto it = grid.voxel_to_leaf.find(voxel_id);
+
+          if (it == grid.voxel_to_leaf.end()) {
+            continue;
+          }
+
+          for (size_t i = it->second;
+               i < grid.leaf_voxel_ids.size() && grid.leaf_voxel_ids[i] == voxel_id; ++i) {
+            if (sqr_distance(grid.leaves[i]) <= sqr_radius) {
+              k_leaves.push_back(&grid.leaves[i]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Keep the max_nn nearest leaves
+  if (max_nn > 0 && k_leaves.size() > max_nn) {
+    std::nth_element(
+      k_leaves.begin(), k_leaves.begin() + max_nn, k_leaves.end(),
+      [&sqr_distance](const LeafConstPtr & a, const LeafConstPtr & b) {
+        return sqr_distance(*a) < sqr_distance(*b);
+      });
+    k_leaves.resize(max_nn);
   }
 
   return k_leaves.size();
@@ -283,7 +285,20 @@ template <typename PointT>
 typename MultiVoxelGridCovariance<PointT>::PointCloud
 MultiVoxelGridCovariance<PointT>::getVoxelPCD() const
 {
-  return *voxel_centroids_ptr_;
+  PointCloud voxel_centroids;
+
+  for (const auto & grid_ptr : grid_list_) {
+    for (const auto & leaf : grid_ptr->leaves) {
+      PointT centroid;
+
+      centroid.x = leaf.centroid_[0];
+      centroid.y = leaf.centroid_[1];
+      centroid.z = leaf.centroid_[2];
+      voxel_centroids.push_back(centroid);
+    }
+  }
+
+  return voxel_centroids;
 }
 
 template <typename PointT>
@@ -342,7 +357,7 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
   div_b[3] = 0;
 
   // Clear the leaves
-  node.clear();
+  node = GridNodeType();
 
   // Set up the division multiplier
   bbox.div_mul = Eigen::Vector4i(1, div_b[0], div_b[0] * div_b[1], 0);
@@ -367,7 +382,7 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
   Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eigensolver;
   Eigen::Vector3d pt_sum;
 
-  node.reserve(map_leaves.size());
+  node.leaves.reserve(map_leaves.size());
 
   // Eigen values less than a threshold of max eigen value are inflated to a set fraction of the max
   // eigen value.
@@ -378,10 +393,10 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
     }
 
     // Append qualified leaves to the end of the output vector
-    node.push_back(it.second);
+    node.leaves.push_back(it.second);
 
     // Normalize the centroid
-    Leaf & leaf = node.back();
+    Leaf & leaf = node.leaves.back();
 
     // Normalize the centroid
     leaf.centroid_ /= static_cast<float>(leaf.nr_points_);
@@ -392,6 +407,8 @@ void MultiVoxelGridCovariance<PointT>::apply_filter(
     // Compute covariance matrices
     computeLeafParams(pt_sum, eigensolver, leaf);
   }
+
+  buildVoxelIndex(node);
 }
 
 template <typename PointT>
@@ -408,6 +425,60 @@ int64_t pclomp::MultiVoxelGridCovariance<PointT>::getLeafID(
   return ijk0 * bbox.div_mul[0] + ijk1 * bbox.div_mul[1] + ijk2 * bbox.div_mul[2];
 }
 
+template <typename PointT>
+void pclomp::MultiVoxelGridCovariance<PointT>::buildVoxelIndex(GridNodeType & node) const
+{
+  if (node.leaves.empty()) {
+    return;
+  }
+
+  // The voxel of a centroid may differ from the voxel of its points by rounding, so the leaves are
+  // indexed by the voxel of their centroids, which is what radiusSearch looks up
+  std::vector<Eigen::Vector3i> voxels;
+  voxels.reserve(node.leaves.size());
+  node.min_voxel.setConstant(std::numeric_limits<int>::max());
+  node.max_voxel.setConstant(std::numeric_limits<int>::lowest());
+
+  for (const auto & leaf : node.leaves) {
+    Eigen::Vector3i voxel;
+
+    for (int axis = 0; axis < 3; ++axis) {
+      voxel[axis] = getVoxelCoordinate(leaf.centroid_[axis], axis);
+    }
+
+    node.min_voxel = node.min_voxel.cwiseMin(voxel);
+    node.max_voxel = node.max_voxel.cwiseMax(voxel);
+    voxels.push_back(voxel);
+  }
+
+  const int64_t x_num = node.max_voxel[0] - node.min_voxel[0] + 1;
+  const int64_t xy_num = x_num * (node.max_voxel[1] - node.min_voxel[1] + 1);
+  std::vector<std::pair<int64_t, int>> sorted_ids(node.leaves.size());
+
+  for (size_t i = 0; i < voxels.size(); ++i) {
+    const Eigen::Vector3i offset = voxels[i] - node.min_voxel;
+    sorted_ids[i] = {offset[0] + offset[1] * x_num + offset[2] * xy_num, static_cast<int>(i)};
+  }
+
+  std::sort(sorted_ids.begin(), sorted_ids.end());
+
+  std::vector<Leaf> sorted_leaves;
+  sorted_leaves.reserve(node.leaves.size());
+  node.leaf_voxel_ids.reserve(node.leaves.size());
+  node.voxel_to_leaf.reserve(node.leaves.size());
+
+  for (const auto & [voxel_id, leaf_index] : sorted_ids) {
+    if (node.leaf_voxel_ids.empty() || node.leaf_voxel_ids.back() != voxel_id) {
+      node.voxel_to_leaf.emplace(voxel_id, static_cast<int>(sorted_leaves.size()));
+    }
+
+    node.leaf_voxel_ids.push_back(voxel_id);
+    sorted_leaves.push_back(std::move(node.leaves[leaf_index]));
+  }
+
+  node.leaves = std::move(sorted_leaves);
+}
+
 template <typename PointT>
 void pclomp::MultiVoxelGridCovariance<PointT>::updateLeaf(
   const PointT & point, const int & centroid_size, Leaf & leaf) const
@@ -60,6 +60,8 @@
 #include "autoware/ndt_scan_matcher/ndt_omp/multigrid_ndt_omp.h"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <utility>
 #include <vector>
 
@@ -89,6 +91,9 @@ MultiGridNormalDistributionsTransform<PointSource, PointTarget>::
 
   regularization_pose_ = other.regularization_pose_;
   regularization_pose_translation_ = other.regularization_pose_translation_;
+
+  // The device buffers of the input source are allocated again on the first use
+  cuda_grids_ = other.cuda_grids_;
 }
 
 template <typename PointSource, typename PointTarget>
@@ -113,6 +118,9 @@ MultiGridNormalDistributionsTransform<PointSource, PointTarget>::
 
   regularization_pose_ = other.regularization_pose_;
   regularization_pose_translation_ = other.regularization_pose_translation_;
+
+  cuda_grids_ = std::move(other.cuda_grids_);
+  cuda_derivatives_ = std::move(other.cuda_derivatives_);
 }
 
 template <typename PointSource, typename PointTarget>
@@ -139,6 +147,8 @@ MultiGridNormalDistributionsTransform<PointSource, PointTarget>::operator=(
   regularization_pose_ = other.regularization_pose_;
   regularization_pose_translation_ = other.regularization_pose_translation_;
 
+  cuda_grids_ = other.cuda_grids_;
+
   BaseRegType::operator=(other);
 
   return *this;
@@ -168,6 +178,9 @@ MultiGridNormalDistributionsTransform<PointSource, PointTarget>::operator=(
   regularization_pose_ = other.regularization_pose_;
   regularization_pose_translation_ = other.regularization_pose_translation_;
 
+  cuda_grids_ = std::move(other.cuda_grids_);
+  cuda_derivatives_ = std::move(other.cuda_derivatives_);
+
   BaseRegType::operator=(std::move(other));
 
   return *this;
@@ -204,6 +217,50 @@ MultiGridNormalDistributionsTransform<
   gauss_d2_ = -2 * log((-log(gauss_c1 * exp(-0.5) + gauss_c2) - gauss_d3_) / gauss_d1_);
 }
 
+template <typename PointSource, typename PointTarget>
+std::vector<NdtResult>
+MultiGridNormalDistributionsTransform<PointSource, PointTarget>::alignBatch(
+  const std::vector<Eigen::Matrix4f> & initial_guesses)
+{
+  std::vector<NdtResult> results(initial_guesses.size());
+
+  // Set up the indices of the input source once, so that the copies only read them
+  if (initial_guesses.empty() || !BaseRegType::initCompute()) {
+    return results;
+  }
+
+  const int hypothesis_num = static_cast<int>(initial_guesses.size());
+  const int worker_num = std::max(1, std::min(params_.num_threads, hypothesis_num));
+  const int worker_thread_num = std::max(1, params_.num_threads / worker_num);
+  std::atomic<int> next_hypothesis(0);
+
+  const auto align_hypotheses = [&]() {
+    MultiGridNormalDistributionsTransform ndt(*this);
+    ndt.params_.num_threads = worker_thread_num;
+    PointCloudSource output;
+
+    for (int i = next_hypothesis++; i < hypothesis_num; i = next_hypothesis++) {
+      ndt.align(output, initial_guesses[i]);
+      results[i] = ndt.getResult();
+    }
+  };
+
+  // The workers are plain threads rather than an OpenMP team, so the OpenMP loops of each alignment
+  // are not nested in a parallel region and get worker_thread_num threads
+  std::vector<std::future<void>> worker_futs;
+  worker_futs.reserve(worker_num - 1);
+  for (int i = 1; i < worker_num; ++i) {
+    worker_futs.push_back(std::async(std::launch::async, align_hypotheses));
+  }
+  align_hypotheses();
+
+  for (auto & fut : worker_futs) {
+    fut.get();
+  }
+
+  return results;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template <typename PointSource, typename PointTarget>
 void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeTransformation(
@@ -351,99 +408,87 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeD
   double nearest_voxel_score = 0;
   size_t found_neighborhood_voxel_num = 0;
 
-  std::vector<double> scores(params_.num_threads);
-  std::vector<double> nearest_voxel_scores(params_.num_threads);
-  std::vector<size_t> found_neighborhood_voxel_nums(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 6, 1>, Eigen::aligned_allocator<Eigen::Matrix<double, 6, 1>>>
-    score_gradients(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 6, 6>, Eigen::aligned_allocator<Eigen::Matrix<double, 6, 6>>>
-    hessians(params_.num_threads);
-  std::vector<int> neighborhood_counts(params_.num_threads);
-
-  // Pre-allocate thread-wise point derivative matrices to avoid reallocate too many times
-  std::vector<Eigen::Matrix<double, 4, 6>> t_point_gradients(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 24, 6>> t_point_hessians(params_.num_threads);
-
-  for (int i = 0; i < params_.num_threads; ++i) {
-    scores[i] = 0;
-    nearest_voxel_scores[i] = 0;
-    found_neighborhood_voxel_nums[i] = 0;
-    score_gradients[i].setZero();
-    hessians[i].setZero();
-    neighborhood_counts[i] = 0;
-
-    // Initialize point derivatives
-    t_point_gradients[i].setZero();
-    t_point_gradients[i].block<3, 3>(0, 0).setIdentity();
-    t_point_hessians[i].setZero();
-  }
+  // Pre-allocate thread-wise sums and point derivative matrices to avoid reallocate too many times
+  std::vector<ThreadDerivatives> thread_derivatives(params_.num_threads);
 
   // Precompute Angular Derivatives (eq. 6.19 and 6.21)[Magnusson 2009]
   computeAngleDerivatives(p);
 
-  // Update gradient and hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
+  CudaNdtDerivativesResult cuda_result{};
+  if (params_.use_gpu && computeDerivativesCuda(trans_cloud, compute_hessian, cuda_result)) {
+    // Put the sums in the ones of the first thread, so that the reduction below is shared
+    auto & t = thread_derivatives[0];
+    t.score = cuda_result.score;
+    t.nearest_voxel_score = cuda_result.nearest_voxel_score;
+    t.found_neighborhood_voxel_num = cuda_result.found_neighborhood_voxel_num;
+    t.score_gradient = Eigen::Map<const Eigen::Matrix<double, 6, 1>>(cuda_result.score_gradient);
+    t.hessian = Eigen::Map<const Eigen::Matrix<double, 6, 6, Eigen::RowMajor>>(cuda_result.hessian);
+    t.neighborhood_count = cuda_result.total_neighborhood_count;
+  } else {
+    // Update gradient and hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
 #pragma omp parallel for num_threads(params_.num_threads) schedule(guided, 8)
-  for (size_t idx = 0; idx < input_->size(); ++idx) {
-    int tid = omp_get_thread_num();
-    // Searching for neighbors of the current transformed point
-    auto & x_trans_pt = trans_cloud[idx];
-    std::vector<TargetGridLeafConstPtr> neighborhood;
-
-    // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
-    target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
-
-    if (neighborhood.empty()) {
-      continue;
-    }
+    for (size_t idx = 0; idx < input_->size(); ++idx) {
+      auto & t = thread_derivatives[omp_get_thread_num()];
+      // Searching for neighbors of the current transformed point
+      auto & x_trans_pt = trans_cloud[idx];
+      auto & neighborhood = t.neighborhood;
 
-    // Original Point
-    auto & x_pt = (*input_)[idx];
-    // Original Point and Transformed Point (for math)
-    Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
-    // Current Point Gradient and Hessian
-    auto & point_gradient = t_point_gradients[tid];
-    auto & point_hessian = t_point_hessians[tid];
+      // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
+      target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
 
-    // Compute derivative of transform function w.r.t. transform vector, J_E and H_E in
-    // Equations 6.18 and 6.20 [Magnusson 2009]
-    computePointDerivatives(x, point_gradient, point_hessian);
+      if (neighborhood.empty()) {
+        continue;
+      }
 
-    // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009]
-    const Eigen::Vector3d x_trans(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
+      // Original Point
+      auto & x_pt = (*input_)[idx];
+      // Original Point and Transformed Point (for math)
+      Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
+      // Current Point Gradient and Hessian
+      auto & point_gradient = t.point_gradient;
+      auto & point_hessian = t.point_hessian;
 
-    double sum_score_pt = 0;
-    double nearest_voxel_score_pt = 0;
-    auto & score_gradient_pt = score_gradients[tid];
-    auto & hessian_pt = hessians[tid];
+      // Compute derivative of transform function w.r.t. transform vector, J_E and H_E in
+      // Equations 6.18 and 6.20 [Magnusson 2009]
+      computePointDerivatives(x, point_gradient, point_hessian);
 
-    for (auto & cell : neighborhood) {
-      // Update score, gradient and hessian, lines 19-21 in Algorithm 2, according to
-      // Equations 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
-      double score_pt = updateDerivatives(
-        score_gradient_pt, hessian_pt, point_gradient, point_hessian, x_trans - cell->getMean(),
-        cell->getInverseCov(), compute_hessian);
-      sum_score_pt += score_pt;
-
-      if (score_pt > nearest_voxel_score_pt) {
-        nearest_voxel_score_pt = score_pt;
+      // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009]
+      const Eigen::Vector3d x_trans(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
+
+      double sum_score_pt = 0;
+      double nearest_voxel_score_pt = 0;
+      auto & score_gradient_pt = t.score_gradient;
+      auto & hessian_pt = t.hessian;
+
+      for (auto & cell : neighborhood) {
+        // Update score, gradient and hessian, lines 19-21 in Algorithm 2, according to
+        // Equations 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
+        double score_pt = updateDerivatives(
+          score_gradient_pt, hessian_pt, point_gradient, point_hessian, x_trans - cell->getMean(),
+          cell->getInverseCov(), compute_hessian);
+        sum_score_pt += score_pt;
+
+        if (score_pt > nearest_voxel_score_pt) {
+          nearest_voxel_score_pt = score_pt;
+        }
       }
-    }
 
-    ++found_neighborhood_voxel_nums[tid];
+      ++t.found_neighborhood_voxel_num;
 
-    scores[tid] += sum_score_pt;
-    nearest_voxel_scores[tid] += nearest_voxel_score_pt;
-    neighborhood_counts[tid] += neighborhood.size();
+      t.score += sum_score_pt;
+      t.nearest_voxel_score += nearest_voxel_score_pt;
+      t.neighborhood_count += neighborhood.size();
+    }
   }
 
   // Ensure that the result is invariant against the summing up order
-  for (int i = 0; i < params_.num_threads; ++i) {
-    score += scores[i];
-    nearest_voxel_score += nearest_voxel_scores[i];
-    found_neighborhood_voxel_num += found_neighborhood_voxel_nums[i];
-    score_gradient += score_gradients[i];
-    hessian += hessians[i];
-    total_neighborhood_count += neighborhood_counts[i];
+  for (const auto & t : thread_derivatives) {
+    score += t.score;
+    nearest_voxel_score += t.nearest_voxel_score;
+    found_neighborhood_voxel_num += t.found_neighborhood_voxel_num;
+    score_gradient += t.score_gradient;
+    hessian += t.hessian;
+    total_neighborhood_count += t.neighborhood_count;
   }
 
   if (regularization_pose_) {
@@ -495,6 +540,134 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeD
   return (score);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename PointSource, typename PointTarget>
+bool MultiGridNormalDistributionsTransform<PointSource, PointTarget>::isBuiltWithCuda()
+{
+#ifdef NDT_OMP_USE_CUDA
+  return true;
+#else
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename PointSource, typename PointTarget>
+void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::updateCudaGrids()
+{
+#ifdef NDT_OMP_USE_CUDA
+  if (!params_.use_gpu) {
+    cuda_grids_.clear();
+    return;
+  }
+
+  const auto & grid_list = target_cells_.getGridList();
+  std::vector<std::pair<typename TargetGrid::GridNodePtr, std::shared_ptr<const CudaNdtGrid>>>
+    cuda_grids;
+  cuda_grids.reserve(grid_list.size());
+
+  for (const auto & grid : grid_list) {
+    // Reuse the copy of a grid that was already loaded
+    const auto loaded = std::find_if(
+      cuda_grids_.begin(), cuda_grids_.end(),
+      [&grid](const auto & cuda_grid) { return cuda_grid.first == grid && cuda_grid.second; });
+    if (loaded != cuda_grids_.end()) {
+      cuda_grids.push_back(*loaded);
+      continue;
+    }
+
+    const size_t leaf_num = grid->leaves.size();
+    std::vector<float> centroids;
+    std::vector<double> means;
+    std::vector<double> inverse_covariances;
+    centroids.reserve(leaf_num * 3);
+    means.reserve(leaf_num * 3);
+    inverse_covariances.reserve(leaf_num * 9);
+    for (const auto & leaf : grid->leaves) {
+      for (int r = 0; r < 3; ++r) {
+        centroids.push_back(leaf.centroid_[r]);
+        means.push_back(leaf.getMean()(r));
+        for (int c = 0; c < 3; ++c) {
+          inverse_covariances.push_back(leaf.getInverseCov()(r, c));
+        }
+      }
+    }
+
+    // A grid that failed to be copied is left null, so that the derivatives fall back to the CPU
+    cuda_grids.emplace_back(
+      grid, CudaNdtGrid::create(
+              grid->leaf_voxel_ids, centroids, means, inverse_covariances,
+              {grid->min_voxel(0), grid->min_voxel(1), grid->min_voxel(2)},
+              {grid->max_voxel(0), grid->max_voxel(1), grid->max_voxel(2)}));
+  }
+
+  cuda_grids_ = std::move(cuda_grids);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename PointSource, typename PointTarget>
+bool MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeDerivativesCuda(
+  const PointCloudSource & trans_cloud, bool compute_hessian, CudaNdtDerivativesResult & result)
+{
+#ifdef NDT_OMP_USE_CUDA
+  const auto & grid_list = target_cells_.getGridList();
+  if (cuda_grids_.size() != grid_list.size()) {
+    return false;
+  }
+
+  std::vector<std::shared_ptr<const CudaNdtGrid>> grids;
+  grids.reserve(grid_list.size());
+  for (size_t i = 0; i < grid_list.size(); ++i) {
+    if (cuda_grids_[i].first != grid_list[i] || !cuda_grids_[i].second) {
+      return false;
+    }
+    grids.push_back(cuda_grids_[i].second);
+  }
+
+  std::vector<float> points;
+  std::vector<float> transformed_points;
+  points.reserve(input_->size() * 3);
+  transformed_points.reserve(input_->size() * 3);
+  for (size_t idx = 0; idx < input_->size(); ++idx) {
+    const auto & x_pt = (*input_)[idx];
+    const auto & x_trans_pt = trans_cloud[idx];
+    points.insert(points.end(), {x_pt.x, x_pt.y, x_pt.z});
+    transformed_points.insert(transformed_points.end(), {x_trans_pt.x, x_trans_pt.y, x_trans_pt.z});
+  }
+
+  CudaNdtDerivativesParameters parameters{};
+  for (int r = 0; r < 8; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      parameters.j_ang[r][c] = j_ang_(r, c);
+    }
+  }
+  for (int r = 0; r < 15; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      parameters.h_ang[r][c] = h_ang_(r, c);
+    }
+  }
+  parameters.gauss_d1 = gauss_d1_;
+  parameters.gauss_d2 = gauss_d2_;
+  const Eigen::Array4f inverse_leaf_size = target_cells_.getInverseLeafSize();
+  for (int axis = 0; axis < 3; ++axis) {
+    parameters.inverse_leaf_size[axis] = static_cast<double>(inverse_leaf_size[axis]);
+  }
+  parameters.radius = params_.resolution;
+  parameters.compute_hessian = compute_hessian;
+
+  if (!cuda_derivatives_) {
+    cuda_derivatives_ = std::make_shared<CudaNdtDerivatives>();
+  }
+  return cuda_derivatives_->compute(grids, points, transformed_points, parameters, result);
+#else
+  (void)trans_cloud;
+  (void)compute_hessian;
+  (void)result;
+  return false;
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template <typename PointSource, typename PointTarget>
 void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeAngleDerivatives(
@@ -629,13 +802,13 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::updateDe
   const Eigen::Matrix<double, 24, 6> & point_hessian, const Eigen::Vector3d & x_trans,
   const Eigen::Matrix3d & c_inv, bool compute_hessian) const
 {
-  Eigen::Matrix<double, 1, 4> x_trans4(x_trans[0], x_trans[1], x_trans[2], 0.0f);
-  Eigen::Matrix4d c_inv4 = Eigen::Matrix4d::Zero();
-
-  c_inv4.topLeftCorner(3, 3) = c_inv;
+  // The fourth row of the point derivatives is the zero of the homogeneous coordinate, so the
+  // products are computed in 3D with fixed-size blocks
+  const auto point_gradient3 = point_gradient.topRows<3>();
+  const Eigen::Matrix<double, 1, 3> x_trans_c_inv = x_trans.transpose() * c_inv;
 
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9 [Magnusson 2009]
-  double e_x_cov_x = exp(-gauss_d2_ * x_trans4.dot(x_trans4 * c_inv4) * 0.5f);
+  double e_x_cov_x = exp(-gauss_d2_ * x_trans_c_inv.dot(x_trans.transpose()) * 0.5);
   // Calculate probability of transformed points existence, Equation 6.9 [Magnusson 2009]
   double score_inc = -gauss_d1_ * e_x_cov_x;
 
@@ -647,33 +820,28 @@ double MultiGridNormalDistributionsTransform<PointSource, PointTarget>::updateDe
   // Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
   e_x_cov_x *= gauss_d1_;
 
-  Eigen::Matrix<double, 4, 6> c_inv4_x_point_gradient4 = c_inv4 * point_gradient;
-  Eigen::Matrix<double, 6, 1> x_trans4_dot_c_inv4_x_point_gradient4 =
-    x_trans4 * c_inv4_x_point_gradient4;
+  const Eigen::Matrix<double, 3, 6> c_inv_x_point_gradient = c_inv * point_gradient3;
+  const Eigen::Matrix<double, 6, 1> x_trans_dot_c_inv_x_point_gradient =
+    c_inv_x_point_gradient.transpose() * x_trans;
 
-  score_gradient.noalias() += (e_x_cov_x * x_trans4_dot_c_inv4_x_point_gradient4).cast<double>();
+  // Update gradient, Equation 6.12 [Magnusson 2009]
+  score_gradient.noalias() += e_x_cov_x * x_trans_dot_c_inv_x_point_gradient;
 
   if (compute_hessian) {
-    Eigen::Matrix<double, 1, 4> x_trans4_x_c_inv4 = x_trans4 * c_inv4;
-    Eigen::Matrix<double, 6, 6> point_gradient4_colj_dot_c_inv4_x_point_gradient4_col_i =
-      point_gradient.transpose() * c_inv4_x_point_gradient4;
-    Eigen::Matrix<double, 6, 1> x_trans4_dot_c_inv4_x_ext_point_hessian_4ij;
-
-    for (int i = 0; i < 6; ++i) {
-      // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
-      // Update gradient, Equation 6.12 [Magnusson 2009]
-      x_trans4_dot_c_inv4_x_ext_point_hessian_4ij.noalias() =
-        x_trans4_x_c_inv4 * point_hessian.block<4, 6>(i * 4, 0);
-
-      for (int j = 0; j < hessian.cols(); j++) {
-        // Update hessian, Equation 6.13 [Magnusson 2009]
-        hessian(i, j) +=
-          e_x_cov_x * (-gauss_d2_ * x_trans4_dot_c_inv4_x_point_gradient4(i) *
-                         x_trans4_dot_c_inv4_x_point_gradient4(j) +
-                       x_trans4_dot_c_inv4_x_ext_point_hessian_4ij(j) +
-                       point_gradient4_colj_dot_c_inv4_x_point_gradient4_col_i(j, i));
+    // Update hessian, Equation 6.13 [Magnusson 2009]
+    Eigen::Matrix<double, 6, 6> hessian_pt =
+      -gauss_d2_ * x_trans_dot_c_inv_x_point_gradient *
+        x_trans_dot_c_inv_x_point_gradient.transpose() +
+      c_inv_x_point_gradient.transpose() * point_gradient3;
+
+    // The second derivatives of the transformed point are only non-zero w.r.t. the angles
+    for (int i = 3; i < 6; ++i) {
+      for (int j = 3; j < 6; ++j) {
+        hessian_pt(i, j) += x_trans_c_inv.dot(point_hessian.block<3, 1>(i * 4, j).transpose());
       }
     }
+
+    hessian.noalias() += e_x_cov_x * hessian_pt;
   }
 
   return (score_inc);
@@ -687,16 +855,7 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
 {
   // Initialize Point Gradient and Hessian
   // Pre-allocate thread-wise point gradients and point hessians
-  std::vector<Eigen::Matrix<double, 4, 6>> t_point_gradients(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 24, 6>> t_point_hessians(params_.num_threads);
-  std::vector<Eigen::Matrix<double, 6, 6>> t_hessians(params_.num_threads);
-
-  for (int i = 0; i < params_.num_threads; ++i) {
-    t_point_gradients[i].setZero();
-    t_point_gradients[i].block<3, 3>(0, 0).setIdentity();
-    t_point_hessians[i].setZero();
-    t_hessians[i].setZero();
-  }
+  std::vector<ThreadDerivatives> thread_derivatives(params_.num_threads);
 
   hessian.setZero();
 
@@ -706,11 +865,11 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
   // Update hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
 #pragma omp parallel for num_threads(params_.num_threads) schedule(guided, 8)
   for (size_t idx = 0; idx < input_->size(); ++idx) {
-    int tid = omp_get_thread_num();
+    auto & t = thread_derivatives[omp_get_thread_num()];
     auto & x_trans_pt = trans_cloud[idx];
 
     // Find neighbors (Radius search has been experimentally faster than direct neighbor checking.
-    std::vector<TargetGridLeafConstPtr> neighborhood;
+    auto & neighborhood = t.neighborhood;
 
     // Neighborhood search method other than kdtree is disabled in multigrid_ndt_omp
     target_cells_.radiusSearch(x_trans_pt, params_.resolution, neighborhood);
@@ -724,9 +883,9 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
     Eigen::Vector3d x(x_pt.x, x_pt.y, x_pt.z);
     const Eigen::Vector3d x_trans(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
 
-    auto & point_gradient = t_point_gradients[tid];
-    auto & point_hessian = t_point_hessians[tid];
-    auto & tmp_hessian = t_hessians[tid];
+    auto & point_gradient = t.point_gradient;
+    auto & point_hessian = t.point_hessian;
+    auto & tmp_hessian = t.hessian;
 
     // Compute derivative of transform function w.r.t. transform vector, J_E and H_E in
     // Equations 6.18 and 6.20 [Magnusson 2009]
@@ -741,9 +900,9 @@ void MultiGridNormalDistributionsTransform<PointSource, PointTarget>::computeHes
     }
   }
 
-  // Sum over t_hessians
-  for (const auto & th : t_hessians) {
-    hessian += th;
+  // Sum over the thread-wise hessians
+  for (const auto & t : thread_derivatives) {
+    hessian += t.hessian;
   }
 }
 
@@ -196,6 +196,9 @@ NDTScanMatcher::NDTScanMatcher(const rclcpp::NodeOptions & options)
     rclcpp::ServicesQoS().get_rmw_qos_profile(), sensor_callback_group);
 
   ndt_ptr_->setParams(param_.ndt);
+  if (param_.ndt.use_gpu && !NormalDistributionsTransform::isBuiltWithCuda()) {
+    RCLCPP_WARN(this->get_logger(), "Built without CUDA, the NDT is computed on the CPU instead");
+  }
 
   initial_pose_buffer_ = std::make_unique<SmartPoseBuffer>(
     this->get_logger(), param_.validation.initial_pose_timeout_sec,
@@ -470,8 +473,11 @@ bool NDTScanMatcher::callback_sensor_points_main(
   // perform ndt scan matching
   const Eigen::Matrix4f initial_pose_matrix =
     pose_to_matrix4f(interpolation_result.interpolated_pose.pose.pose);
-  auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
-  ndt_ptr_->align(*output_cloud, initial_pose_matrix);
+  // NOTE: The aligned cloud is the sensor points transformed by the result pose, so it is reused
+  // for the debug clouds and the no ground scores instead of transforming the points again
+  pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_map_ptr(
+    new pcl::PointCloud<PointSource>);
+  ndt_ptr_->align(*sensor_points_in_map_ptr, initial_pose_matrix);
   const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
 
   const geometry_msgs::msg::Pose result_pose_msg = matrix4f_to_pose(ndt_result.pose);
@@ -640,11 +646,9 @@ bool NDTScanMatcher::callback_sensor_points_main(
     sensor_ros_time, result_pose_msg, interpolation_result.interpolated_pose,
     interpolation_result.old_pose, interpolation_result.new_pose);
 
-  pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_map_ptr(
-    new pcl::PointCloud<PointSource>);
-  autoware::universe_utils::transformPointCloud(
-    *sensor_points_in_baselink_frame, *sensor_points_in_map_ptr, ndt_result.pose);
-  publish_point_cloud(sensor_ros_time, param_.frame.map_frame, sensor_points_in_map_ptr);
+  if (sensor_aligned_pose_pub_->get_subscription_count() > 0) {
+    publish_point_cloud(sensor_ros_time, param_.frame.map_frame, sensor_points_in_map_ptr);
+  }
 
   // check each of point score
   const float lower_nvs = 1.0f;
@@ -666,20 +670,24 @@ bool NDTScanMatcher::callback_sensor_points_main(
     // remove ground
     pcl::shared_ptr<pcl::PointCloud<PointSource>> no_ground_points_in_map_ptr(
       new pcl::PointCloud<PointSource>);
+    no_ground_points_in_map_ptr->points.reserve(sensor_points_in_map_ptr->size());
+    const double result_pose_z = result_pose_msg.position.z;
     for (std::size_t i = 0; i < sensor_points_in_map_ptr->size(); i++) {
       const float point_z = sensor_points_in_map_ptr->points[i].z;  // NOLINT
       if (
-        point_z - matrix4f_to_pose(ndt_result.pose).position.z >
+        point_z - result_pose_z >
         param_.score_estimation.no_ground_points.z_margin_for_ground_removal) {
         no_ground_points_in_map_ptr->points.push_back(sensor_points_in_map_ptr->points[i]);
       }
     }
     // pub remove-ground points
-    sensor_msgs::msg::PointCloud2 no_ground_points_msg_in_map;
-    pcl::toROSMsg(*no_ground_points_in_map_ptr, no_ground_points_msg_in_map);
-    no_ground_points_msg_in_map.header.stamp = sensor_ros_time;
-    no_ground_points_msg_in_map.header.frame_id = param_.frame.map_frame;
-    no_ground_points_aligned_pose_pub_->publish(no_ground_points_msg_in_map);
+    if (no_ground_points_aligned_pose_pub_->get_subscription_count() > 0) {
+      sensor_msgs::msg::PointCloud2 no_ground_points_msg_in_map;
+      pcl::toROSMsg(*no_ground_points_in_map_ptr, no_ground_points_msg_in_map);
+      no_ground_points_msg_in_map.header.stamp = sensor_ros_time;
+      no_ground_points_msg_in_map.header.frame_id = param_.frame.map_frame;
+      no_ground_points_aligned_pose_pub_->publish(no_ground_points_msg_in_map);
+    }
     // calculate score
     const auto no_ground_transform_probability = static_cast<float>(
       ndt_ptr_->calculateTransformationProbability(*no_ground_points_in_map_ptr));
@@ -1099,60 +1107,79 @@ std::tuple<geometry_msgs::msg::PoseWithCovarianceStamped, double> NDTScanMatcher
     param_.initial_pose_estimation.n_startup_trials, sample_mean, sample_stddev);
 
   std::vector<Particle> particle_array;
-  auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
 
   // publish the estimated poses in 20 times to see the progress and to avoid dropping data
   visualization_msgs::msg::MarkerArray marker_array;
   constexpr int64_t publish_num = 20;
   const int64_t publish_interval = param_.initial_pose_estimation.particles_num / publish_num;
 
-  for (int64_t i = 0; i < param_.initial_pose_estimation.particles_num; i++) {
-    const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
-
-    geometry_msgs::msg::Pose initial_pose;
-    initial_pose.position.x = input[0];
-    initial_pose.position.y = input[1];
-    initial_pose.position.z = input[2];
-    geometry_msgs::msg::Vector3 init_rpy;
-    init_rpy.x = input[3];
-    init_rpy.y = input[4];
-    init_rpy.z = input[5];
-    tf2::Quaternion tf_quaternion;
-    tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
-    initial_pose.orientation = tf2::toMsg(tf_quaternion);
-
-    const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(initial_pose);
-    ndt_ptr_->align(*output_cloud, initial_pose_matrix);
-    const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
-
-    Particle particle(
-      initial_pose, matrix4f_to_pose(ndt_result.pose),
-      ndt_result.nearest_voxel_transformation_likelihood, ndt_result.iteration_num);
-    particle_array.push_back(particle);
-    push_debug_markers(marker_array, get_clock()->now(), param_.frame.map_frame, particle, i);
-    if (
-      (i + 1) % publish_interval == 0 || (i + 1) == param_.initial_pose_estimation.particles_num) {
-      ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
-      marker_array.markers.clear();
+  // The startup trials are random samples independent of each other, so they are aligned
+  // concurrently. Each of the later trials depends on the previous ones, so they are aligned one by
+  // one.
+  const int64_t startup_trials_num = std::min(
+    param_.initial_pose_estimation.n_startup_trials, param_.initial_pose_estimation.particles_num);
+
+  int64_t i = 0;
+  while (i < param_.initial_pose_estimation.particles_num) {
+    const int64_t batch_size = std::max<int64_t>(startup_trials_num - i, 1);
+
+    std::vector<geometry_msgs::msg::Pose> initial_poses;
+    std::vector<Eigen::Matrix4f> initial_pose_matrices;
+    for (int64_t j = 0; j < batch_size; j++) {
+      const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
+
+      geometry_msgs::msg::Pose initial_pose;
+      initial_pose.position.x = input[0];
+      initial_pose.position.y = input[1];
+      initial_pose.position.z = input[2];
+      geometry_msgs::msg::Vector3 init_rpy;
+      init_rpy.x = input[3];
+      init_rpy.y = input[4];
+      init_rpy.z = input[5];
+      tf2::Quaternion tf_quaternion;
+      tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
+      initial_pose.orientation = tf2::toMsg(tf_quaternion);
+
+      initial_poses.push_back(initial_pose);
+      initial_pose_matrices.push_back(pose_to_matrix4f(initial_pose));
     }
 
-    const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
-    const geometry_msgs::msg::Vector3 rpy = autoware::localization_util::get_rpy(pose);
-
-    TreeStructuredParzenEstimator::Input result(6);
-    result[0] = pose.position.x;
-    result[1] = pose.position.y;
-    result[2] = pose.position.z;
-    result[3] = rpy.x;
-    result[4] = rpy.y;
-    result[5] = rpy.z;
-    tpe.add_trial(TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
-
-    auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
-    autoware::universe_utils::transformPointCloud(
-      *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
-    publish_point_cloud(
-      initial_pose_with_cov.header.stamp, param_.frame.map_frame, sensor_points_in_map_ptr);
+    const std::vector<pclomp::NdtResult> ndt_results =
+      ndt_ptr_->alignBatch(initial_pose_matrices);
+
+    for (size_t j = 0; j < ndt_results.size(); j++, i++) {
+      const pclomp::NdtResult & ndt_result = ndt_results[j];
+
+      Particle particle(
+        initial_poses[j], matrix4f_to_pose(ndt_result.pose),
+        ndt_result.nearest_voxel_transformation_likelihood, ndt_result.iteration_num);
+      particle_array.push_back(particle);
+      push_debug_markers(marker_array, get_clock()->now(), param_.frame.map_frame, particle, i);
+      if (
+        (i + 1) % publish_interval == 0 ||
+        (i + 1) == param_.initial_pose_estimation.particles_num) {
+        ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
+        marker_array.markers.clear();
+      }
+
+      const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
+      const geometry_msgs::msg::Vector3 rpy = autoware::localization_util::get_rpy(pose);
+
+      TreeStructuredParzenEstimator::Input result(6);
+      result[0] = pose.position.x;
+      result[1] = pose.position.y;
+      result[2] = pose.position.z;
+      result[3] = rpy.x;
+      result[4] = rpy.y;
+      result[5] = rpy.z;
+      tpe.add_trial(TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
+
+      auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
+      autoware::universe_utils::transformPointCloud(
+        *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
+      publish_point_cloud(
+        initial_pose_with_cov.header.stamp, param_.frame.map_frame, sensor_points_in_map_ptr);
+    }
   }
 
   auto best_particle_ptr = std::max_element(
@@ -28,6 +28,7 @@
 #include <std_srvs/srv/set_bool.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -66,11 +67,11 @@ private:
   rclcpp::Publisher<DiagnosticArray>::SharedPtr pub_diag_;
   rclcpp::Publisher<MarkerArray>::SharedPtr pub_debug_marker_array_;
   rclcpp::Publisher<String>::SharedPtr pub_debug_string_;
-  // Subscribers for stoppers
-  rclcpp::Subscription<Image>::SharedPtr sub_yabloc_input_;
-  rclcpp::Subscription<Image>::SharedPtr sub_artag_input_;
-  rclcpp::Subscription<PointCloud2>::SharedPtr sub_ndt_input_;
-  rclcpp::Subscription<PoseCovStamped>::SharedPtr sub_eagleye_output_;
+  // Subscribers for stoppers, which exist only while the stopper is enabled so that the topics
+  // relayed to nobody are not even received
+  std::unordered_map<PoseEstimatorType, std::function<rclcpp::SubscriptionBase::SharedPtr()>>
+    stopper_subscriber_factories_;
+  std::unordered_map<PoseEstimatorType, rclcpp::SubscriptionBase::SharedPtr> stopper_subscribers_;
   // Subscribers for switch rules
   rclcpp::Subscription<PoseCovStamped>::SharedPtr sub_localization_pose_cov_;
   rclcpp::Subscription<PointCloud2>::SharedPtr sub_point_cloud_map_;
@@ -67,31 +67,40 @@ PoseEstimatorArbiter::PoseEstimatorArbiter(const rclcpp::NodeOptions & options)
   const rclcpp::QoS sensor_qos = rclcpp::SensorDataQoS();
   const rclcpp::QoS latch_qos = rclcpp::QoS(1).transient_local().reliable();
 
-  // Create stoppers & subscribers
+  // Create stoppers & subscriber factories
+  // NOTE: The subscribers are created when the stoppers are enabled
   if (is_running(PoseEstimatorType::ndt)) {
     stoppers_.emplace(
       PoseEstimatorType::ndt, std::make_shared<stopper::StopperNdt>(this, shared_data_));
-    sub_ndt_input_ = create_subscription<PointCloud2>(
-      "~/input/ndt/pointcloud", sensor_qos, shared_data_->ndt_input_points.create_callback());
+    stopper_subscriber_factories_.emplace(PoseEstimatorType::ndt, [this, sensor_qos]() {
+      return create_subscription<PointCloud2>(
+        "~/input/ndt/pointcloud", sensor_qos, shared_data_->ndt_input_points.create_callback());
+    });
   }
   if (is_running(PoseEstimatorType::yabloc)) {
     stoppers_.emplace(
       PoseEstimatorType::yabloc, std::make_shared<stopper::StopperYabLoc>(this, shared_data_));
-    sub_yabloc_input_ = create_subscription<Image>(
-      "~/input/yabloc/image", sensor_qos, shared_data_->yabloc_input_image.create_callback());
+    stopper_subscriber_factories_.emplace(PoseEstimatorType::yabloc, [this, sensor_qos]() {
+      return create_subscription<Image>(
+        "~/input/yabloc/image", sensor_qos, shared_data_->yabloc_input_image.create_callback());
+    });
   }
   if (is_running(PoseEstimatorType::eagleye)) {
     stoppers_.emplace(
       PoseEstimatorType::eagleye, std::make_shared<stopper::StopperEagleye>(this, shared_data_));
-    sub_eagleye_output_ = create_subscription<PoseCovStamped>(
-      "~/input/eagleye/pose_with_covariance", 5, /* this is not sensor topic */
-      shared_data_->eagleye_output_pose_cov.create_callback());
+    stopper_subscriber_factories_.emplace(PoseEstimatorType::eagleye, [this]() {
+      return create_subscription<PoseCovStamped>(
+        "~/input/eagleye/pose_with_covariance", 5, /* this is not sensor topic */
+        shared_data_->eagleye_output_pose_cov.create_callback());
+    });
   }
   if (is_running(PoseEstimatorType::artag)) {
     stoppers_.emplace(
       PoseEstimatorType::artag, std::make_shared<stopper::StopperArTag>(this, shared_data_));
-    sub_artag_input_ = create_subscription<Image>(
-      "~/input/artag/image", sensor_qos, shared_data_->artag_input_image.create_callback());
+    stopper_subscriber_factories_.emplace(PoseEstimatorType::artag, [this, sensor_qos]() {
+      return create_subscription<Image>(
+        "~/input/artag/image", sensor_qos, shared_data_->artag_input_image.create_callback());
+    });
   }
 
   // Subscribers for switch rule
@@ -142,10 +151,17 @@ void PoseEstimatorArbiter::toggle_each(
     }
 
     // Enable or disable according to toggle_list
+    // The subscriber is created before enabling, and destroyed after disabling, so that no message
+    // is relayed to the disabled pose_estimator
+    auto & subscriber = stopper_subscribers_[type];
     if (toggle_list.at(type)) {
+      if (!subscriber) {
+        subscriber = stopper_subscriber_factories_.at(type)();
+      }
       stopper->enable();
     } else {
       stopper->disable();
+      subscriber.reset();
     }
   }
 }
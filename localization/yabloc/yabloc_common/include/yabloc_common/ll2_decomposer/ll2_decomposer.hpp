@@ -52,8 +52,26 @@ private:
   std::set<std::string> sign_board_labels_;
   std::set<std::string> bounding_box_labels_;
 
+  // the decomposition is saved in this directory keyed by the hash of the map and the labels, and
+  // loaded instead of decomposing the same map again. Empty to disable.
+  std::string cache_directory_;
+
+  struct Decomposition
+  {
+    Cloud2 road_marking;
+    Cloud2 sign_board;
+    Cloud2 bounding_box;
+    MarkerArray marker;
+  };
+
   void on_map(const LaneletMapBin & msg);
 
+  Decomposition decompose(const LaneletMapBin & msg);
+
+  std::string get_cache_path(const LaneletMapBin & msg) const;
+  bool load_cache(const std::string & path, Decomposition & decomposition);
+  void save_cache(const std::string & path, const Decomposition & decomposition) const;
+
   static pcl::PointNormal to_point_normal(
     const lanelet::ConstPoint3d & from, const lanelet::ConstPoint3d & to);
 
@@ -75,7 +93,7 @@ private:
     const lanelet::PolygonLayer & polygon_layer, const std::set<std::string> & labels,
     const std::string & ns);
 
-  void publish_additional_marker(const lanelet::LaneletMapPtr & lanelet_map);
+  MarkerArray make_additional_marker(const lanelet::LaneletMapPtr & lanelet_map);
 };
 }  // namespace yabloc::ll2_decomposer
 
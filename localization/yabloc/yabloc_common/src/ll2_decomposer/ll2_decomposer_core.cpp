@@ -16,14 +16,65 @@
 
 #include <autoware/universe_utils/ros/marker_helper.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
-#include <yabloc_common/pub_sub.hpp>
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
 
 #include <geometry_msgs/msg/polygon.hpp>
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
 namespace yabloc::ll2_decomposer
 {
+namespace
+{
+// increment when the format of the cache or the decomposition changes
+constexpr uint64_t cache_version = 1;
+
+uint64_t hash_bytes(const void * data, const size_t size, uint64_t hash)
+{
+  // FNV-1a
+  const auto * bytes = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+template <typename MessageT>
+void write_message(std::ofstream & file, const MessageT & message)
+{
+  rclcpp::Serialization<MessageT> serialization;
+  rclcpp::SerializedMessage serialized_message;
+  serialization.serialize_message(&message, &serialized_message);
+  const auto & buffer = serialized_message.get_rcl_serialized_message();
+  const uint64_t size = buffer.buffer_length;
+  file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  file.write(reinterpret_cast<const char *>(buffer.buffer), static_cast<std::streamsize>(size));
+}
+
+template <typename MessageT>
+bool read_message(std::ifstream & file, MessageT & message)
+{
+  uint64_t size = 0;
+  if (!file.read(reinterpret_cast<char *>(&size), sizeof(size))) return false;
+  rclcpp::SerializedMessage serialized_message(size);
+  auto & buffer = serialized_message.get_rcl_serialized_message();
+  if (!file.read(reinterpret_cast<char *>(buffer.buffer), static_cast<std::streamsize>(size))) {
+    return false;
+  }
+  buffer.buffer_length = size;
+  rclcpp::Serialization<MessageT> serialization;
+  serialization.deserialize_message(&serialized_message, &message);
+  return true;
+}
+}  // namespace
+
 Ll2Decomposer::Ll2Decomposer(const rclcpp::NodeOptions & options) : Node("ll2_to_image", options)
 {
   using std::placeholders::_1;
@@ -50,6 +101,7 @@ Ll2Decomposer::Ll2Decomposer(const rclcpp::NodeOptions & options) : Node("ll2_to
   load_lanelet2_labels("road_marking_labels", road_marking_labels_);
   load_lanelet2_labels("sign_board_labels", sign_board_labels_);
   load_lanelet2_labels("bounding_box_labels", bounding_box_labels_);
+  cache_directory_ = declare_parameter<std::string>("cache_directory");
 
   if (road_marking_labels_.empty()) {
     RCLCPP_FATAL_STREAM(
@@ -105,27 +157,111 @@ pcl::PointCloud<pcl::PointXYZL> Ll2Decomposer::load_bounding_boxes(
 void Ll2Decomposer::on_map(const LaneletMapBin & msg)
 {
   RCLCPP_INFO_STREAM(get_logger(), "subscribed binary vector map");
+
+  Decomposition decomposition;
+  const std::string cache_path = cache_directory_.empty() ? "" : get_cache_path(msg);
+  if (!cache_path.empty() && load_cache(cache_path, decomposition)) {
+    RCLCPP_INFO_STREAM(get_logger(), "loaded map decomposition from " << cache_path);
+  } else {
+    decomposition = decompose(msg);
+    if (!cache_path.empty()) save_cache(cache_path, decomposition);
+  }
+
+  const rclcpp::Time stamp = msg.header.stamp;
+  for (Cloud2 * cloud :
+       {&decomposition.road_marking, &decomposition.sign_board, &decomposition.bounding_box}) {
+    cloud->header.stamp = stamp;
+    cloud->header.frame_id = "map";
+  }
+  pub_marker_->publish(decomposition.marker);
+  pub_road_marking_->publish(decomposition.road_marking);
+  pub_sign_board_->publish(decomposition.sign_board);
+  pub_bounding_box_->publish(decomposition.bounding_box);
+
+  RCLCPP_INFO_STREAM(get_logger(), "succeeded map decomposing");
+}
+
+Ll2Decomposer::Decomposition Ll2Decomposer::decompose(const LaneletMapBin & msg)
+{
   lanelet::LaneletMapPtr lanelet_map(new lanelet::LaneletMap);
   lanelet::utils::conversion::fromBinMsg(msg, lanelet_map);
   print_attr(lanelet_map, get_logger());
 
-  const rclcpp::Time stamp = msg.header.stamp;
-
   const auto & ls_layer = lanelet_map->lineStringLayer;
   const auto & po_layer = lanelet_map->polygonLayer;
   auto tmp1 = extract_specified_line_string(ls_layer, sign_board_labels_);
   auto tmp2 = extract_specified_line_string(ls_layer, road_marking_labels_);
-  pcl::PointCloud<pcl::PointNormal> ll2_sign_board = split_line_strings(tmp1);
-  pcl::PointCloud<pcl::PointNormal> ll2_road_marking = split_line_strings(tmp2);
-  pcl::PointCloud<pcl::PointXYZL> ll2_bounding_box = load_bounding_boxes(po_layer);
 
-  publish_additional_marker(lanelet_map);
+  Decomposition decomposition;
+  pcl::toROSMsg(split_line_strings(tmp1), decomposition.sign_board);
+  pcl::toROSMsg(split_line_strings(tmp2), decomposition.road_marking);
+  pcl::toROSMsg(load_bounding_boxes(po_layer), decomposition.bounding_box);
+  decomposition.marker = make_additional_marker(lanelet_map);
+  return decomposition;
+}
 
-  common::publish_cloud(*pub_road_marking_, ll2_road_marking, stamp);
-  common::publish_cloud(*pub_sign_board_, ll2_sign_board, stamp);
-  common::publish_cloud(*pub_bounding_box_, ll2_bounding_box, stamp);
+std::string Ll2Decomposer::get_cache_path(const LaneletMapBin & msg) const
+{
+  uint64_t hash = hash_bytes(&cache_version, sizeof(cache_version), 0xcbf29ce484222325ULL);
+  hash = hash_bytes(msg.data.data(), msg.data.size(), hash);
+  for (const auto * labels : {&road_marking_labels_, &sign_board_labels_, &bounding_box_labels_}) {
+    for (const auto & label : *labels) {
+      // the terminating null separates the labels
+      hash = hash_bytes(label.c_str(), label.size() + 1, hash);
+    }
+    hash = hash_bytes("", 1, hash);
+  }
 
-  RCLCPP_INFO_STREAM(get_logger(), "succeeded map decomposing");
+  std::ostringstream file_name;
+  file_name << "ll2_decomposition_" << std::hex << std::setw(16) << std::setfill('0') << hash
+            << ".bin";
+  return (std::filesystem::path(cache_directory_) / file_name.str()).string();
+}
+
+bool Ll2Decomposer::load_cache(const std::string & path, Decomposition & decomposition)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+
+  try {
+    const bool is_complete = read_message(file, decomposition.road_marking) &&
+                             read_message(file, decomposition.sign_board) &&
+                             read_message(file, decomposition.bounding_box) &&
+                             read_message(file, decomposition.marker);
+    if (!is_complete) {
+      RCLCPP_WARN_STREAM(get_logger(), "ignored the truncated map decomposition cache " << path);
+      return false;
+    }
+  } catch (const std::exception & e) {
+    RCLCPP_WARN_STREAM(get_logger(), "failed to load the map decomposition cache: " << e.what());
+    return false;
+  }
+
+  const auto now = get_clock()->now();
+  for (auto & marker : decomposition.marker.markers) marker.header.stamp = now;
+  return true;
+}
+
+void Ll2Decomposer::save_cache(const std::string & path, const Decomposition & decomposition) const
+{
+  // written to a temporary file first so that another node never loads a partially written cache
+  const std::string temporary_path = path + ".tmp";
+  try {
+    std::filesystem::create_directories(cache_directory_);
+    {
+      std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+      write_message(file, decomposition.road_marking);
+      write_message(file, decomposition.sign_board);
+      write_message(file, decomposition.bounding_box);
+      write_message(file, decomposition.marker);
+      if (!file) throw std::runtime_error("failed to write " + temporary_path);
+    }
+    std::filesystem::rename(temporary_path, path);
+  } catch (const std::exception & e) {
+    RCLCPP_WARN_STREAM(get_logger(), "failed to save the map decomposition cache: " << e.what());
+    std::error_code error_code;
+    std::filesystem::remove(temporary_path, error_code);
+  }
 }
 
 pcl::PointCloud<pcl::PointNormal> Ll2Decomposer::split_line_strings(
@@ -249,7 +385,8 @@ Ll2Decomposer::MarkerArray Ll2Decomposer::make_polygon_marker_msg(
   return marker_array;
 }
 
-void Ll2Decomposer::publish_additional_marker(const lanelet::LaneletMapPtr & lanelet_map)
+Ll2Decomposer::MarkerArray Ll2Decomposer::make_additional_marker(
+  const lanelet::LaneletMapPtr & lanelet_map)
 {
   auto marker1 =
     make_sign_marker_msg(lanelet_map->lineStringLayer, sign_board_labels_, "sign_board");
@@ -259,7 +396,7 @@ void Ll2Decomposer::publish_additional_marker(const lanelet::LaneletMapPtr & lan
 
   std::copy(marker2.markers.begin(), marker2.markers.end(), std::back_inserter(marker1.markers));
   std::copy(marker3.markers.begin(), marker3.markers.end(), std::back_inserter(marker1.markers));
-  pub_marker_->publish(marker1);
+  return marker1;
 }
 
 }  // namespace yabloc::ll2_decomposer
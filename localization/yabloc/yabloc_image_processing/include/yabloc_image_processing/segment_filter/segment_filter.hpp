@@ -29,7 +29,8 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
-#include <set>
+#include <cstdint>
+#include <vector>
 
 namespace yabloc::segment_filter
 {
@@ -62,11 +63,17 @@ private:
   // Return true if success to define or already defined
   bool define_project_func();
 
-  pcl::PointCloud<pcl::PointNormal> project_lines(
-    const pcl::PointCloud<pcl::PointNormal> & points, const std::set<int> & indices,
-    bool negative = false) const;
+  // Project the line segments in parallel and split them into the reliable ones and the others
+  void project_lines(
+    const pcl::PointCloud<pcl::PointNormal> & points, const std::vector<uint8_t> & is_reliable,
+    pcl::PointCloud<pcl::PointNormal> & valid_edges,
+    pcl::PointCloud<pcl::PointNormal> & invalid_edges) const;
 
-  static std::set<int> filter_by_mask(
+  // Return false if the projected line segment is excluded
+  bool project_line(const pcl::PointNormal & pn, pcl::PointNormal & projected_pn) const;
+
+  // Return whether each line segment passes through the mask
+  static std::vector<uint8_t> filter_by_mask(
     const cv::Mat & mask, const pcl::PointCloud<pcl::PointNormal> & edges);
 
   cv::Point2i to_cv_point(const Eigen::Vector3f & v) const;
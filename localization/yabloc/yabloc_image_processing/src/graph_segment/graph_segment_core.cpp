@@ -21,6 +21,8 @@
 #include <yabloc_common/cv_decompress.hpp>
 #include <yabloc_common/pub_sub.hpp>
 
+#include <vector>
+
 namespace yabloc::graph_segment
 {
 GraphSegment::GraphSegment(const rclcpp::NodeOptions & options)
@@ -50,6 +52,13 @@ GraphSegment::GraphSegment(const rclcpp::NodeOptions & options)
   }
 }
 
+int count_classes(const cv::Mat & segmented)
+{
+  double max_class = -1;
+  cv::minMaxLoc(segmented, nullptr, &max_class);
+  return static_cast<int>(max_class) + 1;
+}
+
 cv::Vec3b random_hsv(int index)
 {
   // It generates colors that are not too bright or too vivid, but rich in hues.
@@ -67,26 +76,28 @@ int GraphSegment::search_most_road_like_class(const cv::Mat & segmented) const
     static_cast<int>(static_cast<float>(segmented.cols) * 0.5),
     static_cast<int>(static_cast<float>(segmented.rows) * r));
   cv::Rect2i rect(target_px + cv::Point2i(-bw, -bw), target_px + cv::Point2i(bw, bw));
+  rect &= cv::Rect2i(0, 0, segmented.cols, segmented.rows);
 
-  std::unordered_map<int, int> areas;
-  std::unordered_set<int> candidates;
+  // NOTE: The classes are consecutive integers starting from 0
+  std::vector<int> areas(count_classes(segmented), 0);
   for (int h = 0; h < segmented.rows; h++) {
     const int * seg_ptr = segmented.ptr<int>(h);
     for (int w = 0; w < segmented.cols; w++) {
-      int key = seg_ptr[w];
-      areas.try_emplace(key, 0);
-      areas[key]++;
-      if (rect.contains(cv::Point2i{w, h})) candidates.insert(key);
+      areas[seg_ptr[w]]++;
     }
   }
 
-  // Search the largest area and its class
+  // Search the largest area and its class among the candidates in the target rectangle
   int max_area = 0;
   int max_area_class = -1;
-  for (int c : candidates) {
-    if (areas.at(c) < max_area) continue;
-    max_area = areas.at(c);
-    max_area_class = c;
+  for (int h = rect.y; h < rect.y + rect.height; h++) {
+    const int * seg_ptr = segmented.ptr<int>(h);
+    for (int w = rect.x; w < rect.x + rect.width; w++) {
+      const int c = seg_ptr[w];
+      if (areas[c] < max_area) continue;
+      max_area = areas[c];
+      max_area_class = c;
+    }
   }
   return max_area_class;
 }
@@ -111,36 +122,48 @@ void GraphSegment::on_image(const Image & msg)
     road_keys = similar_area_searcher_->search(resized, segmented, target_class);
   }
 
-  // Draw output image and debug image
+  // The pixel values of each class, so that road_keys is not searched for each pixel
+  const int num_classes = count_classes(segmented);
+  std::vector<uchar> output_values(num_classes, 0);
+  std::vector<cv::Vec3b> debug_values(num_classes);
+  for (int key = 0; key < num_classes; key++) {
+    if (road_keys.count(key) > 0) {
+      output_values[key] = 255;
+      debug_values[key] = (key == target_class) ? cv::Vec3b(30, 255, 255) : cv::Vec3b(10, 255, 255);
+    } else {
+      debug_values[key] = random_hsv(key);
+    }
+  }
+
+  // Draw output image
   cv::Mat output_image = cv::Mat::zeros(resized.size(), CV_8UC1);
-  cv::Mat debug_image = cv::Mat::zeros(resized.size(), CV_8UC3);
   for (int h = 0; h < resized.rows; h++) {
     // NOTE: Accessing through ptr() is faster than at()
-    auto * const debug_image_ptr = debug_image.ptr<cv::Vec3b>(h);
     auto * const output_image_ptr = output_image.ptr<uchar>(h);
     const int * const segmented_image_ptr = segmented.ptr<int>(h);
-
     for (int w = 0; w < resized.cols; w++) {
-      cv::Point2i px(w, h);
-      const int key = segmented_image_ptr[w];
-      if (road_keys.count(key) > 0) {
-        output_image_ptr[w] = 255;
-        if (key == target_class)
-          debug_image_ptr[w] = cv::Vec3b(30, 255, 255);
-        else
-          debug_image_ptr[w] = cv::Vec3b(10, 255, 255);
-      } else {
-        debug_image_ptr[w] = random_hsv(key);
-      }
+      output_image_ptr[w] = output_values[segmented_image_ptr[w]];
     }
   }
-  cv::cvtColor(debug_image, debug_image, cv::COLOR_HSV2BGR);
   cv::resize(output_image, output_image, image.size(), 0, 0, cv::INTER_NEAREST);
-  cv::resize(debug_image, debug_image, image.size(), 0, 0, cv::INTER_NEAREST);
 
   common::publish_image(*pub_mask_image_, output_image, msg.header.stamp);
 
-  draw_and_publish_image(image, debug_image, msg.header.stamp);
+  // Draw debug image only if someone subscribes it
+  if (pub_debug_image_->get_subscription_count() > 0) {
+    cv::Mat debug_image = cv::Mat::zeros(resized.size(), CV_8UC3);
+    for (int h = 0; h < resized.rows; h++) {
+      auto * const debug_image_ptr = debug_image.ptr<cv::Vec3b>(h);
+      const int * const segmented_image_ptr = segmented.ptr<int>(h);
+      for (int w = 0; w < resized.cols; w++) {
+        debug_image_ptr[w] = debug_values[segmented_image_ptr[w]];
+      }
+    }
+    cv::cvtColor(debug_image, debug_image, cv::COLOR_HSV2BGR);
+    cv::resize(debug_image, debug_image, image.size(), 0, 0, cv::INTER_NEAREST);
+
+    draw_and_publish_image(image, debug_image, msg.header.stamp);
+  }
   RCLCPP_INFO_STREAM(get_logger(), "total processing time: " << stop_watch.toc() * 1000 << "[ms]");
 }
 
@@ -19,6 +19,7 @@
 #include <rclcpp/logging.hpp>
 
 #include <queue>
+#include <vector>
 
 namespace yabloc::graph_segment
 {
@@ -32,8 +33,11 @@ struct KeyAndArea
 std::set<int> SimilarAreaSearcher::search(
   const cv::Mat & rgb_image, const cv::Mat & segmented, int best_road_like_class)
 {
-  std::unordered_map<int, Histogram> histogram_map;
-  std::unordered_map<int, int> count_map;
+  // NOTE: The classes are consecutive integers starting from 0
+  double max_class = -1;
+  cv::minMaxLoc(segmented, nullptr, &max_class);
+  std::vector<Histogram> histograms(static_cast<size_t>(max_class + 1));
+  std::vector<int> counts(static_cast<size_t>(max_class + 1), 0);
 
   for (int h = 0; h < rgb_image.rows; h++) {
     const int * seg_ptr = segmented.ptr<int>(h);
@@ -41,24 +45,18 @@ std::set<int> SimilarAreaSearcher::search(
 
     for (int w = 0; w < rgb_image.cols; w++) {
       int key = seg_ptr[w];
-      cv::Vec3b rgb = rgb_ptr[w];
-      if (count_map.count(key) == 0) {
-        count_map[key] = 1;
-        histogram_map[key].add(rgb);
-      } else {
-        count_map[key]++;
-        histogram_map[key].add(rgb);
-      }
+      counts[key]++;
+      histograms[key].add(rgb_ptr[w]);
     }
   }
 
   auto compare = [](KeyAndArea a, KeyAndArea b) { return a.count < b.count; };
   std::priority_queue<KeyAndArea, std::vector<KeyAndArea>, decltype(compare)> key_queue{compare};
-  for (auto [key, count] : count_map) {
-    key_queue.push({key, count});
+  for (int key = 0; key < static_cast<int>(counts.size()); key++) {
+    if (counts[key] > 0) key_queue.push({key, counts[key]});
   }
 
-  const Eigen::MatrixXf ref_histogram = histogram_map.at(best_road_like_class).eval();
+  const Eigen::MatrixXf ref_histogram = histograms.at(best_road_like_class).eval();
 
   std::stringstream debug_ss;
   debug_ss << "histogram equality ";
@@ -69,7 +67,7 @@ std::set<int> SimilarAreaSearcher::search(
     KeyAndArea key = key_queue.top();
     key_queue.pop();
 
-    Eigen::MatrixXf query = histogram_map.at(key.key).eval();
+    Eigen::MatrixXf query = histograms.at(key.key).eval();
     float score = Histogram::eval_histogram_intersection(ref_histogram, query);
     debug_ss << " " << score;
 
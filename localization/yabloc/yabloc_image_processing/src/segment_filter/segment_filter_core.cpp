@@ -15,6 +15,7 @@
 #include "yabloc_image_processing/segment_filter/segment_filter.hpp"
 
 #include <opencv4/opencv2/core.hpp>
+#include <opencv4/opencv2/core/utility.hpp>
 #include <opencv4/opencv2/imgproc.hpp>
 #include <yabloc_common/cv_decompress.hpp>
 #include <yabloc_common/pub_sub.hpp>
@@ -102,11 +103,11 @@ void SegmentFilter::execute(const PointCloud2 & line_segments_msg, const Image &
   cv::Mat mask_image = common::decompress_to_cv_mat(segment_msg);
   pcl::fromROSMsg(line_segments_msg, *line_segments_cloud);
 
-  const std::set<int> indices = filter_by_mask(mask_image, *line_segments_cloud);
+  const std::vector<uint8_t> is_reliable = filter_by_mask(mask_image, *line_segments_cloud);
 
-  pcl::PointCloud<pcl::PointNormal> valid_edges = project_lines(*line_segments_cloud, indices);
-  pcl::PointCloud<pcl::PointNormal> invalid_edges =
-    project_lines(*line_segments_cloud, indices, true);
+  pcl::PointCloud<pcl::PointNormal> valid_edges;
+  pcl::PointCloud<pcl::PointNormal> invalid_edges;
+  project_lines(*line_segments_cloud, is_reliable, valid_edges, invalid_edges);
 
   // Projected line segments
   {
@@ -152,7 +153,7 @@ void SegmentFilter::execute(const PointCloud2 & line_segments_msg, const Image &
       pcl::PointXYZLNormal pln;
       pln.getVector3fMap() = pn.getVector3fMap();
       pln.getNormalVector3fMap() = pn.getNormalVector3fMap();
-      if (indices.count(static_cast<int>(index)) > 0)
+      if (is_reliable[index])
         pln.label = 255;
       else
         pln.label = 0;
@@ -185,104 +186,89 @@ bool SegmentFilter::is_near_element(
   return true;
 }
 
-std::set<ushort> get_unique_pixel_value(cv::Mat & image)
-{
-  // `image` is a set of ushort.
-  // The purpose is to find the unique set of values contained in `image`.
-  // For example, if `image` is {0,1,2,0,1,2,3}, this function returns {0,1,2,3}.
-
-  if (image.depth() != CV_16U) throw std::runtime_error("image's depth must be ushort");
-
-  auto begin = image.begin<ushort>();
-  auto last = std::unique(begin, image.end<ushort>());
-  std::sort(begin, last);
-  last = std::unique(begin, last);
-  return {begin, last};
-}
-
-pcl::PointCloud<pcl::PointNormal> SegmentFilter::project_lines(
-  const pcl::PointCloud<pcl::PointNormal> & points, const std::set<int> & indices,
-  bool negative) const
+void SegmentFilter::project_lines(
+  const pcl::PointCloud<pcl::PointNormal> & points, const std::vector<uint8_t> & is_reliable,
+  pcl::PointCloud<pcl::PointNormal> & valid_edges,
+  pcl::PointCloud<pcl::PointNormal> & invalid_edges) const
 {
   pcl::PointCloud<pcl::PointNormal> projected_points;
-  for (size_t index = 0; index < points.size(); ++index) {
-    if (negative) {
-      if (indices.count(static_cast<int>(index)) > 0) continue;
-    } else {
-      if (indices.count(static_cast<int>(index)) == 0) continue;
+  projected_points.resize(points.size());
+  std::vector<uint8_t> is_projected(points.size(), 0);
+  cv::parallel_for_(cv::Range(0, static_cast<int>(points.size())), [&](const cv::Range & range) {
+    for (int index = range.start; index < range.end; ++index) {
+      is_projected[index] = project_line(points.at(index), projected_points.at(index));
     }
+  });
 
-    pcl::PointNormal truncated_pn = points.at(index);
-
-    std::optional<Eigen::Vector3f> opt1 = project_func_(truncated_pn.getVector3fMap());
-    std::optional<Eigen::Vector3f> opt2 = project_func_(truncated_pn.getNormalVector3fMap());
-    if (!opt1.has_value()) continue;
-    if (!opt2.has_value()) continue;
-
-    // If line segment has shorter length than config, it is excluded
-    if (min_segment_length_ > 0) {
-      float length = (opt1.value() - opt2.value()).norm();
-      if (length < min_segment_length_) continue;
-    }
-    if (max_lateral_distance_ > 0) {
-      float abs_lateral1 = std::abs(opt1.value().y());
-      float abs_lateral2 = std::abs(opt2.value().y());
-      if (std::min(abs_lateral1, abs_lateral2) > max_lateral_distance_) continue;
-    }
-
-    pcl::PointNormal xyz;
-    xyz.x = opt1->x();
-    xyz.y = opt1->y();
-    xyz.z = opt1->z();
-    xyz.normal_x = opt2->x();
-    xyz.normal_y = opt2->y();
-    xyz.normal_z = opt2->z();
-
-    //
-    pcl::PointNormal truncated_xyz = xyz;
-    if (max_segment_distance_ > 0)
-      if (!is_near_element(xyz, truncated_xyz)) continue;
-
-    projected_points.push_back(truncated_xyz);
+  // Gathered in the order of the input
+  for (size_t index = 0; index < points.size(); ++index) {
+    if (!is_projected[index]) continue;
+    if (is_reliable[index])
+      valid_edges.push_back(projected_points.at(index));
+    else
+      invalid_edges.push_back(projected_points.at(index));
   }
-  return projected_points;
 }
 
-std::set<int> SegmentFilter::filter_by_mask(
-  const cv::Mat & mask, const pcl::PointCloud<pcl::PointNormal> & edges)
+bool SegmentFilter::project_line(const pcl::PointNormal & pn, pcl::PointNormal & projected_pn) const
 {
-  // Create line image and assign different color to each segment.
-  cv::Mat line_image = cv::Mat::zeros(mask.size(), CV_16UC1);
-  for (size_t i = 0; i < edges.size(); i++) {
-    auto & pn = edges.at(i);
-    Eigen::Vector3f p1 = pn.getVector3fMap();
-    Eigen::Vector3f p2 = pn.getNormalVector3fMap();
-    cv::Scalar color = cv::Scalar::all(static_cast<double>(i + 1));
-    cv::line(
-      line_image, cv::Point2i(static_cast<int>(p1.x()), static_cast<int>(p1.y())),
-      cv::Point2i(static_cast<int>(p2.x()), static_cast<int>(p2.y())), color, 1,
-      cv::LineTypes::LINE_4);
+  std::optional<Eigen::Vector3f> opt1 = project_func_(pn.getVector3fMap());
+  std::optional<Eigen::Vector3f> opt2 = project_func_(pn.getNormalVector3fMap());
+  if (!opt1.has_value()) return false;
+  if (!opt2.has_value()) return false;
+
+  // If line segment has shorter length than config, it is excluded
+  if (min_segment_length_ > 0) {
+    float length = (opt1.value() - opt2.value()).norm();
+    if (length < min_segment_length_) return false;
+  }
+  if (max_lateral_distance_ > 0) {
+    float abs_lateral1 = std::abs(opt1.value().y());
+    float abs_lateral2 = std::abs(opt2.value().y());
+    if (std::min(abs_lateral1, abs_lateral2) > max_lateral_distance_) return false;
   }
 
+  pcl::PointNormal xyz;
+  xyz.x = opt1->x();
+  xyz.y = opt1->y();
+  xyz.z = opt1->z();
+  xyz.normal_x = opt2->x();
+  xyz.normal_y = opt2->y();
+  xyz.normal_z = opt2->z();
+
+  //
+  projected_pn = xyz;
+  if (max_segment_distance_ > 0)
+    if (!is_near_element(xyz, projected_pn)) return false;
+  return true;
+}
+
+std::vector<uint8_t> SegmentFilter::filter_by_mask(
+  const cv::Mat & mask, const pcl::PointCloud<pcl::PointNormal> & edges)
+{
   cv::Mat mask_image;
   mask.convertTo(mask_image, CV_16UC1);
-  cv::threshold(mask_image, mask_image, 1, std::numeric_limits<ushort>::max(), cv::THRESH_BINARY);
-
-  // TODO(KYabuuchi) Using boost::geometry is more intuitive.
-  // https://boostjp.github.io/tips/geometry.html#disjoint
-
-  // And operator
-  cv::Mat masked_line;
-  cv::bitwise_and(mask_image, line_image, masked_line);
-  std::set<ushort> pixel_values = get_unique_pixel_value(masked_line);
 
-  // Extract edges within masks
-  std::set<int> reliable_indices;
-  for (size_t i = 0; i < edges.size(); i++) {
-    if (pixel_values.count(i + 1) != 0) reliable_indices.insert(static_cast<int>(i));
-  }
-
-  return reliable_indices;
+  // Each segment is traced over the mask with the same pixels as cv::line draws it, instead of
+  // drawing all the segments into one image, so the segments are checked in parallel and the
+  // tracing stops at the first pixel in the mask.
+  std::vector<uint8_t> is_reliable(edges.size(), 0);
+  cv::parallel_for_(cv::Range(0, static_cast<int>(edges.size())), [&](const cv::Range & range) {
+    for (int i = range.start; i < range.end; ++i) {
+      const auto & pn = edges.at(i);
+      cv::LineIterator iterator(
+        mask_image, cv::Point2i(static_cast<int>(pn.x), static_cast<int>(pn.y)),
+        cv::Point2i(static_cast<int>(pn.normal_x), static_cast<int>(pn.normal_y)),
+        cv::LineTypes::LINE_4, true);
+      for (int k = 0; k < iterator.count; ++k, ++iterator) {
+        if (mask_image.at<ushort>(iterator.pos()) > 1) {
+          is_reliable[i] = 1;
+          break;
+        }
+      }
+    }
+  });
+  return is_reliable;
 }
 
 }  // namespace yabloc::segment_filter
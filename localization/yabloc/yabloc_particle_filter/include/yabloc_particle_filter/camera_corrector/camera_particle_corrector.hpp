@@ -16,6 +16,7 @@
 #define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__CAMERA_PARTICLE_CORRECTOR_HPP_
 
 #include <opencv4/opencv2/core.hpp>
+#include <sophus/geometry.hpp>
 #include <yabloc_particle_filter/correction/abstract_corrector.hpp>
 #include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
 
@@ -30,6 +31,7 @@
 #include <pcl/point_types.h>
 
 #include <utility>
+#include <vector>
 
 namespace yabloc::modularized_particle_filter
 {
@@ -52,6 +54,15 @@ public:
   explicit CameraParticleCorrector(const rclcpp::NodeOptions & options = rclcpp::NodeOptions());
 
 private:
+  // Points sampled every 0.1 m along the line segments, with the tangent and the weight of the
+  // line segment that each point belongs to
+  struct LineSegmentSamples
+  {
+    std::vector<Eigen::Vector3f> positions;
+    std::vector<Eigen::Vector3f> tangents;
+    std::vector<float> weights;
+  };
+
   const float min_prob_;
   const float far_weight_gain_;
   HierarchicalCostMap cost_map_;
@@ -85,8 +96,9 @@ private:
 
   std::pair<LineSegments, LineSegments> split_line_segments(const PointCloud2 & msg);
 
-  float compute_logit(
-    const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
+  static LineSegmentSamples sample_line_segments(const LineSegments & line_segments_cloud);
+
+  float compute_logit(const LineSegmentSamples & samples, const Sophus::SE3f & transform);
 
   pcl::PointCloud<pcl::PointXYZI> evaluate_cloud(
     const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
@@ -29,7 +29,14 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -105,6 +112,7 @@ public:
   using BgPolygon = boost::geometry::model::polygon<BgPoint>;
 
   explicit HierarchicalCostMap(rclcpp::Node * node);
+  ~HierarchicalCostMap();
 
   void set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud);
   void set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud);
@@ -117,6 +125,13 @@ public:
    */
   CostMapValue at(const Eigen::Vector2f & position);
 
+  /**
+   * Build the maps ahead of the pose in the background, so that at() does not have to build them
+   *
+   * @param[in] pose Pose at world frame, whose heading gives the direction to look ahead
+   */
+  void prefetch(const Pose & pose);
+
   MarkerArray show_map_range() const;
 
   cv::Mat get_map_image(const Pose & pose);
@@ -126,25 +141,59 @@ public:
   void set_height(float height);
 
 private:
+  // Inputs of the maps, shared with the prefetch thread
+  struct MapSource
+  {
+    std::shared_ptr<const pcl::PointCloud<pcl::PointNormal>> cloud{nullptr};
+    std::shared_ptr<const std::vector<BgPolygon>> bounding_boxes{nullptr};
+    std::optional<float> height{std::nullopt};
+  };
+
+  struct CostMap
+  {
+    cv::Mat image;
+    std::list<Area>::iterator history_itr;
+  };
+
   const float max_range_;
   const float image_size_;
   const size_t max_map_count_;
   rclcpp::Logger logger_;
-  std::optional<float> height_{std::nullopt};
 
   common::GammaConverter gamma_converter_{4.0f};
 
-  std::unordered_map<Area, bool, Area> map_accessed_;
+  // NOTE: source_ is only written by the main thread and under mutex_
+  MapSource source_;
 
+  // The least recently used map comes first
   std::list<Area> generated_map_history_;
-  std::optional<pcl::PointCloud<pcl::PointNormal>> cloud_;
-  std::vector<BgPolygon> bounding_boxes_;
-  std::unordered_map<Area, cv::Mat, Area> cost_maps_;
+  std::unordered_map<Area, CostMap, Area> cost_maps_;
+
+  // consecutive lookups mostly fall on the same tile, so the tile of the last lookup is kept to
+  // skip the hash lookups
+  std::optional<Area> last_area_{std::nullopt};
+  const cv::Mat * last_cost_map_{nullptr};
+
+  // Prefetch thread. The maps built in the background are handed over through prefetched_maps_,
+  // and are discarded if they were built before the maps are cleared.
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<Area> prefetch_queue_;
+  std::optional<Area> building_area_{std::nullopt};
+  std::unordered_map<Area, cv::Mat, Area> prefetched_maps_;
+  uint64_t generation_{0};
+  bool stop_prefetch_{false};
+  std::thread prefetch_thread_;
 
   cv::Point to_cv_point(const Area & area, const Eigen::Vector2f & p) const;
-  void build_map(const Area & area);
-
-  cv::Mat create_available_area_image(const Area & area) const;
+  cv::Mat build_map(const Area & area, const MapSource & source) const;
+  cv::Mat take_or_build_map(const Area & area);
+  void add_map(const Area & area, cv::Mat image);
+  void clear_maps();
+  void prefetch_loop();
+
+  cv::Mat create_available_area_image(
+    const Area & area, const std::vector<BgPolygon> & bounding_boxes) const;
 };
 }  // namespace yabloc
 
@@ -166,17 +166,17 @@ void CameraParticleCorrector::on_line_segments(const PointCloud2 & line_segments
   }
 
   cost_map_.set_height(static_cast<float>(mean_pose.position.z));
+  cost_map_.prefetch(mean_pose);
 
   if (publish_weighted_particles) {
+    // The line segments are sampled once, and only the samples are transformed for each particle
+    LineSegments all_line_segments_cloud = line_segments_cloud;
+    all_line_segments_cloud += iffy_line_segments_cloud;
+    const LineSegmentSamples samples = sample_line_segments(all_line_segments_cloud);
+
     for (auto & particle : weighted_particles.particles) {
       Sophus::SE3f transform = common::pose_to_se3(particle.pose);
-      LineSegments transformed_line_segments =
-        common::transform_line_segments(line_segments_cloud, transform);
-      LineSegments transformed_iffy_line_segments =
-        common::transform_line_segments(iffy_line_segments_cloud, transform);
-      transformed_line_segments += transformed_iffy_line_segments;
-
-      float logit = compute_logit(transformed_line_segments, transform.translation());
+      float logit = compute_logit(samples, transform);
       particle.weight = logit_to_prob(logit, 0.01f);
     }
 
@@ -264,34 +264,49 @@ float abs_cos(const Eigen::Vector3f & t, float deg)
   return std::abs(x.dot(y));
 }
 
-float CameraParticleCorrector::compute_logit(
-  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
+CameraParticleCorrector::LineSegmentSamples CameraParticleCorrector::sample_line_segments(
+  const LineSegments & line_segments_cloud)
 {
-  float logit = 0;
+  LineSegmentSamples samples;
   for (const LineSegment & pn : line_segments_cloud) {
     const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
     const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
+    // NOTE: posteriori line segments are less reliable than apriori ones
+    const float weight = (pn.label == 0) ? 0.2f : 1.0f;
 
     for (float distance = 0; distance < length; distance += 0.1f) {
-      Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
-
-      // NOTE: Close points are prioritized
-      float squared_norm = (p - self_position).topRows(2).squaredNorm();
-      float gain = std::exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
+      samples.positions.push_back(pn.getVector3fMap() + tangent * distance);
+      samples.tangents.push_back(tangent);
+      samples.weights.push_back(weight);
+    }
+  }
+  return samples;
+}
 
-      const CostMapValue v3 = cost_map_.at(p.topRows(2));
+float CameraParticleCorrector::compute_logit(
+  const LineSegmentSamples & samples, const Sophus::SE3f & transform)
+{
+  const Eigen::Matrix3f rotation = transform.so3().matrix();
+  const Eigen::Vector3f & self_position = transform.translation();
 
-      if (v3.unmapped) {
-        // logit does not change if target pixel is unmapped
-        continue;
-      }
-      if (pn.label == 0) {  // posteriori
-        logit +=
-          0.2f * gain * (abs_cos(tangent, static_cast<float>(v3.angle)) * v3.intensity - 0.5f);
-      } else {  // apriori
-        logit += gain * (abs_cos(tangent, static_cast<float>(v3.angle)) * v3.intensity - 0.5f);
-      }
+  float logit = 0;
+  for (size_t i = 0; i < samples.positions.size(); ++i) {
+    const Eigen::Vector3f relative = rotation * samples.positions[i];
+    const Eigen::Vector3f p = relative + self_position;
+
+    const CostMapValue v3 = cost_map_.at(p.topRows(2));
+    if (v3.unmapped) {
+      // logit does not change if target pixel is unmapped
+      continue;
     }
+
+    // NOTE: Close points are prioritized
+    float squared_norm = relative.topRows(2).squaredNorm();
+    float gain = std::exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
+
+    const Eigen::Vector3f tangent = rotation * samples.tangents[i];
+    logit += samples.weights[i] * gain *
+             (abs_cos(tangent, static_cast<float>(v3.angle)) * v3.intensity - 0.5f);
   }
   return logit;
 }
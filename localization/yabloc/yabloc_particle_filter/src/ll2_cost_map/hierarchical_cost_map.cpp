@@ -22,6 +22,10 @@
 
 #include <boost/geometry/geometry.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 namespace yabloc
 {
 float Area::unit_length = -1;
@@ -29,12 +33,28 @@ float Area::unit_length = -1;
 HierarchicalCostMap::HierarchicalCostMap(rclcpp::Node * node)
 : max_range_(static_cast<float>(node->declare_parameter<float>("max_range"))),
   image_size_(static_cast<float>(node->declare_parameter<int>("image_size"))),
-  max_map_count_(10),
+  max_map_count_(static_cast<size_t>(node->declare_parameter<int>("max_map_count"))),
   logger_(node->get_logger())
 {
   Area::unit_length = max_range_;
   float gamma = static_cast<float>(node->declare_parameter<float>("gamma"));
   gamma_converter_.reset(gamma);
+
+  if (node->declare_parameter<bool>("prefetch_map")) {
+    prefetch_thread_ = std::thread(&HierarchicalCostMap::prefetch_loop, this);
+  }
+}
+
+HierarchicalCostMap::~HierarchicalCostMap()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_prefetch_ = true;
+  }
+  condition_.notify_all();
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
 }
 
 cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vector2f & p) const
@@ -47,62 +67,173 @@ cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vec
 
 CostMapValue HierarchicalCostMap::at(const Eigen::Vector2f & position)
 {
-  if (!cloud_.has_value()) {
+  if (!source_.cloud) {
     return CostMapValue{0.5f, 0, true};
   }
 
   Area key(position);
-  if (cost_maps_.count(key) == 0) {
-    build_map(key);
+  if (!last_area_ || *last_area_ != key) {
+    auto itr = cost_maps_.find(key);
+    if (itr == cost_maps_.end()) {
+      add_map(key, take_or_build_map(key));
+      itr = cost_maps_.find(key);
+    } else {
+      // mark as the most recently used
+      generated_map_history_.splice(
+        generated_map_history_.end(), generated_map_history_, itr->second.history_itr);
+    }
+    last_area_ = key;
+    last_cost_map_ = &itr->second.image;
   }
-  map_accessed_[key] = true;
 
   cv::Point2i tmp = to_cv_point(key, position);
-  cv::Vec3b b3 = cost_maps_.at(key).ptr<cv::Vec3b>(tmp.y)[tmp.x];
+  cv::Vec3b b3 = last_cost_map_->ptr<cv::Vec3b>(tmp.y)[tmp.x];
   return {static_cast<float>(b3[0]) / 255.f, b3[1], b3[2] == 1};
 }
 
+void HierarchicalCostMap::prefetch(const Pose & pose)
+{
+  if (!prefetch_thread_.joinable() || !source_.cloud) return;
+
+  Eigen::Vector2f position;
+  position << static_cast<float>(pose.position.x), static_cast<float>(pose.position.y);
+  const auto yaw = static_cast<float>(2.f * std::atan2(pose.orientation.z, pose.orientation.w));
+  const Eigen::Vector2f heading(std::cos(yaw), std::sin(yaw));
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // hand over the maps built since the last call
+  for (auto & [area, image] : prefetched_maps_) {
+    if (cost_maps_.count(area) == 0) {
+      add_map(area, std::move(image));
+    }
+  }
+  prefetched_maps_.clear();
+
+  // the maps from the current position up to one map size ahead
+  for (int i = 0; i <= 2; i++) {
+    Area area(position + heading * (0.5f * max_range_ * static_cast<float>(i)));
+    if (
+      cost_maps_.count(area) != 0 || building_area_ == area ||
+      std::find(prefetch_queue_.begin(), prefetch_queue_.end(), area) != prefetch_queue_.end()) {
+      continue;
+    }
+    prefetch_queue_.push_back(area);
+  }
+  condition_.notify_all();
+}
+
 void HierarchicalCostMap::set_height(float height)
 {
-  if (height_) {
-    if (std::abs(*height_ - height) > 2) {
-      generated_map_history_.clear();
-      cost_maps_.clear();
-      map_accessed_.clear();
+  if (source_.height) {
+    if (std::abs(*source_.height - height) > 2) {
+      clear_maps();
     }
   }
 
-  height_ = height;
+  std::lock_guard<std::mutex> lock(mutex_);
+  source_.height = height;
 }
 
 void HierarchicalCostMap::set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud)
 {
   if (cloud.empty()) return;
+  auto bounding_boxes = source_.bounding_boxes
+                          ? std::make_shared<std::vector<BgPolygon>>(*source_.bounding_boxes)
+                          : std::make_shared<std::vector<BgPolygon>>();
   BgPolygon poly;
 
   std::optional<uint32_t> last_label = std::nullopt;
   for (const pcl::PointXYZL p : cloud) {
     if (last_label) {
       if ((*last_label) != p.label) {
-        bounding_boxes_.push_back(poly);
+        bounding_boxes->push_back(poly);
         poly.outer().clear();
       }
     }
     poly.outer().push_back(BgPoint(p.x, p.y));
     last_label = p.label;
   }
-  bounding_boxes_.push_back(poly);
+  bounding_boxes->push_back(poly);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  source_.bounding_boxes = bounding_boxes;
 }
 
 void HierarchicalCostMap::set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud)
 {
-  cloud_ = cloud;
+  auto shared_cloud = std::make_shared<const pcl::PointCloud<pcl::PointNormal>>(cloud);
+  std::lock_guard<std::mutex> lock(mutex_);
+  source_.cloud = shared_cloud;
 }
 
-void HierarchicalCostMap::build_map(const Area & area)
+void HierarchicalCostMap::add_map(const Area & area, cv::Mat image)
 {
-  if (!cloud_.has_value()) return;
+  generated_map_history_.push_back(area);
+  cost_maps_[area] = CostMap{std::move(image), std::prev(generated_map_history_.end())};
+}
+
+cv::Mat HierarchicalCostMap::take_or_build_map(const Area & area)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // wait for the prefetch thread if it is building the same map
+    condition_.wait(lock, [this, &area] { return building_area_ != area; });
+
+    auto itr = prefetched_maps_.find(area);
+    if (itr != prefetched_maps_.end()) {
+      cv::Mat image = std::move(itr->second);
+      prefetched_maps_.erase(itr);
+      return image;
+    }
+    prefetch_queue_.erase(
+      std::remove(prefetch_queue_.begin(), prefetch_queue_.end(), area), prefetch_queue_.end());
+  }
 
+  return build_map(area, source_);
+}
+
+void HierarchicalCostMap::clear_maps()
+{
+  generated_map_history_.clear();
+  cost_maps_.clear();
+  last_area_ = std::nullopt;
+  last_cost_map_ = nullptr;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  prefetch_queue_.clear();
+  prefetched_maps_.clear();
+  // the map being built in the background is discarded when it is done
+  generation_++;
+}
+
+void HierarchicalCostMap::prefetch_loop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this] { return stop_prefetch_ || !prefetch_queue_.empty(); });
+    if (stop_prefetch_) return;
+
+    const Area area = prefetch_queue_.front();
+    prefetch_queue_.pop_front();
+    building_area_ = area;
+    const MapSource source = source_;
+    const uint64_t generation = generation_;
+
+    lock.unlock();
+    cv::Mat image = build_map(area, source);
+    lock.lock();
+
+    if (generation == generation_) {
+      prefetched_maps_[area] = std::move(image);
+    }
+    building_area_ = std::nullopt;
+    condition_.notify_all();
+  }
+}
+
+cv::Mat HierarchicalCostMap::build_map(const Area & area, const MapSource & source) const
+{
   cv::Mat image =
     255 *
     cv::Mat::ones(cv::Size(static_cast<int>(image_size_), static_cast<int>(image_size_)), CV_8UC1);
@@ -114,10 +245,10 @@ void HierarchicalCostMap::build_map(const Area & area)
   };
 
   // TODO(KYabuuchi) We can speed up by skipping too far line_segments
-  for (const auto pn : cloud_.value()) {
-    if (height_) {
-      if (std::abs(pn.z - *height_) > 4) continue;
-      if (std::abs(pn.normal_z - *height_) > 4) continue;
+  for (const auto pn : *source.cloud) {
+    if (source.height) {
+      if (std::abs(pn.z - *source.height) > 4) continue;
+      if (std::abs(pn.normal_z - *source.height) > 4) continue;
     }
 
     cv::Point2i from = cv_point(pn.getVector3fMap());
@@ -141,18 +272,18 @@ void HierarchicalCostMap::build_map(const Area & area)
   cv::Mat whole_orientation = direct_cost_map(orientation, image);
 
   // channel-3
-  cv::Mat available_area = create_available_area_image(area);
+  cv::Mat available_area = source.bounding_boxes
+                             ? create_available_area_image(area, *source.bounding_boxes)
+                             : create_available_area_image(area, {});
 
   cv::Mat directed_cost_map;
   cv::merge(
     std::vector<cv::Mat>{gamma_converter_(distance), whole_orientation, available_area},
     directed_cost_map);
 
-  cost_maps_[area] = directed_cost_map;
-  generated_map_history_.push_back(area);
-
   RCLCPP_INFO_STREAM(
     logger_, "succeeded to build map " << area(area) << " " << area.real_scale().transpose());
+  return directed_cost_map;
 }
 
 HierarchicalCostMap::MarkerArray HierarchicalCostMap::show_map_range() const
@@ -229,25 +360,24 @@ cv::Mat HierarchicalCostMap::get_map_image(const Pose & pose)
 
 void HierarchicalCostMap::erase_obsolete()
 {
-  if (cost_maps_.size() < max_map_count_) return;
-
-  for (auto itr = generated_map_history_.begin(); itr != generated_map_history_.end();) {
-    if (map_accessed_[*itr]) {
-      ++itr;
-      continue;
+  // the least recently used maps are erased first
+  while (cost_maps_.size() > max_map_count_) {
+    const Area oldest = generated_map_history_.front();
+    if (last_area_ && *last_area_ == oldest) {
+      last_area_ = std::nullopt;
+      last_cost_map_ = nullptr;
     }
-    cost_maps_.erase(*itr);
-    itr = generated_map_history_.erase(itr);
+    cost_maps_.erase(oldest);
+    generated_map_history_.pop_front();
   }
-
-  map_accessed_.clear();
 }
 
-cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) const
+cv::Mat HierarchicalCostMap::create_available_area_image(
+  const Area & area, const std::vector<BgPolygon> & bounding_boxes) const
 {
   cv::Mat available_area =
     cv::Mat::zeros(cv::Size(static_cast<int>(image_size_), static_cast<int>(image_size_)), CV_8UC1);
-  if (bounding_boxes_.empty()) return available_area;
+  if (bounding_boxes.empty()) return available_area;
 
   // Define current area
   using BgBox = boost::geometry::model::box<BgPoint>;
@@ -259,7 +389,7 @@ cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) cons
 
   std::vector<std::vector<cv::Point2i>> contours;
 
-  for (const BgPolygon & box : bounding_boxes_) {
+  for (const BgPolygon & box : bounding_boxes) {
     if (boost::geometry::disjoint(area_polygon, box)) {
       continue;
     }
@@ -0,0 +1,64 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef AUTOWARE__LANELET2_MAP_CACHE__LANELET2_MAP_CACHE_HPP_
+#define AUTOWARE__LANELET2_MAP_CACHE__LANELET2_MAP_CACHE_HPP_
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_routing/Forward.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+#include <string>
+
+namespace autoware::lanelet2_map_cache
+{
+/**
+ * @brief map, traffic rules and routing graph deserialized from a map message
+ * @note They are shared by every node of the process that gets the same map message, so they must
+ * not be modified.
+ */
+struct LaneletMapData
+{
+  lanelet::LaneletMapPtr map;
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules;
+  lanelet::routing::RoutingGraphPtr routing_graph;
+};
+
+/**
+ * @brief get the map of the message, which is only deserialized if no node of the process holds
+ * the map of the same message yet
+ * @details The traffic rules and the routing graph are the ones for vehicles, as given by
+ * lanelet::utils::conversion::fromBinMsg(). The centerlines of the lanelets are computed in
+ * advance, so that the nodes sharing the map do not compute them concurrently.
+ * @param [in] msg map message
+ * @return the map, traffic rules and routing graph of the message
+ */
+LaneletMapData from_bin_msg(const autoware_map_msgs::msg::LaneletMapBin & msg);
+
+/**
+ * @brief get the routing graph of the map for a road user, which is only built if no node of the
+ * process holds it yet
+ * @param [in] map map given by from_bin_msg()
+ * @param [in] participant road user of the traffic rules, e.g. lanelet::Participants::Pedestrian
+ * @return routing graph for the road user
+ */
+lanelet::routing::RoutingGraphConstPtr get_routing_graph(
+  const lanelet::LaneletMapConstPtr & map, const std::string & participant);
+
+}  // namespace autoware::lanelet2_map_cache
+
+#endif  // AUTOWARE__LANELET2_MAP_CACHE__LANELET2_MAP_CACHE_HPP_
@@ -0,0 +1,133 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/lanelet2_map_cache/lanelet2_map_cache.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+
+namespace autoware::lanelet2_map_cache
+{
+namespace
+{
+// NOTE: The cache only holds weak references, so that a map is released once no node uses it
+struct CachedMap
+{
+  std::weak_ptr<lanelet::LaneletMap> map;
+  std::weak_ptr<lanelet::traffic_rules::TrafficRules> traffic_rules;
+  std::weak_ptr<lanelet::routing::RoutingGraph> routing_graph;
+};
+
+struct CachedRoutingGraph
+{
+  std::weak_ptr<const lanelet::LaneletMap> map;
+  std::weak_ptr<const lanelet::routing::RoutingGraph> routing_graph;
+};
+
+// the maps are keyed by the size and the hash of the serialized map
+using MapKey = std::pair<size_t, size_t>;
+// the routing graphs are keyed by the map and the road user
+using RoutingGraphKey = std::pair<const lanelet::LaneletMap *, std::string>;
+
+std::mutex cache_mutex;
+std::map<MapKey, CachedMap> cached_maps;
+std::map<RoutingGraphKey, CachedRoutingGraph> cached_routing_graphs;
+
+MapKey to_map_key(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  const std::string_view data(reinterpret_cast<const char *>(msg.data.data()), msg.data.size());
+  return {msg.data.size(), std::hash<std::string_view>{}(data)};
+}
+
+template <typename CacheT>
+void erase_expired(CacheT & cache)
+{
+  for (auto itr = cache.begin(); itr != cache.end();) {
+    if (itr->second.map.expired()) {
+      itr = cache.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+}
+}  // namespace
+
+LaneletMapData from_bin_msg(const autoware_map_msgs::msg::LaneletMapBin & msg)
+{
+  const MapKey key = to_map_key(msg);
+
+  // NOTE: The lock is held while the map is deserialized, so that the other nodes wait for it
+  // instead of deserializing the same map
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  erase_expired(cached_maps);
+  erase_expired(cached_routing_graphs);
+
+  const auto itr = cached_maps.find(key);
+  if (itr != cached_maps.end()) {
+    LaneletMapData map_data{
+      itr->second.map.lock(), itr->second.traffic_rules.lock(), itr->second.routing_graph.lock()};
+    if (map_data.map && map_data.traffic_rules && map_data.routing_graph) {
+      return map_data;
+    }
+  }
+
+  LaneletMapData map_data;
+  map_data.map = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(
+    msg, map_data.map, &map_data.traffic_rules, &map_data.routing_graph);
+  // centerlines are computed on their first use
+  for (const auto & lanelet : map_data.map->laneletLayer) {
+    lanelet.centerline();
+  }
+
+  cached_maps[key] = CachedMap{map_data.map, map_data.traffic_rules, map_data.routing_graph};
+  return map_data;
+}
+
+lanelet::routing::RoutingGraphConstPtr get_routing_graph(
+  const lanelet::LaneletMapConstPtr & map, const std::string & participant)
+{
+  const RoutingGraphKey key{map.get(), participant};
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  erase_expired(cached_routing_graphs);
+
+  const auto itr = cached_routing_graphs.find(key);
+  if (itr != cached_routing_graphs.end()) {
+    if (auto routing_graph = itr->second.routing_graph.lock()) {
+      return routing_graph;
+    }
+  }
+
+  const auto traffic_rules =
+    lanelet::traffic_rules::TrafficRulesFactory::create(lanelet::Locations::Germany, participant);
+  lanelet::routing::RoutingGraphConstPtr routing_graph =
+    lanelet::routing::RoutingGraph::build(*map, *traffic_rules);
+
+  cached_routing_graphs[key] = CachedRoutingGraph{map, routing_graph};
+  return routing_graph;
+}
+
+}  // namespace autoware::lanelet2_map_cache
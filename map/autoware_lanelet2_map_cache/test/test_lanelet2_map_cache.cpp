@@ -0,0 +1,99 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/lanelet2_map_cache/lanelet2_map_cache.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+namespace
+{
+autoware_map_msgs::msg::LaneletMapBin create_map_msg(const double length)
+{
+  lanelet::LineString3d left_bound(
+    lanelet::utils::getId(),
+    {lanelet::Point3d(lanelet::utils::getId(), 0.0, 2.0, 0.0),
+     lanelet::Point3d(lanelet::utils::getId(), length, 2.0, 0.0)});
+  lanelet::LineString3d right_bound(
+    lanelet::utils::getId(),
+    {lanelet::Point3d(lanelet::utils::getId(), 0.0, -2.0, 0.0),
+     lanelet::Point3d(lanelet::utils::getId(), length, -2.0, 0.0)});
+  lanelet::Lanelet lanelet(lanelet::utils::getId(), left_bound, right_bound);
+  lanelet.setAttribute(lanelet::AttributeName::Subtype, lanelet::AttributeValueString::Road);
+
+  lanelet::LaneletMapPtr map = lanelet::utils::createMap({lanelet});
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(map, &msg);
+  return msg;
+}
+}  // namespace
+
+TEST(lanelet2_map_cache, from_bin_msg)
+{
+  using autoware::lanelet2_map_cache::from_bin_msg;
+
+  const auto msg = create_map_msg(10.0);
+  const auto map_data = from_bin_msg(msg);
+  ASSERT_NE(map_data.map, nullptr);
+  ASSERT_NE(map_data.traffic_rules, nullptr);
+  ASSERT_NE(map_data.routing_graph, nullptr);
+  EXPECT_EQ(map_data.map->laneletLayer.size(), 1u);
+
+  // the same message received by another node gives the same map
+  const autoware_map_msgs::msg::LaneletMapBin same_msg = msg;
+  const auto same_map_data = from_bin_msg(same_msg);
+  EXPECT_EQ(same_map_data.map, map_data.map);
+  EXPECT_EQ(same_map_data.traffic_rules, map_data.traffic_rules);
+  EXPECT_EQ(same_map_data.routing_graph, map_data.routing_graph);
+
+  // another message gives another map
+  const auto other_map_data = from_bin_msg(create_map_msg(20.0));
+  EXPECT_NE(other_map_data.map, map_data.map);
+  EXPECT_NE(other_map_data.routing_graph, map_data.routing_graph);
+}
+
+TEST(lanelet2_map_cache, map_is_released)
+{
+  using autoware::lanelet2_map_cache::from_bin_msg;
+
+  const auto msg = create_map_msg(30.0);
+  std::weak_ptr<lanelet::LaneletMap> weak_map = from_bin_msg(msg).map;
+  // the cache does not keep the map alive
+  EXPECT_TRUE(weak_map.expired());
+
+  const auto map_data = from_bin_msg(msg);
+  EXPECT_NE(map_data.map, nullptr);
+  EXPECT_EQ(map_data.map->laneletLayer.size(), 1u);
+}
+
+TEST(lanelet2_map_cache, get_routing_graph)
+{
+  using autoware::lanelet2_map_cache::from_bin_msg;
+  using autoware::lanelet2_map_cache::get_routing_graph;
+
+  const auto map_data = from_bin_msg(create_map_msg(40.0));
+  const auto pedestrian_graph = get_routing_graph(map_data.map, lanelet::Participants::Pedestrian);
+  ASSERT_NE(pedestrian_graph, nullptr);
+  EXPECT_EQ(get_routing_graph(map_data.map, lanelet::Participants::Pedestrian), pedestrian_graph);
+
+  const auto vehicle_graph = get_routing_graph(map_data.map, lanelet::Participants::Vehicle);
+  ASSERT_NE(vehicle_graph, nullptr);
+  EXPECT_NE(vehicle_graph, pedestrian_graph);
+}
@@ -22,6 +22,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace autoware::map_height_fitter
 {
@@ -38,6 +39,13 @@ public:
   MapHeightFitter(MapHeightFitter &&) = delete;
   MapHeightFitter & operator=(MapHeightFitter &&) = delete;
   std::optional<Point> fit(const Point & position, const std::string & frame);
+  /**
+   * @brief fit the heights of the positions at once, reusing the transforms and the loaded map
+   * @return fitted positions in the same order, or nullopt if the map or the transforms are not
+   * available
+   */
+  std::optional<std::vector<Point>> fit(
+    const std::vector<Point> & positions, const std::string & frame);
 
 private:
   struct Impl;
@@ -0,0 +1,164 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ground_height_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace autoware::map_height_fitter
+{
+
+namespace
+{
+uint64_t to_key(const int64_t index_x, const int64_t index_y)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(index_x)) << 32) |
+         static_cast<uint32_t>(index_y);
+}
+}  // namespace
+
+GroundHeightGrid::GroundHeightGrid(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud, const double cell_size)
+: cell_size_(cell_size)
+{
+  std::vector<std::pair<uint64_t, uint32_t>> keys;
+  keys.reserve(cloud.size());
+  for (uint32_t i = 0; i < cloud.size(); ++i) {
+    const auto & p = cloud.points[i];
+    if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) continue;
+    const int64_t index_x = to_index(p.x);
+    const int64_t index_y = to_index(p.y);
+    if (keys.empty()) {
+      min_index_x_ = max_index_x_ = index_x;
+      min_index_y_ = max_index_y_ = index_y;
+    }
+    min_index_x_ = std::min(min_index_x_, index_x);
+    min_index_y_ = std::min(min_index_y_, index_y);
+    max_index_x_ = std::max(max_index_x_, index_x);
+    max_index_y_ = std::max(max_index_y_, index_y);
+    keys.emplace_back(to_key(index_x, index_y), i);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  points_.reserve(keys.size());
+  for (const auto & [key, point_index] : keys) {
+    const auto & p = cloud.points[point_index];
+    const auto begin = static_cast<uint32_t>(points_.size());
+    auto & cell = cells_.try_emplace(key, Cell{begin, begin, p.z}).first->second;
+    cell.end = begin + 1;
+    cell.min_z = std::min(cell.min_z, p.z);
+    points_.push_back(p);
+  }
+}
+
+std::optional<double> GroundHeightGrid::get_ground_height(const double x, const double y) const
+{
+  if (points_.empty()) {
+    return std::nullopt;
+  }
+
+  const auto distance2 = [x, y](const pcl::PointXYZ & p) {
+    const double dx = x - p.x;
+    const double dy = y - p.y;
+    return (dx * dx) + (dy * dy);
+  };
+
+  // find distance d to closest point, ring by ring of cells around the query
+  // a point in the ring r is at least (r - 1) * cell_size_ away
+  const int64_t center_x = to_index(x);
+  const int64_t center_y = to_index(y);
+  const int64_t max_ring = std::max(
+    {std::abs(center_x - min_index_x_), std::abs(center_x - max_index_x_),
+     std::abs(center_y - min_index_y_), std::abs(center_y - max_index_y_)});
+  double min_dist2 = std::numeric_limits<double>::infinity();
+  for (int64_t ring = 0; ring <= max_ring; ++ring) {
+    const double ring_distance = static_cast<double>(ring - 1) * cell_size_;
+    if (ring_distance > 0.0 && ring_distance * ring_distance > min_dist2) {
+      break;
+    }
+    const auto visit_cell = [&](const int64_t index_x, const int64_t index_y) {
+      if (const auto * cell = find_cell(index_x, index_y)) {
+        for (uint32_t i = cell->begin; i < cell->end; ++i) {
+          min_dist2 = std::min(min_dist2, distance2(points_[i]));
+        }
+      }
+    };
+    // only the cells of the ring within the bounds of the points
+    const int64_t first_x = std::max(center_x - ring, min_index_x_);
+    const int64_t last_x = std::min(center_x + ring, max_index_x_);
+    const int64_t first_y = std::max(center_y - ring, min_index_y_);
+    const int64_t last_y = std::min(center_y + ring, max_index_y_);
+    for (int64_t index_y = first_y; index_y <= last_y; ++index_y) {
+      if (std::abs(index_y - center_y) == ring) {
+        for (int64_t index_x = first_x; index_x <= last_x; ++index_x) {
+          visit_cell(index_x, index_y);
+        }
+        continue;
+      }
+      if (center_x - ring >= first_x) visit_cell(center_x - ring, index_y);
+      if (center_x + ring <= last_x) visit_cell(center_x + ring, index_y);
+    }
+  }
+
+  // find lowest height within radius (d+1.0)
+  const double radius = std::sqrt(min_dist2) + 1.0;
+  const double radius2 = radius * radius;
+  double height = std::numeric_limits<double>::infinity();
+  const int64_t first_x = std::max(to_index(x - radius), min_index_x_);
+  const int64_t last_x = std::min(to_index(x + radius), max_index_x_);
+  const int64_t first_y = std::max(to_index(y - radius), min_index_y_);
+  const int64_t last_y = std::min(to_index(y + radius), max_index_y_);
+  for (int64_t index_y = first_y; index_y <= last_y; ++index_y) {
+    for (int64_t index_x = first_x; index_x <= last_x; ++index_x) {
+      const auto * cell = find_cell(index_x, index_y);
+      if (!cell || cell->min_z >= height) continue;
+
+      // the cell is within the radius if its farthest corner is
+      const double cell_min_x = static_cast<double>(index_x) * cell_size_;
+      const double cell_min_y = static_cast<double>(index_y) * cell_size_;
+      const double far_dx = std::max(x - cell_min_x, cell_min_x + cell_size_ - x);
+      const double far_dy = std::max(y - cell_min_y, cell_min_y + cell_size_ - y);
+      if (far_dx * far_dx + far_dy * far_dy < radius2) {
+        height = cell->min_z;
+        continue;
+      }
+      for (uint32_t i = cell->begin; i < cell->end; ++i) {
+        if (distance2(points_[i]) < radius2) {
+          height = std::min(height, static_cast<double>(points_[i].z));
+        }
+      }
+    }
+  }
+  if (!std::isfinite(height)) {
+    return std::nullopt;
+  }
+  return height;
+}
+
+int64_t GroundHeightGrid::to_index(const double value) const
+{
+  return static_cast<int64_t>(std::floor(value / cell_size_));
+}
+
+const GroundHeightGrid::Cell * GroundHeightGrid::find_cell(
+  const int64_t index_x, const int64_t index_y) const
+{
+  const auto cell_itr = cells_.find(to_key(index_x, index_y));
+  return cell_itr == cells_.end() ? nullptr : &cell_itr->second;
+}
+
+}  // namespace autoware::map_height_fitter
@@ -0,0 +1,67 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GROUND_HEIGHT_GRID_HPP_
+#define GROUND_HEIGHT_GRID_HPP_
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::map_height_fitter
+{
+
+/**
+ * @brief 2D grid of the map points, sorted by cell, to find the ground height without scanning the
+ * whole map
+ */
+class GroundHeightGrid
+{
+public:
+  explicit GroundHeightGrid(const pcl::PointCloud<pcl::PointXYZ> & cloud, double cell_size = 1.0);
+
+  /**
+   * @brief lowest height of the points within 1 m beyond the closest point in 2D, or nullopt if the
+   * grid has no point
+   */
+  std::optional<double> get_ground_height(double x, double y) const;
+
+private:
+  struct Cell
+  {
+    uint32_t begin;
+    uint32_t end;
+    float min_z;
+  };
+
+  int64_t to_index(double value) const;
+  const Cell * find_cell(int64_t index_x, int64_t index_y) const;
+
+  double cell_size_;
+  // the points of a cell are points_[begin, end)
+  std::vector<pcl::PointXYZ> points_;
+  std::unordered_map<uint64_t, Cell> cells_;
+  int64_t min_index_x_{0};
+  int64_t min_index_y_{0};
+  int64_t max_index_x_{-1};
+  int64_t max_index_y_{-1};
+};
+
+}  // namespace autoware::map_height_fitter
+
+#endif  // GROUND_HEIGHT_GRID_HPP_
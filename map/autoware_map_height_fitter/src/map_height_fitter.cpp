@@ -14,6 +14,8 @@
 
 #include "autoware/map_height_fitter/map_height_fitter.hpp"
 
+#include "ground_height_grid.hpp"
+
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
 
@@ -29,7 +31,10 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <cmath>
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace autoware::map_height_fitter
 {
@@ -37,13 +42,19 @@ namespace autoware::map_height_fitter
 struct MapHeightFitter::Impl
 {
   static constexpr char enable_partial_load[] = "enable_partial_load";
+  // the partial map is reused for the points within the loaded area minus the margin
+  static constexpr float partial_load_radius = 50.0f;
+  static constexpr float partial_load_margin = 10.0f;
 
   explicit Impl(rclcpp::Node * node);
   void on_pcd_map(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg);
   void on_vector_map(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg);
   bool get_partial_point_cloud_map(const Point & point);
+  bool is_partial_point_cloud_map_loaded(const Point & point) const;
+  bool prepare_map(const Point & position);
   double get_ground_height(const Point & point) const;
-  std::optional<Point> fit(const Point & position, const std::string & frame);
+  std::optional<std::vector<Point>> fit(
+    const std::vector<Point> & positions, const std::string & frame);
 
   tf2::BufferCore tf2_buffer_;
   tf2_ros::TransformListener tf2_listener_;
@@ -54,7 +65,8 @@ struct MapHeightFitter::Impl
 
   // for fitting by pointcloud_map_loader
   rclcpp::CallbackGroup::SharedPtr group_;
-  pcl::PointCloud<pcl::PointXYZ>::Ptr map_cloud_;
+  std::unique_ptr<GroundHeightGrid> map_grid_;
+  std::optional<autoware_map_msgs::msg::AreaInfo> loaded_area_;
   rclcpp::Client<autoware_map_msgs::srv::GetPartialPointCloudMap>::SharedPtr cli_pcd_map_;
   rclcpp::Subscription<sensor_msgs::msg::PointCloud2>::SharedPtr sub_pcd_map_;
   rclcpp::AsyncParametersClient::SharedPtr params_pcd_map_loader_;
@@ -109,8 +121,9 @@ MapHeightFitter::Impl::Impl(rclcpp::Node * node) : tf2_listener_(tf2_buffer_), n
 void MapHeightFitter::Impl::on_pcd_map(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
   map_frame_ = msg->header.frame_id;
-  map_cloud_ = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
-  pcl::fromROSMsg(*msg, *map_cloud_);
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(*msg, map_cloud);
+  map_grid_ = std::make_unique<GroundHeightGrid>(map_cloud);
 }
 
 bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
@@ -129,7 +142,7 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
   const auto req = std::make_shared<autoware_map_msgs::srv::GetPartialPointCloudMap::Request>();
   req->area.center_x = static_cast<float>(point.x);
   req->area.center_y = static_cast<float>(point.y);
-  req->area.radius = 50;
+  req->area.radius = partial_load_radius;
 
   RCLCPP_DEBUG(logger, "Send request to map_loader");
   auto future = cli_pcd_map_->async_send_request(req);
@@ -159,11 +172,23 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
     }
   }
   map_frame_ = res->header.frame_id;
-  map_cloud_ = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
-  pcl::fromROSMsg(pcd_msg, *map_cloud_);
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(pcd_msg, map_cloud);
+  map_grid_ = std::make_unique<GroundHeightGrid>(map_cloud);
+  loaded_area_ = req->area;
   return true;
 }
 
+bool MapHeightFitter::Impl::is_partial_point_cloud_map_loaded(const Point & point) const
+{
+  if (!loaded_area_ || !map_grid_) {
+    return false;
+  }
+  const double distance =
+    std::hypot(point.x - loaded_area_->center_x, point.y - loaded_area_->center_y);
+  return distance + partial_load_margin <= loaded_area_->radius;
+}
+
 void MapHeightFitter::Impl::on_vector_map(
   const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg)
 {
@@ -181,26 +206,7 @@ double MapHeightFitter::Impl::get_ground_height(const Point & point) const
 
   double height = INFINITY;
   if (fit_target_ == "pointcloud_map") {
-    // find distance d to closest point
-    double min_dist2 = INFINITY;
-    for (const auto & p : map_cloud_->points) {
-      const double dx = x - p.x;
-      const double dy = y - p.y;
-      const double sd = (dx * dx) + (dy * dy);
-      min_dist2 = std::min(min_dist2, sd);
-    }
-
-    // find lowest height within radius (d+1.0)
-    const double radius2 = std::pow(std::sqrt(min_dist2) + 1.0, 2.0);
-
-    for (const auto & p : map_cloud_->points) {
-      const double dx = x - p.x;
-      const double dy = y - p.y;
-      const double sd = (dx * dx) + (dy * dy);
-      if (sd < radius2) {
-        height = std::min(height, static_cast<double>(p.z));
-      }
-    }
+    height = map_grid_->get_ground_height(x, y).value_or(INFINITY);
   } else if (fit_target_ == "vector_map") {
     const auto closest_points = vector_map_->pointLayer.nearest(lanelet::BasicPoint2d{x, y}, 1);
     if (closest_points.empty()) {
@@ -213,64 +219,82 @@ double MapHeightFitter::Impl::get_ground_height(const Point & point) const
   return std::isfinite(height) ? height : point.z;
 }
 
-std::optional<Point> MapHeightFitter::Impl::fit(const Point & position, const std::string & frame)
+bool MapHeightFitter::Impl::prepare_map(const Point & position)
 {
   const auto logger = node_->get_logger();
-  RCLCPP_INFO_STREAM(logger, "fit_target: " << fit_target_ << ", frame: " << frame);
-
-  Point point;
-  point.x = position.x;
-  point.y = position.y;
-  point.z = position.z;
-
-  RCLCPP_DEBUG(logger, "original point: %.3f %.3f %.3f", point.x, point.y, point.z);
 
-  // prepare data
   if (fit_target_ == "pointcloud_map") {
-    if (cli_pcd_map_) {  // if cli_pcd_map_ is available, prepare pointcloud map by partial loading
+    // if cli_pcd_map_ is available, prepare pointcloud map by partial loading
+    if (cli_pcd_map_ && !is_partial_point_cloud_map_loaded(position)) {
       if (!get_partial_point_cloud_map(position)) {
         RCLCPP_WARN_STREAM(logger, "failed to get partial point cloud map");
-        return std::nullopt;
+        return false;
       }
     }  // otherwise, pointcloud map should be already prepared by on_pcd_map
-    if (!map_cloud_) {
+    if (!map_grid_) {
       RCLCPP_WARN_STREAM(logger, "point cloud map is not ready");
-      return std::nullopt;
+      return false;
     }
   } else if (fit_target_ == "vector_map") {
     // vector_map_ should be already prepared by on_vector_map
     if (!vector_map_) {
       RCLCPP_WARN_STREAM(logger, "vector map is not ready");
-      return std::nullopt;
+      return false;
     }
   } else {
     throw std::runtime_error("invalid fit_target");
   }
+  return true;
+}
 
-  // transform frame to map_frame_
-  try {
-    const auto stamped = tf2_buffer_.lookupTransform(frame, map_frame_, tf2::TimePointZero);
-    tf2::doTransform(point, point, stamped);
-  } catch (tf2::TransformException & exception) {
-    RCLCPP_WARN_STREAM(logger, "failed to lookup transform: " << exception.what());
-    return std::nullopt;
-  }
+std::optional<std::vector<Point>> MapHeightFitter::Impl::fit(
+  const std::vector<Point> & positions, const std::string & frame)
+{
+  const auto logger = node_->get_logger();
+  RCLCPP_INFO_STREAM(logger, "fit_target: " << fit_target_ << ", frame: " << frame);
 
-  // fit height on map_frame_
-  point.z = get_ground_height(point);
+  std::optional<geometry_msgs::msg::TransformStamped> frame_to_map;
+  std::optional<geometry_msgs::msg::TransformStamped> map_to_frame;
+  std::vector<Point> points;
+  points.reserve(positions.size());
+  for (const auto & position : positions) {
+    Point point;
+    point.x = position.x;
+    point.y = position.y;
+    point.z = position.z;
 
-  // transform map_frame_ to frame
-  try {
-    const auto stamped = tf2_buffer_.lookupTransform(map_frame_, frame, tf2::TimePointZero);
-    tf2::doTransform(point, point, stamped);
-  } catch (tf2::TransformException & exception) {
-    RCLCPP_WARN_STREAM(logger, "failed to lookup transform: " << exception.what());
-    return std::nullopt;
-  }
+    RCLCPP_DEBUG(logger, "original point: %.3f %.3f %.3f", point.x, point.y, point.z);
+
+    // prepare data
+    if (!prepare_map(position)) {
+      return std::nullopt;
+    }
+
+    // the transforms are looked up once per call, after the map frame is known
+    if (!frame_to_map) {
+      try {
+        frame_to_map = tf2_buffer_.lookupTransform(frame, map_frame_, tf2::TimePointZero);
+        map_to_frame = tf2_buffer_.lookupTransform(map_frame_, frame, tf2::TimePointZero);
+      } catch (tf2::TransformException & exception) {
+        RCLCPP_WARN_STREAM(logger, "failed to lookup transform: " << exception.what());
+        return std::nullopt;
+      }
+    }
+
+    // transform frame to map_frame_
+    tf2::doTransform(point, point, *frame_to_map);
 
-  RCLCPP_DEBUG(logger, "modified point: %.3f %.3f %.3f", point.x, point.y, point.z);
+    // fit height on map_frame_
+    point.z = get_ground_height(point);
 
-  return point;
+    // transform map_frame_ to frame
+    tf2::doTransform(point, point, *map_to_frame);
+
+    RCLCPP_DEBUG(logger, "modified point: %.3f %.3f %.3f", point.x, point.y, point.z);
+
+    points.push_back(point);
+  }
+  return points;
 }
 
 MapHeightFitter::MapHeightFitter(rclcpp::Node * node)
@@ -282,7 +306,17 @@ MapHeightFitter::~MapHeightFitter() = default;
 
 std::optional<Point> MapHeightFitter::fit(const Point & position, const std::string & frame)
 {
-  return impl_->fit(position, frame);
+  const auto points = impl_->fit({position}, frame);
+  if (!points) {
+    return std::nullopt;
+  }
+  return points->front();
+}
+
+std::optional<std::vector<Point>> MapHeightFitter::fit(
+  const std::vector<Point> & positions, const std::string & frame)
+{
+  return impl_->fit(positions, frame);
 }
 
 }  // namespace autoware::map_height_fitter
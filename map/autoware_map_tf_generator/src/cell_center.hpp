@@ -0,0 +1,45 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CELL_CENTER_HPP_
+#define CELL_CENTER_HPP_
+
+#include <autoware_map_msgs/msg/point_cloud_map_meta_data.hpp>
+
+#include <optional>
+#include <utility>
+
+namespace autoware::map_tf_generator
+{
+// mean of the centers of the pointcloud map cells, which is close to the center of the points
+// without loading them, since the cells are usually filled with points
+std::optional<std::pair<double, double>> inline mean_of_cell_centers(
+  const autoware_map_msgs::msg::PointCloudMapMetaData & metadata)
+{
+  if (metadata.metadata_list.empty()) {
+    return std::nullopt;
+  }
+
+  double x = 0.0;
+  double y = 0.0;
+  for (const auto & cell : metadata.metadata_list) {
+    x += (cell.metadata.min_x + cell.metadata.max_x) / 2.0;
+    y += (cell.metadata.min_y + cell.metadata.max_y) / 2.0;
+  }
+  const auto n = static_cast<double>(metadata.metadata_list.size());
+  return std::make_pair(x / n, y / n);
+}
+}  // namespace autoware::map_tf_generator
+
+#endif  // CELL_CENTER_HPP_
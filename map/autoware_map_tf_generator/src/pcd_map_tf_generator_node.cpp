@@ -12,10 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "cell_center.hpp"
 #include "uniform_random.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <autoware_map_msgs/msg/point_cloud_map_meta_data.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
 #include <pcl/point_cloud.h>
@@ -44,6 +46,11 @@ public:
     sub_ = create_subscription<sensor_msgs::msg::PointCloud2>(
       "pointcloud_map", rclcpp::QoS{1}.transient_local(),
       std::bind(&PcdMapTFGeneratorNode::on_point_cloud, this, std::placeholders::_1));
+    // the metadata is published before the points are loaded, so the viewer frame is broadcast from
+    // the cells first and moved to the center of the points when they arrive
+    sub_metadata_ = create_subscription<autoware_map_msgs::msg::PointCloudMapMetaData>(
+      "pointcloud_map_metadata", rclcpp::QoS{1}.transient_local(),
+      std::bind(&PcdMapTFGeneratorNode::on_metadata, this, std::placeholders::_1));
 
     static_broadcaster_ = std::make_shared<tf2_ros::StaticTransformBroadcaster>(this);
   }
@@ -52,11 +59,24 @@ private:
   std::string map_frame_;
   std::string viewer_frame_;
   rclcpp::Subscription<sensor_msgs::msg::PointCloud2>::SharedPtr sub_;
+  rclcpp::Subscription<autoware_map_msgs::msg::PointCloudMapMetaData>::SharedPtr sub_metadata_;
 
   std::shared_ptr<tf2_ros::StaticTransformBroadcaster> static_broadcaster_;
 
+  void on_metadata(const autoware_map_msgs::msg::PointCloudMapMetaData::ConstSharedPtr metadata)
+  {
+    const auto center = mean_of_cell_centers(*metadata);
+    if (!center) {
+      return;
+    }
+    // the cells have no height
+    broadcast(center->first, center->second, 0.0);
+  }
+
   void on_point_cloud(const sensor_msgs::msg::PointCloud2::ConstSharedPtr clouds_ros)
   {
+    sub_metadata_.reset();
+
     // fix random seed to produce the same viewer position every time
     // 3939 is just the author's favorite number
     srand(3939);
@@ -75,13 +95,18 @@ private:
     coordinate[1] = coordinate[1] / static_cast<double>(indices.size());
     coordinate[2] = coordinate[2] / static_cast<double>(indices.size());
 
+    broadcast(coordinate[0], coordinate[1], coordinate[2]);
+  }
+
+  void broadcast(const double x, const double y, const double z)
+  {
     geometry_msgs::msg::TransformStamped static_transform_stamped;
     static_transform_stamped.header.stamp = this->now();
     static_transform_stamped.header.frame_id = map_frame_;
     static_transform_stamped.child_frame_id = viewer_frame_;
-    static_transform_stamped.transform.translation.x = coordinate[0];
-    static_transform_stamped.transform.translation.y = coordinate[1];
-    static_transform_stamped.transform.translation.z = coordinate[2];
+    static_transform_stamped.transform.translation.x = x;
+    static_transform_stamped.transform.translation.y = y;
+    static_transform_stamped.transform.translation.z = z;
     tf2::Quaternion quat;
     quat.setRPY(0, 0, 0);
     static_transform_stamped.transform.rotation.x = quat.x();
@@ -92,9 +117,9 @@ private:
     static_broadcaster_->sendTransform(static_transform_stamped);
 
     RCLCPP_INFO_STREAM(
-      get_logger(), "broadcast static tf. map_frame:"
-                      << map_frame_ << ", viewer_frame:" << viewer_frame_ << ", x:" << coordinate[0]
-                      << ", y:" << coordinate[1] << ", z:" << coordinate[2]);
+      get_logger(), "broadcast static tf. map_frame:" << map_frame_ << ", viewer_frame:"
+                                                      << viewer_frame_ << ", x:" << x << ", y:" << y
+                                                      << ", z:" << z);
   }
 };
 }  // namespace autoware::map_tf_generator
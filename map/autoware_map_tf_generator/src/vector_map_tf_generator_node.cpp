@@ -12,10 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "cell_center.hpp"
+
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+#include <autoware_map_msgs/msg/point_cloud_map_meta_data.hpp>
 
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/Point.h>
@@ -38,6 +41,11 @@ public:
     sub_ = create_subscription<autoware_map_msgs::msg::LaneletMapBin>(
       "vector_map", rclcpp::QoS{1}.transient_local(),
       std::bind(&VectorMapTFGeneratorNode::on_vector_map, this, std::placeholders::_1));
+    // the pointcloud map metadata is published before the vector map is loaded, so the viewer frame
+    // is broadcast from its cells first and moved to the center of the vector map when it arrives
+    sub_metadata_ = create_subscription<autoware_map_msgs::msg::PointCloudMapMetaData>(
+      "pointcloud_map_metadata", rclcpp::QoS{1}.transient_local(),
+      std::bind(&VectorMapTFGeneratorNode::on_metadata, this, std::placeholders::_1));
 
     static_broadcaster_ = std::make_shared<tf2_ros::StaticTransformBroadcaster>(this);
   }
@@ -46,40 +54,47 @@ private:
   std::string map_frame_;
   std::string viewer_frame_;
   rclcpp::Subscription<autoware_map_msgs::msg::LaneletMapBin>::SharedPtr sub_;
+  rclcpp::Subscription<autoware_map_msgs::msg::PointCloudMapMetaData>::SharedPtr sub_metadata_;
 
   std::shared_ptr<tf2_ros::StaticTransformBroadcaster> static_broadcaster_;
   std::shared_ptr<lanelet::LaneletMap> lanelet_map_ptr_;
 
+  void on_metadata(const autoware_map_msgs::msg::PointCloudMapMetaData::ConstSharedPtr metadata)
+  {
+    const auto center = mean_of_cell_centers(*metadata);
+    if (!center) {
+      return;
+    }
+    // the cells have no height
+    broadcast(center->first, center->second, 0.0);
+  }
+
   void on_vector_map(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg)
   {
+    sub_metadata_.reset();
+
     lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
     lanelet::utils::conversion::fromBinMsg(*msg, lanelet_map_ptr_);
-    std::vector<double> points_x;
-    std::vector<double> points_y;
-    std::vector<double> points_z;
 
+    double coordinate[3] = {0, 0, 0};
     for (const lanelet::Point3d & point : lanelet_map_ptr_->pointLayer) {
-      const double point_x = point.x();
-      const double point_y = point.y();
-      const double point_z = point.z();
-      points_x.push_back(point_x);
-      points_y.push_back(point_y);
-      points_z.push_back(point_z);
+      coordinate[0] += point.x();
+      coordinate[1] += point.y();
+      coordinate[2] += point.z();
     }
-    const double coordinate_x =
-      std::accumulate(points_x.begin(), points_x.end(), 0.0) / static_cast<double>(points_x.size());
-    const double coordinate_y =
-      std::accumulate(points_y.begin(), points_y.end(), 0.0) / static_cast<double>(points_y.size());
-    const double coordinate_z =
-      std::accumulate(points_z.begin(), points_z.end(), 0.0) / static_cast<double>(points_z.size());
+    const auto n = static_cast<double>(lanelet_map_ptr_->pointLayer.size());
+    broadcast(coordinate[0] / n, coordinate[1] / n, coordinate[2] / n);
+  }
 
+  void broadcast(const double x, const double y, const double z)
+  {
     geometry_msgs::msg::TransformStamped static_transform_stamped;
     static_transform_stamped.header.stamp = this->now();
     static_transform_stamped.header.frame_id = map_frame_;
     static_transform_stamped.child_frame_id = viewer_frame_;
-    static_transform_stamped.transform.translation.x = coordinate_x;
-    static_transform_stamped.transform.translation.y = coordinate_y;
-    static_transform_stamped.transform.translation.z = coordinate_z;
+    static_transform_stamped.transform.translation.x = x;
+    static_transform_stamped.transform.translation.y = y;
+    static_transform_stamped.transform.translation.z = z;
     tf2::Quaternion quat;
     quat.setRPY(0, 0, 0);
     static_transform_stamped.transform.rotation.x = quat.x();
@@ -90,9 +105,9 @@ private:
     static_broadcaster_->sendTransform(static_transform_stamped);
 
     RCLCPP_INFO_STREAM(
-      get_logger(), "broadcast static tf. map_frame:"
-                      << map_frame_ << ", viewer_frame:" << viewer_frame_ << ", x:" << coordinate_x
-                      << ", y:" << coordinate_y << ", z:" << coordinate_z);
+      get_logger(), "broadcast static tf. map_frame:" << map_frame_ << ", viewer_frame:"
+                                                      << viewer_frame_ << ", x:" << x << ", y:" << y
+                                                      << ", z:" << z);
   }
 };
 }  // namespace autoware::map_tf_generator
@@ -0,0 +1,46 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cell_center.hpp"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+autoware_map_msgs::msg::PointCloudMapCellMetaDataWithID create_cell(
+  const float min_x, const float min_y, const float max_x, const float max_y)
+{
+  autoware_map_msgs::msg::PointCloudMapCellMetaDataWithID cell;
+  cell.metadata.min_x = min_x;
+  cell.metadata.min_y = min_y;
+  cell.metadata.max_x = max_x;
+  cell.metadata.max_y = max_y;
+  return cell;
+}
+}  // namespace
+
+TEST(cell_center, mean_of_cell_centers)
+{
+  autoware_map_msgs::msg::PointCloudMapMetaData metadata;
+  EXPECT_FALSE(autoware::map_tf_generator::mean_of_cell_centers(metadata));
+
+  metadata.metadata_list.push_back(create_cell(0.0, 0.0, 20.0, 20.0));
+  metadata.metadata_list.push_back(create_cell(20.0, 0.0, 40.0, 20.0));
+  metadata.metadata_list.push_back(create_cell(40.0, 20.0, 60.0, 40.0));
+
+  const auto center = autoware::map_tf_generator::mean_of_cell_centers(metadata);
+  ASSERT_TRUE(center);
+  EXPECT_DOUBLE_EQ(center->first, 30.0);
+  EXPECT_DOUBLE_EQ(center->second, 50.0 / 3.0);
+}
@@ -28,6 +28,8 @@
 #include <memory>
 #include <string>
 
+class Lanelet2DifferentialLoaderModule;
+
 class Lanelet2MapLoaderNode : public rclcpp::Node
 {
 public:
@@ -47,10 +49,15 @@ private:
   using MapProjectorInfo = autoware::component_interface_specs::map::MapProjectorInfo;
 
   void on_map_projector_info(const MapProjectorInfo::Message::ConstSharedPtr msg);
+  void check_format_version(
+    const std::string & format_version, const std::string & lanelet2_filename,
+    const bool allow_unsupported_version);
+  void publish_map_bin_msg(const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg);
 
   autoware::component_interface_utils::Subscription<MapProjectorInfo>::SharedPtr
     sub_map_projector_info_;
   rclcpp::Publisher<autoware_map_msgs::msg::LaneletMapBin>::SharedPtr pub_map_bin_;
+  std::shared_ptr<Lanelet2DifferentialLoaderModule> differential_loader_module_;
 };
 
 #endif  // MAP_LOADER__LANELET2_MAP_LOADER_NODE_HPP_
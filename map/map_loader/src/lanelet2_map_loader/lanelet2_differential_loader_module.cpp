@@ -0,0 +1,110 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_differential_loader_module.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+Lanelet2DifferentialLoaderModule::Lanelet2DifferentialLoaderModule(
+  rclcpp::Node * node, const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg,
+  const double x_resolution, const double y_resolution)
+: logger_(node->get_logger()),
+  clock_(node->get_clock()),
+  format_version_(map_bin_msg.version_map_format),
+  map_version_(map_bin_msg.version_map),
+  map_(std::make_shared<lanelet::LaneletMap>())
+{
+  lanelet::utils::conversion::fromBinMsg(map_bin_msg, map_);
+  for (auto & [index, primitives] :
+       lanelet2_map_tiles::divide_into_tiles(*map_, x_resolution, y_resolution)) {
+    const auto name = lanelet2_map_tiles::get_tile_name(index);
+    tile_metadata_.emplace(
+      name,
+      lanelet2_map_tiles::create_tile_metadata(*lanelet2_map_tiles::create_tile_map(primitives)));
+    tiles_.emplace(name, std::move(primitives));
+  }
+
+  pub_metadata_ = node->create_publisher<LaneletMapMetaData>(
+    "output/lanelet_map_metadata", rclcpp::QoS{1}.transient_local());
+  pub_metadata_->publish(create_metadata());
+
+  get_selected_lanelet2_map_service_ = node->create_service<GetSelectedLanelet2Map>(
+    "service/get_selected_lanelet2_map",
+    std::bind(
+      &Lanelet2DifferentialLoaderModule::on_service_get_selected_lanelet2_map, this,
+      std::placeholders::_1, std::placeholders::_2));
+
+  RCLCPP_INFO(logger_, "Divided lanelet2_map into %zu cells", tiles_.size());
+}
+
+Lanelet2DifferentialLoaderModule::LaneletMapMetaData
+Lanelet2DifferentialLoaderModule::create_metadata() const
+{
+  LaneletMapMetaData metadata_msg;
+  metadata_msg.header.stamp = clock_->now();
+  metadata_msg.header.frame_id = "map";
+  for (const auto & [name, metadata] : tile_metadata_) {
+    autoware_map_msgs::msg::LaneletMapCellMetaData cell;
+    cell.cell_id = name;
+    cell.min_x = metadata.min_x;
+    cell.min_y = metadata.min_y;
+    cell.max_x = metadata.max_x;
+    cell.max_y = metadata.max_y;
+    metadata_msg.metadata_list.push_back(cell);
+  }
+  return metadata_msg;
+}
+
+autoware_map_msgs::msg::LaneletMapBin Lanelet2DifferentialLoaderModule::create_cells_msg(
+  const std::vector<std::string> & cell_ids) const
+{
+  // each primitive belongs to a single cell, and the bounds shared by the cells are the same
+  // primitives of the map, so they are added only once
+  lanelet2_map_tiles::TilePrimitives primitives;
+  for (const auto & cell_id : cell_ids) {
+    const auto tile = tiles_.find(cell_id);
+    if (tile == tiles_.end()) {
+      RCLCPP_WARN(logger_, "Requested lanelet2_map cell %s does not exist", cell_id.c_str());
+      continue;
+    }
+    const auto & p = tile->second;
+    primitives.lanelets.insert(primitives.lanelets.end(), p.lanelets.begin(), p.lanelets.end());
+    primitives.areas.insert(primitives.areas.end(), p.areas.begin(), p.areas.end());
+    primitives.polygons.insert(primitives.polygons.end(), p.polygons.begin(), p.polygons.end());
+    primitives.line_strings.insert(
+      primitives.line_strings.end(), p.line_strings.begin(), p.line_strings.end());
+  }
+
+  autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+  map_bin_msg.header.stamp = clock_->now();
+  map_bin_msg.header.frame_id = "map";
+  map_bin_msg.version_map_format = format_version_;
+  map_bin_msg.version_map = map_version_;
+  lanelet::utils::conversion::toBinMsg(
+    lanelet2_map_tiles::create_tile_map(primitives), &map_bin_msg);
+  return map_bin_msg;
+}
+
+bool Lanelet2DifferentialLoaderModule::on_service_get_selected_lanelet2_map(
+  GetSelectedLanelet2Map::Request::SharedPtr req,
+  GetSelectedLanelet2Map::Response::SharedPtr res) const
+{
+  res->lanelet2_cells = create_cells_msg(req->cell_ids);
+  res->header = res->lanelet2_cells.header;
+  return true;
+}
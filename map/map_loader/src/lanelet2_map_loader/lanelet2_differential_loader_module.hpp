@@ -0,0 +1,74 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_DIFFERENTIAL_LOADER_MODULE_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_DIFFERENTIAL_LOADER_MODULE_HPP_
+
+#include "lanelet2_map_tiles.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+#include <autoware_map_msgs/msg/lanelet_map_meta_data.hpp>
+#include <autoware_map_msgs/srv/get_selected_lanelet2_map.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief serve the cells of the lanelet2 map that are requested by their ids
+ *
+ * The cells are the tiles of lanelet2_map_tiler, so that a client holds only the cells around the
+ * ego. The client selects the cells from the published metadata, requests the cells that it does
+ * not hold yet, and drops the cells that are not selected anymore.
+ */
+class Lanelet2DifferentialLoaderModule
+{
+  using GetSelectedLanelet2Map = autoware_map_msgs::srv::GetSelectedLanelet2Map;
+  using LaneletMapMetaData = autoware_map_msgs::msg::LaneletMapMetaData;
+
+public:
+  Lanelet2DifferentialLoaderModule(
+    rclcpp::Node * node, const autoware_map_msgs::msg::LaneletMapBin & map_bin_msg,
+    double x_resolution, double y_resolution);
+
+  /** @brief ids, i.e. the names of the tiles, and bounds of all cells */
+  LaneletMapMetaData create_metadata() const;
+
+  /** @brief serialized map of the cells, unknown ids are skipped */
+  autoware_map_msgs::msg::LaneletMapBin create_cells_msg(
+    const std::vector<std::string> & cell_ids) const;
+
+private:
+  rclcpp::Logger logger_;
+  rclcpp::Clock::SharedPtr clock_;
+
+  std::string format_version_;
+  std::string map_version_;
+  lanelet::LaneletMapPtr map_;
+  std::map<std::string, lanelet2_map_tiles::TilePrimitives> tiles_;
+  std::map<std::string, lanelet2_map_tiles::TileMetadata> tile_metadata_;
+
+  rclcpp::Publisher<LaneletMapMetaData>::SharedPtr pub_metadata_;
+  rclcpp::Service<GetSelectedLanelet2Map>::SharedPtr get_selected_lanelet2_map_service_;
+
+  [[nodiscard]] bool on_service_get_selected_lanelet2_map(
+    GetSelectedLanelet2Map::Request::SharedPtr req,
+    GetSelectedLanelet2Map::Response::SharedPtr res) const;
+};
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_DIFFERENTIAL_LOADER_MODULE_HPP_
@@ -0,0 +1,199 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "lanelet2_map_cache.hpp"
+
+#include <autoware_lanelet2_extension/version.hpp>
+
+#include <boost/version.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lanelet2_map_cache
+{
+namespace
+{
+constexpr char cache_magic[8] = {'L', 'L', '2', 'C', 'A', 'C', 'H', 'E'};
+// increment when the layout of the cache file changes
+constexpr uint32_t cache_format_version = 1;
+
+void write_size(std::ofstream & ofs, const uint64_t size)
+{
+  ofs.write(reinterpret_cast<const char *>(&size), sizeof(size));
+}
+
+template <typename ContainerT>
+void write_bytes(std::ofstream & ofs, const ContainerT & bytes)
+{
+  write_size(ofs, bytes.size());
+  ofs.write(
+    reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+template <typename ContainerT>
+bool read_bytes(std::ifstream & ifs, const uint64_t remaining_size, ContainerT & bytes)
+{
+  uint64_t size = 0;
+  if (!ifs.read(reinterpret_cast<char *>(&size), sizeof(size))) {
+    return false;
+  }
+  // a broken size must not allocate more than the file holds
+  if (size > remaining_size) {
+    return false;
+  }
+  bytes.resize(size);
+  return static_cast<bool>(
+    ifs.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(size)));
+}
+}  // namespace
+
+std::string get_cache_path(const std::string & lanelet2_filename)
+{
+  return lanelet2_filename + ".cache";
+}
+
+std::optional<uint64_t> hash_file(const std::string & filename)
+{
+  std::ifstream ifs(filename, std::ios::binary);
+  if (!ifs) {
+    return std::nullopt;
+  }
+
+  // 64-bit FNV-1a, which unlike std::hash gives the same value on every build
+  uint64_t hash = 14695981039346656037ULL;
+  std::vector<char> buffer(1 << 16);
+  while (ifs) {
+    ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    const auto read_size = ifs.gcount();
+    for (std::streamsize i = 0; i < read_size; ++i) {
+      hash ^= static_cast<uint8_t>(buffer[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+  if (ifs.bad()) {
+    return std::nullopt;
+  }
+  return hash;
+}
+
+std::optional<std::string> create_cache_key(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info, double center_line_resolution,
+  bool use_waypoints)
+{
+  const auto map_hash = hash_file(lanelet2_filename);
+  if (!map_hash) {
+    return std::nullopt;
+  }
+
+  std::ostringstream key;
+  key << std::setprecision(std::numeric_limits<double>::max_digits10);
+  key << "map_hash:" << std::hex << *map_hash << std::dec << "\n";
+  key << "projector_type:" << projector_info.projector_type << "\n";
+  key << "vertical_datum:" << projector_info.vertical_datum << "\n";
+  key << "mgrs_grid:" << projector_info.mgrs_grid << "\n";
+  key << "map_origin:" << projector_info.map_origin.latitude << ","
+      << projector_info.map_origin.longitude << "," << projector_info.map_origin.altitude << "\n";
+  key << "center_line_resolution:" << center_line_resolution << "\n";
+  key << "use_waypoints:" << use_waypoints << "\n";
+  // the map is stored as a boost archive of the lanelet2 extension types
+  key << "lanelet2_extension_version:" << static_cast<int>(lanelet::autoware::version) << "\n";
+  key << "boost_version:" << BOOST_VERSION << "\n";
+  return key.str();
+}
+
+std::optional<CachedMap> read_cache(const std::string & cache_path, const std::string & key)
+{
+  std::error_code error_code;
+  const auto file_size = std::filesystem::file_size(cache_path, error_code);
+  if (error_code) {
+    return std::nullopt;
+  }
+
+  std::ifstream ifs(cache_path, std::ios::binary);
+  if (!ifs) {
+    return std::nullopt;
+  }
+
+  char magic[sizeof(cache_magic)];
+  uint32_t format_version = 0;
+  if (
+    !ifs.read(magic, sizeof(magic)) ||
+    !ifs.read(reinterpret_cast<char *>(&format_version), sizeof(format_version)) ||
+    !std::equal(std::begin(magic), std::end(magic), std::begin(cache_magic)) ||
+    format_version != cache_format_version) {
+    return std::nullopt;
+  }
+
+  std::string cached_key;
+  if (!read_bytes(ifs, file_size, cached_key) || cached_key != key) {
+    return std::nullopt;
+  }
+
+  CachedMap map;
+  if (
+    !read_bytes(ifs, file_size, map.format_version) ||
+    !read_bytes(ifs, file_size, map.map_version) || !read_bytes(ifs, file_size, map.data)) {
+    return std::nullopt;
+  }
+  // trailing bytes mean that the file was not written by write_cache
+  if (ifs.peek() != std::ifstream::traits_type::eof()) {
+    return std::nullopt;
+  }
+  return map;
+}
+
+bool write_cache(const std::string & cache_path, const std::string & key, const CachedMap & map)
+{
+  // write to a temporary file first so that a crash never leaves a half written cache
+  const std::string temporary_path = cache_path + ".tmp";
+  {
+    std::ofstream ofs(temporary_path, std::ios::binary | std::ios::trunc);
+    if (!ofs) {
+      return false;
+    }
+    ofs.write(cache_magic, sizeof(cache_magic));
+    ofs.write(
+      reinterpret_cast<const char *>(&cache_format_version), sizeof(cache_format_version));
+    write_bytes(ofs, key);
+    write_bytes(ofs, map.format_version);
+    write_bytes(ofs, map.map_version);
+    write_bytes(ofs, map.data);
+    ofs.close();
+    if (!ofs) {
+      std::remove(temporary_path.c_str());
+      return false;
+    }
+  }
+
+  std::error_code error_code;
+  std::filesystem::rename(temporary_path, cache_path, error_code);
+  if (error_code) {
+    std::remove(temporary_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace lanelet2_map_cache
@@ -0,0 +1,64 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+
+#include <tier4_map_msgs/msg/map_projector_info.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace lanelet2_map_cache
+{
+/**
+ * @brief lanelet2 map that was already projected and whose centerlines were already overwritten,
+ * serialized in the same way as autoware_map_msgs::msg::LaneletMapBin::data
+ */
+struct CachedMap
+{
+  std::string format_version;
+  std::string map_version;
+  std::vector<uint8_t> data;
+};
+
+/** @brief path of the cache file stored next to the map */
+std::string get_cache_path(const std::string & lanelet2_filename);
+
+/** @brief hash of the file contents, or nullopt if the file cannot be read */
+std::optional<uint64_t> hash_file(const std::string & filename);
+
+/**
+ * @brief key that identifies the map file and every setting that changes the loaded map
+ *
+ * A cache written with a different key, e.g. for another projector or another version of the
+ * serialization, is never loaded.
+ */
+std::optional<std::string> create_cache_key(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info, double center_line_resolution,
+  bool use_waypoints);
+
+/** @brief read the cache, or nullopt if it is missing, broken or written with another key */
+std::optional<CachedMap> read_cache(const std::string & cache_path, const std::string & key);
+
+/** @brief write the cache atomically, return false if it cannot be written */
+bool write_cache(const std::string & cache_path, const std::string & key, const CachedMap & map);
+
+}  // namespace lanelet2_map_cache
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
@@ -33,7 +33,9 @@
 
 #include "map_loader/lanelet2_map_loader_node.hpp"
 
+#include "lanelet2_differential_loader_module.hpp"
 #include "lanelet2_local_projector.hpp"
+#include "lanelet2_map_cache.hpp"
 
 #include <ament_index_cpp/get_package_prefix.hpp>
 #include <autoware/geography_utils/lanelet2_projector.hpp>
@@ -49,8 +51,10 @@
 #include <lanelet2_io/Io.h>
 #include <lanelet2_projection/UTM.h>
 
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 using autoware_map_msgs::msg::LaneletMapBin;
 using tier4_map_msgs::msg::MapProjectorInfo;
@@ -69,6 +73,9 @@ Lanelet2MapLoaderNode::Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options
   declare_parameter<std::string>("lanelet2_map_path");
   declare_parameter<double>("center_line_resolution");
   declare_parameter<bool>("use_waypoints");
+  declare_parameter<bool>("use_lanelet2_map_cache");
+  declare_parameter<bool>("enable_differential_load");
+  declare_parameter<double>("differential_load_cell_size");
 }
 
 void Lanelet2MapLoaderNode::on_map_projector_info(
@@ -78,6 +85,32 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
   const auto lanelet2_filename = get_parameter("lanelet2_map_path").as_string();
   const auto center_line_resolution = get_parameter("center_line_resolution").as_double();
   const auto use_waypoints = get_parameter("use_waypoints").as_bool();
+  const auto use_lanelet2_map_cache = get_parameter("use_lanelet2_map_cache").as_bool();
+
+  // load the projected map with the overwritten centerlines from the cache if it is valid
+  const auto cache_path = lanelet2_map_cache::get_cache_path(lanelet2_filename);
+  std::optional<std::string> cache_key;
+  if (use_lanelet2_map_cache) {
+    cache_key = lanelet2_map_cache::create_cache_key(
+      lanelet2_filename, *msg, center_line_resolution, use_waypoints);
+    if (!cache_key) {
+      RCLCPP_WARN(
+        get_logger(), "Failed to read %s to validate the cache", lanelet2_filename.c_str());
+    } else if (auto cached_map = lanelet2_map_cache::read_cache(cache_path, *cache_key)) {
+      check_format_version(
+        cached_map->format_version, lanelet2_filename, allow_unsupported_version);
+      RCLCPP_INFO(get_logger(), "Loaded lanelet2_map from the cache %s", cache_path.c_str());
+
+      LaneletMapBin map_bin_msg;
+      map_bin_msg.header.stamp = now();
+      map_bin_msg.header.frame_id = "map";
+      map_bin_msg.version_map_format = cached_map->format_version;
+      map_bin_msg.version_map = cached_map->map_version;
+      map_bin_msg.data = std::move(cached_map->data);
+      publish_map_bin_msg(map_bin_msg);
+      return;
+    }
+  }
 
   // load map from file
   const auto map = load_map(lanelet2_filename, *msg);
@@ -89,6 +122,35 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
   std::string format_version{"null"}, map_version{""};
   lanelet::io_handlers::AutowareOsmParser::parseVersions(
     lanelet2_filename, &format_version, &map_version);
+  check_format_version(format_version, lanelet2_filename, allow_unsupported_version);
+
+  // overwrite centerline
+  if (use_waypoints) {
+    lanelet::utils::overwriteLaneletsCenterlineWithWaypoints(map, center_line_resolution, false);
+  } else {
+    lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
+  }
+
+  // create map bin msg
+  const auto map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
+
+  if (cache_key) {
+    const lanelet2_map_cache::CachedMap cached_map{
+      map_bin_msg.version_map_format, map_bin_msg.version_map, map_bin_msg.data};
+    if (lanelet2_map_cache::write_cache(cache_path, *cache_key, cached_map)) {
+      RCLCPP_INFO(get_logger(), "Saved the lanelet2_map cache to %s", cache_path.c_str());
+    } else {
+      RCLCPP_WARN(get_logger(), "Failed to save the lanelet2_map cache to %s", cache_path.c_str());
+    }
+  }
+
+  publish_map_bin_msg(map_bin_msg);
+}
+
+void Lanelet2MapLoaderNode::check_format_version(
+  const std::string & format_version, const std::string & lanelet2_filename,
+  const bool allow_unsupported_version)
+{
   if (format_version == "null" || format_version.empty() || !isdigit(format_version[0])) {
     RCLCPP_WARN(
       get_logger(),
@@ -114,22 +176,23 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
     }
   }
   RCLCPP_INFO(get_logger(), "Loaded map format_version: %s", format_version.c_str());
+}
 
-  // overwrite centerline
-  if (use_waypoints) {
-    lanelet::utils::overwriteLaneletsCenterlineWithWaypoints(map, center_line_resolution, false);
-  } else {
-    lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
-  }
-
-  // create map bin msg
-  const auto map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
-
+void Lanelet2MapLoaderNode::publish_map_bin_msg(const LaneletMapBin & map_bin_msg)
+{
   // create publisher and publish
   pub_map_bin_ =
     create_publisher<LaneletMapBin>("output/lanelet2_map", rclcpp::QoS{1}.transient_local());
   pub_map_bin_->publish(map_bin_msg);
   RCLCPP_INFO(get_logger(), "Succeeded to load lanelet2_map. Map is published.");
+
+  // the cells are created from the published map, so that they are the same whether it was loaded
+  // from the cache or from the file
+  if (get_parameter("enable_differential_load").as_bool()) {
+    const auto cell_size = get_parameter("differential_load_cell_size").as_double();
+    differential_loader_module_ =
+      std::make_shared<Lanelet2DifferentialLoaderModule>(this, map_bin_msg, cell_size, cell_size);
+  }
 }
 
 lanelet::LaneletMapPtr Lanelet2MapLoaderNode::load_map(
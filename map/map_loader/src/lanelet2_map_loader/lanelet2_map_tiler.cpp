@@ -0,0 +1,156 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_cache.hpp"
+#include "lanelet2_map_tiles.hpp"
+#include "map_loader/lanelet2_map_loader_node.hpp"
+
+#include <autoware/map_projection_loader/map_projection_loader.hpp>
+#include <autoware_lanelet2_extension/io/autoware_osm_parser.hpp>
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+#include <autoware_lanelet2_extension/utility/utilities.hpp>
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+constexpr double center_line_resolution = 5.0;
+constexpr bool use_waypoints = true;
+}  // namespace
+
+// divide a lanelet2 map into tiles aligned with the grids of the pointcloud map, and write each
+// tile projected, with its centerlines and in the serialized format of LaneletMapBin
+int main(int argc, char ** argv)
+{
+  if (argc < 5) {
+    std::cerr << "Usage: " << argv[0]
+              << " <lanelet2_map_path> <map_projector_info_path> <pointcloud_map_metadata_path>"
+                 " <output_directory> [num_threads]"
+              << std::endl;
+    return 1;
+  }
+  const std::string lanelet2_map_path = argv[1];
+  const std::string map_projector_info_path = argv[2];
+  const std::string pointcloud_map_metadata_path = argv[3];
+  const fs::path output_directory = argv[4];
+  const size_t num_threads =
+    argc > 5 ? std::stoul(argv[5]) : std::max(1u, std::thread::hardware_concurrency());
+
+  try {
+    const YAML::Node pointcloud_map_metadata = YAML::LoadFile(pointcloud_map_metadata_path);
+    const auto x_resolution = pointcloud_map_metadata["x_resolution"].as<double>();
+    const auto y_resolution = pointcloud_map_metadata["y_resolution"].as<double>();
+
+    const auto projector_info = autoware::map_projection_loader::load_map_projector_info(
+      map_projector_info_path, lanelet2_map_path);
+    const auto map = Lanelet2MapLoaderNode::load_map(lanelet2_map_path, projector_info);
+    if (!map) {
+      std::cerr << "Failed to load " << lanelet2_map_path << std::endl;
+      return 1;
+    }
+
+    // the centerlines are computed once for the whole map, so that they do not depend on the tiling
+    if (use_waypoints) {
+      lanelet::utils::overwriteLaneletsCenterlineWithWaypoints(map, center_line_resolution, false);
+    } else {
+      lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
+    }
+
+    const auto cache_key = lanelet2_map_cache::create_cache_key(
+      lanelet2_map_path, projector_info, center_line_resolution, use_waypoints);
+    if (!cache_key) {
+      std::cerr << "Failed to read " << lanelet2_map_path << std::endl;
+      return 1;
+    }
+    std::string format_version{}, map_version{};
+    lanelet::io_handlers::AutowareOsmParser::parseVersions(
+      lanelet2_map_path, &format_version, &map_version);
+
+    // the tiles share the primitives of the map, so they are created before the parallel part
+    std::vector<std::pair<std::string, lanelet::LaneletMapPtr>> tile_maps;
+    for (const auto & [index, primitives] :
+         lanelet2_map_tiles::divide_into_tiles(*map, x_resolution, y_resolution)) {
+      tile_maps.emplace_back(
+        lanelet2_map_tiles::get_tile_name(index), lanelet2_map_tiles::create_tile_map(primitives));
+    }
+
+    fs::create_directories(output_directory);
+
+    std::map<std::string, lanelet2_map_tiles::TileMetadata> tile_metadata;
+    std::vector<std::string> errors;
+    std::mutex mutex;
+    std::atomic<size_t> next_tile{0};
+    const auto process_tiles = [&]() {
+      for (size_t i = next_tile++; i < tile_maps.size(); i = next_tile++) {
+        const auto & [name, tile_map] = tile_maps.at(i);
+        autoware_map_msgs::msg::LaneletMapBin msg;
+        lanelet::utils::conversion::toBinMsg(tile_map, &msg);
+
+        auto tile_errors = lanelet2_map_tiles::validate_tile(*tile_map, msg.data);
+        const auto tile_path = (output_directory / name).string();
+        const lanelet2_map_cache::CachedMap cached_tile{
+          format_version, map_version, std::move(msg.data)};
+        if (!lanelet2_map_cache::write_cache(tile_path, *cache_key, cached_tile)) {
+          tile_errors.push_back("failed to write " + tile_path);
+        }
+        const auto metadata = lanelet2_map_tiles::create_tile_metadata(*tile_map);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        tile_metadata.emplace(name, metadata);
+        for (const auto & error : tile_errors) {
+          errors.push_back(name + ": " + error);
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < std::min(num_threads, tile_maps.size()); ++i) {
+      threads.emplace_back(process_tiles);
+    }
+    process_tiles();
+    for (auto & thread : threads) {
+      thread.join();
+    }
+
+    if (!errors.empty()) {
+      std::cerr << "The following tile(s) are invalid:";
+      for (const auto & error : errors) {
+        std::cerr << std::endl << error;
+      }
+      std::cerr << std::endl;
+      return 1;
+    }
+
+    const auto metadata_path = (output_directory / "lanelet2_map_metadata.yaml").string();
+    lanelet2_map_tiles::write_tile_metadata(
+      metadata_path, x_resolution, y_resolution, tile_metadata);
+    std::cout << "Wrote " << tile_maps.size() << " tiles to " << output_directory << std::endl;
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
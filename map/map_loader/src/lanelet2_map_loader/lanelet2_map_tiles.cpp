@@ -0,0 +1,189 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_tiles.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+
+#include <lanelet2_core/geometry/Area.h>
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_core/geometry/LineString.h>
+#include <lanelet2_core/geometry/Polygon.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet2_map_tiles
+{
+TileIndex get_tile_index(
+  const double x, const double y, const double x_resolution, const double y_resolution)
+{
+  return {
+    static_cast<int64_t>(std::floor(x / x_resolution)),
+    static_cast<int64_t>(std::floor(y / y_resolution))};
+}
+
+std::string get_tile_name(const TileIndex & index)
+{
+  return "lanelet2_map_" + std::to_string(index.x) + "_" + std::to_string(index.y) + ".bin";
+}
+
+std::map<TileIndex, TilePrimitives> divide_into_tiles(
+  const lanelet::LaneletMap & map, const double x_resolution, const double y_resolution)
+{
+  const auto get_index = [&](const lanelet::BoundingBox2d & box) {
+    const auto center = box.center();
+    return get_tile_index(center.x(), center.y(), x_resolution, y_resolution);
+  };
+
+  std::map<TileIndex, TilePrimitives> tiles;
+  for (const auto & lanelet : map.laneletLayer) {
+    tiles[get_index(lanelet::geometry::boundingBox2d(lanelet))].lanelets.push_back(lanelet);
+  }
+  for (const auto & area : map.areaLayer) {
+    tiles[get_index(lanelet::geometry::boundingBox2d(area))].areas.push_back(area);
+  }
+  for (const auto & polygon : map.polygonLayer) {
+    tiles[get_index(lanelet::geometry::boundingBox2d(polygon))].polygons.push_back(polygon);
+  }
+  for (const auto & line_string : map.lineStringLayer) {
+    // the bounds are added to the tile together with their lanelets
+    if (
+      !map.laneletLayer.findUsages(line_string).empty() ||
+      !map.areaLayer.findUsages(line_string).empty() ||
+      !map.regulatoryElementLayer.findUsages(line_string).empty()) {
+      continue;
+    }
+    tiles[get_index(lanelet::geometry::boundingBox2d(line_string))].line_strings.push_back(
+      line_string);
+  }
+  return tiles;
+}
+
+lanelet::LaneletMapPtr create_tile_map(const TilePrimitives & primitives)
+{
+  lanelet::LaneletMapPtr tile_map =
+    lanelet::utils::createMap(primitives.lanelets, primitives.areas);
+  for (const auto & polygon : primitives.polygons) {
+    if (!tile_map->polygonLayer.exists(polygon.id())) {
+      tile_map->add(polygon);
+    }
+  }
+  for (const auto & line_string : primitives.line_strings) {
+    if (!tile_map->lineStringLayer.exists(line_string.id())) {
+      tile_map->add(line_string);
+    }
+  }
+  return tile_map;
+}
+
+TileMetadata create_tile_metadata(const lanelet::LaneletMap & tile_map)
+{
+  TileMetadata metadata{
+    std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+    std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), {}};
+  for (const auto & point : tile_map.pointLayer) {
+    metadata.min_x = std::min(metadata.min_x, point.x());
+    metadata.min_y = std::min(metadata.min_y, point.y());
+    metadata.max_x = std::max(metadata.max_x, point.x());
+    metadata.max_y = std::max(metadata.max_y, point.y());
+  }
+  for (const auto & lanelet : tile_map.laneletLayer) {
+    metadata.lanelet_ids.push_back(lanelet.id());
+  }
+  std::sort(metadata.lanelet_ids.begin(), metadata.lanelet_ids.end());
+  return metadata;
+}
+
+std::vector<std::string> validate_tile(
+  const lanelet::LaneletMap & tile_map, const std::vector<uint8_t> & data)
+{
+  std::vector<std::string> errors;
+  for (const auto & lanelet : tile_map.laneletLayer) {
+    const auto id = std::to_string(lanelet.id());
+    if (lanelet.leftBound().size() < 2 || lanelet.rightBound().size() < 2) {
+      errors.push_back("lanelet " + id + " has a bound with less than 2 points");
+    }
+    if (!lanelet.hasCustomCenterline()) {
+      errors.push_back("lanelet " + id + " has no precomputed centerline");
+    }
+  }
+
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  msg.data = data;
+  auto deserialized_map = std::make_shared<lanelet::LaneletMap>();
+  try {
+    lanelet::utils::conversion::fromBinMsg(msg, deserialized_map);
+  } catch (const std::exception & e) {
+    errors.push_back(std::string("failed to deserialize the tile: ") + e.what());
+    return errors;
+  }
+
+  const auto check_size = [&](const std::string & layer, const size_t expected, const size_t size) {
+    if (expected != size) {
+      errors.push_back(
+        "the deserialized tile has " + std::to_string(size) + " " + layer + " instead of " +
+        std::to_string(expected));
+    }
+  };
+  check_size("points", tile_map.pointLayer.size(), deserialized_map->pointLayer.size());
+  check_size(
+    "line strings", tile_map.lineStringLayer.size(), deserialized_map->lineStringLayer.size());
+  check_size("polygons", tile_map.polygonLayer.size(), deserialized_map->polygonLayer.size());
+  check_size("lanelets", tile_map.laneletLayer.size(), deserialized_map->laneletLayer.size());
+  check_size("areas", tile_map.areaLayer.size(), deserialized_map->areaLayer.size());
+  check_size(
+    "regulatory elements", tile_map.regulatoryElementLayer.size(),
+    deserialized_map->regulatoryElementLayer.size());
+  return errors;
+}
+
+void write_tile_metadata(
+  const std::string & path, const double x_resolution, const double y_resolution,
+  const std::map<std::string, TileMetadata> & tiles)
+{
+  YAML::Emitter out;
+  out << YAML::BeginMap;
+  out << YAML::Key << "x_resolution" << YAML::Value << x_resolution;
+  out << YAML::Key << "y_resolution" << YAML::Value << y_resolution;
+  out << YAML::Key << "tiles" << YAML::Value << YAML::BeginMap;
+  for (const auto & [name, metadata] : tiles) {
+    out << YAML::Key << name << YAML::Value << YAML::BeginMap;
+    out << YAML::Key << "min" << YAML::Value << YAML::Flow << YAML::BeginSeq << metadata.min_x
+        << metadata.min_y << YAML::EndSeq;
+    out << YAML::Key << "max" << YAML::Value << YAML::Flow << YAML::BeginSeq << metadata.max_x
+        << metadata.max_y << YAML::EndSeq;
+    out << YAML::Key << "lanelet_ids" << YAML::Value << YAML::Flow << metadata.lanelet_ids;
+    out << YAML::EndMap;
+  }
+  out << YAML::EndMap;
+  out << YAML::EndMap;
+
+  std::ofstream ofs(path);
+  ofs << out.c_str() << std::endl;
+  if (!ofs) {
+    throw std::runtime_error("Failed to write " + path);
+  }
+}
+
+}  // namespace lanelet2_map_tiles
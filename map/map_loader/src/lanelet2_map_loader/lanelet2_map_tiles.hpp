@@ -0,0 +1,94 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_MAP_TILES_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_MAP_TILES_HPP_
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace lanelet2_map_tiles
+{
+/** @brief index of a tile in the same grid as the pointcloud map metadata */
+struct TileIndex
+{
+  int64_t x;
+  int64_t y;
+  bool operator<(const TileIndex & other) const
+  {
+    return std::tie(x, y) < std::tie(other.x, other.y);
+  }
+  bool operator==(const TileIndex & other) const { return x == other.x && y == other.y; }
+};
+
+/** @brief primitives of the map assigned to a tile by the center of their bounding box */
+struct TilePrimitives
+{
+  lanelet::Lanelets lanelets;
+  lanelet::Areas areas;
+  lanelet::Polygons3d polygons;
+  // line strings that are not a part of a lanelet, an area or a regulatory element
+  lanelet::LineStrings3d line_strings;
+};
+
+/** @brief axis-aligned bounds of a tile and of the primitives assigned to it */
+struct TileMetadata
+{
+  double min_x;
+  double min_y;
+  double max_x;
+  double max_y;
+  std::vector<lanelet::Id> lanelet_ids;
+};
+
+TileIndex get_tile_index(double x, double y, double x_resolution, double y_resolution);
+
+/** @brief name of the tile file, e.g. "lanelet2_map_100_-2.bin" for x = 100 and y = -2 */
+std::string get_tile_name(const TileIndex & index);
+
+std::map<TileIndex, TilePrimitives> divide_into_tiles(
+  const lanelet::LaneletMap & map, double x_resolution, double y_resolution);
+
+/**
+ * @brief create a map of the primitives of a tile
+ *
+ * The map also contains the bounds, the points and the regulatory elements of the lanelets even if
+ * they are outside of the tile, so that the lanelets can be used without the neighboring tiles.
+ */
+lanelet::LaneletMapPtr create_tile_map(const TilePrimitives & primitives);
+
+/** @brief bounds of all primitives of the tile map, which may extend over the tile */
+TileMetadata create_tile_metadata(const lanelet::LaneletMap & tile_map);
+
+/**
+ * @brief check that the lanelets of the tile have bounds and centerlines, and that the serialized
+ * tile can be deserialized to the same primitives
+ * @return error messages, empty if the tile is valid
+ */
+std::vector<std::string> validate_tile(
+  const lanelet::LaneletMap & tile_map, const std::vector<uint8_t> & data);
+
+/** @brief write the resolution and the metadata of the tiles to a yaml file */
+void write_tile_metadata(
+  const std::string & path, double x_resolution, double y_resolution,
+  const std::map<std::string, TileMetadata> & tiles);
+
+}  // namespace lanelet2_map_tiles
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_MAP_TILES_HPP_
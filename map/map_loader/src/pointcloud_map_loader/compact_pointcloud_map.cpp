@@ -0,0 +1,285 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "compact_pointcloud_map.hpp"
+
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr char compact_map_magic[8] = {'A', 'W', 'C', 'P', 'C', 'M', 'A', 'P'};
+// increment when the layout of the file changes
+constexpr uint32_t compact_map_version = 1;
+constexpr int16_t max_quantized_offset = std::numeric_limits<int16_t>::max();
+// bytes of the x, y and z offsets of a point
+constexpr size_t quantized_point_size = 3 * sizeof(int16_t);
+
+template <typename T>
+void append(std::vector<uint8_t> & buffer, const T & value)
+{
+  const auto * bytes = reinterpret_cast<const uint8_t *>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+std::string get_tile_id(const std::string & pcd_path)
+{
+  return pcd_path.substr(pcd_path.find_last_of("/\\") + 1);
+}
+}  // namespace
+
+void write_compact_pointcloud_map(
+  const std::string & output_path,
+  const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict)
+{
+  // the index has a fixed size, so that the tiles can be written before it
+  size_t index_size = sizeof(compact_map_magic) + sizeof(uint32_t) + sizeof(uint32_t);
+  for (const auto & [pcd_path, metadata] : pcd_metadata_dict) {
+    index_size += sizeof(uint32_t) + get_tile_id(pcd_path).size() + 6 * sizeof(float) +
+                  3 * sizeof(double) + 3 * sizeof(float) + 2 * sizeof(uint64_t);
+  }
+
+  std::ofstream ofs(output_path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    throw std::runtime_error("Failed to open " + output_path);
+  }
+
+  std::vector<uint8_t> index;
+  index.insert(index.end(), std::begin(compact_map_magic), std::end(compact_map_magic));
+  append(index, compact_map_version);
+  append(index, static_cast<uint32_t>(pcd_metadata_dict.size()));
+
+  // the tiles are aligned to 8 bytes
+  uint64_t data_offset = (index_size + 7) / 8 * 8;
+  std::vector<int16_t> quantized_points;
+  for (const auto & [pcd_path, metadata] : pcd_metadata_dict) {
+    pcl::PointCloud<pcl::PointXYZ> pcd;
+    if (pcl::io::loadPCDFile(pcd_path, pcd) == -1) {
+      throw std::runtime_error("PCD load failed: " + pcd_path);
+    }
+
+    // bounds of the finite points
+    double min[3] = {0.0, 0.0, 0.0};
+    double max[3] = {0.0, 0.0, 0.0};
+    bool is_first_point = true;
+    for (const auto & p : pcd.points) {
+      if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) continue;
+      const double values[3] = {p.x, p.y, p.z};
+      for (int axis = 0; axis < 3; ++axis) {
+        min[axis] = is_first_point ? values[axis] : std::min(min[axis], values[axis]);
+        max[axis] = is_first_point ? values[axis] : std::max(max[axis], values[axis]);
+      }
+      is_first_point = false;
+    }
+
+    double origin[3];
+    float scale[3];
+    for (int axis = 0; axis < 3; ++axis) {
+      origin[axis] = (min[axis] + max[axis]) / 2.0;
+      scale[axis] = std::max(
+        static_cast<float>((max[axis] - min[axis]) / 2.0 / max_quantized_offset),
+        std::numeric_limits<float>::min());
+    }
+
+    quantized_points.clear();
+    for (const auto & p : pcd.points) {
+      if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) continue;
+      const double values[3] = {p.x, p.y, p.z};
+      for (int axis = 0; axis < 3; ++axis) {
+        const double offset = std::round((values[axis] - origin[axis]) / scale[axis]);
+        quantized_points.push_back(static_cast<int16_t>(std::clamp<double>(
+          offset, -max_quantized_offset, static_cast<double>(max_quantized_offset))));
+      }
+    }
+    const uint64_t num_points = quantized_points.size() / 3;
+
+    const std::string tile_id = get_tile_id(pcd_path);
+    append(index, static_cast<uint32_t>(tile_id.size()));
+    index.insert(index.end(), tile_id.begin(), tile_id.end());
+    append(index, metadata.min.x);
+    append(index, metadata.min.y);
+    append(index, metadata.min.z);
+    append(index, metadata.max.x);
+    append(index, metadata.max.y);
+    append(index, metadata.max.z);
+    for (const auto & value : origin) append(index, value);
+    for (const auto & value : scale) append(index, value);
+    append(index, num_points);
+    append(index, data_offset);
+
+    ofs.seekp(static_cast<std::streamoff>(data_offset));
+    ofs.write(
+      reinterpret_cast<const char *>(quantized_points.data()),
+      static_cast<std::streamsize>(num_points * quantized_point_size));
+    data_offset = (data_offset + num_points * quantized_point_size + 7) / 8 * 8;
+  }
+
+  ofs.seekp(0);
+  ofs.write(
+    reinterpret_cast<const char *>(index.data()), static_cast<std::streamsize>(index.size()));
+  ofs.close();
+  if (!ofs) {
+    throw std::runtime_error("Failed to write " + output_path);
+  }
+}
+
+CompactPointCloudMap::CompactPointCloudMap(const std::string & path)
+{
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open " + path);
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    close(fd);
+    throw std::runtime_error("Failed to read " + path);
+  }
+  size_ = static_cast<size_t>(file_stat.st_size);
+  void * data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping stays valid after the file is closed
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Failed to map " + path);
+  }
+  data_ = static_cast<const uint8_t *>(data);
+
+  try {
+    read_index(path);
+  } catch (...) {
+    munmap(const_cast<uint8_t *>(data_), size_);
+    throw;
+  }
+}
+
+void CompactPointCloudMap::read_index(const std::string & path)
+{
+  size_t cursor = 0;
+  const auto read = [&](void * value, const size_t size) {
+    if (size > size_ - cursor) {
+      throw std::runtime_error("Invalid compact pointcloud map: " + path);
+    }
+    std::memcpy(value, data_ + cursor, size);
+    cursor += size;
+  };
+
+  char magic[sizeof(compact_map_magic)];
+  uint32_t version = 0;
+  uint32_t num_tiles = 0;
+  read(magic, sizeof(magic));
+  read(&version, sizeof(version));
+  read(&num_tiles, sizeof(num_tiles));
+  if (
+    !std::equal(std::begin(magic), std::end(magic), std::begin(compact_map_magic)) ||
+    version != compact_map_version) {
+    throw std::runtime_error("Unsupported compact pointcloud map: " + path);
+  }
+
+  for (uint32_t i = 0; i < num_tiles; ++i) {
+    uint32_t id_size = 0;
+    read(&id_size, sizeof(id_size));
+    // a broken size must not allocate more than the file holds
+    std::string id(std::min<size_t>(id_size, size_ - cursor), '\0');
+    read(id.data(), id_size);
+
+    PCDFileMetadata metadata;
+    read(&metadata.min.x, sizeof(float));
+    read(&metadata.min.y, sizeof(float));
+    read(&metadata.min.z, sizeof(float));
+    read(&metadata.max.x, sizeof(float));
+    read(&metadata.max.y, sizeof(float));
+    read(&metadata.max.z, sizeof(float));
+
+    Tile tile{};
+    read(tile.origin, sizeof(tile.origin));
+    read(tile.scale, sizeof(tile.scale));
+    read(&tile.num_points, sizeof(tile.num_points));
+    read(&tile.data_offset, sizeof(tile.data_offset));
+    // the offset of an empty tile may be at the end of the file
+    if (
+      tile.num_points > 0 &&
+      (tile.data_offset > size_ ||
+       tile.num_points > (size_ - tile.data_offset) / quantized_point_size)) {
+      throw std::runtime_error("Invalid compact pointcloud map: " + path);
+    }
+
+    metadata_.emplace(id, metadata);
+    tiles_.emplace(id, tile);
+  }
+}
+
+CompactPointCloudMap::~CompactPointCloudMap()
+{
+  munmap(const_cast<uint8_t *>(data_), size_);
+}
+
+std::shared_ptr<const sensor_msgs::msg::PointCloud2> CompactPointCloudMap::load_tile(
+  const std::string & id) const
+{
+  const auto tile_itr = tiles_.find(id);
+  if (tile_itr == tiles_.end()) {
+    return nullptr;
+  }
+  const auto & tile = tile_itr->second;
+
+  auto pointcloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  pointcloud->height = 1;
+  pointcloud->width = static_cast<uint32_t>(tile.num_points);
+  for (const auto & [name, offset] : {std::make_pair("x", 0), std::make_pair("y", 4),
+                                      std::make_pair("z", 8)}) {
+    sensor_msgs::msg::PointField field;
+    field.name = name;
+    field.offset = offset;
+    field.datatype = sensor_msgs::msg::PointField::FLOAT32;
+    field.count = 1;
+    pointcloud->fields.push_back(field);
+  }
+  pointcloud->is_bigendian = false;
+  pointcloud->point_step = 3 * sizeof(float);
+  pointcloud->row_step = pointcloud->point_step * pointcloud->width;
+  pointcloud->is_dense = true;
+  pointcloud->data.resize(pointcloud->row_step);
+
+  const uint8_t * src = data_ + tile.data_offset;
+  auto * dst = pointcloud->data.data();
+  for (uint64_t i = 0; i < tile.num_points; ++i) {
+    int16_t quantized_point[3];
+    std::memcpy(quantized_point, src, quantized_point_size);
+    for (int axis = 0; axis < 3; ++axis) {
+      const auto value =
+        static_cast<float>(tile.origin[axis] + quantized_point[axis] * tile.scale[axis]);
+      std::memcpy(dst, &value, sizeof(value));
+      dst += sizeof(value);
+    }
+    src += quantized_point_size;
+  }
+  return pointcloud;
+}
@@ -0,0 +1,81 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef POINTCLOUD_MAP_LOADER__COMPACT_POINTCLOUD_MAP_HPP_
+#define POINTCLOUD_MAP_LOADER__COMPACT_POINTCLOUD_MAP_HPP_
+
+#include "utils.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+/**
+ * @brief write the pcd files as a compact pointcloud map
+ *
+ * Each tile stores the points as int16 offsets from the center of its points, with a scale per
+ * axis, so that a tile is decoded without parsing. The tiles are identified by the pcd file names.
+ *
+ * @param pcd_metadata_dict map of (pcd path, pcd file metadata)
+ * @throw std::runtime_error if a pcd file cannot be read or the output cannot be written
+ */
+void write_compact_pointcloud_map(
+  const std::string & output_path,
+  const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict);
+
+/**
+ * @brief compact pointcloud map mapped in memory
+ *
+ * Only the tile index is read when the map is opened. The tiles are read from the page cache when
+ * they are loaded, so that the resident memory is limited to the tiles in use.
+ */
+class CompactPointCloudMap
+{
+public:
+  /** @throw std::runtime_error if the file cannot be mapped or is not a compact pointcloud map */
+  explicit CompactPointCloudMap(const std::string & path);
+  ~CompactPointCloudMap();
+
+  CompactPointCloudMap(const CompactPointCloudMap &) = delete;
+  CompactPointCloudMap & operator=(const CompactPointCloudMap &) = delete;
+
+  /** @brief map of (tile ID, tile metadata) */
+  const std::map<std::string, PCDFileMetadata> & metadata() const { return metadata_; }
+
+  /** @brief decoded points of the tile as x, y and z fields, or nullptr if the ID is unknown */
+  std::shared_ptr<const sensor_msgs::msg::PointCloud2> load_tile(const std::string & id) const;
+
+private:
+  struct Tile
+  {
+    double origin[3];
+    float scale[3];
+    uint64_t num_points;
+    uint64_t data_offset;
+  };
+
+  void read_index(const std::string & path);
+
+  const uint8_t * data_{nullptr};
+  size_t size_{0};
+  std::map<std::string, Tile> tiles_;
+  std::map<std::string, PCDFileMetadata> metadata_;
+};
+
+#endif  // POINTCLOUD_MAP_LOADER__COMPACT_POINTCLOUD_MAP_HPP_
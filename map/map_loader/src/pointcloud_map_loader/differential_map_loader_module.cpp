@@ -14,11 +14,18 @@
 
 #include "differential_map_loader_module.hpp"
 
+#include <string>
 #include <utility>
+#include <vector>
 
 DifferentialMapLoaderModule::DifferentialMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<PCDTileCache> tile_cache, double prefetch_time_horizon)
+: logger_(node->get_logger()),
+  clock_(node->get_clock()),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  tile_cache_(std::move(tile_cache)),
+  prefetch_time_horizon_(prefetch_time_horizon)
 {
   get_differential_pcd_maps_service_ = node->create_service<GetDifferentialPointCloudMap>(
     "service/get_differential_pcd_map",
@@ -33,6 +40,7 @@ void DifferentialMapLoaderModule::differential_area_load(
 {
   // iterate over all the available pcd map grids
   std::vector<bool> should_remove(static_cast<int>(cached_ids.size()), true);
+  std::vector<std::string> paths_to_load;
   for (const auto & ele : all_pcd_file_metadata_dict_) {
     std::string path = ele.first;
     PCDFileMetadata metadata = ele.second;
@@ -48,16 +56,24 @@ void DifferentialMapLoaderModule::differential_area_load(
       int index = static_cast<int>(id_in_cached_list - cached_ids.begin());
       should_remove[index] = false;
     } else {
-      autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-        load_point_cloud_map_cell_with_id(path, map_id);
-      pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
-      pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
-      pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
-      pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-      response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+      paths_to_load.push_back(path);
     }
   }
 
+  // the workers load the other grids while the first ones are loaded here
+  tile_cache_->prefetch(paths_to_load);
+
+  for (const auto & path : paths_to_load) {
+    const PCDFileMetadata & metadata = all_pcd_file_metadata_dict_.at(path);
+    autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
+      load_point_cloud_map_cell_with_id(path, path);
+    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
+    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
+    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
+    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
+    response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+  }
+
   for (size_t i = 0; i < cached_ids.size(); ++i) {
     if (should_remove[i]) {
       response->ids_to_remove.push_back(cached_ids[i]);
@@ -67,25 +83,62 @@ void DifferentialMapLoaderModule::differential_area_load(
 
 bool DifferentialMapLoaderModule::on_service_get_differential_point_cloud_map(
   GetDifferentialPointCloudMap::Request::SharedPtr req,
-  GetDifferentialPointCloudMap::Response::SharedPtr res) const
+  GetDifferentialPointCloudMap::Response::SharedPtr res)
 {
   auto area = req->area;
   std::vector<std::string> cached_ids = req->cached_ids;
   differential_area_load(area, cached_ids, res);
   res->header.frame_id = "map";
+  prefetch_predicted_area(area);
   return true;
 }
 
+void DifferentialMapLoaderModule::prefetch_predicted_area(
+  const autoware_map_msgs::msg::AreaInfo & area_info)
+{
+  const rclcpp::Time request_time = clock_->now();
+  const auto last_area = last_area_;
+  const auto last_request_time = last_request_time_;
+  last_area_ = area_info;
+  last_request_time_ = request_time;
+  if (prefetch_time_horizon_ <= 0.0 || !last_area) {
+    return;
+  }
+  // clock of another source, e.g. after the simulation time started
+  if (request_time.get_clock_type() != last_request_time.get_clock_type()) {
+    return;
+  }
+  const double dt = (request_time - last_request_time).seconds();
+  if (dt <= 0.0) {
+    return;
+  }
+
+  // move the area along the velocity between the last two requests
+  const double ratio = prefetch_time_horizon_ / dt;
+  autoware_map_msgs::msg::AreaInfo predicted_area = area_info;
+  predicted_area.center_x += static_cast<float>((area_info.center_x - last_area->center_x) * ratio);
+  predicted_area.center_y += static_cast<float>((area_info.center_y - last_area->center_y) * ratio);
+
+  std::vector<std::string> paths;
+  for (const auto & [path, metadata] : all_pcd_file_metadata_dict_) {
+    if (is_grid_within_queried_area(predicted_area, metadata)) {
+      paths.push_back(path);
+    }
+  }
+  tile_cache_->prefetch(paths);
+}
+
 autoware_map_msgs::msg::PointCloudMapCellWithID
 DifferentialMapLoaderModule::load_point_cloud_map_cell_with_id(
   const std::string & path, const std::string & map_id) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  const auto pcd = tile_cache_->get(path);
+  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
+  if (pcd) {
+    pointcloud_map_cell_with_id.pointcloud = *pcd;
+  } else {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
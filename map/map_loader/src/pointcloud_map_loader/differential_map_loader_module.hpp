@@ -15,6 +15,7 @@
 #ifndef POINTCLOUD_MAP_LOADER__DIFFERENTIAL_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__DIFFERENTIAL_MAP_LOADER_MODULE_HPP_
 
+#include "pcd_tile_cache.hpp"
 #include "utils.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -29,6 +30,8 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -38,17 +41,27 @@ class DifferentialMapLoaderModule
 
 public:
   explicit DifferentialMapLoaderModule(
-    rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict);
+    rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+    std::shared_ptr<PCDTileCache> tile_cache = std::make_shared<PCDTileCache>(),
+    double prefetch_time_horizon = 0.0);
 
 private:
   rclcpp::Logger logger_;
+  rclcpp::Clock::SharedPtr clock_;
 
   std::map<std::string, PCDFileMetadata> all_pcd_file_metadata_dict_;
+  std::shared_ptr<PCDTileCache> tile_cache_;
   rclcpp::Service<GetDifferentialPointCloudMap>::SharedPtr get_differential_pcd_maps_service_;
 
+  // the next area is predicted from the motion between the last two requests
+  double prefetch_time_horizon_;
+  std::optional<autoware_map_msgs::msg::AreaInfo> last_area_;
+  rclcpp::Time last_request_time_;
+
   [[nodiscard]] bool on_service_get_differential_point_cloud_map(
     GetDifferentialPointCloudMap::Request::SharedPtr req,
-    GetDifferentialPointCloudMap::Response::SharedPtr res) const;
+    GetDifferentialPointCloudMap::Response::SharedPtr res);
+  void prefetch_predicted_area(const autoware_map_msgs::msg::AreaInfo & area_info);
   void differential_area_load(
     const autoware_map_msgs::msg::AreaInfo & area_info, const std::vector<std::string> & cached_ids,
     const GetDifferentialPointCloudMap::Response::SharedPtr & response) const;
@@ -14,11 +14,16 @@
 
 #include "partial_map_loader_module.hpp"
 
+#include <string>
 #include <utility>
+#include <vector>
 
 PartialMapLoaderModule::PartialMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<PCDTileCache> tile_cache)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  tile_cache_(std::move(tile_cache))
 {
   get_partial_pcd_maps_service_ = node->create_service<GetPartialPointCloudMap>(
     "service/get_partial_pcd_map",
@@ -32,16 +37,22 @@ void PartialMapLoaderModule::partial_area_load(
   const GetPartialPointCloudMap::Response::SharedPtr & response) const
 {
   // iterate over all the available pcd map grids
+  std::vector<std::string> paths;
   for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
+    // skip if the pcd file is not within the queried area
+    if (!is_grid_within_queried_area(area, ele.second)) continue;
+    paths.push_back(ele.first);
+  }
+
+  // the workers load the other grids while the first ones are loaded here
+  tile_cache_->prefetch(paths);
+
+  for (const auto & path : paths) {
+    const PCDFileMetadata & metadata = all_pcd_file_metadata_dict_.at(path);
 
     // assume that the map ID = map path (for now)
     const std::string & map_id = path;
 
-    // skip if the pcd file is not within the queried area
-    if (!is_grid_within_queried_area(area, metadata)) continue;
-
     autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
       load_point_cloud_map_cell_with_id(path, map_id);
     pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
@@ -67,12 +78,13 @@ autoware_map_msgs::msg::PointCloudMapCellWithID
 PartialMapLoaderModule::load_point_cloud_map_cell_with_id(
   const std::string & path, const std::string & map_id) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  const auto pcd = tile_cache_->get(path);
+  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
+  if (pcd) {
+    pointcloud_map_cell_with_id.pointcloud = *pcd;
+  } else {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
@@ -0,0 +1,162 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "pcd_tile_cache.hpp"
+
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <utility>
+
+PCDTileCache::PCDTileCache(
+  const size_t memory_limit_bytes, const size_t num_threads, TileLoader loader)
+: memory_limit_bytes_(memory_limit_bytes), loader_(std::move(loader))
+{
+  for (size_t i = 0; i < num_threads; ++i) {
+    workers_.emplace_back(&PCDTileCache::worker_loop, this);
+  }
+}
+
+PCDTileCache::~PCDTileCache()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+PCDTileCache::PointCloud2ConstPtr PCDTileCache::get(const std::string & path)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (const auto tile_itr = tiles_.find(path); tile_itr != tiles_.end()) {
+    lru_.splice(lru_.end(), lru_, tile_itr->second.lru_itr);
+    return tile_itr->second.pointcloud;
+  }
+
+  // wait for the worker instead of loading the same tile twice
+  if (const auto loading_itr = loading_.find(path); loading_itr != loading_.end()) {
+    const auto future = loading_itr->second;
+    lock.unlock();
+    return future.get();
+  }
+
+  queue_.erase(std::remove(queue_.begin(), queue_.end(), path), queue_.end());
+  auto promise = start_loading(path);
+  lock.unlock();
+
+  const auto pointcloud = loader_(path);
+
+  lock.lock();
+  finish_loading(path, pointcloud, promise);
+  return pointcloud;
+}
+
+void PCDTileCache::prefetch(const std::vector<std::string> & paths)
+{
+  if (workers_.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.clear();
+    for (const auto & path : paths) {
+      if (tiles_.count(path) == 0 && loading_.count(path) == 0) {
+        queue_.push_back(path);
+      }
+    }
+  }
+  condition_.notify_all();
+}
+
+bool PCDTileCache::contains(const std::string & path) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return tiles_.count(path) > 0;
+}
+
+size_t PCDTileCache::memory_usage() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return memory_usage_;
+}
+
+PCDTileCache::PointCloud2ConstPtr PCDTileCache::load_pcd_file(const std::string & path)
+{
+  auto pcd = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  if (pcl::io::loadPCDFile(path, *pcd) == -1) {
+    return nullptr;
+  }
+  return pcd;
+}
+
+std::promise<PCDTileCache::PointCloud2ConstPtr> PCDTileCache::start_loading(
+  const std::string & path)
+{
+  std::promise<PointCloud2ConstPtr> promise;
+  loading_.emplace(path, promise.get_future().share());
+  return promise;
+}
+
+void PCDTileCache::finish_loading(
+  const std::string & path, const PointCloud2ConstPtr & pointcloud,
+  std::promise<PointCloud2ConstPtr> & promise)
+{
+  loading_.erase(path);
+  promise.set_value(pointcloud);
+
+  // a failed load is retried on the next request, and a tile over the limit is never cached
+  const size_t tile_memory = pointcloud ? pointcloud->data.size() : 0;
+  if (!pointcloud || tile_memory > memory_limit_bytes_) {
+    return;
+  }
+
+  tiles_.emplace(path, Tile{pointcloud, lru_.insert(lru_.end(), path)});
+  memory_usage_ += tile_memory;
+  while (memory_usage_ > memory_limit_bytes_) {
+    const auto tile_itr = tiles_.find(lru_.front());
+    memory_usage_ -= tile_itr->second.pointcloud->data.size();
+    tiles_.erase(tile_itr);
+    lru_.pop_front();
+  }
+}
+
+void PCDTileCache::worker_loop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+    if (stop_) {
+      return;
+    }
+
+    const std::string path = queue_.front();
+    queue_.pop_front();
+    if (tiles_.count(path) > 0 || loading_.count(path) > 0) {
+      continue;
+    }
+
+    auto promise = start_loading(path);
+    lock.unlock();
+    const auto pointcloud = loader_(path);
+    lock.lock();
+    finish_loading(path, pointcloud, promise);
+  }
+}
@@ -0,0 +1,103 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef POINTCLOUD_MAP_LOADER__PCD_TILE_CACHE_HPP_
+#define POINTCLOUD_MAP_LOADER__PCD_TILE_CACHE_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief LRU cache of the decoded PCD tiles, bounded by the memory of the point clouds, with a pool
+ * of threads that load the tiles in background
+ *
+ * A tile that is requested while a worker loads it is waited for instead of being loaded twice, and
+ * a tile that is still queued is loaded by the caller. With no memory, nothing is cached, and with
+ * no threads, the tiles are only loaded by get(). The tiles are read from the pcd files unless
+ * another loader is given.
+ */
+class PCDTileCache
+{
+public:
+  using PointCloud2ConstPtr = std::shared_ptr<const sensor_msgs::msg::PointCloud2>;
+  /** @brief function that loads a tile, returning nullptr on failure */
+  using TileLoader = std::function<PointCloud2ConstPtr(const std::string &)>;
+
+  explicit PCDTileCache(
+    size_t memory_limit_bytes = 0, size_t num_threads = 0, TileLoader loader = load_pcd_file);
+  ~PCDTileCache();
+
+  PCDTileCache(const PCDTileCache &) = delete;
+  PCDTileCache & operator=(const PCDTileCache &) = delete;
+
+  /** @brief tile of the path, or nullptr if it cannot be loaded */
+  PointCloud2ConstPtr get(const std::string & path);
+
+  /**
+   * @brief load the tiles in background, replacing the tiles that are queued but not loaded yet
+   *
+   * The tiles that are cached or being loaded are skipped.
+   */
+  void prefetch(const std::vector<std::string> & paths);
+
+  bool contains(const std::string & path) const;
+  size_t memory_usage() const;
+
+  /** @brief default loader, which reads the tile from the pcd file of the path */
+  static PointCloud2ConstPtr load_pcd_file(const std::string & path);
+
+private:
+  struct Tile
+  {
+    PointCloud2ConstPtr pointcloud;
+    std::list<std::string>::iterator lru_itr;
+  };
+
+  /** @brief register the load of a tile, the mutex must be locked */
+  std::promise<PointCloud2ConstPtr> start_loading(const std::string & path);
+  /** @brief cache the loaded tile and notify the waiting callers, the mutex must be locked */
+  void finish_loading(
+    const std::string & path, const PointCloud2ConstPtr & pointcloud,
+    std::promise<PointCloud2ConstPtr> & promise);
+  void worker_loop();
+
+  const size_t memory_limit_bytes_;
+  const TileLoader loader_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::unordered_map<std::string, Tile> tiles_;
+  // least recently used first
+  std::list<std::string> lru_;
+  size_t memory_usage_{0};
+
+  std::deque<std::string> queue_;
+  std::unordered_map<std::string, std::shared_future<PointCloud2ConstPtr>> loading_;
+  bool stop_{false};
+  std::vector<std::thread> workers_;
+};
+
+#endif  // POINTCLOUD_MAP_LOADER__PCD_TILE_CACHE_HPP_
@@ -19,6 +19,7 @@
 #include <pcl/io/pcd_io.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -63,17 +64,39 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
       std::make_unique<PointcloudMapLoaderModule>(this, pcd_paths, publisher_name, true);
   }
 
-  // Parse the metadata file and get the map of (absolute pcd path, pcd file metadata)
-  auto pcd_metadata_dict = get_pcd_metadata(pcd_metadata_path, pcd_paths);
+  // the tiles of the compact map are served from the mapped file instead of the pcd files
+  const auto compact_pointcloud_map_path =
+    declare_parameter<std::string>("compact_pointcloud_map_path");
+  std::map<std::string, PCDFileMetadata> pcd_metadata_dict;
+  PCDTileCache::TileLoader tile_loader = PCDTileCache::load_pcd_file;
+  if (!compact_pointcloud_map_path.empty()) {
+    const auto compact_map = std::make_shared<CompactPointCloudMap>(compact_pointcloud_map_path);
+    pcd_metadata_dict = compact_map->metadata();
+    tile_loader = [compact_map](const std::string & id) { return compact_map->load_tile(id); };
+  } else {
+    // Parse the metadata file and get the map of (absolute pcd path, pcd file metadata)
+    pcd_metadata_dict = get_pcd_metadata(pcd_metadata_path, pcd_paths);
+  }
+
+  // the decoded pcd files are shared between the partial, differential and selected loaders
+  const auto tile_cache_memory_limit_mb = declare_parameter<int64_t>("tile_cache_memory_limit_mb");
+  const auto tile_loader_num_threads = declare_parameter<int64_t>("tile_loader_num_threads");
+  const auto prefetch_time_horizon = declare_parameter<double>("prefetch_time_horizon");
+  const auto tile_cache = std::make_shared<PCDTileCache>(
+    static_cast<size_t>(std::max<int64_t>(tile_cache_memory_limit_mb, 0)) * 1024 * 1024,
+    static_cast<size_t>(std::max<int64_t>(tile_loader_num_threads, 0)), tile_loader);
 
   if (enable_partial_load) {
-    partial_map_loader_ = std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict);
+    partial_map_loader_ =
+      std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict, tile_cache);
   }
 
-  differential_map_loader_ = std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict);
+  differential_map_loader_ = std::make_unique<DifferentialMapLoaderModule>(
+    this, pcd_metadata_dict, tile_cache, prefetch_time_horizon);
 
   if (enable_selected_load) {
-    selected_map_loader_ = std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict);
+    selected_map_loader_ =
+      std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict, tile_cache);
   }
 }
 
@@ -15,6 +15,7 @@
 #ifndef POINTCLOUD_MAP_LOADER__POINTCLOUD_MAP_LOADER_NODE_HPP_
 #define POINTCLOUD_MAP_LOADER__POINTCLOUD_MAP_LOADER_NODE_HPP_
 
+#include "compact_pointcloud_map.hpp"
 #include "differential_map_loader_module.hpp"
 #include "partial_map_loader_module.hpp"
 #include "pointcloud_map_loader_module.hpp"
@@ -14,7 +14,9 @@
 
 #include "selected_map_loader_module.hpp"
 
+#include <string>
 #include <utility>
+#include <vector>
 namespace
 {
 autoware_map_msgs::msg::PointCloudMapMetaData create_metadata(
@@ -45,8 +47,11 @@ autoware_map_msgs::msg::PointCloudMapMetaData create_metadata(
 }  // namespace
 
 SelectedMapLoaderModule::SelectedMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<PCDTileCache> tile_cache)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  tile_cache_(std::move(tile_cache))
 {
   get_selected_pcd_maps_service_ = node->create_service<GetSelectedPointCloudMap>(
     "service/get_selected_pcd_map",
@@ -67,6 +72,16 @@ bool SelectedMapLoaderModule::on_service_get_selected_point_cloud_map(
   GetSelectedPointCloudMap::Response::SharedPtr res) const
 {
   const auto request_ids = req->cell_ids;
+
+  // the workers load the other cells while the first ones are loaded here
+  std::vector<std::string> paths;
+  for (const auto & request_id : request_ids) {
+    if (all_pcd_file_metadata_dict_.count(request_id) > 0) {
+      paths.push_back(request_id);
+    }
+  }
+  tile_cache_->prefetch(paths);
+
   for (const auto & request_id : request_ids) {
     const auto requested_selected_map_iterator = all_pcd_file_metadata_dict_.find(request_id);
 
@@ -98,12 +113,13 @@ autoware_map_msgs::msg::PointCloudMapCellWithID
 SelectedMapLoaderModule::load_point_cloud_map_cell_with_id(
   const std::string & path, const std::string & map_id) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  const auto pcd = tile_cache_->get(path);
+  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
+  if (pcd) {
+    pointcloud_map_cell_with_id.pointcloud = *pcd;
+  } else {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
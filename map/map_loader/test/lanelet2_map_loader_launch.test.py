@@ -40,6 +40,9 @@ def generate_test_description():
                 "center_line_resolution": 5.0,
                 "use_waypoints": True,
                 "allow_unsupported_version": True,
+                "use_lanelet2_map_cache": False,
+                "enable_differential_load": True,
+                "differential_load_cell_size": 20.0,
             }
         ],
     )
@@ -0,0 +1,96 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "../src/pointcloud_map_loader/compact_pointcloud_map.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+std::map<std::string, PCDFileMetadata> create_dummy_map()
+{
+  pcl::PointCloud<pcl::PointXYZ> dummy_cloud;
+  dummy_cloud.push_back(pcl::PointXYZ(89000.5, 43000.25, 10.0));
+  dummy_cloud.push_back(pcl::PointXYZ(89019.9, 43019.9, 12.5));
+  dummy_cloud.push_back(pcl::PointXYZ(89010.0, 43010.0, 11.0));
+  pcl::io::savePCDFileBinary("/tmp/dummy_compact_0.pcd", dummy_cloud);
+  pcl::PointCloud<pcl::PointXYZ> single_point_cloud;
+  single_point_cloud.push_back(pcl::PointXYZ(89030.0, 43010.0, 11.0));
+  pcl::io::savePCDFileBinary("/tmp/dummy_compact_1.pcd", single_point_cloud);
+
+  PCDFileMetadata metadata_0;
+  metadata_0.min = pcl::PointXYZ(89000.0, 43000.0, 0.0);
+  metadata_0.max = pcl::PointXYZ(89020.0, 43020.0, 0.0);
+  PCDFileMetadata metadata_1;
+  metadata_1.min = pcl::PointXYZ(89020.0, 43000.0, 0.0);
+  metadata_1.max = pcl::PointXYZ(89040.0, 43020.0, 0.0);
+  return {{"/tmp/dummy_compact_0.pcd", metadata_0}, {"/tmp/dummy_compact_1.pcd", metadata_1}};
+}
+}  // namespace
+
+TEST(CompactPointCloudMapTest, WriteAndLoadTiles)
+{
+  const auto pcd_metadata_dict = create_dummy_map();
+  write_compact_pointcloud_map("/tmp/dummy_compact.map", pcd_metadata_dict);
+  const CompactPointCloudMap compact_map("/tmp/dummy_compact.map");
+
+  // the tiles are identified by the pcd file names
+  const auto & metadata = compact_map.metadata();
+  ASSERT_EQ(metadata.size(), 2u);
+  EXPECT_EQ(metadata.at("dummy_compact_0.pcd"), pcd_metadata_dict.at("/tmp/dummy_compact_0.pcd"));
+  EXPECT_EQ(metadata.at("dummy_compact_1.pcd"), pcd_metadata_dict.at("/tmp/dummy_compact_1.pcd"));
+
+  const auto pointcloud = compact_map.load_tile("dummy_compact_0.pcd");
+  ASSERT_NE(pointcloud, nullptr);
+  pcl::PointCloud<pcl::PointXYZ> points;
+  pcl::fromROSMsg(*pointcloud, points);
+  ASSERT_EQ(points.size(), 3u);
+  EXPECT_NEAR(points[0].x, 89000.5, 1e-2);
+  EXPECT_NEAR(points[0].y, 43000.25, 1e-2);
+  EXPECT_NEAR(points[0].z, 10.0, 1e-3);
+  EXPECT_NEAR(points[1].x, 89019.9, 1e-2);
+  EXPECT_NEAR(points[1].y, 43019.9, 1e-2);
+  EXPECT_NEAR(points[1].z, 12.5, 1e-3);
+  EXPECT_NEAR(points[2].x, 89010.0, 1e-2);
+  EXPECT_NEAR(points[2].y, 43010.0, 1e-2);
+  EXPECT_NEAR(points[2].z, 11.0, 1e-3);
+
+  // a single point has no extent to quantize
+  const auto single_pointcloud = compact_map.load_tile("dummy_compact_1.pcd");
+  ASSERT_NE(single_pointcloud, nullptr);
+  pcl::fromROSMsg(*single_pointcloud, points);
+  ASSERT_EQ(points.size(), 1u);
+  EXPECT_NEAR(points[0].x, 89030.0, 1e-2);
+  EXPECT_NEAR(points[0].y, 43010.0, 1e-2);
+  EXPECT_NEAR(points[0].z, 11.0, 1e-3);
+
+  EXPECT_EQ(compact_map.load_tile("missing.pcd"), nullptr);
+}
+
+TEST(CompactPointCloudMapTest, RejectInvalidFile)
+{
+  EXPECT_THROW(CompactPointCloudMap("/tmp/missing_dummy_compact.map"), std::runtime_error);
+
+  std::ofstream("/tmp/dummy_invalid_compact.map") << "not a compact map";
+  EXPECT_THROW(CompactPointCloudMap("/tmp/dummy_invalid_compact.map"), std::runtime_error);
+}
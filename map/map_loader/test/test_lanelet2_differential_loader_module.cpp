@@ -0,0 +1,90 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_loader/lanelet2_differential_loader_module.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace
+{
+lanelet::Lanelet create_lanelet(const lanelet::Id id, const double x, const double y)
+{
+  const lanelet::LineString3d left(
+    id + 1,
+    {lanelet::Point3d(id + 2, x, y + 1.0, 0.0), lanelet::Point3d(id + 3, x + 5.0, y + 1.0, 0.0)});
+  const lanelet::LineString3d right(
+    id + 4,
+    {lanelet::Point3d(id + 5, x, y - 1.0, 0.0), lanelet::Point3d(id + 6, x + 5.0, y - 1.0, 0.0)});
+  return lanelet::Lanelet(id, left, right);
+}
+}  // namespace
+
+class TestLanelet2DifferentialLoaderModule : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = std::make_shared<rclcpp::Node>("test_lanelet2_differential_loader_module");
+
+    auto map = std::make_shared<lanelet::LaneletMap>();
+    map->add(create_lanelet(100, 1.0, 5.0));
+    map->add(create_lanelet(200, 41.0, 5.0));
+    autoware_map_msgs::msg::LaneletMapBin map_bin_msg;
+    map_bin_msg.version_map_format = "1.2.0";
+    map_bin_msg.version_map = "map_version";
+    lanelet::utils::conversion::toBinMsg(map, &map_bin_msg);
+
+    module_ = std::make_shared<Lanelet2DifferentialLoaderModule>(
+      node_.get(), map_bin_msg, 20.0, 20.0);
+  }
+
+  void TearDown() override { rclcpp::shutdown(); }
+
+  rclcpp::Node::SharedPtr node_;
+  std::shared_ptr<Lanelet2DifferentialLoaderModule> module_;
+};
+
+TEST_F(TestLanelet2DifferentialLoaderModule, Metadata)
+{
+  const auto metadata = module_->create_metadata();
+  ASSERT_EQ(metadata.metadata_list.size(), 2u);
+  EXPECT_EQ(metadata.metadata_list.at(0).cell_id, "lanelet2_map_0_0.bin");
+  EXPECT_DOUBLE_EQ(metadata.metadata_list.at(0).min_x, 1.0);
+  EXPECT_DOUBLE_EQ(metadata.metadata_list.at(0).max_x, 6.0);
+  EXPECT_EQ(metadata.metadata_list.at(1).cell_id, "lanelet2_map_2_0.bin");
+}
+
+TEST_F(TestLanelet2DifferentialLoaderModule, LoadSelectedCells)
+{
+  const auto msg = module_->create_cells_msg({"lanelet2_map_2_0.bin", "unknown"});
+  EXPECT_EQ(msg.version_map_format, "1.2.0");
+  EXPECT_EQ(msg.version_map, "map_version");
+
+  auto cells = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(msg, cells);
+  ASSERT_EQ(cells->laneletLayer.size(), 1u);
+  EXPECT_TRUE(cells->laneletLayer.exists(200));
+
+  const auto all_cells_msg =
+    module_->create_cells_msg({"lanelet2_map_0_0.bin", "lanelet2_map_2_0.bin"});
+  auto all_cells = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(all_cells_msg, all_cells);
+  EXPECT_EQ(all_cells->laneletLayer.size(), 2u);
+}
@@ -0,0 +1,120 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "../src/lanelet2_map_loader/lanelet2_map_cache.hpp"
+
+#include <gmock/gmock.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using ::testing::ContainerEq;
+
+namespace
+{
+std::string create_map_file(const std::string & contents)
+{
+  std::filesystem::path tmp_path = std::filesystem::temp_directory_path() / "temp_lanelet2_map.osm";
+
+  std::ofstream ofs(tmp_path);
+  ofs << contents;
+  ofs.close();
+
+  return tmp_path.string();
+}
+
+tier4_map_msgs::msg::MapProjectorInfo create_projector_info()
+{
+  tier4_map_msgs::msg::MapProjectorInfo projector_info;
+  projector_info.projector_type = tier4_map_msgs::msg::MapProjectorInfo::MGRS;
+  projector_info.vertical_datum = tier4_map_msgs::msg::MapProjectorInfo::WGS84;
+  projector_info.mgrs_grid = "54SUE";
+  return projector_info;
+}
+}  // namespace
+
+TEST(Lanelet2MapCacheTest, WriteAndRead)
+{
+  const auto map_path = create_map_file("<osm version='0.6'/>");
+  const auto cache_path = lanelet2_map_cache::get_cache_path(map_path);
+  const auto key =
+    lanelet2_map_cache::create_cache_key(map_path, create_projector_info(), 5.0, true);
+  ASSERT_TRUE(key.has_value());
+
+  const lanelet2_map_cache::CachedMap map{"1.2.0", "map_version", {0, 1, 2, 255}};
+  ASSERT_TRUE(lanelet2_map_cache::write_cache(cache_path, *key, map));
+
+  const auto cached_map = lanelet2_map_cache::read_cache(cache_path, *key);
+  ASSERT_TRUE(cached_map.has_value());
+  EXPECT_EQ(cached_map->format_version, map.format_version);
+  EXPECT_EQ(cached_map->map_version, map.map_version);
+  EXPECT_THAT(cached_map->data, ContainerEq(map.data));
+
+  std::filesystem::remove(cache_path);
+  std::filesystem::remove(map_path);
+}
+
+TEST(Lanelet2MapCacheTest, KeyChangesWithMapAndSettings)
+{
+  const auto projector_info = create_projector_info();
+  const auto map_path = create_map_file("<osm version='0.6'/>");
+  const auto key = lanelet2_map_cache::create_cache_key(map_path, projector_info, 5.0, true);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_EQ(lanelet2_map_cache::create_cache_key(map_path, projector_info, 5.0, true), key);
+
+  EXPECT_NE(lanelet2_map_cache::create_cache_key(map_path, projector_info, 2.0, true), key);
+  EXPECT_NE(lanelet2_map_cache::create_cache_key(map_path, projector_info, 5.0, false), key);
+
+  auto other_projector_info = projector_info;
+  other_projector_info.mgrs_grid = "54SUF";
+  EXPECT_NE(lanelet2_map_cache::create_cache_key(map_path, other_projector_info, 5.0, true), key);
+
+  create_map_file("<osm version='0.6'><node/></osm>");
+  EXPECT_NE(lanelet2_map_cache::create_cache_key(map_path, projector_info, 5.0, true), key);
+
+  std::filesystem::remove(map_path);
+  EXPECT_FALSE(lanelet2_map_cache::create_cache_key(map_path, projector_info, 5.0, true));
+}
+
+TEST(Lanelet2MapCacheTest, RejectInvalidCache)
+{
+  const auto map_path = create_map_file("<osm version='0.6'/>");
+  const auto cache_path = lanelet2_map_cache::get_cache_path(map_path);
+  const auto key =
+    lanelet2_map_cache::create_cache_key(map_path, create_projector_info(), 5.0, true);
+  ASSERT_TRUE(key.has_value());
+
+  // missing cache
+  std::filesystem::remove(cache_path);
+  EXPECT_FALSE(lanelet2_map_cache::read_cache(cache_path, *key));
+
+  // cache written with another key
+  const lanelet2_map_cache::CachedMap map{"1.2.0", "map_version", {0, 1, 2, 255}};
+  ASSERT_TRUE(lanelet2_map_cache::write_cache(cache_path, *key + "other", map));
+  EXPECT_FALSE(lanelet2_map_cache::read_cache(cache_path, *key));
+
+  // truncated cache
+  ASSERT_TRUE(lanelet2_map_cache::write_cache(cache_path, *key, map));
+  std::filesystem::resize_file(cache_path, std::filesystem::file_size(cache_path) - 1);
+  EXPECT_FALSE(lanelet2_map_cache::read_cache(cache_path, *key));
+
+  // not a cache
+  std::ofstream(cache_path) << "not a cache";
+  EXPECT_FALSE(lanelet2_map_cache::read_cache(cache_path, *key));
+
+  std::filesystem::remove(cache_path);
+  std::filesystem::remove(map_path);
+}
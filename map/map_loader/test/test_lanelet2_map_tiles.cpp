@@ -0,0 +1,105 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_loader/lanelet2_map_tiles.hpp"
+
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+#include <autoware_lanelet2_extension/utility/utilities.hpp>
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+using ::testing::ElementsAre;
+
+namespace
+{
+lanelet::Lanelet create_lanelet(const lanelet::Id id, const double x, const double y)
+{
+  const lanelet::LineString3d left(
+    id + 1,
+    {lanelet::Point3d(id + 2, x, y + 1.0, 0.0), lanelet::Point3d(id + 3, x + 5.0, y + 1.0, 0.0)});
+  const lanelet::LineString3d right(
+    id + 4,
+    {lanelet::Point3d(id + 5, x, y - 1.0, 0.0), lanelet::Point3d(id + 6, x + 5.0, y - 1.0, 0.0)});
+  return lanelet::Lanelet(id, left, right);
+}
+}  // namespace
+
+TEST(Lanelet2MapTilesTest, GetTileIndex)
+{
+  const auto index = lanelet2_map_tiles::get_tile_index(25.0, -5.0, 20.0, 20.0);
+  EXPECT_EQ(index.x, 1);
+  EXPECT_EQ(index.y, -1);
+  EXPECT_EQ(lanelet2_map_tiles::get_tile_name(index), "lanelet2_map_1_-1.bin");
+}
+
+TEST(Lanelet2MapTilesTest, DivideIntoTiles)
+{
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  map->add(create_lanelet(100, 1.0, 5.0));
+  map->add(create_lanelet(200, 41.0, 5.0));
+  map->add(lanelet::LineString3d(
+    300, {lanelet::Point3d(301, 45.0, 10.0, 0.0), lanelet::Point3d(302, 46.0, 10.0, 0.0)}));
+
+  const auto tiles = lanelet2_map_tiles::divide_into_tiles(*map, 20.0, 20.0);
+  ASSERT_EQ(tiles.size(), 2u);
+
+  const auto & first_tile = tiles.at({0, 0});
+  ASSERT_EQ(first_tile.lanelets.size(), 1u);
+  EXPECT_EQ(first_tile.lanelets.front().id(), 100);
+  EXPECT_TRUE(first_tile.line_strings.empty());
+
+  const auto & second_tile = tiles.at({2, 0});
+  ASSERT_EQ(second_tile.lanelets.size(), 1u);
+  EXPECT_EQ(second_tile.lanelets.front().id(), 200);
+  ASSERT_EQ(second_tile.line_strings.size(), 1u);
+  EXPECT_EQ(second_tile.line_strings.front().id(), 300);
+
+  const auto tile_map = lanelet2_map_tiles::create_tile_map(second_tile);
+  EXPECT_EQ(tile_map->laneletLayer.size(), 1u);
+  EXPECT_EQ(tile_map->lineStringLayer.size(), 3u);
+
+  const auto metadata = lanelet2_map_tiles::create_tile_metadata(*tile_map);
+  EXPECT_DOUBLE_EQ(metadata.min_x, 41.0);
+  EXPECT_DOUBLE_EQ(metadata.max_x, 46.0);
+  EXPECT_DOUBLE_EQ(metadata.min_y, 4.0);
+  EXPECT_DOUBLE_EQ(metadata.max_y, 10.0);
+  EXPECT_THAT(metadata.lanelet_ids, ElementsAre(200));
+}
+
+TEST(Lanelet2MapTilesTest, ValidateTile)
+{
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  map->add(create_lanelet(100, 1.0, 5.0));
+  const auto tiles = lanelet2_map_tiles::divide_into_tiles(*map, 20.0, 20.0);
+  const auto tile_map = lanelet2_map_tiles::create_tile_map(tiles.at({0, 0}));
+
+  autoware_map_msgs::msg::LaneletMapBin msg;
+  lanelet::utils::conversion::toBinMsg(tile_map, &msg);
+
+  // the centerline is not precomputed yet
+  EXPECT_EQ(lanelet2_map_tiles::validate_tile(*tile_map, msg.data).size(), 1u);
+
+  lanelet::utils::overwriteLaneletsCenterline(tile_map, 5.0, false);
+  lanelet::utils::conversion::toBinMsg(tile_map, &msg);
+  EXPECT_TRUE(lanelet2_map_tiles::validate_tile(*tile_map, msg.data).empty());
+
+  // broken data cannot be deserialized
+  msg.data.resize(msg.data.size() / 2);
+  EXPECT_FALSE(lanelet2_map_tiles::validate_tile(*tile_map, msg.data).empty());
+}
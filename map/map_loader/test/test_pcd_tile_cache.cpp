@@ -0,0 +1,114 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "../src/pointcloud_map_loader/pcd_tile_cache.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_types.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace
+{
+std::string save_dummy_pcd(const std::string & name, const size_t num_points)
+{
+  pcl::PointCloud<pcl::PointXYZ> dummy_cloud;
+  dummy_cloud.width = num_points;
+  dummy_cloud.height = 1;
+  dummy_cloud.points.resize(num_points, pcl::PointXYZ(1.0, 2.0, 3.0));
+  const std::string path = "/tmp/" + name;
+  pcl::io::savePCDFileBinary(path, dummy_cloud);
+  return path;
+}
+}  // namespace
+
+TEST(PCDTileCacheTest, CachesLoadedTiles)
+{
+  const auto path = save_dummy_pcd("dummy_tile_0.pcd", 3);
+  PCDTileCache tile_cache(1024 * 1024, 0);
+
+  const auto pointcloud = tile_cache.get(path);
+  ASSERT_NE(pointcloud, nullptr);
+  EXPECT_EQ(pointcloud->width * pointcloud->height, 3u);
+  EXPECT_TRUE(tile_cache.contains(path));
+  EXPECT_EQ(tile_cache.memory_usage(), pointcloud->data.size());
+
+  // the same tile is returned without loading it again
+  EXPECT_EQ(tile_cache.get(path), pointcloud);
+}
+
+TEST(PCDTileCacheTest, EvictsLeastRecentlyUsedTiles)
+{
+  const auto path_0 = save_dummy_pcd("dummy_tile_0.pcd", 10);
+  const auto path_1 = save_dummy_pcd("dummy_tile_1.pcd", 10);
+  const auto path_2 = save_dummy_pcd("dummy_tile_2.pcd", 10);
+
+  // room for two tiles
+  const size_t tile_memory = PCDTileCache(1024 * 1024).get(path_0)->data.size();
+  PCDTileCache tile_cache(2 * tile_memory, 0);
+
+  ASSERT_NE(tile_cache.get(path_0), nullptr);
+  ASSERT_NE(tile_cache.get(path_1), nullptr);
+  ASSERT_NE(tile_cache.get(path_0), nullptr);
+  ASSERT_NE(tile_cache.get(path_2), nullptr);
+
+  EXPECT_TRUE(tile_cache.contains(path_0));
+  EXPECT_FALSE(tile_cache.contains(path_1));
+  EXPECT_TRUE(tile_cache.contains(path_2));
+  EXPECT_EQ(tile_cache.memory_usage(), 2 * tile_memory);
+}
+
+TEST(PCDTileCacheTest, DoesNotCacheWithoutMemory)
+{
+  const auto path = save_dummy_pcd("dummy_tile_0.pcd", 3);
+  PCDTileCache tile_cache;
+
+  ASSERT_NE(tile_cache.get(path), nullptr);
+  EXPECT_FALSE(tile_cache.contains(path));
+  EXPECT_EQ(tile_cache.memory_usage(), 0u);
+}
+
+TEST(PCDTileCacheTest, ReturnsNullForMissingFile)
+{
+  PCDTileCache tile_cache(1024 * 1024, 1);
+  EXPECT_EQ(tile_cache.get("/tmp/missing_dummy_tile.pcd"), nullptr);
+  EXPECT_FALSE(tile_cache.contains("/tmp/missing_dummy_tile.pcd"));
+}
+
+TEST(PCDTileCacheTest, PrefetchesInBackground)
+{
+  const auto path_0 = save_dummy_pcd("dummy_tile_0.pcd", 3);
+  const auto path_1 = save_dummy_pcd("dummy_tile_1.pcd", 3);
+  PCDTileCache tile_cache(1024 * 1024, 2);
+
+  tile_cache.prefetch({path_0, path_1});
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+  while ((!tile_cache.contains(path_0) || !tile_cache.contains(path_1)) &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(tile_cache.contains(path_0));
+  EXPECT_TRUE(tile_cache.contains(path_1));
+
+  // a tile requested while it is queued or being loaded is only loaded once
+  const auto path_2 = save_dummy_pcd("dummy_tile_2.pcd", 3);
+  tile_cache.prefetch({path_2});
+  const auto pointcloud = tile_cache.get(path_2);
+  ASSERT_NE(pointcloud, nullptr);
+  EXPECT_EQ(tile_cache.get(path_2), pointcloud);
+}
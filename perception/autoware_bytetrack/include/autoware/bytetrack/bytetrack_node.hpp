@@ -45,17 +45,24 @@ public:
 
 private:
   void on_connect();
-  void on_rect(const tier4_perception_msgs::msg::DetectedObjectsWithFeature::ConstSharedPtr msg);
+  void on_rect(
+    const tier4_perception_msgs::msg::DetectedObjectsWithFeature::ConstSharedPtr msg,
+    const size_t camera_index);
 
-  rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr objects_pub_;
-  rclcpp::Publisher<tier4_perception_msgs::msg::DynamicObjectArray>::SharedPtr objects_uuid_pub_;
+  // one tracker per camera stream, all served by this node
+  std::vector<rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr>
+    objects_pubs_;
+  std::vector<rclcpp::Publisher<tier4_perception_msgs::msg::DynamicObjectArray>::SharedPtr>
+    objects_uuid_pubs_;
 
-  rclcpp::Subscription<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr
-    detection_rect_sub_;
+  std::vector<
+    rclcpp::Subscription<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr>
+    detection_rect_subs_;
+  std::vector<std::string> detection_rect_topics_;
 
   rclcpp::TimerBase::SharedPtr timer_;
 
-  std::unique_ptr<autoware::bytetrack::ByteTrack> bytetrack_;
+  std::vector<std::unique_ptr<autoware::bytetrack::ByteTrack>> bytetracks_;
 };
 
 }  // namespace autoware::bytetrack
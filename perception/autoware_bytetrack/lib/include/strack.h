@@ -58,7 +58,7 @@ public:
   ~STrack();
 
   std::vector<float> static tlbr_to_tlwh(std::vector<float> & tlbr);
-  static void multi_predict(std::vector<STrack *> & stracks);
+  static void multi_predict(std::vector<STrack *> & stracks, const int frame_id);
   void static_tlwh();
   void static_tlbr();
   std::vector<float> tlwh_to_xyah(std::vector<float> tlwh_tmp);
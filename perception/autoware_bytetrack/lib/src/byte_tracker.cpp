@@ -106,10 +106,8 @@ std::vector<STrack> ByteTracker::update(const std::vector<ByteTrackObject> & obj
 
   ////////////////// Step 2: First association, with IoU //////////////////
   strack_pool = joint_stracks(tracked_stracks, this->lost_stracks);
-  // do prediction for each stracks
-  for (size_t i = 0; i < strack_pool.size(); i++) {
-    strack_pool[i]->predict(this->frame_id);
-  }
+  // do prediction for all stracks at once
+  STrack::multi_predict(strack_pool, this->frame_id);
 
   std::vector<std::vector<float> > dists;
   int dist_size = 0, dist_size_size = 0;
@@ -44,6 +44,8 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <limits>
+
 // init static variable
 bool STrack::_parameters_loaded = false;
 STrack::KfParams STrack::_kf_parameters;
@@ -69,11 +71,11 @@ STrack::STrack(std::vector<float> input_tlwh, float score, int label)
   this->label = label;
 
   // load static kf parameters: initialized once in program
-  const std::string package_share_directory =
-    ament_index_cpp::get_package_share_directory("autoware_bytetrack");
-  const std::string default_config_path =
-    package_share_directory + "/config/kalman_filter.param.yaml";
   if (!_parameters_loaded) {
+    const std::string package_share_directory =
+      ament_index_cpp::get_package_share_directory("autoware_bytetrack");
+    const std::string default_config_path =
+      package_share_directory + "/config/kalman_filter.param.yaml";
     load_parameters(default_config_path);
     _parameters_loaded = true;
   }
@@ -241,17 +243,63 @@ int STrack::end_frame()
   return this->frame_id;
 }
 
-void STrack::multi_predict(std::vector<STrack *> & stracks)
+/** predict all the tracked tracklets to frame_id at once */
+void STrack::multi_predict(std::vector<STrack *> & stracks, const int frame_id)
 {
-  for (size_t i = 0; i < stracks.size(); i++) {
-    if (stracks[i]->state != TrackState::Tracked) {
-      // not tracked
+  // assert parameter is loaded
+  assert(_parameters_loaded);
+
+  std::vector<STrack *> tracked_stracks;
+  tracked_stracks.reserve(stracks.size());
+  for (auto * strack : stracks) {
+    // same as predict(), only the tracked tracklets are predicted
+    if (strack->state == TrackState::Tracked) {
+      tracked_stracks.push_back(strack);
+    }
+  }
+  if (tracked_stracks.empty()) {
+    return;
+  }
+
+  // stack the states of all the tracklets to predict them in one pass
+  const auto num_stracks = static_cast<Eigen::Index>(tracked_stracks.size());
+  Eigen::MatrixXd X(_kf_parameters.dim_x, num_stracks);
+  Eigen::RowVectorXd time_elapsed(num_stracks);
+  Eigen::MatrixXd x = Eigen::MatrixXd::Zero(_kf_parameters.dim_x, 1);
+  for (Eigen::Index i = 0; i < num_stracks; ++i) {
+    tracked_stracks[i]->kalman_filter_.getX(x);
+    X.col(i) = x;
+    time_elapsed(i) = _kf_parameters.dt * (frame_id - tracked_stracks[i]->frame_id);
+  }
+  // constant velocity model: tlwh += time_elapsed * velocity
+  X.topRows<4>() += X.bottomRows<4>() * time_elapsed.asDiagonal();
+
+  // Q matrix is shared by all the tracklets
+  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(_kf_parameters.dim_x, _kf_parameters.dim_x);
+  Q(IDX::X1, IDX::X1) = _kf_parameters.q_cov_x;
+  Q(IDX::Y1, IDX::Y1) = _kf_parameters.q_cov_y;
+  Q(IDX::VX1, IDX::VX1) = _kf_parameters.q_cov_vx;
+  Q(IDX::VY1, IDX::VY1) = _kf_parameters.q_cov_vy;
+  Q(IDX::X2, IDX::X2) = _kf_parameters.q_cov_x;
+  Q(IDX::Y2, IDX::Y2) = _kf_parameters.q_cov_y;
+  Q(IDX::VX2, IDX::VX2) = _kf_parameters.q_cov_vx;
+  Q(IDX::VY2, IDX::VY2) = _kf_parameters.q_cov_vy;
+
+  // A matrix is rebuilt only when the elapsed time changes, which is rare
+  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(_kf_parameters.dim_x, _kf_parameters.dim_x);
+  double a_time_elapsed = std::numeric_limits<double>::quiet_NaN();
+  for (Eigen::Index i = 0; i < num_stracks; ++i) {
+    if (time_elapsed(i) != a_time_elapsed) {
+      a_time_elapsed = time_elapsed(i);
+      A(IDX::X1, IDX::VX1) = a_time_elapsed;
+      A(IDX::Y1, IDX::VY1) = a_time_elapsed;
+      A(IDX::X2, IDX::VX2) = a_time_elapsed;
+      A(IDX::Y2, IDX::VY2) = a_time_elapsed;
     }
     // prediction
-    stracks[i]->predict(stracks[i]->frame_id + 1);
-    // TODO(me): write prediction
-    stracks[i]->static_tlwh();
-    stracks[i]->static_tlbr();
+    if (!tracked_stracks[i]->kalman_filter_.predict(X.col(i), A, Q)) {
+      std::cerr << "Cannot predict" << std::endl;
+    }
   }
 }
 
@@ -40,6 +40,7 @@
 #include "lapjv.h"
 
 #include <cstddef>
+#include <numeric>
 
 std::vector<STrack *> ByteTracker::joint_stracks(
   std::vector<STrack *> & tlista, std::vector<STrack> & tlistb)
@@ -156,9 +157,69 @@ void ByteTracker::linear_assignment(
     return;
   }
 
-  std::vector<int> rowsol;
-  std::vector<int> colsol;
-  [[maybe_unused]] float c = lapjv(cost_matrix, rowsol, colsol, true, thresh);
+  // A pair whose cost is not below thresh is never assigned, because leaving both unmatched costs
+  // thresh in the extended cost matrix. So the assignment is solved separately for each connected
+  // component of the pairs below thresh, which is the same as solving the whole matrix at once.
+  const int n_rows = static_cast<int>(cost_matrix.size());
+  const int n_cols = static_cast<int>(cost_matrix[0].size());
+  std::vector<int> parents(n_rows + n_cols);
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find_root = [&parents](int i) {
+    while (parents[i] != i) {
+      parents[i] = parents[parents[i]];
+      i = parents[i];
+    }
+    return i;
+  };
+  std::vector<int> num_gated_pairs(n_rows + n_cols, 0);
+  for (int i = 0; i < n_rows; i++) {
+    for (int j = 0; j < n_cols; j++) {
+      if (cost_matrix[i][j] < thresh) {
+        num_gated_pairs[i]++;
+        num_gated_pairs[n_rows + j]++;
+        parents[find_root(i)] = find_root(n_rows + j);
+      }
+    }
+  }
+
+  std::vector<int> rowsol(n_rows, -1);
+  std::vector<int> colsol(n_cols, -1);
+  std::vector<std::vector<int>> component_rows(n_rows + n_cols);
+  std::vector<std::vector<int>> component_cols(n_rows + n_cols);
+  for (int i = 0; i < n_rows; i++) {
+    if (num_gated_pairs[i] > 0) component_rows[find_root(i)].push_back(i);
+  }
+  for (int j = 0; j < n_cols; j++) {
+    if (num_gated_pairs[n_rows + j] > 0) component_cols[find_root(n_rows + j)].push_back(j);
+  }
+  for (size_t root = 0; root < component_rows.size(); root++) {
+    const auto & rows = component_rows[root];
+    const auto & cols = component_cols[root];
+    if (rows.empty()) continue;
+    // a single gated pair is always assigned
+    if (rows.size() == 1 && cols.size() == 1) {
+      rowsol[rows[0]] = cols[0];
+      colsol[cols[0]] = rows[0];
+      continue;
+    }
+    std::vector<std::vector<float>> component_cost(rows.size(), std::vector<float>(cols.size()));
+    for (size_t i = 0; i < rows.size(); i++) {
+      for (size_t j = 0; j < cols.size(); j++) {
+        component_cost[i][j] = cost_matrix[rows[i]][cols[j]];
+      }
+    }
+    std::vector<int> component_rowsol;
+    std::vector<int> component_colsol;
+    [[maybe_unused]] float c =
+      lapjv(component_cost, component_rowsol, component_colsol, true, thresh);
+    for (size_t i = 0; i < rows.size(); i++) {
+      if (component_rowsol[i] >= 0) {
+        rowsol[rows[i]] = cols[component_rowsol[i]];
+        colsol[cols[component_rowsol[i]]] = rows[i];
+      }
+    }
+  }
+
   for (size_t i = 0; i < rowsol.size(); i++) {
     if (rowsol[i] >= 0) {
       std::vector<int> match;
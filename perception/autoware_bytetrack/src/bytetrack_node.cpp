@@ -20,6 +20,8 @@
 
 #include <rmw/qos_profiles.h>
 
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -28,38 +30,55 @@ namespace autoware::bytetrack
 ByteTrackNode::ByteTrackNode(const rclcpp::NodeOptions & node_options)
 : Node("bytetrack", node_options)
 {
-  using std::placeholders::_1;
   using std::chrono_literals::operator""ms;
 
   int track_buffer_length = declare_parameter("track_buffer_length", 30);
+  const int rois_number = declare_parameter("rois_number", 1);
+  if (rois_number < 1) {
+    throw std::runtime_error("rois_number should be larger than 0.");
+  }
 
-  this->bytetrack_ = std::make_unique<autoware::bytetrack::ByteTrack>(track_buffer_length);
+  // the topics are numbered only when the node serves more than one camera
+  for (int i = 0; i < rois_number; ++i) {
+    const std::string suffix = rois_number == 1 ? "" : std::to_string(i);
+    bytetracks_.push_back(std::make_unique<autoware::bytetrack::ByteTrack>(track_buffer_length));
+    detection_rect_topics_.push_back("~/in/rect" + suffix);
+    detection_rect_subs_.emplace_back();
+    objects_pubs_.push_back(
+      this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
+        "~/out/objects" + suffix, 1));
+    objects_uuid_pubs_.push_back(
+      this->create_publisher<tier4_perception_msgs::msg::DynamicObjectArray>(
+        "~/out/objects" + suffix + "/debug/uuid", 1));
+  }
 
   timer_ =
     rclcpp::create_timer(this, get_clock(), 100ms, std::bind(&ByteTrackNode::on_connect, this));
-
-  objects_pub_ = this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
-    "~/out/objects", 1);
-  objects_uuid_pub_ = this->create_publisher<tier4_perception_msgs::msg::DynamicObjectArray>(
-    "~/out/objects/debug/uuid", 1);
 }
 
 void ByteTrackNode::on_connect()
 {
-  using std::placeholders::_1;
-  if (
-    objects_pub_->get_subscription_count() == 0 &&
-    objects_pub_->get_intra_process_subscription_count() == 0) {
-    detection_rect_sub_.reset();
-  } else if (!detection_rect_sub_) {
-    detection_rect_sub_ =
-      this->create_subscription<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
-        "~/in/rect", 1, std::bind(&ByteTrackNode::on_rect, this, _1));
+  for (size_t i = 0; i < bytetracks_.size(); ++i) {
+    auto & detection_rect_sub = detection_rect_subs_[i];
+    if (
+      objects_pubs_[i]->get_subscription_count() == 0 &&
+      objects_pubs_[i]->get_intra_process_subscription_count() == 0) {
+      detection_rect_sub.reset();
+    } else if (!detection_rect_sub) {
+      detection_rect_sub =
+        this->create_subscription<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
+          detection_rect_topics_[i], 1,
+          [this, i](
+            const tier4_perception_msgs::msg::DetectedObjectsWithFeature::ConstSharedPtr msg) {
+            on_rect(msg, i);
+          });
+    }
   }
 }
 
 void ByteTrackNode::on_rect(
-  const tier4_perception_msgs::msg::DetectedObjectsWithFeature::ConstSharedPtr msg)
+  const tier4_perception_msgs::msg::DetectedObjectsWithFeature::ConstSharedPtr msg,
+  const size_t camera_index)
 {
   using Label = autoware_perception_msgs::msg::ObjectClassification;
 
@@ -79,7 +98,8 @@ void ByteTrackNode::on_rect(
     object_array.emplace_back(obj);
   }
 
-  autoware::bytetrack::ObjectArray objects = bytetrack_->update_tracker(object_array);
+  autoware::bytetrack::ObjectArray objects =
+    bytetracks_[camera_index]->update_tracker(object_array);
   for (const auto & tracked_object : objects) {
     tier4_perception_msgs::msg::DetectedObjectWithFeature object;
     // fit xy offset to 0 if roi is outside of image
@@ -109,10 +129,10 @@ void ByteTrackNode::on_rect(
   }
 
   out_objects.header = msg->header;
-  objects_pub_->publish(out_objects);
+  objects_pubs_[camera_index]->publish(out_objects);
 
   out_objects_uuid.header = msg->header;
-  objects_uuid_pub_->publish(out_objects_uuid);
+  objects_uuid_pubs_[camera_index]->publish(out_objects_uuid);
 }
 }  // namespace autoware::bytetrack
 
@@ -0,0 +1,118 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COMPARE_ELEVATION_MAP_FILTER__ELEVATION_GRID_HPP_
+#define COMPARE_ELEVATION_MAP_FILTER__ELEVATION_GRID_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace autoware::compare_map_segmentation
+{
+/**
+ * @brief elevation layer of a grid map in a flat row-major array, for the lookup of many points
+ *
+ * The cell (i, j) is the cell of the grid map index, whose i goes along -x and j along -y from the
+ * corner of the maximum x and y, so that the lookup is a few integer operations on the array
+ * instead of the per-layer and circular buffer lookup of grid_map::GridMap::atPosition.
+ */
+class ElevationGrid
+{
+public:
+  /**
+   * @brief set the cells
+   *
+   * @param max_x x of the corner of the maximum x and y, which is the map position plus half the
+   * map length
+   * @param elevation function of the cell index (i, j) to the elevation
+   */
+  template <typename ElevationFunctionT>
+  void set(
+    double max_x, double max_y, double resolution, int size_x, int size_y,
+    ElevationFunctionT && elevation)
+  {
+    max_x_ = max_x;
+    max_y_ = max_y;
+    inverse_resolution_ = 1.0 / resolution;
+    size_x_ = size_x;
+    size_y_ = size_y;
+    cells_.resize(static_cast<size_t>(size_x) * static_cast<size_t>(size_y));
+    for (int i = 0; i < size_x; ++i) {
+      for (int j = 0; j < size_y; ++j) {
+        cells_[cell_index(i, j)] = elevation(i, j);
+      }
+    }
+  }
+
+  bool empty() const { return cells_.empty(); }
+
+  /**
+   * @brief elevation at the point, bilinearly interpolated between the centers of the four cells
+   * around it as grid_map::InterpolationMethods::INTER_LINEAR
+   *
+   * The cells beyond the border are clamped to the border cells. The elevation is NaN if the point
+   * is outside the map, or if one of the cells is NaN.
+   */
+  float elevation_at(double x, double y) const
+  {
+    // the position in the cells from the corner, which is in [0, size) inside the map
+    const double cell_x = (max_x_ - x) * inverse_resolution_;
+    const double cell_y = (max_y_ - y) * inverse_resolution_;
+    if (!(cell_x >= 0.0 && cell_y >= 0.0 && cell_x < size_x_ && cell_y < size_y_)) {
+      return std::numeric_limits<float>::quiet_NaN();
+    }
+    const int i = std::min(static_cast<int>(cell_x), size_x_ - 1);
+    const int j = std::min(static_cast<int>(cell_y), size_y_ - 1);
+
+    // the offset from the center of the cell selects the neighbor cell on the side of the point
+    const float offset_x = static_cast<float>(cell_x - i) - 0.5f;
+    const float offset_y = static_cast<float>(cell_y - j) - 0.5f;
+    const int neighbor_i = std::clamp(offset_x < 0.0f ? i - 1 : i + 1, 0, size_x_ - 1);
+    const int neighbor_j = std::clamp(offset_y < 0.0f ? j - 1 : j + 1, 0, size_y_ - 1);
+    const float weight_x = std::abs(offset_x);
+    const float weight_y = std::abs(offset_y);
+
+    const float * row = &cells_[cell_index(i, 0)];
+    const float * neighbor_row = &cells_[cell_index(neighbor_i, 0)];
+    return (1.0f - weight_x) * ((1.0f - weight_y) * row[j] + weight_y * row[neighbor_j]) +
+           weight_x * ((1.0f - weight_y) * neighbor_row[j] + weight_y * neighbor_row[neighbor_j]);
+  }
+
+  /** @brief elevations of the points, whose coordinates are given as separate arrays */
+  void elevations_at(const float * x, const float * y, size_t size, float * elevations) const
+  {
+    for (size_t k = 0; k < size; ++k) {
+      elevations[k] = elevation_at(x[k], y[k]);
+    }
+  }
+
+private:
+  double max_x_{0.0};
+  double max_y_{0.0};
+  double inverse_resolution_{1.0};
+  int size_x_{0};
+  int size_y_{0};
+  std::vector<float> cells_;
+
+  size_t cell_index(int i, int j) const
+  {
+    return static_cast<size_t>(i) * static_cast<size_t>(size_y_) + static_cast<size_t>(j);
+  }
+};
+}  // namespace autoware::compare_map_segmentation
+
+#endif  // COMPARE_ELEVATION_MAP_FILTER__ELEVATION_GRID_HPP_
@@ -15,13 +15,13 @@
 #include "node.hpp"
 
 #include <grid_map_core/GridMap.hpp>
-#include <grid_map_cv/GridMapCvConverter.hpp>
 #include <grid_map_pcl/GridMapPclLoader.hpp>
 #include <grid_map_pcl/helpers.hpp>
 #include <grid_map_ros/GridMapRosConverter.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <grid_map_msgs/msg/grid_map.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <glob.h>
 #include <pcl/io/pcd_io.h>
@@ -29,7 +29,12 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <rcutils/filesystem.h>  // To be replaced by std::filesystem in C++17
 
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::compare_map_segmentation
 {
@@ -41,48 +46,160 @@ CompareElevationMapFilterComponent::CompareElevationMapFilterComponent(
   layer_name_ = declare_parameter<std::string>("map_layer_name");
   height_diff_thresh_ = declare_parameter<float>("height_diff_thresh");
   map_frame_ = declare_parameter<std::string>("map_frame");
+  use_elevation_submap_ = declare_parameter<bool>("use_elevation_submap");
+  submap_length_ = declare_parameter<double>("submap_length");
+  submap_update_distance_ = declare_parameter<double>("submap_update_distance");
+  const auto timer_interval_ms = declare_parameter<int>("timer_interval_ms");
 
-  rclcpp::QoS durable_qos{1};
-  durable_qos.transient_local();
+  if (!use_elevation_submap_) {
+    rclcpp::QoS durable_qos{1};
+    durable_qos.transient_local();
 
-  sub_map_ = this->create_subscription<grid_map_msgs::msg::GridMap>(
-    "input/elevation_map", durable_qos,
-    std::bind(
-      &CompareElevationMapFilterComponent::elevationMapCallback, this, std::placeholders::_1));
+    sub_map_ = this->create_subscription<grid_map_msgs::msg::GridMap>(
+      "input/elevation_map", durable_qos,
+      std::bind(
+        &CompareElevationMapFilterComponent::elevationMapCallback, this, std::placeholders::_1));
+    return;
+  }
+
+  sub_kinematic_state_ = this->create_subscription<nav_msgs::msg::Odometry>(
+    "kinematic_state", rclcpp::QoS{1},
+    std::bind(&CompareElevationMapFilterComponent::onKinematicState, this, std::placeholders::_1));
+
+  client_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  submap_client_ = create_client<grid_map_msgs::srv::GetGridMap>(
+    "service/get_elevation_submap", rmw_qos_profile_services_default, client_callback_group_);
+  while (!submap_client_->wait_for_service(std::chrono::seconds(1)) && rclcpp::ok()) {
+    RCLCPP_INFO(get_logger(), "service not available, waiting again ...");
+  }
+
+  const auto period_ns = rclcpp::Rate(timer_interval_ms).period();
+  timer_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  submap_update_timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns,
+    std::bind(&CompareElevationMapFilterComponent::submapUpdateTimerCallback, this),
+    timer_callback_group_);
 }
 
 void CompareElevationMapFilterComponent::elevationMapCallback(
   const grid_map_msgs::msg::GridMap::ConstSharedPtr elevation_map)
 {
-  grid_map::GridMapRosConverter::fromMessage(*elevation_map, elevation_map_);
-  elevation_map_data_ = elevation_map_.get(layer_name_);
-
-  const float min_value = elevation_map_.get(layer_name_).minCoeffOfFinites();
-  const float max_value = elevation_map_.get(layer_name_).maxCoeffOfFinites();
-  grid_map::GridMapCvConverter::toImage<uint16_t, 1>(
-    elevation_map_, layer_name_, CV_16UC1, min_value, max_value, elevation_image_);
-  subscribe();
+  setElevationMap(*elevation_map);
+}
+
+void CompareElevationMapFilterComponent::onKinematicState(
+  const nav_msgs::msg::Odometry::ConstSharedPtr msg)
+{
+  current_position_ = msg->pose.pose.position;
+}
+
+void CompareElevationMapFilterComponent::submapUpdateTimerCallback()
+{
+  if (!current_position_) {
+    return;
+  }
+  if (last_updated_position_) {
+    const double distance = std::hypot(
+      current_position_->x - last_updated_position_->x,
+      current_position_->y - last_updated_position_->y);
+    if (distance <= submap_update_distance_) {
+      return;
+    }
+  }
+  const auto position = *current_position_;
+  requestElevationSubmap(position);
+}
+
+void CompareElevationMapFilterComponent::requestElevationSubmap(
+  const geometry_msgs::msg::Point & position)
+{
+  auto request = std::make_shared<grid_map_msgs::srv::GetGridMap::Request>();
+  request->frame_id = map_frame_;
+  request->position_x = position.x;
+  request->position_y = position.y;
+  request->length_x = submap_length_;
+  request->length_y = submap_length_;
+  request->layers.push_back(layer_name_);
+
+  auto result{submap_client_->async_send_request(
+    request, [](rclcpp::Client<grid_map_msgs::srv::GetGridMap>::SharedFuture) {})};
+
+  std::future_status status = result.wait_for(std::chrono::seconds(0));
+  while (status != std::future_status::ready) {
+    RCLCPP_INFO(get_logger(), "Waiting for response...");
+    if (!rclcpp::ok()) {
+      return;
+    }
+    status = result.wait_for(std::chrono::seconds(1));
+  }
+
+  const auto & submap = result.get()->map;
+  if (submap.data.empty()) {
+    RCLCPP_WARN(get_logger(), "Received an empty elevation submap");
+    return;
+  }
+  setElevationMap(submap);
+  last_updated_position_ = position;
+}
+
+void CompareElevationMapFilterComponent::setElevationMap(
+  const grid_map_msgs::msg::GridMap & elevation_map)
+{
+  std::lock_guard<std::mutex> lock(elevation_map_mutex_);
+  grid_map::GridMapRosConverter::fromMessage(elevation_map, elevation_map_);
+
+  // the cells in the order of the map index, unwrapping the circular buffer of the layer
+  const auto & layer = elevation_map_.get(layer_name_);
+  const auto & size = elevation_map_.getSize();
+  const auto & start_index = elevation_map_.getStartIndex();
+  const grid_map::Position corner =
+    elevation_map_.getPosition() + 0.5 * elevation_map_.getLength().matrix();
+  elevation_grid_.set(
+    corner.x(), corner.y(), elevation_map_.getResolution(), size(0), size(1),
+    [&](const int i, const int j) {
+      return layer((start_index(0) + i) % size(0), (start_index(1) + j) % size(1));
+    });
+
+  if (!is_elevation_map_received_) {
+    is_elevation_map_received_ = true;
+    subscribe();
+  }
 }
 
 void CompareElevationMapFilterComponent::filter(
   const PointCloud2ConstPtr & input, [[maybe_unused]] const IndicesPtr & indices,
   PointCloud2 & output)
 {
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_input(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_output(new pcl::PointCloud<pcl::PointXYZ>);
+  const size_t num_points = input->width * input->height;
+  std::vector<float> x(num_points);
+  std::vector<float> y(num_points);
+  std::vector<float> z(num_points);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*input, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*input, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*input, "z");
+  for (size_t k = 0; k < num_points; ++k, ++iter_x, ++iter_y, ++iter_z) {
+    x[k] = *iter_x;
+    y[k] = *iter_y;
+    z[k] = *iter_z;
+  }
 
+  std::lock_guard<std::mutex> lock(elevation_map_mutex_);
   elevation_map_.setTimestamp(input->header.stamp.nanosec);
-  pcl::fromROSMsg(*input, *pcl_input);
-  pcl_output->points.reserve(pcl_input->points.size());
-  for (const auto & point : pcl_input->points) {
-    if (elevation_map_.isInside(grid_map::Position(point.x, point.y))) {
-      float elevation_value = elevation_map_.atPosition(
-        layer_name_, grid_map::Position(point.x, point.y),
-        grid_map::InterpolationMethods::INTER_LINEAR);
-      const float height_diff = point.z - elevation_value;
-      if (height_diff > height_diff_thresh_) {
-        pcl_output->points.push_back(point);
-      }
+  std::vector<float> elevations(num_points);
+  elevation_grid_.elevations_at(x.data(), y.data(), num_points, elevations.data());
+
+  // the elevation of the points outside the map is NaN, so that they are not kept as well
+  const float height_diff_thresh = static_cast<float>(height_diff_thresh_);
+  std::vector<uint8_t> is_kept(num_points);
+  for (size_t k = 0; k < num_points; ++k) {
+    is_kept[k] = z[k] - elevations[k] > height_diff_thresh;
+  }
+
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_output(new pcl::PointCloud<pcl::PointXYZ>);
+  pcl_output->points.reserve(num_points);
+  for (size_t k = 0; k < num_points; ++k) {
+    if (is_kept[k]) {
+      pcl_output->points.emplace_back(x[k], y[k], z[k]);
     }
   }
 
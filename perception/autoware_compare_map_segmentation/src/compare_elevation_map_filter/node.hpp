@@ -16,14 +16,18 @@
 #define COMPARE_ELEVATION_MAP_FILTER__NODE_HPP_
 
 #include "autoware/pointcloud_preprocessor/filter.hpp"
+#include "elevation_grid.hpp"
 
 #include <grid_map_core/GridMap.hpp>
-#include <grid_map_cv/grid_map_cv.hpp>
 #include <grid_map_pcl/GridMapPclLoader.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <grid_map_msgs/msg/grid_map.hpp>
+#include <grid_map_msgs/srv/get_grid_map.hpp>
+#include <nav_msgs/msg/odometry.hpp>
 
+#include <mutex>
+#include <optional>
 #include <string>
 namespace autoware::compare_map_segmentation
 {
@@ -35,18 +39,36 @@ protected:
 
 private:
   rclcpp::Subscription<grid_map_msgs::msg::GridMap>::SharedPtr sub_map_;
+  rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr sub_kinematic_state_;
+  rclcpp::Client<grid_map_msgs::srv::GetGridMap>::SharedPtr submap_client_;
+  rclcpp::CallbackGroup::SharedPtr client_callback_group_;
+  rclcpp::CallbackGroup::SharedPtr timer_callback_group_;
+  rclcpp::TimerBase::SharedPtr submap_update_timer_;
 
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr pub_filtered_cloud_;
   grid_map::GridMap elevation_map_;
-  cv::Mat elevation_image_;
-  grid_map::Matrix elevation_map_data_;
+  // the layer of elevation_map_ for the lookup of the points
+  ElevationGrid elevation_grid_;
   std::string layer_name_;
   std::string map_frame_;
   double height_diff_thresh_;
 
+  // only the elevation map around the ego is kept when it is requested from the tiled map loader
+  bool use_elevation_submap_;
+  double submap_length_;
+  double submap_update_distance_;
+  std::optional<geometry_msgs::msg::Point> current_position_;
+  std::optional<geometry_msgs::msg::Point> last_updated_position_;
+  bool is_elevation_map_received_{false};
+  std::mutex elevation_map_mutex_;
+
   void setVerbosityLevelToDebugIfFlagSet();
   void processPointcloud(grid_map::GridMapPclLoader * gridMapPclLoader);
   void elevationMapCallback(const grid_map_msgs::msg::GridMap::ConstSharedPtr elevation_map);
+  void setElevationMap(const grid_map_msgs::msg::GridMap & elevation_map);
+  void onKinematicState(const nav_msgs::msg::Odometry::ConstSharedPtr msg);
+  void submapUpdateTimerCallback();
+  void requestElevationSubmap(const geometry_msgs::msg::Point & position);
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
@@ -17,10 +17,10 @@
 #include "autoware/universe_utils/ros/debug_publisher.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
 
-#include <pcl/kdtree/kdtree_flann.h>
-#include <pcl/search/kdtree.h>
 #include <pcl/segmentation/segment_differences.h>
 
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 namespace autoware::compare_map_segmentation
@@ -31,17 +31,9 @@ void DistanceBasedStaticMapLoader::onMapCallback(
 {
   pcl::PointCloud<pcl::PointXYZ> map_pcl;
   pcl::fromROSMsg<pcl::PointXYZ>(*map, map_pcl);
-  const auto map_pcl_ptr = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_pcl);
-  map_ptr_ = map_pcl_ptr;
-  *tf_map_input_frame_ = map_ptr_->header.frame_id;
-  if (!tree_) {
-    if (map_ptr_->isOrganized()) {
-      tree_.reset(new pcl::search::OrganizedNeighbor<pcl::PointXYZ>());
-    } else {
-      tree_.reset(new pcl::search::KdTree<pcl::PointXYZ>(false));
-    }
-  }
-  tree_->setInputCloud(map_ptr_);
+  *tf_map_input_frame_ = map_pcl.header.frame_id;
+  // the static map is indexed as a single map cell
+  map_index_.add_cell("map", map_pcl);
   is_initialized_.store(true, std::memory_order_release);
 }
 
@@ -51,59 +43,15 @@ bool DistanceBasedStaticMapLoader::is_close_to_map(
   if (!is_initialized_.load(std::memory_order_acquire)) {
     return false;
   }
-  if (map_ptr_ == nullptr) {
-    return false;
-  }
-  if (tree_ == nullptr) {
-    return false;
-  }
-
-  std::vector<int> nn_indices(1);
-  std::vector<float> nn_sqr_distances(1);
-  if (!isFinite(point)) {
-    return false;
-  }
-  if (!tree_->nearestKSearch(point, 1, nn_indices, nn_sqr_distances)) {
-    return false;
-  }
-  if (nn_sqr_distances[0] > distance_threshold * distance_threshold) {
-    return false;
-  }
-  return true;
+  return map_index_.is_within(point, distance_threshold);
 }
 
 bool DistanceBasedDynamicMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
-  if (current_voxel_grid_dict_.size() == 0) {
-    return false;
-  }
-  if (!isFinite(point)) {
-    return false;
-  }
-
-  const int map_grid_index = static_cast<int>(
-    std::floor((point.x - origin_x_) / map_grid_size_x_) +
-    map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
-
-  if (static_cast<size_t>(map_grid_index) >= current_voxel_grid_array_.size()) {
-    return false;
-  }
-  if (current_voxel_grid_array_.at(map_grid_index) != nullptr) {
-    if (current_voxel_grid_array_.at(map_grid_index)->map_cell_kdtree == nullptr) {
-      return false;
-    }
-    std::vector<int> nn_indices(1);
-    std::vector<float> nn_distances(1);
-    if (!current_voxel_grid_array_.at(map_grid_index)
-           ->map_cell_kdtree->nearestKSearch(point, 1, nn_indices, nn_distances)) {
-      return false;
-    }
-    if (nn_distances[0] <= distance_threshold) {
-      return true;
-    }
-  }
-  return false;
+  std::shared_lock<std::shared_mutex> lock(map_cell_voxel_index_mutex_);
+  // the index also finds the map points of the neighbor map cells
+  return map_cell_voxel_index_.is_within(point, distance_threshold);
 }
 
 DistanceBasedCompareMapFilterComponent::DistanceBasedCompareMapFilterComponent(
@@ -17,10 +17,10 @@
 #include "autoware/universe_utils/ros/debug_publisher.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
 
-#include <pcl/kdtree/kdtree_flann.h>
-#include <pcl/search/kdtree.h>
 #include <pcl/segmentation/segment_differences.h>
 
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 namespace autoware::compare_map_segmentation
@@ -31,27 +31,9 @@ void VoxelDistanceBasedStaticMapLoader::onMapCallback(
 {
   pcl::PointCloud<pcl::PointXYZ> map_pcl;
   pcl::fromROSMsg<pcl::PointXYZ>(*map, map_pcl);
-  const auto map_pcl_ptr = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_pcl);
-
-  map_ptr_ = map_pcl_ptr;
-  *tf_map_input_frame_ = map_ptr_->header.frame_id;
-  // voxel
-  voxel_map_ptr_.reset(new pcl::PointCloud<pcl::PointXYZ>);
-  voxel_grid_.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, voxel_leaf_size_);
-  voxel_grid_.setInputCloud(map_pcl_ptr);
-  voxel_grid_.setSaveLeafLayout(true);
-  voxel_grid_.filter(*voxel_map_ptr_);
-  // kdtree
-  map_ptr_ = map_pcl_ptr;
-
-  if (!tree_) {
-    if (map_ptr_->isOrganized()) {
-      tree_.reset(new pcl::search::OrganizedNeighbor<pcl::PointXYZ>());
-    } else {
-      tree_.reset(new pcl::search::KdTree<pcl::PointXYZ>(false));
-    }
-  }
-  tree_->setInputCloud(map_ptr_);
+  *tf_map_input_frame_ = map_pcl.header.frame_id;
+  // the static map is indexed as a single map cell
+  map_index_.add_cell("map", map_pcl);
   is_initialized_.store(true, std::memory_order_release);
 }
 
@@ -61,43 +43,16 @@ bool VoxelDistanceBasedStaticMapLoader::is_close_to_map(
   if (!is_initialized_.load(std::memory_order_acquire)) {
     return false;
   }
-  if (voxel_map_ptr_ == nullptr) {
-    return false;
-  }
-  if (map_ptr_ == nullptr) {
-    return false;
-  }
-  if (tree_ == nullptr) {
-    return false;
-  }
-  if (is_close_to_neighbor_voxels(point, distance_threshold, voxel_grid_, tree_)) {
-    return true;
-  }
-  return false;
+  // the points in an occupied voxel are removed without looking at the distance
+  return map_index_.is_in_occupied_voxel(point) || map_index_.is_within(point, distance_threshold);
 }
 
 bool VoxelDistanceBasedDynamicMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
-  if (current_voxel_grid_dict_.size() == 0) {
-    return false;
-  }
-
-  const int map_grid_index = static_cast<int>(
-    std::floor((point.x - origin_x_) / map_grid_size_x_) +
-    map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
-
-  if (static_cast<size_t>(map_grid_index) >= current_voxel_grid_array_.size()) {
-    return false;
-  }
-  if (
-    current_voxel_grid_array_.at(map_grid_index) != nullptr &&
-    is_close_to_neighbor_voxels(
-      point, distance_threshold, current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_grid,
-      current_voxel_grid_array_.at(map_grid_index)->map_cell_kdtree)) {
-    return true;
-  }
-  return false;
+  std::shared_lock<std::shared_mutex> lock(map_cell_voxel_index_mutex_);
+  return map_cell_voxel_index_.is_in_occupied_voxel(point) ||
+         map_cell_voxel_index_.is_within(point, distance_threshold);
 }
 
 VoxelDistanceBasedCompareMapFilterComponent::VoxelDistanceBasedCompareMapFilterComponent(
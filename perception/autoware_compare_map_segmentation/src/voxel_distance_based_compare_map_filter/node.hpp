@@ -36,14 +36,14 @@ using PointCloudConstPtr = typename PointCloud::ConstPtr;
 class VoxelDistanceBasedStaticMapLoader : public VoxelGridStaticMapLoader
 {
 private:
-  PointCloudConstPtr map_ptr_;
-  pcl::search::Search<pcl::PointXYZ>::Ptr tree_;
+  MapCellVoxelIndex map_index_;
 
 public:
   explicit VoxelDistanceBasedStaticMapLoader(
     rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
     std::string * tf_map_input_frame)
-  : VoxelGridStaticMapLoader(node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame)
+  : VoxelGridStaticMapLoader(node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame),
+    map_index_(leaf_size, leaf_size)
   {
     RCLCPP_INFO(logger_, "VoxelDistanceBasedStaticMapLoader initialized.\n");
   }
@@ -51,73 +51,18 @@ public:
   void onMapCallback(const sensor_msgs::msg::PointCloud2::ConstSharedPtr map) override;
 };
 
-class VoxelDistanceBasedDynamicMapLoader : public VoxelGridDynamicMapLoader
+class VoxelDistanceBasedDynamicMapLoader : public MapCellVoxelIndexDynamicMapLoader
 {
-protected:
-private:
-  PointCloudConstPtr map_ptr_;
-  /* data */
 public:
   explicit VoxelDistanceBasedDynamicMapLoader(
     rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
     std::string * tf_map_input_frame, rclcpp::CallbackGroup::SharedPtr main_callback_group)
-  : VoxelGridDynamicMapLoader(
+  : MapCellVoxelIndexDynamicMapLoader(
       node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, main_callback_group)
   {
     RCLCPP_INFO(logger_, "VoxelDistanceBasedDynamicMapLoader initialized.\n");
   }
   bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) override;
-
-  inline void addMapCellAndFilter(
-    const autoware_map_msgs::msg::PointCloudMapCellWithID & map_cell_to_add) override
-  {
-    map_grid_size_x_ = map_cell_to_add.metadata.max_x - map_cell_to_add.metadata.min_x;
-    map_grid_size_y_ = map_cell_to_add.metadata.max_y - map_cell_to_add.metadata.min_y;
-
-    pcl::PointCloud<pcl::PointXYZ> map_cell_pc_tmp;
-    pcl::fromROSMsg(map_cell_to_add.pointcloud, map_cell_pc_tmp);
-
-    VoxelGridPointXYZ map_cell_voxel_grid_tmp;
-    PointCloudPtr map_cell_downsampled_pc_ptr_tmp;
-
-    auto map_cell_voxel_input_tmp_ptr =
-      std::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_cell_pc_tmp);
-    map_cell_voxel_grid_tmp.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, voxel_leaf_size_);
-    map_cell_downsampled_pc_ptr_tmp.reset(new pcl::PointCloud<pcl::PointXYZ>);
-    map_cell_voxel_grid_tmp.setInputCloud(map_cell_voxel_input_tmp_ptr);
-    map_cell_voxel_grid_tmp.setSaveLeafLayout(true);
-    map_cell_voxel_grid_tmp.filter(*map_cell_downsampled_pc_ptr_tmp);
-
-    MapGridVoxelInfo current_voxel_grid_list_item;
-    current_voxel_grid_list_item.min_b_x = map_cell_to_add.metadata.min_x;
-    current_voxel_grid_list_item.min_b_y = map_cell_to_add.metadata.min_y;
-    current_voxel_grid_list_item.max_b_x = map_cell_to_add.metadata.max_x;
-    current_voxel_grid_list_item.max_b_y = map_cell_to_add.metadata.max_y;
-
-    current_voxel_grid_list_item.map_cell_voxel_grid.set_voxel_grid(
-      &(map_cell_voxel_grid_tmp.leaf_layout_), map_cell_voxel_grid_tmp.get_min_b(),
-      map_cell_voxel_grid_tmp.get_max_b(), map_cell_voxel_grid_tmp.get_div_b(),
-      map_cell_voxel_grid_tmp.get_divb_mul(), map_cell_voxel_grid_tmp.get_inverse_leaf_size());
-
-    current_voxel_grid_list_item.map_cell_pc_ptr.reset(new pcl::PointCloud<pcl::PointXYZ>);
-    current_voxel_grid_list_item.map_cell_pc_ptr = std::move(map_cell_downsampled_pc_ptr_tmp);
-
-    // add kdtree
-    pcl::search::Search<pcl::PointXYZ>::Ptr tree_tmp;
-    if (!tree_tmp) {
-      if (map_cell_voxel_input_tmp_ptr->isOrganized()) {
-        tree_tmp.reset(new pcl::search::OrganizedNeighbor<pcl::PointXYZ>());
-      } else {
-        tree_tmp.reset(new pcl::search::KdTree<pcl::PointXYZ>(false));
-      }
-    }
-    tree_tmp->setInputCloud(map_cell_voxel_input_tmp_ptr);
-    current_voxel_grid_list_item.map_cell_kdtree = tree_tmp;
-
-    // add
-    std::lock_guard<std::mutex> lock(dynamic_map_loader_mutex_);
-    current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
-  }
 };
 
 class VoxelDistanceBasedCompareMapFilterComponent : public autoware::pointcloud_preprocessor::Filter
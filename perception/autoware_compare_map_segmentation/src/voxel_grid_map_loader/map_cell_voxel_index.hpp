@@ -0,0 +1,500 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VOXEL_GRID_MAP_LOADER__MAP_CELL_VOXEL_INDEX_HPP_
+#define VOXEL_GRID_MAP_LOADER__MAP_CELL_VOXEL_INDEX_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::compare_map_segmentation
+{
+/**
+ * @brief spatial index of the points of the loaded map cells, shared by the compare map filters
+ *
+ * The points are grouped by voxel in a flat hash table which keeps for each voxel the range of
+ * points of every map cell in it, and each voxel next to an occupied one stores which of its 26
+ * neighbors and itself are occupied. Adding or removing a map cell only updates the voxels of that
+ * cell, and the queries do not allocate. The voxel size should be at least the query distance so
+ * that a query only looks at the neighbor voxels.
+ */
+class MapCellVoxelIndex
+{
+public:
+  explicit MapCellVoxelIndex(double voxel_size_xy = 1.0, double voxel_size_z = 1.0)
+  {
+    set_voxel_size(voxel_size_xy, voxel_size_z);
+  }
+
+  /** @brief set the voxel size, which also removes all the map cells */
+  void set_voxel_size(double voxel_size_xy, double voxel_size_z)
+  {
+    clear();
+    inverse_voxel_size_xy_ = 1.0 / voxel_size_xy;
+    inverse_voxel_size_z_ = 1.0 / voxel_size_z;
+  }
+
+  void clear()
+  {
+    cell_slots_.clear();
+    cells_.clear();
+    free_slots_.clear();
+    voxels_.clear();
+    neighbor_masks_.clear();
+  }
+
+  bool empty() const { return cell_slots_.empty(); }
+  size_t num_cells() const { return cell_slots_.size(); }
+  bool has_cell(const std::string & cell_id) const { return cell_slots_.count(cell_id) > 0; }
+
+  /**
+   * @brief add the points of a map cell, replacing the cell if it was already added
+   *
+   * @param points range of points with x, y and z. The points which are not finite are skipped.
+   */
+  template <typename PointsT>
+  void add_cell(const std::string & cell_id, const PointsT & points);
+
+  void remove_cell(const std::string & cell_id);
+
+  /** @brief whether the voxel containing the point has map points */
+  template <typename PointT>
+  bool is_in_occupied_voxel(const PointT & point) const
+  {
+    VoxelKey key;
+    return to_voxel_key(point.x, point.y, point.z, key) && voxels_.find(key) != nullptr;
+  }
+
+  /** @brief whether a map point is within the distance of the point */
+  template <typename PointT>
+  bool is_within(const PointT & point, double distance) const
+  {
+    const double sqr_distance_threshold = distance * distance;
+    bool found = false;
+    visit_points_around(point, distance, [&](double sqr_distance) {
+      found = sqr_distance <= sqr_distance_threshold;
+      return found;
+    });
+    return found;
+  }
+
+  /**
+   * @brief squared distance from the point to the nearest map point within max_distance
+   *
+   * @return false if there is no map point within max_distance
+   */
+  template <typename PointT>
+  bool nearest_sqr_distance(const PointT & point, double max_distance, double & sqr_distance) const
+  {
+    const double sqr_distance_threshold = max_distance * max_distance;
+    double min_sqr_distance = std::numeric_limits<double>::max();
+    visit_points_around(point, max_distance, [&](double d) {
+      min_sqr_distance = std::min(min_sqr_distance, d);
+      return false;
+    });
+    if (min_sqr_distance > sqr_distance_threshold) {
+      return false;
+    }
+    sqr_distance = min_sqr_distance;
+    return true;
+  }
+
+private:
+  struct MapPoint
+  {
+    float x;
+    float y;
+    float z;
+  };
+
+  struct VoxelKey
+  {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+
+    bool operator==(const VoxelKey & other) const
+    {
+      return x == other.x && y == other.y && z == other.z;
+    }
+    bool operator<(const VoxelKey & other) const
+    {
+      return x != other.x ? x < other.x : (y != other.y ? y < other.y : z < other.z);
+    }
+  };
+
+  /** @brief points of one map cell in one voxel */
+  struct VoxelPoints
+  {
+    uint32_t cell_slot;
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  struct MapCell
+  {
+    /** @brief points sorted by voxel */
+    std::vector<MapPoint> points;
+    /** @brief the distinct voxels of the points */
+    std::vector<VoxelKey> voxels;
+  };
+
+  /**
+   * @brief open addressing hash table with linear probing, which may hold several values for the
+   * same key, and backward shift deletion so that no tombstones are left
+   */
+  template <typename ValueT>
+  class VoxelHashTable
+  {
+  public:
+    void clear()
+    {
+      slots_.clear();
+      size_ = 0;
+    }
+
+    void insert(const VoxelKey & key, const ValueT & value)
+    {
+      if ((size_ + 1) * 2 > slots_.size()) {
+        rehash(std::max<size_t>(slots_.size() * 2, 64));
+      }
+      size_t i = home(key);
+      while (slots_[i].used) {
+        i = (i + 1) & mask_;
+      }
+      slots_[i] = Slot{key, value, true};
+      ++size_;
+    }
+
+    /** @brief the first value of the key, or nullptr */
+    const ValueT * find(const VoxelKey & key) const { return find_impl(key); }
+    ValueT * find(const VoxelKey & key) { return const_cast<ValueT *>(find_impl(key)); }
+
+    /** @brief call the function on every value of the key, until it returns true */
+    template <typename FunctionT>
+    void for_each(const VoxelKey & key, FunctionT && function) const
+    {
+      if (slots_.empty()) {
+        return;
+      }
+      for (size_t i = home(key); slots_[i].used; i = (i + 1) & mask_) {
+        if (slots_[i].key == key && function(slots_[i].value)) {
+          return;
+        }
+      }
+    }
+
+    /** @brief erase the values of the key for which the predicate is true */
+    template <typename PredicateT>
+    void erase_if(const VoxelKey & key, PredicateT && predicate)
+    {
+      if (slots_.empty()) {
+        return;
+      }
+      size_t i = home(key);
+      while (slots_[i].used) {
+        if (slots_[i].key == key && predicate(slots_[i].value)) {
+          erase_slot(i);
+          // the slot now holds the next entry of the probe sequence, if any
+          continue;
+        }
+        i = (i + 1) & mask_;
+      }
+    }
+
+  private:
+    struct Slot
+    {
+      VoxelKey key;
+      ValueT value;
+      bool used;
+    };
+
+    std::vector<Slot> slots_;
+    size_t mask_{0};
+    size_t size_{0};
+
+    size_t home(const VoxelKey & key) const
+    {
+      uint64_t h = static_cast<uint64_t>(static_cast<uint32_t>(key.x)) * 0x9E3779B97F4A7C15ULL;
+      h ^= static_cast<uint64_t>(static_cast<uint32_t>(key.y)) * 0xC2B2AE3D27D4EB4FULL;
+      h ^= static_cast<uint64_t>(static_cast<uint32_t>(key.z)) * 0x165667B19E3779F9ULL;
+      h ^= h >> 29;
+      return static_cast<size_t>(h) & mask_;
+    }
+
+    const ValueT * find_impl(const VoxelKey & key) const
+    {
+      if (slots_.empty()) {
+        return nullptr;
+      }
+      for (size_t i = home(key); slots_[i].used; i = (i + 1) & mask_) {
+        if (slots_[i].key == key) {
+          return &slots_[i].value;
+        }
+      }
+      return nullptr;
+    }
+
+    void erase_slot(size_t hole)
+    {
+      // move back the following entries which can not be found anymore once the slot is empty
+      slots_[hole].used = false;
+      --size_;
+      for (size_t i = (hole + 1) & mask_; slots_[i].used; i = (i + 1) & mask_) {
+        const size_t h = home(slots_[i].key);
+        // distance along the probe sequence, which wraps around the table
+        if (((i - h) & mask_) >= ((i - hole) & mask_)) {
+          slots_[hole] = slots_[i];
+          slots_[i].used = false;
+          hole = i;
+        }
+      }
+    }
+
+    void rehash(size_t capacity)
+    {
+      std::vector<Slot> old_slots(capacity);
+      std::swap(old_slots, slots_);
+      mask_ = capacity - 1;
+      size_ = 0;
+      for (const auto & slot : old_slots) {
+        if (slot.used) {
+          insert(slot.key, slot.value);
+        }
+      }
+    }
+  };
+
+  static constexpr uint32_t neighbor_bit(int dx, int dy, int dz)
+  {
+    return 1U << static_cast<uint32_t>((dx + 1) * 9 + (dy + 1) * 3 + (dz + 1));
+  }
+
+  bool to_voxel_key(double x, double y, double z, VoxelKey & key) const
+  {
+    const double voxel_x = std::floor(x * inverse_voxel_size_xy_);
+    const double voxel_y = std::floor(y * inverse_voxel_size_xy_);
+    const double voxel_z = std::floor(z * inverse_voxel_size_z_);
+    // also false for NaN
+    constexpr double limit = static_cast<double>(std::numeric_limits<int32_t>::max() - 1);
+    if (!(std::abs(voxel_x) < limit && std::abs(voxel_y) < limit && std::abs(voxel_z) < limit)) {
+      return false;
+    }
+    key = VoxelKey{
+      static_cast<int32_t>(voxel_x), static_cast<int32_t>(voxel_y), static_cast<int32_t>(voxel_z)};
+    return true;
+  }
+
+  /**
+   * @brief call the function with the squared distance to every map point in the voxels touching
+   * the cube of the distance around the point, until it returns true
+   */
+  template <typename PointT, typename FunctionT>
+  void visit_points_around(const PointT & point, double distance, FunctionT && function) const;
+
+  double inverse_voxel_size_xy_{1.0};
+  double inverse_voxel_size_z_{1.0};
+
+  std::unordered_map<std::string, uint32_t> cell_slots_;
+  std::vector<MapCell> cells_;
+  std::vector<uint32_t> free_slots_;
+  VoxelHashTable<VoxelPoints> voxels_;
+  /** @brief for every voxel next to an occupied one, the occupied voxels among its neighbors */
+  VoxelHashTable<uint32_t> neighbor_masks_;
+};
+
+template <typename PointsT>
+void MapCellVoxelIndex::add_cell(const std::string & cell_id, const PointsT & points)
+{
+  remove_cell(cell_id);
+
+  uint32_t cell_slot = 0;
+  if (free_slots_.empty()) {
+    cell_slot = static_cast<uint32_t>(cells_.size());
+    cells_.emplace_back();
+  } else {
+    cell_slot = free_slots_.back();
+    free_slots_.pop_back();
+  }
+  cell_slots_.emplace(cell_id, cell_slot);
+
+  std::vector<std::pair<VoxelKey, MapPoint>> keyed_points;
+  keyed_points.reserve(std::size(points));
+  for (const auto & p : points) {
+    VoxelKey key;
+    if (std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z)) {
+      if (to_voxel_key(p.x, p.y, p.z, key)) {
+        keyed_points.emplace_back(key, MapPoint{p.x, p.y, p.z});
+      }
+    }
+  }
+  std::sort(keyed_points.begin(), keyed_points.end(), [](const auto & a, const auto & b) {
+    return a.first < b.first;
+  });
+
+  MapCell & cell = cells_[cell_slot];
+  cell.points.resize(keyed_points.size());
+  for (size_t i = 0; i < keyed_points.size(); ++i) {
+    cell.points[i] = keyed_points[i].second;
+  }
+
+  for (size_t begin = 0; begin < keyed_points.size();) {
+    const VoxelKey & key = keyed_points[begin].first;
+    size_t end = begin + 1;
+    while (end < keyed_points.size() && keyed_points[end].first == key) {
+      ++end;
+    }
+    cell.voxels.push_back(key);
+
+    const bool was_occupied = voxels_.find(key) != nullptr;
+    voxels_.insert(
+      key, VoxelPoints{cell_slot, static_cast<uint32_t>(begin), static_cast<uint32_t>(end)});
+    if (!was_occupied) {
+      for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+          for (int dz = -1; dz <= 1; ++dz) {
+            const VoxelKey neighbor{key.x + dx, key.y + dy, key.z + dz};
+            // the bit of the occupied voxel as seen from the neighbor
+            if (uint32_t * mask = neighbor_masks_.find(neighbor)) {
+              *mask |= neighbor_bit(-dx, -dy, -dz);
+            } else {
+              neighbor_masks_.insert(neighbor, neighbor_bit(-dx, -dy, -dz));
+            }
+          }
+        }
+      }
+    }
+    begin = end;
+  }
+}
+
+inline void MapCellVoxelIndex::remove_cell(const std::string & cell_id)
+{
+  const auto it = cell_slots_.find(cell_id);
+  if (it == cell_slots_.end()) {
+    return;
+  }
+  const uint32_t cell_slot = it->second;
+  cell_slots_.erase(it);
+
+  MapCell & cell = cells_[cell_slot];
+  for (const auto & key : cell.voxels) {
+    voxels_.erase_if(
+      key, [cell_slot](const VoxelPoints & voxel) { return voxel.cell_slot == cell_slot; });
+    if (voxels_.find(key) != nullptr) {
+      // still occupied by another map cell
+      continue;
+    }
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dz = -1; dz <= 1; ++dz) {
+          const VoxelKey neighbor{key.x + dx, key.y + dy, key.z + dz};
+          uint32_t * mask = neighbor_masks_.find(neighbor);
+          if (mask == nullptr) {
+            continue;
+          }
+          *mask &= ~neighbor_bit(-dx, -dy, -dz);
+          if (*mask == 0) {
+            neighbor_masks_.erase_if(neighbor, [](uint32_t) { return true; });
+          }
+        }
+      }
+    }
+  }
+  cell = MapCell{};
+  free_slots_.push_back(cell_slot);
+}
+
+template <typename PointT, typename FunctionT>
+void MapCellVoxelIndex::visit_points_around(
+  const PointT & point, double distance, FunctionT && function) const
+{
+  VoxelKey key;
+  if (!to_voxel_key(point.x, point.y, point.z, key)) {
+    return;
+  }
+  const auto visit_voxel = [&](const VoxelKey & voxel_key) {
+    bool done = false;
+    voxels_.for_each(voxel_key, [&](const VoxelPoints & voxel) {
+      const auto & points = cells_[voxel.cell_slot].points;
+      for (uint32_t i = voxel.begin; i < voxel.end; ++i) {
+        const double dx = static_cast<double>(points[i].x) - point.x;
+        const double dy = static_cast<double>(points[i].y) - point.y;
+        const double dz = static_cast<double>(points[i].z) - point.z;
+        if (function(dx * dx + dy * dy + dz * dz)) {
+          done = true;
+          break;
+        }
+      }
+      return done;
+    });
+    return done;
+  };
+
+  // voxels touching the cube of the distance around the point
+  VoxelKey min_key;
+  VoxelKey max_key;
+  if (
+    !to_voxel_key(point.x - distance, point.y - distance, point.z - distance, min_key) ||
+    !to_voxel_key(point.x + distance, point.y + distance, point.z + distance, max_key)) {
+    return;
+  }
+
+  const bool within_neighbors = min_key.x >= key.x - 1 && min_key.y >= key.y - 1 &&
+                                min_key.z >= key.z - 1 && max_key.x <= key.x + 1 &&
+                                max_key.y <= key.y + 1 && max_key.z <= key.z + 1;
+  if (!within_neighbors) {
+    for (int32_t x = min_key.x; x <= max_key.x; ++x) {
+      for (int32_t y = min_key.y; y <= max_key.y; ++y) {
+        for (int32_t z = min_key.z; z <= max_key.z; ++z) {
+          if (visit_voxel(VoxelKey{x, y, z})) {
+            return;
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  // only the occupied neighbors are looked up
+  const uint32_t * mask = neighbor_masks_.find(key);
+  if (mask == nullptr) {
+    return;
+  }
+  for (int32_t x = min_key.x; x <= max_key.x; ++x) {
+    for (int32_t y = min_key.y; y <= max_key.y; ++y) {
+      for (int32_t z = min_key.z; z <= max_key.z; ++z) {
+        if ((*mask & neighbor_bit(x - key.x, y - key.y, z - key.z)) == 0) {
+          continue;
+        }
+        if (visit_voxel(VoxelKey{x, y, z})) {
+          return;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace autoware::compare_map_segmentation
+
+#endif  // VOXEL_GRID_MAP_LOADER__MAP_CELL_VOXEL_INDEX_HPP_
@@ -39,25 +39,6 @@ void VoxelGridMapLoader::publish_downsampled_map(
   downsampled_map_pub_->publish(downsampled_map_msg);
 }
 
-bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
-  const pcl::PointXYZ & point, const double distance_threshold, VoxelGridPointXYZ & voxel,
-  pcl::search::Search<pcl::PointXYZ>::Ptr tree)
-{
-  const int index = voxel.getCentroidIndexAt(voxel.getGridCoordinates(point.x, point.y, point.z));
-  if (index != -1) {
-    return true;
-  }
-  if (tree == nullptr) {
-    return false;
-  }
-  std::vector<int> nn_indices(1);
-  std::vector<float> nn_distances(1);
-  if (tree->radiusSearch(point, distance_threshold, nn_indices, nn_distances, 1) == 0) {
-    return false;
-  }
-  return true;
-}
-
 bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
   const pcl::PointXYZ & point, const double distance_threshold, const PointCloudPtr & map,
   VoxelGridPointXYZ & voxel) const
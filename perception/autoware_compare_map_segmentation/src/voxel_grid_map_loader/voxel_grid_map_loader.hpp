@@ -15,6 +15,8 @@
 #ifndef VOXEL_GRID_MAP_LOADER__VOXEL_GRID_MAP_LOADER_HPP_
 #define VOXEL_GRID_MAP_LOADER__VOXEL_GRID_MAP_LOADER_HPP_
 
+#include "map_cell_voxel_index.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include "autoware_map_msgs/srv/get_differential_point_cloud_map.hpp"
@@ -29,6 +31,7 @@
 #include <atomic>
 #include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -102,9 +105,6 @@ public:
   virtual ~VoxelGridMapLoader() = default;
 
   virtual bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) = 0;
-  static bool is_close_to_neighbor_voxels(
-    const pcl::PointXYZ & point, const double distance_threshold, VoxelGridPointXYZ & voxel,
-    pcl::search::Search<pcl::PointXYZ>::Ptr tree);
   bool is_close_to_neighbor_voxels(
     const pcl::PointXYZ & point, const double distance_threshold, const PointCloudPtr & map,
     VoxelGridPointXYZ & voxel) const;
@@ -140,7 +140,6 @@ protected:
     VoxelGridPointXYZ map_cell_voxel_grid;
     PointCloudPtr map_cell_pc_ptr;
     float min_b_x, min_b_y, max_b_x, max_b_y;
-    pcl::search::Search<pcl::PointXYZ>::Ptr map_cell_kdtree;
   };
 
   using VoxelGridDict = typename std::map<std::string, struct MapGridVoxelInfo>;
@@ -201,7 +200,9 @@ public:
     pcl::PointCloud<pcl::PointXYZ> output;
     std::lock_guard<std::mutex> lock(dynamic_map_loader_mutex_);
     for (const auto & kv : current_voxel_grid_dict_) {
-      output = output + *(kv.second.map_cell_pc_ptr);
+      if (kv.second.map_cell_pc_ptr) {
+        output = output + *(kv.second.map_cell_pc_ptr);
+      }
     }
     return output;
   }
@@ -265,7 +266,7 @@ public:
     }
   }
 
-  inline void removeMapCell(const std::string & map_cell_id_to_remove)
+  virtual inline void removeMapCell(const std::string & map_cell_id_to_remove)
   {
     std::lock_guard<std::mutex> lock(dynamic_map_loader_mutex_);
     current_voxel_grid_dict_.erase(map_cell_id_to_remove);
@@ -320,6 +321,66 @@ public:
   }
 };
 
+/**
+ * @brief dynamic map loader which keeps the points of the loaded map cells in a MapCellVoxelIndex
+ * that is updated only for the cells that are added or removed
+ */
+class MapCellVoxelIndexDynamicMapLoader : public VoxelGridDynamicMapLoader
+{
+protected:
+  MapCellVoxelIndex map_cell_voxel_index_;
+  /** \brief guards the index, which is updated by the map update timer during the filtering */
+  mutable std::shared_mutex map_cell_voxel_index_mutex_;
+
+public:
+  explicit MapCellVoxelIndexDynamicMapLoader(
+    rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
+    std::string * tf_map_input_frame, rclcpp::CallbackGroup::SharedPtr main_callback_group)
+  : VoxelGridDynamicMapLoader(
+      node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, main_callback_group),
+    map_cell_voxel_index_(leaf_size, leaf_size)
+  {
+  }
+
+  /** The queries go through the index, so the per grid array is not rebuilt */
+  inline void updateVoxelGridArray() override {}
+
+  inline void removeMapCell(const std::string & map_cell_id_to_remove) override
+  {
+    VoxelGridDynamicMapLoader::removeMapCell(map_cell_id_to_remove);
+    std::unique_lock<std::shared_mutex> lock(map_cell_voxel_index_mutex_);
+    map_cell_voxel_index_.remove_cell(map_cell_id_to_remove);
+  }
+
+  inline void addMapCellAndFilter(
+    const autoware_map_msgs::msg::PointCloudMapCellWithID & map_cell_to_add) override
+  {
+    map_grid_size_x_ = map_cell_to_add.metadata.max_x - map_cell_to_add.metadata.min_x;
+    map_grid_size_y_ = map_cell_to_add.metadata.max_y - map_cell_to_add.metadata.min_y;
+
+    auto map_cell_pc_ptr = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+    pcl::fromROSMsg(map_cell_to_add.pointcloud, *map_cell_pc_ptr);
+    {
+      std::unique_lock<std::shared_mutex> lock(map_cell_voxel_index_mutex_);
+      map_cell_voxel_index_.add_cell(map_cell_to_add.cell_id, *map_cell_pc_ptr);
+    }
+
+    MapGridVoxelInfo current_voxel_grid_list_item;
+    current_voxel_grid_list_item.min_b_x = map_cell_to_add.metadata.min_x;
+    current_voxel_grid_list_item.min_b_y = map_cell_to_add.metadata.min_y;
+    current_voxel_grid_list_item.max_b_x = map_cell_to_add.metadata.max_x;
+    current_voxel_grid_list_item.max_b_y = map_cell_to_add.metadata.max_y;
+    // the points are only kept for the debug map, the index has its own copy
+    if (debug_) {
+      current_voxel_grid_list_item.map_cell_pc_ptr = std::move(map_cell_pc_ptr);
+    }
+
+    // add
+    std::lock_guard<std::mutex> lock(dynamic_map_loader_mutex_);
+    current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
+  }
+};
+
 }  // namespace autoware::compare_map_segmentation
 
 #endif  // VOXEL_GRID_MAP_LOADER__VOXEL_GRID_MAP_LOADER_HPP_
@@ -0,0 +1,111 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/compare_elevation_map_filter/elevation_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::compare_map_segmentation::ElevationGrid;
+
+namespace
+{
+constexpr double resolution = 0.5;
+constexpr int size_x = 40;
+constexpr int size_y = 20;
+
+// the map of 20 m x 10 m centered at (100, 50), whose elevation is a plane
+ElevationGrid create_plane_grid()
+{
+  ElevationGrid grid;
+  grid.set(110.0, 55.0, resolution, size_x, size_y, [](int i, int j) {
+    // the center of the cell (i, j)
+    const double x = 110.0 - (i + 0.5) * resolution;
+    const double y = 55.0 - (j + 0.5) * resolution;
+    return static_cast<float>(0.1 * (x - 100.0) - 0.2 * (y - 50.0) + 3.0);
+  });
+  return grid;
+}
+}  // namespace
+
+TEST(ElevationGridTest, InterpolatesBetweenCellCenters)
+{
+  const auto grid = create_plane_grid();
+  std::mt19937 random(0);
+  // inside the centers of the border cells, where the bilinear interpolation gives the plane
+  std::uniform_real_distribution<double> x(90.25, 109.75);
+  std::uniform_real_distribution<double> y(45.25, 54.75);
+  for (int k = 0; k < 1000; ++k) {
+    const double px = x(random);
+    const double py = y(random);
+    EXPECT_NEAR(grid.elevation_at(px, py), 0.1 * (px - 100.0) - 0.2 * (py - 50.0) + 3.0, 1e-4);
+  }
+}
+
+TEST(ElevationGridTest, ClampsAtBorder)
+{
+  const auto grid = create_plane_grid();
+  // beyond the center of the corner cell of the maximum x and y, the corner cell is used
+  EXPECT_NEAR(grid.elevation_at(109.9, 54.9), 0.1 * 9.75 - 0.2 * 4.75 + 3.0, 1e-4);
+  EXPECT_NEAR(grid.elevation_at(90.1, 50.0), 0.1 * -9.75 + 3.0, 1e-4);
+}
+
+TEST(ElevationGridTest, OutsideIsNaN)
+{
+  const auto grid = create_plane_grid();
+  EXPECT_TRUE(std::isnan(grid.elevation_at(110.1, 50.0)));
+  EXPECT_TRUE(std::isnan(grid.elevation_at(100.0, 44.9)));
+  EXPECT_TRUE(std::isnan(grid.elevation_at(std::numeric_limits<double>::quiet_NaN(), 50.0)));
+  EXPECT_TRUE(std::isnan(ElevationGrid().elevation_at(0.0, 0.0)));
+}
+
+TEST(ElevationGridTest, NaNCellIsPropagated)
+{
+  ElevationGrid grid;
+  grid.set(2.0, 2.0, 1.0, 4, 4, [](int i, int j) {
+    return i == 1 && j == 1 ? std::numeric_limits<float>::quiet_NaN() : 1.0f;
+  });
+  // the cell (1, 1) is the cell of [0, 1) x [0, 1)
+  EXPECT_TRUE(std::isnan(grid.elevation_at(0.5, 0.5)));
+  EXPECT_TRUE(std::isnan(grid.elevation_at(1.2, 0.5)));
+  EXPECT_FLOAT_EQ(grid.elevation_at(-1.5, -1.5), 1.0f);
+}
+
+TEST(ElevationGridTest, BatchMatchesSinglePoint)
+{
+  const auto grid = create_plane_grid();
+  std::mt19937 random(1);
+  std::uniform_real_distribution<float> x(85.0f, 115.0f);
+  std::uniform_real_distribution<float> y(40.0f, 60.0f);
+  std::vector<float> xs(257);
+  std::vector<float> ys(xs.size());
+  for (size_t k = 0; k < xs.size(); ++k) {
+    xs[k] = x(random);
+    ys[k] = y(random);
+  }
+  std::vector<float> elevations(xs.size());
+  grid.elevations_at(xs.data(), ys.data(), xs.size(), elevations.data());
+  for (size_t k = 0; k < xs.size(); ++k) {
+    const float expected = grid.elevation_at(xs[k], ys[k]);
+    if (std::isnan(expected)) {
+      EXPECT_TRUE(std::isnan(elevations[k]));
+    } else {
+      EXPECT_FLOAT_EQ(elevations[k], expected);
+    }
+  }
+}
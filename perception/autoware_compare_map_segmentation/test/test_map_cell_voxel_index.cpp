@@ -0,0 +1,143 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/voxel_grid_map_loader/map_cell_voxel_index.hpp"
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+
+using autoware::compare_map_segmentation::MapCellVoxelIndex;
+
+namespace
+{
+pcl::PointCloud<pcl::PointXYZ> create_cell(
+  std::mt19937 & random, float min_x, float min_y, float size, int number_of_points)
+{
+  std::uniform_real_distribution<float> xy(0.0F, size);
+  std::uniform_real_distribution<float> z(-1.0F, 1.0F);
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  for (int i = 0; i < number_of_points; ++i) {
+    cloud.push_back(pcl::PointXYZ(min_x + xy(random), min_y + xy(random), z(random)));
+  }
+  return cloud;
+}
+
+double brute_force_sqr_distance(
+  const std::map<std::string, pcl::PointCloud<pcl::PointXYZ>> & cells, const pcl::PointXYZ & point)
+{
+  double min_sqr_distance = std::numeric_limits<double>::max();
+  for (const auto & [id, cloud] : cells) {
+    for (const auto & p : cloud) {
+      const double dx = static_cast<double>(p.x) - point.x;
+      const double dy = static_cast<double>(p.y) - point.y;
+      const double dz = static_cast<double>(p.z) - point.z;
+      min_sqr_distance = std::min(min_sqr_distance, dx * dx + dy * dy + dz * dz);
+    }
+  }
+  return min_sqr_distance;
+}
+
+void expect_same_as_brute_force(
+  const MapCellVoxelIndex & index,
+  const std::map<std::string, pcl::PointCloud<pcl::PointXYZ>> & cells, std::mt19937 & random,
+  double distance)
+{
+  std::uniform_real_distribution<float> xy(-1.0F, 21.0F);
+  std::uniform_real_distribution<float> z(-1.5F, 1.5F);
+  for (int i = 0; i < 2000; ++i) {
+    const pcl::PointXYZ point(xy(random), xy(random), z(random));
+    const double expected = brute_force_sqr_distance(cells, point);
+    EXPECT_EQ(index.is_within(point, distance), expected <= distance * distance);
+    double sqr_distance = 0.0;
+    if (index.nearest_sqr_distance(point, distance, sqr_distance)) {
+      EXPECT_DOUBLE_EQ(sqr_distance, expected);
+    } else {
+      EXPECT_GT(expected, distance * distance);
+    }
+  }
+}
+}  // namespace
+
+TEST(MapCellVoxelIndexTest, testSameAsBruteForce)
+{
+  std::mt19937 random(0);
+  MapCellVoxelIndex index(0.5, 0.5);
+  std::map<std::string, pcl::PointCloud<pcl::PointXYZ>> cells;
+  for (int x = 0; x < 2; ++x) {
+    for (int y = 0; y < 2; ++y) {
+      const std::string id = std::to_string(x) + "_" + std::to_string(y);
+      cells[id] = create_cell(random, 10.0F * x, 10.0F * y, 10.0F, 2000);
+      index.add_cell(id, cells[id]);
+    }
+  }
+  EXPECT_EQ(index.num_cells(), 4U);
+  expect_same_as_brute_force(index, cells, random, 0.5);
+  // a distance larger than the voxel size looks up more voxels
+  expect_same_as_brute_force(index, cells, random, 1.2);
+}
+
+TEST(MapCellVoxelIndexTest, testAddAndRemoveCells)
+{
+  std::mt19937 random(1);
+  MapCellVoxelIndex index(0.5, 0.5);
+  std::map<std::string, pcl::PointCloud<pcl::PointXYZ>> cells;
+  for (int step = 0; step < 6; ++step) {
+    // cells entering and leaving as the vehicle moves along x
+    const std::string id_to_add = std::to_string(step);
+    cells[id_to_add] = create_cell(random, 5.0F * step - 10.0F, 0.0F, 5.0F, 1000);
+    index.add_cell(id_to_add, cells[id_to_add]);
+    const std::string id_to_remove = std::to_string(step - 3);
+    if (cells.erase(id_to_remove) > 0) {
+      index.remove_cell(id_to_remove);
+    }
+    EXPECT_EQ(index.num_cells(), cells.size());
+    expect_same_as_brute_force(index, cells, random, 0.5);
+  }
+
+  // replacing a cell only keeps the new points
+  cells["5"] = create_cell(random, 15.0F, 5.0F, 5.0F, 500);
+  index.add_cell("5", cells["5"]);
+  expect_same_as_brute_force(index, cells, random, 0.5);
+
+  for (const auto & [id, cloud] : cells) {
+    index.remove_cell(id);
+  }
+  EXPECT_TRUE(index.empty());
+  EXPECT_FALSE(index.is_within(pcl::PointXYZ(15.0F, 2.0F, 0.0F), 0.5));
+}
+
+TEST(MapCellVoxelIndexTest, testOccupiedVoxel)
+{
+  MapCellVoxelIndex index(1.0, 1.0);
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(0.5F, 0.5F, 0.5F));
+  cloud.push_back(pcl::PointXYZ(std::numeric_limits<float>::quiet_NaN(), 0.0F, 0.0F));
+  index.add_cell("cell", cloud);
+
+  EXPECT_TRUE(index.is_in_occupied_voxel(pcl::PointXYZ(0.9F, 0.1F, 0.2F)));
+  EXPECT_FALSE(index.is_in_occupied_voxel(pcl::PointXYZ(1.1F, 0.1F, 0.2F)));
+  EXPECT_FALSE(index.is_in_occupied_voxel(pcl::PointXYZ(-0.1F, 0.1F, 0.2F)));
+  EXPECT_FALSE(
+    index.is_within(pcl::PointXYZ(std::numeric_limits<float>::quiet_NaN(), 0.5F, 0.5F), 1.0));
+  EXPECT_TRUE(index.is_within(pcl::PointXYZ(1.4F, 0.5F, 0.5F), 1.0));
+  EXPECT_FALSE(index.is_within(pcl::PointXYZ(1.6F, 0.5F, 0.5F), 1.0));
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 #include "autoware_crosswalk_traffic_light_estimator/node.hpp"
 
+#include <autoware/lanelet2_map_cache/lanelet2_map_cache.hpp>
 #include <autoware_lanelet2_extension/regulatory_elements/Forward.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 
@@ -103,17 +104,15 @@ CrosswalkTrafficLightEstimatorNode::CrosswalkTrafficLightEstimatorNode(
 void CrosswalkTrafficLightEstimatorNode::onMap(const LaneletMapBin::ConstSharedPtr msg)
 {
   RCLCPP_DEBUG(get_logger(), "[CrosswalkTrafficLightEstimatorNode]: Start loading lanelet");
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
-  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
-  lanelet::routing::RoutingGraphConstPtr vehicle_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules);
+  // NOTE: The map and the routing graphs are shared with the other nodes of the process
+  const auto map_data = autoware::lanelet2_map_cache::from_bin_msg(*msg);
+  lanelet_map_ptr_ = map_data.map;
+  traffic_rules_ptr_ = map_data.traffic_rules;
+  routing_graph_ptr_ = map_data.routing_graph;
+  lanelet::routing::RoutingGraphConstPtr vehicle_graph = routing_graph_ptr_;
   lanelet::routing::RoutingGraphConstPtr pedestrian_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *pedestrian_rules);
+    autoware::lanelet2_map_cache::get_routing_graph(
+      lanelet_map_ptr_, lanelet::Participants::Pedestrian);
   lanelet::routing::RoutingGraphContainer overall_graphs({vehicle_graph, pedestrian_graph});
   overall_graphs_ptr_ =
     std::make_shared<const lanelet::routing::RoutingGraphContainer>(overall_graphs);
@@ -0,0 +1,52 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__DETECTED_OBJECT_VALIDATION__OBJECT_FILTER_PIPELINE__PLUGIN_INTERFACE_HPP_
+#define AUTOWARE__DETECTED_OBJECT_VALIDATION__OBJECT_FILTER_PIPELINE__PLUGIN_INTERFACE_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include "autoware_perception_msgs/msg/detected_objects.hpp"
+
+#include <tf2_ros/buffer.h>
+
+#include <string>
+
+namespace autoware::detected_object_validation
+{
+/**
+ * @brief filter run by the object filter pipeline on the objects shared by all the filters
+ */
+class ObjectFilterPluginInterface
+{
+public:
+  virtual ~ObjectFilterPluginInterface() = default;
+
+  /**
+   * @brief declares the parameters in the namespace of the filter name, and creates the
+   * subscriptions the filter needs
+   */
+  virtual void init(rclcpp::Node & node, tf2_ros::Buffer & tf_buffer) = 0;
+
+  /**
+   * @brief removes the objects rejected by the filter in place, keeping the order of the others
+   * @return false if the objects can not be filtered, and then nothing is published
+   */
+  virtual bool filter(autoware_perception_msgs::msg::DetectedObjects & objects) = 0;
+
+  virtual std::string get_filter_name() const = 0;
+};
+}  // namespace autoware::detected_object_validation
+
+#endif  // AUTOWARE__DETECTED_OBJECT_VALIDATION__OBJECT_FILTER_PIPELINE__PLUGIN_INTERFACE_HPP_
@@ -0,0 +1,184 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef AUTOWARE__DETECTED_OBJECT_VALIDATION__UTILS__POINT_GRID_INDEX_HPP_
+#define AUTOWARE__DETECTED_OBJECT_VALIDATION__UTILS__POINT_GRID_INDEX_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace utils
+{
+/**
+ * @brief uniform 2D grid over a pointcloud, which stores the indices of the points of each cell
+ * next to each other
+ *
+ * The cloud is binned once, and the points around any number of query areas are then found by
+ * visiting the cells overlapping each area. The buffers are kept between builds, so binning clouds
+ * of a similar size again does not allocate.
+ */
+class PointGridIndex
+{
+public:
+  /**
+   * @brief bin the points whose x and y are finite
+   *
+   * @param points sequence of points with x and y members
+   * @param cell_size size of a cell [m]. It is enlarged when the points spread over more than
+   * max_num_cells cells.
+   */
+  template <typename PointsT>
+  void build(const PointsT & points, double cell_size);
+
+  void clear()
+  {
+    num_cells_x_ = 0;
+    num_cells_y_ = 0;
+    cell_offsets_.clear();
+    point_indices_.clear();
+  }
+
+  bool empty() const { return point_indices_.empty(); }
+
+  /**
+   * @brief call fn with the index of every point in the cells overlapping the area
+   * [min_x, max_x] x [min_y, max_y]
+   *
+   * All the points within the area are visited, along with the other points of the same cells.
+   */
+  template <typename FunctionT>
+  void forEachPointInArea(
+    double min_x, double min_y, double max_x, double max_y, FunctionT && fn) const;
+
+private:
+  static constexpr double max_num_cells = 1 << 22;
+
+  double min_x_{0.0};
+  double min_y_{0.0};
+  double cell_size_{1.0};
+  size_t num_cells_x_{0};
+  size_t num_cells_y_{0};
+
+  /** @brief points of each cell, as ranges of point_indices_ per cell */
+  std::vector<uint32_t> cell_offsets_;
+  std::vector<uint32_t> point_indices_;
+  /** @brief cell of each point, or num_cells for the points which are not binned */
+  std::vector<uint32_t> point_cells_;
+};
+
+template <typename PointsT>
+void PointGridIndex::build(const PointsT & points, double cell_size)
+{
+  clear();
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & p : points) {
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) continue;
+    min_x = std::min<double>(min_x, p.x);
+    min_y = std::min<double>(min_y, p.y);
+    max_x = std::max<double>(max_x, p.x);
+    max_y = std::max<double>(max_y, p.y);
+  }
+  if (min_x > max_x) return;
+
+  // a few far points must not blow the grid up, and an invalid size ends up with the finest grid
+  cell_size_ = cell_size > 0.0 ? cell_size : std::numeric_limits<double>::min();
+  while ((std::floor((max_x - min_x) / cell_size_) + 1.0) *
+           (std::floor((max_y - min_y) / cell_size_) + 1.0) >
+         max_num_cells) {
+    cell_size_ *= 2.0;
+  }
+  min_x_ = min_x;
+  min_y_ = min_y;
+  num_cells_x_ = static_cast<size_t>(std::floor((max_x - min_x) / cell_size_)) + 1;
+  num_cells_y_ = static_cast<size_t>(std::floor((max_y - min_y) / cell_size_)) + 1;
+  const size_t num_cells = num_cells_x_ * num_cells_y_;
+
+  // counting sort of the points by cell
+  cell_offsets_.assign(num_cells + 1, 0);
+  point_cells_.resize(std::size(points));
+  size_t point_index = 0;
+  for (const auto & p : points) {
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+      point_cells_[point_index++] = static_cast<uint32_t>(num_cells);
+      continue;
+    }
+    const auto cell_x = std::min(
+      static_cast<size_t>(std::floor((p.x - min_x_) / cell_size_)), num_cells_x_ - 1);
+    const auto cell_y = std::min(
+      static_cast<size_t>(std::floor((p.y - min_y_) / cell_size_)), num_cells_y_ - 1);
+    const auto cell_index = static_cast<uint32_t>(cell_y * num_cells_x_ + cell_x);
+    point_cells_[point_index++] = cell_index;
+    ++cell_offsets_[cell_index + 1];
+  }
+  for (size_t i = 0; i < num_cells; ++i) {
+    cell_offsets_[i + 1] += cell_offsets_[i];
+  }
+
+  // the offsets are shifted forward while filling, and are then shifted back
+  point_indices_.resize(cell_offsets_[num_cells]);
+  for (size_t i = 0; i < point_cells_.size(); ++i) {
+    const auto cell_index = point_cells_[i];
+    if (cell_index == num_cells) continue;
+    point_indices_[cell_offsets_[cell_index]++] = static_cast<uint32_t>(i);
+  }
+  for (size_t i = num_cells; i > 0; --i) {
+    cell_offsets_[i] = cell_offsets_[i - 1];
+  }
+  cell_offsets_[0] = 0;
+}
+
+template <typename FunctionT>
+void PointGridIndex::forEachPointInArea(
+  double min_x, double min_y, double max_x, double max_y, FunctionT && fn) const
+{
+  if (empty()) return;
+  const auto num_cells_x = static_cast<double>(num_cells_x_);
+  const auto num_cells_y = static_cast<double>(num_cells_y_);
+  const double first_col = std::floor((min_x - min_x_) / cell_size_);
+  const double last_col = std::floor((max_x - min_x_) / cell_size_);
+  const double first_row = std::floor((min_y - min_y_) / cell_size_);
+  const double last_row = std::floor((max_y - min_y_) / cell_size_);
+  // also false for NaN
+  if (!(last_col >= 0.0 && first_col < num_cells_x && last_row >= 0.0 && first_row < num_cells_y)) {
+    return;
+  }
+
+  const auto col_begin = static_cast<size_t>(std::max(first_col, 0.0));
+  const auto col_end = static_cast<size_t>(std::min(last_col + 1.0, num_cells_x));
+  const auto row_begin = static_cast<size_t>(std::max(first_row, 0.0));
+  const auto row_end = static_cast<size_t>(std::min(last_row + 1.0, num_cells_y));
+  for (size_t row = row_begin; row < row_end; ++row) {
+    // the cells of a row are contiguous, and so are their points
+    const size_t row_offset = row * num_cells_x_;
+    const uint32_t end = cell_offsets_[row_offset + col_end];
+    for (uint32_t i = cell_offsets_[row_offset + col_begin]; i < end; ++i) {
+      fn(point_indices_[i]);
+    }
+  }
+}
+
+}  // namespace utils
+}  // namespace autoware::detected_object_validation
+
+#endif  // AUTOWARE__DETECTED_OBJECT_VALIDATION__UTILS__POINT_GRID_INDEX_HPP_
@@ -14,6 +14,7 @@
 
 #include "lanelet_filter.hpp"
 
+#include "autoware/lanelet2_map_cache/lanelet2_map_cache.hpp"
 #include "autoware/object_recognition_utils/object_recognition_utils.hpp"
 #include "autoware/universe_utils/geometry/geometry.hpp"
 #include "autoware/universe_utils/system/time_keeper.hpp"
@@ -34,31 +35,37 @@ namespace autoware::detected_object_validation
 {
 namespace lanelet_filter
 {
-ObjectLaneletFilterNode::ObjectLaneletFilterNode(const rclcpp::NodeOptions & node_options)
-: Node("object_lanelet_filter_node", node_options),
-  tf_buffer_(this->get_clock()),
-  tf_listener_(tf_buffer_)
+ObjectLaneletFilter::ObjectLaneletFilter(rclcpp::Node & node, const std::string & prefix)
 {
-  using std::placeholders::_1;
-
   // Set parameters
-  filter_target_.UNKNOWN = declare_parameter<bool>("filter_target_label.UNKNOWN");
-  filter_target_.CAR = declare_parameter<bool>("filter_target_label.CAR");
-  filter_target_.TRUCK = declare_parameter<bool>("filter_target_label.TRUCK");
-  filter_target_.BUS = declare_parameter<bool>("filter_target_label.BUS");
-  filter_target_.TRAILER = declare_parameter<bool>("filter_target_label.TRAILER");
-  filter_target_.MOTORCYCLE = declare_parameter<bool>("filter_target_label.MOTORCYCLE");
-  filter_target_.BICYCLE = declare_parameter<bool>("filter_target_label.BICYCLE");
-  filter_target_.PEDESTRIAN = declare_parameter<bool>("filter_target_label.PEDESTRIAN");
+  const auto label_prefix = prefix + "filter_target_label.";
+  filter_target_.UNKNOWN = node.declare_parameter<bool>(label_prefix + "UNKNOWN");
+  filter_target_.CAR = node.declare_parameter<bool>(label_prefix + "CAR");
+  filter_target_.TRUCK = node.declare_parameter<bool>(label_prefix + "TRUCK");
+  filter_target_.BUS = node.declare_parameter<bool>(label_prefix + "BUS");
+  filter_target_.TRAILER = node.declare_parameter<bool>(label_prefix + "TRAILER");
+  filter_target_.MOTORCYCLE = node.declare_parameter<bool>(label_prefix + "MOTORCYCLE");
+  filter_target_.BICYCLE = node.declare_parameter<bool>(label_prefix + "BICYCLE");
+  filter_target_.PEDESTRIAN = node.declare_parameter<bool>(label_prefix + "PEDESTRIAN");
   // Set filter settings
+  const auto settings_prefix = prefix + "filter_settings.";
   filter_settings_.polygon_overlap_filter =
-    declare_parameter<bool>("filter_settings.polygon_overlap_filter.enabled");
+    node.declare_parameter<bool>(settings_prefix + "polygon_overlap_filter.enabled");
   filter_settings_.lanelet_direction_filter =
-    declare_parameter<bool>("filter_settings.lanelet_direction_filter.enabled");
-  filter_settings_.lanelet_direction_filter_velocity_yaw_threshold =
-    declare_parameter<double>("filter_settings.lanelet_direction_filter.velocity_yaw_threshold");
-  filter_settings_.lanelet_direction_filter_object_speed_threshold =
-    declare_parameter<double>("filter_settings.lanelet_direction_filter.object_speed_threshold");
+    node.declare_parameter<bool>(settings_prefix + "lanelet_direction_filter.enabled");
+  filter_settings_.lanelet_direction_filter_velocity_yaw_threshold = node.declare_parameter<double>(
+    settings_prefix + "lanelet_direction_filter.velocity_yaw_threshold");
+  filter_settings_.lanelet_direction_filter_object_speed_threshold = node.declare_parameter<double>(
+    settings_prefix + "lanelet_direction_filter.object_speed_threshold");
+}
+
+ObjectLaneletFilterNode::ObjectLaneletFilterNode(const rclcpp::NodeOptions & node_options)
+: Node("object_lanelet_filter_node", node_options),
+  tf_buffer_(this->get_clock()),
+  tf_listener_(tf_buffer_),
+  lanelet_filter_(*this, "")
+{
+  using std::placeholders::_1;
 
   // Set publisher/subscriber
   map_sub_ = this->create_subscription<autoware_map_msgs::msg::LaneletMapBin>(
@@ -78,9 +85,37 @@ ObjectLaneletFilterNode::ObjectLaneletFilterNode(const rclcpp::NodeOptions & nod
 void ObjectLaneletFilterNode::mapCallback(
   const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr map_msg)
 {
-  lanelet_frame_id_ = map_msg->header.frame_id;
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr_);
+  lanelet_filter_.setMap(*map_msg);
+}
+
+void ObjectLaneletFilter::setMap(const autoware_map_msgs::msg::LaneletMapBin & map_msg)
+{
+  lanelet_frame_id_ = map_msg.header.frame_id;
+  // NOTE: The map is shared with the other nodes of the process
+  lanelet_map_ptr_ = autoware::lanelet2_map_cache::from_bin_msg(map_msg).map;
+
+  std::vector<BoxAndLanelet> lanelets_with_bbox;
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+    // only check the road lanelets and road shoulder lanelets
+    if (
+      !lanelet.hasAttribute(lanelet::AttributeName::Subtype) ||
+      (lanelet.attribute(lanelet::AttributeName::Subtype).value() !=
+         lanelet::AttributeValueString::Road &&
+       lanelet.attribute(lanelet::AttributeName::Subtype).value() != "road_shoulder")) {
+      continue;
+    }
+    LaneletGeometry lanelet_geometry{lanelet, lanelet.polygon2d().basicPolygon(), {}};
+    bg::convex_hull(lanelet_geometry.polygon, lanelet_geometry.convex_hull);
+
+    // create bbox using boost for making the R-tree
+    const lanelet::BoundingBox2d lanelet_bbox = lanelet::geometry::boundingBox2d(lanelet);
+    const Point2d min_corner(lanelet_bbox.min().x(), lanelet_bbox.min().y());
+    const Point2d max_corner(lanelet_bbox.max().x(), lanelet_bbox.max().y());
+    lanelets_with_bbox.emplace_back(Box(min_corner, max_corner), std::move(lanelet_geometry));
+  }
+  // the range constructor bulk loads the tree with the packing algorithm
+  lanelet_rtree_ =
+    bgi::rtree<BoxAndLanelet, RtreeAlgo>(lanelets_with_bbox.begin(), lanelets_with_bbox.end());
 }
 
 void ObjectLaneletFilterNode::objectCallback(
@@ -92,35 +127,22 @@ void ObjectLaneletFilterNode::objectCallback(
   autoware_perception_msgs::msg::DetectedObjects output_object_msg;
   output_object_msg.header = input_msg->header;
 
-  if (!lanelet_map_ptr_) {
+  if (!lanelet_filter_.hasMap()) {
     RCLCPP_ERROR(get_logger(), "No vector map received.");
     return;
   }
+  const auto & lanelet_frame_id = lanelet_filter_.getMapFrameId();
   autoware_perception_msgs::msg::DetectedObjects transformed_objects;
   if (!autoware::object_recognition_utils::transformObjects(
-        *input_msg, lanelet_frame_id_, tf_buffer_, transformed_objects)) {
-    RCLCPP_ERROR(get_logger(), "Failed transform to %s.", lanelet_frame_id_.c_str());
+        *input_msg, lanelet_frame_id, tf_buffer_, transformed_objects)) {
+    RCLCPP_ERROR(get_logger(), "Failed transform to %s.", lanelet_frame_id.c_str());
     return;
   }
 
-  if (!transformed_objects.objects.empty()) {
-    // calculate convex hull
-    const auto convex_hull = getConvexHull(transformed_objects);
-
-    // get intersected lanelets
-    std::vector<BoxAndLanelet> intersected_lanelets_with_bbox = getIntersectedLanelets(convex_hull);
-
-    // create R-Tree with intersected_lanelets for fast search
-    bgi::rtree<BoxAndLanelet, RtreeAlgo> local_rtree;
-    for (const auto & bbox_and_lanelet : intersected_lanelets_with_bbox) {
-      local_rtree.insert(bbox_and_lanelet);
-    }
-
-    // filtering process
-    for (size_t index = 0; index < transformed_objects.objects.size(); ++index) {
-      const auto & transformed_object = transformed_objects.objects.at(index);
-      const auto & input_object = input_msg->objects.at(index);
-      filterObject(transformed_object, input_object, local_rtree, output_object_msg);
+  // filtering process
+  for (size_t index = 0; index < transformed_objects.objects.size(); ++index) {
+    if (lanelet_filter_.isPassing(transformed_objects.objects.at(index))) {
+      output_object_msg.objects.emplace_back(input_msg->objects.at(index));
     }
   }
 
@@ -137,23 +159,20 @@ void ObjectLaneletFilterNode::objectCallback(
     "debug/pipeline_latency_ms", pipeline_latency);
 }
 
-bool ObjectLaneletFilterNode::filterObject(
-  const autoware_perception_msgs::msg::DetectedObject & transformed_object,
-  const autoware_perception_msgs::msg::DetectedObject & input_object,
-  const bgi::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree,
-  autoware_perception_msgs::msg::DetectedObjects & output_object_msg)
+bool ObjectLaneletFilter::isPassing(
+  const autoware_perception_msgs::msg::DetectedObject & transformed_object) const
 {
   const auto & label = transformed_object.classification.front().label;
   if (filter_target_.isTarget(label)) {
     // no tree, then no intersection
-    if (local_rtree.empty()) {
+    if (lanelet_rtree_.empty()) {
       return false;
     }
 
     bool filter_pass = true;
     // 1. is polygon overlap with road lanelets or shoulder lanelets
     if (filter_settings_.polygon_overlap_filter) {
-      const bool is_polygon_overlap = isObjectOverlapLanelets(transformed_object, local_rtree);
+      const bool is_polygon_overlap = isObjectOverlapLanelets(transformed_object);
       filter_pass = filter_pass && is_polygon_overlap;
     }
 
@@ -162,24 +181,17 @@ bool ObjectLaneletFilterNode::filterObject(
       transformed_object.kinematics.orientation_availability ==
       autoware_perception_msgs::msg::TrackedObjectKinematics::UNAVAILABLE;
     if (filter_settings_.lanelet_direction_filter && !orientation_not_available) {
-      const bool is_same_direction = isSameDirectionWithLanelets(transformed_object, local_rtree);
+      const bool is_same_direction = isSameDirectionWithLanelets(transformed_object);
       filter_pass = filter_pass && is_same_direction;
     }
 
-    // push back to output object
-    if (filter_pass) {
-      output_object_msg.objects.emplace_back(input_object);
-      return true;
-    }
-  } else {
-    output_object_msg.objects.emplace_back(input_object);
-    return true;
+    return filter_pass;
   }
-  return false;
+  return true;
 }
 
-geometry_msgs::msg::Polygon ObjectLaneletFilterNode::setFootprint(
-  const autoware_perception_msgs::msg::DetectedObject & detected_object)
+geometry_msgs::msg::Polygon ObjectLaneletFilter::setFootprint(
+  const autoware_perception_msgs::msg::DetectedObject & detected_object) const
 {
   geometry_msgs::msg::Polygon footprint;
   if (detected_object.shape.type == autoware_perception_msgs::msg::Shape::BOUNDING_BOX) {
@@ -203,25 +215,8 @@ geometry_msgs::msg::Polygon ObjectLaneletFilterNode::setFootprint(
   return footprint;
 }
 
-LinearRing2d ObjectLaneletFilterNode::getConvexHull(
-  const autoware_perception_msgs::msg::DetectedObjects & detected_objects)
-{
-  MultiPoint2d candidate_points;
-  for (const auto & object : detected_objects.objects) {
-    const auto & pos = object.kinematics.pose_with_covariance.pose.position;
-    const auto footprint = setFootprint(object);
-    for (const auto & p : footprint.points) {
-      candidate_points.emplace_back(p.x + pos.x, p.y + pos.y);
-    }
-  }
-  LinearRing2d convex_hull;
-  bg::convex_hull(candidate_points, convex_hull);
-
-  return convex_hull;
-}
-
-LinearRing2d ObjectLaneletFilterNode::getConvexHullFromObjectFootprint(
-  const autoware_perception_msgs::msg::DetectedObject & object)
+LinearRing2d ObjectLaneletFilter::getConvexHullFromObjectFootprint(
+  const autoware_perception_msgs::msg::DetectedObject & object) const
 {
   MultiPoint2d candidate_points;
   const auto & pos = object.kinematics.pose_with_covariance.pose.position;
@@ -237,50 +232,8 @@ LinearRing2d ObjectLaneletFilterNode::getConvexHullFromObjectFootprint(
   return convex_hull;
 }
 
-// fetch the intersected candidate lanelets with bounding box and then
-// check the intersections among the lanelets and the convex hull
-std::vector<BoxAndLanelet> ObjectLaneletFilterNode::getIntersectedLanelets(
-  const LinearRing2d & convex_hull)
-{
-  std::vector<BoxAndLanelet> intersected_lanelets_with_bbox;
-
-  // convert convex_hull to a 2D bounding box for searching in the LaneletMap
-  bg::model::box<bg::model::d2::point_xy<double>> bbox_of_convex_hull;
-  bg::envelope(convex_hull, bbox_of_convex_hull);
-  const lanelet::BoundingBox2d bbox2d(
-    lanelet::BasicPoint2d(
-      bg::get<bg::min_corner, 0>(bbox_of_convex_hull),
-      bg::get<bg::min_corner, 1>(bbox_of_convex_hull)),
-    lanelet::BasicPoint2d(
-      bg::get<bg::max_corner, 0>(bbox_of_convex_hull),
-      bg::get<bg::max_corner, 1>(bbox_of_convex_hull)));
-
-  const lanelet::Lanelets candidate_lanelets = lanelet_map_ptr_->laneletLayer.search(bbox2d);
-  for (const auto & lanelet : candidate_lanelets) {
-    // only check the road lanelets and road shoulder lanelets
-    if (
-      lanelet.hasAttribute(lanelet::AttributeName::Subtype) &&
-      (lanelet.attribute(lanelet::AttributeName::Subtype).value() ==
-         lanelet::AttributeValueString::Road ||
-       lanelet.attribute(lanelet::AttributeName::Subtype).value() == "road_shoulder")) {
-      if (bg::intersects(convex_hull, lanelet.polygon2d().basicPolygon())) {
-        // create bbox using boost for making the R-tree in later phase
-        lanelet::BoundingBox2d lanelet_bbox = lanelet::geometry::boundingBox2d(lanelet);
-        Point2d min_corner(lanelet_bbox.min().x(), lanelet_bbox.min().y());
-        Point2d max_corner(lanelet_bbox.max().x(), lanelet_bbox.max().y());
-        Box boost_bbox(min_corner, max_corner);
-
-        intersected_lanelets_with_bbox.emplace_back(std::make_pair(boost_bbox, lanelet));
-      }
-    }
-  }
-
-  return intersected_lanelets_with_bbox;
-}
-
-bool ObjectLaneletFilterNode::isObjectOverlapLanelets(
-  const autoware_perception_msgs::msg::DetectedObject & object,
-  const bgi::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree)
+bool ObjectLaneletFilter::isObjectOverlapLanelets(
+  const autoware_perception_msgs::msg::DetectedObject & object) const
 {
   // if object has bounding box, use polygon overlap
   if (utils::hasBoundingBox(object)) {
@@ -294,7 +247,7 @@ bool ObjectLaneletFilterNode::isObjectOverlapLanelets(
     }
     polygon.outer().push_back(polygon.outer().front());
 
-    return isPolygonOverlapLanelets(polygon, local_rtree);
+    return isPolygonOverlapLanelets(polygon);
   } else {
     const LinearRing2d object_convex_hull = getConvexHullFromObjectFootprint(object);
 
@@ -302,7 +255,7 @@ bool ObjectLaneletFilterNode::isObjectOverlapLanelets(
     std::vector<BoxAndLanelet> candidates;
     bg::model::box<bg::model::d2::point_xy<double>> bbox;
     bg::envelope(object_convex_hull, bbox);
-    local_rtree.query(bgi::intersects(bbox), std::back_inserter(candidates));
+    lanelet_rtree_.query(bgi::intersects(bbox), std::back_inserter(candidates));
 
     // if object do not have bounding box, check each footprint is inside polygon
     for (const auto & point : object.shape.footprint.points) {
@@ -314,7 +267,7 @@ bool ObjectLaneletFilterNode::isObjectOverlapLanelets(
       point2d.position.y = point_transformed.y;
 
       for (const auto & candidate : candidates) {
-        if (lanelet::utils::isInLanelet(point2d, candidate.second, 0.0)) {
+        if (lanelet::utils::isInLanelet(point2d, candidate.second.lanelet, 0.0)) {
           return true;
         }
       }
@@ -324,17 +277,20 @@ bool ObjectLaneletFilterNode::isObjectOverlapLanelets(
   }
 }
 
-bool ObjectLaneletFilterNode::isPolygonOverlapLanelets(
-  const Polygon2d & polygon, const bgi::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree)
+bool ObjectLaneletFilter::isPolygonOverlapLanelets(const Polygon2d & polygon) const
 {
   // create a bounding box from polygon for searching the local R-tree
   std::vector<BoxAndLanelet> candidates;
   bg::model::box<bg::model::d2::point_xy<double>> bbox_of_convex_hull;
   bg::envelope(polygon, bbox_of_convex_hull);
-  local_rtree.query(bgi::intersects(bbox_of_convex_hull), std::back_inserter(candidates));
+  lanelet_rtree_.query(bgi::intersects(bbox_of_convex_hull), std::back_inserter(candidates));
 
   for (const auto & box_and_lanelet : candidates) {
-    if (!bg::disjoint(polygon, box_and_lanelet.second.polygon2d().basicPolygon())) {
+    // the lanelet is within its convex hull, which has fewer points to test against
+    if (bg::disjoint(polygon, box_and_lanelet.second.convex_hull)) {
+      continue;
+    }
+    if (!bg::disjoint(polygon, box_and_lanelet.second.polygon)) {
       return true;
     }
   }
@@ -342,9 +298,8 @@ bool ObjectLaneletFilterNode::isPolygonOverlapLanelets(
   return false;
 }
 
-bool ObjectLaneletFilterNode::isSameDirectionWithLanelets(
-  const autoware_perception_msgs::msg::DetectedObject & object,
-  const bgi::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree)
+bool ObjectLaneletFilter::isSameDirectionWithLanelets(
+  const autoware_perception_msgs::msg::DetectedObject & object) const
 {
   const double object_yaw = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
   const double object_velocity_norm = std::hypot(
@@ -371,17 +326,17 @@ bool ObjectLaneletFilterNode::isSameDirectionWithLanelets(
     object.kinematics.pose_with_covariance.pose.position.y + eps);
   const Box bbox(min_corner, max_corner);
 
-  local_rtree.query(bgi::intersects(bbox), std::back_inserter(candidates));
+  lanelet_rtree_.query(bgi::intersects(bbox), std::back_inserter(candidates));
 
   for (const auto & box_and_lanelet : candidates) {
     const bool is_in_lanelet = lanelet::utils::isInLanelet(
-      object.kinematics.pose_with_covariance.pose, box_and_lanelet.second, 0.0);
+      object.kinematics.pose_with_covariance.pose, box_and_lanelet.second.lanelet, 0.0);
     if (!is_in_lanelet) {
       continue;
     }
 
     const double lane_yaw = lanelet::utils::getLaneletAngle(
-      box_and_lanelet.second, object.kinematics.pose_with_covariance.pose.position);
+      box_and_lanelet.second.lanelet, object.kinematics.pose_with_covariance.pose.position);
     const double delta_yaw = object_velocity_yaw - lane_yaw;
     const double normalized_delta_yaw = autoware::universe_utils::normalizeRadian(delta_yaw);
     const double abs_norm_delta_yaw = std::fabs(normalized_delta_yaw);
@@ -394,9 +349,55 @@ bool ObjectLaneletFilterNode::isSameDirectionWithLanelets(
   return false;
 }
 
+void ObjectLaneletFilterPlugin::init(rclcpp::Node & node, tf2_ros::Buffer & tf_buffer)
+{
+  logger_ = node.get_logger().get_child(get_filter_name());
+  tf_buffer_ = &tf_buffer;
+  lanelet_filter_ = std::make_unique<ObjectLaneletFilter>(node, get_filter_name() + ".");
+  map_sub_ = node.create_subscription<autoware_map_msgs::msg::LaneletMapBin>(
+    "input/vector_map", rclcpp::QoS{1}.transient_local(),
+    [this](const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr map_msg) {
+      lanelet_filter_->setMap(*map_msg);
+    });
+}
+
+bool ObjectLaneletFilterPlugin::filter(autoware_perception_msgs::msg::DetectedObjects & objects)
+{
+  if (!lanelet_filter_->hasMap()) {
+    RCLCPP_ERROR(logger_, "No vector map received.");
+    return false;
+  }
+  const auto & lanelet_frame_id = lanelet_filter_->getMapFrameId();
+  autoware_perception_msgs::msg::DetectedObjects transformed_objects;
+  if (!autoware::object_recognition_utils::transformObjects(
+        objects, lanelet_frame_id, *tf_buffer_, transformed_objects)) {
+    RCLCPP_ERROR(logger_, "Failed transform to %s.", lanelet_frame_id.c_str());
+    return false;
+  }
+
+  // compact the passing objects to the front, keeping their order
+  auto & object_array = objects.objects;
+  size_t num_passing_objects = 0;
+  for (size_t index = 0; index < object_array.size(); ++index) {
+    if (!lanelet_filter_->isPassing(transformed_objects.objects.at(index))) {
+      continue;
+    }
+    if (num_passing_objects != index) {
+      object_array.at(num_passing_objects) = std::move(object_array.at(index));
+    }
+    ++num_passing_objects;
+  }
+  object_array.erase(object_array.begin() + num_passing_objects, object_array.end());
+  return true;
+}
+
 }  // namespace lanelet_filter
 }  // namespace autoware::detected_object_validation
 
+#include <pluginlib/class_list_macros.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 RCLCPP_COMPONENTS_REGISTER_NODE(
   autoware::detected_object_validation::lanelet_filter::ObjectLaneletFilterNode)
+PLUGINLIB_EXPORT_CLASS(
+  autoware::detected_object_validation::lanelet_filter::ObjectLaneletFilterPlugin,
+  autoware::detected_object_validation::ObjectFilterPluginInterface)
@@ -15,6 +15,7 @@
 #ifndef LANELET_FILTER__LANELET_FILTER_HPP_
 #define LANELET_FILTER__LANELET_FILTER_HPP_
 
+#include "autoware/detected_object_validation/object_filter_pipeline/plugin_interface.hpp"
 #include "autoware/detected_object_validation/utils/utils.hpp"
 #include "autoware/universe_utils/geometry/geometry.hpp"
 #include "autoware/universe_utils/ros/debug_publisher.hpp"
@@ -51,28 +52,35 @@ namespace bg = boost::geometry;
 namespace bgi = boost::geometry::index;
 using Point2d = bg::model::point<double, 2, bg::cs::cartesian>;
 using Box = boost::geometry::model::box<Point2d>;
-using BoxAndLanelet = std::pair<Box, lanelet::Lanelet>;
+/** @brief road or road shoulder lanelet with the geometry used by the overlap tests */
+struct LaneletGeometry
+{
+  lanelet::Lanelet lanelet;
+  lanelet::BasicPolygon2d polygon;
+  /** @brief convex hull of the polygon, which rejects most of the disjoint objects faster */
+  LinearRing2d convex_hull;
+};
+using BoxAndLanelet = std::pair<Box, LaneletGeometry>;
 using RtreeAlgo = bgi::rstar<16>;
 
-class ObjectLaneletFilterNode : public rclcpp::Node
+class ObjectLaneletFilter
 {
 public:
-  explicit ObjectLaneletFilterNode(const rclcpp::NodeOptions & node_options);
+  // declares the parameters with the prefix, which is empty for the standalone node
+  ObjectLaneletFilter(rclcpp::Node & node, const std::string & prefix);
 
-private:
-  void objectCallback(const autoware_perception_msgs::msg::DetectedObjects::ConstSharedPtr);
-  void mapCallback(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr);
+  void setMap(const autoware_map_msgs::msg::LaneletMapBin & map_msg);
+  bool hasMap() const { return lanelet_map_ptr_ != nullptr; }
+  const std::string & getMapFrameId() const { return lanelet_frame_id_; }
 
-  rclcpp::Publisher<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr object_pub_;
-  rclcpp::Subscription<autoware_map_msgs::msg::LaneletMapBin>::SharedPtr map_sub_;
-  rclcpp::Subscription<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr object_sub_;
-  std::unique_ptr<autoware::universe_utils::DebugPublisher> debug_publisher_{nullptr};
+  // whether the object transformed to the map frame passes the filter
+  bool isPassing(const autoware_perception_msgs::msg::DetectedObject & transformed_object) const;
 
+private:
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   std::string lanelet_frame_id_;
-
-  tf2_ros::Buffer tf_buffer_;
-  tf2_ros::TransformListener tf_listener_;
+  // road and road shoulder lanelets of the whole map, bulk loaded once per map
+  bgi::rtree<BoxAndLanelet, RtreeAlgo> lanelet_rtree_;
 
   utils::FilterTargetLabel filter_target_;
   struct FilterSettings
@@ -83,28 +91,52 @@ private:
     double lanelet_direction_filter_object_speed_threshold;
   } filter_settings_;
 
-  bool filterObject(
-    const autoware_perception_msgs::msg::DetectedObject & transformed_object,
-    const autoware_perception_msgs::msg::DetectedObject & input_object,
-    const bg::index::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree,
-    autoware_perception_msgs::msg::DetectedObjects & output_object_msg);
-  LinearRing2d getConvexHull(const autoware_perception_msgs::msg::DetectedObjects &);
   LinearRing2d getConvexHullFromObjectFootprint(
-    const autoware_perception_msgs::msg::DetectedObject & object);
-  std::vector<BoxAndLanelet> getIntersectedLanelets(const LinearRing2d &);
-  bool isObjectOverlapLanelets(
-    const autoware_perception_msgs::msg::DetectedObject & object,
-    const bg::index::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree);
-  bool isPolygonOverlapLanelets(
-    const Polygon2d & polygon, const bgi::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree);
+    const autoware_perception_msgs::msg::DetectedObject & object) const;
+  bool isObjectOverlapLanelets(const autoware_perception_msgs::msg::DetectedObject & object) const;
+  bool isPolygonOverlapLanelets(const Polygon2d & polygon) const;
   bool isSameDirectionWithLanelets(
-    const autoware_perception_msgs::msg::DetectedObject & object,
-    const bgi::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree);
-  geometry_msgs::msg::Polygon setFootprint(const autoware_perception_msgs::msg::DetectedObject &);
+    const autoware_perception_msgs::msg::DetectedObject & object) const;
+  geometry_msgs::msg::Polygon setFootprint(
+    const autoware_perception_msgs::msg::DetectedObject &) const;
+};
+
+class ObjectLaneletFilterNode : public rclcpp::Node
+{
+public:
+  explicit ObjectLaneletFilterNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  void objectCallback(const autoware_perception_msgs::msg::DetectedObjects::ConstSharedPtr);
+  void mapCallback(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr);
+
+  rclcpp::Publisher<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr object_pub_;
+  rclcpp::Subscription<autoware_map_msgs::msg::LaneletMapBin>::SharedPtr map_sub_;
+  rclcpp::Subscription<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr object_sub_;
+  std::unique_ptr<autoware::universe_utils::DebugPublisher> debug_publisher_{nullptr};
+
+  tf2_ros::Buffer tf_buffer_;
+  tf2_ros::TransformListener tf_listener_;
+
+  ObjectLaneletFilter lanelet_filter_;
 
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
 };
 
+class ObjectLaneletFilterPlugin : public ObjectFilterPluginInterface
+{
+public:
+  void init(rclcpp::Node & node, tf2_ros::Buffer & tf_buffer) override;
+  bool filter(autoware_perception_msgs::msg::DetectedObjects & objects) override;
+  std::string get_filter_name() const override { return "lanelet_filter"; }
+
+private:
+  rclcpp::Logger logger_{rclcpp::get_logger("lanelet_filter")};
+  rclcpp::Subscription<autoware_map_msgs::msg::LaneletMapBin>::SharedPtr map_sub_;
+  tf2_ros::Buffer * tf_buffer_{nullptr};
+  std::unique_ptr<ObjectLaneletFilter> lanelet_filter_;
+};
+
 }  // namespace lanelet_filter
 }  // namespace autoware::detected_object_validation
 
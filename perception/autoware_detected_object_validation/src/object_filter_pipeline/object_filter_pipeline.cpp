@@ -0,0 +1,81 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "object_filter_pipeline.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace object_filter_pipeline
+{
+ObjectFilterPipelineNode::ObjectFilterPipelineNode(const rclcpp::NodeOptions & node_options)
+: Node("object_filter_pipeline_node", node_options),
+  tf_buffer_(this->get_clock()),
+  tf_listener_(tf_buffer_),
+  plugin_loader_(
+    "autoware_detected_object_validation",
+    "autoware::detected_object_validation::ObjectFilterPluginInterface")
+{
+  // Load the filters in the order they run
+  for (const auto & name : declare_parameter<std::vector<std::string>>("filter_plugins")) {
+    if (!plugin_loader_.isClassAvailable(name)) {
+      RCLCPP_ERROR_STREAM(get_logger(), "The filter plugin '" << name << "' is not available.");
+      continue;
+    }
+    const auto filter = plugin_loader_.createSharedInstance(name);
+    filter->init(*this, tf_buffer_);
+    filters_.push_back(filter);
+    RCLCPP_DEBUG_STREAM(get_logger(), "The filter plugin '" << name << "' is loaded.");
+  }
+
+  // Set publisher/subscriber
+  object_sub_ = this->create_subscription<autoware_perception_msgs::msg::DetectedObjects>(
+    "input/object", rclcpp::QoS{1},
+    [this](autoware_perception_msgs::msg::DetectedObjects::UniquePtr input_msg) {
+      objectCallback(std::move(input_msg));
+    });
+  object_pub_ = this->create_publisher<autoware_perception_msgs::msg::DetectedObjects>(
+    "output/object", rclcpp::QoS{1});
+  published_time_publisher_ =
+    std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+}
+
+void ObjectFilterPipelineNode::objectCallback(
+  autoware_perception_msgs::msg::DetectedObjects::UniquePtr input_msg)
+{
+  // Guard
+  if (object_pub_->get_subscription_count() < 1) return;
+
+  // the filters remove the objects of the received message in place
+  for (const auto & filter : filters_) {
+    if (!filter->filter(*input_msg)) {
+      return;
+    }
+  }
+
+  const auto stamp = input_msg->header.stamp;
+  object_pub_->publish(std::move(input_msg));
+  published_time_publisher_->publish_if_subscribed(object_pub_, stamp);
+}
+
+}  // namespace object_filter_pipeline
+}  // namespace autoware::detected_object_validation
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(
+  autoware::detected_object_validation::object_filter_pipeline::ObjectFilterPipelineNode)
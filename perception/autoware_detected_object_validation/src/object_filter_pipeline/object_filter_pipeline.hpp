@@ -0,0 +1,64 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBJECT_FILTER_PIPELINE__OBJECT_FILTER_PIPELINE_HPP_
+#define OBJECT_FILTER_PIPELINE__OBJECT_FILTER_PIPELINE_HPP_
+
+#include "autoware/detected_object_validation/object_filter_pipeline/plugin_interface.hpp"
+#include "autoware/universe_utils/ros/published_time_publisher.hpp"
+
+#include <pluginlib/class_loader.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include "autoware_perception_msgs/msg/detected_objects.hpp"
+
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+
+#include <memory>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace object_filter_pipeline
+{
+
+/**
+ * @brief runs the filters loaded as plugins in sequence on the objects of a message, so that the
+ * objects are not copied and republished between the filters
+ */
+class ObjectFilterPipelineNode : public rclcpp::Node
+{
+public:
+  explicit ObjectFilterPipelineNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  void objectCallback(autoware_perception_msgs::msg::DetectedObjects::UniquePtr input_msg);
+
+  rclcpp::Publisher<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr object_pub_;
+  rclcpp::Subscription<autoware_perception_msgs::msg::DetectedObjects>::SharedPtr object_sub_;
+
+  tf2_ros::Buffer tf_buffer_;
+  tf2_ros::TransformListener tf_listener_;
+
+  pluginlib::ClassLoader<ObjectFilterPluginInterface> plugin_loader_;
+  std::vector<std::shared_ptr<ObjectFilterPluginInterface>> filters_;
+
+  std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
+};
+
+}  // namespace object_filter_pipeline
+}  // namespace autoware::detected_object_validation
+
+#endif  // OBJECT_FILTER_PIPELINE__OBJECT_FILTER_PIPELINE_HPP_
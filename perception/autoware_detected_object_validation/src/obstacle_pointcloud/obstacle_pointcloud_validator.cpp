@@ -38,12 +38,71 @@ namespace bg = boost::geometry;
 using Shape = autoware_perception_msgs::msg::Shape;
 using Polygon2d = autoware::universe_utils::Polygon2d;
 
-Validator::Validator(const PointsNumThresholdParam & points_num_threshold_param)
+namespace
+{
+// covers the rounding of the distances to the object, so that the grid visits every neighbor point
+constexpr double grid_search_margin = 1e-3;
+}  // namespace
+
+Validator::Validator(
+  const PointsNumThresholdParam & points_num_threshold_param,
+  const std::optional<double> & grid_index_cell_size)
+: grid_index_cell_size_(grid_index_cell_size)
 {
   points_num_threshold_param_.min_points_num = points_num_threshold_param.min_points_num;
   points_num_threshold_param_.max_points_num = points_num_threshold_param.max_points_num;
   points_num_threshold_param_.min_points_and_distance_ratio =
     points_num_threshold_param.min_points_and_distance_ratio;
+  // the debug pointclouds stay empty with the grid counting
+  if (grid_index_cell_size_) cropped_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
+}
+
+bool Validator::setCropHull(const autoware_perception_msgs::msg::DetectedObject & object)
+{
+  const Polygon2d poly2d = autoware::universe_utils::toPolygon2d(
+    object.kinematics.pose_with_covariance.pose, object.shape);
+  if (bg::is_empty(poly2d)) return false;
+
+  crop_hull_.clear();
+  for (const auto & point : poly2d.outer()) {
+    crop_hull_.emplace_back(point.x(), point.y());
+  }
+  // only a footprint given as a polygon may be concave
+  crop_hull_is_convex_ = object.shape.type != Shape::POLYGON;
+  return true;
+}
+
+bool Validator::isWithinCropHull(const float x, const float y) const
+{
+  // same test as pcl::CropHull in 2D, with the hull polygons {0}, {0, 1}, ..., {0, ..., n - 1}
+  // given in getPointCloudWithinObject, so that both ways count the same points
+  const auto is_within_polygon = [&](const size_t num_vertices) {
+    bool in_poly = false;
+    double x_old = crop_hull_[num_vertices - 1].x;
+    double y_old = crop_hull_[num_vertices - 1].y;
+    for (size_t i = 0; i < num_vertices; ++i) {
+      const double x_new = crop_hull_[i].x;
+      const double y_new = crop_hull_[i].y;
+      const bool is_ascending = x_new > x_old;
+      const double x1 = is_ascending ? x_old : x_new;
+      const double y1 = is_ascending ? y_old : y_new;
+      const double x2 = is_ascending ? x_new : x_old;
+      const double y2 = is_ascending ? y_new : y_old;
+      if ((x_new < x) == (x <= x_old) && (y - y1) * (x2 - x1) < (y2 - y1) * (x - x1)) {
+        in_poly = !in_poly;
+      }
+      x_old = x_new;
+      y_old = y_new;
+    }
+    return in_poly;
+  };
+
+  // the other hull polygons are within the whole one when it is convex
+  if (crop_hull_is_convex_) return is_within_polygon(crop_hull_.size());
+  for (size_t num_vertices = 1; num_vertices <= crop_hull_.size(); ++num_vertices) {
+    if (is_within_polygon(num_vertices)) return true;
+  }
+  return false;
 }
 
 size_t Validator::getThresholdPointCloud(
@@ -63,9 +122,12 @@ size_t Validator::getThresholdPointCloud(
   return threshold_pc;
 }
 
-Validator2D::Validator2D(PointsNumThresholdParam & points_num_threshold_param)
-: Validator(points_num_threshold_param)
+Validator2D::Validator2D(
+  PointsNumThresholdParam & points_num_threshold_param,
+  const std::optional<double> & grid_index_cell_size)
+: Validator(points_num_threshold_param, grid_index_cell_size)
 {
+  if (grid_index_cell_size_) neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXY>);
 }
 
 bool Validator2D::setKdtreeInputCloud(
@@ -76,6 +138,10 @@ bool Validator2D::setKdtreeInputCloud(
   if (obstacle_pointcloud_->empty()) {
     return false;
   }
+  if (grid_index_cell_size_) {
+    grid_index_.build(obstacle_pointcloud_->points, grid_index_cell_size_.value());
+    return true;
+  }
 
   kdtree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
   kdtree_->setInputCloud(obstacle_pointcloud_);
@@ -121,26 +187,57 @@ std::optional<size_t> Validator2D::getPointCloudWithinObject(
   return cropped_pointcloud_->size();
 }
 
+std::optional<size_t> Validator2D::getPointNumWithinObjectOnGrid(
+  const autoware_perception_msgs::msg::DetectedObject & object, const float search_radius)
+{
+  if (!setCropHull(object)) return std::nullopt;
+
+  // same neighbor condition as the kdtree radius search
+  const pcl::PointXY center(
+    object.kinematics.pose_with_covariance.pose.position.x,
+    object.kinematics.pose_with_covariance.pose.position.y);
+  const auto squared_radius =
+    static_cast<float>(static_cast<double>(search_radius) * search_radius);
+  const double search_range = search_radius + grid_search_margin;
+  size_t num = 0;
+  grid_index_.forEachPointInArea(
+    center.x - search_range, center.y - search_range, center.x + search_range,
+    center.y + search_range, [&](const uint32_t index) {
+      const auto & point = obstacle_pointcloud_->points[index];
+      const float dx = point.x - center.x;
+      const float dy = point.y - center.y;
+      if (dx * dx + dy * dy < squared_radius && isWithinCropHull(point.x, point.y)) {
+        ++num;
+      }
+    });
+  return num;
+}
+
 bool Validator2D::validate_object(
   const autoware_perception_msgs::msg::DetectedObject & transformed_object)
 {
-  // get neighbor_pointcloud of object
-  neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXY>);
-  std::vector<int> indices;
-  std::vector<float> distances;
   const auto search_radius = getMaxRadius(transformed_object);
   if (!search_radius) {
     return false;
   }
-  kdtree_->radiusSearch(
-    pcl::PointXY(
-      transformed_object.kinematics.pose_with_covariance.pose.position.x,
-      transformed_object.kinematics.pose_with_covariance.pose.position.y),
-    search_radius.value(), indices, distances);
-  for (const auto & index : indices) {
-    neighbor_pointcloud_->push_back(obstacle_pointcloud_->at(index));
+  std::optional<size_t> num;
+  if (grid_index_cell_size_) {
+    num = getPointNumWithinObjectOnGrid(transformed_object, search_radius.value());
+  } else {
+    // get neighbor_pointcloud of object
+    neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXY>);
+    std::vector<int> indices;
+    std::vector<float> distances;
+    kdtree_->radiusSearch(
+      pcl::PointXY(
+        transformed_object.kinematics.pose_with_covariance.pose.position.x,
+        transformed_object.kinematics.pose_with_covariance.pose.position.y),
+      search_radius.value(), indices, distances);
+    for (const auto & index : indices) {
+      neighbor_pointcloud_->push_back(obstacle_pointcloud_->at(index));
+    }
+    num = getPointCloudWithinObject(transformed_object, neighbor_pointcloud_);
   }
-  const auto num = getPointCloudWithinObject(transformed_object, neighbor_pointcloud_);
   if (!num) return true;
 
   size_t threshold_pointcloud_num = getThresholdPointCloud(transformed_object);
@@ -167,9 +264,12 @@ std::optional<float> Validator2D::getMaxRadius(
   }
 }
 
-Validator3D::Validator3D(PointsNumThresholdParam & points_num_threshold_param)
-: Validator(points_num_threshold_param)
+Validator3D::Validator3D(
+  PointsNumThresholdParam & points_num_threshold_param,
+  const std::optional<double> & grid_index_cell_size)
+: Validator(points_num_threshold_param, grid_index_cell_size)
 {
+  if (grid_index_cell_size_) neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
 }
 bool Validator3D::setKdtreeInputCloud(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_cloud)
@@ -179,6 +279,10 @@ bool Validator3D::setKdtreeInputCloud(
   if (obstacle_pointcloud_->empty()) {
     return false;
   }
+  if (grid_index_cell_size_) {
+    grid_index_.build(obstacle_pointcloud_->points, grid_index_cell_size_.value());
+    return true;
+  }
   // setup kdtree_
   kdtree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXYZ>>(false);
   kdtree_->setInputCloud(obstacle_pointcloud_);
@@ -244,27 +348,64 @@ std::optional<size_t> Validator3D::getPointCloudWithinObject(
   return cropped_pointcloud_->size();
 }
 
+std::optional<size_t> Validator3D::getPointNumWithinObjectOnGrid(
+  const autoware_perception_msgs::msg::DetectedObject & object, const float search_radius)
+{
+  if (!setCropHull(object)) return std::nullopt;
+
+  // same height range as getPointCloudWithinObject
+  auto const & object_position = object.kinematics.pose_with_covariance.pose.position;
+  auto const object_height = object.shape.dimensions.x;
+  auto z_min = object_position.z - object_height / 2.0f;
+  auto z_max = object_position.z + object_height / 2.0f;
+
+  // same neighbor condition as the kdtree radius search
+  const pcl::PointXYZ center(object_position.x, object_position.y, object_position.z);
+  const auto squared_radius =
+    static_cast<float>(static_cast<double>(search_radius) * search_radius);
+  const double search_range = search_radius + grid_search_margin;
+  size_t num = 0;
+  grid_index_.forEachPointInArea(
+    center.x - search_range, center.y - search_range, center.x + search_range,
+    center.y + search_range, [&](const uint32_t index) {
+      const auto & point = obstacle_pointcloud_->points[index];
+      const float dx = point.x - center.x;
+      const float dy = point.y - center.y;
+      const float dz = point.z - center.z;
+      if (
+        dx * dx + dy * dy + dz * dz < squared_radius && point.z > z_min && point.z < z_max &&
+        isWithinCropHull(point.x, point.y)) {
+        ++num;
+      }
+    });
+  return num;
+}
+
 bool Validator3D::validate_object(
   const autoware_perception_msgs::msg::DetectedObject & transformed_object)
 {
-  neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
-  std::vector<int> indices;
-  std::vector<float> distances;
   const auto search_radius = getMaxRadius(transformed_object);
   if (!search_radius) {
     return false;
   }
-  kdtree_->radiusSearch(
-    pcl::PointXYZ(
-      transformed_object.kinematics.pose_with_covariance.pose.position.x,
-      transformed_object.kinematics.pose_with_covariance.pose.position.y,
-      transformed_object.kinematics.pose_with_covariance.pose.position.z),
-    search_radius.value(), indices, distances);
-  for (const auto & index : indices) {
-    neighbor_pointcloud_->push_back(obstacle_pointcloud_->at(index));
+  std::optional<size_t> num;
+  if (grid_index_cell_size_) {
+    num = getPointNumWithinObjectOnGrid(transformed_object, search_radius.value());
+  } else {
+    neighbor_pointcloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
+    std::vector<int> indices;
+    std::vector<float> distances;
+    kdtree_->radiusSearch(
+      pcl::PointXYZ(
+        transformed_object.kinematics.pose_with_covariance.pose.position.x,
+        transformed_object.kinematics.pose_with_covariance.pose.position.y,
+        transformed_object.kinematics.pose_with_covariance.pose.position.z),
+      search_radius.value(), indices, distances);
+    for (const auto & index : indices) {
+      neighbor_pointcloud_->push_back(obstacle_pointcloud_->at(index));
+    }
+    num = getPointCloudWithinObject(transformed_object, neighbor_pointcloud_);
   }
-
-  const auto num = getPointCloudWithinObject(transformed_object, neighbor_pointcloud_);
   if (!num) return true;
 
   size_t threshold_pointcloud_num = getThresholdPointCloud(transformed_object);
@@ -293,6 +434,9 @@ ObstaclePointCloudBasedValidator::ObstaclePointCloudBasedValidator(
     declare_parameter<std::vector<double>>("min_points_and_distance_ratio");
 
   using_2d_validator_ = declare_parameter<bool>("using_2d_validator");
+  const bool using_grid_index = declare_parameter<bool>("using_grid_index");
+  std::optional<double> grid_index_cell_size = declare_parameter<double>("grid_index_cell_size");
+  if (!using_grid_index) grid_index_cell_size = std::nullopt;
 
   using std::placeholders::_1;
   using std::placeholders::_2;
@@ -300,9 +444,9 @@ ObstaclePointCloudBasedValidator::ObstaclePointCloudBasedValidator(
   sync_.registerCallback(
     std::bind(&ObstaclePointCloudBasedValidator::onObjectsAndObstaclePointCloud, this, _1, _2));
   if (using_2d_validator_) {
-    validator_ = std::make_unique<Validator2D>(points_num_threshold_param_);
+    validator_ = std::make_unique<Validator2D>(points_num_threshold_param_, grid_index_cell_size);
   } else {
-    validator_ = std::make_unique<Validator3D>(points_num_threshold_param_);
+    validator_ = std::make_unique<Validator3D>(points_num_threshold_param_, grid_index_cell_size);
   }
 
   objects_pub_ = create_publisher<autoware_perception_msgs::msg::DetectedObjects>(
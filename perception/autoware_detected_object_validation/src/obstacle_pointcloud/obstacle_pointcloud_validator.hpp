@@ -17,6 +17,7 @@
 // NOLINTNEXTLINE(whitespace/line_length)
 #define OBSTACLE_POINTCLOUD__OBSTACLE_POINTCLOUD_VALIDATOR_HPP_
 
+#include "autoware/detected_object_validation/utils/point_grid_index.hpp"
 #include "autoware/universe_utils/ros/debug_publisher.hpp"
 #include "autoware/universe_utils/ros/published_time_publisher.hpp"
 #include "debugger.hpp"
@@ -63,8 +64,20 @@ private:
 protected:
   pcl::PointCloud<pcl::PointXYZ>::Ptr cropped_pointcloud_;
 
+  // grid counting: the obstacle pointcloud is binned once per frame instead of building a kdtree,
+  // and the points of each object are counted without copying them
+  std::optional<double> grid_index_cell_size_;
+  utils::PointGridIndex grid_index_;
+  std::vector<pcl::PointXY> crop_hull_;
+  bool crop_hull_is_convex_{true};
+
+  bool setCropHull(const autoware_perception_msgs::msg::DetectedObject & object);
+  bool isWithinCropHull(const float x, const float y) const;
+
 public:
-  explicit Validator(const PointsNumThresholdParam & points_num_threshold_param);
+  explicit Validator(
+    const PointsNumThresholdParam & points_num_threshold_param,
+    const std::optional<double> & grid_index_cell_size = std::nullopt);
   inline pcl::PointCloud<pcl::PointXYZ>::Ptr getDebugPointCloudWithinObject() const
   {
     return cropped_pointcloud_;
@@ -90,7 +103,9 @@ private:
   pcl::search::Search<pcl::PointXY>::Ptr kdtree_;
 
 public:
-  explicit Validator2D(PointsNumThresholdParam & points_num_threshold_param);
+  explicit Validator2D(
+    PointsNumThresholdParam & points_num_threshold_param,
+    const std::optional<double> & grid_index_cell_size = std::nullopt);
 
   static pcl::PointCloud<pcl::PointXYZ>::Ptr convertToXYZ(
     const pcl::PointCloud<pcl::PointXY>::Ptr & pointcloud_xy);
@@ -108,6 +123,8 @@ public:
   std::optional<size_t> getPointCloudWithinObject(
     const autoware_perception_msgs::msg::DetectedObject & object,
     const pcl::PointCloud<pcl::PointXY>::Ptr pointcloud);
+  std::optional<size_t> getPointNumWithinObjectOnGrid(
+    const autoware_perception_msgs::msg::DetectedObject & object, const float search_radius);
 };
 class Validator3D : public Validator
 {
@@ -117,7 +134,9 @@ private:
   pcl::search::Search<pcl::PointXYZ>::Ptr kdtree_;
 
 public:
-  explicit Validator3D(PointsNumThresholdParam & points_num_threshold_param);
+  explicit Validator3D(
+    PointsNumThresholdParam & points_num_threshold_param,
+    const std::optional<double> & grid_index_cell_size = std::nullopt);
   inline pcl::PointCloud<pcl::PointXYZ>::Ptr getDebugNeighborPointCloud() override
   {
     return neighbor_pointcloud_;
@@ -131,6 +150,8 @@ public:
   std::optional<size_t> getPointCloudWithinObject(
     const autoware_perception_msgs::msg::DetectedObject & object,
     const pcl::PointCloud<pcl::PointXYZ>::Ptr neighbor_pointcloud);
+  std::optional<size_t> getPointNumWithinObjectOnGrid(
+    const autoware_perception_msgs::msg::DetectedObject & object, const float search_radius);
 };
 
 class ObstaclePointCloudBasedValidator : public rclcpp::Node
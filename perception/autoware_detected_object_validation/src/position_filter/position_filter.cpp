@@ -14,31 +14,47 @@
 
 #include "position_filter.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <string>
+
 namespace autoware::detected_object_validation
 {
 namespace position_filter
 {
+ObjectPositionFilter::ObjectPositionFilter(rclcpp::Node & node, const std::string & prefix)
+{
+  // Set parameters
+  upper_bound_x_ = node.declare_parameter<float>(prefix + "upper_bound_x");
+  upper_bound_y_ = node.declare_parameter<float>(prefix + "upper_bound_y");
+  lower_bound_x_ = node.declare_parameter<float>(prefix + "lower_bound_x");
+  lower_bound_y_ = node.declare_parameter<float>(prefix + "lower_bound_y");
+  const auto label_prefix = prefix + "filter_target_label.";
+  filter_target_.UNKNOWN = node.declare_parameter<bool>(label_prefix + "UNKNOWN");
+  filter_target_.CAR = node.declare_parameter<bool>(label_prefix + "CAR");
+  filter_target_.TRUCK = node.declare_parameter<bool>(label_prefix + "TRUCK");
+  filter_target_.BUS = node.declare_parameter<bool>(label_prefix + "BUS");
+  filter_target_.TRAILER = node.declare_parameter<bool>(label_prefix + "TRAILER");
+  filter_target_.MOTORCYCLE = node.declare_parameter<bool>(label_prefix + "MOTORCYCLE");
+  filter_target_.BICYCLE = node.declare_parameter<bool>(label_prefix + "BICYCLE");
+  filter_target_.PEDESTRIAN = node.declare_parameter<bool>(label_prefix + "PEDESTRIAN");
+}
+
+bool ObjectPositionFilter::isPassing(
+  const autoware_perception_msgs::msg::DetectedObject & object) const
+{
+  const auto & label = object.classification.front().label;
+  return !filter_target_.isTarget(label) || isObjectInBounds(object);
+}
+
 ObjectPositionFilterNode::ObjectPositionFilterNode(const rclcpp::NodeOptions & node_options)
 : Node("object_position_filter_node", node_options),
   tf_buffer_(this->get_clock()),
-  tf_listener_(tf_buffer_)
+  tf_listener_(tf_buffer_),
+  position_filter_(*this, "")
 {
   using std::placeholders::_1;
 
-  // Set parameters
-  upper_bound_x_ = declare_parameter<float>("upper_bound_x");
-  upper_bound_y_ = declare_parameter<float>("upper_bound_y");
-  lower_bound_x_ = declare_parameter<float>("lower_bound_x");
-  lower_bound_y_ = declare_parameter<float>("lower_bound_y");
-  filter_target_.UNKNOWN = declare_parameter<bool>("filter_target_label.UNKNOWN");
-  filter_target_.CAR = declare_parameter<bool>("filter_target_label.CAR");
-  filter_target_.TRUCK = declare_parameter<bool>("filter_target_label.TRUCK");
-  filter_target_.BUS = declare_parameter<bool>("filter_target_label.BUS");
-  filter_target_.TRAILER = declare_parameter<bool>("filter_target_label.TRAILER");
-  filter_target_.MOTORCYCLE = declare_parameter<bool>("filter_target_label.MOTORCYCLE");
-  filter_target_.BICYCLE = declare_parameter<bool>("filter_target_label.BICYCLE");
-  filter_target_.PEDESTRIAN = declare_parameter<bool>("filter_target_label.PEDESTRIAN");
-
   // Set publisher/subscriber
   object_sub_ = this->create_subscription<autoware_perception_msgs::msg::DetectedObjects>(
     "input/object", rclcpp::QoS{1}, std::bind(&ObjectPositionFilterNode::objectCallback, this, _1));
@@ -58,12 +74,7 @@ void ObjectPositionFilterNode::objectCallback(
   output_object_msg.header = input_msg->header;
 
   for (const auto & object : input_msg->objects) {
-    const auto & label = object.classification.front().label;
-    if (filter_target_.isTarget(label)) {
-      if (isObjectInBounds(object)) {
-        output_object_msg.objects.emplace_back(object);
-      }
-    } else {
+    if (position_filter_.isPassing(object)) {
       output_object_msg.objects.emplace_back(object);
     }
   }
@@ -72,7 +83,7 @@ void ObjectPositionFilterNode::objectCallback(
   published_time_publisher_->publish_if_subscribed(object_pub_, output_object_msg.header.stamp);
 }
 
-bool ObjectPositionFilterNode::isObjectInBounds(
+bool ObjectPositionFilter::isObjectInBounds(
   const autoware_perception_msgs::msg::DetectedObject & object) const
 {
   const auto & position = object.kinematics.pose_with_covariance.pose.position;
@@ -80,9 +91,30 @@ bool ObjectPositionFilterNode::isObjectInBounds(
          position.y > lower_bound_y_ && position.y < upper_bound_y_;
 }
 
+void ObjectPositionFilterPlugin::init(
+  rclcpp::Node & node, [[maybe_unused]] tf2_ros::Buffer & tf_buffer)
+{
+  position_filter_ = std::make_unique<ObjectPositionFilter>(node, get_filter_name() + ".");
+}
+
+bool ObjectPositionFilterPlugin::filter(autoware_perception_msgs::msg::DetectedObjects & objects)
+{
+  auto & object_array = objects.objects;
+  object_array.erase(
+    std::remove_if(
+      object_array.begin(), object_array.end(),
+      [this](const auto & object) { return !position_filter_->isPassing(object); }),
+    object_array.end());
+  return true;
+}
+
 }  // namespace position_filter
 }  // namespace autoware::detected_object_validation
 
+#include <pluginlib/class_list_macros.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 RCLCPP_COMPONENTS_REGISTER_NODE(
   autoware::detected_object_validation::position_filter::ObjectPositionFilterNode)
+PLUGINLIB_EXPORT_CLASS(
+  autoware::detected_object_validation::position_filter::ObjectPositionFilterPlugin,
+  autoware::detected_object_validation::ObjectFilterPluginInterface)
@@ -15,6 +15,7 @@
 #ifndef POSITION_FILTER__POSITION_FILTER_HPP_
 #define POSITION_FILTER__POSITION_FILTER_HPP_
 
+#include "autoware/detected_object_validation/object_filter_pipeline/plugin_interface.hpp"
 #include "autoware/detected_object_validation/utils/utils.hpp"
 #include "autoware/universe_utils/geometry/geometry.hpp"
 #include "autoware/universe_utils/ros/published_time_publisher.hpp"
@@ -35,6 +36,23 @@ namespace autoware::detected_object_validation
 namespace position_filter
 {
 
+class ObjectPositionFilter
+{
+public:
+  // declares the parameters with the prefix, which is empty for the standalone node
+  ObjectPositionFilter(rclcpp::Node & node, const std::string & prefix);
+
+  bool isPassing(const autoware_perception_msgs::msg::DetectedObject & object) const;
+
+private:
+  float upper_bound_x_;
+  float upper_bound_y_;
+  float lower_bound_x_;
+  float lower_bound_y_;
+  utils::FilterTargetLabel filter_target_;
+  bool isObjectInBounds(const autoware_perception_msgs::msg::DetectedObject & object) const;
+};
+
 class ObjectPositionFilterNode : public rclcpp::Node
 {
 public:
@@ -49,16 +67,22 @@ private:
   tf2_ros::Buffer tf_buffer_;
   tf2_ros::TransformListener tf_listener_;
 
-  float upper_bound_x_;
-  float upper_bound_y_;
-  float lower_bound_x_;
-  float lower_bound_y_;
-  utils::FilterTargetLabel filter_target_;
-  bool isObjectInBounds(const autoware_perception_msgs::msg::DetectedObject & object) const;
+  ObjectPositionFilter position_filter_;
 
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
 };
 
+class ObjectPositionFilterPlugin : public ObjectFilterPluginInterface
+{
+public:
+  void init(rclcpp::Node & node, tf2_ros::Buffer & tf_buffer) override;
+  bool filter(autoware_perception_msgs::msg::DetectedObjects & objects) override;
+  std::string get_filter_name() const override { return "position_filter"; }
+
+private:
+  std::unique_ptr<ObjectPositionFilter> position_filter_;
+};
+
 }  // namespace position_filter
 }  // namespace autoware::detected_object_validation
 
@@ -19,9 +19,11 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
 #include <vector>
 
 using autoware::detected_object_validation::position_filter::ObjectPositionFilterNode;
+using autoware::detected_object_validation::position_filter::ObjectPositionFilterPlugin;
 using autoware_perception_msgs::msg::DetectedObject;
 using autoware_perception_msgs::msg::DetectedObjects;
 using autoware_perception_msgs::msg::ObjectClassification;
@@ -124,3 +126,40 @@ TEST(DetectedObjectValidationTest, testObjectPositionFilterSeveralObjects)
   EXPECT_EQ(latest_msg.objects.size(), 2);
   rclcpp::shutdown();
 }
+
+TEST(DetectedObjectValidationTest, testObjectPositionFilterPluginInPlace)
+{
+  rclcpp::init(0, nullptr);
+  auto node_options = rclcpp::NodeOptions{};
+  const auto detected_object_validation_dir =
+    ament_index_cpp::get_package_share_directory("autoware_detected_object_validation");
+  node_options.arguments(
+    {"--ros-args", "--params-file",
+     detected_object_validation_dir + "/config/object_filter_pipeline.param.yaml"});
+  auto node = std::make_shared<rclcpp::Node>("object_filter_pipeline_test_node", node_options);
+  tf2_ros::Buffer tf_buffer(node->get_clock());
+  ObjectPositionFilterPlugin plugin;
+  plugin.init(*node, tf_buffer);
+
+  // the objects inside, outside and inside the bounds, and a car outside, which is not a target
+  DetectedObjects msg;
+  msg.header.frame_id = "base_link";
+  for (const auto & [x, label] : std::vector<std::pair<double, uint8_t>>{
+         {10.0, ObjectClassification::UNKNOWN},
+         {110.0, ObjectClassification::UNKNOWN},
+         {20.0, ObjectClassification::UNKNOWN},
+         {110.0, ObjectClassification::CAR}}) {
+    DetectedObject object;
+    object.kinematics.pose_with_covariance.pose.position.x = x;
+    object.classification.resize(1);
+    object.classification[0].label = label;
+    msg.objects.push_back(object);
+  }
+
+  EXPECT_TRUE(plugin.filter(msg));
+  ASSERT_EQ(msg.objects.size(), 3);
+  EXPECT_DOUBLE_EQ(msg.objects[0].kinematics.pose_with_covariance.pose.position.x, 10.0);
+  EXPECT_DOUBLE_EQ(msg.objects[1].kinematics.pose_with_covariance.pose.position.x, 20.0);
+  EXPECT_EQ(msg.objects[2].classification[0].label, ObjectClassification::CAR);
+  rclcpp::shutdown();
+}
@@ -0,0 +1,108 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/detected_object_validation/utils/point_grid_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::detected_object_validation::utils::PointGridIndex;
+
+namespace
+{
+struct Point
+{
+  float x;
+  float y;
+};
+
+std::vector<uint32_t> getPointsInArea(
+  const PointGridIndex & grid_index, double min_x, double min_y, double max_x, double max_y)
+{
+  std::vector<uint32_t> indices;
+  grid_index.forEachPointInArea(
+    min_x, min_y, max_x, max_y, [&](uint32_t index) { indices.push_back(index); });
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+}  // namespace
+
+TEST(PointGridIndexTest, EmptyCloud)
+{
+  PointGridIndex grid_index;
+  grid_index.build(std::vector<Point>{}, 1.0);
+  EXPECT_TRUE(grid_index.empty());
+  EXPECT_TRUE(getPointsInArea(grid_index, -10.0, -10.0, 10.0, 10.0).empty());
+}
+
+TEST(PointGridIndexTest, SkipNonFinitePoints)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const std::vector<Point> points{{nan, 0.0f}, {1.0f, 2.0f}, {0.0f, nan}};
+  PointGridIndex grid_index;
+  grid_index.build(points, 1.0);
+  EXPECT_EQ(getPointsInArea(grid_index, -10.0, -10.0, 10.0, 10.0), std::vector<uint32_t>{1});
+  EXPECT_TRUE(getPointsInArea(grid_index, nan, nan, nan, nan).empty());
+}
+
+TEST(PointGridIndexTest, VisitAllPointsInArea)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+  std::vector<Point> points(5000);
+  for (auto & p : points) {
+    p = {coordinate(engine), coordinate(engine)};
+  }
+
+  PointGridIndex grid_index;
+  // the second build reuses the buffers of the first one
+  grid_index.build(std::vector<Point>(points.begin(), points.begin() + 100), 0.5);
+  grid_index.build(points, 1.5);
+
+  std::uniform_real_distribution<double> size(0.0, 10.0);
+  std::uniform_real_distribution<double> center(-60.0, 60.0);
+  for (int i = 0; i < 200; ++i) {
+    const double min_x = center(engine);
+    const double min_y = center(engine);
+    const double max_x = min_x + size(engine);
+    const double max_y = min_y + size(engine);
+    const auto visited = getPointsInArea(grid_index, min_x, min_y, max_x, max_y);
+    // no point is visited twice
+    EXPECT_TRUE(std::adjacent_find(visited.begin(), visited.end()) == visited.end());
+    for (uint32_t j = 0; j < points.size(); ++j) {
+      const auto & p = points[j];
+      if (p.x >= min_x && p.x <= max_x && p.y >= min_y && p.y <= max_y) {
+        EXPECT_TRUE(std::binary_search(visited.begin(), visited.end(), j));
+      }
+    }
+  }
+}
+
+TEST(PointGridIndexTest, EnlargeCellsForSparseCloud)
+{
+  // far points which would need far too many cells of the requested size
+  const std::vector<Point> points{{-1.0e6f, -1.0e6f}, {0.0f, 0.0f}, {1.0e6f, 1.0e6f}};
+  PointGridIndex grid_index;
+  grid_index.build(points, 0.1);
+  EXPECT_EQ(getPointsInArea(grid_index, -1.0, -1.0, 1.0, 1.0), std::vector<uint32_t>{1});
+  EXPECT_EQ(
+    getPointsInArea(grid_index, -2.0e6, -2.0e6, 2.0e6, 2.0e6), (std::vector<uint32_t>{0, 1, 2}));
+}
@@ -173,6 +173,10 @@ void DetectionByTracker::onObjects(
   debugger_->publishInitialObjects(*input_msg);
   debugger_->publishTrackedObjects(tracked_objects);
 
+  // the clusters of the initial objects are converted and divided on demand for this frame
+  cluster_hierarchies_.clear();
+  cluster_hierarchies_.resize(input_msg->feature_objects.size());
+
   // merge over segmented objects
   tier4_perception_msgs::msg::DetectedObjectsWithFeature merged_objects;
   autoware_perception_msgs::msg::DetectedObjects no_found_tracked_objects;
@@ -223,7 +227,8 @@ void DetectionByTracker::divideUnderSegmentedObjects(
       highest_score_divided_object = std::nullopt;
     float highest_score = 0.0;
 
-    for (const auto & initial_object : in_cluster_objects.feature_objects) {
+    for (size_t i = 0; i < in_cluster_objects.feature_objects.size(); ++i) {
+      const auto & initial_object = in_cluster_objects.feature_objects[i];
       // search near object
       const float distance = autoware::universe_utils::calcDistance2d(
         tracked_object.kinematics.pose_with_covariance.pose,
@@ -243,8 +248,8 @@ void DetectionByTracker::divideUnderSegmentedObjects(
       }
       // optimize clustering
       tier4_perception_msgs::msg::DetectedObjectWithFeature divided_object;
-      float score = optimizeUnderSegmentedObject(
-        tracked_object, initial_object.feature.cluster, divided_object);
+      float score =
+        optimizeUnderSegmentedObject(tracked_object, in_cluster_objects, i, divided_object);
       if (score < min_score_threshold) {
         continue;
       }
@@ -262,39 +267,78 @@ void DetectionByTracker::divideUnderSegmentedObjects(
   }
 }
 
-float DetectionByTracker::optimizeUnderSegmentedObject(
-  const autoware_perception_msgs::msg::DetectedObject & target_object,
-  const sensor_msgs::msg::PointCloud2 & under_segmented_cluster,
-  tier4_perception_msgs::msg::DetectedObjectWithFeature & output)
+const pcl::PointCloud<pcl::PointXYZ> & DetectionByTracker::getCluster(
+  const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+  const size_t object_index)
+{
+  auto & cluster_hierarchy = cluster_hierarchies_.at(object_index);
+  if (!cluster_hierarchy.cluster) {
+    cluster_hierarchy.cluster = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+    pcl::fromROSMsg(
+      in_cluster_objects.feature_objects.at(object_index).feature.cluster,
+      *cluster_hierarchy.cluster);
+  }
+  return *cluster_hierarchy.cluster;
+}
+
+const std::vector<pcl::PointCloud<pcl::PointXYZ>> & DetectionByTracker::getDividedClusters(
+  const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+  const size_t object_index, const size_t level)
 {
   constexpr float iter_rate = 0.8;
-  constexpr int iter_max_count = 5;
   constexpr float initial_cluster_range = 0.7;
-  float cluster_range = initial_cluster_range;
   constexpr float initial_voxel_size = initial_cluster_range / 2.0f;
-  float voxel_size = initial_voxel_size;
 
-  const auto & label = target_object.classification.front().label;
+  getCluster(in_cluster_objects, object_index);
+  auto & cluster_hierarchy = cluster_hierarchies_.at(object_index);
+  auto & divided_clusters = cluster_hierarchy.divided_clusters;
+  if (level < divided_clusters.size()) {
+    return divided_clusters.at(level);
+  }
 
   // initialize clustering parameters
   autoware::euclidean_cluster::VoxelGridBasedEuclideanCluster cluster(
     false, 4, 10000, initial_cluster_range, initial_voxel_size, 0);
 
-  // convert to pcl
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_cluster(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(under_segmented_cluster, *pcl_cluster);
+  // the parameters of a level are those of the previous level scaled by the iteration rate
+  float cluster_range = initial_cluster_range;
+  float voxel_size = initial_voxel_size;
+  for (size_t i = 0; i < divided_clusters.size(); ++i) {
+    cluster_range *= iter_rate;
+    voxel_size *= iter_rate;
+  }
+  while (divided_clusters.size() <= level) {
+    // divide under segmented cluster
+    divided_clusters.emplace_back();
+    cluster.setTolerance(cluster_range);
+    cluster.setVoxelLeafSize(voxel_size);
+    cluster.cluster(cluster_hierarchy.cluster, divided_clusters.back());
+    cluster_range *= iter_rate;
+    voxel_size *= iter_rate;
+  }
+  return divided_clusters.at(level);
+}
+
+float DetectionByTracker::optimizeUnderSegmentedObject(
+  const autoware_perception_msgs::msg::DetectedObject & target_object,
+  const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+  const size_t under_segmented_object_index,
+  tier4_perception_msgs::msg::DetectedObjectWithFeature & output)
+{
+  constexpr int iter_max_count = 5;
+
+  const auto & label = target_object.classification.front().label;
+  const auto & under_segmented_cluster =
+    in_cluster_objects.feature_objects.at(under_segmented_object_index).feature.cluster;
 
   // iterate to find best fit divided object
   float highest_iou = 0.0;
   tier4_perception_msgs::msg::DetectedObjectWithFeature highest_iou_object;
   boost::optional<geometry_msgs::msg::Pose> ref_pose = boost::none;
-  for (int iter_count = 0; iter_count < iter_max_count;
-       ++iter_count, cluster_range *= iter_rate, voxel_size *= iter_rate) {
-    // divide under segmented cluster
-    std::vector<pcl::PointCloud<pcl::PointXYZ>> divided_clusters;
-    cluster.setTolerance(cluster_range);
-    cluster.setVoxelLeafSize(voxel_size);
-    cluster.cluster(pcl_cluster, divided_clusters);
+  for (int iter_count = 0; iter_count < iter_max_count; ++iter_count) {
+    // divided clusters of the under segmented cluster, shared with the other trackers
+    const auto & divided_clusters =
+      getDividedClusters(in_cluster_objects, under_segmented_object_index, iter_count);
 
     // find highest iou object in divided clusters
     float highest_iou_in_current_iter = 0.0f;
@@ -361,7 +405,8 @@ void DetectionByTracker::mergeOverSegmentedObjects(
     extended_tracked_object.shape = extendShape(tracked_object.shape, /*scale*/ 1.1);
 
     pcl::PointCloud<pcl::PointXYZ> pcl_merged_cluster;
-    for (const auto & initial_object : in_cluster_objects.feature_objects) {
+    for (size_t i = 0; i < in_cluster_objects.feature_objects.size(); ++i) {
+      const auto & initial_object = in_cluster_objects.feature_objects[i];
       const float distance = autoware::universe_utils::calcDistance2d(
         tracked_object.kinematics.pose_with_covariance.pose,
         initial_object.object.kinematics.pose_with_covariance.pose);
@@ -376,9 +421,7 @@ void DetectionByTracker::mergeOverSegmentedObjects(
       if (precision < precision_threshold) {
         continue;
       }
-      pcl::PointCloud<pcl::PointXYZ> pcl_cluster;
-      pcl::fromROSMsg(initial_object.feature.cluster, pcl_cluster);
-      pcl_merged_cluster += pcl_cluster;
+      pcl_merged_cluster += getCluster(in_cluster_objects, i);
     }
 
     if (pcl_merged_cluster.points.empty()) {  // if clusters aren't found
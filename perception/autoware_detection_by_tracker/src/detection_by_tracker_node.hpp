@@ -78,8 +78,27 @@ private:
 
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
 
+  /**
+   * @brief cluster of an initial object, and its divided clusters at each level of the clustering
+   * parameters, computed at most once per frame and shared by all the trackers
+   */
+  struct ClusterHierarchy
+  {
+    pcl::PointCloud<pcl::PointXYZ>::Ptr cluster;
+    std::vector<std::vector<pcl::PointCloud<pcl::PointXYZ>>> divided_clusters;
+  };
+  std::vector<ClusterHierarchy> cluster_hierarchies_;
+
   void setMaxSearchRange();
 
+  const pcl::PointCloud<pcl::PointXYZ> & getCluster(
+    const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+    const size_t object_index);
+
+  const std::vector<pcl::PointCloud<pcl::PointXYZ>> & getDividedClusters(
+    const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+    const size_t object_index, const size_t level);
+
   void onObjects(
     const tier4_perception_msgs::msg::DetectedObjectsWithFeature::ConstSharedPtr input_msg);
 
@@ -91,7 +110,8 @@ private:
 
   float optimizeUnderSegmentedObject(
     const autoware_perception_msgs::msg::DetectedObject & target_object,
-    const sensor_msgs::msg::PointCloud2 & under_segmented_cluster,
+    const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+    const size_t under_segmented_object_index,
     tier4_perception_msgs::msg::DetectedObjectWithFeature & output);
 
   void mergeOverSegmentedObjects(
@@ -43,6 +43,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <sensor_msgs/msg/point_cloud2.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -82,6 +83,10 @@ ElevationMapLoaderNode::ElevationMapLoaderNode(const rclcpp::NodeOptions & optio
 
   lane_filter_.use_lane_filter_ = use_lane_filter;
   lane_filter_.lane_margin_ = this->declare_parameter("lane_margin", 0.0);
+  use_tiled_elevation_map_ = this->declare_parameter("use_tiled_elevation_map", false);
+  if (use_tiled_elevation_map_ && !use_sequential_load) {
+    throw std::runtime_error("use_tiled_elevation_map requires use_sequential_load.");
+  }
 
   rclcpp::QoS durable_qos{1};
   durable_qos.transient_local();
@@ -179,6 +184,21 @@ void ElevationMapLoaderNode::publish()
 
 void ElevationMapLoaderNode::timerCallback()
 {
+  if (use_tiled_elevation_map_) {
+    if (
+      is_map_metadata_received_ && !is_elevation_map_tiles_created_ &&
+      data_manager_.isTileInputInitialized()) {
+      createElevationMapTiles();
+      // flag to make createElevationMapTiles() called only once.
+      is_elevation_map_tiles_created_ = true;
+      using std::placeholders::_1;
+      using std::placeholders::_2;
+      srv_elevation_submap_ = this->create_service<grid_map_msgs::srv::GetGridMap>(
+        "service/get_elevation_submap",
+        std::bind(&ElevationMapLoaderNode::onGetElevationSubmap, this, _1, _2));
+    }
+    return;
+  }
   if (!is_map_received_ && is_map_metadata_received_) {
     ElevationMapLoaderNode::receiveMap();
     // flag to make receiveMap() called only once.
@@ -235,6 +255,10 @@ void ElevationMapLoaderNode::onPointCloudMapMetaData(
     }
     for (const auto & pointcloud_map_cell_metadata : pointcloud_map_metadata.metadata_list) {
       data_manager_.pointcloud_map_ids_.push_back(pointcloud_map_cell_metadata.cell_id);
+      const auto & metadata = pointcloud_map_cell_metadata.metadata;
+      elevation_map_tiles_.push_back(
+        {pointcloud_map_cell_metadata.cell_id, metadata.min_x, metadata.min_y, metadata.max_x,
+         metadata.max_y});
     }
   }
   is_map_metadata_received_ = true;
@@ -257,37 +281,16 @@ void ElevationMapLoaderNode::onVectorMap(
 void ElevationMapLoaderNode::receiveMap()
 {
   sensor_msgs::msg::PointCloud2 pointcloud_map;
-  // create a loading request with mode = 1
-  auto request = std::make_shared<autoware_map_msgs::srv::GetSelectedPointCloudMap::Request>();
-  if (!pcd_loader_client_->service_is_ready()) {
-    RCLCPP_DEBUG_THROTTLE(
-      this->get_logger(), *get_clock(), 5000,
-      "Waiting for pcd map loader service. Check if the enable_selected_load in "
-      "pointcloud_map_loader is set `true`.");
-  }
-
   // request PCD maps in batches of sequential_map_load_num
   for (unsigned int map_id_counter = 0; map_id_counter < data_manager_.pointcloud_map_ids_.size();
        map_id_counter += sequential_map_load_num_) {
-    // get ids to request
-    request->cell_ids = getRequestIDs(map_id_counter);
-
-    // send a request to map_loader
-    RCLCPP_DEBUG_THROTTLE(this->get_logger(), *get_clock(), 5000, "send a request to map_loader");
-    auto result{pcd_loader_client_->async_send_request(
-      request,
-      [](rclcpp::Client<autoware_map_msgs::srv::GetSelectedPointCloudMap>::SharedFuture) {})};
-    std::future_status status = result.wait_for(std::chrono::seconds(0));
-    while (status != std::future_status::ready) {
-      RCLCPP_DEBUG_THROTTLE(this->get_logger(), *get_clock(), 5000, "waiting response");
-      if (!rclcpp::ok()) {
-        return;
-      }
-      status = result.wait_for(std::chrono::seconds(1));
+    const auto new_pointcloud_with_ids = requestPointCloudMapCells(getRequestIDs(map_id_counter));
+    if (!new_pointcloud_with_ids) {
+      return;
     }
 
     // concatenate maps
-    concatenatePointCloudMaps(pointcloud_map, result.get()->new_pointcloud_with_ids);
+    concatenatePointCloudMaps(pointcloud_map, *new_pointcloud_with_ids);
   }
   RCLCPP_DEBUG(this->get_logger(), "finish receiving");
   pcl::PointCloud<pcl::PointXYZ> map_pcl;
@@ -295,6 +298,35 @@ void ElevationMapLoaderNode::receiveMap()
   data_manager_.map_pcl_ptr_ = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_pcl);
 }
 
+std::optional<std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID>>
+ElevationMapLoaderNode::requestPointCloudMapCells(const std::vector<std::string> & cell_ids)
+{
+  // create a loading request with mode = 1
+  auto request = std::make_shared<autoware_map_msgs::srv::GetSelectedPointCloudMap::Request>();
+  if (!pcd_loader_client_->service_is_ready()) {
+    RCLCPP_DEBUG_THROTTLE(
+      this->get_logger(), *get_clock(), 5000,
+      "Waiting for pcd map loader service. Check if the enable_selected_load in "
+      "pointcloud_map_loader is set `true`.");
+  }
+  request->cell_ids = cell_ids;
+
+  // send a request to map_loader
+  RCLCPP_DEBUG_THROTTLE(this->get_logger(), *get_clock(), 5000, "send a request to map_loader");
+  auto result{pcd_loader_client_->async_send_request(
+    request,
+    [](rclcpp::Client<autoware_map_msgs::srv::GetSelectedPointCloudMap>::SharedFuture) {})};
+  std::future_status status = result.wait_for(std::chrono::seconds(0));
+  while (status != std::future_status::ready) {
+    RCLCPP_DEBUG_THROTTLE(this->get_logger(), *get_clock(), 5000, "waiting response");
+    if (!rclcpp::ok()) {
+      return std::nullopt;
+    }
+    status = result.wait_for(std::chrono::seconds(1));
+  }
+  return result.get()->new_pointcloud_with_ids;
+}
+
 void ElevationMapLoaderNode::concatenatePointCloudMaps(
   sensor_msgs::msg::PointCloud2 & pointcloud_map,
   const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & new_pointcloud_with_ids)
@@ -339,7 +371,7 @@ void ElevationMapLoaderNode::createElevationMap()
     elevation_map_ = grid_map_pcl_loader->getGridMap();
   }
   if (use_inpaint_) {
-    inpaintElevationMap(inpaint_radius_);
+    inpaintElevationMap(elevation_map_, inpaint_radius_);
   }
   saveElevationMap();
 }
@@ -355,16 +387,17 @@ void ElevationMapLoaderNode::createElevationMapFromPointcloud(
     start, "Finish creating elevation map. Total time: ", this->get_logger());
 }
 
-void ElevationMapLoaderNode::inpaintElevationMap(const float radius)
+void ElevationMapLoaderNode::inpaintElevationMap(
+  grid_map::GridMap & elevation_map, const float radius)
 {
   // Convert elevation layer to OpenCV image to fill in holes.
   // Get the inpaint mask (nonzero pixels indicate where values need to be filled in).
   namespace bg = boost::geometry;
   using autoware::universe_utils::Point2d;
 
-  elevation_map_.add("inpaint_mask", 0.0);
+  elevation_map.add("inpaint_mask", 0.0);
 
-  elevation_map_.setBasicLayers(std::vector<std::string>());
+  elevation_map.setBasicLayers(std::vector<std::string>());
   if (lane_filter_.use_lane_filter_) {
     for (const auto & lanelet : lane_filter_.road_lanelets_) {
       auto lane_polygon = lanelet.polygon2d().basicPolygon();
@@ -386,37 +419,37 @@ void ElevationMapLoaderNode::inpaintElevationMap(const float radius)
       for (const auto & p : lane_polygon) {
         polygon.addVertex(grid_map::Position(p[0], p[1]));
       }
-      for (autoware::grid_map_utils::PolygonIterator iterator(elevation_map_, polygon);
+      for (autoware::grid_map_utils::PolygonIterator iterator(elevation_map, polygon);
            !iterator.isPastEnd(); ++iterator) {
-        if (!elevation_map_.isValid(*iterator, layer_name_)) {
-          elevation_map_.at("inpaint_mask", *iterator) = 1.0;
+        if (!elevation_map.isValid(*iterator, layer_name_)) {
+          elevation_map.at("inpaint_mask", *iterator) = 1.0;
         }
       }
     }
   } else {
-    for (grid_map::GridMapIterator iterator(elevation_map_); !iterator.isPastEnd(); ++iterator) {
-      if (!elevation_map_.isValid(*iterator, layer_name_)) {
-        elevation_map_.at("inpaint_mask", *iterator) = 1.0;
+    for (grid_map::GridMapIterator iterator(elevation_map); !iterator.isPastEnd(); ++iterator) {
+      if (!elevation_map.isValid(*iterator, layer_name_)) {
+        elevation_map.at("inpaint_mask", *iterator) = 1.0;
       }
     }
   }
   cv::Mat original_image;
   cv::Mat mask;
   cv::Mat filled_image;
-  const float min_value = elevation_map_.get(layer_name_).minCoeffOfFinites();
-  const float max_value = elevation_map_.get(layer_name_).maxCoeffOfFinites();
+  const float min_value = elevation_map.get(layer_name_).minCoeffOfFinites();
+  const float max_value = elevation_map.get(layer_name_).maxCoeffOfFinites();
 
   grid_map::GridMapCvConverter::toImage<unsigned char, 3>(
-    elevation_map_, layer_name_, CV_8UC3, min_value, max_value, original_image);
+    elevation_map, layer_name_, CV_8UC3, min_value, max_value, original_image);
   grid_map::GridMapCvConverter::toImage<unsigned char, 1>(
-    elevation_map_, "inpaint_mask", CV_8UC1, mask);
+    elevation_map, "inpaint_mask", CV_8UC1, mask);
 
-  const float radius_in_pixels = radius / elevation_map_.getResolution();
+  const float radius_in_pixels = radius / elevation_map.getResolution();
   cv::inpaint(original_image, mask, filled_image, radius_in_pixels, cv::INPAINT_NS);
 
   grid_map::GridMapCvConverter::addLayerFromImage<unsigned char, 3>(
-    filled_image, layer_name_, elevation_map_, min_value, max_value);
-  elevation_map_.erase("inpaint_mask");
+    filled_image, layer_name_, elevation_map, min_value, max_value);
+  elevation_map.erase("inpaint_mask");
 }
 
 pcl::PointCloud<pcl::PointXYZ>::Ptr ElevationMapLoaderNode::createPointcloudFromElevationMap()
@@ -449,6 +482,132 @@ void ElevationMapLoaderNode::saveElevationMap()
   RCLCPP_INFO_STREAM(
     this->get_logger(), "Saving elevation map successful: " << std::boolalpha << saving_successful);
 }
+
+std::filesystem::path ElevationMapLoaderNode::getElevationMapTilePath(
+  const std::string & cell_id) const
+{
+  // next to the whole elevation map of the same point cloud map
+  return std::filesystem::path(data_manager_.elevation_map_path_->string() + "_tiles") / cell_id;
+}
+
+void ElevationMapLoaderNode::createElevationMapTiles()
+{
+  // only the point cloud map cells whose tile is not cached yet are requested
+  std::vector<std::string> cell_ids_to_create;
+  for (const auto & tile : elevation_map_tiles_) {
+    if (!std::filesystem::exists(getElevationMapTilePath(tile.cell_id))) {
+      cell_ids_to_create.push_back(tile.cell_id);
+    }
+  }
+  RCLCPP_INFO(
+    this->get_logger(), "Create %lu of %lu elevation map tiles from pointcloud map",
+    cell_ids_to_create.size(), elevation_map_tiles_.size());
+  std::filesystem::create_directories(getElevationMapTilePath("").parent_path());
+
+  for (size_t i = 0; i < cell_ids_to_create.size(); i += sequential_map_load_num_) {
+    const std::vector<std::string> cell_ids(
+      cell_ids_to_create.begin() + i,
+      cell_ids_to_create.begin() + std::min<size_t>(
+                                     i + sequential_map_load_num_, cell_ids_to_create.size()));
+    const auto new_pointcloud_with_ids = requestPointCloudMapCells(cell_ids);
+    if (!new_pointcloud_with_ids) {
+      return;
+    }
+    for (const auto & new_pointcloud_with_id : *new_pointcloud_with_ids) {
+      auto cloud = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+      pcl::fromROSMsg<pcl::PointXYZ>(new_pointcloud_with_id.pointcloud, *cloud);
+      if (cloud->empty()) {
+        continue;
+      }
+      const bool saving_successful = grid_map::GridMapRosConverter::saveToBag(
+        createElevationMapTile(cloud), getElevationMapTilePath(new_pointcloud_with_id.cell_id),
+        "elevation_map");
+      RCLCPP_DEBUG_STREAM(
+        this->get_logger(), "Saving elevation map tile " << new_pointcloud_with_id.cell_id
+                                                         << " successful: " << std::boolalpha
+                                                         << saving_successful);
+    }
+  }
+}
+
+grid_map::GridMap ElevationMapLoaderNode::createElevationMapTile(
+  const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud)
+{
+  auto grid_map_logger = rclcpp::get_logger("grid_map_logger");
+  grid_map_logger.set_level(rclcpp::Logger::Level::Error);
+  grid_map::GridMap elevation_map_tile;
+  {
+    pcl::shared_ptr<grid_map::GridMapPclLoader> grid_map_pcl_loader =
+      pcl::make_shared<grid_map::GridMapPclLoader>(grid_map_logger);
+    grid_map_pcl_loader->loadParameters(param_file_path_);
+    grid_map_pcl_loader->setInputCloud(cloud);
+    createElevationMapFromPointcloud(grid_map_pcl_loader);
+    elevation_map_tile = grid_map_pcl_loader->getGridMap();
+  }
+  if (use_inpaint_) {
+    inpaintElevationMap(elevation_map_tile, inpaint_radius_);
+  }
+  elevation_map_tile.setFrameId(map_frame_);
+  return elevation_map_tile;
+}
+
+void ElevationMapLoaderNode::onGetElevationSubmap(
+  const grid_map_msgs::srv::GetGridMap::Request::SharedPtr request,
+  grid_map_msgs::srv::GetGridMap::Response::SharedPtr response)
+{
+  const double min_x = request->position_x - request->length_x / 2.0;
+  const double max_x = request->position_x + request->length_x / 2.0;
+  const double min_y = request->position_y - request->length_y / 2.0;
+  const double max_y = request->position_y + request->length_y / 2.0;
+
+  // load the tiles overlapping the requested area, and release the others
+  for (const auto & tile : elevation_map_tiles_) {
+    const bool is_overlapped =
+      tile.min_x <= max_x && tile.max_x >= min_x && tile.min_y <= max_y && tile.max_y >= min_y;
+    if (!is_overlapped) {
+      loaded_elevation_map_tiles_.erase(tile.cell_id);
+      continue;
+    }
+    if (loaded_elevation_map_tiles_.count(tile.cell_id) > 0) {
+      continue;
+    }
+    const auto tile_path = getElevationMapTilePath(tile.cell_id);
+    grid_map::GridMap elevation_map_tile;
+    try {
+      if (
+        std::filesystem::exists(tile_path) &&
+        grid_map::GridMapRosConverter::loadFromBag(
+          tile_path, "elevation_map", elevation_map_tile) &&
+        elevation_map_tile.exists(layer_name_)) {
+        loaded_elevation_map_tiles_.emplace(tile.cell_id, std::move(elevation_map_tile));
+      }
+    } catch (const std::runtime_error & e) {
+      RCLCPP_ERROR(this->get_logger(), e.what());
+    }
+  }
+
+  // fill the submap with the tiles that contain each cell
+  grid_map::GridMap submap;
+  submap.setFrameId(map_frame_);
+  if (!loaded_elevation_map_tiles_.empty()) {
+    submap.setGeometry(
+      grid_map::Length(request->length_x, request->length_y),
+      loaded_elevation_map_tiles_.begin()->second.getResolution(),
+      grid_map::Position(request->position_x, request->position_y));
+    submap.add(layer_name_);
+    for (grid_map::GridMapIterator iterator(submap); !iterator.isPastEnd(); ++iterator) {
+      grid_map::Position position;
+      submap.getPosition(*iterator, position);
+      for (const auto & [cell_id, elevation_map_tile] : loaded_elevation_map_tiles_) {
+        if (elevation_map_tile.isInside(position)) {
+          submap.at(layer_name_, *iterator) = elevation_map_tile.atPosition(layer_name_, position);
+          break;
+        }
+      }
+    }
+  }
+  response->map = *grid_map::GridMapRosConverter::toMessage(submap);
+}
 }  // namespace autoware::elevation_map_loader
 
 #include <rclcpp_components/register_node_macro.hpp>
@@ -25,8 +25,10 @@
 
 #include "tier4_external_api_msgs/msg/map_hash.hpp"
 #include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+#include <autoware_map_msgs/msg/point_cloud_map_cell_with_id.hpp>
 #include <autoware_map_msgs/msg/point_cloud_map_meta_data.hpp>
 #include <autoware_map_msgs/srv/get_selected_point_cloud_map.hpp>
+#include <grid_map_msgs/srv/get_grid_map.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
 #include <lanelet2_core/LaneletMap.h>
@@ -34,7 +36,9 @@
 #include <pcl/point_types.h>
 
 #include <filesystem>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -45,6 +49,11 @@ class DataManager
 {
 public:
   DataManager() = default;
+  bool isTileInputInitialized() const
+  {
+    return static_cast<bool>(elevation_map_path_) &&
+           (!use_lane_filter_ || static_cast<bool>(lanelet_map_ptr_));
+  }
   bool isInitialized() const
   {
     if (use_lane_filter_) {
@@ -61,6 +70,18 @@ public:
   std::vector<std::string> pointcloud_map_ids_;
 };
 
+/**
+ * @brief elevation map tile built from a single point cloud map cell, cached on disk
+ */
+struct ElevationMapTile
+{
+  std::string cell_id;
+  double min_x;
+  double min_y;
+  double max_x;
+  double max_y;
+};
+
 class ElevationMapLoaderNode : public rclcpp::Node
 {
 public:
@@ -75,6 +96,7 @@ private:
   rclcpp::Publisher<grid_map_msgs::msg::GridMap>::SharedPtr pub_elevation_map_;
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr pub_elevation_map_cloud_;
   rclcpp::Client<autoware_map_msgs::srv::GetSelectedPointCloudMap>::SharedPtr pcd_loader_client_;
+  rclcpp::Service<grid_map_msgs::srv::GetGridMap>::SharedPtr srv_elevation_submap_;
   rclcpp::CallbackGroup::SharedPtr group_;
   rclcpp::TimerBase::SharedPtr timer_;
   void onPointcloudMap(const sensor_msgs::msg::PointCloud2::ConstSharedPtr pointcloud_map);
@@ -84,6 +106,8 @@ private:
   void onPointCloudMapMetaData(
     const autoware_map_msgs::msg::PointCloudMapMetaData pointcloud_map_metadata);
   void receiveMap();
+  std::optional<std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID>>
+  requestPointCloudMapCells(const std::vector<std::string> & cell_ids);
   void concatenatePointCloudMaps(
     sensor_msgs::msg::PointCloud2 & pointcloud_map,
     const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & new_pointcloud_with_ids)
@@ -94,10 +118,18 @@ private:
   void setVerbosityLevelToDebugIfFlagSet();
   void createElevationMapFromPointcloud(
     const pcl::shared_ptr<grid_map::GridMapPclLoader> & grid_map_pcl_loader);
-  void inpaintElevationMap(const float radius);
+  void inpaintElevationMap(grid_map::GridMap & elevation_map, const float radius);
   pcl::PointCloud<pcl::PointXYZ>::Ptr createPointcloudFromElevationMap();
   void saveElevationMap();
 
+  // tiled elevation map
+  std::filesystem::path getElevationMapTilePath(const std::string & cell_id) const;
+  void createElevationMapTiles();
+  grid_map::GridMap createElevationMapTile(const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud);
+  void onGetElevationSubmap(
+    const grid_map_msgs::srv::GetGridMap::Request::SharedPtr request,
+    grid_map_msgs::srv::GetGridMap::Response::SharedPtr response);
+
   grid_map::GridMap elevation_map_;
   std::string layer_name_;
   std::string map_frame_;
@@ -111,6 +143,12 @@ private:
   bool is_map_received_ = false;
   bool is_elevation_map_published_ = false;
 
+  bool use_tiled_elevation_map_;
+  bool is_elevation_map_tiles_created_ = false;
+  std::vector<ElevationMapTile> elevation_map_tiles_;
+  // the tiles of the last requested submap, the others are released
+  std::map<std::string, grid_map::GridMap> loaded_elevation_map_tiles_;
+
   DataManager data_manager_;
   struct LaneFilter
   {
@@ -0,0 +1,167 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/euclidean_cluster/euclidean_cluster.hpp"
+#include "autoware/euclidean_cluster/voxel_grid_based_euclidean_cluster.hpp"
+
+#ifdef EUCLIDEAN_CLUSTER_USE_CUDA
+#include "autoware/euclidean_cluster/cuda_euclidean_cluster.hpp"
+
+#include <cuda_runtime_api.h>
+#endif
+
+#include <benchmark/benchmark.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using autoware::euclidean_cluster::EuclideanClusterInterface;
+
+namespace
+{
+// the parameters of the default config
+constexpr float tolerance = 0.7f;
+constexpr float voxel_leaf_size = 0.3f;
+constexpr int min_points_number_per_voxel = 1;
+constexpr int min_cluster_size = 10;
+constexpr int max_cluster_size = 3000;
+constexpr bool use_height = false;
+
+// objects of a fixed seed scattered around the ego, with sparse noise points between them
+pcl::PointCloud<pcl::PointXYZ>::ConstPtr createSyntheticCloud(const size_t num_objects)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> position_distribution(-60.0f, 60.0f);
+  std::uniform_real_distribution<float> size_distribution(0.5f, 5.0f);
+  std::uniform_real_distribution<float> unit_distribution(0.0f, 1.0f);
+
+  auto cloud = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+  for (size_t object = 0; object < num_objects; ++object) {
+    const float center_x = position_distribution(generator);
+    const float center_y = position_distribution(generator);
+    const float length = size_distribution(generator);
+    const float width = size_distribution(generator);
+    const size_t num_points = 50 + static_cast<size_t>(400.0f * unit_distribution(generator));
+    for (size_t i = 0; i < num_points; ++i) {
+      cloud->emplace_back(
+        center_x + length * (unit_distribution(generator) - 0.5f),
+        center_y + width * (unit_distribution(generator) - 0.5f),
+        1.8f * unit_distribution(generator));
+    }
+  }
+  for (size_t i = 0; i < 20 * num_objects; ++i) {
+    cloud->emplace_back(
+      position_distribution(generator), position_distribution(generator),
+      1.8f * unit_distribution(generator));
+  }
+  return cloud;
+}
+
+// the pointcloud given by AUTOWARE_PERCEPTION_BENCHMARK_PCD, which is supposed to have no ground
+// points, or nullptr if not given
+pcl::PointCloud<pcl::PointXYZ>::ConstPtr loadRecordedCloud()
+{
+  const char * pcd_path = std::getenv("AUTOWARE_PERCEPTION_BENCHMARK_PCD");
+  if (!pcd_path) {
+    return nullptr;
+  }
+  auto cloud = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+  pcl::io::loadPCDFile<pcl::PointXYZ>(pcd_path, *cloud);
+  return cloud;
+}
+
+bool hasGpu()
+{
+#ifdef EUCLIDEAN_CLUSTER_USE_CUDA
+  int num_devices = 0;
+  return cudaGetDeviceCount(&num_devices) == cudaSuccess && num_devices > 0;
+#else
+  return false;
+#endif
+}
+
+void run(
+  benchmark::State & state, EuclideanClusterInterface & cluster,
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & input)
+{
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
+  for (auto _ : state) {
+    clusters.clear();
+    cluster.cluster(input, clusters);
+    benchmark::DoNotOptimize(clusters.data());
+  }
+  state.SetItemsProcessed(state.iterations() * input->size());
+  state.counters["clusters"] = clusters.size();
+}
+
+bool registerBenchmarks()
+{
+  using ClusterFactory = std::function<std::unique_ptr<EuclideanClusterInterface>()>;
+  std::vector<std::pair<std::string, ClusterFactory>> clusters{
+    {"EuclideanCluster",
+     []() {
+       return std::make_unique<autoware::euclidean_cluster::EuclideanCluster>(
+         use_height, min_cluster_size, max_cluster_size, tolerance);
+     }},
+    {"VoxelGridBasedEuclideanCluster", []() {
+       return std::make_unique<autoware::euclidean_cluster::VoxelGridBasedEuclideanCluster>(
+         use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
+         min_points_number_per_voxel);
+     }}};
+#ifdef EUCLIDEAN_CLUSTER_USE_CUDA
+  // the GPU clustering is benchmarked only on the machine having a device
+  if (hasGpu()) {
+    clusters.emplace_back("CudaEuclideanCluster", []() {
+      return std::make_unique<autoware::euclidean_cluster::CudaEuclideanCluster>(
+        use_height, min_cluster_size, max_cluster_size, tolerance);
+    });
+    clusters.emplace_back("CudaVoxelGridBasedEuclideanCluster", []() {
+      return std::make_unique<autoware::euclidean_cluster::CudaEuclideanCluster>(
+        use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
+        min_points_number_per_voxel);
+    });
+  }
+#endif
+
+  std::vector<std::pair<std::string, pcl::PointCloud<pcl::PointXYZ>::ConstPtr>> inputs{
+    {"synthetic/50_objects", createSyntheticCloud(50)},
+    {"synthetic/200_objects", createSyntheticCloud(200)}};
+  if (const auto recorded_cloud = loadRecordedCloud()) {
+    inputs.emplace_back("recorded", recorded_cloud);
+  }
+
+  for (const auto & [cluster_name, create_cluster] : clusters) {
+    for (const auto & [input_name, input] : inputs) {
+      benchmark::RegisterBenchmark(
+        ("BM_" + cluster_name + "/" + input_name).c_str(),
+        [create_cluster = create_cluster, input = input](benchmark::State & state) {
+          const auto cluster = create_cluster();
+          run(state, *cluster, input);
+        })
+        ->Unit(benchmark::kMillisecond);
+    }
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool benchmarks_registered = registerBenchmarks();
+}  // namespace
@@ -0,0 +1,65 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+struct ClusterLabelingParameters
+{
+  // the spatial cluster tolerance as a measure in the L2 Euclidean space
+  float tolerance;
+  // use point.z for clustering, only in the point mode
+  bool use_height;
+  // the voxel leaf size of x and y, or 0.0 to cluster the points themselves
+  float voxel_leaf_size;
+  // the minimum number of points for a voxel
+  int min_points_number_per_voxel;
+};
+
+/**
+ * @brief labels the connected components of the points on the GPU
+ *
+ * The elements are the voxel centroids when voxel_leaf_size is positive, or the points otherwise.
+ * The elements are hashed into cells as large as the tolerance, so that the neighbors of an
+ * element are all in the adjacent cells, and the elements closer than the tolerance are merged
+ * with a lock-free union-find.
+ */
+class CudaClusterLabeler
+{
+public:
+  CudaClusterLabeler();
+  ~CudaClusterLabeler();
+
+  /**
+   * @param[in] points x, y and z of each point
+   * @param[out] point_elements element of each point, or -1 if the point is in no element
+   * @param[out] element_roots representative element of the cluster of each element
+   * @return false if a CUDA operation failed
+   */
+  bool label(
+    const std::vector<float> & points, const ClusterLabelingParameters & parameters,
+    std::vector<int32_t> & point_elements, std::vector<int32_t> & element_roots);
+
+private:
+  struct DeviceBuffers;
+  std::unique_ptr<DeviceBuffers> buffers_;
+};
+
+}  // namespace autoware::euclidean_cluster
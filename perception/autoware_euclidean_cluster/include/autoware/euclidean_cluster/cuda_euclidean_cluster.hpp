@@ -0,0 +1,69 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "autoware/euclidean_cluster/cuda_cluster_labeler.hpp"
+#include "autoware/euclidean_cluster/euclidean_cluster_interface.hpp"
+#include "autoware/euclidean_cluster/utils.hpp"
+
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+/**
+ * @brief GPU version of EuclideanCluster, or of VoxelGridBasedEuclideanCluster when a positive
+ * voxel_leaf_size is given
+ */
+class CudaEuclideanCluster : public EuclideanClusterInterface
+{
+public:
+  CudaEuclideanCluster(
+    bool use_height, int min_cluster_size, int max_cluster_size, float tolerance);
+  CudaEuclideanCluster(
+    bool use_height, int min_cluster_size, int max_cluster_size, float tolerance,
+    float voxel_leaf_size, int min_points_number_per_voxel);
+  bool cluster(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) override;
+  bool cluster(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & pointcloud,
+    tier4_perception_msgs::msg::DetectedObjectsWithFeature & clusters) override;
+  void setTolerance(float tolerance) { tolerance_ = tolerance; }
+  void setVoxelLeafSize(float voxel_leaf_size) { voxel_leaf_size_ = voxel_leaf_size; }
+  void setMinPointsNumberPerVoxel(int min_points_number_per_voxel)
+  {
+    min_points_number_per_voxel_ = min_points_number_per_voxel;
+  }
+
+private:
+  /**
+   * @brief get the cluster of each point, or -1 for the points in no valid cluster
+   * @return the number of clusters, or -1 if the GPU labeling failed
+   */
+  int labelPoints(const std::vector<float> & points, std::vector<int32_t> & point_clusters);
+
+  CudaClusterLabeler labeler_;
+  float tolerance_;
+  float voxel_leaf_size_{0.0f};
+  int min_points_number_per_voxel_{1};
+  std::vector<int32_t> point_elements_;
+  std::vector<int32_t> element_roots_;
+};
+
+}  // namespace autoware::euclidean_cluster
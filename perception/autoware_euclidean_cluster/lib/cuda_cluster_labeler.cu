@@ -0,0 +1,360 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/euclidean_cluster/cuda_cluster_labeler.hpp"
+
+#include <cuda_runtime.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system_error.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+namespace
+{
+constexpr int threads_per_block = 256;
+constexpr uint64_t invalid_key = ~0ULL;
+// each cell coordinate is packed in 21 bits of the key
+constexpr int64_t cell_offset = 1 << 20;
+constexpr uint64_t cell_mask = (1ULL << 21) - 1;
+
+unsigned int numBlocks(const int num_threads)
+{
+  return (num_threads + threads_per_block - 1) / threads_per_block;
+}
+
+__host__ __device__ inline uint64_t packCell(const int64_t x, const int64_t y, const int64_t z)
+{
+  return (static_cast<uint64_t>(x + cell_offset) << 42) |
+         (static_cast<uint64_t>(y + cell_offset) << 21) | static_cast<uint64_t>(z + cell_offset);
+}
+
+__device__ inline int64_t unpackCell(const uint64_t key, const int shift)
+{
+  return static_cast<int64_t>((key >> shift) & cell_mask) - cell_offset;
+}
+
+__device__ inline bool isCellInRange(const int64_t x, const int64_t y, const int64_t z)
+{
+  return -cell_offset < x && x < cell_offset && -cell_offset < y && y < cell_offset &&
+         -cell_offset < z && z < cell_offset;
+}
+
+__global__ void computeCellKeysKernel(
+  const float3 * elements, const uint8_t * valid_elements, const int num_elements,
+  const float inverse_cell_size, const bool use_z, uint64_t * keys, int32_t * indices)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_elements) return;
+  indices[i] = i;
+  const float3 p = elements[i];
+  const float x = floorf(p.x * inverse_cell_size);
+  const float y = floorf(p.y * inverse_cell_size);
+  const float z = use_z ? floorf(p.z * inverse_cell_size) : 0.0f;
+  const float limit = static_cast<float>(cell_offset);
+  // also false for NaN and infinity
+  const bool is_finite = fabsf(x) < limit && fabsf(y) < limit && fabsf(z) < limit;
+  if (!is_finite || (valid_elements && !valid_elements[i])) {
+    keys[i] = invalid_key;
+    return;
+  }
+  keys[i] = packCell(static_cast<int64_t>(x), static_cast<int64_t>(y), static_cast<int64_t>(z));
+}
+
+__global__ void markVoxelHeadsKernel(const uint64_t * keys, const int num_points, int32_t * heads)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_points) return;
+  heads[i] = (i == 0 || keys[i] != keys[i - 1]) ? 1 : 0;
+}
+
+// voxel_ids is the inclusive scan of the heads, so that voxel_ids[i] - 1 is the voxel of the point
+__global__ void computeVoxelCentroidsKernel(
+  const float3 * points, const uint64_t * keys, const int32_t * indices, const int32_t * voxel_ids,
+  const int num_points, const int min_points_number_per_voxel, float3 * centroids,
+  uint8_t * valid_voxels)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_points || (i > 0 && keys[i] == keys[i - 1])) return;
+
+  // the points of a voxel are contiguous, and summed in order for a deterministic centroid
+  float sum_x = 0.0f;
+  float sum_y = 0.0f;
+  int count = 0;
+  for (int j = i; j < num_points && keys[j] == keys[i]; ++j) {
+    const float3 p = points[indices[j]];
+    sum_x += p.x;
+    sum_y += p.y;
+    ++count;
+  }
+  const int voxel = voxel_ids[i] - 1;
+  // voxels are pressed to 2d
+  centroids[voxel] = make_float3(sum_x / count, sum_y / count, 0.0f);
+  valid_voxels[voxel] = keys[i] != invalid_key && count >= min_points_number_per_voxel;
+}
+
+__global__ void assignPointVoxelsKernel(
+  const int32_t * indices, const int32_t * voxel_ids, const uint8_t * valid_voxels,
+  const int num_points, int32_t * point_elements)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_points) return;
+  const int32_t voxel = voxel_ids[i] - 1;
+  point_elements[indices[i]] = valid_voxels[voxel] ? voxel : -1;
+}
+
+__global__ void assignPointElementsKernel(
+  const uint64_t * keys, const int32_t * indices, const int num_points, int32_t * point_elements)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_points) return;
+  point_elements[indices[i]] = keys[i] != invalid_key ? indices[i] : -1;
+}
+
+// the parent of an element is never larger than the element, which every update preserves, so
+// that concurrent updates cannot create a cycle
+__device__ int32_t findRoot(int32_t * parents, const int32_t element)
+{
+  int32_t current = parents[element];
+  if (current != element) {
+    int32_t previous = element;
+    int32_t next;
+    // path halving
+    while (current > (next = parents[current])) {
+      parents[previous] = next;
+      previous = current;
+      current = next;
+    }
+  }
+  return current;
+}
+
+__device__ void unite(int32_t * parents, const int32_t a, const int32_t b)
+{
+  int32_t root_a = findRoot(parents, a);
+  int32_t root_b = findRoot(parents, b);
+  while (root_a != root_b) {
+    // the larger root is hooked onto the smaller one
+    if (root_a > root_b) {
+      const int32_t root = root_a;
+      root_a = root_b;
+      root_b = root;
+    }
+    const int32_t previous = atomicCAS(&parents[root_b], root_b, root_a);
+    if (previous == root_b) {
+      break;
+    }
+    // root_b was hooked by another thread meanwhile, so climb from its new parent
+    root_b = previous;
+  }
+}
+
+__global__ void uniteNeighborsKernel(
+  const float3 * elements, const uint64_t * keys, const int32_t * indices, const int num_elements,
+  const float squared_tolerance, const bool use_z, int32_t * parents)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_elements) return;
+  const uint64_t key = keys[i];
+  if (key == invalid_key) return;
+
+  const int32_t element = indices[i];
+  const float3 p = elements[element];
+  const int64_t cell_x = unpackCell(key, 42);
+  const int64_t cell_y = unpackCell(key, 21);
+  const int64_t cell_z = unpackCell(key, 0);
+  const int z_range = use_z ? 1 : 0;
+  for (int dz = -z_range; dz <= z_range; ++dz) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dx = -1; dx <= 1; ++dx) {
+        if (!isCellInRange(cell_x + dx, cell_y + dy, cell_z + dz)) continue;
+        const uint64_t neighbor_key = packCell(cell_x + dx, cell_y + dy, cell_z + dz);
+        // first element of the cell
+        int begin = 0;
+        int end = num_elements;
+        while (begin < end) {
+          const int middle = begin + (end - begin) / 2;
+          if (keys[middle] < neighbor_key) {
+            begin = middle + 1;
+          } else {
+            end = middle;
+          }
+        }
+        for (int j = begin; j < num_elements && keys[j] == neighbor_key; ++j) {
+          const int32_t neighbor = indices[j];
+          // each pair is tested once, by its smaller element
+          if (neighbor <= element) continue;
+          const float3 q = elements[neighbor];
+          const float diff_x = p.x - q.x;
+          const float diff_y = p.y - q.y;
+          const float diff_z = use_z ? p.z - q.z : 0.0f;
+          if (diff_x * diff_x + diff_y * diff_y + diff_z * diff_z <= squared_tolerance) {
+            unite(parents, element, neighbor);
+          }
+        }
+      }
+    }
+  }
+}
+
+__global__ void flattenRootsKernel(const int num_elements, int32_t * parents)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_elements) return;
+  parents[i] = findRoot(parents, i);
+}
+}  // namespace
+
+struct CudaClusterLabeler::DeviceBuffers
+{
+  cudaStream_t stream{nullptr};
+  // reused for the next frames, as device_vector only reallocates to grow
+  thrust::device_vector<float3> points;
+  thrust::device_vector<uint64_t> keys;
+  thrust::device_vector<int32_t> indices;
+  thrust::device_vector<int32_t> voxel_ids;
+  thrust::device_vector<float3> centroids;
+  thrust::device_vector<uint8_t> valid_voxels;
+  thrust::device_vector<int32_t> point_elements;
+  thrust::device_vector<int32_t> parents;
+};
+
+CudaClusterLabeler::CudaClusterLabeler() : buffers_(std::make_unique<DeviceBuffers>())
+{
+  if (cudaStreamCreate(&buffers_->stream) != cudaSuccess) {
+    buffers_->stream = nullptr;
+  }
+}
+
+CudaClusterLabeler::~CudaClusterLabeler()
+{
+  if (buffers_->stream) {
+    cudaStreamDestroy(buffers_->stream);
+  }
+}
+
+bool CudaClusterLabeler::label(
+  const std::vector<float> & points, const ClusterLabelingParameters & parameters,
+  std::vector<int32_t> & point_elements, std::vector<int32_t> & element_roots)
+{
+  const int num_points = static_cast<int>(points.size() / 3);
+  point_elements.clear();
+  element_roots.clear();
+  if (num_points == 0) {
+    return true;
+  }
+
+  auto & b = *buffers_;
+  const auto stream = b.stream;
+  const auto policy = thrust::cuda::par.on(stream);
+  try {
+    b.points.resize(num_points);
+    b.keys.resize(num_points);
+    b.indices.resize(num_points);
+    b.point_elements.resize(num_points);
+    auto * points_d = thrust::raw_pointer_cast(b.points.data());
+    auto * keys_d = thrust::raw_pointer_cast(b.keys.data());
+    auto * indices_d = thrust::raw_pointer_cast(b.indices.data());
+    auto * point_elements_d = thrust::raw_pointer_cast(b.point_elements.data());
+    cudaMemcpyAsync(
+      points_d, points.data(), num_points * sizeof(float3), cudaMemcpyHostToDevice, stream);
+
+    const float3 * elements_d = points_d;
+    const uint8_t * valid_elements_d = nullptr;
+    int num_elements = num_points;
+    bool use_z = parameters.use_height;
+    if (parameters.voxel_leaf_size > 0.0f) {
+      b.voxel_ids.resize(num_points);
+      auto * voxel_ids_d = thrust::raw_pointer_cast(b.voxel_ids.data());
+      computeCellKeysKernel<<<numBlocks(num_points), threads_per_block, 0, stream>>>(
+        points_d, nullptr, num_points, 1.0f / parameters.voxel_leaf_size, false, keys_d,
+        indices_d);
+      thrust::sort_by_key(policy, b.keys.begin(), b.keys.end(), b.indices.begin());
+      markVoxelHeadsKernel<<<numBlocks(num_points), threads_per_block, 0, stream>>>(
+        keys_d, num_points, voxel_ids_d);
+      thrust::inclusive_scan(policy, b.voxel_ids.begin(), b.voxel_ids.end(), b.voxel_ids.begin());
+
+      int32_t num_voxels = 0;
+      cudaMemcpyAsync(
+        &num_voxels, voxel_ids_d + num_points - 1, sizeof(int32_t), cudaMemcpyDeviceToHost, stream);
+      cudaStreamSynchronize(stream);
+      b.centroids.resize(num_voxels);
+      b.valid_voxels.resize(num_voxels);
+      auto * centroids_d = thrust::raw_pointer_cast(b.centroids.data());
+      auto * valid_voxels_d = thrust::raw_pointer_cast(b.valid_voxels.data());
+      computeVoxelCentroidsKernel<<<numBlocks(num_points), threads_per_block, 0, stream>>>(
+        points_d, keys_d, indices_d, voxel_ids_d, num_points,
+        parameters.min_points_number_per_voxel, centroids_d, valid_voxels_d);
+      assignPointVoxelsKernel<<<numBlocks(num_points), threads_per_block, 0, stream>>>(
+        indices_d, voxel_ids_d, valid_voxels_d, num_points, point_elements_d);
+
+      elements_d = centroids_d;
+      valid_elements_d = valid_voxels_d;
+      num_elements = num_voxels;
+      use_z = false;
+    }
+
+    // hash the elements on cells as large as the tolerance, reusing the keys of the points
+    const bool has_tolerance = parameters.tolerance > 0.0f;
+    const float inverse_cell_size = has_tolerance ? 1.0f / parameters.tolerance : 1.0f;
+    computeCellKeysKernel<<<numBlocks(num_elements), threads_per_block, 0, stream>>>(
+      elements_d, valid_elements_d, num_elements, inverse_cell_size, use_z, keys_d, indices_d);
+    thrust::sort_by_key(policy, b.keys.begin(), b.keys.begin() + num_elements, b.indices.begin());
+    if (parameters.voxel_leaf_size <= 0.0f) {
+      assignPointElementsKernel<<<numBlocks(num_points), threads_per_block, 0, stream>>>(
+        keys_d, indices_d, num_points, point_elements_d);
+    }
+
+    b.parents.resize(num_elements);
+    auto * parents_d = thrust::raw_pointer_cast(b.parents.data());
+    thrust::sequence(policy, b.parents.begin(), b.parents.end());
+    if (has_tolerance) {
+      uniteNeighborsKernel<<<numBlocks(num_elements), threads_per_block, 0, stream>>>(
+        elements_d, keys_d, indices_d, num_elements, parameters.tolerance * parameters.tolerance,
+        use_z, parents_d);
+    }
+    flattenRootsKernel<<<numBlocks(num_elements), threads_per_block, 0, stream>>>(
+      num_elements, parents_d);
+
+    point_elements.resize(num_points);
+    element_roots.resize(num_elements);
+    cudaMemcpyAsync(
+      point_elements.data(), point_elements_d, num_points * sizeof(int32_t),
+      cudaMemcpyDeviceToHost, stream);
+    cudaMemcpyAsync(
+      element_roots.data(), parents_d, num_elements * sizeof(int32_t), cudaMemcpyDeviceToHost,
+      stream);
+    cudaStreamSynchronize(stream);
+  } catch (const thrust::system_error &) {
+    point_elements.clear();
+    element_roots.clear();
+    return false;
+  }
+
+  if (cudaGetLastError() != cudaSuccess) {
+    point_elements.clear();
+    element_roots.clear();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace autoware::euclidean_cluster
@@ -0,0 +1,195 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/euclidean_cluster/cuda_euclidean_cluster.hpp"
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+CudaEuclideanCluster::CudaEuclideanCluster(
+  bool use_height, int min_cluster_size, int max_cluster_size, float tolerance)
+: EuclideanClusterInterface(use_height, min_cluster_size, max_cluster_size), tolerance_(tolerance)
+{
+}
+
+CudaEuclideanCluster::CudaEuclideanCluster(
+  bool use_height, int min_cluster_size, int max_cluster_size, float tolerance,
+  float voxel_leaf_size, int min_points_number_per_voxel)
+: EuclideanClusterInterface(use_height, min_cluster_size, max_cluster_size),
+  tolerance_(tolerance),
+  voxel_leaf_size_(voxel_leaf_size),
+  min_points_number_per_voxel_(min_points_number_per_voxel)
+{
+}
+
+int CudaEuclideanCluster::labelPoints(
+  const std::vector<float> & points, std::vector<int32_t> & point_clusters)
+{
+  const ClusterLabelingParameters parameters{
+    tolerance_, use_height_, voxel_leaf_size_, min_points_number_per_voxel_};
+  if (!labeler_.label(points, parameters, point_elements_, element_roots_)) {
+    return -1;
+  }
+
+  // number the clusters in order of their first point, as the CPU versions do not define an order
+  const size_t num_points = point_elements_.size();
+  std::vector<int32_t> root_clusters(element_roots_.size(), -1);
+  std::vector<uint8_t> is_element_counted(element_roots_.size(), 0);
+  std::vector<int> cluster_point_counts;
+  std::vector<int> cluster_element_counts;
+  point_clusters.assign(num_points, -1);
+  for (size_t i = 0; i < num_points; ++i) {
+    const int32_t element = point_elements_[i];
+    if (element < 0) continue;
+    auto & cluster = root_clusters[element_roots_[element]];
+    if (cluster < 0) {
+      cluster = static_cast<int32_t>(cluster_point_counts.size());
+      cluster_point_counts.push_back(0);
+      cluster_element_counts.push_back(0);
+    }
+    point_clusters[i] = cluster;
+    ++cluster_point_counts[cluster];
+    if (!is_element_counted[element]) {
+      is_element_counted[element] = 1;
+      ++cluster_element_counts[cluster];
+    }
+  }
+
+  // same as VoxelGridBasedEuclideanCluster, the number of voxels is also limited by
+  // max_cluster_size
+  std::vector<int32_t> valid_clusters(cluster_point_counts.size(), -1);
+  int num_valid_clusters = 0;
+  for (size_t cluster = 0; cluster < cluster_point_counts.size(); ++cluster) {
+    const int point_count = cluster_point_counts[cluster];
+    if (
+      min_cluster_size_ <= point_count && point_count <= max_cluster_size_ &&
+      cluster_element_counts[cluster] <= max_cluster_size_) {
+      valid_clusters[cluster] = num_valid_clusters++;
+    }
+  }
+  for (auto & cluster : point_clusters) {
+    if (cluster >= 0) {
+      cluster = valid_clusters[cluster];
+    }
+  }
+  return num_valid_clusters;
+}
+
+bool CudaEuclideanCluster::cluster(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  std::vector<float> points;
+  points.reserve(pointcloud->points.size() * 3);
+  for (const auto & point : pointcloud->points) {
+    points.push_back(point.x);
+    points.push_back(point.y);
+    points.push_back(point.z);
+  }
+
+  std::vector<int32_t> point_clusters;
+  const int num_clusters = labelPoints(points, point_clusters);
+  if (num_clusters < 0) {
+    return false;
+  }
+
+  const size_t first_cluster = clusters.size();
+  clusters.resize(first_cluster + num_clusters);
+  for (size_t i = 0; i < point_clusters.size(); ++i) {
+    if (point_clusters[i] >= 0) {
+      clusters[first_cluster + point_clusters[i]].points.push_back(pointcloud->points[i]);
+    }
+  }
+  for (size_t i = first_cluster; i < clusters.size(); ++i) {
+    clusters[i].width = clusters[i].points.size();
+    clusters[i].height = 1;
+    clusters[i].is_dense = false;
+  }
+  return true;
+}
+
+bool CudaEuclideanCluster::cluster(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & pointcloud_msg,
+  tier4_perception_msgs::msg::DetectedObjectsWithFeature & objects)
+{
+  const size_t num_points = pointcloud_msg->width * pointcloud_msg->height;
+  std::vector<float> points;
+  points.reserve(num_points * 3);
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(*pointcloud_msg, "x"),
+       iter_y(*pointcloud_msg, "y"), iter_z(*pointcloud_msg, "z");
+       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    points.push_back(*iter_x);
+    points.push_back(*iter_y);
+    points.push_back(*iter_z);
+  }
+
+  std::vector<int32_t> point_clusters;
+  const int num_clusters = labelPoints(points, point_clusters);
+  if (num_clusters < 0) {
+    return false;
+  }
+
+  // gather the points of each cluster with all of their fields
+  const size_t point_step = pointcloud_msg->point_step;
+  std::vector<size_t> cluster_point_counts(num_clusters, 0);
+  for (const auto cluster : point_clusters) {
+    if (cluster >= 0) {
+      ++cluster_point_counts[cluster];
+    }
+  }
+  std::vector<sensor_msgs::msg::PointCloud2> clusters(num_clusters);
+  for (int i = 0; i < num_clusters; ++i) {
+    auto & cluster = clusters[i];
+    cluster.header = pointcloud_msg->header;
+    cluster.height = 1;
+    cluster.width = cluster_point_counts[i];
+    cluster.fields = pointcloud_msg->fields;
+    cluster.is_bigendian = pointcloud_msg->is_bigendian;
+    cluster.is_dense = pointcloud_msg->is_dense;
+    cluster.point_step = point_step;
+    cluster.row_step = cluster_point_counts[i] * point_step;
+    cluster.data.resize(cluster.row_step);
+  }
+  std::vector<size_t> cluster_data_sizes(num_clusters, 0);
+  for (size_t i = 0; i < point_clusters.size(); ++i) {
+    const int32_t cluster = point_clusters[i];
+    if (cluster < 0) continue;
+    std::memcpy(
+      &clusters[cluster].data[cluster_data_sizes[cluster]], &pointcloud_msg->data[i * point_step],
+      point_step);
+    cluster_data_sizes[cluster] += point_step;
+  }
+
+  for (auto & cluster : clusters) {
+    tier4_perception_msgs::msg::DetectedObjectWithFeature feature_object;
+    feature_object.feature.cluster = std::move(cluster);
+    feature_object.object.kinematics.pose_with_covariance.pose.position =
+      getCentroid(feature_object.feature.cluster);
+    autoware_perception_msgs::msg::ObjectClassification classification;
+    classification.label = autoware_perception_msgs::msg::ObjectClassification::UNKNOWN;
+    classification.probability = 1.0f;
+    feature_object.object.classification.emplace_back(classification);
+    objects.feature_objects.push_back(feature_object);
+  }
+  objects.header = pointcloud_msg->header;
+  return true;
+}
+
+}  // namespace autoware::euclidean_cluster
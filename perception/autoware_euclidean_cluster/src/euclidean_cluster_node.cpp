@@ -16,6 +16,10 @@
 
 #include "autoware/euclidean_cluster/utils.hpp"
 
+#ifdef EUCLIDEAN_CLUSTER_USE_CUDA
+#include "autoware/euclidean_cluster/cuda_euclidean_cluster.hpp"
+#endif
+
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -27,8 +31,19 @@ EuclideanClusterNode::EuclideanClusterNode(const rclcpp::NodeOptions & options)
   const int min_cluster_size = this->declare_parameter("min_cluster_size", 3);
   const int max_cluster_size = this->declare_parameter("max_cluster_size", 200);
   const float tolerance = this->declare_parameter("tolerance", 1.0);
-  cluster_ =
-    std::make_shared<EuclideanCluster>(use_height, min_cluster_size, max_cluster_size, tolerance);
+  const bool use_gpu = this->declare_parameter("use_gpu", false);
+  if (use_gpu) {
+#ifdef EUCLIDEAN_CLUSTER_USE_CUDA
+    cluster_ = std::make_shared<CudaEuclideanCluster>(
+      use_height, min_cluster_size, max_cluster_size, tolerance);
+#else
+    RCLCPP_WARN(get_logger(), "Built without CUDA, clustering on the CPU instead");
+#endif
+  }
+  if (!cluster_) {
+    cluster_ =
+      std::make_shared<EuclideanCluster>(use_height, min_cluster_size, max_cluster_size, tolerance);
+  }
 
   using std::placeholders::_1;
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
@@ -16,6 +16,10 @@
 
 #include "autoware/euclidean_cluster/utils.hpp"
 
+#ifdef EUCLIDEAN_CLUSTER_USE_CUDA
+#include "autoware/euclidean_cluster/cuda_euclidean_cluster.hpp"
+#endif
+
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -30,9 +34,21 @@ VoxelGridBasedEuclideanClusterNode::VoxelGridBasedEuclideanClusterNode(
   const float tolerance = this->declare_parameter("tolerance", 1.0);
   const float voxel_leaf_size = this->declare_parameter("voxel_leaf_size", 0.5);
   const int min_points_number_per_voxel = this->declare_parameter("min_points_number_per_voxel", 3);
-  cluster_ = std::make_shared<VoxelGridBasedEuclideanCluster>(
-    use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
-    min_points_number_per_voxel);
+  const bool use_gpu = this->declare_parameter("use_gpu", false);
+  if (use_gpu) {
+#ifdef EUCLIDEAN_CLUSTER_USE_CUDA
+    cluster_ = std::make_shared<CudaEuclideanCluster>(
+      use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
+      min_points_number_per_voxel);
+#else
+    RCLCPP_WARN(get_logger(), "Built without CUDA, clustering on the CPU instead");
+#endif
+  }
+  if (!cluster_) {
+    cluster_ = std::make_shared<VoxelGridBasedEuclideanCluster>(
+      use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
+      min_points_number_per_voxel);
+  }
 
   using std::placeholders::_1;
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
@@ -0,0 +1,170 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/euclidean_cluster/cuda_euclidean_cluster.hpp"
+#include "autoware/euclidean_cluster/euclidean_cluster.hpp"
+#include "autoware/euclidean_cluster/voxel_grid_based_euclidean_cluster.hpp"
+
+#include <autoware/point_types/types.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <tier4_perception_msgs/msg/detected_objects_with_feature.hpp>
+
+#include <cuda_runtime_api.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using autoware::point_types::PointXYZI;
+
+namespace
+{
+bool hasCudaDevice()
+{
+  int num_devices = 0;
+  return cudaGetDeviceCount(&num_devices) == cudaSuccess && num_devices > 0;
+}
+
+// blobs of points on a regular grid, the blobs being far from each other
+std::vector<PointXYZI> generateBlobs(const std::vector<int> & blob_sizes)
+{
+  std::vector<PointXYZI> points;
+  for (size_t blob = 0; blob < blob_sizes.size(); ++blob) {
+    for (int i = 0; i < blob_sizes[blob]; ++i) {
+      PointXYZI point;
+      point.x = 10.0f * static_cast<float>(blob) + 0.1f * static_cast<float>(i % 10);
+      point.y = -5.0f + 0.1f * static_cast<float>(i / 10);
+      point.z = 0.05f * static_cast<float>(i % 7);
+      point.intensity = static_cast<float>(blob);
+      points.push_back(point);
+    }
+  }
+  return points;
+}
+
+sensor_msgs::msg::PointCloud2::ConstSharedPtr toPointCloud2(const std::vector<PointXYZI> & points)
+{
+  auto pointcloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  pointcloud->fields.resize(4);
+  const char * names[] = {"x", "y", "z", "intensity"};
+  for (size_t i = 0; i < 4; ++i) {
+    pointcloud->fields[i].name = names[i];
+    pointcloud->fields[i].offset = 4 * i;
+    pointcloud->fields[i].datatype = sensor_msgs::msg::PointField::FLOAT32;
+    pointcloud->fields[i].count = 1;
+  }
+  pointcloud->height = 1;
+  pointcloud->width = points.size();
+  pointcloud->point_step = 16;
+  pointcloud->row_step = pointcloud->point_step * points.size();
+  pointcloud->header.frame_id = "dummy_frame_id";
+  pointcloud->data.resize(pointcloud->row_step);
+  for (size_t i = 0; i < points.size(); ++i) {
+    std::memcpy(&pointcloud->data[i * pointcloud->point_step], &points[i], 16);
+  }
+  return pointcloud;
+}
+
+std::vector<uint32_t> getSortedClusterSizes(
+  const tier4_perception_msgs::msg::DetectedObjectsWithFeature & objects)
+{
+  std::vector<uint32_t> sizes;
+  for (const auto & object : objects.feature_objects) {
+    sizes.push_back(object.feature.cluster.width);
+  }
+  std::sort(sizes.begin(), sizes.end());
+  return sizes;
+}
+}  // namespace
+
+// The GPU voxel grid based clustering should give the same clusters as the CPU one
+TEST(CudaEuclideanClusterTest, sameClustersAsVoxelGridBasedEuclideanCluster)
+{
+  if (!hasCudaDevice()) {
+    GTEST_SKIP() << "no CUDA device";
+  }
+  const auto pointcloud_msg = toPointCloud2(generateBlobs({100, 5, 300, 40}));
+  const float tolerance = 0.7;
+  const float voxel_leaf_size = 0.3;
+  const int min_points_number_per_voxel = 1;
+  const int min_cluster_size = 10;
+  const int max_cluster_size = 200;
+  const bool use_height = false;
+
+  autoware::euclidean_cluster::VoxelGridBasedEuclideanCluster cpu_cluster(
+    use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
+    min_points_number_per_voxel);
+  autoware::euclidean_cluster::CudaEuclideanCluster gpu_cluster(
+    use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
+    min_points_number_per_voxel);
+  tier4_perception_msgs::msg::DetectedObjectsWithFeature cpu_output;
+  tier4_perception_msgs::msg::DetectedObjectsWithFeature gpu_output;
+  ASSERT_TRUE(cpu_cluster.cluster(pointcloud_msg, cpu_output));
+  ASSERT_TRUE(gpu_cluster.cluster(pointcloud_msg, gpu_output));
+
+  // the 5 points blob is too small and the 300 points one too large
+  EXPECT_EQ(getSortedClusterSizes(gpu_output), std::vector<uint32_t>({40, 100}));
+  EXPECT_EQ(getSortedClusterSizes(gpu_output), getSortedClusterSizes(cpu_output));
+  for (const auto & object : gpu_output.feature_objects) {
+    // the other fields are copied with the points
+    const auto & cluster = object.feature.cluster;
+    ASSERT_EQ(cluster.point_step, 16u);
+    PointXYZI first_point;
+    std::memcpy(&first_point, cluster.data.data(), 16);
+    for (size_t i = 0; i < cluster.width; ++i) {
+      PointXYZI point;
+      std::memcpy(&point, &cluster.data[i * 16], 16);
+      EXPECT_EQ(point.intensity, first_point.intensity);
+    }
+  }
+}
+
+// The GPU point based clustering should give the same clusters as the CPU one
+TEST(CudaEuclideanClusterTest, sameClustersAsEuclideanCluster)
+{
+  if (!hasCudaDevice()) {
+    GTEST_SKIP() << "no CUDA device";
+  }
+  const auto points = generateBlobs({30, 2, 50});
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
+  for (const auto & point : points) {
+    pointcloud->push_back(pcl::PointXYZ(point.x, point.y, point.z));
+  }
+  for (const bool use_height : {false, true}) {
+    autoware::euclidean_cluster::EuclideanCluster cpu_cluster(use_height, 3, 1000, 0.15);
+    autoware::euclidean_cluster::CudaEuclideanCluster gpu_cluster(use_height, 3, 1000, 0.15);
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> cpu_clusters;
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> gpu_clusters;
+    ASSERT_TRUE(cpu_cluster.cluster(pointcloud, cpu_clusters));
+    ASSERT_TRUE(gpu_cluster.cluster(pointcloud, gpu_clusters));
+
+    std::vector<size_t> cpu_sizes;
+    std::vector<size_t> gpu_sizes;
+    for (const auto & cluster : cpu_clusters) cpu_sizes.push_back(cluster.size());
+    for (const auto & cluster : gpu_clusters) gpu_sizes.push_back(cluster.size());
+    std::sort(cpu_sizes.begin(), cpu_sizes.end());
+    std::sort(gpu_sizes.begin(), gpu_sizes.end());
+    EXPECT_EQ(gpu_sizes, cpu_sizes);
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,212 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/scan_ground_filter/node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <benchmark/benchmark.h>
+#include <pcl/common/transforms.h>
+#include <pcl/io/pcd_io.h>
+
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+#include <cuda_runtime_api.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using autoware::ground_segmentation::ScanGroundFilterComponent;
+using sensor_msgs::msg::PointCloud2;
+
+namespace
+{
+constexpr float sensor_x = 0.6f;
+constexpr float sensor_z = 2.0f;
+
+float deg2rad(const float deg)
+{
+  return deg * static_cast<float>(M_PI) / 180.0f;
+}
+
+PointCloud2::ConstSharedPtr toPointCloud2(const pcl::PointCloud<pcl::PointXYZI> & cloud)
+{
+  auto msg = std::make_shared<PointCloud2>();
+  pcl::toROSMsg(cloud, *msg);
+  msg->header.frame_id = "base_link";
+  return msg;
+}
+
+// scan of a 32 ring lidar over a flat ground with box obstacles around, in base_link
+PointCloud2::ConstSharedPtr createSyntheticScan()
+{
+  constexpr int num_rings = 32;
+  constexpr int num_azimuths = 1800;
+  constexpr float max_range = 100.0f;
+  constexpr float obstacle_height = 1.8f;
+
+  pcl::PointCloud<pcl::PointXYZI> cloud;
+  for (int ring = 0; ring < num_rings; ++ring) {
+    const float elevation = deg2rad(-25.0f + 30.0f * ring / (num_rings - 1));
+    for (int i = 0; i < num_azimuths; ++i) {
+      const float azimuth = deg2rad(360.0f * i / num_azimuths);
+
+      // an obstacle of 5 deg wide in every 30 deg sector, farther in the later sectors
+      const int sector = i / (num_azimuths / 12);
+      const bool in_obstacle = i % (num_azimuths / 12) < num_azimuths * 5 / 360;
+      float range = max_range;
+      if (in_obstacle) {
+        const float obstacle_range = 8.0f + 4.0f * static_cast<float>(sector);
+        const float z = sensor_z + obstacle_range * std::tan(elevation);
+        if (z >= 0.0f && z <= obstacle_height) {
+          range = obstacle_range;
+        }
+      }
+      if (range == max_range && elevation < 0.0f) {
+        range = std::min(max_range, -sensor_z / std::tan(elevation));
+      }
+      if (range == max_range) {
+        continue;
+      }
+
+      pcl::PointXYZI point;
+      point.x = sensor_x + range * std::cos(azimuth);
+      point.y = range * std::sin(azimuth);
+      point.z = std::max(0.0f, sensor_z + range * std::tan(elevation));
+      point.intensity = static_cast<float>(ring);
+      cloud.push_back(point);
+    }
+  }
+  return toPointCloud2(cloud);
+}
+
+// the pointcloud given by AUTOWARE_PERCEPTION_BENCHMARK_PCD in base_link, or the test data of the
+// top lidar
+PointCloud2::ConstSharedPtr loadRecordedScan()
+{
+  pcl::PointCloud<pcl::PointXYZI> cloud;
+  if (const char * pcd_path = std::getenv("AUTOWARE_PERCEPTION_BENCHMARK_PCD")) {
+    pcl::io::loadPCDFile<pcl::PointXYZI>(pcd_path, cloud);
+    return toPointCloud2(cloud);
+  }
+
+  const auto share_dir =
+    ament_index_cpp::get_package_share_directory("autoware_ground_segmentation");
+  pcl::io::loadPCDFile<pcl::PointXYZI>(share_dir + "/data/test.pcd", cloud);
+  Eigen::Affine3f sensor_to_base_link = Eigen::Affine3f::Identity();
+  sensor_to_base_link.translation() << sensor_x, 0.0f, sensor_z;
+  pcl::PointCloud<pcl::PointXYZI> base_link_cloud;
+  pcl::transformPointCloud(cloud, base_link_cloud, sensor_to_base_link);
+  return toPointCloud2(base_link_cloud);
+}
+
+bool hasGpu()
+{
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+  int num_devices = 0;
+  return cudaGetDeviceCount(&num_devices) == cudaSuccess && num_devices > 0;
+#else
+  return false;
+#endif
+}
+}  // namespace
+
+class ScanGroundFilterBenchmark
+{
+public:
+  static void run(
+    benchmark::State & state, const PointCloud2::ConstSharedPtr & input,
+    const bool elevation_grid_mode, const int num_threads, const bool use_gpu)
+  {
+    rclcpp::init(0, nullptr);
+    {
+      const auto filter = createFilter(elevation_grid_mode, num_threads, use_gpu);
+      autoware::pointcloud_preprocessor::TransformInfo transform_info;
+      PointCloud2 output;
+      for (auto _ : state) {
+        filter->faster_filter(input, nullptr, output, transform_info);
+        benchmark::DoNotOptimize(output.data.data());
+      }
+      state.SetItemsProcessed(state.iterations() * input->width * input->height);
+      state.counters["non_ground_points"] = output.width * output.height;
+    }
+    rclcpp::shutdown();
+  }
+
+private:
+  static std::shared_ptr<ScanGroundFilterComponent> createFilter(
+    const bool elevation_grid_mode, const int num_threads, const bool use_gpu)
+  {
+    const auto share_dir =
+      ament_index_cpp::get_package_share_directory("autoware_ground_segmentation");
+    rclcpp::NodeOptions options;
+    options.arguments(
+      {"--ros-args", "--params-file", share_dir + "/config/scan_ground_filter.param.yaml"});
+    options.parameter_overrides({
+      {"wheel_radius", 0.39},
+      {"wheel_width", 0.42},
+      {"wheel_base", 2.74},
+      {"wheel_tread", 1.63},
+      {"front_overhang", 1.0},
+      {"rear_overhang", 1.03},
+      {"left_overhang", 0.1},
+      {"right_overhang", 0.1},
+      {"vehicle_height", 2.5},
+      {"max_steer_angle", 0.7},
+      {"elevation_grid_mode", elevation_grid_mode},
+      {"num_threads", num_threads},
+      {"use_gpu", use_gpu},
+    });
+    return std::make_shared<ScanGroundFilterComponent>(options);
+  }
+};
+
+namespace
+{
+bool registerBenchmarks()
+{
+  const std::vector<std::pair<std::string, PointCloud2::ConstSharedPtr>> inputs{
+    {"synthetic", createSyntheticScan()}, {"recorded", loadRecordedScan()}};
+  for (const auto & [input_name, input] : inputs) {
+    const auto register_benchmark = [input_name = input_name, input = input](
+                                      const std::string & name, const bool elevation_grid_mode,
+                                      const int num_threads, const bool use_gpu) {
+      benchmark::RegisterBenchmark(
+        ("BM_ScanGroundFilter/" + input_name + "/" + name).c_str(),
+        [=](benchmark::State & state) {
+          ScanGroundFilterBenchmark::run(state, input, elevation_grid_mode, num_threads, use_gpu);
+        })
+        ->Unit(benchmark::kMillisecond);
+    };
+    register_benchmark("non_grid", false, 1, false);
+    register_benchmark("grid", true, 1, false);
+    register_benchmark("grid_4_threads", true, 4, false);
+    // the GPU classification is benchmarked only on the machine having a device
+    if (hasGpu()) {
+      register_benchmark("grid_gpu", true, 1, true);
+    }
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool benchmarks_registered = registerBenchmarks();
+}  // namespace
@@ -0,0 +1,719 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cuda_scan_ground_classifier.hpp"
+
+#include <cuda_runtime.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system_error.h>
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace autoware::ground_segmentation
+{
+namespace
+{
+constexpr int threads_per_block = 256;
+// a ray is classified by a single thread, and there are only a few hundred rays, so that small
+// blocks spread them over more multiprocessors
+constexpr int rays_per_block = 32;
+constexpr uint64_t invalid_key = ~0ULL;
+constexpr double two_pi = 2.0 * M_PI;
+
+unsigned int numBlocks(const size_t num_threads, const int block_size)
+{
+  return static_cast<unsigned int>((num_threads + block_size - 1) / block_size);
+}
+
+enum class PointLabel : uint8_t { INIT = 0, GROUND, NON_GROUND, OUT_OF_RANGE };
+
+struct PointData
+{
+  float radius;
+  PointLabel point_state;
+  uint16_t grid_id;
+  uint32_t orig_index;
+};
+
+struct GridCenter
+{
+  float radius;
+  float avg_height;
+  float max_height;
+  float gradient;
+  float intercept;
+  uint16_t grid_id;
+};
+
+/** @brief ScanGroundGrid, with the same arithmetic */
+struct DeviceGrid
+{
+  float grid_size_m;
+  float mode_switch_radius;
+  float virtual_lidar_z;
+  float inv_grid_size_m;
+  float inv_grid_size_rad;
+  float tan_grid_size_rad;
+  float mode_switch_grid_id;
+  float grid_id_offset;
+
+  __device__ float getGridSize(const float radius, const uint16_t grid_id) const
+  {
+    float grid_size = grid_size_m;
+    constexpr uint16_t back_steps_num = 1;
+
+    if (radius > mode_switch_radius && grid_id > mode_switch_grid_id + back_steps_num) {
+      grid_size = radius - (radius - tan_grid_size_rad * virtual_lidar_z) /
+                             (1 + radius * tan_grid_size_rad / virtual_lidar_z);
+    }
+    return grid_size;
+  }
+
+  __device__ uint16_t getGridId(const float radius) const
+  {
+    uint16_t grid_id = 0;
+    if (radius <= mode_switch_radius) {
+      grid_id = static_cast<uint16_t>(radius * inv_grid_size_m);
+    } else {
+      // atan2 of a positive radius is already in [0, 2pi)
+      const double gamma = atan2f(radius, virtual_lidar_z);
+      grid_id = grid_id_offset + gamma * inv_grid_size_rad;
+    }
+    return grid_id;
+  }
+};
+
+DeviceGrid makeDeviceGrid(const CudaScanGroundParameters & parameters)
+{
+  DeviceGrid grid{};
+  grid.grid_size_m = parameters.grid_size_m;
+  grid.mode_switch_radius = parameters.grid_mode_switch_radius;
+  grid.virtual_lidar_z = parameters.virtual_lidar_z;
+
+  grid.inv_grid_size_m = 1.0f / grid.grid_size_m;
+  grid.mode_switch_grid_id = grid.mode_switch_radius * grid.inv_grid_size_m;
+  const float mode_switch_angle_rad = std::atan2(grid.mode_switch_radius, grid.virtual_lidar_z);
+  const float grid_size_rad =
+    static_cast<double>(
+      std::atan2(grid.mode_switch_radius + grid.grid_size_m, grid.virtual_lidar_z)) -
+    static_cast<double>(mode_switch_angle_rad);
+  grid.inv_grid_size_rad = 1.0f / grid_size_rad;
+  grid.tan_grid_size_rad = std::tan(grid_size_rad);
+  grid.grid_id_offset = grid.mode_switch_grid_id - mode_switch_angle_rad * grid.inv_grid_size_rad;
+  return grid;
+}
+
+struct PointsCentroid
+{
+  float radius_sum;
+  float height_sum;
+  float radius_avg;
+  float height_avg;
+  float height_max;
+  float height_min;
+  uint32_t point_num;
+
+  __device__ void initialize()
+  {
+    radius_sum = 0.0f;
+    height_sum = 0.0f;
+    radius_avg = 0.0f;
+    height_avg = 0.0f;
+    height_max = -10.0f;
+    height_min = 10.0f;
+    point_num = 0;
+  }
+
+  __device__ void addPoint(const float radius, const float height)
+  {
+    radius_sum += radius;
+    height_sum += height;
+    ++point_num;
+    radius_avg = radius_sum / point_num;
+    height_avg = height_sum / point_num;
+    height_max = height_max < height ? height : height_max;
+    height_min = height_min > height ? height : height_min;
+  }
+};
+
+/** @brief the last gnd_grid_buffer_size ground grids of a ray, which are all that are read */
+struct GroundGrids
+{
+  GridCenter grids[CudaScanGroundClassifier::max_gnd_grid_buffer_size];
+  uint32_t capacity;
+  uint32_t size;
+
+  __device__ void push(const GridCenter & grid)
+  {
+    grids[size % capacity] = grid;
+    ++size;
+  }
+
+  /** @brief the i-th grid from the end, from 1 */
+  __device__ GridCenter & fromEnd(const uint32_t i) { return grids[(size - i) % capacity]; }
+};
+
+/** @brief std::clamp */
+__device__ inline float clamp(const float value, const float low, const float high)
+{
+  return value < low ? low : (high < value ? high : value);
+}
+
+__device__ inline float loadFloat(const uint8_t * data)
+{
+  float value;
+  memcpy(&value, data, sizeof(float));
+  return value;
+}
+
+__device__ inline float3 loadPoint(
+  const uint8_t * points, const CudaPointLayout & layout, const uint32_t index)
+{
+  const uint8_t * point = points + static_cast<size_t>(index) * layout.point_step;
+  return make_float3(
+    loadFloat(point + layout.offset_x), loadFloat(point + layout.offset_y),
+    loadFloat(point + layout.offset_z));
+}
+
+// the key orders the points by ray, and then by radius as the bits of a non-negative float
+// are ordered as the float
+__global__ void computeRayKeysKernel(
+  const uint8_t * points, const uint32_t num_points, const CudaPointLayout layout,
+  const float x_shift, const float inv_radial_divider_angle_rad,
+  const uint32_t radial_dividers_num, uint64_t * keys, uint32_t * indices)
+{
+  const uint32_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_points) return;
+  indices[i] = i;
+  const float3 point = loadPoint(points, layout, i);
+  const float x = point.x - x_shift;
+  const float radius = hypotf(x, point.y);
+  // normalizeRadian(theta, 0.0)
+  double theta = atan2f(x, point.y);
+  if (theta < 0.0) theta += two_pi;
+  const double radial_div = floor(theta * inv_radial_divider_angle_rad);
+  // also false for NaN
+  if (!(radial_div >= 0.0 && radial_div < radial_dividers_num && radius <= FLT_MAX)) {
+    keys[i] = invalid_key;
+    return;
+  }
+  keys[i] = (static_cast<uint64_t>(radial_div) << 32) | __float_as_uint(radius);
+}
+
+__global__ void findRayRangesKernel(
+  const uint64_t * keys, const uint32_t num_points, uint32_t * ray_begins, uint32_t * ray_ends)
+{
+  const uint32_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_points || keys[i] == invalid_key) return;
+  const uint32_t ray = static_cast<uint32_t>(keys[i] >> 32);
+  if (i == 0 || static_cast<uint32_t>(keys[i - 1] >> 32) != ray) {
+    ray_begins[ray] = i;
+  }
+  if (i + 1 == num_points || static_cast<uint32_t>(keys[i + 1] >> 32) != ray) {
+    ray_ends[ray] = i + 1;
+  }
+}
+
+__device__ void initializeFirstGndGrids(
+  const float h, const float r, const uint16_t id, const uint16_t gnd_grid_buffer_size,
+  GroundGrids & gnd_grids)
+{
+  gnd_grids.capacity = gnd_grid_buffer_size;
+  gnd_grids.size = 0;
+
+  const uint16_t estimating_grid_num = gnd_grid_buffer_size + 1;
+  const uint16_t idx_estimate_from = id - estimating_grid_num;
+  const float gradient = h / r;
+
+  GridCenter curr_gnd_grid;
+  for (uint16_t idx = 1; idx < estimating_grid_num; ++idx) {
+    float interpolation_ratio = static_cast<float>(idx) / static_cast<float>(estimating_grid_num);
+    const uint16_t ind_grid = idx_estimate_from + idx;
+
+    const float interpolated_r = r * interpolation_ratio;
+    const float interpolated_z = gradient * interpolated_r;
+
+    curr_gnd_grid.radius = interpolated_r;
+    curr_gnd_grid.avg_height = interpolated_z;
+    curr_gnd_grid.max_height = interpolated_z;
+    curr_gnd_grid.gradient = gradient;
+    curr_gnd_grid.intercept = 0.0f;
+    curr_gnd_grid.grid_id = ind_grid;
+    gnd_grids.push(curr_gnd_grid);
+  }
+}
+
+__device__ void fitLineFromGndGrid(GroundGrids & gnd_grids, float & a, float & b)
+{
+  float sum_x = 0.0f;
+  float sum_y = 0.0f;
+  float sum_xy = 0.0f;
+  float sum_x2 = 0.0f;
+  for (uint32_t i = gnd_grids.capacity; i > 0; --i) {
+    const auto & grid = gnd_grids.fromEnd(i);
+    sum_x += grid.radius;
+    sum_y += grid.avg_height;
+    sum_xy += grid.radius * grid.avg_height;
+    sum_x2 += grid.radius * grid.radius;
+  }
+  const float n = static_cast<float>(gnd_grids.capacity);
+
+  a = (n * sum_xy - sum_x * sum_y) / (n * sum_x2 - sum_x * sum_x);
+  b = (sum_y - a * sum_x) / n;
+}
+
+__device__ void checkContinuousGndGrid(
+  PointData & pd, const float3 & point_curr, GroundGrids & gnd_grids,
+  const CudaScanGroundParameters & p, const double gnd_z_local_slope_ratio)
+{
+  {
+    const auto & reference_grid = gnd_grids.fromEnd(2);
+    const float delta_z = point_curr.z - reference_grid.avg_height;
+    const float delta_radius = pd.radius - reference_grid.radius;
+    const float local_slope_ratio = delta_z / delta_radius;
+
+    if (fabsf(local_slope_ratio) < p.local_slope_max_ratio) {
+      pd.point_state = PointLabel::GROUND;
+      return;
+    }
+  }
+
+  const auto & last_grid = gnd_grids.fromEnd(1);
+  const float gradient =
+    clamp(last_grid.gradient, -p.global_slope_max_ratio, p.global_slope_max_ratio);
+  const float & intercept = last_grid.intercept;
+
+  const float next_gnd_z = gradient * pd.radius + intercept;
+
+  const float gnd_z_local_thresh = gnd_z_local_slope_ratio * (pd.radius - last_grid.radius);
+
+  if (fabsf(point_curr.z - next_gnd_z) <= p.non_ground_height_threshold + gnd_z_local_thresh) {
+    pd.point_state = PointLabel::GROUND;
+    return;
+  }
+  if (point_curr.z - next_gnd_z >= p.non_ground_height_threshold + gnd_z_local_thresh) {
+    pd.point_state = PointLabel::NON_GROUND;
+    return;
+  }
+}
+
+__device__ void checkDiscontinuousGndGrid(
+  PointData & pd, const float3 & point_curr, GroundGrids & gnd_grids,
+  const CudaScanGroundParameters & p)
+{
+  const auto & grid_ref = gnd_grids.fromEnd(1);
+  const float delta_avg_z = point_curr.z - grid_ref.avg_height;
+  if (fabsf(delta_avg_z) < p.non_ground_height_threshold) {
+    pd.point_state = PointLabel::GROUND;
+    return;
+  }
+  const float delta_max_z = point_curr.z - grid_ref.max_height;
+  if (fabsf(delta_max_z) < p.non_ground_height_threshold) {
+    pd.point_state = PointLabel::GROUND;
+    return;
+  }
+  const float delta_radius = pd.radius - grid_ref.radius;
+  const float local_slope_ratio = delta_avg_z / delta_radius;
+  if (fabsf(local_slope_ratio) < p.local_slope_max_ratio) {
+    pd.point_state = PointLabel::GROUND;
+    return;
+  }
+  if (local_slope_ratio >= p.local_slope_max_ratio) {
+    pd.point_state = PointLabel::NON_GROUND;
+    return;
+  }
+}
+
+__device__ void checkBreakGndGrid(
+  PointData & pd, const float3 & point_curr, GroundGrids & gnd_grids,
+  const CudaScanGroundParameters & p)
+{
+  const auto & grid_ref = gnd_grids.fromEnd(1);
+  const float delta_avg_z = point_curr.z - grid_ref.avg_height;
+  const float delta_radius = pd.radius - grid_ref.radius;
+  const float local_slope_ratio = delta_avg_z / delta_radius;
+  if (fabsf(local_slope_ratio) < p.global_slope_max_ratio) {
+    pd.point_state = PointLabel::GROUND;
+    return;
+  }
+  if (local_slope_ratio >= p.global_slope_max_ratio) {
+    pd.point_state = PointLabel::NON_GROUND;
+    return;
+  }
+}
+
+/**
+ * @brief classify each ray in a thread, as ScanGroundFilterComponent::classifyRadialSectorGridScan
+ *
+ * The outputs and the ground cluster of the ray r are written from ray_begins[r] + r, which leaves
+ * room for one more entry than the points of the ray, as the first point is classified twice.
+ */
+__global__ void classifyRaysKernel(
+  const uint8_t * points, const CudaPointLayout layout, const uint64_t * keys,
+  const uint32_t * indices, const uint32_t * ray_begins, const uint32_t * ray_ends,
+  const CudaScanGroundParameters p, const DeviceGrid grid, const double gnd_z_local_slope_ratio,
+  uint32_t * ray_outputs, uint32_t * cluster_indices, float * cluster_heights,
+  uint32_t * ray_output_nums)
+{
+  const uint32_t ray = blockIdx.x * blockDim.x + threadIdx.x;
+  if (ray >= p.radial_dividers_num) return;
+  const uint32_t begin = ray_begins[ray];
+  const uint32_t end = ray_ends[ray];
+  uint32_t * outputs = ray_outputs + begin + ray;
+  uint32_t * centroid_bin_indices = cluster_indices + begin + ray;
+  float * centroid_bin_heights = cluster_heights + begin + ray;
+  uint32_t output_num = 0;
+  uint32_t centroid_bin_num = 0;
+
+  const auto load_point_data = [&](const uint32_t i) {
+    PointData pd;
+    pd.radius = __uint_as_float(static_cast<uint32_t>(keys[i]));
+    pd.point_state = PointLabel::INIT;
+    pd.grid_id = grid.getGridId(pd.radius);
+    pd.orig_index = indices[i];
+    return pd;
+  };
+  const auto add_centroid_bin_point = [&](
+                                        PointsCentroid & centroid_bin, const PointData & pd,
+                                        const float height) {
+    centroid_bin_indices[centroid_bin_num] = pd.orig_index;
+    centroid_bin_heights[centroid_bin_num] = height;
+    ++centroid_bin_num;
+    centroid_bin.addPoint(pd.radius, height);
+  };
+
+  PointsCentroid centroid_bin;
+  centroid_bin.initialize();
+  GroundGrids gnd_grids;
+  gnd_grids.capacity = p.gnd_grid_buffer_size;
+  gnd_grids.size = 0;
+
+  if (begin == end) {
+    ray_output_nums[ray] = 0;
+    return;
+  }
+
+  bool initialized_first_gnd_grid = false;
+
+  PointData pd_curr = load_point_data(begin);
+  float3 point_curr = loadPoint(points, layout, pd_curr.orig_index);
+  PointData pd_prev;
+  float3 point_prev;
+
+  for (uint32_t i = begin; i < end; ++i) {
+    pd_prev = pd_curr;
+    point_prev = point_curr;
+
+    pd_curr = load_point_data(i);
+    point_curr = loadPoint(points, layout, pd_curr.orig_index);
+
+    const bool is_curr_in_next_grid = pd_curr.grid_id > pd_prev.grid_id;
+
+    if (!initialized_first_gnd_grid) {
+      const float global_slope_ratio_p = point_prev.z / pd_prev.radius;
+      float non_ground_height_threshold_local = p.non_ground_height_threshold;
+      if (point_prev.x < p.low_priority_region_x) {
+        non_ground_height_threshold_local =
+          p.non_ground_height_threshold * fabsf(point_prev.x / p.low_priority_region_x);
+      }
+
+      if (
+        global_slope_ratio_p >= p.global_slope_max_ratio &&
+        point_prev.z > non_ground_height_threshold_local) {
+        outputs[output_num++] = pd_prev.orig_index;
+        pd_prev.point_state = PointLabel::NON_GROUND;
+      } else if (
+        fabsf(global_slope_ratio_p) < p.global_slope_max_ratio &&
+        fabsf(point_prev.z) < non_ground_height_threshold_local) {
+        add_centroid_bin_point(centroid_bin, pd_prev, point_prev.z);
+        pd_prev.point_state = PointLabel::GROUND;
+        initialized_first_gnd_grid = is_curr_in_next_grid;
+      }
+      if (!initialized_first_gnd_grid) {
+        continue;
+      }
+      initializeFirstGndGrids(
+        centroid_bin.height_avg, centroid_bin.radius_avg, pd_prev.grid_id, p.gnd_grid_buffer_size,
+        gnd_grids);
+    }
+
+    if (is_curr_in_next_grid && centroid_bin_num > 0) {
+      if (p.use_recheck_ground_cluster) {
+        const float reference_height =
+          p.use_lowest_point ? centroid_bin.height_min : centroid_bin.height_avg;
+        for (uint32_t j = 0; j < centroid_bin_num; ++j) {
+          if (centroid_bin_heights[j] >= reference_height + p.non_ground_height_threshold) {
+            outputs[output_num++] = centroid_bin_indices[j];
+          }
+        }
+      }
+      GridCenter curr_gnd_grid;
+      curr_gnd_grid.radius = centroid_bin.radius_avg;
+      curr_gnd_grid.avg_height = centroid_bin.height_avg;
+      curr_gnd_grid.max_height = centroid_bin.height_max;
+      curr_gnd_grid.grid_id = pd_prev.grid_id;
+      curr_gnd_grid.gradient = 0.0f;
+      curr_gnd_grid.intercept = 0.0f;
+      gnd_grids.push(curr_gnd_grid);
+      centroid_bin.initialize();
+      centroid_bin_num = 0;
+
+      float gradient, intercept;
+      fitLineFromGndGrid(gnd_grids, gradient, intercept);
+      gnd_grids.fromEnd(1).gradient = gradient;
+      gnd_grids.fromEnd(1).intercept = intercept;
+    }
+
+    const float global_slope_ratio_p = point_curr.z / pd_curr.radius;
+    const GridCenter grid_ref = gnd_grids.fromEnd(1);
+
+    // 1: height is out-of-range
+    if (point_curr.z - grid_ref.avg_height > p.detection_range_z_max) {
+      pd_curr.point_state = PointLabel::OUT_OF_RANGE;
+      continue;
+    }
+
+    // 2: continuously non-ground
+    float points_xy_distance_square =
+      (point_curr.x - point_prev.x) * (point_curr.x - point_prev.x) +
+      (point_curr.y - point_prev.y) * (point_curr.y - point_prev.y);
+    if (
+      pd_prev.point_state == PointLabel::NON_GROUND &&
+      points_xy_distance_square < p.split_points_distance_tolerance_square &&
+      point_curr.z > point_prev.z) {
+      pd_curr.point_state = PointLabel::NON_GROUND;
+      outputs[output_num++] = pd_curr.orig_index;
+      continue;
+    }
+
+    // 3: the angle is exceed the global slope threshold
+    if (global_slope_ratio_p > p.global_slope_max_ratio) {
+      outputs[output_num++] = pd_curr.orig_index;
+      continue;
+    }
+
+    const uint16_t next_gnd_grid_id_thresh = gnd_grids.fromEnd(p.gnd_grid_buffer_size).grid_id +
+                                             p.gnd_grid_buffer_size + p.gnd_grid_continual_thresh;
+    const float curr_grid_width = grid.getGridSize(pd_curr.radius, pd_curr.grid_id);
+    if (
+      // 4: the point is continuous with the previous grid
+      pd_curr.grid_id < next_gnd_grid_id_thresh &&
+      pd_curr.radius - grid_ref.radius < p.gnd_grid_continual_thresh * curr_grid_width) {
+      checkContinuousGndGrid(pd_curr, point_curr, gnd_grids, p, gnd_z_local_slope_ratio);
+    } else if (
+      // 5: the point is discontinuous with the previous grid
+      pd_curr.radius - grid_ref.radius < p.gnd_grid_continual_thresh * curr_grid_width) {
+      checkDiscontinuousGndGrid(pd_curr, point_curr, gnd_grids, p);
+    } else {
+      // 6: the point is break the previous grid
+      checkBreakGndGrid(pd_curr, point_curr, gnd_grids, p);
+    }
+
+    if (pd_curr.point_state == PointLabel::NON_GROUND) {
+      outputs[output_num++] = pd_curr.orig_index;
+    } else if (pd_curr.point_state == PointLabel::GROUND) {
+      add_centroid_bin_point(centroid_bin, pd_curr, point_curr.z);
+    }
+  }
+  ray_output_nums[ray] = output_num;
+}
+
+// a block per ray copies the non-ground points of the ray
+__global__ void gatherNonGroundPointsKernel(
+  const uint8_t * points, const uint32_t point_step, const uint32_t * ray_begins,
+  const uint32_t * ray_outputs, const uint32_t * ray_output_nums,
+  const uint32_t * ray_output_offsets, uint8_t * non_ground_points)
+{
+  const uint32_t ray = blockIdx.x;
+  const uint32_t * outputs = ray_outputs + ray_begins[ray] + ray;
+  uint8_t * ray_non_ground_points =
+    non_ground_points + static_cast<size_t>(ray_output_offsets[ray]) * point_step;
+  for (uint32_t i = threadIdx.x; i < ray_output_nums[ray]; i += blockDim.x) {
+    const uint8_t * src = points + static_cast<size_t>(outputs[i]) * point_step;
+    uint8_t * dst = ray_non_ground_points + static_cast<size_t>(i) * point_step;
+    for (uint32_t j = 0; j < point_step; ++j) {
+      dst[j] = src[j];
+    }
+  }
+}
+}  // namespace
+
+struct CudaScanGroundClassifier::DeviceBuffers
+{
+  cudaStream_t stream{nullptr};
+  // reused for the next frames, as device_vector only reallocates to grow
+  thrust::device_vector<uint8_t> points;
+  thrust::device_vector<uint64_t> keys;
+  thrust::device_vector<uint32_t> indices;
+  thrust::device_vector<uint32_t> ray_begins;
+  thrust::device_vector<uint32_t> ray_ends;
+  thrust::device_vector<uint32_t> ray_outputs;
+  thrust::device_vector<uint32_t> cluster_indices;
+  thrust::device_vector<float> cluster_heights;
+  thrust::device_vector<uint32_t> ray_output_nums;
+  thrust::device_vector<uint32_t> ray_output_offsets;
+  thrust::device_vector<uint8_t> non_ground_points;
+};
+
+CudaScanGroundClassifier::CudaScanGroundClassifier() : buffers_(std::make_unique<DeviceBuffers>())
+{
+  if (cudaStreamCreate(&buffers_->stream) != cudaSuccess) {
+    buffers_->stream = nullptr;
+  }
+}
+
+CudaScanGroundClassifier::~CudaScanGroundClassifier()
+{
+  if (buffers_->stream) {
+    cudaStreamDestroy(buffers_->stream);
+  }
+}
+
+bool CudaScanGroundClassifier::filter(
+  const CudaScanGroundParameters & parameters, const uint8_t * points_d, const size_t num_points,
+  const CudaPointLayout & layout, size_t & num_non_ground_points, cudaStream_t stream)
+{
+  num_non_ground_points = 0;
+  // the indices and the outputs are 32 bits
+  const size_t num_rays = parameters.radial_dividers_num;
+  if (!isSupported(parameters) || num_points + num_rays > UINT32_MAX) {
+    return false;
+  }
+  if (num_points == 0) {
+    return true;
+  }
+
+  auto & b = *buffers_;
+  const auto policy = thrust::cuda::par.on(stream);
+  const DeviceGrid grid = makeDeviceGrid(parameters);
+  // std::tan(DEG2RAD(5.0)) of the CPU implementation, with the DEG2RAD of PCL
+  const double gnd_z_local_slope_ratio = std::tan(5.0 * 0.017453293);
+  size_t num_outputs = 0;
+  try {
+    b.keys.resize(num_points);
+    b.indices.resize(num_points);
+    b.ray_begins.resize(num_rays);
+    b.ray_ends.resize(num_rays);
+    b.ray_output_nums.resize(num_rays);
+    b.ray_output_offsets.resize(num_rays);
+    b.ray_outputs.resize(num_points + num_rays);
+    b.cluster_indices.resize(num_points + num_rays);
+    b.cluster_heights.resize(num_points + num_rays);
+    auto * keys_d = thrust::raw_pointer_cast(b.keys.data());
+    auto * indices_d = thrust::raw_pointer_cast(b.indices.data());
+    auto * ray_begins_d = thrust::raw_pointer_cast(b.ray_begins.data());
+    auto * ray_ends_d = thrust::raw_pointer_cast(b.ray_ends.data());
+    auto * ray_output_nums_d = thrust::raw_pointer_cast(b.ray_output_nums.data());
+    auto * ray_output_offsets_d = thrust::raw_pointer_cast(b.ray_output_offsets.data());
+    auto * ray_outputs_d = thrust::raw_pointer_cast(b.ray_outputs.data());
+
+    // polar binning: one sort orders the points by ray and by radius
+    const auto point_blocks = numBlocks(num_points, threads_per_block);
+    computeRayKeysKernel<<<point_blocks, threads_per_block, 0, stream>>>(
+      points_d, static_cast<uint32_t>(num_points), layout, parameters.x_shift,
+      1.0f / parameters.radial_divider_angle_rad, parameters.radial_dividers_num, keys_d,
+      indices_d);
+    thrust::sort_by_key(policy, b.keys.begin(), b.keys.end(), b.indices.begin());
+    cudaMemsetAsync(ray_begins_d, 0, num_rays * sizeof(uint32_t), stream);
+    cudaMemsetAsync(ray_ends_d, 0, num_rays * sizeof(uint32_t), stream);
+    findRayRangesKernel<<<point_blocks, threads_per_block, 0, stream>>>(
+      keys_d, static_cast<uint32_t>(num_points), ray_begins_d, ray_ends_d);
+
+    classifyRaysKernel<<<numBlocks(num_rays, rays_per_block), rays_per_block, 0, stream>>>(
+      points_d, layout, keys_d, indices_d, ray_begins_d, ray_ends_d, parameters, grid,
+      gnd_z_local_slope_ratio, ray_outputs_d, thrust::raw_pointer_cast(b.cluster_indices.data()),
+      thrust::raw_pointer_cast(b.cluster_heights.data()), ray_output_nums_d);
+
+    // compaction, in the order of the rays as the CPU implementation
+    thrust::exclusive_scan(
+      policy, b.ray_output_nums.begin(), b.ray_output_nums.end(), b.ray_output_offsets.begin());
+    uint32_t last_offset = 0;
+    uint32_t last_num = 0;
+    cudaMemcpyAsync(
+      &last_offset, ray_output_offsets_d + num_rays - 1, sizeof(uint32_t), cudaMemcpyDeviceToHost,
+      stream);
+    cudaMemcpyAsync(
+      &last_num, ray_output_nums_d + num_rays - 1, sizeof(uint32_t), cudaMemcpyDeviceToHost,
+      stream);
+    cudaStreamSynchronize(stream);
+    num_outputs = static_cast<size_t>(last_offset) + last_num;
+
+    b.non_ground_points.resize(num_outputs * layout.point_step);
+    if (num_outputs > 0) {
+      gatherNonGroundPointsKernel<<<num_rays, threads_per_block, 0, stream>>>(
+        points_d, layout.point_step, ray_begins_d, ray_outputs_d, ray_output_nums_d,
+        ray_output_offsets_d, thrust::raw_pointer_cast(b.non_ground_points.data()));
+    }
+    cudaStreamSynchronize(stream);
+  } catch (const thrust::system_error &) {
+    return false;
+  }
+
+  if (cudaGetLastError() != cudaSuccess) {
+    return false;
+  }
+  num_non_ground_points = num_outputs;
+  return true;
+}
+
+bool CudaScanGroundClassifier::filter(
+  const CudaScanGroundParameters & parameters, const std::vector<uint8_t> & points,
+  const CudaPointLayout & layout, std::vector<uint8_t> & non_ground_points)
+{
+  non_ground_points.clear();
+  if (layout.point_step == 0) {
+    return false;
+  }
+  const size_t num_points = points.size() / layout.point_step;
+
+  auto & b = *buffers_;
+  const auto stream = b.stream;
+  try {
+    b.points.resize(num_points * layout.point_step);
+  } catch (const thrust::system_error &) {
+    return false;
+  }
+  auto * points_d = thrust::raw_pointer_cast(b.points.data());
+  cudaMemcpyAsync(
+    points_d, points.data(), num_points * layout.point_step, cudaMemcpyHostToDevice, stream);
+
+  size_t num_non_ground_points = 0;
+  if (!filter(parameters, points_d, num_points, layout, num_non_ground_points, stream)) {
+    return false;
+  }
+  non_ground_points.resize(num_non_ground_points * layout.point_step);
+  cudaMemcpyAsync(
+    non_ground_points.data(), getNonGroundPoints(), non_ground_points.size(),
+    cudaMemcpyDeviceToHost, stream);
+  cudaStreamSynchronize(stream);
+  if (cudaGetLastError() != cudaSuccess) {
+    non_ground_points.clear();
+    return false;
+  }
+  return true;
+}
+
+const uint8_t * CudaScanGroundClassifier::getNonGroundPoints() const
+{
+  return thrust::raw_pointer_cast(buffers_->non_ground_points.data());
+}
+
+}  // namespace autoware::ground_segmentation
@@ -0,0 +1,117 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SCAN_GROUND_FILTER__CUDA_SCAN_GROUND_CLASSIFIER_HPP_
+#define SCAN_GROUND_FILTER__CUDA_SCAN_GROUND_CLASSIFIER_HPP_
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace autoware::ground_segmentation
+{
+/** @brief parameters of the elevation grid mode, as in ScanGroundFilterComponent */
+struct CudaScanGroundParameters
+{
+  // x of the origin of the rays, base on the front wheel center
+  float x_shift;
+  float radial_divider_angle_rad;
+  uint32_t radial_dividers_num;
+
+  float global_slope_max_ratio;
+  float local_slope_max_ratio;
+  float split_points_distance_tolerance_square;
+  float non_ground_height_threshold;
+  float low_priority_region_x;
+  float detection_range_z_max;
+  bool use_recheck_ground_cluster;
+  bool use_lowest_point;
+
+  float grid_size_m;
+  float grid_mode_switch_radius;
+  float virtual_lidar_z;
+  uint16_t gnd_grid_buffer_size;
+  uint16_t gnd_grid_continual_thresh;
+};
+
+/** @brief byte layout of the points, as given by the fields of a PointCloud2 */
+struct CudaPointLayout
+{
+  uint32_t point_step;
+  uint32_t offset_x;
+  uint32_t offset_y;
+  uint32_t offset_z;
+};
+
+/**
+ * @brief the elevation grid scan ground filter on the GPU
+ *
+ * The points are binned by azimuth and sorted by radius in a single device sort, each ray is then
+ * classified sequentially by its own thread with the same steps as
+ * ScanGroundFilterComponent::classifyRadialSectorGridScan, and the non-ground points are compacted
+ * on the device in the order of the CPU implementation.
+ */
+class CudaScanGroundClassifier
+{
+public:
+  /** @brief the largest gnd_grid_buffer_size that the device ground grid buffer holds */
+  static constexpr uint16_t max_gnd_grid_buffer_size = 16;
+
+  CudaScanGroundClassifier();
+  ~CudaScanGroundClassifier();
+
+  static bool isSupported(const CudaScanGroundParameters & parameters)
+  {
+    return parameters.gnd_grid_buffer_size >= 2 &&
+           parameters.gnd_grid_buffer_size <= max_gnd_grid_buffer_size &&
+           parameters.radial_dividers_num > 0;
+  }
+
+  /**
+   * @brief filter points that are already in device memory, keeping the result on the device
+   *
+   * @param[in] points_d points in device memory
+   * @param[out] num_non_ground_points number of points in getNonGroundPoints()
+   * @param[in] stream stream on which the filter runs; it is synchronized before returning
+   * @return false if a CUDA operation failed
+   */
+  bool filter(
+    const CudaScanGroundParameters & parameters, const uint8_t * points_d, size_t num_points,
+    const CudaPointLayout & layout, size_t & num_non_ground_points, cudaStream_t stream);
+
+  /**
+   * @brief filter points in host memory
+   *
+   * @param[in] points points with the layout, as the data of a PointCloud2
+   * @param[out] non_ground_points non-ground points with the same layout
+   * @return false if a CUDA operation failed
+   */
+  bool filter(
+    const CudaScanGroundParameters & parameters, const std::vector<uint8_t> & points,
+    const CudaPointLayout & layout, std::vector<uint8_t> & non_ground_points);
+
+  /** @brief device pointer to the non-ground points of the last filter, until the next filter */
+  const uint8_t * getNonGroundPoints() const;
+
+private:
+  struct DeviceBuffers;
+  std::unique_ptr<DeviceBuffers> buffers_;
+};
+
+}  // namespace autoware::ground_segmentation
+
+#endif  // SCAN_GROUND_FILTER__CUDA_SCAN_GROUND_CLASSIFIER_HPP_
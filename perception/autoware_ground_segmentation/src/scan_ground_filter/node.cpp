@@ -19,6 +19,8 @@
 #include <autoware/universe_utils/math/unit_conversion.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -45,6 +47,7 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
     radial_divider_angle_rad_ =
       static_cast<float>(deg2rad(declare_parameter<double>("radial_divider_angle_deg")));
     radial_dividers_num_ = std::ceil(2.0 * M_PI / radial_divider_angle_rad_);
+    num_threads_ = std::max(static_cast<int>(declare_parameter<int>("num_threads")), 1);
 
     // common thresholds
     global_slope_max_angle_rad_ =
@@ -84,6 +87,18 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
     // initialize grid
     grid_.initialize(grid_size_m_, grid_mode_switch_radius_, virtual_lidar_z_);
 
+    // GPU classification
+    if (declare_parameter<bool>("use_gpu")) {
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+      cuda_classifier_ = std::make_unique<CudaScanGroundClassifier>();
+      if (!elevation_grid_mode_) {
+        RCLCPP_WARN(get_logger(), "use_gpu is only for elevation_grid_mode, filtering on the CPU");
+      }
+#else
+      RCLCPP_WARN(get_logger(), "Built without CUDA, filtering on the CPU instead");
+#endif
+    }
+
     // data access
     data_offset_initialized_ = false;
   }
@@ -184,10 +199,10 @@ void ScanGroundFilterComponent::convertPointcloudGridScan(
     std::unique_ptr<ScopedTimeTrack> inner_st_ptr;
     if (time_keeper_) inner_st_ptr = std::make_unique<ScopedTimeTrack>("sort", *time_keeper_);
 
-    for (size_t i = 0; i < radial_dividers_num_; ++i) {
-      std::sort(
-        out_radial_ordered_points[i].begin(), out_radial_ordered_points[i].end(),
-        [](const PointData & a, const PointData & b) { return a.radius < b.radius; });
+    const auto sectors_num = static_cast<int64_t>(radial_dividers_num_);
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (int64_t i = 0; i < sectors_num; ++i) {
+      sortByRadius(out_radial_ordered_points[i]);
     }
   }
 }
@@ -238,12 +253,64 @@ void ScanGroundFilterComponent::convertPointcloud(
     std::unique_ptr<ScopedTimeTrack> inner_st_ptr;
     if (time_keeper_) inner_st_ptr = std::make_unique<ScopedTimeTrack>("sort", *time_keeper_);
 
-    for (size_t i = 0; i < radial_dividers_num_; ++i) {
+    const auto sectors_num = static_cast<int64_t>(radial_dividers_num_);
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (int64_t i = 0; i < sectors_num; ++i) {
+      sortByRadius(out_radial_ordered_points[i]);
+    }
+  }
+}
+
+void ScanGroundFilterComponent::sortByRadius(PointCloudVector & points)
+{
+  const auto by_radius = [](const PointData & a, const PointData & b) {
+    return a.radius < b.radius;
+  };
+
+  // a comparison sort is cheaper for the small sectors, and the buckets need a finite range
+  constexpr size_t min_bucket_sort_size = 64;
+  const size_t points_num = points.size();
+  float max_radius = 0.0f;
+  bool is_finite = true;
+  for (const auto & point : points) {
+    if (!std::isfinite(point.radius)) {
+      is_finite = false;
+      break;
+    }
+    max_radius = std::max(max_radius, point.radius);
+  }
+  if (points_num < min_bucket_sort_size || !is_finite || max_radius <= 0.0f) {
+    std::sort(points.begin(), points.end(), by_radius);
+    return;
+  }
+
+  // as many buckets as points over [0, max_radius], so that most buckets hold one point
+  const float bucket_scale = static_cast<float>(points_num - 1) / max_radius;
+  const auto get_bucket = [&](const PointData & point) {
+    return std::min(static_cast<size_t>(point.radius * bucket_scale), points_num - 1);
+  };
+  std::vector<uint32_t> bucket_offsets(points_num + 1, 0);
+  for (const auto & point : points) {
+    ++bucket_offsets[get_bucket(point) + 1];
+  }
+  for (size_t i = 0; i < points_num; ++i) {
+    bucket_offsets[i + 1] += bucket_offsets[i];
+  }
+  std::vector<uint32_t> bucket_cursors(bucket_offsets.begin(), bucket_offsets.end() - 1);
+  PointCloudVector sorted_points(points_num);
+  for (const auto & point : points) {
+    sorted_points[bucket_cursors[get_bucket(point)]++] = point;
+  }
+
+  // the points are only out of order within a bucket
+  for (size_t i = 0; i < points_num; ++i) {
+    if (bucket_offsets[i + 1] - bucket_offsets[i] > 1) {
       std::sort(
-        out_radial_ordered_points[i].begin(), out_radial_ordered_points[i].end(),
-        [](const PointData & a, const PointData & b) { return a.radius < b.radius; });
+        sorted_points.begin() + bucket_offsets[i], sorted_points.begin() + bucket_offsets[i + 1],
+        by_radius);
     }
   }
+  points.swap(sorted_points);
 }
 
 void ScanGroundFilterComponent::calcVirtualGroundOrigin(pcl::PointXYZ & point) const
@@ -408,6 +475,41 @@ void ScanGroundFilterComponent::recheckGroundCluster(
   }
 }
 
+template <typename ClassifySectorT>
+void ScanGroundFilterComponent::classifyRadialSectors(
+  const std::vector<PointCloudVector> & in_radial_ordered_clouds,
+  pcl::PointIndices & out_no_ground_indices, const ClassifySectorT & classify_sector) const
+{
+  out_no_ground_indices.indices.clear();
+
+  if (num_threads_ <= 1) {
+    for (const auto & in_radial_ordered_points : in_radial_ordered_clouds) {
+      classify_sector(in_radial_ordered_points, out_no_ground_indices);
+    }
+    return;
+  }
+
+  // the sectors are independent of each other. A dynamic schedule balances the threads since the
+  // number of points varies a lot between the sectors, and the indices of each sector are joined
+  // in the sector order so that the output is the same as the sequential one
+  const auto sectors_num = static_cast<int64_t>(in_radial_ordered_clouds.size());
+  std::vector<pcl::PointIndices> sector_no_ground_indices(in_radial_ordered_clouds.size());
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (int64_t i = 0; i < sectors_num; ++i) {
+    classify_sector(in_radial_ordered_clouds[i], sector_no_ground_indices[i]);
+  }
+
+  size_t no_ground_num = 0;
+  for (const auto & indices : sector_no_ground_indices) {
+    no_ground_num += indices.indices.size();
+  }
+  out_no_ground_indices.indices.reserve(no_ground_num);
+  for (const auto & indices : sector_no_ground_indices) {
+    out_no_ground_indices.indices.insert(
+      out_no_ground_indices.indices.end(), indices.indices.begin(), indices.indices.end());
+  }
+}
+
 void ScanGroundFilterComponent::classifyPointCloudGridScan(
   const PointCloud2ConstPtr & in_cloud,
   const std::vector<PointCloudVector> & in_radial_ordered_clouds,
@@ -416,166 +518,172 @@ void ScanGroundFilterComponent::classifyPointCloudGridScan(
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  out_no_ground_indices.indices.clear();
-
-  // run the classification algorithm for each ray (azimuth division)
-  for (size_t i = 0; i < in_radial_ordered_clouds.size(); ++i) {
-    PointsCentroid centroid_bin;
-    centroid_bin.initialize();
-    std::vector<GridCenter> gnd_grids;
-
-    // check empty ray
-    if (in_radial_ordered_clouds[i].size() == 0) {
-      continue;
-    }
-
-    bool initialized_first_gnd_grid = false;
+  classifyRadialSectors(
+    in_radial_ordered_clouds, out_no_ground_indices,
+    [&](const PointCloudVector & in_radial_ordered_points, pcl::PointIndices & out_indices) {
+      classifyRadialSectorGridScan(in_cloud, in_radial_ordered_points, out_indices);
+    });
+}
 
-    PointData pd_curr, pd_prev;
-    pcl::PointXYZ point_curr, point_prev;
+void ScanGroundFilterComponent::classifyRadialSectorGridScan(
+  const PointCloud2ConstPtr & in_cloud, const PointCloudVector & in_radial_ordered_points,
+  pcl::PointIndices & out_no_ground_indices) const
+{
+  PointsCentroid centroid_bin;
+  centroid_bin.initialize();
+  std::vector<GridCenter> gnd_grids;
 
-    // initialize the previous point
-    {
-      pd_curr = in_radial_ordered_clouds[i][0];
-      const size_t data_index = in_cloud->point_step * pd_curr.orig_index;
-      get_point_from_data_index(in_cloud, data_index, point_curr);
-    }
+  // check empty ray
+  if (in_radial_ordered_points.size() == 0) {
+    return;
+  }
 
-    // iterate over the points in the ray
-    for (const auto & point : in_radial_ordered_clouds[i]) {
-      // set the previous point
-      pd_prev = pd_curr;
-      point_prev = point_curr;
+  bool initialized_first_gnd_grid = false;
 
-      // set the current point
-      pd_curr = point;
-      const size_t data_index = in_cloud->point_step * pd_curr.orig_index;
-      get_point_from_data_index(in_cloud, data_index, point_curr);
+  PointData pd_curr, pd_prev;
+  pcl::PointXYZ point_curr, point_prev;
 
-      // determine if the current point is in new grid
-      const bool is_curr_in_next_grid = pd_curr.grid_id > pd_prev.grid_id;
+  // initialize the previous point
+  {
+    pd_curr = in_radial_ordered_points[0];
+    const size_t data_index = in_cloud->point_step * pd_curr.orig_index;
+    get_point_from_data_index(in_cloud, data_index, point_curr);
+  }
+
+  // iterate over the points in the ray
+  for (const auto & point : in_radial_ordered_points) {
+    // set the previous point
+    pd_prev = pd_curr;
+    point_prev = point_curr;
+
+    // set the current point
+    pd_curr = point;
+    const size_t data_index = in_cloud->point_step * pd_curr.orig_index;
+    get_point_from_data_index(in_cloud, data_index, point_curr);
+
+    // determine if the current point is in new grid
+    const bool is_curr_in_next_grid = pd_curr.grid_id > pd_prev.grid_id;
+
+    // initialization process for the first grid and interpolate the previous grids
+    if (!initialized_first_gnd_grid) {
+      // set the thresholds
+      const float global_slope_ratio_p = point_prev.z / pd_prev.radius;
+      float non_ground_height_threshold_local = non_ground_height_threshold_;
+      if (point_prev.x < low_priority_region_x_) {
+        non_ground_height_threshold_local =
+          non_ground_height_threshold_ * abs(point_prev.x / low_priority_region_x_);
+      }
+      // non_ground_height_threshold_local is only for initialization
 
-      // initialization process for the first grid and interpolate the previous grids
+      // prepare centroid_bin for the first grid
+      if (
+        // classify previous point
+        global_slope_ratio_p >= global_slope_max_ratio_ &&
+        point_prev.z > non_ground_height_threshold_local) {
+        out_no_ground_indices.indices.push_back(pd_prev.orig_index);
+        pd_prev.point_state = PointLabel::NON_GROUND;
+      } else if (
+        abs(global_slope_ratio_p) < global_slope_max_ratio_ &&
+        abs(point_prev.z) < non_ground_height_threshold_local) {
+        centroid_bin.addPoint(pd_prev.radius, point_prev.z, pd_prev.orig_index);
+        pd_prev.point_state = PointLabel::GROUND;
+        // centroid_bin is filled at least once
+        // if the current point is in the next gird, it is ready to be initialized
+        initialized_first_gnd_grid = is_curr_in_next_grid;
+      }
+      // keep filling the centroid_bin until it is ready to be initialized
       if (!initialized_first_gnd_grid) {
-        // set the thresholds
-        const float global_slope_ratio_p = point_prev.z / pd_prev.radius;
-        float non_ground_height_threshold_local = non_ground_height_threshold_;
-        if (point_prev.x < low_priority_region_x_) {
-          non_ground_height_threshold_local =
-            non_ground_height_threshold_ * abs(point_prev.x / low_priority_region_x_);
-        }
-        // non_ground_height_threshold_local is only for initialization
-
-        // prepare centroid_bin for the first grid
-        if (
-          // classify previous point
-          global_slope_ratio_p >= global_slope_max_ratio_ &&
-          point_prev.z > non_ground_height_threshold_local) {
-          out_no_ground_indices.indices.push_back(pd_prev.orig_index);
-          pd_prev.point_state = PointLabel::NON_GROUND;
-        } else if (
-          abs(global_slope_ratio_p) < global_slope_max_ratio_ &&
-          abs(point_prev.z) < non_ground_height_threshold_local) {
-          centroid_bin.addPoint(pd_prev.radius, point_prev.z, pd_prev.orig_index);
-          pd_prev.point_state = PointLabel::GROUND;
-          // centroid_bin is filled at least once
-          // if the current point is in the next gird, it is ready to be initialized
-          initialized_first_gnd_grid = is_curr_in_next_grid;
-        }
-        // keep filling the centroid_bin until it is ready to be initialized
-        if (!initialized_first_gnd_grid) {
-          continue;
-        }
-        // estimate previous grids by linear interpolation
-        float h = centroid_bin.getAverageHeight();
-        float r = centroid_bin.getAverageRadius();
-        initializeFirstGndGrids(h, r, pd_prev.grid_id, gnd_grids);
+        continue;
       }
+      // estimate previous grids by linear interpolation
+      float h = centroid_bin.getAverageHeight();
+      float r = centroid_bin.getAverageRadius();
+      initializeFirstGndGrids(h, r, pd_prev.grid_id, gnd_grids);
+    }
 
-      // finalize the current centroid_bin and update the gnd_grids
-      if (is_curr_in_next_grid && centroid_bin.getIndicesRef().indices.size() > 0) {
-        // check if the prev grid have ground point cloud
-        if (use_recheck_ground_cluster_) {
-          recheckGroundCluster(
-            centroid_bin, non_ground_height_threshold_, use_lowest_point_, out_no_ground_indices);
-          // centroid_bin is not modified. should be rechecked by out_no_ground_indices?
-        }
-        // convert the centroid_bin to grid-center and add it to the gnd_grids
-        GridCenter curr_gnd_grid;
-        curr_gnd_grid.radius = centroid_bin.getAverageRadius();
-        curr_gnd_grid.avg_height = centroid_bin.getAverageHeight();
-        curr_gnd_grid.max_height = centroid_bin.getMaxHeight();
-        curr_gnd_grid.grid_id = pd_prev.grid_id;
-        curr_gnd_grid.gradient = 0.0f;   // not calculated yet
-        curr_gnd_grid.intercept = 0.0f;  // not calculated yet
-        gnd_grids.push_back(curr_gnd_grid);
-        // clear the centroid_bin
-        centroid_bin.initialize();
-
-        // calculate local ground gradient
-        float gradient, intercept;
-        fitLineFromGndGrid(
-          gnd_grids, gnd_grids.size() - gnd_grid_buffer_size_, gnd_grids.size(), gradient,
-          intercept);
-        // update the current grid
-        gnd_grids.back().gradient = gradient;    // update the gradient
-        gnd_grids.back().intercept = intercept;  // update the intercept
+    // finalize the current centroid_bin and update the gnd_grids
+    if (is_curr_in_next_grid && centroid_bin.getIndicesRef().indices.size() > 0) {
+      // check if the prev grid have ground point cloud
+      if (use_recheck_ground_cluster_) {
+        recheckGroundCluster(
+          centroid_bin, non_ground_height_threshold_, use_lowest_point_, out_no_ground_indices);
+        // centroid_bin is not modified. should be rechecked by out_no_ground_indices?
       }
+      // convert the centroid_bin to grid-center and add it to the gnd_grids
+      GridCenter curr_gnd_grid;
+      curr_gnd_grid.radius = centroid_bin.getAverageRadius();
+      curr_gnd_grid.avg_height = centroid_bin.getAverageHeight();
+      curr_gnd_grid.max_height = centroid_bin.getMaxHeight();
+      curr_gnd_grid.grid_id = pd_prev.grid_id;
+      curr_gnd_grid.gradient = 0.0f;   // not calculated yet
+      curr_gnd_grid.intercept = 0.0f;  // not calculated yet
+      gnd_grids.push_back(curr_gnd_grid);
+      // clear the centroid_bin
+      centroid_bin.initialize();
+
+      // calculate local ground gradient
+      float gradient, intercept;
+      fitLineFromGndGrid(
+        gnd_grids, gnd_grids.size() - gnd_grid_buffer_size_, gnd_grids.size(), gradient,
+        intercept);
+      // update the current grid
+      gnd_grids.back().gradient = gradient;    // update the gradient
+      gnd_grids.back().intercept = intercept;  // update the intercept
+    }
 
-      // 0: set the thresholds
-      const float global_slope_ratio_p = point_curr.z / pd_curr.radius;
-      const auto & grid_ref = gnd_grids.back();
+    // 0: set the thresholds
+    const float global_slope_ratio_p = point_curr.z / pd_curr.radius;
+    const auto & grid_ref = gnd_grids.back();
 
-      // 1: height is out-of-range
-      if (point_curr.z - grid_ref.avg_height > detection_range_z_max_) {
-        pd_curr.point_state = PointLabel::OUT_OF_RANGE;
-        continue;
-      }
+    // 1: height is out-of-range
+    if (point_curr.z - grid_ref.avg_height > detection_range_z_max_) {
+      pd_curr.point_state = PointLabel::OUT_OF_RANGE;
+      continue;
+    }
 
-      // 2: continuously non-ground
-      float points_xy_distance_square =
-        (point_curr.x - point_prev.x) * (point_curr.x - point_prev.x) +
-        (point_curr.y - point_prev.y) * (point_curr.y - point_prev.y);
-      if (
-        pd_prev.point_state == PointLabel::NON_GROUND &&
-        points_xy_distance_square < split_points_distance_tolerance_square_ &&
-        point_curr.z > point_prev.z) {
-        pd_curr.point_state = PointLabel::NON_GROUND;
-        out_no_ground_indices.indices.push_back(pd_curr.orig_index);
-        continue;
-      }
+    // 2: continuously non-ground
+    float points_xy_distance_square =
+      (point_curr.x - point_prev.x) * (point_curr.x - point_prev.x) +
+      (point_curr.y - point_prev.y) * (point_curr.y - point_prev.y);
+    if (
+      pd_prev.point_state == PointLabel::NON_GROUND &&
+      points_xy_distance_square < split_points_distance_tolerance_square_ &&
+      point_curr.z > point_prev.z) {
+      pd_curr.point_state = PointLabel::NON_GROUND;
+      out_no_ground_indices.indices.push_back(pd_curr.orig_index);
+      continue;
+    }
 
-      // 3: the angle is exceed the global slope threshold
-      if (global_slope_ratio_p > global_slope_max_ratio_) {
-        out_no_ground_indices.indices.push_back(pd_curr.orig_index);
-        continue;
-      }
+    // 3: the angle is exceed the global slope threshold
+    if (global_slope_ratio_p > global_slope_max_ratio_) {
+      out_no_ground_indices.indices.push_back(pd_curr.orig_index);
+      continue;
+    }
 
-      const uint16_t next_gnd_grid_id_thresh = (gnd_grids.end() - gnd_grid_buffer_size_)->grid_id +
-                                               gnd_grid_buffer_size_ + gnd_grid_continual_thresh_;
-      const float curr_grid_width = grid_.getGridSize(pd_curr.radius, pd_curr.grid_id);
-      if (
-        // 4: the point is continuous with the previous grid
-        pd_curr.grid_id < next_gnd_grid_id_thresh &&
-        pd_curr.radius - grid_ref.radius < gnd_grid_continual_thresh_ * curr_grid_width) {
-        checkContinuousGndGrid(pd_curr, point_curr, gnd_grids);
-      } else if (
-        // 5: the point is discontinuous with the previous grid
-        pd_curr.radius - grid_ref.radius < gnd_grid_continual_thresh_ * curr_grid_width) {
-        checkDiscontinuousGndGrid(pd_curr, point_curr, gnd_grids);
-      } else {
-        // 6: the point is break the previous grid
-        checkBreakGndGrid(pd_curr, point_curr, gnd_grids);
-      }
+    const uint16_t next_gnd_grid_id_thresh = (gnd_grids.end() - gnd_grid_buffer_size_)->grid_id +
+                                             gnd_grid_buffer_size_ + gnd_grid_continual_thresh_;
+    const float curr_grid_width = grid_.getGridSize(pd_curr.radius, pd_curr.grid_id);
+    if (
+      // 4: the point is continuous with the previous grid
+      pd_curr.grid_id < next_gnd_grid_id_thresh &&
+      pd_curr.radius - grid_ref.radius < gnd_grid_continual_thresh_ * curr_grid_width) {
+      checkContinuousGndGrid(pd_curr, point_curr, gnd_grids);
+    } else if (
+      // 5: the point is discontinuous with the previous grid
+      pd_curr.radius - grid_ref.radius < gnd_grid_continual_thresh_ * curr_grid_width) {
+      checkDiscontinuousGndGrid(pd_curr, point_curr, gnd_grids);
+    } else {
+      // 6: the point is break the previous grid
+      checkBreakGndGrid(pd_curr, point_curr, gnd_grids);
+    }
 
-      // update the point label and update the ground cluster
-      if (pd_curr.point_state == PointLabel::NON_GROUND) {
-        out_no_ground_indices.indices.push_back(pd_curr.orig_index);
-      } else if (pd_curr.point_state == PointLabel::GROUND) {
-        centroid_bin.addPoint(pd_curr.radius, point_curr.z, pd_curr.orig_index);
-      }
-      // else, the point is not classified
+    // update the point label and update the ground cluster
+    if (pd_curr.point_state == PointLabel::NON_GROUND) {
+      out_no_ground_indices.indices.push_back(pd_curr.orig_index);
+    } else if (pd_curr.point_state == PointLabel::GROUND) {
+      centroid_bin.addPoint(pd_curr.radius, point_curr.z, pd_curr.orig_index);
     }
+    // else, the point is not classified
   }
 }
 
@@ -587,120 +695,126 @@ void ScanGroundFilterComponent::classifyPointCloud(
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  out_no_ground_indices.indices.clear();
+  classifyRadialSectors(
+    in_radial_ordered_clouds, out_no_ground_indices,
+    [&](const PointCloudVector & in_radial_ordered_points, pcl::PointIndices & out_indices) {
+      classifyRadialSector(in_cloud, in_radial_ordered_points, out_indices);
+    });
+}
 
+void ScanGroundFilterComponent::classifyRadialSector(
+  const PointCloud2ConstPtr & in_cloud, const PointCloudVector & in_radial_ordered_points,
+  pcl::PointIndices & out_no_ground_indices) const
+{
   const pcl::PointXYZ init_ground_point(0, 0, 0);
   pcl::PointXYZ virtual_ground_point(0, 0, 0);
   calcVirtualGroundOrigin(virtual_ground_point);
 
-  // run the classification algorithm for each ray (azimuth division)
-  for (size_t i = 0; i < in_radial_ordered_clouds.size(); ++i) {
-    float prev_gnd_radius = 0.0f;
-    float prev_gnd_slope = 0.0f;
-    PointsCentroid ground_cluster, non_ground_cluster;
-    PointLabel point_label_curr = PointLabel::INIT;
-
-    pcl::PointXYZ prev_gnd_point(0, 0, 0), point_curr, point_prev;
-
-    // iterate over the points in the ray
-    for (size_t j = 0; j < in_radial_ordered_clouds[i].size(); ++j) {
-      float points_distance = 0.0f;
-      const float local_slope_max_angle = local_slope_max_angle_rad_;
-
-      // set the previous point
-      point_prev = point_curr;
-      PointLabel point_label_prev = point_label_curr;
-
-      // set the current point
-      const PointData & pd = in_radial_ordered_clouds[i][j];
-      point_label_curr = pd.point_state;
-
-      const size_t data_index = in_cloud->point_step * pd.orig_index;
-      get_point_from_data_index(in_cloud, data_index, point_curr);
-      if (j == 0) {
-        bool is_front_side = (point_curr.x > virtual_ground_point.x);
-        if (use_virtual_ground_point_ && is_front_side) {
-          prev_gnd_point = virtual_ground_point;
-        } else {
-          prev_gnd_point = init_ground_point;
-        }
-        prev_gnd_radius = std::hypot(prev_gnd_point.x, prev_gnd_point.y);
-        prev_gnd_slope = 0.0f;
-        ground_cluster.initialize();
-        non_ground_cluster.initialize();
-        points_distance = calcDistance3d(point_curr, prev_gnd_point);
-      } else {
-        points_distance = calcDistance3d(point_curr, point_prev);
-      }
+  float prev_gnd_radius = 0.0f;
+  float prev_gnd_slope = 0.0f;
+  PointsCentroid ground_cluster, non_ground_cluster;
+  PointLabel point_label_curr = PointLabel::INIT;
 
-      float radius_distance_from_gnd = pd.radius - prev_gnd_radius;
-      float height_from_gnd = point_curr.z - prev_gnd_point.z;
-      float height_from_obj = point_curr.z - non_ground_cluster.getAverageHeight();
-      bool calculate_slope = false;
-      bool is_point_close_to_prev =
-        (points_distance <
-         (pd.radius * radial_divider_angle_rad_ + split_points_distance_tolerance_));
-
-      float global_slope_ratio = point_curr.z / pd.radius;
-      // check points which is far enough from previous point
-      if (global_slope_ratio > global_slope_max_ratio_) {
-        point_label_curr = PointLabel::NON_GROUND;
-        calculate_slope = false;
-      } else if (
-        (point_label_prev == PointLabel::NON_GROUND) &&
-        (std::abs(height_from_obj) >= split_height_distance_)) {
-        calculate_slope = true;
-      } else if (is_point_close_to_prev && std::abs(height_from_gnd) < split_height_distance_) {
-        // close to the previous point, set point follow label
-        point_label_curr = PointLabel::POINT_FOLLOW;
-        calculate_slope = false;
+  pcl::PointXYZ prev_gnd_point(0, 0, 0), point_curr, point_prev;
+
+  // iterate over the points in the ray
+  for (size_t j = 0; j < in_radial_ordered_points.size(); ++j) {
+    float points_distance = 0.0f;
+    const float local_slope_max_angle = local_slope_max_angle_rad_;
+
+    // set the previous point
+    point_prev = point_curr;
+    PointLabel point_label_prev = point_label_curr;
+
+    // set the current point
+    const PointData & pd = in_radial_ordered_points[j];
+    point_label_curr = pd.point_state;
+
+    const size_t data_index = in_cloud->point_step * pd.orig_index;
+    get_point_from_data_index(in_cloud, data_index, point_curr);
+    if (j == 0) {
+      bool is_front_side = (point_curr.x > virtual_ground_point.x);
+      if (use_virtual_ground_point_ && is_front_side) {
+        prev_gnd_point = virtual_ground_point;
       } else {
-        calculate_slope = true;
-      }
-      if (is_point_close_to_prev) {
-        height_from_gnd = point_curr.z - ground_cluster.getAverageHeight();
-        radius_distance_from_gnd = pd.radius - ground_cluster.getAverageRadius();
-      }
-      if (calculate_slope) {
-        // far from the previous point
-        auto local_slope = std::atan2(height_from_gnd, radius_distance_from_gnd);
-        if (local_slope - prev_gnd_slope > local_slope_max_angle) {
-          // the point is outside of the local slope threshold
-          point_label_curr = PointLabel::NON_GROUND;
-        } else {
-          point_label_curr = PointLabel::GROUND;
-        }
+        prev_gnd_point = init_ground_point;
       }
+      prev_gnd_radius = std::hypot(prev_gnd_point.x, prev_gnd_point.y);
+      prev_gnd_slope = 0.0f;
+      ground_cluster.initialize();
+      non_ground_cluster.initialize();
+      points_distance = calcDistance3d(point_curr, prev_gnd_point);
+    } else {
+      points_distance = calcDistance3d(point_curr, point_prev);
+    }
 
-      if (point_label_curr == PointLabel::GROUND) {
-        ground_cluster.initialize();
-        non_ground_cluster.initialize();
-      }
-      if (point_label_curr == PointLabel::NON_GROUND) {
-        out_no_ground_indices.indices.push_back(pd.orig_index);
-      } else if (  // NOLINT
-        (point_label_prev == PointLabel::NON_GROUND) &&
-        (point_label_curr == PointLabel::POINT_FOLLOW)) {
+    float radius_distance_from_gnd = pd.radius - prev_gnd_radius;
+    float height_from_gnd = point_curr.z - prev_gnd_point.z;
+    float height_from_obj = point_curr.z - non_ground_cluster.getAverageHeight();
+    bool calculate_slope = false;
+    bool is_point_close_to_prev =
+      (points_distance <
+       (pd.radius * radial_divider_angle_rad_ + split_points_distance_tolerance_));
+
+    float global_slope_ratio = point_curr.z / pd.radius;
+    // check points which is far enough from previous point
+    if (global_slope_ratio > global_slope_max_ratio_) {
+      point_label_curr = PointLabel::NON_GROUND;
+      calculate_slope = false;
+    } else if (
+      (point_label_prev == PointLabel::NON_GROUND) &&
+      (std::abs(height_from_obj) >= split_height_distance_)) {
+      calculate_slope = true;
+    } else if (is_point_close_to_prev && std::abs(height_from_gnd) < split_height_distance_) {
+      // close to the previous point, set point follow label
+      point_label_curr = PointLabel::POINT_FOLLOW;
+      calculate_slope = false;
+    } else {
+      calculate_slope = true;
+    }
+    if (is_point_close_to_prev) {
+      height_from_gnd = point_curr.z - ground_cluster.getAverageHeight();
+      radius_distance_from_gnd = pd.radius - ground_cluster.getAverageRadius();
+    }
+    if (calculate_slope) {
+      // far from the previous point
+      auto local_slope = std::atan2(height_from_gnd, radius_distance_from_gnd);
+      if (local_slope - prev_gnd_slope > local_slope_max_angle) {
+        // the point is outside of the local slope threshold
         point_label_curr = PointLabel::NON_GROUND;
-        out_no_ground_indices.indices.push_back(pd.orig_index);
-      } else if (  // NOLINT
-        (point_label_prev == PointLabel::GROUND) &&
-        (point_label_curr == PointLabel::POINT_FOLLOW)) {
-        point_label_curr = PointLabel::GROUND;
       } else {
+        point_label_curr = PointLabel::GROUND;
       }
+    }
 
-      // update the ground state
-      if (point_label_curr == PointLabel::GROUND) {
-        prev_gnd_radius = pd.radius;
-        prev_gnd_point = pcl::PointXYZ(point_curr.x, point_curr.y, point_curr.z);
-        ground_cluster.addPoint(pd.radius, point_curr.z);
-        prev_gnd_slope = ground_cluster.getAverageSlope();
-      }
-      // update the non ground state
-      if (point_label_curr == PointLabel::NON_GROUND) {
-        non_ground_cluster.addPoint(pd.radius, point_curr.z);
-      }
+    if (point_label_curr == PointLabel::GROUND) {
+      ground_cluster.initialize();
+      non_ground_cluster.initialize();
+    }
+    if (point_label_curr == PointLabel::NON_GROUND) {
+      out_no_ground_indices.indices.push_back(pd.orig_index);
+    } else if (  // NOLINT
+      (point_label_prev == PointLabel::NON_GROUND) &&
+      (point_label_curr == PointLabel::POINT_FOLLOW)) {
+      point_label_curr = PointLabel::NON_GROUND;
+      out_no_ground_indices.indices.push_back(pd.orig_index);
+    } else if (  // NOLINT
+      (point_label_prev == PointLabel::GROUND) &&
+      (point_label_curr == PointLabel::POINT_FOLLOW)) {
+      point_label_curr = PointLabel::GROUND;
+    } else {
+    }
+
+    // update the ground state
+    if (point_label_curr == PointLabel::GROUND) {
+      prev_gnd_radius = pd.radius;
+      prev_gnd_point = pcl::PointXYZ(point_curr.x, point_curr.y, point_curr.z);
+      ground_cluster.addPoint(pd.radius, point_curr.z);
+      prev_gnd_slope = ground_cluster.getAverageSlope();
+    }
+    // update the non ground state
+    if (point_label_curr == PointLabel::NON_GROUND) {
+      non_ground_cluster.addPoint(pd.radius, point_curr.z);
     }
   }
 }
@@ -740,16 +854,26 @@ void ScanGroundFilterComponent::faster_filter(
 
   pcl::PointIndices no_ground_indices;
 
-  if (elevation_grid_mode_) {
+  bool is_filtered_on_gpu = false;
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+  if (elevation_grid_mode_ && cuda_classifier_) {
+    is_filtered_on_gpu = filterOnGpu(input, output);
+  }
+#endif
+  if (is_filtered_on_gpu) {
+    // the non-ground points are already in the output data
+  } else if (elevation_grid_mode_) {
     convertPointcloudGridScan(input, radial_ordered_points);
     classifyPointCloudGridScan(input, radial_ordered_points, no_ground_indices);
   } else {
     convertPointcloud(input, radial_ordered_points);
     classifyPointCloud(input, radial_ordered_points, no_ground_indices);
   }
-  output.row_step = no_ground_indices.indices.size() * input->point_step;
+  const size_t output_points_num = is_filtered_on_gpu ? output.data.size() / input->point_step
+                                                      : no_ground_indices.indices.size();
+  output.row_step = output_points_num * input->point_step;
   output.data.resize(output.row_step);
-  output.width = no_ground_indices.indices.size();
+  output.width = output_points_num;
   output.fields = input->fields;
   output.is_dense = true;
   output.height = input->height;
@@ -757,7 +881,9 @@ void ScanGroundFilterComponent::faster_filter(
   output.point_step = input->point_step;
   output.header = input->header;
 
-  extractObjectPoints(input, no_ground_indices, output);
+  if (!is_filtered_on_gpu) {
+    extractObjectPoints(input, no_ground_indices, output);
+  }
   if (debug_publisher_ptr_ && stop_watch_ptr_) {
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
     const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
@@ -768,6 +894,46 @@ void ScanGroundFilterComponent::faster_filter(
   }
 }
 
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+bool ScanGroundFilterComponent::filterOnGpu(
+  const PointCloud2ConstPtr & in_cloud, PointCloud2 & out_object_cloud) const
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  CudaScanGroundParameters parameters;
+  parameters.x_shift = vehicle_info_.wheel_base_m / 2.0f + center_pcl_shift_;
+  parameters.radial_divider_angle_rad = radial_divider_angle_rad_;
+  parameters.radial_dividers_num = static_cast<uint32_t>(radial_dividers_num_);
+  parameters.global_slope_max_ratio = global_slope_max_ratio_;
+  parameters.local_slope_max_ratio = local_slope_max_ratio_;
+  parameters.split_points_distance_tolerance_square = split_points_distance_tolerance_square_;
+  parameters.non_ground_height_threshold = non_ground_height_threshold_;
+  parameters.low_priority_region_x = low_priority_region_x_;
+  parameters.detection_range_z_max = detection_range_z_max_;
+  parameters.use_recheck_ground_cluster = use_recheck_ground_cluster_;
+  parameters.use_lowest_point = use_lowest_point_;
+  parameters.grid_size_m = grid_size_m_;
+  parameters.grid_mode_switch_radius = grid_mode_switch_radius_;
+  parameters.virtual_lidar_z = virtual_lidar_z_;
+  parameters.gnd_grid_buffer_size = gnd_grid_buffer_size_;
+  parameters.gnd_grid_continual_thresh = gnd_grid_continual_thresh_;
+
+  const CudaPointLayout layout{
+    in_cloud->point_step, static_cast<uint32_t>(data_offset_x_),
+    static_cast<uint32_t>(data_offset_y_), static_cast<uint32_t>(data_offset_z_)};
+  if (!cuda_classifier_->filter(parameters, in_cloud->data, layout, out_object_cloud.data)) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000,
+      "Failed to filter on the GPU (gnd_grid_buffer_size must be in [2, %d]), filtering on the "
+      "CPU instead",
+      CudaScanGroundClassifier::max_gnd_grid_buffer_size);
+    return false;
+  }
+  return true;
+}
+#endif
+
 // TODO(taisa1): Temporary Implementation: Delete this function definition when all the filter
 // nodes conform to new API.
 void ScanGroundFilterComponent::filter(
@@ -835,6 +1001,10 @@ rcl_interfaces::msg::SetParametersResult ScanGroundFilterComponent::onParameter(
       get_logger(),
       "Setting use_recheck_ground_cluster to: " << std::boolalpha << use_recheck_ground_cluster_);
   }
+  if (get_param(param, "num_threads", num_threads_)) {
+    num_threads_ = std::max(num_threads_, 1);
+    RCLCPP_DEBUG(get_logger(), "Setting num_threads to: %d.", num_threads_);
+  }
   rcl_interfaces::msg::SetParametersResult result;
   result.successful = true;
   result.reason = "success";
@@ -21,6 +21,10 @@
 #include "autoware_vehicle_info_utils/vehicle_info.hpp"
 #include "grid.hpp"
 
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+#include "cuda_scan_ground_classifier.hpp"
+#endif
+
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
 #include <pcl/filters/extract_indices.h>
@@ -41,6 +45,7 @@
 #include <vector>
 
 class ScanGroundFilterTest;
+class ScanGroundFilterBenchmark;
 
 namespace autoware::ground_segmentation
 {
@@ -179,6 +184,7 @@ private:
   // common parameters
   float radial_divider_angle_rad_;  // distance in rads between dividers
   size_t radial_dividers_num_;
+  int num_threads_;  // threads to sort and classify the radial sectors in parallel
   VehicleInfo vehicle_info_;
 
   // common thresholds
@@ -209,6 +215,19 @@ private:
   // grid data
   ScanGroundGrid grid_;
 
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+  // classification on the GPU, only for the elevation grid mode
+  std::unique_ptr<CudaScanGroundClassifier> cuda_classifier_;
+
+  /*!
+   * Filter the PointCloud on the GPU in the elevation grid mode
+   * @param[in] in_cloud Input PointCloud
+   * @param[out] out_object_cloud Data of the non-ground points
+   * @retval false the GPU filter failed, and the PointCloud has to be filtered on the CPU
+   */
+  bool filterOnGpu(const PointCloud2ConstPtr & in_cloud, PointCloud2 & out_object_cloud) const;
+#endif
+
   // data access methods
   void set_field_index_offsets(const PointCloud2ConstPtr & input);
   void get_point_from_data_index(
@@ -240,6 +259,11 @@ private:
   void convertPointcloudGridScan(
     const PointCloud2ConstPtr & in_cloud,
     std::vector<PointCloudVector> & out_radial_ordered_points) const;
+  /*!
+   * Sort the points of a radial sector by radius, with a bucket sort over the radius range
+   * @param[in,out] points Points of a radial sector
+   */
+  static void sortByRadius(PointCloudVector & points);
   /*!
    * Output ground center of front wheels as the virtual ground point
    * @param[out] point Virtual ground origin point
@@ -277,6 +301,23 @@ private:
     const PointCloud2ConstPtr & in_cloud,
     const std::vector<PointCloudVector> & in_radial_ordered_clouds,
     pcl::PointIndices & out_no_ground_indices) const;
+  void classifyRadialSector(
+    const PointCloud2ConstPtr & in_cloud, const PointCloudVector & in_radial_ordered_points,
+    pcl::PointIndices & out_no_ground_indices) const;
+  void classifyRadialSectorGridScan(
+    const PointCloud2ConstPtr & in_cloud, const PointCloudVector & in_radial_ordered_points,
+    pcl::PointIndices & out_no_ground_indices) const;
+  /*!
+   * Run the classification of each radial sector, on num_threads_ threads
+   * @param in_radial_ordered_clouds Vector of an Ordered PointsCloud
+   * @param out_no_ground_indices Returns the indices of the points classified as not ground,
+   *     in the order of the sectors whatever the number of threads
+   * @param classify_sector Classification of the points of one sector
+   */
+  template <typename ClassifySectorT>
+  void classifyRadialSectors(
+    const std::vector<PointCloudVector> & in_radial_ordered_clouds,
+    pcl::PointIndices & out_no_ground_indices, const ClassifySectorT & classify_sector) const;
   /*!
    * Re-classifies point of ground cluster based on their height
    * @param gnd_cluster Input ground cluster for re-checking
@@ -315,6 +356,7 @@ public:
 
   // for test
   friend ScanGroundFilterTest;
+  friend ScanGroundFilterBenchmark;
 };
 }  // namespace autoware::ground_segmentation
 
@@ -30,6 +30,13 @@
 
 #include <yaml-cpp/yaml.h>
 
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <array>
+#endif
+
 void convertPCL2PointCloud2(
   const pcl::PointCloud<pcl::PointXYZI> & pcl_cloud, sensor_msgs::msg::PointCloud2 & cloud)
 {
@@ -122,6 +129,8 @@ protected:
     parameters.emplace_back(
       rclcpp::Parameter("use_recheck_ground_cluster", use_recheck_ground_cluster_));
     parameters.emplace_back(rclcpp::Parameter("use_lowest_point", use_lowest_point_));
+    parameters.emplace_back(rclcpp::Parameter("num_threads", num_threads_));
+    parameters.emplace_back(rclcpp::Parameter("use_gpu", use_gpu_));
     parameters.emplace_back(
       rclcpp::Parameter("publish_processing_time_detail", publish_processing_time_detail_));
 
@@ -178,6 +187,22 @@ public:
     scan_ground_filter_->faster_filter(input_msg_ptr_, nullptr, out_cloud, transform_info);
   }
 
+  void set_num_threads(const int num_threads) { scan_ground_filter_->num_threads_ = num_threads; }
+
+  void set_elevation_grid_mode(const bool elevation_grid_mode)
+  {
+    scan_ground_filter_->elevation_grid_mode_ = elevation_grid_mode;
+  }
+
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+  void set_use_gpu(const bool use_gpu)
+  {
+    scan_ground_filter_->cuda_classifier_ =
+      use_gpu ? std::make_unique<autoware::ground_segmentation::CudaScanGroundClassifier>()
+              : nullptr;
+  }
+#endif
+
   void parse_yaml()
   {
     const auto share_dir =
@@ -202,6 +227,8 @@ public:
     radial_divider_angle_deg_ = params["radial_divider_angle_deg"].as<float>();
     use_recheck_ground_cluster_ = params["use_recheck_ground_cluster"].as<bool>();
     use_lowest_point_ = params["use_lowest_point"].as<bool>();
+    num_threads_ = params["num_threads"].as<int>();
+    use_gpu_ = params["use_gpu"].as<bool>();
     publish_processing_time_detail_ = params["publish_processing_time_detail"].as<bool>();
   }
 
@@ -221,6 +248,8 @@ public:
   float radial_divider_angle_deg_;
   bool use_recheck_ground_cluster_;
   bool use_lowest_point_;
+  int num_threads_;
+  bool use_gpu_;
   bool publish_processing_time_detail_;
 };
 
@@ -250,3 +279,63 @@ TEST_F(ScanGroundFilterTest, TestCase1)
   //           << ",percentage:" << percent << std::endl;
   EXPECT_GE(percent, 0.9);
 }
+
+TEST_F(ScanGroundFilterTest, TestMultiThreadSameAsSingleThread)
+{
+  for (const bool elevation_grid_mode : {true, false}) {
+    set_elevation_grid_mode(elevation_grid_mode);
+
+    sensor_msgs::msg::PointCloud2 single_thread_cloud;
+    set_num_threads(1);
+    filter(single_thread_cloud);
+
+    sensor_msgs::msg::PointCloud2 multi_thread_cloud;
+    set_num_threads(4);
+    filter(multi_thread_cloud);
+
+    // the sectors are joined in order, so that even the order of the points is the same
+    EXPECT_EQ(single_thread_cloud.width, multi_thread_cloud.width);
+    EXPECT_EQ(single_thread_cloud.data, multi_thread_cloud.data);
+  }
+}
+
+#ifdef SCAN_GROUND_FILTER_USE_CUDA
+TEST_F(ScanGroundFilterTest, TestGpuSameAsCpu)
+{
+  int num_devices = 0;
+  if (cudaGetDeviceCount(&num_devices) != cudaSuccess || num_devices == 0) {
+    GTEST_SKIP() << "no CUDA device";
+  }
+  set_elevation_grid_mode(true);
+
+  sensor_msgs::msg::PointCloud2 cpu_cloud;
+  set_use_gpu(false);
+  filter(cpu_cloud);
+
+  sensor_msgs::msg::PointCloud2 gpu_cloud;
+  set_use_gpu(true);
+  filter(gpu_cloud);
+
+  // the points of equal radius may be ordered differently, and the device math functions may
+  // round differently, so that a few points near the thresholds may be classified differently
+  const auto to_points = [](const sensor_msgs::msg::PointCloud2 & cloud) {
+    std::vector<std::array<float, 3>> points;
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x"), iter_y(cloud, "y"),
+         iter_z(cloud, "z");
+         iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+      points.push_back({*iter_x, *iter_y, *iter_z});
+    }
+    std::sort(points.begin(), points.end());
+    return points;
+  };
+  const auto cpu_points = to_points(cpu_cloud);
+  const auto gpu_points = to_points(gpu_cloud);
+  std::vector<std::array<float, 3>> common_points;
+  std::set_intersection(
+    cpu_points.begin(), cpu_points.end(), gpu_points.begin(), gpu_points.end(),
+    std::back_inserter(common_points));
+  ASSERT_FALSE(cpu_points.empty());
+  EXPECT_GE(common_points.size(), 0.99 * cpu_points.size());
+  EXPECT_GE(common_points.size(), 0.99 * gpu_points.size());
+}
+#endif
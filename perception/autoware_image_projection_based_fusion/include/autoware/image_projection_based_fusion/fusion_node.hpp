@@ -16,6 +16,7 @@
 #define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__FUSION_NODE_HPP_
 
 #include <autoware/image_projection_based_fusion/debugger.hpp>
+#include <autoware/image_projection_based_fusion/utils/roi_arrival_statistics.hpp>
 #include <autoware/universe_utils/ros/debug_publisher.hpp>
 #include <autoware/universe_utils/system/stop_watch.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -94,6 +95,8 @@ protected:
 
   void timer_callback();
   void setPeriod(const int64_t new_period);
+  void recordRoiDelay(const std::size_t roi_i, const rclcpp::Time & msg_arrival_time);
+  void countUnfusedRois();
 
   std::size_t rois_number_{1};
   tf2_ros::Buffer tf_buffer_;
@@ -126,6 +129,17 @@ protected:
   std::vector<std::map<int64_t, typename Msg2D::ConstSharedPtr>> cached_roi_msgs_;
   std::mutex mutex_cached_msgs_;
 
+  // adaptive timeout from the arrival delay of the rois
+  bool use_adaptive_timeout_{false};
+  double adaptive_timeout_margin_ms_{};
+  double adaptive_timeout_min_ms_{};
+  std::unique_ptr<RoiArrivalStatistics> roi_arrival_statistics_;
+  rclcpp::Time cached_msg_arrival_time_;
+  // the last message published before all rois were fused, to still measure the late rois
+  int64_t unfused_msg_stamp_{-1};
+  rclcpp::Time unfused_msg_arrival_time_;
+  std::vector<bool> is_unfused_roi_pending_;
+
   // output publisher
   typename rclcpp::Publisher<TargetMsg3D>::SharedPtr pub_ptr_;
 
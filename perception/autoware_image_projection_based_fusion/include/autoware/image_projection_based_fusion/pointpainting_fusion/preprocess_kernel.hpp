@@ -18,8 +18,16 @@
 #include <cuda.h>
 #include <cuda_runtime_api.h>
 
+#include <autoware/lidar_centerpoint/preprocess/preprocess_kernel.hpp>
+
 namespace autoware::image_projection_based_fusion
 {
+// transforms all the sweeps into the current frame and decodes their class values to one-hot
+cudaError_t generatePaintedSweepPoints_launch(
+  const autoware::lidar_centerpoint::SweepInfo * sweeps, int num_sweeps, std::size_t points_size,
+  int class_field_index, std::size_t class_size, int num_features, float * output_points,
+  cudaStream_t stream);
+
 cudaError_t generateVoxels_random_launch(
   const float * points, size_t points_size, float min_x_range, float max_x_range, float min_y_range,
   float max_y_range, float min_z_range, float max_z_range, float pillar_x_size, float pillar_y_size,
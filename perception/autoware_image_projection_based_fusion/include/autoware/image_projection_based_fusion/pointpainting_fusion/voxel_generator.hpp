@@ -15,36 +15,22 @@
 #ifndef AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__POINTPAINTING_FUSION__VOXEL_GENERATOR_HPP_
 #define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__POINTPAINTING_FUSION__VOXEL_GENERATOR_HPP_
 
-#include <autoware/image_projection_based_fusion/pointpainting_fusion/pointcloud_densification.hpp>
 #include <autoware/lidar_centerpoint/preprocess/pointcloud_densification.hpp>
 #include <autoware/lidar_centerpoint/preprocess/voxel_generator.hpp>
 
-#include <bitset>
 #include <memory>
 #include <vector>
 
 namespace autoware::image_projection_based_fusion
 {
 
-class VoxelGenerator
+// shares the device-resident densification of lidar_centerpoint, and decodes the painted classes
+class VoxelGenerator : public autoware::lidar_centerpoint::VoxelGeneratorTemplate
 {
 public:
-  explicit VoxelGenerator(
-    const autoware::lidar_centerpoint::DensificationParam & param,
-    const autoware::lidar_centerpoint::CenterPointConfig & config);
+  using autoware::lidar_centerpoint::VoxelGeneratorTemplate::VoxelGeneratorTemplate;
 
-  bool enqueuePointCloud(
-    const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer);
-
-  std::size_t generateSweepPoints(std::vector<float> & points);
-
-protected:
-  std::unique_ptr<PointCloudDensification> pd_ptr_{nullptr};
-
-  autoware::lidar_centerpoint::CenterPointConfig config_;
-  std::array<float, 6> range_;
-  std::array<int, 3> grid_size_;
-  std::array<float, 3> recip_voxel_size_;
+  std::size_t generateSweepPoints(float * points_d, cudaStream_t stream) override;
 };
 }  // namespace autoware::image_projection_based_fusion
 
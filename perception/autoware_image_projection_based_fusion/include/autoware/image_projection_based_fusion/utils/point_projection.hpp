@@ -0,0 +1,137 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__POINT_PROJECTION_HPP_
+#define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__POINT_PROJECTION_HPP_
+
+#define EIGEN_MPL2_ONLY
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/region_of_interest.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::image_projection_based_fusion
+{
+/**
+ * @brief points of a cloud projected into the image of one camera, with an index of the points by
+ * image column
+ */
+struct ProjectedPoints
+{
+  /** @brief index of each projected point in the cloud, in the order of the cloud */
+  std::vector<uint32_t> indices;
+  /** @brief pixel of each projected point */
+  std::vector<double> u;
+  std::vector<double> v;
+  /** @brief z of each projected point in the camera optical frame */
+  std::vector<double> depth;
+
+  void clear()
+  {
+    indices.clear();
+    u.clear();
+    v.clear();
+    depth.clear();
+    column_offsets_.clear();
+    column_order_.clear();
+  }
+
+  std::size_t size() const { return indices.size(); }
+  bool empty() const { return indices.empty(); }
+
+  /** @brief sort the points by image column so that forEachInRoi only scans the columns of a roi */
+  void buildColumnIndex(const uint32_t image_width);
+
+  /**
+   * @brief call f with the position in this container of each point within the roi, borders
+   * included. Within a column the points are visited in the order of the cloud.
+   * @note buildColumnIndex must be called after the points are projected
+   */
+  template <typename F>
+  void forEachInRoi(const sensor_msgs::msg::RegionOfInterest & roi, F && f) const
+  {
+    if (column_offsets_.size() < 2) {
+      return;
+    }
+    const uint32_t num_columns = static_cast<uint32_t>(column_offsets_.size() - 1);
+    const uint32_t max_u = roi.x_offset + roi.width;
+    const uint32_t max_v = roi.y_offset + roi.height;
+    const uint32_t last_column = std::min(max_u, num_columns - 1);
+    for (uint32_t column = roi.x_offset; column <= last_column; ++column) {
+      for (uint32_t i = column_offsets_[column]; i < column_offsets_[column + 1]; ++i) {
+        const uint32_t k = column_order_[i];
+        if (roi.x_offset <= u[k] && u[k] <= max_u && roi.y_offset <= v[k] && v[k] <= max_v) {
+          f(k);
+        }
+      }
+    }
+  }
+
+private:
+  std::vector<uint32_t> column_offsets_;
+  std::vector<uint32_t> column_order_;
+};
+
+/**
+ * @brief projects whole point clouds into the image of a camera
+ *
+ * It gives the same pixels as calcRawImageProjectedPoint, including the distortion when the
+ * points are projected to the unrectified image, but the points are transformed and projected in
+ * one vectorized pass instead of one image_geometry call per point.
+ */
+class CameraProjector
+{
+public:
+  CameraProjector(const sensor_msgs::msg::CameraInfo & camera_info, const bool unrectify);
+
+  /**
+   * @brief project the points of the cloud in front of the camera which fall in the image, i.e. in
+   * the pixels (-1, width) x (-1, height) as the integer pixel casts of the fusion nodes check
+   * @param cloud_to_camera transform from the cloud frame to the camera optical frame
+   */
+  void project(
+    const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Affine3d & cloud_to_camera,
+    ProjectedPoints & projected_points);
+
+private:
+  uint32_t image_width_;
+  uint32_t image_height_;
+  bool distort_{false};
+
+  // rectified projection matrix
+  double fx_{}, fy_{}, cx_{}, cy_{}, tx_{}, ty_{};
+  // raw camera matrix, rectification rotation and distortion coefficients k1, k2, p1, p2, k3, k4,
+  // k5, k6
+  double raw_fx_{}, raw_fy_{}, raw_cx_{}, raw_cy_{};
+  std::array<double, 9> rectification_{};
+  std::array<double, 8> distortion_{};
+
+  // buffers reused between the clouds
+  std::vector<float> x_, y_, z_;
+  std::vector<double> u_, v_, depth_;
+  std::vector<uint8_t> is_in_image_;
+};
+
+}  // namespace autoware::image_projection_based_fusion
+
+#endif  // AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__POINT_PROJECTION_HPP_
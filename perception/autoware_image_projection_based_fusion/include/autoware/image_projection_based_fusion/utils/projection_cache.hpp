@@ -0,0 +1,97 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__PROJECTION_CACHE_HPP_
+#define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__PROJECTION_CACHE_HPP_
+
+#include "autoware/image_projection_based_fusion/utils/point_projection.hpp"
+
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace autoware::image_projection_based_fusion
+{
+/**
+ * @brief projections of point clouds into the cameras, shared by the fusion nodes of a process
+ *
+ * When several fusion nodes run in one component container on the same point cloud, the first
+ * one projecting the cloud into a camera stores the result and the others reuse it. A
+ * projection is reused only for the same camera info, transform and rectification, and for a
+ * cloud with the same stamp, frame, size and sampled points, so that a cloud filtered on the way
+ * to one of the nodes is projected again.
+ */
+class ProjectionCache
+{
+public:
+  using ProjectedPointsConstPtr = std::shared_ptr<const ProjectedPoints>;
+
+  explicit ProjectionCache(const std::size_t capacity) : capacity_(capacity) {}
+
+  /** @brief the cache shared by the fusion nodes of the process */
+  static ProjectionCache & getInstance();
+
+  /**
+   * @brief the points of the cloud projected into the camera, with the column index built
+   * @param cloud_to_camera transform from the cloud frame to the camera optical frame
+   */
+  ProjectedPointsConstPtr project(
+    const sensor_msgs::msg::PointCloud2 & cloud, const sensor_msgs::msg::CameraInfo & camera_info,
+    const Eigen::Affine3d & cloud_to_camera, const bool unrectify);
+
+  std::size_t size() const;
+  void clear();
+
+private:
+  struct Key
+  {
+    int64_t cloud_stamp_ns{0};
+    std::string cloud_frame_id;
+    std::size_t cloud_data_size{0};
+    uint64_t cloud_fingerprint{0};
+    int64_t camera_info_stamp_ns{0};
+    std::string camera_frame_id;
+    bool unrectify{false};
+
+    bool operator==(const Key & other) const
+    {
+      return cloud_stamp_ns == other.cloud_stamp_ns && cloud_data_size == other.cloud_data_size &&
+             cloud_fingerprint == other.cloud_fingerprint &&
+             camera_info_stamp_ns == other.camera_info_stamp_ns && unrectify == other.unrectify &&
+             cloud_frame_id == other.cloud_frame_id && camera_frame_id == other.camera_frame_id;
+    }
+  };
+
+  struct Entry
+  {
+    Key key;
+    Eigen::Matrix4d cloud_to_camera;
+    ProjectedPointsConstPtr projected_points;
+  };
+
+  std::size_t capacity_;
+  mutable std::mutex mutex_;
+  // oldest first
+  std::deque<Entry> entries_;
+};
+
+}  // namespace autoware::image_projection_based_fusion
+
+#endif  // AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__PROJECTION_CACHE_HPP_
@@ -0,0 +1,113 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__ROI_ARRIVAL_STATISTICS_HPP_
+#define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__ROI_ARRIVAL_STATISTICS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace autoware::image_projection_based_fusion
+{
+/**
+ * @brief statistics of how long each camera's rois arrive after the 3d message they are fused with
+ *
+ * The mean and the variance of the delay are exponentially weighted so that the estimate follows
+ * changes of the detector load. They give the time to wait for the rois before publishing a
+ * partially fused message.
+ */
+class RoiArrivalStatistics
+{
+public:
+  /**
+   * @param smoothing_factor weight of a new sample in (0, 1]
+   * @param stddev_ratio number of standard deviations added to the mean delay of a camera
+   */
+  RoiArrivalStatistics(
+    const std::size_t rois_number, const double smoothing_factor, const double stddev_ratio)
+  : smoothing_factor_(std::clamp(smoothing_factor, 1e-3, 1.0)),
+    stddev_ratio_(std::max(stddev_ratio, 0.0)),
+    cameras_(rois_number)
+  {
+  }
+
+  /** @brief add the delay [ms] between the 3d message and the roi of the camera */
+  void addDelay(const std::size_t roi_i, const double delay_ms)
+  {
+    auto & camera = cameras_.at(roi_i);
+    const double delay = std::max(delay_ms, 0.0);
+    if (camera.num_samples == 0) {
+      camera.mean_ms = delay;
+      camera.variance_ms2 = 0.0;
+    } else {
+      // incremental form of the exponentially weighted mean and variance
+      const double diff = delay - camera.mean_ms;
+      const double increment = smoothing_factor_ * diff;
+      camera.mean_ms += increment;
+      camera.variance_ms2 = (1.0 - smoothing_factor_) * (camera.variance_ms2 + diff * increment);
+    }
+    ++camera.num_samples;
+  }
+
+  /** @brief count a message published before the roi of the camera is fused */
+  void addLate(const std::size_t roi_i) { ++cameras_.at(roi_i).late_count; }
+
+  std::size_t lateCount(const std::size_t roi_i) const { return cameras_.at(roi_i).late_count; }
+
+  bool hasEstimate(const std::size_t roi_i) const { return cameras_.at(roi_i).num_samples > 0; }
+
+  /** @brief delay [ms] within which the roi of the camera is expected to arrive */
+  double expectedDelay(const std::size_t roi_i) const
+  {
+    const auto & camera = cameras_.at(roi_i);
+    return camera.mean_ms + stddev_ratio_ * std::sqrt(camera.variance_ms2);
+  }
+
+  /**
+   * @brief time [ms] to wait for the rois of all cameras after receiving a 3d message
+   *
+   * It is the expected delay of the slowest camera plus the margin, within [min_ms, max_ms].
+   * max_ms is returned until every camera has an estimate.
+   */
+  double calcDeadline(const double margin_ms, const double min_ms, const double max_ms) const
+  {
+    double deadline_ms = min_ms;
+    for (std::size_t roi_i = 0; roi_i < cameras_.size(); ++roi_i) {
+      if (!hasEstimate(roi_i)) {
+        return max_ms;
+      }
+      deadline_ms = std::max(deadline_ms, expectedDelay(roi_i) + margin_ms);
+    }
+    return std::clamp(deadline_ms, min_ms, std::max(min_ms, max_ms));
+  }
+
+private:
+  struct CameraStatistics
+  {
+    double mean_ms{0.0};
+    double variance_ms2{0.0};
+    std::size_t num_samples{0};
+    std::size_t late_count{0};
+  };
+
+  double smoothing_factor_;
+  double stddev_ratio_;
+  std::vector<CameraStatistics> cameras_;
+};
+
+}  // namespace autoware::image_projection_based_fusion
+
+#endif  // AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__UTILS__ROI_ARRIVAL_STATISTICS_HPP_
@@ -61,6 +61,12 @@ FusionNode<TargetMsg3D, ObjType, Msg2D>::FusionNode(
   // Set parameters
   match_threshold_ms_ = declare_parameter<double>("match_threshold_ms");
   timeout_ms_ = declare_parameter<double>("timeout_ms");
+  use_adaptive_timeout_ = declare_parameter<bool>("use_adaptive_timeout");
+  adaptive_timeout_margin_ms_ = declare_parameter<double>("adaptive_timeout_margin_ms");
+  adaptive_timeout_min_ms_ = declare_parameter<double>("adaptive_timeout_min_ms");
+  roi_arrival_statistics_ = std::make_unique<RoiArrivalStatistics>(
+    rois_number_, declare_parameter<double>("adaptive_timeout_smoothing_factor"),
+    declare_parameter<double>("adaptive_timeout_stddev_ratio"));
 
   input_rois_topics_.resize(rois_number_);
   input_camera_topics_.resize(rois_number_);
@@ -98,6 +104,7 @@ FusionNode<TargetMsg3D, ObjType, Msg2D>::FusionNode(
   rois_subs_.resize(rois_number_);
   cached_roi_msgs_.resize(rois_number_);
   is_fused_.resize(rois_number_, false);
+  is_unfused_roi_pending_.resize(rois_number_, false);
   for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
     std::function<void(const typename Msg2D::ConstSharedPtr msg)> roi_callback =
       std::bind(&FusionNode::roiCallback, this, std::placeholders::_1, roi_i);
@@ -172,6 +179,7 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::subCallback(
     timer_->cancel();
     postprocess(*(cached_msg_.second));
     publish(*(cached_msg_.second));
+    countUnfusedRois();
     std::fill(is_fused_.begin(), is_fused_.end(), false);
 
     // add processing time for debug
@@ -196,8 +204,19 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::subCallback(
   }
 
   std::lock_guard<std::mutex> lock(mutex_cached_msgs_);
+  cached_msg_arrival_time_ = this->get_clock()->now();
+  // wait only as long as the slowest camera usually needs, but never longer than timeout_ms
+  double timeout_ms = timeout_ms_;
+  if (use_adaptive_timeout_) {
+    timeout_ms = roi_arrival_statistics_->calcDeadline(
+      adaptive_timeout_margin_ms_, adaptive_timeout_min_ms_, timeout_ms_);
+  }
+  if (debug_publisher_) {
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/timeout_ms", timeout_ms);
+  }
   auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
-    std::chrono::duration<double, std::milli>(timeout_ms_));
+    std::chrono::duration<double, std::milli>(timeout_ms));
   try {
     setPeriod(period.count());
   } catch (rclcpp::exceptions::RCLError & ex) {
@@ -256,6 +275,8 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::subCallback(
           camera_info_map_.at(roi_i), *output_msg);
         (cached_roi_msgs_.at(roi_i)).erase(matched_stamp);
         is_fused_.at(roi_i) = true;
+        // the roi was already waiting for the 3d message
+        roi_arrival_statistics_->addDelay(roi_i, 0.0);
 
         // add timestamp interval for debug
         if (debug_publisher_) {
@@ -305,6 +326,16 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::roiCallback(
   int64_t timestamp_nsec =
     (*input_roi_msg).header.stamp.sec * (int64_t)1e9 + (*input_roi_msg).header.stamp.nanosec;
 
+  // measure the rois that arrive after their message has been published without them, so that
+  // the adaptive timeout grows back for a camera that became slower
+  if (unfused_msg_stamp_ != -1 && is_unfused_roi_pending_.at(roi_i)) {
+    int64_t new_stamp = unfused_msg_stamp_ + input_offset_ms_.at(roi_i) * (int64_t)1e6;
+    if (abs(timestamp_nsec - new_stamp) < match_threshold_ms_ * (int64_t)1e6) {
+      recordRoiDelay(roi_i, unfused_msg_arrival_time_);
+      is_unfused_roi_pending_.at(roi_i) = false;
+    }
+  }
+
   // if cached Msg exist, try to match
   if (cached_msg_.second != nullptr) {
     int64_t new_stamp = cached_msg_.first + input_offset_ms_.at(roi_i) * (int64_t)1e6;
@@ -325,6 +356,7 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::roiCallback(
         *(cached_msg_.second), roi_i, *input_roi_msg, camera_info_map_.at(roi_i),
         *(cached_msg_.second));
       is_fused_.at(roi_i) = true;
+      recordRoiDelay(roi_i, cached_msg_arrival_time_);
 
       if (debug_publisher_) {
         double timestamp_interval_ms = (timestamp_nsec - cached_msg_.first) / 1e6;
@@ -380,6 +412,7 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::timer_callback()
 
       postprocess(*(cached_msg_.second));
       publish(*(cached_msg_.second));
+      countUnfusedRois();
 
       // add processing time for debug
       if (debug_publisher_) {
@@ -424,6 +457,38 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::setPeriod(const int64_t new_period)
   }
 }
 
+template <class TargetMsg3D, class Obj, class Msg2D>
+void FusionNode<TargetMsg3D, Obj, Msg2D>::recordRoiDelay(
+  const std::size_t roi_i, const rclcpp::Time & msg_arrival_time)
+{
+  const double delay_ms = (this->get_clock()->now() - msg_arrival_time).seconds() * 1e3;
+  roi_arrival_statistics_->addDelay(roi_i, delay_ms);
+  if (debug_publisher_) {
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/roi" + std::to_string(roi_i) + "/arrival_delay_ms", delay_ms);
+  }
+}
+
+template <class TargetMsg3D, class Obj, class Msg2D>
+void FusionNode<TargetMsg3D, Obj, Msg2D>::countUnfusedRois()
+{
+  // called when the cached message is published, before is_fused_ is cleared
+  unfused_msg_stamp_ = cached_msg_.first;
+  unfused_msg_arrival_time_ = cached_msg_arrival_time_;
+  for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
+    is_unfused_roi_pending_.at(roi_i) = !is_fused_.at(roi_i);
+    if (is_fused_.at(roi_i)) {
+      continue;
+    }
+    roi_arrival_statistics_->addLate(roi_i);
+    if (debug_publisher_) {
+      debug_publisher_->publish<tier4_debug_msgs::msg::Int64Stamped>(
+        "debug/roi" + std::to_string(roi_i) + "/late_count",
+        static_cast<int64_t>(roi_arrival_statistics_->lateCount(roi_i)));
+    }
+  }
+}
+
 template <class TargetMsg3D, class Obj, class Msg2D>
 void FusionNode<TargetMsg3D, Obj, Msg2D>::publish(const TargetMsg3D & output_msg)
 {
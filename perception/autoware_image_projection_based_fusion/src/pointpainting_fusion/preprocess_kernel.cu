@@ -57,6 +57,61 @@ std::size_t divup(const std::size_t a, const std::size_t b)
 
 namespace autoware::image_projection_based_fusion
 {
+__global__ void generatePaintedSweepPoints_kernel(
+  const autoware::lidar_centerpoint::SweepInfo * sweeps, int num_sweeps, size_t points_size,
+  int class_field_index, size_t class_size, int num_features, float * output_points)
+{
+  int point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= points_size) return;
+
+  // there are only a few sweeps, so a linear search is enough
+  int sweep_idx = 0;
+  while (sweep_idx + 1 < num_sweeps && point_idx >= sweeps[sweep_idx + 1].points_offset) {
+    ++sweep_idx;
+  }
+  const autoware::lidar_centerpoint::SweepInfo & sweep = sweeps[sweep_idx];
+  const float * input_point =
+    sweep.points + (point_idx - sweep.points_offset) * sweep.input_point_step;
+  const float * transform_array = sweep.transform;
+  float * output_point = output_points + point_idx * num_features;
+
+  const float input_x = input_point[0];
+  const float input_y = input_point[1];
+  const float input_z = input_point[2];
+
+  // transform_array is expected to be column-major
+  output_point[0] = transform_array[0] * input_x + transform_array[4] * input_y +
+                    transform_array[8] * input_z + transform_array[12];
+  output_point[1] = transform_array[1] * input_x + transform_array[5] * input_y +
+                    transform_array[9] * input_z + transform_array[13];
+  output_point[2] = transform_array[2] * input_x + transform_array[6] * input_y +
+                    transform_array[10] * input_z + transform_array[14];
+  output_point[3] = sweep.time_lag;
+
+  // decode the class value back to one-hot binary
+  const auto class_value = static_cast<unsigned int>(input_point[class_field_index]);
+  for (size_t i = 0; i < class_size; ++i) {
+    output_point[4 + i] = static_cast<float>((class_value >> i) & 1U);
+  }
+}
+
+cudaError_t generatePaintedSweepPoints_launch(
+  const autoware::lidar_centerpoint::SweepInfo * sweeps, int num_sweeps, size_t points_size,
+  int class_field_index, size_t class_size, int num_features, float * output_points,
+  cudaStream_t stream)
+{
+  if (points_size == 0) {
+    return cudaGetLastError();
+  }
+
+  dim3 blocks((points_size + 256 - 1) / 256);
+  dim3 threads(256);
+  generatePaintedSweepPoints_kernel<<<blocks, threads, 0, stream>>>(
+    sweeps, num_sweeps, points_size, class_field_index, class_size, num_features, output_points);
+  cudaError_t err = cudaGetLastError();
+  return err;
+}
+
 __global__ void generateVoxels_random_kernel(
   const float * points, size_t points_size, float min_x_range, float max_x_range, float min_y_range,
   float max_y_range, float min_z_range, float max_z_range, float pillar_x_size, float pillar_y_size,
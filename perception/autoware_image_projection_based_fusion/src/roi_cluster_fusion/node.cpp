@@ -15,6 +15,7 @@
 #include "autoware/image_projection_based_fusion/roi_cluster_fusion/node.hpp"
 
 #include <autoware/image_projection_based_fusion/utils/geometry.hpp>
+#include <autoware/image_projection_based_fusion/utils/point_projection.hpp>
 #include <autoware/image_projection_based_fusion/utils/utils.hpp>
 
 #include <sensor_msgs/msg/point_cloud2.hpp>
@@ -85,9 +86,6 @@ void RoiClusterFusionNode::fuseOnSingleImage(
 {
   if (!checkCameraInfo(camera_info)) return;
 
-  image_geometry::PinholeCameraModel pinhole_camera_model;
-  pinhole_camera_model.fromCameraInfo(camera_info);
-
   // get transform from cluster frame id to camera optical frame id
   geometry_msgs::msg::TransformStamped transform_stamped;
   {
@@ -103,6 +101,10 @@ void RoiClusterFusionNode::fuseOnSingleImage(
     transform_stamped = transform_stamped_optional.value();
   }
 
+  const Eigen::Affine3d cluster_to_camera = transformToEigen(transform_stamped.transform);
+  CameraProjector camera_projector(camera_info, point_project_to_unrectified_image_);
+  ProjectedPoints projected_points;
+
   std::map<std::size_t, RegionOfInterest> m_cluster_roi;
   for (std::size_t i = 0; i < input_cluster_msg.feature_objects.size(); ++i) {
     if (input_cluster_msg.feature_objects.at(i).feature.cluster.data.empty()) {
@@ -118,39 +120,24 @@ void RoiClusterFusionNode::fuseOnSingleImage(
       continue;
     }
 
-    sensor_msgs::msg::PointCloud2 transformed_cluster;
-    tf2::doTransform(
-      input_cluster_msg.feature_objects.at(i).feature.cluster, transformed_cluster,
-      transform_stamped);
+    camera_projector.project(
+      input_cluster_msg.feature_objects.at(i).feature.cluster, cluster_to_camera,
+      projected_points);
+    if (projected_points.empty()) {
+      continue;
+    }
 
     int min_x(camera_info.width), min_y(camera_info.height), max_x(0), max_y(0);
-    std::vector<Eigen::Vector2d> projected_points;
-    projected_points.reserve(transformed_cluster.data.size());
-    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(transformed_cluster, "x"),
-         iter_y(transformed_cluster, "y"), iter_z(transformed_cluster, "z");
-         iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-      if (*iter_z <= 0.0) {
-        continue;
+    for (std::size_t k = 0; k < projected_points.size(); ++k) {
+      const int u = static_cast<int>(projected_points.u[k]);
+      const int v = static_cast<int>(projected_points.v[k]);
+      min_x = std::min(u, min_x);
+      min_y = std::min(v, min_y);
+      max_x = std::max(u, max_x);
+      max_y = std::max(v, max_y);
+      if (debugger_) {
+        debugger_->obstacle_points_.emplace_back(projected_points.u[k], projected_points.v[k]);
       }
-
-      Eigen::Vector2d projected_point = calcRawImageProjectedPoint(
-        pinhole_camera_model, cv::Point3d(*iter_x, *iter_y, *iter_z),
-        point_project_to_unrectified_image_);
-      if (
-        0 <= static_cast<int>(projected_point.x()) &&
-        static_cast<int>(projected_point.x()) <= static_cast<int>(camera_info.width) - 1 &&
-        0 <= static_cast<int>(projected_point.y()) &&
-        static_cast<int>(projected_point.y()) <= static_cast<int>(camera_info.height) - 1) {
-        min_x = std::min(static_cast<int>(projected_point.x()), min_x);
-        min_y = std::min(static_cast<int>(projected_point.y()), min_y);
-        max_x = std::max(static_cast<int>(projected_point.x()), max_x);
-        max_y = std::max(static_cast<int>(projected_point.y()), max_y);
-        projected_points.push_back(projected_point);
-        if (debugger_) debugger_->obstacle_points_.push_back(projected_point);
-      }
-    }
-    if (projected_points.empty()) {
-      continue;
     }
 
     sensor_msgs::msg::RegionOfInterest roi;
@@ -15,6 +15,7 @@
 #include "autoware/image_projection_based_fusion/roi_pointcloud_fusion/node.hpp"
 
 #include "autoware/image_projection_based_fusion/utils/geometry.hpp"
+#include "autoware/image_projection_based_fusion/utils/projection_cache.hpp"
 #include "autoware/image_projection_based_fusion/utils/utils.hpp"
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -27,6 +28,10 @@
 
 #include "autoware/euclidean_cluster/utils.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 namespace autoware::image_projection_based_fusion
 {
 RoiPointCloudFusionNode::RoiPointCloudFusionNode(const rclcpp::NodeOptions & options)
@@ -102,10 +107,6 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     return;
   }
 
-  // transform pointcloud to camera optical frame id
-  image_geometry::PinholeCameraModel pinhole_camera_model;
-  pinhole_camera_model.fromCameraInfo(camera_info);
-
   geometry_msgs::msg::TransformStamped transform_stamped;
   {
     const auto transform_stamped_optional = getTransformStamped(
@@ -116,13 +117,14 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     }
     transform_stamped = transform_stamped_optional.value();
   }
-  int point_step = input_pointcloud_msg.point_step;
-  int x_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "x")].offset;
-  int y_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "y")].offset;
-  int z_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "z")].offset;
+  const int point_step = input_pointcloud_msg.point_step;
 
-  sensor_msgs::msg::PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
+  // project the whole pointcloud at once, then only scan the image columns of each roi. The
+  // projection is shared with the other fusion nodes of the container on the same pointcloud.
+  const auto projected_points_ptr = ProjectionCache::getInstance().project(
+    input_pointcloud_msg, camera_info, transformToEigen(transform_stamped.transform),
+    point_project_to_unrectified_image_);
+  const auto & projected_points = *projected_points_ptr;
 
   std::vector<sensor_msgs::msg::PointCloud2> clusters;
   std::vector<size_t> clusters_data_size;
@@ -134,37 +136,24 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     cluster.data.resize(max_cluster_size_ * input_pointcloud_msg.point_step);
     clusters_data_size.push_back(0);
   }
-  for (size_t offset = 0; offset < input_pointcloud_msg.data.size(); offset += point_step) {
-    const float transformed_x =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + x_offset]);
-    const float transformed_y =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + y_offset]);
-    const float transformed_z =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + z_offset]);
-    if (transformed_z <= 0.0) {
-      continue;
-    }
-    Eigen::Vector2d projected_point = calcRawImageProjectedPoint(
-      pinhole_camera_model, cv::Point3d(transformed_x, transformed_y, transformed_z),
-      point_project_to_unrectified_image_);
-    for (std::size_t i = 0; i < output_objs.size(); ++i) {
-      auto & feature_obj = output_objs.at(i);
-      const auto & check_roi = feature_obj.feature.roi;
-      auto & cluster = clusters.at(i);
-
-      if (
-        clusters_data_size.at(i) >=
-        static_cast<size_t>(max_cluster_size_) * static_cast<size_t>(point_step)) {
-        continue;
-      }
-      if (
-        check_roi.x_offset <= projected_point.x() && check_roi.y_offset <= projected_point.y() &&
-        check_roi.x_offset + check_roi.width >= projected_point.x() &&
-        check_roi.y_offset + check_roi.height >= projected_point.y()) {
-        std::memcpy(
-          &cluster.data[clusters_data_size.at(i)], &input_pointcloud_msg.data[offset], point_step);
-        clusters_data_size.at(i) += point_step;
-      }
+  std::vector<uint32_t> roi_point_indices;
+  for (std::size_t i = 0; i < output_objs.size(); ++i) {
+    roi_point_indices.clear();
+    projected_points.forEachInRoi(output_objs.at(i).feature.roi, [&](const std::size_t k) {
+      roi_point_indices.push_back(projected_points.indices[k]);
+    });
+    // keep the first points of the pointcloud when the cluster is full
+    std::sort(roi_point_indices.begin(), roi_point_indices.end());
+    const std::size_t num_cluster_points =
+      std::min(roi_point_indices.size(), static_cast<std::size_t>(max_cluster_size_));
+
+    auto & cluster = clusters.at(i);
+    for (std::size_t j = 0; j < num_cluster_points; ++j) {
+      std::memcpy(
+        &cluster.data[clusters_data_size.at(i)],
+        &input_pointcloud_msg.data[static_cast<std::size_t>(roi_point_indices[j]) * point_step],
+        point_step);
+      clusters_data_size.at(i) += point_step;
     }
   }
 
@@ -15,6 +15,7 @@
 #include "autoware/image_projection_based_fusion/segmentation_pointcloud_fusion/node.hpp"
 
 #include "autoware/image_projection_based_fusion/utils/geometry.hpp"
+#include "autoware/image_projection_based_fusion/utils/projection_cache.hpp"
 #include "autoware/image_projection_based_fusion/utils/utils.hpp"
 
 #include <perception_utils/run_length_encoder.hpp>
@@ -100,9 +101,6 @@ void SegmentPointCloudFusionNode::fuseOnSingleImage(
   const int orig_height = camera_info.height;
   // resize mask to the same size as the camera image
   cv::resize(mask, mask, cv::Size(orig_width, orig_height), 0, 0, cv::INTER_NEAREST);
-  image_geometry::PinholeCameraModel pinhole_camera_model;
-  pinhole_camera_model.fromCameraInfo(camera_info);
-
   geometry_msgs::msg::TransformStamped transform_stamped;
   // transform pointcloud from frame id to camera optical frame id
   {
@@ -115,47 +113,37 @@ void SegmentPointCloudFusionNode::fuseOnSingleImage(
     transform_stamped = transform_stamped_optional.value();
   }
 
-  PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
-
-  int point_step = input_pointcloud_msg.point_step;
-  int x_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "x")].offset;
-  int y_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "y")].offset;
-  int z_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "z")].offset;
+  // the projection is shared with the other fusion nodes of the container on the same pointcloud
+  const auto projected_points_ptr = ProjectionCache::getInstance().project(
+    input_pointcloud_msg, camera_info, transformToEigen(transform_stamped.transform),
+    point_project_to_unrectified_image_);
+  const auto & projected_points = *projected_points_ptr;
 
-  for (size_t global_offset = 0; global_offset < transformed_cloud.data.size();
-       global_offset += point_step) {
-    float transformed_x =
-      *reinterpret_cast<float *>(&transformed_cloud.data[global_offset + x_offset]);
-    float transformed_y =
-      *reinterpret_cast<float *>(&transformed_cloud.data[global_offset + y_offset]);
-    float transformed_z =
-      *reinterpret_cast<float *>(&transformed_cloud.data[global_offset + z_offset]);
-    // skip filtering pointcloud behind the camera or too far from camera
-    if (transformed_z <= 0.0 || transformed_z > filter_distance_threshold_) {
+  const size_t point_step = input_pointcloud_msg.point_step;
+  for (size_t k = 0; k < projected_points.size(); ++k) {
+    // skip filtering pointcloud too far from camera, the points behind it are not projected
+    if (projected_points.depth[k] > filter_distance_threshold_) {
       continue;
     }
 
-    Eigen::Vector2d projected_point = calcRawImageProjectedPoint(
-      pinhole_camera_model, cv::Point3d(transformed_x, transformed_y, transformed_z),
-      point_project_to_unrectified_image_);
-
-    bool is_inside_image = projected_point.x() > 0 && projected_point.x() < camera_info.width &&
-                           projected_point.y() > 0 && projected_point.y() < camera_info.height;
+    const double projected_x = projected_points.u[k];
+    const double projected_y = projected_points.v[k];
+    bool is_inside_image = projected_x > 0 && projected_x < camera_info.width && projected_y > 0 &&
+                           projected_y < camera_info.height;
     if (!is_inside_image) {
       continue;
     }
 
     // skip filtering pointcloud where semantic id out of the defined list
-    uint8_t semantic_id = mask.at<uint8_t>(
-      static_cast<uint16_t>(projected_point.y()), static_cast<uint16_t>(projected_point.x()));
+    uint8_t semantic_id =
+      mask.at<uint8_t>(static_cast<uint16_t>(projected_y), static_cast<uint16_t>(projected_x));
     if (
       static_cast<size_t>(semantic_id) >= filter_semantic_label_target_list_.size() ||
       !filter_semantic_label_target_list_.at(semantic_id).second) {
       continue;
     }
 
-    filter_global_offset_set_.insert(global_offset);
+    filter_global_offset_set_.insert(projected_points.indices[k] * point_step);
   }
 }
 
@@ -0,0 +1,176 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/utils/point_projection.hpp"
+
+#include <image_geometry/pinhole_camera_model.h>
+
+#include <cstring>
+#include <string>
+
+namespace autoware::image_projection_based_fusion
+{
+void ProjectedPoints::buildColumnIndex(const uint32_t image_width)
+{
+  // counting sort by column, which keeps the order of the cloud within each column
+  const uint32_t num_columns = std::max<uint32_t>(image_width, 1);
+  const auto to_column = [num_columns](const double u) {
+    return static_cast<uint32_t>(std::clamp(u, 0.0, static_cast<double>(num_columns - 1)));
+  };
+  column_offsets_.assign(num_columns + 1, 0);
+  for (const double point_u : u) {
+    ++column_offsets_[to_column(point_u) + 1];
+  }
+  for (uint32_t column = 0; column < num_columns; ++column) {
+    column_offsets_[column + 1] += column_offsets_[column];
+  }
+  column_order_.resize(size());
+  std::vector<uint32_t> next(column_offsets_.begin(), column_offsets_.end() - 1);
+  for (uint32_t k = 0; k < size(); ++k) {
+    column_order_[next[to_column(u[k])]++] = k;
+  }
+}
+
+CameraProjector::CameraProjector(
+  const sensor_msgs::msg::CameraInfo & camera_info, const bool unrectify)
+: image_width_(camera_info.width), image_height_(camera_info.height)
+{
+  // take the matrices from image_geometry so that the binning and the roi of the camera info are
+  // handled the same way
+  image_geometry::PinholeCameraModel pinhole_camera_model;
+  pinhole_camera_model.fromCameraInfo(camera_info);
+  fx_ = pinhole_camera_model.fx();
+  fy_ = pinhole_camera_model.fy();
+  cx_ = pinhole_camera_model.cx();
+  cy_ = pinhole_camera_model.cy();
+  tx_ = pinhole_camera_model.Tx();
+  ty_ = pinhole_camera_model.Ty();
+
+  const cv::Matx33d & raw_camera_matrix = pinhole_camera_model.intrinsicMatrix();
+  raw_fx_ = raw_camera_matrix(0, 0);
+  raw_fy_ = raw_camera_matrix(1, 1);
+  raw_cx_ = raw_camera_matrix(0, 2);
+  raw_cy_ = raw_camera_matrix(1, 2);
+  const cv::Matx33d & rectification = pinhole_camera_model.rotationMatrix();
+  for (int i = 0; i < 9; ++i) {
+    rectification_[i] = rectification(i / 3, i % 3);
+  }
+
+  // image_geometry does not unrectify the points when all the coefficients are zero
+  const cv::Mat_<double> & distortion = pinhole_camera_model.distortionCoeffs();
+  const std::size_t num_coefficients = std::min<std::size_t>(distortion.total(), 8);
+  for (std::size_t i = 0; i < num_coefficients; ++i) {
+    distortion_[i] = distortion(static_cast<int>(i));
+    distort_ = distort_ || distortion_[i] != 0.0;
+  }
+  distort_ = unrectify && distort_;
+}
+
+void CameraProjector::project(
+  const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Affine3d & cloud_to_camera,
+  ProjectedPoints & projected_points)
+{
+  projected_points.clear();
+  if (cloud.point_step == 0) {
+    return;
+  }
+  int x_offset = -1;
+  int y_offset = -1;
+  int z_offset = -1;
+  for (const auto & field : cloud.fields) {
+    if (field.name == "x") x_offset = static_cast<int>(field.offset);
+    if (field.name == "y") y_offset = static_cast<int>(field.offset);
+    if (field.name == "z") z_offset = static_cast<int>(field.offset);
+  }
+  if (x_offset < 0 || y_offset < 0 || z_offset < 0) {
+    return;
+  }
+
+  // gather the coordinates so that the projection below runs on contiguous arrays
+  const std::size_t num_points = cloud.data.size() / cloud.point_step;
+  x_.resize(num_points);
+  y_.resize(num_points);
+  z_.resize(num_points);
+  u_.resize(num_points);
+  v_.resize(num_points);
+  depth_.resize(num_points);
+  is_in_image_.resize(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const uint8_t * point = &cloud.data[i * cloud.point_step];
+    std::memcpy(&x_[i], point + x_offset, sizeof(float));
+    std::memcpy(&y_[i], point + y_offset, sizeof(float));
+    std::memcpy(&z_[i], point + z_offset, sizeof(float));
+  }
+
+  const Eigen::Matrix4d & m = cloud_to_camera.matrix();
+  const double m00 = m(0, 0), m01 = m(0, 1), m02 = m(0, 2), m03 = m(0, 3);
+  const double m10 = m(1, 0), m11 = m(1, 1), m12 = m(1, 2), m13 = m(1, 3);
+  const double m20 = m(2, 0), m21 = m(2, 1), m22 = m(2, 2), m23 = m(2, 3);
+  const double width = static_cast<double>(image_width_);
+  const double height = static_cast<double>(image_height_);
+  const float * xs = x_.data();
+  const float * ys = y_.data();
+  const float * zs = z_.data();
+  double * us = u_.data();
+  double * vs = v_.data();
+  double * depths = depth_.data();
+  uint8_t * is_in_image = is_in_image_.data();
+
+  // same formulas as image_geometry::PinholeCameraModel::project3dToPixel and unrectifyPoint
+#pragma omp simd
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const double x = m00 * xs[i] + m01 * ys[i] + m02 * zs[i] + m03;
+    const double y = m10 * xs[i] + m11 * ys[i] + m12 * zs[i] + m13;
+    const double z = m20 * xs[i] + m21 * ys[i] + m22 * zs[i] + m23;
+    double u = (fx_ * x + tx_) / z + cx_;
+    double v = (fy_ * y + ty_) / z + cy_;
+    if (distort_) {
+      const double ray_x = (u - cx_ - tx_) / fx_;
+      const double ray_y = (v - cy_ - ty_) / fy_;
+      // rotate back to the raw camera with the transposed rectification
+      const double rx = rectification_[0] * ray_x + rectification_[3] * ray_y + rectification_[6];
+      const double ry = rectification_[1] * ray_x + rectification_[4] * ray_y + rectification_[7];
+      const double rw = rectification_[2] * ray_x + rectification_[5] * ray_y + rectification_[8];
+      const double xp = rx / rw;
+      const double yp = ry / rw;
+      const double r2 = xp * xp + yp * yp;
+      const double r4 = r2 * r2;
+      const double r6 = r4 * r2;
+      const double a1 = 2.0 * xp * yp;
+      const double radial =
+        (1.0 + distortion_[0] * r2 + distortion_[1] * r4 + distortion_[4] * r6) /
+        (1.0 + distortion_[5] * r2 + distortion_[6] * r4 + distortion_[7] * r6);
+      const double xpp = xp * radial + distortion_[2] * a1 + distortion_[3] * (r2 + 2.0 * xp * xp);
+      const double ypp = yp * radial + distortion_[2] * (r2 + 2.0 * yp * yp) + distortion_[3] * a1;
+      u = xpp * raw_fx_ + raw_cx_;
+      v = ypp * raw_fy_ + raw_cy_;
+    }
+    us[i] = u;
+    vs[i] = v;
+    depths[i] = z;
+    is_in_image[i] = z > 0.0 && u > -1.0 && u < width && v > -1.0 && v < height;
+  }
+
+  for (std::size_t i = 0; i < num_points; ++i) {
+    if (!is_in_image[i]) {
+      continue;
+    }
+    projected_points.indices.push_back(static_cast<uint32_t>(i));
+    projected_points.u.push_back(us[i]);
+    projected_points.v.push_back(vs[i]);
+    projected_points.depth.push_back(depths[i]);
+  }
+}
+
+}  // namespace autoware::image_projection_based_fusion
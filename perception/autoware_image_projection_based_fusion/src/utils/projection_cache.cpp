@@ -0,0 +1,110 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/utils/projection_cache.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace autoware::image_projection_based_fusion
+{
+namespace
+{
+// two frames of eight cameras, so that a node lagging one frame behind still hits the cache
+constexpr std::size_t shared_cache_capacity = 16;
+
+int64_t toNanoseconds(const builtin_interfaces::msg::Time & stamp)
+{
+  return static_cast<int64_t>(stamp.sec) * 1000000000LL + static_cast<int64_t>(stamp.nanosec);
+}
+
+// FNV-1a hash of some points spread over the cloud, cheap compared to the projection
+uint64_t calcFingerprint(const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  constexpr std::size_t num_samples = 64;
+  uint64_t hash = 14695981039346656037ULL;
+  if (cloud.point_step == 0) {
+    return hash;
+  }
+  const std::size_t num_points = cloud.data.size() / cloud.point_step;
+  const std::size_t stride = std::max<std::size_t>(num_points / num_samples, 1);
+  for (std::size_t i = 0; i < num_points; i += stride) {
+    const uint8_t * point = &cloud.data[i * cloud.point_step];
+    for (std::size_t j = 0; j < cloud.point_step; ++j) {
+      hash = (hash ^ point[j]) * 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+}  // namespace
+
+ProjectionCache & ProjectionCache::getInstance()
+{
+  static ProjectionCache cache(shared_cache_capacity);
+  return cache;
+}
+
+ProjectionCache::ProjectedPointsConstPtr ProjectionCache::project(
+  const sensor_msgs::msg::PointCloud2 & cloud, const sensor_msgs::msg::CameraInfo & camera_info,
+  const Eigen::Affine3d & cloud_to_camera, const bool unrectify)
+{
+  Key key;
+  key.cloud_stamp_ns = toNanoseconds(cloud.header.stamp);
+  key.cloud_frame_id = cloud.header.frame_id;
+  key.cloud_data_size = cloud.data.size();
+  key.cloud_fingerprint = calcFingerprint(cloud);
+  key.camera_info_stamp_ns = toNanoseconds(camera_info.header.stamp);
+  key.camera_frame_id = camera_info.header.frame_id;
+  key.unrectify = unrectify;
+  const auto is_same = [&](const Entry & entry) {
+    return entry.key == key && entry.cloud_to_camera == cloud_to_camera.matrix();
+  };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = std::find_if(entries_.begin(), entries_.end(), is_same);
+    if (it != entries_.end()) {
+      return it->projected_points;
+    }
+  }
+
+  // project without the lock so that the other nodes are not blocked
+  auto projected_points = std::make_shared<ProjectedPoints>();
+  CameraProjector camera_projector(camera_info, unrectify);
+  camera_projector.project(cloud, cloud_to_camera, *projected_points);
+  projected_points->buildColumnIndex(camera_info.width);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  // another node may have projected the same cloud in the meantime
+  if (std::none_of(entries_.begin(), entries_.end(), is_same) && capacity_ > 0) {
+    entries_.push_back(Entry{std::move(key), cloud_to_camera.matrix(), projected_points});
+    while (entries_.size() > capacity_) {
+      entries_.pop_front();
+    }
+  }
+  return projected_points;
+}
+
+std::size_t ProjectionCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+void ProjectionCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+}  // namespace autoware::image_projection_based_fusion
@@ -0,0 +1,180 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/utils/point_projection.hpp"
+#include "autoware/image_projection_based_fusion/utils/utils.hpp"
+
+#include <sensor_msgs/distortion_models.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using autoware::image_projection_based_fusion::calcRawImageProjectedPoint;
+using autoware::image_projection_based_fusion::CameraProjector;
+using autoware::image_projection_based_fusion::ProjectedPoints;
+
+namespace
+{
+sensor_msgs::msg::CameraInfo createCameraInfo(const std::vector<double> & d)
+{
+  sensor_msgs::msg::CameraInfo camera_info;
+  camera_info.width = 640;
+  camera_info.height = 480;
+  camera_info.distortion_model = d.size() == 8 ? sensor_msgs::distortion_models::RATIONAL_POLYNOMIAL
+                                               : sensor_msgs::distortion_models::PLUMB_BOB;
+  camera_info.d = d;
+  camera_info.k = {500.0, 0.0, 320.0, 0.0, 510.0, 240.0, 0.0, 0.0, 1.0};
+  camera_info.r = {0.9998, 0.0100, -0.0200, -0.0098, 0.9999, 0.0100, 0.0201, -0.0098, 0.9997};
+  camera_info.p = {480.0, 0.0, 318.0, 0.0, 0.0, 490.0, 242.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+  return camera_info;
+}
+
+sensor_msgs::msg::PointCloud2 createPointCloud(const std::vector<Eigen::Vector3f> & points)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.fields.resize(3);
+  const char * names[] = {"x", "y", "z"};
+  for (std::size_t i = 0; i < 3; ++i) {
+    cloud.fields[i].name = names[i];
+    cloud.fields[i].offset = static_cast<uint32_t>(4 * i);
+    cloud.fields[i].datatype = sensor_msgs::msg::PointField::FLOAT32;
+    cloud.fields[i].count = 1;
+  }
+  cloud.height = 1;
+  cloud.width = static_cast<uint32_t>(points.size());
+  cloud.point_step = 16;
+  cloud.row_step = cloud.point_step * cloud.width;
+  cloud.data.resize(cloud.row_step);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    std::memcpy(&cloud.data[i * cloud.point_step], points[i].data(), 3 * sizeof(float));
+  }
+  return cloud;
+}
+
+std::vector<Eigen::Vector3f> createPoints()
+{
+  std::vector<Eigen::Vector3f> points;
+  for (int i = 0; i < 2000; ++i) {
+    points.emplace_back(
+      0.5f * static_cast<float>(i % 37 - 18), 0.5f * static_cast<float>(i % 23 - 11),
+      static_cast<float>(i % 11 - 2));
+  }
+  return points;
+}
+
+void expectSameAsImageGeometry(
+  const sensor_msgs::msg::CameraInfo & camera_info, const bool unrectify)
+{
+  const auto points = createPoints();
+  const auto cloud = createPointCloud(points);
+  Eigen::Affine3d cloud_to_camera = Eigen::Affine3d::Identity();
+  cloud_to_camera.translate(Eigen::Vector3d(0.1, -0.2, 0.3));
+  cloud_to_camera.rotate(Eigen::AngleAxisd(0.05, Eigen::Vector3d::UnitY()));
+
+  CameraProjector camera_projector(camera_info, unrectify);
+  ProjectedPoints projected_points;
+  camera_projector.project(cloud, cloud_to_camera, projected_points);
+
+  image_geometry::PinholeCameraModel pinhole_camera_model;
+  pinhole_camera_model.fromCameraInfo(camera_info);
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const Eigen::Vector3d point = cloud_to_camera * points[i].cast<double>();
+    if (point.z() <= 0.0) {
+      continue;
+    }
+    const Eigen::Vector2d expected = calcRawImageProjectedPoint(
+      pinhole_camera_model, cv::Point3d(point.x(), point.y(), point.z()), unrectify);
+    const int u = static_cast<int>(expected.x());
+    const int v = static_cast<int>(expected.y());
+    if (
+      u < 0 || u > static_cast<int>(camera_info.width) - 1 || v < 0 ||
+      v > static_cast<int>(camera_info.height) - 1) {
+      continue;
+    }
+    ASSERT_LT(k, projected_points.size());
+    EXPECT_EQ(projected_points.indices[k], i);
+    EXPECT_NEAR(projected_points.u[k], expected.x(), 1e-6);
+    EXPECT_NEAR(projected_points.v[k], expected.y(), 1e-6);
+    ++k;
+  }
+  EXPECT_EQ(k, projected_points.size());
+  EXPECT_GT(k, 0u);
+}
+}  // namespace
+
+TEST(PointProjectionTest, RectifiedImage)
+{
+  expectSameAsImageGeometry(createCameraInfo({-0.3, 0.1, 0.001, -0.002, 0.01}), false);
+}
+
+TEST(PointProjectionTest, PlumbBobDistortion)
+{
+  expectSameAsImageGeometry(createCameraInfo({-0.3, 0.1, 0.001, -0.002, 0.01}), true);
+}
+
+TEST(PointProjectionTest, RationalPolynomialDistortion)
+{
+  expectSameAsImageGeometry(
+    createCameraInfo({-0.3, 0.1, 0.001, -0.002, 0.01, 0.05, 0.01, 0.001}), true);
+}
+
+TEST(PointProjectionTest, NoDistortion)
+{
+  expectSameAsImageGeometry(createCameraInfo({0.0, 0.0, 0.0, 0.0, 0.0}), true);
+}
+
+TEST(PointProjectionTest, ForEachInRoi)
+{
+  const auto camera_info = createCameraInfo({-0.3, 0.1, 0.001, -0.002, 0.01});
+  const auto cloud = createPointCloud(createPoints());
+  CameraProjector camera_projector(camera_info, true);
+  ProjectedPoints projected_points;
+  camera_projector.project(cloud, Eigen::Affine3d::Identity(), projected_points);
+  projected_points.buildColumnIndex(camera_info.width);
+
+  sensor_msgs::msg::RegionOfInterest roi;
+  roi.x_offset = 100;
+  roi.y_offset = 50;
+  roi.width = 300;
+  roi.height = 250;
+  std::vector<std::size_t> expected;
+  for (std::size_t k = 0; k < projected_points.size(); ++k) {
+    if (
+      roi.x_offset <= projected_points.u[k] && projected_points.u[k] <= roi.x_offset + roi.width &&
+      roi.y_offset <= projected_points.v[k] && projected_points.v[k] <= roi.y_offset + roi.height) {
+      expected.push_back(k);
+    }
+  }
+  std::vector<std::size_t> in_roi;
+  projected_points.forEachInRoi(roi, [&](const std::size_t k) { in_roi.push_back(k); });
+  std::sort(in_roi.begin(), in_roi.end());
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(in_roi, expected);
+
+  // a roi out of the image has no point
+  roi.x_offset = camera_info.width;
+  in_roi.clear();
+  projected_points.forEachInRoi(roi, [&](const std::size_t k) { in_roi.push_back(k); });
+  EXPECT_TRUE(in_roi.empty());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
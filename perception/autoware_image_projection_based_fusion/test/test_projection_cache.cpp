@@ -0,0 +1,105 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/utils/projection_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using autoware::image_projection_based_fusion::ProjectionCache;
+
+namespace
+{
+sensor_msgs::msg::CameraInfo createCameraInfo()
+{
+  sensor_msgs::msg::CameraInfo camera_info;
+  camera_info.header.frame_id = "camera_optical_link";
+  camera_info.width = 640;
+  camera_info.height = 480;
+  camera_info.d = {0.0, 0.0, 0.0, 0.0, 0.0};
+  camera_info.k = {500.0, 0.0, 320.0, 0.0, 500.0, 240.0, 0.0, 0.0, 1.0};
+  camera_info.r = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  camera_info.p = {500.0, 0.0, 320.0, 0.0, 0.0, 500.0, 240.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+  return camera_info;
+}
+
+sensor_msgs::msg::PointCloud2 createPointCloud(const int32_t stamp_sec)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.header.frame_id = "base_link";
+  cloud.header.stamp.sec = stamp_sec;
+  cloud.fields.resize(3);
+  const char * names[] = {"x", "y", "z"};
+  for (std::size_t i = 0; i < 3; ++i) {
+    cloud.fields[i].name = names[i];
+    cloud.fields[i].offset = static_cast<uint32_t>(4 * i);
+  }
+  cloud.point_step = 12;
+  for (int i = 0; i < 10; ++i) {
+    const float point[3] = {0.1f * static_cast<float>(i), 0.0f, 5.0f};
+    const std::size_t offset = cloud.data.size();
+    cloud.data.resize(offset + cloud.point_step);
+    std::memcpy(&cloud.data[offset], point, sizeof(point));
+  }
+  return cloud;
+}
+}  // namespace
+
+TEST(ProjectionCacheTest, ReuseSameProjection)
+{
+  ProjectionCache cache(4);
+  const auto camera_info = createCameraInfo();
+  const auto cloud = createPointCloud(1);
+  const Eigen::Affine3d identity = Eigen::Affine3d::Identity();
+
+  const auto projected_points = cache.project(cloud, camera_info, identity, false);
+  ASSERT_NE(projected_points, nullptr);
+  EXPECT_EQ(projected_points->size(), 10u);
+  EXPECT_EQ(cache.project(cloud, camera_info, identity, false), projected_points);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // another transform, rectification or cloud content is projected again
+  Eigen::Affine3d shifted = identity;
+  shifted.translate(Eigen::Vector3d(0.1, 0.0, 0.0));
+  EXPECT_NE(cache.project(cloud, camera_info, shifted, false), projected_points);
+  EXPECT_NE(cache.project(cloud, camera_info, identity, true), projected_points);
+  auto modified_cloud = cloud;
+  modified_cloud.data[0] ^= 0x1;
+  EXPECT_NE(cache.project(modified_cloud, camera_info, identity, false), projected_points);
+  EXPECT_EQ(cache.size(), 4u);
+}
+
+TEST(ProjectionCacheTest, EvictOldestProjection)
+{
+  ProjectionCache cache(2);
+  const auto camera_info = createCameraInfo();
+  const Eigen::Affine3d identity = Eigen::Affine3d::Identity();
+
+  const auto first = cache.project(createPointCloud(1), camera_info, identity, false);
+  const auto second = cache.project(createPointCloud(2), camera_info, identity, false);
+  cache.project(createPointCloud(3), camera_info, identity, false);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.project(createPointCloud(2), camera_info, identity, false), second);
+  EXPECT_NE(cache.project(createPointCloud(1), camera_info, identity, false), first);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
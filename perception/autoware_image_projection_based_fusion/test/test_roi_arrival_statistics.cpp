@@ -0,0 +1,70 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/utils/roi_arrival_statistics.hpp"
+
+#include <gtest/gtest.h>
+
+using autoware::image_projection_based_fusion::RoiArrivalStatistics;
+
+TEST(RoiArrivalStatisticsTest, DeadlineIsMaxUntilAllCamerasMeasured)
+{
+  RoiArrivalStatistics statistics(2, 0.5, 3.0);
+  EXPECT_DOUBLE_EQ(statistics.calcDeadline(5.0, 10.0, 70.0), 70.0);
+
+  statistics.addDelay(0, 20.0);
+  EXPECT_TRUE(statistics.hasEstimate(0));
+  EXPECT_FALSE(statistics.hasEstimate(1));
+  EXPECT_DOUBLE_EQ(statistics.calcDeadline(5.0, 10.0, 70.0), 70.0);
+
+  statistics.addDelay(1, 0.0);
+  EXPECT_DOUBLE_EQ(statistics.calcDeadline(5.0, 10.0, 70.0), 25.0);
+}
+
+TEST(RoiArrivalStatisticsTest, ExpectedDelayFollowsMeanAndVariance)
+{
+  RoiArrivalStatistics statistics(1, 0.5, 1.0);
+  statistics.addDelay(0, 10.0);
+  EXPECT_DOUBLE_EQ(statistics.expectedDelay(0), 10.0);
+
+  // mean 15, variance 0.5 * (0 + 10 * 5) = 25
+  statistics.addDelay(0, 20.0);
+  EXPECT_DOUBLE_EQ(statistics.expectedDelay(0), 20.0);
+
+  // negative delays are counted as zero
+  statistics.addDelay(0, -15.0);
+  EXPECT_LT(statistics.expectedDelay(0), 20.0);
+}
+
+TEST(RoiArrivalStatisticsTest, DeadlineIsClamped)
+{
+  RoiArrivalStatistics statistics(2, 1.0, 3.0);
+  statistics.addDelay(0, 1.0);
+  statistics.addDelay(1, 2.0);
+  EXPECT_DOUBLE_EQ(statistics.calcDeadline(0.0, 10.0, 70.0), 10.0);
+
+  statistics.addDelay(1, 200.0);
+  EXPECT_DOUBLE_EQ(statistics.calcDeadline(0.0, 10.0, 70.0), 70.0);
+}
+
+TEST(RoiArrivalStatisticsTest, LateCount)
+{
+  RoiArrivalStatistics statistics(3, 0.1, 3.0);
+  statistics.addLate(1);
+  statistics.addLate(1);
+  statistics.addLate(2);
+  EXPECT_EQ(statistics.lateCount(0), 0u);
+  EXPECT_EQ(statistics.lateCount(1), 2u);
+  EXPECT_EQ(statistics.lateCount(2), 1u);
+}
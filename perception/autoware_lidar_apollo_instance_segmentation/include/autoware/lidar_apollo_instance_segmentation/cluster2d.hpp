@@ -152,6 +152,9 @@ private:
     }
   };
 
+  // the nodes of the grids in row-major order, which are reused across the frames
+  std::vector<Node> nodes_;
+
   inline bool IsValidRowCol(int row, int col) const { return IsValidRow(row) && IsValidCol(col); }
 
   inline bool IsValidRow(int row) const { return row >= 0 && row < rows_; }
@@ -71,6 +71,11 @@ private:
   CudaUniquePtr<float[]> output_d_;
   CudaUniquePtrHost<float[]> output_h_;
 
+  // the points of x, y, z and intensity, which grow as the input does
+  size_t points_capacity_ = 0;
+  CudaUniquePtr<float[]> points_d_;
+  CudaUniquePtrHost<float[]> points_h_;
+
   StreamUniquePtr stream_{makeCudaStream()};
 };
 }  // namespace lidar_apollo_instance_segmentation
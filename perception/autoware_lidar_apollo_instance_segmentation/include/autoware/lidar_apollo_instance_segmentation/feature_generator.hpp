@@ -15,9 +15,12 @@
 #ifndef AUTOWARE__LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_HPP_
 #define AUTOWARE__LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_HPP_
 
+#include "autoware/lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
 #include "autoware/lidar_apollo_instance_segmentation/feature_map.hpp"
 #include "util.hpp"
 
+#include <autoware/cuda_utils/cuda_unique_ptr.hpp>
+
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
@@ -35,6 +38,9 @@ private:
   bool use_intensity_feature_;
   bool use_constant_feature_;
   std::shared_ptr<FeatureMapInterface> map_ptr_;
+  FeatureChannelOffsets channel_offsets_;
+  autoware::cuda_utils::CudaUniquePtr<unsigned long long[]> top_point_keys_d_;  // NOLINT
+  float * constant_map_d_ = nullptr;  // the device map the constant channels are uploaded to
 
 public:
   FeatureGenerator(
@@ -44,6 +50,11 @@ public:
 
   std::shared_ptr<FeatureMapInterface> generate(
     const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr);
+
+  // generates the feature map in map_d on the device from the points of x, y, z and intensity on
+  // the device
+  void generate(
+    const float * points_d, const size_t num_points, float * map_d, cudaStream_t stream);
 };
 }  // namespace lidar_apollo_instance_segmentation
 }  // namespace autoware
@@ -0,0 +1,47 @@
+// Copyright 2020-2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+#define AUTOWARE__LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+
+#include "cuda.h"
+#include "cuda_runtime_api.h"
+
+#include <cstddef>
+
+namespace autoware
+{
+namespace lidar_apollo_instance_segmentation
+{
+// offsets of the channels in the feature map, or -1 for the channels the map does not have
+struct FeatureChannelOffsets
+{
+  int max_height;
+  int mean_height;
+  int count;
+  int top_intensity;
+  int mean_intensity;
+  int nonempty;
+};
+
+// generates the non-constant channels of the feature map from the points of x, y, z and intensity,
+// where top_point_keys is a scratch of a key per grid
+cudaError_t generateFeatureMap_launch(
+  const float * points, std::size_t num_points, float min_height, float max_height, int width,
+  int height, int range, const FeatureChannelOffsets & offsets,
+  unsigned long long * top_point_keys, float * map_data, cudaStream_t stream);  // NOLINT
+}  // namespace lidar_apollo_instance_segmentation
+}  // namespace autoware
+
+#endif  // AUTOWARE__LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
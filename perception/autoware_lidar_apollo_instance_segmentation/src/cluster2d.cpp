@@ -126,7 +126,7 @@ void Cluster2D::cluster(
 
   pc_ptr_ = pc_ptr;
 
-  std::vector<std::vector<Node>> nodes(rows_, std::vector<Node>(cols_, Node()));
+  nodes_.assign(size_, Node());
 
   valid_indices_in_pc_ = &(valid_indices.indices);
   point2grid_.assign(valid_indices_in_pc_->size(), -1);
@@ -141,28 +141,28 @@ void Cluster2D::cluster(
     int pos_y = F2I(point.x, range_, inv_res_y_);  // row
     if (IsValidRowCol(pos_y, pos_x)) {
       point2grid_[i] = RowCol2Grid(pos_y, pos_x);
-      nodes[pos_y][pos_x].point_num++;
+      nodes_[RowCol2Grid(pos_y, pos_x)].point_num++;
     }
   }
 
   for (int row = 0; row < rows_; ++row) {
     for (int col = 0; col < cols_; ++col) {
       int grid = RowCol2Grid(row, col);
-      Node * node = &nodes[row][col];
+      Node * node = &nodes_[grid];
       DisjointSetMakeSet(node);
-      node->is_object = (use_all_grids_for_clustering || nodes[row][col].point_num > 0) &&
+      node->is_object = (use_all_grids_for_clustering || nodes_[grid].point_num > 0) &&
                         (*(category_pt_data + grid) >= objectness_thresh);
       int center_row = std::round(row + instance_pt_x_data[grid] * scale_);
       int center_col = std::round(col + instance_pt_y_data[grid] * scale_);
       center_row = std::min(std::max(center_row, 0), rows_ - 1);
       center_col = std::min(std::max(center_col, 0), cols_ - 1);
-      node->center_node = &nodes[center_row][center_col];
+      node->center_node = &nodes_[RowCol2Grid(center_row, center_col)];
     }
   }
 
   for (int row = 0; row < rows_; ++row) {
     for (int col = 0; col < cols_; ++col) {
-      Node * node = &nodes[row][col];
+      Node * node = &nodes_[RowCol2Grid(row, col)];
       if (node->is_object && node->traversed == 0) {
         traverse(node);
       }
@@ -171,14 +171,14 @@ void Cluster2D::cluster(
 
   for (int row = 0; row < rows_; ++row) {
     for (int col = 0; col < cols_; ++col) {
-      Node * node = &nodes[row][col];
+      Node * node = &nodes_[RowCol2Grid(row, col)];
       if (!node->is_center) {
         continue;
       }
       for (int row2 = row - 1; row2 <= row + 1; ++row2) {
         for (int col2 = col - 1; col2 <= col + 1; ++col2) {
           if ((row2 == row || col2 == col) && IsValidRowCol(row2, col2)) {
-            Node * node2 = &nodes[row2][col2];
+            Node * node2 = &nodes_[RowCol2Grid(row2, col2)];
             if (node2->is_center) {
               DisjointSetUnion(node, node2);
             }
@@ -193,7 +193,7 @@ void Cluster2D::cluster(
   id_img_.assign(size_, -1);
   for (int row = 0; row < rows_; ++row) {
     for (int col = 0; col < cols_; ++col) {
-      Node * node = &nodes[row][col];
+      Node * node = &nodes_[RowCol2Grid(row, col)];
       if (!node->is_object) {
         continue;
       }
@@ -140,7 +140,16 @@ bool LidarApolloInstanceSegmentation::detectDynamicObjects(
   pcl_pointcloud_raw.width = transformed_cloud.width;
   pcl_pointcloud_raw.height = transformed_cloud.height;
   pcl_pointcloud_raw.is_dense = transformed_cloud.is_dense == 1;
-  pcl_pointcloud_raw.resize(transformed_cloud.width * transformed_cloud.height);
+  const size_t num_points = transformed_cloud.width * transformed_cloud.height;
+  pcl_pointcloud_raw.reserve(num_points);
+
+  constexpr size_t num_point_features = 4;
+  if (points_capacity_ < num_points) {
+    points_capacity_ = num_points;
+    points_d_ = autoware::cuda_utils::make_unique<float[]>(points_capacity_ * num_point_features);
+    points_h_ = autoware::cuda_utils::make_unique_host<float[]>(
+      points_capacity_ * num_point_features, cudaHostAllocPortable);
+  }
 
   sensor_msgs::PointCloud2ConstIterator<float> it_x(transformed_cloud, "x");
   sensor_msgs::PointCloud2ConstIterator<float> it_y(transformed_cloud, "y");
@@ -153,16 +162,23 @@ bool LidarApolloInstanceSegmentation::detectDynamicObjects(
     point.y = *it_y;
     point.z = *it_z;
     point.intensity = static_cast<float>(*it_intensity);
+    float * point_h = points_h_.get() + pcl_pointcloud_raw.size() * num_point_features;
+    point_h[0] = point.x;
+    point_h[1] = point.y;
+    point_h[2] = point.z;
+    point_h[3] = point.intensity;
     pcl_pointcloud_raw.emplace_back(std::move(point));
   }
 
-  // generate feature map
-  std::shared_ptr<FeatureMapInterface> feature_map_ptr =
-    feature_generator_->generate(pcl_pointcloud_raw_ptr);
-
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), feature_map_ptr->map_data.data(),
-    feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice));
+  // generate feature map on the device, directly in the input of the network
+  if (!pcl_pointcloud_raw.empty()) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      points_d_.get(), points_h_.get(),
+      pcl_pointcloud_raw.size() * num_point_features * sizeof(float), cudaMemcpyHostToDevice,
+      *stream_));
+  }
+  feature_generator_->generate(
+    points_d_.get(), pcl_pointcloud_raw.size(), input_d_.get(), *stream_);
 
   std::vector<void *> buffers = {input_d_.get(), output_d_.get()};
 
@@ -16,7 +16,10 @@
 
 #include "autoware/lidar_apollo_instance_segmentation/log_table.hpp"
 
+#include <autoware/cuda_utils/cuda_check_error.hpp>
+
 #include <cmath>
+#include <vector>
 
 namespace
 {
@@ -24,6 +27,11 @@ inline float normalizeIntensity(float intensity)
 {
   return intensity / 255.0f;
 }
+
+inline int channelOffset(const std::vector<float> & map_data, const float * channel_data)
+{
+  return channel_data == nullptr ? -1 : static_cast<int>(channel_data - map_data.data());
+}
 }  // namespace
 
 namespace autoware
@@ -49,6 +57,16 @@ FeatureGenerator::FeatureGenerator(
     map_ptr_ = std::make_shared<FeatureMap>(width, height, range);
   }
   map_ptr_->initializeMap(map_ptr_->map_data);
+
+  const auto & map_data = map_ptr_->map_data;
+  channel_offsets_.max_height = channelOffset(map_data, map_ptr_->max_height_data);
+  channel_offsets_.mean_height = channelOffset(map_data, map_ptr_->mean_height_data);
+  channel_offsets_.count = channelOffset(map_data, map_ptr_->count_data);
+  channel_offsets_.top_intensity = channelOffset(map_data, map_ptr_->top_intensity_data);
+  channel_offsets_.mean_intensity = channelOffset(map_data, map_ptr_->mean_intensity_data);
+  channel_offsets_.nonempty = channelOffset(map_data, map_ptr_->nonempty_data);
+  top_point_keys_d_ =
+    autoware::cuda_utils::make_unique<unsigned long long[]>(width * height);  // NOLINT
 }
 
 std::shared_ptr<FeatureMapInterface> FeatureGenerator::generate(
@@ -102,5 +120,21 @@ std::shared_ptr<FeatureMapInterface> FeatureGenerator::generate(
   }
   return map_ptr_;
 }
+
+void FeatureGenerator::generate(
+  const float * points_d, const size_t num_points, float * map_d, cudaStream_t stream)
+{
+  // the constant channels are the same in every frame, so they are uploaded only once
+  if (map_d != constant_map_d_) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      map_d, map_ptr_->map_data.data(), map_ptr_->map_data.size() * sizeof(float),
+      cudaMemcpyHostToDevice, stream));
+    constant_map_d_ = map_d;
+  }
+
+  CHECK_CUDA_ERROR(generateFeatureMap_launch(
+    points_d, num_points, min_height_, max_height_, map_ptr_->width, map_ptr_->height,
+    map_ptr_->range, channel_offsets_, top_point_keys_d_.get(), map_d, stream));
+}
 }  // namespace lidar_apollo_instance_segmentation
 }  // namespace autoware
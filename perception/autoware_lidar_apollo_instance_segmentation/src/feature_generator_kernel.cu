@@ -0,0 +1,148 @@
+// Copyright 2020-2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+const int LOG_TABLE_SIZE = 256 * 10;  // the same as the size of the log table on the host
+const float EPSILON = 1e-6;
+const float INTENSITY_SCALE = 1.0f / 255.0f;
+
+std::size_t divup(const std::size_t a, const std::size_t b)
+{
+  return (a + b - 1) / b;
+}
+}  // namespace
+
+namespace autoware
+{
+namespace lidar_apollo_instance_segmentation
+{
+// maps the float to the unsigned integer of the same order
+__device__ unsigned int orderedFloat(const float value)
+{
+  const unsigned int bits = __float_as_uint(value);
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+__device__ float unorderedFloat(const unsigned int bits)
+{
+  return __uint_as_float((bits & 0x80000000u) ? (bits & 0x7FFFFFFFu) : ~bits);
+}
+
+__global__ void resetFeatureMap_kernel(
+  int size, FeatureChannelOffsets offsets, unsigned long long * top_point_keys,  // NOLINT
+  float * map_data)
+{
+  const int idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= size) return;
+
+  top_point_keys[idx] = 0;
+  map_data[offsets.mean_height + idx] = 0.0f;
+  map_data[offsets.count + idx] = 0.0f;
+  map_data[offsets.nonempty + idx] = 0.0f;
+  if (offsets.mean_intensity >= 0) {
+    map_data[offsets.mean_intensity + idx] = 0.0f;
+  }
+}
+
+__global__ void accumulatePoints_kernel(
+  const float4 * points, std::size_t num_points, float min_height, float max_height, int width,
+  int height, int range, FeatureChannelOffsets offsets,
+  unsigned long long * top_point_keys, float * map_data)  // NOLINT
+{
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= num_points) return;
+
+  const float4 point = points[point_idx];
+  if (point.z <= min_height || max_height <= point.z) return;
+
+  const float inv_res_x = 0.5f * width / range;
+  const float inv_res_y = 0.5f * height / range;
+  const int pos_x = floorf((range - point.y) * inv_res_x);  // x on grid
+  const int pos_y = floorf((range - point.x) * inv_res_y);  // y on grid
+  if (pos_x < 0 || width <= pos_x || pos_y < 0 || height <= pos_y) return;
+
+  const int idx = pos_y * width + pos_x;
+
+  // the highest point of the grid, and the first one of them as on the host
+  const unsigned long long key =  // NOLINT
+    (static_cast<unsigned long long>(orderedFloat(point.z)) << 32) |  // NOLINT
+    (0xFFFFFFFFu - static_cast<unsigned int>(point_idx));
+  atomicMax(&top_point_keys[idx], key);
+
+  atomicAdd(&map_data[offsets.mean_height + idx], point.z);
+  if (offsets.mean_intensity >= 0) {
+    atomicAdd(&map_data[offsets.mean_intensity + idx], point.w * INTENSITY_SCALE);
+  }
+  atomicAdd(&map_data[offsets.count + idx], 1.0f);
+}
+
+__global__ void finalizeFeatureMap_kernel(
+  const float4 * points, int size, FeatureChannelOffsets offsets,
+  const unsigned long long * top_point_keys, float * map_data)  // NOLINT
+{
+  const int idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= size) return;
+
+  const float count = map_data[offsets.count + idx];
+  if (count < EPSILON) {
+    map_data[offsets.max_height + idx] = 0.0f;
+    if (offsets.top_intensity >= 0) {
+      map_data[offsets.top_intensity + idx] = 0.0f;
+    }
+  } else {
+    const unsigned long long key = top_point_keys[idx];  // NOLINT
+    map_data[offsets.max_height + idx] = unorderedFloat(static_cast<unsigned int>(key >> 32));
+    if (offsets.top_intensity >= 0) {
+      const unsigned int point_idx = 0xFFFFFFFFu - static_cast<unsigned int>(key & 0xFFFFFFFFu);
+      map_data[offsets.top_intensity + idx] = points[point_idx].w * INTENSITY_SCALE;
+    }
+    map_data[offsets.mean_height + idx] /= count;
+    if (offsets.mean_intensity >= 0) {
+      map_data[offsets.mean_intensity + idx] /= count;
+    }
+    map_data[offsets.nonempty + idx] = 1.0f;
+  }
+
+  // the same approximation as calcApproximateLog
+  const int integer_count = static_cast<int>(count * 10.0f);
+  map_data[offsets.count + idx] =
+    integer_count < LOG_TABLE_SIZE ? log1pf(integer_count * 0.1f) : log1pf(count);
+}
+
+cudaError_t generateFeatureMap_launch(
+  const float * points, std::size_t num_points, float min_height, float max_height, int width,
+  int height, int range, const FeatureChannelOffsets & offsets,
+  unsigned long long * top_point_keys, float * map_data, cudaStream_t stream)  // NOLINT
+{
+  const int size = width * height;
+  const auto * points4 = reinterpret_cast<const float4 *>(points);
+
+  resetFeatureMap_kernel<<<divup(size, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    size, offsets, top_point_keys, map_data);
+  if (num_points > 0) {
+    accumulatePoints_kernel<<<divup(num_points, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+      points4, num_points, min_height, max_height, width, height, range, offsets, top_point_keys,
+      map_data);
+  }
+  finalizeFeatureMap_kernel<<<divup(size, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    points4, size, offsets, top_point_keys, map_data);
+
+  return cudaGetLastError();
+}
+}  // namespace lidar_apollo_instance_segmentation
+}  // namespace autoware
@@ -56,7 +56,8 @@ class CenterPointTRT
 public:
   explicit CenterPointTRT(
     const NetworkParam & encoder_param, const NetworkParam & head_param,
-    const DensificationParam & densification_param, const CenterPointConfig & config);
+    const DensificationParam & densification_param, const CenterPointConfig & config,
+    const bool use_cuda_graph = false);
 
   virtual ~CenterPointTRT();
 
@@ -72,6 +73,10 @@ protected:
 
   void inference();
 
+  bool enqueueInference();
+
+  bool captureInferenceGraph();
+
   void postProcess(std::vector<Box3D> & det_boxes3d);
 
   std::unique_ptr<VoxelGeneratorTemplate> vg_ptr_{nullptr};
@@ -80,6 +85,11 @@ protected:
   std::unique_ptr<PostProcessCUDA> post_proc_ptr_{nullptr};
   cudaStream_t stream_{nullptr};
 
+  // the fixed-shape inference (encoder, scatter and head) is replayed from a CUDA graph
+  bool use_cuda_graph_{false};
+  bool is_inference_warmed_up_{false};
+  cudaGraphExec_t inference_graph_exec_{nullptr};
+
   std::size_t class_size_{0};
   CenterPointConfig config_;
   std::size_t encoder_in_feature_size_{0};
@@ -51,6 +51,7 @@ private:
 struct PointCloudWithTransform
 {
   cuda::unique_ptr<float[]> points_d{nullptr};
+  std::size_t points_capacity{0};  // number of floats allocated for points_d
   std_msgs::msg::Header header;
   std::size_t num_points{0};
   std::size_t point_step{0};
@@ -81,7 +82,6 @@ public:
 private:
   void enqueue(
     const sensor_msgs::msg::PointCloud2 & msg, const Eigen::Affine3f & affine, cudaStream_t stream);
-  void dequeue();
 
   DensificationParam param_;
   double current_timestamp_{0.0};
@@ -18,11 +18,24 @@
 #include "cuda.h"
 #include "cuda_runtime_api.h"
 
+#include <cstddef>
+
 namespace autoware::lidar_centerpoint
 {
+// a device-resident sweep of the densification cache, and where its points go in the output
+struct SweepInfo
+{
+  const float * points;
+  unsigned int points_offset;  // index of the first output point of the sweep
+  int input_point_step;        // in floats
+  float time_lag;
+  float transform[16];  // past to current, column-major
+};
+
+// transforms all the sweeps into the current frame at once
 cudaError_t generateSweepPoints_launch(
-  const float * input_points, std::size_t points_size, int input_point_step, float time_lag,
-  const float * transform, int num_features, float * output_points, cudaStream_t stream);
+  const SweepInfo * sweeps, int num_sweeps, std::size_t points_size, int num_features,
+  float * output_points, cudaStream_t stream);
 
 cudaError_t shufflePoints_launch(
   const float * points, const unsigned int * indices, float * shuffled_points,
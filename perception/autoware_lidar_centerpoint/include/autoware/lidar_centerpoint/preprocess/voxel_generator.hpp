@@ -17,6 +17,7 @@
 
 #include "autoware/lidar_centerpoint/centerpoint_config.hpp"
 #include "autoware/lidar_centerpoint/preprocess/pointcloud_densification.hpp"
+#include "autoware/lidar_centerpoint/preprocess/preprocess_kernel.hpp"
 
 #include "sensor_msgs/msg/point_cloud2.hpp"
 
@@ -38,12 +39,20 @@ public:
     cudaStream_t stream);
 
 protected:
+  // fill and upload the per-sweep parameters of the cached pointclouds, and return the number of
+  // points to generate
+  std::size_t uploadSweeps(cudaStream_t stream);
+
   std::unique_ptr<PointCloudDensification> pd_ptr_{nullptr};
 
   CenterPointConfig config_;
   std::array<float, 6> range_;
   std::array<int, 3> grid_size_;
   std::array<float, 3> recip_voxel_size_;
+
+  // per-sweep parameters, uploaded once per frame for a single transform kernel
+  std::vector<SweepInfo> sweeps_;
+  cuda::unique_ptr<SweepInfo[]> sweeps_d_{nullptr};
 };
 
 class VoxelGenerator : public VoxelGeneratorTemplate
@@ -33,8 +33,9 @@ namespace autoware::lidar_centerpoint
 {
 CenterPointTRT::CenterPointTRT(
   const NetworkParam & encoder_param, const NetworkParam & head_param,
-  const DensificationParam & densification_param, const CenterPointConfig & config)
-: config_(config)
+  const DensificationParam & densification_param, const CenterPointConfig & config,
+  const bool use_cuda_graph)
+: use_cuda_graph_(use_cuda_graph), config_(config)
 {
   vg_ptr_ = std::make_unique<VoxelGenerator>(densification_param, config_);
   post_proc_ptr_ = std::make_unique<PostProcessCUDA>(config_);
@@ -66,6 +67,9 @@ CenterPointTRT::CenterPointTRT(
 
 CenterPointTRT::~CenterPointTRT()
 {
+  if (inference_graph_exec_) {
+    cudaGraphExecDestroy(inference_graph_exec_);
+  }
   if (stream_) {
     cudaStreamSynchronize(stream_);
     cudaStreamDestroy(stream_);
@@ -197,22 +201,73 @@ void CenterPointTRT::inference()
     throw std::runtime_error("Failed to create tensorrt context.");
   }
 
+  if (inference_graph_exec_) {
+    CHECK_CUDA_ERROR(cudaGraphLaunch(inference_graph_exec_, stream_));
+    return;
+  }
+
+  // TensorRT completes its lazy initialization in the first enqueue, which can not be captured
+  if (use_cuda_graph_ && is_inference_warmed_up_) {
+    if (captureInferenceGraph()) {
+      CHECK_CUDA_ERROR(cudaGraphLaunch(inference_graph_exec_, stream_));
+      return;
+    }
+    RCLCPP_WARN_STREAM(
+      rclcpp::get_logger("lidar_centerpoint"),
+      "Failed to capture the inference in a CUDA graph. Fall back to direct launches.");
+    use_cuda_graph_ = false;
+  }
+
+  enqueueInference();
+  is_inference_warmed_up_ = true;
+}
+
+bool CenterPointTRT::enqueueInference()
+{
   // pillar encoder network
   std::vector<void *> encoder_buffers{encoder_in_features_d_.get(), pillar_features_d_.get()};
-  encoder_trt_ptr_->context_->enqueueV2(encoder_buffers.data(), stream_, nullptr);
+  const bool is_encoder_enqueued =
+    encoder_trt_ptr_->context_->enqueueV2(encoder_buffers.data(), stream_, nullptr);
 
   // scatter
-  CHECK_CUDA_ERROR(scatterFeatures_launch(
+  const auto scatter_status = scatterFeatures_launch(
     pillar_features_d_.get(), coordinates_d_.get(), num_voxels_d_.get(), config_.max_voxel_size_,
     config_.encoder_out_feature_size_, config_.grid_size_x_, config_.grid_size_y_,
-    spatial_features_d_.get(), stream_));
+    spatial_features_d_.get(), stream_);
 
   // head network
   std::vector<void *> head_buffers = {spatial_features_d_.get(), head_out_heatmap_d_.get(),
                                       head_out_offset_d_.get(),  head_out_z_d_.get(),
                                       head_out_dim_d_.get(),     head_out_rot_d_.get(),
                                       head_out_vel_d_.get()};
-  head_trt_ptr_->context_->enqueueV2(head_buffers.data(), stream_, nullptr);
+  const bool is_head_enqueued =
+    head_trt_ptr_->context_->enqueueV2(head_buffers.data(), stream_, nullptr);
+
+  return is_encoder_enqueued && scatter_status == cudaSuccess && is_head_enqueued;
+}
+
+bool CenterPointTRT::captureInferenceGraph()
+{
+  // all the buffers and binding dimensions are fixed, and the number of voxels is only read on the
+  // device, so the captured graph is valid for every frame
+  CHECK_CUDA_ERROR(cudaStreamBeginCapture(stream_, cudaStreamCaptureModeThreadLocal));
+  const bool is_enqueued = enqueueInference();
+  cudaGraph_t graph{nullptr};
+  const auto capture_status = cudaStreamEndCapture(stream_, &graph);
+
+  bool is_captured = is_enqueued && capture_status == cudaSuccess && graph;
+  if (is_captured) {
+    is_captured = cudaGraphInstantiateWithFlags(&inference_graph_exec_, graph, 0) == cudaSuccess;
+  }
+  if (graph) {
+    cudaGraphDestroy(graph);
+  }
+  if (!is_captured) {
+    inference_graph_exec_ = nullptr;
+    // clear the error of the failed capture
+    cudaGetLastError();
+  }
+  return is_captured;
 }
 
 void CenterPointTRT::postProcess(std::vector<Box3D> & det_boxes3d)
@@ -19,6 +19,7 @@
 
 #include "boost/optional.hpp"
 
+#include <iterator>
 #include <string>
 #include <utility>
 #ifdef ROS_DISTRO_GALACTIC
@@ -78,8 +79,6 @@ bool PointCloudDensification::enqueuePointCloud(
     enqueue(pointcloud_msg, Eigen::Affine3f::Identity(), stream);
   }
 
-  dequeue();
-
   return true;
 }
 
@@ -91,24 +90,33 @@ void PointCloudDensification::enqueue(
   current_timestamp_ = rclcpp::Time(msg.header.stamp).seconds();
 
   assert(sizeof(uint8_t) * msg.width * msg.height * msg.point_step % sizeof(float) == 0);
-  auto points_d = cuda::make_unique<float[]>(
-    sizeof(uint8_t) * msg.width * msg.height * msg.point_step / sizeof(float));
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    points_d.get(), msg.data.data(), sizeof(uint8_t) * msg.width * msg.height * msg.point_step,
-    cudaMemcpyHostToDevice, stream));
-
-  PointCloudWithTransform pointcloud = {
-    std::move(points_d), msg.header, msg.width * msg.height, msg.point_step,
-    affine_world2current.inverse()};
-
-  pointcloud_cache_.push_front(std::move(pointcloud));
-}
+  const std::size_t points_size =
+    sizeof(uint8_t) * msg.width * msg.height * msg.point_step / sizeof(float);
+
+  // once the cache is full, the oldest sweep is recycled as the newest one so that its device
+  // buffer is reused instead of allocating and freeing device memory every frame. The past sweeps
+  // stay on the device and only the current one is uploaded.
+  if (pointcloud_cache_.size() >= param_.pointcloud_cache_size()) {
+    pointcloud_cache_.splice(
+      pointcloud_cache_.begin(), pointcloud_cache_, std::prev(pointcloud_cache_.end()));
+  } else {
+    pointcloud_cache_.emplace_front();
+  }
+  auto & pointcloud = pointcloud_cache_.front();
 
-void PointCloudDensification::dequeue()
-{
-  if (pointcloud_cache_.size() > param_.pointcloud_cache_size()) {
-    pointcloud_cache_.pop_back();
+  if (pointcloud.points_capacity < points_size) {
+    // leave some room so that small fluctuations of the number of points do not reallocate
+    pointcloud.points_capacity = points_size + points_size / 4;
+    pointcloud.points_d = cuda::make_unique<float[]>(pointcloud.points_capacity);
   }
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    pointcloud.points_d.get(), msg.data.data(),
+    sizeof(uint8_t) * msg.width * msg.height * msg.point_step, cudaMemcpyHostToDevice, stream));
+
+  pointcloud.header = msg.header;
+  pointcloud.num_points = msg.width * msg.height;
+  pointcloud.point_step = msg.point_step;
+  pointcloud.affine_past2world = affine_world2current.inverse();
 }
 
 }  // namespace autoware::lidar_centerpoint
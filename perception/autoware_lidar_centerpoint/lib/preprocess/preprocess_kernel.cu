@@ -46,15 +46,25 @@ namespace autoware::lidar_centerpoint
 {
 
 __global__ void generateSweepPoints_kernel(
-  const float * input_points, std::size_t points_size, int input_point_step, float time_lag,
-  const float * transform_array, int num_features, float * output_points)
+  const SweepInfo * sweeps, int num_sweeps, std::size_t points_size, int num_features,
+  float * output_points)
 {
   int point_idx = blockIdx.x * blockDim.x + threadIdx.x;
   if (point_idx >= points_size) return;
 
-  const float input_x = input_points[point_idx * input_point_step + 0];
-  const float input_y = input_points[point_idx * input_point_step + 1];
-  const float input_z = input_points[point_idx * input_point_step + 2];
+  // there are only a few sweeps, so a linear search is enough
+  int sweep_idx = 0;
+  while (sweep_idx + 1 < num_sweeps && point_idx >= sweeps[sweep_idx + 1].points_offset) {
+    ++sweep_idx;
+  }
+  const SweepInfo & sweep = sweeps[sweep_idx];
+  const float * input_point =
+    sweep.points + (point_idx - sweep.points_offset) * sweep.input_point_step;
+  const float * transform_array = sweep.transform;
+
+  const float input_x = input_point[0];
+  const float input_y = input_point[1];
+  const float input_z = input_point[2];
 
   // transform_array is expected to be column-major
   output_points[point_idx * num_features + 0] = transform_array[0] * input_x +
@@ -66,24 +76,23 @@ __global__ void generateSweepPoints_kernel(
   output_points[point_idx * num_features + 2] = transform_array[2] * input_x +
                                                 transform_array[6] * input_y +
                                                 transform_array[10] * input_z + transform_array[14];
-  output_points[point_idx * num_features + 3] = time_lag;
+  output_points[point_idx * num_features + 3] = sweep.time_lag;
 }
 
 cudaError_t generateSweepPoints_launch(
-  const float * input_points, std::size_t points_size, int input_point_step, float time_lag,
-  const float * transform_array, int num_features, float * output_points, cudaStream_t stream)
+  const SweepInfo * sweeps, int num_sweeps, std::size_t points_size, int num_features,
+  float * output_points, cudaStream_t stream)
 {
-  auto transform_d = cuda::make_unique<float[]>(16);
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    transform_d.get(), transform_array, 16 * sizeof(float), cudaMemcpyHostToDevice, stream));
-
   dim3 blocks((points_size + 256 - 1) / 256);
   dim3 threads(256);
   assert(num_features == 4);
 
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+
   generateSweepPoints_kernel<<<blocks, threads, 0, stream>>>(
-    input_points, points_size, input_point_step, time_lag, transform_d.get(), num_features,
-    output_points);
+    sweeps, num_sweeps, points_size, num_features, output_points);
 
   cudaError_t err = cudaGetLastError();
   return err;
@@ -19,6 +19,7 @@
 
 #include "sensor_msgs/point_cloud2_iterator.hpp"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace autoware::lidar_centerpoint
@@ -40,6 +41,9 @@ VoxelGeneratorTemplate::VoxelGeneratorTemplate(
   recip_voxel_size_[0] = 1 / config.voxel_size_x_;
   recip_voxel_size_[1] = 1 / config.voxel_size_y_;
   recip_voxel_size_[2] = 1 / config.voxel_size_z_;
+
+  sweeps_.reserve(param.pointcloud_cache_size());
+  sweeps_d_ = cuda::make_unique<SweepInfo[]>(param.pointcloud_cache_size());
 }
 
 bool VoxelGeneratorTemplate::enqueuePointCloud(
@@ -49,9 +53,10 @@ bool VoxelGeneratorTemplate::enqueuePointCloud(
   return pd_ptr_->enqueuePointCloud(input_pointcloud_msg, tf_buffer, stream);
 }
 
-std::size_t VoxelGenerator::generateSweepPoints(float * points_d, cudaStream_t stream)
+std::size_t VoxelGeneratorTemplate::uploadSweeps(cudaStream_t stream)
 {
   std::size_t point_counter = 0;
+  sweeps_.clear();
   for (auto pc_cache_iter = pd_ptr_->getPointCloudCacheIter(); !pd_ptr_->isCacheEnd(pc_cache_iter);
        pc_cache_iter++) {
     auto sweep_num_points = pc_cache_iter->num_points;
@@ -71,13 +76,39 @@ std::size_t VoxelGenerator::generateSweepPoints(float * points_d, cudaStream_t s
 
     static_assert(std::is_same<decltype(affine_past2current.matrix()), Eigen::Matrix4f &>::value);
     static_assert(!Eigen::Matrix4f::IsRowMajor, "matrices should be col-major.");
-    generateSweepPoints_launch(
-      pc_cache_iter->points_d.get(), sweep_num_points, point_step / sizeof(float), time_lag,
-      affine_past2current.matrix().data(), config_.point_feature_size_,
-      points_d + config_.point_feature_size_ * point_counter, stream);
+    SweepInfo sweep{};
+    sweep.points = pc_cache_iter->points_d.get();
+    sweep.points_offset = static_cast<unsigned int>(point_counter);
+    sweep.input_point_step = static_cast<int>(point_step / sizeof(float));
+    sweep.time_lag = time_lag;
+    std::copy_n(affine_past2current.matrix().data(), 16, sweep.transform);
+    sweeps_.push_back(sweep);
 
     point_counter += sweep_num_points;
   }
+
+  if (point_counter == 0) {
+    return 0;
+  }
+
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    sweeps_d_.get(), sweeps_.data(), sweeps_.size() * sizeof(SweepInfo), cudaMemcpyHostToDevice,
+    stream));
+
+  return point_counter;
+}
+
+std::size_t VoxelGenerator::generateSweepPoints(float * points_d, cudaStream_t stream)
+{
+  const std::size_t point_counter = uploadSweeps(stream);
+  if (point_counter == 0) {
+    return 0;
+  }
+
+  CHECK_CUDA_ERROR(generateSweepPoints_launch(
+    sweeps_d_.get(), static_cast<int>(sweeps_.size()), point_counter, config_.point_feature_size_,
+    points_d, stream));
+
   return point_counter;
 }
 
@@ -51,6 +51,7 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
     this->declare_parameter<int>("densification_params.num_past_frames");
   const std::string trt_precision = this->declare_parameter<std::string>("trt_precision");
   const std::size_t cloud_capacity = this->declare_parameter<std::int64_t>("cloud_capacity");
+  const bool use_cuda_graph = this->declare_parameter<bool>("use_cuda_graph");
   const std::string encoder_onnx_path = this->declare_parameter<std::string>("encoder_onnx_path");
   const std::string encoder_engine_path =
     this->declare_parameter<std::string>("encoder_engine_path");
@@ -108,8 +109,8 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
     class_names_.size(), point_feature_size, cloud_capacity, max_voxel_size, point_cloud_range,
     voxel_size, downsample_factor, encoder_in_feature_size, score_threshold,
     circle_nms_dist_threshold, yaw_norm_thresholds, has_variance_);
-  detector_ptr_ =
-    std::make_unique<CenterPointTRT>(encoder_param, head_param, densification_param, config);
+  detector_ptr_ = std::make_unique<CenterPointTRT>(
+    encoder_param, head_param, densification_param, config, use_cuda_graph);
 
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
     "~/input/pointcloud", rclcpp::SensorDataQoS{}.keep_last(1),
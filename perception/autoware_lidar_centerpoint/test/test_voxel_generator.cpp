@@ -252,6 +252,85 @@ TEST_F(VoxelGeneratorTest, TwoFrames)
   }
 }
 
+TEST_F(VoxelGeneratorTest, RecycledFrames)
+{
+  const unsigned int num_past_frames = 1;
+
+  autoware::lidar_centerpoint::DensificationParam param(world_frame_, num_past_frames);
+
+  autoware::lidar_centerpoint::CenterPointConfig config(
+    class_size_, point_feature_size_, cloud_capacity_, max_voxel_size_, point_cloud_range_,
+    voxel_size_, downsample_factor_, encoder_in_feature_size_, score_threshold_,
+    circle_nms_dist_threshold_, yaw_norm_thresholds_, has_variance_);
+
+  autoware::lidar_centerpoint::VoxelGenerator voxel_generator(param, config);
+  std::vector<float> points;
+  points.resize(capacity_ * config.point_feature_size_);
+  std::fill(points.begin(), points.end(), std::nan(""));
+
+  auto points_d = cuda::make_unique<float[]>(capacity_ * config.point_feature_size_);
+  cudaMemcpy(
+    points_d.get(), points.data(), capacity_ * config.point_feature_size_ * sizeof(float),
+    cudaMemcpyHostToDevice);
+
+  // the third pointcloud reuses the buffer of the first one, and is shifted in y to tell them apart
+  auto cloud3 = *cloud2_;
+  cloud3.header.stamp.nanosec = 300'000'000;
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud3, "y");
+  for (std::size_t i = 0; i < points_per_pointcloud_; ++i, ++iter_y) {
+    *iter_y += 1.0f;
+  }
+  auto transform3 = transform2_;
+  transform3.header.stamp = cloud3.header.stamp;
+  transform3.transform.translation.x += delta_pointcloud_x_;
+
+  tf2_buffer_->setTransform(transform1_, "authority1");
+  tf2_buffer_->setTransform(transform2_, "authority1");
+  tf2_buffer_->setTransform(transform3, "authority1");
+
+  bool status1 = voxel_generator.enqueuePointCloud(*cloud1_, *tf2_buffer_, stream_);
+  bool status2 = voxel_generator.enqueuePointCloud(*cloud2_, *tf2_buffer_, stream_);
+  bool status3 = voxel_generator.enqueuePointCloud(cloud3, *tf2_buffer_, stream_);
+  std::size_t generated_points_num = voxel_generator.generateSweepPoints(points_d.get(), stream_);
+
+  cudaMemcpy(
+    points.data(), points_d.get(), capacity_ * config.point_feature_size_ * sizeof(float),
+    cudaMemcpyDeviceToHost);
+
+  EXPECT_TRUE(status1);
+  EXPECT_TRUE(status2);
+  EXPECT_TRUE(status3);
+  EXPECT_EQ(2 * points_per_pointcloud_, generated_points_num);
+
+  // Check valid points for the latest pointcloud
+  for (std::size_t i = 0; i < points_per_pointcloud_; ++i) {
+    EXPECT_EQ(static_cast<double>(i), points[i * config.point_feature_size_ + 0]);
+    EXPECT_EQ(static_cast<double>(i) + 1.0, points[i * config.point_feature_size_ + 1]);
+    EXPECT_EQ(static_cast<double>(i), points[i * config.point_feature_size_ + 2]);
+    EXPECT_EQ(static_cast<double>(0), points[i * config.point_feature_size_ + 3]);
+  }
+
+  // Check valid points for the previous pointcloud, the first one is out of the cache
+  for (std::size_t i = 0; i < points_per_pointcloud_; ++i) {
+    EXPECT_NEAR(
+      static_cast<double>(i) - delta_pointcloud_x_,
+      points[(points_per_pointcloud_ + i) * config.point_feature_size_ + 0], 1e-6);
+    EXPECT_NEAR(
+      static_cast<double>(i), points[(points_per_pointcloud_ + i) * config.point_feature_size_ + 1],
+      1e-6);
+    EXPECT_NEAR(
+      static_cast<double>(i), points[(points_per_pointcloud_ + i) * config.point_feature_size_ + 2],
+      1e-6);
+    EXPECT_NEAR(0.1, points[(points_per_pointcloud_ + i) * config.point_feature_size_ + 3], 1e-6);
+  }
+
+  // Check invalid points
+  for (std::size_t i = 2 * points_per_pointcloud_ * config.point_feature_size_;
+       i < capacity_ * config.point_feature_size_; ++i) {
+    EXPECT_TRUE(std::isnan(points[i]));
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
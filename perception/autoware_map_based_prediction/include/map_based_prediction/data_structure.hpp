@@ -29,7 +29,10 @@
 
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_routing/LaneletPath.h>
+#include <tf2/LinearMath/Quaternion.h>
 
+#include <cstddef>
+#include <memory>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -68,12 +71,30 @@ struct LaneletData
   double probability;
 };
 
+/**
+ * @brief reference path with the arc length and the orientation of its points, which are computed
+ * once per lanelet sequence and shared by all the objects predicted along it
+ */
+struct ReferencePath
+{
+  PosePath path;
+  // arc length of each point from the first point [m]
+  std::vector<double> s;
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+  std::vector<tf2::Quaternion> orientation;
+};
+using ReferencePathConstPtr = std::shared_ptr<const ReferencePath>;
+
 struct PredictedRefPath
 {
   float probability;
   double speed_limit;
   double width;
-  PosePath path;
+  ReferencePathConstPtr path;
+  // index of the point of the path from which the object is predicted
+  size_t start_index{0};
   Maneuver maneuver;
 };
 
@@ -0,0 +1,95 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MAP_BASED_PREDICTION__LANELET_QUERY_CACHE_HPP_
+#define MAP_BASED_PREDICTION__LANELET_QUERY_CACHE_HPP_
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/Forward.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace autoware::map_based_prediction
+{
+/**
+ * @brief per-lanelet results of the map and routing graph queries used to build the reference
+ * paths of the vehicles
+ *
+ * The results only depend on the map, so they are kept across frames until the next map is set.
+ * get() can be called from several threads at once, setMap() and clear() can not.
+ */
+class LaneletQueryCache
+{
+public:
+  struct Entry
+  {
+    /** @brief previous lanelets in the routing graph */
+    lanelet::ConstLanelets previous;
+    /** @brief left/right neighbour used as the target of a lane change, if any */
+    std::optional<lanelet::ConstLanelet> left;
+    std::optional<lanelet::ConstLanelet> right;
+    /** @brief whether the lanelet has neither following lanelets nor lane change neighbours */
+    bool is_isolated{false};
+    double length_3d{0.0};
+    /** @brief legal speed limit [m/s] */
+    double speed_limit{0.0};
+  };
+
+  /**
+   * @brief whether only the lane change neighbours in the routing graph are considered, or also the
+   * adjacent lanelets and the lanelets sharing a bound
+   */
+  void setConsiderOnlyRoutableNeighbours(const bool consider_only_routable_neighbours);
+
+  /** @brief set the map to query, which also drops the cached results of the previous map */
+  void setMap(
+    const lanelet::LaneletMapPtr & lanelet_map_ptr,
+    const lanelet::routing::RoutingGraphPtr & routing_graph_ptr,
+    const lanelet::traffic_rules::TrafficRulesPtr & traffic_rules_ptr);
+
+  void clear();
+
+  size_t size() const;
+
+  /**
+   * @brief get the query results of the lanelet, running the queries on the first call
+   *
+   * The reference stays valid until the next setMap() or clear().
+   */
+  const Entry & get(const lanelet::ConstLanelet & lanelet) const;
+
+private:
+  Entry query(const lanelet::ConstLanelet & lanelet) const;
+  std::optional<lanelet::ConstLanelet> queryLeftOrRight(
+    const lanelet::ConstLanelet & lanelet, const bool get_left) const;
+
+  bool consider_only_routable_neighbours_{false};
+
+  lanelet::LaneletMapPtr lanelet_map_ptr_;
+  lanelet::routing::RoutingGraphPtr routing_graph_ptr_;
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr_;
+
+  mutable std::shared_mutex mutex_;
+  // references to the elements of an unordered_map stay valid when it rehashes
+  mutable std::unordered_map<lanelet::Id, Entry> entries_;
+};
+}  // namespace autoware::map_based_prediction
+
+#endif  // MAP_BASED_PREDICTION__LANELET_QUERY_CACHE_HPP_
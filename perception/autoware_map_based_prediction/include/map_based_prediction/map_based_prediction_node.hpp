@@ -16,6 +16,7 @@
 #define MAP_BASED_PREDICTION__MAP_BASED_PREDICTION_NODE_HPP_
 
 #include "map_based_prediction/data_structure.hpp"
+#include "map_based_prediction/lanelet_query_cache.hpp"
 #include "map_based_prediction/path_generator.hpp"
 #include "map_based_prediction/predictor_vru.hpp"
 
@@ -45,6 +46,7 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -100,6 +102,7 @@ private:
   std::shared_ptr<lanelet::LaneletMap> lanelet_map_ptr_;
   std::shared_ptr<lanelet::routing::RoutingGraph> routing_graph_ptr_;
   std::shared_ptr<lanelet::traffic_rules::TrafficRules> traffic_rules_ptr_;
+  LaneletQueryCache lanelet_query_cache_;
 
   // parameter update
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
@@ -160,6 +163,9 @@ private:
   double speed_limit_multiplier_;
   double acceleration_exponential_half_life_;
 
+  // Number of threads predicting the vehicles
+  int num_threads_;
+
   ////// Member Functions
   // Node callbacks
   void mapCallback(const LaneletMapBin::ConstSharedPtr msg);
@@ -215,9 +221,18 @@ private:
   // Vehicle path process
   PredictedObject getPredictionForNonVehicleObject(
     const std_msgs::msg::Header & header, const TrackedObject & object);
+  struct VehiclePredictionTask
+  {
+    size_t output_index;
+    TrackedObject transformed_object;
+    // object with the updated yaw and velocity
+    TrackedObject object;
+    LaneletsData current_lanelets;
+    // maneuver of the most probable reference path, for the debug marker
+    std::optional<Maneuver> debug_maneuver;
+  };
   std::optional<PredictedObject> getPredictionForVehicleObject(
-    const std_msgs::msg::Header & header, const TrackedObject & object,
-    const double objects_detected_time, visualization_msgs::msg::MarkerArray & debug_markers);
+    VehiclePredictionTask & task, const double objects_detected_time);
   std::optional<size_t> searchProperStartingRefPathIndex(
     const TrackedObject & object, const PosePath & pose_path) const;
   std::vector<LaneletPathWithPathInfo> getPredictedReferencePath(
@@ -226,9 +241,12 @@ private:
   std::vector<PredictedRefPath> convertPredictedReferencePath(
     const TrackedObject & object,
     const std::vector<LaneletPathWithPathInfo> & lanelet_ref_paths) const;
-  mutable universe_utils::LRUCache<lanelet::routing::LaneletPath, std::pair<PosePath, double>>
+  // reference paths and their widths, shared by the objects along the same lanelet sequence
+  mutable universe_utils::LRUCache<
+    lanelet::routing::LaneletPath, std::pair<ReferencePathConstPtr, double>>
     lru_cache_of_convert_path_type_{1000};
-  std::pair<PosePath, double> convertLaneletPathToPosePath(
+  mutable std::mutex lru_cache_of_convert_path_type_mutex_;
+  std::pair<ReferencePathConstPtr, double> convertLaneletPathToReferencePath(
     const lanelet::routing::LaneletPath & path) const;
 
   ////// Debugger
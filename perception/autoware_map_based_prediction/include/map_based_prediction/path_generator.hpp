@@ -83,6 +83,11 @@ struct CrosswalkEdgePoints
 
 using FrenetPath = std::vector<FrenetPoint>;
 
+/**
+ * @brief compute the arc length and the orientations of the reference path
+ */
+ReferencePath createReferencePath(PosePath pose_path);
+
 class PathGenerator
 {
 public:
@@ -105,6 +110,14 @@ public:
     const double lateral_duration, const double path_width = 0.0,
     const double speed_limit = 0.0) const;
 
+  /**
+   * @brief generate the path along the reference path, starting from its point start_index
+   */
+  PredictedPath generatePathForOnLaneVehicle(
+    const TrackedObject & object, const ReferencePath & ref_path, const size_t start_index,
+    const double duration, const double lateral_duration, const double path_width = 0.0,
+    const double speed_limit = 0.0) const;
+
   PredictedPath generatePathForCrosswalkUser(
     const TrackedObject & object, const CrosswalkEdgePoints & reachable_crosswalk,
     const double duration) const;
@@ -135,9 +148,9 @@ private:
   PredictedPath generateStraightPath(const TrackedObject & object, const double duration) const;
 
   PredictedPath generatePolynomialPath(
-    const TrackedObject & object, const PosePath & ref_path, const double duration,
-    const double lateral_duration, const double path_width, const double backlash_width,
-    const double speed_limit = 0.0) const;
+    const TrackedObject & object, const ReferencePath & ref_path, const size_t start_index,
+    const double duration, const double lateral_duration, const double path_width,
+    const double backlash_width, const double speed_limit = 0.0) const;
 
   FrenetPath generateFrenetPath(
     const FrenetPoint & current_point, const FrenetPoint & target_point, const double max_length,
@@ -147,15 +160,17 @@ private:
   Eigen::Vector2d calcLonCoefficients(
     const FrenetPoint & current_point, const FrenetPoint & target_point, const double T) const;
 
+  // the base keys and values before base_begin are ignored
   std::vector<double> interpolationLerp(
     const std::vector<double> & base_keys, const std::vector<double> & base_values,
-    const std::vector<double> & query_keys) const;
+    const size_t base_begin, const std::vector<double> & query_keys) const;
   std::vector<tf2::Quaternion> interpolationLerp(
     const std::vector<double> & base_keys, const std::vector<tf2::Quaternion> & base_values,
-    const std::vector<double> & query_keys) const;
+    const size_t base_begin, const std::vector<double> & query_keys) const;
 
   PosePath interpolateReferencePath(
-    const PosePath & base_path, const FrenetPath & frenet_predicted_path) const;
+    const ReferencePath & base_path, const size_t start_index,
+    const FrenetPath & frenet_predicted_path) const;
 
   PredictedPath convertToPredictedPath(
     const TrackedObject & object, const FrenetPath & frenet_predicted_path,
@@ -0,0 +1,175 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "map_based_prediction/lanelet_query_cache.hpp"
+
+#include <autoware_lanelet2_extension/utility/utilities.hpp>
+
+#include <lanelet2_routing/RoutingGraph.h>
+
+#include <mutex>
+#include <utility>
+
+namespace autoware::map_based_prediction
+{
+namespace
+{
+/**
+ * @brief Get the Right LineSharing Lanelets object
+ *
+ * @param current_lanelet
+ * @param lanelet_map_ptr
+ * @return lanelet::ConstLanelets
+ */
+lanelet::ConstLanelets getRightLineSharingLanelets(
+  const lanelet::ConstLanelet & current_lanelet, const lanelet::LaneletMapPtr & lanelet_map_ptr)
+{
+  lanelet::ConstLanelets
+    output_lanelets;  // create an empty container of type lanelet::ConstLanelets
+
+  // step1: look for lane sharing current right bound
+  lanelet::Lanelets right_lane_candidates =
+    lanelet_map_ptr->laneletLayer.findUsages(current_lanelet.rightBound());
+  for (auto & candidate : right_lane_candidates) {
+    // exclude self lanelet
+    if (candidate == current_lanelet) continue;
+    // if candidate has linestring as left bound, assign it to output
+    if (candidate.leftBound() == current_lanelet.rightBound()) {
+      output_lanelets.push_back(candidate);
+    }
+  }
+  return output_lanelets;  // return empty
+}
+
+/**
+ * @brief Get the Left LineSharing Lanelets object
+ *
+ * @param current_lanelet
+ * @param lanelet_map_ptr
+ * @return lanelet::ConstLanelets
+ */
+lanelet::ConstLanelets getLeftLineSharingLanelets(
+  const lanelet::ConstLanelet & current_lanelet, const lanelet::LaneletMapPtr & lanelet_map_ptr)
+{
+  lanelet::ConstLanelets
+    output_lanelets;  // create an empty container of type lanelet::ConstLanelets
+
+  // step1: look for lane sharing current left bound
+  lanelet::Lanelets left_lane_candidates =
+    lanelet_map_ptr->laneletLayer.findUsages(current_lanelet.leftBound());
+  for (auto & candidate : left_lane_candidates) {
+    // exclude self lanelet
+    if (candidate == current_lanelet) continue;
+    // if candidate has linestring as right bound, assign it to output
+    if (candidate.rightBound() == current_lanelet.leftBound()) {
+      output_lanelets.push_back(candidate);
+    }
+  }
+  return output_lanelets;  // return empty
+}
+}  // namespace
+
+void LaneletQueryCache::setConsiderOnlyRoutableNeighbours(
+  const bool consider_only_routable_neighbours)
+{
+  std::unique_lock lock(mutex_);
+  consider_only_routable_neighbours_ = consider_only_routable_neighbours;
+  entries_.clear();
+}
+
+void LaneletQueryCache::setMap(
+  const lanelet::LaneletMapPtr & lanelet_map_ptr,
+  const lanelet::routing::RoutingGraphPtr & routing_graph_ptr,
+  const lanelet::traffic_rules::TrafficRulesPtr & traffic_rules_ptr)
+{
+  std::unique_lock lock(mutex_);
+  lanelet_map_ptr_ = lanelet_map_ptr;
+  routing_graph_ptr_ = routing_graph_ptr;
+  traffic_rules_ptr_ = traffic_rules_ptr;
+  entries_.clear();
+}
+
+void LaneletQueryCache::clear()
+{
+  std::unique_lock lock(mutex_);
+  entries_.clear();
+}
+
+size_t LaneletQueryCache::size() const
+{
+  std::shared_lock lock(mutex_);
+  return entries_.size();
+}
+
+const LaneletQueryCache::Entry & LaneletQueryCache::get(const lanelet::ConstLanelet & lanelet) const
+{
+  {
+    std::shared_lock lock(mutex_);
+    const auto it = entries_.find(lanelet.id());
+    if (it != entries_.end()) {
+      return it->second;
+    }
+  }
+
+  // run the queries without the lock, another thread may have inserted the lanelet meanwhile
+  auto entry = query(lanelet);
+  std::unique_lock lock(mutex_);
+  return entries_.try_emplace(lanelet.id(), std::move(entry)).first->second;
+}
+
+LaneletQueryCache::Entry LaneletQueryCache::query(const lanelet::ConstLanelet & lanelet) const
+{
+  Entry entry;
+  entry.previous = routing_graph_ptr_->previous(lanelet);
+  entry.left = queryLeftOrRight(lanelet, true);
+  entry.right = queryLeftOrRight(lanelet, false);
+  // isolated is often caused by lanelet with no connection e.g. shoulder-lane
+  entry.is_isolated = routing_graph_ptr_->following(lanelet).empty() &&
+                      routing_graph_ptr_->lefts(lanelet).empty() &&
+                      routing_graph_ptr_->rights(lanelet).empty();
+  entry.length_3d = lanelet::utils::getLaneletLength3d(lanelet);
+  const lanelet::traffic_rules::SpeedLimitInformation limit =
+    traffic_rules_ptr_->speedLimit(lanelet);
+  entry.speed_limit = static_cast<double>(limit.speedLimit.value());
+  return entry;
+}
+
+std::optional<lanelet::ConstLanelet> LaneletQueryCache::queryLeftOrRight(
+  const lanelet::ConstLanelet & lanelet, const bool get_left) const
+{
+  const auto opt =
+    get_left ? routing_graph_ptr_->left(lanelet) : routing_graph_ptr_->right(lanelet);
+  if (!!opt) {
+    return *opt;
+  }
+  if (!consider_only_routable_neighbours_) {
+    const auto adjacent = get_left ? routing_graph_ptr_->adjacentLeft(lanelet)
+                                   : routing_graph_ptr_->adjacentRight(lanelet);
+    if (!!adjacent) {
+      return *adjacent;
+    }
+    // search for unconnected lanelet
+    const auto unconnected_lanelets = get_left
+                                        ? getLeftLineSharingLanelets(lanelet, lanelet_map_ptr_)
+                                        : getRightLineSharingLanelets(lanelet, lanelet_map_ptr_);
+    // just return first candidate of unconnected lanelet for now
+    if (!unconnected_lanelets.empty()) {
+      return unconnected_lanelets.front();
+    }
+  }
+
+  // if no candidate lanelet found, return empty
+  return std::nullopt;
+}
+}  // namespace autoware::map_based_prediction
@@ -24,6 +24,7 @@
 #include <autoware/universe_utils/math/normalization.hpp>
 #include <autoware/universe_utils/math/unit_conversion.hpp>
 #include <autoware/universe_utils/ros/uuid_helper.hpp>
+#include <autoware/lanelet2_map_cache/lanelet2_map_cache.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
@@ -48,6 +49,10 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
 
 namespace autoware::map_based_prediction
 {
@@ -204,74 +209,6 @@ void updateLateralKinematicsVector(
   }
 }
 
-/**
- * @brief Get the Right LineSharing Lanelets object
- *
- * @param current_lanelet
- * @param lanelet_map_ptr
- * @return lanelet::ConstLanelets
- */
-lanelet::ConstLanelets getRightLineSharingLanelets(
-  const lanelet::ConstLanelet & current_lanelet, const lanelet::LaneletMapPtr & lanelet_map_ptr)
-{
-  lanelet::ConstLanelets
-    output_lanelets;  // create an empty container of type lanelet::ConstLanelets
-
-  // step1: look for lane sharing current right bound
-  lanelet::Lanelets right_lane_candidates =
-    lanelet_map_ptr->laneletLayer.findUsages(current_lanelet.rightBound());
-  for (auto & candidate : right_lane_candidates) {
-    // exclude self lanelet
-    if (candidate == current_lanelet) continue;
-    // if candidate has linestring as left bound, assign it to output
-    if (candidate.leftBound() == current_lanelet.rightBound()) {
-      output_lanelets.push_back(candidate);
-    }
-  }
-  return output_lanelets;  // return empty
-}
-
-/**
- * @brief Get the Left LineSharing Lanelets object
- *
- * @param current_lanelet
- * @param lanelet_map_ptr
- * @return lanelet::ConstLanelets
- */
-lanelet::ConstLanelets getLeftLineSharingLanelets(
-  const lanelet::ConstLanelet & current_lanelet, const lanelet::LaneletMapPtr & lanelet_map_ptr)
-{
-  lanelet::ConstLanelets
-    output_lanelets;  // create an empty container of type lanelet::ConstLanelets
-
-  // step1: look for lane sharing current left bound
-  lanelet::Lanelets left_lane_candidates =
-    lanelet_map_ptr->laneletLayer.findUsages(current_lanelet.leftBound());
-  for (auto & candidate : left_lane_candidates) {
-    // exclude self lanelet
-    if (candidate == current_lanelet) continue;
-    // if candidate has linestring as right bound, assign it to output
-    if (candidate.rightBound() == current_lanelet.leftBound()) {
-      output_lanelets.push_back(candidate);
-    }
-  }
-  return output_lanelets;  // return empty
-}
-
-/**
- * @brief Check if the lanelet is isolated in routing graph
- * @param current_lanelet
- * @param lanelet_map_ptr
- */
-bool isIsolatedLanelet(
-  const lanelet::ConstLanelet & lanelet, lanelet::routing::RoutingGraphPtr & graph)
-{
-  const auto & following_lanelets = graph->following(lanelet);
-  const auto & left_lanelets = graph->lefts(lanelet);
-  const auto & right_lanelets = graph->rights(lanelet);
-  return left_lanelets.empty() && right_lanelets.empty() && following_lanelets.empty();
-}
-
 /**
  * @brief Get the Possible Paths For Isolated Lanelet object
  * @param lanelet
@@ -411,8 +348,10 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
 
     consider_only_routable_neighbours_ =
       declare_parameter<bool>("lane_change_detection.consider_only_routable_neighbours");
+    lanelet_query_cache_.setConsiderOnlyRoutableNeighbours(consider_only_routable_neighbours_);
   }
   reference_path_resolution_ = declare_parameter<double>("reference_path_resolution");
+  num_threads_ = std::max(static_cast<int>(declare_parameter<int>("num_threads")), 1);
   /* prediction path will disabled when the estimated path length exceeds lanelet length. This
    * parameter control the estimated path length = vx * th * (rate)  */
   prediction_time_horizon_rate_for_validate_lane_length_ =
@@ -532,10 +471,14 @@ rcl_interfaces::msg::SetParametersResult MapBasedPredictionNode::onParam(
 void MapBasedPredictionNode::mapCallback(const LaneletMapBin::ConstSharedPtr msg)
 {
   RCLCPP_DEBUG(get_logger(), "[Map Based Prediction]: Start loading lanelet");
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
+  // NOTE: The map is shared with the other nodes of the process, and its centerlines are already
+  // computed, so that the vehicles can be predicted in parallel
+  const auto map_data = autoware::lanelet2_map_cache::from_bin_msg(*msg);
+  lanelet_map_ptr_ = map_data.map;
+  traffic_rules_ptr_ = map_data.traffic_rules;
+  routing_graph_ptr_ = map_data.routing_graph;
   lru_cache_of_convert_path_type_.clear();  // clear cache
+  lanelet_query_cache_.setMap(lanelet_map_ptr_, routing_graph_ptr_, traffic_rules_ptr_);
   RCLCPP_DEBUG(get_logger(), "[Map Based Prediction]: Map is loaded");
 
   predictor_vru_->setLaneletMap(lanelet_map_ptr_);
@@ -600,8 +543,15 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
   // get current crosswalk users for later prediction
   predictor_vru_->loadCurrentCrosswalkUsers(*in_objects);
 
+  // predicted objects in the order of the input objects
+  std::vector<std::optional<PredictedObject>> predicted_objects(in_objects->objects.size());
+  std::vector<VehiclePredictionTask> vehicle_tasks;
+  std::unordered_set<std::string> vehicle_ids;
+  bool has_duplicated_vehicle_id = false;
+
   // for each object
-  for (const auto & object : in_objects->objects) {
+  for (size_t object_index = 0; object_index < in_objects->objects.size(); ++object_index) {
+    const auto & object = in_objects->objects.at(object_index);
     TrackedObject transformed_object = object;
 
     // transform object frame if it's based on map frame
@@ -621,9 +571,8 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
       case ObjectClassification::PEDESTRIAN:
       case ObjectClassification::BICYCLE: {
         // Run pedestrian/bicycle prediction
-        const auto predicted_vru =
+        predicted_objects.at(object_index) =
           getPredictionForNonVehicleObject(output.header, transformed_object);
-        output.objects.emplace_back(predicted_vru);
         break;
       }
       case ObjectClassification::CAR:
@@ -631,11 +580,23 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
       case ObjectClassification::TRAILER:
       case ObjectClassification::MOTORCYCLE:
       case ObjectClassification::TRUCK: {
-        const auto predicted_object_opt = getPredictionForVehicleObject(
-          output.header, transformed_object, objects_detected_time, debug_markers);
-        if (predicted_object_opt) {
-          output.objects.push_back(predicted_object_opt.value());
-        }
+        // The history is updated here so that the vehicles can be predicted in parallel below
+        auto & task = vehicle_tasks.emplace_back();
+        task.output_index = object_index;
+        task.transformed_object = transformed_object;
+        task.object = transformed_object;
+
+        // Update object yaw and velocity
+        updateObjectData(task.object);
+
+        // Get Closest Lanelet
+        task.current_lanelets = getCurrentLanelets(task.object);
+
+        // Update Objects History
+        updateRoadUsersHistory(output.header, task.object, task.current_lanelets);
+
+        const auto object_id = autoware::universe_utils::toHexString(object.object_id);
+        has_duplicated_vehicle_id |= !vehicle_ids.insert(object_id).second;
         break;
       }
       default: {
@@ -645,12 +606,35 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
         predicted_path.confidence = 1.0;
 
         predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
-        output.objects.push_back(predicted_unknown_object);
+        predicted_objects.at(object_index) = predicted_unknown_object;
         break;
       }
     }
   }
 
+  // Each vehicle only modifies its own history, so the vehicles are predicted in parallel unless
+  // two of them share an id. The time keeper only tracks the thread it was started from.
+  const int num_threads = (time_keeper_ || has_duplicated_vehicle_id) ? 1 : num_threads_;
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+  for (size_t task_index = 0; task_index < vehicle_tasks.size(); ++task_index) {
+    auto & task = vehicle_tasks.at(task_index);
+    predicted_objects.at(task.output_index) =
+      getPredictionForVehicleObject(task, objects_detected_time);
+  }
+
+  for (const auto & task : vehicle_tasks) {
+    if (task.debug_maneuver) {
+      debug_markers.markers.push_back(
+        getDebugMarker(task.object, *task.debug_maneuver, debug_markers.markers.size()));
+    }
+  }
+
+  for (auto & predicted_object : predicted_objects) {
+    if (predicted_object) {
+      output.objects.push_back(std::move(*predicted_object));
+    }
+  }
+
   // process lost crosswalk users to tackle unstable detection
   if (remember_lost_crosswalk_users_) {
     PredictedObjects retrieved_objects = predictor_vru_->retrieveUndetectedObjects();
@@ -849,13 +833,13 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
   for (const auto & current_lanelet_data : current_lanelets_data) {
     std::vector<LaneletPathWithPathInfo> ref_paths_per_lanelet;
 
+    const auto & current_lanelet_query = lanelet_query_cache_.get(current_lanelet_data.lanelet);
+
     // Set condition on each lanelet
     lanelet::routing::PossiblePathsParams possible_params{0, {}, 0, false, true};
     double target_speed_limit = 0.0;
     {
-      const lanelet::traffic_rules::SpeedLimitInformation limit =
-        traffic_rules_ptr_->speedLimit(current_lanelet_data.lanelet);
-      const double legal_speed_limit = static_cast<double>(limit.speedLimit.value());
+      const double legal_speed_limit = current_lanelet_query.speed_limit;
       target_speed_limit = legal_speed_limit * speed_limit_multiplier_;
       const bool final_speed_surpasses_limit = final_speed_after_acceleration > target_speed_limit;
       const bool object_has_surpassed_limit_already = obj_vel > target_speed_limit;
@@ -863,7 +847,7 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
       double search_dist = (final_speed_surpasses_limit && !object_has_surpassed_limit_already)
                              ? get_search_distance_with_partial_acc(target_speed_limit)
                              : get_search_distance_with_decaying_acc();
-      search_dist += lanelet::utils::getLaneletLength3d(current_lanelet_data.lanelet);
+      search_dist += current_lanelet_query.length_3d;
       possible_params.routingCostLimit = search_dist;
     }
 
@@ -871,7 +855,7 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
     // isolated is often caused by lanelet with no connection e.g. shoulder-lane
     auto getPathsForNormalOrIsolatedLanelet = [&](const lanelet::ConstLanelet & lanelet) {
       // if lanelet is not isolated, return normal possible paths
-      if (!isIsolatedLanelet(lanelet, routing_graph_ptr_)) {
+      if (!lanelet_query_cache_.get(lanelet).is_isolated) {
         return routing_graph_ptr_->possiblePaths(lanelet, possible_params);
       }
       // if lanelet is isolated, check if it has enough length
@@ -883,35 +867,6 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
       }
     };
 
-    // lambda function to extract left/right lanelets
-    auto getLeftOrRightLanelets = [&](
-                                    const lanelet::ConstLanelet & lanelet,
-                                    const bool get_left) -> std::optional<lanelet::ConstLanelet> {
-      const auto opt =
-        get_left ? routing_graph_ptr_->left(lanelet) : routing_graph_ptr_->right(lanelet);
-      if (!!opt) {
-        return *opt;
-      }
-      if (!consider_only_routable_neighbours_) {
-        const auto adjacent = get_left ? routing_graph_ptr_->adjacentLeft(lanelet)
-                                       : routing_graph_ptr_->adjacentRight(lanelet);
-        if (!!adjacent) {
-          return *adjacent;
-        }
-        // search for unconnected lanelet
-        const auto unconnected_lanelets =
-          get_left ? getLeftLineSharingLanelets(lanelet, lanelet_map_ptr_)
-                   : getRightLineSharingLanelets(lanelet, lanelet_map_ptr_);
-        // just return first candidate of unconnected lanelet for now
-        if (!unconnected_lanelets.empty()) {
-          return unconnected_lanelets.front();
-        }
-      }
-
-      // if no candidate lanelet found, return empty
-      return std::nullopt;
-    };
-
     bool left_paths_exists = false;
     bool right_paths_exists = false;
     bool center_paths_exists = false;
@@ -920,7 +875,7 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
     {
       PredictedRefPath ref_path_info;
       lanelet::routing::LaneletPaths left_paths;
-      const auto left_lanelet = getLeftOrRightLanelets(current_lanelet_data.lanelet, true);
+      const auto & left_lanelet = current_lanelet_query.left;
       if (!!left_lanelet) {
         left_paths = getPathsForNormalOrIsolatedLanelet(left_lanelet.value());
         left_paths_exists = !left_paths.empty();
@@ -936,7 +891,7 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
     {
       PredictedRefPath ref_path_info;
       lanelet::routing::LaneletPaths right_paths;
-      const auto right_lanelet = getLeftOrRightLanelets(current_lanelet_data.lanelet, false);
+      const auto & right_lanelet = current_lanelet_query.right;
       if (!!right_lanelet) {
         right_paths = getPathsForNormalOrIsolatedLanelet(right_lanelet.value());
         right_paths_exists = !right_paths.empty();
@@ -1375,7 +1330,7 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::convertPredictedReferenceP
   for (const auto & ref_path : lanelet_ref_paths) {
     const auto & lanelet_path = ref_path.first;
     const auto & ref_path_info = ref_path.second;
-    const auto converted_path = convertLaneletPathToPosePath(lanelet_path);
+    const auto converted_path = convertLaneletPathToReferencePath(lanelet_path);
     PredictedRefPath predicted_path;
     predicted_path.probability = ref_path_info.probability;
     predicted_path.path = converted_path.first;
@@ -1387,8 +1342,9 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::convertPredictedReferenceP
 
   // Step 2. Search starting point for each reference path
   for (auto it = converted_ref_paths.begin(); it != converted_ref_paths.end();) {
-    auto & pose_path = it->path;
+    const auto & pose_path = it->path->path;
     if (pose_path.empty()) {
+      it = converted_ref_paths.erase(it);
       continue;
     }
 
@@ -1396,8 +1352,8 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::convertPredictedReferenceP
       searchProperStartingRefPathIndex(object, pose_path);
 
     if (opt_starting_idx.has_value()) {
-      // Trim the reference path
-      pose_path.erase(pose_path.begin(), pose_path.begin() + opt_starting_idx.value());
+      // The reference path is shared with the other objects, so it is trimmed by the start index
+      it->start_index = opt_starting_idx.value();
       ++it;
     } else {
       // Proper starting point is not found, remove the reference path
@@ -1408,24 +1364,27 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::convertPredictedReferenceP
   return converted_ref_paths;
 }
 
-std::pair<PosePath, double> MapBasedPredictionNode::convertLaneletPathToPosePath(
+std::pair<ReferencePathConstPtr, double> MapBasedPredictionNode::convertLaneletPathToReferencePath(
   const lanelet::routing::LaneletPath & path) const
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  if (lru_cache_of_convert_path_type_.contains(path)) {
-    return *lru_cache_of_convert_path_type_.get(path);
+  {
+    std::lock_guard<std::mutex> lock(lru_cache_of_convert_path_type_mutex_);
+    if (lru_cache_of_convert_path_type_.contains(path)) {
+      return *lru_cache_of_convert_path_type_.get(path);
+    }
   }
 
-  std::pair<PosePath, double> converted_path_and_width;
+  std::pair<ReferencePathConstPtr, double> converted_path_and_width;
   {
     PosePath converted_path;
     double width = 10.0;  // Initialize with a large value
 
     // Insert Positions. Note that we start inserting points from previous lanelet
     if (!path.empty()) {
-      lanelet::ConstLanelets prev_lanelets = routing_graph_ptr_->previous(path.front());
+      const auto & prev_lanelets = lanelet_query_cache_.get(path.front()).previous;
       if (!prev_lanelets.empty()) {
         lanelet::ConstLanelet prev_lanelet = prev_lanelets.front();
         bool init_flag = true;
@@ -1508,9 +1467,11 @@ std::pair<PosePath, double> MapBasedPredictionNode::convertLaneletPathToPosePath
     // interpolation for xy
     const auto resampled_converted_path = autoware::motion_utils::resamplePoseVector(
       converted_path, reference_path_resolution_, use_akima_spline_for_xy, use_lerp_for_z);
-    converted_path_and_width = std::make_pair(resampled_converted_path, width);
+    converted_path_and_width = std::make_pair(
+      std::make_shared<const ReferencePath>(createReferencePath(resampled_converted_path)), width);
   }
 
+  std::lock_guard<std::mutex> lock(lru_cache_of_convert_path_type_mutex_);
   lru_cache_of_convert_path_type_.put(path, converted_path_and_width);
   return converted_path_and_width;
 }
@@ -1522,21 +1483,11 @@ PredictedObject MapBasedPredictionNode::getPredictionForNonVehicleObject(
 }
 
 std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleObject(
-  const std_msgs::msg::Header & header, const TrackedObject & transformed_object,
-  const double objects_detected_time, visualization_msgs::msg::MarkerArray & debug_markers)
+  VehiclePredictionTask & task, const double objects_detected_time)
 {
-  auto object = transformed_object;
-
-  // Update object yaw and velocity
-  updateObjectData(object);
-
-  // Get Closest Lanelet
-  const auto current_lanelets = utils::getCurrentLanelets(
-    object, lanelet_map_ptr_, road_users_history_, dist_threshold_for_searching_lanelet_,
-    delta_yaw_threshold_for_searching_lanelet_, sigma_lateral_offset_, sigma_yaw_angle_deg_);
-
-  // Update Objects History
-  updateRoadUsersHistory(header, object, current_lanelets);
+  const auto & transformed_object = task.transformed_object;
+  const auto & object = task.object;
+  const auto & current_lanelets = task.current_lanelets;
 
   // For off lane obstacles
   if (current_lanelets.empty()) {
@@ -1596,9 +1547,7 @@ std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleOb
       [](const PredictedRefPath & a, const PredictedRefPath & b) {
         return a.probability < b.probability;
       });
-    const auto debug_marker =
-      getDebugMarker(object, max_prob_path->maneuver, debug_markers.markers.size());
-    debug_markers.markers.push_back(debug_marker);
+    task.debug_maneuver = max_prob_path->maneuver;
   }
 
   // Fix object angle if its orientation unreliable (e.g. far object by radar sensor)
@@ -1616,7 +1565,7 @@ std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleOb
 
   for (const auto & ref_path : ref_paths) {
     PredictedPath predicted_path = path_generator_->generatePathForOnLaneVehicle(
-      yaw_fixed_object, ref_path.path, prediction_time_horizon_.vehicle,
+      yaw_fixed_object, *ref_path.path, ref_path.start_index, prediction_time_horizon_.vehicle,
       lateral_control_time_horizon_, ref_path.width, ref_path.speed_limit);
     if (predicted_path.path.empty()) continue;
 
@@ -16,15 +16,38 @@
 
 #include <autoware/interpolation/linear_interpolation.hpp>
 #include <autoware/interpolation/spline_interpolation.hpp>
-#include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/universe_utils/geometry/geometry.hpp>
 
 #include <algorithm>
+#include <utility>
 
 namespace autoware::map_based_prediction
 {
 using autoware::universe_utils::ScopedTimeTrack;
 
+ReferencePath createReferencePath(PosePath pose_path)
+{
+  ReferencePath ref_path;
+  ref_path.path = std::move(pose_path);
+  const auto & path = ref_path.path;
+  ref_path.s.assign(path.size(), 0.0);
+  ref_path.x.resize(path.size());
+  ref_path.y.resize(path.size());
+  ref_path.z.resize(path.size());
+  ref_path.orientation.resize(path.size());
+  for (size_t i = 0; i < path.size(); ++i) {
+    ref_path.x.at(i) = path.at(i).position.x;
+    ref_path.y.at(i) = path.at(i).position.y;
+    ref_path.z.at(i) = path.at(i).position.z;
+    tf2::fromMsg(path.at(i).orientation, ref_path.orientation.at(i));
+    if (i > 0) {
+      ref_path.s.at(i) =
+        ref_path.s.at(i - 1) + autoware::universe_utils::calcDistance2d(path.at(i - 1), path.at(i));
+    }
+  }
+  return ref_path;
+}
+
 PathGenerator::PathGenerator(const double sampling_time_interval)
 : sampling_time_interval_(sampling_time_interval)
 {
@@ -184,11 +207,20 @@ PredictedPath PathGenerator::generatePathForOffLaneVehicle(
 PredictedPath PathGenerator::generatePathForOnLaneVehicle(
   const TrackedObject & object, const PosePath & ref_path, const double duration,
   const double lateral_duration, const double path_width, const double speed_limit) const
+{
+  return generatePathForOnLaneVehicle(
+    object, createReferencePath(ref_path), 0, duration, lateral_duration, path_width, speed_limit);
+}
+
+PredictedPath PathGenerator::generatePathForOnLaneVehicle(
+  const TrackedObject & object, const ReferencePath & ref_path, const size_t start_index,
+  const double duration, const double lateral_duration, const double path_width,
+  const double speed_limit) const
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  if (ref_path.size() < 2) {
+  if (ref_path.path.size() < start_index + 2) {
     return generateStraightPath(object, duration);
   }
 
@@ -212,7 +244,8 @@ PredictedPath PathGenerator::generatePathForOnLaneVehicle(
   backlash_width = std::max(backlash_width, 0.0);  // minimum is 0.0
 
   return generatePolynomialPath(
-    object, ref_path, duration, lateral_duration, path_width, backlash_width, speed_limit);
+    object, ref_path, start_index, duration, lateral_duration, path_width, backlash_width,
+    speed_limit);
 }
 
 PredictedPath PathGenerator::generateStraightPath(
@@ -236,16 +269,17 @@ PredictedPath PathGenerator::generateStraightPath(
 }
 
 PredictedPath PathGenerator::generatePolynomialPath(
-  const TrackedObject & object, const PosePath & ref_path, const double duration,
-  const double lateral_duration, const double path_width, const double backlash_width,
-  const double speed_limit) const
+  const TrackedObject & object, const ReferencePath & ref_path, const size_t start_index,
+  const double duration, const double lateral_duration, const double path_width,
+  const double backlash_width, const double speed_limit) const
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
   // Get current Frenet Point
-  const double ref_path_len = autoware::motion_utils::calcArcLength(ref_path);
-  const auto current_point = getFrenetPoint(object, ref_path.at(0), duration, speed_limit);
+  const double ref_path_len = ref_path.s.back() - ref_path.s.at(start_index);
+  const auto current_point =
+    getFrenetPoint(object, ref_path.path.at(start_index), duration, speed_limit);
 
   // Step 1. Set Target Frenet Point
   // Note that we do not set position s,
@@ -301,7 +335,8 @@ PredictedPath PathGenerator::generatePolynomialPath(
     current_point, terminal_point, ref_path_len, duration, lateral_duration_adjusted);
 
   // Step 3. Interpolate Reference Path for converting predicted path coordinate
-  const auto interpolated_ref_path = interpolateReferencePath(ref_path, frenet_predicted_path);
+  const auto interpolated_ref_path =
+    interpolateReferencePath(ref_path, start_index, frenet_predicted_path);
 
   if (frenet_predicted_path.size() < 2 || interpolated_ref_path.size() < 2) {
     return generateStraightPath(object, duration);
@@ -407,7 +442,7 @@ Eigen::Vector2d PathGenerator::calcLonCoefficients(
 
 std::vector<double> PathGenerator::interpolationLerp(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
-  const std::vector<double> & query_keys) const
+  const size_t base_begin, const std::vector<double> & query_keys) const
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_)
@@ -416,7 +451,7 @@ std::vector<double> PathGenerator::interpolationLerp(
   // calculate linear interpolation
   // extrapolate the value if the query key is out of the base key range
   std::vector<double> query_values;
-  size_t key_index = 0;
+  size_t key_index = base_begin;
   double last_query_key = query_keys.at(0);
   for (const auto query_key : query_keys) {
     // search for the closest key index
@@ -431,7 +466,7 @@ std::vector<double> PathGenerator::interpolationLerp(
     } else {
       // if current query key is smaller than the last query key, search base_keys decreasing order
       while (base_keys.at(key_index) > query_key) {
-        if (key_index == 0) {
+        if (key_index == base_begin) {
           break;
         }
         --key_index;
@@ -453,7 +488,7 @@ std::vector<double> PathGenerator::interpolationLerp(
 
 std::vector<tf2::Quaternion> PathGenerator::interpolationLerp(
   const std::vector<double> & base_keys, const std::vector<tf2::Quaternion> & base_values,
-  const std::vector<double> & query_keys) const
+  const size_t base_begin, const std::vector<double> & query_keys) const
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_)
@@ -462,7 +497,7 @@ std::vector<tf2::Quaternion> PathGenerator::interpolationLerp(
   // calculate linear interpolation
   // extrapolate the value if the query key is out of the base key range
   std::vector<tf2::Quaternion> query_values;
-  size_t key_index = 0;
+  size_t key_index = base_begin;
   double last_query_key = query_keys.at(0);
   for (const auto query_key : query_keys) {
     // search for the closest key index
@@ -477,7 +512,7 @@ std::vector<tf2::Quaternion> PathGenerator::interpolationLerp(
     } else {
       // if current query key is smaller than the last query key, search base_keys decreasing order
       while (base_keys.at(key_index) > query_key) {
-        if (key_index == 0) {
+        if (key_index == base_begin) {
           break;
         }
         --key_index;
@@ -507,7 +542,8 @@ std::vector<tf2::Quaternion> PathGenerator::interpolationLerp(
 }
 
 PosePath PathGenerator::interpolateReferencePath(
-  const PosePath & base_path, const FrenetPath & frenet_predicted_path) const
+  const ReferencePath & base_path, const size_t start_index,
+  const FrenetPath & frenet_predicted_path) const
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
@@ -515,41 +551,26 @@ PosePath PathGenerator::interpolateReferencePath(
   PosePath interpolated_path;
   const size_t interpolate_num = frenet_predicted_path.size();
   if (interpolate_num < 2) {
-    interpolated_path.emplace_back(base_path.front());
+    interpolated_path.emplace_back(base_path.path.at(start_index));
     return interpolated_path;
   }
 
-  // Prepare base path vectors
-  std::vector<double> base_path_x(base_path.size());
-  std::vector<double> base_path_y(base_path.size());
-  std::vector<double> base_path_z(base_path.size());
-  std::vector<tf2::Quaternion> base_path_orientation(base_path.size());
-  std::vector<double> base_path_s(base_path.size(), 0.0);
-  for (size_t i = 0; i < base_path.size(); ++i) {
-    base_path_x.at(i) = base_path.at(i).position.x;
-    base_path_y.at(i) = base_path.at(i).position.y;
-    base_path_z.at(i) = base_path.at(i).position.z;
-    tf2::Quaternion src_tf;
-    tf2::fromMsg(base_path.at(i).orientation, src_tf);
-    base_path_orientation.at(i) = src_tf;
-    if (i > 0) {
-      base_path_s.at(i) = base_path_s.at(i - 1) + autoware::universe_utils::calcDistance2d(
-                                                    base_path.at(i - 1), base_path.at(i));
-    }
-  }
-
-  // Prepare resampled s vector
+  // Prepare resampled s vector, the Frenet path starts from the start index of the base path
+  const double start_s = base_path.s.at(start_index);
   std::vector<double> resampled_s(frenet_predicted_path.size());
   for (size_t i = 0; i < frenet_predicted_path.size(); ++i) {
-    resampled_s.at(i) = frenet_predicted_path.at(i).s;
+    resampled_s.at(i) = frenet_predicted_path.at(i).s + start_s;
   }
 
   // Linear Interpolation for x, y, z, and orientation
-  std::vector<double> lerp_ref_path_x = interpolationLerp(base_path_s, base_path_x, resampled_s);
-  std::vector<double> lerp_ref_path_y = interpolationLerp(base_path_s, base_path_y, resampled_s);
-  std::vector<double> lerp_ref_path_z = interpolationLerp(base_path_s, base_path_z, resampled_s);
+  std::vector<double> lerp_ref_path_x =
+    interpolationLerp(base_path.s, base_path.x, start_index, resampled_s);
+  std::vector<double> lerp_ref_path_y =
+    interpolationLerp(base_path.s, base_path.y, start_index, resampled_s);
+  std::vector<double> lerp_ref_path_z =
+    interpolationLerp(base_path.s, base_path.z, start_index, resampled_s);
   std::vector<tf2::Quaternion> lerp_ref_path_orientation =
-    interpolationLerp(base_path_s, base_path_orientation, resampled_s);
+    interpolationLerp(base_path.s, base_path.orientation, start_index, resampled_s);
 
   // Set the interpolated PosePath
   interpolated_path.resize(interpolate_num);
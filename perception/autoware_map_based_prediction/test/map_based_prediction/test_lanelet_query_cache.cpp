@@ -0,0 +1,140 @@
+// Copyright 2024 TIER IV, inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "map_based_prediction/lanelet_query_cache.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+#include <memory>
+
+using autoware::map_based_prediction::LaneletQueryCache;
+
+namespace
+{
+lanelet::LineString3d makeLine(const lanelet::Point3d & begin, const lanelet::Point3d & end)
+{
+  lanelet::LineString3d line(lanelet::utils::getId(), {begin, end});
+  line.attributes()[lanelet::AttributeName::Type] = lanelet::AttributeValueString::LineThin;
+  line.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Dashed;
+  return line;
+}
+
+lanelet::Lanelet makeLanelet(
+  const lanelet::LineString3d & left, const lanelet::LineString3d & right)
+{
+  lanelet::Lanelet lanelet(lanelet::utils::getId(), left, right);
+  lanelet.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+  return lanelet;
+}
+
+lanelet::Point3d makePoint(const double x, const double y)
+{
+  return lanelet::Point3d(lanelet::utils::getId(), x, y, 0.0);
+}
+
+/**
+ * @brief map with the lanelet `a` followed by `b`, the lanelet `c` on the left of `a` and the
+ * lanelet `d` connected to nothing
+ */
+struct TestMap
+{
+  TestMap()
+  {
+    const auto p00 = makePoint(0.0, 0.0);
+    const auto p03 = makePoint(0.0, 3.0);
+    const auto p06 = makePoint(0.0, 6.0);
+    const auto p10_0 = makePoint(10.0, 0.0);
+    const auto p10_3 = makePoint(10.0, 3.0);
+    const auto p10_6 = makePoint(10.0, 6.0);
+    const auto p20_0 = makePoint(20.0, 0.0);
+    const auto p20_3 = makePoint(20.0, 3.0);
+
+    const auto a_left = makeLine(p03, p10_3);
+    a = makeLanelet(a_left, makeLine(p00, p10_0));
+    b = makeLanelet(makeLine(p10_3, p20_3), makeLine(p10_0, p20_0));
+    c = makeLanelet(makeLine(p06, p10_6), a_left);
+    d = makeLanelet(
+      makeLine(makePoint(100.0, 3.0), makePoint(110.0, 3.0)),
+      makeLine(makePoint(100.0, 0.0), makePoint(110.0, 0.0)));
+
+    map = lanelet::utils::createMap({a, b, c, d});
+    traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+      lanelet::Locations::Germany, lanelet::Participants::Vehicle);
+    routing_graph = lanelet::routing::RoutingGraph::build(*map, *traffic_rules);
+  }
+
+  lanelet::Lanelet a;
+  lanelet::Lanelet b;
+  lanelet::Lanelet c;
+  lanelet::Lanelet d;
+  lanelet::LaneletMapPtr map;
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules;
+  lanelet::routing::RoutingGraphPtr routing_graph;
+};
+}  // namespace
+
+TEST(LaneletQueryCache, test_get)
+{
+  const TestMap test_map;
+  LaneletQueryCache cache;
+  cache.setMap(test_map.map, test_map.routing_graph, test_map.traffic_rules);
+
+  const auto & a = cache.get(test_map.a);
+  EXPECT_TRUE(a.previous.empty());
+  EXPECT_FALSE(a.is_isolated);
+  EXPECT_NEAR(a.length_3d, 10.0, 1e-6);
+  EXPECT_GT(a.speed_limit, 0.0);
+  ASSERT_TRUE(a.left.has_value());
+  EXPECT_EQ(a.left->id(), test_map.c.id());
+  EXPECT_FALSE(a.right.has_value());
+
+  const auto & b = cache.get(test_map.b);
+  ASSERT_EQ(b.previous.size(), 1u);
+  EXPECT_EQ(b.previous.front().id(), test_map.a.id());
+
+  const auto & c = cache.get(test_map.c);
+  ASSERT_TRUE(c.right.has_value());
+  EXPECT_EQ(c.right->id(), test_map.a.id());
+
+  const auto & d = cache.get(test_map.d);
+  EXPECT_TRUE(d.is_isolated);
+  EXPECT_FALSE(d.left.has_value());
+  EXPECT_FALSE(d.right.has_value());
+}
+
+TEST(LaneletQueryCache, test_cache_is_reset_with_map)
+{
+  const TestMap test_map;
+  LaneletQueryCache cache;
+  cache.setMap(test_map.map, test_map.routing_graph, test_map.traffic_rules);
+  EXPECT_EQ(cache.size(), 0u);
+
+  const auto * first = &cache.get(test_map.a);
+  EXPECT_EQ(&cache.get(test_map.a), first);
+  cache.get(test_map.b);
+  EXPECT_EQ(cache.size(), 2u);
+
+  cache.setMap(test_map.map, test_map.routing_graph, test_map.traffic_rules);
+  EXPECT_EQ(cache.size(), 0u);
+  cache.setConsiderOnlyRoutableNeighbours(true);
+  cache.get(test_map.a);
+  EXPECT_EQ(cache.size(), 1u);
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+}
@@ -153,6 +153,50 @@ TEST(PathGenerator, test_generatePathForOnLaneVehicle)
   EXPECT_EQ(predicted_path.path[0].position.z, 0.0);
 }
 
+TEST(PathGenerator, test_generatePathForOnLaneVehicleWithStartIndex)
+{
+  // Generate Path generator
+  const double prediction_time_horizon = 10.0;
+  const double lateral_control_time_horizon = 5.0;
+  const double prediction_sampling_time_interval = 0.5;
+  const double min_crosswalk_user_velocity = 0.1;
+  const autoware::map_based_prediction::PathGenerator path_generator =
+    autoware::map_based_prediction::PathGenerator(
+      prediction_sampling_time_interval, min_crosswalk_user_velocity);
+
+  // Generate dummy object moving along the reference path with a lateral offset
+  TrackedObject tracked_object = generate_static_object(ObjectClassification::CAR);
+  tracked_object.kinematics.pose_with_covariance.pose.position.x = 5.2;
+  tracked_object.kinematics.pose_with_covariance.pose.position.y = 0.5;
+  tracked_object.kinematics.twist_with_covariance.twist.linear.x = 5.0;
+
+  // Generate reference path
+  autoware::map_based_prediction::PosePath ref_path;
+  for (size_t i = 0; i < 100; ++i) {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = static_cast<double>(i);
+    pose.position.y = 0.01 * static_cast<double>(i);
+    ref_path.push_back(pose);
+  }
+  const size_t start_index = 5;
+  const autoware::map_based_prediction::PosePath trimmed_ref_path(
+    ref_path.begin() + start_index, ref_path.end());
+
+  // Generate predicted paths
+  const PredictedPath expected_path = path_generator.generatePathForOnLaneVehicle(
+    tracked_object, trimmed_ref_path, prediction_time_horizon, lateral_control_time_horizon);
+  const PredictedPath predicted_path = path_generator.generatePathForOnLaneVehicle(
+    tracked_object, autoware::map_based_prediction::createReferencePath(ref_path), start_index,
+    prediction_time_horizon, lateral_control_time_horizon);
+
+  // Check that starting from the index is the same as trimming the reference path
+  ASSERT_EQ(predicted_path.path.size(), expected_path.path.size());
+  for (size_t i = 0; i < predicted_path.path.size(); ++i) {
+    EXPECT_NEAR(predicted_path.path[i].position.x, expected_path.path[i].position.x, 1e-6);
+    EXPECT_NEAR(predicted_path.path[i].position.y, expected_path.path[i].position.y, 1e-6);
+  }
+}
+
 TEST(PathGenerator, test_generatePathForCrosswalkUser)
 {
   // Generate Path generator
@@ -0,0 +1,136 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/multi_object_tracker/association/association.hpp"
+#include "autoware/multi_object_tracker/tracker/model/normal_vehicle_tracker.hpp"
+
+#include <autoware/universe_utils/geometry/geometry.hpp>
+#include <rclcpp/time.hpp>
+
+#include <autoware_perception_msgs/msg/detected_objects.hpp>
+#include <geometry_msgs/msg/transform.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using autoware::multi_object_tracker::DataAssociation;
+using autoware::multi_object_tracker::NormalVehicleTracker;
+using autoware::multi_object_tracker::Tracker;
+using autoware_perception_msgs::msg::DetectedObject;
+using autoware_perception_msgs::msg::DetectedObjects;
+using autoware_perception_msgs::msg::ObjectClassification;
+using autoware_perception_msgs::msg::Shape;
+
+namespace
+{
+constexpr size_t num_labels = 8;
+
+// the scene has only cars, so the car to car gates of the default config are used for every pair
+std::unique_ptr<DataAssociation> createDataAssociation()
+{
+  const size_t num_elements = num_labels * num_labels;
+  return std::make_unique<DataAssociation>(
+    std::vector<int>(num_elements, 1), std::vector<double>(num_elements, 2.0),
+    std::vector<double>(num_elements, 12.1), std::vector<double>(num_elements, 3.6),
+    std::vector<double>(num_elements, 1.047), std::vector<double>(num_elements, 0.1));
+}
+
+DetectedObject createCar(const double x, const double y, const double yaw)
+{
+  DetectedObject object;
+  object.existence_probability = 1.0;
+  ObjectClassification classification;
+  classification.label = ObjectClassification::CAR;
+  classification.probability = 1.0;
+  object.classification.push_back(classification);
+  auto & pose = object.kinematics.pose_with_covariance.pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation = autoware::universe_utils::createQuaternionFromYaw(yaw);
+  object.shape.type = Shape::BOUNDING_BOX;
+  object.shape.dimensions.x = 4.5;
+  object.shape.dimensions.y = 1.8;
+  object.shape.dimensions.z = 1.5;
+  return object;
+}
+
+// the trackers of the cars of a fixed seed, and the measurements of them in the next cycle
+struct Scene
+{
+  std::vector<std::shared_ptr<Tracker>> trackers;
+  DetectedObjects measurements;
+};
+
+Scene createScene(const size_t num_objects)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> position_distribution(-100.0, 100.0);
+  std::uniform_real_distribution<double> yaw_distribution(-M_PI, M_PI);
+  std::normal_distribution<double> noise_distribution(0.0, 0.3);
+
+  const rclcpp::Time tracker_time(0, 0, RCL_ROS_TIME);
+  const rclcpp::Time measurement_time(0, 100000000, RCL_ROS_TIME);
+  const geometry_msgs::msg::Transform self_transform;
+  const uint channel_index = 0;
+
+  Scene scene;
+  scene.measurements.header.stamp = measurement_time;
+  for (size_t i = 0; i < num_objects; ++i) {
+    const double x = position_distribution(generator);
+    const double y = position_distribution(generator);
+    const double yaw = yaw_distribution(generator);
+    scene.trackers.push_back(std::make_shared<NormalVehicleTracker>(
+      tracker_time, createCar(x, y, yaw), self_transform, 1, channel_index));
+    scene.measurements.objects.push_back(createCar(
+      x + noise_distribution(generator), y + noise_distribution(generator),
+      yaw + 0.1 * noise_distribution(generator)));
+  }
+  return scene;
+}
+
+void BM_CalcScoreMatrix(benchmark::State & state)
+{
+  const auto scene = createScene(state.range(0));
+  const auto data_association = createDataAssociation();
+  for (auto _ : state) {
+    auto score_matrix = data_association->calcScoreMatrix(scene.measurements, scene.trackers);
+    benchmark::DoNotOptimize(score_matrix);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void BM_Assign(benchmark::State & state)
+{
+  const auto scene = createScene(state.range(0));
+  const auto data_association = createDataAssociation();
+  const auto score_matrix = data_association->calcScoreMatrix(scene.measurements, scene.trackers);
+  std::unordered_map<int, int> direct_assignment;
+  std::unordered_map<int, int> reverse_assignment;
+  for (auto _ : state) {
+    direct_assignment.clear();
+    reverse_assignment.clear();
+    data_association->assign(score_matrix, direct_assignment, reverse_assignment);
+    benchmark::DoNotOptimize(direct_assignment);
+  }
+  state.counters["assigned"] = direct_assignment.size();
+}
+}  // namespace
+
+BENCHMARK(BM_CalcScoreMatrix)->Arg(16)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Assign)->Arg(16)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
@@ -29,7 +29,6 @@
 
 #include "autoware_perception_msgs/msg/detected_objects.hpp"
 
-#include <list>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -45,6 +44,8 @@ private:
   Eigen::MatrixXd min_area_matrix_;
   Eigen::MatrixXd max_rad_matrix_;
   Eigen::MatrixXd min_iou_matrix_;
+  /** @brief largest distance gate, which is the cell size of the spatial gating grid */
+  double max_dist_gate_;
   const double score_threshold_;
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
 
@@ -55,11 +56,17 @@ public:
     std::vector<double> max_area_vector, std::vector<double> min_area_vector,
     std::vector<double> max_rad_vector, std::vector<double> min_iou_vector);
   void assign(
-    const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+    const gnn_solver::SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
     std::unordered_map<int, int> & reverse_assignment);
-  Eigen::MatrixXd calcScoreMatrix(
+  /**
+   * @brief scores of the tracker (row) and measurement (column) pairs which pass the gates
+   *
+   * Only the measurements in the grid cells around a tracker are gated, so the cost grows with the
+   * number of objects near each tracker rather than with the number of all the pairs.
+   */
+  gnn_solver::SparseScoreMatrix calcScoreMatrix(
     const autoware_perception_msgs::msg::DetectedObjects & measurements,
-    const std::list<std::shared_ptr<Tracker>> & trackers);
+    const std::vector<std::shared_ptr<Tracker>> & trackers);
   virtual ~DataAssociation() {}
 };
 
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__MULTI_OBJECT_TRACKER__ASSOCIATION__SOLVER__GNN_SOLVER_INTERFACE_HPP_
 #define AUTOWARE__MULTI_OBJECT_TRACKER__ASSOCIATION__SOLVER__GNN_SOLVER_INTERFACE_HPP_
 
+#include <algorithm>
 #include <unordered_map>
 #include <vector>
 
@@ -22,6 +23,33 @@ namespace autoware::multi_object_tracker
 {
 namespace gnn_solver
 {
+/**
+ * @brief score matrix which only holds the non-zero scores, sorted by row and then by column
+ */
+struct SparseScoreMatrix
+{
+  struct Entry
+  {
+    int row;
+    int col;
+    double score;
+  };
+
+  int rows{0};
+  int cols{0};
+  std::vector<Entry> entries;
+
+  /** @brief score of the element, which is zero if it is not held */
+  double at(const int row, const int col) const
+  {
+    const auto it = std::lower_bound(
+      entries.begin(), entries.end(), Entry{row, col, 0.0}, [](const Entry & a, const Entry & b) {
+        return a.row != b.row ? a.row < b.row : a.col < b.col;
+      });
+    return it != entries.end() && it->row == row && it->col == col ? it->score : 0.0;
+  }
+};
+
 class GnnSolverInterface
 {
 public:
@@ -31,6 +59,11 @@ public:
   virtual void maximizeLinearAssignment(
     const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
     std::unordered_map<int, int> * reverse_assignment) = 0;
+
+  /** @brief same as the dense variant, where the elements which are not held are zero */
+  virtual void maximizeLinearAssignment(
+    const SparseScoreMatrix & cost, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment) = 0;
 };
 
 }  // namespace gnn_solver
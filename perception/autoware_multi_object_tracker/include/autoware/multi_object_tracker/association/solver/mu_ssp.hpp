@@ -33,6 +33,14 @@ public:
   void maximizeLinearAssignment(
     const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
     std::unordered_map<int, int> * reverse_assignment) override;
+
+  /**
+   * @brief solve each connected component of the score graph by itself, so that the solved
+   * matrices stay small when the scene is dense but the objects are gated to their neighbors
+   */
+  void maximizeLinearAssignment(
+    const SparseScoreMatrix & cost, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment) override;
 };
 
 }  // namespace gnn_solver
@@ -41,6 +41,11 @@ public:
   void maximizeLinearAssignment(
     const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
     std::unordered_map<int, int> * reverse_assignment, const bool sparse_cost = true);
+
+  /** @brief the residual graph only has the edges of the held elements */
+  void maximizeLinearAssignment(
+    const SparseScoreMatrix & cost, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment) override;
 };
 
 }  // namespace gnn_solver
@@ -19,9 +19,12 @@
 #include "autoware/object_recognition_utils/object_recognition_utils.hpp"
 
 #include <algorithm>
-#include <list>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace
@@ -66,6 +69,13 @@ double getFormedYawAngle(
   }
   return std::fabs(measurement_fixed_yaw - tracker_yaw);
 }
+
+uint64_t getGridCellKey(const double x, const double y, const double cell_size)
+{
+  const auto cell_x = static_cast<uint64_t>(static_cast<int64_t>(std::floor(x / cell_size)));
+  const auto cell_y = static_cast<uint64_t>(static_cast<int64_t>(std::floor(y / cell_size)));
+  return (cell_x << 32) ^ (cell_y & 0xFFFFFFFF);
+}
 }  // namespace
 
 namespace autoware::multi_object_tracker
@@ -88,6 +98,7 @@ DataAssociation::DataAssociation(
     Eigen::Map<Eigen::MatrixXd> max_dist_matrix_tmp(
       max_dist_vector.data(), max_dist_label_num, max_dist_label_num);
     max_dist_matrix_ = max_dist_matrix_tmp.transpose();
+    max_dist_gate_ = max_dist_matrix_.size() > 0 ? max_dist_matrix_.maxCoeff() : 0.0;
   }
   {
     const int max_area_label_num = static_cast<int>(std::sqrt(max_area_vector.size()));
@@ -118,21 +129,14 @@ DataAssociation::DataAssociation(
 }
 
 void DataAssociation::assign(
-  const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+  const gnn_solver::SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
   std::unordered_map<int, int> & reverse_assignment)
 {
-  std::vector<std::vector<double>> score(src.rows());
-  for (int row = 0; row < src.rows(); ++row) {
-    score.at(row).resize(src.cols());
-    for (int col = 0; col < src.cols(); ++col) {
-      score.at(row).at(col) = src(row, col);
-    }
-  }
   // Solve
-  gnn_solver_ptr_->maximizeLinearAssignment(score, &direct_assignment, &reverse_assignment);
+  gnn_solver_ptr_->maximizeLinearAssignment(src, &direct_assignment, &reverse_assignment);
 
   for (auto itr = direct_assignment.begin(); itr != direct_assignment.end();) {
-    if (src(itr->first, itr->second) < score_threshold_) {
+    if (src.at(itr->first, itr->second) < score_threshold_) {
       itr = direct_assignment.erase(itr);
       continue;
     } else {
@@ -140,7 +144,7 @@ void DataAssociation::assign(
     }
   }
   for (auto itr = reverse_assignment.begin(); itr != reverse_assignment.end();) {
-    if (src(itr->second, itr->first) < score_threshold_) {
+    if (src.at(itr->second, itr->first) < score_threshold_) {
       itr = reverse_assignment.erase(itr);
       continue;
     } else {
@@ -149,79 +153,133 @@ void DataAssociation::assign(
   }
 }
 
-Eigen::MatrixXd DataAssociation::calcScoreMatrix(
+gnn_solver::SparseScoreMatrix DataAssociation::calcScoreMatrix(
   const autoware_perception_msgs::msg::DetectedObjects & measurements,
-  const std::list<std::shared_ptr<Tracker>> & trackers)
+  const std::vector<std::shared_ptr<Tracker>> & trackers)
 {
-  Eigen::MatrixXd score_matrix =
-    Eigen::MatrixXd::Zero(trackers.size(), measurements.objects.size());
-  size_t tracker_idx = 0;
+  gnn_solver::SparseScoreMatrix score_matrix;
+  score_matrix.rows = static_cast<int>(trackers.size());
+  score_matrix.cols = static_cast<int>(measurements.objects.size());
+  if (score_matrix.rows == 0 || score_matrix.cols == 0) {
+    return score_matrix;
+  }
+
+  std::vector<std::uint8_t> measurement_labels(measurements.objects.size());
+  for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
+       ++measurement_idx) {
+    measurement_labels.at(measurement_idx) =
+      autoware::object_recognition_utils::getHighestProbLabel(
+        measurements.objects.at(measurement_idx).classification);
+  }
+
+  // grid of the measurement positions, whose cell size is the largest distance gate so that the
+  // measurements passing the distance gate of a tracker are in the 3x3 cells around it
+  const bool use_grid = std::isfinite(max_dist_gate_) && max_dist_gate_ > 0.0;
+  std::vector<std::pair<uint64_t, int>> measurement_cells;
+  if (use_grid) {
+    measurement_cells.reserve(measurements.objects.size());
+    for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
+         ++measurement_idx) {
+      const auto & position =
+        measurements.objects.at(measurement_idx).kinematics.pose_with_covariance.pose.position;
+      if (std::isfinite(position.x) && std::isfinite(position.y)) {
+        measurement_cells.emplace_back(
+          getGridCellKey(position.x, position.y, max_dist_gate_),
+          static_cast<int>(measurement_idx));
+      }
+    }
+    std::sort(measurement_cells.begin(), measurement_cells.end());
+  }
+
+  std::vector<int> candidates;
+  candidates.reserve(measurements.objects.size());
+  int tracker_idx = 0;
   for (auto tracker_itr = trackers.begin(); tracker_itr != trackers.end();
        ++tracker_itr, ++tracker_idx) {
     const std::uint8_t tracker_label = (*tracker_itr)->getHighestProbLabel();
+    autoware_perception_msgs::msg::TrackedObject tracked_object;
+    (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
+    const auto & tracker_position = tracked_object.kinematics.pose_with_covariance.pose.position;
 
-    for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
-         ++measurement_idx) {
+    candidates.clear();
+    if (!use_grid) {
+      for (int measurement_idx = 0; measurement_idx < score_matrix.cols; ++measurement_idx) {
+        candidates.push_back(measurement_idx);
+      }
+    } else if (std::isfinite(tracker_position.x) && std::isfinite(tracker_position.y)) {
+      for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+          const uint64_t key = getGridCellKey(
+            tracker_position.x + dx * max_dist_gate_, tracker_position.y + dy * max_dist_gate_,
+            max_dist_gate_);
+          auto itr = std::lower_bound(
+            measurement_cells.begin(), measurement_cells.end(),
+            std::make_pair(key, std::numeric_limits<int>::min()));
+          for (; itr != measurement_cells.end() && itr->first == key; ++itr) {
+            candidates.push_back(itr->second);
+          }
+        }
+      }
+      // keep the scores sorted by column
+      std::sort(candidates.begin(), candidates.end());
+    }
+
+    for (const int measurement_idx : candidates) {
       const autoware_perception_msgs::msg::DetectedObject & measurement_object =
         measurements.objects.at(measurement_idx);
-      const std::uint8_t measurement_label =
-        autoware::object_recognition_utils::getHighestProbLabel(measurement_object.classification);
-
-      double score = 0.0;
-      if (can_assign_matrix_(tracker_label, measurement_label)) {
-        autoware_perception_msgs::msg::TrackedObject tracked_object;
-        (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
-
-        const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
-        const double dist = autoware::universe_utils::calcDistance2d(
-          measurement_object.kinematics.pose_with_covariance.pose.position,
-          tracked_object.kinematics.pose_with_covariance.pose.position);
-
-        bool passed_gate = true;
-        // dist gate
-        {  // passed_gate is always true
-          if (max_dist < dist) passed_gate = false;
-        }
-        // area gate
-        if (passed_gate) {
-          const double max_area = max_area_matrix_(tracker_label, measurement_label);
-          const double min_area = min_area_matrix_(tracker_label, measurement_label);
-          const double area = autoware::universe_utils::getArea(measurement_object.shape);
-          if (area < min_area || max_area < area) passed_gate = false;
-        }
-        // angle gate
-        if (passed_gate) {
-          const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
-          const double angle = getFormedYawAngle(
-            measurement_object.kinematics.pose_with_covariance.pose.orientation,
-            tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
-          if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle))
-            passed_gate = false;
-        }
-        // mahalanobis dist gate
-        if (passed_gate) {
-          const double mahalanobis_dist = getMahalanobisDistance(
-            measurement_object.kinematics.pose_with_covariance.pose.position,
-            tracked_object.kinematics.pose_with_covariance.pose.position,
-            getXYCovariance(tracked_object.kinematics.pose_with_covariance));
-          if (3.035 /*99%*/ <= mahalanobis_dist) passed_gate = false;
-        }
-        // 2d iou gate
-        if (passed_gate) {
-          const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
-          const double min_union_iou_area = 1e-2;
-          const double iou = autoware::object_recognition_utils::get2dIoU(
-            measurement_object, tracked_object, min_union_iou_area);
-          if (iou < min_iou) passed_gate = false;
-        }
+      const std::uint8_t measurement_label = measurement_labels.at(measurement_idx);
+      if (!can_assign_matrix_(tracker_label, measurement_label)) {
+        continue;
+      }
+
+      const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
+      const double dist = autoware::universe_utils::calcDistance2d(
+        measurement_object.kinematics.pose_with_covariance.pose.position, tracker_position);
+
+      bool passed_gate = true;
+      // dist gate
+      {  // passed_gate is always true
+        if (max_dist < dist) passed_gate = false;
+      }
+      // area gate
+      if (passed_gate) {
+        const double max_area = max_area_matrix_(tracker_label, measurement_label);
+        const double min_area = min_area_matrix_(tracker_label, measurement_label);
+        const double area = autoware::universe_utils::getArea(measurement_object.shape);
+        if (area < min_area || max_area < area) passed_gate = false;
+      }
+      // angle gate
+      if (passed_gate) {
+        const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
+        const double angle = getFormedYawAngle(
+          measurement_object.kinematics.pose_with_covariance.pose.orientation,
+          tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
+        if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle))
+          passed_gate = false;
+      }
+      // mahalanobis dist gate
+      if (passed_gate) {
+        const double mahalanobis_dist = getMahalanobisDistance(
+          measurement_object.kinematics.pose_with_covariance.pose.position, tracker_position,
+          getXYCovariance(tracked_object.kinematics.pose_with_covariance));
+        if (3.035 /*99%*/ <= mahalanobis_dist) passed_gate = false;
+      }
+      // 2d iou gate
+      if (passed_gate) {
+        const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
+        const double min_union_iou_area = 1e-2;
+        const double iou = autoware::object_recognition_utils::get2dIoU(
+          measurement_object, tracked_object, min_union_iou_area);
+        if (iou < min_iou) passed_gate = false;
+      }
 
-        // all gate is passed
-        if (passed_gate) {
-          score = (max_dist - std::min(dist, max_dist)) / max_dist;
-          if (score < score_threshold_) score = 0.0;
+      // all gate is passed
+      if (passed_gate) {
+        const double score = (max_dist - std::min(dist, max_dist)) / max_dist;
+        if (score >= score_threshold_) {
+          score_matrix.entries.push_back({tracker_idx, measurement_idx, score});
         }
       }
-      score_matrix(tracker_idx, measurement_idx) = score;
     }
   }
 
@@ -20,6 +20,7 @@
 #include <cassert>
 #include <fstream>
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -40,6 +41,84 @@ void MuSSP::maximizeLinearAssignment(
   // Solve DA by muSSP
   solve_muSSP(cost, direct_assignment, reverse_assignment);
 }
+
+void MuSSP::maximizeLinearAssignment(
+  const SparseScoreMatrix & cost, std::unordered_map<int, int> * direct_assignment,
+  std::unordered_map<int, int> * reverse_assignment)
+{
+  // Terminate if the graph is empty
+  if (cost.rows == 0 || cost.cols == 0 || cost.entries.empty()) {
+    return;
+  }
+
+  // Connected components of the bipartite graph, where the nodes are the rows and then the columns
+  std::vector<int> parents(cost.rows + cost.cols);
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find_root = [&parents](int node) {
+    while (parents.at(node) != node) {
+      parents.at(node) = parents.at(parents.at(node));
+      node = parents.at(node);
+    }
+    return node;
+  };
+  for (const auto & entry : cost.entries) {
+    const int row_root = find_root(entry.row);
+    const int col_root = find_root(cost.rows + entry.col);
+    if (row_root != col_root) {
+      parents.at(row_root) = col_root;
+    }
+  }
+
+  // Local indices of the rows and columns within their component
+  std::vector<int> local_indices(cost.rows + cost.cols, -1);
+  std::unordered_map<int, std::vector<int>> component_rows;
+  std::unordered_map<int, std::vector<int>> component_cols;
+  std::vector<int> component_roots;
+  for (const auto & entry : cost.entries) {
+    const int root = find_root(entry.row);
+    if (local_indices.at(entry.row) < 0) {
+      if (component_rows.count(root) == 0) {
+        component_roots.push_back(root);
+      }
+      local_indices.at(entry.row) = static_cast<int>(component_rows[root].size());
+      component_rows[root].push_back(entry.row);
+    }
+    if (local_indices.at(cost.rows + entry.col) < 0) {
+      local_indices.at(cost.rows + entry.col) = static_cast<int>(component_cols[root].size());
+      component_cols[root].push_back(entry.col);
+    }
+  }
+
+  // Solve each component by itself
+  std::unordered_map<int, std::vector<std::vector<double>>> component_costs;
+  for (const int root : component_roots) {
+    component_costs[root].assign(
+      component_rows.at(root).size(), std::vector<double>(component_cols.at(root).size(), 0.0));
+  }
+  for (const auto & entry : cost.entries) {
+    component_costs.at(find_root(entry.row))
+      .at(local_indices.at(entry.row))
+      .at(local_indices.at(cost.rows + entry.col)) = entry.score;
+  }
+  for (const int root : component_roots) {
+    const auto & rows = component_rows.at(root);
+    const auto & cols = component_cols.at(root);
+    // a pair which is only gated to each other does not need the solver
+    if (rows.size() == 1 && cols.size() == 1) {
+      (*direct_assignment)[rows.front()] = cols.front();
+      (*reverse_assignment)[cols.front()] = rows.front();
+      continue;
+    }
+    std::unordered_map<int, int> component_direct_assignment;
+    std::unordered_map<int, int> component_reverse_assignment;
+    solve_muSSP(
+      component_costs.at(root), &component_direct_assignment, &component_reverse_assignment);
+    for (const auto & [local_row, local_col] : component_direct_assignment) {
+      (*direct_assignment)[rows.at(local_row)] = cols.at(local_col);
+      (*reverse_assignment)[cols.at(local_col)] = rows.at(local_row);
+    }
+  }
+}
 }  // namespace gnn_solver
 
 }  // namespace autoware::multi_object_tracker
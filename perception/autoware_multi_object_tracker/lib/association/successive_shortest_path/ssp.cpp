@@ -45,25 +45,31 @@ struct ResidualEdge
   }
 };
 
-void SSP::maximizeLinearAssignment(
-  const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
+namespace
+{
+// Hyperparameters
+// double MAX_COST = 6;
+constexpr double MAX_COST = 10;
+constexpr double INF_DIST = 10000000;
+constexpr double EPS = 1e-5;
+
+/**
+ * @brief solve the assignment over the agent to task edges, given as cost matrix elements sorted
+ * by agent
+ */
+void solveSSP(
+  const int n_agents, const int n_tasks, const std::vector<SparseScoreMatrix::Entry> & edges,
+  std::unordered_map<int, int> * direct_assignment,
   std::unordered_map<int, int> * reverse_assignment, const bool sparse_cost)
 {
-  // Hyperparameters
-  // double MAX_COST = 6;
-  const double MAX_COST = 10;
-  const double INF_DIST = 10000000;
-  const double EPS = 1e-5;
-
-  // When there is no agents or no tasks, terminate
-  if (cost.size() == 0 || cost.at(0).size() == 0) {
-    return;
+  // Number of edges from each agent and to each task
+  std::vector<int> n_agent_edges(n_agents, 0);
+  std::vector<int> n_task_edges(n_tasks, 0);
+  for (const auto & edge : edges) {
+    ++n_agent_edges.at(edge.row);
+    ++n_task_edges.at(edge.col);
   }
 
-  // Construct a bipartite graph from the cost matrix
-  int n_agents = cost.size();
-  int n_tasks = cost.at(0).size();
-
   int n_dummies;
   if (sparse_cost) {
     n_dummies = n_agents;
@@ -105,10 +111,10 @@ void SSP::maximizeLinearAssignment(
       adjacency_list.at(v).reserve(n_agents);
     } else if (v <= n_agents) {
       // Agents
-      adjacency_list.at(v).reserve(n_tasks + 1 + 1);
+      adjacency_list.at(v).reserve(n_agent_edges.at(v - 1) + 1 + 1);
     } else if (v <= n_agents + n_tasks) {
       // Tasks
-      adjacency_list.at(v).reserve(n_agents + 1);
+      adjacency_list.at(v).reserve(n_task_edges.at(v - n_agents - 1) + 1);
     } else if (v == sink) {
       // Sink
       adjacency_list.at(v).reserve(n_tasks + n_dummies);
@@ -128,21 +134,18 @@ void SSP::maximizeLinearAssignment(
   }
 
   // Add edges from agents
-  for (int agent = 0; agent < n_agents; ++agent) {
-    for (int task = 0; task < n_tasks; ++task) {
-      if (!sparse_cost || cost.at(agent).at(task) > EPS) {
-        // From agent to task
-        adjacency_list.at(agent + 1).emplace_back(
-          task + n_agents + 1, 1, MAX_COST - cost.at(agent).at(task), 0,
-          adjacency_list.at(task + n_agents + 1).size());
-
-        // From task to agent
-        adjacency_list.at(task + n_agents + 1)
-          .emplace_back(
-            agent + 1, 0, cost.at(agent).at(task) - MAX_COST, 0,
-            adjacency_list.at(agent + 1).size() - 1);
-      }
-    }
+  for (const auto & edge : edges) {
+    const int agent = edge.row;
+    const int task = edge.col;
+    // From agent to task
+    adjacency_list.at(agent + 1).emplace_back(
+      task + n_agents + 1, 1, MAX_COST - edge.score, 0,
+      adjacency_list.at(task + n_agents + 1).size());
+
+    // From task to agent
+    adjacency_list.at(task + n_agents + 1)
+      .emplace_back(
+        agent + 1, 0, edge.score - MAX_COST, 0, adjacency_list.at(agent + 1).size() - 1);
   }
 
   // Add edges form tasks
@@ -365,6 +368,50 @@ void SSP::maximizeLinearAssignment(
   }
 #endif
 }
+}  // namespace
+
+void SSP::maximizeLinearAssignment(
+  const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
+  std::unordered_map<int, int> * reverse_assignment, const bool sparse_cost)
+{
+  // When there is no agents or no tasks, terminate
+  if (cost.size() == 0 || cost.at(0).size() == 0) {
+    return;
+  }
+
+  // Construct a bipartite graph from the cost matrix
+  const int n_agents = cost.size();
+  const int n_tasks = cost.at(0).size();
+  std::vector<SparseScoreMatrix::Entry> edges;
+  for (int agent = 0; agent < n_agents; ++agent) {
+    for (int task = 0; task < n_tasks; ++task) {
+      if (!sparse_cost || cost.at(agent).at(task) > EPS) {
+        edges.push_back({agent, task, cost.at(agent).at(task)});
+      }
+    }
+  }
+  solveSSP(n_agents, n_tasks, edges, direct_assignment, reverse_assignment, sparse_cost);
+}
+
+void SSP::maximizeLinearAssignment(
+  const SparseScoreMatrix & cost, std::unordered_map<int, int> * direct_assignment,
+  std::unordered_map<int, int> * reverse_assignment)
+{
+  // When there is no agents or no tasks, terminate
+  if (cost.rows == 0 || cost.cols == 0) {
+    return;
+  }
+
+  std::vector<SparseScoreMatrix::Entry> edges;
+  edges.reserve(cost.entries.size());
+  for (const auto & entry : cost.entries) {
+    if (entry.score > EPS) {
+      edges.push_back(entry);
+    }
+  }
+  const bool sparse_cost = true;
+  solveSSP(cost.rows, cost.cols, edges, direct_assignment, reverse_assignment, sparse_cost);
+}
 }  // namespace gnn_solver
 
 }  // namespace autoware::multi_object_tracker
@@ -181,7 +181,7 @@ void TrackerDebugger::endPublishTime(const rclcpp::Time & now, const rclcpp::Tim
 }
 
 void TrackerDebugger::collectObjectInfo(
-  const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+  const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
   const uint & channel_index,
   const autoware_perception_msgs::msg::DetectedObjects & detected_objects,
   const std::unordered_map<int, int> & direct_assignment,
@@ -27,7 +27,6 @@
 #include "autoware_perception_msgs/msg/tracked_objects.hpp"
 #include <geometry_msgs/msg/pose_stamped.hpp>
 
-#include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -100,7 +99,7 @@ public:
     object_debugger_.setChannelNames(channels);
   }
   void collectObjectInfo(
-    const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+    const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
     const uint & channel_index,
     const autoware_perception_msgs::msg::DetectedObjects & detected_objects,
     const std::unordered_map<int, int> & direct_assignment,
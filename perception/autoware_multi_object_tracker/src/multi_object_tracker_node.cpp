@@ -29,9 +29,11 @@
 #include <tf2_ros/create_timer_interface.h>
 #include <tf2_ros/create_timer_ros.h>
 
+#include <future>
 #include <iterator>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -158,8 +160,11 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
     publisher_period_ = 1.0 / publish_rate;    // [s]
     constexpr double timer_multiplier = 10.0;  // 10 times frequent for publish timing check
     const auto timer_period = rclcpp::Rate(publish_rate * timer_multiplier).period();
+    publish_timer_callback_group_ =
+      create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
     publish_timer_ = rclcpp::create_timer(
-      this, get_clock(), timer_period, std::bind(&MultiObjectTracker::onTimer, this));
+      this, get_clock(), timer_period, std::bind(&MultiObjectTracker::onTimer, this),
+      publish_timer_callback_group_);
   }
 
   // Initialize processor
@@ -217,12 +222,14 @@ void MultiObjectTracker::onTrigger()
   // Publish without delay compensation
   if (!publish_timer_) {
     const auto latest_object_time = rclcpp::Time(objects_list.back().second.header.stamp);
+    std::lock_guard<std::mutex> lock(tracker_mutex_);
     checkAndPublish(latest_object_time);
   }
 }
 
 void MultiObjectTracker::onTimer()
 {
+  std::lock_guard<std::mutex> lock(tracker_mutex_);
   const rclcpp::Time current_time = this->now();
 
   // ensure minimum interval: room for the next process(prediction)
@@ -248,31 +255,55 @@ void MultiObjectTracker::onMessage(const ObjectsList & objects_list)
 {
   const rclcpp::Time current_time = this->now();
   const rclcpp::Time oldest_time(objects_list.front().second.header.stamp);
-  last_updated_time_ = current_time;
+  {
+    std::lock_guard<std::mutex> lock(tracker_mutex_);
+    last_updated_time_ = current_time;
 
-  // process start
-  debugger_->startMeasurementTime(this->now(), oldest_time);
+    // process start
+    debugger_->startMeasurementTime(this->now(), oldest_time);
+  }
   // run process for each DetectedObjects
   for (const auto & objects_data : objects_list) {
-    runProcess(objects_data.second, objects_data.first);
+    const DetectedObjects & input_objects = objects_data.second;
+    // Get the time of the measurement
+    const rclcpp::Time measurement_time =
+      rclcpp::Time(input_objects.header.stamp, this->now().get_clock_type());
+
+    // The measurement is preprocessed while the trackers are predicted to its time.
+    // The lock is taken per measurement so that the publish timer can run in between.
+    DetectedObjects transformed_objects;
+    geometry_msgs::msg::Transform self_transform;
+    auto is_preprocessed = std::async(std::launch::async, [&]() {
+      return preprocessObjects(input_objects, transformed_objects, self_transform);
+    });
+    std::lock_guard<std::mutex> lock(tracker_mutex_);
+    /* prediction */
+    processor_->predict(measurement_time);
+    if (!is_preprocessed.get()) {
+      continue;
+    }
+    runProcess(transformed_objects, self_transform, measurement_time, objects_data.first);
   }
   // process end
+  std::lock_guard<std::mutex> lock(tracker_mutex_);
   debugger_->endMeasurementTime(this->now());
 }
 
-void MultiObjectTracker::runProcess(
-  const DetectedObjects & input_objects, const uint & channel_index)
+bool MultiObjectTracker::preprocessObjects(
+  const DetectedObjects & input_objects, DetectedObjects & transformed_objects,
+  geometry_msgs::msg::Transform & self_transform) const
 {
   // Get the time of the measurement
   const rclcpp::Time measurement_time =
     rclcpp::Time(input_objects.header.stamp, this->now().get_clock_type());
 
   // Get the transform of the self frame
-  const auto self_transform =
+  const auto self_transform_optional =
     getTransformAnonymous(tf_buffer_, "base_link", world_frame_id_, measurement_time);
-  if (!self_transform) {
-    return;
+  if (!self_transform_optional) {
+    return false;
   }
+  self_transform = *self_transform_optional;
 
   // Model the object uncertainty if it is empty
   DetectedObjects input_objects_with_uncertainty = uncertainty::modelUncertainty(input_objects);
@@ -281,22 +312,21 @@ void MultiObjectTracker::runProcess(
   uncertainty::normalizeUncertainty(input_objects_with_uncertainty);
 
   // Transform the objects to the world frame
-  DetectedObjects transformed_objects;
-  if (!autoware::object_recognition_utils::transformObjects(
-        input_objects_with_uncertainty, world_frame_id_, tf_buffer_, transformed_objects)) {
-    return;
-  }
-
-  /* prediction */
-  processor_->predict(measurement_time);
+  return autoware::object_recognition_utils::transformObjects(
+    input_objects_with_uncertainty, world_frame_id_, tf_buffer_, transformed_objects);
+}
 
+void MultiObjectTracker::runProcess(
+  const DetectedObjects & transformed_objects, const geometry_msgs::msg::Transform & self_transform,
+  const rclcpp::Time & measurement_time, const uint & channel_index)
+{
   /* object association */
   std::unordered_map<int, int> direct_assignment, reverse_assignment;
   {
     const auto & list_tracker = processor_->getListTracker();
     const auto & detected_objects = transformed_objects;
     // global nearest neighbor
-    Eigen::MatrixXd score_matrix = association_->calcScoreMatrix(
+    const auto score_matrix = association_->calcScoreMatrix(
       detected_objects, list_tracker);  // row : tracker, col : measurement
     association_->assign(score_matrix, direct_assignment, reverse_assignment);
 
@@ -307,14 +337,14 @@ void MultiObjectTracker::runProcess(
   }
 
   /* tracker update */
-  processor_->update(transformed_objects, *self_transform, direct_assignment, channel_index);
+  processor_->update(transformed_objects, self_transform, direct_assignment, channel_index);
 
   /* tracker pruning */
   processor_->prune(measurement_time);
 
   /* spawn new tracker */
   if (input_manager_->isChannelSpawnEnabled(channel_index)) {
-    processor_->spawn(transformed_objects, *self_transform, reverse_assignment, channel_index);
+    processor_->spawn(transformed_objects, self_transform, reverse_assignment, channel_index);
   }
 }
 
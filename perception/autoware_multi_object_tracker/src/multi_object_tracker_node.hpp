@@ -47,6 +47,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -75,8 +76,13 @@ private:
   std::unique_ptr<TrackerDebugger> debugger_;
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
 
-  // publish timer
+  // publish timer, in its own callback group so that the output is published while the
+  // measurements are processed
   rclcpp::TimerBase::SharedPtr publish_timer_;
+  rclcpp::CallbackGroup::SharedPtr publish_timer_callback_group_;
+  // guards the trackers, the debugger and the update and publish times, which are shared by the
+  // measurement and the publish timer callbacks
+  std::mutex tracker_mutex_;
   rclcpp::Time last_published_time_;
   rclcpp::Time last_updated_time_;
   double publisher_period_;
@@ -100,7 +106,13 @@ private:
   void onMessage(const ObjectsList & objects_list);
 
   // publish processes
-  void runProcess(const DetectedObjects & input_objects, const uint & channel_index);
+  bool preprocessObjects(
+    const DetectedObjects & input_objects, DetectedObjects & transformed_objects,
+    geometry_msgs::msg::Transform & self_transform) const;
+  void runProcess(
+    const DetectedObjects & transformed_objects,
+    const geometry_msgs::msg::Transform & self_transform, const rclcpp::Time & measurement_time,
+    const uint & channel_index);
   void checkAndPublish(const rclcpp::Time & time);
   void publish(const rclcpp::Time & time) const;
   inline bool shouldTrackerPublish(const std::shared_ptr<const Tracker> tracker) const;
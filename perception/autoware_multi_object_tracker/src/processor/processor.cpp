@@ -19,7 +19,13 @@
 
 #include "autoware_perception_msgs/msg/tracked_objects.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace autoware::multi_object_tracker
 {
@@ -130,30 +136,67 @@ void TrackerProcessor::prune(const rclcpp::Time & time)
 
 void TrackerProcessor::removeOldTracker(const rclcpp::Time & time)
 {
-  // Check elapsed time from last update
-  for (auto itr = list_tracker_.begin(); itr != list_tracker_.end(); ++itr) {
-    const bool is_old = max_elapsed_time_ < (*itr)->getElapsedTimeFromLastUpdate(time);
-    // If the tracker is old, delete it
-    if (is_old) {
-      auto erase_itr = itr;
-      --itr;
-      list_tracker_.erase(erase_itr);
-    }
-  }
+  // Check elapsed time from last update, and delete the old trackers
+  list_tracker_.erase(
+    std::remove_if(
+      list_tracker_.begin(), list_tracker_.end(),
+      [this, &time](const std::shared_ptr<Tracker> & tracker) {
+        return max_elapsed_time_ < tracker->getElapsedTimeFromLastUpdate(time);
+      }),
+    list_tracker_.end());
 }
 
 // This function removes overlapped trackers based on distance and IoU criteria
 void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
 {
+  const size_t num_trackers = list_tracker_.size();
+
+  // Get the tracked objects once, and put them in a grid whose cell size is the distance threshold
+  // so that only the trackers in the 3x3 neighbor cells are compared
+  std::vector<autoware_perception_msgs::msg::TrackedObject> objects(num_trackers);
+  std::vector<bool> is_valid(num_trackers, false);
+  std::unordered_map<uint64_t, std::vector<size_t>> grid;
+  const auto to_cell = [this](const double coordinate) {
+    return static_cast<int64_t>(std::floor(coordinate / distance_threshold_));
+  };
+  const auto to_key = [](const int64_t cell_x, const int64_t cell_y) {
+    return (static_cast<uint64_t>(cell_x) << 32) ^ (static_cast<uint64_t>(cell_y) & 0xFFFFFFFF);
+  };
+  for (size_t i = 0; i < num_trackers; ++i) {
+    if (!list_tracker_.at(i)->getTrackedObject(time, objects.at(i))) continue;
+    const auto & position = objects.at(i).kinematics.pose_with_covariance.pose.position;
+    if (!std::isfinite(position.x) || !std::isfinite(position.y)) continue;
+    is_valid.at(i) = true;
+    grid[to_key(to_cell(position.x), to_cell(position.y))].push_back(i);
+  }
+
   // Iterate through the list of trackers
-  for (auto itr1 = list_tracker_.begin(); itr1 != list_tracker_.end(); ++itr1) {
-    autoware_perception_msgs::msg::TrackedObject object1;
-    if (!(*itr1)->getTrackedObject(time, object1)) continue;
+  std::vector<bool> is_deleted(num_trackers, false);
+  std::vector<size_t> neighbors;
+  for (size_t i1 = 0; i1 < num_trackers; ++i1) {
+    if (!is_valid.at(i1) || is_deleted.at(i1)) continue;
+    const auto & object1 = objects.at(i1);
+    const auto & position1 = object1.kinematics.pose_with_covariance.pose.position;
+
+    // The remaining trackers near the current tracker, in the order of the list
+    neighbors.clear();
+    const int64_t cell_x = to_cell(position1.x);
+    const int64_t cell_y = to_cell(position1.y);
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        const auto cell = grid.find(to_key(cell_x + dx, cell_y + dy));
+        if (cell == grid.end()) continue;
+        for (const size_t i2 : cell->second) {
+          if (i2 > i1) neighbors.push_back(i2);
+        }
+      }
+    }
+    std::sort(neighbors.begin(), neighbors.end());
 
     // Compare the current tracker with the remaining trackers
-    for (auto itr2 = std::next(itr1); itr2 != list_tracker_.end(); ++itr2) {
-      autoware_perception_msgs::msg::TrackedObject object2;
-      if (!(*itr2)->getTrackedObject(time, object2)) continue;
+    for (const size_t i2 : neighbors) {
+      if (is_deleted.at(i2)) continue;
+      const auto & object2 = objects.at(i2);
 
       // Calculate the distance between the two objects
       const double distance = std::hypot(
@@ -171,8 +214,10 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
       const double min_union_iou_area = 1e-2;
       const auto iou =
         autoware::object_recognition_utils::get2dIoU(object1, object2, min_union_iou_area);
-      const auto & label1 = (*itr1)->getHighestProbLabel();
-      const auto & label2 = (*itr2)->getHighestProbLabel();
+      const auto & tracker1 = list_tracker_.at(i1);
+      const auto & tracker2 = list_tracker_.at(i2);
+      const auto & label1 = tracker1->getHighestProbLabel();
+      const auto & label2 = tracker2->getHighestProbLabel();
       bool should_delete_tracker1 = false;
       bool should_delete_tracker2 = false;
 
@@ -181,7 +226,7 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
       if (label1 == Label::UNKNOWN || label2 == Label::UNKNOWN) {
         if (iou > min_iou_for_unknown_object_) {
           if (label1 == Label::UNKNOWN && label2 == Label::UNKNOWN) {
-            if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+            if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
               should_delete_tracker1 = true;
             } else {
               should_delete_tracker2 = true;
@@ -194,7 +239,7 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
         }
       } else {  // If neither object is UNKNOWN, delete the younger tracker
         if (iou > min_iou_) {
-          if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+          if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
             should_delete_tracker1 = true;
           } else {
             should_delete_tracker2 = true;
@@ -204,16 +249,22 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
 
       // Delete the tracker
       if (should_delete_tracker1) {
-        itr1 = list_tracker_.erase(itr1);
-        --itr1;
+        is_deleted.at(i1) = true;
         break;
       }
       if (should_delete_tracker2) {
-        itr2 = list_tracker_.erase(itr2);
-        --itr2;
+        is_deleted.at(i2) = true;
       }
     }
   }
+
+  size_t num_kept = 0;
+  for (size_t i = 0; i < num_trackers; ++i) {
+    if (!is_deleted.at(i)) {
+      list_tracker_.at(num_kept++) = std::move(list_tracker_.at(i));
+    }
+  }
+  list_tracker_.resize(num_kept);
 }
 
 bool TrackerProcessor::isConfidentTracker(const std::shared_ptr<Tracker> & tracker) const
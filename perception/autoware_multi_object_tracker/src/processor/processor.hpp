@@ -22,7 +22,6 @@
 #include "autoware_perception_msgs/msg/detected_objects.hpp"
 #include "autoware_perception_msgs/msg/tracked_objects.hpp"
 
-#include <list>
 #include <map>
 #include <memory>
 #include <string>
@@ -37,7 +36,7 @@ public:
   explicit TrackerProcessor(
     const std::map<std::uint8_t, std::string> & tracker_map, const size_t & channel_size);
 
-  const std::list<std::shared_ptr<Tracker>> & getListTracker() const { return list_tracker_; }
+  const std::vector<std::shared_ptr<Tracker>> & getListTracker() const { return list_tracker_; }
   // tracker processes
   void predict(const rclcpp::Time & time);
   void update(
@@ -63,7 +62,7 @@ public:
 
 private:
   std::map<std::uint8_t, std::string> tracker_map_;
-  std::list<std::shared_ptr<Tracker>> list_tracker_;
+  std::vector<std::shared_ptr<Tracker>> list_tracker_;
   const size_t channel_size_;
 
   // parameters
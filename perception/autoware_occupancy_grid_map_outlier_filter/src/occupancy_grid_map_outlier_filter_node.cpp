@@ -115,37 +115,45 @@ RadiusSearch2dFilter::RadiusSearch2dFilter(rclcpp::Node & node)
   max_points_ = node.declare_parameter<int>("radius_search_2d_filter.max_points");
   max_filter_points_nb_ =
     node.declare_parameter<int>("radius_search_2d_filter.max_filter_points_nb");
-  kd_tree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
+}
+
+void RadiusSearch2dFilter::appendXyPoints(const PointCloud2 & input)
+{
+  const int x_offset = input.fields[pcl::getFieldIndex(input, "x")].offset;
+  const int y_offset = input.fields[pcl::getFieldIndex(input, "y")].offset;
+  for (size_t offset = 0; offset + input.point_step <= input.data.size();
+       offset += input.point_step) {
+    Point2d point;
+    std::memcpy(&point.x, &input.data[offset + x_offset], sizeof(float));
+    std::memcpy(&point.y, &input.data[offset + y_offset], sizeof(float));
+    xy_points_.push_back(point);
+  }
+}
+
+bool RadiusSearch2dFilter::hasEnoughNeighbors(const Point2d & point, const Pose & pose) const
+{
+  const float distance = std::hypot(point.x - pose.position.x, point.y - pose.position.y);
+  const int min_points_threshold = std::min(
+    std::max(static_cast<int>(min_points_and_distance_ratio_ / distance + 0.5f), min_points_),
+    max_points_);
+  // the counting stops at the threshold, as the radius search did with it as the max neighbors
+  const size_t threshold = static_cast<size_t>(std::max(min_points_threshold, 0));
+  return threshold <= grid_.count_neighbors(point.x, point.y, threshold);
 }
 
 void RadiusSearch2dFilter::filter(
   const PointCloud2 & input, const Pose & pose, PointCloud2 & output, PointCloud2 & outlier)
 {
-  pcl::PointCloud<pcl::PointXY>::Ptr xy_cloud(new pcl::PointCloud<pcl::PointXY>);
-  int point_step = input.point_step;
-  int x_offset = input.fields[pcl::getFieldIndex(input, "x")].offset;
-  int y_offset = input.fields[pcl::getFieldIndex(input, "y")].offset;
-  xy_cloud->points.resize(input.data.size() / point_step);
-  for (size_t i = 0; i < input.data.size() / point_step; ++i) {
-    std::memcpy(&xy_cloud->points[i].x, &input.data[i * point_step + x_offset], sizeof(float));
-    std::memcpy(&xy_cloud->points[i].y, &input.data[i * point_step + y_offset], sizeof(float));
-  }
+  const size_t point_step = input.point_step;
+  xy_points_.clear();
+  xy_points_.reserve(input.data.size() / point_step);
+  appendXyPoints(input);
+  grid_.build(xy_points_, search_radius_);
 
-  std::vector<int> k_indices(xy_cloud->points.size());
-  std::vector<float> k_distances(xy_cloud->points.size());
-  kd_tree_->setInputCloud(xy_cloud);
   size_t output_size = 0;
   size_t outlier_size = 0;
-  for (size_t i = 0; i < xy_cloud->points.size(); ++i) {
-    const float distance =
-      std::hypot(xy_cloud->points[i].x - pose.position.x, xy_cloud->points[i].y - pose.position.y);
-    const int min_points_threshold = std::min(
-      std::max(static_cast<int>(min_points_and_distance_ratio_ / distance + 0.5f), min_points_),
-      max_points_);
-    const int points_num =
-      kd_tree_->radiusSearch(i, search_radius_, k_indices, k_distances, min_points_threshold);
-
-    if (min_points_threshold <= points_num) {
+  for (size_t i = 0; i < xy_points_.size(); ++i) {
+    if (hasEnoughNeighbors(xy_points_[i], pose)) {
       std::memcpy(&output.data[output_size], &input.data[i * point_step], point_step);
       output_size += point_step;
     } else {
@@ -168,53 +176,26 @@ void RadiusSearch2dFilter::filter(
       "Skip outlier filter since too much low_confidence pointcloud!");
     return;
   }
-  int x_offset = low_conf_xyz_cloud.fields[pcl::getFieldIndex(low_conf_xyz_cloud, "x")].offset;
-  int y_offset = low_conf_xyz_cloud.fields[pcl::getFieldIndex(low_conf_xyz_cloud, "y")].offset;
-  int point_step = low_conf_xyz_cloud.point_step;
-  pcl::PointCloud<pcl::PointXY>::Ptr xy_cloud(new pcl::PointCloud<pcl::PointXY>);
-  xy_cloud->points.resize(low_conf_xyz_cloud.width + high_conf_xyz_cloud.width);
-  for (size_t i = 0; i < low_conf_xyz_cloud.width; ++i) {
-    std::memcpy(
-      &xy_cloud->points[i].x, &low_conf_xyz_cloud.data[i * point_step + x_offset], sizeof(float));
-    std::memcpy(
-      &xy_cloud->points[i].y, &low_conf_xyz_cloud.data[i * point_step + y_offset], sizeof(float));
-  }
-
-  for (size_t i = low_conf_xyz_cloud.width; i < xy_cloud->points.size(); ++i) {
-    size_t high_conf_xyz_cloud_index = i - low_conf_xyz_cloud.width;
-    std::memcpy(
-      &xy_cloud->points[i].x,
-      &high_conf_xyz_cloud.data[high_conf_xyz_cloud_index * point_step + x_offset], sizeof(float));
-    std::memcpy(
-      &xy_cloud->points[i].y,
-      &high_conf_xyz_cloud.data[high_conf_xyz_cloud_index * point_step + y_offset], sizeof(float));
-  }
 
-  std::vector<int> k_indices(xy_cloud->points.size());
-  std::vector<float> k_distances(xy_cloud->points.size());
-  kd_tree_->setInputCloud(xy_cloud);
+  // the low confidence points are counted against both the low and the high confidence points
+  const size_t point_step = low_conf_xyz_cloud.point_step;
+  const size_t low_conf_size = low_conf_xyz_cloud.data.size() / point_step;
+  xy_points_.clear();
+  xy_points_.reserve(low_conf_size + high_conf_xyz_cloud.data.size() / point_step);
+  appendXyPoints(low_conf_xyz_cloud);
+  appendXyPoints(high_conf_xyz_cloud);
+  grid_.build(xy_points_, search_radius_);
 
   size_t output_size = 0;
   size_t outlier_size = 0;
-  for (size_t i = 0; i < low_conf_xyz_cloud.data.size() / low_conf_xyz_cloud.point_step; ++i) {
-    const float distance =
-      std::hypot(xy_cloud->points[i].x - pose.position.x, xy_cloud->points[i].y - pose.position.y);
-    const int min_points_threshold = std::min(
-      std::max(static_cast<int>(min_points_and_distance_ratio_ / distance + 0.5f), min_points_),
-      max_points_);
-    const int points_num =
-      kd_tree_->radiusSearch(i, search_radius_, k_indices, k_distances, min_points_threshold);
-
-    if (min_points_threshold <= points_num) {
-      std::memcpy(
-        &output.data[output_size], &low_conf_xyz_cloud.data[i * low_conf_xyz_cloud.point_step],
-        low_conf_xyz_cloud.point_step);
-      output_size += low_conf_xyz_cloud.point_step;
+  for (size_t i = 0; i < low_conf_size; ++i) {
+    if (hasEnoughNeighbors(xy_points_[i], pose)) {
+      std::memcpy(&output.data[output_size], &low_conf_xyz_cloud.data[i * point_step], point_step);
+      output_size += point_step;
     } else {
       std::memcpy(
-        &outlier.data[outlier_size], &low_conf_xyz_cloud.data[i * low_conf_xyz_cloud.point_step],
-        low_conf_xyz_cloud.point_step);
-      outlier_size += low_conf_xyz_cloud.point_step;
+        &outlier.data[outlier_size], &low_conf_xyz_cloud.data[i * point_step], point_step);
+      outlier_size += point_step;
     }
   }
 
@@ -16,6 +16,7 @@
 #define OCCUPANCY_GRID_MAP_OUTLIER_FILTER_NODE_HPP_
 
 #include "autoware/pointcloud_preprocessor/filter.hpp"
+#include "autoware/pointcloud_preprocessor/utility/radius_search_2d_grid.hpp"
 #include "autoware/universe_utils/ros/published_time_publisher.hpp"
 #include "autoware/universe_utils/system/time_keeper.hpp"
 
@@ -32,17 +33,17 @@
 #include <message_filters/sync_policies/exact_time.h>
 #include <message_filters/synchronizer.h>
 #include <pcl/filters/extract_indices.h>
-#include <pcl/filters/radius_outlier_removal.h>
-#include <pcl/search/kdtree.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/message_filter.h>
 #include <tf2_ros/transform_listener.h>
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::occupancy_grid_map_outlier_filter
 {
+using autoware::pointcloud_preprocessor::utils::Point2d;
 using geometry_msgs::msg::Pose;
 using nav_msgs::msg::OccupancyGrid;
 using sensor_msgs::msg::PointCloud2;
@@ -64,7 +65,13 @@ private:
   int min_points_;
   int max_points_;
   long unsigned int max_filter_points_nb_;
-  pcl::search::Search<pcl::PointXY>::Ptr kd_tree_;
+  std::vector<Point2d> xy_points_;
+  autoware::pointcloud_preprocessor::utils::RadiusSearch2dGrid grid_;
+
+  // append the xy of the points in the buffer to xy_points_
+  void appendXyPoints(const PointCloud2 & input);
+  // whether the point has enough neighbors in grid_ for its distance from the pose
+  bool hasEnoughNeighbors(const Point2d & point, const Pose & pose) const;
 };
 
 class OccupancyGridMapOutlierFilterComponent : public rclcpp::Node
@@ -0,0 +1,210 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_fixed.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_projective.hpp"
+
+#include <pcl_conversions/pcl_conversions.h>
+#include <rclcpp/rclcpp.hpp>
+#include <tf2/LinearMath/Quaternion.h>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+#include <pcl/io/pcd_io.h>
+
+#ifdef OCCUPANCY_GRID_MAP_USE_CUDA
+#include <cuda_runtime_api.h>
+#endif
+
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapFixedBlindSpot;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapProjectiveBlindSpot;
+using geometry_msgs::msg::Pose;
+using sensor_msgs::msg::PointCloud2;
+
+namespace
+{
+constexpr unsigned int map_cells = 300;
+constexpr float map_resolution = 0.5f;
+
+// the raw pointcloud and the obstacle pointcloud
+using Input = std::pair<PointCloud2, PointCloud2>;
+
+PointCloud2 createRandomPointCloud(
+  std::mt19937 & generator, const size_t num_points, const float min_z, const float max_z)
+{
+  PointCloud2 cloud;
+  cloud.header.frame_id = "base_link";
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(num_points);
+
+  std::uniform_real_distribution<float> xy_distribution(-60.0f, 60.0f);
+  std::uniform_real_distribution<float> z_distribution(min_z, max_z);
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+  for (size_t i = 0; i < num_points; ++i, ++iter_x, ++iter_y, ++iter_z) {
+    // a third of the points near the vehicle, as the lidar points are dense there
+    const float scale = i % 3 == 0 ? 0.2f : 1.0f;
+    *iter_x = xy_distribution(generator) * scale;
+    *iter_y = xy_distribution(generator) * scale;
+    *iter_z = z_distribution(generator);
+  }
+  return cloud;
+}
+
+Input createSyntheticInput()
+{
+  std::mt19937 generator(0);
+  auto raw_pointcloud = createRandomPointCloud(generator, 200000, -1.5f, 2.5f);
+  auto obstacle_pointcloud = createRandomPointCloud(generator, 60000, -0.5f, 2.5f);
+  return {std::move(raw_pointcloud), std::move(obstacle_pointcloud)};
+}
+
+// the pointcloud given by AUTOWARE_PERCEPTION_BENCHMARK_PCD in base_link and its points above the
+// ground as the obstacles, or nullopt if not given
+std::optional<Input> loadRecordedInput()
+{
+  const char * pcd_path = std::getenv("AUTOWARE_PERCEPTION_BENCHMARK_PCD");
+  if (!pcd_path) {
+    return std::nullopt;
+  }
+  pcl::PointCloud<pcl::PointXYZ> raw_cloud;
+  pcl::io::loadPCDFile<pcl::PointXYZ>(pcd_path, raw_cloud);
+  pcl::PointCloud<pcl::PointXYZ> obstacle_cloud;
+  for (const auto & point : raw_cloud) {
+    if (point.z > 0.2f) {
+      obstacle_cloud.push_back(point);
+    }
+  }
+
+  Input input;
+  pcl::toROSMsg(raw_cloud, input.first);
+  pcl::toROSMsg(obstacle_cloud, input.second);
+  input.first.header.frame_id = "base_link";
+  input.second.header.frame_id = "base_link";
+  return input;
+}
+
+Pose createPose(const double x, const double y, const double z, const double yaw)
+{
+  Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.position.z = z;
+  tf2::Quaternion quaternion;
+  quaternion.setRPY(0.0, 0.0, yaw);
+  pose.orientation.x = quaternion.x();
+  pose.orientation.y = quaternion.y();
+  pose.orientation.z = quaternion.z();
+  pose.orientation.w = quaternion.w();
+  return pose;
+}
+
+std::shared_ptr<rclcpp::Node> createNode()
+{
+  rclcpp::NodeOptions options;
+  options.parameter_overrides({
+    {"OccupancyGridMapFixedBlindSpot.distance_margin", 1.0},
+    {"OccupancyGridMapProjectiveBlindSpot.projection_dz_threshold", 0.01},
+    {"OccupancyGridMapProjectiveBlindSpot.obstacle_separation_threshold", 1.0},
+    {"OccupancyGridMapProjectiveBlindSpot.pub_debug_grid", false},
+  });
+  return std::make_shared<rclcpp::Node>("occupancy_grid_map_benchmark", options);
+}
+
+bool hasGpu()
+{
+#ifdef OCCUPANCY_GRID_MAP_USE_CUDA
+  int num_devices = 0;
+  return cudaGetDeviceCount(&num_devices) == cudaSuccess && num_devices > 0;
+#else
+  return false;
+#endif
+}
+
+template <typename GridMapT>
+void run(benchmark::State & state, const Input & input, const bool use_gpu)
+{
+  rclcpp::init(0, nullptr);
+  {
+    const auto node = createNode();
+    GridMapT map(map_cells, map_cells, map_resolution);
+    map.initRosParam(*node);
+    if (use_gpu) {
+      map.enableGpu();
+    }
+
+    // the map centered at the vehicle, and the scan from the top lidar
+    const auto robot_pose = createPose(0.0, 0.0, 0.0, 0.0);
+    const auto scan_origin = createPose(0.6, 0.0, 2.0, 0.0);
+    const double origin = -static_cast<double>(map_cells) * map_resolution / 2.0;
+    for (auto _ : state) {
+      map.resetMaps();
+      map.updateOrigin(origin, origin);
+      map.updateWithPointCloud(input.first, input.second, robot_pose, scan_origin);
+      benchmark::DoNotOptimize(map.getCharMap());
+    }
+    state.SetItemsProcessed(
+      state.iterations() * (input.first.width * input.first.height +
+                            input.second.width * input.second.height));
+  }
+  rclcpp::shutdown();
+}
+
+bool registerBenchmarks()
+{
+  std::vector<std::pair<std::string, std::shared_ptr<const Input>>> inputs{
+    {"synthetic", std::make_shared<const Input>(createSyntheticInput())}};
+  if (auto recorded_input = loadRecordedInput()) {
+    inputs.emplace_back("recorded", std::make_shared<const Input>(std::move(*recorded_input)));
+  }
+
+  // the GPU raytracing is benchmarked only on the machine having a device
+  std::vector<bool> use_gpu_options{false};
+  if (hasGpu()) {
+    use_gpu_options.push_back(true);
+  }
+
+  for (const auto & [input_name, input] : inputs) {
+    for (const bool use_gpu : use_gpu_options) {
+      const auto suffix = "/" + input_name + (use_gpu ? "/gpu" : "/cpu");
+      benchmark::RegisterBenchmark(
+        ("BM_FixedBlindSpot" + suffix).c_str(),
+        [input = input, use_gpu](benchmark::State & state) {
+          run<OccupancyGridMapFixedBlindSpot>(state, *input, use_gpu);
+        })
+        ->Unit(benchmark::kMillisecond);
+      benchmark::RegisterBenchmark(
+        ("BM_ProjectiveBlindSpot" + suffix).c_str(),
+        [input = input, use_gpu](benchmark::State & state) {
+          run<OccupancyGridMapProjectiveBlindSpot>(state, *input, use_gpu);
+        })
+        ->Unit(benchmark::kMillisecond);
+    }
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool benchmarks_registered = registerBenchmarks();
+}  // namespace
@@ -0,0 +1,109 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__COSTMAP_2D__CUDA_POINTCLOUD_RAYTRACER_HPP_
+#define AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__COSTMAP_2D__CUDA_POINTCLOUD_RAYTRACER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace autoware::occupancy_grid_map
+{
+namespace costmap_2d
+{
+/** @brief model of the region behind the obstacles, as in the grid map types */
+enum class CudaBlindSpotModel : uint8_t { FIXED = 0, PROJECTIVE };
+
+/** @brief parameters of OccupancyGridMapInterface::updateWithPointCloud */
+struct CudaRaytraceParameters
+{
+  CudaBlindSpotModel blind_spot_model;
+
+  // transforms from the point cloud frame to the map frame and from the map frame to the scan
+  // frame, row-major
+  float mat_map[16];
+  float mat_scan[16];
+  double min_height;
+  double max_height;
+
+  double scan_origin_x;
+  double scan_origin_y;
+  double scan_origin_z;
+  double robot_pose_z;
+
+  double min_angle;
+  double angle_increment_inv;
+  uint32_t angle_bin_size;
+
+  // OccupancyGridMapFixedBlindSpot
+  double distance_margin;
+  // OccupancyGridMapProjectiveBlindSpot
+  double projection_dz_threshold;
+  double obstacle_separation_threshold;
+
+  // geometry of the costmap
+  double origin_x;
+  double origin_y;
+  double resolution;
+  uint32_t size_x;
+  uint32_t size_y;
+};
+
+/** @brief byte layout of the points, as given by the fields of a PointCloud2 */
+struct CudaPointLayout
+{
+  uint32_t point_step;
+  uint32_t offset_x;
+  uint32_t offset_y;
+  uint32_t offset_z;
+};
+
+/**
+ * @brief the ray tracing of the fixed and projective blind spot grid maps on the GPU
+ *
+ * The points are binned by angle with atomic counters and sorted by range in a single device
+ * sort. Each angle bin then runs the three steps of updateWithPointCloud in its own thread, in
+ * separate kernels so that a step only starts once every bin finished the previous one. The
+ * unknown cells of the second step are ordered by (bin, ray), so that a cell that several bins
+ * write keeps the value of the last bin as on the CPU.
+ */
+class CudaPointCloudRaytracer
+{
+public:
+  CudaPointCloudRaytracer();
+  ~CudaPointCloudRaytracer();
+
+  /**
+   * @brief update the costmap with the raw and obstacle points
+   *
+   * @param[in] raw_points raw points with the layout, as the data of a PointCloud2
+   * @param[in] obstacle_points obstacle points with the layout, as the data of a PointCloud2
+   * @param[in,out] costmap costmap of size_x * size_y cells, as Costmap2D::getCharMap()
+   * @return false if a CUDA operation failed
+   */
+  bool update(
+    const CudaRaytraceParameters & parameters, const uint8_t * raw_points, size_t num_raw_points,
+    const CudaPointLayout & raw_layout, const uint8_t * obstacle_points,
+    size_t num_obstacle_points, const CudaPointLayout & obstacle_layout, uint8_t * costmap);
+
+private:
+  struct DeviceBuffers;
+  std::unique_ptr<DeviceBuffers> buffers_;
+};
+
+}  // namespace costmap_2d
+}  // namespace autoware::occupancy_grid_map
+
+#endif  // AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__COSTMAP_2D__CUDA_POINTCLOUD_RAYTRACER_HPP_
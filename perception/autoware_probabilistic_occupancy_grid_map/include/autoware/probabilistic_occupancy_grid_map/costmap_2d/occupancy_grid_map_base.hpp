@@ -52,6 +52,8 @@
 #ifndef AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__COSTMAP_2D__OCCUPANCY_GRID_MAP_BASE_HPP_
 #define AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__COSTMAP_2D__OCCUPANCY_GRID_MAP_BASE_HPP_
 
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/cuda_pointcloud_raytracer.hpp"
+
 #include <autoware/universe_utils/math/unit_conversion.hpp>
 #include <nav2_costmap_2d/costmap_2d.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -61,6 +63,8 @@
 #include <sensor_msgs/msg/laser_scan.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <memory>
+
 namespace autoware::occupancy_grid_map
 {
 namespace costmap_2d
@@ -87,6 +91,9 @@ public:
 
   virtual void initRosParam(rclcpp::Node & node) = 0;
 
+  /** @brief raytrace on the GPU from now on, returning false if built without CUDA */
+  bool enableGpu();
+
   void setHeightLimit(const double min_height, const double max_height);
 
   double min_height_;
@@ -126,6 +133,19 @@ public:
     range = std::sqrt(pt_scan[1] * pt_scan[1] + pt_scan[0] * pt_scan[0]);
   }
 
+protected:
+  /**
+   * @brief updateWithPointCloud on the GPU, with the transforms already set
+   *
+   * @param parameters parameters of the grid map type, the others being filled from this map
+   * @return false if the GPU is not enabled or failed, the map being updated on the CPU then
+   */
+  bool updateWithPointCloudOnGpu(
+    const PointCloud2 & raw_pointcloud, const PointCloud2 & obstacle_pointcloud,
+    const Pose & robot_pose, const Pose & scan_origin, CudaRaytraceParameters parameters);
+
+  std::shared_ptr<CudaPointCloudRaytracer> cuda_raytracer_;
+
 private:
   bool worldToMap(double wx, double wy, unsigned int & mx, unsigned int & my) const;
 
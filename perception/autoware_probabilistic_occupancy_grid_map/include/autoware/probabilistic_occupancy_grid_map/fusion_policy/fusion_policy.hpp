@@ -18,6 +18,7 @@
 #include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
 #include <vector>
@@ -64,6 +65,19 @@ unsigned char singleFrameOccupancyFusion(
   const std::vector<unsigned char> & occupancy, FusionMethod method,
   const std::vector<double> & reliability);
 
+/**
+ * @brief fuse whole single frame maps of the same size and origin at once
+ *
+ * Gives the same cells as singleFrameOccupancyFusion on the costs of each cell, but the log-odds
+ * fusion is done with a lookup table per map and loops over the arrays that can be vectorized.
+ *
+ * @param occupancies char maps to be fused, each with num_cells cells
+ * @param fused char map of num_cells cells to write the fused map to
+ */
+void singleFrameOccupancyFusion(
+  const std::vector<const unsigned char *> & occupancies, const std::size_t num_cells,
+  FusionMethod method, const std::vector<double> & reliability, unsigned char * fused);
+
 }  // namespace fusion_policy
 }  // namespace autoware::occupancy_grid_map
 
@@ -15,11 +15,15 @@
 #ifndef AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UPDATER__BINARY_BAYES_FILTER_UPDATER_HPP_
 #define AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UPDATER__BINARY_BAYES_FILTER_UPDATER_HPP_
 
+#include "autoware/probabilistic_occupancy_grid_map/updater/cuda_binary_bayes_filter.hpp"
 #include "autoware/probabilistic_occupancy_grid_map/updater/ogm_updater_interface.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include <memory>
+#include <vector>
+
 namespace autoware::occupancy_grid_map
 {
 namespace costmap_2d
@@ -32,11 +36,15 @@ public:
     const unsigned int cells_size_x, const unsigned int cells_size_y, const float resolution);
   bool update(const Costmap2D & single_frame_occupancy_grid_map) override;
   void initRosParam(rclcpp::Node & node) override;
+  bool enableGpu() override;
 
 private:
   inline unsigned char applyBBF(const unsigned char & z, const unsigned char & o);
   Eigen::Matrix2f probability_matrix_;
   double v_ratio_;
+  // applyBBF(z, o) at z * CudaBinaryBayesFilter::cost_table_stride + o
+  std::vector<unsigned char> cost_table_;
+  std::shared_ptr<CudaBinaryBayesFilter> cuda_filter_;
 };
 
 }  // namespace costmap_2d
@@ -0,0 +1,60 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UPDATER__CUDA_BINARY_BAYES_FILTER_HPP_
+#define AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UPDATER__CUDA_BINARY_BAYES_FILTER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace autoware::occupancy_grid_map
+{
+namespace costmap_2d
+{
+/**
+ * @brief the update of OccupancyGridMapBBFUpdater on the GPU
+ *
+ * Each cell is updated with the cost table of the updater, indexed by the measured cost and the
+ * previous cost of the cell.
+ */
+class CudaBinaryBayesFilter
+{
+public:
+  /** @brief number of costs, the table holding cost_table_stride * cost_table_stride costs */
+  static constexpr size_t cost_table_stride = 256;
+
+  CudaBinaryBayesFilter();
+  ~CudaBinaryBayesFilter();
+
+  /**
+   * @brief update the costmap with the measured costmap
+   *
+   * @param[in] cost_table updated cost at measured cost * cost_table_stride + previous cost
+   * @param[in] measurement costmap of the single frame, with num_cells cells
+   * @param[in,out] costmap costmap with num_cells cells
+   * @return false if a CUDA operation failed
+   */
+  bool update(
+    const uint8_t * cost_table, const uint8_t * measurement, uint8_t * costmap, size_t num_cells);
+
+private:
+  struct DeviceBuffers;
+  std::unique_ptr<DeviceBuffers> buffers_;
+};
+
+}  // namespace costmap_2d
+}  // namespace autoware::occupancy_grid_map
+
+#endif  // AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UPDATER__CUDA_BINARY_BAYES_FILTER_HPP_
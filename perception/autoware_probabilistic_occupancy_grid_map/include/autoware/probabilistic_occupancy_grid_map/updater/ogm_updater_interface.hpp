@@ -35,6 +35,8 @@ public:
   virtual ~OccupancyGridMapUpdaterInterface() = default;
   virtual bool update(const Costmap2D & single_frame_occupancy_grid_map) = 0;
   virtual void initRosParam(rclcpp::Node & node) = 0;
+  /** @brief update on the GPU from now on, returning false if the updater does not support it */
+  virtual bool enableGpu() { return false; }
 };
 
 }  // namespace costmap_2d
@@ -143,6 +143,64 @@ def get_downsample_preprocess_nodes(voxel_size: float, raw_pointcloud_topics: li
     return nodes
 
 
+def get_container_actions(composable_nodes: list) -> list:
+    occupancy_grid_map_container = ComposableNodeContainer(
+        name=LaunchConfiguration("pointcloud_container_name"),
+        namespace="",
+        package="rclcpp_components",
+        executable=LaunchConfiguration("container_executable"),
+        composable_node_descriptions=composable_nodes,
+        condition=UnlessCondition(LaunchConfiguration("use_pointcloud_container")),
+        output="screen",
+    )
+
+    load_composable_nodes = LoadComposableNodes(
+        composable_node_descriptions=composable_nodes,
+        target_container=LaunchConfiguration("pointcloud_container_name"),
+        condition=IfCondition(LaunchConfiguration("use_pointcloud_container")),
+    )
+
+    return [occupancy_grid_map_container, load_composable_nodes]
+
+
+def launch_in_process_fusion(
+    context, total_config: dict, fusion_config: dict, obstacle_pointcloud_topic: str
+) -> list:
+    """Launch a single node which builds the grid map of every lidar and fuses them."""
+    ogm_creation_config = get_ogm_creation_config(total_config, 0)
+    ogm_creation_config.update(fusion_config)
+
+    if total_config["downsample_input_pointcloud"]:
+        # `/sensing/lidar/top/pointcloud` -> `top/raw/downsample/pointcloud`
+        ogm_creation_config["raw_pointcloud_topics"] = [
+            topic.split("/")[-2] + "/raw/downsample/pointcloud"
+            for topic in fusion_config["raw_pointcloud_topics"]
+        ]
+
+    composable_nodes = [
+        ComposableNode(
+            package="autoware_probabilistic_occupancy_grid_map",
+            plugin="autoware::occupancy_grid_map::MultiLidarPointcloudBasedOccupancyGridMapNode",
+            name="occupancy_grid_map_node",
+            remappings=[
+                ("~/input/obstacle_pointcloud", obstacle_pointcloud_topic),
+                ("~/output/occupancy_grid_map", LaunchConfiguration("output")),
+            ],
+            parameters=[ogm_creation_config],
+            extra_arguments=[{"use_intra_process_comms": LaunchConfiguration("use_intra_process")}],
+        )
+    ]
+
+    if total_config["downsample_input_pointcloud"]:
+        composable_nodes.extend(
+            get_downsample_preprocess_nodes(
+                total_config["downsample_voxel_size"], fusion_config["raw_pointcloud_topics"]
+            )
+        )
+
+    return get_container_actions(composable_nodes)
+
+
 def launch_setup(context, *args, **kwargs):
     """Launch fusion based occupancy grid map creation nodes.
 
@@ -180,6 +238,13 @@ def launch_setup(context, *args, **kwargs):
         else LaunchConfiguration("input/obstacle_pointcloud").perform(context)
     )
 
+    # build the grid map of every lidar and fuse them in a single node
+    in_process_fusion: bool = total_config["in_process_fusion"]
+    if in_process_fusion:
+        return launch_in_process_fusion(
+            context, total_config, fusion_config, obstacle_pointcloud_topic
+        )
+
     for i in range(number_of_nodes):
         # load parameter file
         ogm_creation_config = get_ogm_creation_config(total_config, i)
@@ -230,23 +295,7 @@ def launch_setup(context, *args, **kwargs):
     ]
 
     # 3. launch setting
-    occupancy_grid_map_container = ComposableNodeContainer(
-        name=LaunchConfiguration("pointcloud_container_name"),
-        namespace="",
-        package="rclcpp_components",
-        executable=LaunchConfiguration("container_executable"),
-        composable_node_descriptions=gridmap_generation_composable_nodes + gridmap_fusion_node,
-        condition=UnlessCondition(LaunchConfiguration("use_pointcloud_container")),
-        output="screen",
-    )
-
-    load_composable_nodes = LoadComposableNodes(
-        composable_node_descriptions=gridmap_generation_composable_nodes + gridmap_fusion_node,
-        target_container=LaunchConfiguration("pointcloud_container_name"),
-        condition=IfCondition(LaunchConfiguration("use_pointcloud_container")),
-    )
-
-    return [occupancy_grid_map_container, load_composable_nodes]
+    return get_container_actions(gridmap_generation_composable_nodes + gridmap_fusion_node)
 
 
 def generate_launch_description():
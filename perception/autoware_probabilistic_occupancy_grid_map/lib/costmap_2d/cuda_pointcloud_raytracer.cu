@@ -0,0 +1,713 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/cuda_pointcloud_raytracer.hpp"
+
+#include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
+
+#include <cuda_runtime.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system_error.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace autoware::occupancy_grid_map
+{
+namespace costmap_2d
+{
+namespace
+{
+constexpr int threads_per_block = 256;
+// a bin is traced by a single thread, so that small blocks spread the bins over more
+// multiprocessors
+constexpr int bins_per_block = 32;
+constexpr uint64_t invalid_key = ~0ULL;
+// as in OccupancyGridMapInterface::raytrace, large enough to ignore the range threshold
+constexpr uint32_t cell_raytrace_range = 10000;
+
+constexpr uint8_t free_space = cost_value::FREE_SPACE;
+constexpr uint8_t no_information = cost_value::NO_INFORMATION;
+constexpr uint8_t lethal_obstacle = cost_value::LETHAL_OBSTACLE;
+
+unsigned int numBlocks(const size_t num_threads, const int block_size)
+{
+  return static_cast<unsigned int>((num_threads + block_size - 1) / block_size);
+}
+
+/** @brief BinInfo of the fixed map and BinInfo3D of the projective map */
+struct BinPoint
+{
+  double range;
+  double wx;
+  double wy;
+  double wz;
+  double projection_length;
+  double projected_wx;
+  double projected_wy;
+};
+
+/** @brief the cell arithmetic of OccupancyGridMapInterface */
+struct DeviceMap
+{
+  double origin_x;
+  double origin_y;
+  double resolution;
+  double resolution_inv;
+  uint32_t size_x;
+  uint32_t size_y;
+
+  __device__ bool worldToMap(const double wx, const double wy, uint32_t & mx, uint32_t & my) const
+  {
+    if (wx < origin_x || wy < origin_y) {
+      return false;
+    }
+    // the conversion of NaN to int gives an index out of the map on the CPU, but 0 on the device
+    if (isnan(wx) || isnan(wy)) {
+      return false;
+    }
+
+    mx = static_cast<int>(floor((wx - origin_x) * resolution_inv));
+    my = static_cast<int>(floor((wy - origin_y) * resolution_inv));
+    return mx < size_x && my < size_y;
+  }
+};
+
+/** @brief MarkCell of Costmap2D */
+struct StoreMarker
+{
+  uint8_t * costmap;
+  uint8_t cost;
+
+  __device__ void operator()(const uint32_t offset) const { costmap[offset] = cost; }
+};
+
+/**
+ * @brief marker that keeps the cost of the last write in the order of the CPU implementation
+ *
+ * The key orders the writes by bin, then by ray within the bin, and holds the cost in its lowest
+ * byte, so that the largest key of a cell is its final value.
+ */
+struct OrderedMarker
+{
+  unsigned long long * writes;
+  unsigned long long key;
+
+  __device__ void operator()(const uint32_t offset) const { atomicMax(writes + offset, key); }
+};
+
+/** @brief gives an OrderedMarker for each successive ray of a bin */
+struct OrderedMarkerFactory
+{
+  unsigned long long * writes;
+  uint32_t bin_index;
+  uint32_t num_rays;
+
+  __device__ OrderedMarker next(const uint8_t cost)
+  {
+    const unsigned long long key = (static_cast<unsigned long long>(bin_index + 1) << 40) |
+                                   (static_cast<unsigned long long>(num_rays++) << 8) | cost;
+    return OrderedMarker{writes, key};
+  }
+};
+
+/** @brief Costmap2D::bresenham2D */
+template <typename MarkerT>
+__device__ void bresenham2D(
+  const MarkerT & marker, const uint32_t abs_da, const uint32_t abs_db, int error_b,
+  const int offset_a, const int offset_b, uint32_t offset, const uint32_t max_length)
+{
+  const uint32_t end = min(max_length, abs_da);
+  for (uint32_t i = 0; i < end; ++i) {
+    marker(offset);
+    offset += offset_a;
+    error_b += abs_db;
+    if (static_cast<uint32_t>(error_b) >= abs_da) {
+      offset += offset_b;
+      error_b -= abs_da;
+    }
+  }
+  marker(offset);
+}
+
+/** @brief Costmap2D::raytraceLine */
+template <typename MarkerT>
+__device__ void raytraceLine(
+  const MarkerT & marker, const uint32_t size_x, const uint32_t x0, const uint32_t y0,
+  const uint32_t x1, const uint32_t y1, const uint32_t max_length)
+{
+  const int dx = x1 - x0;
+  const int dy = y1 - y0;
+  const uint32_t abs_dx = abs(dx);
+  const uint32_t abs_dy = abs(dy);
+  const int offset_dx = dx > 0 ? 1 : -1;
+  const int offset_dy = (dy > 0 ? 1 : -1) * static_cast<int>(size_x);
+  const uint32_t offset = y0 * size_x + x0;
+
+  // we need to chose how much to scale our dominant dimension, based on the maximum length of the
+  // line
+  const double dist = hypot(static_cast<double>(dx), static_cast<double>(dy));
+  const double scale = (dist == 0.0) ? 1.0 : fmin(1.0, max_length / dist);
+
+  if (abs_dx >= abs_dy) {
+    const int error_y = abs_dx / 2;
+    bresenham2D(
+      marker, abs_dx, abs_dy, error_y, offset_dx, offset_dy, offset,
+      static_cast<uint32_t>(scale * abs_dx));
+    return;
+  }
+  const int error_x = abs_dy / 2;
+  bresenham2D(
+    marker, abs_dy, abs_dx, error_x, offset_dy, offset_dx, offset,
+    static_cast<uint32_t>(scale * abs_dy));
+}
+
+/** @brief OccupancyGridMapInterface::raytrace */
+template <typename MarkerT>
+__device__ void raytrace(
+  const DeviceMap & map, const double source_x, const double source_y, const double target_x,
+  const double target_y, const MarkerT & marker)
+{
+  uint32_t x0{};
+  uint32_t y0{};
+  const double ox{source_x};
+  const double oy{source_y};
+  if (!map.worldToMap(ox, oy, x0, y0)) {
+    return;
+  }
+
+  const double origin_x = map.origin_x, origin_y = map.origin_y;
+  const double map_end_x = origin_x + map.size_x * map.resolution;
+  const double map_end_y = origin_y + map.size_y * map.resolution;
+
+  double wx = target_x;
+  double wy = target_y;
+
+  // make sure that the endpoint we're ray-tracing to isn't off the costmap and scale if necessary
+  const double a = wx - ox;
+  const double b = wy - oy;
+
+  // the minimum value to raytrace from is the origin
+  if (wx < origin_x) {
+    const double t = (origin_x - ox) / a;
+    wx = origin_x;
+    wy = oy + b * t;
+  }
+  if (wy < origin_y) {
+    const double t = (origin_y - oy) / b;
+    wx = ox + a * t;
+    wy = origin_y;
+  }
+
+  // the maximum value to raytrace to is the end of the map
+  if (wx > map_end_x) {
+    const double t = (map_end_x - ox) / a;
+    wx = map_end_x - .001;
+    wy = oy + b * t;
+  }
+  if (wy > map_end_y) {
+    const double t = (map_end_y - oy) / b;
+    wx = ox + a * t;
+    wy = map_end_y - .001;
+  }
+
+  uint32_t x1{};
+  uint32_t y1{};
+  if (!map.worldToMap(wx, wy, x1, y1)) {
+    return;
+  }
+  raytraceLine(marker, map.size_x, x0, y0, x1, y1, cell_raytrace_range);
+}
+
+/** @brief OccupancyGridMapInterface::setCellValue */
+template <typename MarkerT>
+__device__ void setCellValue(
+  const DeviceMap & map, const double wx, const double wy, const MarkerT & marker)
+{
+  uint32_t mx{};
+  uint32_t my{};
+  if (!map.worldToMap(wx, wy, mx, my)) {
+    return;
+  }
+  marker(my * map.size_x + mx);
+}
+
+__device__ float loadFloat(const uint8_t * data)
+{
+  float value;
+  memcpy(&value, data, sizeof(float));
+  return value;
+}
+
+/** @brief Eigen::Matrix4f * Eigen::Vector4f for a point with w = 1, with a row-major matrix */
+__device__ void transformPoint(const float * mat, const float * pt, float * transformed)
+{
+  for (int i = 0; i < 3; ++i) {
+    transformed[i] =
+      mat[i * 4] * pt[0] + mat[i * 4 + 1] * pt[1] + mat[i * 4 + 2] * pt[2] + mat[i * 4 + 3];
+  }
+}
+
+/**
+ * @brief transform the points and compute their angle bins and ranges, as
+ * OccupancyGridMapInterface::transformPointAndCalculate
+ *
+ * The obstacle points are dropped when no raw point of their bin is farther, for which the raw
+ * bins are given. The key orders the points by bin then by range, and is invalid_key for the
+ * dropped points.
+ */
+__global__ void binPointsKernel(
+  const uint8_t * __restrict__ points, const uint32_t num_points, const CudaPointLayout layout,
+  const CudaRaytraceParameters parameters, const BinPoint * __restrict__ raw_bin_points,
+  const uint32_t * __restrict__ raw_bin_begins, const uint32_t * __restrict__ raw_bin_counts,
+  uint64_t * __restrict__ keys, uint32_t * __restrict__ indices, BinPoint * __restrict__ bin_points,
+  uint32_t * __restrict__ bin_counts)
+{
+  const uint32_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= num_points) {
+    return;
+  }
+  indices[i] = i;
+  keys[i] = invalid_key;
+
+  const uint8_t * point = points + static_cast<size_t>(i) * layout.point_step;
+  const float pt[3] = {
+    loadFloat(point + layout.offset_x), loadFloat(point + layout.offset_y),
+    loadFloat(point + layout.offset_z)};
+  // height filter, and exclude invalid points
+  if (
+    !(parameters.min_height < pt[2] && pt[2] < parameters.max_height) || !isfinite(pt[0]) ||
+    !isfinite(pt[1]) || !isfinite(pt[2])) {
+    return;
+  }
+
+  float pt_map[3];
+  float pt_scan[3];
+  transformPoint(parameters.mat_map, pt, pt_map);
+  transformPoint(parameters.mat_scan, pt_map, pt_scan);
+  // atan2 of floats resolves to the float overload on the CPU
+  const double angle = atan2f(pt_scan[1], pt_scan[0]);
+  const int angle_bin_index = (angle - parameters.min_angle) * parameters.angle_increment_inv;
+  if (angle_bin_index < 0 || static_cast<uint32_t>(angle_bin_index) >= parameters.angle_bin_size) {
+    return;
+  }
+  const float range = sqrtf(pt_scan[1] * pt_scan[1] + pt_scan[0] * pt_scan[0]);
+
+  BinPoint bin_point{};
+  bin_point.range = range;
+  bin_point.wx = pt_map[0];
+  bin_point.wy = pt_map[1];
+  bin_point.wz = pt_map[2];
+  bin_point.projection_length = INFINITY;
+  bin_point.projected_wx = INFINITY;
+  bin_point.projected_wy = INFINITY;
+
+  if (raw_bin_points) {
+    // ignore obstacle points exceeding the range of the raw points
+    const uint32_t num_raw_points = raw_bin_counts[angle_bin_index];
+    if (num_raw_points == 0) {
+      return;
+    }
+    const BinPoint & farthest_raw_point =
+      raw_bin_points[raw_bin_begins[angle_bin_index] + num_raw_points - 1];
+    if (bin_point.range > farthest_raw_point.range) {
+      return;
+    }
+
+    if (parameters.blind_spot_model == CudaBlindSpotModel::PROJECTIVE) {
+      const double scan_z = parameters.scan_origin_z - parameters.robot_pose_z;
+      const double obstacle_z = bin_point.wz - parameters.robot_pose_z;
+      const double dz = scan_z - obstacle_z;
+      if (dz > parameters.projection_dz_threshold) {
+        const double ratio = obstacle_z / dz;
+        bin_point.projection_length = bin_point.range * ratio;
+        bin_point.projected_wx = bin_point.wx + (bin_point.wx - parameters.scan_origin_x) * ratio;
+        bin_point.projected_wy = bin_point.wy + (bin_point.wy - parameters.scan_origin_y) * ratio;
+      }
+    }
+  }
+
+  bin_points[i] = bin_point;
+  // ranges are not negative, so that their bits sort as the floats
+  keys[i] = (static_cast<uint64_t>(angle_bin_index) << 32) | __float_as_uint(range);
+  atomicAdd(bin_counts + angle_bin_index, 1U);
+}
+
+__global__ void gatherBinPointsKernel(
+  const BinPoint * __restrict__ bin_points, const uint32_t * __restrict__ indices,
+  const uint32_t num_points, BinPoint * __restrict__ sorted_bin_points)
+{
+  const uint32_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < num_points) {
+    sorted_bin_points[i] = bin_points[indices[i]];
+  }
+}
+
+struct DeviceBins
+{
+  const BinPoint * points;
+  const uint32_t * begins;
+  const uint32_t * counts;
+
+  __device__ const BinPoint * begin(const uint32_t bin_index) const
+  {
+    return points + begins[bin_index];
+  }
+  __device__ uint32_t size(const uint32_t bin_index) const { return counts[bin_index]; }
+};
+
+/** @brief first step: initialize the cells to the farthest raw point with free space */
+__global__ void traceFreeSpaceKernel(
+  const CudaRaytraceParameters parameters, const DeviceMap map, const DeviceBins raw_bins,
+  uint8_t * __restrict__ costmap)
+{
+  const uint32_t bin_index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (bin_index >= parameters.angle_bin_size || raw_bins.size(bin_index) == 0) {
+    return;
+  }
+  const BinPoint & ray_end = raw_bins.begin(bin_index)[raw_bins.size(bin_index) - 1];
+  raytrace(
+    map, parameters.scan_origin_x, parameters.scan_origin_y, ray_end.wx, ray_end.wy,
+    StoreMarker{costmap, free_space});
+}
+
+/** @brief second step of OccupancyGridMapFixedBlindSpot, for a bin */
+__device__ void traceFixedUnknownBin(
+  const CudaRaytraceParameters & parameters, const DeviceMap & map, const BinPoint * obstacles,
+  const uint32_t num_obstacles, const BinPoint * raws, const uint32_t num_raws,
+  OrderedMarkerFactory & markers)
+{
+  const double distance_margin = parameters.distance_margin;
+  uint32_t raw_index = 0;
+  for (uint32_t dist_index = 0; dist_index < num_obstacles; ++dist_index) {
+    const BinPoint & obstacle = obstacles[dist_index];
+    // calculate next raw point from obstacle point
+    while (raw_index < num_raws && raws[raw_index].range < obstacle.range + distance_margin) {
+      ++raw_index;
+    }
+
+    // there is no point farther than the obstacle point
+    const bool no_freespace_point = raw_index == num_raws;
+
+    if (dist_index + 1 == num_obstacles) {
+      if (!no_freespace_point) {
+        const BinPoint & target = raws[raw_index];
+        raytrace(map, obstacle.wx, obstacle.wy, target.wx, target.wy, markers.next(no_information));
+        setCellValue(map, target.wx, target.wy, markers.next(free_space));
+      }
+      continue;
+    }
+
+    const BinPoint & next_obstacle = obstacles[dist_index + 1];
+    const double next_obstacle_point_distance = fabs(next_obstacle.range - obstacle.range);
+    if (next_obstacle_point_distance <= distance_margin) {
+      continue;
+    } else if (no_freespace_point) {
+      raytrace(
+        map, obstacle.wx, obstacle.wy, next_obstacle.wx, next_obstacle.wy,
+        markers.next(no_information));
+      continue;
+    }
+
+    const BinPoint & raw = raws[raw_index];
+    const double next_raw_distance = fabs(obstacle.range - raw.range);
+    if (next_raw_distance < next_obstacle_point_distance) {
+      raytrace(map, obstacle.wx, obstacle.wy, raw.wx, raw.wy, markers.next(no_information));
+      setCellValue(map, raw.wx, raw.wy, markers.next(free_space));
+    } else {
+      raytrace(
+        map, obstacle.wx, obstacle.wy, next_obstacle.wx, next_obstacle.wy,
+        markers.next(no_information));
+    }
+  }
+}
+
+/** @brief second step of OccupancyGridMapProjectiveBlindSpot, for a bin */
+__device__ void traceProjectiveUnknownBin(
+  const CudaRaytraceParameters & parameters, const DeviceMap & map, const BinPoint * obstacles,
+  const uint32_t num_obstacles, const BinPoint * raws, const uint32_t num_raws,
+  OrderedMarkerFactory & markers)
+{
+  const auto is_visible_beyond_obstacle = [&](const BinPoint & obstacle, const BinPoint & raw) {
+    if (raw.range < obstacle.range) {
+      return false;
+    }
+    if (isinf(obstacle.projection_length)) {
+      return false;
+    }
+    // y = ax + b
+    const double a = -(parameters.scan_origin_z - parameters.robot_pose_z) /
+                     (obstacle.range + obstacle.projection_length);
+    const double b = parameters.scan_origin_z;
+    return raw.wz > (a * raw.range + b);
+  };
+
+  const double obstacle_separation_threshold = parameters.obstacle_separation_threshold;
+  uint32_t raw_index = 0;
+  for (uint32_t dist_index = 0; dist_index < num_obstacles; ++dist_index) {
+    const BinPoint & obstacle = obstacles[dist_index];
+    // calculate next raw point from obstacle point
+    while (raw_index < num_raws && !is_visible_beyond_obstacle(obstacle, raws[raw_index])) {
+      ++raw_index;
+    }
+
+    // there is no point farther than the obstacle point
+    if (raw_index == num_raws) {
+      raytrace(
+        map, obstacle.wx, obstacle.wy, obstacle.projected_wx, obstacle.projected_wy,
+        markers.next(no_information));
+      break;
+    }
+
+    if (dist_index + 1 == num_obstacles) {
+      raytrace(
+        map, obstacle.wx, obstacle.wy, obstacle.projected_wx, obstacle.projected_wy,
+        markers.next(no_information));
+      continue;
+    }
+
+    const BinPoint & next_obstacle = obstacles[dist_index + 1];
+    const double next_obstacle_point_distance = fabs(next_obstacle.range - obstacle.range);
+    if (next_obstacle_point_distance <= obstacle_separation_threshold) {
+      continue;
+    }
+
+    const BinPoint & raw = raws[raw_index];
+    const double next_raw_distance = fabs(obstacle.range - raw.range);
+    if (next_raw_distance < next_obstacle_point_distance) {
+      raytrace(map, obstacle.wx, obstacle.wy, raw.wx, raw.wy, markers.next(no_information));
+      setCellValue(map, raw.wx, raw.wy, markers.next(free_space));
+    } else {
+      raytrace(
+        map, obstacle.wx, obstacle.wy, next_obstacle.wx, next_obstacle.wy,
+        markers.next(no_information));
+    }
+  }
+}
+
+/** @brief second step: add the unknown cells behind the obstacles */
+__global__ void traceUnknownKernel(
+  const CudaRaytraceParameters parameters, const DeviceMap map, const DeviceBins raw_bins,
+  const DeviceBins obstacle_bins, unsigned long long * __restrict__ writes)
+{
+  const uint32_t bin_index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (bin_index >= parameters.angle_bin_size) {
+    return;
+  }
+  OrderedMarkerFactory markers{writes, bin_index, 0};
+  if (parameters.blind_spot_model == CudaBlindSpotModel::PROJECTIVE) {
+    traceProjectiveUnknownBin(
+      parameters, map, obstacle_bins.begin(bin_index), obstacle_bins.size(bin_index),
+      raw_bins.begin(bin_index), raw_bins.size(bin_index), markers);
+  } else {
+    traceFixedUnknownBin(
+      parameters, map, obstacle_bins.begin(bin_index), obstacle_bins.size(bin_index),
+      raw_bins.begin(bin_index), raw_bins.size(bin_index), markers);
+  }
+}
+
+__global__ void applyOrderedWritesKernel(
+  const unsigned long long * __restrict__ writes, const uint32_t num_cells,
+  uint8_t * __restrict__ costmap)
+{
+  const uint32_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < num_cells && writes[i] != 0) {
+    costmap[i] = static_cast<uint8_t>(writes[i] & 0xFF);
+  }
+}
+
+/** @brief third step: overwrite the occupied cells */
+__global__ void traceObstaclesKernel(
+  const CudaRaytraceParameters parameters, const DeviceMap map, const DeviceBins obstacle_bins,
+  uint8_t * __restrict__ costmap)
+{
+  const uint32_t bin_index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (bin_index >= parameters.angle_bin_size) {
+    return;
+  }
+  const double separation_threshold =
+    parameters.blind_spot_model == CudaBlindSpotModel::PROJECTIVE
+      ? parameters.obstacle_separation_threshold
+      : parameters.distance_margin;
+  const StoreMarker marker{costmap, lethal_obstacle};
+  const BinPoint * obstacles = obstacle_bins.begin(bin_index);
+  const uint32_t num_obstacles = obstacle_bins.size(bin_index);
+  for (uint32_t dist_index = 0; dist_index < num_obstacles; ++dist_index) {
+    const BinPoint & obstacle = obstacles[dist_index];
+    setCellValue(map, obstacle.wx, obstacle.wy, marker);
+
+    if (dist_index + 1 == num_obstacles) {
+      continue;
+    }
+    const BinPoint & next_obstacle = obstacles[dist_index + 1];
+    if (fabs(next_obstacle.range - obstacle.range) <= separation_threshold) {
+      raytrace(map, obstacle.wx, obstacle.wy, next_obstacle.wx, next_obstacle.wy, marker);
+    }
+  }
+}
+}  // namespace
+
+struct CudaPointCloudRaytracer::DeviceBuffers
+{
+  /** @brief points of a cloud, grouped by angle bin and sorted by range */
+  struct PointBins
+  {
+    thrust::device_vector<uint8_t> points;
+    thrust::device_vector<uint64_t> keys;
+    thrust::device_vector<uint32_t> indices;
+    thrust::device_vector<BinPoint> unsorted_bin_points;
+    thrust::device_vector<BinPoint> bin_points;
+    thrust::device_vector<uint32_t> bin_counts;
+    thrust::device_vector<uint32_t> bin_begins;
+
+    DeviceBins getDeviceBins() const
+    {
+      return DeviceBins{
+        thrust::raw_pointer_cast(bin_points.data()), thrust::raw_pointer_cast(bin_begins.data()),
+        thrust::raw_pointer_cast(bin_counts.data())};
+    }
+  };
+
+  cudaStream_t stream{nullptr};
+  // reused for the next frames, as device_vector only reallocates to grow
+  PointBins raw;
+  PointBins obstacle;
+  thrust::device_vector<uint8_t> costmap;
+  thrust::device_vector<unsigned long long> writes;
+};
+
+CudaPointCloudRaytracer::CudaPointCloudRaytracer() : buffers_(std::make_unique<DeviceBuffers>())
+{
+  if (cudaStreamCreate(&buffers_->stream) != cudaSuccess) {
+    buffers_->stream = nullptr;
+  }
+}
+
+CudaPointCloudRaytracer::~CudaPointCloudRaytracer()
+{
+  if (buffers_->stream) {
+    cudaStreamDestroy(buffers_->stream);
+  }
+}
+
+bool CudaPointCloudRaytracer::update(
+  const CudaRaytraceParameters & parameters, const uint8_t * raw_points,
+  const size_t num_raw_points, const CudaPointLayout & raw_layout,
+  const uint8_t * obstacle_points, const size_t num_obstacle_points,
+  const CudaPointLayout & obstacle_layout, uint8_t * costmap)
+{
+  // the indices and the cell offsets are 32 bits
+  const size_t num_cells = static_cast<size_t>(parameters.size_x) * parameters.size_y;
+  const size_t num_bins = parameters.angle_bin_size;
+  if (
+    raw_layout.point_step == 0 || obstacle_layout.point_step == 0 || num_bins == 0 ||
+    num_cells == 0 || num_cells > UINT32_MAX || num_raw_points > UINT32_MAX ||
+    num_obstacle_points > UINT32_MAX) {
+    return false;
+  }
+
+  DeviceMap map{};
+  map.origin_x = parameters.origin_x;
+  map.origin_y = parameters.origin_y;
+  map.resolution = parameters.resolution;
+  map.resolution_inv = 1.0 / parameters.resolution;
+  map.size_x = parameters.size_x;
+  map.size_y = parameters.size_y;
+
+  auto & b = *buffers_;
+  const auto stream = b.stream;
+  const auto policy = thrust::cuda::par.on(stream);
+
+  // transform the points into angle bins sorted by range, the obstacle points being filtered by
+  // the raw bins
+  const auto bin_points = [&](
+                            DeviceBuffers::PointBins & bins, const uint8_t * points,
+                            const size_t num_points, const CudaPointLayout & layout,
+                            const DeviceBuffers::PointBins * raw_bins) {
+    bins.points.resize(num_points * layout.point_step);
+    bins.keys.resize(num_points);
+    bins.indices.resize(num_points);
+    bins.unsorted_bin_points.resize(num_points);
+    bins.bin_points.resize(num_points);
+    bins.bin_counts.resize(num_bins);
+    bins.bin_begins.resize(num_bins);
+    cudaMemsetAsync(
+      thrust::raw_pointer_cast(bins.bin_counts.data()), 0, num_bins * sizeof(uint32_t), stream);
+    if (num_points > 0) {
+      cudaMemcpyAsync(
+        thrust::raw_pointer_cast(bins.points.data()), points, num_points * layout.point_step,
+        cudaMemcpyHostToDevice, stream);
+      const DeviceBins raw_device_bins =
+        raw_bins ? raw_bins->getDeviceBins() : DeviceBins{nullptr, nullptr, nullptr};
+      binPointsKernel<<<numBlocks(num_points, threads_per_block), threads_per_block, 0, stream>>>(
+        thrust::raw_pointer_cast(bins.points.data()), static_cast<uint32_t>(num_points), layout,
+        parameters, raw_device_bins.points, raw_device_bins.begins, raw_device_bins.counts,
+        thrust::raw_pointer_cast(bins.keys.data()), thrust::raw_pointer_cast(bins.indices.data()),
+        thrust::raw_pointer_cast(bins.unsorted_bin_points.data()),
+        thrust::raw_pointer_cast(bins.bin_counts.data()));
+      thrust::sort_by_key(policy, bins.keys.begin(), bins.keys.end(), bins.indices.begin());
+      gatherBinPointsKernel<<<
+        numBlocks(num_points, threads_per_block), threads_per_block, 0, stream>>>(
+        thrust::raw_pointer_cast(bins.unsorted_bin_points.data()),
+        thrust::raw_pointer_cast(bins.indices.data()), static_cast<uint32_t>(num_points),
+        thrust::raw_pointer_cast(bins.bin_points.data()));
+    }
+    thrust::exclusive_scan(
+      policy, bins.bin_counts.begin(), bins.bin_counts.end(), bins.bin_begins.begin());
+  };
+
+  try {
+    b.costmap.resize(num_cells);
+    b.writes.resize(num_cells);
+    auto * costmap_d = thrust::raw_pointer_cast(b.costmap.data());
+    auto * writes_d = thrust::raw_pointer_cast(b.writes.data());
+    cudaMemcpyAsync(costmap_d, costmap, num_cells, cudaMemcpyHostToDevice, stream);
+    cudaMemsetAsync(writes_d, 0, num_cells * sizeof(unsigned long long), stream);
+
+    bin_points(b.raw, raw_points, num_raw_points, raw_layout, nullptr);
+    bin_points(b.obstacle, obstacle_points, num_obstacle_points, obstacle_layout, &b.raw);
+    const DeviceBins raw_bins = b.raw.getDeviceBins();
+    const DeviceBins obstacle_bins = b.obstacle.getDeviceBins();
+
+    // every step waits for all the bins of the previous one, as it overwrites its cells
+    const auto bin_blocks = numBlocks(num_bins, bins_per_block);
+    traceFreeSpaceKernel<<<bin_blocks, bins_per_block, 0, stream>>>(
+      parameters, map, raw_bins, costmap_d);
+    traceUnknownKernel<<<bin_blocks, bins_per_block, 0, stream>>>(
+      parameters, map, raw_bins, obstacle_bins, writes_d);
+    applyOrderedWritesKernel<<<numBlocks(num_cells, threads_per_block), threads_per_block, 0,
+                               stream>>>(writes_d, static_cast<uint32_t>(num_cells), costmap_d);
+    traceObstaclesKernel<<<bin_blocks, bins_per_block, 0, stream>>>(
+      parameters, map, obstacle_bins, costmap_d);
+    cudaStreamSynchronize(stream);
+  } catch (const thrust::system_error &) {
+    return false;
+  }
+
+  if (cudaGetLastError() != cudaSuccess) {
+    return false;
+  }
+  cudaMemcpyAsync(
+    costmap, thrust::raw_pointer_cast(b.costmap.data()), num_cells, cudaMemcpyDeviceToHost,
+    stream);
+  cudaStreamSynchronize(stream);
+  return cudaGetLastError() == cudaSuccess;
+}
+
+}  // namespace costmap_2d
+}  // namespace autoware::occupancy_grid_map
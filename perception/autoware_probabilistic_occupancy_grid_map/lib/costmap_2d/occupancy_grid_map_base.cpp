@@ -236,6 +236,67 @@ void OccupancyGridMapInterface::raytrace(
   raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_range);
 }
 
+bool OccupancyGridMapInterface::enableGpu()
+{
+#ifdef OCCUPANCY_GRID_MAP_USE_CUDA
+  cuda_raytracer_ = std::make_shared<CudaPointCloudRaytracer>();
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool OccupancyGridMapInterface::updateWithPointCloudOnGpu(
+  const PointCloud2 & raw_pointcloud, const PointCloud2 & obstacle_pointcloud,
+  const Pose & robot_pose, const Pose & scan_origin, CudaRaytraceParameters parameters)
+{
+  if (!cuda_raytracer_) {
+    return false;
+  }
+
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      parameters.mat_map[row * 4 + col] = mat_map_(row, col);
+      parameters.mat_scan[row * 4 + col] = mat_scan_(row, col);
+    }
+  }
+  parameters.min_height = min_height_;
+  parameters.max_height = max_height_;
+  parameters.scan_origin_x = scan_origin.position.x;
+  parameters.scan_origin_y = scan_origin.position.y;
+  parameters.scan_origin_z = scan_origin.position.z;
+  parameters.robot_pose_z = robot_pose.position.z;
+  parameters.min_angle = min_angle_;
+  parameters.angle_increment_inv = angle_increment_inv_;
+  parameters.angle_bin_size =
+    ((max_angle_ - min_angle_) * angle_increment_inv_) + size_t(1 /*margin*/);
+  parameters.origin_x = origin_x_;
+  parameters.origin_y = origin_y_;
+  parameters.resolution = resolution_;
+  parameters.size_x = size_x_;
+  parameters.size_y = size_y_;
+
+#ifdef OCCUPANCY_GRID_MAP_USE_CUDA
+  const CudaPointLayout raw_layout{
+    raw_pointcloud.point_step, static_cast<uint32_t>(x_offset_raw_),
+    static_cast<uint32_t>(y_offset_raw_), static_cast<uint32_t>(z_offset_raw_)};
+  const CudaPointLayout obstacle_layout{
+    obstacle_pointcloud.point_step, static_cast<uint32_t>(x_offset_obstacle_),
+    static_cast<uint32_t>(y_offset_obstacle_), static_cast<uint32_t>(z_offset_obstacle_)};
+  if (cuda_raytracer_->update(
+        parameters, raw_pointcloud.data.data(), raw_pointcloud.width * raw_pointcloud.height,
+        raw_layout, obstacle_pointcloud.data.data(),
+        obstacle_pointcloud.width * obstacle_pointcloud.height, obstacle_layout, costmap_)) {
+    return true;
+  }
+  RCLCPP_WARN_THROTTLE(logger_, clock_, 5000, "GPU raytracing failed, raytracing on the CPU");
+#else
+  (void)raw_pointcloud;
+  (void)obstacle_pointcloud;
+#endif
+  return false;
+}
+
 void OccupancyGridMapInterface::setHeightLimit(const double min_height, const double max_height)
 {
   min_height_ = min_height;
@@ -73,6 +73,16 @@ void OccupancyGridMapFixedBlindSpot::updateWithPointCloud(
     setFieldOffsets(raw_pointcloud, obstacle_pointcloud);
   }
 
+  if (cuda_raytracer_) {
+    CudaRaytraceParameters parameters{};
+    parameters.blind_spot_model = CudaBlindSpotModel::FIXED;
+    parameters.distance_margin = distance_margin_;
+    if (updateWithPointCloudOnGpu(
+          raw_pointcloud, obstacle_pointcloud, robot_pose, scan_origin, parameters)) {
+      return;
+    }
+  }
+
   // Create angle bins and sort by distance
   struct BinInfo
   {
@@ -74,6 +74,18 @@ void OccupancyGridMapProjectiveBlindSpot::updateWithPointCloud(
     setFieldOffsets(raw_pointcloud, obstacle_pointcloud);
   }
 
+  // the debug grid needs the map after each step, which the GPU does not download
+  if (cuda_raytracer_ && !pub_debug_grid_) {
+    CudaRaytraceParameters parameters{};
+    parameters.blind_spot_model = CudaBlindSpotModel::PROJECTIVE;
+    parameters.projection_dz_threshold = projection_dz_threshold_;
+    parameters.obstacle_separation_threshold = obstacle_separation_threshold_;
+    if (updateWithPointCloudOnGpu(
+          raw_pointcloud, obstacle_pointcloud, robot_pose, scan_origin, parameters)) {
+      return;
+    }
+  }
+
   // Create angle bins and sort points by range
   struct BinInfo3D
   {
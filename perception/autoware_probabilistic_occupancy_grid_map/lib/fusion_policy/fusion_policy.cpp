@@ -14,6 +14,9 @@
 
 #include "autoware/probabilistic_occupancy_grid_map/fusion_policy/fusion_policy.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace autoware::occupancy_grid_map
 {
 namespace fusion_policy
@@ -321,5 +324,59 @@ unsigned char singleFrameOccupancyFusion(
   }
 }
 
+void singleFrameOccupancyFusion(
+  const std::vector<const unsigned char *> & occupancies, const std::size_t num_cells,
+  FusionMethod method, const std::vector<double> & reliability, unsigned char * fused)
+{
+  if (occupancies.empty()) {
+    throw std::runtime_error("occupancies size is 0");
+  } else if (occupancies.size() == 1) {
+    std::copy(occupancies[0], occupancies[0] + num_cells, fused);
+    return;
+  }
+
+  // warn once for the whole map instead of for each cell
+  const bool use_reliability = reliability.size() == occupancies.size();
+  if (!use_reliability && method != FusionMethod::OVERWRITE) {
+    std::cout << "The size of occupancies and reliability are not the same. Return fusion "
+                 "without reliability."
+              << std::endl;
+  }
+
+  if (method != FusionMethod::LOG_ODDS) {
+    std::vector<unsigned char> costs(occupancies.size());
+    for (std::size_t i = 0; i < num_cells; ++i) {
+      for (std::size_t map_i = 0; map_i < occupancies.size(); ++map_i) {
+        costs[map_i] = occupancies[map_i][i];
+      }
+      fused[i] = use_reliability ? singleFrameOccupancyFusion(costs, method, reliability)
+                                 : singleFrameOccupancyFusion(costs, method);
+    }
+    return;
+  }
+
+  // weighted log-odds of every char value, summed in the same order as logOddsFusion
+  std::vector<double> log_odds(num_cells, 0.0);
+  std::array<double, 256> log_odds_table{};
+  for (std::size_t map_i = 0; map_i < occupancies.size(); ++map_i) {
+    for (std::size_t occupancy = 0; occupancy < log_odds_table.size(); ++occupancy) {
+      const double p = std::max(
+        EPSILON_PROB,
+        std::min(
+          1.0 - EPSILON_PROB, convertCharToProbability(static_cast<unsigned char>(occupancy))));
+      const double cell_log_odds = std::log(p / (1.0 - p));
+      log_odds_table[occupancy] =
+        use_reliability ? reliability[map_i] * cell_log_odds : cell_log_odds;
+    }
+    const unsigned char * occupancy = occupancies[map_i];
+    for (std::size_t i = 0; i < num_cells; ++i) {
+      log_odds[i] += log_odds_table[occupancy[i]];
+    }
+  }
+  for (std::size_t i = 0; i < num_cells; ++i) {
+    fused[i] = convertProbabilityToChar(1.0 / (1.0 + std::exp(-log_odds[i])));
+  }
+}
+
 }  // namespace fusion_policy
 }  // namespace autoware::occupancy_grid_map
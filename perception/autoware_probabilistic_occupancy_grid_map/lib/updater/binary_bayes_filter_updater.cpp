@@ -41,6 +41,26 @@ void OccupancyGridMapBBFUpdater::initRosParam(rclcpp::Node & node)
   probability_matrix_(Index::OCCUPIED, Index::FREE) =
     node.declare_parameter<double>("probability_matrix.free_to_occupied");
   v_ratio_ = node.declare_parameter<double>("v_ratio");
+
+  // applyBBF only depends on the measured and the previous costs, so that it is tabulated once
+  constexpr size_t cost_table_stride = CudaBinaryBayesFilter::cost_table_stride;
+  cost_table_.resize(cost_table_stride * cost_table_stride);
+  for (size_t z = 0; z < cost_table_stride; ++z) {
+    for (size_t o = 0; o < cost_table_stride; ++o) {
+      cost_table_[z * cost_table_stride + o] =
+        applyBBF(static_cast<unsigned char>(z), static_cast<unsigned char>(o));
+    }
+  }
+}
+
+bool OccupancyGridMapBBFUpdater::enableGpu()
+{
+#ifdef OCCUPANCY_GRID_MAP_USE_CUDA
+  cuda_filter_ = std::make_shared<CudaBinaryBayesFilter>();
+  return true;
+#else
+  return false;
+#endif
 }
 
 inline unsigned char OccupancyGridMapBBFUpdater::applyBBF(
@@ -73,11 +93,16 @@ bool OccupancyGridMapBBFUpdater::update(const Costmap2D & single_frame_occupancy
 {
   updateOrigin(
     single_frame_occupancy_grid_map.getOriginX(), single_frame_occupancy_grid_map.getOriginY());
-  for (unsigned int x = 0; x < getSizeInCellsX(); x++) {
-    for (unsigned int y = 0; y < getSizeInCellsY(); y++) {
-      unsigned int index = getIndex(x, y);
-      costmap_[index] = applyBBF(single_frame_occupancy_grid_map.getCost(x, y), costmap_[index]);
-    }
+  const unsigned char * measurement = single_frame_occupancy_grid_map.getCharMap();
+  const size_t num_cells = static_cast<size_t>(getSizeInCellsX()) * getSizeInCellsY();
+#ifdef OCCUPANCY_GRID_MAP_USE_CUDA
+  if (cuda_filter_ && cuda_filter_->update(cost_table_.data(), measurement, costmap_, num_cells)) {
+    return true;
+  }
+#endif
+  constexpr size_t cost_table_stride = CudaBinaryBayesFilter::cost_table_stride;
+  for (size_t index = 0; index < num_cells; ++index) {
+    costmap_[index] = cost_table_[measurement[index] * cost_table_stride + costmap_[index]];
   }
   return true;
 }
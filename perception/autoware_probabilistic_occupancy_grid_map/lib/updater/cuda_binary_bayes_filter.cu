@@ -0,0 +1,107 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/probabilistic_occupancy_grid_map/updater/cuda_binary_bayes_filter.hpp"
+
+#include <cuda_runtime.h>
+#include <thrust/device_vector.h>
+#include <thrust/system_error.h>
+
+#include <cstdint>
+
+namespace autoware::occupancy_grid_map
+{
+namespace costmap_2d
+{
+namespace
+{
+constexpr int threads_per_block = 256;
+
+__global__ void updateCellsKernel(
+  const uint8_t * __restrict__ cost_table, const uint8_t * __restrict__ measurement,
+  const uint32_t num_cells, uint8_t * __restrict__ costmap)
+{
+  const uint32_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < num_cells) {
+    costmap[i] = __ldg(
+      cost_table + measurement[i] * CudaBinaryBayesFilter::cost_table_stride + costmap[i]);
+  }
+}
+}  // namespace
+
+struct CudaBinaryBayesFilter::DeviceBuffers
+{
+  cudaStream_t stream{nullptr};
+  // reused for the next frames, as device_vector only reallocates to grow
+  thrust::device_vector<uint8_t> cost_table;
+  thrust::device_vector<uint8_t> measurement;
+  thrust::device_vector<uint8_t> costmap;
+};
+
+CudaBinaryBayesFilter::CudaBinaryBayesFilter() : buffers_(std::make_unique<DeviceBuffers>())
+{
+  if (cudaStreamCreate(&buffers_->stream) != cudaSuccess) {
+    buffers_->stream = nullptr;
+  }
+}
+
+CudaBinaryBayesFilter::~CudaBinaryBayesFilter()
+{
+  if (buffers_->stream) {
+    cudaStreamDestroy(buffers_->stream);
+  }
+}
+
+bool CudaBinaryBayesFilter::update(
+  const uint8_t * cost_table, const uint8_t * measurement, uint8_t * costmap,
+  const size_t num_cells)
+{
+  if (num_cells == 0 || num_cells > UINT32_MAX) {
+    return false;
+  }
+
+  auto & b = *buffers_;
+  const auto stream = b.stream;
+  constexpr size_t cost_table_size = cost_table_stride * cost_table_stride;
+  try {
+    b.cost_table.resize(cost_table_size);
+    b.measurement.resize(num_cells);
+    b.costmap.resize(num_cells);
+  } catch (const thrust::system_error &) {
+    return false;
+  }
+  auto * cost_table_d = thrust::raw_pointer_cast(b.cost_table.data());
+  auto * measurement_d = thrust::raw_pointer_cast(b.measurement.data());
+  auto * costmap_d = thrust::raw_pointer_cast(b.costmap.data());
+
+  // the table is only 64 KiB, so that it is uploaded with every frame rather than tracked
+  cudaMemcpyAsync(cost_table_d, cost_table, cost_table_size, cudaMemcpyHostToDevice, stream);
+  cudaMemcpyAsync(measurement_d, measurement, num_cells, cudaMemcpyHostToDevice, stream);
+  cudaMemcpyAsync(costmap_d, costmap, num_cells, cudaMemcpyHostToDevice, stream);
+  const auto num_blocks =
+    static_cast<unsigned int>((num_cells + threads_per_block - 1) / threads_per_block);
+  updateCellsKernel<<<num_blocks, threads_per_block, 0, stream>>>(
+    cost_table_d, measurement_d, static_cast<uint32_t>(num_cells), costmap_d);
+  cudaStreamSynchronize(stream);
+  if (cudaGetLastError() != cudaSuccess) {
+    return false;
+  }
+
+  cudaMemcpyAsync(costmap, costmap_d, num_cells, cudaMemcpyDeviceToHost, stream);
+  cudaStreamSynchronize(stream);
+  return cudaGetLastError() == cudaSuccess;
+}
+
+}  // namespace costmap_2d
+}  // namespace autoware::occupancy_grid_map
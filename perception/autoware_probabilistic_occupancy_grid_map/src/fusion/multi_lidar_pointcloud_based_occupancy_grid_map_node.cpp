@@ -0,0 +1,444 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "multi_lidar_pointcloud_based_occupancy_grid_map_node.hpp"
+
+#include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_fixed.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_projective.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/utils/utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// cspell: ignore LOBF
+
+namespace autoware::occupancy_grid_map
+{
+using autoware::universe_utils::ScopedTimeTrack;
+using costmap_2d::OccupancyGridMapFixedBlindSpot;
+using costmap_2d::OccupancyGridMapLOBFUpdater;
+using costmap_2d::OccupancyGridMapProjectiveBlindSpot;
+
+MultiLidarPointcloudBasedOccupancyGridMapNode::MultiLidarPointcloudBasedOccupancyGridMapNode(
+  const rclcpp::NodeOptions & node_options)
+: Node("multi_lidar_pointcloud_based_occupancy_grid_map_node", node_options)
+{
+  using std::placeholders::_1;
+
+  /* params */
+  map_frame_ = this->declare_parameter<std::string>("map_frame");
+  base_link_frame_ = this->declare_parameter<std::string>("base_link_frame");
+  gridmap_origin_frame_ = this->declare_parameter<std::string>("gridmap_origin_frame");
+  use_height_filter_ = this->declare_parameter<bool>("height_filter.use_height_filter");
+  min_height_ = this->declare_parameter<double>("height_filter.min_height");
+  max_height_ = this->declare_parameter<double>("height_filter.max_height");
+  filter_obstacle_pointcloud_by_raw_pointcloud_ =
+    this->declare_parameter<bool>("filter_obstacle_pointcloud_by_raw_pointcloud");
+  const double map_length_x = this->declare_parameter<double>("map_length_x");
+  const double map_length_y = this->declare_parameter<double>("map_length_y");
+  const double map_resolution = this->declare_parameter<double>("map_resolution");
+  const bool use_gpu = this->declare_parameter<bool>("use_gpu");
+  timeout_sec_ = this->declare_parameter<double>("timeout_sec");
+  num_threads_ = this->declare_parameter<int>("num_threads");
+
+  const auto raw_pointcloud_topics =
+    this->declare_parameter<std::vector<std::string>>("raw_pointcloud_topics");
+  if (raw_pointcloud_topics.empty()) {
+    throw std::runtime_error("The number of raw pointcloud topics must larger than 0.");
+  }
+  input_ogm_reliabilities_ =
+    this->declare_parameter<std::vector<double>>("input_ogm_reliabilities");
+  if (input_ogm_reliabilities_.size() != raw_pointcloud_topics.size()) {
+    throw std::runtime_error("The number of reliabilities does not match the number of topics.");
+  }
+
+  const std::string fusion_method_str = this->declare_parameter<std::string>("fusion_method");
+  if (fusion_method_str == "overwrite") {
+    fusion_method_ = fusion_policy::FusionMethod::OVERWRITE;
+  } else if (fusion_method_str == "log-odds") {
+    fusion_method_ = fusion_policy::FusionMethod::LOG_ODDS;
+  } else if (fusion_method_str == "dempster-shafer") {
+    fusion_method_ = fusion_policy::FusionMethod::DEMPSTER_SHAFER;
+  } else {
+    throw std::runtime_error("The fusion method is not supported.");
+  }
+
+  /* grid maps */
+  const auto cells_size_x = static_cast<unsigned int>(map_length_x / map_resolution);
+  const auto cells_size_y = static_cast<unsigned int>(map_length_y / map_resolution);
+  const std::string grid_map_type = this->declare_parameter<std::string>("grid_map_type");
+  if (
+    grid_map_type != "OccupancyGridMapProjectiveBlindSpot" &&
+    grid_map_type != "OccupancyGridMapFixedBlindSpot") {
+    RCLCPP_WARN(
+      get_logger(),
+      "specified occupancy grid map type [%s] is not found, use OccupancyGridMapFixedBlindSpot",
+      grid_map_type.c_str());
+  }
+  // every lidar has the same grid map parameters, which can only be declared once, so the grid
+  // maps of the other lidars are copied from the first one
+  if (grid_map_type == "OccupancyGridMapProjectiveBlindSpot") {
+    auto occupancy_grid_map_ptr = std::make_unique<OccupancyGridMapProjectiveBlindSpot>(
+      cells_size_x, cells_size_y, map_resolution);
+    occupancy_grid_map_ptr->initRosParam(*this);
+    for (std::size_t sensor_i = 1; sensor_i < raw_pointcloud_topics.size(); ++sensor_i) {
+      occupancy_grid_map_ptrs_.push_back(
+        std::make_unique<OccupancyGridMapProjectiveBlindSpot>(*occupancy_grid_map_ptr));
+    }
+    occupancy_grid_map_ptrs_.insert(
+      occupancy_grid_map_ptrs_.begin(), std::move(occupancy_grid_map_ptr));
+  } else {
+    auto occupancy_grid_map_ptr = std::make_unique<OccupancyGridMapFixedBlindSpot>(
+      cells_size_x, cells_size_y, map_resolution);
+    occupancy_grid_map_ptr->initRosParam(*this);
+    for (std::size_t sensor_i = 1; sensor_i < raw_pointcloud_topics.size(); ++sensor_i) {
+      occupancy_grid_map_ptrs_.push_back(
+        std::make_unique<OccupancyGridMapFixedBlindSpot>(*occupancy_grid_map_ptr));
+    }
+    occupancy_grid_map_ptrs_.insert(
+      occupancy_grid_map_ptrs_.begin(), std::move(occupancy_grid_map_ptr));
+  }
+  // each grid map has its own GPU buffers, since they are built in parallel
+  if (use_gpu) {
+    bool is_on_gpu = true;
+    for (auto & occupancy_grid_map_ptr : occupancy_grid_map_ptrs_) {
+      is_on_gpu = occupancy_grid_map_ptr->enableGpu() && is_on_gpu;
+    }
+    if (!is_on_gpu) {
+      RCLCPP_WARN(get_logger(), "Built without CUDA, updating the grid map on the CPU instead");
+    }
+  }
+  single_frame_map_ptr_ =
+    std::make_unique<OccupancyGridMapFixedBlindSpot>(cells_size_x, cells_size_y, map_resolution);
+  occupancy_grid_map_updater_ptr_ =
+    std::make_unique<OccupancyGridMapLOBFUpdater>(cells_size_x, cells_size_y, map_resolution);
+  occupancy_grid_map_updater_ptr_->initRosParam(*this);
+
+  /* Subscriber and publisher */
+  obstacle_pointcloud_sub_ = create_subscription<PointCloud2>(
+    "~/input/obstacle_pointcloud", rclcpp::SensorDataQoS{}.keep_last(1),
+    std::bind(&MultiLidarPointcloudBasedOccupancyGridMapNode::onObstaclePointcloud, this, _1));
+  raw_pointclouds_.resize(raw_pointcloud_topics.size());
+  for (std::size_t sensor_i = 0; sensor_i < raw_pointcloud_topics.size(); ++sensor_i) {
+    std::function<void(const PointCloud2::ConstSharedPtr msg)> fnc = std::bind(
+      &MultiLidarPointcloudBasedOccupancyGridMapNode::onRawPointcloud, this, _1, sensor_i);
+    raw_pointcloud_subs_.push_back(create_subscription<PointCloud2>(
+      raw_pointcloud_topics.at(sensor_i), rclcpp::SensorDataQoS{}.keep_last(1), fnc));
+  }
+  fused_map_pub_ = create_publisher<OccupancyGrid>("~/output/occupancy_grid_map", 1);
+  single_frame_pub_ = create_publisher<OccupancyGrid>("~/debug/single_frame_map", 1);
+
+  // the timer is only started with the obstacle pointcloud of a frame
+  const auto period_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::duration<double>(timeout_sec_));
+  timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns,
+    std::bind(&MultiLidarPointcloudBasedOccupancyGridMapNode::onTimer, this));
+  timer_->cancel();
+
+  // initialize debug tool
+  {
+    using autoware::universe_utils::DebugPublisher;
+    using autoware::universe_utils::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ptr_ =
+      std::make_unique<DebugPublisher>(this, "multi_lidar_pointcloud_based_occupancy_grid_map");
+    stop_watch_ptr_->tic("cyclic_time");
+    stop_watch_ptr_->tic("processing_time");
+
+    // time keeper setup
+    bool use_time_keeper = declare_parameter<bool>("publish_processing_time_detail");
+    if (use_time_keeper) {
+      detailed_processing_time_publisher_ =
+        this->create_publisher<autoware::universe_utils::ProcessingTimeDetail>(
+          "~/debug/processing_time_detail_ms", 1);
+      auto time_keeper = autoware::universe_utils::TimeKeeper(detailed_processing_time_publisher_);
+      time_keeper_ = std::make_shared<autoware::universe_utils::TimeKeeper>(time_keeper);
+    }
+  }
+}
+
+void MultiLidarPointcloudBasedOccupancyGridMapNode::onObstaclePointcloud(
+  const PointCloud2::ConstSharedPtr & input_obstacle_msg)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  // the previous frame is published with the lidars received so far
+  if (obstacle_pointcloud_) {
+    timer_->cancel();
+    publish();
+  }
+  obstacle_pointcloud_ = input_obstacle_msg;
+  if (isFrameComplete()) {
+    publish();
+  } else {
+    timer_->reset();
+  }
+}
+
+void MultiLidarPointcloudBasedOccupancyGridMapNode::onRawPointcloud(
+  const PointCloud2::ConstSharedPtr & input_raw_msg, const std::size_t sensor_index)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  raw_pointclouds_.at(sensor_index) = input_raw_msg;
+  if (isFrameComplete()) {
+    timer_->cancel();
+    publish();
+  }
+}
+
+void MultiLidarPointcloudBasedOccupancyGridMapNode::onTimer()
+{
+  timer_->cancel();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (obstacle_pointcloud_) {
+    publish();
+  }
+}
+
+bool MultiLidarPointcloudBasedOccupancyGridMapNode::isFrameComplete() const
+{
+  // each raw pointcloud is synchronized with the obstacle pointcloud by the exact stamp
+  return obstacle_pointcloud_ &&
+         std::all_of(raw_pointclouds_.begin(), raw_pointclouds_.end(), [this](const auto & raw) {
+           return raw && rclcpp::Time(raw->header.stamp) ==
+                           rclcpp::Time(obstacle_pointcloud_->header.stamp);
+         });
+}
+
+void MultiLidarPointcloudBasedOccupancyGridMapNode::publish()
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  if (stop_watch_ptr_) {
+    stop_watch_ptr_->toc("processing_time", true);
+  }
+  const PointCloud2::ConstSharedPtr input_obstacle_msg = obstacle_pointcloud_;
+  obstacle_pointcloud_ = nullptr;
+  const rclcpp::Time stamp(input_obstacle_msg->header.stamp);
+
+  // Prepare for applying height filter, the obstacle pointcloud being shared by every lidar
+  PointCloud2 trans_input_obstacle{};
+  bool is_obstacle_transformed = false;
+  if (use_height_filter_ && input_obstacle_msg->header.frame_id != base_link_frame_) {
+    if (!utils::transformPointcloud(
+          *input_obstacle_msg, *tf2_, base_link_frame_, trans_input_obstacle)) {
+      return;
+    }
+    is_obstacle_transformed = true;
+  }
+  const PointCloud2 & input_obstacle_use =
+    is_obstacle_transformed ? trans_input_obstacle : *input_obstacle_msg;
+
+  // Get from map to base_link and grid map origin pose
+  Pose robot_pose{};
+  Pose gridmap_origin{};
+  try {
+    robot_pose = utils::getPose(stamp, *tf2_, base_link_frame_, map_frame_);
+    gridmap_origin = utils::getPose(stamp, *tf2_, gridmap_origin_frame_, map_frame_);
+  } catch (tf2::TransformException & ex) {
+    RCLCPP_WARN_STREAM(get_logger(), ex.what());
+    return;
+  }
+
+  // build the grid map of each received lidar in parallel
+  const std::size_t num_sensors = occupancy_grid_map_ptrs_.size();
+  std::vector<char> is_updated(num_sensors, false);
+  {
+    std::unique_ptr<ScopedTimeTrack> inner_st_ptr;
+    if (time_keeper_)
+      inner_st_ptr = std::make_unique<ScopedTimeTrack>("create_occupancy_grid_maps", *time_keeper_);
+
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (std::size_t sensor_i = 0; sensor_i < num_sensors; ++sensor_i) {
+      const auto & raw = raw_pointclouds_[sensor_i];
+      if (raw && rclcpp::Time(raw->header.stamp) == stamp) {
+        is_updated[sensor_i] =
+          updateSensorGridMap(sensor_i, input_obstacle_use, robot_pose, gridmap_origin);
+      }
+    }
+  }
+  std::vector<const unsigned char *> occupancies;
+  std::vector<double> weights;
+  for (std::size_t sensor_i = 0; sensor_i < num_sensors; ++sensor_i) {
+    const auto & raw = raw_pointclouds_[sensor_i];
+    if (raw && rclcpp::Time(raw->header.stamp) == stamp) {
+      raw_pointclouds_[sensor_i] = nullptr;
+    }
+    if (!is_updated[sensor_i]) {
+      continue;
+    }
+    occupancies.push_back(occupancy_grid_map_ptrs_[sensor_i]->getCharMap());
+    weights.push_back(input_ogm_reliabilities_[sensor_i]);
+  }
+  if (occupancies.empty()) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000,
+      "No grid map is created. Please check the raw pointcloud topics.");
+    return;
+  }
+
+  {  // fuse the grid maps in place
+    std::unique_ptr<ScopedTimeTrack> inner_st_ptr;
+    if (time_keeper_)
+      inner_st_ptr = std::make_unique<ScopedTimeTrack>("fuse_occupancy_grid_maps", *time_keeper_);
+
+    single_frame_map_ptr_->updateOrigin(
+      gridmap_origin.position.x - single_frame_map_ptr_->getSizeInMetersX() / 2,
+      gridmap_origin.position.y - single_frame_map_ptr_->getSizeInMetersY() / 2);
+    // the maps are built with the same origin, but fix the origin if the grid alignment differs
+    for (std::size_t sensor_i = 0; sensor_i < num_sensors; ++sensor_i) {
+      auto & occupancy_grid_map = *occupancy_grid_map_ptrs_[sensor_i];
+      if (
+        is_updated[sensor_i] &&
+        (occupancy_grid_map.getOriginX() != single_frame_map_ptr_->getOriginX() ||
+         occupancy_grid_map.getOriginY() != single_frame_map_ptr_->getOriginY())) {
+        occupancy_grid_map.updateOrigin(
+          single_frame_map_ptr_->getOriginX(), single_frame_map_ptr_->getOriginY());
+      }
+    }
+    fusion_policy::singleFrameOccupancyFusion(
+      occupancies,
+      single_frame_map_ptr_->getSizeInCellsX() * single_frame_map_ptr_->getSizeInCellsY(),
+      fusion_method_, weights, single_frame_map_ptr_->getCharMap());
+  }
+
+  {
+    std::unique_ptr<ScopedTimeTrack> inner_st_ptr;
+    if (time_keeper_)
+      inner_st_ptr =
+        std::make_unique<ScopedTimeTrack>("update_and_publish_occupancy_grid_map", *time_keeper_);
+
+    // multi frame fusion
+    occupancy_grid_map_updater_ptr_->update(*single_frame_map_ptr_);
+
+    // publish
+    fused_map_pub_->publish(OccupancyGridMapToMsgPtr(
+      map_frame_, stamp, robot_pose.position.z, *occupancy_grid_map_updater_ptr_));
+    single_frame_pub_->publish(
+      OccupancyGridMapToMsgPtr(map_frame_, stamp, robot_pose.position.z, *single_frame_map_ptr_));
+  }
+
+  if (debug_publisher_ptr_ && stop_watch_ptr_) {
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    const double pipeline_latency_ms =
+      std::chrono::duration<double, std::milli>(
+        std::chrono::nanoseconds((this->get_clock()->now() - stamp).nanoseconds()))
+        .count();
+    debug_publisher_ptr_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_ptr_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+    debug_publisher_ptr_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/pipeline_latency_ms", pipeline_latency_ms);
+  }
+}
+
+bool MultiLidarPointcloudBasedOccupancyGridMapNode::updateSensorGridMap(
+  const std::size_t sensor_index, const PointCloud2 & input_obstacle, const Pose & robot_pose,
+  const Pose & gridmap_origin)
+{
+  const PointCloud2::ConstSharedPtr & input_raw_msg = raw_pointclouds_[sensor_index];
+  auto & occupancy_grid_map = *occupancy_grid_map_ptrs_[sensor_index];
+
+  // Prepare for applying height filter
+  PointCloud2 trans_input_raw{};
+  bool is_raw_transformed = false;
+  if (use_height_filter_) {
+    // Make sure that the frame is base_link
+    if (input_raw_msg->header.frame_id != base_link_frame_) {
+      if (!utils::transformPointcloud(*input_raw_msg, *tf2_, base_link_frame_, trans_input_raw)) {
+        return false;
+      }
+      is_raw_transformed = true;
+    }
+    occupancy_grid_map.setHeightLimit(min_height_, max_height_);
+  } else {
+    occupancy_grid_map.setHeightLimit(
+      -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity());
+  }
+  const PointCloud2 & input_raw_use = is_raw_transformed ? trans_input_raw : *input_raw_msg;
+
+  // Filter obstacle pointcloud by raw pointcloud
+  PointCloud2 input_obstacle_pc_common{};
+  bool use_input_obstacle_pc_common = false;
+  if (filter_obstacle_pointcloud_by_raw_pointcloud_) {
+    if (utils::extractCommonPointCloud(input_obstacle, input_raw_use, input_obstacle_pc_common)) {
+      use_input_obstacle_pc_common = true;
+    }
+  }
+
+  // Get from map to sensor frame pose, the scan origin being the frame of the raw pointcloud
+  Pose scan_origin{};
+  try {
+    scan_origin = utils::getPose(
+      input_raw_msg->header.stamp, *tf2_, input_raw_msg->header.frame_id, map_frame_);
+  } catch (tf2::TransformException & ex) {
+    RCLCPP_WARN_STREAM(get_logger(), ex.what());
+    return false;
+  }
+
+  // Create single frame occupancy grid map
+  occupancy_grid_map.resetMaps();
+  occupancy_grid_map.updateOrigin(
+    gridmap_origin.position.x - occupancy_grid_map.getSizeInMetersX() / 2,
+    gridmap_origin.position.y - occupancy_grid_map.getSizeInMetersY() / 2);
+  occupancy_grid_map.updateWithPointCloud(
+    input_raw_use, (use_input_obstacle_pc_common ? input_obstacle_pc_common : input_obstacle),
+    robot_pose, scan_origin);
+  return true;
+}
+
+OccupancyGrid::UniquePtr MultiLidarPointcloudBasedOccupancyGridMapNode::OccupancyGridMapToMsgPtr(
+  const std::string & frame_id, const Time & stamp, const float & robot_pose_z,
+  const Costmap2D & occupancy_grid_map)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  auto msg_ptr = std::make_unique<OccupancyGrid>();
+
+  msg_ptr->header.frame_id = frame_id;
+  msg_ptr->header.stamp = stamp;
+  msg_ptr->info.resolution = occupancy_grid_map.getResolution();
+
+  msg_ptr->info.width = occupancy_grid_map.getSizeInCellsX();
+  msg_ptr->info.height = occupancy_grid_map.getSizeInCellsY();
+
+  msg_ptr->info.origin.position.x = occupancy_grid_map.getOriginX();
+  msg_ptr->info.origin.position.y = occupancy_grid_map.getOriginY();
+  msg_ptr->info.origin.position.z = robot_pose_z;
+  msg_ptr->info.origin.orientation.w = 1.0;
+
+  msg_ptr->data.resize(msg_ptr->info.width * msg_ptr->info.height);
+
+  const unsigned char * data = occupancy_grid_map.getCharMap();
+  for (unsigned int i = 0; i < msg_ptr->data.size(); ++i) {
+    msg_ptr->data[i] = cost_value::cost_translation_table[data[i]];
+  }
+  return msg_ptr;
+}
+
+}  // namespace autoware::occupancy_grid_map
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(
+  autoware::occupancy_grid_map::MultiLidarPointcloudBasedOccupancyGridMapNode)
@@ -0,0 +1,130 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FUSION__MULTI_LIDAR_POINTCLOUD_BASED_OCCUPANCY_GRID_MAP_NODE_HPP_
+#define FUSION__MULTI_LIDAR_POINTCLOUD_BASED_OCCUPANCY_GRID_MAP_NODE_HPP_
+
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_base.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/fusion_policy/fusion_policy.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/updater/log_odds_bayes_filter_updater.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/updater/ogm_updater_interface.hpp"
+
+#include <autoware/universe_utils/ros/debug_publisher.hpp>
+#include <autoware/universe_utils/system/stop_watch.hpp>
+#include <autoware/universe_utils/system/time_keeper.hpp>
+#include <builtin_interfaces/msg/time.hpp>
+#include <nav2_costmap_2d/costmap_2d.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <nav_msgs/msg/occupancy_grid.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// cspell: ignore LOBF
+
+namespace autoware::occupancy_grid_map
+{
+using builtin_interfaces::msg::Time;
+using costmap_2d::OccupancyGridMapInterface;
+using costmap_2d::OccupancyGridMapUpdaterInterface;
+using geometry_msgs::msg::Pose;
+using nav2_costmap_2d::Costmap2D;
+using nav_msgs::msg::OccupancyGrid;
+using sensor_msgs::msg::PointCloud2;
+
+/**
+ * @brief build the grid map of every lidar and fuse them in a single node
+ *
+ * This gives the same map as a PointcloudBasedOccupancyGridMapNode in single frame mode for each
+ * lidar followed by GridMapFusionNode, but the grid maps of the lidars are built in parallel and
+ * fused in memory, so only the fused map is serialized.
+ */
+class MultiLidarPointcloudBasedOccupancyGridMapNode : public rclcpp::Node
+{
+public:
+  explicit MultiLidarPointcloudBasedOccupancyGridMapNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  void onObstaclePointcloud(const PointCloud2::ConstSharedPtr & input_obstacle_msg);
+  void onRawPointcloud(
+    const PointCloud2::ConstSharedPtr & input_raw_msg, const std::size_t sensor_index);
+  void onTimer();
+
+  /** @brief whether the obstacle pointcloud and the raw pointcloud of every lidar are received */
+  bool isFrameComplete() const;
+  /** @brief build, fuse and publish the grid maps of the lidars received for the frame */
+  void publish();
+  /** @brief build the single frame grid map of a lidar, returning false if it could not */
+  bool updateSensorGridMap(
+    const std::size_t sensor_index, const PointCloud2 & input_obstacle, const Pose & robot_pose,
+    const Pose & gridmap_origin);
+  OccupancyGrid::UniquePtr OccupancyGridMapToMsgPtr(
+    const std::string & frame_id, const Time & stamp, const float & robot_pose_z,
+    const Costmap2D & occupancy_grid_map);
+
+private:
+  rclcpp::Publisher<OccupancyGrid>::SharedPtr fused_map_pub_;
+  rclcpp::Publisher<OccupancyGrid>::SharedPtr single_frame_pub_;
+  rclcpp::Subscription<PointCloud2>::SharedPtr obstacle_pointcloud_sub_;
+  std::vector<rclcpp::Subscription<PointCloud2>::SharedPtr> raw_pointcloud_subs_;
+  std::unique_ptr<autoware::universe_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_{};
+  std::unique_ptr<autoware::universe_utils::DebugPublisher> debug_publisher_ptr_{};
+
+  std::shared_ptr<tf2_ros::Buffer> tf2_{std::make_shared<tf2_ros::Buffer>(get_clock())};
+  std::shared_ptr<tf2_ros::TransformListener> tf2_listener_{
+    std::make_shared<tf2_ros::TransformListener>(*tf2_)};
+
+  // Timer to publish the frame without the lidars which did not arrive in time
+  rclcpp::TimerBase::SharedPtr timer_;
+  double timeout_sec_{};
+
+  // pointclouds of the current frame, the raw pointclouds being indexed by lidar
+  std::mutex mutex_;
+  PointCloud2::ConstSharedPtr obstacle_pointcloud_;
+  std::vector<PointCloud2::ConstSharedPtr> raw_pointclouds_;
+
+  // single frame grid map of each lidar, the fused one and the multi frame one
+  std::vector<std::unique_ptr<OccupancyGridMapInterface>> occupancy_grid_map_ptrs_;
+  std::unique_ptr<Costmap2D> single_frame_map_ptr_;
+  std::unique_ptr<OccupancyGridMapUpdaterInterface> occupancy_grid_map_updater_ptr_;
+
+  // ROS Parameters
+  std::string map_frame_;
+  std::string base_link_frame_;
+  std::string gridmap_origin_frame_;
+  bool use_height_filter_;
+  double min_height_;
+  double max_height_;
+  bool filter_obstacle_pointcloud_by_raw_pointcloud_;
+  std::vector<double> input_ogm_reliabilities_;
+  fusion_policy::FusionMethod fusion_method_;
+  int num_threads_;
+
+  // time keeper
+  rclcpp::Publisher<autoware::universe_utils::ProcessingTimeDetail>::SharedPtr
+    detailed_processing_time_publisher_;
+  std::shared_ptr<autoware::universe_utils::TimeKeeper> time_keeper_;
+};
+
+}  // namespace autoware::occupancy_grid_map
+
+#endif  // FUSION__MULTI_LIDAR_POINTCLOUD_BASED_OCCUPANCY_GRID_MAP_NODE_HPP_
@@ -376,26 +376,16 @@ OccupancyGridMapFixedBlindSpot GridMapFusionNode::SingleFrameOccupancyFusion(
       gridmap_origin.position.y - fused_map.getSizeInMetersY() / 2);
 
     // fix origin of each map
+    std::vector<const unsigned char *> occupancies;
     for (auto & map : occupancy_grid_maps) {
       map.updateOrigin(fused_map.getOriginX(), fused_map.getOriginY());
+      occupancies.push_back(map.getCharMap());
     }
 
     // assume map is same size and resolutions
-    for (unsigned int x = 0; x < fused_map.getSizeInCellsX(); x++) {
-      for (unsigned int y = 0; y < fused_map.getSizeInCellsY(); y++) {
-        // get cost of each map
-        std::vector<unsigned char> costs;
-        for (auto & map : occupancy_grid_maps) {
-          costs.push_back(map.getCost(x, y));
-        }
-
-        // set fusion policy
-        auto fused_cost = fusion_policy::singleFrameOccupancyFusion(costs, fusion_method_, weights);
-
-        // set max cost to fused map
-        fused_map.setCost(x, y, fused_cost);
-      }
-    }
+    fusion_policy::singleFrameOccupancyFusion(
+      occupancies, fused_map.getSizeInCellsX() * fused_map.getSizeInCellsY(), fusion_method_,
+      weights, fused_map.getCharMap());
 
     return fused_map;
   }  // scope for time keeper ends
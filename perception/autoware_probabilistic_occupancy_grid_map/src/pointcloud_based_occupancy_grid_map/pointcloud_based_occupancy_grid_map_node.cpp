@@ -69,6 +69,7 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
     this->declare_parameter<bool>("filter_obstacle_pointcloud_by_raw_pointcloud");
   const double map_length = this->declare_parameter<double>("map_length");
   const double map_resolution = this->declare_parameter<double>("map_resolution");
+  const bool use_gpu = this->declare_parameter<bool>("use_gpu");
 
   /* Subscriber and publisher */
   obstacle_pointcloud_sub_.subscribe(
@@ -119,6 +120,14 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
   }
   occupancy_grid_map_ptr_->initRosParam(*this);
 
+  if (use_gpu) {
+    const bool is_grid_map_on_gpu = occupancy_grid_map_ptr_->enableGpu();
+    const bool is_updater_on_gpu = occupancy_grid_map_updater_ptr_->enableGpu();
+    if (!is_grid_map_on_gpu || !is_updater_on_gpu) {
+      RCLCPP_WARN(get_logger(), "Built without CUDA, updating the grid map on the CPU instead");
+    }
+  }
+
   // initialize debug tool
   {
     using autoware::universe_utils::DebugPublisher;
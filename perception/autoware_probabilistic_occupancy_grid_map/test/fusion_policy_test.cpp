@@ -75,3 +75,36 @@ TEST(FusionPolicyTest, TestDempsterShaferUpdateRule)
   std::vector<double> case3_1 = {OCCUPIED, FREE};
   EXPECT_NEAR(dempsterShaferFusion(case3_1), UNKNOWN, EPSILON);
 }
+
+// Test that fusing whole maps gives the same cells as fusing each cell
+TEST(FusionPolicyTest, TestWholeMapFusionSameAsEachCell)
+{
+  using autoware::occupancy_grid_map::fusion_policy::FusionMethod;
+  using autoware::occupancy_grid_map::fusion_policy::singleFrameOccupancyFusion;
+
+  // every pair of the char values, and a third map with a sweep of values
+  constexpr std::size_t num_cells = 256 * 256;
+  std::vector<unsigned char> map1(num_cells), map2(num_cells), map3(num_cells);
+  for (std::size_t i = 0; i < num_cells; ++i) {
+    map1[i] = static_cast<unsigned char>(i % 256);
+    map2[i] = static_cast<unsigned char>(i / 256);
+    map3[i] = static_cast<unsigned char>((i * 7) % 256);
+  }
+  const std::vector<const unsigned char *> occupancies = {map1.data(), map2.data(), map3.data()};
+  const std::vector<std::vector<double>> reliabilities = {{1.0, 0.6, 0.6}, {}};
+
+  for (const auto method :
+       {FusionMethod::OVERWRITE, FusionMethod::LOG_ODDS, FusionMethod::DEMPSTER_SHAFER}) {
+    for (const auto & reliability : reliabilities) {
+      std::vector<unsigned char> fused(num_cells);
+      singleFrameOccupancyFusion(occupancies, num_cells, method, reliability, fused.data());
+      for (std::size_t i = 0; i < num_cells; ++i) {
+        const std::vector<unsigned char> costs = {map1[i], map2[i], map3[i]};
+        const unsigned char expected = reliability.empty()
+                                         ? singleFrameOccupancyFusion(costs, method)
+                                         : singleFrameOccupancyFusion(costs, method, reliability);
+        ASSERT_EQ(fused[i], expected) << "cell " << i;
+      }
+    }
+  }
+}
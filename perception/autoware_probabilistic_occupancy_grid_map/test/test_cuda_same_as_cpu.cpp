@@ -0,0 +1,200 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_fixed.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_projective.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/updater/binary_bayes_filter_updater.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+#include <tf2/LinearMath/Quaternion.h>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapBBFUpdater;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapFixedBlindSpot;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapProjectiveBlindSpot;
+using geometry_msgs::msg::Pose;
+using sensor_msgs::msg::PointCloud2;
+
+namespace
+{
+constexpr unsigned int map_cells = 300;
+constexpr float map_resolution = 0.5f;
+
+PointCloud2 createRandomPointCloud(
+  std::mt19937 & generator, const size_t num_points, const float min_z, const float max_z)
+{
+  PointCloud2 cloud;
+  cloud.header.frame_id = "base_link";
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(num_points);
+
+  std::uniform_real_distribution<float> xy_distribution(-60.0f, 60.0f);
+  std::uniform_real_distribution<float> z_distribution(min_z, max_z);
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+  for (size_t i = 0; i < num_points; ++i, ++iter_x, ++iter_y, ++iter_z) {
+    // a third of the points near the vehicle, so that the bins have several points
+    const float scale = i % 3 == 0 ? 0.2f : 1.0f;
+    *iter_x = xy_distribution(generator) * scale;
+    *iter_y = xy_distribution(generator) * scale;
+    *iter_z = z_distribution(generator);
+  }
+  return cloud;
+}
+
+Pose createPose(const double x, const double y, const double z, const double yaw)
+{
+  Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.position.z = z;
+  tf2::Quaternion quaternion;
+  quaternion.setRPY(0.0, 0.0, yaw);
+  pose.orientation.x = quaternion.x();
+  pose.orientation.y = quaternion.y();
+  pose.orientation.z = quaternion.z();
+  pose.orientation.w = quaternion.w();
+  return pose;
+}
+
+size_t countDifferentCells(
+  const nav2_costmap_2d::Costmap2D & map_a, const nav2_costmap_2d::Costmap2D & map_b)
+{
+  const size_t num_cells = map_a.getSizeInCellsX() * map_a.getSizeInCellsY();
+  size_t num_different_cells = 0;
+  for (size_t i = 0; i < num_cells; ++i) {
+    num_different_cells += map_a.getCharMap()[i] != map_b.getCharMap()[i];
+  }
+  return num_different_cells;
+}
+}  // namespace
+
+class CudaSameAsCpuTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    generator_.seed(0);
+    raw_pointcloud_ = createRandomPointCloud(generator_, 20000, -1.5f, 2.5f);
+    // the obstacle points are partly raw points
+    obstacle_pointcloud_ = createRandomPointCloud(generator_, 6000, -0.5f, 2.5f);
+    const size_t num_copied_points = 3000;
+    for (size_t i = 0; i < num_copied_points; ++i) {
+      std::copy_n(
+        raw_pointcloud_.data.begin() + i * 5 * raw_pointcloud_.point_step,
+        raw_pointcloud_.point_step,
+        obstacle_pointcloud_.data.begin() + i * obstacle_pointcloud_.point_step);
+    }
+  }
+
+  void TearDown() override { rclcpp::shutdown(); }
+
+  static std::shared_ptr<rclcpp::Node> createNode(const std::string & name)
+  {
+    rclcpp::NodeOptions options;
+    options.parameter_overrides({
+      {"OccupancyGridMapFixedBlindSpot.distance_margin", 1.0},
+      {"OccupancyGridMapProjectiveBlindSpot.projection_dz_threshold", 0.01},
+      {"OccupancyGridMapProjectiveBlindSpot.obstacle_separation_threshold", 1.0},
+      {"OccupancyGridMapProjectiveBlindSpot.pub_debug_grid", false},
+      {"probability_matrix.occupied_to_occupied", 0.95},
+      {"probability_matrix.occupied_to_free", 0.05},
+      {"probability_matrix.free_to_occupied", 0.2},
+      {"probability_matrix.free_to_free", 0.8},
+      {"v_ratio", 0.1},
+    });
+    return std::make_shared<rclcpp::Node>(name, options);
+  }
+
+  template <typename GridMapT>
+  void updateMap(GridMapT & map, const double yaw) const
+  {
+    map.updateOrigin(-70.0 + yaw * 4.0, -80.0);
+    map.updateWithPointCloud(
+      raw_pointcloud_, obstacle_pointcloud_, createPose(3.0, -2.0, 0.3, yaw),
+      createPose(4.0, -2.5, 2.0, yaw + 0.1));
+  }
+
+  template <typename GridMapT>
+  void expectSameAsCpu()
+  {
+    const auto cpu_node = createNode("cpu_grid_map");
+    const auto gpu_node = createNode("gpu_grid_map");
+    GridMapT cpu_map(map_cells, map_cells, map_resolution);
+    GridMapT gpu_map(map_cells, map_cells, map_resolution);
+    cpu_map.initRosParam(*cpu_node);
+    gpu_map.initRosParam(*gpu_node);
+    ASSERT_TRUE(gpu_map.enableGpu());
+
+    for (const double yaw : {0.0, 0.7, -2.5}) {
+      cpu_map.resetMaps();
+      gpu_map.resetMaps();
+      updateMap(cpu_map, yaw);
+      updateMap(gpu_map, yaw);
+      // the angle of a point on a bin boundary may round to the other bin on the device
+      EXPECT_LE(countDifferentCells(cpu_map, gpu_map), map_cells * map_cells / 1000);
+    }
+  }
+
+  std::mt19937 generator_;
+  PointCloud2 raw_pointcloud_;
+  PointCloud2 obstacle_pointcloud_;
+};
+
+TEST_F(CudaSameAsCpuTest, FixedBlindSpot)
+{
+  expectSameAsCpu<OccupancyGridMapFixedBlindSpot>();
+}
+
+TEST_F(CudaSameAsCpuTest, ProjectiveBlindSpot)
+{
+  expectSameAsCpu<OccupancyGridMapProjectiveBlindSpot>();
+}
+
+TEST_F(CudaSameAsCpuTest, BinaryBayesFilter)
+{
+  const auto node = createNode("grid_map");
+  OccupancyGridMapFixedBlindSpot single_frame_map(map_cells, map_cells, map_resolution);
+  single_frame_map.initRosParam(*node);
+  const auto cpu_node = createNode("cpu_updater");
+  const auto gpu_node = createNode("gpu_updater");
+  OccupancyGridMapBBFUpdater cpu_updater(map_cells, map_cells, map_resolution);
+  OccupancyGridMapBBFUpdater gpu_updater(map_cells, map_cells, map_resolution);
+  cpu_updater.initRosParam(*cpu_node);
+  gpu_updater.initRosParam(*gpu_node);
+  ASSERT_TRUE(gpu_updater.enableGpu());
+
+  // the filter is updated over several frames, the map moving between them
+  for (const double yaw : {0.0, 0.7, -2.5}) {
+    single_frame_map.resetMaps();
+    updateMap(single_frame_map, yaw);
+    cpu_updater.update(single_frame_map);
+    gpu_updater.update(single_frame_map);
+    EXPECT_EQ(countDifferentCells(cpu_updater, gpu_updater), 0U);
+  }
+}
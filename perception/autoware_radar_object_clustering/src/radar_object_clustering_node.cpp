@@ -28,8 +28,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -57,6 +61,17 @@ double get_distance(const autoware_perception_msgs::msg::DetectedObject & object
   return std::hypot(position.x, position.y);
 }
 
+int64_t getCellKey(
+  const double x, const double y, const double cell_size, const int64_t dx, const int64_t dy)
+{
+  constexpr double limit = static_cast<double>(std::numeric_limits<int32_t>::max() - 1);
+  const int64_t cell_x = static_cast<int64_t>(std::clamp(std::floor(x / cell_size), -limit, limit));
+  const int64_t cell_y = static_cast<int64_t>(std::clamp(std::floor(y / cell_size), -limit, limit));
+  return static_cast<int64_t>(
+    (static_cast<uint64_t>(cell_x + dx) << 32) |
+    (static_cast<uint64_t>(cell_y + dy) & 0xFFFFFFFFu));
+}
+
 }  // namespace
 
 namespace autoware::radar_object_clustering
@@ -103,60 +118,64 @@ void RadarObjectClusteringNode::onObjects(const DetectedObjects::ConstSharedPtr
     return get_distance(lhs) < get_distance(rhs);
   };
   std::sort(objects.begin(), objects.end(), func);
+  buildGrid(objects);
 
   for (size_t i = 0; i < objects.size(); i++) {
     if (used_flags.at(i) == true) {
       continue;
     }
 
-    std::vector<DetectedObject> clustered_objects;
+    // the objects before i are all used, so the cluster is in the same order as the sorted objects
+    cluster_indices_.clear();
     used_flags.at(i) = true;
-    clustered_objects.emplace_back(objects.at(i));
+    cluster_indices_.push_back(i);
 
-    for (size_t j = i; j < objects.size(); ++j) {
+    getNeighborCandidates(objects.at(i), candidates_);
+    std::sort(candidates_.begin(), candidates_.end());
+    for (const size_t j : candidates_) {
       if (used_flags.at(j) == false && isSameObject(objects.at(i), objects.at(j))) {
         used_flags.at(j) = true;
-        clustered_objects.emplace_back(objects.at(j));
+        cluster_indices_.push_back(j);
       }
     }
 
     // clustering
     DetectedObject clustered_output_object;
-    if (clustered_objects.size() == 1) {
-      clustered_output_object = clustered_objects.at(0);
+    if (cluster_indices_.size() == 1) {
+      clustered_output_object = objects.at(i);
     } else {
-      auto func_max_confidence = [](const DetectedObject & a, const DetectedObject & b) {
-        return a.existence_probability < b.existence_probability;
+      auto func_max_confidence = [&objects](const size_t a, const size_t b) {
+        return objects.at(a).existence_probability < objects.at(b).existence_probability;
       };
-      auto iter = std::max_element(
-        std::begin(clustered_objects), std::end(clustered_objects), func_max_confidence);
+      const auto & max_confidence_object = objects.at(*std::max_element(
+        std::begin(cluster_indices_), std::end(cluster_indices_), func_max_confidence));
 
       // class label
-      clustered_output_object.existence_probability = iter->existence_probability;
-      clustered_output_object.classification = iter->classification;
+      clustered_output_object.existence_probability = max_confidence_object.existence_probability;
+      clustered_output_object.classification = max_confidence_object.classification;
 
       // kinematics
-      clustered_output_object.kinematics = iter->kinematics;
+      clustered_output_object.kinematics = max_confidence_object.kinematics;
 
       auto & pose = clustered_output_object.kinematics.pose_with_covariance.pose;
-      auto func_sum_x = [](const double & a, const DetectedObject & b) {
-        return a + b.kinematics.pose_with_covariance.pose.position.x;
+      auto func_sum_x = [&objects](const double & a, const size_t b) {
+        return a + objects.at(b).kinematics.pose_with_covariance.pose.position.x;
       };
       pose.position.x =
         std::accumulate(
-          std::begin(clustered_objects), std::end(clustered_objects), 0.0, func_sum_x) /
-        clustered_objects.size();
-      auto func_sum_y = [](const double & a, const DetectedObject & b) {
-        return a + b.kinematics.pose_with_covariance.pose.position.y;
+          std::begin(cluster_indices_), std::end(cluster_indices_), 0.0, func_sum_x) /
+        cluster_indices_.size();
+      auto func_sum_y = [&objects](const double & a, const size_t b) {
+        return a + objects.at(b).kinematics.pose_with_covariance.pose.position.y;
       };
       pose.position.y =
         std::accumulate(
-          std::begin(clustered_objects), std::end(clustered_objects), 0.0, func_sum_y) /
-        clustered_objects.size();
-      pose.position.z = iter->kinematics.pose_with_covariance.pose.position.z;
+          std::begin(cluster_indices_), std::end(cluster_indices_), 0.0, func_sum_y) /
+        cluster_indices_.size();
+      pose.position.z = max_confidence_object.kinematics.pose_with_covariance.pose.position.z;
 
       // Shape
-      clustered_output_object.shape = iter->shape;
+      clustered_output_object.shape = max_confidence_object.shape;
     }
 
     // Fixed label correction
@@ -199,6 +218,54 @@ bool RadarObjectClusteringNode::isSameObject(
   }
 }
 
+void RadarObjectClusteringNode::buildGrid(const std::vector<DetectedObject> & objects)
+{
+  // the objects farther than distance_threshold are never the same object, so the candidates of
+  // an object are in the 3x3 cells around it
+  grid_cell_size_ = node_param_.distance_threshold;
+  grid_num_objects_ = objects.size();
+  grid_cells_.clear();
+  if (!(0.0 < grid_cell_size_ && std::isfinite(grid_cell_size_))) {
+    return;
+  }
+  for (size_t i = 0; i < objects.size(); ++i) {
+    const auto & position = objects.at(i).kinematics.pose_with_covariance.pose.position;
+    // the distance to a non-finite position is never within the threshold
+    if (std::isfinite(position.x) && std::isfinite(position.y)) {
+      grid_cells_.emplace_back(getCellKey(position.x, position.y, grid_cell_size_, 0, 0), i);
+    }
+  }
+  std::sort(grid_cells_.begin(), grid_cells_.end());
+}
+
+void RadarObjectClusteringNode::getNeighborCandidates(
+  const DetectedObject & object, std::vector<size_t> & candidates) const
+{
+  candidates.clear();
+  const auto & position = object.kinematics.pose_with_covariance.pose.position;
+  if (!(0.0 < grid_cell_size_ && std::isfinite(grid_cell_size_))) {
+    // no object is within a non-positive distance, and every object is within an infinite one
+    if (std::isinf(grid_cell_size_)) {
+      candidates.resize(grid_num_objects_);
+      std::iota(candidates.begin(), candidates.end(), 0);
+    }
+    return;
+  }
+  if (!std::isfinite(position.x) || !std::isfinite(position.y)) {
+    return;
+  }
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      const int64_t key = getCellKey(position.x, position.y, grid_cell_size_, dx, dy);
+      auto itr =
+        std::lower_bound(grid_cells_.begin(), grid_cells_.end(), std::make_pair(key, size_t{0}));
+      for (; itr != grid_cells_.end() && itr->first == key; ++itr) {
+        candidates.push_back(itr->second);
+      }
+    }
+  }
+}
+
 rcl_interfaces::msg::SetParametersResult RadarObjectClusteringNode::onSetParam(
   const std::vector<rclcpp::Parameter> & params)
 {
@@ -20,8 +20,10 @@
 #include "autoware_perception_msgs/msg/detected_objects.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::radar_object_clustering
@@ -67,6 +69,15 @@ private:
 
   // Core
   bool isSameObject(const DetectedObject & object_1, const DetectedObject & object_2);
+
+  // Uniform grid of the object positions for the neighbor search, kept to reuse the memory
+  void buildGrid(const std::vector<DetectedObject> & objects);
+  void getNeighborCandidates(const DetectedObject & object, std::vector<size_t> & candidates) const;
+  double grid_cell_size_{};
+  size_t grid_num_objects_{};
+  std::vector<std::pair<int64_t, size_t>> grid_cells_{};
+  std::vector<size_t> candidates_{};
+  std::vector<size_t> cluster_indices_{};
 };
 
 }  // namespace autoware::radar_object_clustering
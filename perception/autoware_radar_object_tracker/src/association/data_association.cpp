@@ -19,10 +19,15 @@
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
+#include <limits>
 #include <list>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace
@@ -67,6 +72,70 @@ double getFormedYawAngle(
   }
   return std::fabs(measurement_fixed_yaw - tracker_yaw);
 }
+
+/**
+ * @brief uniform grid over the measurement positions to find the measurements within a distance
+ * of a tracker without comparing every pair
+ */
+class MeasurementGrid
+{
+public:
+  MeasurementGrid(
+    const autoware_perception_msgs::msg::DetectedObjects & measurements, const double cell_size)
+  : cell_size_(cell_size)
+  {
+    cells_.reserve(measurements.objects.size());
+    for (size_t i = 0; i < measurements.objects.size(); ++i) {
+      const auto & position =
+        measurements.objects.at(i).kinematics.pose_with_covariance.pose.position;
+      if (std::isfinite(position.x) && std::isfinite(position.y)) {
+        cells_.emplace_back(getCellKey(toCellIndex(position.x), toCellIndex(position.y)), i);
+      } else {
+        // the distance gate does not reject NaN, so they are candidates of every tracker
+        non_finite_measurements_.push_back(i);
+      }
+    }
+    std::sort(cells_.begin(), cells_.end());
+  }
+
+  /** @brief indices of the measurements that can be within the distance from the position */
+  void getCandidates(
+    const geometry_msgs::msg::Point & position, const double distance,
+    std::vector<size_t> & candidates) const
+  {
+    candidates.assign(non_finite_measurements_.begin(), non_finite_measurements_.end());
+    const int64_t min_x = toCellIndex(position.x - distance);
+    const int64_t max_x = toCellIndex(position.x + distance);
+    const int64_t min_y = toCellIndex(position.y - distance);
+    const int64_t max_y = toCellIndex(position.y + distance);
+    for (int64_t x = min_x; x <= max_x; ++x) {
+      for (int64_t y = min_y; y <= max_y; ++y) {
+        const int64_t key = getCellKey(x, y);
+        auto itr = std::lower_bound(cells_.begin(), cells_.end(), std::make_pair(key, size_t{0}));
+        for (; itr != cells_.end() && itr->first == key; ++itr) {
+          candidates.push_back(itr->second);
+        }
+      }
+    }
+  }
+
+private:
+  int64_t toCellIndex(const double value) const
+  {
+    constexpr double limit = static_cast<double>(std::numeric_limits<int32_t>::max());
+    return static_cast<int64_t>(std::clamp(std::floor(value / cell_size_), -limit, limit));
+  }
+
+  static int64_t getCellKey(const int64_t x, const int64_t y)
+  {
+    return static_cast<int64_t>(
+      (static_cast<uint64_t>(x) << 32) | (static_cast<uint64_t>(y) & 0xFFFFFFFFu));
+  }
+
+  double cell_size_;
+  std::vector<std::pair<int64_t, size_t>> cells_;
+  std::vector<size_t> non_finite_measurements_;
+};
 }  // namespace
 
 namespace autoware::radar_object_tracker
@@ -166,13 +235,46 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 
   Eigen::MatrixXd score_matrix =
     Eigen::MatrixXd::Zero(trackers.size(), measurements.objects.size());
+
+  // The pairs farther than max_dist never pass the dist gate and keep the score 0, so only the
+  // measurements around each tracker are evaluated. Every pair is evaluated to log all of them.
+  double max_dist_of_all_labels = 0.0;
+  for (int i = 0; i < max_dist_matrix_.rows(); ++i) {
+    for (int j = 0; j < max_dist_matrix_.cols(); ++j) {
+      if (can_assign_matrix_(i, j)) {
+        max_dist_of_all_labels = std::max(max_dist_of_all_labels, max_dist_matrix_(i, j));
+      }
+    }
+  }
+  const bool use_measurement_grid =
+    !debug_log && 0.0 < max_dist_of_all_labels && std::isfinite(max_dist_of_all_labels);
+  const MeasurementGrid measurement_grid(
+    measurements, use_measurement_grid ? max_dist_of_all_labels : 1.0);
+  std::vector<size_t> measurement_indices;
+
   size_t tracker_idx = 0;
   for (auto tracker_itr = trackers.begin(); tracker_itr != trackers.end();
        ++tracker_itr, ++tracker_idx) {
     const std::uint8_t tracker_label = (*tracker_itr)->getHighestProbLabel();
+    autoware_perception_msgs::msg::TrackedObject tracked_object;
+    (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
 
-    for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
-         ++measurement_idx) {
+    if (use_measurement_grid) {
+      double tracker_max_dist = 0.0;
+      for (int j = 0; j < max_dist_matrix_.cols(); ++j) {
+        if (can_assign_matrix_(tracker_label, j)) {
+          tracker_max_dist = std::max(tracker_max_dist, max_dist_matrix_(tracker_label, j));
+        }
+      }
+      measurement_grid.getCandidates(
+        tracked_object.kinematics.pose_with_covariance.pose.position, tracker_max_dist,
+        measurement_indices);
+    } else {
+      measurement_indices.resize(measurements.objects.size());
+      std::iota(measurement_indices.begin(), measurement_indices.end(), 0);
+    }
+
+    for (const size_t measurement_idx : measurement_indices) {
       const autoware_perception_msgs::msg::DetectedObject & measurement_object =
         measurements.objects.at(measurement_idx);
       const std::uint8_t measurement_label =
@@ -180,9 +282,6 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
       // Create a JSON object to hold the log data for this pair
       nlohmann::json pair_log_data;
 
-      autoware_perception_msgs::msg::TrackedObject tracked_object;
-      (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
-
       std::vector<double> tracker_pose = {
         tracked_object.kinematics.pose_with_covariance.pose.position.x,
         tracked_object.kinematics.pose_with_covariance.pose.position.y};
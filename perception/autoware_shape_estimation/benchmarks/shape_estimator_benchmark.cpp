@@ -0,0 +1,128 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/shape_estimation/shape_estimator.hpp"
+
+#include <autoware_perception_msgs/msg/object_classification.hpp>
+
+#include <benchmark/benchmark.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using autoware::shape_estimation::ShapeEstimationInput;
+using autoware::shape_estimation::ShapeEstimationOutput;
+using autoware::shape_estimation::ShapeEstimator;
+using autoware_perception_msgs::msg::ObjectClassification;
+
+namespace
+{
+// clusters of a fixed seed of the cars, whose two sides facing the sensor at the origin are seen
+// as an L shape
+std::vector<ShapeEstimationInput> createInputs(const size_t num_clusters)
+{
+  constexpr double length = 4.5;
+  constexpr double width = 1.8;
+  constexpr size_t num_points_per_side = 150;
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> range_distribution(5.0, 60.0);
+  std::uniform_real_distribution<double> angle_distribution(-M_PI, M_PI);
+  std::uniform_real_distribution<double> unit_distribution(0.0, 1.0);
+  std::normal_distribution<double> noise_distribution(0.0, 0.03);
+
+  std::vector<ShapeEstimationInput> inputs;
+  inputs.reserve(num_clusters);
+  for (size_t i = 0; i < num_clusters; ++i) {
+    const double range = range_distribution(generator);
+    const double azimuth = angle_distribution(generator);
+    const double yaw = angle_distribution(generator);
+    const double center_x = range * std::cos(azimuth);
+    const double center_y = range * std::sin(azimuth);
+
+    // the corner nearest to the sensor, and the sides along the length and the width from it
+    const double sign_x = std::cos(azimuth - yaw) > 0.0 ? -1.0 : 1.0;
+    const double sign_y = std::sin(azimuth - yaw) > 0.0 ? -1.0 : 1.0;
+    auto cluster = std::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+    const auto add_point = [&](const double local_x, const double local_y) {
+      const double x = local_x + noise_distribution(generator);
+      const double y = local_y + noise_distribution(generator);
+      cluster->emplace_back(
+        static_cast<float>(center_x + x * std::cos(yaw) - y * std::sin(yaw)),
+        static_cast<float>(center_y + x * std::sin(yaw) + y * std::cos(yaw)),
+        static_cast<float>(1.5 * unit_distribution(generator)));
+    };
+    for (size_t j = 0; j < num_points_per_side; ++j) {
+      add_point(length * (unit_distribution(generator) - 0.5), sign_y * width / 2.0);
+      add_point(sign_x * length / 2.0, width * (unit_distribution(generator) - 0.5));
+    }
+
+    ShapeEstimationInput input;
+    input.label = ObjectClassification::CAR;
+    input.cluster = cluster;
+    inputs.push_back(input);
+  }
+  return inputs;
+}
+
+void BM_EstimateShapeAndPose(benchmark::State & state, const bool use_boost_bbox_optimizer)
+{
+  const auto inputs = createInputs(state.range(0));
+  ShapeEstimator estimator(true, true, use_boost_bbox_optimizer);
+  ShapeEstimationOutput output;
+  for (auto _ : state) {
+    for (const auto & input : inputs) {
+      output.success = estimator.estimateShapeAndPose(
+        input.label, *input.cluster, input.ref_yaw_info, input.ref_shape_size_info,
+        input.ref_pose, output.shape, output.pose);
+      benchmark::DoNotOptimize(output);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+void BM_EstimateShapesAndPoses(benchmark::State & state, const bool use_boost_bbox_optimizer)
+{
+  const auto inputs = createInputs(state.range(0));
+  ShapeEstimator estimator(true, true, use_boost_bbox_optimizer);
+  std::vector<ShapeEstimationOutput> outputs;
+  for (auto _ : state) {
+    estimator.estimateShapesAndPoses(inputs, outputs);
+    benchmark::DoNotOptimize(outputs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+}  // namespace
+
+// the clusters one by one as before the batch estimation, and in a batch
+BENCHMARK_CAPTURE(BM_EstimateShapeAndPose, search, false)
+  ->Arg(16)
+  ->Arg(64)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EstimateShapeAndPose, boost_optimizer, true)
+  ->Arg(16)
+  ->Arg(64)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EstimateShapesAndPoses, search, false)
+  ->Arg(16)
+  ->Arg(64)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EstimateShapesAndPoses, boost_optimizer, true)
+  ->Arg(16)
+  ->Arg(64)
+  ->Unit(benchmark::kMillisecond);
@@ -26,6 +26,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <string>
+#include <vector>
 
 namespace autoware::shape_estimation
 {
@@ -48,6 +49,22 @@ struct ReferenceShapeSizeInfo
   Mode mode;
 };
 
+struct ShapeEstimationInput
+{
+  uint8_t label;
+  pcl::PointCloud<pcl::PointXYZ>::ConstPtr cluster;
+  boost::optional<ReferenceYawInfo> ref_yaw_info;
+  boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info;
+  boost::optional<geometry_msgs::msg::Pose> ref_pose;
+};
+
+struct ShapeEstimationOutput
+{
+  bool success;
+  autoware_perception_msgs::msg::Shape shape;
+  geometry_msgs::msg::Pose pose;
+};
+
 class ShapeEstimator
 {
 private:
@@ -79,6 +96,13 @@ public:
     const boost::optional<ReferenceShapeSizeInfo> & ref_shape_size_info,
     const boost::optional<geometry_msgs::msg::Pose> & ref_pose,
     autoware_perception_msgs::msg::Shape & shape_output, geometry_msgs::msg::Pose & pose_output);
+
+  /**
+   * @brief estimate the shapes and poses of a batch of clusters, in parallel when built with
+   * OpenMP. The outputs are the same as of estimateShapeAndPose for each input, in the same order.
+   */
+  void estimateShapesAndPoses(
+    const std::vector<ShapeEstimationInput> & inputs, std::vector<ShapeEstimationOutput> & outputs);
 };
 }  // namespace autoware::shape_estimation
 
@@ -176,56 +176,60 @@ float BoundingBoxShapeModel::calcClosenessCriterion(
   const float min_c_2 = *std::min_element(C_2.begin(), C_2.end());  // col.3, Algo.4
   const float max_c_2 = *std::max_element(C_2.begin(), C_2.end());  // col.3, Algo.4
 
-  std::vector<float> D_1;  // col.4, Algo.4
-  for (const auto & c_1_element : C_1) {
-    const float v = std::min(max_c_1 - c_1_element, c_1_element - min_c_1);
-    D_1.push_back(v * v);
-  }
-
-  std::vector<float> D_2;  // col.5, Algo.4
-  for (const auto & c_2_element : C_2) {
-    const float v = std::min(max_c_2 - c_2_element, c_2_element - min_c_2);
-    D_2.push_back(v * v);
-  }
   constexpr float d_min = 0.1 * 0.1;
   constexpr float d_max = 0.4 * 0.4;
   float beta = 0;  // col.6, Algo.4
-  for (size_t i = 0; i < D_1.size(); ++i) {
-    if (d_max < std::min(D_1.at(i), D_2.at(i))) {
+  for (size_t i = 0; i < C_1.size(); ++i) {
+    const float v_1 = std::min(max_c_1 - C_1[i], C_1[i] - min_c_1);
+    const float v_2 = std::min(max_c_2 - C_2[i], C_2[i] - min_c_2);
+    const float d_1 = v_1 * v_1;  // col.4, Algo.4
+    const float d_2 = v_2 * v_2;  // col.5, Algo.4
+    if (d_max < std::min(d_1, d_2)) {
       continue;
     }
-    const float d = std::max(std::min(D_1.at(i), D_2.at(i)), d_min);
+    const float d = std::max(std::min(d_1, d_2), d_min);
     beta += 1.0 / d;
   }
   return beta;
 }
 
+float BoundingBoxShapeModel::calcClosenessCriterion(
+  const std::vector<float> & x, const std::vector<float> & y, const float theta,
+  std::vector<float> & C_1, std::vector<float> & C_2)
+{
+  const float cos_theta = std::cos(theta);
+  const float sin_theta = std::sin(theta);
+  // col.3 - col.6, Algo.2, into buffers reused over the angles
+  C_1.resize(x.size());
+  C_2.resize(x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    C_1[i] = x[i] * cos_theta + y[i] * sin_theta;
+    C_2[i] = x[i] * -sin_theta + y[i] * cos_theta;
+  }
+  return calcClosenessCriterion(C_1, C_2);
+}
+
 float BoundingBoxShapeModel::optimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
-  std::vector<std::pair<float /*theta*/, float /*q*/>> Q;
-  constexpr float angle_resolution = M_PI / 180.0;
-  for (float theta = min_angle; theta <= max_angle + epsilon; theta += angle_resolution) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);  // col.7, Algo.2
-    Q.push_back(std::make_pair(theta, q));       // col.8, Algo.2
+  std::vector<float> x, y, C_1, C_2;
+  x.reserve(cluster.size());
+  y.reserve(cluster.size());
+  for (const auto & point : cluster) {
+    x.push_back(point.x);
+    y.push_back(point.y);
   }
 
+  constexpr float angle_resolution = M_PI / 180.0;
   float theta_star{0.0};  // col.10, Algo.2
   float max_q = 0.0;
-  for (size_t i = 0; i < Q.size(); ++i) {
-    if (max_q < Q.at(i).second || i == 0) {
-      max_q = Q.at(i).second;
-      theta_star = Q.at(i).first;
+  bool is_first = true;
+  for (float theta = min_angle; theta <= max_angle + epsilon; theta += angle_resolution) {
+    const float q = calcClosenessCriterion(x, y, theta, C_1, C_2);  // col.7, Algo.2
+    if (max_q < q || is_first) {
+      max_q = q;
+      theta_star = theta;
+      is_first = false;
     }
   }
 
@@ -235,19 +239,15 @@ float BoundingBoxShapeModel::optimize(
 float BoundingBoxShapeModel::boostOptimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
+  std::vector<float> x, y, C_1, C_2;
+  x.reserve(cluster.size());
+  y.reserve(cluster.size());
+  for (const auto & point : cluster) {
+    x.push_back(point.x);
+    y.push_back(point.y);
+  }
   auto closeness_func = [&](float theta) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);
-    return -q;
+    return -calcClosenessCriterion(x, y, theta, C_1, C_2);
   };
 
   int bits = 6;
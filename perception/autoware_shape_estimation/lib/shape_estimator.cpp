@@ -73,6 +73,21 @@ bool ShapeEstimator::estimateShapeAndPose(
   return true;
 }
 
+void ShapeEstimator::estimateShapesAndPoses(
+  const std::vector<ShapeEstimationInput> & inputs, std::vector<ShapeEstimationOutput> & outputs)
+{
+  outputs.resize(inputs.size());
+  // the models, filters and correctors are created per cluster, so the clusters are independent
+#pragma omp parallel for schedule(dynamic)
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const auto & input = inputs[i];
+    auto & output = outputs[i];
+    output.success = estimateShapeAndPose(
+      input.label, *input.cluster, input.ref_yaw_info, input.ref_shape_size_info, input.ref_pose,
+      output.shape, output.pose);
+  }
+}
+
 bool ShapeEstimator::estimateOriginalShapeAndPose(
   const uint8_t label, const pcl::PointCloud<pcl::PointXYZ> & cluster,
   const boost::optional<ReferenceYawInfo> & ref_yaw_info,
@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::shape_estimation
 {
@@ -114,8 +115,12 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
   // Create ml model input batch
   DetectedObjectsWithFeature input_trt_batch;
 
-  // Estimate shape for each object and pack msg
-  for (const auto & feature_object : input_msg->feature_objects) {
+  // Create shape estimation input batch, with the indices of the input objects
+  std::vector<ShapeEstimationInput> estimator_inputs;
+  std::vector<size_t> estimator_input_indices;
+
+  for (size_t i = 0; i < input_msg->feature_objects.size(); ++i) {
+    const auto & feature_object = input_msg->feature_objects[i];
     const auto & object = feature_object.object;
     const auto label = get_label(object.classification);
     const auto is_vehicle = label_is_vehicle(label);
@@ -137,28 +142,32 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
     }
 #endif
 
-    // estimate shape and pose
-    autoware_perception_msgs::msg::Shape shape;
-    geometry_msgs::msg::Pose pose;
-    boost::optional<ReferenceYawInfo> ref_yaw_info = boost::none;
-    boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info = boost::none;
-    boost::optional<geometry_msgs::msg::Pose> ref_pose = boost::none;
+    ShapeEstimationInput estimator_input{label, cluster, boost::none, boost::none, boost::none};
     if (use_vehicle_reference_yaw_ && is_vehicle) {
-      ref_yaw_info = ReferenceYawInfo{
+      estimator_input.ref_yaw_info = ReferenceYawInfo{
         static_cast<float>(tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation)),
         autoware::universe_utils::deg2rad(10)};
     }
     if (use_vehicle_reference_shape_size_ && is_vehicle) {
-      ref_shape_size_info = ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
+      estimator_input.ref_shape_size_info =
+        ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
     }
-    const bool estimated_success = estimator_->estimateShapeAndPose(
-      label, *cluster, ref_yaw_info, ref_shape_size_info, ref_pose, shape, pose);
+    estimator_inputs.push_back(estimator_input);
+    estimator_input_indices.push_back(i);
+  }
 
+  // estimate shape and pose of all the clusters at once
+  std::vector<ShapeEstimationOutput> estimator_outputs;
+  estimator_->estimateShapesAndPoses(estimator_inputs, estimator_outputs);
+
+  // pack msg
+  for (size_t i = 0; i < estimator_outputs.size(); ++i) {
+    const auto & [estimated_success, shape, pose] = estimator_outputs[i];
     // If the shape estimation fails, change to Unknown object.
     if (!fix_filtered_objects_label_to_unknown_ && !estimated_success) {
       continue;
     }
-    output_msg.feature_objects.push_back(feature_object);
+    output_msg.feature_objects.push_back(input_msg->feature_objects[estimator_input_indices[i]]);
     if (!estimated_success) {
       output_msg.feature_objects.back().object.classification.front().label = Label::UNKNOWN;
     }
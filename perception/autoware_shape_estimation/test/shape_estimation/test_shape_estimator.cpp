@@ -21,6 +21,8 @@
 #include <gtest/gtest.h>
 #include <math.h>
 
+#include <vector>
+
 namespace
 {
 double yawFromQuaternion(const geometry_msgs::msg::Quaternion & q)
@@ -237,3 +239,38 @@ TEST(ShapeEstimator, test_estimateShapeAndPose)
   const double pose_output_yaw = yawFromQuaternion(pose_output.orientation);
   EXPECT_NEAR(pose_output_yaw, yaw, deg2rad(15.0));
 }
+
+// test the batch estimation gives the same results as the estimation of each cluster
+TEST(ShapeEstimator, test_estimateShapesAndPoses)
+{
+  using autoware_perception_msgs::msg::ObjectClassification;
+  auto shape_estimator = autoware::shape_estimation::ShapeEstimator(true, true, false);
+
+  std::vector<autoware::shape_estimation::ShapeEstimationInput> inputs;
+  const std::vector<uint8_t> labels = {
+    ObjectClassification::CAR, ObjectClassification::PEDESTRIAN, ObjectClassification::UNKNOWN,
+    ObjectClassification::TRUCK, ObjectClassification::BICYCLE};
+  for (size_t i = 0; i < labels.size(); ++i) {
+    const double yaw = deg2rad(20.0 * static_cast<double>(i));
+    const auto cluster = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>(
+      createLShapeCluster(4.0, 2.0, 1.0, yaw, 3.0 * static_cast<double>(i), -2.0));
+    inputs.push_back({labels[i], cluster, boost::none, boost::none, boost::none});
+  }
+  inputs[3].ref_yaw_info = autoware::shape_estimation::ReferenceYawInfo{
+    static_cast<float>(deg2rad(60.0)), static_cast<float>(deg2rad(10.0))};
+
+  std::vector<autoware::shape_estimation::ShapeEstimationOutput> outputs;
+  shape_estimator.estimateShapesAndPoses(inputs, outputs);
+  ASSERT_EQ(outputs.size(), inputs.size());
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    autoware_perception_msgs::msg::Shape shape_output;
+    geometry_msgs::msg::Pose pose_output;
+    const bool result = shape_estimator.estimateShapeAndPose(
+      inputs[i].label, *inputs[i].cluster, inputs[i].ref_yaw_info, inputs[i].ref_shape_size_info,
+      inputs[i].ref_pose, shape_output, pose_output);
+    EXPECT_EQ(outputs[i].success, result);
+    EXPECT_EQ(outputs[i].shape, shape_output);
+    EXPECT_EQ(outputs[i].pose, pose_output);
+  }
+}
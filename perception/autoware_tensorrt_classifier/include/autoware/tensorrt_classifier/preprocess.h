@@ -29,6 +29,12 @@ typedef struct _roi
   int h;
 } Roi;
 
+typedef struct _normalization
+{
+  float mean[3];
+  float inv_std[3];
+} Normalization;
+
 /**
  * @brief Resize a image using bilinear interpolation on gpus
  * @param[out] dst Resized image
@@ -178,4 +184,24 @@ extern void multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
   float * dst, unsigned char * src, int d_w, int d_h, int d_c, Roi * d_roi, int s_w, int s_h,
   int s_c, int batch, float norm, cudaStream_t stream);
 
+/**
+ * @brief Optimized multi-scale preprocessing including crop, resize, zero padding, nhwc2nchw,
+ * toFloat and per-channel normalization with batching for classifiers on gpus
+ * @param[out] dst processed image
+ * @param[in] src image
+ * @param[in] d_w width for output
+ * @param[in] d_h height for output
+ * @param[in] d_c channel for output
+ * @param[in] d_roi regions of interest of the single input image, one per batch
+ * @param[in] s_w width for input
+ * @param[in] s_h height for input
+ * @param[in] s_c channel for input
+ * @param[in] batch batch size
+ * @param[in] norm per-channel mean and inverse of std
+ * @param[in] stream cuda stream
+ */
+extern void multi_scale_resize_bilinear_pad_nhwc_to_nchw32_normalize_batch_gpu(
+  float * dst, unsigned char * src, int d_w, int d_h, int d_c, Roi * d_roi, int s_w, int s_h,
+  int s_c, int batch, Normalization norm, cudaStream_t stream);
+
 #endif  // AUTOWARE__TENSORRT_CLASSIFIER__PREPROCESS_H_
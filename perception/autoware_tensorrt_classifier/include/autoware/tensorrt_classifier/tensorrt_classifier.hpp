@@ -18,6 +18,7 @@
 #include <autoware/cuda_utils/cuda_check_error.hpp>
 #include <autoware/cuda_utils/cuda_unique_ptr.hpp>
 #include <autoware/cuda_utils/stream_unique_ptr.hpp>
+#include <autoware/tensorrt_classifier/preprocess.h>
 #include <autoware/tensorrt_common/tensorrt_common.hpp>
 #include <opencv2/opencv.hpp>
 
@@ -75,6 +76,18 @@ public:
     const std::vector<cv::Mat> & images, std::vector<int> & results,
     std::vector<float> & probabilities);
 
+  /**
+   * @brief run inference on the regions of interest of a single image, which are cropped and
+   * resized into one batch
+   * @param[in] image whole image
+   * @param[in] rois regions of interest, up to the max batch size
+   * @param[out] results class index of each roi
+   * @param[out] probabilities probability of each roi
+   */
+  bool doMultiScaleInference(
+    const cv::Mat & image, const std::vector<cv::Rect> & rois, std::vector<int> & results,
+    std::vector<float> & probabilities);
+
   /**
    * @brief allocate buffer for preprocess on GPU
    * @param[in] width original image width
@@ -98,9 +111,16 @@ private:
    */
   void preprocessGpu(const std::vector<cv::Mat> & images);
 
+  /**
+   * @brief run preprocess of the regions of interest of a single image on GPU, which uploads the
+   * image once and crops, resizes and normalizes all the regions in one kernel
+   * @param[in] image whole image
+   * @param[in] rois regions of interest
+   */
+  void multiScalePreprocessGpu(const cv::Mat & image, const std::vector<cv::Rect> & rois);
+
   bool feedforwardAndDecode(
-    const std::vector<cv::Mat> & images, std::vector<int> & results,
-    std::vector<float> & probabilities);
+    const int batch_size, std::vector<int> & results, std::vector<float> & probabilities);
 
   std::unique_ptr<autoware::tensorrt_common::TrtCommon> trt_common_;
 
@@ -128,6 +148,12 @@ private:
   int src_height_;
   int batch_size_;
   CudaUniquePtrHost<float[]> out_prob_h_;
+  // buffers for the multi-scale preprocessing on GPU, which only grow with the image size
+  size_t image_buf_size_{0};
+  CudaUniquePtrHost<unsigned char[]> image_buf_h_;
+  CudaUniquePtr<unsigned char[]> image_buf_d_;
+  CudaUniquePtrHost<Roi[]> roi_h_;
+  CudaUniquePtr<Roi[]> roi_d_;
 };
 }  // namespace autoware::tensorrt_classifier
 
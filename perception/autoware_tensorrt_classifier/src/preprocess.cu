@@ -594,3 +594,70 @@ void multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
   multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_kernel<<<
     cuda_gridsize(N), BLOCK, 0, stream>>>(N, dst, src, d_h, d_w, s_h, s_w, d_roi, norm, batch);
 }
+
+__global__ void multi_scale_resize_bilinear_pad_nhwc_to_nchw32_normalize_batch_kernel(
+  int N, float * dst_img, unsigned char * src_img, int dst_h, int dst_w, int src_w, Roi * d_roi,
+  Normalization norm)
+{
+  int index = (blockIdx.x + blockIdx.y * gridDim.x) * blockDim.x + threadIdx.x;
+
+  if (index >= N) return;
+  int C = 3;
+  int H = dst_h;
+  int W = dst_w;
+  // one thread per pixel of every batch
+  int w = index % W;
+  int h = (index / W) % H;
+  int b = index / (W * H);
+
+  // same scaled size as the cpu preprocessing, the bottom and right are padded with zeros
+  Roi roi = d_roi[b];
+  float scale = fminf(W / (float)roi.w, H / (float)roi.h);
+  int scaled_w = (int)(scale * roi.w);
+  int scaled_h = (int)(scale * roi.h);
+  bool is_padding = w >= scaled_w || h >= scaled_h;
+
+  // bilinear sampling of the crop at the pixel center, like cv::INTER_LINEAR
+  int x0 = 0, x1 = 0, y0 = 0, y1 = 0;
+  float ax = 0.0f, ay = 0.0f;
+  if (!is_padding) {
+    float src_x = fmaxf((w + 0.5f) * roi.w / (float)scaled_w - 0.5f, 0.0f);
+    float src_y = fmaxf((h + 0.5f) * roi.h / (float)scaled_h - 0.5f, 0.0f);
+    x0 = min((int)src_x, roi.w - 1);
+    y0 = min((int)src_y, roi.h - 1);
+    x1 = min(x0 + 1, roi.w - 1);
+    y1 = min(y0 + 1, roi.h - 1);
+    ax = src_x - x0;
+    ay = src_y - y0;
+    x0 += roi.x;
+    x1 += roi.x;
+    y0 += roi.y;
+    y1 += roi.y;
+  }
+
+  int stride = src_w * C;
+  for (int c = 0; c < C; c++) {
+    float value = 0.0f;
+    if (!is_padding) {
+      // NHWC
+      float f00 = src_img[y0 * stride + x0 * C + c];
+      float f01 = src_img[y0 * stride + x1 * C + c];
+      float f10 = src_img[y1 * stride + x0 * C + c];
+      float f11 = src_img[y1 * stride + x1 * C + c];
+      value = rintf(
+        (1.0f - ay) * ((1.0f - ax) * f00 + ax * f01) + ay * ((1.0f - ax) * f10 + ax * f11));
+    }
+    // NCHW
+    int dst_index = w + (W * h) + (W * H * c) + b * (W * H * C);
+    dst_img[dst_index] = (value - norm.mean[c]) * norm.inv_std[c];
+  }
+}
+
+void multi_scale_resize_bilinear_pad_nhwc_to_nchw32_normalize_batch_gpu(
+  float * dst, unsigned char * src, int d_w, int d_h, int d_c, Roi * d_roi, int s_w, int s_h,
+  int s_c, int batch, Normalization norm, cudaStream_t stream)
+{
+  int N = d_w * d_h * batch;
+  multi_scale_resize_bilinear_pad_nhwc_to_nchw32_normalize_batch_kernel<<<
+    cuda_gridsize(N), BLOCK, 0, stream>>>(N, dst, src, d_h, d_w, s_w, d_roi, norm);
+}
@@ -183,6 +183,8 @@ TrtClassifier::TrtClassifier(
     m_cuda = true;
     h_img_ = NULL;
     d_img_ = NULL;
+    roi_h_ = autoware::cuda_utils::make_unique_host<Roi[]>(batch_size_, cudaHostAllocWriteCombined);
+    roi_d_ = autoware::cuda_utils::make_unique<Roi[]>(batch_size_);
 
   } else {
     m_cuda = false;
@@ -294,6 +296,54 @@ void TrtClassifier::preprocessGpu(const std::vector<cv::Mat> & images)
   // CHECK_CUDA_ERROR(cudaStreamSynchronize(*stream_));
 }
 
+void TrtClassifier::multiScalePreprocessGpu(
+  const cv::Mat & image, const std::vector<cv::Rect> & rois)
+{
+  const auto batch_size = rois.size();
+  auto input_dims = trt_common_->getBindingDimensions(0);
+  input_dims.d[0] = batch_size;
+  trt_common_->setBindingDimensions(0, input_dims);
+  const int input_height = input_dims.d[2];
+  const int input_width = input_dims.d[3];
+
+  const size_t image_size = image.cols * image.rows * 3;
+  if (image_size > image_buf_size_) {
+    image_buf_h_ = autoware::cuda_utils::make_unique_host<unsigned char[]>(
+      image_size, cudaHostAllocWriteCombined);
+    image_buf_d_ = autoware::cuda_utils::make_unique<unsigned char[]>(image_size);
+    image_buf_size_ = image_size;
+  }
+
+  // the rois are kept within the image, since the kernel reads the pixels without any check
+  const cv::Rect image_rect(0, 0, image.cols, image.rows);
+  for (size_t b = 0; b < batch_size; b++) {
+    const auto roi = rois[b] & image_rect;
+    roi_h_[b].x = roi.x;
+    roi_h_[b].y = roi.y;
+    roi_h_[b].w = std::max(roi.width, 1);
+    roi_h_[b].h = std::max(roi.height, 1);
+  }
+  Normalization norm;
+  for (int c = 0; c < 3; c++) {
+    norm.mean[c] = mean_[c];
+    norm.inv_std[c] = inv_std_[c];
+  }
+
+  // Copy into pinned memory
+  cv::Mat image_buf(image.rows, image.cols, CV_8UC3, image_buf_h_.get());
+  image.copyTo(image_buf);
+  // Copy into device memory
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    image_buf_d_.get(), image_buf_h_.get(), image_size * sizeof(unsigned char),
+    cudaMemcpyHostToDevice, *stream_));
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    roi_d_.get(), roi_h_.get(), batch_size * sizeof(Roi), cudaMemcpyHostToDevice, *stream_));
+  multi_scale_resize_bilinear_pad_nhwc_to_nchw32_normalize_batch_gpu(
+    input_d_.get(), image_buf_d_.get(), input_width, input_height, 3, roi_d_.get(), image.cols,
+    image.rows, 3, batch_size, norm, *stream_);
+  // No Need for Sync
+}
+
 void TrtClassifier::preprocess_opt(const std::vector<cv::Mat> & images)
 {
   int batch_size = static_cast<int>(images.size());
@@ -351,20 +401,41 @@ bool TrtClassifier::doInference(
   }
   preprocess_opt(images);
 
-  return feedforwardAndDecode(images, results, probabilities);
+  return feedforwardAndDecode(static_cast<int>(images.size()), results, probabilities);
 }
 
-bool TrtClassifier::feedforwardAndDecode(
-  const std::vector<cv::Mat> & images, std::vector<int> & results,
+bool TrtClassifier::doMultiScaleInference(
+  const cv::Mat & image, const std::vector<cv::Rect> & rois, std::vector<int> & results,
   std::vector<float> & probabilities)
+{
+  if (!trt_common_->isInitialized()) {
+    return false;
+  }
+  if (rois.empty() || static_cast<int>(rois.size()) > batch_size_ || image.type() != CV_8UC3) {
+    return false;
+  }
+  if (m_cuda) {
+    multiScalePreprocessGpu(image, rois);
+  } else {
+    std::vector<cv::Mat> images;
+    images.reserve(rois.size());
+    for (const auto & roi : rois) {
+      images.emplace_back(image(roi));
+    }
+    preprocess_opt(images);
+  }
+
+  return feedforwardAndDecode(static_cast<int>(rois.size()), results, probabilities);
+}
+
+bool TrtClassifier::feedforwardAndDecode(
+  const int batch_size, std::vector<int> & results, std::vector<float> & probabilities)
 {
   results.clear();
   probabilities.clear();
   std::vector<void *> buffers = {input_d_.get(), out_prob_d_.get()};
   trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
 
-  int batch_size = static_cast<int>(images.size());
-
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     out_prob_h_.get(), out_prob_d_.get(), sizeof(float) * out_elem_num_, cudaMemcpyDeviceToHost,
     *stream_));
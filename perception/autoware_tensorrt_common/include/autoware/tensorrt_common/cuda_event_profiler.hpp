@@ -0,0 +1,128 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef AUTOWARE__TENSORRT_COMMON__CUDA_EVENT_PROFILER_HPP_
+#define AUTOWARE__TENSORRT_COMMON__CUDA_EVENT_PROFILER_HPP_
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autoware
+{
+namespace tensorrt_common
+{
+/**
+ * @class CudaEventProfiler
+ * @brief Measure the device time of sections of work enqueued on CUDA streams
+ *
+ * Unlike the IProfiler of TensorRT, which makes the enqueue synchronous, the sections are
+ * delimited by CUDA events and their times are only read once the events are completed, so
+ * profiling does not change the timing of the profiled process. This class is not thread safe.
+ */
+class CudaEventProfiler
+{
+public:
+  struct Statistics
+  {
+    std::string name;
+    size_t count{0};
+    float mean_ms{0.0F};
+    float p50_ms{0.0F};
+    float p90_ms{0.0F};
+    float p99_ms{0.0F};
+    float max_ms{0.0F};
+  };
+
+  /**
+   * @brief Construct CudaEventProfiler
+   * @param[in] name name of the profiler, used in the outputs
+   * @param[in] max_samples number of the latest samples kept for each section
+   */
+  explicit CudaEventProfiler(std::string name, size_t max_samples = 1000);
+  ~CudaEventProfiler();
+
+  CudaEventProfiler(const CudaEventProfiler &) = delete;
+  CudaEventProfiler & operator=(const CudaEventProfiler &) = delete;
+
+  /**
+   * @brief record the start of a section on the stream
+   */
+  void start(const std::string & section, cudaStream_t stream);
+
+  /**
+   * @brief record the end of a section on the stream, which may differ from the starting one
+   */
+  void stop(const std::string & section, cudaStream_t stream);
+
+  /**
+   * @brief collect the times of the completed sections without waiting for the device
+   */
+  void update();
+
+  /**
+   * @brief get the statistics of the collected samples of each section, in order of appearance
+   */
+  std::vector<Statistics> getStatistics() const;
+
+  /**
+   * @brief write the collected samples as a Chrome trace, viewable with chrome://tracing or
+   * Perfetto
+   * @param[in] file_path path for a JSON file
+   * @return flag for whether writing succeeded
+   */
+  bool writeChromeTrace(const std::string & file_path) const;
+
+  friend std::ostream & operator<<(std::ostream & out, const CudaEventProfiler & value);
+
+private:
+  struct PendingSection
+  {
+    std::string name;
+    cudaEvent_t start{nullptr};
+    cudaEvent_t stop{nullptr};
+  };
+
+  struct Sample
+  {
+    // time since the first recorded event
+    float start_ms;
+    float duration_ms;
+  };
+
+  cudaEvent_t acquireEvent();
+  void releaseEvent(cudaEvent_t event);
+
+  std::string name_;
+  size_t max_samples_;
+  // reference of the timestamps in the trace
+  cudaEvent_t origin_{nullptr};
+  std::vector<cudaEvent_t> free_events_;
+  // sections in order of submission, and the ones that were started but not stopped yet
+  std::list<PendingSection> pending_sections_;
+  std::map<std::string, std::list<PendingSection>::iterator> open_sections_;
+  std::vector<std::string> section_names_;
+  std::map<std::string, std::deque<Sample>> samples_;
+};
+}  // namespace tensorrt_common
+}  // namespace autoware
+
+#endif  // AUTOWARE__TENSORRT_COMMON__CUDA_EVENT_PROFILER_HPP_
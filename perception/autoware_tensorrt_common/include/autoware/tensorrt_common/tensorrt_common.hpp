@@ -30,6 +30,7 @@ namespace fs = ::std::filesystem;
 namespace fs = ::std::experimental::filesystem;
 #endif
 
+#include <autoware/tensorrt_common/cuda_event_profiler.hpp>
 #include <autoware/tensorrt_common/logger.hpp>
 #include <autoware/tensorrt_common/simple_profiler.hpp>
 
@@ -66,6 +67,9 @@ struct BuildConfig
   // clip value for implicit quantization
   double clip_value;  // For implicit quantization
 
+  // flag for device-side profiler using CUDA events, which keeps enqueue asynchronous
+  bool profile_with_events;
+
   // Supported calibration type
   const std::array<std::string, 4> valid_calib_type = {"Entropy", "Legacy", "Percentile", "MinMax"};
 
@@ -75,20 +79,23 @@ struct BuildConfig
     quantize_first_layer(false),
     quantize_last_layer(false),
     profile_per_layer(false),
-    clip_value(0.0)
+    clip_value(0.0),
+    profile_with_events(false)
   {
   }
 
   explicit BuildConfig(
     const std::string & calib_type_str, const int dla_core_id = -1,
     const bool quantize_first_layer = false, const bool quantize_last_layer = false,
-    const bool profile_per_layer = false, const double clip_value = 0.0)
+    const bool profile_per_layer = false, const double clip_value = 0.0,
+    const bool profile_with_events = false)
   : calib_type_str(calib_type_str),
     dla_core_id(dla_core_id),
     quantize_first_layer(quantize_first_layer),
     quantize_last_layer(quantize_last_layer),
     profile_per_layer(profile_per_layer),
-    clip_value(clip_value)
+    clip_value(clip_value),
+    profile_with_events(profile_with_events)
   {
 #ifndef YOLOX_STANDALONE
     if (
@@ -176,7 +183,7 @@ public:
   /**
    * @brief build TensorRT engine from ONNX
    * @param[in] onnx_file_path path for a onnx file
-   * @param[in] output_engine_file_path path for a engine file
+   * @param[in] output_engine_file_path path for a engine file, written atomically
    */
   bool buildEngineFromOnnx(
     const std::string & onnx_file_path, const std::string & output_engine_file_path);
@@ -207,6 +214,13 @@ public:
    */
   void printProfiling(void);
 
+  /**
+   * @brief get the device-side profiler, to which callers may add their own sections such as
+   * preprocessing and postprocessing kernels
+   * @return pointer for the profiler, or nullptr if profile_with_events is disabled
+   */
+  CudaEventProfiler * getEventProfiler();
+
 #if (NV_TENSORRT_MAJOR * 1000) + (NV_TENSORRT_MINOR * 100) + NV_TENSOR_PATCH >= 8200
   /**
    * @brief get per-layer information for trt-engine-profiler
@@ -215,8 +229,17 @@ public:
 #endif
 
 private:
+  /**
+   * @brief get the key identifying an engine built from the model with the current settings
+   * @param[in] build_name name of the build options, as used in the engine file name
+   * @return hash of the ONNX file, build options, TensorRT version and GPU as 16 hex digits, or
+   * an empty string if the ONNX file cannot be read
+   */
+  std::string getEngineCacheKey(const std::string & build_name) const;
+
   Logger logger_;
   fs::path model_file_path_;
+  std::vector<std::string> plugin_paths_;
   TrtUniquePtr<nvinfer1::IRuntime> runtime_;
   TrtUniquePtr<nvinfer1::ICudaEngine> engine_;
   TrtUniquePtr<nvinfer1::IExecutionContext> context_;
@@ -233,6 +256,8 @@ private:
   SimpleProfiler model_profiler_;
   // profiler for whole model
   SimpleProfiler host_profiler_;
+  // device-side profiler for whole model
+  std::unique_ptr<CudaEventProfiler> event_profiler_;
 
   std::unique_ptr<const BuildConfig> build_config_;
 };
@@ -0,0 +1,232 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <autoware/tensorrt_common/cuda_event_profiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+float percentile(const std::vector<float> & sorted_values, const float ratio)
+{
+  const auto index =
+    static_cast<size_t>(std::ceil(ratio * static_cast<float>(sorted_values.size()))) - 1;
+  return sorted_values[std::min(index, sorted_values.size() - 1)];
+}
+}  // anonymous namespace
+
+namespace autoware
+{
+namespace tensorrt_common
+{
+CudaEventProfiler::CudaEventProfiler(std::string name, size_t max_samples)
+: name_(std::move(name)), max_samples_(std::max<size_t>(max_samples, 1))
+{
+}
+
+CudaEventProfiler::~CudaEventProfiler()
+{
+  for (const auto & section : pending_sections_) {
+    releaseEvent(section.start);
+    releaseEvent(section.stop);
+  }
+  releaseEvent(origin_);
+  for (auto event : free_events_) {
+    cudaEventDestroy(event);
+  }
+}
+
+cudaEvent_t CudaEventProfiler::acquireEvent()
+{
+  if (!free_events_.empty()) {
+    auto event = free_events_.back();
+    free_events_.pop_back();
+    return event;
+  }
+  cudaEvent_t event = nullptr;
+  if (cudaEventCreate(&event) != cudaSuccess) {
+    return nullptr;
+  }
+  return event;
+}
+
+void CudaEventProfiler::releaseEvent(cudaEvent_t event)
+{
+  if (event) {
+    free_events_.push_back(event);
+  }
+}
+
+void CudaEventProfiler::start(const std::string & section, cudaStream_t stream)
+{
+  if (open_sections_.count(section) > 0) {
+    // the previous one was never stopped
+    stop(section, stream);
+  }
+  if (!origin_) {
+    origin_ = acquireEvent();
+    if (!origin_ || cudaEventRecord(origin_, stream) != cudaSuccess) {
+      releaseEvent(origin_);
+      origin_ = nullptr;
+      return;
+    }
+  }
+  auto event = acquireEvent();
+  if (!event || cudaEventRecord(event, stream) != cudaSuccess) {
+    releaseEvent(event);
+    return;
+  }
+  if (samples_.count(section) == 0) {
+    section_names_.push_back(section);
+    samples_[section];
+  }
+  pending_sections_.push_back({section, event, nullptr});
+  open_sections_[section] = std::prev(pending_sections_.end());
+}
+
+void CudaEventProfiler::stop(const std::string & section, cudaStream_t stream)
+{
+  const auto open_section = open_sections_.find(section);
+  if (open_section == open_sections_.end()) {
+    return;
+  }
+  auto pending_section = open_section->second;
+  open_sections_.erase(open_section);
+  auto event = acquireEvent();
+  if (!event || cudaEventRecord(event, stream) != cudaSuccess) {
+    releaseEvent(event);
+    releaseEvent(pending_section->start);
+    pending_sections_.erase(pending_section);
+    return;
+  }
+  pending_section->stop = event;
+}
+
+void CudaEventProfiler::update()
+{
+  if (!origin_ || cudaEventQuery(origin_) != cudaSuccess) {
+    return;
+  }
+  for (auto it = pending_sections_.begin(); it != pending_sections_.end();) {
+    // cudaEventQuery does not block, and the stop event completes after the start one
+    if (!it->stop || cudaEventQuery(it->stop) != cudaSuccess) {
+      ++it;
+      continue;
+    }
+    Sample sample{};
+    if (
+      cudaEventElapsedTime(&sample.start_ms, origin_, it->start) == cudaSuccess &&
+      cudaEventElapsedTime(&sample.duration_ms, it->start, it->stop) == cudaSuccess) {
+      auto & samples = samples_[it->name];
+      samples.push_back(sample);
+      if (samples.size() > max_samples_) {
+        samples.pop_front();
+      }
+    }
+    releaseEvent(it->start);
+    releaseEvent(it->stop);
+    it = pending_sections_.erase(it);
+  }
+}
+
+std::vector<CudaEventProfiler::Statistics> CudaEventProfiler::getStatistics() const
+{
+  std::vector<Statistics> statistics;
+  std::vector<float> durations;
+  for (const auto & section_name : section_names_) {
+    const auto & samples = samples_.at(section_name);
+    if (samples.empty()) {
+      continue;
+    }
+    durations.clear();
+    for (const auto & sample : samples) {
+      durations.push_back(sample.duration_ms);
+    }
+    std::sort(durations.begin(), durations.end());
+
+    Statistics section_statistics;
+    section_statistics.name = section_name;
+    section_statistics.count = durations.size();
+    section_statistics.mean_ms = std::accumulate(durations.begin(), durations.end(), 0.0F) /
+                                 static_cast<float>(durations.size());
+    section_statistics.p50_ms = percentile(durations, 0.5F);
+    section_statistics.p90_ms = percentile(durations, 0.9F);
+    section_statistics.p99_ms = percentile(durations, 0.99F);
+    section_statistics.max_ms = durations.back();
+    statistics.push_back(section_statistics);
+  }
+  return statistics;
+}
+
+bool CudaEventProfiler::writeChromeTrace(const std::string & file_path) const
+{
+  std::ofstream file(file_path, std::ofstream::trunc);
+  if (!file.is_open()) {
+    return false;
+  }
+  // one row per section, with the timestamps and durations in microseconds
+  file << "{\"traceEvents\":[";
+  bool is_first = true;
+  for (size_t tid = 0; tid < section_names_.size(); ++tid) {
+    const auto & section_name = section_names_[tid];
+    file << (is_first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":\"" << name_
+         << "\",\"tid\":" << tid << ",\"args\":{\"name\":\"" << section_name << "\"}}";
+    is_first = false;
+    for (const auto & sample : samples_.at(section_name)) {
+      file << ",\n{\"name\":\"" << section_name << "\",\"ph\":\"X\",\"pid\":\"" << name_
+           << "\",\"tid\":" << tid << std::fixed << std::setprecision(3)
+           << ",\"ts\":" << sample.start_ms * 1000.0F << ",\"dur\":" << sample.duration_ms * 1000.0F
+           << "}";
+    }
+  }
+  file << "\n]}\n";
+  return static_cast<bool>(file);
+}
+
+std::ostream & operator<<(std::ostream & out, const CudaEventProfiler & value)
+{
+  const auto statistics = value.getStatistics();
+  int max_name_length = static_cast<int>(std::string("Section").size());
+  for (const auto & section_statistics : statistics) {
+    max_name_length = std::max(max_name_length, static_cast<int>(section_statistics.name.size()));
+  }
+
+  auto old_settings = out.flags();
+  auto old_precision = out.precision();
+  out << "========== " << value.name_ << " device profile ==========" << std::endl;
+  out << std::setw(max_name_length) << "Section" << "," << std::setw(12) << "Samples" << ","
+      << std::setw(12) << "Mean[ms]" << "," << std::setw(12) << "P50[ms]" << "," << std::setw(12)
+      << "P90[ms]" << "," << std::setw(12) << "P99[ms]" << "," << std::setw(12) << "Max[ms]"
+      << std::endl;
+  for (const auto & s : statistics) {
+    out << std::setw(max_name_length) << s.name << "," << std::setw(12) << s.count << ","
+        << std::fixed << std::setprecision(3) << std::setw(12) << s.mean_ms << "," << std::setw(12)
+        << s.p50_ms << "," << std::setw(12) << s.p90_ms << "," << std::setw(12) << s.p99_ms << ","
+        << std::setw(12) << s.max_ms << std::endl;
+  }
+  out.flags(old_settings);
+  out.precision(old_precision);
+  return out;
+}
+}  // namespace tensorrt_common
+}  // namespace autoware
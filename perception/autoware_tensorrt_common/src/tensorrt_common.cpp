@@ -15,13 +15,18 @@
 #include <autoware/tensorrt_common/tensorrt_common.hpp>
 
 #include <NvInferPlugin.h>
+#include <cuda_runtime_api.h>
 #include <dlfcn.h>
+#include <unistd.h>
 
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <system_error>
 #include <utility>
 
 namespace
@@ -31,6 +36,39 @@ bool contain(const std::string & s, const T & v)
 {
   return s.find(v) != std::string::npos;
 }
+
+// 64-bit FNV-1a, only used to tell engine caches apart
+constexpr uint64_t fnv_offset_basis = 14695981039346656037ULL;
+constexpr uint64_t fnv_prime = 1099511628211ULL;
+
+uint64_t hash_bytes(uint64_t hash, const char * data, const size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= fnv_prime;
+  }
+  return hash;
+}
+
+uint64_t hash_string(const uint64_t hash, const std::string & s)
+{
+  // the terminating null separates consecutive fields
+  return hash_bytes(hash, s.c_str(), s.size() + 1);
+}
+
+bool hash_file(uint64_t & hash, const std::string & file_path)
+{
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+  std::vector<char> buffer(1 << 20);
+  while (file) {
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    hash = hash_bytes(hash, buffer.data(), static_cast<size_t>(file.gcount()));
+  }
+  return file.eof();
+}
 }  // anonymous namespace
 
 namespace autoware
@@ -94,6 +132,7 @@ TrtCommon::TrtCommon(
   const size_t max_workspace_size, const BuildConfig & build_config,
   const std::vector<std::string> & plugin_paths)
 : model_file_path_(model_path),
+  plugin_paths_(plugin_paths),
   calibrator_(std::move(calibrator)),
   precision_(precision),
   batch_config_(batch_config),
@@ -106,6 +145,9 @@ TrtCommon::TrtCommon(
     return;
   }
   build_config_ = std::make_unique<const BuildConfig>(build_config);
+  if (build_config_->profile_with_events) {
+    event_profiler_ = std::make_unique<CudaEventProfiler>("Device");
+  }
 
   for (const auto & plugin_path : plugin_paths) {
     int32_t flags{RTLD_LAZY};
@@ -160,33 +202,39 @@ void TrtCommon::setup()
       }
     }
     if (build_config_->dla_core_id != -1) {
-      ext = "DLA" + std::to_string(build_config_->dla_core_id) + "-" + calib_name + precision_;
-      if (build_config_->quantize_first_layer) {
-        ext += "-firstFP16";
-      }
-      if (build_config_->quantize_last_layer) {
-        ext += "-lastFP16";
-      }
-      ext += "-batch" + std::to_string(batch_config_[0]) + ".engine";
-    } else {
-      ext = calib_name + precision_;
-      if (build_config_->quantize_first_layer) {
-        ext += "-firstFP16";
-      }
-      if (build_config_->quantize_last_layer) {
-        ext += "-lastFP16";
-      }
-      ext += "-batch" + std::to_string(batch_config_[0]) + ".engine";
+      ext = "DLA" + std::to_string(build_config_->dla_core_id) + "-";
     }
+    ext += calib_name + precision_;
+    if (build_config_->quantize_first_layer) {
+      ext += "-firstFP16";
+    }
+    if (build_config_->quantize_last_layer) {
+      ext += "-lastFP16";
+    }
+    ext += "-batch" + std::to_string(batch_config_[0]);
+    // the key makes an engine built for another model, TensorRT version or GPU unreachable
+    const auto cache_key = getEngineCacheKey(ext);
+    if (cache_key.empty()) {
+      logger_.log(nvinfer1::ILogger::Severity::kERROR, "Failed to read onnx file");
+      is_initialized_ = false;
+      return;
+    }
+    ext += "-" + cache_key + ".engine";
     cache_engine_path.replace_extension(ext);
 
     // Output Network Information
     printNetworkInfo(model_file_path_);
 
+    bool is_cache_loaded = false;
     if (fs::exists(cache_engine_path)) {
       std::cout << "Loading... " << cache_engine_path << std::endl;
-      loadEngine(cache_engine_path);
-    } else {
+      is_cache_loaded = loadEngine(cache_engine_path);
+      if (!is_cache_loaded) {
+        logger_.log(
+          nvinfer1::ILogger::Severity::kWARNING, "Failed to load the cached engine, rebuilding it");
+      }
+    }
+    if (!is_cache_loaded) {
       std::cout << "Building... " << cache_engine_path << std::endl;
       logger_.log(nvinfer1::ILogger::Severity::kINFO, "Start build engine");
       auto log_thread = logger_.log_throttle(
@@ -203,6 +251,12 @@ void TrtCommon::setup()
     return;
   }
 
+  if (!engine_) {
+    logger_.log(nvinfer1::ILogger::Severity::kERROR, "Fail to load engine");
+    is_initialized_ = false;
+    return;
+  }
+
   context_ = TrtUniquePtr<nvinfer1::IExecutionContext>(engine_->createExecutionContext());
   if (!context_) {
     logger_.log(nvinfer1::ILogger::Severity::kERROR, "Fail to create context");
@@ -245,7 +299,40 @@ bool TrtCommon::loadEngine(const std::string & engine_file_path)
   std::string engine_str = engine_buffer.str();
   engine_ = TrtUniquePtr<nvinfer1::ICudaEngine>(runtime_->deserializeCudaEngine(
     reinterpret_cast<const void *>(engine_str.data()), engine_str.size()));
-  return true;
+  return engine_ != nullptr;
+}
+
+std::string TrtCommon::getEngineCacheKey(const std::string & build_name) const
+{
+  uint64_t hash = fnv_offset_basis;
+  if (!hash_file(hash, model_file_path_)) {
+    return "";
+  }
+  for (const auto & plugin_path : plugin_paths_) {
+    hash = hash_string(hash, fs::path(plugin_path).filename().string());
+  }
+
+  std::stringstream build_options;
+  build_options << build_name << ";" << batch_config_[0] << "," << batch_config_[1] << ","
+                << batch_config_[2] << ";" << max_workspace_size_ << ";"
+                << build_config_->clip_value << ";" << build_config_->profile_per_layer;
+  hash = hash_string(hash, build_options.str());
+
+  // the library version is checked instead of the headers, which may not match after an update
+  hash = hash_string(hash, "trt" + std::to_string(getInferLibVersion()));
+  int device = 0;
+  cudaDeviceProp device_prop;
+  if (
+    cudaGetDevice(&device) == cudaSuccess &&
+    cudaGetDeviceProperties(&device_prop, device) == cudaSuccess) {
+    hash = hash_string(
+      hash, std::string(device_prop.name) + ";sm" + std::to_string(device_prop.major) +
+              std::to_string(device_prop.minor));
+  }
+
+  char key[17];
+  std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+  return key;
 }
 
 void TrtCommon::printNetworkInfo(const std::string & onnx_file_path)
@@ -524,12 +611,15 @@ bool TrtCommon::buildEngineFromOnnx(
     return false;
   }
 
-  // save engine
+  // save engine to a temporary file first, so that a process killed while writing or another
+  // process building the same engine never leaves a truncated engine behind
 #if TENSORRT_VERSION_MAJOR < 8
   auto data = TrtUniquePtr<nvinfer1::IHostMemory>(engine_->serialize());
 #endif
+  const std::string temporary_file_path =
+    output_engine_file_path + ".tmp" + std::to_string(getpid());
   std::ofstream file;
-  file.open(output_engine_file_path, std::ios::binary | std::ios::out);
+  file.open(temporary_file_path, std::ios::binary | std::ios::out);
   if (!file.is_open()) {
     return false;
   }
@@ -540,6 +630,16 @@ bool TrtCommon::buildEngineFromOnnx(
 #endif
 
   file.close();
+  std::error_code error;
+  if (!file) {
+    fs::remove(temporary_file_path, error);
+    return false;
+  }
+  fs::rename(temporary_file_path, output_engine_file_path, error);
+  if (error) {
+    fs::remove(temporary_file_path, error);
+    return false;
+  }
 
   return true;
 }
@@ -591,6 +691,13 @@ bool TrtCommon::enqueueV3(cudaStream_t stream)
       std::chrono::duration<float, std::milli>(inference_end - inference_start).count());
     return ret;
   }
+  if (event_profiler_) {
+    event_profiler_->start("inference", stream);
+    bool ret = context_->enqueueV3(stream);
+    event_profiler_->stop("inference", stream);
+    event_profiler_->update();
+    return ret;
+  }
   return context_->enqueueV3(stream);
 }
 #endif
@@ -607,6 +714,12 @@ bool TrtCommon::enqueueV2(void ** bindings, cudaStream_t stream, cudaEvent_t * i
       "inference",
       std::chrono::duration<float, std::milli>(inference_end - inference_start).count());
     return ret;
+  } else if (event_profiler_) {
+    event_profiler_->start("inference", stream);
+    bool ret = context_->enqueueV2(bindings, stream, input_consumed);
+    event_profiler_->stop("inference", stream);
+    event_profiler_->update();
+    return ret;
   } else {
     return context_->enqueueV2(bindings, stream, input_consumed);
   }
@@ -618,6 +731,16 @@ void TrtCommon::printProfiling()
   std::cout << host_profiler_;
   std::cout << std::endl;
   std::cout << model_profiler_;
+  if (event_profiler_) {
+    event_profiler_->update();
+    std::cout << std::endl;
+    std::cout << *event_profiler_;
+  }
+}
+
+CudaEventProfiler * TrtCommon::getEventProfiler()
+{
+  return event_profiler_.get();
 }
 
 #if (NV_TENSORRT_MAJOR * 1000) + (NV_TENSORRT_MINOR * 100) + NV_TENSOR_PATCH >= 8200
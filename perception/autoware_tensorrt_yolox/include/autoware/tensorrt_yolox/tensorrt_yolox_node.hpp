@@ -74,20 +74,32 @@ public:
 
 private:
   void onConnect();
-  void onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg);
+  void onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg, const std::size_t camera_id);
+  void inferPendingImages();
+  void publishResults(
+    const std::size_t camera_id, const sensor_msgs::msg::Image::ConstSharedPtr & msg,
+    cv_bridge::CvImagePtr & in_image_ptr, const tensorrt_yolox::ObjectArray & yolox_objects,
+    cv::Mat & mask);
+  std::string getTopicName(const std::string & name, const std::size_t camera_id) const;
   bool readLabelFile(const std::string & label_path);
   void replaceLabelMap();
   void overlapSegmentByRoi(
     const tensorrt_yolox::Object & object, cv::Mat & mask, const int width, const int height);
   int mapRoiLabel2SegLabel(const int32_t roi_label_index);
-  image_transport::Publisher image_pub_;
-  image_transport::Publisher mask_pub_;
+  // one publisher and subscriber per camera, all the cameras are inferred as a single batch
+  std::vector<image_transport::Publisher> image_pubs_;
+  std::vector<image_transport::Publisher> mask_pubs_;
 
-  image_transport::Publisher color_mask_pub_;
+  std::vector<image_transport::Publisher> color_mask_pubs_;
 
-  rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr objects_pub_;
+  std::vector<rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr>
+    objects_pubs_;
 
-  image_transport::Subscriber image_sub_;
+  std::vector<image_transport::Subscriber> image_subs_;
+
+  // latest image of each camera which is not inferred yet
+  std::vector<sensor_msgs::msg::Image::ConstSharedPtr> pending_images_;
+  std::size_t num_cameras_{1};
 
   rclcpp::TimerBase::SharedPtr timer_;
 
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -58,6 +59,10 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
   const std::string calibration_image_list_path =
     this->declare_parameter<std::string>("calibration_image_list_path");
   const uint8_t gpu_id = this->declare_parameter<uint8_t>("gpu_id");
+  num_cameras_ = static_cast<std::size_t>(this->declare_parameter<int>("num_cameras"));
+  if (num_cameras_ < 1) {
+    throw std::invalid_argument("num_cameras should be positive.");
+  }
 
   std::string color_map_path = this->declare_parameter<std::string>("color_map_path");
 
@@ -89,7 +94,9 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
 
   const double norm_factor = 1.0;
   const std::string cache_dir = "";
-  const autoware::tensorrt_common::BatchConfig batch_config{1, 1, 1};
+  // the images of all the cameras are inferred at once, so that one engine serves every camera
+  const int batch_size = static_cast<int>(num_cameras_);
+  const autoware::tensorrt_common::BatchConfig batch_config{batch_size, batch_size, batch_size};
   const size_t max_workspace_size = (1 << 30);
 
   trt_yolox_ = std::make_unique<tensorrt_yolox::TrtYoloX>(
@@ -107,11 +114,19 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
   timer_ =
     rclcpp::create_timer(this, get_clock(), 100ms, std::bind(&TrtYoloXNode::onConnect, this));
 
-  objects_pub_ = this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
-    "~/out/objects", 1);
-  mask_pub_ = image_transport::create_publisher(this, "~/out/mask");
-  color_mask_pub_ = image_transport::create_publisher(this, "~/out/color_mask");
-  image_pub_ = image_transport::create_publisher(this, "~/out/image");
+  pending_images_.resize(num_cameras_);
+  image_subs_.resize(num_cameras_);
+  for (std::size_t camera_id = 0; camera_id < num_cameras_; ++camera_id) {
+    objects_pubs_.push_back(
+      this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
+        getTopicName("~/out/objects", camera_id), 1));
+    mask_pubs_.push_back(
+      image_transport::create_publisher(this, getTopicName("~/out/mask", camera_id)));
+    color_mask_pubs_.push_back(
+      image_transport::create_publisher(this, getTopicName("~/out/color_mask", camera_id)));
+    image_pubs_.push_back(
+      image_transport::create_publisher(this, getTopicName("~/out/image", camera_id)));
+  }
 
   if (declare_parameter("build_only", false)) {
     RCLCPP_INFO(this->get_logger(), "TensorRT engine file is built and exit.");
@@ -119,49 +134,148 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
   }
 }
 
+std::string TrtYoloXNode::getTopicName(const std::string & name, const std::size_t camera_id) const
+{
+  // the topics of a single camera keep their names without index
+  return num_cameras_ == 1 ? name : name + std::to_string(camera_id);
+}
+
 void TrtYoloXNode::onConnect()
 {
   using std::placeholders::_1;
-  if (
-    objects_pub_->get_subscription_count() == 0 &&
-    objects_pub_->get_intra_process_subscription_count() == 0 &&
-    image_pub_.getNumSubscribers() == 0 && mask_pub_.getNumSubscribers() == 0 &&
-    color_mask_pub_.getNumSubscribers() == 0) {
-    image_sub_.shutdown();
-  } else if (!image_sub_) {
-    image_sub_ = image_transport::create_subscription(
-      this, "~/in/image", std::bind(&TrtYoloXNode::onImage, this, _1), "raw",
-      rmw_qos_profile_sensor_data);
+  bool has_subscriber = false;
+  for (std::size_t camera_id = 0; camera_id < num_cameras_; ++camera_id) {
+    has_subscriber = has_subscriber || objects_pubs_[camera_id]->get_subscription_count() > 0 ||
+                     objects_pubs_[camera_id]->get_intra_process_subscription_count() > 0 ||
+                     image_pubs_[camera_id].getNumSubscribers() > 0 ||
+                     mask_pubs_[camera_id].getNumSubscribers() > 0 ||
+                     color_mask_pubs_[camera_id].getNumSubscribers() > 0;
+  }
+  for (std::size_t camera_id = 0; camera_id < num_cameras_; ++camera_id) {
+    if (!has_subscriber) {
+      image_subs_[camera_id].shutdown();
+      pending_images_[camera_id].reset();
+    } else if (!image_subs_[camera_id]) {
+      image_subs_[camera_id] = image_transport::create_subscription(
+        this, getTopicName("~/in/image", camera_id),
+        [this, camera_id](const sensor_msgs::msg::Image::ConstSharedPtr msg) {
+          onImage(msg, camera_id);
+        },
+        "raw", rmw_qos_profile_sensor_data);
+    }
   }
 }
 
-void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
+void TrtYoloXNode::onImage(
+  const sensor_msgs::msg::Image::ConstSharedPtr msg, const std::size_t camera_id)
+{
+  // a camera which sends a new image before the others flushes the incomplete batch, so that a
+  // stopped camera can not block the other ones
+  if (pending_images_[camera_id]) {
+    inferPendingImages();
+  }
+  pending_images_[camera_id] = msg;
+
+  const bool is_batch_complete = std::all_of(
+    pending_images_.begin(), pending_images_.end(), [](const auto & image) { return !!image; });
+  if (is_batch_complete) {
+    inferPendingImages();
+  }
+}
+
+void TrtYoloXNode::inferPendingImages()
 {
   stop_watch_ptr_->toc("processing_time", true);
-  tier4_perception_msgs::msg::DetectedObjectsWithFeature out_objects;
 
-  cv_bridge::CvImagePtr in_image_ptr;
-  try {
-    in_image_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::BGR8);
-  } catch (cv_bridge::Exception & e) {
-    RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+  std::vector<cv_bridge::CvImagePtr> in_image_ptrs(num_cameras_);
+  for (std::size_t camera_id = 0; camera_id < num_cameras_; ++camera_id) {
+    if (!pending_images_[camera_id]) {
+      continue;
+    }
+    try {
+      in_image_ptrs[camera_id] =
+        cv_bridge::toCvCopy(pending_images_[camera_id], sensor_msgs::image_encodings::BGR8);
+    } catch (cv_bridge::Exception & e) {
+      RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+    }
+  }
+  const auto msgs = pending_images_;
+  std::fill(pending_images_.begin(), pending_images_.end(), nullptr);
+
+  const auto reference_image_ptr = std::find_if(
+    in_image_ptrs.begin(), in_image_ptrs.end(), [](const auto & ptr) { return !!ptr; });
+  if (reference_image_ptr == in_image_ptrs.end()) {
     return;
   }
-  const auto width = in_image_ptr->image.cols;
-  const auto height = in_image_ptr->image.rows;
+  const auto width = (*reference_image_ptr)->image.cols;
+  const auto height = (*reference_image_ptr)->image.rows;
+
+  // the batch has a fixed size and a single resolution. The slots of the cameras without a valid
+  // image are filled with another image of the batch, and their results are discarded.
+  std::vector<cv::Mat> images;
+  for (auto & in_image_ptr : in_image_ptrs) {
+    if (in_image_ptr && (in_image_ptr->image.cols != width || in_image_ptr->image.rows != height)) {
+      RCLCPP_WARN_THROTTLE(
+        this->get_logger(), *this->get_clock(), 5000,
+        "All the cameras should have the same resolution for batched inference.");
+      in_image_ptr.reset();
+    }
+    images.push_back(in_image_ptr ? in_image_ptr->image : (*reference_image_ptr)->image);
+  }
 
   tensorrt_yolox::ObjectArrays objects;
-  std::vector<cv::Mat> masks = {cv::Mat(cv::Size(height, width), CV_8UC1, cv::Scalar(0))};
-  std::vector<cv::Mat> color_masks = {
-    cv::Mat(cv::Size(height, width), CV_8UC3, cv::Scalar(0, 0, 0))};
+  std::vector<cv::Mat> masks;
+  std::vector<cv::Mat> color_masks;
+  for (std::size_t camera_id = 0; camera_id < num_cameras_; ++camera_id) {
+    masks.emplace_back(cv::Size(height, width), CV_8UC1, cv::Scalar(0));
+    color_masks.emplace_back(cv::Size(height, width), CV_8UC3, cv::Scalar(0, 0, 0));
+  }
 
-  if (!trt_yolox_->doInference({in_image_ptr->image}, objects, masks, color_masks)) {
+  if (!trt_yolox_->doInference(images, objects, masks, color_masks)) {
     RCLCPP_WARN(this->get_logger(), "Fail to inference");
     return;
   }
-  auto & mask = masks.at(0);
 
-  for (const auto & yolox_object : objects.at(0)) {
+  std::optional<rclcpp::Time> oldest_stamp;
+  for (std::size_t camera_id = 0; camera_id < num_cameras_; ++camera_id) {
+    if (!in_image_ptrs[camera_id]) {
+      continue;
+    }
+    publishResults(
+      camera_id, msgs[camera_id], in_image_ptrs[camera_id], objects.at(camera_id),
+      masks.at(camera_id));
+    const rclcpp::Time stamp(msgs[camera_id]->header.stamp);
+    if (!oldest_stamp || stamp < *oldest_stamp) {
+      oldest_stamp = stamp;
+    }
+  }
+
+  if (debug_publisher_ && oldest_stamp) {
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double pipeline_latency_ms =
+      std::chrono::duration<double, std::milli>(
+        std::chrono::nanoseconds((this->get_clock()->now() - *oldest_stamp).nanoseconds()))
+        .count();
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/pipeline_latency_ms", pipeline_latency_ms);
+  }
+}
+
+void TrtYoloXNode::publishResults(
+  const std::size_t camera_id, const sensor_msgs::msg::Image::ConstSharedPtr & msg,
+  cv_bridge::CvImagePtr & in_image_ptr, const tensorrt_yolox::ObjectArray & yolox_objects,
+  cv::Mat & mask)
+{
+  tier4_perception_msgs::msg::DetectedObjectsWithFeature out_objects;
+  const auto width = in_image_ptr->image.cols;
+  const auto height = in_image_ptr->image.rows;
+
+  for (const auto & yolox_object : yolox_objects) {
     tier4_perception_msgs::msg::DetectedObjectWithFeature object;
     object.feature.roi.x_offset = yolox_object.x_offset;
     object.feature.roi.y_offset = yolox_object.y_offset;
@@ -199,27 +313,11 @@ void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
       std::memcpy(&out_mask_msg->data[i * step], &compressed_data.at(i).first, sizeof(uint8_t));
       std::memcpy(&out_mask_msg->data[i * step + 1], &compressed_data.at(i).second, sizeof(int));
     }
-    mask_pub_.publish(out_mask_msg);
+    mask_pubs_[camera_id].publish(out_mask_msg);
   }
-  image_pub_.publish(in_image_ptr->toImageMsg());
+  image_pubs_[camera_id].publish(in_image_ptr->toImageMsg());
   out_objects.header = msg->header;
-  objects_pub_->publish(out_objects);
-
-  if (debug_publisher_) {
-    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
-    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
-    const double pipeline_latency_ms =
-      std::chrono::duration<double, std::milli>(
-        std::chrono::nanoseconds(
-          (this->get_clock()->now() - out_objects.header.stamp).nanoseconds()))
-        .count();
-    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
-      "debug/cyclic_time_ms", cyclic_time_ms);
-    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
-      "debug/processing_time_ms", processing_time_ms);
-    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
-      "debug/pipeline_latency_ms", pipeline_latency_ms);
-  }
+  objects_pubs_[camera_id]->publish(out_objects);
 
   if (is_publish_color_mask_ && trt_yolox_->getMultitaskNum() > 0) {
     cv::Mat color_mask = cv::Mat::zeros(mask.rows, mask.cols, CV_8UC3);
@@ -228,7 +326,7 @@ void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
       cv_bridge::CvImage(std_msgs::msg::Header(), sensor_msgs::image_encodings::BGR8, color_mask)
         .toImageMsg();
     output_color_mask_msg->header = msg->header;
-    color_mask_pub_.publish(output_color_mask_msg);
+    color_mask_pubs_[camera_id].publish(output_color_mask_msg);
   }
 }
 
@@ -19,6 +19,7 @@
 #include "autoware/object_recognition_utils/object_recognition_utils.hpp"
 #include "autoware/tracking_object_merger/association/solver/ssp.hpp"
 #include "autoware/tracking_object_merger/utils/utils.hpp"
+#include "autoware/universe_utils/ros/uuid_helper.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -44,11 +45,28 @@ double getUnixTime(const std_msgs::msg::Header & header)
   return header.stamp.sec + header.stamp.nanosec * 1e-9;
 }
 
-// calc association score matrix
+// get data association by input and trackers measurement state
+// we assume that lidar and radar are exclusive
+const DataAssociation & getDataAssociation(
+  const MEASUREMENT_STATE measurement_state, const MEASUREMENT_STATE tracker_state,
+  const std::unordered_map<std::string, std::unique_ptr<DataAssociation>> & data_association_map)
+{
+  const auto input_has_lidar = measurement_state & MEASUREMENT_STATE::LIDAR;
+  const auto tracker_has_lidar = tracker_state & MEASUREMENT_STATE::LIDAR;
+  if (input_has_lidar && tracker_has_lidar) {
+    return *data_association_map.at("lidar-lidar");
+  } else if (!input_has_lidar && !tracker_has_lidar) {
+    return *data_association_map.at("radar-radar");
+  }
+  return *data_association_map.at("lidar-radar");
+}
+
+// calc association score matrix between the given trackers and input objects
 Eigen::MatrixXd calcScoreMatrixForAssociation(
   const MEASUREMENT_STATE measurement_state,
   const autoware_perception_msgs::msg::TrackedObjects & objects0,
-  const std::vector<TrackerState> & trackers,
+  const std::vector<size_t> & objects0_indices, const std::vector<TrackerState> & trackers,
+  const std::vector<size_t> & trackers_indices,
   const std::unordered_map<std::string, std::unique_ptr<DataAssociation>> & data_association_map
   // const bool debug_log, const std::string & file_name // do not logging for now
 )
@@ -57,27 +75,19 @@ Eigen::MatrixXd calcScoreMatrixForAssociation(
   const rclcpp::Time current_time = rclcpp::Time(objects0.header.stamp);
 
   // calc score matrix
-  Eigen::MatrixXd score_matrix = Eigen::MatrixXd::Zero(trackers.size(), objects0.objects.size());
-  for (size_t trackers_idx = 0; trackers_idx < trackers.size(); ++trackers_idx) {
-    const auto & tracker_obj = trackers.at(trackers_idx);
+  Eigen::MatrixXd score_matrix =
+    Eigen::MatrixXd::Zero(trackers_indices.size(), objects0_indices.size());
+  for (size_t row = 0; row < trackers_indices.size(); ++row) {
+    const auto & tracker_obj = trackers.at(trackers_indices.at(row));
     const auto & object1 = tracker_obj.getObject();
-    const auto & tracker_state = tracker_obj.getCurrentMeasurementState(current_time);
-
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
-      const auto & object0 = objects0.objects.at(objects0_idx);
-      // switch calc score function by input and trackers measurement state
-      // we assume that lidar and radar are exclusive
-      double score;
-      const auto input_has_lidar = measurement_state & MEASUREMENT_STATE::LIDAR;
-      const auto tracker_has_lidar = tracker_state & MEASUREMENT_STATE::LIDAR;
-      if (input_has_lidar && tracker_has_lidar) {
-        score = data_association_map.at("lidar-lidar")->calcScoreBetweenObjects(object0, object1);
-      } else if (!input_has_lidar && !tracker_has_lidar) {
-        score = data_association_map.at("radar-radar")->calcScoreBetweenObjects(object0, object1);
-      } else {
-        score = data_association_map.at("lidar-radar")->calcScoreBetweenObjects(object0, object1);
-      }
-      score_matrix(trackers_idx, objects0_idx) = score;
+    const auto & data_association = getDataAssociation(
+      measurement_state, tracker_obj.getCurrentMeasurementState(current_time),
+      data_association_map);
+
+    for (size_t col = 0; col < objects0_indices.size(); ++col) {
+      // the distance gate comes first, so the far pairs are rejected cheaply
+      const auto & object0 = objects0.objects.at(objects0_indices.at(col));
+      score_matrix(row, col) = data_association.calcScoreBetweenObjects(object0, object1);
     }
   }
   return score_matrix;
@@ -302,16 +312,62 @@ bool DecorativeTrackerMergerNode::decorativeMerger(
     object.predict(current_time);
   }
 
-  // TODO(yoshiri): pre-association
-
   // associate inner objects and input objects
-  /* global nearest neighbor */
   std::unordered_map<int, int> direct_assignment, reverse_assignment;
   const auto & objects1 = input_objects_msg->objects;
-  Eigen::MatrixXd score_matrix = calcScoreMatrixForAssociation(
-    input_sensor, *input_objects_msg, inner_tracker_objects_, data_association_map_);
-  data_association_map_.at("lidar-lidar")
-    ->assign(score_matrix, direct_assignment, reverse_assignment);
+
+  /* pre-association */
+  // keep the association of the previous frame as long as the pair still passes the gates, as
+  // the input tracker keeps the uuid of the object
+  std::unordered_map<std::string, int> tracker_idx_map;
+  for (int tracker_idx = 0; tracker_idx < static_cast<int>(inner_tracker_objects_.size());
+       ++tracker_idx) {
+    const auto & input_uuid = inner_tracker_objects_.at(tracker_idx).input_uuid_map_;
+    const auto itr = input_uuid.find(input_sensor);
+    if (itr != input_uuid.end() && itr->second) {
+      tracker_idx_map.emplace(autoware::universe_utils::toHexString(*itr->second), tracker_idx);
+    }
+  }
+  std::vector<size_t> unassigned_object1_indices;
+  for (int object1_idx = 0; object1_idx < static_cast<int>(objects1.size()); ++object1_idx) {
+    const auto & object1 = objects1.at(object1_idx);
+    const auto itr =
+      tracker_idx_map.find(autoware::universe_utils::toHexString(object1.object_id));
+    if (itr != tracker_idx_map.end() && direct_assignment.count(itr->second) == 0) {
+      const auto & tracker = inner_tracker_objects_.at(itr->second);
+      const auto & data_association = getDataAssociation(
+        input_sensor, tracker.getCurrentMeasurementState(current_time), data_association_map_);
+      if (data_association.calcScoreBetweenObjects(object1, tracker.getObject()) > 0.0) {
+        direct_assignment[itr->second] = object1_idx;
+        reverse_assignment[object1_idx] = itr->second;
+        continue;
+      }
+    }
+    unassigned_object1_indices.push_back(object1_idx);
+  }
+
+  /* global nearest neighbor */
+  // only between the trackers and the input objects not pre-associated
+  std::vector<size_t> unassigned_tracker_indices;
+  for (size_t tracker_idx = 0; tracker_idx < inner_tracker_objects_.size(); ++tracker_idx) {
+    if (direct_assignment.count(static_cast<int>(tracker_idx)) == 0) {
+      unassigned_tracker_indices.push_back(tracker_idx);
+    }
+  }
+  if (!unassigned_tracker_indices.empty() && !unassigned_object1_indices.empty()) {
+    std::unordered_map<int, int> gnn_direct_assignment, gnn_reverse_assignment;
+    Eigen::MatrixXd score_matrix = calcScoreMatrixForAssociation(
+      input_sensor, *input_objects_msg, unassigned_object1_indices, inner_tracker_objects_,
+      unassigned_tracker_indices, data_association_map_);
+    data_association_map_.at("lidar-lidar")
+      ->assign(score_matrix, gnn_direct_assignment, gnn_reverse_assignment);
+    for (const auto & [row, col] : gnn_direct_assignment) {
+      const int tracker_idx = static_cast<int>(unassigned_tracker_indices.at(row));
+      const int object1_idx = static_cast<int>(unassigned_object1_indices.at(col));
+      direct_assignment[tracker_idx] = object1_idx;
+      reverse_assignment[object1_idx] = tracker_idx;
+    }
+  }
 
   // look for tracker
   for (int tracker_idx = 0; tracker_idx < static_cast<int>(inner_tracker_objects_.size());
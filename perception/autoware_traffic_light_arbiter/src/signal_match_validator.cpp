@@ -22,24 +22,26 @@ using Element = autoware_perception_msgs::msg::TrafficLightElement;
 using Time = builtin_interfaces::msg::Time;
 
 // Finds a signal by its ID within a TrafficSignalArray
-std::optional<TrafficSignal> find_signal_by_id(
-  const std::unordered_map<lanelet::Id, TrafficSignal> & id_signal_map, int64_t signal_id)
+const TrafficSignal * find_signal_by_id(
+  const std::unordered_map<lanelet::Id, const TrafficSignal *> & id_signal_map, int64_t signal_id)
 {
   auto it = id_signal_map.find(signal_id);
   if (it != id_signal_map.end()) {
     return it->second;  // Return the found signal
   } else {
-    return std::nullopt;  // Return an empty optional if not found
+    return nullptr;  // Return nullptr if not found
   }
 }
 
-// Creates a map from signal IDs to TrafficSignal objects.
-std::unordered_map<lanelet::Id, TrafficSignal> create_id_signal_map(
+// Creates a map from signal IDs to the TrafficSignal objects, which refers to the given array to
+// avoid copying the signals
+std::unordered_map<lanelet::Id, const TrafficSignal *> create_id_signal_map(
   const TrafficSignalArray & traffic_signals)
 {
-  std::unordered_map<lanelet::Id, TrafficSignal> id_signal_map;
+  std::unordered_map<lanelet::Id, const TrafficSignal *> id_signal_map;
+  id_signal_map.reserve(traffic_signals.traffic_light_groups.size());
   for (const auto & traffic_signal : traffic_signals.traffic_light_groups) {
-    id_signal_map[traffic_signal.traffic_light_group_id] = traffic_signal;
+    id_signal_map[traffic_signal.traffic_light_group_id] = &traffic_signal;
   }
 
   return id_signal_map;
@@ -139,6 +141,7 @@ std::unordered_set<lanelet::Id> create_signal_id_set(
   const std::vector<TrafficSignal> & signals1, const std::vector<TrafficSignal> & signals2)
 {
   std::unordered_set<lanelet::Id> signal_id_set;
+  signal_id_set.reserve(signals1.size() + signals2.size());
   for (const auto & traffic_signal : signals1) {
     signal_id_set.emplace(traffic_signal.traffic_light_group_id);
   }
@@ -151,8 +154,8 @@ std::unordered_set<lanelet::Id> create_signal_id_set(
 
 // Returns the signal with the highest confidence elements, considering a external priority
 TrafficSignal get_highest_confidence_signal(
-  const std::optional<TrafficSignal> & perception_signal,
-  const std::optional<TrafficSignal> & external_signal, const bool external_priority)
+  const TrafficSignal * perception_signal, const TrafficSignal * external_signal,
+  const bool external_priority)
 {
   // Returns the existing signal if only one of them exists
   if (!perception_signal) {
@@ -222,6 +225,7 @@ autoware_perception_msgs::msg::TrafficLightGroupArray SignalMatchValidator::vali
   // then compare the signal element for each received signal id
   const auto received_signal_id_set = util::create_signal_id_set(
     perception_signals.traffic_light_groups, external_signals.traffic_light_groups);
+  validated_signals.traffic_light_groups.reserve(received_signal_id_set.size());
 
   for (const auto & signal_id : received_signal_id_set) {
     const auto perception_result = util::find_signal_by_id(perception_id_signal_map, signal_id);
@@ -270,6 +274,7 @@ autoware_perception_msgs::msg::TrafficLightGroupArray SignalMatchValidator::vali
 void SignalMatchValidator::setPedestrianSignals(
   const std::vector<TrafficLightConstPtr> & pedestrian_signals)
 {
+  map_pedestrian_signal_regulatory_elements_set_.clear();
   for (const auto & pedestrian_signal : pedestrian_signals) {
     map_pedestrian_signal_regulatory_elements_set_.emplace(pedestrian_signal->id());
   }
@@ -30,6 +30,23 @@ public:
   virtual bool getTrafficSignals(
     const std::vector<cv::Mat> & input_image,
     tier4_perception_msgs::msg::TrafficLightArray & traffic_signals) = 0;
+
+  /**
+   * @brief classify the traffic lights within the rois of a single image
+   *
+   * The default implementation crops the rois and classifies the crops.
+   */
+  virtual bool getTrafficSignals(
+    const cv::Mat & image, const std::vector<cv::Rect> & rois,
+    tier4_perception_msgs::msg::TrafficLightArray & traffic_signals)
+  {
+    std::vector<cv::Mat> images;
+    images.reserve(rois.size());
+    for (const auto & roi : rois) {
+      images.emplace_back(image(roi));
+    }
+    return getTrafficSignals(images, traffic_signals);
+  }
 };
 }  // namespace autoware::traffic_light
 
@@ -50,14 +50,20 @@ CNNClassifier::CNNClassifier(rclcpp::Node * node_ptr) : node_ptr_(node_ptr)
     return;
   }
 
+  preprocess_on_gpu_ = node_ptr_->declare_parameter("classifier_preprocess_on_gpu", false);
+  const int max_batch_size = node_ptr_->declare_parameter("classifier_max_batch_size", 32);
+
   readLabelfile(label_file_path, labels_);
   nvinfer1::Dims input_dim = autoware::tensorrt_common::get_input_dims(model_file_path);
-  assert(input_dim.d[0] > 0);
-  batch_size_ = input_dim.d[0];
+  is_dynamic_batch_ = input_dim.d[0] <= 0;
+  batch_size_ = is_dynamic_batch_ ? max_batch_size : input_dim.d[0];
 
-  autoware::tensorrt_common::BatchConfig batch_config{batch_size_, batch_size_, batch_size_};
+  autoware::tensorrt_common::BatchConfig batch_config{
+    is_dynamic_batch_ ? 1 : batch_size_, batch_size_, batch_size_};
   classifier_ = std::make_unique<autoware::tensorrt_classifier::TrtClassifier>(
-    model_file_path, precision, batch_config, mean_, std_);
+    model_file_path, precision, batch_config, mean_, std_, (1 << 30), "",
+    autoware::tensorrt_common::BuildConfig("MinMax", -1, false, false, false, 0.0),
+    preprocess_on_gpu_);
   if (node_ptr_->declare_parameter("build_only", false)) {
     RCLCPP_INFO(node_ptr_->get_logger(), "TensorRT engine is built and shutdown node.");
     rclcpp::shutdown();
@@ -79,13 +85,14 @@ bool CNNClassifier::getTrafficSignals(
     image_batch.emplace_back(images[image_i]);
     // keep the actual batch size
     size_t true_batch_size = image_batch.size();
+    const bool is_last = image_i + 1 == images.size();
     // insert fake image since the TRT model requires static batch size
-    if (image_i + 1 == images.size()) {
+    if (is_last && !is_dynamic_batch_) {
       while (static_cast<int>(image_batch.size()) < batch_size_) {
         image_batch.emplace_back(image_batch.front());
       }
     }
-    if (static_cast<int>(image_batch.size()) == batch_size_) {
+    if (static_cast<int>(image_batch.size()) == batch_size_ || is_last) {
       std::vector<float> probabilities;
       std::vector<int> classes;
       bool res = classifier_->doInference(image_batch, classes, probabilities);
@@ -106,6 +113,54 @@ bool CNNClassifier::getTrafficSignals(
   return true;
 }
 
+bool CNNClassifier::getTrafficSignals(
+  const cv::Mat & image, const std::vector<cv::Rect> & rois,
+  tier4_perception_msgs::msg::TrafficLightArray & traffic_signals)
+{
+  if (!preprocess_on_gpu_) {
+    return ClassifierInterface::getTrafficSignals(image, rois, traffic_signals);
+  }
+  if (rois.size() != traffic_signals.signals.size()) {
+    RCLCPP_WARN(node_ptr_->get_logger(), "roi number should be equal to traffic signal number!");
+    return false;
+  }
+  // the whole image is uploaded once per batch, and the rois are cropped and resized on the GPU
+  std::vector<cv::Rect> roi_batch;
+  int signal_i = 0;
+
+  for (size_t roi_i = 0; roi_i < rois.size(); roi_i++) {
+    roi_batch.emplace_back(rois[roi_i]);
+    // keep the actual batch size
+    size_t true_batch_size = roi_batch.size();
+    const bool is_last = roi_i + 1 == rois.size();
+    // insert fake roi since the TRT model requires static batch size
+    if (is_last && !is_dynamic_batch_) {
+      while (static_cast<int>(roi_batch.size()) < batch_size_) {
+        roi_batch.emplace_back(roi_batch.front());
+      }
+    }
+    if (static_cast<int>(roi_batch.size()) == batch_size_ || is_last) {
+      std::vector<float> probabilities;
+      std::vector<int> classes;
+      bool res = classifier_->doMultiScaleInference(image, roi_batch, classes, probabilities);
+      if (!res || classes.empty() || probabilities.empty()) {
+        return false;
+      }
+      for (size_t i = 0; i < true_batch_size; i++) {
+        postProcess(classes[i], probabilities[i], traffic_signals.signals[signal_i]);
+        /* debug */
+        if (0 < image_pub_.getNumSubscribers()) {
+          cv::Mat debug_image = image(roi_batch[i]).clone();
+          outputDebugImage(debug_image, traffic_signals.signals[signal_i]);
+        }
+        signal_i++;
+      }
+      roi_batch.clear();
+    }
+  }
+  return true;
+}
+
 void CNNClassifier::outputDebugImage(
   cv::Mat & debug_image, const tier4_perception_msgs::msg::TrafficLight & traffic_signal)
 {
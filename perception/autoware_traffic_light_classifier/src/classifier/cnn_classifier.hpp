@@ -59,6 +59,10 @@ public:
     const std::vector<cv::Mat> & images,
     tier4_perception_msgs::msg::TrafficLightArray & traffic_signals) override;
 
+  bool getTrafficSignals(
+    const cv::Mat & image, const std::vector<cv::Rect> & rois,
+    tier4_perception_msgs::msg::TrafficLightArray & traffic_signals) override;
+
 private:
   void postProcess(
     int class_index, float prob, tier4_perception_msgs::msg::TrafficLight & traffic_signal);
@@ -112,6 +116,9 @@ private:
 
   rclcpp::Node * node_ptr_;
   int batch_size_;
+  // a model with a dynamic batch is run with the actual number of rois, up to batch_size_
+  bool is_dynamic_batch_;
+  bool preprocess_on_gpu_;
   std::unique_ptr<autoware::tensorrt_classifier::TrtClassifier> classifier_;
   image_transport::Publisher image_pub_;
   std::vector<std::string> labels_;
@@ -62,6 +62,7 @@ public:
   explicit ColorClassifier(rclcpp::Node * node_ptr);
   virtual ~ColorClassifier() = default;
 
+  using ClassifierInterface::getTrafficSignals;
   bool getTrafficSignals(
     const std::vector<cv::Mat> & images,
     tier4_perception_msgs::msg::TrafficLightArray & traffic_signals) override;
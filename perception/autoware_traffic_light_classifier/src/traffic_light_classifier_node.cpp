@@ -102,7 +102,7 @@ void TrafficLightClassifierNodelet::imageRoiCallback(
 
   output_msg.signals.resize(input_rois_msg->rois.size());
 
-  std::vector<cv::Mat> images;
+  std::vector<cv::Rect> rois;
   std::vector<size_t> backlight_indices;
   size_t idx_valid_roi = 0;
   for (const auto & input_roi : input_rois_msg->rois) {
@@ -120,18 +120,18 @@ void TrafficLightClassifierNodelet::imageRoiCallback(
     output_msg.signals[idx_valid_roi].traffic_light_type = input_roi.traffic_light_type;
 
     const sensor_msgs::msg::RegionOfInterest & roi = input_roi.roi;
-    auto roi_img = cv_ptr->image(cv::Rect(roi.x_offset, roi.y_offset, roi.width, roi.height));
-    if (is_harsh_backlight(roi_img)) {
+    const cv::Rect rect(roi.x_offset, roi.y_offset, roi.width, roi.height);
+    if (is_harsh_backlight(cv_ptr->image(rect))) {
       backlight_indices.emplace_back(idx_valid_roi);
     }
-    images.emplace_back(roi_img);
+    rois.emplace_back(rect);
     idx_valid_roi++;
   }
 
-  // classify the images
-  output_msg.signals.resize(images.size());
-  if (!images.empty()) {
-    if (!classifier_ptr_->getTrafficSignals(images, output_msg)) {
+  // classify the rois of the image
+  output_msg.signals.resize(rois.size());
+  if (!rois.empty()) {
+    if (!classifier_ptr_->getTrafficSignals(cv_ptr->image, rois, output_msg)) {
       RCLCPP_ERROR(this->get_logger(), "failed classify image, abort callback");
       return;
     }
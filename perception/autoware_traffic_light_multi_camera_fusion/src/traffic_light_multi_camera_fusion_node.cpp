@@ -21,6 +21,8 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace
@@ -48,8 +50,8 @@ int calVisibleScore(const autoware::traffic_light::FusionRecord & record)
   uint32_t y1 = record.roi.roi.y_offset;
   uint32_t y2 = record.roi.roi.y_offset + record.roi.roi.height;
   if (
-    x1 <= boundary || (record.cam_info.width - x2) <= boundary || y1 <= boundary ||
-    (record.cam_info.height - y2) <= boundary) {
+    x1 <= boundary || (record.cam_info->width - x2) <= boundary || y1 <= boundary ||
+    (record.cam_info->height - y2) <= boundary) {
     return 0;
   } else {
     return 1;
@@ -185,20 +187,41 @@ void MultiCameraFusion::trafficSignalRoiCallback(
   const CamInfoType::ConstSharedPtr cam_info_msg, const RoiArrayType::ConstSharedPtr roi_msg,
   const SignalArrayType::ConstSharedPtr signal_msg)
 {
-  rclcpp::Time stamp(roi_msg->header.stamp);
+  /*
+  match the rois with the signals once, instead of searching the signal of every roi on every
+  fusion
+  */
+  std::unordered_map<IdType, const SignalType *> id_to_signal;
+  id_to_signal.reserve(signal_msg->signals.size());
+  for (const auto & signal : signal_msg->signals) {
+    id_to_signal.emplace(signal.traffic_light_id, &signal);
+  }
+  FusionRecordArr record_arr{cam_info_msg->header, {}};
+  record_arr.records.reserve(roi_msg->rois.size());
+  std::unordered_set<IdType> updated_traffic_light_ids;
+  for (const auto & roi : roi_msg->rois) {
+    const auto signal_it = id_to_signal.find(roi.traffic_light_id);
+    /*
+    failed to find corresponding signal. skip it
+    */
+    if (signal_it == id_to_signal.end()) {
+      continue;
+    }
+    record_arr.records.push_back(
+      FusionRecord{record_arr.header, cam_info_msg, roi, *signal_it->second});
+    updated_traffic_light_ids.insert(roi.traffic_light_id);
+  }
   /*
   Insert the received record array to the table.
   Attention should be payed that this record array might not have the newest timestamp
   */
-  record_arr_set_.insert(
-    FusionRecordArr{cam_info_msg->header, *cam_info_msg, *roi_msg, *signal_msg});
+  record_arr_set_.insert(std::move(record_arr));
 
-  std::map<IdType, FusionRecord> fused_record_map, grouped_record_map;
-  multiCameraFusion(fused_record_map);
-  groupFusion(fused_record_map, grouped_record_map);
+  multiCameraFusion(updated_traffic_light_ids);
+  groupFusion(updated_traffic_light_ids);
 
   NewSignalArrayType msg_out;
-  convertOutputMsg(grouped_record_map, msg_out);
+  convertOutputMsg(grouped_record_map_, msg_out);
   msg_out.stamp = cam_info_msg->header.stamp;
   signal_pub_->publish(msg_out);
 }
@@ -206,6 +229,8 @@ void MultiCameraFusion::trafficSignalRoiCallback(
 void MultiCameraFusion::mapCallback(
   const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr input_msg)
 {
+  traffic_light_id_to_regulatory_ele_id_.clear();
+  regulatory_ele_id_to_traffic_light_id_.clear();
   lanelet::LaneletMapPtr lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
 
   lanelet::utils::conversion::fromBinMsg(*input_msg, lanelet_map_ptr);
@@ -219,8 +244,23 @@ void MultiCameraFusion::mapCallback(
     auto lights = tl->trafficLights();
     for (const auto & light : lights) {
       traffic_light_id_to_regulatory_ele_id_[light.id()].emplace_back(tl->id());
+      regulatory_ele_id_to_traffic_light_id_[tl->id()].emplace_back(light.id());
     }
   }
+  /*
+  a regulatory element is shared by the lanelets it belongs to, so remove the duplicates
+  */
+  const auto sort_and_unique = [](std::vector<lanelet::Id> & ids) {
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  };
+  for (auto & p : traffic_light_id_to_regulatory_ele_id_) {
+    sort_and_unique(p.second);
+  }
+  for (auto & p : regulatory_ele_id_to_traffic_light_id_) {
+    sort_and_unique(p.second);
+  }
+  is_map_updated_ = true;
 }
 
 void MultiCameraFusion::convertOutputMsg(
@@ -239,9 +279,8 @@ void MultiCameraFusion::convertOutputMsg(
   }
 }
 
-void MultiCameraFusion::multiCameraFusion(std::map<IdType, FusionRecord> & fused_record_map)
+void MultiCameraFusion::multiCameraFusion(std::unordered_set<IdType> & updated_traffic_light_ids)
 {
-  fused_record_map.clear();
   /*
   this should not happen. Just in case
   */
@@ -249,74 +288,94 @@ void MultiCameraFusion::multiCameraFusion(std::map<IdType, FusionRecord> & fused
     RCLCPP_ERROR(get_logger(), "record_arr_set_ is empty! This should not happen");
     return;
   }
+  /*
+  remove all old record arrays whose timestamp difference with newest record is larger than
+  threshold. the traffic lights in them have to be fused again without them
+  */
   const rclcpp::Time & newest_stamp(record_arr_set_.rbegin()->header.stamp);
   for (auto it = record_arr_set_.begin(); it != record_arr_set_.end();) {
-    /*
-    remove all old record arrays whose timestamp difference with newest record is larger than
-    threshold
-    */
     if (
       (newest_stamp - rclcpp::Time(it->header.stamp)) >
       rclcpp::Duration::from_seconds(message_lifespan_)) {
+      for (const auto & record : it->records) {
+        updated_traffic_light_ids.insert(record.roi.traffic_light_id);
+      }
       it = record_arr_set_.erase(it);
     } else {
+      it++;
+    }
+  }
+
+  /*
+  generate fused record result of the updated traffic lights with the saved records. the others
+  keep their results, as none of their records is added or removed
+  */
+  for (const auto & id : updated_traffic_light_ids) {
+    fused_record_map_.erase(id);
+  }
+  for (const auto & record_arr : record_arr_set_) {
+    for (const auto & record : record_arr.records) {
+      const auto & id = record.roi.traffic_light_id;
+      if (updated_traffic_light_ids.count(id) == 0) {
+        continue;
+      }
       /*
-      generate fused record result with the saved records
+      if this traffic light is not detected yet or can be updated by higher priority record,
+      update it
       */
-      const FusionRecordArr & record_arr = *it;
-      for (size_t i = 0; i < record_arr.rois.rois.size(); i++) {
-        const RoiType & roi = record_arr.rois.rois[i];
-        auto signal_it = std::find_if(
-          record_arr.signals.signals.begin(), record_arr.signals.signals.end(),
-          [roi](const SignalType & s1) { return roi.traffic_light_id == s1.traffic_light_id; });
-        /*
-        failed to find corresponding signal. skip it
-        */
-        if (signal_it == record_arr.signals.signals.end()) {
-          continue;
-        }
-        FusionRecord record{record_arr.header, record_arr.cam_info, roi, *signal_it};
-        /*
-        if this traffic light is not detected yet or can be updated by higher priority record,
-        update it
-        */
-        if (
-          fused_record_map.find(roi.traffic_light_id) == fused_record_map.end() ||
-          ::compareRecord(record, fused_record_map[roi.traffic_light_id]) >= 0) {
-          fused_record_map[roi.traffic_light_id] = record;
-        }
+      const auto fused_it = fused_record_map_.find(id);
+      if (fused_it == fused_record_map_.end()) {
+        fused_record_map_.emplace(id, record);
+      } else if (::compareRecord(record, fused_it->second) >= 0) {
+        fused_it->second = record;
       }
-      it++;
     }
   }
 }
 
-void MultiCameraFusion::groupFusion(
-  std::map<IdType, FusionRecord> & fused_record_map,
-  std::map<IdType, FusionRecord> & grouped_record_map)
+void MultiCameraFusion::groupFusion(const std::unordered_set<IdType> & updated_traffic_light_ids)
 {
-  grouped_record_map.clear();
-  for (const auto & p : fused_record_map) {
-    IdType roi_id = p.second.roi.traffic_light_id;
-    /*
-    this should not happen
-    */
-    if (traffic_light_id_to_regulatory_ele_id_.count(roi_id) == 0) {
-      RCLCPP_WARN_STREAM(
-        get_logger(), "Found Traffic Light Id = " << roi_id << " which is not defined in Map");
-      continue;
+  /*
+  collect the groups to be fused again, which are all the groups when the map is updated
+  */
+  std::unordered_set<lanelet::Id> updated_reg_ele_ids;
+  if (is_map_updated_) {
+    grouped_record_map_.clear();
+    for (const auto & p : regulatory_ele_id_to_traffic_light_id_) {
+      updated_reg_ele_ids.insert(p.first);
     }
+    is_map_updated_ = false;
+  } else {
+    for (const auto & roi_id : updated_traffic_light_ids) {
+      const auto reg_ele_it = traffic_light_id_to_regulatory_ele_id_.find(roi_id);
+      /*
+      this should not happen
+      */
+      if (reg_ele_it == traffic_light_id_to_regulatory_ele_id_.end()) {
+        RCLCPP_WARN_STREAM(
+          get_logger(), "Found Traffic Light Id = " << roi_id << " which is not defined in Map");
+        continue;
+      }
+      updated_reg_ele_ids.insert(reg_ele_it->second.begin(), reg_ele_it->second.end());
+    }
+  }
 
-    /*
-    keep the best record for every regulatory element id
-    */
-    const auto reg_ele_id_vec =
-      traffic_light_id_to_regulatory_ele_id_[p.second.roi.traffic_light_id];
-    for (const auto & reg_ele_id : reg_ele_id_vec) {
-      if (
-        grouped_record_map.count(reg_ele_id) == 0 ||
-        ::compareRecord(p.second, grouped_record_map[reg_ele_id]) >= 0) {
-        grouped_record_map[reg_ele_id] = p.second;
+  /*
+  keep the best record for every regulatory element id, visiting its traffic lights in the
+  increasing id order
+  */
+  for (const auto & reg_ele_id : updated_reg_ele_ids) {
+    grouped_record_map_.erase(reg_ele_id);
+    for (const auto & roi_id : regulatory_ele_id_to_traffic_light_id_.at(reg_ele_id)) {
+      const auto fused_it = fused_record_map_.find(roi_id);
+      if (fused_it == fused_record_map_.end()) {
+        continue;
+      }
+      const auto grouped_it = grouped_record_map_.find(reg_ele_id);
+      if (grouped_it == grouped_record_map_.end()) {
+        grouped_record_map_.emplace(reg_ele_id, fused_it->second);
+      } else if (::compareRecord(fused_it->second, grouped_it->second) >= 0) {
+        grouped_it->second = fused_it->second;
       }
     }
   }
@@ -33,6 +33,8 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -44,17 +46,18 @@ namespace mf = message_filters;
 struct FusionRecord
 {
   std_msgs::msg::Header header;
-  sensor_msgs::msg::CameraInfo cam_info;
+  sensor_msgs::msg::CameraInfo::ConstSharedPtr cam_info;
   tier4_perception_msgs::msg::TrafficLightRoi roi;
   tier4_perception_msgs::msg::TrafficLight signal;
 };
 
+/*
+the records of a camera frame, whose rois are matched with the signals when the frame is received
+*/
 struct FusionRecordArr
 {
   std_msgs::msg::Header header;
-  sensor_msgs::msg::CameraInfo cam_info;
-  tier4_perception_msgs::msg::TrafficLightRoiArray rois;
-  tier4_perception_msgs::msg::TrafficLightArray signals;
+  std::vector<FusionRecord> records;
 };
 
 bool operator<(const FusionRecordArr & r1, const FusionRecordArr & r2)
@@ -85,14 +88,12 @@ private:
 
   void mapCallback(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr input_msg);
 
-  void multiCameraFusion(std::map<IdType, FusionRecord> & fused_record_map);
+  void multiCameraFusion(std::unordered_set<IdType> & updated_traffic_light_ids);
 
   void convertOutputMsg(
     const std::map<IdType, FusionRecord> & grouped_record_map, NewSignalArrayType & msg_out);
 
-  void groupFusion(
-    std::map<IdType, FusionRecord> & fused_record_map,
-    std::map<IdType, FusionRecord> & grouped_record_map);
+  void groupFusion(const std::unordered_set<IdType> & updated_traffic_light_ids);
 
   typedef mf::sync_policies::ExactTime<CamInfoType, RoiArrayType, SignalArrayType> ExactSyncPolicy;
   typedef mf::Synchronizer<ExactSyncPolicy> ExactSync;
@@ -109,9 +110,18 @@ private:
 
   rclcpp::Publisher<NewSignalArrayType>::SharedPtr signal_pub_;
   /*
-  the mapping from traffic light id (instance id) to regulatory element id (group id)
+  the mapping from traffic light id (instance id) to regulatory element id (group id), and its
+  inverse whose traffic light ids are sorted. both are built when the map is received
   */
-  std::map<lanelet::Id, std::vector<lanelet::Id>> traffic_light_id_to_regulatory_ele_id_;
+  std::unordered_map<lanelet::Id, std::vector<lanelet::Id>> traffic_light_id_to_regulatory_ele_id_;
+  std::unordered_map<lanelet::Id, std::vector<lanelet::Id>> regulatory_ele_id_to_traffic_light_id_;
+  /*
+  the fusion results kept between the callbacks. only the traffic lights observed in the received
+  record array or in the expired ones, and their groups, are fused again
+  */
+  std::unordered_map<IdType, FusionRecord> fused_record_map_;
+  std::map<IdType, FusionRecord> grouped_record_map_;
+  bool is_map_updated_{false};
   /*
   save record arrays by increasing timestamp order.
   use multiset in case there are multiple cameras publishing images at exactly the same time
@@ -16,8 +16,24 @@
 #include "occlusion_predictor.hpp"
 
 #include <algorithm>
+#include <limits>
+#include <optional>
 namespace
 {
+// a lidar point closer than this to a traffic light does not occlude it
+constexpr float min_dist_from_occlusion_to_tl = 5.0f;
+
+// bins of the integer part of the azimuth in [-180, 180] and of the elevation in [-90, 90]
+constexpr int num_azimuth_bins = 361;
+constexpr int num_elevation_bins = 181;
+
+std::optional<uint32_t> getRayBin(int azimuth, int elevation)
+{
+  if (azimuth < -180 || azimuth > 180 || elevation < -90 || elevation > 90) {
+    return std::nullopt;
+  }
+  return static_cast<uint32_t>((azimuth + 180) * num_elevation_bins + elevation + 90);
+}
 
 autoware::traffic_light::Ray point2ray(const pcl::PointXYZ & pt)
 {
@@ -85,47 +101,113 @@ void CloudOcclusionPredictor::predict(
     return;
   }
 
-  std::vector<pcl::PointXYZ> roi_tls(rois_msg->rois.size()), roi_brs(rois_msg->rois.size());
+  // the samples of the previous frame are only valid for the same camera model
+  if (
+    camera_info_msg->width != camera_info_.width ||
+    camera_info_msg->height != camera_info_.height ||
+    camera_info_msg->distortion_model != camera_info_.distortion_model ||
+    camera_info_msg->d != camera_info_.d || camera_info_msg->k != camera_info_.k ||
+    camera_info_msg->r != camera_info_.r || camera_info_msg->p != camera_info_.p ||
+    camera_info_msg->binning_x != camera_info_.binning_x ||
+    camera_info_msg->binning_y != camera_info_.binning_y ||
+    camera_info_msg->roi != camera_info_.roi) {
+    camera_info_ = *camera_info_msg;
+    roi_samples_.clear();
+  }
+
+  // sample the rois, or reuse the samples of the previous frame for the static traffic lights
   image_geometry::PinholeCameraModel pinhole_model;
   pinhole_model.fromCameraInfo(*camera_info_msg);
+  std::vector<RoiSamples> roi_samples(rois_msg->rois.size());
+  std::vector<const RoiSamples *> valid_roi_samples;
   for (size_t i = 0; i < rois_msg->rois.size(); i++) {
-    // skip if no detection
-    if (rois_msg->rois[i].roi.height == 0) {
+    const auto & roi = rois_msg->rois[i];
+    // skip if no detection, or if the traffic light is not in the map
+    if (roi.roi.height == 0 || traffic_light_position_map.count(roi.traffic_light_id) == 0) {
       continue;
     }
-    calcRoiVector3D(
-      rois_msg->rois[i], pinhole_model, traffic_light_position_map, tf_camera2map, roi_tls[i],
-      roi_brs[i]);
+    const double dist2cam =
+      (tf_camera2map * traffic_light_position_map.at(roi.traffic_light_id)).length();
+    roi_samples[i] = getRoiSamples(roi, pinhole_model, dist2cam);
+    valid_roi_samples.push_back(&roi_samples[i]);
+  }
+  roi_samples_.clear();
+  for (size_t i = 0; i < rois_msg->rois.size(); i++) {
+    if (!roi_samples[i].rays.empty()) {
+      const auto & roi = rois_msg->rois[i];
+      roi_samples_[{roi.traffic_light_id, roi.traffic_light_type}] = roi_samples[i];
+    }
   }
 
-  lidar_rays_.clear();
   // points in camera frame
   pcl::PointCloud<pcl::PointXYZ> cloud_camera;
-  // points within roi
-  pcl::PointCloud<pcl::PointXYZ> cloud_roi;
   autoware::universe_utils::transformPointCloudFromROSMsg(*cloud_msg, cloud_camera, camera2cloud);
+  updateLidarRays(cloud_camera, valid_roi_samples);
 
-  filterCloud(cloud_camera, roi_tls, roi_brs, cloud_roi);
+  for (size_t i = 0; i < rois_msg->rois.size(); i++) {
+    // the samples of an undetected roi or of a traffic light out of the map are never occluded
+    occlusion_ratios[i] = roi_samples[i].rays.empty() ? 0 : predict(roi_samples[i]);
+  }
+}
 
-  for (const pcl::PointXYZ & pt : cloud_roi) {
-    Ray ray = ::point2ray(pt);
-    lidar_rays_[static_cast<int>(ray.azimuth)][static_cast<int>(ray.elevation)].push_back(ray);
+RoiSamples CloudOcclusionPredictor::getRoiSamples(
+  const tier4_perception_msgs::msg::TrafficLightRoi & roi,
+  const image_geometry::PinholeCameraModel & pinhole_model, double dist2cam) const
+{
+  // a change of the distance within the tolerance, e.g. from the localization noise, moves the
+  // samples far less than the search resolution
+  constexpr double reuse_dist_tolerance = 0.01;
+  const auto iter = roi_samples_.find({roi.traffic_light_id, roi.traffic_light_type});
+  if (
+    iter != roi_samples_.end() && iter->second.roi == roi.roi &&
+    std::abs(iter->second.dist2cam - dist2cam) < reuse_dist_tolerance) {
+    return iter->second;
   }
-  for (size_t i = 0; i < roi_tls.size(); i++) {
-    occlusion_ratios[i] = rois_msg->rois[i].roi.height == 0 ? 0 : predict(roi_tls[i], roi_brs[i]);
+
+  const uint32_t horizontal_sample_num = 20;
+  const uint32_t vertical_sample_num = 20;
+  static_assert(horizontal_sample_num > 1);
+  static_assert(vertical_sample_num > 1);
+
+  RoiSamples samples;
+  samples.roi = roi.roi;
+  samples.dist2cam = dist2cam;
+  calcRoiVector3D(roi, pinhole_model, dist2cam, samples.top_left, samples.bottom_right);
+
+  pcl::PointCloud<pcl::PointXYZ> tl_sample_cloud;
+  sampleTrafficLightRoi(
+    samples.top_left, samples.bottom_right, horizontal_sample_num, vertical_sample_num,
+    tl_sample_cloud);
+  samples.rays.reserve(tl_sample_cloud.size());
+  samples.min_azimuth = std::numeric_limits<float>::max();
+  samples.max_azimuth = std::numeric_limits<float>::lowest();
+  samples.min_elevation = std::numeric_limits<float>::max();
+  samples.max_elevation = std::numeric_limits<float>::lowest();
+  samples.max_occluder_dist = std::numeric_limits<float>::lowest();
+  for (const pcl::PointXYZ & tl_pt : tl_sample_cloud) {
+    const Ray tl_ray = ::point2ray(tl_pt);
+    samples.rays.push_back(tl_ray);
+    samples.min_azimuth = std::min(samples.min_azimuth, tl_ray.azimuth);
+    samples.max_azimuth = std::max(samples.max_azimuth, tl_ray.azimuth);
+    samples.min_elevation = std::min(samples.min_elevation, tl_ray.elevation);
+    samples.max_elevation = std::max(samples.max_elevation, tl_ray.elevation);
+    samples.max_occluder_dist =
+      std::max(samples.max_occluder_dist, tl_ray.dist - min_dist_from_occlusion_to_tl);
   }
+  // with a small margin for the rounding of the angle differences in predict
+  constexpr float angle_margin_deg = 1e-3f;
+  samples.min_azimuth -= azimuth_occlusion_resolution_deg_ + angle_margin_deg;
+  samples.max_azimuth += azimuth_occlusion_resolution_deg_ + angle_margin_deg;
+  samples.min_elevation -= elevation_occlusion_resolution_deg_ + angle_margin_deg;
+  samples.max_elevation += elevation_occlusion_resolution_deg_ + angle_margin_deg;
+  return samples;
 }
 
 void CloudOcclusionPredictor::calcRoiVector3D(
   const tier4_perception_msgs::msg::TrafficLightRoi & roi,
-  const image_geometry::PinholeCameraModel & pinhole_model,
-  const std::map<lanelet::Id, tf2::Vector3> & traffic_light_position_map,
-  const tf2::Transform & tf_camera2map, pcl::PointXYZ & top_left, pcl::PointXYZ & bottom_right)
+  const image_geometry::PinholeCameraModel & pinhole_model, double dist2cam,
+  pcl::PointXYZ & top_left, pcl::PointXYZ & bottom_right)
 {
-  if (traffic_light_position_map.count(roi.traffic_light_id) == 0) {
-    return;
-  }
-  double dist2cam = (tf_camera2map * traffic_light_position_map.at(roi.traffic_light_id)).length();
   {
     cv::Point2d pixel(roi.roi.x_offset, roi.roi.y_offset);
     cv::Point2d rectified_pixel = pinhole_model.rectifyPoint(pixel);
@@ -146,30 +228,26 @@ void CloudOcclusionPredictor::calcRoiVector3D(
   }
 }
 
-void CloudOcclusionPredictor::filterCloud(
-  const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const std::vector<pcl::PointXYZ> & roi_tls,
-  const std::vector<pcl::PointXYZ> & roi_brs, pcl::PointCloud<pcl::PointXYZ> & cloud_out) const
+void CloudOcclusionPredictor::updateLidarRays(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud, const std::vector<const RoiSamples *> & samples)
 {
+  // bounding box of the rois and the camera
   float min_x = 0, max_x = 0, min_y = 0, max_y = 0, min_z = 0, max_z = 0;
-  for (const auto & pt : roi_tls) {
-    min_x = std::min(min_x, pt.x);
-    max_x = std::max(max_x, pt.x);
-    min_y = std::min(min_y, pt.y);
-    max_y = std::max(max_y, pt.y);
-    min_z = std::min(min_z, pt.z);
-    max_z = std::max(max_z, pt.z);
-  }
-  for (const auto & pt : roi_brs) {
-    min_x = std::min(min_x, pt.x);
-    max_x = std::max(max_x, pt.x);
-    min_y = std::min(min_y, pt.y);
-    max_y = std::max(max_y, pt.y);
-    min_z = std::min(min_z, pt.z);
-    max_z = std::max(max_z, pt.z);
+  for (const auto & roi_samples : samples) {
+    for (const auto & pt : {roi_samples->top_left, roi_samples->bottom_right}) {
+      min_x = std::min(min_x, pt.x);
+      max_x = std::max(max_x, pt.x);
+      min_y = std::min(min_y, pt.y);
+      max_y = std::max(max_y, pt.y);
+      min_z = std::min(min_z, pt.z);
+      max_z = std::max(max_z, pt.z);
+    }
   }
   const float min_dist_to_cam = 1.0f;
-  cloud_out.clear();
-  for (const auto & pt : cloud_in) {
+  unsorted_lidar_rays_.clear();
+  unsorted_lidar_ray_bins_.clear();
+  lidar_ray_offsets_.assign(num_azimuth_bins * num_elevation_bins + 1, 0);
+  for (const auto & pt : cloud) {
     if (
       pt.x < min_x || pt.x > max_x || pt.y < min_y || pt.y > max_y || pt.z < min_z ||
       pt.z > max_z) {
@@ -181,8 +259,40 @@ void CloudOcclusionPredictor::filterCloud(
       dist >= max_valid_pt_distance_ * max_valid_pt_distance_) {
       continue;
     }
-    cloud_out.push_back(pt);
+    // keep only the points within the view frustum of a roi and in front of it
+    const Ray ray = ::point2ray(pt);
+    const bool may_occlude =
+      std::any_of(samples.begin(), samples.end(), [&ray](const RoiSamples * roi_samples) {
+        return ray.azimuth >= roi_samples->min_azimuth && ray.azimuth <= roi_samples->max_azimuth &&
+               ray.elevation >= roi_samples->min_elevation &&
+               ray.elevation <= roi_samples->max_elevation &&
+               ray.dist < roi_samples->max_occluder_dist;
+      });
+    if (!may_occlude) {
+      continue;
+    }
+    const auto bin = getRayBin(static_cast<int>(ray.azimuth), static_cast<int>(ray.elevation));
+    if (!bin) {
+      continue;
+    }
+    unsorted_lidar_rays_.push_back(ray);
+    unsorted_lidar_ray_bins_.push_back(*bin);
+    ++lidar_ray_offsets_[*bin + 1];
+  }
+
+  // counting sort of the rays by bin
+  for (size_t i = 0; i + 1 < lidar_ray_offsets_.size(); i++) {
+    lidar_ray_offsets_[i + 1] += lidar_ray_offsets_[i];
   }
+  lidar_rays_.resize(unsorted_lidar_rays_.size());
+  std::vector<uint32_t> & next = unsorted_lidar_ray_bins_;
+  for (size_t i = 0; i < unsorted_lidar_rays_.size(); i++) {
+    lidar_rays_[lidar_ray_offsets_[next[i]]++] = unsorted_lidar_rays_[i];
+  }
+  for (size_t i = lidar_ray_offsets_.size() - 1; i > 0; i--) {
+    lidar_ray_offsets_[i] = lidar_ray_offsets_[i - 1];
+  }
+  lidar_ray_offsets_[0] = 0;
 }
 
 void CloudOcclusionPredictor::sampleTrafficLightRoi(
@@ -207,22 +317,10 @@ void CloudOcclusionPredictor::sampleTrafficLightRoi(
   }
 }
 
-uint32_t CloudOcclusionPredictor::predict(
-  const pcl::PointXYZ & roi_top_left, const pcl::PointXYZ & roi_bottom_right)
+uint32_t CloudOcclusionPredictor::predict(const RoiSamples & samples) const
 {
-  const uint32_t horizontal_sample_num = 20;
-  const uint32_t vertical_sample_num = 20;
-  static_assert(horizontal_sample_num > 1);
-  static_assert(vertical_sample_num > 1);
-
-  const float min_dist_from_occlusion_to_tl = 5.0f;
-
-  pcl::PointCloud<pcl::PointXYZ> tl_sample_cloud;
-  sampleTrafficLightRoi(
-    roi_top_left, roi_bottom_right, horizontal_sample_num, vertical_sample_num, tl_sample_cloud);
   uint32_t occluded_num = 0;
-  for (const pcl::PointXYZ & tl_pt : tl_sample_cloud) {
-    Ray tl_ray = ::point2ray(tl_pt);
+  for (const Ray & tl_ray : samples.rays) {
     bool occluded = false;
     // the azimuth and elevation range to search for points that may occlude tl_pt
     int min_azimuth = static_cast<int>(tl_ray.azimuth - azimuth_occlusion_resolution_deg_);
@@ -237,7 +335,12 @@ uint32_t CloudOcclusionPredictor::predict(
      */
     for (int azimuth = min_azimuth; (azimuth <= max_azimuth) && !occluded; azimuth++) {
       for (int elevation = min_elevation; (elevation <= max_elevation) && !occluded; elevation++) {
-        for (const Ray & lidar_ray : lidar_rays_[azimuth][elevation]) {
+        const auto bin = getRayBin(azimuth, elevation);
+        if (!bin) {
+          continue;
+        }
+        for (uint32_t i = lidar_ray_offsets_[*bin]; i < lidar_ray_offsets_[*bin + 1]; i++) {
+          const Ray & lidar_ray = lidar_rays_[i];
           if (
             std::abs(lidar_ray.azimuth - tl_ray.azimuth) <= azimuth_occlusion_resolution_deg_ &&
             std::abs(lidar_ray.elevation - tl_ray.elevation) <=
@@ -251,7 +354,7 @@ uint32_t CloudOcclusionPredictor::predict(
     }
     occluded_num += occluded;
   }
-  return 100 * occluded_num / tl_sample_cloud.size();
+  return 100 * occluded_num / samples.rays.size();
 }
 
 }  // namespace autoware::traffic_light
@@ -21,7 +21,9 @@
 #include <rclcpp/rclcpp.hpp>
 #include <tf2_eigen/tf2_eigen.hpp>
 
+#include <sensor_msgs/msg/camera_info.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/region_of_interest.hpp>
 #include <tier4_perception_msgs/msg/traffic_light_roi_array.hpp>
 
 #if __has_include(<image_geometry/pinhole_camera_model.hpp>)
@@ -41,6 +43,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::traffic_light
@@ -53,6 +56,26 @@ struct Ray
   float dist;
 };
 
+/**
+ * @brief sampled rays of a traffic light roi, which are kept while the roi and the distance to
+ * the traffic light do not change, e.g. while the ego vehicle is stopped
+ */
+struct RoiSamples
+{
+  sensor_msgs::msg::RegionOfInterest roi;
+  double dist2cam{0.0};
+  pcl::PointXYZ top_left;
+  pcl::PointXYZ bottom_right;
+  std::vector<Ray> rays;
+  // the view frustum of the rays extended by the search resolution, out of which no lidar point
+  // can occlude the traffic light
+  float min_azimuth{0.0f};
+  float max_azimuth{0.0f};
+  float min_elevation{0.0f};
+  float max_elevation{0.0f};
+  float max_occluder_dist{0.0f};
+};
+
 class CloudOcclusionPredictor
 {
 public:
@@ -69,11 +92,18 @@ public:
     std::vector<int> & occlusion_ratios);
 
 private:
-  uint32_t predict(const pcl::PointXYZ & roi_top_left, const pcl::PointXYZ & roi_bottom_right);
+  uint32_t predict(const RoiSamples & samples) const;
 
-  void filterCloud(
-    const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const std::vector<pcl::PointXYZ> & roi_tls,
-    const std::vector<pcl::PointXYZ> & roi_brs, pcl::PointCloud<pcl::PointXYZ> & cloud_out) const;
+  /**
+   * @brief bin the rays of the points which may occlude any of the rois, in one pass over the
+   * cloud
+   */
+  void updateLidarRays(
+    const pcl::PointCloud<pcl::PointXYZ> & cloud, const std::vector<const RoiSamples *> & samples);
+
+  RoiSamples getRoiSamples(
+    const tier4_perception_msgs::msg::TrafficLightRoi & roi,
+    const image_geometry::PinholeCameraModel & pinhole_model, double dist2cam) const;
 
   static void sampleTrafficLightRoi(
     const pcl::PointXYZ & top_left, const pcl::PointXYZ & bottom_right,
@@ -82,11 +112,19 @@ private:
 
   static void calcRoiVector3D(
     const tier4_perception_msgs::msg::TrafficLightRoi & roi,
-    const image_geometry::PinholeCameraModel & pinhole_model,
-    const std::map<lanelet::Id, tf2::Vector3> & traffic_light_position_map,
-    const tf2::Transform & tf_camera2map, pcl::PointXYZ & top_left, pcl::PointXYZ & bottom_right);
-
-  std::map<int, std::map<int, std::vector<Ray> > > lidar_rays_;
+    const image_geometry::PinholeCameraModel & pinhole_model, double dist2cam,
+    pcl::PointXYZ & top_left, pcl::PointXYZ & bottom_right);
+
+  // lidar rays binned by the integer part of their azimuth and elevation over the whole sphere,
+  // as ranges of lidar_rays_ per bin
+  std::vector<uint32_t> lidar_ray_offsets_;
+  std::vector<Ray> lidar_rays_;
+  std::vector<Ray> unsorted_lidar_rays_;
+  std::vector<uint32_t> unsorted_lidar_ray_bins_;
+
+  // roi samples of the previous frame for each traffic light id and type
+  std::map<std::pair<lanelet::Id, uint8_t>, RoiSamples> roi_samples_;
+  sensor_msgs::msg::CameraInfo camera_info_;
   rclcpp::Node * node_ptr_;
   float max_valid_pt_distance_;
   float azimuth_occlusion_resolution_deg_;
@@ -70,6 +70,7 @@
 #include <tf2_ros/transform_listener.h>
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace autoware::costmap_generator
@@ -107,6 +108,10 @@ private:
 
   std::vector<geometry_msgs::msg::Polygon> primitives_polygons_;
 
+  // primitives layer of a grid larger than the costmap, which is reused while the costmap is inside
+  grid_map::GridMap primitives_cache_;
+  std::optional<geometry_msgs::msg::Transform> primitives_cache_transform_;
+
   PointsToCostmap points2costmap_{};
   ObjectsToCostmap objects2costmap_;
 
@@ -176,6 +181,10 @@ private:
   /// \brief calculate cost from lanelet2 map
   grid_map::Matrix generatePrimitivesCostmap();
 
+  /// \brief fill the primitives layer of the cache around the costmap
+  /// \param[in] transform: transform from the map frame to the costmap frame
+  void updatePrimitivesCache(const geometry_msgs::msg::Transform & transform);
+
   /// \brief calculate cost for final output
   grid_map::Matrix generateCombinedCostmap();
 
@@ -57,6 +57,7 @@
 #include <tf2/time.h>
 #include <tf2/utils.h>
 
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -247,6 +248,8 @@ void CostmapGenerator::onLaneletMapBin(
   if (param_->use_parkinglot) {
     loadParkingAreasFromLaneletMap(lanelet_map_, primitives_polygons_);
   }
+
+  primitives_cache_transform_ = std::nullopt;
 }
 
 void CostmapGenerator::onObjects(
@@ -290,10 +293,11 @@ void CostmapGenerator::onTimer()
   }
   time_keeper_->end_track("lookupTransform");
 
-  // Set grid center
+  // Set grid center, which is aligned to the cells of the primitives cache
+  const double resolution = costmap_.getResolution();
   grid_map::Position p;
-  p.x() = tf.transform.translation.x;
-  p.y() = tf.transform.translation.y;
+  p.x() = std::round(tf.transform.translation.x / resolution) * resolution;
+  p.y() = std::round(tf.transform.translation.y / resolution) * resolution;
   costmap_.setPosition(p);
 
   if ((param_->use_wayarea || param_->use_parkinglot) && lanelet_map_) {
@@ -416,13 +420,54 @@ grid_map::Matrix CostmapGenerator::generateObjectsCostmap(
 
 grid_map::Matrix CostmapGenerator::generatePrimitivesCostmap()
 {
-  grid_map::GridMap lanelet2_costmap = costmap_;
+  geometry_msgs::msg::TransformStamped map2costmap;
+  try {
+    map2costmap =
+      tf_buffer_.lookupTransform(param_->costmap_frame, param_->map_frame, tf2::TimePointZero);
+  } catch (const tf2::TransformException & ex) {
+    RCLCPP_ERROR(rclcpp::get_logger("costmap_generator"), "%s", ex.what());
+    return costmap_[LayerName::primitives];
+  }
+
+  // offset of the costmap from the cache in cells, where the index increases toward -x and -y
+  const auto & size = costmap_.getSize();
+  const auto calc_offset = [&]() -> Eigen::Array2i {
+    const grid_map::Position cache_corner =
+      primitives_cache_.getPosition() + 0.5 * primitives_cache_.getLength().matrix();
+    const grid_map::Position costmap_corner =
+      costmap_.getPosition() + 0.5 * costmap_.getLength().matrix();
+    return ((cache_corner - costmap_corner) / costmap_.getResolution()).array().round().cast<int>();
+  };
+  const auto is_inside_cache = [&](const Eigen::Array2i & offset) {
+    return (offset >= 0).all() && (offset + size <= primitives_cache_.getSize()).all();
+  };
+
+  if (
+    !primitives_cache_transform_ || *primitives_cache_transform_ != map2costmap.transform ||
+    !is_inside_cache(calc_offset())) {
+    updatePrimitivesCache(map2costmap.transform);
+  }
+
+  const auto offset = calc_offset();
+  return primitives_cache_[LayerName::primitives].block(offset.x(), offset.y(), size.x(), size.y());
+}
+
+void CostmapGenerator::updatePrimitivesCache(const geometry_msgs::msg::Transform & transform)
+{
+  // the cache extends the costmap by half of its size on each side, keeping the cells aligned
+  const grid_map::Size cache_size = costmap_.getSize() + 2 * (costmap_.getSize() / 2);
+  primitives_cache_ = grid_map::GridMap({LayerName::primitives});
+  primitives_cache_.setFrameId(param_->costmap_frame);
+  primitives_cache_.setGeometry(
+    cache_size.cast<double>() * costmap_.getResolution(), costmap_.getResolution(),
+    costmap_.getPosition());
+  primitives_cache_[LayerName::primitives].setConstant(param_->grid_max_value);
   if (!primitives_polygons_.empty()) {
     object_map::fill_polygon_areas(
-      lanelet2_costmap, primitives_polygons_, LayerName::primitives, param_->grid_max_value,
+      primitives_cache_, primitives_polygons_, LayerName::primitives, param_->grid_max_value,
       param_->grid_min_value, param_->costmap_frame, param_->map_frame, tf_buffer_);
   }
-  return lanelet2_costmap[LayerName::primitives];
+  primitives_cache_transform_ = transform;
 }
 
 grid_map::Matrix CostmapGenerator::generateCombinedCostmap()
@@ -17,6 +17,7 @@
 
 #include "autoware/freespace_planning_algorithms/abstract_algorithm.hpp"
 #include "autoware/freespace_planning_algorithms/reeds_shepp.hpp"
+#include "autoware/freespace_planning_algorithms/reeds_shepp_distance_table.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -28,6 +29,7 @@
 #include <cmath>
 #include <functional>
 #include <iostream>
+#include <optional>
 #include <queue>
 #include <string>
 #include <tuple>
@@ -71,6 +73,7 @@ struct AstarNode
   int steering_index;                    // steering index
   bool is_back;                          // true if the current direction of the vehicle is back
   AstarNode * parent = nullptr;          // parent node
+  uint32_t search_id = 0;                // id of the search which last set the node
 
   inline void set(
     const Pose & pose, const double move_cost, const double total_cost, const double steer_ind,
@@ -134,6 +137,7 @@ private:
   bool search();
   void expandNodes(AstarNode & current_node, const bool is_back = false);
   void resetData();
+  AstarNode & getNode(const IndexXYT & index);
   void setPath(const AstarNode & goal);
   void setStartNode(const double cost_offset = 0.0);
   double estimateCost(const Pose & pose, const IndexXYT & index) const;
@@ -152,7 +156,9 @@ private:
   AstarParam astar_param_;
 
   // hybrid astar variables
+  // the nodes are reset lazily, when they are first accessed in a search
   std::vector<AstarNode> graph_;
+  uint32_t search_id_ = 0;
   std::vector<double> col_free_distance_map_;
 
   std::priority_queue<AstarNode *, std::vector<AstarNode *>, NodeComparison> openlist_;
@@ -168,6 +174,9 @@ private:
   // distance metric option (removed when the reeds_shepp gets stable)
   bool use_reeds_shepp_;
 
+  // reeds shepp distance to the goal used in the heuristic
+  std::optional<ReedsSheppDistanceTable> rs_distance_table_;
+
   double steering_resolution_;
   double heading_resolution_;
   double avg_turning_radius_;
@@ -191,6 +200,11 @@ private:
 
   // cost free obstacle distance
   static constexpr double cost_free_obs_dist = 1.0;
+
+  // range and resolution of the reeds shepp distance table, out of which the distance is computed
+  // analytically
+  static constexpr double rs_distance_table_max_dist_ = 30.0;
+  static constexpr double rs_distance_table_resolution_ = 0.5;
 };
 }  // namespace autoware::freespace_planning_algorithms
 
@@ -0,0 +1,59 @@
+// Copyright 2024 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__FREESPACE_PLANNING_ALGORITHMS__REEDS_SHEPP_DISTANCE_TABLE_HPP_
+#define AUTOWARE__FREESPACE_PLANNING_ALGORITHMS__REEDS_SHEPP_DISTANCE_TABLE_HPP_
+
+#include "autoware/freespace_planning_algorithms/reeds_shepp.hpp"
+
+#include <vector>
+
+namespace autoware::freespace_planning_algorithms
+{
+/**
+ * @brief lookup table of the Reeds-Shepp distance over the discretized pose of s1 relative to s0
+ * @details the distance only depends on the relative pose, and is symmetric about the x axis of
+ * s0, so only the half plane of y >= 0 is stored. The cells are computed when they are first
+ * queried, and the distance between the cells is interpolated trilinearly. The relative poses out
+ * of the table are computed analytically. Since the cells are filled lazily, the table must not
+ * be queried from multiple threads.
+ */
+class ReedsSheppDistanceTable
+{
+public:
+  ReedsSheppDistanceTable(
+    const double turning_radius, const double max_distance, const double xy_resolution,
+    const int theta_size);
+
+  double distance(
+    const ReedsSheppStateSpace::StateXYT & s0, const ReedsSheppStateSpace::StateXYT & s1) const;
+
+  double getTurningRadius() const { return rs_space_.rho_; }
+
+private:
+  double getCellDistance(const int x_index, const int y_index, const int theta_index) const;
+
+  ReedsSheppStateSpace rs_space_;
+  double max_distance_;
+  double xy_resolution_;
+  double theta_resolution_;
+  int x_size_;
+  int y_size_;
+  int theta_size_;
+  // negative if not computed yet
+  mutable std::vector<float> table_;
+};
+}  // namespace autoware::freespace_planning_algorithms
+
+#endif  // AUTOWARE__FREESPACE_PLANNING_ALGORITHMS__REEDS_SHEPP_DISTANCE_TABLE_HPP_
@@ -106,6 +106,14 @@ double PlannerWaypoints::compute_length() const
 
 void AbstractPlanningAlgorithm::setMap(const nav_msgs::msg::OccupancyGrid & costmap)
 {
+  // the obstacle table and the EDT map only depend on the costmap, so they are not recomputed for
+  // the same costmap, which is set again for every replanning
+  if (
+    is_collision_table_initialized && costmap.header == costmap_.header &&
+    costmap.info == costmap_.info && costmap.data == costmap_.data) {
+    return;
+  }
+
   costmap_ = costmap;
 
   const uint32_t nb_of_cells = costmap_.data.size();
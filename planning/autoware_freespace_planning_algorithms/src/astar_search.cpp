@@ -38,14 +38,9 @@ namespace autoware::freespace_planning_algorithms
 {
 using autoware::universe_utils::calcDistance2d;
 
-double calcReedsSheppDistance(const Pose & p1, const Pose & p2, double radius)
+ReedsSheppStateSpace::StateXYT toStateXYT(const Pose & pose)
 {
-  const auto rs_space = ReedsSheppStateSpace(radius);
-  const ReedsSheppStateSpace::StateXYT pose0{
-    p1.position.x, p1.position.y, tf2::getYaw(p1.orientation)};
-  const ReedsSheppStateSpace::StateXYT pose1{
-    p2.position.x, p2.position.y, tf2::getYaw(p2.orientation)};
-  return rs_space.distance(pose0, pose1);
+  return {pose.position.x, pose.position.y, tf2::getYaw(pose.orientation)};
 }
 
 void setYaw(geometry_msgs::msg::Quaternion * orientation, const double yaw)
@@ -85,6 +80,9 @@ AstarSearch::AstarSearch(
     steering_resolution_ + (collision_vehicle_shape_.max_steering - steering_resolution_) / 2.0;
   avg_turning_radius_ =
     kinematic_bicycle_model::getTurningRadius(collision_vehicle_shape_.base_length, avg_steering);
+  rs_distance_table_.emplace(
+    avg_turning_radius_, rs_distance_table_max_dist_, rs_distance_table_resolution_,
+    planner_common_param_.theta_size);
 
   is_backward_search_ = astar_param_.search_method == "backward";
 
@@ -111,12 +109,27 @@ void AstarSearch::resetData()
   // point to deleted node.
   openlist_ = std::priority_queue<AstarNode *, std::vector<AstarNode *>, NodeComparison>();
   const int nb_of_grid_nodes = costmap_.info.width * costmap_.info.height;
-  const int total_astar_node_count = nb_of_grid_nodes * planner_common_param_.theta_size;
-  graph_.assign(total_astar_node_count, AstarNode{});
+  const size_t total_astar_node_count = nb_of_grid_nodes * planner_common_param_.theta_size;
+  // the nodes of the previous searches are not cleared here but reset in getNode()
+  ++search_id_;
+  if (graph_.size() != total_astar_node_count || search_id_ == 0) {
+    graph_.assign(total_astar_node_count, AstarNode{});
+    search_id_ = 1;
+  }
   col_free_distance_map_.assign(nb_of_grid_nodes, std::numeric_limits<double>::max());
   shifted_goal_pose_ = {};
 }
 
+AstarNode & AstarSearch::getNode(const IndexXYT & index)
+{
+  AstarNode & node = graph_[getKey(index)];
+  if (node.search_id != search_id_) {
+    node = AstarNode{};
+    node.search_id = search_id_;
+  }
+  return node;
+}
+
 bool AstarSearch::makePlan(const Pose & start_pose, const Pose & goal_pose)
 {
   resetData();
@@ -238,7 +251,7 @@ void AstarSearch::setStartNode(const double cost_offset)
 {
   const auto index = pose2index(costmap_, start_pose_, planner_common_param_.theta_size);
   // Set start node
-  AstarNode * start_node = &graph_[getKey(index)];
+  AstarNode * start_node = &getNode(index);
   const double initial_cost = estimateCost(start_pose_, index) + cost_offset;
   start_node->set(start_pose_, 0.0, initial_cost, 0, false);
   start_node->dir_distance = 0.0;
@@ -257,7 +270,7 @@ double AstarSearch::estimateCost(const Pose & pose, const IndexXYT & index) cons
   // Temporarily, until reeds_shepp gets stable.
   if (use_reeds_shepp_) {
     total_cost =
-      std::max(total_cost, calcReedsSheppDistance(pose, goal_pose_, avg_turning_radius_));
+      std::max(total_cost, rs_distance_table_->distance(toStateXYT(pose), toStateXYT(goal_pose_)));
   }
   return astar_param_.distance_heuristic_weight * total_cost;
 }
@@ -316,7 +329,7 @@ void AstarSearch::expandNodes(AstarNode & current_node, const bool is_back)
 
     if (isOutOfRange(next_index) || isObs(next_index)) continue;
 
-    AstarNode * next_node = &graph_[getKey(next_index)];
+    AstarNode * next_node = &getNode(next_index);
     if (next_node->status == NodeStatus::Closed || detectCollision(next_index)) continue;
 
     const auto obs_edt = getObstacleEDT(next_index);
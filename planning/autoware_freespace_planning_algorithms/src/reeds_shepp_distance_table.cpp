@@ -0,0 +1,94 @@
+// Copyright 2024 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/freespace_planning_algorithms/reeds_shepp_distance_table.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace autoware::freespace_planning_algorithms
+{
+ReedsSheppDistanceTable::ReedsSheppDistanceTable(
+  const double turning_radius, const double max_distance, const double xy_resolution,
+  const int theta_size)
+: rs_space_(turning_radius),
+  max_distance_(max_distance),
+  xy_resolution_(xy_resolution),
+  theta_resolution_(2.0 * M_PI / theta_size),
+  x_size_(2 * static_cast<int>(std::ceil(max_distance / xy_resolution)) + 1),
+  y_size_(static_cast<int>(std::ceil(max_distance / xy_resolution)) + 1),
+  theta_size_(theta_size),
+  table_(static_cast<size_t>(x_size_) * y_size_ * theta_size_, -1.0f)
+{
+}
+
+double ReedsSheppDistanceTable::distance(
+  const ReedsSheppStateSpace::StateXYT & s0, const ReedsSheppStateSpace::StateXYT & s1) const
+{
+  // pose of s1 in the frame of s0
+  const double dx = s1.x - s0.x;
+  const double dy = s1.y - s0.y;
+  const double cos_yaw = std::cos(s0.yaw);
+  const double sin_yaw = std::sin(s0.yaw);
+  const double x = cos_yaw * dx + sin_yaw * dy;
+  double y = -sin_yaw * dx + cos_yaw * dy;
+  double yaw = std::remainder(s1.yaw - s0.yaw, 2.0 * M_PI);
+  if (std::abs(x) > max_distance_ || std::abs(y) > max_distance_) {
+    return rs_space_.distance(s0, s1);
+  }
+  if (y < 0.0) {
+    y = -y;
+    yaw = -yaw;
+  }
+
+  // NOTE: the x index is offset so that x = -max_distance_ is the first cell
+  const double x_pos = (x + (x_size_ / 2) * xy_resolution_) / xy_resolution_;
+  const double y_pos = y / xy_resolution_;
+  const double theta_pos = (yaw + M_PI) / theta_resolution_;
+  const int x0 = std::clamp(static_cast<int>(std::floor(x_pos)), 0, x_size_ - 2);
+  const int y0 = std::clamp(static_cast<int>(std::floor(y_pos)), 0, y_size_ - 2);
+  const int t0 = static_cast<int>(std::floor(theta_pos));
+  const double rx = std::clamp(x_pos - x0, 0.0, 1.0);
+  const double ry = std::clamp(y_pos - y0, 0.0, 1.0);
+  const double rt = std::clamp(theta_pos - t0, 0.0, 1.0);
+
+  double interpolated = 0.0;
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      for (int k = 0; k < 2; ++k) {
+        const double weight = (i ? rx : 1.0 - rx) * (j ? ry : 1.0 - ry) * (k ? rt : 1.0 - rt);
+        if (weight == 0.0) continue;
+        // the yaw is periodic
+        const int theta_index = ((t0 + k) % theta_size_ + theta_size_) % theta_size_;
+        interpolated += weight * getCellDistance(x0 + i, y0 + j, theta_index);
+      }
+    }
+  }
+  return interpolated;
+}
+
+double ReedsSheppDistanceTable::getCellDistance(
+  const int x_index, const int y_index, const int theta_index) const
+{
+  const size_t id = (static_cast<size_t>(x_index) * y_size_ + y_index) * theta_size_ + theta_index;
+  float & cell = table_[id];
+  if (cell < 0.0f) {
+    const ReedsSheppStateSpace::StateXYT cell_pose{
+      (x_index - x_size_ / 2) * xy_resolution_, y_index * xy_resolution_,
+      -M_PI + theta_index * theta_resolution_};
+    cell = static_cast<float>(rs_space_.distance({0.0, 0.0, 0.0}, cell_pose));
+  }
+  return cell;
+}
+}  // namespace autoware::freespace_planning_algorithms
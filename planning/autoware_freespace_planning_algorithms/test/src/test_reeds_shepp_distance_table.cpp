@@ -0,0 +1,72 @@
+// Copyright 2024 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/freespace_planning_algorithms/reeds_shepp_distance_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+namespace autoware::freespace_planning_algorithms
+{
+using StateXYT = ReedsSheppStateSpace::StateXYT;
+
+TEST(ReedsSheppDistanceTable, OnGrid)
+{
+  const ReedsSheppDistanceTable table(5.0, 20.0, 0.5, 72);
+  const ReedsSheppStateSpace rs_space(5.0);
+
+  // the relative poses on the cells of the table are exact
+  const StateXYT s0{0.0, 0.0, 0.0};
+  for (const auto & s1 : {StateXYT{3.0, 1.5, M_PI / 4.0}, StateXYT{-10.0, -2.0, -M_PI / 2.0}}) {
+    EXPECT_NEAR(table.distance(s0, s1), rs_space.distance(s0, s1), 1e-4);
+  }
+
+  // the distance is invariant to the pose of s0
+  const StateXYT s0_moved{10.0, -5.0, M_PI / 2.0};
+  const StateXYT s1_moved{10.0 - 1.5, -5.0 + 3.0, M_PI / 2.0 + M_PI / 4.0};
+  EXPECT_NEAR(
+    table.distance(s0_moved, s1_moved), rs_space.distance(s0, {3.0, 1.5, M_PI / 4.0}), 1e-4);
+}
+
+TEST(ReedsSheppDistanceTable, Interpolated)
+{
+  const ReedsSheppDistanceTable table(5.0, 20.0, 0.5, 72);
+  const ReedsSheppStateSpace rs_space(5.0);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position_dist(-15.0, 15.0);
+  std::uniform_real_distribution<double> yaw_dist(-M_PI, M_PI);
+  double error_sum = 0.0;
+  constexpr int sample_num = 1000;
+  for (int i = 0; i < sample_num; ++i) {
+    const StateXYT s0{position_dist(engine), position_dist(engine), yaw_dist(engine)};
+    const StateXYT s1{
+      s0.x + position_dist(engine), s0.y + position_dist(engine), yaw_dist(engine)};
+    error_sum += std::abs(table.distance(s0, s1) - rs_space.distance(s0, s1));
+  }
+  EXPECT_LT(error_sum / sample_num, 0.1);
+}
+
+TEST(ReedsSheppDistanceTable, OutOfTable)
+{
+  const ReedsSheppDistanceTable table(5.0, 20.0, 0.5, 72);
+  const ReedsSheppStateSpace rs_space(5.0);
+
+  const StateXYT s0{0.0, 0.0, 0.0};
+  const StateXYT s1{30.0, -25.0, 1.0};
+  EXPECT_DOUBLE_EQ(table.distance(s0, s1), rs_space.distance(s0, s1));
+}
+}  // namespace autoware::freespace_planning_algorithms
@@ -38,6 +38,8 @@
 #include <lanelet2_core/geometry/Lanelet.h>
 #include <tf2/utils.h>
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <vector>
 
@@ -83,9 +85,48 @@ bool DefaultPlanner::ready() const
 void DefaultPlanner::map_callback(const LaneletMapBin::ConstSharedPtr msg)
 {
   route_handler_.setMap(*msg);
+  route_section_cache_.clear();
   is_graph_ready_ = true;
 }
 
+bool DefaultPlanner::plan_path_lanelets_between_checkpoints(
+  const Pose & start_checkpoint, const Pose & goal_checkpoint,
+  lanelet::ConstLanelets * path_lanelets)
+{
+  const auto closest_preferred_lanelet_id = [&](const Pose & pose) {
+    lanelet::ConstLanelet closest_lanelet;
+    if (!route_handler_.getClosestPreferredLaneletWithinRoute(pose, &closest_lanelet)) {
+      return lanelet::InvalId;
+    }
+    return closest_lanelet.id();
+  };
+  const auto to_array = [](const Pose & pose) {
+    return std::array<double, 7>{pose.position.x,    pose.position.y,    pose.position.z,
+                                 pose.orientation.x, pose.orientation.y, pose.orientation.z,
+                                 pose.orientation.w};
+  };
+  RouteSectionKey key{};
+  const auto start = to_array(start_checkpoint);
+  const auto goal = to_array(goal_checkpoint);
+  std::copy(start.begin(), start.end(), key.checkpoints.begin());
+  std::copy(goal.begin(), goal.end(), key.checkpoints.begin() + start.size());
+  key.start_preferred_lanelet_id = closest_preferred_lanelet_id(start_checkpoint);
+  key.goal_preferred_lanelet_id = closest_preferred_lanelet_id(goal_checkpoint);
+  key.consider_no_drivable_lanes = param_.consider_no_drivable_lanes;
+
+  if (const auto cached_lanelets = route_section_cache_.get(key)) {
+    *path_lanelets = *cached_lanelets;
+    return true;
+  }
+
+  if (!route_handler_.planPathLaneletsBetweenCheckpoints(
+        start_checkpoint, goal_checkpoint, path_lanelets, param_.consider_no_drivable_lanes)) {
+    return false;
+  }
+  route_section_cache_.put(key, *path_lanelets);
+  return true;
+}
+
 PlannerPlugin::MarkerArray DefaultPlanner::visualize(const LaneletRoute & route) const
 {
   lanelet::ConstLanelets route_lanelets;
@@ -319,8 +360,8 @@ PlannerPlugin::LaneletRoute DefaultPlanner::plan(const RoutePoints & points)
     const auto start_check_point = points.at(i - 1);
     const auto goal_check_point = points.at(i);
     lanelet::ConstLanelets path_lanelets;
-    if (!route_handler_.planPathLaneletsBetweenCheckpoints(
-          start_check_point, goal_check_point, &path_lanelets, param_.consider_no_drivable_lanes)) {
+    if (!plan_path_lanelets_between_checkpoints(
+          start_check_point, goal_check_point, &path_lanelets)) {
       RCLCPP_WARN(logger, "Failed to plan route.");
       return route_msg;
     }
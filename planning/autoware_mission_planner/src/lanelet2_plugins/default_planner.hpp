@@ -17,6 +17,7 @@
 
 #include <autoware/mission_planner/mission_planner_plugin.hpp>
 #include <autoware/route_handler/route_handler.hpp>
+#include <autoware/universe_utils/system/lru_cache.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 #include <rclcpp/rclcpp.hpp>
 
@@ -27,6 +28,9 @@
 #include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <array>
+#include <map>
+#include <tuple>
 #include <vector>
 
 namespace autoware::mission_planner::lanelet2
@@ -40,6 +44,27 @@ struct DefaultPlannerParameters
   bool check_footprint_inside_lanes;
 };
 
+/**
+ * @brief the inputs which decide the lanelets planned between two checkpoints
+ * @details the planned lanelets also depend on the preferred lanelets of the current route closest
+ * to the checkpoints, so their ids are part of the key.
+ */
+struct RouteSectionKey
+{
+  std::array<double, 14> checkpoints;  // position and orientation of the start and goal checkpoint
+  lanelet::Id start_preferred_lanelet_id;
+  lanelet::Id goal_preferred_lanelet_id;
+  bool consider_no_drivable_lanes;
+
+  [[nodiscard]] auto tie() const
+  {
+    return std::tie(
+      checkpoints, start_preferred_lanelet_id, goal_preferred_lanelet_id,
+      consider_no_drivable_lanes);
+  }
+  bool operator<(const RouteSectionKey & other) const { return tie() < other.tie(); }
+};
+
 class DefaultPlanner : public mission_planner::PlannerPlugin
 {
 public:
@@ -64,6 +89,12 @@ protected:
 
   DefaultPlannerParameters param_;
 
+  // lanelets planned between checkpoints, reused by reroutes and goal modifications which keep
+  // some of the checkpoints
+  static constexpr size_t route_section_cache_size = 32;
+  autoware::universe_utils::LRUCache<RouteSectionKey, lanelet::ConstLanelets, std::map>
+    route_section_cache_{route_section_cache_size};
+
   rclcpp::Node * node_;
   rclcpp::Subscription<LaneletMapBin>::SharedPtr map_subscriber_;
   rclcpp::Publisher<MarkerArray>::SharedPtr pub_goal_footprint_marker_;
@@ -71,6 +102,14 @@ protected:
   void initialize_common(rclcpp::Node * node);
   void map_callback(const LaneletMapBin::ConstSharedPtr msg);
 
+  /**
+   * @brief plan the lanelets between two checkpoints, or reuse them if the same section was planned
+   * recently with the same preferred lanelets around the checkpoints
+   */
+  bool plan_path_lanelets_between_checkpoints(
+    const Pose & start_checkpoint, const Pose & goal_checkpoint,
+    lanelet::ConstLanelets * path_lanelets);
+
   /**
    * @brief check if the goal_footprint is within the route lanelets plus the
    * succeeding lanelets around the goal
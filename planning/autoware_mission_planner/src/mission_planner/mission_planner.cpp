@@ -27,7 +27,9 @@
 #include <lanelet2_core/geometry/LineString.h>
 
 #include <algorithm>
+#include <map>
 #include <utility>
+#include <vector>
 
 namespace autoware::mission_planner
 {
@@ -504,13 +506,25 @@ bool MissionPlanner::check_reroute_safety(
   // =============================================================================================
   const auto start_idx_opt =
     std::invoke([&]() -> std::optional<std::pair<size_t /* original */, size_t /* target */>> {
+      // index the target segments by their sorted primitive ids, so that each original segment is
+      // matched with one lookup instead of comparing it with all the target segments
+      const auto sorted_ids = [](const std::vector<LaneletPrimitive> & primitives) {
+        std::vector<int64_t> ids;
+        ids.reserve(primitives.size());
+        for (const auto & primitive : primitives) ids.push_back(primitive.id);
+        std::sort(ids.begin(), ids.end());
+        return ids;
+      };
+      std::map<std::vector<int64_t>, size_t> target_segment_indices;
+      for (size_t j = 0; j < target_route.segments.size(); ++j) {
+        // keep the first target segment with the same primitives
+        target_segment_indices.emplace(sorted_ids(target_route.segments.at(j).primitives), j);
+      }
       for (size_t i = 0; i < original_route.segments.size(); ++i) {
-        const auto & original_segment = original_route.segments.at(i).primitives;
-        for (size_t j = 0; j < target_route.segments.size(); ++j) {
-          const auto & target_segment = target_route.segments.at(j).primitives;
-          if (hasSamePrimitives(original_segment, target_segment)) {
-            return std::make_pair(i, j);
-          }
+        const auto itr =
+          target_segment_indices.find(sorted_ids(original_route.segments.at(i).primitives));
+        if (itr != target_segment_indices.end()) {
+          return std::make_pair(i, itr->second);
         }
       }
       return std::nullopt;
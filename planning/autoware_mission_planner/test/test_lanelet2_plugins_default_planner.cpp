@@ -54,6 +54,8 @@ struct DefaultPlanner : public autoware::mission_planner::lanelet2::DefaultPlann
     return is_goal_valid(goal, path_lanelets);
   }
 
+  [[nodiscard]] size_t cached_route_section_size() const { return route_section_cache_.size(); }
+
   lanelet::ConstLanelets get_lanelets_from_ids(const std::vector<lanelet::Id> & ids)
   {
     const auto lanelet_map_ptr = route_handler_.getLaneletMapPtr();
@@ -371,6 +373,45 @@ TEST_F(DefaultPlannerTest, plan)
   }
 }
 
+TEST_F(DefaultPlannerTest, planWithCachedRouteSections)
+{
+  planner_.set_default_test_map();
+
+  Pose start_pose;
+  start_pose.position.x = 3717.239501953125;
+  start_pose.position.y = 73720.84375;
+  start_pose.orientation.z = 0.2412209576008544;
+  start_pose.orientation.w = 0.9704702236915761;
+
+  Pose goal_pose;
+  goal_pose.position.x = 3810.24951171875;
+  goal_pose.position.y = 73769.2578125;
+  goal_pose.orientation.z = 0.23908402523702438;
+  goal_pose.orientation.w = 0.9709988820160721;
+
+  const RoutePoints route_points{start_pose, goal_pose};
+  const auto route = planner_.plan(route_points);
+  ASSERT_FALSE(route.segments.empty());
+  EXPECT_EQ(planner_.cached_route_section_size(), 1u);
+
+  // the same section is reused and gives the same route
+  const auto replanned_route = planner_.plan(route_points);
+  EXPECT_EQ(planner_.cached_route_section_size(), 1u);
+  ASSERT_EQ(replanned_route.segments.size(), route.segments.size());
+  for (size_t i = 0; i < route.segments.size(); ++i) {
+    EXPECT_EQ(
+      replanned_route.segments.at(i).preferred_primitive.id,
+      route.segments.at(i).preferred_primitive.id);
+    EXPECT_EQ(
+      replanned_route.segments.at(i).primitives.size(), route.segments.at(i).primitives.size());
+  }
+
+  // the preferred lanelets of the current route are part of the key
+  planner_.updateRoute(route);
+  planner_.plan(route_points);
+  EXPECT_EQ(planner_.cached_route_section_size(), 2u);
+}
+
 //  `visualize` function is used for user too, so it is more important than debug functions
 TEST_F(DefaultPlannerTest, visualize)
 {
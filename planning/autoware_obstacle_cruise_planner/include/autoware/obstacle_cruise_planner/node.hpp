@@ -20,6 +20,7 @@
 #include "autoware/obstacle_cruise_planner/pid_based_planner/pid_based_planner.hpp"
 #include "autoware/obstacle_cruise_planner/type_alias.hpp"
 #include "autoware/signal_processing/lowpass_filter_1d.hpp"
+#include "autoware/universe_utils/geometry/boost_geometry.hpp"
 #include "autoware/universe_utils/ros/logger_level_configure.hpp"
 #include "autoware/universe_utils/ros/polling_subscriber.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
@@ -76,6 +77,13 @@ private:
     const std::vector<Obstacle> & obstacles);
   std::vector<TrajectoryPoint> decimateTrajectoryPoints(
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points) const;
+  struct DecimatedTrajectory;
+  struct PreciseLatDist;
+  const DecimatedTrajectory & getDecimatedTrajectory(
+    const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points);
+  double calcPreciseLatDist(
+    const Obstacle & obstacle, const DecimatedTrajectory & decimated_traj,
+    std::unordered_map<std::string, PreciseLatDist> & precise_lat_dists) const;
   std::optional<StopObstacle> createStopObstacleForPredictedObject(
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
     const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
@@ -209,6 +217,31 @@ private:
   // PointCloud-based stop obstacle history
   std::vector<StopObstacle> stop_pc_obstacle_history_;
 
+  // decimated trajectory and its polygons, which are reused while the trajectory, the ego pose and
+  // the parameters are same
+  struct DecimatedTrajectory
+  {
+    std::vector<TrajectoryPoint> input_traj_points;
+    geometry_msgs::msg::Pose ego_pose;
+    std::vector<TrajectoryPoint> points;
+    std::vector<Polygon2d> polys;
+    std::vector<autoware::universe_utils::Box2d> poly_boxes;
+    size_t generation;
+  };
+  std::optional<DecimatedTrajectory> decimated_traj_;
+  size_t decimated_traj_generation_{0};
+
+  // distance between the decimated trajectory polygons and the PredictedObject-based obstacle,
+  // which is reused while the polygons are same and the obstacle does not move
+  struct PreciseLatDist
+  {
+    geometry_msgs::msg::Pose pose;
+    Shape shape;
+    size_t traj_generation;
+    double lat_dist;
+  };
+  std::unordered_map<std::string, PreciseLatDist> prev_precise_lat_dists_;
+
   // behavior determination parameter
   struct BehaviorDeterminationParam
   {
@@ -38,6 +38,18 @@ PoseWithStamp getCurrentObjectPose(
 
 std::vector<StopObstacle> getClosestStopObstacles(const std::vector<StopObstacle> & stop_obstacles);
 
+/**
+ * @brief cluster the points whose distance is within the tolerance, as the euclidean cluster
+ * extraction does, with the connected components of the points hashed into the cells of the size
+ * of the tolerance
+ * @details only the points in the neighboring cells are compared, so no kd-tree is built.
+ * @return indices of the points of each cluster whose size is in [min_cluster_size,
+ * max_cluster_size]
+ */
+std::vector<std::vector<size_t>> clusterPoints(
+  const PointCloud & points, const double tolerance, const size_t min_cluster_size,
+  const size_t max_cluster_size);
+
 template <class T>
 size_t getIndexWithLongitudinalOffset(
   const T & points, const double longitudinal_offset, std::optional<size_t> start_idx)
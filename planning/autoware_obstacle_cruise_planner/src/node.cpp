@@ -16,6 +16,7 @@
 
 #include "autoware/motion_utils/resample/resample.hpp"
 #include "autoware/motion_utils/trajectory/conversion.hpp"
+#include "autoware/motion_utils/trajectory/indexed_trajectory.hpp"
 #include "autoware/object_recognition_utils/predicted_path_utils.hpp"
 #include "autoware/obstacle_cruise_planner/polygon_utils.hpp"
 #include "autoware/obstacle_cruise_planner/utils.hpp"
@@ -27,11 +28,12 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 
 #include <pcl/filters/voxel_grid.h>
-#include <pcl/segmentation/extract_clusters.h>
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <algorithm>
 #include <chrono>
+#include <memory>
+#include <utility>
 
 namespace
 {
@@ -60,12 +62,13 @@ std::optional<T> getObstacleFromUuid(
 }
 
 std::optional<double> calcDistanceToFrontVehicle(
-  const std::vector<TrajectoryPoint> & traj_points, const size_t ego_idx,
-  const geometry_msgs::msg::Point & obstacle_pos)
+  const autoware::motion_utils::IndexedTrajectory<std::vector<TrajectoryPoint>> &
+    indexed_traj_points,
+  const size_t ego_idx, const geometry_msgs::msg::Point & obstacle_pos)
 {
-  const size_t obstacle_idx = autoware::motion_utils::findNearestIndex(traj_points, obstacle_pos);
+  const size_t obstacle_idx = indexed_traj_points.findNearestIndex(obstacle_pos);
   const auto ego_to_obstacle_distance =
-    autoware::motion_utils::calcSignedArcLength(traj_points, ego_idx, obstacle_idx);
+    indexed_traj_points.calcSignedArcLength(ego_idx, obstacle_idx);
   if (ego_to_obstacle_distance < 0.0) return std::nullopt;
   return ego_to_obstacle_distance;
 }
@@ -162,6 +165,9 @@ std::pair<double, double> calculateObstacleVelocitiesRelativeToTrajectory(
   return std::make_pair(projected_velocity[0], sign * projected_velocity[1]);
 }
 
+// the distance between the polygons changes at most by the displacement of the obstacle
+constexpr double precise_lat_dist_reuse_displacement = 0.01;
+
 double calcObstacleMaxLength(const Shape & shape)
 {
   if (shape.type == Shape::BOUNDING_BOX) {
@@ -603,6 +609,7 @@ rcl_interfaces::msg::SetParametersResult ObstacleCruisePlannerNode::onParam(
   const std::vector<rclcpp::Parameter> & parameters)
 {
   planner_ptr_->onParam(parameters);
+  decimated_traj_ = std::nullopt;
 
   autoware::universe_utils::updateParam<bool>(
     parameters, "common.enable_debug_info", enable_debug_info_);
@@ -708,17 +715,16 @@ void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr ms
 
   // 6. Slow down planning
   std::optional<VelocityLimit> slow_down_vel_limit;
-  const auto slow_down_traj_points = planner_ptr_->generateSlowDownTrajectory(
+  auto slow_down_traj_points = planner_ptr_->generateSlowDownTrajectory(
     planner_data, cruise_traj_points, slow_down_obstacles, slow_down_vel_limit);
   publishVelocityLimit(slow_down_vel_limit, "slow_down");
 
   // 7. Publish trajectory
-  const auto output_traj =
-    autoware::motion_utils::convertToTrajectory(slow_down_traj_points, msg->header);
-  trajectory_pub_->publish(output_traj);
+  trajectory_pub_->publish(std::make_unique<Trajectory>(
+    autoware::motion_utils::convertToTrajectory(std::move(slow_down_traj_points), msg->header)));
 
   // 8. Publish debug data
-  published_time_publisher_->publish_if_subscribed(trajectory_pub_, output_traj.header.stamp);
+  published_time_publisher_->publish_if_subscribed(trajectory_pub_, msg->header.stamp);
   planner_ptr_->publishDiagnostics(now());
   publishDebugMarker();
   publishDebugInfo();
@@ -828,6 +834,7 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
   const double max_lat_time_margin =
     std::max({p.max_lat_time_margin_for_stop, p.max_lat_time_margin_for_cruise});
   const size_t ego_idx = ego_nearest_param_.findIndex(traj_points, odometry.pose.pose);
+  const autoware::motion_utils::IndexedTrajectory indexed_traj_points(traj_points);
 
   std::vector<Obstacle> target_obstacles;
   for (const auto & predicted_object : objects.objects) {
@@ -856,7 +863,7 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
 
     // 2. Check if the obstacle is in front of the ego.
     const auto ego_to_obstacle_distance =
-      calcDistanceToFrontVehicle(traj_points, ego_idx, current_obstacle_pose.pose.position);
+      calcDistanceToFrontVehicle(indexed_traj_points, ego_idx, current_obstacle_pose.pose.position);
     if (!ego_to_obstacle_distance) {
       RCLCPP_INFO_EXPRESSION(
         get_logger(), enable_debug_info_, "Ignore obstacle (%s) since it is not front obstacle.",
@@ -867,7 +874,7 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
     // 3. Check if rough lateral distance and time to reach trajectory are smaller than the
     // threshold
     const double lat_dist_from_obstacle_to_traj =
-      autoware::motion_utils::calcLateralOffset(traj_points, current_obstacle_pose.pose.position);
+      indexed_traj_points.calcLateralOffset(current_obstacle_pose.pose.position);
 
     const double min_lat_dist_to_traj_poly = [&]() {
       const double obstacle_max_length = calcObstacleMaxLength(predicted_object.shape);
@@ -945,20 +952,15 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
       p.pointcloud_voxel_grid_x, p.pointcloud_voxel_grid_y, p.pointcloud_voxel_grid_z);
     filter.filter(*filtered_points_ptr);
 
-    pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-    tree->setInputCloud(filtered_points_ptr);
-    std::vector<pcl::PointIndices> clusters;
-    pcl::EuclideanClusterExtraction<pcl::PointXYZ> ec;
-    ec.setClusterTolerance(p.pointcloud_cluster_tolerance);
-    ec.setMinClusterSize(p.pointcloud_min_cluster_size);
-    ec.setMaxClusterSize(p.pointcloud_max_cluster_size);
-    ec.setSearchMethod(tree);
-    ec.setInputCloud(filtered_points_ptr);
-    ec.extract(clusters);
+    const auto clusters = obstacle_cruise_utils::clusterPoints(
+      *filtered_points_ptr, p.pointcloud_cluster_tolerance,
+      static_cast<size_t>(p.pointcloud_min_cluster_size),
+      static_cast<size_t>(p.pointcloud_max_cluster_size));
 
     const auto max_lat_margin =
       std::max(p.max_lat_margin_for_stop_against_unknown, p.max_lat_margin_for_slow_down);
     const size_t ego_idx = ego_nearest_param_.findIndex(traj_points, odometry.pose.pose);
+    const autoware::motion_utils::IndexedTrajectory indexed_traj_points(traj_points);
 
     // 3. convert clusters to obstacles
     for (const auto & cluster_indices : clusters) {
@@ -971,16 +973,16 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
       std::optional<geometry_msgs::msg::Point> slow_down_front_collision_point = std::nullopt;
       std::optional<geometry_msgs::msg::Point> slow_down_back_collision_point = std::nullopt;
 
-      for (const auto & index : cluster_indices.indices) {
+      for (const auto index : cluster_indices) {
         const auto obstacle_point = toGeomPoint(filtered_points_ptr->points[index]);
         const auto current_lat_dist_from_obstacle_to_traj =
-          autoware::motion_utils::calcLateralOffset(traj_points, obstacle_point);
+          indexed_traj_points.calcLateralOffset(obstacle_point);
         const auto min_lat_dist_to_traj_poly =
           std::abs(current_lat_dist_from_obstacle_to_traj) - vehicle_info_.vehicle_width_m;
 
         if (min_lat_dist_to_traj_poly < max_lat_margin) {
           const auto current_ego_to_obstacle_distance =
-            calcDistanceToFrontVehicle(traj_points, ego_idx, obstacle_point);
+            calcDistanceToFrontVehicle(indexed_traj_points, ego_idx, obstacle_point);
           if (current_ego_to_obstacle_distance) {
             ego_to_obstacle_distance =
               std::min(ego_to_obstacle_distance, *current_ego_to_obstacle_distance);
@@ -1088,25 +1090,21 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstPredictedObjectObstacles(
   stop_watch_.tic(__func__);
 
   // calculated decimated trajectory points and trajectory polygon
-  const auto decimated_traj_points = decimateTrajectoryPoints(odometry, traj_points);
-  const auto decimated_traj_polys =
-    createOneStepPolygons(decimated_traj_points, vehicle_info_, odometry.pose.pose);
+  const auto & decimated_traj = getDecimatedTrajectory(odometry, traj_points);
+  const auto & decimated_traj_points = decimated_traj.points;
+  const auto & decimated_traj_polys = decimated_traj.polys;
   debug_data_ptr_->detection_polygons = decimated_traj_polys;
 
   // determine ego's behavior from stop, cruise and slow down
   std::vector<StopObstacle> stop_obstacles;
   std::vector<CruiseObstacle> cruise_obstacles;
   std::vector<SlowDownObstacle> slow_down_obstacles;
+  std::unordered_map<std::string, PreciseLatDist> precise_lat_dists;
   slow_down_condition_counter_.resetCurrentUuids();
   for (const auto & obstacle : obstacles) {
-    const auto obstacle_poly = autoware::universe_utils::toPolygon2d(obstacle.pose, obstacle.shape);
-
     // Calculate distance between trajectory and obstacle first
-    double precise_lat_dist = std::numeric_limits<double>::max();
-    for (const auto & traj_poly : decimated_traj_polys) {
-      const double current_precise_lat_dist = bg::distance(traj_poly, obstacle_poly);
-      precise_lat_dist = std::min(precise_lat_dist, current_precise_lat_dist);
-    }
+    const double precise_lat_dist =
+      calcPreciseLatDist(obstacle, decimated_traj, precise_lat_dists);
 
     // Filter obstacles for cruise, stop and slow down
     const auto cruise_obstacle = createCruiseObstacle(
@@ -1151,6 +1149,7 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstPredictedObjectObstacles(
   checkConsistency(objects.header.stamp, objects, stop_obstacles);
 
   // update previous obstacles
+  prev_precise_lat_dists_ = std::move(precise_lat_dists);
   prev_stop_object_obstacles_ = stop_obstacles;
   prev_cruise_object_obstacles_ = cruise_obstacles;
   prev_slow_down_object_obstacles_ = slow_down_obstacles;
@@ -1173,10 +1172,9 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstPointCloudObstacles(
   const auto & p = behavior_determination_param_;
 
   // calculated decimated trajectory points and trajectory polygon
-  const auto decimated_traj_points = decimateTrajectoryPoints(odometry, traj_points);
-  const auto decimated_traj_polys =
-    createOneStepPolygons(decimated_traj_points, vehicle_info_, odometry.pose.pose);
-  debug_data_ptr_->detection_polygons = decimated_traj_polys;
+  const auto & decimated_traj = getDecimatedTrajectory(odometry, traj_points);
+  const auto & decimated_traj_points = decimated_traj.points;
+  debug_data_ptr_->detection_polygons = decimated_traj.polys;
 
   // determine ego's behavior from stop and slow down
   std::vector<StopObstacle> stop_obstacles;
@@ -1257,6 +1255,70 @@ std::vector<TrajectoryPoint> ObstacleCruisePlannerNode::decimateTrajectoryPoints
   return extended_traj_points;
 }
 
+const ObstacleCruisePlannerNode::DecimatedTrajectory &
+ObstacleCruisePlannerNode::getDecimatedTrajectory(
+  const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points)
+{
+  if (
+    decimated_traj_ && decimated_traj_->ego_pose == odometry.pose.pose &&
+    decimated_traj_->input_traj_points == traj_points) {
+    return *decimated_traj_;
+  }
+
+  DecimatedTrajectory decimated_traj;
+  decimated_traj.input_traj_points = traj_points;
+  decimated_traj.ego_pose = odometry.pose.pose;
+  decimated_traj.points = decimateTrajectoryPoints(odometry, traj_points);
+  decimated_traj.polys =
+    createOneStepPolygons(decimated_traj.points, vehicle_info_, odometry.pose.pose);
+  for (const auto & poly : decimated_traj.polys) {
+    decimated_traj.poly_boxes.push_back(
+      bg::return_envelope<autoware::universe_utils::Box2d>(poly));
+  }
+  decimated_traj.generation = ++decimated_traj_generation_;
+  decimated_traj_ = std::move(decimated_traj);
+  return *decimated_traj_;
+}
+
+double ObstacleCruisePlannerNode::calcPreciseLatDist(
+  const Obstacle & obstacle, const DecimatedTrajectory & decimated_traj,
+  std::unordered_map<std::string, PreciseLatDist> & precise_lat_dists) const
+{
+  // reuse the distance of the previous cycle if neither the polygons nor the obstacle changed
+  const auto prev_itr = prev_precise_lat_dists_.find(obstacle.uuid);
+  if (
+    prev_itr != prev_precise_lat_dists_.end() &&
+    prev_itr->second.traj_generation == decimated_traj.generation &&
+    prev_itr->second.shape == obstacle.shape) {
+    const auto & prev_pose = prev_itr->second.pose;
+    const double yaw_diff = autoware::universe_utils::normalizeRadian(
+      tf2::getYaw(obstacle.pose.orientation) - tf2::getYaw(prev_pose.orientation));
+    const double displacement =
+      autoware::universe_utils::calcDistance2d(obstacle.pose, prev_pose) +
+      calcObstacleMaxLength(obstacle.shape) * std::abs(yaw_diff);
+    if (displacement < precise_lat_dist_reuse_displacement) {
+      precise_lat_dists.emplace(obstacle.uuid, prev_itr->second);
+      return prev_itr->second.lat_dist;
+    }
+  }
+
+  const auto obstacle_poly = autoware::universe_utils::toPolygon2d(obstacle.pose, obstacle.shape);
+  const auto obstacle_box = bg::return_envelope<autoware::universe_utils::Box2d>(obstacle_poly);
+  double precise_lat_dist = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < decimated_traj.polys.size(); ++i) {
+    // the distance between the boxes is not larger than the one between the polygons
+    if (bg::distance(decimated_traj.poly_boxes.at(i), obstacle_box) >= precise_lat_dist) {
+      continue;
+    }
+    const double current_precise_lat_dist = bg::distance(decimated_traj.polys.at(i), obstacle_poly);
+    precise_lat_dist = std::min(precise_lat_dist, current_precise_lat_dist);
+  }
+  precise_lat_dists.emplace(
+    obstacle.uuid,
+    PreciseLatDist{obstacle.pose, obstacle.shape, decimated_traj.generation, precise_lat_dist});
+  return precise_lat_dist;
+}
+
 std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
   const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
   const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
@@ -17,6 +17,12 @@
 #include "autoware/object_recognition_utils/predicted_path_utils.hpp"
 #include "autoware/universe_utils/ros/marker_helper.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <unordered_map>
+
 namespace obstacle_cruise_utils
 {
 namespace
@@ -38,6 +44,22 @@ std::optional<geometry_msgs::msg::Pose> getCurrentObjectPoseFromPredictedPath(
   return pose.get();
 }
 
+uint64_t toCellKey(const int64_t x, const int64_t y, const int64_t z)
+{
+  constexpr uint64_t mask = (uint64_t{1} << 21) - 1;
+  return ((static_cast<uint64_t>(x) & mask) << 42) | ((static_cast<uint64_t>(y) & mask) << 21) |
+         (static_cast<uint64_t>(z) & mask);
+}
+
+size_t findRoot(std::vector<size_t> & parents, size_t index)
+{
+  while (parents.at(index) != index) {
+    parents.at(index) = parents.at(parents.at(index));
+    index = parents.at(index);
+  }
+  return index;
+}
+
 std::optional<geometry_msgs::msg::Pose> getCurrentObjectPoseFromPredictedPaths(
   const std::vector<PredictedPath> & predicted_paths, const rclcpp::Time & obj_base_time,
   const rclcpp::Time & current_time)
@@ -113,4 +135,71 @@ std::vector<StopObstacle> getClosestStopObstacles(const std::vector<StopObstacle
   }
   return candidates;
 }
+
+std::vector<std::vector<size_t>> clusterPoints(
+  const PointCloud & points, const double tolerance, const size_t min_cluster_size,
+  const size_t max_cluster_size)
+{
+  const auto to_cell_index = [&](const float value) {
+    return static_cast<int64_t>(std::floor(value / tolerance));
+  };
+
+  std::unordered_map<uint64_t, std::vector<size_t>> cells;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & point = points.at(i);
+    cells[toCellKey(to_cell_index(point.x), to_cell_index(point.y), to_cell_index(point.z))]
+      .push_back(i);
+  }
+
+  // connect the points within the tolerance in the neighboring cells
+  const double squared_tolerance = tolerance * tolerance;
+  std::vector<size_t> parents(points.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & point = points.at(i);
+    const auto x = to_cell_index(point.x);
+    const auto y = to_cell_index(point.y);
+    const auto z = to_cell_index(point.z);
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        for (int64_t dz = -1; dz <= 1; ++dz) {
+          const auto cell = cells.find(toCellKey(x + dx, y + dy, z + dz));
+          if (cell == cells.end()) {
+            continue;
+          }
+          for (const auto j : cell->second) {
+            if (j <= i) {
+              continue;
+            }
+            const auto & other = points.at(j);
+            const double squared_dist = std::pow(point.x - other.x, 2) +
+                                        std::pow(point.y - other.y, 2) +
+                                        std::pow(point.z - other.z, 2);
+            if (squared_dist <= squared_tolerance) {
+              parents.at(findRoot(parents, j)) = findRoot(parents, i);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::unordered_map<size_t, size_t> root_to_cluster;
+  std::vector<std::vector<size_t>> clusters;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto [itr, inserted] = root_to_cluster.emplace(findRoot(parents, i), clusters.size());
+    if (inserted) {
+      clusters.emplace_back();
+    }
+    clusters.at(itr->second).push_back(i);
+  }
+  clusters.erase(
+    std::remove_if(
+      clusters.begin(), clusters.end(),
+      [&](const auto & cluster) {
+        return cluster.size() < min_cluster_size || max_cluster_size < cluster.size();
+      }),
+    clusters.end());
+  return clusters;
+}
 }  // namespace obstacle_cruise_utils
@@ -71,3 +71,29 @@ TEST(ObstacleCruisePlannerUtilsTest, getClosestStopObstacles)
   stop_obstacles.emplace_back(generate_stop_obstacle(ObjectClassification::BUS, 10.0));
   EXPECT_EQ(3, obstacle_cruise_utils::getClosestStopObstacles(stop_obstacles).size());
 }
+
+TEST(ObstacleCruisePlannerUtilsTest, clusterPoints)
+{
+  PointCloud points;
+  EXPECT_EQ(0, obstacle_cruise_utils::clusterPoints(points, 0.5, 1, 100).size());
+
+  // a line of 10 points and a line of 3 points, which are separated, and an isolated point
+  for (int i = 0; i < 10; ++i) {
+    points.push_back(pcl::PointXYZ(0.4 * i, 0.0, 0.0));
+  }
+  for (int i = 0; i < 3; ++i) {
+    points.push_back(pcl::PointXYZ(10.0 + 0.4 * i, -5.0, 0.0));
+  }
+  points.push_back(pcl::PointXYZ(-20.0, -20.0, 1.0));
+
+  const auto clusters = obstacle_cruise_utils::clusterPoints(points, 0.5, 2, 100);
+  ASSERT_EQ(2, clusters.size());
+  EXPECT_EQ(10, clusters.at(0).size());
+  EXPECT_EQ(3, clusters.at(1).size());
+  EXPECT_EQ(10, clusters.at(1).front());
+
+  // the clusters larger than the max size are removed
+  EXPECT_EQ(1, obstacle_cruise_utils::clusterPoints(points, 0.5, 2, 5).size());
+  // the points are not connected if the tolerance is smaller than the interval
+  EXPECT_EQ(0, obstacle_cruise_utils::clusterPoints(points, 0.3, 2, 100).size());
+}
@@ -20,6 +20,8 @@
 #include "autoware/path_optimizer/vehicle_model/vehicle_model_interface.hpp"
 #include "autoware/universe_utils/system/time_keeper.hpp"
 
+#include <Eigen/Sparse>
+
 #include <memory>
 #include <vector>
 
@@ -32,8 +34,10 @@ class StateEquationGenerator
 public:
   struct Matrix
   {
-    Eigen::MatrixXd A;
-    Eigen::MatrixXd B;
+    // NOTE: A and B are block banded, and all the elements of their blocks are stored so that their
+    //       sparsity pattern only depends on the number of points.
+    Eigen::SparseMatrix<double> A;
+    Eigen::SparseMatrix<double> B;
     Eigen::VectorXd W;
   };
 
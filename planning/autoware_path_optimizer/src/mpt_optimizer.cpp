@@ -166,6 +166,28 @@ double calcLateralDistToBounds(
 
   return closest_dist_to_bound;
 }
+
+// add the stored elements of the sparse matrix, including the zeros, as a block of the triplets
+void addSparseBlock(
+  std::vector<Eigen::Triplet<double>> & triplet_vec, const Eigen::SparseMatrix<double> & mat,
+  const size_t row_offset, const size_t col_offset, const double scale = 1.0)
+{
+  for (Eigen::Index k = 0; k < mat.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, k); it; ++it) {
+      triplet_vec.emplace_back(row_offset + it.row(), col_offset + it.col(), scale * it.value());
+    }
+  }
+}
+
+// add the identity matrix of the size as a block of the triplets
+void addIdentityBlock(
+  std::vector<Eigen::Triplet<double>> & triplet_vec, const size_t size, const size_t row_offset,
+  const size_t col_offset)
+{
+  for (size_t i = 0; i < size; ++i) {
+    triplet_vec.emplace_back(row_offset + i, col_offset + i, 1.0);
+  }
+}
 }  // namespace
 
 MPTOptimizer::MPTParam::MPTParam(
@@ -584,7 +606,7 @@ std::vector<ReferencePoint> MPTOptimizer::calcReferencePoints(
   ref_points = autoware::motion_utils::cropPoints(
     ref_points, p.ego_pose.position, ego_seg_idx, forward_traj_length + tmp_margin,
     backward_traj_length);
-  ref_points_spline = autoware::interpolation::SplineInterpolationPoints2d(ref_points);
+  ref_points_spline.calcSplineCoefficients(ref_points);
   ego_seg_idx = trajectory_utils::findEgoSegmentIndex(ref_points, p.ego_pose, ego_nearest_param_);
 
   // 5. update fixed points, and resample
@@ -592,7 +614,7 @@ std::vector<ReferencePoint> MPTOptimizer::calcReferencePoints(
   //       New start point may be added and resampled. Spline calculation is required.
   updateFixedPoint(ref_points);
   ref_points = trajectory_utils::sanitizePoints(ref_points);
-  ref_points_spline = autoware::interpolation::SplineInterpolationPoints2d(ref_points);
+  ref_points_spline.calcSplineCoefficients(ref_points);
 
   // 6. update bounds
   // NOTE: After this, resample must not be called since bounds are not interpolated.
@@ -1260,14 +1282,14 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   sparse_T_mat.setFromTriplets(triplet_T_vec.begin(), triplet_T_vec.end());
 
   // NOTE: min J(v) = min (v'Hv + v'g)
-  Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
-  H_x.triangularView<Eigen::Upper>() =
-    Eigen::MatrixXd(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat);
-  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
+  const Eigen::SparseMatrix<double> H_x = sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat;
 
-  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
-  H.block(0, 0, N_x, N_x) = H_x;
-  H.block(N_x, N_x, N_u, N_u) = val_mat.R;
+  std::vector<Eigen::Triplet<double>> H_triplet_vec;
+  H_triplet_vec.reserve(H_x.nonZeros() + val_mat.R.nonZeros());
+  addSparseBlock(H_triplet_vec, H_x, 0, 0);
+  addSparseBlock(H_triplet_vec, val_mat.R, N_x, N_x);
+  Eigen::SparseMatrix<double> H(N_v, N_v);
+  H.setFromTriplets(H_triplet_vec.begin(), H_triplet_vec.end());
 
   Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
   g.segment(0, N_x) = T_vec.transpose() * val_mat.Q * sparse_T_mat;
@@ -1328,15 +1350,17 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows += N_u;
   }
 
-  // NOTE: The following takes 1 [ms]
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
+  // NOTE: A is assembled from triplets where all the elements of the blocks are stored, so that its
+  //       sparsity pattern does not depend on the values and the solver can be updated in place.
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
   Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::osqp_interface::INF);
   Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::osqp_interface::INF);
   size_t A_rows_end = 0;
 
   // 1. State equation
-  A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - mpt_mat.A;
-  A.block(0, N_x, N_x, N_u) = -mpt_mat.B;
+  addIdentityBlock(A_triplet_vec, N_x, 0, 0);
+  addSparseBlock(A_triplet_vec, mpt_mat.A, 0, 0, -1.0);
+  addSparseBlock(A_triplet_vec, mpt_mat.B, 0, N_x, -1.0);
   lb.segment(0, N_x) = mpt_mat.W;
   ub.segment(0, N_x) = mpt_mat.W;
   A_rows_end += N_x;
@@ -1372,16 +1396,13 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       // A := [C | O | ... | O | I | O | ...
       //      -C | O | ... | O | I | O | ...
       //          O    | O | ... | O | I | O | ... ]
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_x) = C_sparse_mat;
-      A_blk.block(N_ref, 0, N_ref, N_x) = -C_sparse_mat;
+      addSparseBlock(A_triplet_vec, C_sparse_mat, A_rows_end, 0);
+      addSparseBlock(A_triplet_vec, C_sparse_mat, A_rows_end + N_ref, 0, -1.0);
 
       const size_t local_A_offset_cols = N_x + N_u + (!mpt_param_.l_inf_norm ? N_ref * l_idx : 0);
-      A_blk.block(0, local_A_offset_cols, N_ref, N_ref) = Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(2 * N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
+      addIdentityBlock(A_triplet_vec, N_ref, A_rows_end, local_A_offset_cols);
+      addIdentityBlock(A_triplet_vec, N_ref, A_rows_end + N_ref, local_A_offset_cols);
+      addIdentityBlock(A_triplet_vec, N_ref, A_rows_end + 2 * N_ref, local_A_offset_cols);
 
       // lb := [lower_bound - C
       //        C - upper_bound
@@ -1390,7 +1411,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       lb_blk.segment(0, N_ref) = -C_vec + part_lb;
       lb_blk.segment(N_ref, N_ref) = C_vec - part_ub;
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = lb_blk;
 
       A_rows_end += A_blk_rows;
@@ -1400,10 +1420,8 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     if (mpt_param_.hard_constraint) {
       const size_t A_blk_rows = N_ref;
 
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_ref) = C_sparse_mat;
+      addSparseBlock(A_triplet_vec, C_sparse_mat, A_rows_end, 0);
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = part_lb - C_vec;
       ub.segment(A_rows_end, A_blk_rows) = part_ub - C_vec;
 
@@ -1414,7 +1432,7 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // 3. fixed points constraint
   // X = B v + w where point is fixed
   for (const size_t i : fixed_points_indices) {
-    A.block(A_rows_end, D_x * i, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    addIdentityBlock(A_triplet_vec, D_x, A_rows_end, D_x * i);
 
     lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
     ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
@@ -1424,7 +1442,7 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
 
   // 4. steer angle limit
   if (mpt_param_.steer_limit_constraint) {
-    A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+    addIdentityBlock(A_triplet_vec, N_u, A_rows_end, N_x);
 
     // TODO(murooka) use curvature by stabling optimization
     // Currently, when using curvature, the optimization result is weird with sample_map.
@@ -1442,6 +1460,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows_end += N_u;
   }
 
+  Eigen::SparseMatrix<double> A(A_rows, N_v);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+
   return ConstraintMatrix{A, lb, ub};
 }
 
@@ -1493,8 +1514,8 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     updateMatrixForManualWarmStart(obj_mat, const_mat, u0);
 
   // calculate matrices for qp
-  const Eigen::MatrixXd & H = updated_obj_mat.hessian;
-  const Eigen::MatrixXd & A = updated_const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = updated_obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = updated_const_mat.linear;
   const auto f = toStdVector(updated_obj_mat.gradient);
   const auto upper_bound = toStdVector(updated_const_mat.upper_bound);
   const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
@@ -1505,21 +1526,17 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   const autoware::osqp_interface::CSC_Matrix P_csc =
     autoware::osqp_interface::calCSCMatrixTrapezoidal(H);
   const autoware::osqp_interface::CSC_Matrix A_csc = autoware::osqp_interface::calCSCMatrix(A);
-  if (
-    prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
-    RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
-    osqp_solver_ptr_->updateCscP(P_csc);
-    osqp_solver_ptr_->updateQ(f);
-    osqp_solver_ptr_->updateCscA(A_csc);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
+  if (prev_solution_status_ == 1 && mpt_param_.enable_warm_start) {
+    // NOTE: the workspace is updated in place only if the sparsity pattern is unchanged
+    const bool is_updated =
+      osqp_solver_ptr_->updateOrInitializeProblem(P_csc, A_csc, f, lower_bound, upper_bound);
+    RCLCPP_INFO_EXPRESSION(
+      logger_, enable_debug_info_, is_updated ? "warm start" : "no warm start");
   } else {
     RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "no warm start");
     osqp_solver_ptr_ = std::make_unique<autoware::osqp_interface::OSQPInterface>(
       P_csc, A_csc, f, lower_bound, upper_bound, osqp_epsilon_);
   }
-  prev_mat_n_ = H.rows();
-  prev_mat_m_ = A.rows();
   time_keeper_->end_track("initOsqp");
 
   // solve qp
@@ -1609,8 +1626,8 @@ MPTOptimizer::updateMatrixForManualWarmStart(
     return {obj_mat, const_mat};
   }
 
-  const Eigen::MatrixXd & H = obj_mat.hessian;
-  const Eigen::MatrixXd & A = const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = const_mat.linear;
 
   auto updated_obj_mat = obj_mat;
   auto updated_const_mat = const_mat;
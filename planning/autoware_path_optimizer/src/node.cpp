@@ -25,6 +25,8 @@
 #include <chrono>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <utility>
 
 namespace autoware::path_optimizer
 {
@@ -246,11 +248,9 @@ void PathOptimizer::onPath(const Path::ConstSharedPtr path_ptr)
       get_logger(), *get_clock(), 5000,
       "Backward path is NOT supported. Just converting path to trajectory");
 
-    const auto traj_points = trajectory_utils::convertToTrajectoryPoints(path_ptr->points);
-    const auto output_traj_msg =
-      autoware::motion_utils::convertToTrajectory(traj_points, path_ptr->header);
-    traj_pub_->publish(output_traj_msg);
-    published_time_publisher_->publish_if_subscribed(traj_pub_, output_traj_msg.header.stamp);
+    traj_pub_->publish(std::make_unique<Trajectory>(autoware::motion_utils::convertToTrajectory(
+      trajectory_utils::convertToTrajectoryPoints(path_ptr->points), path_ptr->header)));
+    published_time_publisher_->publish_if_subscribed(traj_pub_, path_ptr->header.stamp);
     return;
   }
 
@@ -273,10 +273,9 @@ void PathOptimizer::onPath(const Path::ConstSharedPtr path_ptr)
   // NOTE: This function must be called after measuring onPath calculation time
   debug_calculation_time_float_pub_->publish(createFloat64Stamped(now(), stop_watch_.toc()));
 
-  const auto output_traj_msg =
-    autoware::motion_utils::convertToTrajectory(full_traj_points, path_ptr->header);
-  traj_pub_->publish(output_traj_msg);
-  published_time_publisher_->publish_if_subscribed(traj_pub_, output_traj_msg.header.stamp);
+  traj_pub_->publish(std::make_unique<Trajectory>(
+    autoware::motion_utils::convertToTrajectory(std::move(full_traj_points), path_ptr->header)));
+  published_time_publisher_->publish_if_subscribed(traj_pub_, path_ptr->header.stamp);
 
   time_keeper_->end_track(__func__);
 }
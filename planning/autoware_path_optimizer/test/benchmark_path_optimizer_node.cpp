@@ -0,0 +1,73 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/conversion.hpp"
+#include "autoware/path_optimizer/node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_planning_test_manager/autoware_planning_benchmark_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+
+#include <autoware_planning_msgs/msg/path.hpp>
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+
+#include <benchmark/benchmark.h>
+
+using autoware::planning_test_manager::PlanningBenchmarkManager;
+using autoware_planning_msgs::msg::Path;
+using autoware_planning_msgs::msg::Trajectory;
+using nav_msgs::msg::Odometry;
+
+std::shared_ptr<autoware::path_optimizer::PathOptimizer> generateNode()
+{
+  auto node_options = rclcpp::NodeOptions{};
+
+  const auto autoware_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("autoware_test_utils");
+  const auto path_optimizer_dir =
+    ament_index_cpp::get_package_share_directory("autoware_path_optimizer");
+
+  autoware::test_utils::updateNodeOptions(
+    node_options, {autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+                   autoware_test_utils_dir + "/config/test_common.param.yaml",
+                   autoware_test_utils_dir + "/config/test_nearest_search.param.yaml",
+                   path_optimizer_dir + "/config/path_optimizer.param.yaml"});
+
+  return std::make_shared<autoware::path_optimizer::PathOptimizer>(node_options);
+}
+
+static void BM_PathOptimizer(benchmark::State & state)
+{
+  rclcpp::init(0, nullptr);
+  {
+    PlanningBenchmarkManager benchmark_manager;
+    auto test_target_node = generateNode();
+
+    const auto path =
+      autoware::motion_utils::convertToPath<tier4_planning_msgs::msg::PathWithLaneId>(
+        autoware::test_utils::loadPathWithLaneIdInYaml());
+    Odometry odometry;
+    odometry.header = path.header;
+    odometry.pose.pose = path.points.front().pose;
+    benchmark_manager.publish(
+      test_target_node, "path_optimizer/input/odometry",
+      benchmark_manager.getSnapshotField("self_odometry", odometry));
+
+    benchmark_manager.benchmarkWithInput<Path, Trajectory>(
+      state, test_target_node, "path_optimizer/input/path", path, "path_optimizer/output/path");
+  }
+  rclcpp::shutdown();
+}
+BENCHMARK(BM_PathOptimizer)->UseManualTime()->Iterations(100)->Unit(benchmark::kMillisecond);
@@ -20,6 +20,7 @@
 #include "autoware/path_smoother/type_alias.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 
 #include <memory>
 #include <optional>
@@ -83,6 +84,14 @@ private:
     double max_validation_error;
   };
 
+  // solution of the previous cycle with its reference points for the warm start
+  struct Solution
+  {
+    std::vector<TrajectoryPoint> ref_points;
+    std::vector<double> primal;
+    std::vector<double> dual;
+  };
+
   struct Constraint2d
   {
     struct Constraint
@@ -111,6 +120,12 @@ private:
 
   std::unique_ptr<autoware::osqp_interface::OSQPInterface> osqp_solver_ptr_;
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_eb_traj_points_ptr_{nullptr};
+  std::optional<Solution> prev_solution_{std::nullopt};
+
+  // constant parts of the QP, which are updated only when the parameters change
+  Eigen::SparseMatrix<double> raw_P_for_smooth_;
+  double raw_P_smooth_weight_{0.0};
+  autoware::osqp_interface::CSC_Matrix A_csc_;
 
   std::vector<TrajectoryPoint> insertFixedPoint(
     const std::vector<TrajectoryPoint> & traj_point) const;
@@ -122,6 +137,8 @@ private:
     const std::vector<TrajectoryPoint> & traj_points, const bool is_goal_contained,
     const int pad_start_idx);
 
+  void setWarmStartSolution(const std::vector<TrajectoryPoint> & traj_points);
+
   std::optional<std::vector<double>> calcSmoothedTrajectory();
 
   std::optional<std::vector<TrajectoryPoint>> convertOptimizedPointsToTrajectory(
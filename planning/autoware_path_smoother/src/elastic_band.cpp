@@ -26,10 +26,13 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <limits>
+#include <vector>
 
 namespace
 {
+// NOTE: the zero elements are not stored so that the matrix keeps its band structure
 Eigen::SparseMatrix<double> makePMatrix(const int num_points)
 {
   std::vector<Eigen::Triplet<double>> triplet_vec;
@@ -59,8 +62,6 @@ Eigen::SparseMatrix<double> makePMatrix(const int num_points)
         }
       } else if (std::abs(c - r) == 2) {
         assign_value_to_triplet_vec(r, c, 1.0);
-      } else {
-        assign_value_to_triplet_vec(r, c, 0.0);
       }
     }
   }
@@ -192,6 +193,7 @@ void EBPathSmoother::initialize(const bool enable_debug_info, const CommonParam
 void EBPathSmoother::resetPreviousData()
 {
   prev_eb_traj_points_ptr_ = nullptr;
+  prev_solution_ = std::nullopt;
 }
 
 std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
@@ -248,8 +250,10 @@ std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
   if (!optimized_points) {
     RCLCPP_INFO_EXPRESSION(
       logger_, enable_debug_info_, "return std::nullopt since smoothing failed");
+    prev_solution_ = std::nullopt;
     return get_prev_eb_traj_points();
   }
+  prev_solution_->ref_points = padded_traj_points;
 
   // 7. convert optimization result to trajectory
   const auto eb_traj_points =
@@ -317,7 +321,6 @@ void EBPathSmoother::updateConstraint(
 
   std::vector<TrajectoryPoint> debug_fixed_traj_points;  // for debug
 
-  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity(p.num_points, p.num_points);
   std::vector<double> upper_bound(p.num_points, 0.0);
   std::vector<double> lower_bound(p.num_points, 0.0);
   for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
@@ -349,6 +352,16 @@ void EBPathSmoother::updateConstraint(
     }
   }
 
+  // NOTE: the structure of the QP only depends on the parameters, so that the constant parts are
+  //       kept while the parameters are unchanged
+  if (raw_P_for_smooth_.rows() != 2 * p.num_points || raw_P_smooth_weight_ != p.smooth_weight) {
+    raw_P_for_smooth_ = p.smooth_weight * makePMatrix(p.num_points);
+    raw_P_smooth_weight_ = p.smooth_weight;
+    Eigen::SparseMatrix<double> A(p.num_points, p.num_points);
+    A.setIdentity();
+    A_csc_ = autoware::osqp_interface::calCSCMatrix(A);
+  }
+
   Eigen::VectorXd x_mat(2 * p.num_points);
   std::vector<Eigen::Triplet<double>> theta_triplet_vec;
   for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
@@ -362,27 +375,27 @@ void EBPathSmoother::updateConstraint(
   Eigen::SparseMatrix<double> sparse_theta_mat(p.num_points, 2 * p.num_points);
   sparse_theta_mat.setFromTriplets(theta_triplet_vec.begin(), theta_triplet_vec.end());
 
-  // calculate P
-  const Eigen::SparseMatrix<double> raw_P_for_smooth = p.smooth_weight * makePMatrix(p.num_points);
-  const Eigen::MatrixXd theta_P_mat = sparse_theta_mat * raw_P_for_smooth;
-  const Eigen::MatrixXd P_for_smooth = theta_P_mat * sparse_theta_mat.transpose();
-  const Eigen::MatrixXd P_for_lat_error =
-    p.lat_error_weight * Eigen::MatrixXd::Identity(p.num_points, p.num_points);
-  const Eigen::MatrixXd P = P_for_smooth + P_for_lat_error;
+  // calculate P, which is a band matrix kept sparse
+  const Eigen::SparseMatrix<double> theta_P_mat = sparse_theta_mat * raw_P_for_smooth_;
+  Eigen::SparseMatrix<double> P_for_lat_error(p.num_points, p.num_points);
+  P_for_lat_error.setIdentity();
+  const Eigen::SparseMatrix<double> P =
+    Eigen::SparseMatrix<double>(theta_P_mat * sparse_theta_mat.transpose()) +
+    p.lat_error_weight * P_for_lat_error;
+  const auto P_csc = autoware::osqp_interface::calCSCMatrixTrapezoidal(P);
 
   // calculate q
   const Eigen::VectorXd raw_q_for_smooth = theta_P_mat * x_mat;
   const auto q = toStdVector(raw_q_for_smooth);
 
   if (p.enable_warm_start && osqp_solver_ptr_) {
-    osqp_solver_ptr_->updateP(P);
-    osqp_solver_ptr_->updateQ(q);
-    osqp_solver_ptr_->updateA(A);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
+    // NOTE: the workspace is updated in place only if the sparsity pattern is unchanged
+    osqp_solver_ptr_->updateOrInitializeProblem(P_csc, A_csc_, q, lower_bound, upper_bound);
     osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
+    setWarmStartSolution(traj_points);
   } else {
     osqp_solver_ptr_ = std::make_unique<autoware::osqp_interface::OSQPInterface>(
-      P, A, q, lower_bound, upper_bound, p.qp_param.eps_abs);
+      P_csc, A_csc_, q, lower_bound, upper_bound, p.qp_param.eps_abs);
     osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
     osqp_solver_ptr_->updateEpsAbs(p.qp_param.eps_abs);
     osqp_solver_ptr_->updateMaxIter(p.qp_param.max_iteration);
@@ -396,6 +409,32 @@ void EBPathSmoother::updateConstraint(
   time_keeper_ptr_->toc(__func__, "        ");
 }
 
+void EBPathSmoother::setWarmStartSolution(const std::vector<TrajectoryPoint> & traj_points)
+{
+  if (!prev_solution_ || prev_solution_->ref_points.empty()) {
+    return;
+  }
+
+  // shift the previous solution by the arc length which the front point moved along the previous
+  // reference points, so that each lateral offset is given to the point at the same place
+  const auto & prev_ref_points = prev_solution_->ref_points;
+  const double shift_length = autoware::motion_utils::calcSignedArcLength(
+    prev_ref_points, 0, traj_points.front().pose.position);
+  const int shift_idx = static_cast<int>(std::round(shift_length / eb_param_.delta_arc_length));
+
+  const auto shift = [&](const std::vector<double> & prev_values) {
+    std::vector<double> values(traj_points.size(), 0.0);
+    for (size_t i = 0; i < values.size(); ++i) {
+      const int prev_idx = static_cast<int>(i) + shift_idx;
+      if (0 <= prev_idx && prev_idx < static_cast<int>(prev_values.size())) {
+        values.at(i) = prev_values.at(prev_idx);
+      }
+    }
+    return values;
+  };
+  osqp_solver_ptr_->setWarmStart(shift(prev_solution_->primal), shift(prev_solution_->dual));
+}
+
 std::optional<std::vector<double>> EBPathSmoother::calcSmoothedTrajectory()
 {
   time_keeper_ptr_->tic(__func__);
@@ -405,6 +444,8 @@ std::optional<std::vector<double>> EBPathSmoother::calcSmoothedTrajectory()
   const auto optimized_points = std::get<0>(result);
 
   const auto status = std::get<3>(result);
+  const int iteration = std::get<4>(result);
+  RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "iteration: %d", iteration);
 
   // check status
   if (status != 1) {
@@ -417,6 +458,7 @@ std::optional<std::vector<double>> EBPathSmoother::calcSmoothedTrajectory()
     RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
     return std::nullopt;
   }
+  prev_solution_ = Solution{{}, optimized_points, std::get<1>(result)};
 
   time_keeper_ptr_->toc(__func__, "        ");
   return optimized_points;
@@ -22,6 +22,8 @@
 
 #include <chrono>
 #include <limits>
+#include <memory>
+#include <utility>
 
 namespace autoware::path_smoother
 {
@@ -168,10 +170,8 @@ void ElasticBandSmoother::onPath(const Path::ConstSharedPtr path_ptr)
       get_logger(), *get_clock(), 5000,
       "Backward path is NOT supported. Just converting path to trajectory");
 
-    const auto traj_points = trajectory_utils::convertToTrajectoryPoints(path_ptr->points);
-    const auto output_traj_msg =
-      autoware::motion_utils::convertToTrajectory(traj_points, path_ptr->header);
-    traj_pub_->publish(output_traj_msg);
+    traj_pub_->publish(std::make_unique<Trajectory>(autoware::motion_utils::convertToTrajectory(
+      trajectory_utils::convertToTrajectoryPoints(path_ptr->points), path_ptr->header)));
     path_pub_->publish(*path_ptr);
     published_time_publisher_->publish_if_subscribed(path_pub_, path_ptr->header.stamp);
     return;
@@ -223,11 +223,11 @@ void ElasticBandSmoother::onPath(const Path::ConstSharedPtr path_ptr)
   debug_calculation_time_float_pub_->publish(
     createFloat64Stamped(now(), time_keeper_ptr_->getAccumulatedTime()));
 
-  const auto output_traj_msg =
-    autoware::motion_utils::convertToTrajectory(full_traj_points, path_ptr->header);
-  traj_pub_->publish(output_traj_msg);
-  const auto output_path_msg = trajectory_utils::create_path(*path_ptr, full_traj_points);
-  path_pub_->publish(output_path_msg);
+  auto output_path_msg =
+    std::make_unique<Path>(trajectory_utils::create_path(*path_ptr, full_traj_points));
+  traj_pub_->publish(std::make_unique<Trajectory>(
+    autoware::motion_utils::convertToTrajectory(std::move(full_traj_points), path_ptr->header)));
+  path_pub_->publish(std::move(output_path_msg));
   published_time_publisher_->publish_if_subscribed(path_pub_, path_ptr->header.stamp);
 }
 
@@ -0,0 +1,166 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_PLANNING_TEST_MANAGER__AUTOWARE_PLANNING_BENCHMARK_MANAGER_HPP_
+#define AUTOWARE_PLANNING_TEST_MANAGER__AUTOWARE_PLANNING_BENCHMARK_MANAGER_HPP_
+
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_test_utils/mock_data_parser.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_map_msgs/msg/lanelet_map_bin.hpp>
+
+#include <benchmark/benchmark.h>
+#include <yaml-cpp/yaml.h>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace autoware::planning_test_manager
+{
+using autoware_map_msgs::msg::LaneletMapBin;
+
+struct LatencyStatistics
+{
+  double p50_ms{0.0};
+  double p90_ms{0.0};
+  double p99_ms{0.0};
+  double max_ms{0.0};
+};
+
+/**
+ * @brief calculate the percentiles of the latencies
+ * @param latencies_ms latencies [ms], which are reordered
+ */
+LatencyStatistics calcLatencyStatistics(std::vector<double> & latencies_ms);
+
+/**
+ * @brief count the heap allocations of the current thread while the instance is alive
+ */
+class ScopedAllocationCounter
+{
+public:
+  ScopedAllocationCounter();
+  ~ScopedAllocationCounter();
+  ScopedAllocationCounter(const ScopedAllocationCounter &) = delete;
+  ScopedAllocationCounter & operator=(const ScopedAllocationCounter &) = delete;
+
+  size_t getCount() const;
+
+private:
+  size_t start_count_;
+};
+
+/**
+ * @brief replays the inputs of a planning node in-process and measures the latency from the input
+ * to the output with Google Benchmark
+ */
+class PlanningBenchmarkManager
+{
+public:
+  /**
+   * @brief the snapshot is loaded from AUTOWARE_PLANNING_BENCHMARK_SNAPSHOT if it is set
+   */
+  PlanningBenchmarkManager();
+
+  /**
+   * @brief load the snapshot saved by topic_snapshot_saver of autoware_test_utils
+   * @param snapshot_path path to the snapshot yaml
+   */
+  void loadSnapshot(const std::string & snapshot_path);
+
+  /**
+   * @brief get the field of the snapshot, or the default message if the field does not exist
+   */
+  template <typename T>
+  T getSnapshotField(const std::string & field_name, const T & default_msg) const
+  {
+    const auto & field = snapshot_[field_name];
+    if (!field) {
+      return default_msg;
+    }
+    return autoware::test_utils::parse<T>(field);
+  }
+
+  /**
+   * @brief get the map of the snapshot, or the test map of autoware_test_utils
+   */
+  LaneletMapBin getMap() const;
+
+  /**
+   * @brief set the timeout to wait for an output of the target node
+   */
+  void setTimeout(const std::chrono::milliseconds timeout) { timeout_ = timeout; }
+
+  rclcpp::Node::SharedPtr getTestNode() const { return test_node_; }
+
+  /**
+   * @brief publish the message once to the target node
+   */
+  template <typename T>
+  void publish(
+    rclcpp::Node::SharedPtr target_node, const std::string & topic_name, const T & msg)
+  {
+    typename rclcpp::Publisher<T>::SharedPtr publisher;
+    autoware::test_utils::publishToTargetNode(test_node_, target_node, topic_name, publisher, msg);
+    publishers_.push_back(publisher);
+  }
+
+  /**
+   * @brief publish the input at every iteration and measure until the target node outputs
+   */
+  template <typename InputT, typename OutputT>
+  void benchmarkWithInput(
+    benchmark::State & state, rclcpp::Node::SharedPtr target_node, const std::string & input_topic,
+    const InputT & input, const std::string & output_topic)
+  {
+    typename rclcpp::Publisher<InputT>::SharedPtr publisher;
+    autoware::test_utils::setPublisher(test_node_, input_topic, publisher);
+    size_t output_count = 0;
+    typename rclcpp::Subscription<OutputT>::SharedPtr subscription;
+    autoware::test_utils::setSubscriber(test_node_, output_topic, subscription, output_count);
+    run(state, target_node, [&]() { publisher->publish(input); }, output_count);
+  }
+
+  /**
+   * @brief measure until the target node outputs by its own timer, whose period should be
+   * shorter than the processing time of the node to measure the processing time
+   */
+  template <typename OutputT>
+  void benchmarkWithTimer(
+    benchmark::State & state, rclcpp::Node::SharedPtr target_node,
+    const std::string & output_topic)
+  {
+    size_t output_count = 0;
+    typename rclcpp::Subscription<OutputT>::SharedPtr subscription;
+    autoware::test_utils::setSubscriber(test_node_, output_topic, subscription, output_count);
+    run(state, target_node, []() {}, output_count);
+  }
+
+private:
+  void run(
+    benchmark::State & state, rclcpp::Node::SharedPtr target_node,
+    const std::function<void()> & trigger, const size_t & output_count);
+
+  rclcpp::Node::SharedPtr test_node_;
+  std::vector<rclcpp::PublisherBase::SharedPtr> publishers_;
+  YAML::Node snapshot_;
+  std::chrono::milliseconds timeout_{5000};
+};  // class PlanningBenchmarkManager
+
+}  // namespace autoware::planning_test_manager
+
+#endif  // AUTOWARE_PLANNING_TEST_MANAGER__AUTOWARE_PLANNING_BENCHMARK_MANAGER_HPP_
@@ -0,0 +1,164 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware_planning_test_manager/autoware_planning_benchmark_manager.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+// the allocations are counted only in the thread which runs the benchmark, since the middleware
+// threads allocate regardless of the target node
+thread_local bool g_count_allocations = false;
+thread_local size_t g_allocation_count = 0;
+
+void * allocate(const std::size_t size)
+{
+  if (g_count_allocations) {
+    ++g_allocation_count;
+  }
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+double percentile(std::vector<double> & values, const double ratio)
+{
+  const auto idx = static_cast<size_t>(ratio * static_cast<double>(values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + idx, values.end());
+  return values.at(idx);
+}
+}  // namespace
+
+// replaced in the benchmark executables which link this library to count the allocations
+void * operator new(std::size_t size)
+{
+  return allocate(size);
+}
+
+void * operator new[](std::size_t size)
+{
+  return allocate(size);
+}
+
+namespace autoware::planning_test_manager
+{
+
+LatencyStatistics calcLatencyStatistics(std::vector<double> & latencies_ms)
+{
+  LatencyStatistics statistics;
+  if (latencies_ms.empty()) {
+    return statistics;
+  }
+  statistics.p50_ms = percentile(latencies_ms, 0.5);
+  statistics.p90_ms = percentile(latencies_ms, 0.9);
+  statistics.p99_ms = percentile(latencies_ms, 0.99);
+  statistics.max_ms = *std::max_element(latencies_ms.begin(), latencies_ms.end());
+  return statistics;
+}
+
+ScopedAllocationCounter::ScopedAllocationCounter() : start_count_(g_allocation_count)
+{
+  g_count_allocations = true;
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter()
+{
+  g_count_allocations = false;
+}
+
+size_t ScopedAllocationCounter::getCount() const
+{
+  return g_allocation_count - start_count_;
+}
+
+PlanningBenchmarkManager::PlanningBenchmarkManager()
+{
+  test_node_ = std::make_shared<rclcpp::Node>("planning_benchmark_node");
+
+  if (const char * snapshot_path = std::getenv("AUTOWARE_PLANNING_BENCHMARK_SNAPSHOT")) {
+    loadSnapshot(snapshot_path);
+  }
+}
+
+void PlanningBenchmarkManager::loadSnapshot(const std::string & snapshot_path)
+{
+  snapshot_ = YAML::LoadFile(snapshot_path);
+}
+
+LaneletMapBin PlanningBenchmarkManager::getMap() const
+{
+  if (const auto & map_path_uri = snapshot_["map_path_uri"]) {
+    const auto map_path =
+      autoware::test_utils::resolve_pkg_share_uri(map_path_uri.as<std::string>());
+    if (!map_path) {
+      throw std::runtime_error("failed to resolve " + map_path_uri.as<std::string>());
+    }
+    return autoware::test_utils::make_map_bin_msg(map_path.value());
+  }
+  return autoware::test_utils::makeMapBinMsg();
+}
+
+void PlanningBenchmarkManager::run(
+  benchmark::State & state, rclcpp::Node::SharedPtr target_node,
+  const std::function<void()> & trigger, const size_t & output_count)
+{
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(test_node_);
+  executor.add_node(target_node);
+
+  std::vector<double> latencies_ms;
+  size_t allocation_count = 0;
+  for (auto _ : state) {
+    const size_t expected_output_count = output_count + 1;
+    const auto start = std::chrono::steady_clock::now();
+    auto end = start;
+    {
+      ScopedAllocationCounter allocation_counter;
+      trigger();
+      while (output_count < expected_output_count && end - start < timeout_) {
+        executor.spin_some();
+        end = std::chrono::steady_clock::now();
+      }
+      allocation_count += allocation_counter.getCount();
+    }
+    if (output_count < expected_output_count) {
+      state.SkipWithError("the target node did not output within the timeout");
+      break;
+    }
+
+    const std::chrono::duration<double> elapsed = end - start;
+    state.SetIterationTime(elapsed.count());
+    latencies_ms.push_back(elapsed.count() * 1e3);
+  }
+
+  executor.remove_node(target_node);
+  executor.remove_node(test_node_);
+
+  const auto statistics = calcLatencyStatistics(latencies_ms);
+  state.counters["p50_ms"] = statistics.p50_ms;
+  state.counters["p90_ms"] = statistics.p90_ms;
+  state.counters["p99_ms"] = statistics.p99_ms;
+  state.counters["max_ms"] = statistics.max_ms;
+  state.counters["allocations"] =
+    benchmark::Counter(static_cast<double>(allocation_count), benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace autoware::planning_test_manager
@@ -0,0 +1,52 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PLANNING_TOPIC_CONVERTER__POINTCLOUD_TO_MAP_FRAME_HPP_
+#define AUTOWARE__PLANNING_TOPIC_CONVERTER__POINTCLOUD_TO_MAP_FRAME_HPP_
+
+#include "autoware/planning_topic_converter/converter_base.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+
+namespace autoware::planning_topic_converter
+{
+
+using sensor_msgs::msg::PointCloud2;
+
+/**
+ * @brief transform the obstacle pointcloud into the map frame and downsample it once, so that the
+ * planning nodes that subscribe to the output do not repeat the same conversion.
+ */
+class PointCloudToMapFrame : public ConverterBase<PointCloud2, PointCloud2>
+{
+public:
+  explicit PointCloudToMapFrame(const rclcpp::NodeOptions & options);
+
+private:
+  void process(const PointCloud2::ConstSharedPtr msg) override;
+
+  tf2_ros::Buffer tf_buffer_;
+  tf2_ros::TransformListener tf_listener_;
+
+  // leaf size of the voxel grid filter [m], the filter is disabled if it is not positive.
+  double voxel_leaf_size_;
+};
+
+}  // namespace autoware::planning_topic_converter
+
+#endif  // AUTOWARE__PLANNING_TOPIC_CONVERTER__POINTCLOUD_TO_MAP_FRAME_HPP_
@@ -0,0 +1,76 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/planning_topic_converter/pointcloud_to_map_frame.hpp"
+
+#include <autoware/universe_utils/transform/transforms.hpp>
+
+#include <pcl/filters/voxel_grid.h>
+#include <pcl_conversions/pcl_conversions.h>
+#include <tf2_eigen/tf2_eigen.hpp>
+
+#include <memory>
+
+namespace autoware::planning_topic_converter
+{
+
+PointCloudToMapFrame::PointCloudToMapFrame(const rclcpp::NodeOptions & options)
+: ConverterBase("pointcloud_to_map_frame_converter", options),
+  tf_buffer_(this->get_clock()),
+  tf_listener_(tf_buffer_),
+  voxel_leaf_size_(this->declare_parameter<double>("voxel_leaf_size"))
+{
+}
+
+void PointCloudToMapFrame::process(const PointCloud2::ConstSharedPtr msg)
+{
+  geometry_msgs::msg::TransformStamped transform;
+  try {
+    transform = tf_buffer_.lookupTransform(
+      "map", msg->header.frame_id, msg->header.stamp, rclcpp::Duration::from_seconds(0.1));
+  } catch (tf2::TransformException & e) {
+    RCLCPP_WARN(get_logger(), "no transform found for pointcloud: %s", e.what());
+    return;
+  }
+
+  pcl::PointCloud<pcl::PointXYZ> pc;
+  pcl::fromROSMsg(*msg, pc);
+
+  Eigen::Affine3f affine = tf2::transformToEigen(transform.transform).cast<float>();
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pc_transformed(new pcl::PointCloud<pcl::PointXYZ>);
+  if (!pc.empty()) {
+    autoware::universe_utils::transformPointCloud(pc, *pc_transformed, affine);
+  }
+
+  if (voxel_leaf_size_ > 0.0 && !pc_transformed->empty()) {
+    pcl::PointCloud<pcl::PointXYZ>::Ptr pc_filtered(new pcl::PointCloud<pcl::PointXYZ>);
+    pcl::VoxelGrid<pcl::PointXYZ> filter;
+    filter.setInputCloud(pc_transformed);
+    filter.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, voxel_leaf_size_);
+    filter.filter(*pc_filtered);
+    pc_transformed = pc_filtered;
+  }
+
+  // publish as unique_ptr so that the subscribers in the same container receive it without copy
+  auto output = std::make_unique<PointCloud2>();
+  pcl::toROSMsg(*pc_transformed, *output);
+  output->header.stamp = msg->header.stamp;
+  output->header.frame_id = "map";
+  pub_->publish(std::move(output));
+}
+
+}  // namespace autoware::planning_topic_converter
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(autoware::planning_topic_converter::PointCloudToMapFrame)
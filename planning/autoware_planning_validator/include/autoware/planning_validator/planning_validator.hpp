@@ -16,6 +16,7 @@
 #define AUTOWARE__PLANNING_VALIDATOR__PLANNING_VALIDATOR_HPP_
 
 #include "autoware/planning_validator/debug_marker.hpp"
+#include "autoware/planning_validator/utils.hpp"
 #include "autoware/universe_utils/ros/logger_level_configure.hpp"
 #include "autoware/universe_utils/ros/polling_subscriber.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
@@ -88,6 +89,19 @@ public:
   bool checkValidForwardTrajectoryLength(const Trajectory & trajectory);
 
 private:
+  // the checks with the metrics and the ego nearest index calculated once for the trajectory
+  bool checkValidRelativeAngle(const Trajectory & trajectory, const TrajectoryMetrics & metrics);
+  bool checkValidCurvature(const Trajectory & trajectory, const TrajectoryMetrics & metrics);
+  bool checkValidLateralAcceleration(
+    const Trajectory & trajectory, const TrajectoryMetrics & metrics);
+  bool checkValidSteering(const Trajectory & trajectory, const TrajectoryMetrics & metrics);
+  bool checkValidSteeringRate(const Trajectory & trajectory, const TrajectoryMetrics & metrics);
+  bool checkValidVelocityDeviation(const Trajectory & trajectory, const size_t ego_nearest_idx);
+  bool checkValidDistanceDeviation(const Trajectory & trajectory, const size_t ego_nearest_idx);
+  bool checkValidLongitudinalDistanceDeviation(
+    const Trajectory & trajectory, const size_t ego_nearest_idx);
+  size_t findEgoNearestIndex(const Trajectory & trajectory) const;
+
   void setupDiag();
 
   void setupParameters();
@@ -126,6 +140,8 @@ private:
   PlanningValidatorStatus validation_status_;
   ValidationParams validation_params_;  // for thresholds
 
+  TrajectoryMetrics trajectory_metrics_;
+
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
 
   bool isAllValid(const PlanningValidatorStatus & status) const;
@@ -28,6 +28,24 @@ namespace autoware::planning_validator
 using autoware_planning_msgs::msg::Trajectory;
 using autoware_planning_msgs::msg::TrajectoryPoint;
 
+/**
+ * @brief quantities derived from the curvature and the relative angle of the trajectory
+ * @details the curvatures and the steering angles are kept as buffers reused for the next
+ * trajectory.
+ */
+struct TrajectoryMetrics
+{
+  std::vector<double> curvatures;
+  std::vector<double> steering_angles;
+
+  // maximum value and its index
+  std::pair<double, size_t> max_relative_angle{0.0, 0};
+  std::pair<double, size_t> max_curvature{0.0, 0};
+  std::pair<double, size_t> max_lateral_acc{0.0, 0};
+  std::pair<double, size_t> max_steering{0.0, 0};
+  std::pair<double, size_t> max_steering_rate{0.0, 0};
+};
+
 std::pair<double, size_t> getAbsMaxValAndIdx(const std::vector<double> & v);
 
 Trajectory resampleTrajectory(const Trajectory & trajectory, const double min_interval);
@@ -57,6 +75,14 @@ std::pair<double, size_t> calcMaxSteeringAngles(
 std::pair<double, size_t> calcMaxSteeringRates(
   const Trajectory & trajectory, const double wheelbase);
 
+/**
+ * @brief calculate the same values as calcMaxRelativeAngles, calcMaxCurvature,
+ * calcMaxLateralAcceleration, calcMaxSteeringAngles and calcMaxSteeringRates with a single
+ * curvature calculation and a single pass over the trajectory
+ */
+void calcTrajectoryMetrics(
+  const Trajectory & trajectory, const double wheelbase, TrajectoryMetrics & metrics);
+
 bool checkFinite(const TrajectoryPoint & point);
 
 void shiftPose(geometry_msgs::msg::Pose & pose, double longitudinal);
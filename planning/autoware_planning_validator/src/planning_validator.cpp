@@ -302,12 +302,14 @@ void PlanningValidator::validate(const Trajectory & trajectory)
       "trajectory has invalid value (NaN, Inf, etc). Stop validation process, raise an error.");
   }
 
+  const size_t ego_nearest_idx = findEgoNearestIndex(trajectory);
   s.is_valid_interval = checkValidInterval(trajectory);
   s.is_valid_longitudinal_max_acc = checkValidMaxLongitudinalAcceleration(trajectory);
   s.is_valid_longitudinal_min_acc = checkValidMinLongitudinalAcceleration(trajectory);
-  s.is_valid_velocity_deviation = checkValidVelocityDeviation(trajectory);
-  s.is_valid_distance_deviation = checkValidDistanceDeviation(trajectory);
-  s.is_valid_longitudinal_distance_deviation = checkValidLongitudinalDistanceDeviation(trajectory);
+  s.is_valid_velocity_deviation = checkValidVelocityDeviation(trajectory, ego_nearest_idx);
+  s.is_valid_distance_deviation = checkValidDistanceDeviation(trajectory, ego_nearest_idx);
+  s.is_valid_longitudinal_distance_deviation =
+    checkValidLongitudinalDistanceDeviation(trajectory, ego_nearest_idx);
   s.is_valid_forward_trajectory_length = checkValidForwardTrajectoryLength(trajectory);
 
   // use resampled trajectory because the following metrics can not be evaluated for closed points.
@@ -315,11 +317,14 @@ void PlanningValidator::validate(const Trajectory & trajectory)
   constexpr auto min_interval = 1.0;
   const auto resampled = resampleTrajectory(trajectory, min_interval);
 
-  s.is_valid_relative_angle = checkValidRelativeAngle(resampled);
-  s.is_valid_curvature = checkValidCurvature(resampled);
-  s.is_valid_lateral_acc = checkValidLateralAcceleration(resampled);
-  s.is_valid_steering = checkValidSteering(resampled);
-  s.is_valid_steering_rate = checkValidSteeringRate(resampled);
+  // calculate the curvature based metrics at once
+  calcTrajectoryMetrics(resampled, vehicle_info_.wheel_base_m, trajectory_metrics_);
+
+  s.is_valid_relative_angle = checkValidRelativeAngle(resampled, trajectory_metrics_);
+  s.is_valid_curvature = checkValidCurvature(resampled, trajectory_metrics_);
+  s.is_valid_lateral_acc = checkValidLateralAcceleration(resampled, trajectory_metrics_);
+  s.is_valid_steering = checkValidSteering(resampled, trajectory_metrics_);
+  s.is_valid_steering_rate = checkValidSteeringRate(resampled, trajectory_metrics_);
 
   s.invalid_count = isAllValid(s) ? 0 : s.invalid_count + 1;
 }
@@ -357,7 +362,14 @@ bool PlanningValidator::checkValidInterval(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidRelativeAngle(const Trajectory & trajectory)
 {
-  const auto [max_relative_angle, i] = calcMaxRelativeAngles(trajectory);
+  calcTrajectoryMetrics(trajectory, vehicle_info_.wheel_base_m, trajectory_metrics_);
+  return checkValidRelativeAngle(trajectory, trajectory_metrics_);
+}
+
+bool PlanningValidator::checkValidRelativeAngle(
+  const Trajectory & trajectory, const TrajectoryMetrics & metrics)
+{
+  const auto [max_relative_angle, i] = metrics.max_relative_angle;
   validation_status_.max_relative_angle = max_relative_angle;
 
   if (max_relative_angle > validation_params_.relative_angle_threshold) {
@@ -374,7 +386,14 @@ bool PlanningValidator::checkValidRelativeAngle(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 {
-  const auto [max_curvature, i] = calcMaxCurvature(trajectory);
+  calcTrajectoryMetrics(trajectory, vehicle_info_.wheel_base_m, trajectory_metrics_);
+  return checkValidCurvature(trajectory, trajectory_metrics_);
+}
+
+bool PlanningValidator::checkValidCurvature(
+  const Trajectory & trajectory, const TrajectoryMetrics & metrics)
+{
+  const auto [max_curvature, i] = metrics.max_curvature;
   validation_status_.max_curvature = max_curvature;
   if (max_curvature > validation_params_.curvature_threshold) {
     const auto & p = trajectory.points;
@@ -390,7 +409,14 @@ bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidLateralAcceleration(const Trajectory & trajectory)
 {
-  const auto [max_lateral_acc, i] = calcMaxLateralAcceleration(trajectory);
+  calcTrajectoryMetrics(trajectory, vehicle_info_.wheel_base_m, trajectory_metrics_);
+  return checkValidLateralAcceleration(trajectory, trajectory_metrics_);
+}
+
+bool PlanningValidator::checkValidLateralAcceleration(
+  const Trajectory & trajectory, const TrajectoryMetrics & metrics)
+{
+  const auto [max_lateral_acc, i] = metrics.max_lateral_acc;
   validation_status_.max_lateral_acc = max_lateral_acc;
   if (max_lateral_acc > validation_params_.lateral_acc_threshold) {
     debug_pose_publisher_->pushPoseMarker(trajectory.points.at(i), "lateral_acceleration");
@@ -425,7 +451,14 @@ bool PlanningValidator::checkValidMaxLongitudinalAcceleration(const Trajectory &
 
 bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 {
-  const auto [max_steering, i] = calcMaxSteeringAngles(trajectory, vehicle_info_.wheel_base_m);
+  calcTrajectoryMetrics(trajectory, vehicle_info_.wheel_base_m, trajectory_metrics_);
+  return checkValidSteering(trajectory, trajectory_metrics_);
+}
+
+bool PlanningValidator::checkValidSteering(
+  const Trajectory & trajectory, const TrajectoryMetrics & metrics)
+{
+  const auto [max_steering, i] = metrics.max_steering;
   validation_status_.max_steering = max_steering;
 
   if (max_steering > validation_params_.steering_threshold) {
@@ -437,7 +470,14 @@ bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidSteeringRate(const Trajectory & trajectory)
 {
-  const auto [max_steering_rate, i] = calcMaxSteeringRates(trajectory, vehicle_info_.wheel_base_m);
+  calcTrajectoryMetrics(trajectory, vehicle_info_.wheel_base_m, trajectory_metrics_);
+  return checkValidSteeringRate(trajectory, trajectory_metrics_);
+}
+
+bool PlanningValidator::checkValidSteeringRate(
+  const Trajectory & trajectory, const TrajectoryMetrics & metrics)
+{
+  const auto [max_steering_rate, i] = metrics.max_steering_rate;
   validation_status_.max_steering_rate = max_steering_rate;
 
   if (max_steering_rate > validation_params_.steering_rate_threshold) {
@@ -447,12 +487,21 @@ bool PlanningValidator::checkValidSteeringRate(const Trajectory & trajectory)
   return true;
 }
 
-bool PlanningValidator::checkValidVelocityDeviation(const Trajectory & trajectory)
+size_t PlanningValidator::findEgoNearestIndex(const Trajectory & trajectory) const
 {
   // TODO(horibe): set appropriate thresholds for index search
-  const auto idx = autoware::motion_utils::findFirstNearestIndexWithSoftConstraints(
+  return autoware::motion_utils::findFirstNearestIndexWithSoftConstraints(
     trajectory.points, current_kinematics_->pose.pose);
+}
+
+bool PlanningValidator::checkValidVelocityDeviation(const Trajectory & trajectory)
+{
+  return checkValidVelocityDeviation(trajectory, findEgoNearestIndex(trajectory));
+}
 
+bool PlanningValidator::checkValidVelocityDeviation(
+  const Trajectory & trajectory, const size_t idx)
+{
   validation_status_.velocity_deviation = std::abs(
     trajectory.points.at(idx).longitudinal_velocity_mps -
     current_kinematics_->twist.twist.linear.x);
@@ -465,10 +514,12 @@ bool PlanningValidator::checkValidVelocityDeviation(const Trajectory & trajector
 
 bool PlanningValidator::checkValidDistanceDeviation(const Trajectory & trajectory)
 {
-  // TODO(horibe): set appropriate thresholds for index search
-  const auto idx = autoware::motion_utils::findFirstNearestIndexWithSoftConstraints(
-    trajectory.points, current_kinematics_->pose.pose);
+  return checkValidDistanceDeviation(trajectory, findEgoNearestIndex(trajectory));
+}
 
+bool PlanningValidator::checkValidDistanceDeviation(
+  const Trajectory & trajectory, const size_t idx)
+{
   validation_status_.distance_deviation = autoware::universe_utils::calcDistance2d(
     trajectory.points.at(idx), current_kinematics_->pose.pose);
 
@@ -479,6 +530,12 @@ bool PlanningValidator::checkValidDistanceDeviation(const Trajectory & trajector
 }
 
 bool PlanningValidator::checkValidLongitudinalDistanceDeviation(const Trajectory & trajectory)
+{
+  return checkValidLongitudinalDistanceDeviation(trajectory, findEgoNearestIndex(trajectory));
+}
+
+bool PlanningValidator::checkValidLongitudinalDistanceDeviation(
+  const Trajectory & trajectory, const size_t idx)
 {
   if (trajectory.points.size() < 2) {
     RCLCPP_ERROR(get_logger(), "Trajectory size is invalid to calculate distance deviation.");
@@ -486,8 +543,6 @@ bool PlanningValidator::checkValidLongitudinalDistanceDeviation(const Trajectory
   }
 
   const auto ego_pose = current_kinematics_->pose.pose;
-  const size_t idx =
-    autoware::motion_utils::findFirstNearestIndexWithSoftConstraints(trajectory.points, ego_pose);
 
   if (0 < idx && idx < trajectory.points.size() - 1) {
     return true;  // ego-nearest point exists between trajectory points.
@@ -17,6 +17,8 @@
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/universe_utils/geometry/geometry.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -93,31 +95,38 @@ void calcCurvature(
   }
 
   // initialize with 0 curvature
-  curvature_arr = std::vector<double>(trajectory.points.size(), 0.0);
+  curvature_arr.assign(trajectory.points.size(), 0.0);
 
+  // NOTE: the arc length is non-decreasing, so the previous and next points farther than
+  // curvature_distance only move forward as the index increases.
   size_t first_distant_index = 0;
   size_t last_distant_index = trajectory.points.size() - 1;
+  size_t farthest_prev_idx = 0;
+  size_t nearest_next_idx = 1;
   for (size_t i = 1; i < trajectory.points.size() - 1; ++i) {
     // find the previous point
+    while (farthest_prev_idx + 1 < i &&
+           arc_length.at(i) - arc_length.at(farthest_prev_idx + 1) > curvature_distance) {
+      ++farthest_prev_idx;
+    }
     size_t prev_idx = 0;
-    for (size_t j = i - 1; j > 0; --j) {
-      if (arc_length.at(i) - arc_length.at(j) > curvature_distance) {
-        if (first_distant_index == 0) {
-          first_distant_index = i;  // save first index that meets distance requirement
-        }
-        prev_idx = j;
-        break;
+    if (farthest_prev_idx > 0) {
+      if (first_distant_index == 0) {
+        first_distant_index = i;  // save first index that meets distance requirement
       }
+      prev_idx = farthest_prev_idx;
     }
 
     // find the next point
+    nearest_next_idx = std::max(nearest_next_idx, i + 1);
+    while (nearest_next_idx < trajectory.points.size() &&
+           arc_length.at(nearest_next_idx) - arc_length.at(i) <= curvature_distance) {
+      ++nearest_next_idx;
+    }
     size_t next_idx = trajectory.points.size() - 1;
-    for (size_t j = i + 1; j < trajectory.points.size(); ++j) {
-      if (arc_length.at(j) - arc_length.at(i) > curvature_distance) {
-        last_distant_index = i;  // save last index that meets distance requirement
-        next_idx = j;
-        break;
-      }
+    if (nearest_next_idx < trajectory.points.size()) {
+      last_distant_index = i;  // save last index that meets distance requirement
+      next_idx = nearest_next_idx;
     }
 
     const auto p1 = getPoint(trajectory.points.at(prev_idx));
@@ -289,6 +298,63 @@ std::pair<double, size_t> calcMaxSteeringRates(
   return {max_steering_rate, max_index};
 }
 
+void calcTrajectoryMetrics(
+  const Trajectory & trajectory, const double wheelbase, TrajectoryMetrics & metrics)
+{
+  const auto & points = trajectory.points;
+  calcCurvature(trajectory, metrics.curvatures);
+  metrics.steering_angles.resize(points.size());
+
+  // We need at least three points to compute relative angle and curvature
+  const bool has_three_points = points.size() >= 3;
+  metrics.max_relative_angle = {0.0, 0};
+  metrics.max_curvature = {has_three_points ? -std::numeric_limits<double>::max() : 0.0, 0};
+  metrics.max_lateral_acc = {0.0, 0};
+  metrics.max_steering = {0.0, 0};
+  metrics.max_steering_rate = {0.0, 0};
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double k = metrics.curvatures.at(i);
+    metrics.steering_angles.at(i) = std::atan(k * wheelbase);
+
+    if (i + 2 < points.size()) {
+      const auto angle_a = autoware::universe_utils::calcAzimuthAngle(
+        points.at(i).pose.position, points.at(i + 1).pose.position);
+      const auto angle_b = autoware::universe_utils::calcAzimuthAngle(
+        points.at(i + 1).pose.position, points.at(i + 2).pose.position);
+      const auto relative_angle =
+        std::abs(autoware::universe_utils::normalizeRadian(angle_b - angle_a));
+      auto & [max_relative_angle, max_relative_angle_idx] = metrics.max_relative_angle;
+      takeBigger(max_relative_angle, max_relative_angle_idx, relative_angle, i);
+    }
+
+    if (has_three_points) {
+      auto & [max_curvature, max_curvature_idx] = metrics.max_curvature;
+      takeBigger(max_curvature, max_curvature_idx, k, i);
+    }
+
+    const auto v = points.at(i).longitudinal_velocity_mps;
+    auto & [max_lateral_acc, max_lateral_acc_idx] = metrics.max_lateral_acc;
+    takeBigger(max_lateral_acc, max_lateral_acc_idx, std::abs(v * v * k), i);
+
+    if (i == 0 || std::abs(metrics.steering_angles.at(i)) > metrics.max_steering.first) {
+      metrics.max_steering = {std::abs(metrics.steering_angles.at(i)), i};
+    }
+
+    if (i > 0) {
+      const auto & p_prev = points.at(i - 1);
+      const auto & p_next = points.at(i);
+      const auto delta_s = calcDistance2d(p_prev, p_next);
+      const auto v_mean =
+        0.5 * (p_next.longitudinal_velocity_mps + p_prev.longitudinal_velocity_mps);
+      const auto dt = delta_s / std::max(v_mean, 1.0e-5);
+      const auto steer_rate =
+        (metrics.steering_angles.at(i) - metrics.steering_angles.at(i - 1)) / dt;
+      auto & [max_steering_rate, max_steering_rate_idx] = metrics.max_steering_rate;
+      takeBigger(max_steering_rate, max_steering_rate_idx, std::abs(steer_rate), i - 1);
+    }
+  }
+}
+
 bool checkFinite(const TrajectoryPoint & point)
 {
   const auto & p = point.pose.position;
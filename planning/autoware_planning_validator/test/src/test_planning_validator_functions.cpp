@@ -14,6 +14,7 @@
 
 #include "autoware/planning_validator/debug_marker.hpp"
 #include "autoware/planning_validator/planning_validator.hpp"
+#include "autoware/planning_validator/utils.hpp"
 #include "test_parameter.hpp"
 #include "test_planning_validator_helper.hpp"
 
@@ -160,3 +161,26 @@ TEST(PlanningValidatorTestSuite, checkValidRelativeAngleFunction)
     ASSERT_FALSE(validator->checkValidRelativeAngle(invalid_traj));
   }
 }
+
+TEST(PlanningValidatorTestSuite, calcTrajectoryMetricsFunction)
+{
+  using autoware::planning_validator::calcTrajectoryMetrics;
+  using autoware::planning_validator::TrajectoryMetrics;
+  namespace utils = autoware::planning_validator;
+
+  constexpr double wheelbase = 3.0;
+  TrajectoryMetrics metrics;
+  const auto trajectories = {
+    generateTrajectory(1.0, 2.0, 0.0, 2),
+    generateTrajectoryWithConstantCurvature(1.5, 5.0, 0.1, 20, wheelbase),
+    generateTrajectoryWithConstantSteeringRate(1.5, 5.0, 0.1, 30, wheelbase)};
+  for (const auto & trajectory : trajectories) {
+    // the metrics buffer is reused
+    calcTrajectoryMetrics(trajectory, wheelbase, metrics);
+    EXPECT_EQ(metrics.max_relative_angle, utils::calcMaxRelativeAngles(trajectory));
+    EXPECT_EQ(metrics.max_curvature, utils::calcMaxCurvature(trajectory));
+    EXPECT_EQ(metrics.max_lateral_acc, utils::calcMaxLateralAcceleration(trajectory));
+    EXPECT_EQ(metrics.max_steering, utils::calcMaxSteeringAngles(trajectory, wheelbase));
+    EXPECT_EQ(metrics.max_steering_rate, utils::calcMaxSteeringRates(trajectory, wheelbase));
+  }
+}
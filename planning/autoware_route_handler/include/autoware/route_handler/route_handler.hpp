@@ -51,6 +51,8 @@ enum class Direction { NONE, LEFT, RIGHT };
 enum class PullOverDirection { NONE, LEFT, RIGHT };
 enum class PullOutDirection { NONE, LEFT, RIGHT };
 
+struct RouteLaneletIndex;
+
 struct ReferencePoint
 {
   bool is_waypoint{false};
@@ -340,6 +342,8 @@ private:
   lanelet::ConstLanelets start_lanelets_;
   lanelet::ConstLanelets goal_lanelets_;
   std::shared_ptr<LaneletRoute> route_ptr_{nullptr};
+  // rebuilt whenever the lanelets above change, and shared by the copies of the handler
+  std::shared_ptr<const RouteLaneletIndex> route_lanelet_index_{nullptr};
 
   rclcpp::Logger logger_{rclcpp::get_logger("route_handler")};
 
@@ -352,6 +356,7 @@ private:
 
   // non-const methods
   void setLaneletsFromRouteMsg();
+  void updateRouteLaneletIndex();
 
   // const methods
   // for routing
@@ -380,6 +385,12 @@ private:
   lanelet::ConstLanelets getPreviousLaneletSequence(
     const lanelet::ConstLanelets & lanelet_sequence) const;
   lanelet::ConstLanelets getNeighborsWithinRoute(const lanelet::ConstLanelet & lanelet) const;
+  bool isStartLanelet(const lanelet::ConstLanelet & lanelet) const;
+  bool isGoalLanelet(const lanelet::ConstLanelet & lanelet) const;
+  bool isPreferredLanelet(const lanelet::ConstLanelet & lanelet) const;
+  double getCenterlineLength(const lanelet::ConstLanelet & lanelet) const;
+  lanelet::ConstLanelets getAllNeighborsRight(const lanelet::ConstLanelet & lanelet) const;
+  lanelet::ConstLanelets getAllNeighborsLeft(const lanelet::ConstLanelet & lanelet) const;
 
   // for path
 
@@ -27,6 +27,9 @@
 #include <autoware_planning_msgs/msg/path.hpp>
 #include <tier4_planning_msgs/msg/path_point_with_lane_id.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
+#include <lanelet2_core/geometry/BoundingBox.h>
 #include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/primitives/LaneletSequence.h>
 #include <lanelet2_routing/Route.h>
@@ -41,10 +44,46 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace autoware::route_handler
 {
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+/**
+ * @brief lookup tables of the route lanelets, built once per route
+ * @details the routing graph and centerline queries of the per-cycle getters become table lookups
+ * for the route lanelets. The other lanelets still query the routing graph.
+ */
+struct RouteLaneletIndex
+{
+  using Point2d = bg::model::point<double, 2, bg::cs::cartesian>;
+  using Box = bg::model::box<Point2d>;
+  // the value is the index in route_lanelets
+  using BoxAndIndex = std::pair<Box, size_t>;
+
+  lanelet::ConstLanelets route_lanelets;
+  std::unordered_set<lanelet::Id> route_ids;
+  std::unordered_set<lanelet::Id> preferred_ids;
+  std::unordered_set<lanelet::Id> start_ids;
+  std::unordered_set<lanelet::Id> goal_ids;
+  std::unordered_map<lanelet::Id, double> centerline_lengths;
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelets> next_lanelets_within_route;
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelets> previous_lanelets_within_route;
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelets> all_neighbors_right;
+  std::unordered_map<lanelet::Id, lanelet::ConstLanelets> all_neighbors_left;
+  bgi::rtree<BoxAndIndex, bgi::rstar<16>> rtree;
+
+  // the route lanelets are taken from the lanelet layer, so they are never inverted
+  static bool contains(
+    const std::unordered_set<lanelet::Id> & ids, const lanelet::ConstLanelet & llt)
+  {
+    return !llt.inverted() && ids.count(llt.id()) != 0;
+  }
+};
+
 namespace
 {
 using autoware::universe_utils::createPoint;
@@ -353,6 +392,7 @@ void RouteHandler::setRouteLanelets(const lanelet::ConstLanelets & path_lanelets
   for (const auto & id : route_lanelets_id) {
     route_lanelets_.push_back(lanelet_map_ptr_->laneletLayer.get(id));
   }
+  updateRouteLaneletIndex();
   is_handler_ready_ = true;
 }
 
@@ -363,6 +403,7 @@ void RouteHandler::clearRoute()
   start_lanelets_.clear();
   goal_lanelets_.clear();
   route_ptr_ = nullptr;
+  route_lanelet_index_ = nullptr;
   is_handler_ready_ = false;
 }
 
@@ -375,6 +416,7 @@ void RouteHandler::setLaneletsFromRouteMsg()
   preferred_lanelets_.clear();
   const bool is_route_valid = lanelet::utils::route::isRouteValid(*route_ptr_, lanelet_map_ptr_);
   if (!is_route_valid) {
+    updateRouteLaneletIndex();
     return;
   }
 
@@ -410,9 +452,126 @@ void RouteHandler::setLaneletsFromRouteMsg()
       start_lanelets_.push_back(llt);
     }
   }
+  updateRouteLaneletIndex();
   is_handler_ready_ = true;
 }
 
+void RouteHandler::updateRouteLaneletIndex()
+{
+  auto index = std::make_shared<RouteLaneletIndex>();
+  index->route_lanelets = route_lanelets_;
+  for (const auto & llt : route_lanelets_) index->route_ids.insert(llt.id());
+  for (const auto & llt : preferred_lanelets_) index->preferred_ids.insert(llt.id());
+  for (const auto & llt : start_lanelets_) index->start_ids.insert(llt.id());
+  for (const auto & llt : goal_lanelets_) index->goal_ids.insert(llt.id());
+
+  const auto start_lane_id = (route_ptr_ && !route_ptr_->segments.empty())
+                               ? route_ptr_->segments.front().preferred_primitive.id
+                               : lanelet::InvalId;
+  const auto filter_route_lanelets = [&](const lanelet::ConstLanelets & lanelets) {
+    lanelet::ConstLanelets filtered;
+    for (const auto & llt : lanelets) {
+      if (RouteLaneletIndex::contains(index->route_ids, llt)) filtered.push_back(llt);
+    }
+    return filtered;
+  };
+
+  std::vector<RouteLaneletIndex::BoxAndIndex> boxes;
+  boxes.reserve(route_lanelets_.size());
+  for (size_t i = 0; i < route_lanelets_.size(); ++i) {
+    const auto & llt = route_lanelets_.at(i);
+    const auto id = llt.id();
+    index->centerline_lengths[id] =
+      static_cast<double>(boost::geometry::length(llt.centerline().basicLineString()));
+
+    if (!RouteLaneletIndex::contains(index->goal_ids, llt)) {
+      lanelet::ConstLanelets next_lanelets;
+      for (const auto & next : filter_route_lanelets(routing_graph_ptr_->following(llt))) {
+        if (next.id() != start_lane_id) next_lanelets.push_back(next);
+      }
+      index->next_lanelets_within_route.emplace(id, std::move(next_lanelets));
+    }
+    if (!RouteLaneletIndex::contains(index->start_ids, llt)) {
+      index->previous_lanelets_within_route.emplace(
+        id, filter_route_lanelets(routing_graph_ptr_->previous(llt)));
+    }
+    index->all_neighbors_right.emplace(
+      id, lanelet::utils::query::getAllNeighborsRight(routing_graph_ptr_, llt));
+    index->all_neighbors_left.emplace(
+      id, lanelet::utils::query::getAllNeighborsLeft(routing_graph_ptr_, llt));
+
+    const auto bbox = lanelet::geometry::boundingBox2d(llt);
+    boxes.emplace_back(
+      RouteLaneletIndex::Box(
+        RouteLaneletIndex::Point2d(bbox.min().x(), bbox.min().y()),
+        RouteLaneletIndex::Point2d(bbox.max().x(), bbox.max().y())),
+      i);
+  }
+  // the range constructor bulk loads the tree with the packing algorithm
+  index->rtree = bgi::rtree<RouteLaneletIndex::BoxAndIndex, bgi::rstar<16>>(boxes);
+
+  route_lanelet_index_ = std::move(index);
+}
+
+bool RouteHandler::isStartLanelet(const lanelet::ConstLanelet & lanelet) const
+{
+  if (!route_lanelet_index_) {
+    return exists(start_lanelets_, lanelet);
+  }
+  return RouteLaneletIndex::contains(route_lanelet_index_->start_ids, lanelet);
+}
+
+bool RouteHandler::isGoalLanelet(const lanelet::ConstLanelet & lanelet) const
+{
+  if (!route_lanelet_index_) {
+    return exists(goal_lanelets_, lanelet);
+  }
+  return RouteLaneletIndex::contains(route_lanelet_index_->goal_ids, lanelet);
+}
+
+bool RouteHandler::isPreferredLanelet(const lanelet::ConstLanelet & lanelet) const
+{
+  if (!route_lanelet_index_) {
+    return exists(preferred_lanelets_, lanelet);
+  }
+  return RouteLaneletIndex::contains(route_lanelet_index_->preferred_ids, lanelet);
+}
+
+double RouteHandler::getCenterlineLength(const lanelet::ConstLanelet & lanelet) const
+{
+  if (route_lanelet_index_ && !lanelet.inverted()) {
+    const auto itr = route_lanelet_index_->centerline_lengths.find(lanelet.id());
+    if (itr != route_lanelet_index_->centerline_lengths.end()) {
+      return itr->second;
+    }
+  }
+  return static_cast<double>(boost::geometry::length(lanelet.centerline().basicLineString()));
+}
+
+lanelet::ConstLanelets RouteHandler::getAllNeighborsRight(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  if (route_lanelet_index_ && !lanelet.inverted()) {
+    const auto itr = route_lanelet_index_->all_neighbors_right.find(lanelet.id());
+    if (itr != route_lanelet_index_->all_neighbors_right.end()) {
+      return itr->second;
+    }
+  }
+  return lanelet::utils::query::getAllNeighborsRight(routing_graph_ptr_, lanelet);
+}
+
+lanelet::ConstLanelets RouteHandler::getAllNeighborsLeft(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  if (route_lanelet_index_ && !lanelet.inverted()) {
+    const auto itr = route_lanelet_index_->all_neighbors_left.find(lanelet.id());
+    if (itr != route_lanelet_index_->all_neighbors_left.end()) {
+      return itr->second;
+    }
+  }
+  return lanelet::utils::query::getAllNeighborsLeft(routing_graph_ptr_, lanelet);
+}
+
 Header RouteHandler::getRouteHeader() const
 {
   if (!route_ptr_) {
@@ -564,7 +723,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence_forward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence_forward;
   }
 
@@ -588,8 +747,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
     }
     lanelet_sequence_forward.push_back(next_lanelet);
     current_lanelet = next_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
+    length += getCenterlineLength(next_lanelet);
   }
 
   return lanelet_sequence_forward;
@@ -599,7 +757,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence_backward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence_backward;
   }
 
@@ -640,10 +798,9 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
     if (checkForLoop(previous_lanelets, is_route_lanelets)) break;
 
     for (const auto & prev_lanelet : previous_lanelets) {
-      if (!isNewLanelet(prev_lanelet) || exists(goal_lanelets_, prev_lanelet)) continue;
+      if (!isNewLanelet(prev_lanelet) || isGoalLanelet(prev_lanelet)) continue;
       lanelet_sequence_backward.push_back(prev_lanelet);
-      length +=
-        static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
+      length += getCenterlineLength(prev_lanelet);
       current_lanelet = prev_lanelet;
       break;
     }
@@ -664,7 +821,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   }
 
   lanelet::ConstLanelets lanelet_sequence;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence;
   }
 
@@ -707,7 +864,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   const lanelet::ConstLanelet & lanelet, const Pose & current_pose, const double backward_distance,
   const double forward_distance, const bool only_route_lanes) const
 {
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return {};
   }
 
@@ -907,7 +1064,37 @@ lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequence(
 bool RouteHandler::getClosestLaneletWithinRoute(
   const Pose & search_pose, lanelet::ConstLanelet * closest_lanelet) const
 {
-  return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  if (!route_lanelet_index_ || route_lanelet_index_->route_lanelets.empty()) {
+    return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  }
+
+  // visit the lanelets by increasing distance of their bounding box, until the box is farther than
+  // the closest lanelet polygon found so far. The polygon is never closer than its bounding box, so
+  // the skipped lanelets cannot be the closest.
+  const auto & index = *route_lanelet_index_;
+  const RouteLaneletIndex::Point2d search_point(search_pose.position.x, search_pose.position.y);
+  const lanelet::BasicPoint2d search_point_2d(search_pose.position.x, search_pose.position.y);
+  std::vector<size_t> candidate_indices;
+  double min_distance = std::numeric_limits<double>::max();
+  for (auto itr = index.rtree.qbegin(bgi::nearest(search_point, index.rtree.size()));
+       itr != index.rtree.qend(); ++itr) {
+    if (bg::distance(itr->first, search_point) > min_distance) {
+      break;
+    }
+    const auto & llt = index.route_lanelets.at(itr->second);
+    min_distance =
+      std::min(min_distance, bg::distance(llt.polygon2d().basicPolygon(), search_point_2d));
+    candidate_indices.push_back(itr->second);
+  }
+
+  // keep the order of route_lanelets_ so that ties are resolved as with the linear search
+  std::sort(candidate_indices.begin(), candidate_indices.end());
+  lanelet::ConstLanelets candidates;
+  candidates.reserve(candidate_indices.size());
+  for (const auto i : candidate_indices) {
+    candidates.push_back(index.route_lanelets.at(i));
+  }
+  return lanelet::utils::query::getClosestLanelet(candidates, search_pose, closest_lanelet);
 }
 
 bool RouteHandler::getClosestPreferredLaneletWithinRoute(
@@ -952,16 +1139,24 @@ bool RouteHandler::getClosestRouteLaneletFromLanelet(
 bool RouteHandler::getNextLaneletsWithinRoute(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelets * next_lanelets) const
 {
-  if (exists(goal_lanelets_, lanelet)) {
+  if (isGoalLanelet(lanelet)) {
     return false;
   }
 
+  if (route_lanelet_index_ && !lanelet.inverted()) {
+    const auto itr = route_lanelet_index_->next_lanelets_within_route.find(lanelet.id());
+    if (itr != route_lanelet_index_->next_lanelets_within_route.end()) {
+      *next_lanelets = itr->second;
+      return !(next_lanelets->empty());
+    }
+  }
+
   const auto start_lane_id = route_ptr_->segments.front().preferred_primitive.id;
 
   const auto following_lanelets = routing_graph_ptr_->following(lanelet);
   next_lanelets->clear();
   for (const auto & llt : following_lanelets) {
-    if (start_lane_id != llt.id() && exists(route_lanelets_, llt)) {
+    if (start_lane_id != llt.id() && isRouteLanelet(llt)) {
       next_lanelets->push_back(llt);
     }
   }
@@ -987,13 +1182,22 @@ lanelet::ConstLanelets RouteHandler::getNextLanelets(const lanelet::ConstLanelet
 bool RouteHandler::getPreviousLaneletsWithinRoute(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelets * prev_lanelets) const
 {
-  if (exists(start_lanelets_, lanelet)) {
+  if (isStartLanelet(lanelet)) {
     return false;
   }
+
+  if (route_lanelet_index_ && !lanelet.inverted()) {
+    const auto itr = route_lanelet_index_->previous_lanelets_within_route.find(lanelet.id());
+    if (itr != route_lanelet_index_->previous_lanelets_within_route.end()) {
+      *prev_lanelets = itr->second;
+      return !(prev_lanelets->empty());
+    }
+  }
+
   const auto candidate_lanelets = routing_graph_ptr_->previous(lanelet);
   prev_lanelets->clear();
   for (const auto & llt : candidate_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       prev_lanelets->push_back(llt);
     }
   }
@@ -1394,29 +1598,27 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getPullOutStartLane(
 int RouteHandler::getNumLaneToPreferredLane(
   const lanelet::ConstLanelet & lanelet, const Direction direction) const
 {
-  if (exists(preferred_lanelets_, lanelet)) {
+  if (isPreferredLanelet(lanelet)) {
     return 0;
   }
 
   if ((direction == Direction::NONE) || (direction == Direction::RIGHT)) {
     int num{0};
-    const auto & right_lanes =
-      lanelet::utils::query::getAllNeighborsRight(routing_graph_ptr_, lanelet);
+    const auto & right_lanes = getAllNeighborsRight(lanelet);
     for (const auto & right : right_lanes) {
       num--;
-      if (exists(preferred_lanelets_, right)) {
+      if (isPreferredLanelet(right)) {
         return num;
       }
     }
   }
 
   if ((direction == Direction::NONE) || (direction == Direction::LEFT)) {
-    const auto & left_lanes =
-      lanelet::utils::query::getAllNeighborsLeft(routing_graph_ptr_, lanelet);
+    const auto & left_lanes = getAllNeighborsLeft(lanelet);
     int num = 0;
     for (const auto & left : left_lanes) {
       num++;
-      if (exists(preferred_lanelets_, left)) {
+      if (isPreferredLanelet(left)) {
         return num;
       }
     }
@@ -1428,15 +1630,14 @@ int RouteHandler::getNumLaneToPreferredLane(
 std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
   const lanelet::ConstLanelet & lanelet, const Direction direction) const
 {
-  if (exists(preferred_lanelets_, lanelet)) {
+  if (isPreferredLanelet(lanelet)) {
     return {};
   }
 
   if ((direction == Direction::NONE) || (direction == Direction::RIGHT)) {
     std::vector<double> intervals;
     lanelet::ConstLanelet current_lanelet = lanelet;
-    const auto & right_lanes =
-      lanelet::utils::query::getAllNeighborsRight(routing_graph_ptr_, lanelet);
+    const auto & right_lanes = getAllNeighborsRight(lanelet);
     for (const auto & right : right_lanes) {
       const auto & current_centerline = current_lanelet.centerline();
       const auto & next_centerline = right.centerline();
@@ -1447,7 +1648,7 @@ std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
       const auto & next_pt = next_centerline.front();
       intervals.push_back(-lanelet::geometry::distance2d(to2D(curr_pt), to2D(next_pt)));
 
-      if (exists(preferred_lanelets_, right)) {
+      if (isPreferredLanelet(right)) {
         return intervals;
       }
       current_lanelet = right;
@@ -1457,8 +1658,7 @@ std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
   if ((direction == Direction::NONE) || (direction == Direction::LEFT)) {
     std::vector<double> intervals;
     lanelet::ConstLanelet current_lanelet = lanelet;
-    const auto & left_lanes =
-      lanelet::utils::query::getAllNeighborsLeft(routing_graph_ptr_, lanelet);
+    const auto & left_lanes = getAllNeighborsLeft(lanelet);
     for (const auto & left : left_lanes) {
       const auto & current_centerline = current_lanelet.centerline();
       const auto & next_centerline = left.centerline();
@@ -1469,7 +1669,7 @@ std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
       const auto & next_pt = next_centerline.front();
       intervals.push_back(lanelet::geometry::distance2d(to2D(curr_pt), to2D(next_pt)));
 
-      if (exists(preferred_lanelets_, left)) {
+      if (isPreferredLanelet(left)) {
         return intervals;
       }
       current_lanelet = left;
@@ -1798,7 +1998,10 @@ bool RouteHandler::isShoulderLanelet(const lanelet::ConstLanelet & lanelet) cons
 
 bool RouteHandler::isRouteLanelet(const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::contains(route_lanelets_, lanelet);
+  if (!route_lanelet_index_) {
+    return lanelet::utils::contains(route_lanelets_, lanelet);
+  }
+  return RouteLaneletIndex::contains(route_lanelet_index_->route_ids, lanelet);
 }
 
 bool RouteHandler::isRoadLanelet(const lanelet::ConstLanelet & lanelet) const
@@ -1816,12 +2019,11 @@ lanelet::ConstLanelets RouteHandler::getPreviousLaneletSequence(
   }
 
   const auto & first_lane = lanelet_sequence.front();
-  if (exists(start_lanelets_, first_lane)) {
+  if (isStartLanelet(first_lane)) {
     return previous_lanelet_sequence;
   }
 
-  auto right_relations =
-    lanelet::utils::query::getAllNeighborsRight(routing_graph_ptr_, first_lane);
+  auto right_relations = getAllNeighborsRight(first_lane);
   for (const auto & right : right_relations) {
     previous_lanelet_sequence = getLaneletSequenceUpTo(right);
     if (!previous_lanelet_sequence.empty()) {
@@ -1829,7 +2031,7 @@ lanelet::ConstLanelets RouteHandler::getPreviousLaneletSequence(
     }
   }
 
-  auto left_relations = lanelet::utils::query::getAllNeighborsLeft(routing_graph_ptr_, first_lane);
+  auto left_relations = getAllNeighborsLeft(first_lane);
   for (const auto & left : left_relations) {
     previous_lanelet_sequence = getLaneletSequenceUpTo(left);
     if (!previous_lanelet_sequence.empty()) {
@@ -1846,7 +2048,7 @@ lanelet::ConstLanelets RouteHandler::getNeighborsWithinRoute(
     lanelet::utils::query::getAllNeighbors(routing_graph_ptr_, lanelet);
   lanelet::ConstLanelets neighbors_within_route;
   for (const auto & llt : neighbor_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       neighbors_within_route.push_back(llt);
     }
   }
@@ -16,6 +16,7 @@
 
 #include "autoware/universe_utils/geometry/geometry.hpp"
 
+#include <autoware_lanelet2_extension/utility/query.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <gtest/gtest.h>
@@ -267,6 +268,40 @@ TEST_F(TestRouteHandler, getClosestLaneletWithinRouteWhenPointsInRoute)
   ASSERT_EQ(get_closest_lanelet_within_route(0.5, 1.75, 0).value(), 4424ul);
 }
 
+TEST_F(TestRouteHandler, getClosestLaneletWithinRouteSameAsLinearSearch)
+{
+  const auto route = autoware::test_utils::parse<LaneletRoute>(
+    get_absolute_path_to_route(autoware_route_handler_dir, lane_change_right_test_route_filename));
+  lanelet::Ids route_ids;
+  for (const auto & segment : route.segments) {
+    for (const auto & primitive : segment.primitives) {
+      route_ids.push_back(primitive.id);
+    }
+  }
+  const auto route_lanelets = route_handler_->getLaneletsFromIds(route_ids);
+
+  for (double x = -60.0; x <= 60.0; x += 7.5) {
+    for (double y = -6.0; y <= 10.0; y += 1.75) {
+      const auto pose = autoware::test_utils::createPose(x, y, 0.0, 0.0, 0.0, 0.0);
+      lanelet::ConstLanelet expected;
+      lanelet::ConstLanelet closest;
+      ASSERT_EQ(
+        lanelet::utils::query::getClosestLanelet(route_lanelets, pose, &expected),
+        route_handler_->getClosestLaneletWithinRoute(pose, &closest));
+      EXPECT_EQ(expected.id(), closest.id()) << "x: " << x << ", y: " << y;
+    }
+  }
+
+  // the index is rebuilt with the route
+  route_handler_->clearRoute();
+  lanelet::ConstLanelet closest;
+  const auto pose = autoware::test_utils::createPose(0.5, 1.75, 0.0, 0.0, 0.0, 0.0);
+  ASSERT_FALSE(route_handler_->getClosestLaneletWithinRoute(pose, &closest));
+  route_handler_->setRoute(route);
+  ASSERT_TRUE(route_handler_->getClosestLaneletWithinRoute(pose, &closest));
+  ASSERT_EQ(closest.id(), 4424ul);
+}
+
 TEST_F(TestRouteHandler, testGetLaneChangeTargetLanes)
 {
   {
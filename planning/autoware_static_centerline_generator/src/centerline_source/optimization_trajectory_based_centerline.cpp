@@ -23,6 +23,8 @@
 #include "utils.hpp"
 
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace autoware::static_centerline_generator
 {
@@ -89,6 +91,8 @@ OptimizationTrajectoryBasedCenterline::generate_centerline_with_optimization(
     autoware::universe_utils::getOrDeclareParameter<double>(node, "output_path_interval");
   const double behavior_vel_interval =
     autoware::universe_utils::getOrDeclareParameter<double>(node, "behavior_output_path_interval");
+  const int optimization_thread_num =
+    autoware::universe_utils::getOrDeclareParameter<int>(node, "optimization_thread_num");
 
   // extract path with lane id from lanelets
   const auto raw_path_with_lane_id = [&]() {
@@ -110,7 +114,7 @@ OptimizationTrajectoryBasedCenterline::generate_centerline_with_optimization(
   RCLCPP_INFO(node.get_logger(), "Converted to path and published.");
 
   // smooth trajectory and road collision avoidance
-  const auto optimized_traj_points = optimize_trajectory(raw_path);
+  const auto optimized_traj_points = optimize_trajectory(raw_path, optimization_thread_num);
   RCLCPP_INFO(
     node.get_logger(),
     "Smoothed trajectory and made it collision free with the road and published.");
@@ -119,7 +123,7 @@ OptimizationTrajectoryBasedCenterline::generate_centerline_with_optimization(
 }
 
 std::vector<TrajectoryPoint> OptimizationTrajectoryBasedCenterline::optimize_trajectory(
-  const Path & raw_path) const
+  const Path & raw_path, const int optimization_thread_num) const
 {
   // convert to trajectory points
   const auto raw_traj_points = [&]() {
@@ -127,12 +131,6 @@ std::vector<TrajectoryPoint> OptimizationTrajectoryBasedCenterline::optimize_tra
     return autoware::motion_utils::convertToTrajectoryPointArray(raw_traj);
   }();
 
-  // create an instance of elastic band and model predictive trajectory.
-  const auto eb_path_smoother_ptr =
-    autoware::path_smoother::ElasticBandSmoother(create_node_options()).getElasticBandSmoother();
-  const auto mpt_optimizer_ptr =
-    autoware::path_optimizer::PathOptimizer(create_node_options()).getMPTOptimizer();
-
   // NOTE: The optimization is executed every valid_optimized_traj_points_num points.
   constexpr int valid_optimized_traj_points_num = 10;
   const int traj_segment_num = raw_traj_points.size() / valid_optimized_traj_points_num;
@@ -141,43 +139,68 @@ std::vector<TrajectoryPoint> OptimizationTrajectoryBasedCenterline::optimize_tra
   // warm start.
   constexpr int num_initial_optimization = 2;
 
+  // NOTE: The segments are split into the chunks optimized in parallel. Each chunk has its own
+  // instances of elastic band and model predictive trajectory, and starts with the initial
+  // optimization as the first chunk does since the warm start is not shared between the chunks.
+  const int chunk_num = std::clamp(optimization_thread_num, 1, std::max(traj_segment_num, 1));
+  std::vector<std::shared_ptr<autoware::path_smoother::EBPathSmoother>> eb_path_smoother_ptrs;
+  std::vector<std::shared_ptr<autoware::path_optimizer::MPTOptimizer>> mpt_optimizer_ptrs;
+  for (int chunk_idx = 0; chunk_idx < chunk_num; ++chunk_idx) {
+    eb_path_smoother_ptrs.push_back(
+      autoware::path_smoother::ElasticBandSmoother(create_node_options()).getElasticBandSmoother());
+    mpt_optimizer_ptrs.push_back(
+      autoware::path_optimizer::PathOptimizer(create_node_options()).getMPTOptimizer());
+  }
+
+  // optimized trajectory points of each optimization in the order of the virtual ego pose
+  std::vector<std::vector<std::vector<TrajectoryPoint>>> chunk_optimized_traj_points(chunk_num);
+#pragma omp parallel for num_threads(chunk_num) schedule(static, 1)
+  for (int chunk_idx = 0; chunk_idx < chunk_num; ++chunk_idx) {
+    const int begin_segment_idx = traj_segment_num * chunk_idx / chunk_num;
+    const int end_segment_idx = traj_segment_num * (chunk_idx + 1) / chunk_num;
+    for (int virtual_ego_pose_idx = begin_segment_idx - num_initial_optimization;
+         virtual_ego_pose_idx < end_segment_idx; ++virtual_ego_pose_idx) {
+      // calculate virtual ego pose for the optimization
+      constexpr int virtual_ego_pose_offset_idx = 1;
+      const auto virtual_ego_pose =
+        raw_traj_points
+          .at(
+            valid_optimized_traj_points_num * std::max(virtual_ego_pose_idx, begin_segment_idx) +
+            virtual_ego_pose_offset_idx)
+          .pose;
+
+      // smooth trajectory by elastic band in the autoware_path_smoother package
+      const auto smoothed_traj_points =
+        eb_path_smoother_ptrs.at(chunk_idx)->smoothTrajectory(raw_traj_points, virtual_ego_pose);
+
+      // road collision avoidance by model predictive trajectory in the autoware_path_optimizer
+      // package
+      const autoware::path_optimizer::PlannerData planner_data{
+        raw_path.header, smoothed_traj_points, raw_path.left_bound, raw_path.right_bound,
+        virtual_ego_pose};
+      chunk_optimized_traj_points.at(chunk_idx).push_back(
+        mpt_optimizer_ptrs.at(chunk_idx)->optimizeTrajectory(planner_data));
+    }
+  }
+
   std::vector<TrajectoryPoint> whole_optimized_traj_points;
-  for (int virtual_ego_pose_idx = -num_initial_optimization;
-       virtual_ego_pose_idx < traj_segment_num; ++virtual_ego_pose_idx) {
-    // calculate virtual ego pose for the optimization
-    constexpr int virtual_ego_pose_offset_idx = 1;
-    const auto virtual_ego_pose =
-      raw_traj_points
-        .at(
-          valid_optimized_traj_points_num * std::max(virtual_ego_pose_idx, 0) +
-          virtual_ego_pose_offset_idx)
-        .pose;
-
-    // smooth trajectory by elastic band in the autoware_path_smoother package
-    const auto smoothed_traj_points =
-      eb_path_smoother_ptr->smoothTrajectory(raw_traj_points, virtual_ego_pose);
-
-    // road collision avoidance by model predictive trajectory in the autoware_path_optimizer
-    // package
-    const autoware::path_optimizer::PlannerData planner_data{
-      raw_path.header, smoothed_traj_points, raw_path.left_bound, raw_path.right_bound,
-      virtual_ego_pose};
-    const auto optimized_traj_points = mpt_optimizer_ptr->optimizeTrajectory(planner_data);
-
-    // connect the previously and currently optimized trajectory points
-    for (size_t j = 0; j < whole_optimized_traj_points.size(); ++j) {
-      const double dist = autoware::universe_utils::calcDistance2d(
-        whole_optimized_traj_points.at(j), optimized_traj_points.front());
-      if (dist < 0.5) {
-        const std::vector<TrajectoryPoint> extracted_whole_optimized_traj_points{
-          whole_optimized_traj_points.begin(),
-          whole_optimized_traj_points.begin() + std::max(j, 1UL) - 1};
-        whole_optimized_traj_points = extracted_whole_optimized_traj_points;
-        break;
+  for (const auto & optimized_traj_points_vec : chunk_optimized_traj_points) {
+    for (const auto & optimized_traj_points : optimized_traj_points_vec) {
+      // connect the previously and currently optimized trajectory points
+      for (size_t j = 0; j < whole_optimized_traj_points.size(); ++j) {
+        const double dist = autoware::universe_utils::calcDistance2d(
+          whole_optimized_traj_points.at(j), optimized_traj_points.front());
+        if (dist < 0.5) {
+          const std::vector<TrajectoryPoint> extracted_whole_optimized_traj_points{
+            whole_optimized_traj_points.begin(),
+            whole_optimized_traj_points.begin() + std::max(j, 1UL) - 1};
+          whole_optimized_traj_points = extracted_whole_optimized_traj_points;
+          break;
+        }
+      }
+      for (size_t j = 0; j < optimized_traj_points.size(); ++j) {
+        whole_optimized_traj_points.push_back(optimized_traj_points.at(j));
       }
-    }
-    for (size_t j = 0; j < optimized_traj_points.size(); ++j) {
-      whole_optimized_traj_points.push_back(optimized_traj_points.at(j));
     }
   }
 
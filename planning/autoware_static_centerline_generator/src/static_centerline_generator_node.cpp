@@ -631,17 +631,27 @@ void StaticCenterlineGeneratorNode::validate()
     vehicle_info_.max_steer_angle_rad - max_steer_angle_margin);
 
   // calculate the distance between footprint and right/left bounds
+  // NOTE: The distances of the points are independent of each other, and calculated in parallel
+  //       since they are the most of the validation time for a long centerline.
+  std::vector<LinearRing2d> footprint_polys(centerline.size());
+  std::vector<double> min_dists_to_bound(centerline.size());
+#pragma omp parallel for schedule(dynamic, 64)
+  for (size_t i = 0; i < centerline.size(); ++i) {
+    footprint_polys.at(i) = create_vehicle_footprint(centerline.at(i).pose, vehicle_info_);
+    const double dist_to_right =
+      boost::geometry::distance(footprint_polys.at(i), lanelet_right_bound);
+    const double dist_to_left =
+      boost::geometry::distance(footprint_polys.at(i), lanelet_left_bound);
+    min_dists_to_bound.at(i) = std::min(dist_to_right, dist_to_left);
+  }
+
   MarkerArray marker_array;
   double min_dist = std::numeric_limits<double>::max();
   double max_curvature = std::numeric_limits<double>::min();
   for (size_t i = 0; i < centerline.size(); ++i) {
     const auto & traj_point = centerline.at(i);
-
-    const auto footprint_poly = create_vehicle_footprint(traj_point.pose, vehicle_info_);
-
-    const double dist_to_right = boost::geometry::distance(footprint_poly, lanelet_right_bound);
-    const double dist_to_left = boost::geometry::distance(footprint_poly, lanelet_left_bound);
-    const double min_dist_to_bound = std::min(dist_to_right, dist_to_left);
+    const auto & footprint_poly = footprint_polys.at(i);
+    const double min_dist_to_bound = min_dists_to_bound.at(i);
 
     if (min_dist_to_bound < min_dist) {
       min_dist = min_dist_to_bound;
@@ -0,0 +1,145 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef EGO_FOOTPRINT_HPP_
+#define EGO_FOOTPRINT_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace autoware::surround_obstacle_checker
+{
+
+/**
+ * @brief footprint of the ego with the check margins, as an axis aligned rectangle in the base_link
+ * frame, whose distances to the points and the polygons in the same frame are computed in closed
+ * form without boost::geometry
+ */
+struct EgoFootprint
+{
+  struct Point
+  {
+    double x;
+    double y;
+  };
+
+  double front;
+  double rear;
+  double half_width;
+
+  EgoFootprint(const double base_to_front, const double base_to_rear, const double width)
+  : front(base_to_front), rear(base_to_rear), half_width(width / 2.0)
+  {
+  }
+
+  // exact distance from the point, 0 if the point is within the footprint
+  double distance(const double x, const double y) const
+  {
+    const double dx = std::max({-rear - x, 0.0, x - front});
+    const double dy = std::max(std::abs(y) - half_width, 0.0);
+    return std::hypot(dx, dy);
+  }
+
+  // exact distance from the polygon given by its vertices, 0 if they overlap
+  double distance(const std::vector<Point> & polygon) const
+  {
+    if (polygon.empty()) {
+      return std::numeric_limits<double>::max();
+    }
+
+    // an edge of the polygon crossing the footprint, including a vertex within it
+    const size_t num_points = polygon.size();
+    for (size_t i = 0; i < num_points; ++i) {
+      if (intersects(polygon[i], polygon[(i + 1) % num_points])) {
+        return 0.0;
+      }
+    }
+    // the footprint within the polygon
+    if (num_points >= 3 && isWithinPolygon(polygon, {front, half_width})) {
+      return 0.0;
+    }
+
+    // otherwise the nearest pair is a vertex of one and an edge of the other
+    const Point corners[] = {
+      {front, half_width}, {front, -half_width}, {-rear, -half_width}, {-rear, half_width}};
+    double min_distance = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < num_points; ++i) {
+      const auto & a = polygon[i];
+      const auto & b = polygon[(i + 1) % num_points];
+      min_distance = std::min(min_distance, distance(a.x, a.y));
+      for (const auto & corner : corners) {
+        min_distance = std::min(min_distance, distanceToSegment(corner, a, b));
+      }
+    }
+    return min_distance;
+  }
+
+private:
+  // whether the segment crosses the footprint, by clipping it with the footprint (Liang-Barsky)
+  bool intersects(const Point & a, const Point & b) const
+  {
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double p[] = {-dx, dx, -dy, dy};
+    const double q[] = {a.x + rear, front - a.x, a.y + half_width, half_width - a.y};
+    double t0 = 0.0;
+    double t1 = 1.0;
+    for (size_t i = 0; i < 4; ++i) {
+      if (p[i] == 0.0) {
+        if (q[i] < 0.0) return false;
+        continue;
+      }
+      const double t = q[i] / p[i];
+      if (p[i] < 0.0) {
+        t0 = std::max(t0, t);
+      } else {
+        t1 = std::min(t1, t);
+      }
+      if (t0 > t1) return false;
+    }
+    return true;
+  }
+
+  static double distanceToSegment(const Point & p, const Point & a, const Point & b)
+  {
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double squared_length = dx * dx + dy * dy;
+    const double t =
+      squared_length > 0.0
+        ? std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / squared_length, 0.0, 1.0)
+        : 0.0;
+    return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+  }
+
+  // even-odd test of the interior of the polygon
+  static bool isWithinPolygon(const std::vector<Point> & polygon, const Point & p)
+  {
+    bool within = false;
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+      const auto & a = polygon[i];
+      const auto & b = polygon[j];
+      if ((a.y > p.y) != (b.y > p.y) && p.x < (b.x - a.x) * (p.y - a.y) / (b.y - a.y) + a.x) {
+        within = !within;
+      }
+    }
+    return within;
+  }
+};
+
+}  // namespace autoware::surround_obstacle_checker
+
+#endif  // EGO_FOOTPRINT_HPP_
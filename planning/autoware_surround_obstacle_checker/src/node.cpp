@@ -18,18 +18,12 @@
 #include <autoware/universe_utils/geometry/geometry.hpp>
 #include <autoware/universe_utils/ros/update_param.hpp>
 #include <autoware/universe_utils/system/stop_watch.hpp>
-#include <autoware/universe_utils/transform/transforms.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/format.hpp>
-#include <boost/geometry.hpp>
-#include <boost/geometry/geometries/linestring.hpp>
-#include <boost/geometry/geometries/point_xy.hpp>
 
-#include <pcl/common/transforms.h>
-#include <pcl/point_cloud.h>
-#include <pcl_conversions/pcl_conversions.h>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <optional>
 #ifdef ROS_DISTRO_GALACTIC
@@ -43,6 +37,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #define EIGEN_MPL2_ONLY
 #include <Eigen/Core>
@@ -50,10 +45,6 @@
 
 namespace autoware::surround_obstacle_checker
 {
-namespace bg = boost::geometry;
-using Point2d = bg::model::d2::point_xy<double>;
-using Polygon2d = bg::model::polygon<Point2d>;
-using autoware::universe_utils::createPoint;
 using autoware::universe_utils::pose2transform;
 using autoware_perception_msgs::msg::ObjectClassification;
 
@@ -142,6 +133,14 @@ std::array<double, 3> SurroundObstacleCheckerNode::getCheckDistances(
     obstacle_param.surround_check_back_distance};
 }
 
+EgoFootprint SurroundObstacleCheckerNode::createEgoFootprint(
+  const double front_margin, const double side_margin, const double back_margin) const
+{
+  return EgoFootprint(
+    vehicle_info_.max_longitudinal_offset_m + front_margin,
+    vehicle_info_.rear_overhang_m + back_margin, vehicle_info_.vehicle_width_m + side_margin * 2);
+}
+
 bool SurroundObstacleCheckerNode::getUseDynamicObject() const
 {
   const auto param = param_listener_->get_params();
@@ -310,40 +309,39 @@ std::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByPointCl
     return std::nullopt;
   }
 
-  Eigen::Affine3f isometry =
+  const Eigen::Affine3f isometry =
     tf2::transformToEigen(transform_stamped.value().transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud;
-  pcl::fromROSMsg(*pointcloud_ptr_, transformed_pointcloud);
-  autoware::universe_utils::transformPointCloud(
-    transformed_pointcloud, transformed_pointcloud, isometry);
 
+  // the points are transformed to base_link while they are read from the buffer, and the distance
+  // to the footprint is computed in base_link in closed form
   const auto & pointcloud_param = param.obstacle_types_map.at("pointcloud");
-  const double front_margin = pointcloud_param.surround_check_front_distance;
-  const double side_margin = pointcloud_param.surround_check_side_distance;
-  const double back_margin = pointcloud_param.surround_check_back_distance;
-  const double base_to_front = vehicle_info_.max_longitudinal_offset_m + front_margin;
-  const double base_to_rear = vehicle_info_.rear_overhang_m + back_margin;
-  const double width = vehicle_info_.vehicle_width_m + side_margin * 2;
-  const auto ego_polygon = autoware::universe_utils::toFootprint(
-    odometry_ptr_->pose.pose, base_to_front, base_to_rear, width);
-
-  geometry_msgs::msg::Point nearest_point;
+  const auto ego_footprint = createEgoFootprint(
+    pointcloud_param.surround_check_front_distance, pointcloud_param.surround_check_side_distance,
+    pointcloud_param.surround_check_back_distance);
+  Eigen::Vector3f nearest_point;
   double minimum_distance = std::numeric_limits<double>::max();
   bool was_minimum_distance_updated = false;
-  for (const auto & p : transformed_pointcloud) {
-    Point2d boost_point(p.x, p.y);
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(*pointcloud_ptr_, "x"),
+       iter_y(*pointcloud_ptr_, "y"), iter_z(*pointcloud_ptr_, "z");
+       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f p = isometry * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
 
-    const auto distance_to_object = bg::distance(ego_polygon, boost_point);
+    const auto distance_to_object = ego_footprint.distance(p.x(), p.y());
 
     if (distance_to_object < minimum_distance) {
-      nearest_point = createPoint(p.x, p.y, p.z);
+      nearest_point = p;
       minimum_distance = distance_to_object;
       was_minimum_distance_updated = true;
     }
   }
 
   if (was_minimum_distance_updated) {
-    return std::make_pair(minimum_distance, nearest_point);
+    // the nearest point is reported in the same frame as the objects
+    return std::make_pair(
+      minimum_distance,
+      autoware::universe_utils::calcOffsetPose(
+        odometry_ptr_->pose.pose, nearest_point.x(), nearest_point.y(), nearest_point.z())
+        .position);
   }
   return std::nullopt;
 }
@@ -354,7 +352,12 @@ std::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByDynamic
 
   const auto param = param_listener_->get_params();
 
-  // TODO(murooka) check computation cost
+  const auto & ego_position = odometry_ptr_->pose.pose.position;
+  const double ego_yaw = tf2::getYaw(odometry_ptr_->pose.pose.orientation);
+  const double cos_ego_yaw = std::cos(ego_yaw);
+  const double sin_ego_yaw = std::sin(ego_yaw);
+  std::vector<EgoFootprint::Point> ego_frame_polygon;
+
   geometry_msgs::msg::Point nearest_point;
   double minimum_distance = std::numeric_limits<double>::max();
   bool was_minimum_distance_updated = false;
@@ -367,18 +370,21 @@ std::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByDynamic
       continue;
     }
     const auto & object_param = param.obstacle_types_map.at(str_label);
-    const double front_margin = object_param.surround_check_front_distance;
-    const double side_margin = object_param.surround_check_side_distance;
-    const double back_margin = object_param.surround_check_back_distance;
-    const double base_to_front = vehicle_info_.max_longitudinal_offset_m + front_margin;
-    const double base_to_rear = vehicle_info_.rear_overhang_m + back_margin;
-    const double width = vehicle_info_.vehicle_width_m + side_margin * 2;
-    const auto ego_polygon = autoware::universe_utils::toFootprint(
-      odometry_ptr_->pose.pose, base_to_front, base_to_rear, width);
+    const auto ego_footprint = createEgoFootprint(
+      object_param.surround_check_front_distance, object_param.surround_check_side_distance,
+      object_param.surround_check_back_distance);
 
+    // the distance is computed in base_link, where the footprint is an axis aligned rectangle
     const auto object_polygon = autoware::universe_utils::toPolygon2d(object);
+    ego_frame_polygon.clear();
+    for (const auto & p : object_polygon.outer()) {
+      const double dx = p.x() - ego_position.x;
+      const double dy = p.y() - ego_position.y;
+      ego_frame_polygon.push_back(
+        {cos_ego_yaw * dx + sin_ego_yaw * dy, -sin_ego_yaw * dx + cos_ego_yaw * dy});
+    }
 
-    const auto distance_to_object = bg::distance(ego_polygon, object_polygon);
+    const auto distance_to_object = ego_footprint.distance(ego_frame_polygon);
 
     if (distance_to_object < minimum_distance) {
       nearest_point = object_pose.position;
@@ -18,6 +18,7 @@
 #include "autoware/universe_utils/ros/logger_level_configure.hpp"
 #include "autoware/universe_utils/ros/polling_subscriber.hpp"
 #include "debug_marker.hpp"
+#include "ego_footprint.hpp"
 #include "surround_obstacle_checker_node_parameters.hpp"
 
 #include <autoware/motion_utils/vehicle/vehicle_state_checker.hpp>
@@ -67,6 +68,9 @@ public:
 private:
   std::array<double, 3> getCheckDistances(const std::string & str_label) const;
 
+  EgoFootprint createEgoFootprint(
+    const double front_margin, const double side_margin, const double back_margin) const;
+
   bool getUseDynamicObject() const;
 
   void onTimer();
@@ -20,6 +20,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 namespace autoware::surround_obstacle_checker
 {
 auto generateTestTargetNode() -> std::shared_ptr<SurroundObstacleCheckerNode>
@@ -126,4 +128,33 @@ TEST_F(SurroundObstacleCheckerNodeTest, isStopRequired)
 
   rclcpp::shutdown();
 }
+
+TEST(EgoFootprint, distance)
+{
+  // 4.0 m to the front, 1.0 m to the rear and 2.0 m wide
+  const EgoFootprint ego_footprint(4.0, 1.0, 2.0);
+
+  EXPECT_DOUBLE_EQ(ego_footprint.distance(0.0, 0.0), 0.0);
+  EXPECT_DOUBLE_EQ(ego_footprint.distance(4.0, 1.0), 0.0);
+  EXPECT_DOUBLE_EQ(ego_footprint.distance(6.0, 0.5), 2.0);
+  EXPECT_DOUBLE_EQ(ego_footprint.distance(-2.0, 0.0), 1.0);
+  EXPECT_DOUBLE_EQ(ego_footprint.distance(0.0, -3.0), 2.0);
+  EXPECT_DOUBLE_EQ(ego_footprint.distance(7.0, 5.0), 5.0);
+
+  // a box in front of the ego
+  EXPECT_DOUBLE_EQ(
+    ego_footprint.distance({{6.0, -0.5}, {8.0, -0.5}, {8.0, 0.5}, {6.0, 0.5}}), 2.0);
+  // a box whose corner is the nearest to the corner of the ego
+  EXPECT_NEAR(
+    ego_footprint.distance({{7.0, 5.0}, {9.0, 5.0}, {9.0, 7.0}, {7.0, 7.0}}), 5.0, 1e-9);
+  // a box crossing the ego without any vertex within it
+  EXPECT_DOUBLE_EQ(
+    ego_footprint.distance({{1.0, -5.0}, {2.0, -5.0}, {2.0, 5.0}, {1.0, 5.0}}), 0.0);
+  // a box containing the ego
+  EXPECT_DOUBLE_EQ(
+    ego_footprint.distance({{-10.0, -10.0}, {10.0, -10.0}, {10.0, 10.0}, {-10.0, 10.0}}), 0.0);
+  // a triangle whose edge is the nearest to the corner of the ego
+  EXPECT_NEAR(
+    ego_footprint.distance({{3.0, 4.0}, {6.0, 1.0}, {8.0, 4.0}}), std::sqrt(2.0), 1e-9);
+}
 }  // namespace autoware::surround_obstacle_checker
@@ -61,6 +61,9 @@ public:
 private:
   Param smoother_param_;
   std::shared_ptr<autoware::qp_interface::QPInterface> qp_interface_;
+  // previous optimized trajectory and solution to warm start the next optimization
+  TrajectoryPoints prev_optimized_trajectory_;
+  std::vector<double> prev_optval_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("jerk_filtered_smoother")};
 
   TrajectoryPoints forwardJerkFilter(
@@ -69,6 +72,7 @@ private:
   TrajectoryPoints backwardJerkFilter(
     const double v0, const double a0, const double a_min, const double a_stop, const double j_min,
     const TrajectoryPoints & input) const;
+  std::vector<double> calcInitialGuess(const TrajectoryPoints & trajectory, const size_t N) const;
   TrajectoryPoints mergeFilteredTrajectory(
     const double v0, const double a0, const double a_min, const double j_min,
     const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const;
@@ -29,6 +29,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 // clang-format on
@@ -307,11 +308,13 @@ void VelocitySmootherNode::initCommonParam()
 
 void VelocitySmootherNode::publishTrajectory(const TrajectoryPoints & trajectory) const
 {
-  Trajectory publishing_trajectory = autoware::motion_utils::convertToTrajectory(trajectory);
-  publishing_trajectory.header = base_traj_raw_ptr_->header;
-  pub_trajectory_->publish(publishing_trajectory);
-  published_time_publisher_->publish_if_subscribed(
-    pub_trajectory_, publishing_trajectory.header.stamp);
+  // publish with unique_ptr so that the message is not copied again in the intra-process
+  // communication
+  auto publishing_trajectory = std::make_unique<Trajectory>(
+    autoware::motion_utils::convertToTrajectory(trajectory, base_traj_raw_ptr_->header));
+  const auto stamp = publishing_trajectory->header.stamp;
+  pub_trajectory_->publish(std::move(publishing_trajectory));
+  published_time_publisher_->publish_if_subscribed(pub_trajectory_, stamp);
 }
 
 void VelocitySmootherNode::calcExternalVelocityLimit()
@@ -18,6 +18,7 @@
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 
 #include <algorithm>
 #include <chrono>
@@ -42,7 +43,7 @@ JerkFilteredSmoother::JerkFilteredSmoother(
   p.jerk_filter_ds = node.declare_parameter<double>("jerk_filter_ds");
 
   qp_interface_ =
-    std::make_shared<autoware::qp_interface::ProxQPInterface>(false, 20000, 1.0e-8, 1.0e-6, false);
+    std::make_shared<autoware::qp_interface::ProxQPInterface>(true, 20000, 1.0e-8, 1.0e-6, false);
 }
 
 void JerkFilteredSmoother::setParam(const Param & smoother_param)
@@ -186,12 +187,16 @@ bool JerkFilteredSmoother::apply(
   const uint32_t l_constraints = 4 * N + 1;
 
   // the matrix size depends on constraint numbers.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
+  // NOTE: The triplets are added regardless of their values so that the sparsity structure of the
+  // matrices only depends on N, and the solver updates the previous problem in place.
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(9 * N);
 
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  P_triplets.reserve(7 * N);
   std::vector<double> q(l_variables, 0.0);
 
   /**************************************************************/
@@ -206,10 +211,11 @@ bool JerkFilteredSmoother::apply(
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double interval_dist = std::max(interval_dist_arr.at(i), 0.0001);
     const double w_x_ds_inv = (1.0 / interval_dist) * ref_vel;
-    P(IDX_A0 + i, IDX_A0 + i) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i, IDX_A0 + i + 1) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i + 1) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    const double jerk_weight = smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i, jerk_weight);
+    P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i + 1, -jerk_weight);
+    P_triplets.emplace_back(IDX_A0 + i + 1, IDX_A0 + i, -jerk_weight);
+    P_triplets.emplace_back(IDX_A0 + i + 1, IDX_A0 + i + 1, jerk_weight);
   }
 
   // |v_max_i^2 - b_i|/v_max^2 -> minimize (-bi) * ds / v_max^2
@@ -222,9 +228,9 @@ bool JerkFilteredSmoother::apply(
       }
       q.at(IDX_B0 + i) += v_weight_term;
     }
-    P(IDX_DELTA0 + i, IDX_DELTA0 + i) += over_v_weight;  // over velocity cost
-    P(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += over_a_weight;  // over acceleration cost
-    P(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += over_j_weight;  // over jerk cost
+    P_triplets.emplace_back(IDX_DELTA0 + i, IDX_DELTA0 + i, over_v_weight);  // over velocity cost
+    P_triplets.emplace_back(IDX_SIGMA0 + i, IDX_SIGMA0 + i, over_a_weight);  // over accel cost
+    P_triplets.emplace_back(IDX_GAMMA0 + i, IDX_GAMMA0 + i, over_j_weight);  // over jerk cost
   }
 
   /**************************************************************/
@@ -245,16 +251,16 @@ bool JerkFilteredSmoother::apply(
 
   // Soft Constraint Velocity Limit: 0 < b - delta < v_max^2
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = 1.0;       // b_i
-    A(constr_idx, IDX_DELTA0 + i) = -1.0;  // -delta_i
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, 1.0);       // b_i
+    A_triplets.emplace_back(constr_idx, IDX_DELTA0 + i, -1.0);  // -delta_i
     upper_bound[constr_idx] = v_max_arr.at(i) * v_max_arr.at(i);
     lower_bound[constr_idx] = 0.0;
   }
 
   // Soft Constraint Acceleration Limit: a_min < a - sigma < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;       // a_i
-    A(constr_idx, IDX_SIGMA0 + i) = -1.0;  // -sigma_i
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 1.0);       // a_i
+    A_triplets.emplace_back(constr_idx, IDX_SIGMA0 + i, -1.0);  // -sigma_i
 
     constexpr double stop_vel = 1e-3;
     if (v_max_arr.at(i) < stop_vel) {
@@ -272,34 +278,45 @@ bool JerkFilteredSmoother::apply(
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double ds = interval_dist_arr.at(i);
-    A(constr_idx, IDX_A0 + i) = -ref_vel;     // -a[i] * ref_vel
-    A(constr_idx, IDX_A0 + i + 1) = ref_vel;  //  a[i+1] * ref_vel
-    A(constr_idx, IDX_GAMMA0 + i) = -ds;      // -gamma[i] * ds
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, -ref_vel);     // -a[i] * ref_vel
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i + 1, ref_vel);  //  a[i+1] * ref_vel
+    A_triplets.emplace_back(constr_idx, IDX_GAMMA0 + i, -ds);      // -gamma[i] * ds
     upper_bound[constr_idx] = j_max * ds;     //  jerk_max * ds
     lower_bound[constr_idx] = j_min * ds;     //  jerk_min * ds
   }
 
   // b' = 2a ... (b(i+1) - b(i)) / ds = 2a(i)
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = -1.0;                            // b(i)
-    A(constr_idx, IDX_B0 + i + 1) = 1.0;                         // b(i+1)
-    A(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, -1.0);                            // b(i)
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i + 1, 1.0);                         // b(i+1)
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, -2.0 * interval_dist_arr.at(i));  // a(i) * ds
     upper_bound[constr_idx] = 0.0;
     lower_bound[constr_idx] = 0.0;
   }
 
   // initial condition
   {
-    A(constr_idx, IDX_B0) = 1.0;  // b0
+    A_triplets.emplace_back(constr_idx, IDX_B0, 1.0);  // b0
     upper_bound[constr_idx] = v0 * v0;
     lower_bound[constr_idx] = v0 * v0;
     ++constr_idx;
 
-    A(constr_idx, IDX_A0) = 1.0;  // a0
+    A_triplets.emplace_back(constr_idx, IDX_A0, 1.0);  // a0
     upper_bound[constr_idx] = a0;
     lower_bound[constr_idx] = a0;
     ++constr_idx;
   }
+
+  Eigen::SparseMatrix<double> A(l_constraints, l_variables);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  Eigen::SparseMatrix<double> P(l_variables, l_variables);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+
+  // warm start with the previous solution shifted to the current trajectory
+  const auto initial_guess = calcInitialGuess(opt_resampled_trajectory, N);
+  if (!initial_guess.empty()) {
+    qp_interface_->setInitialPrimalVariables(initial_guess);
+  }
   time_keeper_->end_track("initOptimization");
 
   // execute optimization
@@ -308,6 +325,7 @@ bool JerkFilteredSmoother::apply(
   time_keeper_->end_track("optimize");
   if (!qp_interface_->isSolved()) {
     RCLCPP_WARN(logger_, "optimization failed : %s", qp_interface_->getStatus().c_str());
+    prev_optval_.clear();
     return false;
   }
 
@@ -315,9 +333,14 @@ bool JerkFilteredSmoother::apply(
     std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
   if (has_nan) {
     RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
+    prev_optval_.clear();
     return false;
   }
 
+  prev_optimized_trajectory_.assign(
+    opt_resampled_trajectory.begin(), opt_resampled_trajectory.begin() + N);
+  prev_optval_ = optval;
+
   const auto tf1 = std::chrono::system_clock::now();
   const double dt_ms1 =
     std::chrono::duration_cast<std::chrono::nanoseconds>(tf1 - ts).count() * 1.0e-6;
@@ -354,6 +377,39 @@ bool JerkFilteredSmoother::apply(
   return true;
 }
 
+std::vector<double> JerkFilteredSmoother::calcInitialGuess(
+  const TrajectoryPoints & trajectory, const size_t N) const
+{
+  const size_t prev_N = prev_optimized_trajectory_.size();
+  if (prev_N < 2 || prev_optval_.size() != 5 * prev_N) {
+    return {};
+  }
+
+  // the arc length of the current points from the front of the previous trajectory
+  const double offset = autoware::motion_utils::calcSignedArcLength(
+    prev_optimized_trajectory_, 0, trajectory.front().pose.position);
+  const auto prev_arclength = trajectory_utils::calcArclengthArray(prev_optimized_trajectory_);
+  const auto arclength = trajectory_utils::calcArclengthArray(trajectory);
+
+  // interpolate the variables of the previous solution linearly, and hold them outside
+  std::vector<double> initial_guess(5 * N, 0.0);
+  for (size_t i = 0; i < N; ++i) {
+    const double s = offset + arclength.at(i);
+    const size_t upper_idx = std::distance(
+      prev_arclength.begin(), std::upper_bound(prev_arclength.begin(), prev_arclength.end(), s));
+    const size_t seg_idx = std::clamp<size_t>(upper_idx, 1, prev_N - 1) - 1;
+    const double seg_length = prev_arclength.at(seg_idx + 1) - prev_arclength.at(seg_idx);
+    const double ratio =
+      seg_length < 1e-6 ? 0.0 : std::clamp((s - prev_arclength.at(seg_idx)) / seg_length, 0.0, 1.0);
+    for (size_t k = 0; k < 5; ++k) {
+      const double prev_value = prev_optval_.at(k * prev_N + seg_idx);
+      const double next_value = prev_optval_.at(k * prev_N + seg_idx + 1);
+      initial_guess.at(k * N + i) = prev_value + ratio * (next_value - prev_value);
+    }
+  }
+  return initial_guess;
+}
+
 TrajectoryPoints JerkFilteredSmoother::forwardJerkFilter(
   const double v0, const double a0, const double a_max, const double a_start, const double j_max,
   const TrajectoryPoints & input) const
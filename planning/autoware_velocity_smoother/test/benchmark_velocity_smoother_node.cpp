@@ -0,0 +1,102 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/velocity_smoother/node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_planning_test_manager/autoware_planning_benchmark_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+
+#include <autoware_adapi_v1_msgs/msg/operation_mode_state.hpp>
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <tier4_planning_msgs/msg/velocity_limit.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using autoware::planning_test_manager::PlanningBenchmarkManager;
+using autoware::velocity_smoother::VelocitySmootherNode;
+using autoware_adapi_v1_msgs::msg::OperationModeState;
+using autoware_planning_msgs::msg::Trajectory;
+using geometry_msgs::msg::AccelWithCovarianceStamped;
+using nav_msgs::msg::Odometry;
+using tier4_planning_msgs::msg::VelocityLimit;
+
+std::shared_ptr<VelocitySmootherNode> generateNode(const std::string & algorithm_type)
+{
+  auto node_options = rclcpp::NodeOptions{};
+  node_options.append_parameter_override("algorithm_type", algorithm_type);
+  node_options.append_parameter_override("publish_debug_trajs", false);
+  const auto autoware_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("autoware_test_utils");
+  const auto velocity_smoother_dir =
+    ament_index_cpp::get_package_share_directory("autoware_velocity_smoother");
+
+  autoware::test_utils::updateNodeOptions(
+    node_options, {autoware_test_utils_dir + "/config/test_common.param.yaml",
+                   autoware_test_utils_dir + "/config/test_nearest_search.param.yaml",
+                   autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+                   velocity_smoother_dir + "/config/default_velocity_smoother.param.yaml",
+                   velocity_smoother_dir + "/config/default_common.param.yaml",
+                   velocity_smoother_dir + "/config/" + algorithm_type + ".param.yaml"});
+
+  return std::make_shared<VelocitySmootherNode>(node_options);
+}
+
+static void BM_VelocitySmoother(benchmark::State & state, const std::string & algorithm_type)
+{
+  rclcpp::init(0, nullptr);
+  {
+    PlanningBenchmarkManager benchmark_manager;
+    auto test_target_node = generateNode(algorithm_type);
+
+    benchmark_manager.publish(
+      test_target_node, "/localization/kinematic_state",
+      benchmark_manager.getSnapshotField("self_odometry", autoware::test_utils::makeOdometry()));
+    benchmark_manager.publish(
+      test_target_node, "velocity_smoother/input/external_velocity_limit_mps", VelocityLimit{});
+    benchmark_manager.publish(
+      test_target_node, "velocity_smoother/input/operation_mode_state",
+      benchmark_manager.getSnapshotField("operation_mode", OperationModeState{}));
+    benchmark_manager.publish(
+      test_target_node, "velocity_smoother/input/acceleration",
+      benchmark_manager.getSnapshotField("self_acceleration", AccelWithCovarianceStamped{}));
+
+    // 200 m straight trajectory at 10 m/s
+    const auto trajectory = autoware::test_utils::generateTrajectory<Trajectory>(200, 1.0, 10.0);
+    benchmark_manager.benchmarkWithInput<Trajectory, Trajectory>(
+      state, test_target_node, "velocity_smoother/input/trajectory", trajectory,
+      "velocity_smoother/output/trajectory");
+  }
+  rclcpp::shutdown();
+}
+BENCHMARK_CAPTURE(BM_VelocitySmoother, JerkFiltered, std::string("JerkFiltered"))
+  ->UseManualTime()
+  ->Iterations(100)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VelocitySmoother, L2, std::string("L2"))
+  ->UseManualTime()
+  ->Iterations(100)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VelocitySmoother, Linf, std::string("Linf"))
+  ->UseManualTime()
+  ->Iterations(100)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VelocitySmoother, Analytical, std::string("Analytical"))
+  ->UseManualTime()
+  ->Iterations(100)
+  ->Unit(benchmark::kMillisecond);
@@ -192,8 +192,9 @@ void AvoidanceByLaneChange::fillAvoidanceTargetObjects(
   const auto [object_within_target_lane, object_outside_target_lane] =
     utils::path_safety_checker::separateObjectsByLanelets(
       *planner_data_->dynamic_object, data.current_lanelets,
-      [](const auto & obj, const auto & lane, const auto yaw_threshold) {
-        return utils::path_safety_checker::isPolygonOverlapLanelet(obj, lane, yaw_threshold);
+      [this](const auto & obj, const auto & lane, const auto yaw_threshold) {
+        return utils::path_safety_checker::isPolygonOverlapLanelet(
+          obj, lane, yaw_threshold, planner_data_->object_lanelet_index);
       });
 
   // Assume that the maximum allocation for data.other object is the sum of
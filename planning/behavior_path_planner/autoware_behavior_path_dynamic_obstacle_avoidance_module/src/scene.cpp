@@ -27,6 +27,8 @@
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/difference.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/union.hpp>
 
 #include <lanelet2_core/geometry/Point.h>
@@ -411,7 +413,13 @@ BehaviorModuleOutput DynamicObstacleAvoidanceModule::plan()
     throw std::runtime_error("input path is empty");
   }
 
-  const auto ego_path_reserve_poly = calcEgoPathReservePoly(input_path);
+  // the ego path reserve polygon is used only to clip the polygons of the unregulated objects
+  const bool has_unregulated_object =
+    std::any_of(target_objects_.begin(), target_objects_.end(), [&](const auto & object) {
+      return getObjectType(object.label) == ObjectType::UNREGULATED;
+    });
+  const auto ego_path_reserve_poly =
+    has_unregulated_object ? calcEgoPathReservePoly(input_path) : EgoPathReservePoly{};
 
   // create obstacles to avoid (= extract from the drivable area)
   std::vector<DrivableAreaInfo::Obstacle> obstacles_for_drivable_area;
@@ -1864,10 +1872,17 @@ DynamicObstacleAvoidanceModule::calcPredictedPathBasedDynamicObstaclePolygon(
     strategy::point_circle());
   if (expanded_poly.empty()) return {};
 
+  // the difference is the expanded polygon itself when their bounding boxes are apart
+  const auto & avoid_poly =
+    object.is_collision_left ? ego_path_poly.right_avoid : ego_path_poly.left_avoid;
   autoware::universe_utils::MultiPolygon2d output_poly;
-  boost::geometry::difference(
-    expanded_poly[0],
-    object.is_collision_left ? ego_path_poly.right_avoid : ego_path_poly.left_avoid, output_poly);
+  if (boost::geometry::disjoint(
+        boost::geometry::return_envelope<autoware::universe_utils::Box2d>(expanded_poly[0]),
+        boost::geometry::return_envelope<autoware::universe_utils::Box2d>(avoid_poly))) {
+    output_poly.push_back(expanded_poly[0]);
+  } else {
+    boost::geometry::difference(expanded_poly[0], avoid_poly, output_poly);
+  }
 
   if (output_poly.empty()) {
     RCLCPP_INFO_EXPRESSION(
@@ -1927,6 +1942,10 @@ DynamicObstacleAvoidanceModule::calcEgoPathReservePoly(const PathWithLaneId & eg
       }
       // boost::geometry::append(steer_lines, bg_point);
     }
+    // the union is skipped while there are no steer lines, as it is the path polygon itself
+    if (steer_lines.empty() && path_poly.size() == 1) {
+      return path_poly[0];
+    }
     autoware::universe_utils::MultiPolygon2d steer_poly;
     boost::geometry::buffer(
       steer_lines, steer_poly, steer_expand_strategy, strategy::side_straight(),
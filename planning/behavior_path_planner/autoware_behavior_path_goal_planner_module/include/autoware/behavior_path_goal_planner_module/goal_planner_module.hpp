@@ -306,7 +306,8 @@ private:
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_{};
 
   // planner
-  std::vector<std::shared_ptr<PullOverPlannerBase>> pull_over_planners_;
+  // one set of lane parking planners for each thread of onTimer
+  std::vector<std::vector<std::shared_ptr<PullOverPlannerBase>>> pull_over_planners_;
   std::unique_ptr<PullOverPlannerBase> freespace_planner_;
   std::unique_ptr<FixedGoalPlannerBase> fixed_goal_planner_;
 
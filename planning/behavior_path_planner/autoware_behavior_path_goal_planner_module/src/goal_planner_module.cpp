@@ -37,6 +37,7 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -73,13 +74,6 @@ GoalPlannerModule::GoalPlannerModule(
   is_freespace_parking_cb_running_{false},
   debug_stop_pose_with_info_{&stop_pose_}
 {
-  LaneDepartureChecker lane_departure_checker{};
-  lane_departure_checker.setVehicleInfo(vehicle_info_);
-  lane_departure_checker::Param lane_departure_checker_params;
-  lane_departure_checker_params.footprint_extra_margin =
-    parameters->lane_departure_check_expansion_margin;
-  lane_departure_checker.setParam(lane_departure_checker_params);
-
   occupancy_grid_map_ = std::make_shared<OccupancyGridBasedCollisionDetector>();
 
   left_side_parking_ = parameters_->parking_policy == ParkingPolicy::LEFT_SIDE;
@@ -87,20 +81,33 @@ GoalPlannerModule::GoalPlannerModule(
   // planner when goal modification is not allowed
   fixed_goal_planner_ = std::make_unique<DefaultFixedGoalPlanner>();
 
-  for (const std::string & planner_type : parameters_->efficient_path_order) {
-    if (planner_type == "SHIFT" && parameters_->enable_shift_parking) {
-      pull_over_planners_.push_back(
-        std::make_shared<ShiftPullOver>(node, *parameters, lane_departure_checker));
-    } else if (planner_type == "ARC_FORWARD" && parameters_->enable_arc_forward_parking) {
-      pull_over_planners_.push_back(std::make_shared<GeometricPullOver>(
-        node, *parameters, lane_departure_checker, /*is_forward*/ true));
-    } else if (planner_type == "ARC_BACKWARD" && parameters_->enable_arc_backward_parking) {
-      pull_over_planners_.push_back(std::make_shared<GeometricPullOver>(
-        node, *parameters, lane_departure_checker, /*is_forward*/ false));
+  // the planners and their lane departure checkers, which share a time keeper, are not thread-safe,
+  // so each thread of onTimer has its own set of planners
+  for (int i = 0; i < std::max(parameters_->num_threads, 1); ++i) {
+    LaneDepartureChecker lane_departure_checker{};
+    lane_departure_checker.setVehicleInfo(vehicle_info_);
+    lane_departure_checker::Param lane_departure_checker_params;
+    lane_departure_checker_params.footprint_extra_margin =
+      parameters->lane_departure_check_expansion_margin;
+    lane_departure_checker.setParam(lane_departure_checker_params);
+
+    std::vector<std::shared_ptr<PullOverPlannerBase>> pull_over_planners;
+    for (const std::string & planner_type : parameters_->efficient_path_order) {
+      if (planner_type == "SHIFT" && parameters_->enable_shift_parking) {
+        pull_over_planners.push_back(
+          std::make_shared<ShiftPullOver>(node, *parameters, lane_departure_checker));
+      } else if (planner_type == "ARC_FORWARD" && parameters_->enable_arc_forward_parking) {
+        pull_over_planners.push_back(std::make_shared<GeometricPullOver>(
+          node, *parameters, lane_departure_checker, /*is_forward*/ true));
+      } else if (planner_type == "ARC_BACKWARD" && parameters_->enable_arc_backward_parking) {
+        pull_over_planners.push_back(std::make_shared<GeometricPullOver>(
+          node, *parameters, lane_departure_checker, /*is_forward*/ false));
+      }
     }
+    pull_over_planners_.push_back(std::move(pull_over_planners));
   }
 
-  if (pull_over_planners_.empty()) {
+  if (pull_over_planners_.front().empty()) {
     RCLCPP_ERROR(getLogger(), "Not found enabled planner");
   }
 
@@ -303,28 +310,6 @@ void GoalPlannerModule::onTimer()
     local_planner_data, parameters.backward_goal_search_length,
     parameters.forward_goal_search_length,
     /*forward_only_in_route*/ false);
-  std::vector<PullOverPath> path_candidates{};
-  std::optional<Pose> closest_start_pose{};
-  double min_start_arc_length = std::numeric_limits<double>::max();
-  const auto planCandidatePaths = [&](
-                                    const std::shared_ptr<PullOverPlannerBase> & planner,
-                                    const GoalCandidate & goal_candidate) {
-    const auto pull_over_path = planner->plan(
-      goal_candidate, path_candidates.size(), local_planner_data, previous_module_output);
-    if (pull_over_path) {
-      // calculate absolute maximum curvature of parking path(start pose to end pose) for path
-      // priority
-      path_candidates.push_back(*pull_over_path);
-      // calculate closest pull over start pose for stop path
-      const double start_arc_length =
-        lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose()).length;
-      if (start_arc_length < min_start_arc_length) {
-        min_start_arc_length = start_arc_length;
-        // closest start pose is stop point when not finding safe path
-        closest_start_pose = pull_over_path->start_pose();
-      }
-    }
-  };
 
   // todo: currently non centerline input path is supported only by shift pull over
   const bool is_center_line_input_path = goal_planner_utils::isReferencePath(
@@ -333,25 +318,28 @@ void GoalPlannerModule::onTimer()
     getLogger(), "the input path of pull over planner is center line: %d",
     is_center_line_input_path);
 
-  // plan candidate paths and set them to the member variable
+  // list the pairs of the planner and the goal candidate in the order of the path priority
+  const auto & pull_over_planners = pull_over_planners_.front();
+  std::vector<std::pair<size_t, size_t>> planner_and_goal_indices{};
+  const auto addPlannerAndGoal = [&](const size_t planner_index, const size_t goal_index) {
+    // todo: temporary skip NON SHIFT planner when input path is not center line
+    if (
+      !is_center_line_input_path &&
+      pull_over_planners.at(planner_index)->getPlannerType() != PullOverPlannerType::SHIFT) {
+      return;
+    }
+    planner_and_goal_indices.emplace_back(planner_index, goal_index);
+  };
   if (parameters.path_priority == "efficient_path") {
-    for (const auto & planner : pull_over_planners_) {
-      // todo: temporary skip NON SHIFT planner when input path is not center line
-      if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
-        continue;
-      }
-      for (const auto & goal_candidate : goal_candidates) {
-        planCandidatePaths(planner, goal_candidate);
+    for (size_t i = 0; i < pull_over_planners.size(); ++i) {
+      for (size_t j = 0; j < goal_candidates.size(); ++j) {
+        addPlannerAndGoal(i, j);
       }
     }
   } else if (parameters.path_priority == "close_goal") {
-    for (const auto & goal_candidate : goal_candidates) {
-      for (const auto & planner : pull_over_planners_) {
-        // todo: temporary skip NON SHIFT planner when input path is not center line
-        if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
-          continue;
-        }
-        planCandidatePaths(planner, goal_candidate);
+    for (size_t j = 0; j < goal_candidates.size(); ++j) {
+      for (size_t i = 0; i < pull_over_planners.size(); ++i) {
+        addPlannerAndGoal(i, j);
       }
     }
   } else {
@@ -361,6 +349,40 @@ void GoalPlannerModule::onTimer()
     throw std::domain_error("[pull_over] invalid path_priority");
   }
 
+  // plan candidate paths in parallel. each thread takes its own set of planners, and the id of a
+  // path is its index in the list above so that it does not depend on the threads
+  std::vector<std::optional<PullOverPath>> planned_paths(planner_and_goal_indices.size());
+  std::atomic<size_t> next_thread_index{0};
+  std::atomic<size_t> next_plan_index{0};
+#pragma omp parallel num_threads(pull_over_planners_.size())
+  {
+    const auto & planners = pull_over_planners_.at(next_thread_index++);
+    for (size_t i = next_plan_index++; i < planner_and_goal_indices.size(); i = next_plan_index++) {
+      const auto & [planner_index, goal_index] = planner_and_goal_indices.at(i);
+      const auto & planner = planners.at(planner_index);
+      planned_paths.at(i) = planner->plan(
+        goal_candidates.at(goal_index), i, local_planner_data, previous_module_output);
+    }
+  }
+
+  std::vector<PullOverPath> path_candidates{};
+  std::optional<Pose> closest_start_pose{};
+  double min_start_arc_length = std::numeric_limits<double>::max();
+  for (auto & pull_over_path : planned_paths) {
+    if (!pull_over_path) {
+      continue;
+    }
+    // calculate closest pull over start pose for stop path
+    const double start_arc_length =
+      lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose()).length;
+    if (start_arc_length < min_start_arc_length) {
+      min_start_arc_length = start_arc_length;
+      // closest start pose is stop point when not finding safe path
+      closest_start_pose = pull_over_path->start_pose();
+    }
+    path_candidates.push_back(std::move(*pull_over_path));
+  }
+
   // set member variables
   thread_safe_data_.set_pull_over_path_candidates(path_candidates);
   thread_safe_data_.set_closest_start_pose(closest_start_pose);
@@ -991,10 +1013,17 @@ std::optional<PullOverPath> GoalPlannerModule::selectPullOverPath(
     // Create a map of PullOverPath pointer to largest collision check margin
     std::map<size_t, double> path_id_to_rough_margin_map;
     const auto & target_objects = context_data.static_target_objects;
-    for (const size_t i : sorted_path_indices) {
-      const auto & path = pull_over_path_candidates[i];
-      const double distance = utils::path_safety_checker::calculateRoughDistanceToObjects(
+    // the distances of the paths are independent of each other, so they are calculated in parallel
+    std::vector<double> rough_distances(sorted_path_indices.size());
+#pragma omp parallel for num_threads(parameters_->num_threads) schedule(dynamic)
+    for (size_t j = 0; j < sorted_path_indices.size(); ++j) {
+      const auto & path = pull_over_path_candidates[sorted_path_indices[j]];
+      rough_distances[j] = utils::path_safety_checker::calculateRoughDistanceToObjects(
         path.parking_path(), target_objects, planner_data_->parameters, false, "max");
+    }
+    for (size_t j = 0; j < sorted_path_indices.size(); ++j) {
+      const auto & path = pull_over_path_candidates[sorted_path_indices[j]];
+      const double distance = rough_distances[j];
       auto it = std::lower_bound(
         margins_with_zero.begin(), margins_with_zero.end(), distance, std::greater<double>());
       if (it == margins_with_zero.end()) {
@@ -20,6 +20,7 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -150,6 +151,7 @@ GoalPlannerParameters GoalPlannerModuleManager::initGoalPlannerParameters(
       node->declare_parameter<std::vector<std::string>>(ns + "efficient_path_order");
     p.lane_departure_check_expansion_margin =
       node->declare_parameter<double>(ns + "lane_departure_check_expansion_margin");
+    p.num_threads = std::max(node->declare_parameter<int>(ns + "num_threads"), 1);
   }
 
   // shift parking
@@ -16,6 +16,7 @@
 
 #include "autoware/behavior_path_lane_change_module/utils/base_class.hpp"
 #include "autoware/behavior_path_lane_change_module/utils/data_structs.hpp"
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check.hpp"
 
 #include <memory>
 #include <utility>
@@ -151,8 +152,18 @@ protected:
     const PathWithLaneId & prep_segment, const std::vector<std::vector<int64_t>> & sorted_lane_ids,
     const Pose & lc_start_pose, const double shift_length) const;
 
+  /**
+   * @brief check the safety of a candidate path and store the result in the evaluation
+   *
+   * It is called from the tasks of get_lane_change_paths(), so it must not use the time keeper or
+   * modify the module state.
+   */
+  void evaluate_candidate_path(
+    CandidatePathEvaluation & evaluation, const lane_change::TargetObjects & target_objects) const;
+
   bool check_candidate_path_safety(
-    const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects) const;
+    const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects,
+    CollisionCheckDebugMap & debug_data) const;
 
   std::optional<LaneChangePath> calcTerminalLaneChangePath(
     const lanelet::ConstLanelets & current_lanes,
@@ -173,7 +184,7 @@ protected:
 
   bool is_collided(
     const PathWithLaneId & lane_change_path, const ExtendedPredictedObject & obj,
-    const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
+    utils::path_safety_checker::InterpolatedEgoPathCache & ego_path_cache,
     const RSSparams & selected_rss_param, CollisionCheckDebugMap & debug_data) const;
 
   double get_max_velocity_for_safety_check() const;
@@ -159,6 +159,7 @@ struct Parameters
   bool allow_loose_check_for_cancel{true};
   bool enable_target_lane_bound_check{true};
   double collision_check_yaw_diff_threshold{3.1416};
+  int num_threads{1};
   utils::path_safety_checker::RSSparams rss_params{};
   utils::path_safety_checker::RSSparams rss_params_for_parked{};
   utils::path_safety_checker::RSSparams rss_params_for_abort{};
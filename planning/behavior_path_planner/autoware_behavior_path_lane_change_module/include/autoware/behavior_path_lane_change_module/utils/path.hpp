@@ -42,6 +42,21 @@ struct Status
   double start_distance{0.0};
 };
 
+enum class CandidatePathStatus {
+  UNCHECKED = 0,
+  SAFE,
+  UNSAFE,
+  REJECTED,  // the safety check failed, and no later candidate is considered
+};
+
+// a candidate path and the result of its safety check, which may run on another thread
+struct CandidatePathEvaluation
+{
+  Path path{};
+  CandidatePathStatus status{CandidatePathStatus::UNCHECKED};
+  utils::path_safety_checker::CollisionCheckDebugMap debug_data{};
+};
+
 }  // namespace autoware::behavior_path_planner::lane_change
 
 namespace autoware::behavior_path_planner
@@ -49,5 +64,7 @@ namespace autoware::behavior_path_planner
 using LaneChangePath = lane_change::Path;
 using LaneChangePaths = std::vector<lane_change::Path>;
 using LaneChangeStatus = lane_change::Status;
+using CandidatePathEvaluation = lane_change::CandidatePathEvaluation;
+using CandidatePathStatus = lane_change::CandidatePathStatus;
 }  // namespace autoware::behavior_path_planner
 #endif  // AUTOWARE__BEHAVIOR_PATH_LANE_CHANGE_MODULE__UTILS__PATH_HPP_
@@ -35,7 +35,9 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -1282,27 +1284,37 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
 
   const auto prepare_phase_metrics = get_prepare_metrics();
 
-  candidate_paths.reserve(
-    prepare_phase_metrics.size() * lane_change_parameters_->lateral_acc_sampling_num);
-
   const bool only_tl = getStopTime() >= lane_change_parameters_->stop_time_threshold;
   const auto dist_to_next_regulatory_element =
     utils::lane_change::get_distance_to_next_regulatory_element(common_data_ptr_, only_tl, only_tl);
 
+  // The candidates are generated in the order of their priority on this thread, and the safety
+  // of each candidate is checked in a task. The deque keeps the references of the tasks valid.
+  std::deque<CandidatePathEvaluation> evaluations;
+  constexpr auto no_index = std::numeric_limits<size_t>::max();
+  // index of the first candidate that is safe or that stops the search
+  std::atomic<size_t> first_decided_index{no_index};
+
   auto check_length_diff =
     [&](const double prep_length, const double lc_length, const bool check_lc) {
-      if (candidate_paths.empty()) return true;
+      if (evaluations.empty()) return true;
 
-      const auto prep_diff = std::abs(candidate_paths.back().info.length.prepare - prep_length);
+      const auto & last_path = evaluations.back().path;
+      const auto prep_diff = std::abs(last_path.info.length.prepare - prep_length);
       if (prep_diff > lane_change_parameters_->skip_process_lon_diff_th_prepare) return true;
 
       if (!check_lc) return false;
 
-      const auto lc_diff = std::abs(candidate_paths.back().info.length.lane_changing - lc_length);
+      const auto lc_diff = std::abs(last_path.info.length.lane_changing - lc_length);
       return lc_diff > lane_change_parameters_->skip_process_lon_diff_th_lane_changing;
     };
 
+#pragma omp parallel num_threads(lane_change_parameters_->num_threads)
+#pragma omp single
   for (const auto & prep_metric : prepare_phase_metrics) {
+    // the candidates after the decided one are not needed anymore
+    if (first_decided_index.load() != no_index) break;
+
     const auto debug_print = [&](const std::string & s) {
       RCLCPP_DEBUG(
         logger_, "%s | prep_time: %.5f | lon_acc: %.5f | prep_len: %.5f", s.c_str(),
@@ -1338,6 +1350,8 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
     utils::lane_change::setPrepareVelocity(prepare_segment, current_velocity, prep_metric.velocity);
 
     for (const auto & lc_metric : lane_changing_metrics) {
+      if (first_decided_index.load() != no_index) break;
+
       const auto debug_print_lat = [&](const std::string & s) {
         RCLCPP_DEBUG(
           logger_, "%s | lc_time: %.5f | lon_acc: %.5f | lat_acc: %.5f | lc_len: %.5f", s.c_str(),
@@ -1359,24 +1373,71 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
         continue;
       }
 
-      candidate_paths.push_back(candidate_path);
-
-      try {
-        if (check_candidate_path_safety(candidate_path, target_objects)) {
-          debug_print_lat("ACCEPT!!!: it is valid and safe!");
-          return true;
+      const auto index = evaluations.size();
+      auto * evaluation = &evaluations.emplace_back();
+      evaluation->path = std::move(candidate_path);
+
+#pragma omp task firstprivate(index, evaluation) shared(first_decided_index, target_objects)
+      {
+        // skipped if a candidate with a higher priority has already decided the result
+        if (index < first_decided_index.load()) {
+          evaluate_candidate_path(*evaluation, target_objects);
+          if (evaluation->status != CandidatePathStatus::UNSAFE) {
+            auto decided_index = first_decided_index.load();
+            while (index < decided_index &&
+                   !first_decided_index.compare_exchange_weak(decided_index, index)) {
+            }
+          }
         }
-      } catch (const std::exception & e) {
-        debug_print_lat(std::string("Reject: ") + e.what());
-        return false;
       }
+    }
+  }
 
-      debug_print_lat("Reject: sampled path is not safe.");
+  // All candidates before the decided one have been checked, and the ones after it are dropped
+  // as if the candidates had been checked one by one.
+  const auto decided_index = first_decided_index.load();
+  const auto num_candidates = decided_index == no_index ? evaluations.size() : decided_index + 1;
+  candidate_paths.reserve(num_candidates);
+  for (size_t i = 0; i < num_candidates; ++i) {
+    auto & evaluation = evaluations.at(i);
+    for (auto & [uuid, debug] : evaluation.debug_data) {
+      lane_change_debug_.collision_check_objects.insert_or_assign(uuid, std::move(debug));
     }
+    candidate_paths.push_back(std::move(evaluation.path));
   }
 
-  RCLCPP_DEBUG(logger_, "No safety path found.");
-  return false;
+  if (decided_index == no_index) {
+    RCLCPP_DEBUG(logger_, "No safety path found.");
+    return false;
+  }
+  return evaluations.at(decided_index).status == CandidatePathStatus::SAFE;
+}
+
+void NormalLaneChange::evaluate_candidate_path(
+  CandidatePathEvaluation & evaluation, const lane_change::TargetObjects & target_objects) const
+{
+  const auto & info = evaluation.path.info;
+  const auto debug_print_lat = [&](const std::string & s) {
+    RCLCPP_DEBUG(
+      logger_, "%s | lc_time: %.5f | lon_acc: %.5f | lat_acc: %.5f | lc_len: %.5f", s.c_str(),
+      info.duration.lane_changing, info.longitudinal_acceleration.lane_changing,
+      info.lateral_acceleration, info.length.lane_changing);
+  };
+
+  try {
+    if (check_candidate_path_safety(evaluation.path, target_objects, evaluation.debug_data)) {
+      debug_print_lat("ACCEPT!!!: it is valid and safe!");
+      evaluation.status = CandidatePathStatus::SAFE;
+      return;
+    }
+  } catch (const std::exception & e) {
+    debug_print_lat(std::string("Reject: ") + e.what());
+    evaluation.status = CandidatePathStatus::REJECTED;
+    return;
+  }
+
+  debug_print_lat("Reject: sampled path is not safe.");
+  evaluation.status = CandidatePathStatus::UNSAFE;
 }
 
 LaneChangePath NormalLaneChange::get_candidate_path(
@@ -1426,7 +1487,8 @@ LaneChangePath NormalLaneChange::get_candidate_path(
 }
 
 bool NormalLaneChange::check_candidate_path_safety(
-  const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects) const
+  const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects,
+  CollisionCheckDebugMap & debug_data) const
 {
   const auto is_stuck = common_data_ptr_->transient_data.is_ego_stuck;
   if (utils::lane_change::has_overtaking_turn_lane_object(
@@ -1437,7 +1499,7 @@ bool NormalLaneChange::check_candidate_path_safety(
   if (
     !is_stuck && !utils::lane_change::passed_parked_objects(
                    common_data_ptr_, candidate_path, filtered_objects_.target_lane_leading,
-                   lane_change_debug_.collision_check_objects)) {
+                   debug_data)) {
     throw std::logic_error(
       "Ego is not stuck and parked vehicle exists in the target lane. Skip lane change.");
   }
@@ -1457,12 +1519,12 @@ bool NormalLaneChange::check_candidate_path_safety(
   constexpr size_t decel_sampling_num = 1;
   const auto safety_check_with_normal_rss = isLaneChangePathSafe(
     candidate_path, target_objects, common_data_ptr_->lc_param_ptr->rss_params, decel_sampling_num,
-    lane_change_debug_.collision_check_objects);
+    debug_data);
 
   if (!safety_check_with_normal_rss.is_safe && is_stuck) {
     const auto safety_check_with_stuck_rss = isLaneChangePathSafe(
       candidate_path, target_objects, common_data_ptr_->lc_param_ptr->rss_params_for_stuck,
-      decel_sampling_num, lane_change_debug_.collision_check_objects);
+      decel_sampling_num, debug_data);
     return safety_check_with_stuck_rss.is_safe;
   }
 
@@ -1862,7 +1924,7 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
   const utils::path_safety_checker::RSSparams & rss_params, const size_t deceleration_sampling_num,
   CollisionCheckDebugMap & debug_data) const
 {
-  universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  // not tracked by the time keeper, since the candidate paths are checked on the worker threads
   constexpr auto is_safe = true;
   constexpr auto is_object_behind_ego = true;
 
@@ -1930,6 +1992,8 @@ bool NormalLaneChange::has_collision_with_decel_patterns(
         *lane_change_parameters_, time_resolution);
       const auto debug_predicted_path =
         utils::path_safety_checker::convertToPredictedPath(ego_predicted_path, time_resolution);
+      utils::path_safety_checker::InterpolatedEgoPathCache ego_path_cache(
+        ego_predicted_path, bpp_param.vehicle_info);
 
       return std::any_of(objects.begin(), objects.end(), [&](const auto & obj) {
         const auto selected_rss_param =
@@ -1937,7 +2001,7 @@ bool NormalLaneChange::has_collision_with_decel_patterns(
             ? lane_change_parameters_->rss_params_for_parked
             : rss_param;
         return is_collided(
-          lane_change_path.path, obj, ego_predicted_path, selected_rss_param, debug_data);
+          lane_change_path.path, obj, ego_path_cache, selected_rss_param, debug_data);
       });
     });
 
@@ -1946,7 +2010,7 @@ bool NormalLaneChange::has_collision_with_decel_patterns(
 
 bool NormalLaneChange::is_collided(
   const PathWithLaneId & lane_change_path, const ExtendedPredictedObject & obj,
-  const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
+  utils::path_safety_checker::InterpolatedEgoPathCache & ego_path_cache,
   const RSSparams & selected_rss_param, CollisionCheckDebugMap & debug_data) const
 {
   constexpr auto is_collided{true};
@@ -1955,7 +2019,7 @@ bool NormalLaneChange::is_collided(
     return !is_collided;
   }
 
-  if (ego_predicted_path.empty()) {
+  if (ego_path_cache.predicted_ego_path().empty()) {
     return !is_collided;
   }
 
@@ -1974,13 +2038,11 @@ bool NormalLaneChange::is_collided(
   const auto obj_predicted_paths = utils::path_safety_checker::getPredictedPathFromObj(
     obj, lane_change_parameters_->use_all_predicted_path);
   const auto safety_check_max_vel = get_max_velocity_for_safety_check();
-  const auto & bpp_param = *common_data_ptr_->bpp_param_ptr;
 
   for (const auto & obj_path : obj_predicted_paths) {
     const auto collided_polygons = utils::path_safety_checker::get_collided_polygons(
-      lane_change_path, ego_predicted_path, obj, obj_path, bpp_param.vehicle_info,
-      selected_rss_param, hysteresis_factor, safety_check_max_vel,
-      collision_check_yaw_diff_threshold, current_debug_data.second);
+      lane_change_path, ego_path_cache, obj, obj_path, selected_rss_param, hysteresis_factor,
+      safety_check_max_vel, collision_check_yaw_diff_threshold, current_debug_data.second);
 
     if (collided_polygons.empty()) {
       utils::path_safety_checker::updateCollisionCheckDebugMap(
@@ -2009,7 +2071,6 @@ bool NormalLaneChange::is_collided(
 
 double NormalLaneChange::get_max_velocity_for_safety_check() const
 {
-  universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
   const auto external_velocity_limit_ptr = planner_data_->external_limit_max_velocity;
   if (external_velocity_limit_ptr) {
     return std::min(
@@ -47,6 +47,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -126,6 +127,13 @@ private:
   rclcpp::Publisher<RerouteAvailability>::SharedPtr reroute_availability_publisher_;
   rclcpp::TimerBase::SharedPtr timer_;
 
+  // run as soon as the predicted objects are received, so that the path is not delayed by up to a
+  // period after the perception output, and by the timer only while they are not received
+  bool trigger_on_perception_{false};
+  rclcpp::Subscription<PredictedObjects>::SharedPtr perception_trigger_subscriber_;
+  rclcpp::Duration planning_period_{0, 0};
+  std::optional<rclcpp::Time> last_triggered_run_time_;
+
   std::map<std::string, rclcpp::Publisher<Path>::SharedPtr> path_candidate_publishers_;
   std::map<std::string, rclcpp::Publisher<Path>::SharedPtr> path_reference_publishers_;
 
@@ -160,6 +168,7 @@ private:
   void onLateralOffset(const LateralOffset::ConstSharedPtr msg);
   void on_external_velocity_limiter(
     const tier4_planning_msgs::msg::VelocityLimit::ConstSharedPtr msg);
+  void onTimer();
 
   SetParametersResult onSetParam(const std::vector<rclcpp::Parameter> & parameters);
 
@@ -18,6 +18,7 @@
 #include "autoware/behavior_path_planner_common/interface/scene_module_interface.hpp"
 #include "autoware/behavior_path_planner_common/interface/scene_module_manager_interface.hpp"
 #include "autoware/behavior_path_planner_common/interface/scene_module_visitor.hpp"
+#include "autoware/behavior_path_planner_common/utils/path_utils.hpp"
 #include "autoware/universe_utils/ros/debug_publisher.hpp"
 #include "autoware/universe_utils/system/stop_watch.hpp"
 
@@ -32,6 +33,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -129,10 +131,12 @@ class SubPlannerManager
 public:
   explicit SubPlannerManager(
     std::shared_ptr<std::optional<lanelet::ConstLanelet>> lanelet,
-    std::unordered_map<std::string, double> & processing_time, ModuleUpdateInfo & debug_info)
+    std::unordered_map<std::string, double> & processing_time, ModuleUpdateInfo & debug_info,
+    const int num_threads = 1)
   : current_route_lanelet_(lanelet),
     processing_time_(std::ref(processing_time)),
-    debug_info_(std::ref(debug_info))
+    debug_info_(std::ref(debug_info)),
+    num_threads_(std::max(num_threads, 1))
   {
   }
 
@@ -311,6 +315,8 @@ private:
 
   /**
    * @brief checks whether a path of trajectory has forward driving direction
+   * @details the executable modules all start from previous_module_output, so they are run
+   * concurrently on num_threads_ threads and their results are merged in priority order.
    * @param modules that make execution request.
    * @param planner data.
    * @param decided (=approved) path.
@@ -362,6 +368,9 @@ private:
   std::vector<SceneModulePtr> candidate_module_ptrs_;
 
   ModuleUpdateInfo & debug_info_;
+
+  // number of threads to run the simultaneously executable candidate modules concurrently
+  int num_threads_{1};
 };
 
 class PlannerManager
@@ -584,6 +593,9 @@ private:
   // NOTE: current_route_lanelet_ is shared with SubPlannerManagers
   std::shared_ptr<std::optional<lanelet::ConstLanelet>> current_route_lanelet_;
 
+  // centerline path of the previous cycles that the root reference path is cropped from
+  mutable std::optional<utils::ReferencePathBuffer> reference_path_buffer_;
+
   // NOTE: SubPlannerManager::manager_ptrs_ and manager_ptrs_ share the same SceneModuleManager
   // instance as shared_ptr
   std::vector<SubPlannerManager> planner_manager_slots_;
@@ -605,6 +617,8 @@ private:
   ModuleUpdateInfo debug_info_;
 
   std::shared_ptr<SceneModuleVisitor> debug_msg_ptr_;
+
+  int num_threads_for_candidate_modules_{1};
 };
 }  // namespace autoware::behavior_path_planner
 
@@ -120,8 +120,17 @@ BehaviorPathPlannerNode::BehaviorPathPlannerNode(const rclcpp::NodeOptions & nod
   {
     const auto planning_hz = declare_parameter<double>("planning_hz");
     const auto period_ns = rclcpp::Rate(planning_hz).period();
+    planning_period_ = rclcpp::Duration(period_ns);
     timer_ = rclcpp::create_timer(
-      this, get_clock(), period_ns, std::bind(&BehaviorPathPlannerNode::run, this));
+      this, get_clock(), period_ns, std::bind(&BehaviorPathPlannerNode::onTimer, this));
+  }
+
+  // NOTE: the trigger is in the default callback group with the timer, so they never run at once
+  trigger_on_perception_ = declare_parameter<bool>("trigger_on_perception");
+  if (trigger_on_perception_) {
+    perception_trigger_subscriber_ = create_subscription<PredictedObjects>(
+      "~/input/perception", 1,
+      std::bind(&BehaviorPathPlannerNode::onPerception, this, std::placeholders::_1));
   }
 
   logger_configure_ = std::make_unique<autoware::universe_utils::LoggerLevelConfigure>(this);
@@ -153,6 +162,22 @@ std::vector<std::string> BehaviorPathPlannerNode::getRunningModules()
   return running_modules;
 }
 
+void BehaviorPathPlannerNode::onPerception(const PredictedObjects::ConstSharedPtr msg)
+{
+  planner_data_->dynamic_object = msg;
+  last_triggered_run_time_ = now();
+  run();
+}
+
+void BehaviorPathPlannerNode::onTimer()
+{
+  // the timer keeps planning only while the trigger does not arrive for a period
+  if (last_triggered_run_time_ && now() - *last_triggered_run_time_ < planning_period_) {
+    return;
+  }
+  run();
+}
+
 void BehaviorPathPlannerNode::takeData()
 {
   // route
@@ -196,8 +221,8 @@ void BehaviorPathPlannerNode::takeData()
       current_scenario_ = msg;
     }
   }
-  // perception
-  {
+  // perception, which the trigger sets instead when running on the predicted objects
+  if (!trigger_on_perception_) {
     const auto msg = perception_subscriber_.takeData();
     if (msg) {
       planner_data_->dynamic_object = msg;
@@ -363,6 +388,18 @@ void BehaviorPathPlannerNode::run()
     !planner_manager_->hasPossibleRerouteApprovedModules(planner_data_))
     planner_manager_->resetCurrentRouteLanelet(planner_data_);
 
+  // assign the objects to the lanelets once for all modules, only when the objects or map changed
+  {
+    using utils::path_safety_checker::ObjectLaneletIndex;
+    const auto & objects = planner_data_->dynamic_object;
+    const auto lanelet_map = planner_data_->route_handler->getLaneletMapPtr();
+    const auto & index = planner_data_->object_lanelet_index;
+    if (!index || !index->isBuiltFrom(objects, lanelet_map)) {
+      planner_data_->object_lanelet_index =
+        std::make_shared<const ObjectLaneletIndex>(objects, lanelet_map);
+    }
+  }
+
   // run behavior planner
   const auto output = planner_manager_->run(planner_data_);
 
@@ -25,8 +25,11 @@
 
 #include <boost/scope_exit.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace autoware::behavior_path_planner
 {
@@ -37,6 +40,8 @@ PlannerManager::PlannerManager(rclcpp::Node & node)
   logger_(node.get_logger().get_child("planner_manager")),
   clock_(*node.get_clock())
 {
+  num_threads_for_candidate_modules_ =
+    std::max(static_cast<int>(node.declare_parameter<int>("num_threads_for_candidate_modules")), 1);
   current_route_lanelet_ = std::make_shared<std::optional<lanelet::ConstLanelet>>(std::nullopt);
   processing_time_.emplace("total_time", 0.0);
   debug_publisher_ptr_ = std::make_unique<DebugPublisher>(&node, "~/debug");
@@ -75,7 +80,8 @@ void PlannerManager::configureModuleSlot(
   }
 
   for (const auto & slot : slot_configuration) {
-    SubPlannerManager sub_manager(current_route_lanelet_, processing_time_, debug_info_);
+    SubPlannerManager sub_manager(
+      current_route_lanelet_, processing_time_, debug_info_, num_threads_for_candidate_modules_);
     for (const auto & module_name : slot) {
       if (const auto it = registered_modules.find(module_name); it != registered_modules.end()) {
         sub_manager.addSceneModuleManager(it->second);
@@ -265,7 +271,8 @@ void PlannerManager::updateCurrentRouteLanelet(
 BehaviorModuleOutput PlannerManager::getReferencePath(
   const std::shared_ptr<PlannerData> & data) const
 {
-  const auto reference_path = utils::getReferencePath(current_route_lanelet_->value(), data);
+  const auto reference_path =
+    utils::getReferencePath(current_route_lanelet_->value(), data, reference_path_buffer_);
   publishDebugRootReferencePath(reference_path);
   return reference_path;
 }
@@ -657,8 +664,27 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> SubPlannerManager::runRequestMod
       manager_ptr->registerNewModule(
         std::weak_ptr<SceneModuleInterface>(module_ptr), previous_module_output);
     }
+  }
+
+  // the executable modules do not depend on each other's output, so they are run concurrently.
+  // modules of the same manager share the manager's state (e.g. RTC interface, processing time),
+  // so they are run sequentially in that case.
+  const bool is_parallel_executable = [&]() {
+    std::unordered_set<std::string> names;
+    return std::all_of(executable_modules.begin(), executable_modules.end(), [&](const auto & m) {
+      return names.insert(m->name()).second;
+    });
+  }();
+  std::vector<BehaviorModuleOutput> outputs(executable_modules.size());
+  const auto num_threads =
+    std::min(num_threads_, std::max(static_cast<int>(executable_modules.size()), 1));
+#pragma omp parallel for num_threads(num_threads) if (is_parallel_executable) schedule(dynamic)
+  for (size_t i = 0; i < executable_modules.size(); ++i) {
+    outputs.at(i) = run(executable_modules.at(i), data, previous_module_output);
+  }
 
-    results.emplace(module_ptr->name(), run(module_ptr, data, previous_module_output));
+  for (size_t i = 0; i < executable_modules.size(); ++i) {
+    results.emplace(executable_modules.at(i)->name(), std::move(outputs.at(i)));
   }
 
   /**
@@ -0,0 +1,153 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_path_planner/behavior_path_planner_node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_planning_test_manager/autoware_planning_benchmark_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+
+#include <autoware_adapi_v1_msgs/msg/operation_mode_state.hpp>
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
+#include <tier4_planning_msgs/msg/lateral_offset.hpp>
+#include <tier4_planning_msgs/msg/path_with_lane_id.hpp>
+#include <tier4_planning_msgs/msg/scenario.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+using autoware::behavior_path_planner::BehaviorPathPlannerNode;
+using autoware::planning_test_manager::PlanningBenchmarkManager;
+using autoware_adapi_v1_msgs::msg::OperationModeState;
+using autoware_perception_msgs::msg::PredictedObjects;
+using geometry_msgs::msg::AccelWithCovarianceStamped;
+using tier4_planning_msgs::msg::LateralOffset;
+using tier4_planning_msgs::msg::PathWithLaneId;
+using tier4_planning_msgs::msg::Scenario;
+
+// the planner without any module if the plugin name is empty
+std::shared_ptr<BehaviorPathPlannerNode> generateNode(
+  const std::string & plugin_name, const std::string & module)
+{
+  auto node_options = rclcpp::NodeOptions{};
+  const auto autoware_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("autoware_test_utils");
+  const auto behavior_path_planner_dir =
+    ament_index_cpp::get_package_share_directory("autoware_behavior_path_planner");
+
+  std::vector<std::string> params_files{
+    autoware_test_utils_dir + "/config/test_common.param.yaml",
+    autoware_test_utils_dir + "/config/test_nearest_search.param.yaml",
+    autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+    behavior_path_planner_dir + "/config/behavior_path_planner.param.yaml",
+    behavior_path_planner_dir + "/config/drivable_area_expansion.param.yaml",
+    behavior_path_planner_dir + "/config/scene_module_manager.param.yaml"};
+  std::vector<std::string> module_names;
+  if (!plugin_name.empty()) {
+    // the modules depend on this package, so they are looked up only when installed
+    const auto package_name = "autoware_behavior_path_" + module + "_module";
+    params_files.push_back(
+      ament_index_cpp::get_package_share_directory(package_name) + "/config/" + module +
+      ".param.yaml");
+    module_names.push_back(plugin_name);
+  }
+
+  // the planner runs by its own timer, whose period is shortened not to wait for the next cycle
+  std::vector<rclcpp::Parameter> params;
+  params.emplace_back("launch_modules", module_names);
+  params.emplace_back("planning_hz", 1000.0);
+  node_options.parameter_overrides(params);
+  autoware::test_utils::updateNodeOptions(node_options, params_files);
+
+  return std::make_shared<BehaviorPathPlannerNode>(node_options);
+}
+
+static void BM_BehaviorPathPlanner(
+  benchmark::State & state, const std::string & plugin_name, const std::string & module)
+{
+  rclcpp::init(0, nullptr);
+  {
+    PlanningBenchmarkManager benchmark_manager;
+    std::shared_ptr<BehaviorPathPlannerNode> test_target_node;
+    try {
+      test_target_node = generateNode(plugin_name, module);
+    } catch (const std::exception & e) {
+      state.SkipWithError(e.what());
+    }
+
+    if (test_target_node) {
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/odometry",
+        benchmark_manager.getSnapshotField(
+          "self_odometry", autoware::test_utils::makeInitialPose()));
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/accel",
+        benchmark_manager.getSnapshotField("self_acceleration", AccelWithCovarianceStamped{}));
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/perception",
+        benchmark_manager.getSnapshotField("dynamic_object", PredictedObjects{}));
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/occupancy_grid_map",
+        autoware::test_utils::makeCostMapMsg());
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/scenario",
+        autoware::test_utils::makeScenarioMsg(Scenario::LANEDRIVING));
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/vector_map", benchmark_manager.getMap());
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/costmap",
+        autoware::test_utils::makeCostMapMsg());
+      benchmark_manager.publish(
+        test_target_node, "system/operation_mode/state",
+        benchmark_manager.getSnapshotField("operation_mode", OperationModeState{}));
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/lateral_offset", LateralOffset{});
+      benchmark_manager.publish(
+        test_target_node, "behavior_path_planner/input/route",
+        benchmark_manager.getSnapshotField(
+          "route", autoware::test_utils::makeBehaviorNormalRoute()));
+
+      benchmark_manager.benchmarkWithTimer<PathWithLaneId>(
+        state, test_target_node, "behavior_path_planner/output/path");
+    }
+  }
+  rclcpp::shutdown();
+}
+
+// the planner without any module, and with each module
+BENCHMARK_CAPTURE(BM_BehaviorPathPlanner, none, std::string(), std::string())
+  ->UseManualTime()
+  ->Iterations(100)
+  ->Unit(benchmark::kMillisecond);
+
+#define BENCHMARK_BEHAVIOR_PATH_MODULE(plugin, module)                             \
+  BENCHMARK_CAPTURE(                                                               \
+    BM_BehaviorPathPlanner, plugin,                                                \
+    std::string("autoware::behavior_path_planner::" #plugin), std::string(module)) \
+    ->UseManualTime()                                                              \
+    ->Iterations(100)                                                              \
+    ->Unit(benchmark::kMillisecond)
+
+BENCHMARK_BEHAVIOR_PATH_MODULE(DynamicObstacleAvoidanceModuleManager, "dynamic_obstacle_avoidance");
+BENCHMARK_BEHAVIOR_PATH_MODULE(GoalPlannerModuleManager, "goal_planner");
+BENCHMARK_BEHAVIOR_PATH_MODULE(LaneChangeLeftModuleManager, "lane_change");
+BENCHMARK_BEHAVIOR_PATH_MODULE(LaneChangeRightModuleManager, "lane_change");
+BENCHMARK_BEHAVIOR_PATH_MODULE(SideShiftModuleManager, "side_shift");
+BENCHMARK_BEHAVIOR_PATH_MODULE(StartPlannerModuleManager, "start_planner");
+BENCHMARK_BEHAVIOR_PATH_MODULE(StaticObstacleAvoidanceModuleManager, "static_obstacle_avoidance");
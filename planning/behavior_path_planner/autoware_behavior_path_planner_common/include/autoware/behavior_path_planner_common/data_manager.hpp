@@ -17,7 +17,9 @@
 
 #include "autoware/behavior_path_planner_common/parameters.hpp"
 #include "autoware/behavior_path_planner_common/turn_signal_decider.hpp"
+#include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/map_utils.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/parameters.hpp"
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/object_lanelet_index.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 
 #include <autoware/route_handler/route_handler.hpp>
@@ -165,9 +167,13 @@ struct PlannerData
   autoware::behavior_path_planner::drivable_area_expansion::DrivableAreaExpansionParameters
     drivable_area_expansion_parameters{};
   VelocityLimit::ConstSharedPtr external_limit_max_velocity{};
+  // lanelets of the map that each object of dynamic_object is located on, built by the node
+  std::shared_ptr<const utils::path_safety_checker::ObjectLaneletIndex> object_lanelet_index{};
 
   mutable std::vector<geometry_msgs::msg::Pose> drivable_area_expansion_prev_path_poses{};
   mutable std::vector<double> drivable_area_expansion_prev_curvatures{};
+  mutable autoware::behavior_path_planner::drivable_area_expansion::UncrossableSegmentsCache
+    drivable_area_expansion_uncrossable_segments_cache{};
   mutable TurnSignalDecider turn_signal_decider;
 
   void init_parameters(rclcpp::Node & node)
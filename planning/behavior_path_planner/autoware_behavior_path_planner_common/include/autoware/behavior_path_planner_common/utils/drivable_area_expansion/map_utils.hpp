@@ -20,11 +20,21 @@
 
 #include <lanelet2_core/LaneletMap.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace autoware::behavior_path_planner::drivable_area_expansion
 {
+/// @brief uncrossable segments of the whole lanelet map, reused across cycles while the map and the
+/// linestring types do not change
+struct UncrossableSegmentsCache
+{
+  std::weak_ptr<const lanelet::LaneletMap> lanelet_map;
+  std::vector<std::string> linestring_types;
+  SegmentRtree segments;
+};
+
 /// @brief Extract uncrossable segments from the lanelet map that are in range of ego
 /// @param[in] lanelet_map lanelet map
 /// @param[in] ego_point point of the current ego position
@@ -34,6 +44,18 @@ SegmentRtree extract_uncrossable_segments(
   const lanelet::LaneletMap & lanelet_map, const Point & ego_point,
   const DrivableAreaExpansionParameters & params);
 
+/// @brief Extract uncrossable segments from the lanelet map that are in range of ego
+/// @details the segments of the whole map are extracted only when the map or the linestring types
+/// changed, then the segments in range of ego are queried from the cached rtree
+/// @param[in] lanelet_map lanelet map
+/// @param[in] ego_point point of the current ego position
+/// @param[in] params parameters with linestring types that cannot be crossed and maximum range
+/// @param[inout] cache uncrossable segments of the whole map extracted in a previous cycle
+/// @return the uncrossable segments stored in a rtree
+SegmentRtree extract_uncrossable_segments(
+  const std::shared_ptr<const lanelet::LaneletMap> & lanelet_map, const Point & ego_point,
+  const DrivableAreaExpansionParameters & params, UncrossableSegmentsCache & cache);
+
 /// @brief Determine if the given linestring has one of the given types
 /// @param[in] ls linestring to check
 /// @param[in] types type strings to check
@@ -142,6 +142,12 @@ protected:
    */
   void compute_collision_indexes(int theta_index, std::vector<IndexXY> & indexes);
 
+  /**
+   * @brief Computes the chessboard distance from each cell to the nearest obstacle, so that the
+   * footprint check is skipped for the poses far from the obstacles.
+   */
+  void compute_obstacle_distance_table();
+
   [[nodiscard]] inline bool is_out_of_range(const IndexXYT & index) const
   {
     if (index.x < 0 || static_cast<int>(costmap_.info.width) <= index.x) {
@@ -168,8 +174,14 @@ protected:
   // collision indexes cache
   std::vector<std::vector<IndexXY>> coll_indexes_table_;
 
+  // max chessboard distance [cell] from the base to the collision indexes for each theta
+  std::vector<int> coll_indexes_radius_table_;
+
   // is_obstacle's table
   std::vector<std::vector<bool>> is_obstacle_table_;
+
+  // chessboard distance [cell] from each cell to the nearest obstacle, in row-major order
+  std::vector<int> obstacle_distance_table_;
 };
 }  // namespace autoware::behavior_path_planner
 
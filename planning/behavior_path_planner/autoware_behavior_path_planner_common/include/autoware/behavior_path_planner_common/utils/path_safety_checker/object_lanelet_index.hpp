@@ -0,0 +1,86 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__OBJECT_LANELET_INDEX_HPP_  // NOLINT
+#define AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__OBJECT_LANELET_INDEX_HPP_  // NOLINT
+
+#include <autoware_perception_msgs/msg/predicted_object.hpp>
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::behavior_path_planner::utils::path_safety_checker
+{
+
+using autoware_perception_msgs::msg::PredictedObject;
+using autoware_perception_msgs::msg::PredictedObjects;
+
+/**
+ * @brief lanelets of the map that each predicted object is located on, computed once per cycle
+ *
+ * The candidate lanelets of an object are searched with the R-tree of the lanelet layer, so that
+ * the modules only look up the result of the geometric test instead of repeating it for every
+ * object and every lanelet of interest. The result is not available, i.e. std::nullopt, if the
+ * object or the lanelet does not come from the objects and the map that the index is built from.
+ */
+class ObjectLaneletIndex
+{
+public:
+  ObjectLaneletIndex(
+    const PredictedObjects::ConstSharedPtr & objects,
+    const std::shared_ptr<const lanelet::LaneletMap> & lanelet_map);
+
+  /** @brief true if the index is built from the same objects message and the same map */
+  bool isBuiltFrom(
+    const PredictedObjects::ConstSharedPtr & objects,
+    const std::shared_ptr<const lanelet::LaneletMap> & lanelet_map) const;
+
+  /** @brief whether the centroid of the object is within the lanelet */
+  std::optional<bool> isCentroidWithinLanelet(
+    const PredictedObject & object, const lanelet::ConstLanelet & lanelet) const;
+
+  /** @brief whether the polygon of the object overlaps with the lanelet */
+  std::optional<bool> isPolygonOverlapLanelet(
+    const PredictedObject & object, const lanelet::ConstLanelet & lanelet) const;
+
+private:
+  struct Entry
+  {
+    geometry_msgs::msg::Pose pose;
+    autoware_perception_msgs::msg::Shape shape;
+    // sorted ids of the lanelets
+    std::vector<lanelet::Id> centroid_lanelet_ids;
+    std::vector<lanelet::Id> overlap_lanelet_ids;
+  };
+
+  const Entry * findEntry(
+    const PredictedObject & object, const lanelet::ConstLanelet & lanelet) const;
+
+  PredictedObjects::ConstSharedPtr objects_;
+  std::weak_ptr<const lanelet::LaneletMap> lanelet_map_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace autoware::behavior_path_planner::utils::path_safety_checker
+
+// clang-format off
+#endif  // AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__OBJECT_LANELET_INDEX_HPP_  // NOLINT
+// clang-format on
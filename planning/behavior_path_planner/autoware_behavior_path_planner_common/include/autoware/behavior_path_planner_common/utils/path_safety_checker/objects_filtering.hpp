@@ -16,6 +16,7 @@
 #define AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__OBJECTS_FILTERING_HPP_  // NOLINT
 
 #include "autoware/behavior_path_planner_common/data_manager.hpp"
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/object_lanelet_index.hpp"
 #include "autoware/behavior_path_planner_common/utils/path_safety_checker/path_safety_checker_parameters.hpp"
 
 #include <autoware_perception_msgs/msg/predicted_object.hpp>
@@ -105,6 +106,35 @@ bool isPolygonOverlapLanelet(
   const PredictedObject & object, const lanelet::ConstLanelet & lanelet,
   const double yaw_threshold);
 
+/**
+ * @brief Filters objects based on object centroid position, looking up the result of the
+ * geometric test in the index of the planner data if it is available for the object and lanelet.
+ *
+ * @param object The predicted object to filter.
+ * @param lanelet
+ * @param yaw_threshold
+ * @param object_lanelet_index The index of the planner data, can be nullptr.
+ * @return result.
+ */
+bool isCentroidWithinLanelet(
+  const PredictedObject & object, const lanelet::ConstLanelet & lanelet, const double yaw_threshold,
+  const std::shared_ptr<const ObjectLaneletIndex> & object_lanelet_index);
+
+/**
+ * @brief Filters objects based on object polygon overlapping with lanelet, looking up the result
+ * of the geometric test in the index of the planner data if it is available for the object and
+ * lanelet.
+ *
+ * @param object The predicted object to filter.
+ * @param lanelet
+ * @param yaw_threshold
+ * @param object_lanelet_index The index of the planner data, can be nullptr.
+ * @return result.
+ */
+bool isPolygonOverlapLanelet(
+  const PredictedObject & object, const lanelet::ConstLanelet & lanelet, const double yaw_threshold,
+  const std::shared_ptr<const ObjectLaneletIndex> & object_lanelet_index);
+
 bool isPolygonOverlapLanelet(
   const PredictedObject & object, const autoware::universe_utils::Polygon2d & lanelet_polygon);
 
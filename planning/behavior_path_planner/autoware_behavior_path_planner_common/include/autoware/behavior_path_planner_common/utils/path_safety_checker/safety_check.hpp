@@ -27,6 +27,8 @@
 #include <geometry_msgs/msg/twist.hpp>
 
 #include <cmath>
+#include <map>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -116,6 +118,34 @@ get_interpolated_pose_with_velocity_and_polygon_stamped(
   const std::vector<PoseWithVelocityStamped> & pred_path, const double current_time,
   const Shape & shape);
 
+/**
+ * @brief Ego poses, velocities and footprints interpolated from the ego predicted path.
+ *        They are computed once per time and shared by all objects, since the predicted paths of
+ *        the objects are sampled at the same times.
+ */
+class InterpolatedEgoPathCache
+{
+public:
+  InterpolatedEgoPathCache(
+    std::vector<PoseWithVelocityStamped> predicted_ego_path, const VehicleInfo & vehicle_info);
+
+  const std::vector<PoseWithVelocityStamped> & predicted_ego_path() const
+  {
+    return predicted_ego_path_;
+  }
+  const VehicleInfo & vehicle_info() const { return vehicle_info_; }
+
+  /**
+   * @brief Same as get_interpolated_pose_with_velocity_and_polygon_stamped() for the ego path.
+   */
+  const std::optional<PoseWithVelocityAndPolygonStamped> & get(const double time);
+
+private:
+  std::vector<PoseWithVelocityStamped> predicted_ego_path_;
+  VehicleInfo vehicle_info_;
+  std::map<double, std::optional<PoseWithVelocityAndPolygonStamped>> interpolated_data_;
+};
+
 template <typename T, typename F>
 std::vector<T> filterPredictedPathByTimeHorizon(
   const std::vector<T> & path, const double time_horizon, const F & interpolateFunc);
@@ -182,6 +212,29 @@ std::vector<Polygon2d> get_collided_polygons(
   const RSSparams & rss_parameters, const double hysteresis_factor, const double max_velocity_limit,
   const double yaw_difference_th, CollisionCheckDebug & debug);
 
+/**
+ * @brief Checks if the "rectangle" extended polygons of the ego and the object can overlap, by
+ *        comparing the distance between their poses with the radii of the circles that contain
+ *        the polygons for the largest RSS distance.
+ * @return false if the polygons cannot overlap.
+ */
+bool canCollideWithExtendedPolygon(
+  const Pose & ego_pose, const Pose & obj_pose, const Polygon2d & obj_polygon,
+  const double ego_velocity, const double object_velocity, const VehicleInfo & vehicle_info,
+  const RSSparams & rss_parameters, const double hysteresis_factor);
+
+/**
+ * @brief Same as above, with the interpolated ego path shared by the objects.
+ *        The time steps that cannot collide are skipped by comparing the bounding circles of the
+ *        ego and the object before creating the extended polygons.
+ */
+std::vector<Polygon2d> get_collided_polygons(
+  const PathWithLaneId & planned_path, InterpolatedEgoPathCache & ego_path_cache,
+  const ExtendedPredictedObject & target_object,
+  const PredictedPathWithPolygon & target_object_path, const RSSparams & rss_parameters,
+  const double hysteresis_factor, const double max_velocity_limit, const double yaw_difference_th,
+  CollisionCheckDebug & debug);
+
 bool checkPolygonsIntersects(
   const std::vector<Polygon2d> & polys_1, const std::vector<Polygon2d> & polys_2);
 bool checkSafetyWithIntegralPredictedPolygon(
@@ -141,6 +141,11 @@ private:
   // The reference path along which the shift will be performed.
   PathWithLaneId reference_path_;
 
+  // Arc length and lateral unit vector (-sin(yaw), cos(yaw)) at each point of reference_path_.
+  std::vector<double> reference_arclength_;
+  std::vector<double> lateral_direction_x_;
+  std::vector<double> lateral_direction_y_;
+
   // Shift points used for shifted-path generation.
   ShiftLineArray shift_lines_;
 
@@ -183,17 +188,24 @@ private:
   void sortShiftLinesAlongPath(ShiftLineArray & shift_lines) const;
 
   /**
-   * @brief Generate shifted path from reference_path_ and shift_lines_ with linear shifting.
+   * @brief Calculate shift length of reference_path_ points from shift_lines_ with linear shifting.
    */
-  void applyLinearShifter(ShiftedPath * shifted_path) const;
+  void applyLinearShifter(std::vector<double> & shift_length) const;
 
   /**
-   * @brief Generate shifted path from reference_path_ and shift_lines_ with spline_based shifting.
+   * @brief Calculate shift length of reference_path_ points from shift_lines_ with spline_based
+   *        shifting.
    * @details Calculate the shift so that the horizontal jerk remains constant. This is achieved by
    *          dividing the shift interval into four parts and apply a cubic spline to them.
    *          The resultant shifting shape is closed to the Clothoid curve.
    */
-  void applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const;
+  void applySplineShifter(std::vector<double> & shift_length, const bool offset_back) const;
+
+  /**
+   * @brief Move the points of the shifted path laterally by the shift length added by generate().
+   */
+  void applyLateralOffsets(
+    ShiftedPath * shifted_path, const std::vector<double> & initial_shift_length) const;
 
   ////////////////////////////////////////
   // Helper Functions
@@ -204,9 +216,7 @@ private:
    */
   bool checkShiftLinesAlignment(const ShiftLineArray & shift_lines) const;
 
-  static void addLateralOffsetOnIndexPoint(ShiftedPath * path, double offset, size_t index);
-
-  static void shiftBaseLength(ShiftedPath * path, double offset);
+  static void shiftBaseLength(std::vector<double> & shift_length, double offset);
 
   void setBaseOffset(const double val)
   {
@@ -30,6 +30,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -144,10 +145,40 @@ PathWithLaneId calcCenterLinePath(
  */
 PathWithLaneId combinePath(const PathWithLaneId & path1, const PathWithLaneId & path2);
 
+/**
+ * @brief centerline path of the route around ego that is kept across cycles.
+ * @details the path is longer than forward_path_length, so that the reference path is cropped from
+ * it while ego moves along the lanes of the path. it is rebuilt on reroute, on map change, when ego
+ * leaves its lanes and when its remaining length gets short.
+ */
+struct ReferencePathBuffer
+{
+  PathWithLaneId path;
+  UUID route_id;
+  std::weak_ptr<const lanelet::LaneletMap> lanelet_map;
+  // the path is not extended anymore, e.g. because it starts at the beginning of the route
+  bool is_backward_end{false};
+  // the path is not extended anymore, e.g. because it ends at the goal
+  bool is_forward_end{false};
+};
+
 BehaviorModuleOutput getReferencePath(
   const lanelet::ConstLanelet & current_lane,
   const std::shared_ptr<const PlannerData> & planner_data);
 
+/**
+ * @brief get the reference path by cropping the buffered centerline path around ego.
+ * @param [in] current_lane the lane where ego is.
+ * @param [in] planner_data planner data.
+ * @param [inout] reference_path_buffer the centerline path of the previous cycles, which is rebuilt
+ * when it is not valid anymore.
+ * @return the reference path and its drivable lanes.
+ */
+BehaviorModuleOutput getReferencePath(
+  const lanelet::ConstLanelet & current_lane,
+  const std::shared_ptr<const PlannerData> & planner_data,
+  std::optional<ReferencePathBuffer> & reference_path_buffer);
+
 BehaviorModuleOutput createGoalAroundPath(const std::shared_ptr<const PlannerData> & planner_data);
 
 }  // namespace autoware::behavior_path_planner::utils
@@ -416,7 +416,8 @@ void expand_drivable_area(
   const auto & params = planner_data->drivable_area_expansion_parameters;
   const auto & route_handler = *planner_data->route_handler;
   const auto uncrossable_segments = extract_uncrossable_segments(
-    *route_handler.getLaneletMapPtr(), planner_data->self_odometry->pose.pose.position, params);
+    route_handler.getLaneletMapPtr(), planner_data->self_odometry->pose.pose.position, params,
+    planner_data->drivable_area_expansion_uncrossable_segments_cache);
   const auto uncrossable_polygons = create_object_footprints(*planner_data->dynamic_object, params);
   const auto preprocessing_ms = stop_watch.toc("preprocessing");
   stop_watch.tic("crop");
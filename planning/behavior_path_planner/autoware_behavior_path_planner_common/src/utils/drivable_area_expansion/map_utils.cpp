@@ -20,29 +20,76 @@
 #include <lanelet2_core/primitives/LineString.h>
 
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace autoware::behavior_path_planner::drivable_area_expansion
 {
-SegmentRtree extract_uncrossable_segments(
-  const lanelet::LaneletMap & lanelet_map, const Point & ego_point,
-  const DrivableAreaExpansionParameters & params)
+namespace
 {
-  SegmentRtree uncrossable_segments_in_range;
+std::vector<Segment2d> extract_all_uncrossable_segments(
+  const lanelet::LaneletMap & lanelet_map, const std::vector<std::string> & linestring_types)
+{
+  std::vector<Segment2d> uncrossable_segments;
   LineString2d line;
-  const auto ego_p = Point2d{ego_point.x, ego_point.y};
   for (const auto & ls : lanelet_map.lineStringLayer) {
-    if (has_types(ls, params.avoid_linestring_types)) {
+    if (has_types(ls, linestring_types)) {
       line.clear();
       for (const auto & p : ls) line.push_back(Point2d{p.x(), p.y()});
       for (auto segment_idx = 0LU; segment_idx + 1 < line.size(); ++segment_idx) {
-        Segment2d segment = {line[segment_idx], line[segment_idx + 1]};
-        if (boost::geometry::distance(segment, ego_p) < params.max_path_arc_length) {
-          uncrossable_segments_in_range.insert(segment);
-        }
+        uncrossable_segments.emplace_back(line[segment_idx], line[segment_idx + 1]);
       }
     }
   }
-  return uncrossable_segments_in_range;
+  return uncrossable_segments;
+}
+}  // namespace
+
+SegmentRtree extract_uncrossable_segments(
+  const lanelet::LaneletMap & lanelet_map, const Point & ego_point,
+  const DrivableAreaExpansionParameters & params)
+{
+  std::vector<Segment2d> uncrossable_segments_in_range;
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  for (const auto & segment :
+       extract_all_uncrossable_segments(lanelet_map, params.avoid_linestring_types)) {
+    if (boost::geometry::distance(segment, ego_p) < params.max_path_arc_length) {
+      uncrossable_segments_in_range.push_back(segment);
+    }
+  }
+  return SegmentRtree(uncrossable_segments_in_range.begin(), uncrossable_segments_in_range.end());
+}
+
+SegmentRtree extract_uncrossable_segments(
+  const std::shared_ptr<const lanelet::LaneletMap> & lanelet_map, const Point & ego_point,
+  const DrivableAreaExpansionParameters & params, UncrossableSegmentsCache & cache)
+{
+  if (!lanelet_map) return {};
+  if (
+    cache.lanelet_map.lock() != lanelet_map ||
+    cache.linestring_types != params.avoid_linestring_types) {
+    const auto segments =
+      extract_all_uncrossable_segments(*lanelet_map, params.avoid_linestring_types);
+    cache.segments = SegmentRtree(segments.begin(), segments.end());
+    cache.lanelet_map = lanelet_map;
+    cache.linestring_types = params.avoid_linestring_types;
+  }
+
+  if (params.max_path_arc_length <= 0.0) return {};
+  std::vector<Segment2d> uncrossable_segments_in_range;
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  const auto range = params.max_path_arc_length;
+  const Box2d query_box{
+    Point2d{ego_p.x() - range, ego_p.y() - range}, Point2d{ego_p.x() + range, ego_p.y() + range}};
+  cache.segments.query(
+    boost::geometry::index::intersects(query_box) &&
+      boost::geometry::index::satisfies([&](const Segment2d & segment) {
+        return boost::geometry::distance(segment, ego_p) < range;
+      }),
+    std::back_inserter(uncrossable_segments_in_range));
+  return SegmentRtree(uncrossable_segments_in_range.begin(), uncrossable_segments_in_range.end());
 }
 
 bool has_types(const lanelet::ConstLineString3d & ls, const std::vector<std::string> & types)
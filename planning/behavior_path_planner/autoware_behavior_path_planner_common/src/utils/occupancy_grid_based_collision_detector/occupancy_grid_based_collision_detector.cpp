@@ -17,6 +17,11 @@
 #include <autoware/universe_utils/geometry/geometry.hpp>
 #include <autoware/universe_utils/math/normalization.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace autoware::behavior_path_planner
@@ -89,12 +94,56 @@ void OccupancyGridBasedCollisionDetector::setMap(const nav_msgs::msg::OccupancyG
   }
   is_obstacle_table_ = is_obstacle_table;
 
+  compute_obstacle_distance_table();
+
   // construct collision indexes table
   coll_indexes_table_.clear();
+  coll_indexes_radius_table_.clear();
   for (int i = 0; i < param_.theta_size; i++) {
     std::vector<IndexXY> indexes_2d;
     compute_collision_indexes(i, indexes_2d);
+
+    int radius = 0;
+    for (const auto & index_2d : indexes_2d) {
+      radius = std::max({radius, std::abs(index_2d.x), std::abs(index_2d.y)});
+    }
     coll_indexes_table_.push_back(indexes_2d);
+    coll_indexes_radius_table_.push_back(radius);
+  }
+}
+
+void OccupancyGridBasedCollisionDetector::compute_obstacle_distance_table()
+{
+  const int height = static_cast<int>(costmap_.info.height);
+  const int width = static_cast<int>(costmap_.info.width);
+
+  // two-pass distance transform, which is exact for the chessboard distance
+  constexpr int max_distance = std::numeric_limits<int>::max() - 1;
+  obstacle_distance_table_.assign(height * width, max_distance);
+  const auto distance = [&](const int x, const int y) {
+    if (x < 0 || width <= x || y < 0 || height <= y) {
+      return max_distance;
+    }
+    return obstacle_distance_table_[y * width + x];
+  };
+
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      auto & d = obstacle_distance_table_[y * width + x];
+      if (is_obstacle_table_[y][x]) {
+        d = 0;
+        continue;
+      }
+      d = std::min({d, distance(x - 1, y) + 1, distance(x - 1, y - 1) + 1,
+                    distance(x, y - 1) + 1, distance(x + 1, y - 1) + 1});
+    }
+  }
+  for (int y = height - 1; y >= 0; y--) {
+    for (int x = width - 1; x >= 0; x--) {
+      auto & d = obstacle_distance_table_[y * width + x];
+      d = std::min({d, distance(x + 1, y) + 1, distance(x + 1, y + 1) + 1,
+                    distance(x, y + 1) + 1, distance(x - 1, y + 1) + 1});
+    }
   }
 }
 
@@ -145,6 +194,17 @@ void OccupancyGridBasedCollisionDetector::compute_collision_indexes(
     add_index2d(front, y);
   }
   add_index2d(front, left);
+
+  // the footprint is sampled at half of the resolution, so that most of the indexes are duplicated.
+  // only the first one is kept since the check ends at the first obstacle or out of range index.
+  std::set<std::pair<int, int>> added_indexes_2d;
+  std::vector<IndexXY> unique_indexes_2d;
+  for (const auto & index_2d : indexes_2d) {
+    if (added_indexes_2d.emplace(index_2d.x, index_2d.y).second) {
+      unique_indexes_2d.push_back(index_2d);
+    }
+  }
+  indexes_2d = unique_indexes_2d;
 }
 
 bool OccupancyGridBasedCollisionDetector::detectCollision(
@@ -155,6 +215,20 @@ bool OccupancyGridBasedCollisionDetector::detectCollision(
               << std::endl;
     return false;
   }
+
+  // no obstacle is within the square around the base that contains the footprint
+  if (!is_out_of_range(base_index)) {
+    const int radius = coll_indexes_radius_table_[base_index.theta];
+    const bool is_footprint_in_range =
+      !is_out_of_range({base_index.x - radius, base_index.y - radius, 0}) &&
+      !is_out_of_range({base_index.x + radius, base_index.y + radius, 0});
+    const auto distance =
+      obstacle_distance_table_[base_index.y * costmap_.info.width + base_index.x];
+    if ((is_footprint_in_range || !check_out_of_range) && radius < distance) {
+      return false;
+    }
+  }
+
   const auto & coll_indexes_2d = coll_indexes_table_[base_index.theta];
   for (const auto & coll_index_2d : coll_indexes_2d) {
     int idx_theta = 0;  // whatever. Yaw is nothing to do with collision detection between grids.
@@ -175,10 +249,24 @@ bool OccupancyGridBasedCollisionDetector::detectCollision(
 bool OccupancyGridBasedCollisionDetector::hasObstacleOnPath(
   const tier4_planning_msgs::msg::PathWithLaneId & path, const bool check_out_of_range) const
 {
+  tf2::Transform tf_origin;
+  tf2::convert(costmap_.info.origin, tf_origin);
+  geometry_msgs::msg::TransformStamped transform;
+  transform.transform = tf2::toMsg(tf_origin.inverse());
+
+  std::optional<IndexXYT> prev_index{};
   for (const auto & p : path.points) {
-    const auto pose_local = global2local(costmap_, p.point.pose);
+    const auto pose_local = transformPose(p.point.pose, transform);
     const auto index = pose2index(costmap_, pose_local, param_.theta_size);
 
+    // the dense path points often fall into the same index as the previous one
+    if (
+      prev_index && prev_index->x == index.x && prev_index->y == index.y &&
+      prev_index->theta == index.theta) {
+      continue;
+    }
+    prev_index = index;
+
     if (detectCollision(index, check_out_of_range)) {
       return true;
     }
@@ -0,0 +1,141 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/object_lanelet_index.hpp"
+
+#include "autoware/behavior_path_planner_common/utils/utils.hpp"
+
+#include <autoware/universe_utils/geometry/boost_polygon_utils.hpp>
+
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <lanelet2_core/primitives/BoundingBox.h>
+
+#include <algorithm>
+
+namespace autoware::behavior_path_planner::utils::path_safety_checker
+{
+namespace
+{
+std::string toKey(const PredictedObject & object)
+{
+  const auto & uuid = object.object_id.uuid;
+  return std::string(uuid.begin(), uuid.end());
+}
+}  // namespace
+
+ObjectLaneletIndex::ObjectLaneletIndex(
+  const PredictedObjects::ConstSharedPtr & objects,
+  const std::shared_ptr<const lanelet::LaneletMap> & lanelet_map)
+: objects_(objects), lanelet_map_(lanelet_map)
+{
+  if (!objects || !lanelet_map) {
+    return;
+  }
+
+  for (const auto & object : objects->objects) {
+    const auto & pose = object.kinematics.initial_pose_with_covariance.pose;
+    // objects sharing an id are looked up by the first one, the others fall back to the direct test
+    const auto [it, inserted] = entries_.emplace(toKey(object), Entry{pose, object.shape, {}, {}});
+    if (!inserted) {
+      continue;
+    }
+    auto & entry = it->second;
+
+    const lanelet::BasicPoint2d centroid(pose.position.x, pose.position.y);
+    for (const auto & lanelet :
+         lanelet_map->laneletLayer.search(lanelet::BoundingBox2d(centroid, centroid))) {
+      if (boost::geometry::within(centroid, lanelet.polygon2d().basicPolygon())) {
+        entry.centroid_lanelet_ids.push_back(lanelet.id());
+      }
+    }
+
+    const auto object_polygon = autoware::universe_utils::toPolygon2d(object);
+    autoware::universe_utils::Box2d object_box;
+    boost::geometry::envelope(object_polygon, object_box);
+    const lanelet::BoundingBox2d search_box(
+      lanelet::BasicPoint2d(object_box.min_corner().x(), object_box.min_corner().y()),
+      lanelet::BasicPoint2d(object_box.max_corner().x(), object_box.max_corner().y()));
+    for (const auto & lanelet : lanelet_map->laneletLayer.search(search_box)) {
+      if (!boost::geometry::disjoint(utils::toPolygon2d(lanelet), object_polygon)) {
+        entry.overlap_lanelet_ids.push_back(lanelet.id());
+      }
+    }
+
+    std::sort(entry.centroid_lanelet_ids.begin(), entry.centroid_lanelet_ids.end());
+    std::sort(entry.overlap_lanelet_ids.begin(), entry.overlap_lanelet_ids.end());
+  }
+}
+
+bool ObjectLaneletIndex::isBuiltFrom(
+  const PredictedObjects::ConstSharedPtr & objects,
+  const std::shared_ptr<const lanelet::LaneletMap> & lanelet_map) const
+{
+  return objects_ == objects && lanelet_map_.lock() == lanelet_map;
+}
+
+std::optional<bool> ObjectLaneletIndex::isCentroidWithinLanelet(
+  const PredictedObject & object, const lanelet::ConstLanelet & lanelet) const
+{
+  const auto entry = findEntry(object, lanelet);
+  if (!entry) {
+    return std::nullopt;
+  }
+  return std::binary_search(
+    entry->centroid_lanelet_ids.begin(), entry->centroid_lanelet_ids.end(), lanelet.id());
+}
+
+std::optional<bool> ObjectLaneletIndex::isPolygonOverlapLanelet(
+  const PredictedObject & object, const lanelet::ConstLanelet & lanelet) const
+{
+  const auto entry = findEntry(object, lanelet);
+  if (!entry) {
+    return std::nullopt;
+  }
+  return std::binary_search(
+    entry->overlap_lanelet_ids.begin(), entry->overlap_lanelet_ids.end(), lanelet.id());
+}
+
+const ObjectLaneletIndex::Entry * ObjectLaneletIndex::findEntry(
+  const PredictedObject & object, const lanelet::ConstLanelet & lanelet) const
+{
+  const auto lanelet_map = lanelet_map_.lock();
+  if (!lanelet_map) {
+    return nullptr;
+  }
+
+  // the lanelet has to be the one of the map, not a modified copy with the same id
+  const auto lanelet_it = lanelet_map->laneletLayer.find(lanelet.id());
+  if (
+    lanelet_it == lanelet_map->laneletLayer.end() ||
+    lanelet_it->constData() != lanelet.constData()) {
+    return nullptr;
+  }
+
+  const auto entry_it = entries_.find(toKey(object));
+  if (entry_it == entries_.end()) {
+    return nullptr;
+  }
+  const auto & entry = entry_it->second;
+  if (
+    entry.pose != object.kinematics.initial_pose_with_covariance.pose ||
+    entry.shape != object.shape) {
+    return nullptr;
+  }
+  return &entry;
+}
+
+}  // namespace autoware::behavior_path_planner::utils::path_safety_checker
@@ -89,6 +89,46 @@ bool isPolygonOverlapLanelet(
          yaw_threshold;
 }
 
+bool isCentroidWithinLanelet(
+  const PredictedObject & object, const lanelet::ConstLanelet & lanelet, const double yaw_threshold,
+  const std::shared_ptr<const ObjectLaneletIndex> & object_lanelet_index)
+{
+  const auto is_within = object_lanelet_index
+                           ? object_lanelet_index->isCentroidWithinLanelet(object, lanelet)
+                           : std::nullopt;
+  if (!is_within) {
+    return isCentroidWithinLanelet(object, lanelet, yaw_threshold);
+  }
+  if (!*is_within) {
+    return false;
+  }
+
+  const auto & object_pose = object.kinematics.initial_pose_with_covariance.pose;
+  const auto closest_pose = lanelet::utils::getClosestCenterPose(lanelet, object_pose.position);
+  return std::abs(autoware::universe_utils::calcYawDeviation(closest_pose, object_pose)) <
+         yaw_threshold;
+}
+
+bool isPolygonOverlapLanelet(
+  const PredictedObject & object, const lanelet::ConstLanelet & lanelet, const double yaw_threshold,
+  const std::shared_ptr<const ObjectLaneletIndex> & object_lanelet_index)
+{
+  const auto is_overlapped = object_lanelet_index
+                               ? object_lanelet_index->isPolygonOverlapLanelet(object, lanelet)
+                               : std::nullopt;
+  if (!is_overlapped) {
+    return isPolygonOverlapLanelet(object, lanelet, yaw_threshold);
+  }
+  if (!*is_overlapped) {
+    return false;
+  }
+
+  const auto & object_pose = object.kinematics.initial_pose_with_covariance.pose;
+  const auto closest_pose = lanelet::utils::getClosestCenterPose(lanelet, object_pose.position);
+  return std::abs(autoware::universe_utils::calcYawDeviation(closest_pose, object_pose)) <
+         yaw_threshold;
+}
+
 bool isPolygonOverlapLanelet(
   const PredictedObject & object, const autoware::universe_utils::Polygon2d & lanelet_polygon)
 {
@@ -30,6 +30,8 @@
 
 #include <cmath>
 #include <limits>
+#include <utility>
+#include <vector>
 
 namespace autoware::behavior_path_planner::utils::path_safety_checker
 {
@@ -404,6 +406,26 @@ get_interpolated_pose_with_velocity_and_polygon_stamped(
   return PoseWithVelocityAndPolygonStamped{current_time, pose, velocity, obj_polygon};
 }
 
+InterpolatedEgoPathCache::InterpolatedEgoPathCache(
+  std::vector<PoseWithVelocityStamped> predicted_ego_path, const VehicleInfo & vehicle_info)
+: predicted_ego_path_(std::move(predicted_ego_path)), vehicle_info_(vehicle_info)
+{
+}
+
+const std::optional<PoseWithVelocityAndPolygonStamped> & InterpolatedEgoPathCache::get(
+  const double time)
+{
+  auto itr = interpolated_data_.find(time);
+  if (itr == interpolated_data_.end()) {
+    itr = interpolated_data_
+            .emplace(
+              time, get_interpolated_pose_with_velocity_and_polygon_stamped(
+                      predicted_ego_path_, time, vehicle_info_))
+            .first;
+  }
+  return itr->second;
+}
+
 template <typename T, typename F>
 std::vector<T> filterPredictedPathByTimeHorizon(
   const std::vector<T> & path, const double time_horizon, const F & interpolateFunc)
@@ -478,6 +500,8 @@ bool checkSafetyWithRSS(
   const bool check_all_predicted_path, const double hysteresis_factor,
   const double yaw_difference_th)
 {
+  InterpolatedEgoPathCache ego_path_cache(ego_predicted_path, parameters.vehicle_info);
+
   // Check for collisions with each predicted path of the object
   const bool is_safe = !std::any_of(objects.begin(), objects.end(), [&](const auto & object) {
     auto current_debug_data = utils::path_safety_checker::createObjectDebug(object);
@@ -487,9 +511,11 @@ bool checkSafetyWithRSS(
 
     return std::any_of(
       obj_predicted_paths.begin(), obj_predicted_paths.end(), [&](const auto & obj_path) {
-        const bool has_collision = !utils::path_safety_checker::checkCollision(
-          planned_path, ego_predicted_path, object, obj_path, parameters, rss_params,
-          hysteresis_factor, yaw_difference_th, current_debug_data.second);
+        const bool has_collision = !utils::path_safety_checker::get_collided_polygons(
+                                      planned_path, ego_path_cache, object, obj_path, rss_params,
+                                      hysteresis_factor, std::numeric_limits<double>::max(),
+                                      yaw_difference_th, current_debug_data.second)
+                                      .empty();
 
         utils::path_safety_checker::updateCollisionCheckDebugMap(
           debug_map, current_debug_data, !has_collision);
@@ -562,16 +588,65 @@ bool checkCollision(
   return collided_polygons.empty();
 }
 
+bool canCollideWithExtendedPolygon(
+  const Pose & ego_pose, const Pose & obj_pose, const Polygon2d & obj_polygon,
+  const double ego_velocity, const double object_velocity, const VehicleInfo & vehicle_info,
+  const RSSparams & rss_parameters, const double hysteresis_factor)
+{
+  // the longitudinal offset depends on which one is at the front, so take the larger one
+  const auto calc_lon_offset = [&](const double front_velocity, const double rear_velocity) {
+    return std::max(
+             calcRssDistance(front_velocity, rear_velocity, rss_parameters),
+             calc_minimum_longitudinal_length(front_velocity, rear_velocity, rss_parameters)) *
+           hysteresis_factor;
+  };
+  const double lon_offset = std::max(
+    calc_lon_offset(object_velocity, ego_velocity), calc_lon_offset(ego_velocity, object_velocity));
+  const double lat_margin = rss_parameters.lateral_distance_max_threshold * hysteresis_factor;
+
+  // the extended ego polygon is a rectangle around the ego pose
+  const double ego_radius = std::hypot(
+    std::max(vehicle_info.max_longitudinal_offset_m, vehicle_info.rear_overhang_m) + lon_offset,
+    vehicle_info.vehicle_width_m / 2.0 + lat_margin);
+
+  // the extended object polygon is the bounding rectangle of the object polygon in the object
+  // frame, whose corners are within sqrt(2) times the farthest vertex, extended by the offsets
+  double obj_max_squared_distance = 0.0;
+  for (const auto & p : obj_polygon.outer()) {
+    obj_max_squared_distance = std::max(
+      obj_max_squared_distance,
+      std::pow(p.x() - obj_pose.position.x, 2) + std::pow(p.y() - obj_pose.position.y, 2));
+  }
+  const double obj_radius =
+    std::sqrt(2.0 * obj_max_squared_distance) + std::hypot(lon_offset, lat_margin);
+
+  return calcDistance2d(ego_pose, obj_pose) <= ego_radius + obj_radius;
+}
+
 std::vector<Polygon2d> get_collided_polygons(
-  [[maybe_unused]] const PathWithLaneId & planned_path,
+  const PathWithLaneId & planned_path,
   const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
   const ExtendedPredictedObject & target_object,
   const PredictedPathWithPolygon & target_object_path, const VehicleInfo & vehicle_info,
   const RSSparams & rss_parameters, double hysteresis_factor, const double max_velocity_limit,
   const double yaw_difference_th, CollisionCheckDebug & debug)
 {
+  InterpolatedEgoPathCache ego_path_cache(predicted_ego_path, vehicle_info);
+  return get_collided_polygons(
+    planned_path, ego_path_cache, target_object, target_object_path, rss_parameters,
+    hysteresis_factor, max_velocity_limit, yaw_difference_th, debug);
+}
+
+std::vector<Polygon2d> get_collided_polygons(
+  const PathWithLaneId & planned_path, InterpolatedEgoPathCache & ego_path_cache,
+  const ExtendedPredictedObject & target_object,
+  const PredictedPathWithPolygon & target_object_path, const RSSparams & rss_parameters,
+  const double hysteresis_factor, const double max_velocity_limit, const double yaw_difference_th,
+  CollisionCheckDebug & debug)
+{
+  const auto & vehicle_info = ego_path_cache.vehicle_info();
   {
-    debug.ego_predicted_path = predicted_ego_path;
+    debug.ego_predicted_path = ego_path_cache.predicted_ego_path();
     debug.obj_predicted_path = target_object_path.path;
     debug.current_obj_pose = target_object.initial_pose;
   }
@@ -587,11 +662,8 @@ std::vector<Polygon2d> get_collided_polygons(
     const auto object_velocity = obj_pose_with_poly.velocity;
 
     // get ego information at current time
-    // Note: we can create these polygons in advance. However, it can decrease the readability and
-    // variability
     const auto & ego_vehicle_info = vehicle_info;
-    const auto interpolated_data = get_interpolated_pose_with_velocity_and_polygon_stamped(
-      predicted_ego_path, current_time, ego_vehicle_info);
+    const auto & interpolated_data = ego_path_cache.get(current_time);
     if (!interpolated_data) {
       continue;
     }
@@ -604,6 +676,16 @@ std::vector<Polygon2d> get_collided_polygons(
     const double yaw_difference = autoware::universe_utils::normalizeRadian(ego_yaw - object_yaw);
     if (std::abs(yaw_difference) > yaw_difference_th) continue;
 
+    // skip the time step if the bounding circles of the ego and the object do not overlap even
+    // after the largest extension, which is known without creating the extended polygons
+    if (
+      rss_parameters.extended_polygon_policy == "rectangle" &&
+      !canCollideWithExtendedPolygon(
+        ego_pose, obj_pose, obj_polygon, ego_velocity, object_velocity, ego_vehicle_info,
+        rss_parameters, hysteresis_factor)) {
+      continue;
+    }
+
     // check overlap
     if (boost::geometry::overlaps(ego_polygon, obj_polygon)) {
       debug.unsafe_reason = "overlap_polygon";
@@ -20,6 +20,7 @@
 #include <autoware/motion_utils/trajectory/path_with_lane_id.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
 
+#include <cmath>
 #include <string>
 #include <utility>
 #include <vector>
@@ -60,6 +61,17 @@ void PathShifter::setPath(const PathWithLaneId & path)
 {
   reference_path_ = path;
 
+  // the orientation of the points is not changed while shifting, so the arc length and the lateral
+  // direction are calculated once for all the paths generated from this reference path
+  reference_arclength_ = utils::calcPathArcLengthArray(reference_path_);
+  lateral_direction_x_.resize(reference_path_.points.size());
+  lateral_direction_y_.resize(reference_path_.points.size());
+  for (size_t i = 0; i < reference_path_.points.size(); ++i) {
+    const double yaw = tf2::getYaw(reference_path_.points.at(i).point.pose.orientation);
+    lateral_direction_x_.at(i) = -std::sin(yaw);
+    lateral_direction_y_.at(i) = std::cos(yaw);
+  }
+
   updateShiftLinesIndices(shift_lines_);
   sortShiftLinesAlongPath(shift_lines_);
 }
@@ -107,11 +119,13 @@ bool PathShifter::generate(
 
   shifted_path->path = reference_path_;
   shifted_path->shift_length.resize(reference_path_.points.size(), 0.0);
+  const auto initial_shift_length = shifted_path->shift_length;
 
   if (shift_lines_.empty()) {
     RCLCPP_DEBUG_STREAM_THROTTLE(
       logger_, clock_, 3000, "shift_lines_ is empty. Return reference with base offset.");
-    shiftBaseLength(shifted_path, base_offset_);
+    shiftBaseLength(shifted_path->shift_length, base_offset_);
+    applyLateralOffsets(shifted_path, initial_shift_length);
     return true;
   }
 
@@ -149,8 +163,9 @@ bool PathShifter::generate(
   }
 
   // Calculate shifted path
-  type == SHIFT_TYPE::SPLINE ? applySplineShifter(shifted_path, offset_back)
-                             : applyLinearShifter(shifted_path);
+  type == SHIFT_TYPE::SPLINE ? applySplineShifter(shifted_path->shift_length, offset_back)
+                             : applyLinearShifter(shifted_path->shift_length);
+  applyLateralOffsets(shifted_path, initial_shift_length);
 
   shifted_path->path.points = removeOverlapPoints(shifted_path->path.points);
   // Use orientation before shift to remove points in reverse order
@@ -173,45 +188,38 @@ bool PathShifter::generate(
   return true;
 }
 
-void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
+void PathShifter::applyLinearShifter(std::vector<double> & shift_length) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_arclength_;
 
-  shiftBaseLength(shifted_path, base_offset_);
+  shiftBaseLength(shift_length, base_offset_);
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
   // For all shift_lines_,
   for (const auto & shift_line : shift_lines_) {
-    const auto current_shift = shifted_path->shift_length.at(shift_line.end_idx);
+    const auto current_shift = shift_length.at(shift_line.end_idx);
     const auto delta_shift = shift_line.end_shift_length - current_shift;
-    const auto shifting_arclength = std::max(
-      arclength_arr.at(shift_line.end_idx) - arclength_arr.at(shift_line.start_idx), epsilon);
-
-    // For all path.points,
-    for (size_t i = 0; i < shifted_path->path.points.size(); ++i) {
-      // Set shift length.
-      double ith_shift_length = 0.0;
-      if (i < shift_line.start_idx) {
-        ith_shift_length = 0.0;
-      } else if (i <= shift_line.end_idx) {
-        auto dist_from_start = arclength_arr.at(i) - arclength_arr.at(shift_line.start_idx);
-        ith_shift_length = (dist_from_start / shifting_arclength) * delta_shift;
-      } else {
-        ith_shift_length = delta_shift;
-      }
+    const auto start_arclength = arclength_arr.at(shift_line.start_idx);
+    const auto shifting_arclength =
+      std::max(arclength_arr.at(shift_line.end_idx) - start_arclength, epsilon);
 
-      // Apply shifting.
-      addLateralOffsetOnIndexPoint(shifted_path, ith_shift_length, i);
+    // The points before start_idx are not shifted.
+    for (size_t i = shift_line.start_idx; i <= shift_line.end_idx; ++i) {
+      shift_length[i] += (arclength_arr[i] - start_arclength) / shifting_arclength * delta_shift;
+    }
+    for (size_t i = shift_line.end_idx + 1; i < shift_length.size(); ++i) {
+      shift_length[i] += delta_shift;
     }
   }
 }
 
-void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const
+void PathShifter::applySplineShifter(
+  std::vector<double> & shift_length, const bool offset_back) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_arclength_;
 
-  shiftBaseLength(shifted_path, base_offset_);
+  shiftBaseLength(shift_length, base_offset_);
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
@@ -219,7 +227,7 @@ void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offs
   for (const auto & shift_line : shift_lines_) {
     // calc delta shift at the sp.end_idx so that the sp.end_idx on the path will have
     // the desired shift length.
-    const auto current_shift = shifted_path->shift_length.at(shift_line.end_idx);
+    const auto current_shift = shift_length.at(shift_line.end_idx);
     const auto delta_shift = shift_line.end_shift_length - current_shift;
 
     RCLCPP_DEBUG(
@@ -229,8 +237,9 @@ void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offs
       RCLCPP_DEBUG(logger_, "delta shift is zero. skip for this shift point.");
     }
 
-    const auto shifting_arclength = std::max(
-      arclength_arr.at(shift_line.end_idx) - arclength_arr.at(shift_line.start_idx), epsilon);
+    const auto start_arclength = arclength_arr.at(shift_line.start_idx);
+    const auto shifting_arclength =
+      std::max(arclength_arr.at(shift_line.end_idx) - start_arclength, epsilon);
 
     // TODO(Watanabe) write docs.
     // These points are defined to achieve the constant-jerk shifting (see the header description).
@@ -241,43 +250,50 @@ void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offs
       logger_, "base_distance = %s, base_length = %s", toStr(base_distance).c_str(),
       toStr(base_length).c_str());
 
-    std::vector<double> query_distance;
-    std::vector<double> query_length;
-
     // For all path.points,
     // Note: start_idx is not included since shift = 0,
     //       end_idx is not included since shift is considered out of spline.
-    for (size_t i = shift_line.start_idx + 1; i < shift_line.end_idx; ++i) {
-      const double dist_from_start = arclength_arr.at(i) - arclength_arr.at(shift_line.start_idx);
-      query_distance.push_back(dist_from_start);
+    std::vector<double> query_distance(
+      arclength_arr.begin() + shift_line.start_idx + 1, arclength_arr.begin() + shift_line.end_idx);
+    for (auto & distance : query_distance) {
+      distance -= start_arclength;
     }
+    std::vector<double> query_length;
     if (!query_distance.empty()) {
       query_length = autoware::interpolation::spline(base_distance, base_length, query_distance);
     }
 
     // Apply shifting.
-    {
-      size_t i = shift_line.start_idx + 1;
-      for (const auto & itr : query_length) {
-        addLateralOffsetOnIndexPoint(shifted_path, itr, i);
-        ++i;
-      }
+    for (size_t i = 0; i < query_length.size(); ++i) {
+      shift_length[shift_line.start_idx + 1 + i] += query_length[i];
     }
 
     if (offset_back) {
       // Apply shifting after shift
-      for (size_t i = shift_line.end_idx; i < shifted_path->path.points.size(); ++i) {
-        addLateralOffsetOnIndexPoint(shifted_path, delta_shift, i);
+      for (size_t i = shift_line.end_idx; i < shift_length.size(); ++i) {
+        shift_length[i] += delta_shift;
       }
     } else {
       // Apply shifting before shift
       for (size_t i = 0; i < shift_line.start_idx + 1; ++i) {
-        addLateralOffsetOnIndexPoint(shifted_path, query_length.front(), i);
+        shift_length[i] += query_length.front();
       }
     }
   }
 }
 
+void PathShifter::applyLateralOffsets(
+  ShiftedPath * shifted_path, const std::vector<double> & initial_shift_length) const
+{
+  auto & points = shifted_path->path.points;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double offset = shifted_path->shift_length[i] - initial_shift_length[i];
+    auto & position = points[i].point.pose.position;
+    position.x += lateral_direction_x_[i] * offset;
+    position.y += lateral_direction_y_[i] * offset;
+  }
+}
+
 std::pair<std::vector<double>, std::vector<double>> PathShifter::getBaseLengthsWithoutAccelLimit(
   const double arclength, const double shift_length, const bool offset_back)
 {
@@ -497,26 +513,12 @@ void PathShifter::removeBehindShiftLineAndSetBaseOffset(const size_t nearest_idx
   setBaseOffset(new_base_offset);
 }
 
-void PathShifter::addLateralOffsetOnIndexPoint(ShiftedPath * path, double offset, size_t index)
-{
-  if (fabs(offset) < 1.0e-8) {
-    return;
-  }
-
-  auto & p = path->path.points.at(index).point.pose;
-  double yaw = tf2::getYaw(p.orientation);
-  p.position.x -= std::sin(yaw) * offset;
-  p.position.y += std::cos(yaw) * offset;
-
-  path->shift_length.at(index) += offset;
-}
-
-void PathShifter::shiftBaseLength(ShiftedPath * path, double offset)
+void PathShifter::shiftBaseLength(std::vector<double> & shift_length, double offset)
 {
   constexpr double base_offset_thr = 1.0e-4;
   if (std::abs(offset) > base_offset_thr) {
-    for (size_t i = 0; i < path->path.points.size(); ++i) {
-      addLateralOffsetOnIndexPoint(path, offset, i);
+    for (auto & length : shift_length) {
+      length += offset;
     }
   }
 }
@@ -442,6 +442,15 @@ PathWithLaneId combinePath(const PathWithLaneId & path1, const PathWithLaneId &
 BehaviorModuleOutput getReferencePath(
   const lanelet::ConstLanelet & current_lane,
   const std::shared_ptr<const PlannerData> & planner_data)
+{
+  std::optional<ReferencePathBuffer> reference_path_buffer{};
+  return getReferencePath(current_lane, planner_data, reference_path_buffer);
+}
+
+BehaviorModuleOutput getReferencePath(
+  const lanelet::ConstLanelet & current_lane,
+  const std::shared_ptr<const PlannerData> & planner_data,
+  std::optional<ReferencePathBuffer> & reference_path_buffer)
 {
   PathWithLaneId reference_path{};
 
@@ -454,14 +463,71 @@ BehaviorModuleOutput getReferencePath(
 
   // calculate path with backward margin to avoid end points' instability by spline interpolation
   constexpr double extra_margin = 10.0;
+  // extra forward length of the buffered path so that it is not rebuilt every cycle
+  constexpr double buffer_margin = 50.0;
   const double backward_length = p.backward_path_length + extra_margin;
-  const auto current_lanes_with_backward_margin =
-    route_handler->getLaneletSequence(current_lane, backward_length, p.forward_path_length);
   const auto no_shift_pose =
     lanelet::utils::getClosestCenterPose(current_lane, current_pose.position);
-  reference_path = getCenterLinePath(
-    *route_handler, current_lanes_with_backward_margin, no_shift_pose, backward_length,
-    p.forward_path_length, p);
+
+  // arc lengths from the start of the path to ego and from ego to the end of the path
+  const auto calc_arc_lengths_from_pose = [&](const PathWithLaneId & path, const size_t seg_idx) {
+    return std::make_pair(
+      autoware::motion_utils::calcSignedArcLength(
+        path.points, 0, no_shift_pose.position, seg_idx),
+      autoware::motion_utils::calcSignedArcLength(
+        path.points, no_shift_pose.position, seg_idx, path.points.size() - 1));
+  };
+
+  const auto is_buffer_valid = [&](const ReferencePathBuffer & buffer) {
+    if (
+      buffer.path.points.size() < 2 || buffer.route_id != route_handler->getRouteUuid() ||
+      buffer.lanelet_map.lock() != route_handler->getLaneletMapPtr()) {
+      return false;
+    }
+    const auto is_on_current_lane = std::any_of(
+      buffer.path.points.begin(), buffer.path.points.end(), [&](const auto & point) {
+        return std::find(point.lane_ids.begin(), point.lane_ids.end(), current_lane.id()) !=
+               point.lane_ids.end();
+      });
+    if (!is_on_current_lane) {
+      return false;
+    }
+    const auto seg_idx = autoware::motion_utils::findNearestSegmentIndex(
+      buffer.path.points, no_shift_pose, p.ego_nearest_dist_threshold, p.ego_nearest_yaw_threshold);
+    if (!seg_idx) {
+      return false;
+    }
+    const auto [backward_arc_length, forward_arc_length] =
+      calc_arc_lengths_from_pose(buffer.path, *seg_idx);
+    return (buffer.is_backward_end ||
+            p.backward_path_length + p.input_path_interval < backward_arc_length) &&
+           (buffer.is_forward_end || p.forward_path_length + extra_margin < forward_arc_length);
+  };
+
+  if (!reference_path_buffer || !is_buffer_valid(*reference_path_buffer)) {
+    const double forward_length = p.forward_path_length + extra_margin + buffer_margin;
+    const auto current_lanes_with_backward_margin =
+      route_handler->getLaneletSequence(current_lane, backward_length, forward_length);
+    ReferencePathBuffer buffer;
+    buffer.path = getCenterLinePath(
+      *route_handler, current_lanes_with_backward_margin, no_shift_pose, backward_length,
+      forward_length, p);
+    buffer.route_id = route_handler->getRouteUuid();
+    buffer.lanelet_map = route_handler->getLaneletMapPtr();
+    if (buffer.path.points.size() >= 2) {
+      // the lengths are shorter than requested only at the ends of the lanelet sequence. the
+      // tolerance covers the resampling and the shift of the centerline to the rear wheel center.
+      const auto seg_idx = autoware::motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
+        buffer.path.points, no_shift_pose, p.ego_nearest_dist_threshold,
+        p.ego_nearest_yaw_threshold);
+      const auto [backward_arc_length, forward_arc_length] =
+        calc_arc_lengths_from_pose(buffer.path, seg_idx);
+      buffer.is_backward_end = backward_arc_length < backward_length - extra_margin;
+      buffer.is_forward_end = forward_arc_length < forward_length - extra_margin;
+    }
+    reference_path_buffer = buffer;
+  }
+  reference_path.points = reference_path_buffer->path.points;
 
   // clip backward length
   // NOTE: In order to keep backward_path_length at least, resampling interval is added to the
@@ -477,13 +543,6 @@ BehaviorModuleOutput getReferencePath(
   const auto drivable_lanelets = getLaneletsFromPath(reference_path, route_handler);
   const auto drivable_lanes = generateDrivableLanes(drivable_lanelets);
 
-  const auto & dp = planner_data->drivable_area_expansion_parameters;
-
-  const auto shorten_lanes = cutOverlappedLanes(reference_path, drivable_lanes);
-  const auto expanded_lanes = expandLanelets(
-    shorten_lanes, dp.drivable_area_left_bound_offset, dp.drivable_area_right_bound_offset,
-    dp.drivable_area_types_to_skip);
-
   BehaviorModuleOutput output;
   output.path = reference_path;
   output.reference_path = reference_path;
@@ -14,12 +14,14 @@
 
 #include "autoware/behavior_path_planner_common/data_manager.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/drivable_area_expansion.hpp"
+#include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/map_utils.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/path_projection.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/types.hpp"
 #include "autoware_lanelet2_extension/utility/message_conversion.hpp"
 
 #include <gtest/gtest.h>
 #include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/utility/Utilities.h>
 
 using autoware::behavior_path_planner::drivable_area_expansion::LineString2d;
 using autoware::behavior_path_planner::drivable_area_expansion::Point2d;
@@ -272,3 +274,44 @@ TEST(DrivableAreaExpansionProjection, expand_drivable_area)
     EXPECT_LT(p.y, -1.0);
   }
 }
+
+TEST(DrivableAreaExpansionMapUtils, extract_uncrossable_segments)
+{
+  using autoware::behavior_path_planner::drivable_area_expansion::extract_uncrossable_segments;
+  autoware::behavior_path_planner::drivable_area_expansion::DrivableAreaExpansionParameters params;
+  params.avoid_linestring_types = {"road_border"};
+  params.max_path_arc_length = 20.0;
+
+  auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+  lanelet::LineString3d road_border(
+    lanelet::utils::getId(),
+    {lanelet::Point3d(lanelet::utils::getId(), 0.0, 5.0, 0.0),
+     lanelet::Point3d(lanelet::utils::getId(), 10.0, 5.0, 0.0),
+     lanelet::Point3d(lanelet::utils::getId(), 100.0, 5.0, 0.0)});
+  road_border.attributes()[lanelet::AttributeName::Type] = "road_border";
+  lanelet_map_ptr->add(road_border);
+  lanelet_map_ptr->add(lanelet::LineString3d(
+    lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), 0.0, -5.0, 0.0),
+                              lanelet::Point3d(lanelet::utils::getId(), 10.0, -5.0, 0.0)}));
+
+  autoware::behavior_path_planner::drivable_area_expansion::Point ego_point;
+  ego_point.x = 60.0;
+  autoware::behavior_path_planner::drivable_area_expansion::UncrossableSegmentsCache cache;
+  const auto segments = extract_uncrossable_segments(*lanelet_map_ptr, ego_point, params);
+  const auto cached_segments =
+    extract_uncrossable_segments(lanelet_map_ptr, ego_point, params, cache);
+  EXPECT_EQ(segments.size(), 1ul);
+  EXPECT_EQ(cached_segments.size(), 1ul);
+  // all the uncrossable segments of the map are kept in the cache
+  EXPECT_EQ(cache.segments.size(), 2ul);
+
+  // the cache is reused for another ego position
+  ego_point.x = 0.0;
+  EXPECT_EQ(extract_uncrossable_segments(lanelet_map_ptr, ego_point, params, cache).size(), 2ul);
+  EXPECT_EQ(cache.lanelet_map.lock(), lanelet_map_ptr);
+
+  // the cache is updated when the linestring types change
+  params.avoid_linestring_types = {};
+  EXPECT_TRUE(extract_uncrossable_segments(lanelet_map_ptr, ego_point, params, cache).empty());
+  EXPECT_TRUE(cache.segments.empty());
+}
@@ -380,3 +380,60 @@ TEST(BehaviorPathPlanningObjectsFiltering, isTargetObjectType)
   obj.classification.at(1).label = ObjectClassification::Type::PEDESTRIAN;
   EXPECT_TRUE(isTargetObjectType(obj, types_to_check));
 }
+
+TEST(BehaviorPathPlanningObjectsFiltering, ObjectLaneletIndex)
+{
+  using autoware::behavior_path_planner::utils::path_safety_checker::isCentroidWithinLanelet;
+  using autoware::behavior_path_planner::utils::path_safety_checker::ObjectLaneletIndex;
+
+  const lanelet::LineString3d left_bound(
+    lanelet::InvalId, {lanelet::Point3d(lanelet::InvalId, 0.0, 1.75, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, 20.0, 1.75, 0.0)});
+  const lanelet::LineString3d right_bound(
+    lanelet::InvalId, {lanelet::Point3d(lanelet::InvalId, 0.0, -1.75, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, 20.0, -1.75, 0.0)});
+  const lanelet::Lanelet lanelet(1, left_bound, right_bound);
+  const std::shared_ptr<lanelet::LaneletMap> lanelet_map = lanelet::utils::createMap({lanelet});
+
+  const auto create_object = [](const double x, const double y) {
+    PredictedObject object;
+    object.object_id = autoware::universe_utils::generateUUID();
+    object.kinematics.initial_pose_with_covariance.pose = createPose(x, y, 0.0, 0.0, 0.0, 0.0);
+    object.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = 4.0;
+    object.shape.dimensions.y = 2.0;
+    return object;
+  };
+  auto objects = std::make_shared<PredictedObjects>();
+  objects->objects.push_back(create_object(10.0, 0.0));
+  objects->objects.push_back(create_object(10.0, 2.5));
+  objects->objects.push_back(create_object(10.0, 5.0));
+
+  const auto index = std::make_shared<const ObjectLaneletIndex>(objects, lanelet_map);
+  EXPECT_TRUE(index->isBuiltFrom(objects, lanelet_map));
+  EXPECT_FALSE(index->isBuiltFrom(std::make_shared<PredictedObjects>(*objects), lanelet_map));
+
+  const auto & inside = objects->objects.at(0);
+  const auto & overlapping = objects->objects.at(1);
+  const auto & outside = objects->objects.at(2);
+  EXPECT_EQ(index->isCentroidWithinLanelet(inside, lanelet), std::optional<bool>(true));
+  EXPECT_EQ(index->isPolygonOverlapLanelet(inside, lanelet), std::optional<bool>(true));
+  EXPECT_EQ(index->isCentroidWithinLanelet(overlapping, lanelet), std::optional<bool>(false));
+  EXPECT_EQ(index->isPolygonOverlapLanelet(overlapping, lanelet), std::optional<bool>(true));
+  EXPECT_EQ(index->isCentroidWithinLanelet(outside, lanelet), std::optional<bool>(false));
+  EXPECT_EQ(index->isPolygonOverlapLanelet(outside, lanelet), std::optional<bool>(false));
+
+  // the result is not available for the objects and lanelets that are not indexed
+  auto moved = inside;
+  moved.kinematics.initial_pose_with_covariance.pose.position.y = 5.0;
+  EXPECT_FALSE(index->isCentroidWithinLanelet(moved, lanelet).has_value());
+  EXPECT_FALSE(index->isCentroidWithinLanelet(create_object(10.0, 0.0), lanelet).has_value());
+  const lanelet::Lanelet other_lanelet(1, left_bound, right_bound);
+  EXPECT_FALSE(index->isCentroidWithinLanelet(inside, other_lanelet).has_value());
+
+  // the result of the direct test is used in that case
+  EXPECT_TRUE(isCentroidWithinLanelet(inside, lanelet, M_PI_2, index));
+  EXPECT_FALSE(isCentroidWithinLanelet(moved, lanelet, M_PI_2, index));
+  EXPECT_TRUE(isCentroidWithinLanelet(inside, other_lanelet, M_PI_2, index));
+  EXPECT_TRUE(isCentroidWithinLanelet(inside, lanelet, M_PI_2, nullptr));
+}
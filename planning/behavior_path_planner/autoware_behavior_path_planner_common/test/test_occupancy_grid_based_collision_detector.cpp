@@ -123,6 +123,31 @@ TEST_F(OccupancyGridBasedCollisionDetectorTest, detectCollision)
   EXPECT_FALSE(detector_.detectCollision(base_index, false));
 }
 
+TEST_F(OccupancyGridBasedCollisionDetectorTest, detectCollisionFarFromObstacle)
+{
+  using autoware::behavior_path_planner::IndexXYT;
+
+  detector_.setMap(costmap_);
+
+  // Condition: far from obstacle and footprint within range
+  IndexXYT base_index{4, 20, 0};
+  EXPECT_FALSE(detector_.detectCollision(base_index, true));
+  EXPECT_FALSE(detector_.detectCollision(base_index, false));
+
+  // Condition: far from obstacle but footprint partially out of range
+  base_index.x = 30;
+  base_index.y = 4;
+  EXPECT_TRUE(detector_.detectCollision(base_index, true));
+  EXPECT_FALSE(detector_.detectCollision(base_index, false));
+
+  // Condition: obstacle just in front of footprint
+  base_index.x = 12;
+  base_index.y = 28;
+  EXPECT_TRUE(detector_.detectCollision(base_index, false));
+  base_index.x = 11;
+  EXPECT_FALSE(detector_.detectCollision(base_index, false));
+}
+
 TEST_F(OccupancyGridBasedCollisionDetectorTest, hasObstacleOnPath)
 {
   tier4_planning_msgs::msg::PathWithLaneId path;
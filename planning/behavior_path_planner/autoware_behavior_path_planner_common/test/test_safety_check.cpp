@@ -17,6 +17,7 @@
 #include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check.hpp"
 
 #include <autoware/universe_utils/geometry/boost_geometry.hpp>
+#include <autoware/universe_utils/geometry/boost_polygon_utils.hpp>
 #include <autoware/universe_utils/math/unit_conversion.hpp>
 #include <autoware_test_utils/autoware_test_utils.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info.hpp>
@@ -392,6 +393,71 @@ TEST(BehaviorPathPlanningSafetyUtilsTest, get_interpolated_pose_with_velocity_an
   EXPECT_TRUE(interpolation_result.has_value());
 }
 
+TEST(BehaviorPathPlanningSafetyUtilsTest, InterpolatedEgoPathCache)
+{
+  using autoware::behavior_path_planner::utils::path_safety_checker::
+    get_interpolated_pose_with_velocity_and_polygon_stamped;
+  using autoware::behavior_path_planner::utils::path_safety_checker::InterpolatedEgoPathCache;
+
+  autoware::vehicle_info_utils::VehicleInfo vehicle_info{};
+  vehicle_info.max_longitudinal_offset_m = 1.0;
+  vehicle_info.rear_overhang_m = 1.0;
+  vehicle_info.vehicle_width_m = 2.0;
+
+  const auto pred_path = createTestPath();
+  InterpolatedEgoPathCache cache(pred_path, vehicle_info);
+  for (const double time : {0.5, 1.5, 0.5, 3.0}) {
+    const auto expected =
+      get_interpolated_pose_with_velocity_and_polygon_stamped(pred_path, time, vehicle_info);
+    const auto & result = cache.get(time);
+    ASSERT_EQ(result.has_value(), expected.has_value());
+    if (expected) {
+      EXPECT_NEAR(result->pose.position.x, expected->pose.position.x, epsilon);
+      EXPECT_NEAR(result->velocity, expected->velocity, epsilon);
+      EXPECT_TRUE(boost::geometry::equals(result->poly, expected->poly));
+    }
+  }
+}
+
+TEST(BehaviorPathPlanningSafetyUtilsTest, canCollideWithExtendedPolygon)
+{
+  using autoware::behavior_path_planner::utils::path_safety_checker::
+    canCollideWithExtendedPolygon;
+  using autoware::behavior_path_planner::utils::path_safety_checker::RSSparams;
+
+  autoware::vehicle_info_utils::VehicleInfo vehicle_info{};
+  vehicle_info.max_longitudinal_offset_m = 4.0;
+  vehicle_info.rear_overhang_m = 1.0;
+  vehicle_info.vehicle_width_m = 2.0;
+
+  RSSparams params;
+  params.rear_vehicle_reaction_time = 1.0;
+  params.rear_vehicle_safety_time_margin = 1.0;
+  params.lateral_distance_max_threshold = 1.0;
+  params.longitudinal_distance_min_threshold = 1.0;
+  params.longitudinal_velocity_delta_time = 0.0;
+  params.front_vehicle_deceleration = -1.0;
+  params.rear_vehicle_deceleration = -1.0;
+
+  const auto create_object_polygon = [](const Pose & pose) {
+    return autoware::universe_utils::toFootprint(pose, 2.0, 2.0, 2.0);
+  };
+  const auto ego_pose = createPose(0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+
+  // the minimum longitudinal distance of 1m between the stopped ego and object
+  const auto near_pose = createPose(8.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+  EXPECT_TRUE(canCollideWithExtendedPolygon(
+    ego_pose, near_pose, create_object_polygon(near_pose), 0.0, 0.0, vehicle_info, params, 1.0));
+
+  const auto far_pose = createPose(100.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+  EXPECT_FALSE(canCollideWithExtendedPolygon(
+    ego_pose, far_pose, create_object_polygon(far_pose), 0.0, 0.0, vehicle_info, params, 1.0));
+
+  // the RSS distance of the fast ego reaches the far object
+  EXPECT_TRUE(canCollideWithExtendedPolygon(
+    ego_pose, far_pose, create_object_polygon(far_pose), 20.0, 0.0, vehicle_info, params, 1.0));
+}
+
 TEST(BehaviorPathPlanningSafetyUtilsTest, checkPolygonsIntersects)
 {
   using autoware::behavior_path_planner::utils::path_safety_checker::checkPolygonsIntersects;
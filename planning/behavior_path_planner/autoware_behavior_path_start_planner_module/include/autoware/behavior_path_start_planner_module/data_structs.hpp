@@ -138,6 +138,7 @@ struct StartPlannerParameters
   double backward_search_resolution{0.0};
   double backward_path_update_duration{0.0};
   double ignore_distance_from_lane_end{0.0};
+  int num_threads{1};  // number of threads evaluating the start pose and planner candidates
   // freespace planner
   bool enable_freespace_planner{false};
   std::string freespace_planner_algorithm;
@@ -261,10 +261,13 @@ ego pose.
 
   PriorityOrder determinePriorityOrder(
     const std::string & search_priority, const size_t start_pose_candidates_num);
-  bool findPullOutPath(
+  std::optional<PullOutPath> planPullOutPath(
     const Pose & start_pose_candidate, const std::shared_ptr<PullOutPlannerBase> & planner,
-    const Pose & refined_start_pose, const Pose & goal_pose, const double collision_check_margin,
-    std::vector<PlannerDebugData> & debug_data_vector);
+    const Pose & goal_pose, const double collision_check_margin,
+    PlannerDebugData & debug_data) const;
+  void updateStatusWithPullOutPath(
+    const PullOutPath & pull_out_path, const Pose & start_pose_candidate,
+    const Pose & refined_start_pose, const PlannerType & planner_type);
 
   PathWithLaneId extractCollisionCheckSection(
     const PullOutPath & path, const autoware::behavior_path_planner::PlannerType & planner_type);
@@ -282,7 +285,8 @@ ego pose.
   mutable std::shared_ptr<SafetyCheckParams> safety_check_params_;
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
 
-  std::vector<std::shared_ptr<PullOutPlannerBase>> start_planners_;
+  // one set of planners for each thread of planWithPriority
+  std::vector<std::vector<std::shared_ptr<PullOutPlannerBase>>> start_planners_;
   PullOutStatus status_;
   mutable StartPlannerDebugData debug_data_;
 
@@ -311,8 +315,6 @@ ego pose.
   std::vector<Pose> searchPullOutStartPoseCandidates(
     const PathWithLaneId & back_path_from_start_pose) const;
 
-  std::shared_ptr<LaneDepartureChecker> lane_departure_checker_;
-
   // turn signal
   TurnSignalInfo calcTurnSignalInfo();
 
@@ -18,6 +18,7 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -94,6 +95,7 @@ void StartPlannerModuleManager::init(rclcpp::Node * node)
     p.max_back_distance = node->declare_parameter<double>(ns + "max_back_distance");
     p.backward_search_resolution =
       node->declare_parameter<double>(ns + "backward_search_resolution");
+    p.num_threads = std::max(node->declare_parameter<int>(ns + "num_threads"), 1);
     p.backward_path_update_duration =
       node->declare_parameter<double>(ns + "backward_path_update_duration");
     p.ignore_distance_from_lane_end =
@@ -32,8 +32,9 @@ bool PullOutPlannerBase::isPullOutPathCollided(
     *dynamic_objects, parameters_.th_moving_object_velocity);
   auto [pull_out_lane_stop_objects, others] = utils::path_safety_checker::separateObjectsByLanelets(
     stop_objects, pull_out_lanes,
-    [](const auto & obj, const auto & lane, const auto yaw_threshold) {
-      return utils::path_safety_checker::isPolygonOverlapLanelet(obj, lane, yaw_threshold);
+    [this](const auto & obj, const auto & lane, const auto yaw_threshold) {
+      return utils::path_safety_checker::isPolygonOverlapLanelet(
+        obj, lane, yaw_threshold, planner_data_->object_lanelet_index);
     });
   utils::path_safety_checker::filterObjectsByClass(
     pull_out_lane_stop_objects, parameters_.object_types_to_check_for_path_generation);
@@ -33,10 +33,12 @@
 #include <lanelet2_core/geometry/Lanelet.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -65,24 +67,33 @@ StartPlannerModule::StartPlannerModule(
   vehicle_info_{autoware::vehicle_info_utils::VehicleInfoUtils(node).getVehicleInfo()},
   is_freespace_planner_cb_running_{false}
 {
-  lane_departure_checker_ = std::make_shared<LaneDepartureChecker>(time_keeper_);
-  lane_departure_checker_->setVehicleInfo(vehicle_info_);
-  autoware::lane_departure_checker::Param lane_departure_checker_params{};
-  lane_departure_checker_params.footprint_extra_margin =
-    parameters->lane_departure_check_expansion_margin;
-
-  lane_departure_checker_->setParam(lane_departure_checker_params);
-
-  // set enabled planner
-  if (parameters_->enable_shift_pull_out) {
-    start_planners_.push_back(
-      std::make_shared<ShiftPullOut>(node, *parameters, lane_departure_checker_, time_keeper_));
-  }
-  if (parameters_->enable_geometric_pull_out) {
-    start_planners_.push_back(
-      std::make_shared<GeometricPullOut>(node, *parameters, lane_departure_checker_, time_keeper_));
+  // the planners and their lane departure checkers are not thread-safe, so each thread of
+  // planWithPriority has its own set of planners. the time keeper of the module only tracks the
+  // planners when they run in the thread of the module
+  const int num_threads = std::max(parameters_->num_threads, 1);
+  for (int i = 0; i < num_threads; ++i) {
+    const auto time_keeper =
+      num_threads == 1 ? time_keeper_ : std::make_shared<universe_utils::TimeKeeper>();
+    auto lane_departure_checker = std::make_shared<LaneDepartureChecker>(time_keeper);
+    lane_departure_checker->setVehicleInfo(vehicle_info_);
+    autoware::lane_departure_checker::Param lane_departure_checker_params{};
+    lane_departure_checker_params.footprint_extra_margin =
+      parameters->lane_departure_check_expansion_margin;
+    lane_departure_checker->setParam(lane_departure_checker_params);
+
+    // set enabled planner
+    std::vector<std::shared_ptr<PullOutPlannerBase>> start_planners;
+    if (parameters_->enable_shift_pull_out) {
+      start_planners.push_back(
+        std::make_shared<ShiftPullOut>(node, *parameters, lane_departure_checker, time_keeper));
+    }
+    if (parameters_->enable_geometric_pull_out) {
+      start_planners.push_back(
+        std::make_shared<GeometricPullOut>(node, *parameters, lane_departure_checker, time_keeper));
+    }
+    start_planners_.push_back(std::move(start_planners));
   }
-  if (start_planners_.empty()) {
+  if (start_planners_.front().empty()) {
     RCLCPP_ERROR(getLogger(), "Not found enabled planner");
   }
 
@@ -914,27 +925,78 @@ void StartPlannerModule::planWithPriority(
   const PriorityOrder order_priority =
     determinePriorityOrder(search_priority, start_pose_candidates.size());
 
-  std::vector<PlannerDebugData> debug_data_vector;
+  // the combinations of the margin, the start pose candidate and the planner index in the order of
+  // the search, where the earlier one is preferred
+  const auto & planners = start_planners_.front();
+  std::vector<std::tuple<double, size_t, size_t>> candidates;
+  for (const auto & collision_check_margin : parameters_->collision_check_margins) {
+    for (const auto & [index, planner] : order_priority) {
+      const auto planner_index = static_cast<size_t>(
+        std::distance(planners.begin(), std::find(planners.begin(), planners.end(), planner)));
+      candidates.emplace_back(collision_check_margin, index, planner_index);
+    }
+  }
+
+  // evaluate the candidates in parallel. each thread takes its own set of planners, and skips the
+  // candidates after the earliest one found so far, so that the earliest one is always selected as
+  // in the sequential search
+  std::vector<std::optional<PullOutPath>> pull_out_paths(candidates.size());
+  std::vector<std::optional<PlannerDebugData>> planner_debug_data(candidates.size());
+  std::atomic<size_t> selected_index{candidates.size()};
   {  // create a scope for the scoped time track
     universe_utils::ScopedTimeTrack st2("findPullOutPaths", *time_keeper_);
 
-    for (const auto & collision_check_margin : parameters_->collision_check_margins) {
-      for (const auto & [index, planner] : order_priority) {
-        if (findPullOutPath(
-              start_pose_candidates[index], planner, refined_start_pose, goal_pose,
-              collision_check_margin, debug_data_vector)) {
-          debug_data_.selected_start_pose_candidate_index = index;
-          debug_data_.margin_for_start_pose_candidate = collision_check_margin;
-          if (parameters_->print_debug_info) {
-            const auto ss = get_accumulated_debug_stream(debug_data_vector);
-            DEBUG_PRINT("\nPull out path search results:\n%s", ss.str().c_str());
-          }
-          return;
+    std::atomic<size_t> next_thread_index{0};
+    std::atomic<size_t> next_candidate_index{0};
+#pragma omp parallel num_threads(start_planners_.size())
+    {
+      const auto & thread_planners = start_planners_.at(next_thread_index++);
+      for (size_t i = next_candidate_index++; i < candidates.size(); i = next_candidate_index++) {
+        if (selected_index.load() < i) {
+          break;
+        }
+        const auto & [collision_check_margin, index, planner_index] = candidates.at(i);
+        const auto & planner = thread_planners.at(planner_index);
+        PlannerDebugData debug_data{
+          planner->getPlannerType(), {}, collision_check_margin,
+          autoware::universe_utils::calcDistance2d(
+            start_pose_candidates.at(index), refined_start_pose)};
+        pull_out_paths.at(i) = planPullOutPath(
+          start_pose_candidates.at(index), planner, goal_pose, collision_check_margin, debug_data);
+        planner_debug_data.at(i) = debug_data;
+        if (!pull_out_paths.at(i)) {
+          continue;
+        }
+        size_t current_index = selected_index.load();
+        while (i < current_index && !selected_index.compare_exchange_weak(current_index, i)) {
         }
       }
     }
   }
 
+  // the candidates up to the selected one are all evaluated
+  const size_t selected = selected_index.load();
+  std::vector<PlannerDebugData> debug_data_vector;
+  for (size_t i = 0; i < std::min(selected + 1, candidates.size()); ++i) {
+    if (planner_debug_data.at(i)) {
+      debug_data_vector.push_back(*planner_debug_data.at(i));
+    }
+  }
+
+  if (selected < candidates.size()) {
+    const auto & [collision_check_margin, index, planner_index] = candidates.at(selected);
+    updateStatusWithPullOutPath(
+      *pull_out_paths.at(selected), start_pose_candidates.at(index), refined_start_pose,
+      planners.at(planner_index)->getPlannerType());
+    debug_data_.selected_start_pose_candidate_index = index;
+    debug_data_.margin_for_start_pose_candidate = collision_check_margin;
+    if (parameters_->print_debug_info) {
+      const auto ss = get_accumulated_debug_stream(debug_data_vector);
+      DEBUG_PRINT("\nPull out path search results:\n%s", ss.str().c_str());
+    }
+    return;
+  }
+
   if (parameters_->print_debug_info) {
     const auto ss = get_accumulated_debug_stream(debug_data_vector);
     DEBUG_PRINT("\nPull out path search results:\n%s", ss.str().c_str());
@@ -949,14 +1011,14 @@ PriorityOrder StartPlannerModule::determinePriorityOrder(
 
   PriorityOrder order_priority;
   if (search_priority == "efficient_path") {
-    for (const auto & planner : start_planners_) {
+    for (const auto & planner : start_planners_.front()) {
       for (size_t i = 0; i < start_pose_candidates_num; i++) {
         order_priority.emplace_back(i, planner);
       }
     }
   } else if (search_priority == "short_back_distance") {
     for (size_t i = 0; i < start_pose_candidates_num; i++) {
-      for (const auto & planner : start_planners_) {
+      for (const auto & planner : start_planners_.front()) {
         order_priority.emplace_back(i, planner);
       }
     }
@@ -967,10 +1029,19 @@ PriorityOrder StartPlannerModule::determinePriorityOrder(
   return order_priority;
 }
 
-bool StartPlannerModule::findPullOutPath(
+std::optional<PullOutPath> StartPlannerModule::planPullOutPath(
   const Pose & start_pose_candidate, const std::shared_ptr<PullOutPlannerBase> & planner,
-  const Pose & refined_start_pose, const Pose & goal_pose, const double collision_check_margin,
-  std::vector<PlannerDebugData> & debug_data_vector)
+  const Pose & goal_pose, const double collision_check_margin,
+  PlannerDebugData & debug_data) const
+{
+  planner->setCollisionCheckMargin(collision_check_margin);
+  planner->setPlannerData(planner_data_);
+  return planner->plan(start_pose_candidate, goal_pose, debug_data);
+}
+
+void StartPlannerModule::updateStatusWithPullOutPath(
+  const PullOutPath & pull_out_path, const Pose & start_pose_candidate,
+  const Pose & refined_start_pose, const PlannerType & planner_type)
 {
   // if start_pose_candidate is far from refined_start_pose, backward driving is necessary
   constexpr double epsilon = 0.01;
@@ -978,26 +1049,12 @@ bool StartPlannerModule::findPullOutPath(
     autoware::universe_utils::calcDistance2d(start_pose_candidate, refined_start_pose);
   const bool backward_is_unnecessary = backwards_distance < epsilon;
 
-  planner->setCollisionCheckMargin(collision_check_margin);
-  planner->setPlannerData(planner_data_);
-  PlannerDebugData debug_data{
-    planner->getPlannerType(), {}, collision_check_margin, backwards_distance};
-
-  const auto pull_out_path = planner->plan(start_pose_candidate, goal_pose, debug_data);
-  debug_data_vector.push_back(debug_data);
-  // If no path is found, return false
-  if (!pull_out_path) {
-    return false;
-  }
-
   if (backward_is_unnecessary) {
-    updateStatusWithCurrentPath(*pull_out_path, start_pose_candidate, planner->getPlannerType());
-    return true;
+    updateStatusWithCurrentPath(pull_out_path, start_pose_candidate, planner_type);
+    return;
   }
 
-  updateStatusWithNextPath(*pull_out_path, start_pose_candidate, planner->getPlannerType());
-
-  return true;
+  updateStatusWithNextPath(pull_out_path, start_pose_candidate, planner_type);
 }
 
 void StartPlannerModule::updateStatusWithCurrentPath(
@@ -1291,8 +1348,9 @@ PredictedObjects StartPlannerModule::filterStopObjectsInPullOutLanes(
   auto [stop_objects_in_pull_out_lanes, others] =
     utils::path_safety_checker::separateObjectsByLanelets(
       stop_objects, pull_out_lanes,
-      [](const auto & obj, const auto & lane, const auto yaw_threshold) {
-        return utils::path_safety_checker::isPolygonOverlapLanelet(obj, lane, yaw_threshold);
+      [this](const auto & obj, const auto & lane, const auto yaw_threshold) {
+        return utils::path_safety_checker::isPolygonOverlapLanelet(
+          obj, lane, yaw_threshold, planner_data_->object_lanelet_index);
       });
 
   const auto path = planner_data_->route_handler->getCenterLinePath(
@@ -27,6 +27,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -466,6 +467,43 @@ struct ObjectData  // avoidance target
 };
 using ObjectDataArray = std::vector<ObjectData>;
 
+/*
+ * Map related properties of an object, which depend only on its pose, shape and overhang lanelet.
+ * They are reused in the following cycles while the object stays still on the same lanelet.
+ */
+struct StaticObjectProperty
+{
+  Pose pose;
+
+  Vector3 dimensions;
+
+  lanelet::ConstLanelet overhang_lanelet;
+
+  Direction direction{Direction::NONE};
+
+  // is within intersection area
+  bool is_within_intersection{false};
+
+  struct ParkedVehicleGeometry
+  {
+    // the outermost lanelet on the object side is road shoulder
+    bool has_road_shoulder{false};
+
+    // CoG is within the road shoulder lanelet
+    bool is_within_road_shoulder{false};
+
+    // lateral distance from the centerline of the overhang lanelet to the outermost bound
+    double center_to_bound{0.0};
+
+    // signed lateral distance from the centerline of the overhang lanelet to CoG
+    double center_to_object{0.0};
+  };
+
+  // filled only for the vehicle type objects outside of intersection
+  std::optional<ParkedVehicleGeometry> parked_vehicle_geometry{std::nullopt};
+};
+using StaticObjectPropertyCache = std::unordered_map<std::string, StaticObjectProperty>;
+
 /*
  * Shift point with additional info for avoidance planning
  */
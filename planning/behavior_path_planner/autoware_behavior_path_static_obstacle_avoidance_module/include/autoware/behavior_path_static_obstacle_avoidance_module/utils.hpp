@@ -218,10 +218,20 @@ void compensateLostTargetObjects(
   const std::shared_ptr<const PlannerData> & planner_data,
   const std::shared_ptr<AvoidanceParameters> & parameters);
 
+/**
+ * @brief filter the objects to determine the avoidance target objects.
+ * @param objects to be filtered.
+ * @param avoidance planning data.
+ * @param forward detection range.
+ * @param planner data.
+ * @param avoidance parameters.
+ * @param map related properties of the objects, which are reused while the objects stay still.
+ */
 void filterTargetObjects(
   ObjectDataArray & objects, AvoidancePlanningData & data, const double forward_detection_range,
   const std::shared_ptr<const PlannerData> & planner_data,
-  const std::shared_ptr<AvoidanceParameters> & parameters);
+  const std::shared_ptr<AvoidanceParameters> & parameters,
+  StaticObjectPropertyCache & property_cache);
 
 void updateRoadShoulderDistance(
   AvoidancePlanningData & data, const std::shared_ptr<const PlannerData> & planner_data,
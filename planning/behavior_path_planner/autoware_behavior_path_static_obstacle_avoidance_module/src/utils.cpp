@@ -36,6 +36,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::behavior_path_planner::utils::static_obstacle_avoidance
@@ -416,130 +417,97 @@ bool isMergingToEgoLane(const ObjectData & object)
 }
 
 /**
- * @brief check whether the object is parking on road shoulder.
- * @param object polygon.
- * @param avoidance module data.
+ * @brief calculate the lateral geometry of the object and the outermost lanelet on the object side.
+ * @param object data.
  * @param route handler.
- * @param parameters.
- * @return if the object is close to road shoulder of the lane, return true.
+ * @return lateral geometry used in parked vehicle judgement.
  */
-bool isParkedVehicle(
-  ObjectData & object, const AvoidancePlanningData & data,
-  const std::shared_ptr<RouteHandler> & route_handler,
-  const std::shared_ptr<AvoidanceParameters> & parameters)
+StaticObjectProperty::ParkedVehicleGeometry calcParkedVehicleGeometry(
+  const ObjectData & object, const std::shared_ptr<RouteHandler> & route_handler)
 {
   using lanelet::geometry::distance2d;
   using lanelet::geometry::toArcCoordinates;
   using lanelet::utils::to2D;
   using lanelet::utils::conversion::toLaneletPoint;
 
-  if (object.is_within_intersection) {
-    return false;
-  }
-
   const auto centerline_pos =
     lanelet::utils::getClosestCenterPose(object.overhang_lanelet, object.getPosition()).position;
 
-  bool is_left_side_parked_vehicle = false;
-  if (!isOnRight(object)) {
-    const auto most_left_lanelet = [&]() {
-      auto same_direction_lane =
-        route_handler->getMostLeftLanelet(object.overhang_lanelet, true, true);
-      const lanelet::Attribute & sub_type =
-        same_direction_lane.attribute(lanelet::AttributeName::Subtype);
-      if (sub_type == "road_shoulder") {
-        return same_direction_lane;
-      }
-
-      const auto opposite_lanes = route_handler->getLeftOppositeLanelets(same_direction_lane);
-      if (opposite_lanes.empty()) {
-        return same_direction_lane;
-      }
-
-      return static_cast<lanelet::ConstLanelet>(
-        route_handler->getMostRightLanelet(opposite_lanes.front()).invert());
-    }();
-
-    const auto center_to_left_boundary = distance2d(
-      to2D(most_left_lanelet.leftBound().basicLineString()),
-      to2D(toLaneletPoint(centerline_pos)).basicPoint());
-
-    double object_shiftable_distance =
-      center_to_left_boundary - 0.5 * object.object.shape.dimensions.y;
-
+  const auto most_outside_lanelet = [&]() {
+    auto same_direction_lane =
+      isOnRight(object) ? route_handler->getMostRightLanelet(object.overhang_lanelet, true, true)
+                        : route_handler->getMostLeftLanelet(object.overhang_lanelet, true, true);
     const lanelet::Attribute & sub_type =
-      most_left_lanelet.attribute(lanelet::AttributeName::Subtype);
+      same_direction_lane.attribute(lanelet::AttributeName::Subtype);
     if (sub_type == "road_shoulder") {
-      // assuming it's parked vehicle if its CoG is within road shoulder lanelet.
-      if (boost::geometry::within(
-            to2D(toLaneletPoint(object.getPosition())).basicPoint(),
-            most_left_lanelet.polygon2d().basicPolygon())) {
-        return true;
-      }
-    } else {
-      // assuming there is 0.5m road shoulder even if it's not defined explicitly in HDMap.
-      object_shiftable_distance += parameters->object_check_min_road_shoulder_width;
+      return same_direction_lane;
     }
 
-    const auto arc_coordinates = toArcCoordinates(
-      to2D(object.overhang_lanelet.centerline().basicLineString()),
-      to2D(toLaneletPoint(object.getPosition())).basicPoint());
-    object.shiftable_ratio = arc_coordinates.distance / object_shiftable_distance;
-
-    is_left_side_parked_vehicle = object.shiftable_ratio > parameters->object_check_shiftable_ratio;
-  }
+    const auto opposite_lanes = isOnRight(object)
+                                  ? route_handler->getRightOppositeLanelets(same_direction_lane)
+                                  : route_handler->getLeftOppositeLanelets(same_direction_lane);
+    if (opposite_lanes.empty()) {
+      return same_direction_lane;
+    }
 
-  bool is_right_side_parked_vehicle = false;
-  if (isOnRight(object)) {
-    const auto most_right_lanelet = [&]() {
-      auto same_direction_lane =
-        route_handler->getMostRightLanelet(object.overhang_lanelet, true, true);
-      const lanelet::Attribute & sub_type =
-        same_direction_lane.attribute(lanelet::AttributeName::Subtype);
-      if (sub_type == "road_shoulder") {
-        return same_direction_lane;
-      }
+    return static_cast<lanelet::ConstLanelet>(
+      isOnRight(object) ? route_handler->getMostLeftLanelet(opposite_lanes.front()).invert()
+                        : route_handler->getMostRightLanelet(opposite_lanes.front()).invert());
+  }();
 
-      const auto opposite_lanes = route_handler->getRightOppositeLanelets(same_direction_lane);
-      if (opposite_lanes.empty()) {
-        return same_direction_lane;
-      }
+  StaticObjectProperty::ParkedVehicleGeometry geometry;
 
-      return static_cast<lanelet::ConstLanelet>(
-        route_handler->getMostLeftLanelet(opposite_lanes.front()).invert());
-    }();
+  const auto & bound =
+    isOnRight(object) ? most_outside_lanelet.rightBound() : most_outside_lanelet.leftBound();
+  geometry.center_to_bound =
+    distance2d(to2D(bound.basicLineString()), to2D(toLaneletPoint(centerline_pos)).basicPoint());
 
-    const auto center_to_right_boundary = distance2d(
-      to2D(most_right_lanelet.rightBound().basicLineString()),
-      to2D(toLaneletPoint(centerline_pos)).basicPoint());
+  const lanelet::Attribute & sub_type =
+    most_outside_lanelet.attribute(lanelet::AttributeName::Subtype);
+  geometry.has_road_shoulder = sub_type == "road_shoulder";
+  geometry.is_within_road_shoulder =
+    geometry.has_road_shoulder &&
+    boost::geometry::within(
+      to2D(toLaneletPoint(object.getPosition())).basicPoint(),
+      most_outside_lanelet.polygon2d().basicPolygon());
 
-    double object_shiftable_distance =
-      center_to_right_boundary - 0.5 * object.object.shape.dimensions.y;
+  geometry.center_to_object =
+    toArcCoordinates(
+      to2D(object.overhang_lanelet.centerline().basicLineString()),
+      to2D(toLaneletPoint(object.getPosition())).basicPoint())
+      .distance;
 
-    const lanelet::Attribute & sub_type =
-      most_right_lanelet.attribute(lanelet::AttributeName::Subtype);
-    if (sub_type == "road_shoulder") {
-      // assuming it's parked vehicle if its CoG is within road shoulder lanelet.
-      if (boost::geometry::within(
-            to2D(toLaneletPoint(object.getPosition())).basicPoint(),
-            most_right_lanelet.polygon2d().basicPolygon())) {
-        return true;
-      }
-    } else {
-      // assuming there is 0.5m road shoulder even if it's not defined explicitly in HDMap.
-      object_shiftable_distance += parameters->object_check_min_road_shoulder_width;
-    }
+  return geometry;
+}
 
-    const auto arc_coordinates = toArcCoordinates(
-      to2D(object.overhang_lanelet.centerline().basicLineString()),
-      to2D(toLaneletPoint(object.getPosition())).basicPoint());
-    object.shiftable_ratio = -1.0 * arc_coordinates.distance / object_shiftable_distance;
+/**
+ * @brief check whether the object is parking on road shoulder.
+ * @param object polygon.
+ * @param lateral geometry of the object and the outermost lanelet on the object side.
+ * @param avoidance module data.
+ * @param parameters.
+ * @return if the object is close to road shoulder of the lane, return true.
+ */
+bool isParkedVehicle(
+  ObjectData & object, const StaticObjectProperty::ParkedVehicleGeometry & geometry,
+  const AvoidancePlanningData & data, const std::shared_ptr<AvoidanceParameters> & parameters)
+{
+  // assuming it's parked vehicle if its CoG is within road shoulder lanelet.
+  if (geometry.is_within_road_shoulder) {
+    return true;
+  }
 
-    is_right_side_parked_vehicle =
-      object.shiftable_ratio > parameters->object_check_shiftable_ratio;
+  double object_shiftable_distance =
+    geometry.center_to_bound - 0.5 * object.object.shape.dimensions.y;
+  if (!geometry.has_road_shoulder) {
+    // assuming there is 0.5m road shoulder even if it's not defined explicitly in HDMap.
+    object_shiftable_distance += parameters->object_check_min_road_shoulder_width;
   }
 
-  if (!is_left_side_parked_vehicle && !is_right_side_parked_vehicle) {
+  object.shiftable_ratio = (isOnRight(object) ? -1.0 : 1.0) * geometry.center_to_object /
+                           object_shiftable_distance;
+  const bool is_parked_vehicle = object.shiftable_ratio > parameters->object_check_shiftable_ratio;
+  if (!is_parked_vehicle) {
     return false;
   }
 
@@ -552,6 +520,50 @@ bool isParkedVehicle(
   return true;
 }
 
+/**
+ * @brief get the map related properties of the object, which are reused while the object stays
+ * still on the same overhang lanelet.
+ * @param object data.
+ * @param route handler.
+ * @param property cache of the previous cycle.
+ * @param property cache of the current cycle.
+ * @return map related properties of the object.
+ */
+StaticObjectProperty & getStaticObjectProperty(
+  const ObjectData & object, const std::shared_ptr<RouteHandler> & route_handler,
+  const StaticObjectPropertyCache & prev_cache, StaticObjectPropertyCache & cache)
+{
+  // TODO(someone): parametrize if need.
+  constexpr double POSITION_THRESHOLD = 0.1;   // [m]
+  constexpr double DIMENSION_THRESHOLD = 0.1;  // [m]
+
+  const auto id = toHexString(object.object.object_id);
+  if (const auto itr = cache.find(id); itr != cache.end()) {
+    return itr->second;
+  }
+
+  const auto is_same = [&](const StaticObjectProperty & property) {
+    const auto & dimensions = object.object.shape.dimensions;
+    return property.overhang_lanelet.constData() == object.overhang_lanelet.constData() &&
+           property.direction == object.direction &&
+           calcDistance2d(property.pose, object.getPose()) < POSITION_THRESHOLD &&
+           std::abs(property.dimensions.x - dimensions.x) < DIMENSION_THRESHOLD &&
+           std::abs(property.dimensions.y - dimensions.y) < DIMENSION_THRESHOLD;
+  };
+
+  if (const auto itr = prev_cache.find(id); itr != prev_cache.end() && is_same(itr->second)) {
+    return cache.emplace(id, itr->second).first->second;
+  }
+
+  StaticObjectProperty property;
+  property.pose = object.getPose();
+  property.dimensions = object.object.shape.dimensions;
+  property.overhang_lanelet = object.overhang_lanelet;
+  property.direction = object.direction;
+  property.is_within_intersection = isWithinIntersection(object, route_handler);
+  return cache.emplace(id, property).first->second;
+}
+
 bool isCloseToStopFactor(
   ObjectData & object, const AvoidancePlanningData & data,
   const std::shared_ptr<const PlannerData> & planner_data,
@@ -1939,7 +1951,8 @@ void updateRoadShoulderDistance(
 void filterTargetObjects(
   ObjectDataArray & objects, AvoidancePlanningData & data, const double forward_detection_range,
   const std::shared_ptr<const PlannerData> & planner_data,
-  const std::shared_ptr<AvoidanceParameters> & parameters)
+  const std::shared_ptr<AvoidanceParameters> & parameters,
+  StaticObjectPropertyCache & property_cache)
 {
   if (data.current_lanelets.empty()) {
     return;
@@ -1961,6 +1974,9 @@ void filterTargetObjects(
   const auto & is_allowed_goal_modification =
     utils::isAllowedGoalModification(planner_data->route_handler);
 
+  // the properties of the objects that are not checked in this cycle are dropped.
+  const auto prev_property_cache = std::exchange(property_cache, StaticObjectPropertyCache{});
+
   for (auto & o : objects) {
     if (!filtering_utils::isSatisfiedWithCommonCondition(
           o, data.reference_path_rough, forward_detection_range, to_goal_distance,
@@ -1989,10 +2005,16 @@ void filterTargetObjects(
     } else if (filtering_utils::isVehicleTypeObject(o)) {
       // TARGET: CAR, TRUCK, BUS, TRAILER, MOTORCYCLE
 
-      o.is_within_intersection =
-        filtering_utils::isWithinIntersection(o, planner_data->route_handler);
-      o.is_parked =
-        filtering_utils::isParkedVehicle(o, data, planner_data->route_handler, parameters);
+      auto & property = filtering_utils::getStaticObjectProperty(
+        o, planner_data->route_handler, prev_property_cache, property_cache);
+      if (!property.is_within_intersection && !property.parked_vehicle_geometry) {
+        property.parked_vehicle_geometry =
+          filtering_utils::calcParkedVehicleGeometry(o, planner_data->route_handler);
+      }
+      o.is_within_intersection = property.is_within_intersection;
+      o.is_parked = !o.is_within_intersection &&
+                    filtering_utils::isParkedVehicle(
+                      o, property.parked_vehicle_geometry.value(), data, parameters);
       o.avoid_margin = filtering_utils::getAvoidMargin(o, planner_data, parameters);
 
       if (filtering_utils::isNoNeedAvoidanceBehavior(o, parameters)) {
@@ -2007,8 +2029,10 @@ void filterTargetObjects(
     } else {
       // TARGET: PEDESTRIAN, BICYCLE
 
-      o.is_within_intersection =
-        filtering_utils::isWithinIntersection(o, planner_data->route_handler);
+      o.is_within_intersection = filtering_utils::getStaticObjectProperty(
+                                   o, planner_data->route_handler, prev_property_cache,
+                                   property_cache)
+                                   .is_within_intersection;
       o.is_parked = false;
       o.avoid_margin = filtering_utils::getAvoidMargin(o, planner_data, parameters);
 
@@ -2258,13 +2282,15 @@ std::vector<ExtendedPredictedObject> getSafetyCheckTargetObjects(
     return object_vel_norm > object_parameter.moving_speed_threshold;
   };
 
-  const auto filter =
-    [&is_moving](const auto & object, const auto & lanelet, [[maybe_unused]] const auto unused) {
-      // filter by yaw deviation only when the object is moving because the head direction is not
-      // reliable while object is stopping.
-      const auto yaw_threshold = is_moving(object) ? M_PI_2 : M_PI;
-      return utils::path_safety_checker::isCentroidWithinLanelet(object, lanelet, yaw_threshold);
-    };
+  const auto filter = [&is_moving, &planner_data](
+                        const auto & object, const auto & lanelet,
+                        [[maybe_unused]] const auto unused) {
+    // filter by yaw deviation only when the object is moving because the head direction is not
+    // reliable while object is stopping.
+    const auto yaw_threshold = is_moving(object) ? M_PI_2 : M_PI;
+    return utils::path_safety_checker::isCentroidWithinLanelet(
+      object, lanelet, yaw_threshold, planner_data->object_lanelet_index);
+  };
 
   // check right lanes
   if (check_right_lanes) {
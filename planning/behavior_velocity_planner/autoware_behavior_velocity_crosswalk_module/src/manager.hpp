@@ -46,6 +46,8 @@ public:
 
 private:
   CrosswalkModule::PlannerParam crosswalk_planner_param_{};
+  std::shared_ptr<PredictedObjectIndex> predicted_object_index_{
+    std::make_shared<PredictedObjectIndex>()};
 
   void launchNewModules(const PathWithLaneId & path) override;
 
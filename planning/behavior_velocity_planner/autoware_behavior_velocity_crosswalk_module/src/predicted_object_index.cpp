@@ -0,0 +1,124 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "predicted_object_index.hpp"
+
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace autoware::behavior_velocity_planner
+{
+namespace
+{
+// the objects whose box covers more cells than this are not put in the cells
+constexpr int64_t max_cells_per_object = 256;
+
+uint64_t toCellKey(const int64_t x, const int64_t y)
+{
+  return (static_cast<uint64_t>(x) << 32) ^ static_cast<uint32_t>(y);
+}
+
+// the box of the poses of all the predicted paths, expanded by the footprint of the object
+autoware::universe_utils::Box2d calcSweptBox(
+  const autoware_perception_msgs::msg::PredictedObject & object)
+{
+  // the footprint of the crosswalk module is the rectangle of the dimensions around the pose
+  const auto & dimensions = object.shape.dimensions;
+  const double radius = std::hypot(dimensions.x, dimensions.y) / 2.0;
+
+  const auto & initial_position = object.kinematics.initial_pose_with_covariance.pose.position;
+  double min_x = initial_position.x;
+  double min_y = initial_position.y;
+  double max_x = initial_position.x;
+  double max_y = initial_position.y;
+  for (const auto & predicted_path : object.kinematics.predicted_paths) {
+    for (const auto & pose : predicted_path.path) {
+      min_x = std::min(min_x, pose.position.x);
+      min_y = std::min(min_y, pose.position.y);
+      max_x = std::max(max_x, pose.position.x);
+      max_y = std::max(max_y, pose.position.y);
+    }
+  }
+  return autoware::universe_utils::Box2d(
+    {min_x - radius, min_y - radius}, {max_x + radius, max_y + radius});
+}
+}  // namespace
+
+PredictedObjectIndex::PredictedObjectIndex(const double cell_size) : cell_size_(cell_size)
+{
+}
+
+void PredictedObjectIndex::update(
+  const autoware_perception_msgs::msg::PredictedObjects::ConstSharedPtr & objects)
+{
+  if (objects == objects_) {
+    return;
+  }
+  objects_ = objects;
+  boxes_.clear();
+  cells_.clear();
+  large_objects_.clear();
+  if (!objects) {
+    return;
+  }
+
+  for (size_t i = 0; i < objects->objects.size(); ++i) {
+    const auto box = calcSweptBox(objects->objects.at(i));
+    boxes_.push_back(box);
+
+    const auto min_x = static_cast<int64_t>(std::floor(box.min_corner().x() / cell_size_));
+    const auto min_y = static_cast<int64_t>(std::floor(box.min_corner().y() / cell_size_));
+    const auto max_x = static_cast<int64_t>(std::floor(box.max_corner().x() / cell_size_));
+    const auto max_y = static_cast<int64_t>(std::floor(box.max_corner().y() / cell_size_));
+    if ((max_x - min_x + 1) * (max_y - min_y + 1) > max_cells_per_object) {
+      large_objects_.push_back(i);
+      continue;
+    }
+    for (int64_t x = min_x; x <= max_x; ++x) {
+      for (int64_t y = min_y; y <= max_y; ++y) {
+        cells_[toCellKey(x, y)].push_back(i);
+      }
+    }
+  }
+}
+
+std::vector<size_t> PredictedObjectIndex::query(const autoware::universe_utils::Box2d & box) const
+{
+  std::vector<size_t> candidates = large_objects_;
+  const auto min_x = static_cast<int64_t>(std::floor(box.min_corner().x() / cell_size_));
+  const auto min_y = static_cast<int64_t>(std::floor(box.min_corner().y() / cell_size_));
+  const auto max_x = static_cast<int64_t>(std::floor(box.max_corner().x() / cell_size_));
+  const auto max_y = static_cast<int64_t>(std::floor(box.max_corner().y() / cell_size_));
+  for (int64_t x = min_x; x <= max_x; ++x) {
+    for (int64_t y = min_y; y <= max_y; ++y) {
+      if (const auto it = cells_.find(toCellKey(x, y)); it != cells_.end()) {
+        candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+      }
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  std::vector<size_t> indices;
+  for (const auto i : candidates) {
+    if (boost::geometry::intersects(boxes_.at(i), box)) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+}  // namespace autoware::behavior_velocity_planner
@@ -0,0 +1,62 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PREDICTED_OBJECT_INDEX_HPP_
+#define PREDICTED_OBJECT_INDEX_HPP_
+
+#include <autoware/universe_utils/geometry/boost_geometry.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+
+/**
+ * @brief bounding boxes of the area swept by the predicted paths of the objects, put in the cells
+ * of a uniform grid
+ * @details an object whose box does not intersect the attention area of a crosswalk cannot
+ * collide on it, so the crosswalk modules only check the objects found by query(). The index is
+ * built once for each objects message and shared by the crosswalk modules.
+ */
+class PredictedObjectIndex
+{
+public:
+  explicit PredictedObjectIndex(const double cell_size = 10.0);
+
+  /**
+   * @brief rebuild the index unless it is built from the same objects message
+   */
+  void update(const autoware_perception_msgs::msg::PredictedObjects::ConstSharedPtr & objects);
+
+  /**
+   * @brief sorted indices of the objects whose box intersects the box
+   */
+  std::vector<size_t> query(const autoware::universe_utils::Box2d & box) const;
+
+private:
+  double cell_size_;
+  autoware_perception_msgs::msg::PredictedObjects::ConstSharedPtr objects_{nullptr};
+  std::vector<autoware::universe_utils::Box2d> boxes_;
+  std::unordered_map<uint64_t, std::vector<size_t>> cells_;
+  //! objects covering too many cells, which are checked in every query
+  std::vector<size_t> large_objects_;
+};
+
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // PREDICTED_OBJECT_INDEX_HPP_
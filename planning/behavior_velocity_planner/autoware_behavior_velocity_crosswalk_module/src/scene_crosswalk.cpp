@@ -172,11 +172,13 @@ tier4_debug_msgs::msg::StringStamped createStringStampedMessage(
 CrosswalkModule::CrosswalkModule(
   rclcpp::Node & node, const int64_t lane_id, const int64_t module_id,
   const std::optional<int64_t> & reg_elem_id, const lanelet::LaneletMapPtr & lanelet_map_ptr,
-  const PlannerParam & planner_param, const rclcpp::Logger & logger,
-  const rclcpp::Clock::SharedPtr clock)
+  const PlannerParam & planner_param,
+  const std::shared_ptr<PredictedObjectIndex> & predicted_object_index,
+  const rclcpp::Logger & logger, const rclcpp::Clock::SharedPtr clock)
 : SceneModuleInterface(module_id, logger, clock),
   module_id_(module_id),
   planner_param_(planner_param),
+  predicted_object_index_(predicted_object_index),
   use_regulatory_element_(reg_elem_id)
 {
   velocity_factor_.init(PlanningBehavior::CROSSWALK);
@@ -1146,9 +1148,20 @@ void CrosswalkModule::updateObjectState(
   const auto ignore_crosswalk = isRedSignalForPedestrians();
   debug_data_.ignore_crosswalk = ignore_crosswalk;
 
+  // NOTE: the objects whose swept box does not intersect the attention area never have a
+  //       collision point, so the collision check is skipped for them.
+  predicted_object_index_->update(objects_ptr);
+  autoware::universe_utils::Box2d attention_box;
+  bg::envelope(attention_area, attention_box);
+  std::vector<bool> is_near_attention_area(objects_ptr->objects.size(), false);
+  for (const auto i : predicted_object_index_->query(attention_box)) {
+    is_near_attention_area.at(i) = true;
+  }
+
   // Update object state
   object_info_manager_.init();
-  for (const auto & object : objects_ptr->objects) {
+  for (size_t i = 0; i < objects_ptr->objects.size(); ++i) {
+    const auto & object = objects_ptr->objects.at(i);
     const auto obj_uuid = toHexString(object.object_id);
     const auto & obj_pos = object.kinematics.initial_pose_with_covariance.pose.position;
     const auto & obj_vel = object.kinematics.initial_twist_with_covariance.twist.linear;
@@ -1162,7 +1175,10 @@ void CrosswalkModule::updateObjectState(
     }
 
     const auto collision_point =
-      getCollisionPoint(sparse_resample_path, object, crosswalk_attention_range, attention_area);
+      is_near_attention_area.at(i)
+        ? getCollisionPoint(
+            sparse_resample_path, object, crosswalk_attention_range, attention_area)
+        : std::nullopt;
     object_info_manager_.update(
       obj_uuid, obj_pos, std::hypot(obj_vel.x, obj_vel.y), clock_->now(), is_ego_yielding,
       has_traffic_light, collision_point, object.classification.front().label, planner_param_,
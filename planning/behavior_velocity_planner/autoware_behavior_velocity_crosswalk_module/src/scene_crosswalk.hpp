@@ -16,6 +16,7 @@
 #define SCENE_CROSSWALK_HPP_
 
 #include "autoware/behavior_velocity_crosswalk_module/util.hpp"
+#include "predicted_object_index.hpp"
 
 #include <autoware/behavior_velocity_planner_common/scene_module_interface.hpp>
 #include <autoware/universe_utils/geometry/boost_geometry.hpp>
@@ -334,8 +335,9 @@ public:
   CrosswalkModule(
     rclcpp::Node & node, const int64_t lane_id, const int64_t module_id,
     const std::optional<int64_t> & reg_elem_id, const lanelet::LaneletMapPtr & lanelet_map_ptr,
-    const PlannerParam & planner_param, const rclcpp::Logger & logger,
-    const rclcpp::Clock::SharedPtr clock);
+    const PlannerParam & planner_param,
+    const std::shared_ptr<PredictedObjectIndex> & predicted_object_index,
+    const rclcpp::Logger & logger, const rclcpp::Clock::SharedPtr clock);
 
   bool modifyPathVelocity(PathWithLaneId * path, StopReason * stop_reason) override;
 
@@ -470,6 +472,9 @@ private:
 
   ObjectInfoManager object_info_manager_;
 
+  // spatial index of the predicted objects shared by the crosswalk modules
+  const std::shared_ptr<PredictedObjectIndex> predicted_object_index_;
+
   // Debug
   mutable DebugData debug_data_;
 
@@ -0,0 +1,180 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bit_grid.hpp"
+
+#include <algorithm>
+
+namespace autoware::behavior_velocity_planner
+{
+namespace
+{
+constexpr int bits_per_word = 64;
+constexpr std::uint64_t all_ones = ~std::uint64_t{0};
+
+int numWords(const int width)
+{
+  return (width + bits_per_word - 1) / bits_per_word;
+}
+
+int floorDiv(const int a, const int b)
+{
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+// the i-th word of the row, where the bits out of [0, width) are fill
+std::uint64_t wordAt(const std::uint64_t * row, const int width, const int i, const bool fill)
+{
+  const std::uint64_t fill_word = fill ? all_ones : 0;
+  if (i < 0 || i >= numWords(width)) {
+    return fill_word;
+  }
+  const int num_valid_bits = width - i * bits_per_word;
+  if (num_valid_bits >= bits_per_word) {
+    return row[i];
+  }
+  const std::uint64_t valid_mask = (std::uint64_t{1} << num_valid_bits) - 1;
+  return (row[i] & valid_mask) | (fill_word & ~valid_mask);
+}
+
+// 64 bits of the row from the bit, which may be out of [0, width)
+std::uint64_t bitsAt(const std::uint64_t * row, const int width, const int bit, const bool fill)
+{
+  const int i = floorDiv(bit, bits_per_word);
+  const int shift = bit - i * bits_per_word;
+  const auto lower = wordAt(row, width, i, fill);
+  if (shift == 0) {
+    return lower;
+  }
+  return (lower >> shift) | (wordAt(row, width, i + 1, fill) << (bits_per_word - shift));
+}
+
+void clearPadding(std::uint64_t * row, const int width)
+{
+  const int num_padding_bits = numWords(width) * bits_per_word - width;
+  if (num_padding_bits > 0) {
+    row[numWords(width) - 1] &= all_ones >> num_padding_bits;
+  }
+}
+
+// dst[x] = src[x + offset] for x in [0, dst_width)
+void copyBits(
+  const std::uint64_t * src, const int src_width, const int offset, const bool fill,
+  std::uint64_t * dst, const int dst_width)
+{
+  for (int i = 0; i < numWords(dst_width); ++i) {
+    dst[i] = bitsAt(src, src_width, offset + i * bits_per_word, fill);
+  }
+  clearPadding(dst, dst_width);
+}
+}  // namespace
+
+BitGrid::BitGrid(const int width, const int height)
+: width_(std::max(width, 0)),
+  height_(std::max(height, 0)),
+  words_per_row_(numWords(width_)),
+  words_(static_cast<size_t>(words_per_row_) * height_, 0)
+{
+}
+
+bool BitGrid::get(const int x, const int y) const
+{
+  return (row(y)[x / bits_per_word] >> (x % bits_per_word)) & 1;
+}
+
+void BitGrid::set(const int x, const int y, const bool value)
+{
+  const std::uint64_t bit = std::uint64_t{1} << (x % bits_per_word);
+  if (value) {
+    row(y)[x / bits_per_word] |= bit;
+  } else {
+    row(y)[x / bits_per_word] &= ~bit;
+  }
+}
+
+BitGrid BitGrid::crop(
+  const int x, const int y, const int width, const int height, const bool fill) const
+{
+  BitGrid cropped(width, height);
+  for (int j = 0; j < cropped.height_; ++j) {
+    const int src_y = y + j;
+    if (src_y < 0 || src_y >= height_) {
+      std::fill(cropped.row(j), cropped.row(j) + cropped.words_per_row_, fill ? all_ones : 0);
+      clearPadding(cropped.row(j), cropped.width_);
+      continue;
+    }
+    copyBits(row(src_y), width_, x, fill, cropped.row(j), cropped.width_);
+  }
+  return cropped;
+}
+
+BitGrid & BitGrid::operator&=(const BitGrid & other)
+{
+  for (size_t i = 0; i < std::min(words_.size(), other.words_.size()); ++i) {
+    words_[i] &= other.words_[i];
+  }
+  return *this;
+}
+
+BitGrid BitGrid::open(const int kernel_size) const
+{
+  if (kernel_size <= 1) {
+    return *this;
+  }
+  return morph(kernel_size, true).morph(kernel_size, false);
+}
+
+BitGrid BitGrid::morph(const int kernel_size, const bool is_erode) const
+{
+  // the out of the grid is regarded as 1 for erosion and 0 for dilation as cv
+  const std::uint64_t identity = is_erode ? all_ones : 0;
+  const auto combine = [&](std::uint64_t & dst, const std::uint64_t src) {
+    dst = is_erode ? (dst & src) : (dst | src);
+  };
+  const int anchor = kernel_size / 2;
+
+  // the rectangular kernel is separable, so the rows are processed first
+  BitGrid horizontal(width_, height_);
+  std::vector<std::uint64_t> shifted(words_per_row_);
+  for (int y = 0; y < height_; ++y) {
+    auto * dst = horizontal.row(y);
+    std::fill(dst, dst + words_per_row_, identity);
+    for (int dx = -anchor; dx < kernel_size - anchor; ++dx) {
+      copyBits(row(y), width_, dx, is_erode, shifted.data(), width_);
+      for (int i = 0; i < words_per_row_; ++i) {
+        combine(dst[i], shifted[i]);
+      }
+    }
+  }
+
+  // the row of the image is upside down, so is the kernel in y
+  BitGrid result(width_, height_);
+  for (int y = 0; y < height_; ++y) {
+    auto * dst = result.row(y);
+    std::fill(dst, dst + words_per_row_, identity);
+    for (int dy = anchor - kernel_size + 1; dy <= anchor; ++dy) {
+      const int src_y = y + dy;
+      if (src_y < 0 || src_y >= height_) {
+        continue;
+      }
+      const auto * src = horizontal.row(src_y);
+      for (int i = 0; i < words_per_row_; ++i) {
+        combine(dst[i], src[i]);
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace autoware::behavior_velocity_planner
@@ -0,0 +1,77 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BIT_GRID_HPP_
+#define BIT_GRID_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+
+/**
+ * @brief binary grid whose rows are packed into 64 bit words
+ * @note the cell (x, y) is the x-th column of the y-th row, and y increases upward as the
+ * occupancy grid, i.e. the row of the cell in the image of cv is (height - 1 - y)
+ */
+class BitGrid
+{
+public:
+  BitGrid() = default;
+  BitGrid(const int width, const int height);
+
+  int width() const { return width_; }
+  int height() const { return height_; }
+
+  bool get(const int x, const int y) const;
+  void set(const int x, const int y, const bool value = true);
+
+  /**
+   * @brief copy of the cells [x, x + width) x [y, y + height), the cells out of this grid are
+   * filled with fill
+   */
+  BitGrid crop(
+    const int x, const int y, const int width, const int height, const bool fill = false) const;
+
+  /**
+   * @brief cell-wise AND with the grid of the same size
+   */
+  BitGrid & operator&=(const BitGrid & other);
+
+  /**
+   * @brief same as cv::morphologyEx(cv::MORPH_OPEN) with the rectangular kernel of kernel_size
+   * applied on the image of this grid, including the anchor of the kernel of even size and the
+   * default border values
+   */
+  BitGrid open(const int kernel_size) const;
+
+private:
+  /**
+   * @brief erode(is_erode = true) or dilate(is_erode = false) with the rectangular kernel
+   */
+  BitGrid morph(const int kernel_size, const bool is_erode) const;
+
+  const std::uint64_t * row(const int y) const { return words_.data() + y * words_per_row_; }
+  std::uint64_t * row(const int y) { return words_.data() + y * words_per_row_; }
+
+  int width_{0};
+  int height_{0};
+  int words_per_row_{0};
+  std::vector<std::uint64_t> words_;
+};
+
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // BIT_GRID_HPP_
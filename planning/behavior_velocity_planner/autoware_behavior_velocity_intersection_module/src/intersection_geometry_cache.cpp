@@ -0,0 +1,63 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intersection_geometry_cache.hpp"
+
+namespace autoware::behavior_velocity_planner
+{
+
+std::optional<IntersectionLanelets> IntersectionGeometryCache::findLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id)
+{
+  return entry(lanelet_map, lane_id).lanelets;
+}
+
+void IntersectionGeometryCache::storeLanelets(
+  const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id,
+  const IntersectionLanelets & lanelets)
+{
+  entry(lanelet_map, lane_id).lanelets = lanelets;
+}
+
+std::optional<std::vector<lanelet::ConstLineString3d>>
+IntersectionGeometryCache::findOcclusionAttentionDivisions(
+  const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id,
+  const double resolution, const bool is_prioritized)
+{
+  const auto & cached = entry(lanelet_map, lane_id).divisions.at(is_prioritized);
+  if (!cached || cached->resolution != resolution) {
+    return std::nullopt;
+  }
+  return cached->divisions;
+}
+
+void IntersectionGeometryCache::storeOcclusionAttentionDivisions(
+  const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id,
+  const double resolution, const bool is_prioritized,
+  const std::vector<lanelet::ConstLineString3d> & divisions)
+{
+  entry(lanelet_map, lane_id).divisions.at(is_prioritized) = Divisions{resolution, divisions};
+}
+
+IntersectionGeometryCache::Entry & IntersectionGeometryCache::entry(
+  const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id)
+{
+  if (lanelet_map_.lock() != lanelet_map) {
+    entries_.clear();
+    lanelet_map_ = lanelet_map;
+  }
+  return entries_[lane_id];
+}
+
+}  // namespace autoware::behavior_velocity_planner
@@ -0,0 +1,88 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INTERSECTION_GEOMETRY_CACHE_HPP_
+#define INTERSECTION_GEOMETRY_CACHE_HPP_
+
+#include "intersection_lanelets.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/LineString.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+
+/**
+ * @brief map dependent geometry of each intersection lane, which is shared by the module instances
+ * @details the geometry only depends on the map and the parameters of the manager, so once it is
+ * generated for an intersection lane the following instances of the lane reuse it. The entries
+ * are cleared when the map is changed.
+ */
+class IntersectionGeometryCache
+{
+public:
+  /**
+   * @brief IntersectionLanelets of the lane before update(), std::nullopt if not generated yet
+   */
+  std::optional<IntersectionLanelets> findLanelets(
+    const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id);
+
+  void storeLanelets(
+    const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id,
+    const IntersectionLanelets & lanelets);
+
+  /**
+   * @brief discretized occlusion attention lanelets of the lane with the resolution,
+   * std::nullopt if not generated yet
+   * @param is_prioritized the occlusion attention lanelets differ if the lane is prioritized
+   */
+  std::optional<std::vector<lanelet::ConstLineString3d>> findOcclusionAttentionDivisions(
+    const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id,
+    const double resolution, const bool is_prioritized);
+
+  void storeOcclusionAttentionDivisions(
+    const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id,
+    const double resolution, const bool is_prioritized,
+    const std::vector<lanelet::ConstLineString3d> & divisions);
+
+private:
+  struct Divisions
+  {
+    double resolution{0.0};
+    std::vector<lanelet::ConstLineString3d> divisions{};
+  };
+
+  struct Entry
+  {
+    std::optional<IntersectionLanelets> lanelets{std::nullopt};
+    //! indexed by is_prioritized
+    std::array<std::optional<Divisions>, 2> divisions{};
+  };
+
+  //! the entry of the lane, after all the entries are cleared if the map is changed
+  Entry & entry(const lanelet::LaneletMapConstPtr & lanelet_map, const lanelet::Id lane_id);
+
+  std::weak_ptr<const lanelet::LaneletMap> lanelet_map_;
+  std::unordered_map<lanelet::Id, Entry> entries_;
+};
+
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // INTERSECTION_GEOMETRY_CACHE_HPP_
@@ -45,6 +45,9 @@ private:
   IntersectionModule::PlannerParam intersection_param_;
   // additional for INTERSECTION_OCCLUSION
   RTCInterface occlusion_rtc_interface_;
+  // geometry of the intersection lanes shared by the modules
+  std::shared_ptr<IntersectionGeometryCache> geometry_cache_{
+    std::make_shared<IntersectionGeometryCache>()};
 
   void launchNewModules(const tier4_planning_msgs::msg::PathWithLaneId & path) override;
 
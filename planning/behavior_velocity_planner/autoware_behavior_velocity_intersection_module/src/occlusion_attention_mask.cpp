@@ -0,0 +1,141 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "occlusion_attention_mask.hpp"
+
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+namespace
+{
+// the grid origin is regarded as aligned if it is off by less than this ratio of the resolution
+constexpr double alignment_tolerance = 1e-3;
+}  // namespace
+
+OcclusionAttentionMask::OcclusionAttentionMask(
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets, const nav_msgs::msg::MapMetaData & grid_info)
+: origin_(grid_info.origin.position), resolution_(grid_info.resolution)
+{
+  const auto toCell = [&](const double x, const double y) {
+    return cv::Point(
+      static_cast<int>(std::floor((x - origin_.x) / resolution_)),
+      static_cast<int>(std::floor((y - origin_.y) / resolution_)));
+  };
+
+  std::vector<std::vector<cv::Point>> attention_polygons;
+  for (const auto & attention_area : attention_areas) {
+    std::vector<cv::Point> polygon;
+    for (const auto & p : attention_area) {
+      polygon.push_back(toCell(p.x(), p.y()));
+    }
+    attention_polygons.push_back(polygon);
+  }
+  std::vector<std::vector<cv::Point>> adjacent_polygons;
+  for (const auto & adjacent_lanelet : adjacent_lanelets) {
+    std::vector<cv::Point> polygon;
+    for (const auto & p : adjacent_lanelet.polygon2d().basicPolygon()) {
+      polygon.push_back(toCell(p.x(), p.y()));
+    }
+    adjacent_polygons.push_back(polygon);
+  }
+
+  int min_x = std::numeric_limits<int>::max();
+  int min_y = std::numeric_limits<int>::max();
+  int max_x = std::numeric_limits<int>::lowest();
+  int max_y = std::numeric_limits<int>::lowest();
+  for (const auto & polygon : attention_polygons) {
+    for (const auto & p : polygon) {
+      min_x = std::min(min_x, p.x);
+      min_y = std::min(min_y, p.y);
+      max_x = std::max(max_x, p.x);
+      max_y = std::max(max_y, p.y);
+    }
+  }
+  if (min_x > max_x || min_y > max_y) {
+    return;
+  }
+  // margin for the anti-aliased edges
+  min_x_ = min_x - 1;
+  min_y_ = min_y - 1;
+  const int width = max_x - min_x + 3;
+  const int height = max_y - min_y + 3;
+
+  // attention: 255, adjacent lanes and non-attention: 0, in the image whose row is upside down
+  cv::Mat image(height, width, CV_8UC1, cv::Scalar(0));
+  const auto toImage = [&](const cv::Point & cell) {
+    return cv::Point(cell.x - min_x_, height - 1 - (cell.y - min_y_));
+  };
+  for (auto & polygon : attention_polygons) {
+    std::transform(polygon.begin(), polygon.end(), polygon.begin(), toImage);
+    cv::fillPoly(image, polygon, cv::Scalar(255), cv::LINE_AA);
+  }
+  for (auto & polygon : adjacent_polygons) {
+    std::transform(polygon.begin(), polygon.end(), polygon.begin(), toImage);
+    cv::fillPoly(image, polygon, cv::Scalar(0), cv::LINE_AA);
+  }
+
+  mask_ = BitGrid(width, height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      if (image.at<unsigned char>(height - 1 - y, x) != 0) {
+        mask_.set(x, y);
+      }
+    }
+  }
+}
+
+bool OcclusionAttentionMask::isAlignedWith(const nav_msgs::msg::MapMetaData & grid_info) const
+{
+  if (std::abs(grid_info.resolution - resolution_) > alignment_tolerance * resolution_) {
+    return false;
+  }
+  const double offset_x = (grid_info.origin.position.x - origin_.x) / resolution_;
+  const double offset_y = (grid_info.origin.position.y - origin_.y) / resolution_;
+  return std::abs(offset_x - std::round(offset_x)) < alignment_tolerance &&
+         std::abs(offset_y - std::round(offset_y)) < alignment_tolerance;
+}
+
+std::optional<std::pair<GridRegion, BitGrid>> OcclusionAttentionMask::cropToGrid(
+  const nav_msgs::msg::MapMetaData & grid_info) const
+{
+  // the cell (x, y) of the grid is the cell (x + offset_x, y + offset_y) from origin_
+  const int offset_x =
+    static_cast<int>(std::round((grid_info.origin.position.x - origin_.x) / resolution_));
+  const int offset_y =
+    static_cast<int>(std::round((grid_info.origin.position.y - origin_.y) / resolution_));
+
+  const int x_begin = std::max(min_x_ - offset_x, 0);
+  const int y_begin = std::max(min_y_ - offset_y, 0);
+  const int x_end = std::min(min_x_ - offset_x + mask_.width(), static_cast<int>(grid_info.width));
+  const int y_end =
+    std::min(min_y_ - offset_y + mask_.height(), static_cast<int>(grid_info.height));
+  if (x_begin >= x_end || y_begin >= y_end) {
+    return std::nullopt;
+  }
+
+  const GridRegion region{x_begin, y_begin, x_end - x_begin, y_end - y_begin};
+  return std::make_pair(
+    region, mask_.crop(
+              x_begin + offset_x - min_x_, y_begin + offset_y - min_y_, region.width,
+              region.height));
+}
+
+}  // namespace autoware::behavior_velocity_planner
@@ -0,0 +1,80 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OCCLUSION_ATTENTION_MASK_HPP_
+#define OCCLUSION_ATTENTION_MASK_HPP_
+
+#include "bit_grid.hpp"
+
+#include <geometry_msgs/msg/point.hpp>
+#include <nav_msgs/msg/map_meta_data.hpp>
+
+#include <lanelet2_core/primitives/CompoundPolygon.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+
+/**
+ * @brief the cells [x, x + width) x [y, y + height) of the occupancy grid
+ */
+struct GridRegion
+{
+  int x{0};
+  int y{0};
+  int width{0};
+  int height{0};
+};
+
+/**
+ * @brief occlusion attention area without the adjacent lanes, rasterized in the cells of the
+ * occupancy grid
+ * @details the occupancy grid moves with ego by a whole number of cells, so the mask is reused as
+ * long as the offset of the grid origin is a multiple of the resolution
+ */
+class OcclusionAttentionMask
+{
+public:
+  OcclusionAttentionMask(
+    const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+    const lanelet::ConstLanelets & adjacent_lanelets, const nav_msgs::msg::MapMetaData & grid_info);
+
+  /**
+   * @brief true if the cells of the grid coincide with the cells of this mask
+   */
+  bool isAlignedWith(const nav_msgs::msg::MapMetaData & grid_info) const;
+
+  /**
+   * @brief the region of the grid that covers the mask and the mask in the region, std::nullopt
+   * if the mask is out of the grid
+   */
+  std::optional<std::pair<GridRegion, BitGrid>> cropToGrid(
+    const nav_msgs::msg::MapMetaData & grid_info) const;
+
+private:
+  geometry_msgs::msg::Point origin_;
+  double resolution_;
+  //! the cell of mask_(0, 0) from origin_
+  int min_x_{0};
+  int min_y_{0};
+  BitGrid mask_;
+};
+
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // OCCLUSION_ATTENTION_MASK_HPP_
@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::behavior_velocity_planner
@@ -48,7 +49,8 @@ IntersectionModule::IntersectionModule(
   const int64_t module_id, const int64_t lane_id,
   [[maybe_unused]] std::shared_ptr<const PlannerData> planner_data,
   const PlannerParam & planner_param, const std::set<lanelet::Id> & associative_ids,
-  const std::string & turn_direction, const bool has_traffic_light, rclcpp::Node & node,
+  const std::string & turn_direction, const bool has_traffic_light,
+  std::shared_ptr<IntersectionGeometryCache> geometry_cache, rclcpp::Node & node,
   const rclcpp::Logger logger, const rclcpp::Clock::SharedPtr clock)
 : SceneModuleInterface(module_id, logger, clock),
   planner_param_(planner_param),
@@ -56,7 +58,8 @@ IntersectionModule::IntersectionModule(
   associative_ids_(associative_ids),
   turn_direction_(turn_direction),
   has_traffic_light_(has_traffic_light),
-  occlusion_uuid_(autoware::universe_utils::generateUUID())
+  occlusion_uuid_(autoware::universe_utils::generateUUID()),
+  geometry_cache_(std::move(geometry_cache))
 {
   velocity_factor_.init(PlanningBehavior::INTERSECTION);
 
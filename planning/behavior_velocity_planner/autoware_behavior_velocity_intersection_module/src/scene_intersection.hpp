@@ -17,9 +17,11 @@
 
 #include "decision_result.hpp"
 #include "interpolated_path_info.hpp"
+#include "intersection_geometry_cache.hpp"
 #include "intersection_lanelets.hpp"
 #include "intersection_stoplines.hpp"
 #include "object_manager.hpp"
+#include "occlusion_attention_mask.hpp"
 #include "result.hpp"
 
 #include <autoware/behavior_velocity_planner_common/scene_module_interface.hpp>
@@ -303,7 +305,8 @@ public:
   IntersectionModule(
     const int64_t module_id, const int64_t lane_id, std::shared_ptr<const PlannerData> planner_data,
     const PlannerParam & planner_param, const std::set<lanelet::Id> & associative_ids,
-    const std::string & turn_direction, const bool has_traffic_light, rclcpp::Node & node,
+    const std::string & turn_direction, const bool has_traffic_light,
+    std::shared_ptr<IntersectionGeometryCache> geometry_cache, rclcpp::Node & node,
     const rclcpp::Logger logger, const rclcpp::Clock::SharedPtr clock);
 
   /**
@@ -362,6 +365,9 @@ private:
 
   //! RTC uuid for INTERSECTION_OCCLUSION
   const UUID occlusion_uuid_;
+
+  //! map dependent geometry shared with the other instances of the same manager
+  const std::shared_ptr<IntersectionGeometryCache> geometry_cache_;
   /** @}*/
 
 private:
@@ -381,6 +387,9 @@ private:
   std::optional<std::vector<lanelet::ConstLineString3d>> occlusion_attention_divisions_{
     std::nullopt};
 
+  //! cache occlusion attention area rasterized in the cells of the occupancy grid
+  std::optional<OcclusionAttentionMask> occlusion_attention_mask_{std::nullopt};
+
   //! save the time when ego observed green traffic light before entering the intersection
   std::optional<rclcpp::Time> initial_green_light_observed_time_{std::nullopt};
   /** @}*/
@@ -699,7 +708,8 @@ private:
   /**
    * @brief calculate detected occlusion status(NOT | STATICALLY | DYNAMICALLY)
    * @attention this function has access to value() of intersection_lanelets_,
-   * intersection_lanelets.first_attention_area(), occlusion_attention_divisions_
+   * intersection_lanelets.first_attention_area(), occlusion_attention_divisions_,
+   * occlusion_attention_mask_
    */
   OcclusionType detectOcclusion(const InterpolatedPathInfo & interpolated_path_info) const;
   /** @} */
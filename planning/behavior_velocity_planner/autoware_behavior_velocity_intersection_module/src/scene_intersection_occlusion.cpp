@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "bit_grid.hpp"
 #include "scene_intersection.hpp"
 #include "util.hpp"
 
@@ -23,7 +24,11 @@
 
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <tuple>
+#include <vector>
 
 namespace autoware::behavior_velocity_planner
 {
@@ -102,8 +107,6 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const InterpolatedPathInfo & interpolated_path_info) const
 {
   const auto & intersection_lanelets = intersection_lanelets_.value();
-  const auto & adjacent_lanelets = intersection_lanelets.adjacent();
-  const auto & attention_areas = intersection_lanelets.occlusion_attention_area();
   const auto first_attention_area = intersection_lanelets.first_attention_area().value();
   const auto & lane_divisions = occlusion_attention_divisions_.value();
 
@@ -140,124 +143,100 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     return std::make_tuple(true, idx_x, idx_y);
   };
 
-  Polygon2d grid_poly;
-  grid_poly.outer().emplace_back(origin.x, origin.y);
-  grid_poly.outer().emplace_back(origin.x + (width - 1) * resolution, origin.y);
-  grid_poly.outer().emplace_back(
-    origin.x + (width - 1) * resolution, origin.y + (height - 1) * resolution);
-  grid_poly.outer().emplace_back(origin.x, origin.y + (height - 1) * resolution);
-  grid_poly.outer().emplace_back(origin.x, origin.y);
-  bg::correct(grid_poly);
-
-  auto findCommonCvPolygons =
-    [&](const auto & area2d, std::vector<std::vector<cv::Point>> & cv_polygons) -> void {
-    autoware::universe_utils::Polygon2d area2d_poly;
-    for (const auto & p : area2d) {
-      area2d_poly.outer().emplace_back(p.x(), p.y());
-    }
-    area2d_poly.outer().push_back(area2d_poly.outer().front());
-    bg::correct(area2d_poly);
-    std::vector<Polygon2d> common_areas;
-    bg::intersection(area2d_poly, grid_poly, common_areas);
-    if (common_areas.empty()) {
-      return;
-    }
-    for (size_t i = 0; i < common_areas.size(); ++i) {
-      common_areas[i].outer().push_back(common_areas[i].outer().front());
-      bg::correct(common_areas[i]);
-    }
-    for (const auto & common_area : common_areas) {
-      std::vector<cv::Point> cv_polygon;
-      for (const auto & p : common_area.outer()) {
-        const int idx_x = static_cast<int>((p.x() - origin.x) / resolution);
-        const int idx_y = static_cast<int>((p.y() - origin.y) / resolution);
-        cv_polygon.emplace_back(idx_x, height - 1 - idx_y);
-      }
-      cv_polygons.push_back(cv_polygon);
-    }
-  };
-
-  // (1) prepare detection area mask
-  // attention: 255
+  // (1) crop the attention mask to the grid
+  // attention: 1
   // non-attention: 0
-  // NOTE: interesting area is set to 255 for later masking
-  cv::Mat attention_mask(width, height, CV_8UC1, cv::Scalar(0));
-  std::vector<std::vector<cv::Point>> attention_area_cv_polygons;
-  for (const auto & attention_area : attention_areas) {
-    const auto area2d = lanelet::utils::to2D(attention_area);
-    findCommonCvPolygons(area2d, attention_area_cv_polygons);
-  }
-  for (const auto & poly : attention_area_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(255), cv::LINE_AA);
-  }
-  // (1.1)
-  // reset adjacent_lanelets area to 0 on attention_mask
-  std::vector<std::vector<cv::Point>> adjacent_lane_cv_polygons;
-  for (const auto & adjacent_lanelet : adjacent_lanelets) {
-    const auto area2d = adjacent_lanelet.polygon2d().basicPolygon();
-    findCommonCvPolygons(area2d, adjacent_lane_cv_polygons);
+  // NOTE: the mask is rasterized once and the following steps only process the cells of region
+  const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
+  for (const auto & blocking_attention_object_info : blocking_attention_objects) {
+    debug_data_.parked_targets.objects.push_back(
+      blocking_attention_object_info->predicted_object());
   }
-  for (const auto & poly : adjacent_lane_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(0), cv::LINE_AA);
+  const auto attention_mask_in_grid = occlusion_attention_mask_.value().cropToGrid(occ_grid.info);
+  if (!attention_mask_in_grid) {
+    return NotOccluded{std::numeric_limits<double>::infinity()};
   }
+  const auto & [region, attention_mask] = attention_mask_in_grid.value();
+  // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x], and the
+  // image of region starts from the cell (region.x, region.y + region.height - 1) of the grid
+  auto regionPixel = [&](const cv::Mat & image, const int idx_x, const int idx_y) -> unsigned char {
+    const int x = idx_x - region.x;
+    const int y = idx_y - region.y;
+    if (x < 0 || x >= region.width || y < 0 || y >= region.height) {
+      return 0;
+    }
+    return image.at<unsigned char>(region.height - 1 - y, x);
+  };
+  auto toRegionCvPoint = [&](const double x, const double y) {
+    const int idx_x = static_cast<int>(std::floor((x - origin.x) / resolution));
+    const int idx_y = static_cast<int>(std::floor((y - origin.y) / resolution));
+    return cv::Point(idx_x - region.x, region.y + region.height - 1 - idx_y);
+  };
 
   // (2) prepare unknown mask
-  // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
-  // unknown: 255
+  // unknown: 1
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
-    for (int y = 0; y < height; y++) {
+  // NOTE: the margin makes the result of morphologyEx in region the same as on the whole grid
+  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+  const int morph_margin = 2 * std::max(morph_size, 0);
+  const int unknown_x_begin = std::max(region.x - morph_margin, 0);
+  const int unknown_y_begin = std::max(region.y - morph_margin, 0);
+  const int unknown_x_end = std::min(region.x + region.width + morph_margin, width);
+  const int unknown_y_end = std::min(region.y + region.height + morph_margin, height);
+  BitGrid unknown_mask_raw(unknown_x_end - unknown_x_begin, unknown_y_end - unknown_y_begin);
+  for (int y = unknown_y_begin; y < unknown_y_end; y++) {
+    for (int x = unknown_x_begin; x < unknown_x_end; x++) {
       const int idx = y * width + x;
       const unsigned char intensity = occ_grid.data.at(idx);
       if (
         planner_param_.occlusion.free_space_max <= intensity &&
         intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
+        unknown_mask_raw.set(x - unknown_x_begin, y - unknown_y_begin);
       }
     }
   }
   // (2.1) apply morphologyEx
-  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
-  cv::morphologyEx(
-    unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
-    cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
+  auto occlusion_bits = unknown_mask_raw.open(morph_size).crop(
+    region.x - unknown_x_begin, region.y - unknown_y_begin, region.width, region.height);
 
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
   static constexpr unsigned char BLOCKED = 127;
-  cv::Mat occlusion_mask(width, height, CV_8UC1, cv::Scalar(0));
-  cv::bitwise_and(attention_mask, unknown_mask, occlusion_mask);
-  // re-use attention_mask
-  attention_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
-  // (3.1) draw all cells on attention_mask behind blocking vehicles as not occluded
-  const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
-  for (const auto & blocking_attention_object_info : blocking_attention_objects) {
-    debug_data_.parked_targets.objects.push_back(
-      blocking_attention_object_info->predicted_object());
-  }
-  std::vector<std::vector<cv::Point>> blocking_polygons;
+  occlusion_bits &= attention_mask;
+  // (3.1) draw all cells on blocking_mask behind blocking vehicles as not occluded
+  cv::Mat blocking_mask(region.height, region.width, CV_8UC1, cv::Scalar(0));
   for (const auto & blocking_attention_object_info : blocking_attention_objects) {
     const Polygon2d obj_poly =
       autoware::universe_utils::toPolygon2d(blocking_attention_object_info->predicted_object());
-    findCommonCvPolygons(obj_poly.outer(), blocking_polygons);
-  }
-  for (const auto & blocking_polygon : blocking_polygons) {
-    cv::fillPoly(attention_mask, blocking_polygon, cv::Scalar(BLOCKED), cv::LINE_AA);
+    std::vector<cv::Point> blocking_polygon;
+    for (const auto & p : obj_poly.outer()) {
+      blocking_polygon.push_back(toRegionCvPoint(p.x(), p.y()));
+    }
+    cv::fillPoly(blocking_mask, blocking_polygon, cv::Scalar(BLOCKED), cv::LINE_AA);
   }
   for (const auto & division : lane_divisions) {
     bool blocking_vehicle_found = false;
     for (const auto & point_it : division) {
       const auto [valid, idx_x, idx_y] = coord2index(point_it.x(), point_it.y());
       if (!valid) continue;
+      const int x = idx_x - region.x;
+      const int y = idx_y - region.y;
+      if (x < 0 || x >= region.width || y < 0 || y >= region.height) continue;
       if (blocking_vehicle_found) {
-        occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x) = 0;
+        occlusion_bits.set(x, y, false);
         continue;
       }
-      if (attention_mask.at<unsigned char>(height - 1 - idx_y, idx_x) == BLOCKED) {
+      if (blocking_mask.at<unsigned char>(region.height - 1 - y, x) == BLOCKED) {
         blocking_vehicle_found = true;
-        occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x) = 0;
+        occlusion_bits.set(x, y, false);
+      }
+    }
+  }
+  cv::Mat occlusion_mask(region.height, region.width, CV_8UC1, cv::Scalar(0));
+  for (int y = 0; y < region.height; ++y) {
+    for (int x = 0; x < region.width; ++x) {
+      if (occlusion_bits.get(x, y)) {
+        occlusion_mask.at<unsigned char>(region.height - 1 - y, x) = OCCLUDED;
       }
     }
   }
@@ -294,8 +273,8 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     geometry_msgs::msg::Polygon polygon_msg;
     geometry_msgs::msg::Point32 point_msg;
     for (const auto & p : approx_contour) {
-      const double glob_x = (p.x + 0.5) * resolution + origin.x;
-      const double glob_y = (height - 0.5 - p.y) * resolution + origin.y;
+      const double glob_x = (region.x + p.x + 0.5) * resolution + origin.x;
+      const double glob_y = (region.y + region.height - 0.5 - p.y) * resolution + origin.y;
       point_msg.x = glob_x;
       point_msg.y = glob_y;
       point_msg.z = origin.z;
@@ -304,7 +283,7 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     debug_data_.occlusion_polygons.push_back(polygon_msg);
   }
   // (4.1) re-draw occluded cells using valid_contours
-  occlusion_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  occlusion_mask = cv::Mat(region.height, region.width, CV_8UC1, cv::Scalar(0));
   for (const auto & valid_contour : valid_contours) {
     // NOTE: drawContour does not work well
     cv::fillPoly(occlusion_mask, valid_contour, cv::Scalar(OCCLUDED), cv::LINE_AA);
@@ -394,7 +373,7 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
       acc_dist_it = point_it;
       const auto [valid, idx_x, idx_y] = coord2index(point_it->x(), point_it->y());
       if (!valid) continue;
-      const auto pixel = occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x);
+      const auto pixel = regionPixel(occlusion_mask, idx_x, idx_y);
       if (pixel == BLOCKED) {
         break;
       }
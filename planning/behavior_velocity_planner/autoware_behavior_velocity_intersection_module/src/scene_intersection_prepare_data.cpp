@@ -202,9 +202,13 @@ Result<IntersectionModule::BasicData, InternalError> IntersectionModule::prepare
     path->points, current_pose.position,
     path_ip.points.at(path_ip_intersection_end).point.pose.position);
 
+  if (!intersection_lanelets_) {
+    intersection_lanelets_ = geometry_cache_->findLanelets(lanelet_map_ptr, lane_id_);
+  }
   if (!intersection_lanelets_) {
     intersection_lanelets_ =
       generateObjectiveLanelets(lanelet_map_ptr, routing_graph_ptr, assigned_lanelet);
+    geometry_cache_->storeLanelets(lanelet_map_ptr, lane_id_, intersection_lanelets_.value());
   }
   auto & intersection_lanelets = intersection_lanelets_.value();
   debug_data_.attention_area = intersection_lanelets.attention_area();
@@ -265,9 +269,26 @@ Result<IntersectionModule::BasicData, InternalError> IntersectionModule::prepare
   const auto & path_lanelets = path_lanelets_opt.value();
 
   if (!occlusion_attention_divisions_) {
-    occlusion_attention_divisions_ = generateDetectionLaneDivisions(
-      intersection_lanelets.occlusion_attention(), intersection_lanelets.attention_non_preceding(),
-      routing_graph_ptr, planner_data_->occupancy_grid->info.resolution);
+    const double resolution = planner_data_->occupancy_grid->info.resolution;
+    occlusion_attention_divisions_ = geometry_cache_->findOcclusionAttentionDivisions(
+      lanelet_map_ptr, lane_id_, resolution, is_prioritized);
+    if (!occlusion_attention_divisions_) {
+      occlusion_attention_divisions_ = generateDetectionLaneDivisions(
+        intersection_lanelets.occlusion_attention(), intersection_lanelets.attention_non_preceding(),
+        routing_graph_ptr, resolution);
+      geometry_cache_->storeOcclusionAttentionDivisions(
+        lanelet_map_ptr, lane_id_, resolution, is_prioritized,
+        occlusion_attention_divisions_.value());
+    }
+  }
+  // NOTE: the occupancy grid moves by a whole number of cells, so this is rarely re-generated
+  const auto & occ_grid_info = planner_data_->occupancy_grid->info;
+  if (
+    planner_param_.occlusion.enable &&
+    (!occlusion_attention_mask_ || !occlusion_attention_mask_->isAlignedWith(occ_grid_info))) {
+    occlusion_attention_mask_.emplace(
+      intersection_lanelets.occlusion_attention_area(), intersection_lanelets.adjacent(),
+      occ_grid_info);
   }
 
   if (has_traffic_light_) {
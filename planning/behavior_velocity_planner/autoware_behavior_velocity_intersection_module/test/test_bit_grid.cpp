@@ -0,0 +1,114 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/bit_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using autoware::behavior_velocity_planner::BitGrid;
+
+namespace
+{
+// erosion or dilation on the image, whose row is (height - 1 - y), in the way of cv
+std::vector<std::vector<bool>> morphImage(
+  const std::vector<std::vector<bool>> & image, const int kernel_size, const bool is_erode)
+{
+  const int rows = static_cast<int>(image.size());
+  const int cols = static_cast<int>(image.front().size());
+  const int anchor = kernel_size / 2;
+  auto result = image;
+  for (int r = 0; r < rows; ++r) {
+    for (int c = 0; c < cols; ++c) {
+      bool value = is_erode;
+      for (int j = 0; j < kernel_size; ++j) {
+        for (int i = 0; i < kernel_size; ++i) {
+          const int src_r = r + j - anchor;
+          const int src_c = c + i - anchor;
+          if (src_r < 0 || src_r >= rows || src_c < 0 || src_c >= cols) {
+            continue;
+          }
+          value = is_erode ? (value && image[src_r][src_c]) : (value || image[src_r][src_c]);
+        }
+      }
+      result[r][c] = value;
+    }
+  }
+  return result;
+}
+}  // namespace
+
+TEST(TestBitGrid, crop)
+{
+  BitGrid grid(130, 3);
+  grid.set(0, 0);
+  grid.set(64, 1);
+  grid.set(129, 2);
+
+  const auto cropped = grid.crop(64, 1, 70, 3, true);
+  EXPECT_EQ(cropped.width(), 70);
+  EXPECT_EQ(cropped.height(), 3);
+  EXPECT_TRUE(cropped.get(0, 0));
+  EXPECT_FALSE(cropped.get(1, 0));
+  EXPECT_TRUE(cropped.get(65, 1));
+  EXPECT_TRUE(cropped.get(66, 1));  // out of the grid
+  EXPECT_TRUE(cropped.get(0, 2));   // out of the grid
+
+  const auto shifted = grid.crop(-1, 0, 130, 1);
+  EXPECT_FALSE(shifted.get(0, 0));
+  EXPECT_TRUE(shifted.get(1, 0));
+}
+
+TEST(TestBitGrid, open)
+{
+  std::mt19937 engine(0);
+  std::bernoulli_distribution distribution(0.7);
+  const int width = 150;
+  const int height = 40;
+  BitGrid grid(width, height);
+  std::vector<std::vector<bool>> image(height, std::vector<bool>(width, false));
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      if (distribution(engine)) {
+        grid.set(x, y);
+        image[height - 1 - y][x] = true;
+      }
+    }
+  }
+
+  for (const int kernel_size : {1, 2, 3, 4, 5}) {
+    const auto expected = morphImage(morphImage(image, kernel_size, true), kernel_size, false);
+    const auto opened = grid.open(kernel_size);
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        ASSERT_EQ(opened.get(x, y), expected[height - 1 - y][x])
+          << "kernel_size: " << kernel_size << ", x: " << x << ", y: " << y;
+      }
+    }
+  }
+}
+
+TEST(TestBitGrid, and)
+{
+  BitGrid lhs(70, 1);
+  BitGrid rhs(70, 1);
+  lhs.set(3, 0);
+  lhs.set(66, 0);
+  rhs.set(66, 0);
+  lhs &= rhs;
+  EXPECT_FALSE(lhs.get(3, 0));
+  EXPECT_TRUE(lhs.get(66, 0));
+}
@@ -24,6 +24,7 @@
 #include <autoware/universe_utils/math/normalization.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <algorithm>
 #include <deque>
 #include <functional>
 #include <limits>
@@ -445,14 +446,25 @@ std::optional<PossibleCollisionInfo> generateOneNotableCollisionFromOcclusionSpo
   PossibleCollisionInfo candidate;
   bool has_collision = false;
   const auto & partition_lanelets = debug_data.close_partition;
-  for (const grid_map::Position & occlusion_spot_position : occlusion_spot_positions) {
+  // NOTE: the occlusion spots are checked from the nearest one so that the expensive collision
+  //       check is skipped once a collision free occlusion spot is found
+  std::vector<std::pair<double, size_t>> sorted_occlusion_spots;
+  sorted_occlusion_spots.reserve(occlusion_spot_positions.size());
+  for (size_t i = 0; i < occlusion_spot_positions.size(); ++i) {
+    const auto & p = occlusion_spot_positions.at(i);
+    sorted_occlusion_spots.emplace_back(
+      std::hypot(base_point.x() - p[0], base_point.y() - p[1]), i);
+  }
+  std::stable_sort(
+    sorted_occlusion_spots.begin(), sorted_occlusion_spots.end(),
+    [](const auto & a, const auto & b) { return a.first < b.first; });
+  for (const auto & [dist, spot_idx] : sorted_occlusion_spots) {
+    // the remaining occlusion spots are farther than the candidate
+    if (distance_lower_bound < dist) break;
+    const grid_map::Position & occlusion_spot_position = occlusion_spot_positions.at(spot_idx);
     // arc intersection
     const lanelet::BasicPoint2d obstacle_point = {
       occlusion_spot_position[0], occlusion_spot_position[1]};
-    const double dist =
-      std::hypot(base_point.x() - obstacle_point[0], base_point.y() - obstacle_point[1]);
-    // skip if absolute distance is larger
-    if (distance_lower_bound < dist) continue;
     lanelet::ArcCoordinates arc_coord_occlusion_point =
       lanelet::geometry::toArcCoordinates(path_lanelet.centerline2d(), obstacle_point);
     const double length_to_col = arc_coord_occlusion_point.length - baselink_to_front;
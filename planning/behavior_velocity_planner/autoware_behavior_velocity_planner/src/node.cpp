@@ -122,6 +122,8 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   planner_data_.is_simulation = declare_parameter<bool>("is_simulation");
 
   // Initialize PlannerManager
+  planner_manager_.setNumThreads(
+    static_cast<int>(declare_parameter<int>("num_threads_for_scene_modules")));
   for (const auto & name : declare_parameter<std::vector<std::string>>("launch_modules")) {
     // workaround: Since ROS 2 can't get empty list, launcher set [''] on the parameter.
     if (name == "") {
@@ -179,6 +181,14 @@ void BehaviorVelocityPlannerNode::onExternalVelocityLimit(const VelocityLimit::C
 void BehaviorVelocityPlannerNode::processNoGroundPointCloud(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
+  // the pointcloud already transformed by e.g. planning_topic_converter is used as it is
+  if (msg->header.frame_id == "map") {
+    pcl::PointCloud<pcl::PointXYZ>::Ptr pc(new pcl::PointCloud<pcl::PointXYZ>);
+    pcl::fromROSMsg(*msg, *pc);
+    planner_data_.no_ground_pointcloud = pc;
+    return;
+  }
+
   geometry_msgs::msg::TransformStamped transform;
   try {
     transform = tf_buffer_.lookupTransform(
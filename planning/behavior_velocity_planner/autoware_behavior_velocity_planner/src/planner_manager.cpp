@@ -14,10 +14,17 @@
 
 #include "planner_manager.hpp"
 
+#include <autoware/motion_utils/trajectory/trajectory.hpp>
+#include <autoware/universe_utils/geometry/geometry.hpp>
+
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace autoware::behavior_velocity_planner
 {
@@ -47,6 +54,66 @@ diagnostic_msgs::msg::DiagnosticStatus makeStopReasonDiag(
   stop_reason_diag.values.push_back(stop_reason_diag_kv);
   return stop_reason_diag;
 }
+
+std::vector<double> calcArcLengths(const tier4_planning_msgs::msg::PathWithLaneId & path)
+{
+  std::vector<double> arc_lengths(path.points.size(), 0.0);
+  for (size_t i = 1; i < path.points.size(); ++i) {
+    arc_lengths.at(i) =
+      arc_lengths.at(i - 1) + autoware::universe_utils::calcDistance2d(
+                                path.points.at(i - 1).point.pose, path.points.at(i).point.pose);
+  }
+  return arc_lengths;
+}
+
+// merge the velocity limits that a scene module applied to its own copy of the path. the points
+// that the module inserted are added, and the velocity of each point is the minimum of both paths,
+// where the velocity of a path holds from its point to the next one.
+void mergeVelocityLimits(
+  const tier4_planning_msgs::msg::PathWithLaneId & module_path,
+  tier4_planning_msgs::msg::PathWithLaneId & merged_path)
+{
+  constexpr double epsilon = 1e-3;
+
+  if (module_path.points.empty()) {
+    return;
+  }
+  const auto merged_arc_lengths = calcArcLengths(merged_path);
+  const auto module_arc_lengths = calcArcLengths(module_path);
+
+  std::vector<tier4_planning_msgs::msg::PathPointWithLaneId> points;
+  points.reserve(merged_path.points.size() + module_path.points.size());
+  size_t i = 0;
+  size_t j = 0;
+  while (i < merged_path.points.size() || j < module_path.points.size()) {
+    const double merged_s = i < merged_path.points.size() ? merged_arc_lengths.at(i)
+                                                          : std::numeric_limits<double>::max();
+    const double module_s = j < module_path.points.size() ? module_arc_lengths.at(j)
+                                                          : std::numeric_limits<double>::max();
+    if (std::abs(merged_s - module_s) < epsilon) {
+      auto point = merged_path.points.at(i++);
+      point.point.longitudinal_velocity_mps = std::min(
+        point.point.longitudinal_velocity_mps,
+        module_path.points.at(j++).point.longitudinal_velocity_mps);
+      points.push_back(point);
+    } else if (merged_s < module_s) {
+      auto point = merged_path.points.at(i++);
+      point.point.longitudinal_velocity_mps = std::min(
+        point.point.longitudinal_velocity_mps,
+        module_path.points.at(j == 0 ? 0 : j - 1).point.longitudinal_velocity_mps);
+      points.push_back(point);
+    } else {
+      auto point = module_path.points.at(j++);
+      if (i != 0) {
+        point.point.longitudinal_velocity_mps = std::min(
+          point.point.longitudinal_velocity_mps,
+          merged_path.points.at(i - 1).point.longitudinal_velocity_mps);
+      }
+      points.push_back(point);
+    }
+  }
+  merged_path.points = std::move(points);
+}
 }  // namespace
 
 BehaviorVelocityPlannerManager::BehaviorVelocityPlannerManager()
@@ -55,6 +122,11 @@ BehaviorVelocityPlannerManager::BehaviorVelocityPlannerManager()
 {
 }
 
+void BehaviorVelocityPlannerManager::setNumThreads(const int num_threads)
+{
+  num_threads_ = std::max(num_threads, 1);
+}
+
 void BehaviorVelocityPlannerManager::launchScenePlugin(
   rclcpp::Node & node, const std::string & name)
 {
@@ -106,15 +178,60 @@ tier4_planning_msgs::msg::PathWithLaneId BehaviorVelocityPlannerManager::planPat
   int first_stop_path_point_index = static_cast<int>(output_path_msg.points.size() - 1);
   std::string stop_reason_msg("path_end");
 
-  for (const auto & plugin : scene_manager_plugins_) {
-    plugin->updateSceneModuleInstances(planner_data, input_path_msg);
-    plugin->plan(&output_path_msg);
-    const auto firstStopPathPointIndex = plugin->getFirstStopPathPointIndex();
+  if (num_threads_ <= 1 || scene_manager_plugins_.size() <= 1) {
+    for (const auto & plugin : scene_manager_plugins_) {
+      plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+      plugin->plan(&output_path_msg);
+      const auto firstStopPathPointIndex = plugin->getFirstStopPathPointIndex();
+
+      if (firstStopPathPointIndex) {
+        if (firstStopPathPointIndex.value() < first_stop_path_point_index) {
+          first_stop_path_point_index = firstStopPathPointIndex.value();
+          stop_reason_msg = plugin->getModuleName();
+        }
+      }
+    }
+  } else {
+    // the scene modules only limit the velocity of the path, so each plugin plans on its own copy
+    // of the input path concurrently and the results are merged in the order of the plugins.
+    const auto num_plugins = scene_manager_plugins_.size();
+    std::vector<tier4_planning_msgs::msg::PathWithLaneId> module_paths(num_plugins, input_path_msg);
+    std::vector<std::optional<double>> stop_arc_lengths(num_plugins);
+    const auto num_threads = std::min(num_threads_, static_cast<int>(num_plugins));
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (size_t i = 0; i < num_plugins; ++i) {
+      const auto & plugin = scene_manager_plugins_.at(i);
+      plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+      plugin->plan(&module_paths.at(i));
+      const auto & module_path = module_paths.at(i);
+      const auto stop_idx = plugin->getFirstStopPathPointIndex();
+      if (stop_idx && 0 <= *stop_idx && *stop_idx < static_cast<int>(module_path.points.size())) {
+        stop_arc_lengths.at(i) = autoware::motion_utils::calcSignedArcLength(
+          module_path.points, 0, static_cast<size_t>(*stop_idx));
+      }
+    }
+
+    std::optional<double> first_stop_arc_length;
+    for (size_t i = 0; i < num_plugins; ++i) {
+      mergeVelocityLimits(module_paths.at(i), output_path_msg);
+      const auto & stop_arc_length = stop_arc_lengths.at(i);
+      if (!stop_arc_length) {
+        continue;
+      }
+      if (!first_stop_arc_length || *stop_arc_length < *first_stop_arc_length) {
+        first_stop_arc_length = stop_arc_length;
+        stop_reason_msg = scene_manager_plugins_.at(i)->getModuleName();
+      }
+    }
 
-    if (firstStopPathPointIndex) {
-      if (firstStopPathPointIndex.value() < first_stop_path_point_index) {
-        first_stop_path_point_index = firstStopPathPointIndex.value();
-        stop_reason_msg = plugin->getModuleName();
+    first_stop_path_point_index = static_cast<int>(output_path_msg.points.size() - 1);
+    if (first_stop_arc_length) {
+      const auto merged_arc_lengths = calcArcLengths(output_path_msg);
+      const auto it = std::lower_bound(
+        merged_arc_lengths.begin(), merged_arc_lengths.end(), *first_stop_arc_length - 1e-3);
+      if (it != merged_arc_lengths.end()) {
+        first_stop_path_point_index =
+          static_cast<int>(std::distance(merged_arc_lengths.begin(), it));
       }
     }
   }
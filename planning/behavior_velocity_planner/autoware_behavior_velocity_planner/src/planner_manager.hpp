@@ -43,6 +43,7 @@ class BehaviorVelocityPlannerManager
 {
 public:
   BehaviorVelocityPlannerManager();
+  void setNumThreads(const int num_threads);
   void launchScenePlugin(rclcpp::Node & node, const std::string & name);
   void removeScenePlugin(rclcpp::Node & node, const std::string & name);
 
@@ -56,6 +57,9 @@ private:
   diagnostic_msgs::msg::DiagnosticStatus stop_reason_diag_;
   pluginlib::ClassLoader<PluginInterface> plugin_loader_;
   std::vector<std::shared_ptr<PluginInterface>> scene_manager_plugins_;
+
+  // number of threads to run the scene module managers concurrently, 1 runs them one by one
+  int num_threads_{1};
 };
 }  // namespace autoware::behavior_velocity_planner
 
@@ -0,0 +1,165 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_planning_test_manager/autoware_planning_benchmark_manager.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_perception_msgs/msg/traffic_light_group_array.hpp>
+#include <autoware_planning_msgs/msg/path.hpp>
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <tier4_planning_msgs/msg/path_with_lane_id.hpp>
+#include <tier4_planning_msgs/msg/velocity_limit.hpp>
+#include <tier4_v2x_msgs/msg/virtual_traffic_light_state_array.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using autoware::behavior_velocity_planner::BehaviorVelocityPlannerNode;
+using autoware::planning_test_manager::PlanningBenchmarkManager;
+using autoware_perception_msgs::msg::PredictedObjects;
+using autoware_perception_msgs::msg::TrafficLightGroupArray;
+using autoware_planning_msgs::msg::Path;
+using geometry_msgs::msg::AccelWithCovarianceStamped;
+using nav_msgs::msg::Odometry;
+using sensor_msgs::msg::PointCloud2;
+using tier4_planning_msgs::msg::PathWithLaneId;
+using tier4_planning_msgs::msg::VelocityLimit;
+using tier4_v2x_msgs::msg::VirtualTrafficLightStateArray;
+
+// the planner without any module if the plugin name is empty
+std::shared_ptr<BehaviorVelocityPlannerNode> generateNode(
+  const std::string & plugin_name, const std::string & module)
+{
+  auto node_options = rclcpp::NodeOptions{};
+
+  const auto autoware_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("autoware_test_utils");
+  const auto behavior_velocity_planner_dir =
+    ament_index_cpp::get_package_share_directory("autoware_behavior_velocity_planner");
+  const auto velocity_smoother_dir =
+    ament_index_cpp::get_package_share_directory("autoware_velocity_smoother");
+
+  std::vector<std::string> params_files{
+    autoware_test_utils_dir + "/config/test_common.param.yaml",
+    autoware_test_utils_dir + "/config/test_nearest_search.param.yaml",
+    autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+    velocity_smoother_dir + "/config/default_velocity_smoother.param.yaml",
+    velocity_smoother_dir + "/config/Analytical.param.yaml",
+    behavior_velocity_planner_dir + "/config/behavior_velocity_planner.param.yaml"};
+  std::vector<std::string> module_names;
+  if (!plugin_name.empty()) {
+    const auto package_name = "autoware_behavior_velocity_" + module + "_module";
+    params_files.push_back(
+      ament_index_cpp::get_package_share_directory(package_name) + "/config/" + module +
+      ".param.yaml");
+    module_names.push_back(plugin_name);
+  }
+
+  std::vector<rclcpp::Parameter> params;
+  params.emplace_back("launch_modules", module_names);
+  params.emplace_back("is_simulation", false);
+  node_options.parameter_overrides(params);
+  autoware::test_utils::updateNodeOptions(node_options, params_files);
+
+  return std::make_shared<BehaviorVelocityPlannerNode>(node_options);
+}
+
+static void BM_BehaviorVelocityPlanner(
+  benchmark::State & state, const std::string & plugin_name, const std::string & module)
+{
+  rclcpp::init(0, nullptr);
+  {
+    PlanningBenchmarkManager benchmark_manager;
+    auto test_target_node = generateNode(plugin_name, module);
+
+    const auto path = autoware::test_utils::loadPathWithLaneIdInYaml();
+    Odometry odometry;
+    odometry.header = path.header;
+    odometry.pose.pose = path.points.front().point.pose;
+
+    benchmark_manager.publish(
+      test_target_node, "/tf",
+      autoware::test_utils::makeTFMsg(test_target_node, "base_link", "map"));
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/accel",
+      benchmark_manager.getSnapshotField("self_acceleration", AccelWithCovarianceStamped{}));
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/dynamic_objects",
+      benchmark_manager.getSnapshotField("dynamic_object", PredictedObjects{}));
+    PointCloud2 point_cloud;
+    point_cloud.header.frame_id = "base_link";
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/no_ground_pointcloud", point_cloud);
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/vehicle_odometry",
+      benchmark_manager.getSnapshotField("self_odometry", odometry));
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/vector_map",
+      benchmark_manager.getMap());
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/traffic_signals",
+      benchmark_manager.getSnapshotField("traffic_signal", TrafficLightGroupArray{}));
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/external_velocity_limit_mps",
+      VelocityLimit{});
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/virtual_traffic_light_states",
+      VirtualTrafficLightStateArray{});
+    benchmark_manager.publish(
+      test_target_node, "behavior_velocity_planner_node/input/occupancy_grid",
+      autoware::test_utils::makeCostMapMsg());
+
+    benchmark_manager.benchmarkWithInput<PathWithLaneId, Path>(
+      state, test_target_node, "behavior_velocity_planner_node/input/path_with_lane_id", path,
+      "behavior_velocity_planner_node/output/path");
+  }
+  rclcpp::shutdown();
+}
+
+// the planner without any module, and with each module
+BENCHMARK_CAPTURE(BM_BehaviorVelocityPlanner, none, std::string(), std::string())
+  ->UseManualTime()
+  ->Iterations(100)
+  ->Unit(benchmark::kMillisecond);
+
+#define BENCHMARK_BEHAVIOR_VELOCITY_MODULE(plugin, module)                             \
+  BENCHMARK_CAPTURE(                                                                   \
+    BM_BehaviorVelocityPlanner, plugin,                                                \
+    std::string("autoware::behavior_velocity_planner::" #plugin), std::string(module)) \
+    ->UseManualTime()                                                                  \
+    ->Iterations(100)                                                                  \
+    ->Unit(benchmark::kMillisecond)
+
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(BlindSpotModulePlugin, "blind_spot");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(CrosswalkModulePlugin, "crosswalk");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(DetectionAreaModulePlugin, "detection_area");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(IntersectionModulePlugin, "intersection");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(MergeFromPrivateModulePlugin, "intersection");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(NoDrivableLaneModulePlugin, "no_drivable_lane");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(NoStoppingAreaModulePlugin, "no_stopping_area");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(OcclusionSpotModulePlugin, "occlusion_spot");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(RunOutModulePlugin, "run_out");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(SpeedBumpModulePlugin, "speed_bump");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(StopLineModulePlugin, "stop_line");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(TrafficLightModulePlugin, "traffic_light");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(VirtualTrafficLightModulePlugin, "virtual_traffic_light");
+BENCHMARK_BEHAVIOR_VELOCITY_MODULE(WalkwayModulePlugin, "walkway");
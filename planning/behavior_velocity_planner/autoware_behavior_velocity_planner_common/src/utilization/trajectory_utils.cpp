@@ -32,6 +32,7 @@
 #endif
 
 #include <memory>
+#include <mutex>
 
 namespace autoware::behavior_velocity_planner
 {
@@ -43,6 +44,12 @@ using TrajectoryPoints = std::vector<TrajectoryPoint>;
 using geometry_msgs::msg::Quaternion;
 using TrajectoryPointWithIdx = std::pair<TrajectoryPoint, size_t>;
 
+namespace
+{
+// the smoother of the planner data is shared by the scene modules, which may run concurrently
+std::mutex smoother_mutex;
+}  // namespace
+
 //! smooth path point with lane id starts from ego position on path to the path end
 bool smoothPath(
   const PathWithLaneId & in_path, PathWithLaneId & out_path,
@@ -76,9 +83,12 @@ bool smoothPath(
   TrajectoryPoints traj_smoothed;
   clipped.insert(
     clipped.end(), traj_resampled.begin() + traj_resampled_closest, traj_resampled.end());
-  if (!smoother->apply(v0, a0, clipped, traj_smoothed, debug_trajectories, false)) {
-    std::cerr << "[behavior_velocity][trajectory_utils]: failed to smooth" << std::endl;
-    return false;
+  {
+    std::lock_guard<std::mutex> lock(smoother_mutex);
+    if (!smoother->apply(v0, a0, clipped, traj_smoothed, debug_trajectories, false)) {
+      std::cerr << "[behavior_velocity][trajectory_utils]: failed to smooth" << std::endl;
+      return false;
+    }
   }
   traj_smoothed.insert(
     traj_smoothed.begin(), traj_resampled.begin(), traj_resampled.begin() + traj_resampled_closest);
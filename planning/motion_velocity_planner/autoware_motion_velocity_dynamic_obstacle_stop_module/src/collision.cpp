@@ -33,12 +33,12 @@ std::optional<geometry_msgs::msg::Point> find_closest_collision_point(
 {
   std::optional<geometry_msgs::msg::Point> closest_collision_point;
   auto closest_dist = std::numeric_limits<double>::max();
-  std::vector<BoxIndexPair> rough_collisions;
-  ego_data.rtree.query(
+  std::vector<RtreeNode> rough_collisions;
+  ego_data.trajectory_footprints->get_rtree()->query(
     boost::geometry::index::intersects(object_footprint), std::back_inserter(rough_collisions));
   for (const auto & rough_collision : rough_collisions) {
     const auto traj_idx = rough_collision.second;
-    const auto & ego_footprint = ego_data.trajectory_footprints[traj_idx];
+    const auto & ego_footprint = ego_data.trajectory_footprints->trajectory_footprints()[traj_idx];
     const auto & ego_pose = ego_data.trajectory[traj_idx].pose;
     const auto angle_diff = autoware::universe_utils::normalizeRadian(
       tf2::getYaw(ego_pose.orientation) - tf2::getYaw(object_pose.orientation));
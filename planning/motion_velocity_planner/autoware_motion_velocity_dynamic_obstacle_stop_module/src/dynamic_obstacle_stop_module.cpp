@@ -122,7 +122,7 @@ VelocityPlanningResult DynamicObstacleStopModule::plan(
   ego_data.earliest_stop_pose = autoware::motion_utils::calcLongitudinalOffsetPose(
     ego_data.trajectory, ego_data.pose.position, min_stop_distance);
 
-  dynamic_obstacle_stop::make_ego_footprint_rtree(ego_data, params_);
+  dynamic_obstacle_stop::make_ego_footprint_rtree(ego_data, params_, *planner_data);
   double hysteresis =
     std::find_if(
       object_map_.begin(), object_map_.end(),
@@ -181,7 +181,7 @@ VelocityPlanningResult DynamicObstacleStopModule::plan(
     "Total time = %2.2fus\n\tpreprocessing = %2.2fus\n\tfootprints = "
     "%2.2fus\n\tcollisions = %2.2fus\n",
     total_time_us, preprocessing_duration_us, footprints_duration_us, collisions_duration_us);
-  debug_data_.ego_footprints = ego_data.trajectory_footprints;
+  debug_data_.ego_footprints = ego_data.trajectory_footprints->trajectory_footprints();
   debug_data_.obstacle_footprints = obstacle_forward_footprints;
   debug_data_.z = ego_data.pose.position.z;
   std::map<std::string, double> processing_times;
@@ -18,8 +18,6 @@
 
 #include <geometry_msgs/msg/pose.hpp>
 
-#include <boost/geometry/algorithms/envelope.hpp>
-
 #include <lanelet2_core/geometry/Polygon.h>
 #include <tf2/utils.h>
 
@@ -69,19 +67,16 @@ autoware::universe_utils::Polygon2d project_to_pose(
   return footprint;
 }
 
-void make_ego_footprint_rtree(EgoData & ego_data, const PlannerParam & params)
+void make_ego_footprint_rtree(
+  EgoData & ego_data, const PlannerParam & params, const PlannerData & planner_data)
 {
-  for (const auto & p : ego_data.trajectory)
-    ego_data.trajectory_footprints.push_back(autoware::universe_utils::toFootprint(
-      p.pose, params.ego_longitudinal_offset, 0.0, params.ego_lateral_offset * 2.0));
-  std::vector<BoxIndexPair> rtree_nodes;
-  rtree_nodes.reserve(ego_data.trajectory_footprints.size());
-  for (auto i = 0UL; i < ego_data.trajectory_footprints.size(); ++i) {
-    const auto box = boost::geometry::return_envelope<autoware::universe_utils::Box2d>(
-      ego_data.trajectory_footprints[i]);
-    rtree_nodes.emplace_back(box, i);
-  }
-  ego_data.rtree = Rtree(rtree_nodes);
+  FootprintParameters footprint_params;
+  footprint_params.front_offset = params.ego_longitudinal_offset;
+  footprint_params.rear_offset = 0.0;
+  footprint_params.left_offset = params.ego_lateral_offset;
+  footprint_params.right_offset = -params.ego_lateral_offset;
+  ego_data.trajectory_footprints =
+    planner_data.get_trajectory_collision_checker(ego_data.trajectory, footprint_params);
 }
 
 }  // namespace autoware::motion_velocity_planner::dynamic_obstacle_stop
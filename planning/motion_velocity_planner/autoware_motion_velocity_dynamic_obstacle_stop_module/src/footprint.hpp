@@ -17,6 +17,7 @@
 
 #include "types.hpp"
 
+#include <autoware/motion_velocity_planner_common/planner_data.hpp>
 #include <autoware/universe_utils/geometry/geometry.hpp>
 
 #include <vector>
@@ -47,10 +48,13 @@ autoware::universe_utils::Polygon2d make_forward_footprint(
 autoware::universe_utils::Polygon2d project_to_pose(
   const autoware::universe_utils::Polygon2d & base_footprint,
   const geometry_msgs::msg::Pose & pose);
-/// @brief create the rtree indexing the ego footprint along the trajectory
+/// @brief get the rtree indexing the ego footprint along the trajectory
+/// @details the footprints are shared with the other modules using the same trajectory and offsets
 /// @param [inout] ego_data ego data with its trajectory and the rtree to populate
 /// @param [in] params parameters
-void make_ego_footprint_rtree(EgoData & ego_data, const PlannerParam & params);
+/// @param [in] planner_data planner data providing the ego footprints
+void make_ego_footprint_rtree(
+  EgoData & ego_data, const PlannerParam & params, const PlannerData & planner_data);
 }  // namespace autoware::motion_velocity_planner::dynamic_obstacle_stop
 
 #endif  // FOOTPRINT_HPP_
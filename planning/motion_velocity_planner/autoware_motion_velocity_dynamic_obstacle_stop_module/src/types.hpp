@@ -15,6 +15,7 @@
 #ifndef TYPES_HPP_
 #define TYPES_HPP_
 
+#include <autoware/motion_velocity_planner_common/collision_checker.hpp>
 #include <autoware/universe_utils/geometry/boost_geometry.hpp>
 #include <rclcpp/time.hpp>
 
@@ -22,8 +23,7 @@
 #include <autoware_planning_msgs/msg/trajectory_point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 
-#include <boost/geometry/index/rtree.hpp>
-
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
@@ -32,8 +32,6 @@
 namespace autoware::motion_velocity_planner::dynamic_obstacle_stop
 {
 using TrajectoryPoints = std::vector<autoware_planning_msgs::msg::TrajectoryPoint>;
-using BoxIndexPair = std::pair<autoware::universe_utils::Box2d, size_t>;
-using Rtree = boost::geometry::index::rtree<BoxIndexPair, boost::geometry::index::rstar<16, 4>>;
 
 /// @brief parameters for the "out of lane" module
 struct PlannerParam
@@ -57,8 +55,8 @@ struct EgoData
   size_t first_trajectory_idx{};
   double longitudinal_offset_to_first_trajectory_idx;  // [m]
   geometry_msgs::msg::Pose pose;
-  autoware::universe_utils::MultiPolygon2d trajectory_footprints;
-  Rtree rtree;
+  // ego footprints along the trajectory and their rtree
+  std::shared_ptr<const CollisionChecker> trajectory_footprints;
   std::optional<geometry_msgs::msg::Pose> earliest_stop_pose;
 };
 
@@ -12,17 +12,26 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "../src/distance.hpp"
 #include "../src/obstacles.hpp"
+#include "../src/parameters.hpp"
 #include "../src/types.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <random>
+#include <vector>
 
 using autoware::motion_velocity_planner::obstacle_velocity_limiter::CollisionChecker;
+using autoware::motion_velocity_planner::obstacle_velocity_limiter::distancesToClosestCollision;
 using autoware::motion_velocity_planner::obstacle_velocity_limiter::linestring_t;
+using autoware::motion_velocity_planner::obstacle_velocity_limiter::multi_linestring_t;
 using autoware::motion_velocity_planner::obstacle_velocity_limiter::Obstacles;
 using autoware::motion_velocity_planner::obstacle_velocity_limiter::point_t;
 using autoware::motion_velocity_planner::obstacle_velocity_limiter::polygon_t;
+using autoware::motion_velocity_planner::obstacle_velocity_limiter::ProjectionParameters;
+using autoware::motion_velocity_planner::obstacle_velocity_limiter::TrajectoryPoints;
 
 point_t random_point()
 {
@@ -52,6 +61,48 @@ polygon_t random_polygon()
   return polygon;
 }
 
+int64_t percentile(std::vector<int64_t> times, const double ratio)
+{
+  const auto idx = static_cast<size_t>(ratio * static_cast<double>(times.size() - 1));
+  std::nth_element(times.begin(), times.begin() + idx, times.end());
+  return times[idx];
+}
+
+// distances to collision of all the points of a trajectory, as done by the module at each cycle
+void benchmark_distances(const CollisionChecker & collision_checker)
+{
+  constexpr auto nb_trajectory_points = 100lu;
+  constexpr auto nb_runs = 200lu;
+  TrajectoryPoints trajectory(nb_trajectory_points);
+  std::vector<multi_linestring_t> projections;
+  std::vector<polygon_t> footprints;
+  for (auto & point : trajectory) {
+    const auto footprint = random_polygon();
+    const auto & origin = footprint.outer().front();
+    point.pose.position.x = origin.x();
+    point.pose.position.y = origin.y();
+    point.pose.orientation.w = 1.0;
+    projections.push_back({{origin, point_t{origin.x() + 4, origin.y()}}});
+    footprints.push_back(footprint);
+  }
+  ProjectionParameters params;
+  std::printf("nb_threads, p50 [ns], p99 [ns]\n");
+  for (const auto nb_threads : {1l, 2l, 4l, 8l}) {
+    params.nb_threads = nb_threads;
+    std::vector<int64_t> times;
+    times.reserve(nb_runs);
+    for (auto run = 0lu; run < nb_runs; ++run) {
+      const auto start = std::chrono::system_clock::now();
+      // cppcheck-suppress unreadVariable
+      const auto distances =
+        distancesToClosestCollision(trajectory, projections, footprints, collision_checker, params);
+      const auto end = std::chrono::system_clock::now();
+      times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    std::printf("%ld, %ld, %ld\n", nb_threads, percentile(times, 0.5), percentile(times, 0.99));
+  }
+}
+
 int main()
 {
   Obstacles obstacles;
@@ -94,5 +145,6 @@ int main()
         rtt_check_time.count(), naive_constr_time.count(), naive_check_time.count());
     }
   }
+  benchmark_distances(CollisionChecker(obstacles, 0, 0));
   return 0;
 }
@@ -54,6 +54,24 @@ std::optional<double> distanceToClosestCollision(
   return distance;
 }
 
+std::vector<std::optional<double>> distancesToClosestCollision(
+  const TrajectoryPoints & trajectory, const std::vector<multi_linestring_t> & projections,
+  const std::vector<polygon_t> & footprints, const CollisionChecker & collision_checker,
+  const ProjectionParameters & params)
+{
+  std::vector<std::optional<double>> distances(trajectory.size());
+#pragma omp parallel for num_threads(params.nb_threads) schedule(dynamic)
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    // First linestring is used to calculate distance
+    if (projections[i].empty()) continue;
+    auto point_params = params;
+    point_params.update(trajectory[i]);
+    distances[i] =
+      distanceToClosestCollision(projections[i][0], footprints[i], collision_checker, point_params);
+  }
+  return distances;
+}
+
 double arcDistance(const point_t & origin, const double heading, const point_t & target)
 {
   // Circle passing through the origin and the target such that origin+heading is tangent
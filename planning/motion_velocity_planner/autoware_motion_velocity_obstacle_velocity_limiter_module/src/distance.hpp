@@ -36,6 +36,19 @@ std::optional<double> distanceToClosestCollision(
   const linestring_t & projection, const polygon_t & footprint,
   const CollisionChecker & collision_checker, const ProjectionParameters & params);
 
+/// @brief calculate the closest distance to a collision for each trajectory point
+/// @details the trajectory points are processed in parallel with params.nb_threads threads
+/// @param [in] trajectory trajectory points
+/// @param [in] projections forward projection lines of each trajectory point
+/// @param [in] footprints footprint of the projections of each trajectory point
+/// @param [in] collision_checker object to retrieve collision points
+/// @param [in] params projection parameters
+/// @return distance to the closest collision of each trajectory point if any
+std::vector<std::optional<double>> distancesToClosestCollision(
+  const TrajectoryPoints & trajectory, const std::vector<multi_linestring_t> & projections,
+  const std::vector<polygon_t> & footprints, const CollisionChecker & collision_checker,
+  const ProjectionParameters & params);
+
 /// @brief calculate the closest distance along a circle to a given target point
 /// @param [in] origin starting point
 /// @param [in] heading heading used to calculate the tangent to the circle at the origin
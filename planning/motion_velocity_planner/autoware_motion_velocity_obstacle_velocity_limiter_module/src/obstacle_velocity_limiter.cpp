@@ -115,13 +115,11 @@ std::vector<autoware::motion_velocity_planner::SlowdownInterval> calculate_slowd
 {
   std::vector<autoware::motion_velocity_planner::SlowdownInterval> slowdown_intervals;
   size_t previous_slowdown_index = trajectory.size();
+  const auto distances_to_collision = distancesToClosestCollision(
+    trajectory, projections, footprints, collision_checker, projection_params);
   for (size_t i = 0; i < trajectory.size(); ++i) {
     auto & trajectory_point = trajectory[i];
-    // First linestring is used to calculate distance
-    if (projections[i].empty()) continue;
-    projection_params.update(trajectory_point);
-    const auto dist_to_collision = distanceToClosestCollision(
-      projections[i][0], footprints[i], collision_checker, projection_params);
+    const auto & dist_to_collision = distances_to_collision[i];
     if (dist_to_collision) {
       const auto min_feasible_velocity =
         velocity_params.current_ego_velocity -
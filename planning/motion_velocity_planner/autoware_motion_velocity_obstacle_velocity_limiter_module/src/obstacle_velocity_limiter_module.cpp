@@ -125,6 +125,8 @@ void ObstacleVelocityLimiterModule::update_parameters(
       projection_params_.steering_angle_offset = parameter.as_double();
     } else if (parameter.get_name() == ProjectionParameters::DISTANCE_METHOD_PARAM) {
       projection_params_.updateDistanceMethod(logger_, parameter.as_string());
+    } else if (parameter.get_name() == ProjectionParameters::NB_THREADS_PARAM) {
+      projection_params_.updateNbThreads(logger_, parameter.as_int());
     } else {
       RCLCPP_WARN(logger_, "Unknown parameter %s", parameter.get_name().c_str());
     }
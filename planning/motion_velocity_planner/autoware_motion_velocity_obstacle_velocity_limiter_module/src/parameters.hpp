@@ -118,6 +118,7 @@ struct ProjectionParameters
   static constexpr auto STEER_OFFSET_PARAM = "simulation.steering_offset";
   static constexpr auto DISTANCE_METHOD_PARAM = "simulation.distance_method";
   static constexpr auto DURATION_PARAM = "min_ttc";
+  static constexpr auto NB_THREADS_PARAM = "simulation.nb_threads";
 
   enum { PARTICLE, BICYCLE } model = PARTICLE;
   enum { EXACT, APPROXIMATION } distance_method = EXACT;
@@ -130,6 +131,8 @@ struct ProjectionParameters
   double wheel_base{};
   double steering_angle{};
   double steering_angle_offset{};
+  // number of threads used to calculate the distances to collision
+  int64_t nb_threads = 1;
 
   ProjectionParameters() = default;
   explicit ProjectionParameters(rclcpp::Node & node)
@@ -140,6 +143,7 @@ struct ProjectionParameters
     updateNbPoints(logger, node.declare_parameter<int>(NB_POINTS_PARAM));
     steering_angle_offset = node.declare_parameter<double>(STEER_OFFSET_PARAM);
     duration = node.declare_parameter<double>(DURATION_PARAM);
+    updateNbThreads(logger, node.declare_parameter<int>(NB_THREADS_PARAM));
   }
 
   // cppcheck-suppress functionStatic
@@ -185,6 +189,16 @@ struct ProjectionParameters
     return true;
   }
 
+  bool updateNbThreads(const rclcpp::Logger & logger, const int64_t threads)
+  {
+    if (threads < 1) {
+      RCLCPP_WARN(logger, "Cannot use less than 1 thread. Using value %ld instead.", nb_threads);
+      return false;
+    }
+    nb_threads = threads;
+    return true;
+  }
+
   void update(const TrajectoryPoint & point)
   {
     velocity = point.longitudinal_velocity_mps;
@@ -443,3 +443,57 @@ TEST(TestCollisionDistance, createObjPolygons)
   polygons = createObjectPolygons(objects, 0.0, 0.0);
   EXPECT_EQ(polygons.size(), 2ul);
 }
+
+TEST(TestCollisionDistance, distancesToClosestCollision)
+{
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::CollisionChecker;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::distancesToClosestCollision;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::distanceToClosestCollision;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::multi_linestring_t;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::polygon_t;
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::TrajectoryPoints;
+
+  autoware::motion_velocity_planner::obstacle_velocity_limiter::ProjectionParameters params;
+  params.model =
+    autoware::motion_velocity_planner::obstacle_velocity_limiter::ProjectionParameters::PARTICLE;
+  TrajectoryPoints trajectory(20);
+  std::vector<multi_linestring_t> projections;
+  std::vector<polygon_t> footprints;
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    const auto x = static_cast<double>(i);
+    trajectory[i].pose.position.x = x;
+    trajectory[i].pose.orientation = autoware::universe_utils::createQuaternionFromYaw(0.1 * x);
+    if (i % 5 == 0) {  // points without projection
+      projections.emplace_back();
+    } else {
+      projections.push_back({{{x, 0.0}, {x + 5.0, 0.0}}});
+    }
+    polygon_t footprint;
+    footprint.outer() = {{x, 1.0}, {x + 5.0, 1.0}, {x + 5.0, -1.0}, {x, -1.0}};
+    boost::geometry::correct(footprint);
+    footprints.push_back(footprint);
+  }
+  autoware::motion_velocity_planner::obstacle_velocity_limiter::Obstacles obstacles;
+  obstacles.points = {{4.5, 0.5}, {12.0, -0.5}, {16.5, 0.0}};
+  obstacles.lines.push_back({{8.5, -2.0}, {8.5, 2.0}});
+  const CollisionChecker collision_checker(obstacles, 0lu, 0lu);
+
+  for (const auto nb_threads : {1l, 4l}) {
+    params.nb_threads = nb_threads;
+    const auto distances =
+      distancesToClosestCollision(trajectory, projections, footprints, collision_checker, params);
+    ASSERT_EQ(distances.size(), trajectory.size());
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+      if (projections[i].empty()) {
+        EXPECT_FALSE(distances[i].has_value());
+        continue;
+      }
+      auto point_params = params;
+      point_params.update(trajectory[i]);
+      const auto expected = distanceToClosestCollision(
+        projections[i][0], footprints[i], collision_checker, point_params);
+      ASSERT_EQ(distances[i].has_value(), expected.has_value());
+      if (expected) EXPECT_DOUBLE_EQ(*distances[i], *expected);
+    }
+  }
+}
@@ -33,7 +33,9 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion_velocity_planner::out_of_lane
@@ -129,14 +131,38 @@ void calculate_collisions_to_avoid(
   }
 }
 
+namespace
+{
+bool is_same_footprint(const lanelet::BasicPolygon2d & a, const lanelet::BasicPolygon2d & b)
+{
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto & p1, const auto & p2) {
+    return p1.x() == p2.x() && p1.y() == p2.y();
+  });
+}
+
+/// @brief index in the cache of the footprint matching the first footprint of the trajectory
+/// @details the trajectory starts from the segment closest to ego so its unchanged part is shifted
+/// in the cache by the number of points that ego passed since the previous iteration
+std::optional<size_t> find_cache_offset(
+  const std::vector<lanelet::BasicPolygon2d> & footprints, const OutOfLanePointsCache & cache)
+{
+  if (footprints.empty()) {
+    return std::nullopt;
+  }
+  for (auto i = 0UL; i < cache.footprints.size(); ++i) {
+    if (is_same_footprint(cache.footprints[i], footprints.front())) {
+      return i;
+    }
+  }
+  return std::nullopt;
+}
+}  // namespace
+
 OutOfLanePoint calculate_out_of_lane_point(
   const lanelet::BasicPolygon2d & footprint, const lanelet::ConstLanelets & out_lanelets,
-  const OutLaneletRtree & out_lanelets_rtree)
+  const std::vector<LaneletNode> & candidates)
 {
   OutOfLanePoint p;
-  std::vector<LaneletNode> candidates;
-  out_lanelets_rtree.query(
-    boost::geometry::index::intersects(footprint), std::back_inserter(candidates));
   for (const auto & [_, idx] : candidates) {
     const auto & lanelet = out_lanelets[idx];
     lanelet::BasicPolygons2d intersections;
@@ -152,18 +178,48 @@ OutOfLanePoint calculate_out_of_lane_point(
   }
   return p;
 }
-std::vector<OutOfLanePoint> calculate_out_of_lane_points(const EgoData & ego_data)
+
+std::vector<OutOfLanePoint> calculate_out_of_lane_points(
+  const EgoData & ego_data, const lanelet::LaneletMapConstPtr & lanelet_map,
+  OutOfLanePointsCache & cache)
 {
+  if (cache.lanelet_map.lock() != lanelet_map) {
+    cache = OutOfLanePointsCache{};
+    cache.lanelet_map = lanelet_map;
+  }
+  const auto cache_offset = find_cache_offset(ego_data.trajectory_footprints, cache);
+  OutOfLanePointsCache new_cache;
+  new_cache.lanelet_map = lanelet_map;
   std::vector<OutOfLanePoint> out_of_lane_points;
   for (auto i = 0UL; i < ego_data.trajectory_footprints.size(); ++i) {
     const auto & footprint = ego_data.trajectory_footprints[i];
+    std::vector<LaneletNode> candidates;
+    ego_data.out_lanelets_rtree.query(
+      boost::geometry::index::intersects(footprint), std::back_inserter(candidates));
+    std::sort(candidates.begin(), candidates.end(), [](const auto & n1, const auto & n2) {
+      return n1.second < n2.second;
+    });
+    std::vector<lanelet::Id> candidate_ids;
+    candidate_ids.reserve(candidates.size());
+    for (const auto & [_, idx] : candidates) {
+      candidate_ids.push_back(ego_data.out_lanelets[idx].id());
+    }
+    const auto cache_idx = cache_offset ? *cache_offset + i : cache.footprints.size();
+    const auto is_cached = cache_idx < cache.footprints.size() &&
+                           cache.candidate_lanelet_ids[cache_idx] == candidate_ids &&
+                           is_same_footprint(cache.footprints[cache_idx], footprint);
     OutOfLanePoint p =
-      calculate_out_of_lane_point(footprint, ego_data.out_lanelets, ego_data.out_lanelets_rtree);
+      is_cached ? cache.points[cache_idx]
+                : calculate_out_of_lane_point(footprint, ego_data.out_lanelets, candidates);
     p.trajectory_index = i;
     if (!p.overlapped_lanelets.empty()) {
       out_of_lane_points.push_back(p);
     }
+    new_cache.footprints.push_back(footprint);
+    new_cache.candidate_lanelet_ids.push_back(std::move(candidate_ids));
+    new_cache.points.push_back(std::move(p));
   }
+  cache = std::move(new_cache);
   return out_of_lane_points;
 }
 
@@ -48,7 +48,13 @@ void calculate_collisions_to_avoid(
   const PlannerParam & params);
 
 /// @brief calculate the out of lane points
-std::vector<OutOfLanePoint> calculate_out_of_lane_points(const EgoData & ego_data);
+/// @details the points of the footprints unchanged since the previous call are taken from the cache
+/// @param [in] ego_data ego data with the trajectory footprints and the out lanelets
+/// @param [in] lanelet_map map of the out lanelets, the cache is cleared if it changed
+/// @param [inout] cache points of the previous call, updated with the points of this call
+std::vector<OutOfLanePoint> calculate_out_of_lane_points(
+  const EgoData & ego_data, const lanelet::LaneletMapConstPtr & lanelet_map,
+  OutOfLanePointsCache & cache);
 
 /// @brief prepare the rtree of out of lane points for the given data
 void prepare_out_of_lane_areas_rtree(OutOfLaneData & out_of_lane_data);
@@ -199,10 +199,13 @@ void prepare_stop_lines_rtree(
   ego_data.stop_lines_rtree = {rtree_nodes.begin(), rtree_nodes.end()};
 }
 
-out_of_lane::OutOfLaneData prepare_out_of_lane_data(const out_of_lane::EgoData & ego_data)
+out_of_lane::OutOfLaneData prepare_out_of_lane_data(
+  const out_of_lane::EgoData & ego_data, const lanelet::LaneletMapConstPtr & lanelet_map,
+  out_of_lane::OutOfLanePointsCache & cache)
 {
   out_of_lane::OutOfLaneData out_of_lane_data;
-  out_of_lane_data.outside_points = out_of_lane::calculate_out_of_lane_points(ego_data);
+  out_of_lane_data.outside_points =
+    out_of_lane::calculate_out_of_lane_points(ego_data, lanelet_map, cache);
   out_of_lane::prepare_out_of_lane_areas_rtree(out_of_lane_data);
   return out_of_lane_data;
 }
@@ -235,7 +238,8 @@ VelocityPlanningResult OutOfLaneModule::plan(
   const auto calculate_lanelets_us = stopwatch.toc("calculate_lanelets");
 
   stopwatch.tic("calculate_out_of_lane_areas");
-  auto out_of_lane_data = prepare_out_of_lane_data(ego_data);
+  auto out_of_lane_data = prepare_out_of_lane_data(
+    ego_data, planner_data->route_handler->getLaneletMapPtr(), out_of_lane_points_cache_);
   const auto calculate_out_of_lane_areas_us = stopwatch.toc("calculate_out_of_lane_areas");
 
   stopwatch.tic("filter_predicted_objects");
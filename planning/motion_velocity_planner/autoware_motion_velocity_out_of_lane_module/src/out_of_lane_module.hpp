@@ -62,6 +62,7 @@ private:
   rclcpp::Clock::SharedPtr clock_{nullptr};
   std::optional<geometry_msgs::msg::Pose> previous_slowdown_pose_{std::nullopt};
   rclcpp::Time previous_slowdown_time_{0};
+  out_of_lane::OutOfLanePointsCache out_of_lane_points_cache_{};
 
 protected:
   // Debug
@@ -30,6 +30,7 @@
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -135,6 +136,20 @@ struct OutOfLaneData
   OutAreaRtree outside_areas_rtree;
 };
 
+/// @brief out of lane points calculated for the trajectory footprints of the previous iteration
+/// @details a footprint that did not change and that is checked against the same out lanelets
+/// has the same out of lane point, so only the footprints of the changed part of the trajectory
+/// need to be intersected with the lanelets
+struct OutOfLanePointsCache
+{
+  std::weak_ptr<const lanelet::LaneletMap> lanelet_map;
+  std::vector<lanelet::BasicPolygon2d> footprints;
+  std::vector<std::vector<lanelet::Id>>
+    candidate_lanelet_ids;  // ids of the out lanelets whose box intersects each footprint
+  std::vector<OutOfLanePoint>
+    points;  // point of each footprint, without overlapped lanelets if it is inside the lane
+};
+
 /// @brief debug data
 struct DebugData
 {
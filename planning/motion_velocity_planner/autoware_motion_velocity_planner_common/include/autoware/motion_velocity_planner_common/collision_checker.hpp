@@ -63,6 +63,13 @@ public:
 
   /// @brief get the size of the trajectory used by this collision checker
   [[nodiscard]] size_t trajectory_size() const { return trajectory_footprints_.size(); }
+
+  /// @brief direct access to the footprints of the trajectory
+  /// @return footprints of the trajectory, indexed like the trajectory
+  [[nodiscard]] const autoware::universe_utils::MultiPolygon2d & trajectory_footprints() const
+  {
+    return trajectory_footprints_;
+  }
 };
 }  // namespace autoware::motion_velocity_planner
 
@@ -17,6 +17,7 @@
 
 #include <autoware/motion_utils/distance/distance.hpp>
 #include <autoware/motion_velocity_planner_common/collision_checker.hpp>
+#include <autoware/motion_velocity_planner_common/trajectory_footprint_cache.hpp>
 #include <autoware/route_handler/route_handler.hpp>
 #include <autoware/universe_utils/geometry/boost_polygon_utils.hpp>
 #include <autoware/velocity_smoother/smoother/smoother_base.hpp>
@@ -43,6 +44,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace autoware::motion_velocity_planner
 {
@@ -80,6 +82,9 @@ struct PlannerData
 
   // velocity smoother
   std::shared_ptr<autoware::velocity_smoother::SmootherBase> velocity_smoother_;
+  // ego footprints shared by the modules, to be reset at each cycle
+  std::shared_ptr<TrajectoryFootprintCache> trajectory_footprint_cache_ =
+    std::make_shared<TrajectoryFootprintCache>();
   // parameters
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
 
@@ -99,6 +104,18 @@ struct PlannerData
     return std::make_optional<TrafficSignalStamped>(traffic_light_id_map.at(id));
   }
 
+  /**
+   *@fn
+   *@brief get the collision checker of the ego footprints along the given trajectory, which is
+   *calculated at the first request and then shared by the modules during the cycle
+   */
+  [[nodiscard]] std::shared_ptr<const CollisionChecker> get_trajectory_collision_checker(
+    const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & trajectory,
+    const FootprintParameters & footprint_params) const
+  {
+    return trajectory_footprint_cache_->get_collision_checker(trajectory, footprint_params);
+  }
+
   [[nodiscard]] std::optional<double> calculate_min_deceleration_distance(
     const double target_velocity) const
   {
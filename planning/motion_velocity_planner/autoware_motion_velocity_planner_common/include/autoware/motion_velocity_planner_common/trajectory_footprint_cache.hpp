@@ -0,0 +1,79 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MOTION_VELOCITY_PLANNER_COMMON__TRAJECTORY_FOOTPRINT_CACHE_HPP_
+#define AUTOWARE__MOTION_VELOCITY_PLANNER_COMMON__TRAJECTORY_FOOTPRINT_CACHE_HPP_
+
+#include <autoware/motion_velocity_planner_common/collision_checker.hpp>
+#include <autoware/universe_utils/geometry/boost_geometry.hpp>
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace autoware::motion_velocity_planner
+{
+/// @brief ego footprint as offsets from the base_link
+struct FootprintParameters
+{
+  double front_offset{};  // [m] longitudinal offset of the front of the footprint
+  double rear_offset{};   // [m] longitudinal offset of the rear of the footprint (usually negative)
+  double left_offset{};   // [m] lateral offset of the left of the footprint
+  double right_offset{};  // [m] lateral offset of the right of the footprint (usually negative)
+
+  bool operator==(const FootprintParameters & other) const
+  {
+    return front_offset == other.front_offset && rear_offset == other.rear_offset &&
+           left_offset == other.left_offset && right_offset == other.right_offset;
+  }
+};
+
+/// @brief calculate the ego footprints along a trajectory
+/// @param trajectory trajectory points
+/// @param params footprint parameters
+/// @return footprint at each trajectory point
+autoware::universe_utils::MultiPolygon2d calculate_trajectory_footprints(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & trajectory,
+  const FootprintParameters & params);
+
+/// @brief ego footprints along trajectories, calculated once per cycle and shared by the modules
+/// @details the collision checker of a trajectory and a set of footprint parameters is built the
+/// first time it is requested. Requests with the same trajectory poses and parameters reuse it.
+class TrajectoryFootprintCache
+{
+public:
+  /// @brief get the collision checker of the ego footprints along the trajectory
+  /// @param trajectory trajectory points
+  /// @param params footprint parameters
+  /// @return collision checker with the footprints of the trajectory
+  [[nodiscard]] std::shared_ptr<const CollisionChecker> get_collision_checker(
+    const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & trajectory,
+    const FootprintParameters & params);
+
+private:
+  struct Entry
+  {
+    std::vector<autoware_planning_msgs::msg::TrajectoryPoint> trajectory;
+    FootprintParameters params;
+    std::shared_ptr<const CollisionChecker> collision_checker;
+  };
+
+  std::mutex mutex_;
+  std::vector<Entry> entries_;
+};
+}  // namespace autoware::motion_velocity_planner
+
+#endif  // AUTOWARE__MOTION_VELOCITY_PLANNER_COMMON__TRAJECTORY_FOOTPRINT_CACHE_HPP_
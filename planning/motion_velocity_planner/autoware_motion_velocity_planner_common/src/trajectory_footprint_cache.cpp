@@ -0,0 +1,83 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_velocity_planner_common/trajectory_footprint_cache.hpp"
+
+#include <autoware/universe_utils/geometry/geometry.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace autoware::motion_velocity_planner
+{
+namespace
+{
+bool is_same_trajectory(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & a,
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & b)
+{
+  // only the poses are used to calculate the footprints
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto & p1, const auto & p2) {
+    return p1.pose == p2.pose;
+  });
+}
+}  // namespace
+
+autoware::universe_utils::MultiPolygon2d calculate_trajectory_footprints(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & trajectory,
+  const FootprintParameters & params)
+{
+  const std::vector<autoware::universe_utils::Point2d> base_footprint = {
+    {params.front_offset, params.left_offset},
+    {params.front_offset, params.right_offset},
+    {params.rear_offset, params.right_offset},
+    {params.rear_offset, params.left_offset}};
+  autoware::universe_utils::MultiPolygon2d footprints;
+  footprints.reserve(trajectory.size());
+  for (const auto & p : trajectory) {
+    const auto angle = autoware::universe_utils::getRPY(p.pose).z;
+    const auto cos_angle = std::cos(angle);
+    const auto sin_angle = std::sin(angle);
+    autoware::universe_utils::Polygon2d footprint;
+    for (const auto & b : base_footprint) {
+      footprint.outer().emplace_back(
+        p.pose.position.x + cos_angle * b.x() - sin_angle * b.y(),
+        p.pose.position.y + sin_angle * b.x() + cos_angle * b.y());
+    }
+    footprint.outer().push_back(footprint.outer().front());
+    boost::geometry::correct(footprint);
+    footprints.push_back(footprint);
+  }
+  return footprints;
+}
+
+std::shared_ptr<const CollisionChecker> TrajectoryFootprintCache::get_collision_checker(
+  const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & trajectory,
+  const FootprintParameters & params)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto & entry : entries_) {
+    if (entry.params == params && is_same_trajectory(entry.trajectory, trajectory)) {
+      return entry.collision_checker;
+    }
+  }
+  auto collision_checker =
+    std::make_shared<const CollisionChecker>(calculate_trajectory_footprints(trajectory, params));
+  entries_.push_back({trajectory, params, collision_checker});
+  return collision_checker;
+}
+}  // namespace autoware::motion_velocity_planner
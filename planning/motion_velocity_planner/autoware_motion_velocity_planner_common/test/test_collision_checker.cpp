@@ -13,15 +13,20 @@
 // limitations under the License.
 
 #include "autoware/motion_velocity_planner_common/collision_checker.hpp"
+#include "autoware/motion_velocity_planner_common/trajectory_footprint_cache.hpp"
 
 #include <boost/geometry/geometry.hpp>
 
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cmath>
 #include <random>
+#include <vector>
 
 using autoware::motion_velocity_planner::CollisionChecker;
+using autoware::motion_velocity_planner::FootprintParameters;
+using autoware::motion_velocity_planner::TrajectoryFootprintCache;
 using autoware::universe_utils::Line2d;
 using autoware::universe_utils::MultiLineString2d;
 using autoware::universe_utils::MultiPoint2d;
@@ -174,3 +179,45 @@ TEST(TestCollisionChecker, DISABLED_Benchmark)
   std::printf("%d Points:\n", nb_obstacles);
   check_obstacles(point_obstacles);
 }
+
+TEST(TestCollisionChecker, TrajectoryFootprintCache)
+{
+  std::vector<autoware_planning_msgs::msg::TrajectoryPoint> trajectory(3);
+  for (auto i = 0UL; i < trajectory.size(); ++i) {
+    trajectory[i].pose.position.x = static_cast<double>(i);
+    trajectory[i].pose.orientation.w = 1.0;
+  }
+  // rotate the last point by 90 degrees
+  trajectory.back().pose.orientation.z = std::sqrt(0.5);
+  trajectory.back().pose.orientation.w = std::sqrt(0.5);
+  FootprintParameters params;
+  params.front_offset = 2.0;
+  params.rear_offset = -1.0;
+  params.left_offset = 0.5;
+  params.right_offset = -1.5;
+
+  TrajectoryFootprintCache cache;
+  const auto collision_checker = cache.get_collision_checker(trajectory, params);
+  ASSERT_EQ(collision_checker->trajectory_size(), trajectory.size());
+  const auto & footprints = collision_checker->trajectory_footprints();
+  EXPECT_NEAR(boost::geometry::area(footprints.front()), 6.0, 1e-6);
+  EXPECT_TRUE(boost::geometry::within(Point2d{2.9, 0.4}, footprints[1]));
+  EXPECT_TRUE(boost::geometry::within(Point2d{0.1, -1.4}, footprints[1]));
+  EXPECT_FALSE(boost::geometry::within(Point2d{1.0, 0.6}, footprints[1]));
+  EXPECT_TRUE(boost::geometry::within(Point2d{3.4, 1.9}, footprints[2]));
+  EXPECT_TRUE(boost::geometry::within(Point2d{1.6, -0.9}, footprints[2]));
+  EXPECT_FALSE(boost::geometry::within(Point2d{4.0, 0.0}, footprints[2]));
+
+  // the same trajectory and parameters reuse the collision checker
+  EXPECT_EQ(cache.get_collision_checker(trajectory, params), collision_checker);
+  auto other_params = params;
+  other_params.front_offset = 3.0;
+  EXPECT_NE(cache.get_collision_checker(trajectory, other_params), collision_checker);
+  auto other_trajectory = trajectory;
+  other_trajectory.front().pose.position.y = 1.0;
+  EXPECT_NE(cache.get_collision_checker(other_trajectory, params), collision_checker);
+  // only the poses are used to calculate the footprints
+  auto same_poses_trajectory = trajectory;
+  same_poses_trajectory.front().longitudinal_velocity_mps = 1.0;
+  EXPECT_EQ(cache.get_collision_checker(same_poses_trajectory, params), collision_checker);
+}
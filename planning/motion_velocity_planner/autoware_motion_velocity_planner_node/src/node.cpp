@@ -37,6 +37,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace
@@ -93,6 +94,8 @@ MotionVelocityPlannerNode::MotionVelocityPlannerNode(const rclcpp::NodeOptions &
 
   // Parameters
   smooth_velocity_before_planning_ = declare_parameter<bool>("smooth_velocity_before_planning");
+  planner_manager_.set_num_threads(
+    static_cast<int>(declare_parameter<int>("num_threads_for_modules")));
   // nearest search
   planner_data_.ego_nearest_dist_threshold =
     declare_parameter<double>("ego_nearest_dist_threshold");
@@ -197,6 +200,13 @@ std::optional<pcl::PointCloud<pcl::PointXYZ>>
 MotionVelocityPlannerNode::process_no_ground_pointcloud(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
+  // the pointcloud already transformed by e.g. planning_topic_converter is used as it is
+  if (msg->header.frame_id == "map") {
+    pcl::PointCloud<pcl::PointXYZ> pc;
+    pcl::fromROSMsg(*msg, pc);
+    return pc;
+  }
+
   geometry_msgs::msg::TransformStamped transform;
   try {
     transform = tf_buffer_.lookupTransform("map", msg->header.frame_id, tf2::TimePointZero);
@@ -291,15 +301,16 @@ void MotionVelocityPlannerNode::on_trajectory(
 
   autoware::motion_velocity_planner::TrajectoryPoints input_trajectory_points{
     input_trajectory_msg->points.begin(), input_trajectory_msg->points.end()};
-  auto output_trajectory_msg = generate_trajectory(input_trajectory_points, processing_times);
-  output_trajectory_msg.header = input_trajectory_msg->header;
+  auto output_trajectory_msg = std::make_unique<autoware_planning_msgs::msg::Trajectory>(
+    generate_trajectory(input_trajectory_points, processing_times));
+  output_trajectory_msg->header = input_trajectory_msg->header;
   processing_times["generate_trajectory"] = stop_watch.toc(true);
 
   lk.unlock();
 
-  trajectory_pub_->publish(output_trajectory_msg);
+  trajectory_pub_->publish(std::move(output_trajectory_msg));
   published_time_publisher_.publish_if_subscribed(
-    trajectory_pub_, output_trajectory_msg.header.stamp);
+    trajectory_pub_, input_trajectory_msg->header.stamp);
   processing_times["Total"] = stop_watch.toc("Total");
   processing_diag_publisher_.publish(processing_times);
   tier4_debug_msgs::msg::Float64Stamped processing_time_msg;
@@ -427,8 +438,9 @@ autoware_planning_msgs::msg::Trajectory MotionVelocityPlannerNode::generate_traj
     resampled_trajectory, planner_data_.current_odometry.pose.pose.position);
   processing_times["calculate_time_from_start"] = stop_watch.toc("calculate_time_from_start");
   stop_watch.tic("plan_velocities");
+  planner_data_.trajectory_footprint_cache_ = std::make_shared<TrajectoryFootprintCache>();
   const auto planning_results = planner_manager_.plan_velocities(
-    resampled_trajectory, std::make_shared<const PlannerData>(planner_data_));
+    resampled_trajectory, std::make_shared<const PlannerData>(planner_data_), processing_times);
   processing_times["plan_velocities"] = stop_watch.toc("plan_velocities");
 
   autoware_adapi_v1_msgs::msg::VelocityFactorArray velocity_factors;
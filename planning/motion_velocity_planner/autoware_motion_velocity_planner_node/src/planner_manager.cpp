@@ -14,10 +14,15 @@
 
 #include "planner_manager.hpp"
 
+#include <autoware/universe_utils/system/stop_watch.hpp>
+
 #include <boost/format.hpp>
 
+#include <chrono>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::motion_velocity_planner
 {
@@ -110,12 +115,24 @@ std::shared_ptr<DiagnosticArray> MotionVelocityPlannerManager::get_diagnostics(
 
 std::vector<VelocityPlanningResult> MotionVelocityPlannerManager::plan_velocities(
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & ego_trajectory_points,
-  const std::shared_ptr<const PlannerData> planner_data)
+  const std::shared_ptr<const PlannerData> planner_data,
+  std::map<std::string, double> & processing_times)
 {
-  std::vector<VelocityPlanningResult> results;
-  for (auto & plugin : loaded_plugins_) {
-    VelocityPlanningResult res = plugin->plan(ego_trajectory_points, planner_data);
-    results.push_back(res);
+  // NOTE: the modules only read the trajectory and the planner data, so they can run concurrently.
+  //       The results keep the order of the loaded modules.
+  std::vector<VelocityPlanningResult> results(loaded_plugins_.size());
+  std::vector<double> module_processing_times(loaded_plugins_.size());
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (size_t i = 0; i < loaded_plugins_.size(); ++i) {
+    universe_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+    results[i] = loaded_plugins_[i]->plan(ego_trajectory_points, planner_data);
+    module_processing_times[i] = stop_watch.toc();
+  }
+
+  for (size_t i = 0; i < loaded_plugins_.size(); ++i) {
+    const auto & plugin = loaded_plugins_[i];
+    const auto & res = results[i];
+    processing_times["plan_velocities." + plugin->get_module_name()] = module_processing_times[i];
 
     const auto stop_reason_diag =
       make_diagnostic(plugin->get_module_name(), "stop", res.stop_points.size() > 0);
@@ -32,6 +32,7 @@
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,9 +49,14 @@ public:
   void load_module_plugin(rclcpp::Node & node, const std::string & name);
   void unload_module_plugin(rclcpp::Node & node, const std::string & name);
   void update_module_parameters(const std::vector<rclcpp::Parameter> & parameters);
+  /// @brief set the number of threads used to run the modules concurrently
+  void set_num_threads(const int num_threads) { num_threads_ = num_threads; }
+  /// @brief run the modules and return their results in the order of the loaded modules
+  /// @param [out] processing_times processing time of each module [ms]
   std::vector<VelocityPlanningResult> plan_velocities(
     const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & ego_trajectory_points,
-    const std::shared_ptr<const PlannerData> planner_data);
+    const std::shared_ptr<const PlannerData> planner_data,
+    std::map<std::string, double> & processing_times);
 
   // Diagnostic
   std::shared_ptr<DiagnosticStatus> make_diagnostic(
@@ -62,6 +68,7 @@ private:
   std::vector<std::shared_ptr<DiagnosticStatus>> diagnostics_;
   pluginlib::ClassLoader<PluginModuleInterface> plugin_loader_;
   std::vector<std::shared_ptr<PluginModuleInterface>> loaded_plugins_;
+  int num_threads_{1};
 };
 }  // namespace autoware::motion_velocity_planner
 
@@ -33,6 +33,47 @@
 
 namespace autoware::frenet_planner
 {
+namespace
+{
+// calculate the yaws, lengths, poses and curvatures from the cartesian points
+void calculatePathGeometry(Path & path)
+{
+  if (path.points.empty()) return;
+  path.yaws.reserve(path.points.size());
+  path.lengths.reserve(path.points.size());
+  path.curvatures.reserve(path.points.size());
+  path.poses.reserve(path.points.size());
+  // TODO(Maxime CLEMENT): more precise calculations are proposed in Appendix I of the paper:
+  // Optimal path Generation for Dynamic Street Scenarios in a Frenet Frame (Werling2010)
+  // Calculate cartesian yaw and interval values
+  path.lengths.push_back(0.0);
+  for (auto it = path.points.begin(); it != std::prev(path.points.end()); ++it) {
+    const auto dx = std::next(it)->x() - it->x();
+    const auto dy = std::next(it)->y() - it->y();
+    const auto yaw = std::atan2(dy, dx);
+    path.yaws.push_back(yaw);
+    path.lengths.push_back(path.lengths.back() + std::hypot(dx, dy));
+
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = it->x();
+    pose.position.y = it->y();
+    pose.position.z = 0.0;
+    pose.orientation = autoware::universe_utils::createQuaternionFromRPY(0.0, 0.0, yaw);
+    path.poses.push_back(pose);
+  }
+  path.yaws.push_back(path.yaws.back());
+  path.poses.push_back(path.poses.back());
+
+  // Calculate curvatures
+  for (size_t i = 1; i < path.yaws.size(); ++i) {
+    const auto dyaw =
+      autoware::common::helper_functions::wrap_angle(path.yaws[i] - path.yaws[i - 1]);
+    path.curvatures.push_back(dyaw / (path.lengths[i] - path.lengths[i - 1]));
+  }
+  path.curvatures.push_back(path.curvatures.back());
+}
+}  // namespace
+
 // cppcheck-suppress unusedFunction
 std::vector<Trajectory> generateTrajectories(
   const autoware::sampler_common::transform::Spline2D & reference_spline,
@@ -58,13 +99,38 @@ std::vector<Path> generatePaths(
   const autoware::sampler_common::transform::Spline2D & reference_spline,
   const FrenetState & initial_state, const SamplingParameters & sampling_parameters)
 {
-  std::vector<Path> candidates;
-  candidates.reserve(sampling_parameters.parameters.size());
-  for (const auto parameter : sampling_parameters.parameters) {
-    auto candidate =
-      generateCandidate(initial_state, parameter.target_state, sampling_parameters.resolution);
-    calculateCartesian(reference_spline, candidate);
-    candidates.push_back(candidate);
+  // all candidates are sampled at the same arc lengths from the initial state, so the points and
+  // normals of the reference are calculated once for the longest candidate
+  double max_delta_s = 0.0;
+  for (const auto & parameter : sampling_parameters.parameters) {
+    max_delta_s =
+      std::max(max_delta_s, parameter.target_state.position.s - initial_state.position.s);
+  }
+  std::vector<autoware::sampler_common::Point2d> reference_points;
+  std::vector<Eigen::Vector2d> reference_normals;
+  for (double s = sampling_parameters.resolution; s <= max_delta_s;
+       s += sampling_parameters.resolution) {
+    const auto reference_s = initial_state.position.s + s;
+    const auto heading = reference_spline.yaw(reference_s);
+    reference_points.push_back(reference_spline.cartesian(reference_s));
+    reference_normals.emplace_back(std::cos(heading + M_PI_2), std::sin(heading + M_PI_2));
+  }
+
+  std::vector<Path> candidates(sampling_parameters.parameters.size());
+#pragma omp parallel for
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    auto & candidate = candidates[i];
+    candidate = generateCandidate(
+      initial_state, sampling_parameters.parameters[i].target_state,
+      sampling_parameters.resolution);
+    candidate.points.reserve(candidate.frenet_points.size());
+    for (size_t j = 0; j < candidate.frenet_points.size(); ++j) {
+      const auto & p = reference_points[j];
+      const auto & n = reference_normals[j];
+      const auto d = candidate.frenet_points[j].d;
+      candidate.points.emplace_back(p.x() + d * n.x(), p.y() + d * n.y());
+    }
+    calculatePathGeometry(candidate);
   }
   return candidates;
 }
@@ -111,42 +177,11 @@ void calculateCartesian(
 {
   if (!path.frenet_points.empty()) {
     path.points.reserve(path.frenet_points.size());
-    path.yaws.reserve(path.frenet_points.size());
-    path.lengths.reserve(path.frenet_points.size());
-    path.curvatures.reserve(path.frenet_points.size());
-    path.poses.reserve(path.frenet_points.size());
     // Calculate cartesian positions
     for (const auto & fp : path.frenet_points) {
       path.points.push_back(reference.cartesian(fp));
     }
-    // TODO(Maxime CLEMENT): more precise calculations are proposed in Appendix I of the paper:
-    // Optimal path Generation for Dynamic Street Scenarios in a Frenet Frame (Werling2010)
-    // Calculate cartesian yaw and interval values
-    path.lengths.push_back(0.0);
-    for (auto it = path.points.begin(); it != std::prev(path.points.end()); ++it) {
-      const auto dx = std::next(it)->x() - it->x();
-      const auto dy = std::next(it)->y() - it->y();
-      const auto yaw = std::atan2(dy, dx);
-      path.yaws.push_back(yaw);
-      path.lengths.push_back(path.lengths.back() + std::hypot(dx, dy));
-
-      geometry_msgs::msg::Pose pose;
-      pose.position.x = it->x();
-      pose.position.y = it->y();
-      pose.position.z = 0.0;
-      pose.orientation = autoware::universe_utils::createQuaternionFromRPY(0.0, 0.0, yaw);
-      path.poses.push_back(pose);
-    }
-    path.yaws.push_back(path.yaws.back());
-    path.poses.push_back(path.poses.back());
-
-    // Calculate curvatures
-    for (size_t i = 1; i < path.yaws.size(); ++i) {
-      const auto dyaw =
-        autoware::common::helper_functions::wrap_angle(path.yaws[i] - path.yaws[i - 1]);
-      path.curvatures.push_back(dyaw / (path.lengths[i] - path.lengths[i - 1]));
-    }
-    path.curvatures.push_back(path.curvatures.back());
+    calculatePathGeometry(path);
   }
 }
 void calculateCartesian(
@@ -16,6 +16,7 @@
 
 #include <autoware/component_interface_specs/map.hpp>
 #include <autoware/component_interface_utils/rclcpp.hpp>
+#include <autoware/geography_utils/projection.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_sensing_msgs/msg/gnss_ins_orientation_stamped.hpp>
@@ -37,6 +38,7 @@
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <optional>
 #include <string>
 
 namespace autoware::gnss_poser
@@ -90,6 +92,8 @@ private:
   rclcpp::Publisher<tier4_debug_msgs::msg::BoolStamped>::SharedPtr fixed_pub_;
 
   MapProjectorInfo::Message projector_info_;
+  // projector built from projector_info_ on the first fix, not to build it on every fix
+  std::optional<autoware::geography_utils::Projector> projector_;
   const std::string base_frame_;
   const std::string gnss_base_frame_;
   const std::string map_frame_;
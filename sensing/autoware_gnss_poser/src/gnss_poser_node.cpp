@@ -73,6 +73,7 @@ GNSSPoser::GNSSPoser(const rclcpp::NodeOptions & node_options)
 void GNSSPoser::callback_map_projector_info(const MapProjectorInfo::Message::ConstSharedPtr msg)
 {
   projector_info_ = *msg;
+  projector_.reset();
   received_map_projector_info_ = true;
 }
 
@@ -116,8 +117,10 @@ void GNSSPoser::callback_nav_sat_fix(
   gps_point.latitude = nav_sat_fix_msg_ptr->latitude;
   gps_point.longitude = nav_sat_fix_msg_ptr->longitude;
   gps_point.altitude = nav_sat_fix_msg_ptr->altitude;
-  geometry_msgs::msg::Point position =
-    autoware::geography_utils::project_forward(gps_point, projector_info_);
+  if (!projector_) {
+    projector_.emplace(projector_info_);
+  }
+  geometry_msgs::msg::Point position = projector_->forward(gps_point);
   position.z = autoware::geography_utils::convert_height(
     position.z, gps_point.latitude, gps_point.longitude, MapProjectorInfo::Message::WGS84,
     projector_info_.vertical_datum);
@@ -0,0 +1,48 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__IMAGE_TRANSPORT_DECOMPRESSOR__DECODER_HPP_
+#define AUTOWARE__IMAGE_TRANSPORT_DECOMPRESSOR__DECODER_HPP_
+
+#include <sensor_msgs/msg/compressed_image.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+#include <memory>
+#include <string>
+
+namespace autoware::image_preprocessor
+{
+// Decodes a compressed image into a bgr8 image message.
+class Decoder
+{
+public:
+  virtual ~Decoder() = default;
+
+  // Name of the backend, e.g. for logging.
+  virtual std::string getName() const = 0;
+
+  // Decode the input directly into the data of the output, and fill the height, width, step and
+  // encoding of the output. The header of the output is not modified. Returns false on failure.
+  virtual bool decode(
+    const sensor_msgs::msg::CompressedImage & input, sensor_msgs::msg::Image & output) = 0;
+};
+
+// Create the decoder of the backend, which is one of "auto", "opencv" and "turbojpeg". "auto"
+// selects the fastest backend built in this package. Throws std::invalid_argument if the backend
+// is unknown or not built.
+std::unique_ptr<Decoder> createDecoder(const std::string & backend);
+
+}  // namespace autoware::image_preprocessor
+
+#endif  // AUTOWARE__IMAGE_TRANSPORT_DECOMPRESSOR__DECODER_HPP_
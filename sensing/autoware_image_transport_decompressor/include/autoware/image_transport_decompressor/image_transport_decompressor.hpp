@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__IMAGE_TRANSPORT_DECOMPRESSOR__IMAGE_TRANSPORT_DECOMPRESSOR_HPP_
 #define AUTOWARE__IMAGE_TRANSPORT_DECOMPRESSOR__IMAGE_TRANSPORT_DECOMPRESSOR_HPP_
 
+#include "autoware/image_transport_decompressor/decoder.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <sensor_msgs/msg/compressed_image.hpp>
@@ -38,6 +40,7 @@ private:
   rclcpp::Subscription<sensor_msgs::msg::CompressedImage>::SharedPtr compressed_image_sub_;
   rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr raw_image_pub_;
   std::string encoding_;
+  std::unique_ptr<Decoder> decoder_;
 };
 
 }  // namespace autoware::image_preprocessor
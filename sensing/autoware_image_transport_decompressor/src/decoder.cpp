@@ -0,0 +1,140 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_transport_decompressor/decoder.hpp"
+
+#include <opencv2/imgcodecs.hpp>
+
+#include <sensor_msgs/image_encodings.hpp>
+
+#ifdef HAVE_TURBOJPEG
+#include <turbojpeg.h>
+#endif
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace autoware::image_preprocessor
+{
+namespace
+{
+void setBgr8Layout(const int height, const int width, sensor_msgs::msg::Image & output)
+{
+  output.height = static_cast<uint32_t>(height);
+  output.width = static_cast<uint32_t>(width);
+  output.encoding = sensor_msgs::image_encodings::BGR8;
+  output.is_bigendian = false;
+  output.step = static_cast<uint32_t>(width) * 3;
+  output.data.resize(static_cast<size_t>(output.step) * output.height);
+}
+
+// Generic decoder of all formats supported by OpenCV.
+class OpenCvDecoder : public Decoder
+{
+public:
+  std::string getName() const override { return "opencv"; }
+
+  bool decode(
+    const sensor_msgs::msg::CompressedImage & input, sensor_msgs::msg::Image & output) override
+  {
+    // Wrap the input without copying it
+    const cv::Mat buffer(
+      1, static_cast<int>(input.data.size()), CV_8UC1, const_cast<uint8_t *>(input.data.data()));
+    const cv::Mat image = cv::imdecode(buffer, cv::IMREAD_COLOR);
+    if (image.empty()) {
+      return false;
+    }
+
+    // Copy the rows once into the message instead of going through cv_bridge
+    setBgr8Layout(image.rows, image.cols, output);
+    cv::Mat destination(image.rows, image.cols, CV_8UC3, output.data.data(), output.step);
+    image.copyTo(destination);
+    return true;
+  }
+};
+
+#ifdef HAVE_TURBOJPEG
+// JPEG decoder using the SIMD code of libjpeg-turbo, which decodes directly into the message.
+// The other formats are decoded by OpenCV.
+class TurboJpegDecoder : public Decoder
+{
+public:
+  TurboJpegDecoder() : handle_(tjInitDecompress())
+  {
+    if (!handle_) {
+      throw std::runtime_error("failed to initialize libjpeg-turbo: " + getError());
+    }
+  }
+  ~TurboJpegDecoder() override { tjDestroy(handle_); }
+  TurboJpegDecoder(const TurboJpegDecoder &) = delete;
+  TurboJpegDecoder & operator=(const TurboJpegDecoder &) = delete;
+
+  std::string getName() const override { return "turbojpeg"; }
+
+  bool decode(
+    const sensor_msgs::msg::CompressedImage & input, sensor_msgs::msg::Image & output) override
+  {
+    if (!isJpeg(input)) {
+      return fallback_.decode(input, output);
+    }
+
+    auto * data = const_cast<uint8_t *>(input.data.data());
+    const auto size = static_cast<unsigned long>(input.data.size());  // NOLINT
+    int width = 0;
+    int height = 0;
+    int subsampling = 0;
+    int colorspace = 0;
+    if (tjDecompressHeader3(handle_, data, size, &width, &height, &subsampling, &colorspace) != 0) {
+      return false;
+    }
+
+    setBgr8Layout(height, width, output);
+    return tjDecompress2(
+             handle_, data, size, output.data.data(), width, static_cast<int>(output.step), height,
+             TJPF_BGR, 0) == 0;
+  }
+
+private:
+  static bool isJpeg(const sensor_msgs::msg::CompressedImage & input)
+  {
+    return input.data.size() >= 2 && input.data[0] == 0xFF && input.data[1] == 0xD8;
+  }
+
+  std::string getError() const { return tjGetErrorStr2(handle_); }
+
+  tjhandle handle_;
+  OpenCvDecoder fallback_;
+};
+#endif
+}  // namespace
+
+std::unique_ptr<Decoder> createDecoder(const std::string & backend)
+{
+#ifdef HAVE_TURBOJPEG
+  if (backend == "auto" || backend == "turbojpeg") {
+    return std::make_unique<TurboJpegDecoder>();
+  }
+#else
+  if (backend == "auto") {
+    return std::make_unique<OpenCvDecoder>();
+  }
+#endif
+  if (backend == "opencv") {
+    return std::make_unique<OpenCvDecoder>();
+  }
+  throw std::invalid_argument("unknown or unavailable decoder backend: " + backend);
+}
+
+}  // namespace autoware::image_preprocessor
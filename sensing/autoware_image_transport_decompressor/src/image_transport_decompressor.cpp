@@ -48,18 +48,10 @@
 
 #include "autoware/image_transport_decompressor/image_transport_decompressor.hpp"
 
-#include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 
 #include <sensor_msgs/image_encodings.hpp>
 
-#if __has_include(<cv_bridge/cv_bridge.hpp>)
-#include <cv_bridge/cv_bridge.hpp>
-#else
-#include <cv_bridge/cv_bridge.h>
-#endif
-
-#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -67,10 +59,36 @@
 
 namespace autoware::image_preprocessor
 {
+namespace
+{
+// Convert the colors of a decoded bgr8 image in the message.
+void convertColor(sensor_msgs::msg::Image & image, const int code)
+{
+  const auto rows = static_cast<int>(image.height);
+  const auto cols = static_cast<int>(image.width);
+  cv::Mat source(rows, cols, CV_8UC3, image.data.data(), image.step);
+  if (code == cv::COLOR_BGR2RGB || code == cv::COLOR_RGB2BGR) {
+    // The number of channels does not change, so convert in place
+    cv::cvtColor(source, source, code);
+    return;
+  }
+
+  const auto step = image.width * 4;
+  std::vector<uint8_t> data(static_cast<size_t>(step) * image.height);
+  cv::Mat destination(rows, cols, CV_8UC4, data.data(), step);
+  cv::cvtColor(source, destination, code);
+  image.step = step;
+  image.data = std::move(data);
+}
+}  // namespace
+
 ImageTransportDecompressor::ImageTransportDecompressor(const rclcpp::NodeOptions & node_options)
 : rclcpp::Node("image_transport_decompressor", node_options),
-  encoding_(declare_parameter<std::string>("encoding"))
+  encoding_(declare_parameter<std::string>("encoding")),
+  decoder_(createDecoder(declare_parameter<std::string>("decoder_backend")))
 {
+  RCLCPP_INFO(get_logger(), "Decoder backend: %s", decoder_->getName().c_str());
+
   compressed_image_sub_ = create_subscription<sensor_msgs::msg::CompressedImage>(
     "~/input/compressed_image", rclcpp::SensorDataQoS(),
     std::bind(&ImageTransportDecompressor::onCompressedImage, this, std::placeholders::_1));
@@ -81,31 +99,23 @@ ImageTransportDecompressor::ImageTransportDecompressor(const rclcpp::NodeOptions
 void ImageTransportDecompressor::onCompressedImage(
   const sensor_msgs::msg::CompressedImage::ConstSharedPtr input_compressed_image_msg)
 {
-  cv_bridge::CvImagePtr cv_ptr(new cv_bridge::CvImage);
+  // Decode straight into the published message to avoid copying the image through cv_bridge
+  auto image_ptr = std::make_unique<sensor_msgs::msg::Image>();
   // Copy message header
-  cv_ptr->header = input_compressed_image_msg->header;
+  image_ptr->header = input_compressed_image_msg->header;
 
-  // Decode color/mono image
   try {
-    cv_ptr->image = cv::imdecode(cv::Mat(input_compressed_image_msg->data), cv::IMREAD_COLOR);
+    // Decode color image, whose encoding is bgr8
+    if (!decoder_->decode(*input_compressed_image_msg, *image_ptr)) {
+      RCLCPP_ERROR(get_logger(), "Failed to decode the image with %s", decoder_->getName().c_str());
+      return;
+    }
 
     // Assign image encoding string
     const size_t split_pos = input_compressed_image_msg->format.find(';');
-    if (split_pos == std::string::npos) {
-      // Older version of compressed_image_transport does not signal image format
-      switch (cv_ptr->image.channels()) {
-        case 1:
-          cv_ptr->encoding = sensor_msgs::image_encodings::MONO8;
-          break;
-        case 3:
-          cv_ptr->encoding = sensor_msgs::image_encodings::BGR8;
-          break;
-        default:
-          RCLCPP_ERROR(
-            get_logger(), "Unsupported number of channels: %i", cv_ptr->image.channels());
-          break;
-      }
-    } else {
+    // Older version of compressed_image_transport does not signal image format, so the decoded
+    // image is kept as bgr8
+    if (split_pos != std::string::npos) {
       std::string image_encoding;
       if (encoding_ == std::string("default")) {
         image_encoding = input_compressed_image_msg->format.substr(0, split_pos);
@@ -117,8 +127,6 @@ void ImageTransportDecompressor::onCompressedImage(
         image_encoding = input_compressed_image_msg->format.substr(0, split_pos);
       }
 
-      cv_ptr->encoding = image_encoding;
-
       if (sensor_msgs::image_encodings::isColor(image_encoding)) {
         std::string compressed_encoding = input_compressed_image_msg->format.substr(split_pos);
         bool compressed_bgr_image =
@@ -130,52 +138,51 @@ void ImageTransportDecompressor::onCompressedImage(
           if (
             (image_encoding == sensor_msgs::image_encodings::RGB8) ||
             (image_encoding == sensor_msgs::image_encodings::RGB16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2RGB);
+            convertColor(*image_ptr, cv::COLOR_BGR2RGB);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::RGBA8) ||
             (image_encoding == sensor_msgs::image_encodings::RGBA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2RGBA);
+            convertColor(*image_ptr, cv::COLOR_BGR2RGBA);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::BGRA8) ||
             (image_encoding == sensor_msgs::image_encodings::BGRA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2BGRA);
+            convertColor(*image_ptr, cv::COLOR_BGR2BGRA);
           }
         } else {
           // if necessary convert colors from rgb to bgr
           if (
             (image_encoding == sensor_msgs::image_encodings::BGR8) ||
             (image_encoding == sensor_msgs::image_encodings::BGR16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2BGR);
+            convertColor(*image_ptr, cv::COLOR_RGB2BGR);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::BGRA8) ||
             (image_encoding == sensor_msgs::image_encodings::BGRA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2BGRA);
+            convertColor(*image_ptr, cv::COLOR_RGB2BGRA);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::RGBA8) ||
             (image_encoding == sensor_msgs::image_encodings::RGBA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2RGBA);
+            convertColor(*image_ptr, cv::COLOR_RGB2RGBA);
           }
         }
       }
+
+      image_ptr->encoding = image_encoding;
     }
   } catch (cv::Exception & e) {
     RCLCPP_ERROR(get_logger(), "%s", e.what());
+    return;
   }
 
-  size_t rows = cv_ptr->image.rows;
-  size_t cols = cv_ptr->image.cols;
-
-  if ((rows > 0) && (cols > 0)) {
+  if ((image_ptr->height > 0) && (image_ptr->width > 0)) {
     // Publish message to user callback
-    auto image_ptr = std::make_unique<sensor_msgs::msg::Image>(*cv_ptr->toImageMsg());
     raw_image_pub_->publish(std::move(image_ptr));
   }
 }
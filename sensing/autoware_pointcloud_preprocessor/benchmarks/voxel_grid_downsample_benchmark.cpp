@@ -0,0 +1,135 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+
+#include <pcl_conversions/pcl_conversions.h>
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <benchmark/benchmark.h>
+#include <pcl/filters/voxel_grid.h>
+#include <pcl/io/pcd_io.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+
+using autoware::pointcloud_preprocessor::FasterVoxelGridDownsampleFilter;
+using autoware::pointcloud_preprocessor::TransformInfo;
+using sensor_msgs::msg::PointCloud2;
+
+namespace
+{
+// points of a fixed seed, dense near the sensor as the lidar points are
+pcl::PointCloud<pcl::PointXYZI>::Ptr createSyntheticCloud(const size_t num_points)
+{
+  std::mt19937 generator(0);
+  std::exponential_distribution<float> range_distribution(1.0f / 15.0f);
+  std::uniform_real_distribution<float> angle_distribution(-M_PI, M_PI);
+  std::uniform_real_distribution<float> z_distribution(-2.0f, 3.0f);
+  auto cloud = std::make_shared<pcl::PointCloud<pcl::PointXYZI>>();
+  cloud->reserve(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const float range = range_distribution(generator);
+    const float angle = angle_distribution(generator);
+    pcl::PointXYZI point;
+    point.x = range * std::cos(angle);
+    point.y = range * std::sin(angle);
+    point.z = z_distribution(generator);
+    point.intensity = static_cast<float>(i % 256);
+    cloud->push_back(point);
+  }
+  return cloud;
+}
+
+// the pointcloud given by AUTOWARE_PERCEPTION_BENCHMARK_PCD, or nullptr if not given
+pcl::PointCloud<pcl::PointXYZI>::Ptr loadRecordedCloud()
+{
+  const char * pcd_path = std::getenv("AUTOWARE_PERCEPTION_BENCHMARK_PCD");
+  if (!pcd_path) {
+    return nullptr;
+  }
+  auto cloud = std::make_shared<pcl::PointCloud<pcl::PointXYZI>>();
+  pcl::io::loadPCDFile<pcl::PointXYZI>(pcd_path, *cloud);
+  return cloud;
+}
+
+void runFasterVoxelGrid(
+  benchmark::State & state, const pcl::PointCloud<pcl::PointXYZI>::ConstPtr & cloud,
+  const float voxel_size)
+{
+  auto input = std::make_shared<PointCloud2>();
+  pcl::toROSMsg(*cloud, *input);
+  const auto logger = rclcpp::get_logger("voxel_grid_downsample_benchmark");
+
+  PointCloud2 output;
+  for (auto _ : state) {
+    // a filter per input as in the node
+    FasterVoxelGridDownsampleFilter filter;
+    filter.set_voxel_size(voxel_size, voxel_size, voxel_size);
+    filter.set_field_offsets(input, logger);
+    filter.filter(input, output, TransformInfo{}, logger);
+    benchmark::DoNotOptimize(output.data.data());
+  }
+  state.SetItemsProcessed(state.iterations() * cloud->size());
+  state.counters["output_points"] = output.width * output.height;
+}
+
+void runPclVoxelGrid(
+  benchmark::State & state, const pcl::PointCloud<pcl::PointXYZI>::ConstPtr & cloud,
+  const float voxel_size)
+{
+  pcl::PointCloud<pcl::PointXYZI> output;
+  for (auto _ : state) {
+    pcl::VoxelGrid<pcl::PointXYZI> filter;
+    filter.setLeafSize(voxel_size, voxel_size, voxel_size);
+    filter.setInputCloud(cloud);
+    filter.filter(output);
+    benchmark::DoNotOptimize(output.points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * cloud->size());
+  state.counters["output_points"] = output.size();
+}
+
+bool registerBenchmarks()
+{
+  const auto register_benchmarks = [](
+                                     const std::string & input_name,
+                                     const pcl::PointCloud<pcl::PointXYZI>::ConstPtr & cloud) {
+    for (const float voxel_size : {0.1f, 0.3f, 1.0f}) {
+      const auto suffix = "/" + input_name + "/" + std::to_string(voxel_size).substr(0, 3);
+      benchmark::RegisterBenchmark(
+        ("BM_FasterVoxelGrid" + suffix).c_str(),
+        [=](benchmark::State & state) { runFasterVoxelGrid(state, cloud, voxel_size); })
+        ->Unit(benchmark::kMillisecond);
+      benchmark::RegisterBenchmark(
+        ("BM_PclVoxelGrid" + suffix).c_str(),
+        [=](benchmark::State & state) { runPclVoxelGrid(state, cloud, voxel_size); })
+        ->Unit(benchmark::kMillisecond);
+    }
+  };
+
+  register_benchmarks("synthetic", createSyntheticCloud(200000));
+  if (const auto recorded_cloud = loadRecordedCloud()) {
+    register_benchmarks("recorded", recorded_cloud);
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool benchmarks_registered = registerBenchmarks();
+}  // namespace
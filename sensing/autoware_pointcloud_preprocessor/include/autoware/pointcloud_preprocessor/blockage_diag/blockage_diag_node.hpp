@@ -16,6 +16,7 @@
 #define AUTOWARE__POINTCLOUD_PREPROCESSOR__BLOCKAGE_DIAG__BLOCKAGE_DIAG_NODE_HPP_
 
 #include "autoware/pointcloud_preprocessor/filter.hpp"
+#include "autoware/universe_utils/system/time_keeper.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 #include <image_transport/image_transport.hpp>
@@ -35,6 +36,7 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -97,6 +99,14 @@ private:
   double horizontal_resolution_{0.4};
   boost::circular_buffer<cv::Mat> no_return_mask_buffer{1};
   boost::circular_buffer<cv::Mat> dust_mask_buffer{1};
+  // per-pixel sums of the masks in the buffers above, updated as masks are pushed and evicted
+  cv::Mat no_return_mask_buffer_sum_;
+  cv::Mat dust_mask_buffer_sum_;
+
+  // time keeper related
+  rclcpp::Publisher<autoware::universe_utils::ProcessingTimeDetail>::SharedPtr
+    detailed_processing_time_publisher_;
+  std::shared_ptr<autoware::universe_utils::TimeKeeper> time_keeper_;
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
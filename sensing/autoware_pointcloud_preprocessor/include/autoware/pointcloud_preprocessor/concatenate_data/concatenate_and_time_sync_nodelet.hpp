@@ -62,6 +62,7 @@
 
 // ROS includes
 #include "autoware/point_types/types.hpp"
+#include "autoware/pointcloud_preprocessor/utility/twist_history.hpp"
 
 #include <autoware/universe_utils/ros/debug_publisher.hpp>
 #include <autoware/universe_utils/ros/managed_transform_buffer.hpp>
@@ -128,6 +129,10 @@ private:
 
   bool publish_synchronized_pointcloud_;
   bool keep_input_frame_in_synchronized_pointcloud_;
+  /** \brief If true, transform each input directly into its slice of a single output buffer. */
+  bool use_preallocated_output_buffer_;
+  /** \brief Number of threads used to transform the inputs into the preallocated buffer. */
+  int num_transform_threads_{1};
   std::string synchronized_pointcloud_postfix_;
 
   std::set<std::string> not_subscribed_topic_names_;
@@ -155,7 +160,7 @@ private:
 
   std::unique_ptr<autoware::universe_utils::ManagedTransformBuffer> managed_tf_buffer_{nullptr};
 
-  std::deque<geometry_msgs::msg::TwistStamped::ConstSharedPtr> twist_ptr_queue_;
+  utils::TwistHistory twist_history_;
 
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_;
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_tmp_;
@@ -168,6 +173,10 @@ private:
     const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp);
   std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr> combineClouds(
     sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr);
+  std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr>
+  combineCloudsIntoPreallocatedBuffer(sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr);
+  Eigen::Matrix4f computeTransformToAdjustForOldestTimestamp(
+    const rclcpp::Time & cloud_stamp, const std::vector<rclcpp::Time> & sorted_stamps);
   void publish();
 
   void convertToXYZIRCCloud(
@@ -43,6 +43,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::pointcloud_preprocessor
 {
@@ -82,6 +83,8 @@ protected:
   void warn_if_timestamp_is_too_late(
     bool is_twist_time_stamp_too_late, bool is_imu_time_stamp_too_late);
   static tf2::Transform convert_matrix_to_transform(const Eigen::Matrix4f & matrix);
+  static Eigen::Matrix4f convert_transform_to_matrix(const tf2::Transform & transform);
+  static float compute_azimuth(const AngleConversion & angle_conversion, float x, float y);
 
 public:
   explicit DistortionCorrectorBase(rclcpp::Node & node, const bool & has_static_tf_only)
@@ -111,6 +114,11 @@ public:
   virtual void undistort_pointcloud(
     bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
     sensor_msgs::msg::PointCloud2 & pointcloud) = 0;
+  // Same result as undistort_pointcloud, but computes one transform per unique point time stamp
+  // and applies them to all points afterwards in a data-parallel pass.
+  virtual void undistort_pointcloud_batched(
+    bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
+    sensor_msgs::msg::PointCloud2 & pointcloud) = 0;
 };
 
 template <class T>
@@ -126,6 +134,10 @@ public:
     bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
     sensor_msgs::msg::PointCloud2 & pointcloud) override;
 
+  void undistort_pointcloud_batched(
+    bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
+    sensor_msgs::msg::PointCloud2 & pointcloud) override;
+
   void undistort_point(
     sensor_msgs::PointCloud2Iterator<float> & it_x, sensor_msgs::PointCloud2Iterator<float> & it_y,
     sensor_msgs::PointCloud2Iterator<float> & it_z,
@@ -136,6 +148,17 @@ public:
     static_cast<T *>(this)->undistort_point_implementation(
       it_x, it_y, it_z, it_twist, it_imu, time_offset, is_twist_valid, is_imu_valid);
   };
+
+  // Advance the motion state by time_offset and return the transform to apply to the points that
+  // share the resulting time stamp, expressed in the pointcloud frame.
+  Eigen::Matrix4f compute_point_transform(
+    std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
+    std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, float const & time_offset,
+    const bool & is_twist_valid, const bool & is_imu_valid)
+  {
+    return static_cast<T *>(this)->compute_point_transform_implementation(
+      it_twist, it_imu, time_offset, is_twist_valid, is_imu_valid);
+  };
 };
 
 class DistortionCorrector2D : public DistortionCorrector<DistortionCorrector2D>
@@ -168,6 +191,10 @@ public:
     std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
     std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
     const bool & is_twist_valid, const bool & is_imu_valid);
+  Eigen::Matrix4f compute_point_transform_implementation(
+    std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
+    std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
+    const bool & is_twist_valid, const bool & is_imu_valid);
 };
 
 class DistortionCorrector3D : public DistortionCorrector<DistortionCorrector3D>
@@ -197,6 +224,10 @@ public:
     std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
     std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
     const bool & is_twist_valid, const bool & is_imu_valid);
+  Eigen::Matrix4f compute_point_transform_implementation(
+    std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
+    std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
+    const bool & is_twist_valid, const bool & is_imu_valid);
 };
 
 }  // namespace autoware::pointcloud_preprocessor
@@ -53,6 +53,7 @@ private:
   bool use_imu_;
   bool use_3d_distortion_correction_;
   bool update_azimuth_and_distance_;
+  bool use_batched_undistortion_;
 
   std::optional<AngleConversion> angle_conversion_opt_;
 
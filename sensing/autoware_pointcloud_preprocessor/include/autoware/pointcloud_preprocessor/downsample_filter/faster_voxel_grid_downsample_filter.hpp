@@ -14,13 +14,13 @@
 
 #pragma once
 
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_hash_grid.hpp"
 #include "autoware/pointcloud_preprocessor/transform_info.hpp"
 
 #include <pcl/filters/voxel_grid.h>
 #include <pcl_conversions/pcl_conversions.h>
 #include <sensor_msgs/msg/point_cloud2.h>
 
-#include <unordered_map>
 #include <vector>
 
 namespace autoware::pointcloud_preprocessor
@@ -40,40 +40,7 @@ public:
     const rclcpp::Logger & logger);
 
 private:
-  struct Centroid
-  {
-    float x;
-    float y;
-    float z;
-    float intensity;
-    uint32_t point_count_;
-
-    Centroid() : x(0), y(0), z(0), intensity(0) {}
-    Centroid(float _x, float _y, float _z, float _intensity)
-    : x(_x), y(_y), z(_z), intensity(_intensity)
-    {
-      this->point_count_ = 1;
-    }
-
-    void add_point(float _x, float _y, float _z, float _intensity)
-    {
-      this->x += _x;
-      this->y += _y;
-      this->z += _z;
-      this->intensity += _intensity;
-      this->point_count_++;
-    }
-
-    Eigen::Vector4f calc_centroid() const
-    {
-      Eigen::Vector4f centroid(
-        (this->x / this->point_count_), (this->y / this->point_count_),
-        (this->z / this->point_count_), (this->intensity / this->point_count_));
-      return centroid;
-    }
-  };
-
-  Eigen::Vector3f inverse_voxel_size_;
+  VoxelHashGrid<CentroidReducer> voxel_grid_;
   int x_offset_;
   int y_offset_;
   int z_offset_;
@@ -84,16 +51,9 @@ private:
   Eigen::Vector4f get_point_from_global_offset(
     const PointCloud2ConstPtr & input, size_t global_offset);
 
-  bool get_min_max_voxel(
-    const PointCloud2ConstPtr & input, Eigen::Vector3i & min_voxel, Eigen::Vector3i & max_voxel);
-
-  std::unordered_map<uint32_t, Centroid> calc_centroids_each_voxel(
-    const PointCloud2ConstPtr & input, const Eigen::Vector3i & max_voxel,
-    const Eigen::Vector3i & min_voxel);
+  void calc_centroids_each_voxel(const PointCloud2ConstPtr & input);
 
-  void copy_centroids_to_output(
-    std::unordered_map<uint32_t, Centroid> & voxel_centroid_map, PointCloud2 & output,
-    const TransformInfo & transform_info);
+  void copy_centroids_to_output(PointCloud2 & output, const TransformInfo & transform_info);
 };
 
 }  // namespace autoware::pointcloud_preprocessor
@@ -0,0 +1,189 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__DOWNSAMPLE_FILTER__VOXEL_HASH_GRID_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__DOWNSAMPLE_FILTER__VOXEL_HASH_GRID_HPP_
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/robin_hood.h"
+
+#include <Eigen/Core>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace autoware::pointcloud_preprocessor
+{
+/**
+ * @brief Integer coordinates of a voxel.
+ * Unlike a flattened index over the bounding box of the input, a key does not overflow for large
+ * inputs or small voxel sizes.
+ */
+using VoxelKey = std::array<int, 3>;
+
+/**
+ * @brief Hash function for voxel keys.
+ * Utilizes prime numbers to calculate a unique hash for each voxel key.
+ */
+struct VoxelKeyHash
+{
+  std::size_t operator()(const VoxelKey & k) const
+  {
+    // Primes based on the following paper: 'Investigating the Use of Primes in Hashing for
+    // Volumetric Data'.
+    return static_cast<std::size_t>(k[0]) * 73856093 ^ static_cast<std::size_t>(k[1]) * 19349663 ^
+           static_cast<std::size_t>(k[2]) * 83492791;
+  }
+};
+
+/**
+ * @brief Equality function for voxel keys.
+ * Checks if two voxel keys are equal.
+ */
+struct VoxelKeyEqual
+{
+  bool operator()(const VoxelKey & a, const VoxelKey & b) const { return a == b; }
+};
+
+/**
+ * @brief Reducer that accumulates the coordinates and the intensity of the points in a voxel, so
+ * that the voxel can be represented by their centroid.
+ */
+struct CentroidReducer
+{
+  struct State
+  {
+    float x{0};
+    float y{0};
+    float z{0};
+    float intensity{0};
+    uint32_t point_count{0};
+
+    Eigen::Vector4f calc_centroid() const
+    {
+      return Eigen::Vector4f(
+        x / point_count, y / point_count, z / point_count, intensity / point_count);
+    }
+  };
+
+  static State init(float x, float y, float z, float intensity)
+  {
+    return State{x, y, z, intensity, 1};
+  }
+
+  static void update(State & state, float x, float y, float z, float intensity)
+  {
+    state.x += x;
+    state.y += y;
+    state.z += z;
+    state.intensity += intensity;
+    state.point_count++;
+  }
+};
+
+/**
+ * @brief Reducer that keeps the offset of the first point added to a voxel, so that the voxel can
+ * be represented by an actual input point.
+ */
+struct FirstPointReducer
+{
+  using State = std::size_t;
+
+  static State init(std::size_t global_offset) { return global_offset; }
+
+  static void update([[maybe_unused]] State & state, [[maybe_unused]] std::size_t global_offset) {}
+};
+
+/**
+ * @brief Reducer that counts the points in a voxel, so that sparse voxels can be told apart from
+ * the ones having at least a given number of points.
+ */
+struct CountThresholdReducer
+{
+  using State = uint32_t;
+
+  static State init() { return 1; }
+
+  static void update(State & state) { state++; }
+
+  static bool reached(const State & state, uint32_t threshold) { return state >= threshold; }
+};
+
+/**
+ * @brief Voxel grid backed by a hash map, which visits the input once and only stores the voxels
+ * that contain points.
+ * @tparam Reducer policy that defines the per-voxel `State` and how points are folded into it via
+ * `init()` and `update()`.
+ */
+template <typename Reducer>
+class VoxelHashGrid
+{
+public:
+  using State = typename Reducer::State;
+  using Map = robin_hood::unordered_map<VoxelKey, State, VoxelKeyHash, VoxelKeyEqual>;
+
+  VoxelHashGrid() : inverse_voxel_size_(Eigen::Array3f::Ones()) {}
+
+  void set_voxel_size(float voxel_size_x, float voxel_size_y, float voxel_size_z)
+  {
+    inverse_voxel_size_ =
+      Eigen::Array3f::Ones() / Eigen::Array3f(voxel_size_x, voxel_size_y, voxel_size_z);
+  }
+
+  /** @brief Remove all voxels while keeping the allocated buckets for the next input. */
+  void clear() { voxels_.clear(); }
+
+  void reserve(std::size_t num_points) { voxels_.reserve(num_points); }
+
+  VoxelKey get_voxel_key(float x, float y, float z) const
+  {
+    return {
+      static_cast<int>(std::floor(x * inverse_voxel_size_[0])),
+      static_cast<int>(std::floor(y * inverse_voxel_size_[1])),
+      static_cast<int>(std::floor(z * inverse_voxel_size_[2]))};
+  }
+
+  /** @brief Fold a point into its voxel. `args` are forwarded to the reducer. */
+  template <typename... Args>
+  void add_point(float x, float y, float z, Args &&... args)
+  {
+    const VoxelKey key = get_voxel_key(x, y, z);
+    auto it = voxels_.find(key);
+    if (it == voxels_.end()) {
+      voxels_.emplace(key, Reducer::init(std::forward<Args>(args)...));
+    } else {
+      Reducer::update(it->second, std::forward<Args>(args)...);
+    }
+  }
+
+  /** @brief Return the state of the voxel containing the given point, or nullptr if empty. */
+  const State * find(float x, float y, float z) const
+  {
+    const auto it = voxels_.find(get_voxel_key(x, y, z));
+    return it == voxels_.end() ? nullptr : &it->second;
+  }
+
+  const Map & voxels() const { return voxels_; }
+  std::size_t size() const { return voxels_.size(); }
+
+private:
+  Eigen::Array3f inverse_voxel_size_;
+  Map voxels_;
+};
+
+}  // namespace autoware::pointcloud_preprocessor
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__DOWNSAMPLE_FILTER__VOXEL_HASH_GRID_HPP_
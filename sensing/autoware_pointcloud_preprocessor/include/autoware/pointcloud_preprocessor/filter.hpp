@@ -53,6 +53,7 @@
 #define AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_HPP_
 
 #include "autoware/pointcloud_preprocessor/transform_info.hpp"
+#include "autoware/pointcloud_preprocessor/utility/filter_statistics.hpp"
 
 #include <memory>
 #include <string>
@@ -62,6 +63,7 @@
 #include <boost/thread/mutex.hpp>
 
 #include <pcl/filters/filter.h>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <sensor_msgs/msg/point_cloud2.h>
 // PCL includes
 #include <message_filters/subscriber.h>
@@ -180,6 +182,10 @@ protected:
   std::unique_ptr<autoware::universe_utils::DebugPublisher> debug_publisher_;
   std::unique_ptr<autoware::universe_utils::PublishedTimePublisher> published_time_publisher_;
 
+  /** \brief Throughput, drop and latency statistics of this filter, which are reported together
+   * with the statistics of the other filters in the same process. **/
+  std::shared_ptr<utils::StageStatistics> statistics_;
+
   /** \brief Virtual abstract filter method. To be implemented by every child.
    * \param input the input point cloud dataset.
    * \param indices a pointer to the vector of point indices to use.
@@ -205,8 +211,11 @@ protected:
   /** \brief Call the child filter () method, optionally transform the result, and publish it.
    * \param input the input point cloud dataset.
    * \param indices a pointer to the vector of point indices to use.
+   * \param measurement the statistics measurement of the input, finished when it is published.
    */
-  void computePublish(const PointCloud2ConstPtr & input, const IndicesPtr & indices);
+  void computePublish(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices,
+    utils::StageStatistics::Measurement & measurement);
 
   //////////////////////
   // from PCLNodelet //
@@ -238,6 +247,10 @@ protected:
    * versus an exact one (false by default). */
   bool approximate_sync_ = false;
 
+  /** \brief True if the output is published in the quantized PointXYZIRCPacked format to cut the
+   * transport bandwidth, when it has the PointXYZIRC layout (false by default). */
+  bool output_packed_ = false;
+
   std::unique_ptr<autoware::universe_utils::ManagedTransformBuffer> managed_tf_buffer_{nullptr};
 
   inline bool isValid(
@@ -280,7 +293,7 @@ private:
   std::shared_ptr<ApproximateTimeSyncPolicy> sync_input_indices_a_;
 
   /** \brief PointCloud2 + Indices data callback. */
-  void input_indices_callback(const PointCloud2ConstPtr cloud, const PointIndicesConstPtr indices);
+  void input_indices_callback(const PointCloud2ConstPtr input, const PointIndicesConstPtr indices);
 
   /** \brief Get a matrix for conversion from the original frame to the target frame */
   bool calculate_transform_matrix(
@@ -289,12 +302,28 @@ private:
 
   bool convert_output_costly(std::unique_ptr<PointCloud2> & output);
 
+  /** \brief Unpack the input in the PointXYZIRCPacked format, or return the input as it is. */
+  PointCloud2ConstPtr unpack_input(const PointCloud2ConstPtr & input);
+
+  /** \brief Pack the output into the PointXYZIRCPacked format if it is requested and possible. */
+  void pack_output(std::unique_ptr<PointCloud2> & output);
+
   // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
   // to new API.
   void faster_input_indices_callback(
-    const PointCloud2ConstPtr cloud, const PointIndicesConstPtr indices);
+    const PointCloud2ConstPtr input, const PointIndicesConstPtr indices);
 
   void setupTF();
+
+  /** \brief Start the measurement of the statistics of an input. */
+  utils::StageStatistics::Measurement startMeasurement(const PointCloud2 & input);
+
+  /** \brief Publish the statistics of all filters in this process if this filter is the reporter.
+   */
+  void publishStatistics();
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_statistics_;
+  rclcpp::TimerBase::SharedPtr statistics_timer_;
+  std::chrono::steady_clock::time_point last_statistics_time_;
 };
 }  // namespace autoware::pointcloud_preprocessor
 
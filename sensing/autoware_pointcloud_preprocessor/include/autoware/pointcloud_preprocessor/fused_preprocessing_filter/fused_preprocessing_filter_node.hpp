@@ -0,0 +1,134 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__FUSED_PREPROCESSING_FILTER__FUSED_PREPROCESSING_FILTER_NODE_HPP_  // NOLINT
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__FUSED_PREPROCESSING_FILTER__FUSED_PREPROCESSING_FILTER_NODE_HPP_  // NOLINT
+
+#include "autoware/point_types/types.hpp"
+#include "autoware/pointcloud_preprocessor/filter.hpp"
+#include "autoware/pointcloud_preprocessor/transform_info.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+/** \brief Runs crop box filter, ring outlier filter and voxel grid downsample filter as a single
+ * filter, so that no intermediate message is created between the stages. Each stage behaves the
+ * same as the corresponding standalone filter node and can be disabled individually.
+ */
+class FusedPreprocessingFilterComponent : public autoware::pointcloud_preprocessor::Filter
+{
+protected:
+  using InputPointType = autoware::point_types::PointXYZIRCAEDT;
+  using OutputPointType = autoware::point_types::PointXYZIRC;
+
+  virtual void filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output);
+
+  // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
+  // to new API
+  virtual void faster_filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+    const TransformInfo & transform_info);
+
+private:
+  struct CropBoxParam
+  {
+    bool enable{true};
+    float min_x;
+    float max_x;
+    float min_y;
+    float max_y;
+    float min_z;
+    float max_z;
+    bool negative{false};
+  } crop_box_param_;
+
+  struct RingOutlierFilterParam
+  {
+    bool enable{true};
+    double distance_ratio;
+    double object_length_threshold;
+    int num_points_threshold;
+    uint16_t max_rings_num;
+    size_t max_points_num_per_ring;
+  } ring_outlier_filter_param_;
+
+  struct VoxelGridDownsampleParam
+  {
+    bool enable{true};
+    float voxel_size_x;
+    float voxel_size_y;
+    float voxel_size_z;
+  } voxel_grid_downsample_param_;
+
+  /** \brief Output of the crop box and ring outlier stages when the voxel grid stage is enabled.
+   * Kept as a member so that its buffer is reused across frames. */
+  std::shared_ptr<PointCloud2> filtered_points_ptr_{std::make_shared<PointCloud2>()};
+
+  /** \brief Offsets of the xyz fields of the current input */
+  size_t x_offset_{0};
+  size_t y_offset_{0};
+  size_t z_offset_{0};
+
+  /** \brief Per-ring indices of the points kept by the crop box stage, reused across frames. */
+  std::vector<std::vector<size_t>> ring2indices_;
+
+  /** \brief Parameter service callback result : needed to be hold */
+  OnSetParametersCallbackHandle::SharedPtr set_param_res_;
+
+  /** \brief Parameter service callback */
+  rcl_interfaces::msg::SetParametersResult paramCallback(const std::vector<rclcpp::Parameter> & p);
+
+  /** \brief Read a point from the input and apply the input transform. Returns false for points
+   * with non-finite coordinates or points removed by the crop box stage. */
+  bool getCroppedPoint(
+    const PointCloud2ConstPtr & input, size_t data_idx, const TransformInfo & transform_info,
+    Eigen::Vector4f & point) const;
+
+  void filterCropBox(
+    const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info);
+  void filterCropBoxAndRingOutlier(
+    const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info);
+
+  bool isCluster(
+    const PointCloud2ConstPtr & input, std::pair<size_t, size_t> data_idx_both_ends,
+    int walk_size) const
+  {
+    if (walk_size > ring_outlier_filter_param_.num_points_threshold) return true;
+
+    auto first_point =
+      reinterpret_cast<const InputPointType *>(&input->data[data_idx_both_ends.first]);
+    auto last_point =
+      reinterpret_cast<const InputPointType *>(&input->data[data_idx_both_ends.second]);
+
+    const auto x = first_point->x - last_point->x;
+    const auto y = first_point->y - last_point->y;
+    const auto z = first_point->z - last_point->z;
+
+    return x * x + y * y + z * z >= ring_outlier_filter_param_.object_length_threshold *
+                                      ring_outlier_filter_param_.object_length_threshold;
+  }
+
+public:
+  PCL_MAKE_ALIGNED_OPERATOR_NEW
+  explicit FusedPreprocessingFilterComponent(const rclcpp::NodeOptions & options);
+};
+}  // namespace autoware::pointcloud_preprocessor
+
+// clang-format off
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__FUSED_PREPROCESSING_FILTER__FUSED_PREPROCESSING_FILTER_NODE_HPP_  // NOLINT
+// clang-format on
@@ -16,6 +16,7 @@
 #define AUTOWARE__POINTCLOUD_PREPROCESSOR__OUTLIER_FILTER__RADIUS_SEARCH_2D_OUTLIER_FILTER_NODE_HPP_  // NOLINT
 
 #include "autoware/pointcloud_preprocessor/filter.hpp"
+#include "autoware/pointcloud_preprocessor/utility/radius_search_2d_grid.hpp"
 
 #include <pcl/common/impl/common.hpp>
 
@@ -38,9 +39,7 @@ private:
   double search_radius_;
   size_t min_neighbors_;
 
-  // pcl::RadiusOutlierRemoval<pcl::PCLPointCloud2> radius_outlier_removal_;
-  pcl::search::Search<pcl::PointXY>::Ptr kd_tree_;
-  // pcl::ExtractIndices<pcl::PCLPointCloud2> extract_indices_;
+  utils::RadiusSearch2dGrid grid_;
 
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
@@ -65,6 +65,7 @@ private:
   uint16_t max_rings_num_;
   size_t max_points_num_per_ring_;
   bool publish_outlier_pointcloud_;
+  int num_threads_;
 
   // for visibility score
   int noise_threshold_;
@@ -81,8 +82,27 @@ private:
   /** \brief Parameter service callback */
   rcl_interfaces::msg::SetParametersResult paramCallback(const std::vector<rclcpp::Parameter> & p);
 
+  /** \brief Walks of a ring, as inclusive ranges of positions in the indices of the ring */
+  struct RingWalks
+  {
+    std::vector<std::pair<int, int>> inlier_walks;
+    std::vector<std::pair<int, int>> outlier_walks;
+    size_t num_inliers{0};
+    size_t output_offset{0};
+  };
+
+  /** \brief Data offsets of the points of each ring, reused across frames */
+  std::vector<std::vector<size_t>> ring2indices_;
+  /** \brief Walks found in each ring, reused across frames */
+  std::vector<RingWalks> ring_walks_;
+
+  /** \brief Split a ring into walks and classify each of them as inlier or outlier */
+  void segmentRing(
+    const PointCloud2ConstPtr & input, const std::vector<size_t> & indices,
+    RingWalks & walks) const;
+
   bool isCluster(
-    const PointCloud2ConstPtr & input, std::pair<int, int> data_idx_both_ends, int walk_size)
+    const PointCloud2ConstPtr & input, std::pair<int, int> data_idx_both_ends, int walk_size) const
   {
     if (walk_size > num_points_threshold_) return true;
 
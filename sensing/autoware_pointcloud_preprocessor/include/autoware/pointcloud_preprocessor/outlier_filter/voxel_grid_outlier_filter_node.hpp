@@ -15,11 +15,9 @@
 #ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__OUTLIER_FILTER__VOXEL_GRID_OUTLIER_FILTER_NODE_HPP_
 #define AUTOWARE__POINTCLOUD_PREPROCESSOR__OUTLIER_FILTER__VOXEL_GRID_OUTLIER_FILTER_NODE_HPP_
 
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_hash_grid.hpp"
 #include "autoware/pointcloud_preprocessor/filter.hpp"
 
-#include <pcl/filters/voxel_grid.h>
-#include <pcl/search/pcl_search.h>
-
 #include <vector>
 
 namespace autoware::pointcloud_preprocessor
@@ -42,7 +40,7 @@ private:
   double voxel_size_z_;
   int voxel_points_threshold_;
 
-  pcl::VoxelGrid<pcl::PointXYZ> voxel_filter;
+  VoxelHashGrid<CountThresholdReducer> voxel_grid_;
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
@@ -17,8 +17,11 @@
 
 #include "autoware/pointcloud_preprocessor/filter.hpp"
 
+#include <Eigen/Core>
+
 #include <boost/circular_buffer.hpp>
 
+#include <string>
 #include <vector>
 
 namespace autoware::pointcloud_preprocessor
@@ -36,8 +39,23 @@ protected:
   rcl_interfaces::msg::SetParametersResult paramCallback(const std::vector<rclcpp::Parameter> & p);
 
 private:
+  /** \brief A past pointcloud with its pose in the world frame, looked up when it arrived. */
+  struct Sweep
+  {
+    PointCloud2ConstPtr cloud;
+    Eigen::Matrix4f world_from_sweep{Eigen::Matrix4f::Identity()};
+  };
+
+  /** \brief Whether anyone subscribes the merged output. */
+  bool hasSubscribers() const;
+
+  /** \brief Concatenate the sweeps within the accumulation time having the layout of the latest
+   * one, transforming them to the latest one if the world frame is given. */
+  void mergeSweeps(PointCloud2 & output) const;
+
   double accumulation_time_sec_;
-  boost::circular_buffer<PointCloud2ConstPtr> pointcloud_buffer_;
+  std::string world_frame_;
+  boost::circular_buffer<Sweep> pointcloud_buffer_;
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
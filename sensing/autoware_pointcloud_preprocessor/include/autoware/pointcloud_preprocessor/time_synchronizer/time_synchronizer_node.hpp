@@ -61,6 +61,8 @@
 #include <vector>
 
 // ROS includes
+#include "autoware/pointcloud_preprocessor/utility/twist_history.hpp"
+
 #include <autoware/point_types/types.hpp>
 #include <autoware/universe_utils/ros/debug_publisher.hpp>
 #include <autoware/universe_utils/ros/managed_transform_buffer.hpp>
@@ -149,7 +151,7 @@ private:
 
   std::unique_ptr<autoware::universe_utils::ManagedTransformBuffer> managed_tf_buffer_{nullptr};
 
-  std::deque<geometry_msgs::msg::TwistStamped::ConstSharedPtr> twist_ptr_queue_;
+  utils::TwistHistory twist_history_;
 
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_;
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_tmp_;
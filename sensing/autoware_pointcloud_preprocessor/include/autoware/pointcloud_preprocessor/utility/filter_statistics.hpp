@@ -0,0 +1,118 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__FILTER_STATISTICS_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__FILTER_STATISTICS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor::utils
+{
+/** @brief statistics of a filter stage accumulated since they were last taken */
+struct StageSummary
+{
+  std::string name;
+  size_t messages{0};
+  // messages which were received but not published, e.g. invalid or failed to be transformed
+  size_t rejected_messages{0};
+  uint64_t input_points{0};
+  uint64_t output_points{0};
+  uint64_t input_bytes{0};
+  uint64_t output_bytes{0};
+  double processing_time_ms_mean{0.0};
+  double processing_time_ms_max{0.0};
+  // delay between the header stamp of the input and the start of the processing
+  double queueing_delay_ms_mean{0.0};
+  double queueing_delay_ms_max{0.0};
+};
+
+/**
+ * @brief lightweight statistics of a filter stage, which are updated once per message
+ */
+class StageStatistics
+{
+public:
+  /**
+   * @brief measurement of a message, which is counted as rejected unless it is finished
+   */
+  class Measurement
+  {
+  public:
+    Measurement(
+      std::shared_ptr<StageStatistics> statistics, size_t input_points, size_t input_bytes,
+      double queueing_delay_ms);
+    ~Measurement();
+    Measurement(const Measurement &) = delete;
+    Measurement & operator=(const Measurement &) = delete;
+
+    /** @brief record the published output */
+    void finish(size_t output_points, size_t output_bytes);
+
+  private:
+    std::shared_ptr<StageStatistics> statistics_;
+    std::chrono::steady_clock::time_point start_;
+    size_t input_points_;
+    size_t input_bytes_;
+    double queueing_delay_ms_;
+    bool finished_{false};
+  };
+
+  explicit StageStatistics(std::string name);
+
+  void add(
+    size_t input_points, size_t input_bytes, size_t output_points, size_t output_bytes,
+    double processing_time_ms, double queueing_delay_ms);
+  void add_rejected();
+
+  /** @brief take the statistics accumulated so far and start accumulating again */
+  StageSummary take();
+
+private:
+  std::mutex mutex_;
+  StageSummary current_;
+  double processing_time_ms_sum_{0.0};
+  double queueing_delay_ms_sum_{0.0};
+};
+
+/**
+ * @brief statistics of all filter stages in this process, e.g. in a container, so that they are
+ * reported together by one of the stages
+ */
+class FilterStatisticsRegistry
+{
+public:
+  static FilterStatisticsRegistry & instance();
+
+  /** @brief add a stage, which is removed when the returned statistics are released */
+  std::shared_ptr<StageStatistics> add_stage(const std::string & name);
+
+  /** @brief true if the stage is the oldest one alive, which reports all the stages */
+  bool is_reporter(const StageStatistics * stage);
+
+  /** @brief take the statistics of all stages alive */
+  std::vector<StageSummary> take_all();
+
+private:
+  std::mutex mutex_;
+  std::vector<std::weak_ptr<StageStatistics>> stages_;
+};
+}  // namespace autoware::pointcloud_preprocessor::utils
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__FILTER_STATISTICS_HPP_
@@ -35,6 +35,19 @@ bool is_data_layout_compatible_with_point_xyziradrt(const sensor_msgs::msg::Poin
  * is to say whether you can memcpy from the PointCloud2 data buffer to a PointXYZIRCAEDT */
 bool is_data_layout_compatible_with_point_xyzircaedt(const sensor_msgs::msg::PointCloud2 & input);
 
+/** \brief Return whether the input PointCloud2 data has the same layout than PointXYZIRCPacked, the
+ * quantized format for the transport */
+bool is_data_layout_compatible_with_point_xyzirc_packed(
+  const sensor_msgs::msg::PointCloud2 & input);
+
+/** \brief Pack the input having the same layout than PointXYZIRC into PointXYZIRCPacked */
+void pack_point_xyzirc(
+  const sensor_msgs::msg::PointCloud2 & input, sensor_msgs::msg::PointCloud2 & output);
+
+/** \brief Unpack the input having the same layout than PointXYZIRCPacked into PointXYZIRC */
+void unpack_point_xyzirc(
+  const sensor_msgs::msg::PointCloud2 & input, sensor_msgs::msg::PointCloud2 & output);
+
 }  // namespace autoware::pointcloud_preprocessor::utils
 
 #endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__MEMORY_HPP_
@@ -0,0 +1,265 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_RASTER_INDEX_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_RASTER_INDEX_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor::utils
+{
+/**
+ * @brief grid over a rectangular tile that tells for each cell whether it lies inside one of a set
+ * of polygons, outside all of them, or on the boundary of some of them
+ *
+ * A lookup is O(1) for the cells inside or outside the polygons. For the boundary cells and for
+ * the points out of the tile, the caller provides the exact point-in-polygon test, which is only
+ * run against the polygons that cross the cell, so the result is the same as testing every
+ * polygon.
+ */
+class PolygonRasterIndex
+{
+public:
+  /**
+   * @brief rasterize the polygons over the tile [min_x, max_x] x [min_y, max_y]
+   *
+   * @param polygons polygons as sequences of points with x() and y(), without repeating the first
+   * point. The polygon indices given to the exact test are the indices in this sequence.
+   * @param resolution size of a cell [m]
+   */
+  template <typename PolygonsT>
+  void build(
+    const PolygonsT & polygons, double min_x, double min_y, double max_x, double max_y,
+    double resolution);
+
+  void clear()
+  {
+    num_cells_x_ = 0;
+    num_cells_y_ = 0;
+    num_polygons_ = 0;
+    cells_.clear();
+    boundary_offsets_.clear();
+    boundary_polygons_.clear();
+  }
+
+  bool empty() const { return cells_.empty(); }
+
+  /** @brief whether the tile contains the area [min_x, max_x] x [min_y, max_y] */
+  bool covers(double min_x, double min_y, double max_x, double max_y) const
+  {
+    return !empty() && min_x >= min_x_ && min_y >= min_y_ &&
+           max_x < min_x_ + static_cast<double>(num_cells_x_) * resolution_ &&
+           max_y < min_y_ + static_cast<double>(num_cells_y_) * resolution_;
+  }
+
+  /**
+   * @brief whether the point is within one of the polygons
+   *
+   * @param is_within_polygon exact test, called with the index of a polygon
+   */
+  template <typename IsWithinPolygonT>
+  bool is_within(double x, double y, IsWithinPolygonT && is_within_polygon) const
+  {
+    const double cell_x = std::floor((x - min_x_) / resolution_);
+    const double cell_y = std::floor((y - min_y_) / resolution_);
+    // also false for NaN
+    if (!(cell_x >= 0.0 && cell_x < num_cells_x_ && cell_y >= 0.0 && cell_y < num_cells_y_)) {
+      for (uint32_t polygon_index = 0; polygon_index < num_polygons_; ++polygon_index) {
+        if (is_within_polygon(polygon_index)) return true;
+      }
+      return false;
+    }
+
+    const size_t cell_index =
+      static_cast<size_t>(cell_y) * num_cells_x_ + static_cast<size_t>(cell_x);
+    switch (cells_[cell_index]) {
+      case CellState::INSIDE:
+        return true;
+      case CellState::OUTSIDE:
+        return false;
+      default:
+        break;
+    }
+    for (uint32_t i = boundary_offsets_[cell_index]; i < boundary_offsets_[cell_index + 1]; ++i) {
+      if (is_within_polygon(boundary_polygons_[i])) return true;
+    }
+    return false;
+  }
+
+private:
+  enum CellState : uint8_t { OUTSIDE = 0, INSIDE, BOUNDARY };
+
+  /** @brief margin in cells added around the edges so that rounding never misses a cell */
+  static constexpr double cell_margin = 1e-6;
+
+  double min_x_{0.0};
+  double min_y_{0.0};
+  double resolution_{1.0};
+  size_t num_cells_x_{0};
+  size_t num_cells_y_{0};
+  uint32_t num_polygons_{0};
+
+  std::vector<uint8_t> cells_;
+  /** @brief polygons crossing each boundary cell, as ranges of boundary_polygons_ per cell */
+  std::vector<uint32_t> boundary_offsets_;
+  std::vector<uint32_t> boundary_polygons_;
+};
+
+template <typename PolygonsT>
+void PolygonRasterIndex::build(
+  const PolygonsT & polygons, double min_x, double min_y, double max_x, double max_y,
+  double resolution)
+{
+  clear();
+  min_x_ = min_x;
+  min_y_ = min_y;
+  resolution_ = resolution;
+  num_cells_x_ = static_cast<size_t>(std::max(std::ceil((max_x - min_x) / resolution), 1.0));
+  num_cells_y_ = static_cast<size_t>(std::max(std::ceil((max_y - min_y) / resolution), 1.0));
+  num_polygons_ = static_cast<uint32_t>(std::size(polygons));
+  const size_t num_cells = num_cells_x_ * num_cells_y_;
+  cells_.assign(num_cells, CellState::OUTSIDE);
+
+  // (cell, polygon) pairs of the boundary cells, and the last polygon marked on each cell so that
+  // the interior fill of a polygon can skip its own boundary cells
+  std::vector<std::pair<uint32_t, uint32_t>> boundary_pairs;
+  std::vector<int64_t> last_boundary_polygon(num_cells, -1);
+  std::vector<double> crossings;
+
+  const auto to_cell_x = [this](double x) { return (x - min_x_) / resolution_; };
+  const auto to_cell_y = [this](double y) { return (y - min_y_) / resolution_; };
+  const auto clamp_x = [this](double cell_x) {
+    return static_cast<int64_t>(std::clamp(cell_x, -1.0, static_cast<double>(num_cells_x_)));
+  };
+  const auto clamp_y = [this](double cell_y) {
+    return static_cast<int64_t>(std::clamp(cell_y, -1.0, static_cast<double>(num_cells_y_)));
+  };
+
+  uint32_t polygon_index = 0;
+  for (const auto & polygon : polygons) {
+    const size_t num_points = std::size(polygon);
+    double polygon_min_y = std::numeric_limits<double>::max();
+    double polygon_max_y = std::numeric_limits<double>::lowest();
+    double polygon_min_x = std::numeric_limits<double>::max();
+    double polygon_max_x = std::numeric_limits<double>::lowest();
+    for (const auto & p : polygon) {
+      polygon_min_x = std::min(polygon_min_x, p.x());
+      polygon_max_x = std::max(polygon_max_x, p.x());
+      polygon_min_y = std::min(polygon_min_y, p.y());
+      polygon_max_y = std::max(polygon_max_y, p.y());
+    }
+    // polygons out of the tile are only tested for the points out of the tile
+    if (
+      num_points < 3 || polygon_max_x < min_x || polygon_min_x > max_x || polygon_max_y < min_y ||
+      polygon_min_y > max_y) {
+      ++polygon_index;
+      continue;
+    }
+
+    // mark every cell crossed by an edge, row by row
+    for (size_t i = 0; i < num_points; ++i) {
+      const auto & a = polygon[i];
+      const auto & b = polygon[(i + 1) % num_points];
+      const double edge_min_y = std::min(a.y(), b.y());
+      const double edge_max_y = std::max(a.y(), b.y());
+      const int64_t first_row =
+        std::max<int64_t>(clamp_y(std::floor(to_cell_y(edge_min_y) - cell_margin)), 0);
+      const int64_t last_row = std::min<int64_t>(
+        clamp_y(std::floor(to_cell_y(edge_max_y) + cell_margin)),
+        static_cast<int64_t>(num_cells_y_) - 1);
+      for (int64_t row = first_row; row <= last_row; ++row) {
+        // part of the edge within the row
+        const double row_min_y =
+          std::max(min_y_ + static_cast<double>(row) * resolution_, edge_min_y);
+        const double row_max_y =
+          std::min(min_y_ + static_cast<double>(row + 1) * resolution_, edge_max_y);
+        double x0 = std::min(a.x(), b.x());
+        double x1 = std::max(a.x(), b.x());
+        if (a.y() != b.y()) {
+          const double slope = (b.x() - a.x()) / (b.y() - a.y());
+          const double row_x0 = a.x() + (row_min_y - a.y()) * slope;
+          const double row_x1 = a.x() + (row_max_y - a.y()) * slope;
+          x0 = std::max(std::min(row_x0, row_x1), x0);
+          x1 = std::min(std::max(row_x0, row_x1), x1);
+        }
+        const int64_t first_col =
+          std::max<int64_t>(clamp_x(std::floor(to_cell_x(x0) - cell_margin)), 0);
+        const int64_t last_col = std::min<int64_t>(
+          clamp_x(std::floor(to_cell_x(x1) + cell_margin)),
+          static_cast<int64_t>(num_cells_x_) - 1);
+        for (int64_t col = first_col; col <= last_col; ++col) {
+          const auto cell_index = static_cast<uint32_t>(row * num_cells_x_ + col);
+          if (last_boundary_polygon[cell_index] != polygon_index) {
+            last_boundary_polygon[cell_index] = polygon_index;
+            boundary_pairs.emplace_back(cell_index, polygon_index);
+          }
+        }
+      }
+    }
+
+    // fill the cells whose center is inside the polygon and which no edge crosses
+    const int64_t first_row = std::max<int64_t>(clamp_y(std::floor(to_cell_y(polygon_min_y))), 0);
+    const int64_t last_row = std::min<int64_t>(
+      clamp_y(std::floor(to_cell_y(polygon_max_y))), static_cast<int64_t>(num_cells_y_) - 1);
+    for (int64_t row = first_row; row <= last_row; ++row) {
+      const double center_y = min_y_ + (static_cast<double>(row) + 0.5) * resolution_;
+      crossings.clear();
+      for (size_t i = 0; i < num_points; ++i) {
+        const auto & a = polygon[i];
+        const auto & b = polygon[(i + 1) % num_points];
+        if ((a.y() > center_y) != (b.y() > center_y)) {
+          crossings.push_back(a.x() + (center_y - a.y()) * (b.x() - a.x()) / (b.y() - a.y()));
+        }
+      }
+      std::sort(crossings.begin(), crossings.end());
+      for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+        const int64_t first_col =
+          std::max<int64_t>(clamp_x(std::ceil(to_cell_x(crossings[i]) - 0.5)), 0);
+        const int64_t last_col = std::min<int64_t>(
+          clamp_x(std::floor(to_cell_x(crossings[i + 1]) - 0.5)),
+          static_cast<int64_t>(num_cells_x_) - 1);
+        for (int64_t col = first_col; col <= last_col; ++col) {
+          const size_t cell_index = row * num_cells_x_ + col;
+          if (last_boundary_polygon[cell_index] != polygon_index) {
+            cells_[cell_index] = CellState::INSIDE;
+          }
+        }
+      }
+    }
+    ++polygon_index;
+  }
+
+  // a cell inside any polygon does not need the exact test
+  std::sort(boundary_pairs.begin(), boundary_pairs.end());
+  boundary_offsets_.assign(num_cells + 1, 0);
+  for (const auto & [cell_index, boundary_polygon_index] : boundary_pairs) {
+    if (cells_[cell_index] == CellState::INSIDE) continue;
+    cells_[cell_index] = CellState::BOUNDARY;
+    boundary_polygons_.push_back(boundary_polygon_index);
+    ++boundary_offsets_[cell_index + 1];
+  }
+  for (size_t i = 0; i < num_cells; ++i) {
+    boundary_offsets_[i + 1] += boundary_offsets_[i];
+  }
+}
+
+}  // namespace autoware::pointcloud_preprocessor::utils
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_RASTER_INDEX_HPP_
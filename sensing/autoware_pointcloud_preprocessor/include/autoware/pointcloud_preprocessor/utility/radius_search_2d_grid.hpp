@@ -0,0 +1,134 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__RADIUS_SEARCH_2D_GRID_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__RADIUS_SEARCH_2D_GRID_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor::utils
+{
+struct Point2d
+{
+  float x;
+  float y;
+};
+
+/**
+ * @brief uniform grid over 2D points whose cell size is the search radius, to count the neighbors
+ * of a point without building a tree
+ *
+ * The neighbors within the radius are always in the 3x3 cells around the cell of the query point.
+ * The cells are hashed, so the extent of the points is not limited. Building is O(n), and a
+ * count visits only the points of the 3x3 cells until it reaches the given maximum.
+ */
+class RadiusSearch2dGrid
+{
+public:
+  /**
+   * @brief store the points in the cells of the size of the radius. The non-finite points are
+   * ignored.
+   */
+  void build(const std::vector<Point2d> & points, float radius)
+  {
+    radius_ = radius;
+    inverse_cell_size_ = 1.0f / radius;
+    cell_indices_.clear();
+    cell_offsets_.clear();
+    sorted_points_.clear();
+
+    // count the points of each cell, then place them cell by cell
+    std::vector<uint32_t> point_cells(points.size(), invalid_cell);
+    for (size_t i = 0; i < points.size(); ++i) {
+      const auto & p = points[i];
+      if (!std::isfinite(p.x) || !std::isfinite(p.y)) continue;
+      const auto [iter, inserted] = cell_indices_.try_emplace(
+        cell_key(cell_coordinate(p.x), cell_coordinate(p.y)),
+        static_cast<uint32_t>(cell_indices_.size()));
+      if (inserted) cell_offsets_.push_back(0);
+      point_cells[i] = iter->second;
+      ++cell_offsets_[iter->second];
+    }
+    cell_offsets_.push_back(0);
+    uint32_t offset = 0;
+    for (auto & cell_offset : cell_offsets_) {
+      const uint32_t num_points = cell_offset;
+      cell_offset = offset;
+      offset += num_points;
+    }
+
+    sorted_points_.resize(offset);
+    std::vector<uint32_t> cell_ends(cell_offsets_.begin(), cell_offsets_.end() - 1);
+    for (size_t i = 0; i < points.size(); ++i) {
+      if (point_cells[i] == invalid_cell) continue;
+      sorted_points_[cell_ends[point_cells[i]]++] = points[i];
+    }
+  }
+
+  /**
+   * @brief the number of the points within the radius from (x, y), including the point itself if
+   * it was stored, counted up to max_count
+   */
+  size_t count_neighbors(float x, float y, size_t max_count) const
+  {
+    if (!std::isfinite(x) || !std::isfinite(y)) return 0;
+    const float squared_radius = radius_ * radius_;
+    const int64_t cell_x = cell_coordinate(x);
+    const int64_t cell_y = cell_coordinate(y);
+    size_t count = 0;
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        const auto iter = cell_indices_.find(cell_key(cell_x + dx, cell_y + dy));
+        if (iter == cell_indices_.end()) continue;
+        for (uint32_t i = cell_offsets_[iter->second]; i < cell_offsets_[iter->second + 1]; ++i) {
+          const float diff_x = sorted_points_[i].x - x;
+          const float diff_y = sorted_points_[i].y - y;
+          if (diff_x * diff_x + diff_y * diff_y <= squared_radius && ++count >= max_count) {
+            return count;
+          }
+        }
+      }
+    }
+    return count;
+  }
+
+private:
+  static constexpr uint32_t invalid_cell = UINT32_MAX;
+
+  int64_t cell_coordinate(float value) const
+  {
+    return static_cast<int64_t>(std::floor(value * inverse_cell_size_));
+  }
+
+  static uint64_t cell_key(int64_t cell_x, int64_t cell_y)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cell_x)) << 32) |
+           static_cast<uint32_t>(cell_y);
+  }
+
+  float radius_{1.0f};
+  float inverse_cell_size_{1.0f};
+  std::unordered_map<uint64_t, uint32_t> cell_indices_;
+  /** @brief the points of each cell, as ranges of sorted_points_ per cell */
+  std::vector<uint32_t> cell_offsets_;
+  std::vector<Point2d> sorted_points_;
+};
+
+}  // namespace autoware::pointcloud_preprocessor::utils
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__RADIUS_SEARCH_2D_GRID_HPP_
@@ -0,0 +1,102 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__TWIST_HISTORY_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__TWIST_HISTORY_HPP_
+
+#include <Eigen/Core>
+#include <rclcpp/time.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace autoware::pointcloud_preprocessor::utils
+{
+/**
+ * @brief history of the ego twist used to compensate the motion between two stamps
+ *
+ * The planar motion is integrated once per received twist, so that the motion between any two
+ * stamps is obtained with two binary searches instead of a walk over all the twists in between.
+ */
+class TwistHistory
+{
+public:
+  /**
+   * @param max_history_duration_sec twists older than this duration before the newest one are
+   * dropped
+   * @param max_integration_step_sec the integration stops at the first step longer than this
+   */
+  explicit TwistHistory(
+    double max_history_duration_sec = 1.0, double max_integration_step_sec = 0.1);
+
+  /**
+   * @brief add a twist. The history is cleared when the stamp is older than the oldest twist,
+   * e.g. when a rosbag is restarted.
+   */
+  void add_twist(const rclcpp::Time & stamp, double linear_x, double angular_z);
+
+  void clear() { samples_.clear(); }
+  bool empty() const { return samples_.empty(); }
+  size_t size() const { return samples_.size(); }
+
+  /**
+   * @brief compute transform to adjust for old timestamp
+   *
+   * @param old_stamp
+   * @param new_stamp
+   * @param is_step_too_long set to true when the integration stopped at a step longer than
+   * max_integration_step_sec
+   * @return Eigen::Matrix4f: transformation matrix from new_stamp to old_stamp. Identity if the
+   * history is empty or old_stamp is newer than new_stamp.
+   */
+  Eigen::Matrix4f compute_transform_to_adjust_for_old_timestamp(
+    const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp, bool & is_step_too_long) const;
+
+private:
+  /** @brief planar pose, as used by the integration */
+  struct Pose2d
+  {
+    double x{0.0};
+    double y{0.0};
+    double yaw{0.0};
+  };
+
+  struct Sample
+  {
+    int64_t stamp_ns;
+    double linear_x;
+    double angular_z;
+    /** @brief integrated pose at stamp_ns, relative to an arbitrary origin */
+    Pose2d pose;
+    /** @brief number of steps longer than max_integration_step_ns_ up to this sample */
+    uint64_t num_long_steps;
+  };
+
+  /** @brief motion over dt with the velocity of sample, in the frame at the start of the step */
+  static Pose2d integrate_step(const Sample & sample, double dt);
+  /** @brief motion from the pose of samples_[from] to the pose of samples_[to] */
+  Pose2d relative_pose(size_t from, size_t to) const;
+  static Pose2d compose(const Pose2d & a, const Pose2d & b);
+  /** @brief index of the first sample not older than stamp_ns, clamped to the newest sample */
+  size_t lower_bound_index(int64_t stamp_ns) const;
+
+  int64_t max_history_duration_ns_;
+  int64_t max_integration_step_ns_;
+  std::deque<Sample> samples_;
+};
+
+}  // namespace autoware::pointcloud_preprocessor::utils
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__UTILITY__TWIST_HISTORY_HPP_
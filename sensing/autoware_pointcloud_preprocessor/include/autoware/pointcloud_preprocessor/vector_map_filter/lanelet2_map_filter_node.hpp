@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__LANELET2_MAP_FILTER_NODE_HPP_
 #define AUTOWARE__POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__LANELET2_MAP_FILTER_NODE_HPP_
 
+#include "autoware/pointcloud_preprocessor/utility/polygon_raster_index.hpp"
+
 #include <autoware/universe_utils/geometry/boost_geometry.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
@@ -68,6 +70,13 @@ private:
 
   float voxel_size_x_;
   float voxel_size_y_;
+  bool use_raster_index_;
+  double raster_resolution_;
+  double raster_tile_margin_;
+
+  /** \brief Polygons of road_lanelets_ converted once per map for the raster index mode */
+  std::vector<lanelet::BasicPolygon2d> road_polygons_;
+  utils::PolygonRasterIndex raster_index_;
 
   void pointcloudCallback(const PointCloud2ConstPtr msg);
 
@@ -88,6 +97,11 @@ private:
 
   bool pointWithinLanelets(const Point2d & point, const lanelet::ConstLanelets & joint_lanelets);
 
+  bool pointWithinRasterIndex(const Point2d & point);
+
+  /** \brief Rebuild the raster index around the input if it is not covered by the current tile */
+  void updateRasterIndex(const pcl::PointCloud<pcl::PointXYZ>::Ptr & input_cloud);
+
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
 
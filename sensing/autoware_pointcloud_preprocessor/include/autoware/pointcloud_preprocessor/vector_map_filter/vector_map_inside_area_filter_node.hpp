@@ -17,6 +17,7 @@
 
 #include "autoware/pointcloud_preprocessor/filter.hpp"
 #include "autoware/pointcloud_preprocessor/utility/geometry.hpp"
+#include "autoware/pointcloud_preprocessor/utility/polygon_raster_index.hpp"
 
 #include <autoware/universe_utils/geometry/boost_geometry.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
@@ -26,6 +27,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 using autoware::universe_utils::MultiPoint2d;
 
@@ -42,10 +44,22 @@ private:
 
   void mapCallback(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg);
 
+  /** \brief Rebuild the raster index around the bounding box if it is not covered by the current
+   * tile. Returns false if the bounding box is invalid, e.g. for an empty input. */
+  bool updateRasterIndex(const autoware::universe_utils::Box2d & bounding_box);
+
   // parameter
   std::string polygon_type_;
   bool use_z_filter_ = false;
   float z_threshold_;
+  bool use_raster_index_ = false;
+  double raster_resolution_;
+  double raster_tile_margin_;
+
+  /** \brief Polygons of polygon_lanelets_ converted once per map for the raster index mode */
+  std::vector<lanelet::BasicPolygon2d> polygons_2d_;
+  std::vector<PolygonCgal> cgal_polygons_;
+  utils::PolygonRasterIndex raster_index_;
 
   // tf2 listener
   std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
@@ -16,14 +16,48 @@
 
 #include "autoware/point_types/types.hpp"
 
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
 #include <algorithm>
+#include <memory>
 #include <numeric>
 
 namespace autoware::pointcloud_preprocessor
 {
-using autoware::point_types::PointXYZIRCAEDT;
+using autoware::universe_utils::ScopedTimeTrack;
 using diagnostic_msgs::msg::DiagnosticStatus;
 
+namespace
+{
+/**
+ * @brief Clear a mask history when the image size has changed, since the buffered masks can no
+ * longer be accumulated with the new ones.
+ */
+void reset_mask_history_if_resized(
+  const cv::Size & mask_size, boost::circular_buffer<cv::Mat> & mask_buffer, cv::Mat & mask_sum)
+{
+  if (mask_sum.size() != mask_size) {
+    mask_buffer.clear();
+    mask_sum = cv::Mat::zeros(mask_size, CV_8UC1);
+  }
+}
+
+/**
+ * @brief Push a binarized mask into a mask history and keep the per-pixel sum of the history up to
+ * date, so that the sum does not have to be recomputed from every buffered mask on each frame.
+ */
+void push_to_mask_history(
+  const cv::Mat & binarized_mask, boost::circular_buffer<cv::Mat> & mask_buffer, cv::Mat & mask_sum)
+{
+  if (mask_buffer.capacity() == 0) return;
+  if (mask_buffer.full()) {
+    mask_sum -= mask_buffer.front();
+  }
+  mask_buffer.push_back(binarized_mask);
+  mask_sum += binarized_mask;
+}
+}  // namespace
+
 BlockageDiagComponent::BlockageDiagComponent(const rclcpp::NodeOptions & options)
 : Filter("BlockageDiag", options)
 {
@@ -47,6 +81,15 @@ BlockageDiagComponent::BlockageDiagComponent(const rclcpp::NodeOptions & options
     max_distance_range_ = declare_parameter<double>("max_distance_range");
     horizontal_resolution_ = declare_parameter<double>("horizontal_resolution");
     blockage_kernel_ = declare_parameter<int>("blockage_kernel");
+
+    bool use_time_keeper = declare_parameter<bool>("publish_processing_time_detail");
+    if (use_time_keeper) {
+      detailed_processing_time_publisher_ =
+        this->create_publisher<autoware::universe_utils::ProcessingTimeDetail>(
+          "~/debug/processing_time_detail_ms", 1);
+      auto time_keeper = autoware::universe_utils::TimeKeeper(detailed_processing_time_publisher_);
+      time_keeper_ = std::make_shared<autoware::universe_utils::TimeKeeper>(time_keeper);
+    }
   }
   dust_mask_buffer.set_capacity(dust_buffering_frames_);
   no_return_mask_buffer.set_capacity(blockage_buffering_frames_);
@@ -160,6 +203,9 @@ void BlockageDiagComponent::filter(
   PointCloud2 & output)
 {
   std::scoped_lock lock(mutex_);
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
   int vertical_bins = vertical_bins_;
   int ideal_horizontal_bins;
   double compensate_angle = 0.0;
@@ -169,13 +215,14 @@ void BlockageDiagComponent::filter(
   }
   ideal_horizontal_bins = static_cast<int>(
     (angle_range_deg_[1] + compensate_angle - angle_range_deg_[0]) / horizontal_resolution_);
-  pcl::PointCloud<PointXYZIRCAEDT>::Ptr pcl_input(new pcl::PointCloud<PointXYZIRCAEDT>);
-  pcl::fromROSMsg(*input, *pcl_input);
+  std::unique_ptr<ScopedTimeTrack> depth_map_st_ptr;
+  if (time_keeper_)
+    depth_map_st_ptr = std::make_unique<ScopedTimeTrack>("build_depth_map", *time_keeper_);
   cv::Mat full_size_depth_map(
     cv::Size(ideal_horizontal_bins, vertical_bins), CV_16UC1, cv::Scalar(0));
   cv::Mat lidar_depth_map_8u(
     cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
-  if (pcl_input->points.empty()) {
+  if (input->width * input->height == 0) {
     ground_blockage_ratio_ = 1.0f;
     sky_blockage_ratio_ = 1.0f;
     if (ground_blockage_count_ <= 2 * blockage_count_threshold_) {
@@ -189,16 +236,22 @@ void BlockageDiagComponent::filter(
     sky_blockage_range_deg_[0] = angle_range_deg_[0];
     sky_blockage_range_deg_[1] = angle_range_deg_[1];
   } else {
-    for (const auto p : pcl_input->points) {
-      if (p.channel >= vertical_bins) {
+    // The fields are read in place to avoid converting the whole pointcloud
+    sensor_msgs::PointCloud2ConstIterator<uint16_t> iter_channel(*input, "channel");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_azimuth(*input, "azimuth");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_distance(*input, "distance");
+    for (; iter_channel != iter_channel.end(); ++iter_channel, ++iter_azimuth, ++iter_distance) {
+      const uint16_t channel = *iter_channel;
+      const float distance = *iter_distance;
+      if (channel >= vertical_bins) {
         RCLCPP_ERROR(
           this->get_logger(),
           "p.channel: %d is larger than vertical_bins: %d  .Please check the parameter "
           "'vertical_bins'.",
-          p.channel, vertical_bins);
+          channel, vertical_bins);
         throw std::runtime_error("Parameter is not valid");
       }
-      double azimuth_deg = p.azimuth * (180.0 / M_PI);
+      double azimuth_deg = *iter_azimuth * (180.0 / M_PI);
       if (
         ((azimuth_deg > angle_range_deg_[0]) &&
          (azimuth_deg <= angle_range_deg_[1] + compensate_angle)) ||
@@ -208,17 +261,22 @@ void BlockageDiagComponent::filter(
         int horizontal_bin_index = static_cast<int>(current_angle_range / horizontal_resolution_) %
                                    static_cast<int>(360.0 / horizontal_resolution_);
         uint16_t depth_intensity =
-          UINT16_MAX * (1.0 - std::min(p.distance / max_distance_range_, 1.0));
+          UINT16_MAX * (1.0 - std::min(distance / max_distance_range_, 1.0));
         if (is_channel_order_top2down_) {
-          full_size_depth_map.at<uint16_t>(p.channel, horizontal_bin_index) = depth_intensity;
+          full_size_depth_map.at<uint16_t>(channel, horizontal_bin_index) = depth_intensity;
         } else {
-          full_size_depth_map.at<uint16_t>(vertical_bins - p.channel - 1, horizontal_bin_index) =
+          full_size_depth_map.at<uint16_t>(vertical_bins - channel - 1, horizontal_bin_index) =
             depth_intensity;
         }
       }
     }
   }
   full_size_depth_map.convertTo(lidar_depth_map_8u, CV_8UC1, 1.0 / 300);
+  depth_map_st_ptr.reset();
+
+  std::unique_ptr<ScopedTimeTrack> blockage_st_ptr;
+  if (time_keeper_)
+    blockage_st_ptr = std::make_unique<ScopedTimeTrack>("blockage_mask", *time_keeper_);
   cv::Mat no_return_mask(cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
   cv::inRange(lidar_depth_map_8u, 0, 1, no_return_mask);
   cv::Mat erosion_dst;
@@ -229,35 +287,29 @@ void BlockageDiagComponent::filter(
   cv::dilate(erosion_dst, no_return_mask, blockage_element);
   cv::Mat time_series_blockage_result(
     cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
-  cv::Mat time_series_blockage_mask(
-    cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
-  cv::Mat no_return_mask_binarized(
-    cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
 
   if (blockage_buffering_interval_ == 0) {
     no_return_mask.copyTo(time_series_blockage_result);
   } else {
-    no_return_mask_binarized = no_return_mask / 255;
+    reset_mask_history_if_resized(
+      no_return_mask.size(), no_return_mask_buffer, no_return_mask_buffer_sum_);
     if (blockage_frame_count_ >= blockage_buffering_interval_) {
-      no_return_mask_buffer.push_back(no_return_mask_binarized);
+      const cv::Mat no_return_mask_binarized = no_return_mask / 255;
+      push_to_mask_history(
+        no_return_mask_binarized, no_return_mask_buffer, no_return_mask_buffer_sum_);
       blockage_frame_count_ = 0;
     } else {
       blockage_frame_count_++;
     }
-    for (const auto & binary_mask : no_return_mask_buffer) {
-      time_series_blockage_mask += binary_mask;
-    }
     cv::inRange(
-      time_series_blockage_mask, no_return_mask_buffer.size() - 1, no_return_mask_buffer.size(),
+      no_return_mask_buffer_sum_, no_return_mask_buffer.size() - 1, no_return_mask_buffer.size(),
       time_series_blockage_result);
   }
-  cv::Mat ground_no_return_mask;
-  cv::Mat sky_no_return_mask;
-  no_return_mask(cv::Rect(0, 0, ideal_horizontal_bins, horizontal_ring_id_))
-    .copyTo(sky_no_return_mask);
-  no_return_mask(
-    cv::Rect(0, horizontal_ring_id_, ideal_horizontal_bins, vertical_bins - horizontal_ring_id_))
-    .copyTo(ground_no_return_mask);
+  // ROIs share the data of no_return_mask, so the masks are not copied
+  const cv::Mat sky_no_return_mask =
+    no_return_mask(cv::Rect(0, 0, ideal_horizontal_bins, horizontal_ring_id_));
+  const cv::Mat ground_no_return_mask = no_return_mask(
+    cv::Rect(0, horizontal_ring_id_, ideal_horizontal_bins, vertical_bins - horizontal_ring_id_));
   ground_blockage_ratio_ =
     static_cast<float>(cv::countNonZero(ground_no_return_mask)) /
     static_cast<float>(ideal_horizontal_bins * (vertical_bins - horizontal_ring_id_));
@@ -293,8 +345,13 @@ void BlockageDiagComponent::filter(
   } else {
     sky_blockage_count_ = 0;
   }
+  blockage_st_ptr.reset();
+
   // dust
   if (enable_dust_diag_) {
+    std::unique_ptr<ScopedTimeTrack> dust_st_ptr;
+    if (time_keeper_) dust_st_ptr = std::make_unique<ScopedTimeTrack>("dust_mask", *time_keeper_);
+
     cv::Mat ground_depth_map = lidar_depth_map_8u(
       cv::Rect(0, horizontal_ring_id_, ideal_horizontal_bins, vertical_bins - horizontal_ring_id_));
     cv::Mat sky_blank(horizontal_ring_id_, ideal_horizontal_bins, CV_8UC1, cv::Scalar(0));
@@ -328,10 +385,6 @@ void BlockageDiagComponent::filter(
     }
 
     if (publish_debug_image_) {
-      cv::Mat binarized_dust_mask_(
-        cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
-      cv::Mat multi_frame_dust_mask(
-        cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
       cv::Mat multi_frame_ground_dust_result(
         cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
 
@@ -339,18 +392,17 @@ void BlockageDiagComponent::filter(
         single_dust_img.copyTo(multi_frame_ground_dust_result);
         dust_buffering_frame_counter_ = 0;
       } else {
-        binarized_dust_mask_ = single_dust_img / 255;
+        reset_mask_history_if_resized(
+          single_dust_img.size(), dust_mask_buffer, dust_mask_buffer_sum_);
         if (dust_buffering_frame_counter_ >= dust_buffering_interval_) {
-          dust_mask_buffer.push_back(binarized_dust_mask_);
+          const cv::Mat binarized_dust_mask = single_dust_img / 255;
+          push_to_mask_history(binarized_dust_mask, dust_mask_buffer, dust_mask_buffer_sum_);
           dust_buffering_frame_counter_ = 0;
         } else {
           dust_buffering_frame_counter_++;
         }
-        for (const auto & binarized_dust_mask : dust_mask_buffer) {
-          multi_frame_dust_mask += binarized_dust_mask;
-        }
         cv::inRange(
-          multi_frame_dust_mask, dust_mask_buffer.size() - 1, dust_mask_buffer.size(),
+          dust_mask_buffer_sum_, dust_mask_buffer.size() - 1, dust_mask_buffer.size(),
           multi_frame_ground_dust_result);
       }
       cv::Mat single_frame_ground_dust_colorized(
@@ -406,8 +458,7 @@ void BlockageDiagComponent::filter(
     blockage_mask_pub_.publish(blockage_mask_msg);
   }
 
-  pcl::toROSMsg(*pcl_input, output);
-  output.header = input->header;
+  output = *input;
 }
 rcl_interfaces::msg::SetParametersResult BlockageDiagComponent::paramCallback(
   const std::vector<rclcpp::Parameter> & p)
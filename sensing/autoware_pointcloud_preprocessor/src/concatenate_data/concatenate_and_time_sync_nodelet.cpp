@@ -58,6 +58,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -120,6 +121,13 @@ PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchro
       declare_parameter("keep_input_frame_in_synchronized_pointcloud", true);
     synchronized_pointcloud_postfix_ =
       declare_parameter("synchronized_pointcloud_postfix", "pointcloud");
+    use_preallocated_output_buffer_ = declare_parameter("use_preallocated_output_buffer", false);
+    num_transform_threads_ =
+      static_cast<int>(declare_parameter("num_transform_threads", static_cast<int64_t>(1)));
+    if (num_transform_threads_ < 1) {
+      RCLCPP_WARN(get_logger(), "num_transform_threads must be positive. Using 1 thread.");
+      num_transform_threads_ = 1;
+    }
   }
 
   // Initialize not_subscribed_topic_names_
@@ -266,7 +274,7 @@ PointCloudConcatenateDataSynchronizerComponent::computeTransformToAdjustForOldTi
   const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp)
 {
   // return identity if no twist is available
-  if (twist_ptr_queue_.empty()) {
+  if (twist_history_.empty()) {
     RCLCPP_WARN_STREAM_THROTTLE(
       get_logger(), *get_clock(), std::chrono::milliseconds(10000).count(),
       "No twist is available. Please confirm twist topic and timestamp");
@@ -281,52 +289,38 @@ PointCloudConcatenateDataSynchronizerComponent::computeTransformToAdjustForOldTi
     return Eigen::Matrix4f::Identity();
   }
 
-  auto old_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), old_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
-    });
-  old_twist_ptr_it =
-    old_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : old_twist_ptr_it;
-
-  auto new_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), new_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
-    });
-  new_twist_ptr_it =
-    new_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : new_twist_ptr_it;
-
-  auto prev_time = old_stamp;
-  double x = 0.0;
-  double y = 0.0;
-  double yaw = 0.0;
-  for (auto twist_ptr_it = old_twist_ptr_it; twist_ptr_it != new_twist_ptr_it + 1; ++twist_ptr_it) {
-    const double dt =
-      (twist_ptr_it != new_twist_ptr_it)
-        ? (rclcpp::Time((*twist_ptr_it)->header.stamp) - rclcpp::Time(prev_time)).seconds()
-        : (rclcpp::Time(new_stamp) - rclcpp::Time(prev_time)).seconds();
-
-    if (std::fabs(dt) > 0.1) {
-      RCLCPP_WARN_STREAM_THROTTLE(
-        get_logger(), *get_clock(), std::chrono::milliseconds(10000).count(),
-        "Time difference is too large. Cloud not interpolate. Please confirm twist topic and "
-        "timestamp");
-      break;
-    }
+  bool is_step_too_long = false;
+  const auto transform = twist_history_.compute_transform_to_adjust_for_old_timestamp(
+    old_stamp, new_stamp, is_step_too_long);
+  if (is_step_too_long) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      get_logger(), *get_clock(), std::chrono::milliseconds(10000).count(),
+      "Time difference is too large. Cloud not interpolate. Please confirm twist topic and "
+      "timestamp");
+  }
+  return transform;
+}
 
-    const double dis = (*twist_ptr_it)->twist.linear.x * dt;
-    yaw += (*twist_ptr_it)->twist.angular.z * dt;
-    x += dis * std::cos(yaw);
-    y += dis * std::sin(yaw);
-    prev_time = (*twist_ptr_it)->header.stamp;
-  }
-  Eigen::AngleAxisf rotation_x(0, Eigen::Vector3f::UnitX());
-  Eigen::AngleAxisf rotation_y(0, Eigen::Vector3f::UnitY());
-  Eigen::AngleAxisf rotation_z(yaw, Eigen::Vector3f::UnitZ());
-  Eigen::Translation3f translation(x, y, 0);
-  Eigen::Matrix4f rotation_matrix = (translation * rotation_z * rotation_y * rotation_x).matrix();
-  return rotation_matrix;
+/**
+ * @brief compute transform to adjust a cloud to the oldest stamp of the concatenated clouds
+ *
+ * @param cloud_stamp stamp of the cloud to be adjusted
+ * @param sorted_stamps stamps of all clouds to be concatenated, sorted from newest to oldest
+ * @return Eigen::Matrix4f: transformation matrix from cloud_stamp to the oldest stamp
+ */
+Eigen::Matrix4f
+PointCloudConcatenateDataSynchronizerComponent::computeTransformToAdjustForOldestTimestamp(
+  const rclcpp::Time & cloud_stamp, const std::vector<rclcpp::Time> & sorted_stamps)
+{
+  Eigen::Matrix4f adjust_to_old_data_transform = Eigen::Matrix4f::Identity();
+  rclcpp::Time transformed_stamp = cloud_stamp;
+  for (const auto & stamp : sorted_stamps) {
+    const auto new_to_old_transform =
+      computeTransformToAdjustForOldTimestamp(stamp, transformed_stamp);
+    adjust_to_old_data_transform = new_to_old_transform * adjust_to_old_data_transform;
+    transformed_stamp = std::min(transformed_stamp, stamp);
+  }
+  return adjust_to_old_data_transform;
 }
 
 std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr>
@@ -366,14 +360,8 @@ PointCloudConcatenateDataSynchronizerComponent::combineClouds(
       managed_tf_buffer_->transformPointcloud(output_frame_, *e.second, *transformed_cloud_ptr);
 
       // calculate transforms to oldest stamp
-      Eigen::Matrix4f adjust_to_old_data_transform = Eigen::Matrix4f::Identity();
-      rclcpp::Time transformed_stamp = rclcpp::Time(e.second->header.stamp);
-      for (const auto & stamp : pc_stamps) {
-        const auto new_to_old_transform =
-          computeTransformToAdjustForOldTimestamp(stamp, transformed_stamp);
-        adjust_to_old_data_transform = new_to_old_transform * adjust_to_old_data_transform;
-        transformed_stamp = std::min(transformed_stamp, stamp);
-      }
+      const Eigen::Matrix4f adjust_to_old_data_transform =
+        computeTransformToAdjustForOldestTimestamp(rclcpp::Time(e.second->header.stamp), pc_stamps);
       sensor_msgs::msg::PointCloud2::SharedPtr transformed_delay_compensated_cloud_ptr(
         new sensor_msgs::msg::PointCloud2());
       pcl_ros::transformPointCloud(
@@ -413,18 +401,172 @@ PointCloudConcatenateDataSynchronizerComponent::combineClouds(
   return transformed_clouds;
 }
 
+/**
+ * @brief concatenate clouds without intermediate copies
+ *
+ * The output buffer is sized once from the sum of the input sizes. Each input is copied into its
+ * own slice of the buffer and the sensor-to-output and delay compensation transforms are applied
+ * there in place. All inputs are already converted to PointXYZIRC in cloud_callback, so they share
+ * the same point layout.
+ */
+std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr>
+PointCloudConcatenateDataSynchronizerComponent::combineCloudsIntoPreallocatedBuffer(
+  sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr)
+{
+  // map for storing the transformed point clouds
+  std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr> transformed_clouds;
+
+  // Step1. gather stamps and sort it, and count the total size of the output
+  std::vector<rclcpp::Time> pc_stamps;
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr layout_cloud_ptr = nullptr;
+  size_t total_data_size = 0;
+  for (const auto & e : cloud_stdmap_) {
+    transformed_clouds[e.first] = nullptr;
+    if (e.second != nullptr) {
+      if (e.second->data.size() == 0) {
+        continue;
+      }
+      pc_stamps.push_back(rclcpp::Time(e.second->header.stamp));
+      total_data_size += e.second->data.size();
+      if (layout_cloud_ptr == nullptr) {
+        layout_cloud_ptr = e.second;
+      }
+    }
+  }
+  if (pc_stamps.empty()) {
+    return transformed_clouds;
+  }
+  // sort stamps and get oldest stamp
+  std::sort(pc_stamps.begin(), pc_stamps.end());
+  std::reverse(pc_stamps.begin(), pc_stamps.end());
+  const auto oldest_stamp = pc_stamps.back();
+
+  // Step2. Allocate the output buffer once
+  concat_cloud_ptr = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  concat_cloud_ptr->fields = layout_cloud_ptr->fields;
+  concat_cloud_ptr->point_step = layout_cloud_ptr->point_step;
+  concat_cloud_ptr->is_bigendian = layout_cloud_ptr->is_bigendian;
+  concat_cloud_ptr->is_dense = true;
+  concat_cloud_ptr->data.resize(total_data_size);
+  const size_t point_step = concat_cloud_ptr->point_step;
+
+  // Step3. Look up the transforms and assign a slice of the output buffer to each cloud. This is
+  // done serially since the transform buffer and the twist queue are not thread-safe.
+  struct SliceJob
+  {
+    std::string topic_name;
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud_ptr;
+    Eigen::Matrix4f transform;
+    size_t data_offset;
+  };
+  std::vector<SliceJob> slice_jobs;
+  size_t data_offset = 0;
+  for (const auto & e : cloud_stdmap_) {
+    if (e.second == nullptr) {
+      not_subscribed_topic_names_.insert(e.first);
+      continue;
+    }
+    if (e.second->data.size() == 0) {
+      continue;
+    }
+
+    Eigen::Matrix4f sensor_to_output_transform = Eigen::Matrix4f::Identity();
+    if (
+      e.second->header.frame_id != output_frame_ &&
+      !managed_tf_buffer_->getTransform(
+        output_frame_, e.second->header.frame_id, sensor_to_output_transform)) {
+      continue;
+    }
+    const Eigen::Matrix4f transform =
+      computeTransformToAdjustForOldestTimestamp(rclcpp::Time(e.second->header.stamp), pc_stamps) *
+      sensor_to_output_transform;
+    slice_jobs.push_back({e.first, e.second, transform, data_offset});
+    data_offset += e.second->data.size();
+  }
+
+  // Step4. Transform each cloud directly into its slice of the output buffer. The slices do not
+  // overlap, so the clouds can be processed concurrently.
+  std::vector<sensor_msgs::msg::PointCloud2::SharedPtr> slice_clouds(slice_jobs.size());
+  // cppcheck-suppress-begin invalidPointerCast
+#pragma omp parallel for num_threads(num_transform_threads_)
+  for (size_t job_index = 0; job_index < slice_jobs.size(); ++job_index) {
+    const auto & job = slice_jobs[job_index];
+    uint8_t * slice = concat_cloud_ptr->data.data() + job.data_offset;
+    std::memcpy(slice, job.cloud_ptr->data.data(), job.cloud_ptr->data.size());
+    const size_t num_points = job.cloud_ptr->data.size() / point_step;
+    for (size_t i = 0; i < num_points; ++i) {
+      auto * point = reinterpret_cast<PointXYZIRC *>(slice + i * point_step);
+      const Eigen::Vector4f transformed_point =
+        job.transform * Eigen::Vector4f(point->x, point->y, point->z, 1.0f);
+      point->x = transformed_point.x();
+      point->y = transformed_point.y();
+      point->z = transformed_point.z();
+    }
+
+    // the synchronized clouds are separate messages, so they have to be copied out of the slice
+    if (publish_synchronized_pointcloud_) {
+      auto transformed_cloud_ptr = std::make_shared<sensor_msgs::msg::PointCloud2>();
+      transformed_cloud_ptr->fields = concat_cloud_ptr->fields;
+      transformed_cloud_ptr->point_step = concat_cloud_ptr->point_step;
+      transformed_cloud_ptr->is_bigendian = concat_cloud_ptr->is_bigendian;
+      transformed_cloud_ptr->is_dense = job.cloud_ptr->is_dense;
+      transformed_cloud_ptr->height = 1;
+      transformed_cloud_ptr->width = static_cast<uint32_t>(num_points);
+      transformed_cloud_ptr->row_step = static_cast<uint32_t>(job.cloud_ptr->data.size());
+      transformed_cloud_ptr->data.assign(slice, slice + job.cloud_ptr->data.size());
+      transformed_cloud_ptr->header.stamp = oldest_stamp;
+      transformed_cloud_ptr->header.frame_id = output_frame_;
+      slice_clouds[job_index] = transformed_cloud_ptr;
+    }
+  }
+  // cppcheck-suppress-end invalidPointerCast
+
+  // Step5. Collect the synchronized clouds, converting to the original sensor frame if necessary
+  for (size_t job_index = 0; job_index < slice_jobs.size(); ++job_index) {
+    const auto & job = slice_jobs[job_index];
+    concat_cloud_ptr->is_dense = concat_cloud_ptr->is_dense && job.cloud_ptr->is_dense;
+    if (!publish_synchronized_pointcloud_) {
+      continue;
+    }
+    bool need_transform_to_sensor_frame = (job.cloud_ptr->header.frame_id != output_frame_);
+    if (keep_input_frame_in_synchronized_pointcloud_ && need_transform_to_sensor_frame) {
+      sensor_msgs::msg::PointCloud2::SharedPtr transformed_cloud_ptr_in_sensor_frame(
+        new sensor_msgs::msg::PointCloud2());
+      managed_tf_buffer_->transformPointcloud(
+        job.cloud_ptr->header.frame_id, *slice_clouds[job_index],
+        *transformed_cloud_ptr_in_sensor_frame);
+      transformed_cloud_ptr_in_sensor_frame->header.stamp = oldest_stamp;
+      transformed_cloud_ptr_in_sensor_frame->header.frame_id = job.cloud_ptr->header.frame_id;
+      transformed_clouds[job.topic_name] = transformed_cloud_ptr_in_sensor_frame;
+    } else {
+      transformed_clouds[job.topic_name] = slice_clouds[job_index];
+    }
+  }
+
+  // shrink the buffer if some of the transforms were not available
+  concat_cloud_ptr->data.resize(data_offset);
+  concat_cloud_ptr->height = 1;
+  concat_cloud_ptr->width = static_cast<uint32_t>(data_offset / point_step);
+  concat_cloud_ptr->row_step = static_cast<uint32_t>(data_offset);
+  concat_cloud_ptr->header.stamp = oldest_stamp;
+  concat_cloud_ptr->header.frame_id = output_frame_;
+  return transformed_clouds;
+}
+
 void PointCloudConcatenateDataSynchronizerComponent::publish()
 {
   stop_watch_ptr_->toc("processing_time", true);
   sensor_msgs::msg::PointCloud2::SharedPtr concat_cloud_ptr = nullptr;
   not_subscribed_topic_names_.clear();
 
-  const auto & transformed_raw_points =
-    PointCloudConcatenateDataSynchronizerComponent::combineClouds(concat_cloud_ptr);
+  const auto & transformed_raw_points = use_preallocated_output_buffer_
+                                          ? combineCloudsIntoPreallocatedBuffer(concat_cloud_ptr)
+                                          : combineClouds(concat_cloud_ptr);
 
   // publish concatenated pointcloud
   if (concat_cloud_ptr) {
-    auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(*concat_cloud_ptr);
+    // the concatenated cloud is owned by this function only, so move it instead of copying
+    auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(std::move(*concat_cloud_ptr));
     pub_output_->publish(std::move(output));
   } else {
     RCLCPP_WARN(this->get_logger(), "concat_cloud_ptr is nullptr, skipping pointcloud publish.");
@@ -434,7 +576,7 @@ void PointCloudConcatenateDataSynchronizerComponent::publish()
   if (publish_synchronized_pointcloud_) {
     for (const auto & e : transformed_raw_points) {
       if (e.second) {
-        auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(*e.second);
+        auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(std::move(*e.second));
         transformed_raw_pc_publisher_map_[e.first]->publish(std::move(output));
       } else {
         RCLCPP_WARN(
@@ -645,53 +787,15 @@ void PointCloudConcatenateDataSynchronizerComponent::timer_callback()
 void PointCloudConcatenateDataSynchronizerComponent::twist_callback(
   const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr input)
 {
-  // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
-    }
-  }
-
-  // pop old data
-  while (!twist_ptr_queue_.empty()) {
-    if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
-      rclcpp::Time(input->header.stamp)) {
-      break;
-    }
-    twist_ptr_queue_.pop_front();
-  }
-
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header = input->header;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  twist_history_.add_twist(
+    input->header.stamp, input->twist.twist.linear.x, input->twist.twist.angular.z);
 }
 
 void PointCloudConcatenateDataSynchronizerComponent::odom_callback(
   const nav_msgs::msg::Odometry::ConstSharedPtr input)
 {
-  // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
-    }
-  }
-
-  // pop old data
-  while (!twist_ptr_queue_.empty()) {
-    if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
-      rclcpp::Time(input->header.stamp)) {
-      break;
-    }
-    twist_ptr_queue_.pop_front();
-  }
-
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header = input->header;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  twist_history_.add_twist(
+    input->header.stamp, input->twist.twist.linear.x, input->twist.twist.angular.z);
 }
 
 void PointCloudConcatenateDataSynchronizerComponent::checkConcatStatus(
@@ -17,9 +17,12 @@
 #include "autoware/pointcloud_preprocessor/utility/memory.hpp"
 #include "autoware/universe_utils/math/constants.hpp"
 
+#include <autoware/point_types/types.hpp>
 #include <autoware/universe_utils/math/trigonometry.hpp>
 #include <tf2_eigen/tf2_eigen.hpp>
 
+#include <vector>
+
 namespace autoware::pointcloud_preprocessor
 {
 
@@ -212,10 +215,12 @@ std::optional<AngleConversion> DistortionCorrectorBase::try_compute_angle_conver
     return std::nullopt;
   }
 
+  // the angle of the next point is reused as that of the current point in the next iteration
+  float next_cartesian_rad = autoware::universe_utils::opencv_fast_atan2(*it_y, *it_x);
   for (; next_it_x != it_x.end();
        ++it_x, ++it_y, ++it_azimuth, ++next_it_x, ++next_it_y, ++next_it_azimuth) {
-    auto current_cartesian_rad = autoware::universe_utils::opencv_fast_atan2(*it_y, *it_x);
-    auto next_cartesian_rad = autoware::universe_utils::opencv_fast_atan2(*next_it_y, *next_it_x);
+    const float current_cartesian_rad = next_cartesian_rad;
+    next_cartesian_rad = autoware::universe_utils::opencv_fast_atan2(*next_it_y, *next_it_x);
 
     // If the angle exceeds 180 degrees, it may cross the 0-degree axis,
     // which could disrupt the calculation of the formula.
@@ -301,6 +306,35 @@ tf2::Transform DistortionCorrectorBase::convert_matrix_to_transform(const Eigen:
   return transform;
 }
 
+Eigen::Matrix4f DistortionCorrectorBase::convert_transform_to_matrix(
+  const tf2::Transform & transform)
+{
+  Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+  const auto & basis = transform.getBasis();
+  const auto & origin = transform.getOrigin();
+  for (int row = 0; row < 3; ++row) {
+    for (int col = 0; col < 3; ++col) {
+      matrix(row, col) = static_cast<float>(basis[row][col]);
+    }
+    matrix(row, 3) = static_cast<float>(origin[row]);
+  }
+  return matrix;
+}
+
+float DistortionCorrectorBase::compute_azimuth(
+  const AngleConversion & angle_conversion, float x, float y)
+{
+  float cartesian_coordinate_azimuth = autoware::universe_utils::opencv_fast_atan2(y, x);
+  float updated_azimuth =
+    angle_conversion.offset_rad + angle_conversion.sign * cartesian_coordinate_azimuth;
+  if (updated_azimuth < 0) {
+    updated_azimuth += autoware::universe_utils::pi * 2;
+  } else if (updated_azimuth > 2 * autoware::universe_utils::pi) {
+    updated_azimuth -= autoware::universe_utils::pi * 2;
+  }
+  return updated_azimuth;
+}
+
 template <class T>
 void DistortionCorrector<T>::undistort_pointcloud(
   bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
@@ -384,17 +418,7 @@ void DistortionCorrector<T>::undistort_pointcloud(
           "updated. "
           "Please change the input pointcloud or set update_azimuth_and_distance to false.");
       }
-      float cartesian_coordinate_azimuth =
-        autoware::universe_utils::opencv_fast_atan2(*it_y, *it_x);
-      float updated_azimuth = angle_conversion_opt->offset_rad +
-                              angle_conversion_opt->sign * cartesian_coordinate_azimuth;
-      if (updated_azimuth < 0) {
-        updated_azimuth += autoware::universe_utils::pi * 2;
-      } else if (updated_azimuth > 2 * autoware::universe_utils::pi) {
-        updated_azimuth -= autoware::universe_utils::pi * 2;
-      }
-
-      *it_azimuth = updated_azimuth;
+      *it_azimuth = compute_azimuth(*angle_conversion_opt, *it_x, *it_y);
       *it_distance = sqrt(*it_x * *it_x + *it_y * *it_y + *it_z * *it_z);
 
       ++it_azimuth;
@@ -407,6 +431,117 @@ void DistortionCorrector<T>::undistort_pointcloud(
   warn_if_timestamp_is_too_late(is_twist_time_stamp_too_late, is_imu_time_stamp_too_late);
 }
 
+template <class T>
+void DistortionCorrector<T>::undistort_pointcloud_batched(
+  bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
+  sensor_msgs::msg::PointCloud2 & pointcloud)
+{
+  if (!is_pointcloud_valid(pointcloud)) return;
+  if (twist_queue_.empty()) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      node_.get_logger(), *node_.get_clock(), 10000 /* ms */, "Twist queue is empty.");
+    return;
+  }
+  if (angle_conversion_opt.has_value() && !pointcloud_transform_needed_) {
+    throw std::runtime_error(
+      "The pointcloud is not in the sensor's frame and thus azimuth and distance cannot be "
+      "updated. "
+      "Please change the input pointcloud or set update_azimuth_and_distance to false.");
+  }
+
+  // The layout has been checked by is_pointcloud_valid, so the points can be accessed directly
+  using autoware::point_types::PointXYZIRCAEDT;
+  const size_t point_step = pointcloud.point_step;
+  const size_t num_points = pointcloud.data.size() / point_step;
+  auto point_at = [&pointcloud, point_step](size_t i) {
+    return reinterpret_cast<PointXYZIRCAEDT *>(pointcloud.data.data() + i * point_step);
+  };
+
+  const std::uint32_t first_time_stamp = point_at(0)->time_stamp;
+  double prev_time_stamp_sec{
+    pointcloud.header.stamp.sec + 1e-9 * (pointcloud.header.stamp.nanosec + first_time_stamp)};
+  const double first_point_time_stamp_sec{prev_time_stamp_sec};
+
+  std::deque<geometry_msgs::msg::TwistStamped>::iterator it_twist;
+  std::deque<geometry_msgs::msg::Vector3Stamped>::iterator it_imu;
+  get_twist_and_imu_iterator(use_imu, first_point_time_stamp_sec, it_twist, it_imu);
+
+  // For performance, do not instantiate `rclcpp::Time` inside of the for-loop
+  double twist_stamp = rclcpp::Time(it_twist->header.stamp).seconds();
+  double imu_stamp{0.0};
+  if (use_imu && !angular_velocity_queue_.empty()) {
+    imu_stamp = rclcpp::Time(it_imu->header.stamp).seconds();
+  }
+
+  // If there is a point in a pointcloud that cannot be associated, record it to issue a warning
+  bool is_twist_time_stamp_too_late = false;
+  bool is_imu_time_stamp_too_late = false;
+
+  // Step1. Compute one transform per run of points sharing the same time stamp. Points with the
+  // same time stamp as the previous one have a zero time offset, so their transform is identical.
+  std::vector<Eigen::Matrix4f> bucket_transforms;
+  std::vector<uint32_t> bucket_indices(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const std::uint32_t point_time_stamp = point_at(i)->time_stamp;
+    if (i == 0 || point_time_stamp != point_at(i - 1)->time_stamp) {
+      bool is_twist_valid = true;
+      bool is_imu_valid = true;
+
+      const double global_point_stamp =
+        pointcloud.header.stamp.sec + 1e-9 * (pointcloud.header.stamp.nanosec + point_time_stamp);
+
+      // Get closest twist information
+      while (it_twist != std::end(twist_queue_) - 1 && global_point_stamp > twist_stamp) {
+        ++it_twist;
+        twist_stamp = rclcpp::Time(it_twist->header.stamp).seconds();
+      }
+      if (std::abs(global_point_stamp - twist_stamp) > 0.1) {
+        is_twist_time_stamp_too_late = true;
+        is_twist_valid = false;
+      }
+
+      // Get closest IMU information
+      if (use_imu && !angular_velocity_queue_.empty()) {
+        while (it_imu != std::end(angular_velocity_queue_) - 1 && global_point_stamp > imu_stamp) {
+          ++it_imu;
+          imu_stamp = rclcpp::Time(it_imu->header.stamp).seconds();
+        }
+
+        if (std::abs(global_point_stamp - imu_stamp) > 0.1) {
+          is_imu_time_stamp_too_late = true;
+          is_imu_valid = false;
+        }
+      } else {
+        is_imu_valid = false;
+      }
+
+      auto time_offset = static_cast<float>(global_point_stamp - prev_time_stamp_sec);
+      bucket_transforms.push_back(
+        compute_point_transform(it_twist, it_imu, time_offset, is_twist_valid, is_imu_valid));
+      prev_time_stamp_sec = global_point_stamp;
+    }
+    bucket_indices[i] = static_cast<uint32_t>(bucket_transforms.size() - 1);
+  }
+
+  // Step2. Apply the transforms. Each point is independent here, so the loop only consists of
+  // fixed-size Eigen products which the compiler turns into packed float math.
+  for (size_t i = 0; i < num_points; ++i) {
+    auto * point = point_at(i);
+    const Eigen::Vector4f undistorted_point =
+      bucket_transforms[bucket_indices[i]] * Eigen::Vector4f(point->x, point->y, point->z, 1.0f);
+    point->x = undistorted_point[0];
+    point->y = undistorted_point[1];
+    point->z = undistorted_point[2];
+
+    if (angle_conversion_opt.has_value()) {
+      point->azimuth = compute_azimuth(*angle_conversion_opt, point->x, point->y);
+      point->distance = std::sqrt(point->x * point->x + point->y * point->y + point->z * point->z);
+    }
+  }
+
+  warn_if_timestamp_is_too_late(is_twist_time_stamp_too_late, is_imu_time_stamp_too_late);
+}
+
 ///////////////////////// Functions for different undistortion strategies /////////////////////////
 
 void DistortionCorrector2D::initialize()
@@ -548,6 +683,79 @@ inline void DistortionCorrector3D::undistort_point_implementation(
   prev_transformation_matrix_ = transformation_matrix_;
 }
 
+Eigen::Matrix4f DistortionCorrector2D::compute_point_transform_implementation(
+  std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
+  std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
+  const bool & is_twist_valid, const bool & is_imu_valid)
+{
+  // Initialize linear velocity and angular velocity
+  float v{0.0f};
+  float w{0.0f};
+  if (is_twist_valid) {
+    v = static_cast<float>(it_twist->twist.linear.x);
+    w = static_cast<float>(it_twist->twist.angular.z);
+  }
+  if (is_imu_valid) {
+    w = static_cast<float>(it_imu->vector.z);
+  }
+
+  theta_ += w * time_offset;
+  auto [sin_half_theta, cos_half_theta] = autoware::universe_utils::sin_and_cos(theta_ * 0.5f);
+  auto [sin_theta, cos_theta] = autoware::universe_utils::sin_and_cos(theta_);
+
+  baselink_quat_.setValue(0, 0, sin_half_theta, cos_half_theta);
+  const float dis = v * time_offset;
+  x_ += dis * cos_theta;
+  y_ += dis * sin_theta;
+
+  baselink_tf_odom_.setOrigin(tf2::Vector3(x_, y_, 0.0));
+  baselink_tf_odom_.setRotation(baselink_quat_);
+
+  if (pointcloud_transform_needed_) {
+    return convert_transform_to_matrix(
+      tf2_base_link_to_lidar_ * baselink_tf_odom_ * tf2_lidar_to_base_link_);
+  }
+  return convert_transform_to_matrix(baselink_tf_odom_);
+}
+
+Eigen::Matrix4f DistortionCorrector3D::compute_point_transform_implementation(
+  std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
+  std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
+  const bool & is_twist_valid, const bool & is_imu_valid)
+{
+  // Initialize linear velocity and angular velocity
+  float v_x{0.0f};
+  float v_y{0.0f};
+  float v_z{0.0f};
+  float w_x{0.0f};
+  float w_y{0.0f};
+  float w_z{0.0f};
+  if (is_twist_valid) {
+    v_x = static_cast<float>(it_twist->twist.linear.x);
+    v_y = static_cast<float>(it_twist->twist.linear.y);
+    v_z = static_cast<float>(it_twist->twist.linear.z);
+    w_x = static_cast<float>(it_twist->twist.angular.x);
+    w_y = static_cast<float>(it_twist->twist.angular.y);
+    w_z = static_cast<float>(it_twist->twist.angular.z);
+  }
+  if (is_imu_valid) {
+    w_x = static_cast<float>(it_imu->vector.x);
+    w_y = static_cast<float>(it_imu->vector.y);
+    w_z = static_cast<float>(it_imu->vector.z);
+  }
+
+  Sophus::SE3f::Tangent twist(v_x, v_y, v_z, w_x, w_y, w_z);
+  twist = twist * time_offset;
+  transformation_matrix_ = Sophus::SE3f::exp(twist).matrix();
+  transformation_matrix_ = transformation_matrix_ * prev_transformation_matrix_;
+  prev_transformation_matrix_ = transformation_matrix_;
+
+  if (pointcloud_transform_needed_) {
+    return eigen_base_link_to_lidar_ * transformation_matrix_ * eigen_lidar_to_base_link_;
+  }
+  return transformation_matrix_;
+}
+
 template class DistortionCorrector<DistortionCorrector2D>;
 template class DistortionCorrector<DistortionCorrector3D>;
 
@@ -36,6 +36,7 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
   use_imu_ = declare_parameter<bool>("use_imu");
   use_3d_distortion_correction_ = declare_parameter<bool>("use_3d_distortion_correction");
   update_azimuth_and_distance_ = declare_parameter<bool>("update_azimuth_and_distance");
+  use_batched_undistortion_ = declare_parameter<bool>("use_batched_undistortion");
   auto has_static_tf_only =
     declare_parameter<bool>("has_static_tf_only", false);  // TODO(amadeuszsz): remove default value
 
@@ -111,7 +112,12 @@ void DistortionCorrectorComponent::pointcloud_callback(PointCloud2::UniquePtr po
     }
   }
 
-  distortion_corrector_->undistort_pointcloud(use_imu_, angle_conversion_opt_, *pointcloud_msg);
+  if (use_batched_undistortion_) {
+    distortion_corrector_->undistort_pointcloud_batched(
+      use_imu_, angle_conversion_opt_, *pointcloud_msg);
+  } else {
+    distortion_corrector_->undistort_pointcloud(use_imu_, angle_conversion_opt_, *pointcloud_msg);
+  }
 
   if (debug_publisher_) {
     auto pipeline_latency_ms =
@@ -14,40 +14,7 @@
 
 #include "autoware/pointcloud_preprocessor/downsample_filter/pickup_based_voxel_grid_downsample_filter_node.hpp"
 
-#include "robin_hood.h"
-
-namespace
-{
-/**
- * @brief Hash function for voxel keys.
- * Utilizes prime numbers to calculate a unique hash for each voxel key.
- */
-struct VoxelKeyHash
-{
-  std::size_t operator()(const std::array<int, 3> & k) const
-  {
-    // Primes based on the following paper: 'Investigating the Use of Primes in Hashing for
-    // Volumetric Data'.
-    return (k[0] * 73856093 ^ k[1] * 19349663 ^ k[2] * 83492791);
-    // In general, the performance of the search may be improved by restricting the hashkey to the
-    // following However, the risk of key collisions also increases, so the value must be
-    // appropriate. Enable the following code depending on the situation. return ((1 << 16) - 1) &
-    // (k[0] * 73856093 ^ k[1] * 19349663 ^ k[2] * 83492791);
-  }
-};
-
-/**
- * @brief Equality function for voxel keys.
- * Checks if two voxel keys are equal.
- */
-struct VoxelKeyEqual
-{
-  bool operator()(const std::array<int, 3> & a, const std::array<int, 3> & b) const
-  {
-    return a == b;
-  }
-};
-}  // namespace
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_hash_grid.hpp"
 
 namespace autoware::pointcloud_preprocessor
 {
@@ -83,16 +50,9 @@ void PickupBasedVoxelGridDownsampleFilterComponent::filter(
 
   stop_watch_ptr_->toc("processing_time", true);
 
-  using VoxelKey = std::array<int, 3>;
-  // std::unordered_map<VoxelKey, size_t, VoxelKeyHash, VoxelKeyEqual> voxel_map;
-  robin_hood::unordered_map<VoxelKey, size_t, VoxelKeyHash, VoxelKeyEqual> voxel_map;
-
-  voxel_map.reserve(input->data.size() / input->point_step);
-
-  constexpr float large_num_offset = 100000.0;
-  const float inverse_voxel_size_x = 1.0 / voxel_size_x_;
-  const float inverse_voxel_size_y = 1.0 / voxel_size_y_;
-  const float inverse_voxel_size_z = 1.0 / voxel_size_z_;
+  VoxelHashGrid<FirstPointReducer> voxel_grid;
+  voxel_grid.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
+  voxel_grid.reserve(input->data.size() / input->point_step);
 
   const int x_offset = input->fields[pcl::getFieldIndex(*input, "x")].offset;
   const int y_offset = input->fields[pcl::getFieldIndex(*input, "y")].offset;
@@ -105,22 +65,14 @@ void PickupBasedVoxelGridDownsampleFilterComponent::filter(
     const float & y = *reinterpret_cast<const float *>(&input->data[global_offset + y_offset]);
     const float & z = *reinterpret_cast<const float *>(&input->data[global_offset + z_offset]);
 
-    // The reason for adding a large value is that when converting from float to int, values around
-    // -1 to 1 are all rounded down to 0. Therefore, to prevent the numbers from becoming negative,
-    // a large value is added. It has been tuned to reduce computational costs, and deliberately
-    // avoids using round or floor functions.
-    VoxelKey key = {
-      static_cast<int>((x + large_num_offset) * inverse_voxel_size_x),
-      static_cast<int>((y + large_num_offset) * inverse_voxel_size_y),
-      static_cast<int>((z + large_num_offset) * inverse_voxel_size_z)};
-
-    voxel_map.emplace(key, global_offset);
+    // Only the first point of each voxel is kept
+    voxel_grid.add_point(x, y, z, global_offset);
   }
 
   // Populate the output point cloud
   size_t output_global_offset = 0;
-  output.data.resize(voxel_map.size() * input->point_step);
-  for (const auto & kv : voxel_map) {
+  output.data.resize(voxel_grid.size() * input->point_step);
+  for (const auto & kv : voxel_grid.voxels()) {
     std::memcpy(
       &output.data[output_global_offset + x_offset], &input->data[kv.second + x_offset],
       sizeof(float));
@@ -52,10 +52,6 @@
 
 #include "autoware/pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
 
-#include <pcl/kdtree/kdtree_flann.h>
-#include <pcl/search/kdtree.h>
-#include <pcl/segmentation/segment_differences.h>
-
 #include <vector>
 
 namespace autoware::pointcloud_preprocessor
@@ -85,18 +81,10 @@ void VoxelGridDownsampleFilterComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_input(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_output(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*input, *pcl_input);
-  pcl_output->points.reserve(pcl_input->points.size());
-  pcl::VoxelGrid<pcl::PointXYZ> filter;
-  filter.setInputCloud(pcl_input);
-  // filter.setSaveLeafLayout(true);
-  filter.setLeafSize(voxel_size_x_, voxel_size_y_, voxel_size_z_);
-  filter.filter(*pcl_output);
-
-  pcl::toROSMsg(*pcl_output, output);
-  output.header = input->header;
+  FasterVoxelGridDownsampleFilter faster_voxel_filter;
+  faster_voxel_filter.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
+  faster_voxel_filter.set_field_offsets(input, this->get_logger());
+  faster_voxel_filter.filter(input, output, TransformInfo{}, this->get_logger());
 }
 
 // TODO(atsushi421): Temporary Implementation: Rename this function to `filter()` when all the
@@ -53,10 +53,14 @@
 
 #include "autoware/pointcloud_preprocessor/utility/memory.hpp"
 
+#include <autoware/point_types/types.hpp>
+
 #include <pcl_ros/transforms.hpp>
 
 #include <pcl/io/io.h>
+#include <unistd.h>
 
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -79,6 +83,7 @@ autoware::pointcloud_preprocessor::Filter::Filter(
     use_indices_ = static_cast<bool>(declare_parameter("use_indices", false));
     latched_indices_ = static_cast<bool>(declare_parameter("latched_indices", false));
     approximate_sync_ = static_cast<bool>(declare_parameter("approximate_sync", false));
+    output_packed_ = static_cast<bool>(declare_parameter("output_packed", false));
 
     RCLCPP_DEBUG_STREAM(
       this->get_logger(),
@@ -87,6 +92,7 @@ autoware::pointcloud_preprocessor::Filter::Filter(
         << " - approximate_sync : " << (approximate_sync_ ? "true" : "false") << std::endl
         << " - use_indices      : " << (use_indices_ ? "true" : "false") << std::endl
         << " - latched_indices  : " << (latched_indices_ ? "true" : "false") << std::endl
+        << " - output_packed    : " << (output_packed_ ? "true" : "false") << std::endl
         << " - max_queue_size   : " << max_queue_size_);
   }
 
@@ -109,6 +115,22 @@ autoware::pointcloud_preprocessor::Filter::Filter(
 
   published_time_publisher_ =
     std::make_unique<autoware::universe_utils::PublishedTimePublisher>(this);
+
+  // Statistics are reported by the oldest filter in the process as one diagnostic status
+  {
+    const auto statistics_period =
+      static_cast<double>(declare_parameter("statistics_publish_period", 1.0));
+    statistics_ = utils::FilterStatisticsRegistry::instance().add_stage(
+      this->get_fully_qualified_name());
+    if (statistics_period > 0.0) {
+      pub_statistics_ = this->create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+        "/diagnostics", rclcpp::QoS(1));
+      last_statistics_time_ = std::chrono::steady_clock::now();
+      statistics_timer_ = rclcpp::create_timer(
+        this, get_clock(), std::chrono::duration<double>(statistics_period),
+        std::bind(&Filter::publishStatistics, this));
+    }
+  }
   RCLCPP_DEBUG(this->get_logger(), "[Filter Constructor] successfully created.");
 }
 
@@ -141,7 +163,8 @@ void autoware::pointcloud_preprocessor::Filter::subscribe(const std::string & fi
   // each time a child class supports the faster version.
   // When all the child classes support the faster version, this workaround is deleted.
   std::set<std::string> supported_nodes = {
-    "CropBoxFilter", "RingOutlierFilter", "VoxelGridDownsampleFilter", "ScanGroundFilter"};
+    "CropBoxFilter", "RingOutlierFilter", "VoxelGridDownsampleFilter", "ScanGroundFilter",
+    "FusedPreprocessingFilter"};
   auto callback = supported_nodes.find(filter_name) != supported_nodes.end()
                     ? &Filter::faster_input_indices_callback
                     : &Filter::input_indices_callback;
@@ -194,7 +217,8 @@ void autoware::pointcloud_preprocessor::Filter::unsubscribe()
 // TODO(sykwer): Temporary Implementation: Delete this function definition when all the filter nodes
 // conform to new API.
 void autoware::pointcloud_preprocessor::Filter::computePublish(
-  const PointCloud2ConstPtr & input, const IndicesPtr & indices)
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices,
+  utils::StageStatistics::Measurement & measurement)
 {
   auto output = std::make_unique<PointCloud2>();
 
@@ -202,9 +226,11 @@ void autoware::pointcloud_preprocessor::Filter::computePublish(
   filter(input, indices, *output);
 
   if (!convert_output_costly(output)) return;
+  pack_output(output);
 
   // Copy timestamp to keep it
   output->header.stamp = input->header.stamp;
+  measurement.finish(output->width * output->height, output->data.size());
 
   // Publish a boost shared ptr
   pub_output_->publish(std::move(output));
@@ -236,8 +262,11 @@ autoware::pointcloud_preprocessor::Filter::filterParamCallback(
 // TODO(sykwer): Temporary Implementation: Delete this function definition when all the filter nodes
 // conform to new API.
 void autoware::pointcloud_preprocessor::Filter::input_indices_callback(
-  const PointCloud2ConstPtr cloud, const PointIndicesConstPtr indices)
+  const PointCloud2ConstPtr input, const PointIndicesConstPtr indices)
 {
+  auto measurement = startMeasurement(*input);
+  const auto cloud = unpack_input(input);
+
   // If cloud is given, check if it's valid
   if (!isValid(cloud)) {
     RCLCPP_ERROR(this->get_logger(), "[input_indices_callback] Invalid input!");
@@ -293,7 +322,7 @@ void autoware::pointcloud_preprocessor::Filter::input_indices_callback(
     vindices.reset(new std::vector<int>(indices->indices));
   }
 
-  computePublish(cloud_tf, vindices);
+  computePublish(cloud_tf, vindices, measurement);
 }
 
 // Returns false in error cases
@@ -363,12 +392,45 @@ bool autoware::pointcloud_preprocessor::Filter::convert_output_costly(
   return true;
 }
 
+autoware::pointcloud_preprocessor::Filter::PointCloud2ConstPtr
+autoware::pointcloud_preprocessor::Filter::unpack_input(const PointCloud2ConstPtr & input)
+{
+  if (!utils::is_data_layout_compatible_with_point_xyzirc_packed(*input)) {
+    return input;
+  }
+  auto unpacked = std::make_shared<PointCloud2>();
+  utils::unpack_point_xyzirc(*input, *unpacked);
+  return unpacked;
+}
+
+void autoware::pointcloud_preprocessor::Filter::pack_output(std::unique_ptr<PointCloud2> & output)
+{
+  if (!output_packed_) {
+    return;
+  }
+  // the other layouts have the fields which the packed format does not have
+  if (
+    !utils::is_data_layout_compatible_with_point_xyzirc(*output) ||
+    output->point_step != sizeof(autoware::point_types::PointXYZIRC)) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000,
+      "The output is published as it is, since only PointXYZIRC can be packed.");
+    return;
+  }
+  auto packed = std::make_unique<PointCloud2>();
+  utils::pack_point_xyzirc(*output, *packed);
+  output = std::move(packed);
+}
+
 // TODO(sykwer): Temporary Implementation: Rename this function to `input_indices_callback()` when
 // all the filter nodes conform to new API. Then delete the old `input_indices_callback()` defined
 // above.
 void autoware::pointcloud_preprocessor::Filter::faster_input_indices_callback(
-  const PointCloud2ConstPtr cloud, const PointIndicesConstPtr indices)
+  const PointCloud2ConstPtr input, const PointIndicesConstPtr indices)
 {
+  auto measurement = startMeasurement(*input);
+  const auto cloud = unpack_input(input);
+
   if (
     !utils::is_data_layout_compatible_with_point_xyzircaedt(*cloud) &&
     !utils::is_data_layout_compatible_with_point_xyzirc(*cloud)) {
@@ -440,8 +502,10 @@ void autoware::pointcloud_preprocessor::Filter::faster_input_indices_callback(
   faster_filter(cloud, vindices, *output, transform_info);
 
   if (!convert_output_costly(output)) return;
+  pack_output(output);
 
   output->header.stamp = cloud->header.stamp;
+  measurement.finish(output->width * output->height, output->data.size());
   pub_output_->publish(std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
 }
@@ -458,3 +522,67 @@ void autoware::pointcloud_preprocessor::Filter::faster_filter(
   (void)output;
   (void)transform_info;
 }
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+autoware::pointcloud_preprocessor::utils::StageStatistics::Measurement
+autoware::pointcloud_preprocessor::Filter::startMeasurement(const PointCloud2 & input)
+{
+  const double queueing_delay_ms = (this->now() - rclcpp::Time(input.header.stamp)).seconds() * 1e3;
+  return utils::StageStatistics::Measurement(
+    statistics_, static_cast<size_t>(input.width) * input.height, input.data.size(),
+    queueing_delay_ms);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void autoware::pointcloud_preprocessor::Filter::publishStatistics()
+{
+  auto & registry = utils::FilterStatisticsRegistry::instance();
+  if (!registry.is_reporter(statistics_.get())) {
+    // Statistics of this filter are reported by another filter in the same process
+    last_statistics_time_ = std::chrono::steady_clock::now();
+    return;
+  }
+
+  const auto current_time = std::chrono::steady_clock::now();
+  const double elapsed =
+    std::chrono::duration<double>(current_time - last_statistics_time_).count();
+  last_statistics_time_ = current_time;
+  if (elapsed <= 0.0) {
+    return;
+  }
+
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  status.name = "pointcloud_preprocessor_statistics: " + std::to_string(getpid());
+  status.hardware_id = "pointcloud_preprocessor";
+  status.message = "OK";
+
+  const auto add_value = [&status](const std::string & key, const auto & value) {
+    diagnostic_msgs::msg::KeyValue key_value;
+    key_value.key = key;
+    key_value.value = std::to_string(value);
+    status.values.push_back(key_value);
+  };
+  for (const auto & stage : registry.take_all()) {
+    const double dropped_ratio =
+      0 < stage.input_points
+        ? 1.0 - static_cast<double>(stage.output_points) / static_cast<double>(stage.input_points)
+        : 0.0;
+    add_value(stage.name + " rate [Hz]", static_cast<double>(stage.messages) / elapsed);
+    add_value(stage.name + " input points", stage.input_points);
+    add_value(stage.name + " output points", stage.output_points);
+    add_value(stage.name + " dropped points ratio", dropped_ratio);
+    add_value(stage.name + " input [byte/s]", static_cast<double>(stage.input_bytes) / elapsed);
+    add_value(stage.name + " output [byte/s]", static_cast<double>(stage.output_bytes) / elapsed);
+    add_value(stage.name + " processing time mean [ms]", stage.processing_time_ms_mean);
+    add_value(stage.name + " processing time max [ms]", stage.processing_time_ms_max);
+    add_value(stage.name + " queueing delay mean [ms]", stage.queueing_delay_ms_mean);
+    add_value(stage.name + " queueing delay max [ms]", stage.queueing_delay_ms_max);
+    add_value(stage.name + " rejected messages", stage.rejected_messages);
+  }
+
+  diagnostic_msgs::msg::DiagnosticArray diagnostics;
+  diagnostics.header.stamp = this->now();
+  diagnostics.status.push_back(std::move(status));
+  pub_statistics_->publish(diagnostics);
+}
@@ -0,0 +1,374 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/fused_preprocessing_filter/fused_preprocessing_filter_node.hpp"
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+#include "autoware/pointcloud_preprocessor/utility/memory.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+FusedPreprocessingFilterComponent::FusedPreprocessingFilterComponent(
+  const rclcpp::NodeOptions & options)
+: Filter("FusedPreprocessingFilter", options)
+{
+  // initialize debug tool
+  {
+    using autoware::universe_utils::DebugPublisher;
+    using autoware::universe_utils::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, "fused_preprocessing_filter");
+    stop_watch_ptr_->tic("cyclic_time");
+    stop_watch_ptr_->tic("processing_time");
+  }
+
+  // set initial parameters
+  {
+    auto & p = crop_box_param_;
+    p.enable = declare_parameter<bool>("crop_box.enable");
+    p.min_x = declare_parameter<float>("crop_box.min_x");
+    p.min_y = declare_parameter<float>("crop_box.min_y");
+    p.min_z = declare_parameter<float>("crop_box.min_z");
+    p.max_x = declare_parameter<float>("crop_box.max_x");
+    p.max_y = declare_parameter<float>("crop_box.max_y");
+    p.max_z = declare_parameter<float>("crop_box.max_z");
+    p.negative = declare_parameter<bool>("crop_box.negative");
+    if (p.enable && tf_input_frame_.empty()) {
+      throw std::invalid_argument("Crop box requires non-empty input_frame");
+    }
+  }
+  {
+    auto & p = ring_outlier_filter_param_;
+    p.enable = declare_parameter<bool>("ring_outlier_filter.enable");
+    p.distance_ratio = declare_parameter<double>("ring_outlier_filter.distance_ratio");
+    p.object_length_threshold =
+      declare_parameter<double>("ring_outlier_filter.object_length_threshold");
+    p.num_points_threshold = declare_parameter<int>("ring_outlier_filter.num_points_threshold");
+    p.max_rings_num =
+      static_cast<uint16_t>(declare_parameter<int64_t>("ring_outlier_filter.max_rings_num"));
+    p.max_points_num_per_ring = static_cast<size_t>(
+      declare_parameter<int64_t>("ring_outlier_filter.max_points_num_per_ring"));
+  }
+  {
+    auto & p = voxel_grid_downsample_param_;
+    p.enable = declare_parameter<bool>("voxel_grid_downsample.enable");
+    p.voxel_size_x = declare_parameter<float>("voxel_grid_downsample.voxel_size_x");
+    p.voxel_size_y = declare_parameter<float>("voxel_grid_downsample.voxel_size_y");
+    p.voxel_size_z = declare_parameter<float>("voxel_grid_downsample.voxel_size_z");
+  }
+
+  // set parameter service callback
+  {
+    using std::placeholders::_1;
+    set_param_res_ = this->add_on_set_parameters_callback(
+      std::bind(&FusedPreprocessingFilterComponent::paramCallback, this, _1));
+  }
+}
+
+// TODO(sykwer): Temporary Implementation: Delete this function definition when all the filter nodes
+// conform to new API.
+void FusedPreprocessingFilterComponent::filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output)
+{
+  (void)input;
+  (void)indices;
+  (void)output;
+}
+
+// TODO(sykwer): Temporary Implementation: Rename this function to `filter()` when all the filter
+// nodes conform to new API. Then delete the old `filter()` defined above.
+void FusedPreprocessingFilterComponent::faster_filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+  const TransformInfo & transform_info)
+{
+  std::scoped_lock lock(mutex_);
+  stop_watch_ptr_->toc("processing_time", true);
+
+  if (indices) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "Indices are not supported and will be ignored");
+  }
+
+  if (
+    ring_outlier_filter_param_.enable &&
+    !utils::is_data_layout_compatible_with_point_xyzircaedt(*input)) {
+    RCLCPP_ERROR_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "The pointcloud layout is not compatible with PointXYZIRCAEDT. Aborting");
+    return;
+  }
+
+  x_offset_ = input->fields[pcl::getFieldIndex(*input, "x")].offset;
+  y_offset_ = input->fields[pcl::getFieldIndex(*input, "y")].offset;
+  z_offset_ = input->fields[pcl::getFieldIndex(*input, "z")].offset;
+
+  // The crop box and ring outlier stages write directly into the output when the voxel grid stage
+  // is disabled, otherwise into a scratch buffer that is kept across frames.
+  PointCloud2 & filtered_points =
+    voxel_grid_downsample_param_.enable ? *filtered_points_ptr_ : output;
+
+  if (ring_outlier_filter_param_.enable) {
+    filterCropBoxAndRingOutlier(input, filtered_points, transform_info);
+  } else {
+    filterCropBox(input, filtered_points, transform_info);
+  }
+
+  if (voxel_grid_downsample_param_.enable) {
+    // The points are already transformed into the input frame by the previous stages
+    FasterVoxelGridDownsampleFilter faster_voxel_filter;
+    faster_voxel_filter.set_voxel_size(
+      voxel_grid_downsample_param_.voxel_size_x, voxel_grid_downsample_param_.voxel_size_y,
+      voxel_grid_downsample_param_.voxel_size_z);
+    faster_voxel_filter.set_field_offsets(filtered_points_ptr_, this->get_logger());
+    faster_voxel_filter.filter(filtered_points_ptr_, output, TransformInfo{}, this->get_logger());
+  }
+
+  // add processing time for debug
+  if (debug_publisher_) {
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+
+    auto pipeline_latency_ms =
+      std::chrono::duration<double, std::milli>(
+        std::chrono::nanoseconds((this->get_clock()->now() - input->header.stamp).nanoseconds()))
+        .count();
+
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/pipeline_latency_ms", pipeline_latency_ms);
+  }
+}
+
+bool FusedPreprocessingFilterComponent::getCroppedPoint(
+  const PointCloud2ConstPtr & input, size_t data_idx, const TransformInfo & transform_info,
+  Eigen::Vector4f & point) const
+{
+  std::memcpy(&point[0], &input->data[data_idx + x_offset_], sizeof(float));
+  std::memcpy(&point[1], &input->data[data_idx + y_offset_], sizeof(float));
+  std::memcpy(&point[2], &input->data[data_idx + z_offset_], sizeof(float));
+  point[3] = 1;
+
+  if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
+    return false;
+  }
+
+  if (transform_info.need_transform) {
+    point = transform_info.eigen_transform * point;
+  }
+
+  if (!crop_box_param_.enable) return true;
+
+  const auto & p = crop_box_param_;
+  bool point_is_inside = point[2] > p.min_z && point[2] < p.max_z && point[1] > p.min_y &&
+                         point[1] < p.max_y && point[0] > p.min_x && point[0] < p.max_x;
+  return p.negative != point_is_inside;
+}
+
+void FusedPreprocessingFilterComponent::filterCropBox(
+  const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info)
+{
+  output.data.resize(input->data.size());
+  size_t output_size = 0;
+
+  for (size_t data_idx = 0; data_idx + input->point_step <= input->data.size();
+       data_idx += input->point_step) {
+    Eigen::Vector4f point;
+    if (!getCroppedPoint(input, data_idx, transform_info, point)) continue;
+
+    std::memcpy(&output.data[output_size], &input->data[data_idx], input->point_step);
+    if (transform_info.need_transform) {
+      std::memcpy(&output.data[output_size + x_offset_], &point[0], sizeof(float));
+      std::memcpy(&output.data[output_size + y_offset_], &point[1], sizeof(float));
+      std::memcpy(&output.data[output_size + z_offset_], &point[2], sizeof(float));
+    }
+    output_size += input->point_step;
+  }
+
+  output.data.resize(output_size);
+  // Note that `input->header.frame_id` is data before converted when `transform_info.need_transform
+  // == true`
+  output.header.stamp = input->header.stamp;
+  output.header.frame_id = !tf_input_frame_.empty() ? tf_input_frame_ : tf_input_orig_frame_;
+  output.height = 1;
+  output.fields = input->fields;
+  output.is_bigendian = input->is_bigendian;
+  output.point_step = input->point_step;
+  output.is_dense = input->is_dense;
+  output.width = static_cast<uint32_t>(output.data.size() / output.height / output.point_step);
+  output.row_step = static_cast<uint32_t>(output.data.size() / output.height);
+}
+
+void FusedPreprocessingFilterComponent::filterCropBoxAndRingOutlier(
+  const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info)
+{
+  const auto & p = ring_outlier_filter_param_;
+
+  output.point_step = sizeof(OutputPointType);
+  output.data.resize(output.point_step * input->width * input->height);
+  size_t output_size = 0;
+
+  // Only the points kept by the crop box are bucketed, so that rejected points never enter the
+  // ring walk. Their transformed coordinates are recomputed when written to the output.
+  ring2indices_.resize(p.max_rings_num);
+  for (auto & indices : ring2indices_) {
+    indices.clear();
+    indices.reserve(p.max_points_num_per_ring);
+  }
+
+  for (size_t data_idx = 0; data_idx + input->point_step <= input->data.size();
+       data_idx += input->point_step) {
+    Eigen::Vector4f point;
+    if (!getCroppedPoint(input, data_idx, transform_info, point)) continue;
+
+    const auto input_ptr = reinterpret_cast<const InputPointType *>(&input->data[data_idx]);
+    if (input_ptr->channel >= p.max_rings_num) {
+      RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 1000, "Channel %u exceeds max_rings_num %u and is ignored",
+        input_ptr->channel, p.max_rings_num);
+      continue;
+    }
+    ring2indices_[input_ptr->channel].push_back(data_idx);
+  }
+
+  const auto write_walk = [&](const std::vector<size_t> & indices, int first, int last) {
+    for (int i = first; i <= last; i++) {
+      auto output_ptr = reinterpret_cast<OutputPointType *>(&output.data[output_size]);
+      auto input_ptr = reinterpret_cast<const InputPointType *>(&input->data[indices[i]]);
+
+      if (transform_info.need_transform) {
+        Eigen::Vector4f point(input_ptr->x, input_ptr->y, input_ptr->z, 1);
+        point = transform_info.eigen_transform * point;
+        output_ptr->x = point[0];
+        output_ptr->y = point[1];
+        output_ptr->z = point[2];
+      } else {
+        output_ptr->x = input_ptr->x;
+        output_ptr->y = input_ptr->y;
+        output_ptr->z = input_ptr->z;
+      }
+      output_ptr->intensity = input_ptr->intensity;
+      output_ptr->return_type = input_ptr->return_type;
+      output_ptr->channel = input_ptr->channel;
+
+      output_size += output.point_step;
+    }
+  };
+
+  for (const auto & indices : ring2indices_) {
+    if (indices.size() < 2) continue;
+
+    // walk range: [walk_first_idx, walk_last_idx]
+    int walk_first_idx = 0;
+    int walk_last_idx = -1;
+
+    for (size_t idx = 0U; idx < indices.size() - 1; ++idx) {
+      const auto current_ptr =
+        reinterpret_cast<const InputPointType *>(&input->data[indices[idx]]);
+      const auto next_ptr =
+        reinterpret_cast<const InputPointType *>(&input->data[indices[idx + 1]]);
+      walk_last_idx = idx;
+
+      float azimuth_diff = next_ptr->azimuth - current_ptr->azimuth;
+      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 2 * M_PI : azimuth_diff;
+
+      if (
+        std::max(current_ptr->distance, next_ptr->distance) <
+          std::min(current_ptr->distance, next_ptr->distance) * p.distance_ratio &&
+        azimuth_diff < 1.0 * (180.0 / M_PI)) {  // one degree
+        continue;                               // Determined to be included in the same walk
+      }
+
+      if (isCluster(
+            input, std::make_pair(indices[walk_first_idx], indices[walk_last_idx]),
+            walk_last_idx - walk_first_idx + 1)) {
+        write_walk(indices, walk_first_idx, walk_last_idx);
+      }
+
+      walk_first_idx = idx + 1;
+    }
+
+    if (walk_first_idx > walk_last_idx) continue;
+
+    if (isCluster(
+          input, std::make_pair(indices[walk_first_idx], indices[walk_last_idx]),
+          walk_last_idx - walk_first_idx + 1)) {
+      write_walk(indices, walk_first_idx, walk_last_idx);
+    }
+  }
+
+  output.data.resize(output_size);
+  // Note that `input->header.frame_id` is data before converted when `transform_info.need_transform
+  // == true`
+  output.header.stamp = input->header.stamp;
+  output.header.frame_id = !tf_input_frame_.empty() ? tf_input_frame_ : tf_input_orig_frame_;
+  output.height = 1;
+  output.width = static_cast<uint32_t>(output.data.size() / output.point_step);
+  output.row_step = static_cast<uint32_t>(output.data.size());
+  output.is_bigendian = input->is_bigendian;
+  output.is_dense = input->is_dense;
+
+  // This is a hack to get the correct fields in the output point cloud without creating the fields
+  // manually
+  sensor_msgs::msg::PointCloud2 msg_aux;
+  pcl::toROSMsg(pcl::PointCloud<OutputPointType>(), msg_aux);
+  output.fields = msg_aux.fields;
+}
+
+rcl_interfaces::msg::SetParametersResult FusedPreprocessingFilterComponent::paramCallback(
+  const std::vector<rclcpp::Parameter> & p)
+{
+  std::scoped_lock lock(mutex_);
+
+  auto & crop_box = crop_box_param_;
+  get_param(p, "crop_box.enable", crop_box.enable);
+  get_param(p, "crop_box.min_x", crop_box.min_x);
+  get_param(p, "crop_box.min_y", crop_box.min_y);
+  get_param(p, "crop_box.min_z", crop_box.min_z);
+  get_param(p, "crop_box.max_x", crop_box.max_x);
+  get_param(p, "crop_box.max_y", crop_box.max_y);
+  get_param(p, "crop_box.max_z", crop_box.max_z);
+  get_param(p, "crop_box.negative", crop_box.negative);
+
+  auto & ring = ring_outlier_filter_param_;
+  get_param(p, "ring_outlier_filter.enable", ring.enable);
+  get_param(p, "ring_outlier_filter.distance_ratio", ring.distance_ratio);
+  get_param(p, "ring_outlier_filter.object_length_threshold", ring.object_length_threshold);
+  get_param(p, "ring_outlier_filter.num_points_threshold", ring.num_points_threshold);
+
+  auto & voxel = voxel_grid_downsample_param_;
+  get_param(p, "voxel_grid_downsample.enable", voxel.enable);
+  get_param(p, "voxel_grid_downsample.voxel_size_x", voxel.voxel_size_x);
+  get_param(p, "voxel_grid_downsample.voxel_size_y", voxel.voxel_size_y);
+  get_param(p, "voxel_grid_downsample.voxel_size_z", voxel.voxel_size_z);
+
+  rcl_interfaces::msg::SetParametersResult result;
+  result.successful = true;
+  result.reason = "success";
+
+  return result;
+}
+
+}  // namespace autoware::pointcloud_preprocessor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(
+  autoware::pointcloud_preprocessor::FusedPreprocessingFilterComponent)
@@ -14,9 +14,7 @@
 
 #include "autoware/pointcloud_preprocessor/outlier_filter/radius_search_2d_outlier_filter_node.hpp"
 
-#include <pcl/kdtree/kdtree_flann.h>
-#include <pcl/search/kdtree.h>
-#include <pcl/segmentation/segment_differences.h>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <vector>
 
@@ -32,7 +30,6 @@ RadiusSearch2DOutlierFilterComponent::RadiusSearch2DOutlierFilterComponent(
     search_radius_ = declare_parameter<double>("search_radius");
   }
 
-  kd_tree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
 
   using std::placeholders::_1;
   set_param_res_ = this->add_on_set_parameters_callback(
@@ -46,26 +43,28 @@ void RadiusSearch2DOutlierFilterComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
-  pcl::PointCloud<pcl::PointXYZ>::Ptr xyz_cloud(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*input, *xyz_cloud);
-
-  pcl::PointCloud<pcl::PointXY>::Ptr xy_cloud(new pcl::PointCloud<pcl::PointXY>);
-  xy_cloud->points.resize(xyz_cloud->points.size());
-  for (size_t i = 0; i < xyz_cloud->points.size(); ++i) {
-    xy_cloud->points[i].x = xyz_cloud->points[i].x;
-    xy_cloud->points[i].y = xyz_cloud->points[i].y;
+  // read the points from the buffer, and count the neighbors of each point in the grid of the cells
+  // of the search radius, stopping at the threshold
+  const size_t num_points = input->width * input->height;
+  std::vector<utils::Point2d> xy_points;
+  xy_points.reserve(num_points);
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(*input, "x"), iter_y(*input, "y");
+       iter_x != iter_x.end(); ++iter_x, ++iter_y) {
+    xy_points.push_back({*iter_x, *iter_y});
   }
+  grid_.build(xy_points, static_cast<float>(search_radius_));
 
-  std::vector<int> k_indices(xy_cloud->points.size());
-  std::vector<float> k_sqr_distances(xy_cloud->points.size());
-  kd_tree_->setInputCloud(xy_cloud);
   pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_output(new pcl::PointCloud<pcl::PointXYZ>);
-  for (size_t i = 0; i < xy_cloud->points.size(); ++i) {
-    size_t k = kd_tree_->radiusSearch(i, search_radius_, k_indices, k_sqr_distances);
-    if (k >= min_neighbors_) {
-      pcl_output->points.push_back(xyz_cloud->points.at(i));
+  pcl_output->points.reserve(num_points);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*input, "z");
+  for (size_t i = 0; i < xy_points.size(); ++i, ++iter_z) {
+    const auto & p = xy_points[i];
+    if (grid_.count_neighbors(p.x, p.y, min_neighbors_) >= min_neighbors_) {
+      pcl_output->points.emplace_back(p.x, p.y, *iter_z);
     }
   }
+  pcl_output->width = pcl_output->points.size();
+  pcl_output->height = 1;
   pcl::toROSMsg(*pcl_output, output);
   output.header = input->header;
 }
@@ -55,6 +55,11 @@ RingOutlierFilterComponent::RingOutlierFilterComponent(const rclcpp::NodeOptions
       static_cast<size_t>(declare_parameter<int64_t>("max_points_num_per_ring"));
 
     publish_outlier_pointcloud_ = declare_parameter<bool>("publish_outlier_pointcloud");
+    num_threads_ = declare_parameter<int>("num_threads");
+    if (num_threads_ < 1) {
+      RCLCPP_WARN(get_logger(), "num_threads must be positive. Using 1 thread.");
+      num_threads_ = 1;
+    }
 
     min_azimuth_deg_ = declare_parameter<float>("min_azimuth_deg");
     max_azimuth_deg_ = declare_parameter<float>("max_azimuth_deg");
@@ -89,125 +94,40 @@ void RingOutlierFilterComponent::faster_filter(
 
   const auto input_channel_offset =
     input->fields.at(static_cast<size_t>(InputPointIndex::Channel)).offset;
-  const auto input_azimuth_offset =
-    input->fields.at(static_cast<size_t>(InputPointIndex::Azimuth)).offset;
-  const auto input_distance_offset =
-    input->fields.at(static_cast<size_t>(InputPointIndex::Distance)).offset;
-  const auto input_intensity_offset =
-    input->fields.at(static_cast<size_t>(InputPointIndex::Intensity)).offset;
-  const auto input_return_type_offset =
-    input->fields.at(static_cast<size_t>(InputPointIndex::ReturnType)).offset;
-
-  std::vector<std::vector<size_t>> ring2indices;
-  ring2indices.reserve(max_rings_num_);
 
-  for (uint16_t i = 0; i < max_rings_num_; i++) {
-    ring2indices.push_back(std::vector<size_t>());
-    ring2indices.back().reserve(max_points_num_per_ring_);
+  ring2indices_.resize(max_rings_num_);
+  ring_walks_.resize(max_rings_num_);
+  for (auto & indices : ring2indices_) {
+    indices.clear();
+    indices.reserve(max_points_num_per_ring_);
   }
 
   for (size_t data_idx = 0; data_idx < input->data.size(); data_idx += input->point_step) {
     const uint16_t ring =
       *reinterpret_cast<const uint16_t *>(&input->data[data_idx + input_channel_offset]);
-    ring2indices[ring].push_back(data_idx);
+    ring2indices_[ring].push_back(data_idx);
   }
 
-  // walk range: [walk_first_idx, walk_last_idx]
-  int walk_first_idx = 0;
-  int walk_last_idx = -1;
-
-  for (const auto & indices : ring2indices) {
-    if (indices.size() < 2) continue;
-
-    walk_first_idx = 0;
-    walk_last_idx = -1;
-
-    for (size_t idx = 0U; idx < indices.size() - 1; ++idx) {
-      const size_t & current_data_idx = indices[idx];
-      const size_t & next_data_idx = indices[idx + 1];
-      walk_last_idx = idx;
-
-      // if(std::abs(iter->distance - (iter+1)->distance) <= std::sqrt(iter->distance) * 0.08)
-
-      const float & current_azimuth =
-        *reinterpret_cast<const float *>(&input->data[current_data_idx + input_azimuth_offset]);
-      const float & next_azimuth =
-        *reinterpret_cast<const float *>(&input->data[next_data_idx + input_azimuth_offset]);
-      float azimuth_diff = next_azimuth - current_azimuth;
-      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 2 * M_PI : azimuth_diff;
-
-      const float & current_distance =
-        *reinterpret_cast<const float *>(&input->data[current_data_idx + input_distance_offset]);
-      const float & next_distance =
-        *reinterpret_cast<const float *>(&input->data[next_data_idx + input_distance_offset]);
-
-      if (
-        std::max(current_distance, next_distance) <
-          std::min(current_distance, next_distance) * distance_ratio_ &&
-        azimuth_diff < 1.0 * (180.0 / M_PI)) {  // one degree
-        continue;                               // Determined to be included in the same walk
-      }
-
-      if (isCluster(
-            input, std::make_pair(indices[walk_first_idx], indices[walk_last_idx]),
-            walk_last_idx - walk_first_idx + 1)) {
-        for (int i = walk_first_idx; i <= walk_last_idx; i++) {
-          auto output_ptr = reinterpret_cast<OutputPointType *>(&output.data[output_size]);
-          auto input_ptr = reinterpret_cast<const InputPointType *>(&input->data[indices[i]]);
-
-          if (transform_info.need_transform) {
-            Eigen::Vector4f p(input_ptr->x, input_ptr->y, input_ptr->z, 1);
-            p = transform_info.eigen_transform * p;
-            output_ptr->x = p[0];
-            output_ptr->y = p[1];
-            output_ptr->z = p[2];
-          } else {
-            output_ptr->x = input_ptr->x;
-            output_ptr->y = input_ptr->y;
-            output_ptr->z = input_ptr->z;
-          }
-          const std::uint8_t & intensity = *reinterpret_cast<const std::uint8_t *>(
-            &input->data[indices[i] + input_intensity_offset]);
-          output_ptr->intensity = intensity;
-
-          const std::uint8_t & return_type = *reinterpret_cast<const std::uint8_t *>(
-            &input->data[indices[i] + input_return_type_offset]);
-          output_ptr->return_type = return_type;
-
-          const std::uint8_t & channel = *reinterpret_cast<const std::uint8_t *>(
-            &input->data[indices[i] + input_channel_offset]);
-          output_ptr->channel = channel;
-
-          output_size += output.point_step;
-        }
-      } else if (publish_outlier_pointcloud_) {
-        for (int i = walk_first_idx; i <= walk_last_idx; i++) {
-          auto input_ptr =
-            reinterpret_cast<const InputPointType *>(&input->data[indices[walk_first_idx]]);
-          InputPointType outlier_point = *input_ptr;
-
-          if (transform_info.need_transform) {
-            Eigen::Vector4f p(input_ptr->x, input_ptr->y, input_ptr->z, 1);
-            p = transform_info.eigen_transform * p;
-            outlier_point.x = p[0];
-            outlier_point.y = p[1];
-            outlier_point.z = p[2];
-          }
-
-          outlier_pcl->push_back(outlier_point);
-        }
-      }
-
-      walk_first_idx = idx + 1;
-    }
+  // Rings are independent of each other, so each ring is segmented into walks in parallel
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (size_t ring = 0; ring < ring2indices_.size(); ++ring) {
+    segmentRing(input, ring2indices_[ring], ring_walks_[ring]);
+  }
 
-    if (walk_first_idx > walk_last_idx) continue;
+  // Compact the inliers: each ring writes its points from the end of the preceding rings
+  for (auto & walks : ring_walks_) {
+    walks.output_offset = output_size;
+    output_size += walks.num_inliers * output.point_step;
+  }
 
-    if (isCluster(
-          input, std::make_pair(indices[walk_first_idx], indices[walk_last_idx]),
-          walk_last_idx - walk_first_idx + 1)) {
+  // cppcheck-suppress-begin invalidPointerCast
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (size_t ring = 0; ring < ring2indices_.size(); ++ring) {
+    const auto & indices = ring2indices_[ring];
+    size_t output_offset = ring_walks_[ring].output_offset;
+    for (const auto & [walk_first_idx, walk_last_idx] : ring_walks_[ring].inlier_walks) {
       for (int i = walk_first_idx; i <= walk_last_idx; i++) {
-        auto output_ptr = reinterpret_cast<OutputPointType *>(&output.data[output_size]);
+        auto output_ptr = reinterpret_cast<OutputPointType *>(&output.data[output_offset]);
         auto input_ptr = reinterpret_cast<const InputPointType *>(&input->data[indices[i]]);
 
         if (transform_info.need_transform) {
@@ -221,33 +141,34 @@ void RingOutlierFilterComponent::faster_filter(
           output_ptr->y = input_ptr->y;
           output_ptr->z = input_ptr->z;
         }
-        const float & intensity =
-          *reinterpret_cast<const float *>(&input->data[indices[i] + input_intensity_offset]);
-        output_ptr->intensity = intensity;
+        output_ptr->intensity = input_ptr->intensity;
+        output_ptr->return_type = input_ptr->return_type;
+        output_ptr->channel = input_ptr->channel;
 
-        const std::uint8_t & return_type = *reinterpret_cast<const std::uint8_t *>(
-          &input->data[indices[i] + input_return_type_offset]);
-        output_ptr->return_type = return_type;
+        output_offset += output.point_step;
+      }
+    }
+  }
+  // cppcheck-suppress-end invalidPointerCast
 
-        const std::uint8_t & channel =
-          *reinterpret_cast<const std::uint8_t *>(&input->data[indices[i] + input_channel_offset]);
-        output_ptr->channel = channel;
+  if (publish_outlier_pointcloud_) {
+    for (size_t ring = 0; ring < ring2indices_.size(); ++ring) {
+      const auto & indices = ring2indices_[ring];
+      for (const auto & [walk_first_idx, walk_last_idx] : ring_walks_[ring].outlier_walks) {
+        for (int i = walk_first_idx; i <= walk_last_idx; i++) {
+          auto input_ptr = reinterpret_cast<const InputPointType *>(&input->data[indices[i]]);
+          InputPointType outlier_point = *input_ptr;
 
-        output_size += output.point_step;
-      }
-    } else if (publish_outlier_pointcloud_) {
-      for (int i = walk_first_idx; i < walk_last_idx; i++) {
-        auto input_ptr = reinterpret_cast<const InputPointType *>(&input->data[indices[i]]);
-        InputPointType outlier_point = *input_ptr;
-        if (transform_info.need_transform) {
-          Eigen::Vector4f p(input_ptr->x, input_ptr->y, input_ptr->z, 1);
-          p = transform_info.eigen_transform * p;
-          outlier_point.x = p[0];
-          outlier_point.y = p[1];
-          outlier_point.z = p[2];
-        }
+          if (transform_info.need_transform) {
+            Eigen::Vector4f p(input_ptr->x, input_ptr->y, input_ptr->z, 1);
+            p = transform_info.eigen_transform * p;
+            outlier_point.x = p[0];
+            outlier_point.y = p[1];
+            outlier_point.z = p[2];
+          }
 
-        outlier_pcl->push_back(outlier_point);
+          outlier_pcl->push_back(outlier_point);
+        }
       }
     }
   }
@@ -285,6 +206,70 @@ void RingOutlierFilterComponent::faster_filter(
   }
 }
 
+void RingOutlierFilterComponent::segmentRing(
+  const PointCloud2ConstPtr & input, const std::vector<size_t> & indices, RingWalks & walks) const
+{
+  walks.inlier_walks.clear();
+  walks.outlier_walks.clear();
+  walks.num_inliers = 0;
+
+  if (indices.size() < 2) return;
+
+  const auto input_azimuth_offset =
+    input->fields.at(static_cast<size_t>(InputPointIndex::Azimuth)).offset;
+  const auto input_distance_offset =
+    input->fields.at(static_cast<size_t>(InputPointIndex::Distance)).offset;
+
+  const auto close_walk = [&](int walk_first_idx, int walk_last_idx) {
+    if (isCluster(
+          input, std::make_pair(indices[walk_first_idx], indices[walk_last_idx]),
+          walk_last_idx - walk_first_idx + 1)) {
+      walks.inlier_walks.emplace_back(walk_first_idx, walk_last_idx);
+      walks.num_inliers += walk_last_idx - walk_first_idx + 1;
+    } else {
+      walks.outlier_walks.emplace_back(walk_first_idx, walk_last_idx);
+    }
+  };
+
+  // walk range: [walk_first_idx, walk_last_idx]
+  int walk_first_idx = 0;
+  int walk_last_idx = -1;
+
+  for (size_t idx = 0U; idx < indices.size() - 1; ++idx) {
+    const size_t & current_data_idx = indices[idx];
+    const size_t & next_data_idx = indices[idx + 1];
+    walk_last_idx = idx;
+
+    // if(std::abs(iter->distance - (iter+1)->distance) <= std::sqrt(iter->distance) * 0.08)
+
+    const float & current_azimuth =
+      *reinterpret_cast<const float *>(&input->data[current_data_idx + input_azimuth_offset]);
+    const float & next_azimuth =
+      *reinterpret_cast<const float *>(&input->data[next_data_idx + input_azimuth_offset]);
+    float azimuth_diff = next_azimuth - current_azimuth;
+    azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 2 * M_PI : azimuth_diff;
+
+    const float & current_distance =
+      *reinterpret_cast<const float *>(&input->data[current_data_idx + input_distance_offset]);
+    const float & next_distance =
+      *reinterpret_cast<const float *>(&input->data[next_data_idx + input_distance_offset]);
+
+    if (
+      std::max(current_distance, next_distance) <
+        std::min(current_distance, next_distance) * distance_ratio_ &&
+      azimuth_diff < 1.0 * (180.0 / M_PI)) {  // one degree
+      continue;                               // Determined to be included in the same walk
+    }
+
+    close_walk(walk_first_idx, walk_last_idx);
+    walk_first_idx = idx + 1;
+  }
+
+  if (walk_first_idx > walk_last_idx) return;
+
+  close_walk(walk_first_idx, walk_last_idx);
+}
+
 // TODO(sykwer): Temporary Implementation: Delete this function definition when all the filter nodes
 // conform to new API
 void RingOutlierFilterComponent::filter(
@@ -14,10 +14,8 @@
 
 #include "autoware/pointcloud_preprocessor/outlier_filter/voxel_grid_outlier_filter_node.hpp"
 
-#include <pcl/kdtree/kdtree_flann.h>
-#include <pcl/search/kdtree.h>
-#include <pcl/segmentation/segment_differences.h>
-
+#include <cmath>
+#include <cstring>
 #include <vector>
 
 namespace autoware::pointcloud_preprocessor
@@ -45,28 +43,56 @@ void VoxelGridOutlierFilterComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_input(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_voxelized_input(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_output(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*input, *pcl_input);
-  pcl_voxelized_input->points.reserve(pcl_input->points.size());
-  voxel_filter.setInputCloud(pcl_input);
-  voxel_filter.setSaveLeafLayout(true);
-  voxel_filter.setLeafSize(voxel_size_x_, voxel_size_y_, voxel_size_z_);
-  voxel_filter.setMinimumPointsNumberPerVoxel(voxel_points_threshold_);
-  voxel_filter.filter(*pcl_voxelized_input);
 
-  pcl_output->points.reserve(pcl_input->points.size());
-  for (size_t i = 0; i < pcl_input->points.size(); ++i) {
-    const int index = voxel_filter.getCentroidIndexAt(voxel_filter.getGridCoordinates(
-      pcl_input->points.at(i).x, pcl_input->points.at(i).y, pcl_input->points.at(i).z));
-    if (index != -1) {  // not empty voxel
-      pcl_output->points.push_back(pcl_input->points.at(i));
+  const int x_offset = input->fields[pcl::getFieldIndex(*input, "x")].offset;
+  const int y_offset = input->fields[pcl::getFieldIndex(*input, "y")].offset;
+  const int z_offset = input->fields[pcl::getFieldIndex(*input, "z")].offset;
+  const auto get_point = [&](size_t global_offset) {
+    Eigen::Vector3f point;
+    std::memcpy(&point[0], &input->data[global_offset + x_offset], sizeof(float));
+    std::memcpy(&point[1], &input->data[global_offset + y_offset], sizeof(float));
+    std::memcpy(&point[2], &input->data[global_offset + z_offset], sizeof(float));
+    return point;
+  };
+
+  // Count the points in each voxel
+  voxel_grid_.clear();
+  voxel_grid_.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
+  voxel_grid_.reserve(input->data.size() / input->point_step);
+  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
+       global_offset += input->point_step) {
+    const Eigen::Vector3f point = get_point(global_offset);
+    if (std::isfinite(point[0]) && std::isfinite(point[1]) && std::isfinite(point[2])) {
+      voxel_grid_.add_point(point[0], point[1], point[2]);
+    }
+  }
+
+  // Keep the points belonging to the voxels with enough points
+  const auto points_threshold = static_cast<uint32_t>(voxel_points_threshold_);
+  output.data.resize(input->data.size());
+  size_t output_size = 0;
+  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
+       global_offset += input->point_step) {
+    const Eigen::Vector3f point = get_point(global_offset);
+    if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
+      continue;
+    }
+    const auto * point_count = voxel_grid_.find(point[0], point[1], point[2]);
+    if (point_count != nullptr && CountThresholdReducer::reached(*point_count, points_threshold)) {
+      std::memcpy(&output.data[output_size], &input->data[global_offset], input->point_step);
+      output_size += input->point_step;
     }
   }
+  output.data.resize(output_size);
 
-  pcl::toROSMsg(*pcl_output, output);
   output.header = input->header;
+  output.height = 1;
+  output.fields = input->fields;
+  output.is_bigendian = input->is_bigendian;
+  output.point_step = input->point_step;
+  output.is_dense = true;  // we filter out invalid points
+  output.width = static_cast<uint32_t>(output.data.size() / output.height / output.point_step);
+  output.row_step = static_cast<uint32_t>(output.data.size() / output.height);
 }
 
 rcl_interfaces::msg::SetParametersResult VoxelGridOutlierFilterComponent::paramCallback(
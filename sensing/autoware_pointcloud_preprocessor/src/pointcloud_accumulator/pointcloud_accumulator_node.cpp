@@ -14,6 +14,10 @@
 
 #include "autoware/pointcloud_preprocessor/pointcloud_accumulator/pointcloud_accumulator_node.hpp"
 
+#include <Eigen/Geometry>
+
+#include <cstring>
+#include <string>
 #include <vector>
 
 namespace autoware::pointcloud_preprocessor
@@ -24,6 +28,7 @@ PointcloudAccumulatorComponent::PointcloudAccumulatorComponent(const rclcpp::Nod
   // set initial parameters
   {
     accumulation_time_sec_ = declare_parameter<double>("accumulation_time_sec");
+    world_frame_ = declare_parameter<std::string>("world_frame");
     pointcloud_buffer_.set_capacity(
       static_cast<size_t>(declare_parameter<int64_t>("pointcloud_buffer_size")));
   }
@@ -40,19 +45,104 @@ void PointcloudAccumulatorComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
-  pointcloud_buffer_.push_front(input);
-  rclcpp::Time last_time = input->header.stamp;
-  pcl::PointCloud<pcl::PointXYZ> pcl_input;
-  pcl::PointCloud<pcl::PointXYZ> pcl_output;
-  for (size_t i = 0; i < pointcloud_buffer_.size(); i++) {
-    if (accumulation_time_sec_ < (last_time - pointcloud_buffer_.at(i)->header.stamp).seconds()) {
+
+  // the pose is looked up once per sweep, so that merging the sweeps needs no lookup
+  Sweep sweep;
+  sweep.cloud = input;
+  if (
+    !world_frame_.empty() &&
+    !managed_tf_buffer_->getTransform(
+      world_frame_, input->header.frame_id, sweep.world_from_sweep)) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000,
+      "Failed to look up the transform from %s to %s. The sweep is accumulated as it is.",
+      input->header.frame_id.c_str(), world_frame_.c_str());
+  }
+  pointcloud_buffer_.push_front(std::move(sweep));
+
+  // the sweeps are only buffered while nobody consumes the merged output
+  output.header = input->header;
+  if (!hasSubscribers()) {
+    return;
+  }
+  mergeSweeps(output);
+}
+
+bool PointcloudAccumulatorComponent::hasSubscribers() const
+{
+  return pub_output_->get_subscription_count() > 0 ||
+         pub_output_->get_intra_process_subscription_count() > 0;
+}
+
+void PointcloudAccumulatorComponent::mergeSweeps(PointCloud2 & output) const
+{
+  const auto & latest = pointcloud_buffer_.front();
+  if (latest.cloud->point_step == 0) {
+    return;
+  }
+  const rclcpp::Time last_time = latest.cloud->header.stamp;
+  std::vector<const Sweep *> sweeps;
+  size_t num_bytes = 0;
+  for (const auto & sweep : pointcloud_buffer_) {
+    if (accumulation_time_sec_ < (last_time - sweep.cloud->header.stamp).seconds()) {
       break;
     }
-    pcl::fromROSMsg(*pointcloud_buffer_.at(i), pcl_input);
-    pcl_output += pcl_input;
+    if (
+      sweep.cloud->point_step != latest.cloud->point_step ||
+      sweep.cloud->fields != latest.cloud->fields) {
+      continue;
+    }
+    sweeps.push_back(&sweep);
+    num_bytes += sweep.cloud->width * sweep.cloud->height * sweep.cloud->point_step;
+  }
+
+  output.fields = latest.cloud->fields;
+  output.is_bigendian = latest.cloud->is_bigendian;
+  output.point_step = latest.cloud->point_step;
+  output.height = 1;
+  output.width = num_bytes / output.point_step;
+  output.row_step = num_bytes;
+  output.is_dense = false;
+  output.data.resize(num_bytes);
+
+  // the offsets of the position to transform the past sweeps to the latest one
+  int x_offset = -1;
+  int y_offset = -1;
+  int z_offset = -1;
+  for (const auto & field : output.fields) {
+    if (field.datatype != sensor_msgs::msg::PointField::FLOAT32) {
+      continue;
+    }
+    if (field.name == "x") x_offset = static_cast<int>(field.offset);
+    if (field.name == "y") y_offset = static_cast<int>(field.offset);
+    if (field.name == "z") z_offset = static_cast<int>(field.offset);
+  }
+  const bool compensate_motion =
+    !world_frame_.empty() && x_offset >= 0 && y_offset >= 0 && z_offset >= 0;
+  const Eigen::Matrix4f latest_from_world = latest.world_from_sweep.inverse();
+
+  size_t output_offset = 0;
+  for (const auto * sweep : sweeps) {
+    const auto & data = sweep->cloud->data;
+    const size_t size = sweep->cloud->width * sweep->cloud->height * sweep->cloud->point_step;
+    std::memcpy(output.data.data() + output_offset, data.data(), size);
+    if (compensate_motion && sweep != &latest) {
+      const Eigen::Matrix4f latest_from_sweep = latest_from_world * sweep->world_from_sweep;
+      const Eigen::Matrix3f rotation = latest_from_sweep.topLeftCorner<3, 3>();
+      const Eigen::Vector3f translation = latest_from_sweep.topRightCorner<3, 1>();
+      for (size_t offset = output_offset; offset < output_offset + size;
+           offset += output.point_step) {
+        auto * x = reinterpret_cast<float *>(&output.data[offset + x_offset]);
+        auto * y = reinterpret_cast<float *>(&output.data[offset + y_offset]);
+        auto * z = reinterpret_cast<float *>(&output.data[offset + z_offset]);
+        const Eigen::Vector3f point = rotation * Eigen::Vector3f(*x, *y, *z) + translation;
+        *x = point.x();
+        *y = point.y();
+        *z = point.z();
+      }
+    }
+    output_offset += size;
   }
-  pcl::toROSMsg(pcl_output, output);
-  output.header = input->header;
 }
 
 rcl_interfaces::msg::SetParametersResult PointcloudAccumulatorComponent::paramCallback(
@@ -63,6 +153,9 @@ rcl_interfaces::msg::SetParametersResult PointcloudAccumulatorComponent::paramCa
   if (get_param(p, "accumulation_time_sec", accumulation_time_sec_)) {
     RCLCPP_DEBUG(get_logger(), "Setting new accumulation time to: %f.", accumulation_time_sec_);
   }
+  if (get_param(p, "world_frame", world_frame_)) {
+    RCLCPP_DEBUG(get_logger(), "Setting new world frame to: %s.", world_frame_.c_str());
+  }
   int pointcloud_buffer_size;
   if (get_param(p, "pointcloud_buffer_size", pointcloud_buffer_size)) {
     pointcloud_buffer_.set_capacity((size_t)pointcloud_buffer_size);
@@ -230,56 +230,20 @@ Eigen::Matrix4f PointCloudDataSynchronizerComponent::computeTransformToAdjustFor
   const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp)
 {
   // return identity if no twist is available or old_stamp is newer than new_stamp
-  if (twist_ptr_queue_.empty() || old_stamp > new_stamp) {
+  if (twist_history_.empty() || old_stamp > new_stamp) {
     return Eigen::Matrix4f::Identity();
   }
 
-  auto old_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), old_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
-    });
-  old_twist_ptr_it =
-    old_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : old_twist_ptr_it;
-
-  auto new_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), new_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
-    });
-  new_twist_ptr_it =
-    new_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : new_twist_ptr_it;
-
-  auto prev_time = old_stamp;
-  double x = 0.0;
-  double y = 0.0;
-  double yaw = 0.0;
-  for (auto twist_ptr_it = old_twist_ptr_it; twist_ptr_it != new_twist_ptr_it + 1; ++twist_ptr_it) {
-    const double dt =
-      (twist_ptr_it != new_twist_ptr_it)
-        ? (rclcpp::Time((*twist_ptr_it)->header.stamp) - rclcpp::Time(prev_time)).seconds()
-        : (rclcpp::Time(new_stamp) - rclcpp::Time(prev_time)).seconds();
-
-    if (std::fabs(dt) > 0.1) {
-      RCLCPP_WARN_STREAM_THROTTLE(
-        get_logger(), *get_clock(), std::chrono::milliseconds(10000).count(),
-        "Time difference is too large. Cloud not interpolate. Please confirm twist topic and "
-        "timestamp");
-      break;
-    }
-
-    const double dis = (*twist_ptr_it)->twist.linear.x * dt;
-    yaw += (*twist_ptr_it)->twist.angular.z * dt;
-    x += dis * std::cos(yaw);
-    y += dis * std::sin(yaw);
-    prev_time = (*twist_ptr_it)->header.stamp;
+  bool is_step_too_long = false;
+  const auto transform = twist_history_.compute_transform_to_adjust_for_old_timestamp(
+    old_stamp, new_stamp, is_step_too_long);
+  if (is_step_too_long) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      get_logger(), *get_clock(), std::chrono::milliseconds(10000).count(),
+      "Time difference is too large. Cloud not interpolate. Please confirm twist topic and "
+      "timestamp");
   }
-  Eigen::AngleAxisf rotation_x(0, Eigen::Vector3f::UnitX());
-  Eigen::AngleAxisf rotation_y(0, Eigen::Vector3f::UnitY());
-  Eigen::AngleAxisf rotation_z(yaw, Eigen::Vector3f::UnitZ());
-  Eigen::Translation3f translation(x, y, 0);
-  Eigen::Matrix4f rotation_matrix = (translation * rotation_z * rotation_y * rotation_x).matrix();
-  return rotation_matrix;
+  return transform;
 }
 
 std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr>
@@ -560,53 +524,15 @@ void PointCloudDataSynchronizerComponent::timer_callback()
 void PointCloudDataSynchronizerComponent::twist_callback(
   const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr input)
 {
-  // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
-    }
-  }
-
-  // pop old data
-  while (!twist_ptr_queue_.empty()) {
-    if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
-      rclcpp::Time(input->header.stamp)) {
-      break;
-    }
-    twist_ptr_queue_.pop_front();
-  }
-
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header.stamp = input->header.stamp;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  twist_history_.add_twist(
+    input->header.stamp, input->twist.twist.linear.x, input->twist.twist.angular.z);
 }
 
 void PointCloudDataSynchronizerComponent::odom_callback(
   const nav_msgs::msg::Odometry::ConstSharedPtr input)
 {
-  // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
-    }
-  }
-
-  // pop old data
-  while (!twist_ptr_queue_.empty()) {
-    if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
-      rclcpp::Time(input->header.stamp)) {
-      break;
-    }
-    twist_ptr_queue_.pop_front();
-  }
-
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header.stamp = input->header.stamp;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  twist_history_.add_twist(
+    input->header.stamp, input->twist.twist.linear.x, input->twist.twist.angular.z);
 }
 
 void PointCloudDataSynchronizerComponent::checkSyncStatus(
@@ -0,0 +1,143 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/utility/filter_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor::utils
+{
+StageStatistics::Measurement::Measurement(
+  std::shared_ptr<StageStatistics> statistics, size_t input_points, size_t input_bytes,
+  double queueing_delay_ms)
+: statistics_(std::move(statistics)),
+  start_(std::chrono::steady_clock::now()),
+  input_points_(input_points),
+  input_bytes_(input_bytes),
+  queueing_delay_ms_(queueing_delay_ms)
+{
+}
+
+StageStatistics::Measurement::~Measurement()
+{
+  if (!finished_ && statistics_) {
+    statistics_->add_rejected();
+  }
+}
+
+void StageStatistics::Measurement::finish(size_t output_points, size_t output_bytes)
+{
+  if (finished_ || !statistics_) {
+    return;
+  }
+  const std::chrono::duration<double, std::milli> processing_time =
+    std::chrono::steady_clock::now() - start_;
+  statistics_->add(
+    input_points_, input_bytes_, output_points, output_bytes, processing_time.count(),
+    queueing_delay_ms_);
+  finished_ = true;
+}
+
+StageStatistics::StageStatistics(std::string name)
+{
+  current_.name = std::move(name);
+}
+
+void StageStatistics::add(
+  size_t input_points, size_t input_bytes, size_t output_points, size_t output_bytes,
+  double processing_time_ms, double queueing_delay_ms)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++current_.messages;
+  current_.input_points += input_points;
+  current_.output_points += output_points;
+  current_.input_bytes += input_bytes;
+  current_.output_bytes += output_bytes;
+  processing_time_ms_sum_ += processing_time_ms;
+  queueing_delay_ms_sum_ += queueing_delay_ms;
+  current_.processing_time_ms_max = std::max(current_.processing_time_ms_max, processing_time_ms);
+  current_.queueing_delay_ms_max = std::max(current_.queueing_delay_ms_max, queueing_delay_ms);
+}
+
+void StageStatistics::add_rejected()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++current_.rejected_messages;
+}
+
+StageSummary StageStatistics::take()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  StageSummary summary = current_;
+  if (0 < summary.messages) {
+    const auto messages = static_cast<double>(summary.messages);
+    summary.processing_time_ms_mean = processing_time_ms_sum_ / messages;
+    summary.queueing_delay_ms_mean = queueing_delay_ms_sum_ / messages;
+  }
+
+  current_ = StageSummary{};
+  current_.name = summary.name;
+  processing_time_ms_sum_ = 0.0;
+  queueing_delay_ms_sum_ = 0.0;
+  return summary;
+}
+
+FilterStatisticsRegistry & FilterStatisticsRegistry::instance()
+{
+  static FilterStatisticsRegistry registry;
+  return registry;
+}
+
+std::shared_ptr<StageStatistics> FilterStatisticsRegistry::add_stage(const std::string & name)
+{
+  auto stage = std::make_shared<StageStatistics>(name);
+  std::lock_guard<std::mutex> lock(mutex_);
+  stages_.push_back(stage);
+  return stage;
+}
+
+bool FilterStatisticsRegistry::is_reporter(const StageStatistics * stage)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto & weak_stage : stages_) {
+    if (const auto alive_stage = weak_stage.lock()) {
+      return alive_stage.get() == stage;
+    }
+  }
+  return false;
+}
+
+std::vector<StageSummary> FilterStatisticsRegistry::take_all()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  stages_.erase(
+    std::remove_if(
+      stages_.begin(), stages_.end(),
+      [](const std::weak_ptr<StageStatistics> & stage) { return stage.expired(); }),
+    stages_.end());
+
+  std::vector<StageSummary> summaries;
+  summaries.reserve(stages_.size());
+  for (const auto & weak_stage : stages_) {
+    if (const auto stage = weak_stage.lock()) {
+      summaries.push_back(stage->take());
+    }
+  }
+  return summaries;
+}
+}  // namespace autoware::pointcloud_preprocessor::utils
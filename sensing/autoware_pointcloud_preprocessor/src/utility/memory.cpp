@@ -14,6 +14,7 @@
 
 #include "autoware/pointcloud_preprocessor/utility/memory.hpp"
 
+#include <autoware/point_types/packed_types.hpp>
 #include <autoware/point_types/types.hpp>
 
 namespace autoware::pointcloud_preprocessor::utils
@@ -208,4 +209,81 @@ bool is_data_layout_compatible_with_point_xyzircaedt(const sensor_msgs::msg::Poi
   return same_layout;
 }
 
+bool is_data_layout_compatible_with_point_xyzirc_packed(
+  const sensor_msgs::msg::PointCloud2 & input)
+{
+  using PointIndex = autoware::point_types::PointXYZIRCPackedIndex;
+  using autoware::point_types::PointXYZIRCPacked;
+  // the points are read without the copy, so that the point step must not have any padding
+  if (input.fields.size() != 6 || input.point_step != sizeof(PointXYZIRCPacked)) {
+    return false;
+  }
+  bool same_layout = true;
+  const auto & field_x = input.fields.at(static_cast<size_t>(PointIndex::X));
+  same_layout &= field_x.name == "x";
+  same_layout &= field_x.offset == offsetof(PointXYZIRCPacked, x);
+  same_layout &= field_x.datatype == sensor_msgs::msg::PointField::INT16;
+  same_layout &= field_x.count == 1;
+  const auto & field_y = input.fields.at(static_cast<size_t>(PointIndex::Y));
+  same_layout &= field_y.name == "y";
+  same_layout &= field_y.offset == offsetof(PointXYZIRCPacked, y);
+  same_layout &= field_y.datatype == sensor_msgs::msg::PointField::INT16;
+  same_layout &= field_y.count == 1;
+  const auto & field_z = input.fields.at(static_cast<size_t>(PointIndex::Z));
+  same_layout &= field_z.name == "z";
+  same_layout &= field_z.offset == offsetof(PointXYZIRCPacked, z);
+  same_layout &= field_z.datatype == sensor_msgs::msg::PointField::INT16;
+  same_layout &= field_z.count == 1;
+  const auto & field_intensity = input.fields.at(static_cast<size_t>(PointIndex::Intensity));
+  same_layout &= field_intensity.name == "intensity";
+  same_layout &= field_intensity.offset == offsetof(PointXYZIRCPacked, intensity);
+  same_layout &= field_intensity.datatype == sensor_msgs::msg::PointField::UINT8;
+  same_layout &= field_intensity.count == 1;
+  const auto & field_return_type = input.fields.at(static_cast<size_t>(PointIndex::ReturnType));
+  same_layout &= field_return_type.name == "return_type";
+  same_layout &= field_return_type.offset == offsetof(PointXYZIRCPacked, return_type);
+  same_layout &= field_return_type.datatype == sensor_msgs::msg::PointField::UINT8;
+  same_layout &= field_return_type.count == 1;
+  const auto & field_channel = input.fields.at(static_cast<size_t>(PointIndex::Channel));
+  same_layout &= field_channel.name == "channel";
+  same_layout &= field_channel.offset == offsetof(PointXYZIRCPacked, channel);
+  same_layout &= field_channel.datatype == sensor_msgs::msg::PointField::UINT16;
+  same_layout &= field_channel.count == 1;
+  return same_layout;
+}
+
+void pack_point_xyzirc(
+  const sensor_msgs::msg::PointCloud2 & input, sensor_msgs::msg::PointCloud2 & output)
+{
+  using autoware::point_types::PointXYZIRC;
+  using autoware::point_types::PointXYZIRCPacked;
+  const size_t num_points = input.data.size() / input.point_step;
+
+  point_cloud_msg_wrapper::PointCloud2Modifier<
+    PointXYZIRCPacked, autoware::point_types::PointXYZIRCPackedGenerator>
+    modifier{output, input.header.frame_id};
+  modifier.resize(num_points);
+  output.header = input.header;
+  autoware::point_types::pack_points(
+    reinterpret_cast<const PointXYZIRC *>(input.data.data()), num_points,
+    reinterpret_cast<PointXYZIRCPacked *>(output.data.data()));
+}
+
+void unpack_point_xyzirc(
+  const sensor_msgs::msg::PointCloud2 & input, sensor_msgs::msg::PointCloud2 & output)
+{
+  using autoware::point_types::PointXYZIRC;
+  using autoware::point_types::PointXYZIRCPacked;
+  const size_t num_points = input.data.size() / input.point_step;
+
+  point_cloud_msg_wrapper::PointCloud2Modifier<
+    PointXYZIRC, autoware::point_types::PointXYZIRCGenerator>
+    modifier{output, input.header.frame_id};
+  modifier.resize(num_points);
+  output.header = input.header;
+  autoware::point_types::unpack_points(
+    reinterpret_cast<const PointXYZIRCPacked *>(input.data.data()), num_points,
+    reinterpret_cast<PointXYZIRC *>(output.data.data()));
+}
+
 }  // namespace autoware::pointcloud_preprocessor::utils
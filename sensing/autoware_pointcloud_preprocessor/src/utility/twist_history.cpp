@@ -0,0 +1,151 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/utility/twist_history.hpp"
+
+#include <Eigen/Geometry>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace autoware::pointcloud_preprocessor::utils
+{
+TwistHistory::TwistHistory(double max_history_duration_sec, double max_integration_step_sec)
+: max_history_duration_ns_(static_cast<int64_t>(max_history_duration_sec * 1e9)),
+  max_integration_step_ns_(static_cast<int64_t>(max_integration_step_sec * 1e9))
+{
+}
+
+void TwistHistory::add_twist(const rclcpp::Time & stamp, double linear_x, double angular_z)
+{
+  const int64_t stamp_ns = stamp.nanoseconds();
+
+  // if rosbag restart, clear buffer
+  if (!samples_.empty() && samples_.front().stamp_ns > stamp_ns) {
+    samples_.clear();
+  }
+
+  // pop old data
+  while (!samples_.empty() && samples_.front().stamp_ns + max_history_duration_ns_ <= stamp_ns) {
+    samples_.pop_front();
+  }
+
+  Sample sample{stamp_ns, linear_x, angular_z, Pose2d{}, 0};
+  if (!samples_.empty()) {
+    const auto & prev = samples_.back();
+    const int64_t step_ns = stamp_ns - prev.stamp_ns;
+    sample.pose = compose(prev.pose, integrate_step(sample, static_cast<double>(step_ns) * 1e-9));
+    sample.num_long_steps =
+      prev.num_long_steps + (std::abs(step_ns) > max_integration_step_ns_ ? 1 : 0);
+  }
+  samples_.push_back(sample);
+}
+
+Eigen::Matrix4f TwistHistory::compute_transform_to_adjust_for_old_timestamp(
+  const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp, bool & is_step_too_long) const
+{
+  is_step_too_long = false;
+  const int64_t old_stamp_ns = old_stamp.nanoseconds();
+  const int64_t new_stamp_ns = new_stamp.nanoseconds();
+  if (samples_.empty() || old_stamp_ns > new_stamp_ns) {
+    return Eigen::Matrix4f::Identity();
+  }
+
+  // The motion is integrated with the velocity of the first twist not older than the end of each
+  // step: the first step ends at the first twist after old_stamp, the last one at new_stamp, and
+  // the steps in between are already integrated in the poses of the samples.
+  const size_t old_index = lower_bound_index(old_stamp_ns);
+  const size_t new_index = lower_bound_index(new_stamp_ns);
+  const auto is_valid_step = [this, &is_step_too_long](int64_t step_ns) {
+    if (std::abs(step_ns) > max_integration_step_ns_) {
+      is_step_too_long = true;
+      return false;
+    }
+    return true;
+  };
+
+  Pose2d pose;
+  if (old_index == new_index) {
+    const int64_t step_ns = new_stamp_ns - old_stamp_ns;
+    if (is_valid_step(step_ns)) {
+      pose = integrate_step(samples_[new_index], static_cast<double>(step_ns) * 1e-9);
+    }
+  } else {
+    const int64_t first_step_ns = samples_[old_index].stamp_ns - old_stamp_ns;
+    if (is_valid_step(first_step_ns)) {
+      pose = integrate_step(samples_[old_index], static_cast<double>(first_step_ns) * 1e-9);
+
+      const uint64_t num_long_steps = samples_[old_index].num_long_steps;
+      if (samples_[new_index - 1].num_long_steps != num_long_steps) {
+        // stop right before the first long step
+        const auto long_step_it = std::upper_bound(
+          samples_.begin() + old_index + 1, samples_.begin() + new_index, num_long_steps,
+          [](uint64_t n, const Sample & sample) { return n < sample.num_long_steps; });
+        const auto last_index = static_cast<size_t>(long_step_it - samples_.begin()) - 1;
+        pose = compose(pose, relative_pose(old_index, last_index));
+        is_step_too_long = true;
+      } else {
+        pose = compose(pose, relative_pose(old_index, new_index - 1));
+        const int64_t last_step_ns = new_stamp_ns - samples_[new_index - 1].stamp_ns;
+        if (is_valid_step(last_step_ns)) {
+          pose = compose(
+            pose, integrate_step(samples_[new_index], static_cast<double>(last_step_ns) * 1e-9));
+        }
+      }
+    }
+  }
+
+  Eigen::AngleAxisf rotation_z(static_cast<float>(pose.yaw), Eigen::Vector3f::UnitZ());
+  Eigen::Translation3f translation(static_cast<float>(pose.x), static_cast<float>(pose.y), 0);
+  Eigen::Matrix4f rotation_matrix = (translation * rotation_z).matrix();
+  return rotation_matrix;
+}
+
+TwistHistory::Pose2d TwistHistory::integrate_step(const Sample & sample, double dt)
+{
+  const double dis = sample.linear_x * dt;
+  const double yaw = sample.angular_z * dt;
+  return Pose2d{dis * std::cos(yaw), dis * std::sin(yaw), yaw};
+}
+
+TwistHistory::Pose2d TwistHistory::relative_pose(size_t from, size_t to) const
+{
+  const auto & from_pose = samples_[from].pose;
+  const auto & to_pose = samples_[to].pose;
+  const double dx = to_pose.x - from_pose.x;
+  const double dy = to_pose.y - from_pose.y;
+  const double cos_yaw = std::cos(from_pose.yaw);
+  const double sin_yaw = std::sin(from_pose.yaw);
+  return Pose2d{
+    cos_yaw * dx + sin_yaw * dy, -sin_yaw * dx + cos_yaw * dy, to_pose.yaw - from_pose.yaw};
+}
+
+TwistHistory::Pose2d TwistHistory::compose(const Pose2d & a, const Pose2d & b)
+{
+  const double cos_yaw = std::cos(a.yaw);
+  const double sin_yaw = std::sin(a.yaw);
+  return Pose2d{
+    a.x + cos_yaw * b.x - sin_yaw * b.y, a.y + sin_yaw * b.x + cos_yaw * b.y, a.yaw + b.yaw};
+}
+
+size_t TwistHistory::lower_bound_index(int64_t stamp_ns) const
+{
+  const auto it = std::lower_bound(
+    samples_.begin(), samples_.end(), stamp_ns,
+    [](const Sample & sample, int64_t t) { return sample.stamp_ns < t; });
+  return it == samples_.end() ? samples_.size() - 1 : static_cast<size_t>(it - samples_.begin());
+}
+
+}  // namespace autoware::pointcloud_preprocessor::utils
@@ -24,6 +24,9 @@
 #include <lanelet2_core/geometry/Polygon.h>
 #include <tf2_ros/create_timer_ros.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -41,6 +44,9 @@ Lanelet2MapFilterComponent::Lanelet2MapFilterComponent(const rclcpp::NodeOptions
   {
     voxel_size_x_ = declare_parameter<float>("voxel_size_x");
     voxel_size_y_ = declare_parameter<float>("voxel_size_y");
+    use_raster_index_ = declare_parameter<bool>("use_raster_index");
+    raster_resolution_ = declare_parameter<double>("raster_resolution");
+    raster_tile_margin_ = declare_parameter<double>("raster_tile_margin");
   }
 
   // Set publisher
@@ -166,6 +172,41 @@ bool Lanelet2MapFilterComponent::pointWithinLanelets(
   return false;
 }
 
+bool Lanelet2MapFilterComponent::pointWithinRasterIndex(const Point2d & point)
+{
+  return raster_index_.is_within(point.x(), point.y(), [&](uint32_t polygon_index) {
+    return boost::geometry::within(point, road_polygons_[polygon_index]);
+  });
+}
+
+void Lanelet2MapFilterComponent::updateRasterIndex(
+  const pcl::PointCloud<pcl::PointXYZ>::Ptr & input_cloud)
+{
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & p : input_cloud->points) {
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+      continue;
+    }
+    min_x = std::min(min_x, static_cast<double>(p.x));
+    min_y = std::min(min_y, static_cast<double>(p.y));
+    max_x = std::max(max_x, static_cast<double>(p.x));
+    max_y = std::max(max_y, static_cast<double>(p.y));
+  }
+  if (min_x > max_x || min_y > max_y) {
+    return;
+  }
+
+  // the tile is extended by a margin, so that it is only rebuilt after the ego moves by the margin
+  if (!raster_index_.covers(min_x, min_y, max_x, max_y)) {
+    raster_index_.build(
+      road_polygons_, min_x - raster_tile_margin_, min_y - raster_tile_margin_,
+      max_x + raster_tile_margin_, max_y + raster_tile_margin_, raster_resolution_);
+  }
+}
+
 pcl::PointCloud<pcl::PointXYZ> Lanelet2MapFilterComponent::getLaneFilteredPointCloud(
   const lanelet::ConstLanelets & intersected_lanelets,
   const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud)
@@ -203,8 +244,11 @@ pcl::PointCloud<pcl::PointXYZ> Lanelet2MapFilterComponent::getLaneFilteredPointC
   }
 
   for (auto & point : downsampled_cloud->points) {
-    if (pointWithinLanelets(
-          Point2d(point.x + centroid[0], point.y + centroid[1]), intersected_lanelets)) {
+    const Point2d point_2d(point.x + centroid[0], point.y + centroid[1]);
+    const bool within_lanelets = use_raster_index_
+                                   ? pointWithinRasterIndex(point_2d)
+                                   : pointWithinLanelets(point_2d, intersected_lanelets);
+    if (within_lanelets) {
       const size_t index = voxel_grid.getCentroidIndex(point);
       for (auto & original_point : downsampled2original_map[index].points) {
         original_point.x += centroid[0];
@@ -237,10 +281,15 @@ void Lanelet2MapFilterComponent::pointcloudCallback(const PointCloud2ConstPtr cl
   if (cloud->points.empty()) {
     return;
   }
-  // calculate convex hull
-  const auto convex_hull = getConvexHull(cloud);
-  // get intersected lanelets
-  lanelet::ConstLanelets intersected_lanelets = getIntersectedLanelets(convex_hull, road_lanelets_);
+  lanelet::ConstLanelets intersected_lanelets;
+  if (use_raster_index_) {
+    updateRasterIndex(cloud);
+  } else {
+    // calculate convex hull
+    const auto convex_hull = getConvexHull(cloud);
+    // get intersected lanelets
+    intersected_lanelets = getIntersectedLanelets(convex_hull, road_lanelets_);
+  }
   // filter pointcloud by lanelet
   const auto filtered_cloud = getLaneFilteredPointCloud(intersected_lanelets, cloud);
   // transform pointcloud to input frame
@@ -266,6 +315,12 @@ void Lanelet2MapFilterComponent::mapCallback(
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr_);
   const lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
   road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
+
+  road_polygons_.clear();
+  for (const auto & road_lanelet : road_lanelets_) {
+    road_polygons_.push_back(road_lanelet.polygon2d().basicPolygon());
+  }
+  raster_index_.clear();
 }
 
 }  // namespace autoware::pointcloud_preprocessor
@@ -14,6 +14,10 @@
 
 #include "autoware/pointcloud_preprocessor/vector_map_filter/vector_map_inside_area_filter_node.hpp"
 
+#include <cmath>
+#include <optional>
+#include <vector>
+
 namespace
 {
 autoware::universe_utils::Box2d calcBoundingBox(
@@ -78,6 +82,9 @@ VectorMapInsideAreaFilterComponent::VectorMapInsideAreaFilterComponent(
   // Set parameters
   use_z_filter_ = declare_parameter<bool>("use_z_filter");
   z_threshold_ = declare_parameter<float>("z_threshold");  // defined in the base_link frame
+  use_raster_index_ = declare_parameter<bool>("use_raster_index");
+  raster_resolution_ = declare_parameter<double>("raster_resolution");
+  raster_tile_margin_ = declare_parameter<double>("raster_tile_margin");
 
   // Set tf
   {
@@ -109,9 +116,6 @@ void VectorMapInsideAreaFilterComponent::filter(
   // calculate bounding box of points
   const auto bounding_box = calcBoundingBox(pc_input);
 
-  // use only intersected lanelets to reduce calculation cost
-  const auto intersected_lanelets = calcIntersectedPolygons(bounding_box, polygon_lanelets_);
-
   // filter pointcloud by lanelet
   std::optional<float> z_threshold_in_base_link = std::nullopt;
   if (use_z_filter_) {
@@ -130,6 +134,30 @@ void VectorMapInsideAreaFilterComponent::filter(
       }
     }
   }
+
+  if (use_raster_index_ && updateRasterIndex(bounding_box)) {
+    pcl::PointCloud<pcl::PointXYZ> filtered_pc;
+    filtered_pc.reserve(pc_input->size());
+    for (const auto & p : *pc_input) {
+      const bool within_max_z = z_threshold_in_base_link ? p.z <= *z_threshold_in_base_link : true;
+      // remove points within the polygon and max_z
+      if (
+        within_max_z && raster_index_.is_within(p.x, p.y, [&](uint32_t polygon_index) {
+          const auto & polygon = cgal_polygons_[polygon_index];
+          return CGAL::bounded_side_2(polygon.begin(), polygon.end(), PointCgal(p.x, p.y), K()) ==
+                 CGAL::ON_BOUNDED_SIDE;
+        })) {
+        continue;
+      }
+      filtered_pc.emplace_back(p);
+    }
+    pcl::toROSMsg(filtered_pc, output);
+    output.header = input->header;
+    return;
+  }
+
+  // use only intersected lanelets to reduce calculation cost
+  const auto intersected_lanelets = calcIntersectedPolygons(bounding_box, polygon_lanelets_);
   const auto filtered_pc =
     removePointsWithinPolygons(pc_input, intersected_lanelets, z_threshold_in_base_link);
 
@@ -138,6 +166,27 @@ void VectorMapInsideAreaFilterComponent::filter(
   output.header = input->header;
 }
 
+bool VectorMapInsideAreaFilterComponent::updateRasterIndex(
+  const autoware::universe_utils::Box2d & bounding_box)
+{
+  const double min_x = bounding_box.min_corner().x();
+  const double min_y = bounding_box.min_corner().y();
+  const double max_x = bounding_box.max_corner().x();
+  const double max_y = bounding_box.max_corner().y();
+  // also false for NaN
+  if (!(min_x <= max_x && min_y <= max_y) || !std::isfinite(max_x - min_x + max_y - min_y)) {
+    return false;
+  }
+
+  // the tile is extended by a margin, so that it is only rebuilt after the ego moves by the margin
+  if (!raster_index_.covers(min_x, min_y, max_x, max_y)) {
+    raster_index_.build(
+      polygons_2d_, min_x - raster_tile_margin_, min_y - raster_tile_margin_,
+      max_x + raster_tile_margin_, max_y + raster_tile_margin_, raster_resolution_);
+  }
+  return true;
+}
+
 void VectorMapInsideAreaFilterComponent::mapCallback(
   const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr map_msg)
 {
@@ -146,6 +195,16 @@ void VectorMapInsideAreaFilterComponent::mapCallback(
   const auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr);
   polygon_lanelets_ = lanelet::utils::query::getAllPolygonsByType(lanelet_map_ptr, polygon_type_);
+
+  polygons_2d_.clear();
+  cgal_polygons_.clear();
+  for (const auto & polygon : polygon_lanelets_) {
+    polygons_2d_.push_back(lanelet::utils::to2D(polygon).basicPolygon());
+    PolygonCgal cgal_poly;
+    autoware::pointcloud_preprocessor::utils::to_cgal_polygon(polygons_2d_.back(), cgal_poly);
+    cgal_polygons_.push_back(cgal_poly);
+  }
+  raster_index_.clear();
 }
 
 }  // namespace autoware::pointcloud_preprocessor
@@ -1278,6 +1278,74 @@ TEST_F(DistortionCorrectorTest, TestTryComputeAngleConversionOnBadAzimuthPointcl
   EXPECT_FALSE(angle_conversion_opt.has_value());
 }
 
+TEST_F(DistortionCorrectorTest, TestUndistortPointcloudBatched2dMatchesPerPoint)
+{
+  rclcpp::Time timestamp(timestamp_seconds, timestamp_nanoseconds, RCL_ROS_TIME);
+  auto [default_points, default_azimuths] =
+    generate_default_pointcloud(AngleCoordinateSystem::CARTESIAN);
+  auto expected_pointcloud =
+    generate_pointcloud_msg(true, timestamp, default_points, default_azimuths);
+  auto batched_pointcloud =
+    generate_pointcloud_msg(true, timestamp, default_points, default_azimuths);
+
+  generate_and_process_twist_msgs(distortion_corrector_2d_, timestamp);
+  generate_and_process_imu_msgs(distortion_corrector_2d_, timestamp);
+  distortion_corrector_2d_->set_pointcloud_transform("base_link", "lidar_top");
+
+  distortion_corrector_2d_->initialize();
+  distortion_corrector_2d_->undistort_pointcloud(true, std::nullopt, expected_pointcloud);
+  distortion_corrector_2d_->initialize();
+  distortion_corrector_2d_->undistort_pointcloud_batched(true, std::nullopt, batched_pointcloud);
+
+  sensor_msgs::PointCloud2ConstIterator<float> expected_iter_x(expected_pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> expected_iter_y(expected_pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> expected_iter_z(expected_pointcloud, "z");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(batched_pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(batched_pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(batched_pointcloud, "z");
+
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z, ++expected_iter_x,
+                                 ++expected_iter_y, ++expected_iter_z) {
+    EXPECT_NEAR(*iter_x, *expected_iter_x, standard_tolerance);
+    EXPECT_NEAR(*iter_y, *expected_iter_y, standard_tolerance);
+    EXPECT_NEAR(*iter_z, *expected_iter_z, standard_tolerance);
+  }
+}
+
+TEST_F(DistortionCorrectorTest, TestUndistortPointcloudBatched3dMatchesPerPoint)
+{
+  rclcpp::Time timestamp(timestamp_seconds, timestamp_nanoseconds, RCL_ROS_TIME);
+  auto [default_points, default_azimuths] =
+    generate_default_pointcloud(AngleCoordinateSystem::CARTESIAN);
+  auto expected_pointcloud =
+    generate_pointcloud_msg(true, timestamp, default_points, default_azimuths);
+  auto batched_pointcloud =
+    generate_pointcloud_msg(true, timestamp, default_points, default_azimuths);
+
+  generate_and_process_twist_msgs(distortion_corrector_3d_, timestamp);
+  generate_and_process_imu_msgs(distortion_corrector_3d_, timestamp);
+  distortion_corrector_3d_->set_pointcloud_transform("base_link", "lidar_top");
+
+  distortion_corrector_3d_->initialize();
+  distortion_corrector_3d_->undistort_pointcloud(true, std::nullopt, expected_pointcloud);
+  distortion_corrector_3d_->initialize();
+  distortion_corrector_3d_->undistort_pointcloud_batched(true, std::nullopt, batched_pointcloud);
+
+  sensor_msgs::PointCloud2ConstIterator<float> expected_iter_x(expected_pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> expected_iter_y(expected_pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> expected_iter_z(expected_pointcloud, "z");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(batched_pointcloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(batched_pointcloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(batched_pointcloud, "z");
+
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z, ++expected_iter_x,
+                                 ++expected_iter_y, ++expected_iter_z) {
+    EXPECT_NEAR(*iter_x, *expected_iter_x, standard_tolerance);
+    EXPECT_NEAR(*iter_y, *expected_iter_y, standard_tolerance);
+    EXPECT_NEAR(*iter_z, *expected_iter_z, standard_tolerance);
+  }
+}
+
 int main(int argc, char ** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,101 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/utility/filter_statistics.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using autoware::pointcloud_preprocessor::utils::FilterStatisticsRegistry;
+using autoware::pointcloud_preprocessor::utils::StageStatistics;
+
+constexpr double EPSILON = 1e-6;
+
+TEST(FilterStatisticsTest, AccumulateAndTake)
+{
+  auto statistics = std::make_shared<StageStatistics>("stage");
+  statistics->add(100, 1600, 80, 1280, 2.0, 10.0);
+  statistics->add(200, 3200, 100, 1600, 4.0, 30.0);
+
+  const auto summary = statistics->take();
+  EXPECT_EQ(summary.name, "stage");
+  EXPECT_EQ(summary.messages, 2u);
+  EXPECT_EQ(summary.rejected_messages, 0u);
+  EXPECT_EQ(summary.input_points, 300u);
+  EXPECT_EQ(summary.output_points, 180u);
+  EXPECT_EQ(summary.input_bytes, 4800u);
+  EXPECT_EQ(summary.output_bytes, 2880u);
+  EXPECT_NEAR(summary.processing_time_ms_mean, 3.0, EPSILON);
+  EXPECT_NEAR(summary.processing_time_ms_max, 4.0, EPSILON);
+  EXPECT_NEAR(summary.queueing_delay_ms_mean, 20.0, EPSILON);
+  EXPECT_NEAR(summary.queueing_delay_ms_max, 30.0, EPSILON);
+
+  // The statistics are reset after they are taken
+  const auto empty_summary = statistics->take();
+  EXPECT_EQ(empty_summary.name, "stage");
+  EXPECT_EQ(empty_summary.messages, 0u);
+  EXPECT_EQ(empty_summary.input_points, 0u);
+  EXPECT_NEAR(empty_summary.processing_time_ms_mean, 0.0, EPSILON);
+  EXPECT_NEAR(empty_summary.processing_time_ms_max, 0.0, EPSILON);
+}
+
+TEST(FilterStatisticsTest, Measurement)
+{
+  auto statistics = std::make_shared<StageStatistics>("stage");
+  {
+    StageStatistics::Measurement measurement(statistics, 100, 1600, 5.0);
+    measurement.finish(50, 800);
+    // Finishing twice does not count the message twice
+    measurement.finish(50, 800);
+  }
+  {
+    // A message which is not finished is counted as rejected
+    StageStatistics::Measurement measurement(statistics, 100, 1600, 5.0);
+  }
+
+  const auto summary = statistics->take();
+  EXPECT_EQ(summary.messages, 1u);
+  EXPECT_EQ(summary.rejected_messages, 1u);
+  EXPECT_EQ(summary.input_points, 100u);
+  EXPECT_EQ(summary.output_points, 50u);
+  EXPECT_NEAR(summary.queueing_delay_ms_mean, 5.0, EPSILON);
+  EXPECT_GE(summary.processing_time_ms_max, 0.0);
+}
+
+TEST(FilterStatisticsTest, Registry)
+{
+  auto & registry = FilterStatisticsRegistry::instance();
+  auto first = registry.add_stage("first");
+  auto second = registry.add_stage("second");
+
+  // The oldest stage alive reports all the stages
+  EXPECT_TRUE(registry.is_reporter(first.get()));
+  EXPECT_FALSE(registry.is_reporter(second.get()));
+
+  first->add(10, 160, 10, 160, 1.0, 1.0);
+  auto summaries = registry.take_all();
+  ASSERT_EQ(summaries.size(), 2u);
+  EXPECT_EQ(summaries.at(0).name, "first");
+  EXPECT_EQ(summaries.at(0).messages, 1u);
+  EXPECT_EQ(summaries.at(1).name, "second");
+  EXPECT_EQ(summaries.at(1).messages, 0u);
+
+  // The released stage is removed and the next one takes over the reporting
+  first.reset();
+  EXPECT_TRUE(registry.is_reporter(second.get()));
+  summaries = registry.take_all();
+  ASSERT_EQ(summaries.size(), 1u);
+  EXPECT_EQ(summaries.at(0).name, "second");
+}
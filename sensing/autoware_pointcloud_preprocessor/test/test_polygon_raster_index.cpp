@@ -0,0 +1,123 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/utility/polygon_raster_index.hpp"
+
+#include <Eigen/Core>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::utils::PolygonRasterIndex;
+using Polygon = std::vector<Eigen::Vector2d>;
+
+// even-odd test of the interior of a polygon
+bool is_within_polygon(const Polygon & polygon, double x, double y)
+{
+  bool within = false;
+  for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+    const auto & a = polygon[i];
+    const auto & b = polygon[j];
+    if ((a.y() > y) != (b.y() > y) && x < (b.x() - a.x()) * (y - a.y()) / (b.y() - a.y()) + a.x()) {
+      within = !within;
+    }
+  }
+  return within;
+}
+
+std::vector<Polygon> make_polygons()
+{
+  std::vector<Polygon> polygons;
+  // axis aligned square, aligned with the cells
+  polygons.push_back({{0.0, 0.0}, {4.0, 0.0}, {4.0, 4.0}, {0.0, 4.0}});
+  // rotated rectangle
+  polygons.push_back({{10.0, 2.0}, {17.0, 9.0}, {15.5, 10.5}, {8.5, 3.5}});
+  // concave polygon
+  polygons.push_back({{-8.0, -8.0}, {-1.0, -8.0}, {-1.0, -1.0}, {-4.0, -5.0}, {-8.0, -1.0}});
+  // thin triangle, narrower than a cell
+  polygons.push_back({{-10.0, 10.0}, {10.0, 10.3}, {-10.0, 10.6}});
+  // polygon partially out of the tile
+  polygons.push_back({{15.0, -15.0}, {30.0, -15.0}, {30.0, -5.0}, {15.0, -5.0}});
+  // degenerate polygon
+  polygons.push_back({{0.0, -12.0}, {1.0, -12.0}});
+  return polygons;
+}
+
+TEST(PolygonRasterIndexTest, MatchesExactTest)
+{
+  const auto polygons = make_polygons();
+  PolygonRasterIndex raster_index;
+  raster_index.build(polygons, -20.0, -20.0, 20.0, 20.0, 0.5);
+  EXPECT_TRUE(raster_index.covers(-20.0, -20.0, 19.9, 19.9));
+  EXPECT_FALSE(raster_index.covers(-20.0, -20.0, 25.0, 19.9));
+
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> dist(-25.0, 25.0);
+  for (int i = 0; i < 200000; ++i) {
+    const double x = dist(rng);
+    const double y = dist(rng);
+    bool expected = false;
+    for (const auto & polygon : polygons) {
+      if (polygon.size() >= 3 && is_within_polygon(polygon, x, y)) expected = true;
+    }
+    const bool actual = raster_index.is_within(x, y, [&](uint32_t polygon_index) {
+      const auto & polygon = polygons[polygon_index];
+      return polygon.size() >= 3 && is_within_polygon(polygon, x, y);
+    });
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST(PolygonRasterIndexTest, SkipsExactTestInsideAndOutside)
+{
+  const auto polygons = make_polygons();
+  PolygonRasterIndex raster_index;
+  raster_index.build(polygons, -20.0, -20.0, 20.0, 20.0, 0.5);
+
+  int num_exact_tests = 0;
+  const auto count_exact_tests = [&](uint32_t) {
+    ++num_exact_tests;
+    return false;
+  };
+  // center of the square
+  EXPECT_TRUE(raster_index.is_within(2.0, 2.0, count_exact_tests));
+  // far from every polygon
+  EXPECT_FALSE(raster_index.is_within(5.0, -18.0, count_exact_tests));
+  EXPECT_EQ(num_exact_tests, 0);
+
+  // out of the tile, every polygon is tested
+  EXPECT_FALSE(raster_index.is_within(100.0, 100.0, count_exact_tests));
+  EXPECT_EQ(num_exact_tests, static_cast<int>(polygons.size()));
+}
+
+TEST(PolygonRasterIndexTest, Clear)
+{
+  PolygonRasterIndex raster_index;
+  EXPECT_TRUE(raster_index.empty());
+  raster_index.build(make_polygons(), -20.0, -20.0, 20.0, 20.0, 0.5);
+  EXPECT_FALSE(raster_index.empty());
+  raster_index.clear();
+  EXPECT_TRUE(raster_index.empty());
+  EXPECT_FALSE(raster_index.covers(0.0, 0.0, 1.0, 1.0));
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,76 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/utility/radius_search_2d_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::utils::Point2d;
+using autoware::pointcloud_preprocessor::utils::RadiusSearch2dGrid;
+
+size_t count_neighbors_brute_force(
+  const std::vector<Point2d> & points, const Point2d & query, float radius)
+{
+  size_t count = 0;
+  for (const auto & p : points) {
+    const float diff_x = p.x - query.x;
+    const float diff_y = p.y - query.y;
+    if (diff_x * diff_x + diff_y * diff_y <= radius * radius) ++count;
+  }
+  return count;
+}
+
+TEST(RadiusSearch2dGridTest, MatchesBruteForce)
+{
+  constexpr float radius = 0.7f;
+  std::mt19937 rng(0);
+  // a dense cluster and sparse points, in the negative and positive coordinates
+  std::uniform_real_distribution<float> dense_dist(-2.0f, 2.0f);
+  std::uniform_real_distribution<float> sparse_dist(-50.0f, 50.0f);
+  std::vector<Point2d> points;
+  for (int i = 0; i < 2000; ++i) {
+    points.push_back({dense_dist(rng), dense_dist(rng)});
+    points.push_back({sparse_dist(rng), sparse_dist(rng)});
+  }
+
+  RadiusSearch2dGrid grid;
+  grid.build(points, radius);
+  for (const auto & p : points) {
+    const size_t expected = count_neighbors_brute_force(points, p, radius);
+    EXPECT_EQ(grid.count_neighbors(p.x, p.y, std::numeric_limits<size_t>::max()), expected);
+    EXPECT_EQ(grid.count_neighbors(p.x, p.y, 3), std::min<size_t>(expected, 3));
+  }
+}
+
+TEST(RadiusSearch2dGridTest, IgnoresNonFinitePoints)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const std::vector<Point2d> points{{0.0f, 0.0f}, {nan, 0.0f}, {0.1f, 0.1f}};
+  RadiusSearch2dGrid grid;
+  grid.build(points, 1.0f);
+  EXPECT_EQ(grid.count_neighbors(0.0f, 0.0f, 10), 2U);
+  EXPECT_EQ(grid.count_neighbors(nan, 0.0f, 10), 0U);
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
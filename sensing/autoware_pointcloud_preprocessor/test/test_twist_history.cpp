@@ -0,0 +1,162 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/utility/twist_history.hpp"
+
+#include <Eigen/Geometry>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::utils::TwistHistory;
+
+constexpr double EPSILON = 1e-4;
+
+struct TwistSample
+{
+  double stamp;
+  double linear_x;
+  double angular_z;
+};
+
+// Integrates the twists one by one between the two stamps
+Eigen::Matrix4f compute_reference_transform(
+  const std::vector<TwistSample> & twists, double old_stamp, double new_stamp)
+{
+  if (twists.empty() || old_stamp > new_stamp) {
+    return Eigen::Matrix4f::Identity();
+  }
+  const auto lower_bound = [&twists](double t) {
+    auto it = std::lower_bound(
+      twists.begin(), twists.end(), t,
+      [](const TwistSample & twist, double t) { return twist.stamp < t; });
+    return it == twists.end() ? twists.end() - 1 : it;
+  };
+  const auto old_it = lower_bound(old_stamp);
+  const auto new_it = lower_bound(new_stamp);
+
+  double prev_time = old_stamp;
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (auto it = old_it; it != new_it + 1; ++it) {
+    const double dt = (it != new_it) ? it->stamp - prev_time : new_stamp - prev_time;
+    if (std::fabs(dt) > 0.1) break;
+    const double dis = it->linear_x * dt;
+    yaw += it->angular_z * dt;
+    x += dis * std::cos(yaw);
+    y += dis * std::sin(yaw);
+    prev_time = it->stamp;
+  }
+  Eigen::AngleAxisf rotation_z(yaw, Eigen::Vector3f::UnitZ());
+  Eigen::Translation3f translation(x, y, 0);
+  return (translation * rotation_z).matrix();
+}
+
+void expect_matrix_near(const Eigen::Matrix4f & actual, const Eigen::Matrix4f & expected)
+{
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      EXPECT_NEAR(actual(i, j), expected(i, j), EPSILON);
+    }
+  }
+}
+
+TEST(TwistHistoryTest, EmptyHistoryReturnsIdentity)
+{
+  TwistHistory history;
+  bool is_step_too_long = false;
+  const auto transform = history.compute_transform_to_adjust_for_old_timestamp(
+    rclcpp::Time(10, 0), rclcpp::Time(11, 0), is_step_too_long);
+  expect_matrix_near(transform, Eigen::Matrix4f::Identity());
+  EXPECT_FALSE(is_step_too_long);
+}
+
+TEST(TwistHistoryTest, OldStampNewerThanNewStampReturnsIdentity)
+{
+  TwistHistory history;
+  history.add_twist(rclcpp::Time(10, 0), 10.0, 0.1);
+  bool is_step_too_long = false;
+  const auto transform = history.compute_transform_to_adjust_for_old_timestamp(
+    rclcpp::Time(10, 50'000'000), rclcpp::Time(10, 0), is_step_too_long);
+  expect_matrix_near(transform, Eigen::Matrix4f::Identity());
+}
+
+TEST(TwistHistoryTest, MatchesStepByStepIntegration)
+{
+  TwistHistory history;
+  std::vector<TwistSample> twists;
+  // 500 Hz twist with a varying velocity and a single 0.2 s dropout
+  double stamp = 100.0;
+  for (int i = 0; i < 400; ++i) {
+    stamp += (i == 300) ? 0.2 : 0.002;
+    const TwistSample twist{stamp, 10.0 + std::sin(0.05 * i), 0.3 * std::cos(0.02 * i)};
+    twists.push_back(twist);
+    history.add_twist(
+      rclcpp::Time(static_cast<int64_t>(std::llround(stamp * 1e9))), twist.linear_x,
+      twist.angular_z);
+  }
+  ASSERT_EQ(history.size(), twists.size());
+
+  const double first_stamp = twists.front().stamp;
+  for (int i = 0; i < 60; ++i) {
+    const double old_stamp = first_stamp - 0.01 + 0.0137 * i;
+    for (const double duration : {0.0, 0.0011, 0.03, 0.09, 0.25}) {
+      const double new_stamp = old_stamp + duration;
+      bool is_step_too_long = false;
+      const auto transform = history.compute_transform_to_adjust_for_old_timestamp(
+        rclcpp::Time(static_cast<int64_t>(std::llround(old_stamp * 1e9))),
+        rclcpp::Time(static_cast<int64_t>(std::llround(new_stamp * 1e9))), is_step_too_long);
+      expect_matrix_near(transform, compute_reference_transform(twists, old_stamp, new_stamp));
+    }
+  }
+}
+
+TEST(TwistHistoryTest, StopsBeforeLongStep)
+{
+  TwistHistory history;
+  history.add_twist(rclcpp::Time(10, 0), 1.0, 0.0);
+  history.add_twist(rclcpp::Time(10, 50'000'000), 1.0, 0.0);
+  history.add_twist(rclcpp::Time(10, 500'000'000), 1.0, 0.0);
+  history.add_twist(rclcpp::Time(10, 550'000'000), 1.0, 0.0);
+
+  bool is_step_too_long = false;
+  const auto transform = history.compute_transform_to_adjust_for_old_timestamp(
+    rclcpp::Time(10, 0), rclcpp::Time(10, 540'000'000), is_step_too_long);
+  EXPECT_TRUE(is_step_too_long);
+  EXPECT_NEAR(transform(0, 3), 0.05, EPSILON);
+  EXPECT_NEAR(transform(1, 3), 0.0, EPSILON);
+}
+
+TEST(TwistHistoryTest, DropsOldAndRestartedTwists)
+{
+  TwistHistory history(1.0, 0.1);
+  history.add_twist(rclcpp::Time(10, 0), 1.0, 0.0);
+  history.add_twist(rclcpp::Time(10, 500'000'000), 1.0, 0.0);
+  history.add_twist(rclcpp::Time(11, 0), 1.0, 0.0);
+  EXPECT_EQ(history.size(), 2u);
+
+  // rosbag restart
+  history.add_twist(rclcpp::Time(5, 0), 1.0, 0.0);
+  EXPECT_EQ(history.size(), 1u);
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
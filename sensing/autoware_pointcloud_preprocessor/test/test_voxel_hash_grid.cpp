@@ -0,0 +1,106 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_hash_grid.hpp"
+
+#include <gtest/gtest.h>
+
+using autoware::pointcloud_preprocessor::CentroidReducer;
+using autoware::pointcloud_preprocessor::CountThresholdReducer;
+using autoware::pointcloud_preprocessor::FirstPointReducer;
+using autoware::pointcloud_preprocessor::VoxelHashGrid;
+using autoware::pointcloud_preprocessor::VoxelKey;
+
+constexpr float EPSILON = 1e-5;
+
+TEST(VoxelHashGridTest, NegativeCoordinatesAreFloored)
+{
+  VoxelHashGrid<CountThresholdReducer> voxel_grid;
+  voxel_grid.set_voxel_size(0.5f, 0.5f, 0.5f);
+
+  EXPECT_EQ(voxel_grid.get_voxel_key(0.1f, 0.6f, 1.1f), (VoxelKey{0, 1, 2}));
+  EXPECT_EQ(voxel_grid.get_voxel_key(-0.1f, -0.6f, -1.1f), (VoxelKey{-1, -2, -3}));
+}
+
+TEST(VoxelHashGridTest, CentroidReducerAveragesPoints)
+{
+  VoxelHashGrid<CentroidReducer> voxel_grid;
+  voxel_grid.set_voxel_size(1.0f, 1.0f, 1.0f);
+
+  voxel_grid.add_point(0.2f, 0.2f, 0.2f, 0.2f, 0.2f, 0.2f, 10.0f);
+  voxel_grid.add_point(0.8f, 0.4f, 0.6f, 0.8f, 0.4f, 0.6f, 20.0f);
+  voxel_grid.add_point(5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 5.5f, 30.0f);
+  ASSERT_EQ(voxel_grid.size(), 2U);
+
+  const auto * state = voxel_grid.find(0.5f, 0.5f, 0.5f);
+  ASSERT_NE(state, nullptr);
+  const Eigen::Vector4f centroid = state->calc_centroid();
+  EXPECT_NEAR(centroid[0], 0.5f, EPSILON);
+  EXPECT_NEAR(centroid[1], 0.3f, EPSILON);
+  EXPECT_NEAR(centroid[2], 0.4f, EPSILON);
+  EXPECT_NEAR(centroid[3], 15.0f, EPSILON);
+}
+
+TEST(VoxelHashGridTest, FirstPointReducerKeepsFirstOffset)
+{
+  VoxelHashGrid<FirstPointReducer> voxel_grid;
+  voxel_grid.set_voxel_size(1.0f, 1.0f, 1.0f);
+
+  voxel_grid.add_point(0.1f, 0.1f, 0.1f, static_cast<std::size_t>(16));
+  voxel_grid.add_point(0.9f, 0.9f, 0.9f, static_cast<std::size_t>(32));
+
+  const auto * state = voxel_grid.find(0.5f, 0.5f, 0.5f);
+  ASSERT_NE(state, nullptr);
+  EXPECT_EQ(*state, 16U);
+}
+
+TEST(VoxelHashGridTest, CountThresholdReducerCountsPoints)
+{
+  VoxelHashGrid<CountThresholdReducer> voxel_grid;
+  voxel_grid.set_voxel_size(1.0f, 1.0f, 1.0f);
+
+  for (int i = 0; i < 3; ++i) {
+    voxel_grid.add_point(0.5f, 0.5f, 0.5f);
+  }
+  voxel_grid.add_point(2.5f, 0.5f, 0.5f);
+
+  const auto * dense = voxel_grid.find(0.5f, 0.5f, 0.5f);
+  const auto * sparse = voxel_grid.find(2.5f, 0.5f, 0.5f);
+  ASSERT_NE(dense, nullptr);
+  ASSERT_NE(sparse, nullptr);
+  EXPECT_TRUE(CountThresholdReducer::reached(*dense, 3));
+  EXPECT_FALSE(CountThresholdReducer::reached(*sparse, 3));
+  EXPECT_EQ(voxel_grid.find(10.0f, 10.0f, 10.0f), nullptr);
+
+  voxel_grid.clear();
+  EXPECT_EQ(voxel_grid.size(), 0U);
+}
+
+TEST(VoxelHashGridTest, LargeExtentDoesNotOverflow)
+{
+  // A flattened index over this extent would exceed the int32 range
+  VoxelHashGrid<CountThresholdReducer> voxel_grid;
+  voxel_grid.set_voxel_size(0.01f, 0.01f, 0.01f);
+
+  voxel_grid.add_point(-1000.0f, -1000.0f, -100.0f);
+  voxel_grid.add_point(1000.0f, 1000.0f, 100.0f);
+  EXPECT_EQ(voxel_grid.size(), 2U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
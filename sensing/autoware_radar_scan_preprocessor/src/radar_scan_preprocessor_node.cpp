@@ -0,0 +1,329 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "radar_scan_preprocessor_node.hpp"
+
+#include <geometry_msgs/msg/vector3.hpp>
+#include <geometry_msgs/msg/vector3_stamped.hpp>
+
+#include <pcl_conversions/pcl_conversions.h>
+#include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+template <class T>
+bool update_param(
+  const std::vector<rclcpp::Parameter> & params, const std::string & name, T & value)
+{
+  const auto itr = std::find_if(
+    params.cbegin(), params.cend(),
+    [&name](const rclcpp::Parameter & p) { return p.get_name() == name; });
+
+  // Not found
+  if (itr == params.cend()) {
+    return false;
+  }
+
+  value = itr->template get_value<T>();
+  return true;
+}
+
+bool isWithin(double value, double max, double min)
+{
+  return min < value && value < max;
+}
+
+template <class T>
+bool hasSubscriber(const typename rclcpp::Publisher<T>::SharedPtr & publisher)
+{
+  return publisher->get_subscription_count() + publisher->get_intra_process_subscription_count() >
+         0;
+}
+
+geometry_msgs::msg::Vector3 getVelocity(const radar_msgs::msg::RadarReturn & radar)
+{
+  return geometry_msgs::build<geometry_msgs::msg::Vector3>()
+    .x(radar.doppler_velocity * std::cos(radar.azimuth))
+    .y(radar.doppler_velocity * std::sin(radar.azimuth))
+    .z(0.0);
+}
+
+pcl::PointXYZI getPointXYZI(const radar_msgs::msg::RadarReturn & radar, float intensity)
+{
+  pcl::PointXYZI point;
+  const float r_xy = radar.range * std::cos(radar.elevation);
+  point.x = r_xy * std::cos(radar.azimuth);
+  point.y = r_xy * std::sin(radar.azimuth);
+  point.z = radar.range * std::sin(radar.elevation);
+  point.intensity = intensity;
+  return point;
+}
+}  // namespace
+
+namespace autoware::radar_scan_preprocessor
+{
+using std::placeholders::_1;
+using std::placeholders::_2;
+
+RadarScanPreprocessorNode::RadarScanPreprocessorNode(const rclcpp::NodeOptions & node_options)
+: Node("radar_scan_preprocessor", node_options)
+{
+  // Parameter Server
+  set_param_res_ = this->add_on_set_parameters_callback(
+    std::bind(&RadarScanPreprocessorNode::onSetParam, this, _1));
+
+  // Node Parameter
+  {
+    auto & p = node_param_.threshold_filter;
+    p.enable = declare_parameter<bool>("threshold_filter.enable");
+    p.is_amplitude_filter = declare_parameter<bool>("threshold_filter.is_amplitude_filter");
+    p.amplitude_min = declare_parameter<double>("threshold_filter.amplitude_min");
+    p.amplitude_max = declare_parameter<double>("threshold_filter.amplitude_max");
+    p.is_range_filter = declare_parameter<bool>("threshold_filter.is_range_filter");
+    p.range_min = declare_parameter<double>("threshold_filter.range_min");
+    p.range_max = declare_parameter<double>("threshold_filter.range_max");
+    p.is_azimuth_filter = declare_parameter<bool>("threshold_filter.is_azimuth_filter");
+    p.azimuth_min = declare_parameter<double>("threshold_filter.azimuth_min");
+    p.azimuth_max = declare_parameter<double>("threshold_filter.azimuth_max");
+    p.is_z_filter = declare_parameter<bool>("threshold_filter.is_z_filter");
+    p.z_min = declare_parameter<double>("threshold_filter.z_min");
+    p.z_max = declare_parameter<double>("threshold_filter.z_max");
+  }
+  node_param_.static_filter.enable = declare_parameter<bool>("static_filter.enable");
+  node_param_.static_filter.doppler_velocity_sd =
+    declare_parameter<double>("static_filter.doppler_velocity_sd");
+  node_param_.publish_amplitude_pointcloud =
+    declare_parameter<bool>("publish_amplitude_pointcloud");
+  node_param_.publish_doppler_pointcloud = declare_parameter<bool>("publish_doppler_pointcloud");
+
+  // Subscriber
+  // odometry is only needed by the static pointcloud filter
+  if (node_param_.static_filter.enable) {
+    transform_listener_ = std::make_shared<autoware::universe_utils::TransformListener>(this);
+
+    sub_synchronized_radar_.subscribe(this, "~/input/radar", rclcpp::QoS{1}.get_rmw_qos_profile());
+    sub_odometry_.subscribe(this, "~/input/odometry", rclcpp::QoS{1}.get_rmw_qos_profile());
+
+    sync_ptr_ = std::make_shared<Sync>(SyncPolicy(10), sub_synchronized_radar_, sub_odometry_);
+    sync_ptr_->registerCallback(std::bind(&RadarScanPreprocessorNode::onData, this, _1, _2));
+  } else {
+    sub_radar_ = create_subscription<RadarScan>(
+      "~/input/radar", rclcpp::QoS{1}, std::bind(&RadarScanPreprocessorNode::onRadar, this, _1));
+  }
+
+  // Publisher
+  pub_radar_ = create_publisher<RadarScan>("~/output/radar", 1);
+  pub_static_radar_ = create_publisher<RadarScan>("~/output/static_radar_scan", 1);
+  pub_dynamic_radar_ = create_publisher<RadarScan>("~/output/dynamic_radar_scan", 1);
+  {
+    rclcpp::PublisherOptions pub_options;
+    pub_options.qos_overriding_options = rclcpp::QosOverridingOptions::with_default_policies();
+    pub_amplitude_pointcloud_ =
+      create_publisher<PointCloud2>("~/output/amplitude_pointcloud", 1, pub_options);
+    pub_doppler_pointcloud_ =
+      create_publisher<PointCloud2>("~/output/doppler_pointcloud", 1, pub_options);
+  }
+}
+
+rcl_interfaces::msg::SetParametersResult RadarScanPreprocessorNode::onSetParam(
+  const std::vector<rclcpp::Parameter> & params)
+{
+  rcl_interfaces::msg::SetParametersResult result;
+  try {
+    {
+      auto & p = node_param_.threshold_filter;
+      update_param(params, "threshold_filter.enable", p.enable);
+      update_param(params, "threshold_filter.is_amplitude_filter", p.is_amplitude_filter);
+      update_param(params, "threshold_filter.amplitude_min", p.amplitude_min);
+      update_param(params, "threshold_filter.amplitude_max", p.amplitude_max);
+      update_param(params, "threshold_filter.is_range_filter", p.is_range_filter);
+      update_param(params, "threshold_filter.range_min", p.range_min);
+      update_param(params, "threshold_filter.range_max", p.range_max);
+      update_param(params, "threshold_filter.is_azimuth_filter", p.is_azimuth_filter);
+      update_param(params, "threshold_filter.azimuth_min", p.azimuth_min);
+      update_param(params, "threshold_filter.azimuth_max", p.azimuth_max);
+      update_param(params, "threshold_filter.is_z_filter", p.is_z_filter);
+      update_param(params, "threshold_filter.z_min", p.z_min);
+      update_param(params, "threshold_filter.z_max", p.z_max);
+    }
+    // static_filter.enable changes the subscriptions, so it is only read at startup
+    update_param(
+      params, "static_filter.doppler_velocity_sd", node_param_.static_filter.doppler_velocity_sd);
+    update_param(params, "publish_amplitude_pointcloud", node_param_.publish_amplitude_pointcloud);
+    update_param(params, "publish_doppler_pointcloud", node_param_.publish_doppler_pointcloud);
+  } catch (const rclcpp::exceptions::InvalidParameterTypeException & e) {
+    result.successful = false;
+    result.reason = e.what();
+    return result;
+  }
+  result.successful = true;
+  result.reason = "success";
+  return result;
+}
+
+void RadarScanPreprocessorNode::onRadar(const RadarScan::ConstSharedPtr radar_msg)
+{
+  process(*radar_msg, nullptr, nullptr);
+}
+
+void RadarScanPreprocessorNode::onData(
+  const RadarScan::ConstSharedPtr radar_msg, const Odometry::ConstSharedPtr odom_msg)
+{
+  TransformStamped::ConstSharedPtr transform;
+
+  try {
+    transform = transform_listener_->getTransform(
+      odom_msg->header.frame_id, radar_msg->header.frame_id, odom_msg->header.stamp,
+      rclcpp::Duration::from_seconds(0.2));
+  } catch (tf2::TransformException & ex) {
+    RCLCPP_INFO(this->get_logger(), "Could not transform");
+    return;
+  }
+
+  process(*radar_msg, odom_msg, transform);
+}
+
+void RadarScanPreprocessorNode::process(
+  const RadarScan & radar_msg, const Odometry::ConstSharedPtr & odom_msg,
+  const TransformStamped::ConstSharedPtr & transform)
+{
+  // label every return once, so that each output is built with a single pass and without
+  // intermediate messages
+  return_labels_.resize(radar_msg.returns.size());
+  for (size_t i = 0; i < radar_msg.returns.size(); ++i) {
+    const auto & radar_return = radar_msg.returns[i];
+    if (node_param_.threshold_filter.enable && !isWithinThreshold(radar_return)) {
+      return_labels_[i] = ReturnLabel::REMOVED;
+    } else if (odom_msg && transform && isStaticPointcloud(radar_return, *odom_msg, *transform)) {
+      return_labels_[i] = ReturnLabel::STATIC;
+    } else {
+      return_labels_[i] = ReturnLabel::DYNAMIC;
+    }
+  }
+
+  publishRadarScan(radar_msg, ReturnLabel::DYNAMIC, ReturnLabel::STATIC, pub_radar_);
+  if (node_param_.static_filter.enable) {
+    publishRadarScan(radar_msg, ReturnLabel::STATIC, ReturnLabel::STATIC, pub_static_radar_);
+    publishRadarScan(radar_msg, ReturnLabel::DYNAMIC, ReturnLabel::DYNAMIC, pub_dynamic_radar_);
+  }
+
+  // the pointclouds are made of the dynamic returns when the static filter is enabled, and of all
+  // the remaining returns otherwise
+  if (node_param_.publish_amplitude_pointcloud) {
+    publishPointcloud(radar_msg, ReturnLabel::DYNAMIC, false, pub_amplitude_pointcloud_);
+  }
+  if (node_param_.publish_doppler_pointcloud) {
+    publishPointcloud(radar_msg, ReturnLabel::DYNAMIC, true, pub_doppler_pointcloud_);
+  }
+}
+
+void RadarScanPreprocessorNode::publishRadarScan(
+  const RadarScan & radar_msg, const ReturnLabel min_label, const ReturnLabel max_label,
+  const rclcpp::Publisher<RadarScan>::SharedPtr & publisher)
+{
+  // skip building the message when nobody listens to it
+  if (!hasSubscriber<RadarScan>(publisher)) {
+    return;
+  }
+
+  const auto is_selected = [min_label, max_label](const ReturnLabel label) {
+    return min_label <= label && label <= max_label;
+  };
+
+  auto output = std::make_unique<RadarScan>();
+  output->header = radar_msg.header;
+  output->returns.reserve(std::count_if(return_labels_.begin(), return_labels_.end(), is_selected));
+  for (size_t i = 0; i < radar_msg.returns.size(); ++i) {
+    if (is_selected(return_labels_[i])) {
+      output->returns.push_back(radar_msg.returns[i]);
+    }
+  }
+  publisher->publish(std::move(output));
+}
+
+void RadarScanPreprocessorNode::publishPointcloud(
+  const RadarScan & radar_msg, const ReturnLabel label, const bool use_doppler_velocity,
+  const rclcpp::Publisher<PointCloud2>::SharedPtr & publisher)
+{
+  pointcloud_buffer_.clear();
+  for (size_t i = 0; i < radar_msg.returns.size(); ++i) {
+    if (return_labels_[i] != label) {
+      continue;
+    }
+    const auto & radar_return = radar_msg.returns[i];
+    pointcloud_buffer_.push_back(getPointXYZI(
+      radar_return,
+      use_doppler_velocity ? radar_return.doppler_velocity : radar_return.amplitude));
+  }
+
+  auto output = std::make_unique<PointCloud2>();
+  pcl::toROSMsg(pointcloud_buffer_, *output);
+  output->header = radar_msg.header;
+  publisher->publish(std::move(output));
+}
+
+bool RadarScanPreprocessorNode::isWithinThreshold(const RadarReturn & radar_return) const
+{
+  const auto & p = node_param_.threshold_filter;
+  if (
+    p.is_amplitude_filter && !isWithin(radar_return.amplitude, p.amplitude_max, p.amplitude_min)) {
+    return false;
+  }
+
+  if (p.is_range_filter && !isWithin(radar_return.range, p.range_max, p.range_min)) {
+    return false;
+  }
+
+  if (p.is_azimuth_filter && !isWithin(radar_return.azimuth, p.azimuth_max, p.azimuth_min)) {
+    return false;
+  }
+
+  if (p.is_z_filter) {
+    const auto z = radar_return.range * std::sin(radar_return.elevation);
+    if (!isWithin(z, p.z_max, p.z_min)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool RadarScanPreprocessorNode::isStaticPointcloud(
+  const RadarReturn & radar_return, const Odometry & odom_msg,
+  const TransformStamped & transform) const
+{
+  geometry_msgs::msg::Vector3Stamped velocity_stamped{};
+  velocity_stamped.vector = getVelocity(radar_return);
+  geometry_msgs::msg::Vector3Stamped transformed_velocity_stamped{};
+  tf2::doTransform(velocity_stamped, transformed_velocity_stamped, transform);
+
+  // compensate the ego vehicle twist
+  const auto & v_e = odom_msg.twist.twist.linear;
+  const double compensated_velocity_x = transformed_velocity_stamped.vector.x + v_e.x;
+
+  const double doppler_velocity_sd = node_param_.static_filter.doppler_velocity_sd;
+  return (-doppler_velocity_sd < compensated_velocity_x) &&
+         (compensated_velocity_x < doppler_velocity_sd);
+}
+
+}  // namespace autoware::radar_scan_preprocessor
+
+#include "rclcpp_components/register_node_macro.hpp"
+RCLCPP_COMPONENTS_REGISTER_NODE(autoware::radar_scan_preprocessor::RadarScanPreprocessorNode)
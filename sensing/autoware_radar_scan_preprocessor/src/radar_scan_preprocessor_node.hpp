@@ -0,0 +1,143 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RADAR_SCAN_PREPROCESSOR_NODE_HPP_
+#define RADAR_SCAN_PREPROCESSOR_NODE_HPP_
+
+#include "autoware/universe_utils/ros/transform_listener.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <geometry_msgs/msg/transform_stamped.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <radar_msgs/msg/radar_scan.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <message_filters/subscriber.h>
+#include <message_filters/sync_policies/approximate_time.h>
+#include <message_filters/synchronizer.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace autoware::radar_scan_preprocessor
+{
+using geometry_msgs::msg::TransformStamped;
+using nav_msgs::msg::Odometry;
+using radar_msgs::msg::RadarReturn;
+using radar_msgs::msg::RadarScan;
+using sensor_msgs::msg::PointCloud2;
+
+/**
+ * Runs the threshold filter, the static pointcloud filter and the conversion to PointCloud2 of a
+ * radar scan in a single callback. Each stage behaves as the corresponding standalone node.
+ */
+class RadarScanPreprocessorNode : public rclcpp::Node
+{
+public:
+  explicit RadarScanPreprocessorNode(const rclcpp::NodeOptions & node_options);
+
+  struct ThresholdFilterParam
+  {
+    bool enable{};
+    bool is_amplitude_filter{};
+    double amplitude_min{};
+    double amplitude_max{};
+    bool is_range_filter{};
+    double range_min{};
+    double range_max{};
+    bool is_azimuth_filter{};
+    double azimuth_min{};
+    double azimuth_max{};
+    bool is_z_filter{};
+    double z_min{};
+    double z_max{};
+  };
+
+  struct StaticFilterParam
+  {
+    bool enable{};
+    double doppler_velocity_sd{};
+  };
+
+  struct NodeParam
+  {
+    ThresholdFilterParam threshold_filter{};
+    StaticFilterParam static_filter{};
+    bool publish_amplitude_pointcloud{};
+    bool publish_doppler_pointcloud{};
+  };
+
+private:
+  enum class ReturnLabel : uint8_t { REMOVED, DYNAMIC, STATIC };
+
+  // Subscriber
+  rclcpp::Subscription<RadarScan>::SharedPtr sub_radar_{};
+  message_filters::Subscriber<RadarScan> sub_synchronized_radar_{};
+  message_filters::Subscriber<Odometry> sub_odometry_{};
+  std::shared_ptr<autoware::universe_utils::TransformListener> transform_listener_;
+
+  using SyncPolicy = message_filters::sync_policies::ApproximateTime<RadarScan, Odometry>;
+  using Sync = message_filters::Synchronizer<SyncPolicy>;
+  typename std::shared_ptr<Sync> sync_ptr_;
+
+  // Callback
+  void onRadar(const RadarScan::ConstSharedPtr radar_msg);
+  void onData(const RadarScan::ConstSharedPtr radar_msg, const Odometry::ConstSharedPtr odom_msg);
+
+  // Publisher
+  rclcpp::Publisher<RadarScan>::SharedPtr pub_radar_{};
+  rclcpp::Publisher<RadarScan>::SharedPtr pub_static_radar_{};
+  rclcpp::Publisher<RadarScan>::SharedPtr pub_dynamic_radar_{};
+  rclcpp::Publisher<PointCloud2>::SharedPtr pub_amplitude_pointcloud_{};
+  rclcpp::Publisher<PointCloud2>::SharedPtr pub_doppler_pointcloud_{};
+
+  // Parameter Server
+  OnSetParametersCallbackHandle::SharedPtr set_param_res_;
+  rcl_interfaces::msg::SetParametersResult onSetParam(
+    const std::vector<rclcpp::Parameter> & params);
+
+  // Data buffer, reused across frames
+  std::vector<ReturnLabel> return_labels_;
+  pcl::PointCloud<pcl::PointXYZI> pointcloud_buffer_;
+
+  // Parameter
+  NodeParam node_param_{};
+
+  // Function
+  void process(
+    const RadarScan & radar_msg, const Odometry::ConstSharedPtr & odom_msg,
+    const TransformStamped::ConstSharedPtr & transform);
+  void publishRadarScan(
+    const RadarScan & radar_msg, const ReturnLabel min_label, const ReturnLabel max_label,
+    const rclcpp::Publisher<RadarScan>::SharedPtr & publisher);
+  void publishPointcloud(
+    const RadarScan & radar_msg, const ReturnLabel label, const bool use_doppler_velocity,
+    const rclcpp::Publisher<PointCloud2>::SharedPtr & publisher);
+
+public:
+  bool isWithinThreshold(const RadarReturn & radar_return) const;
+  bool isStaticPointcloud(
+    const RadarReturn & radar_return, const Odometry & odom_msg,
+    const TransformStamped & transform) const;
+};
+
+}  // namespace autoware::radar_scan_preprocessor
+
+#endif  // RADAR_SCAN_PREPROCESSOR_NODE_HPP_
@@ -0,0 +1,144 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/radar_scan_preprocessor_node.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <radar_msgs/msg/radar_scan.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+
+using autoware::radar_scan_preprocessor::RadarScanPreprocessorNode;
+using geometry_msgs::msg::TransformStamped;
+using nav_msgs::msg::Odometry;
+using radar_msgs::msg::RadarReturn;
+
+std::shared_ptr<RadarScanPreprocessorNode> createNode(
+  const bool is_amplitude_filter, const bool is_range_filter, const bool is_azimuth_filter,
+  const bool is_z_filter)
+{
+  rclcpp::NodeOptions node_options;
+  node_options.parameter_overrides({
+    {"threshold_filter.enable", true},
+    {"threshold_filter.is_amplitude_filter", is_amplitude_filter},
+    {"threshold_filter.amplitude_min", -10.0},
+    {"threshold_filter.amplitude_max", 100.0},
+    {"threshold_filter.is_range_filter", is_range_filter},
+    {"threshold_filter.range_min", 20.0},
+    {"threshold_filter.range_max", 300.0},
+    {"threshold_filter.is_azimuth_filter", is_azimuth_filter},
+    {"threshold_filter.azimuth_min", -1.2},
+    {"threshold_filter.azimuth_max", 1.2},
+    {"threshold_filter.is_z_filter", is_z_filter},
+    {"threshold_filter.z_min", -2.0},
+    {"threshold_filter.z_max", 5.0},
+    {"static_filter.enable", false},
+    {"static_filter.doppler_velocity_sd", 4.0},
+    {"publish_amplitude_pointcloud", true},
+    {"publish_doppler_pointcloud", false},
+  });
+  return std::make_shared<RadarScanPreprocessorNode>(node_options);
+}
+
+TEST(RadarScanPreprocessor, isWithinThreshold)
+{
+  // amplitude filter
+  {
+    const auto node = createNode(true, false, false, false);
+    RadarReturn radar_return;
+    radar_return.amplitude = -100.0;
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+    radar_return.amplitude = 0.0;
+    EXPECT_TRUE(node->isWithinThreshold(radar_return));
+    radar_return.amplitude = 1000.0;
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+  }
+
+  // range filter
+  {
+    const auto node = createNode(false, true, false, false);
+    RadarReturn radar_return;
+    radar_return.range = 0.0;
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+    radar_return.range = 100.0;
+    EXPECT_TRUE(node->isWithinThreshold(radar_return));
+    radar_return.range = 1000.0;
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+  }
+
+  // azimuth filter
+  {
+    const auto node = createNode(false, false, true, false);
+    RadarReturn radar_return;
+    radar_return.azimuth = -10.0;
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+    radar_return.azimuth = 0.0;
+    EXPECT_TRUE(node->isWithinThreshold(radar_return));
+    radar_return.azimuth = 10.0;
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+  }
+
+  // z filter
+  {
+    const auto node = createNode(false, false, false, true);
+    RadarReturn radar_return;
+    radar_return.range = 100.0;
+    radar_return.elevation = std::asin(-10.0 / 100.0);
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+    radar_return.elevation = 0.0;
+    EXPECT_TRUE(node->isWithinThreshold(radar_return));
+    radar_return.elevation = std::asin(10.0 / 100.0);
+    EXPECT_FALSE(node->isWithinThreshold(radar_return));
+  }
+}
+
+TEST(RadarScanPreprocessor, isStaticPointcloud)
+{
+  const auto node = createNode(false, false, false, false);
+
+  TransformStamped transform;
+  transform.transform.rotation.w = 1.0;
+  Odometry odometry;
+  odometry.twist.twist.linear.x = 10.0;
+
+  RadarReturn radar_return;
+  radar_return.azimuth = 0.0;
+  // a static object approaches at the ego velocity
+  radar_return.doppler_velocity = -10.0;
+  EXPECT_TRUE(node->isStaticPointcloud(radar_return, odometry, transform));
+  // an object moving ahead at the ego velocity
+  radar_return.doppler_velocity = 0.0;
+  EXPECT_FALSE(node->isStaticPointcloud(radar_return, odometry, transform));
+
+  // with the radar facing backward, a static object goes away at the ego velocity
+  transform.transform.rotation.z = 1.0;
+  transform.transform.rotation.w = 0.0;
+  radar_return.doppler_velocity = 10.0;
+  EXPECT_TRUE(node->isStaticPointcloud(radar_return, odometry, transform));
+  radar_return.doppler_velocity = -10.0;
+  EXPECT_FALSE(node->isStaticPointcloud(radar_return, odometry, transform));
+}
+
+int main(int argc, char * argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  bool result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
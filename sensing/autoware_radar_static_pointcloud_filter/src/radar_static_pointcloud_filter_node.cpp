@@ -56,7 +56,7 @@ geometry_msgs::msg::Vector3 getTransformedVelocity(
   velocity_stamped.vector = velocity;
   geometry_msgs::msg::Vector3Stamped transformed_velocity_stamped{};
   tf2::doTransform(velocity_stamped, transformed_velocity_stamped, *transform);
-  return velocity_stamped.vector;
+  return transformed_velocity_stamped.vector;
 }
 
 geometry_msgs::msg::Vector3 compensateEgoVehicleTwist(
@@ -206,44 +206,38 @@ class carla_ros2_interface(object):
             PointField(name="channel", offset=14, datatype=PointField.UINT16, count=1),
         ]
 
+        # The points are converted with whole array operations into the layout of the fields, so
+        # that the message data is copied once from it
         lidar_data = numpy.frombuffer(
             carla_lidar_measurement.raw_data, dtype=numpy.float32
         ).reshape(-1, 4)
-        intensity = lidar_data[:, 3]
-        intensity = (
-            numpy.clip(intensity, 0, 1) * 255
-        )  # CARLA lidar intensity values are between 0 and 1
-        intensity = intensity.astype(numpy.uint8).reshape(-1, 1)
-
-        return_type = numpy.zeros((lidar_data.shape[0], 1), dtype=numpy.uint8)
-        channel = numpy.empty((0, 1), dtype=numpy.uint16)
-        self.channels = self.sensors["sensors"]
-
-        for i in range(self.channels[1]["channels"]):
-            current_ring_points_count = carla_lidar_measurement.get_point_count(i)
-            channel = numpy.vstack(
-                (channel, numpy.full((current_ring_points_count, 1), i, dtype=numpy.uint16))
-            )
-
-        lidar_data = numpy.hstack((lidar_data[:, :3], intensity, return_type, channel))
-        lidar_data[:, 1] *= -1
 
         dtype = [
-            ("x", "f4"),
-            ("y", "f4"),
-            ("z", "f4"),
+            ("x", "<f4"),
+            ("y", "<f4"),
+            ("z", "<f4"),
             ("intensity", "u1"),
             ("return_type", "u1"),
-            ("channel", "u2"),
+            ("channel", "<u2"),
         ]
 
-        structured_lidar_data = numpy.zeros(lidar_data.shape[0], dtype=dtype)
+        structured_lidar_data = numpy.empty(lidar_data.shape[0], dtype=dtype)
         structured_lidar_data["x"] = lidar_data[:, 0]
-        structured_lidar_data["y"] = lidar_data[:, 1]
+        structured_lidar_data["y"] = -lidar_data[:, 1]
         structured_lidar_data["z"] = lidar_data[:, 2]
-        structured_lidar_data["intensity"] = lidar_data[:, 3].astype(numpy.uint8)
-        structured_lidar_data["return_type"] = lidar_data[:, 4].astype(numpy.uint8)
-        structured_lidar_data["channel"] = lidar_data[:, 5].astype(numpy.uint16)
+        # CARLA lidar intensity values are between 0 and 1
+        structured_lidar_data["intensity"] = numpy.clip(lidar_data[:, 3], 0, 1) * 255
+        structured_lidar_data["return_type"] = 0
+
+        # The points are ordered by channel
+        self.channels = self.sensors["sensors"]
+        num_channels = self.channels[1]["channels"]
+        ring_points_counts = [
+            carla_lidar_measurement.get_point_count(i) for i in range(num_channels)
+        ]
+        structured_lidar_data["channel"] = numpy.repeat(
+            numpy.arange(num_channels, dtype=numpy.uint16), ring_points_counts
+        )
 
         point_cloud_msg = create_cloud(header, fields, structured_lidar_data)
         self.pub_lidar[id_].publish(point_cloud_msg)
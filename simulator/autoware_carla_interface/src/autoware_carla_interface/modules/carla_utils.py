@@ -1,3 +1,4 @@
+import array
 import ctypes
 import math
 import struct
@@ -6,6 +7,7 @@ import sys
 import carla
 from geometry_msgs.msg import Point
 from geometry_msgs.msg import Quaternion
+import numpy
 from sensor_msgs.msg import PointCloud2
 from sensor_msgs.msg import PointField
 from transforms3d.euler import euler2quat
@@ -48,15 +50,20 @@ def create_cloud(header, fields, points):
     """Create a L{sensor_msgs.msg.PointCloud2} message with different datatype (Modified create_cloud function)."""
     cloud_struct = struct.Struct(_get_struct_fmt(False, fields))
 
-    buff = ctypes.create_string_buffer(cloud_struct.size * len(points))
+    if isinstance(points, numpy.ndarray) and points.dtype.itemsize == cloud_struct.size:
+        # The structured array already has the layout of the fields
+        buff = points.tobytes()
+    else:
+        packed_buff = ctypes.create_string_buffer(cloud_struct.size * len(points))
 
-    point_step, pack_into = cloud_struct.size, cloud_struct.pack_into
-    offset = 0
-    for p in points:
-        pack_into(buff, offset, *p)
-        offset += point_step
+        point_step, pack_into = cloud_struct.size, cloud_struct.pack_into
+        offset = 0
+        for p in points:
+            pack_into(packed_buff, offset, *p)
+            offset += point_step
+        buff = packed_buff.raw
 
-    return PointCloud2(
+    cloud = PointCloud2(
         header=header,
         height=1,
         width=len(points),
@@ -65,8 +72,12 @@ def create_cloud(header, fields, points):
         fields=fields,
         point_step=cloud_struct.size,
         row_step=cloud_struct.size * len(points),
-        data=buff.raw,
     )
+    # Set the data as an array, as the message checks the bytes given otherwise one by one
+    data = array.array("B")
+    data.frombytes(buff)
+    cloud.data = data
+    return cloud
 
 
 def carla_location_to_ros_point(carla_location):
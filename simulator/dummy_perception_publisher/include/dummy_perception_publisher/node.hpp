@@ -15,6 +15,8 @@
 #ifndef DUMMY_PERCEPTION_PUBLISHER__NODE_HPP_
 #define DUMMY_PERCEPTION_PUBLISHER__NODE_HPP_
 
+#include "dummy_perception_publisher/ray_casting.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_perception_msgs/msg/detected_objects.hpp>
@@ -97,7 +99,7 @@ private:
 class EgoCentricPointCloudCreator : public PointCloudCreator
 {
 public:
-  explicit EgoCentricPointCloudCreator(double visible_range) : visible_range_(visible_range) {}
+  explicit EgoCentricPointCloudCreator(double visible_range);
   std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> create_pointclouds(
     const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
     std::mt19937 & random_generator,
@@ -105,6 +107,7 @@ public:
 
 private:
   double visible_range_;
+  ray_casting::HorizontalRayCaster ray_caster_;
 };
 
 class DummyPerceptionPublisherNode : public rclcpp::Node
@@ -0,0 +1,73 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DUMMY_PERCEPTION_PUBLISHER__RAY_CASTING_HPP_
+#define DUMMY_PERCEPTION_PUBLISHER__RAY_CASTING_HPP_
+
+#include <tf2/LinearMath/Transform.h>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace ray_casting
+{
+
+// 2D box seen from the sensor at the origin
+struct Box
+{
+  Box(double length, double width, const tf2::Transform & tf_sensor_to_box);
+  double center_x;
+  double center_y;
+  double cos_yaw;
+  double sin_yaw;
+  double half_length;
+  double half_width;
+};
+
+// Casts the horizontal beams of a fixed pattern from the origin against many boxes at once.
+// Instead of marching every beam against every box, each box is rasterized into the beams
+// covering its angular extent, so the cost grows with the number of beams hitting the boxes.
+class HorizontalRayCaster
+{
+public:
+  static constexpr size_t no_hit = std::numeric_limits<size_t>::max();
+
+  // beam i points to first_angle + i * angle_step
+  HorizontalRayCaster(size_t num_beams, double first_angle, double angle_step);
+
+  // find the nearest box hit by each beam within max_range, whose distance is infinity and box
+  // index is no_hit if the beam hit nothing
+  void cast(
+    const std::vector<Box> & boxes, double max_range, std::vector<double> & distances,
+    std::vector<size_t> & box_indices) const;
+
+  size_t size() const { return cos_angles_.size(); }
+  double cos_angle(size_t beam) const { return cos_angles_.at(beam); }
+  double sin_angle(size_t beam) const { return sin_angles_.at(beam); }
+
+private:
+  void castBox(
+    const Box & box, size_t box_index, double max_range, std::vector<double> & distances,
+    std::vector<size_t> & box_indices) const;
+
+  double first_angle_;
+  double angle_step_;
+  std::vector<double> cos_angles_;
+  std::vector<double> sin_angles_;
+};
+
+}  // namespace ray_casting
+
+#endif  // DUMMY_PERCEPTION_PUBLISHER__RAY_CASTING_HPP_
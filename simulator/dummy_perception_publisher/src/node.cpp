@@ -216,21 +216,20 @@ void DummyPerceptionPublisherNode::timerCallback()
 
   std::vector<size_t> selected_indices{};
   std::vector<ObjectInfo> obj_infos;
+  obj_infos.reserve(objects_.size());
   static std::uniform_real_distribution<> detection_successful_random(0.0, 1.0);
   for (size_t i = 0; i < objects_.size(); ++i) {
     if (detection_successful_rate_ >= detection_successful_random(random_generator_)) {
       selected_indices.push_back(i);
     }
-    const auto obj_info = ObjectInfo(objects_.at(i), current_time);
-    obj_infos.push_back(obj_info);
+    obj_infos.emplace_back(objects_.at(i), current_time);
   }
 
   // publish ground truth
   // add Tracked Object
   if (publish_ground_truth_objects_) {
-    for (auto object : objects_) {
-      const auto object_info = ObjectInfo(object, current_time);
-      TrackedObject gt_tracked_object = object_info.toTrackedObject(object);
+    for (size_t i = 0; i < objects_.size(); ++i) {
+      TrackedObject gt_tracked_object = obj_infos.at(i).toTrackedObject(objects_.at(i));
       gt_tracked_object.existence_probability = 1.0;
       output_ground_truth_objects_msg.objects.push_back(gt_tracked_object);
     }
@@ -251,7 +250,7 @@ void DummyPerceptionPublisherNode::timerCallback()
   if (!selected_indices.empty()) {
     std::vector<ObjectInfo> detected_obj_infos;
     for (const auto selected_idx : selected_indices) {
-      const auto detected_obj_info = ObjectInfo(objects_.at(selected_idx), current_time);
+      const auto & detected_obj_info = obj_infos.at(selected_idx);
       tf2::toMsg(detected_obj_info.tf_map2moved_object, output_moved_object_pose.pose);
       detected_obj_infos.push_back(detected_obj_info);
     }
@@ -264,7 +263,7 @@ void DummyPerceptionPublisherNode::timerCallback()
       const auto pointcloud = pointclouds[i];
       const size_t selected_idx = selected_indices[i];
       const auto & object = objects_.at(selected_idx);
-      const auto object_info = ObjectInfo(object, current_time);
+      const auto & object_info = obj_infos.at(selected_idx);
       // dynamic object
       std::normal_distribution<> x_random(0.0, object_info.std_dev_x);
       std::normal_distribution<> y_random(0.0, object_info.std_dev_y);
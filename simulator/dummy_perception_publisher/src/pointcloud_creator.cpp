@@ -13,7 +13,7 @@
 // limitations under the License.
 
 #include "dummy_perception_publisher/node.hpp"
-#include "dummy_perception_publisher/signed_distance_function.hpp"
+#include "dummy_perception_publisher/ray_casting.hpp"
 
 #include <pcl/impl/point_types.hpp>
 
@@ -24,6 +24,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -44,6 +45,20 @@ pcl::PointXYZ getPointWrtBaseLink(
   return pcl::PointXYZ(p_wrt_base.x(), p_wrt_base.y(), p_wrt_base.z());
 }
 
+// tangents of the vertical beams, which are shared by all the horizontal beams
+const std::vector<double> & getVerticalTanTemplate()
+{
+  static const std::vector<double> vertical_tans = [] {
+    std::vector<double> tans;
+    for (double vertical_theta = vertical_min_theta; vertical_theta <= vertical_max_theta + epsilon;
+         vertical_theta += vertical_theta_step) {
+      tans.push_back(std::tan(vertical_theta));
+    }
+    return tans;
+  }();
+  return vertical_tans;
+}
+
 }  // namespace
 
 void ObjectCentricPointCloudCreator::create_object_pointcloud(
@@ -122,9 +137,8 @@ void ObjectCentricPointCloudCreator::create_object_pointcloud(
       const double distance = std::hypot(
         horizontal_candidate_pointcloud.at(pointcloud_index).x,
         horizontal_candidate_pointcloud.at(pointcloud_index).y);
-      for (double vertical_theta = vertical_min_theta;
-           vertical_theta <= vertical_max_theta + epsilon; vertical_theta += vertical_theta_step) {
-        const double z = distance * std::tan(vertical_theta);
+      for (const double vertical_tan : getVerticalTanTemplate()) {
+        const double z = distance * vertical_tan;
         if (min_z <= z && z <= max_z + epsilon) {
           pcl::PointXYZ point;
           point.x =
@@ -195,64 +209,70 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> ObjectCentricPointCloudCreator:
   return pointclouds;
 }
 
+EgoCentricPointCloudCreator::EgoCentricPointCloudCreator(double visible_range)
+: visible_range_(visible_range),
+  ray_caster_(
+    static_cast<size_t>(std::floor(2 * M_PI / horizontal_theta_step)), horizontal_theta_step,
+    horizontal_theta_step)
+{
+}
+
 std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::create_pointclouds(
   const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
   std::mt19937 & random_generator, pcl::PointCloud<pcl::PointXYZ>::Ptr & merged_pointcloud) const
 {
-  std::vector<std::shared_ptr<signed_distance_function::AbstractSignedDistanceFunction>> sdf_ptrs;
-  for (const auto & obj_info : obj_infos) {
-    const auto sdf_ptr = std::make_shared<signed_distance_function::BoxSDF>(
-      obj_info.length, obj_info.width, tf_base_link2map * obj_info.tf_map2moved_object);
-    sdf_ptrs.push_back(sdf_ptr);
-  }
-  const auto composite_sdf = signed_distance_function::CompositeSDF(sdf_ptrs);
-
+  std::vector<ray_casting::Box> boxes;
+  boxes.reserve(obj_infos.size());
   std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> pointclouds(obj_infos.size());
-  for (size_t i = 0; i < obj_infos.size(); ++i) {
-    pointclouds.at(i) = (pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>));
-  }
-
   std::vector<double> min_zs(obj_infos.size());
   std::vector<double> max_zs(obj_infos.size());
 
   for (size_t idx = 0; idx < obj_infos.size(); ++idx) {
     const auto & obj_info = obj_infos.at(idx);
     const auto tf_base_link2moved_object = tf_base_link2map * obj_info.tf_map2moved_object;
-    const double min_z = -1.0 * (obj_info.height / 2.0) + tf_base_link2moved_object.getOrigin().z();
-    const double max_z = 1.0 * (obj_info.height / 2.0) + tf_base_link2moved_object.getOrigin().z();
-    min_zs.at(idx) = min_z;
-    max_zs.at(idx) = max_z;
+    boxes.emplace_back(obj_info.length, obj_info.width, tf_base_link2moved_object);
+    pointclouds.at(idx) = (pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>));
+    min_zs.at(idx) = -1.0 * (obj_info.height / 2.0) + tf_base_link2moved_object.getOrigin().z();
+    max_zs.at(idx) = 1.0 * (obj_info.height / 2.0) + tf_base_link2moved_object.getOrigin().z();
   }
 
-  double angle = 0.0;
-  const auto n_scan = static_cast<size_t>(std::floor(2 * M_PI / horizontal_theta_step));
-  for (size_t i = 0; i < n_scan; ++i) {
-    angle += horizontal_theta_step;
-    const auto dist = composite_sdf.getSphereTracingDist(0.0, 0.0, angle, visible_range_);
+  // all the beams are cast at once, and each beam knows the object it hit
+  std::vector<double> distances;
+  std::vector<size_t> box_indices;
+  ray_caster_.cast(boxes, visible_range_, distances, box_indices);
 
-    if (std::isfinite(dist)) {
-      const auto x_hit = dist * cos(angle);
-      const auto y_hit = dist * sin(angle);
-      const auto idx_hit = composite_sdf.nearest_sdf_index(x_hit, y_hit);
-      const auto obj_info_here = obj_infos.at(idx_hit);
-      const auto min_z_here = min_zs.at(idx_hit);
-      const auto max_z_here = max_zs.at(idx_hit);
-      std::normal_distribution<> x_random(0.0, obj_info_here.std_dev_x);
-      std::normal_distribution<> y_random(0.0, obj_info_here.std_dev_y);
-      std::normal_distribution<> z_random(0.0, obj_info_here.std_dev_z);
+  const auto & vertical_tans = getVerticalTanTemplate();
+  for (size_t i = 0; i < ray_caster_.size(); ++i) {
+    const auto idx_hit = box_indices.at(i);
+    if (idx_hit == ray_casting::HorizontalRayCaster::no_hit) {
+      continue;
+    }
 
-      for (double vertical_theta = vertical_min_theta;
-           vertical_theta <= vertical_max_theta + epsilon; vertical_theta += vertical_theta_step) {
-        const double z = dist * std::tan(vertical_theta);
-        if (min_z_here <= z && z <= max_z_here + epsilon) {
-          pointclouds.at(idx_hit)->push_back(pcl::PointXYZ(
-            x_hit + x_random(random_generator), y_hit + y_random(random_generator),
-            z + z_random(random_generator)));
-        }
+    const auto dist = distances.at(i);
+    const auto x_hit = dist * ray_caster_.cos_angle(i);
+    const auto y_hit = dist * ray_caster_.sin_angle(i);
+    const auto & obj_info_here = obj_infos.at(idx_hit);
+    const auto min_z_here = min_zs.at(idx_hit);
+    const auto max_z_here = max_zs.at(idx_hit);
+    std::normal_distribution<> x_random(0.0, obj_info_here.std_dev_x);
+    std::normal_distribution<> y_random(0.0, obj_info_here.std_dev_y);
+    std::normal_distribution<> z_random(0.0, obj_info_here.std_dev_z);
+
+    for (const double vertical_tan : vertical_tans) {
+      const double z = dist * vertical_tan;
+      if (min_z_here <= z && z <= max_z_here + epsilon) {
+        pointclouds.at(idx_hit)->push_back(pcl::PointXYZ(
+          x_hit + x_random(random_generator), y_hit + y_random(random_generator),
+          z + z_random(random_generator)));
       }
     }
   }
 
+  size_t num_points = merged_pointcloud->size();
+  for (const auto & cloud : pointclouds) {
+    num_points += cloud->size();
+  }
+  merged_pointcloud->reserve(num_points);
   for (const auto & cloud : pointclouds) {
     for (const auto & pt : *cloud) {
       merged_pointcloud->push_back(pt);
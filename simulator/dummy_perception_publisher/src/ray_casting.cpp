@@ -0,0 +1,148 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dummy_perception_publisher/ray_casting.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ray_casting
+{
+namespace
+{
+double normalizeAngle(double angle)
+{
+  angle = std::fmod(angle + M_PI, 2.0 * M_PI);
+  return angle < 0.0 ? angle + M_PI : angle - M_PI;
+}
+
+// clip the ray parameter range by the slab |origin + t * direction| <= half_size
+bool clipBySlab(
+  const double origin, const double direction, const double half_size, double & t_min,
+  double & t_max)
+{
+  if (std::abs(direction) < 1e-12) {
+    return std::abs(origin) <= half_size;
+  }
+  const double t1 = (-half_size - origin) / direction;
+  const double t2 = (half_size - origin) / direction;
+  t_min = std::max(t_min, std::min(t1, t2));
+  t_max = std::min(t_max, std::max(t1, t2));
+  return t_min <= t_max;
+}
+}  // namespace
+
+Box::Box(double length, double width, const tf2::Transform & tf_sensor_to_box)
+: center_x(tf_sensor_to_box.getOrigin().x()),
+  center_y(tf_sensor_to_box.getOrigin().y()),
+  half_length(0.5 * length),
+  half_width(0.5 * width)
+{
+  const auto & basis = tf_sensor_to_box.getBasis();
+  const double yaw = std::atan2(basis[1][0], basis[0][0]);
+  cos_yaw = std::cos(yaw);
+  sin_yaw = std::sin(yaw);
+}
+
+HorizontalRayCaster::HorizontalRayCaster(
+  size_t num_beams, double first_angle, double angle_step)
+: first_angle_(first_angle), angle_step_(angle_step)
+{
+  cos_angles_.resize(num_beams);
+  sin_angles_.resize(num_beams);
+  for (size_t i = 0; i < num_beams; ++i) {
+    const double angle = first_angle + static_cast<double>(i) * angle_step;
+    cos_angles_.at(i) = std::cos(angle);
+    sin_angles_.at(i) = std::sin(angle);
+  }
+}
+
+void HorizontalRayCaster::cast(
+  const std::vector<Box> & boxes, double max_range, std::vector<double> & distances,
+  std::vector<size_t> & box_indices) const
+{
+  distances.assign(size(), std::numeric_limits<double>::infinity());
+  box_indices.assign(size(), no_hit);
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    castBox(boxes.at(i), i, max_range, distances, box_indices);
+  }
+}
+
+void HorizontalRayCaster::castBox(
+  const Box & box, size_t box_index, double max_range, std::vector<double> & distances,
+  std::vector<size_t> & box_indices) const
+{
+  const auto num_beams = static_cast<int64_t>(size());
+  if (num_beams == 0) {
+    return;
+  }
+
+  // skip the box out of range
+  const double center_range = std::hypot(box.center_x, box.center_y);
+  if (center_range - std::hypot(box.half_length, box.half_width) > max_range) {
+    return;
+  }
+
+  // the sensor in the box frame, which must be outside of the box
+  const double origin_x = -(box.cos_yaw * box.center_x + box.sin_yaw * box.center_y);
+  const double origin_y = box.sin_yaw * box.center_x - box.cos_yaw * box.center_y;
+  if (std::abs(origin_x) <= box.half_length && std::abs(origin_y) <= box.half_width) {
+    return;
+  }
+
+  // angular extent of the box, which is less than pi since the sensor is outside of the box
+  const double center_angle = std::atan2(box.center_y, box.center_x);
+  double min_offset = std::numeric_limits<double>::infinity();
+  double max_offset = -std::numeric_limits<double>::infinity();
+  for (const double sign_x : {-1.0, 1.0}) {
+    for (const double sign_y : {-1.0, 1.0}) {
+      const double local_x = sign_x * box.half_length;
+      const double local_y = sign_y * box.half_width;
+      const double corner_x = box.center_x + box.cos_yaw * local_x - box.sin_yaw * local_y;
+      const double corner_y = box.center_y + box.sin_yaw * local_x + box.cos_yaw * local_y;
+      const double offset = normalizeAngle(std::atan2(corner_y, corner_x) - center_angle);
+      min_offset = std::min(min_offset, offset);
+      max_offset = std::max(max_offset, offset);
+    }
+  }
+
+  const auto first_beam = static_cast<int64_t>(
+    std::ceil((center_angle + min_offset - first_angle_) / angle_step_));
+  const auto last_beam = std::min(
+    static_cast<int64_t>(std::floor((center_angle + max_offset - first_angle_) / angle_step_)),
+    first_beam + num_beams - 1);
+  for (int64_t beam = first_beam; beam <= last_beam; ++beam) {
+    const auto i = static_cast<size_t>(((beam % num_beams) + num_beams) % num_beams);
+
+    // intersection of the beam and the box in the box frame
+    const double direction_x = box.cos_yaw * cos_angles_[i] + box.sin_yaw * sin_angles_[i];
+    const double direction_y = -box.sin_yaw * cos_angles_[i] + box.cos_yaw * sin_angles_[i];
+    double t_min = 0.0;
+    double t_max = max_range;
+    if (
+      !clipBySlab(origin_x, direction_x, box.half_length, t_min, t_max) ||
+      !clipBySlab(origin_y, direction_y, box.half_width, t_min, t_max)) {
+      continue;
+    }
+    if (t_min < distances[i]) {
+      distances[i] = t_min;
+      box_indices[i] = box_index;
+    }
+  }
+}
+
+}  // namespace ray_casting
@@ -0,0 +1,115 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dummy_perception_publisher/ray_casting.hpp"
+
+#include <gtest/gtest.h>
+#include <tf2/LinearMath/Quaternion.h>
+#include <tf2/LinearMath/Transform.h>
+#include <tf2/LinearMath/Vector3.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+ray_casting::Box createBox(double length, double width, double x, double y, double yaw)
+{
+  const auto q = tf2::Quaternion(tf2::Vector3(0, 0, 1.0), yaw);
+  return ray_casting::Box(length, width, tf2::Transform(q, tf2::Vector3(x, y, 0.0)));
+}
+}  // namespace
+
+TEST(RayCastingTest, HitNearestBox)
+{
+  const double eps = 1e-5;
+  const size_t num_beams = 360;
+  const double step = 2.0 * M_PI / static_cast<double>(num_beams);
+  const ray_casting::HorizontalRayCaster caster(num_beams, -M_PI, step);
+  const size_t front_beam = num_beams / 2;
+  const size_t left_beam = 3 * num_beams / 4;
+  const size_t rear_beam = 0;
+
+  // the second box is hidden behind the first one, and the third one rotated by 90 deg is on the
+  // left, whose near side is at 3.0 m
+  const std::vector<ray_casting::Box> boxes{
+    createBox(2.0, 1.0, 5.0, 0.0, 0.0), createBox(2.0, 4.0, 10.0, 0.0, 0.0),
+    createBox(2.0, 1.0, 0.0, 4.0, M_PI * 0.5)};
+  std::vector<double> distances;
+  std::vector<size_t> box_indices;
+  caster.cast(boxes, 100.0, distances, box_indices);
+
+  ASSERT_EQ(distances.size(), num_beams);
+  ASSERT_EQ(box_indices.size(), num_beams);
+  EXPECT_NEAR(distances.at(front_beam), 4.0, eps);
+  EXPECT_EQ(box_indices.at(front_beam), 0u);
+  EXPECT_NEAR(distances.at(left_beam), 3.0, eps);
+  EXPECT_EQ(box_indices.at(left_beam), 2u);
+  EXPECT_TRUE(std::isinf(distances.at(rear_beam)));
+  EXPECT_EQ(box_indices.at(rear_beam), ray_casting::HorizontalRayCaster::no_hit);
+
+  // the second box is visible beside the first one
+  size_t num_second_box_beams = 0;
+  for (size_t i = 0; i < num_beams; ++i) {
+    if (box_indices.at(i) == 1u) {
+      ++num_second_box_beams;
+      EXPECT_NEAR(distances.at(i) * caster.cos_angle(i), 9.0, eps);
+    }
+  }
+  EXPECT_GT(num_second_box_beams, 0u);
+}
+
+TEST(RayCastingTest, BoxAcrossBeamWrap)
+{
+  const double eps = 1e-5;
+  const size_t num_beams = 3600;
+  const double step = 2.0 * M_PI / static_cast<double>(num_beams);
+  const ray_casting::HorizontalRayCaster caster(num_beams, step, step);
+
+  // the box behind the sensor covers the beams around +-pi, and the one in front of the sensor
+  // covers the first and last beams
+  const std::vector<ray_casting::Box> boxes{
+    createBox(1.0, 2.0, -5.0, 0.0, 0.0), createBox(1.0, 2.0, 5.0, 0.0, 0.0)};
+  std::vector<double> distances;
+  std::vector<size_t> box_indices;
+  caster.cast(boxes, 100.0, distances, box_indices);
+
+  for (const size_t i : {num_beams / 2 - 2, num_beams / 2 - 1, num_beams / 2}) {
+    EXPECT_EQ(box_indices.at(i), 0u);
+    EXPECT_NEAR(distances.at(i) * -caster.cos_angle(i), 4.5, eps);
+  }
+  for (const size_t i : {size_t{0}, num_beams - 2, num_beams - 1}) {
+    EXPECT_EQ(box_indices.at(i), 1u);
+    EXPECT_NEAR(distances.at(i) * caster.cos_angle(i), 4.5, eps);
+  }
+}
+
+TEST(RayCastingTest, IgnoreBoxOutOfRange)
+{
+  const size_t num_beams = 360;
+  const double step = 2.0 * M_PI / static_cast<double>(num_beams);
+  const ray_casting::HorizontalRayCaster caster(num_beams, -M_PI, step);
+
+  // the first box is out of range, and the sensor is in the second box
+  const std::vector<ray_casting::Box> boxes{
+    createBox(2.0, 1.0, 50.0, 0.0, 0.0), createBox(4.0, 2.0, 0.5, 0.0, 0.0)};
+  std::vector<double> distances;
+  std::vector<size_t> box_indices;
+  caster.cast(boxes, 20.0, distances, box_indices);
+
+  for (size_t i = 0; i < num_beams; ++i) {
+    EXPECT_TRUE(std::isinf(distances.at(i)));
+    EXPECT_EQ(box_indices.at(i), ray_casting::HorizontalRayCaster::no_hit);
+  }
+}
@@ -0,0 +1,116 @@
+// Copyright 2024 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LEARNING_BASED_VEHICLE_MODEL__SIMPLE_ONNX_MODEL_HPP_
+#define LEARNING_BASED_VEHICLE_MODEL__SIMPLE_ONNX_MODEL_HPP_
+
+#include "learning_based_vehicle_model/model_connections_helpers.hpp"
+#include "learning_based_vehicle_model/submodel_interface.hpp"
+
+#include <onnxruntime_cxx_api.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * @class SimpleOnnxModel
+ * @brief This class runs a sub-model exported to ONNX natively with ONNX Runtime, without the
+ * python interpreter.
+ *
+ * The model takes the float or double tensors "action" of [batch, actions] and "state" of
+ * [batch, states], and optionally "dt" of [1], and its first output is the next state of
+ * [batch, states]. The names of the actions and the states are stored comma separated in the
+ * "action_names" and "state_names" metadata of the model.
+ */
+class SimpleOnnxModel : public SubModelInterface
+{
+private:
+  Ort::Env env;
+  Ort::Session session{nullptr};
+  Ort::MemoryInfo memory_info{nullptr};
+
+  bool has_dt_input = false;
+  bool use_double = false;
+  double dt = 0.0;
+
+  std::vector<std::string> onnx_model_input_name_strings;
+  std::vector<std::string> onnx_model_state_name_strings;
+  std::vector<char *> onnx_model_input_names;
+  std::vector<char *> onnx_model_state_names;
+
+  std::vector<int> map_sig_vec_to_onnx_model_inputs;  // index in "map_sig_vec_to_onnx_model_inputs"
+                                                      // is index in "onnx_inputs" and value is
+                                                      // index in "signals_vec_names"
+  std::vector<int> map_onnx_model_outputs_to_sig_vec;  // index in
+                                                       // "map_onnx_model_outputs_to_sig_vec" is
+                                                       // index in "onnx_model_outputs" and value
+                                                       // is index in "signals_vec_names"
+
+  template <typename T>
+  std::vector<std::vector<double>> getNextStatesAs(
+    const std::vector<std::vector<double>> & model_signals_vecs,
+    std::vector<std::vector<double>> model_signals_vecs_next);
+
+public:
+  /**
+   * @brief constructor
+   * @param [in] onnx_model_path path to the ONNX model
+   */
+  explicit SimpleOnnxModel(const std::string & onnx_model_path);
+
+  /**
+   * @brief calculate the next state of the ONNX model
+   * @param [in] model_signals_vec all available inputs from PSIM
+   */
+  std::vector<double> getNextState(
+    std::vector<double> model_signals_vec, std::vector<double> model_signals_vec_next) override;
+
+  /**
+   * @brief calculate the next states of the ONNX model for a batch of vehicles in a single run
+   * @param [in] model_signals_vecs all available inputs from PSIM of each vehicle
+   */
+  std::vector<std::vector<double>> getNextStates(
+    const std::vector<std::vector<double>> & model_signals_vecs,
+    std::vector<std::vector<double>> model_signals_vecs_next) override;
+
+  /**
+   * @brief set time step of the model
+   * @param [in] dt time step
+   */
+  void dtSet(double dt) override;
+
+  /**
+   * @brief get names of inputs of the ONNX model
+   */
+  std::vector<char *> getInputNames() override;
+
+  /**
+   * @brief get names of states of the ONNX model
+   */
+  std::vector<char *> getStateNames() override;
+
+  /**
+   * @brief create a map from model signal vector to the ONNX model inputs
+   * @param [in] signal_vec_names names of signals in model signal vector
+   */
+  void mapInputs(std::vector<char *> signals_vec_names) override;
+
+  /**
+   * @brief create a map from the ONNX model outputs to model signal vector
+   * @param [in] signal_vec_names names of signals in model signal vector
+   */
+  void mapOutputs(std::vector<char *> signals_vec_names) override;
+};
+
+#endif  // LEARNING_BASED_VEHICLE_MODEL__SIMPLE_ONNX_MODEL_HPP_
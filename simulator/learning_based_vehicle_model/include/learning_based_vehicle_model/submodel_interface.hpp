@@ -20,6 +20,8 @@
 class SubModelInterface
 {
 public:
+  virtual ~SubModelInterface() = default;
+
   /**
    * @brief set time step of the model
    * @param [in] dt time step
@@ -55,6 +57,24 @@ public:
    */
   virtual std::vector<double> getNextState(
     std::vector<double> model_signals_vec, std::vector<double> model_signals_vec_next) = 0;
+
+  /**
+   * @brief calculate the next states of this submodule for a batch of vehicles, one by one unless
+   * the model steps the batch at once
+   * @param [in] model_signals_vecs values of signals in model signal vector of each vehicle
+   * @param [in] model_signals_vecs_next values of signals in model signal vector to update of each
+   * vehicle
+   */
+  virtual std::vector<std::vector<double>> getNextStates(
+    const std::vector<std::vector<double>> & model_signals_vecs,
+    std::vector<std::vector<double>> model_signals_vecs_next)
+  {
+    for (size_t BATCH_IDX = 0; BATCH_IDX < model_signals_vecs.size(); BATCH_IDX++) {
+      model_signals_vecs_next[BATCH_IDX] =
+        getNextState(model_signals_vecs[BATCH_IDX], model_signals_vecs_next[BATCH_IDX]);
+    }
+    return model_signals_vecs_next;
+  }
 };
 
 #endif  // LEARNING_BASED_VEHICLE_MODEL__SUBMODEL_INTERFACE_HPP_
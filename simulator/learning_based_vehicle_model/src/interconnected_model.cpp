@@ -14,6 +14,12 @@
 
 #include "learning_based_vehicle_model/interconnected_model.hpp"
 
+#ifdef LEARNING_BASED_VEHICLE_MODEL_USE_ONNXRUNTIME
+#include "learning_based_vehicle_model/simple_onnx_model.hpp"
+#endif
+
+#include <stdexcept>
+
 void InterconnectedModel::mapInputs(std::vector<char *> in_names)
 {
   // index in "map_in_to_sig_vec" is index in "in_names" and value in "map_in_to_sig_vec" is index
@@ -75,6 +81,22 @@ void InterconnectedModel::addSubmodel(
   std::tuple<std::string, std::string, std::string> submodel_desc)
 {
   const auto [lib_path, param_path, class_name] = submodel_desc;
+
+  // A sub-model exported to ONNX runs natively without the python interpreter
+  const std::string onnx_extension = ".onnx";
+  const bool is_onnx_model =
+    lib_path.size() >= onnx_extension.size() &&
+    lib_path.compare(lib_path.size() - onnx_extension.size(), std::string::npos, onnx_extension) ==
+      0;
+  if (is_onnx_model) {
+#ifdef LEARNING_BASED_VEHICLE_MODEL_USE_ONNXRUNTIME
+    submodels.push_back(std::make_unique<SimpleOnnxModel>(lib_path));
+    return;
+#else
+    throw std::runtime_error("ONNX sub-model is given but ONNX Runtime is not available");
+#endif
+  }
+
   auto new_model = new SimplePyModel(lib_path, param_path, class_name);
   submodels.push_back(std::unique_ptr<SimplePyModel>(new_model));
 }
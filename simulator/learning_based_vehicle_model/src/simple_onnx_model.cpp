@@ -0,0 +1,197 @@
+// Copyright 2024 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "learning_based_vehicle_model/simple_onnx_model.hpp"
+
+#include <array>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> getNamesFromMetadata(
+  const Ort::ModelMetadata & metadata, const char * key)
+{
+  Ort::AllocatorWithDefaultOptions allocator;
+  const auto value = metadata.LookupCustomMetadataMapAllocated(key, allocator);
+  if (!value) {
+    throw std::runtime_error(std::string("ONNX model has no metadata: ") + key);
+  }
+
+  std::vector<std::string> names;
+  std::stringstream stream(value.get());
+  std::string name;
+  while (std::getline(stream, name, ',')) {
+    names.push_back(name);
+  }
+  return names;
+}
+
+std::vector<char *> toCharPointers(std::vector<std::string> & strings)
+{
+  std::vector<char *> pointers;
+  for (auto & string : strings) {
+    pointers.push_back(string.data());
+  }
+  return pointers;
+}
+}  // namespace
+
+SimpleOnnxModel::SimpleOnnxModel(const std::string & onnx_model_path)
+: env(ORT_LOGGING_LEVEL_WARNING, "learning_based_vehicle_model")
+{
+  // A sub-model is small, so a single thread avoids the thread pool overhead at every step
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(1);
+  session = Ort::Session(env, onnx_model_path.c_str(), session_options);
+  memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+
+  // Get string names of states and actions (inputs) of the ONNX model from its metadata
+  const auto metadata = session.GetModelMetadata();
+  onnx_model_state_name_strings = getNamesFromMetadata(metadata, "state_names");
+  onnx_model_input_name_strings = getNamesFromMetadata(metadata, "action_names");
+  onnx_model_state_names = toCharPointers(onnx_model_state_name_strings);
+  onnx_model_input_names = toCharPointers(onnx_model_input_name_strings);
+
+  // The time step is an optional input of the graph, and the tensors are either float or double
+  // (e.g. to keep the precision of the position in the map)
+  Ort::AllocatorWithDefaultOptions allocator;
+  for (size_t INPUT_IDX = 0; INPUT_IDX < session.GetInputCount(); INPUT_IDX++) {
+    const std::string input_name = session.GetInputNameAllocated(INPUT_IDX, allocator).get();
+    if (input_name == "dt") {
+      has_dt_input = true;
+    } else if (input_name == "state") {
+      const auto element_type =
+        session.GetInputTypeInfo(INPUT_IDX).GetTensorTypeAndShapeInfo().GetElementType();
+      use_double = element_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE;
+    }
+  }
+}
+
+std::vector<double> SimpleOnnxModel::getNextState(
+  std::vector<double> model_signals_vec, std::vector<double> model_signals_vec_next)
+{
+  return getNextStates({model_signals_vec}, {model_signals_vec_next}).front();
+}
+
+std::vector<std::vector<double>> SimpleOnnxModel::getNextStates(
+  const std::vector<std::vector<double>> & model_signals_vecs,
+  std::vector<std::vector<double>> model_signals_vecs_next)
+{
+  if (use_double) {
+    return getNextStatesAs<double>(model_signals_vecs, std::move(model_signals_vecs_next));
+  }
+  return getNextStatesAs<float>(model_signals_vecs, std::move(model_signals_vecs_next));
+}
+
+template <typename T>
+std::vector<std::vector<double>> SimpleOnnxModel::getNextStatesAs(
+  const std::vector<std::vector<double>> & model_signals_vecs,
+  std::vector<std::vector<double>> model_signals_vecs_next)
+{
+  const int64_t batch_size = static_cast<int64_t>(model_signals_vecs.size());
+  const int64_t num_inputs = static_cast<int64_t>(onnx_model_input_names.size());
+  const int64_t num_states = static_cast<int64_t>(onnx_model_state_names.size());
+  if (batch_size == 0) {
+    return model_signals_vecs_next;
+  }
+
+  // get inputs and states of the ONNX model from the vectors of signals of all the vehicles
+  std::vector<T> onnx_inputs(batch_size * num_inputs, 0.0);
+  std::vector<T> onnx_states(batch_size * num_states, 0.0);
+  for (int64_t BATCH_IDX = 0; BATCH_IDX < batch_size; BATCH_IDX++) {
+    const auto & model_signals_vec = model_signals_vecs[BATCH_IDX];
+    for (int64_t INPUT_IDX = 0; INPUT_IDX < num_inputs; INPUT_IDX++) {
+      const int sig_vec_idx = map_sig_vec_to_onnx_model_inputs[INPUT_IDX];
+      if (sig_vec_idx == -1) continue;
+      onnx_inputs[BATCH_IDX * num_inputs + INPUT_IDX] =
+        static_cast<T>(model_signals_vec[sig_vec_idx]);
+    }
+    for (int64_t STATE_IDX = 0; STATE_IDX < num_states; STATE_IDX++) {
+      const int sig_vec_idx = map_onnx_model_outputs_to_sig_vec[STATE_IDX];
+      if (sig_vec_idx == -1) continue;
+      onnx_states[BATCH_IDX * num_states + STATE_IDX] =
+        static_cast<T>(model_signals_vec[sig_vec_idx]);
+    }
+  }
+
+  // forward pass through the model for all the vehicles at once
+  const std::array<int64_t, 2> input_shape{batch_size, num_inputs};
+  const std::array<int64_t, 2> state_shape{batch_size, num_states};
+  const std::array<int64_t, 1> dt_shape{1};
+  T onnx_dt = static_cast<T>(dt);
+  std::vector<Ort::Value> input_tensors;
+  input_tensors.push_back(Ort::Value::CreateTensor<T>(
+    memory_info, onnx_inputs.data(), onnx_inputs.size(), input_shape.data(), input_shape.size()));
+  input_tensors.push_back(Ort::Value::CreateTensor<T>(
+    memory_info, onnx_states.data(), onnx_states.size(), state_shape.data(), state_shape.size()));
+  std::vector<const char *> input_tensor_names{"action", "state"};
+  if (has_dt_input) {
+    input_tensors.push_back(
+      Ort::Value::CreateTensor<T>(memory_info, &onnx_dt, 1, dt_shape.data(), dt_shape.size()));
+    input_tensor_names.push_back("dt");
+  }
+  Ort::AllocatorWithDefaultOptions allocator;
+  const auto output_name = session.GetOutputNameAllocated(0, allocator);
+  const char * output_tensor_names[] = {output_name.get()};
+  const auto output_tensors = session.Run(
+    Ort::RunOptions{nullptr}, input_tensor_names.data(), input_tensors.data(),
+    input_tensors.size(), output_tensor_names, 1);
+  const T * onnx_states_next = output_tensors.front().GetTensorData<T>();
+
+  // map outputs from the ONNX model to required outputs
+  for (int64_t BATCH_IDX = 0; BATCH_IDX < batch_size; BATCH_IDX++) {
+    auto & model_signals_vec_next = model_signals_vecs_next[BATCH_IDX];
+    for (int64_t STATE_IDX = 0; STATE_IDX < num_states; STATE_IDX++) {
+      const int sig_vec_idx = map_onnx_model_outputs_to_sig_vec[STATE_IDX];
+      if (sig_vec_idx == -1) continue;
+      model_signals_vec_next[sig_vec_idx] = onnx_states_next[BATCH_IDX * num_states + STATE_IDX];
+    }
+  }
+  return model_signals_vecs_next;
+}
+
+void SimpleOnnxModel::dtSet(double dt_)
+{
+  dt = dt_;
+}
+
+std::vector<char *> SimpleOnnxModel::getInputNames()
+{
+  return onnx_model_input_names;
+}
+
+std::vector<char *> SimpleOnnxModel::getStateNames()
+{
+  return onnx_model_state_names;
+}
+
+void SimpleOnnxModel::mapInputs(std::vector<char *> signals_vec_names)
+{
+  // index in "map_sig_vec_to_onnx_model_inputs" is index in "onnx_inputs" and value in
+  // "map_sig_vec_to_onnx_model_inputs" is index in "signals_vec_names"
+  map_sig_vec_to_onnx_model_inputs =
+    createConnectionsMap(signals_vec_names, onnx_model_input_names);
+}
+
+void SimpleOnnxModel::mapOutputs(std::vector<char *> signals_vec_names)
+{
+  // index in "map_onnx_model_outputs_to_sig_vec" is index in "onnx_model_outputs" and value in
+  // "map_onnx_model_outputs_to_sig_vec" is index in "signals_vec_names"
+  map_onnx_model_outputs_to_sig_vec =
+    createConnectionsMap(signals_vec_names, onnx_model_state_names);
+}
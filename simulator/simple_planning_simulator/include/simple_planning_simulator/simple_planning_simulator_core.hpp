@@ -42,6 +42,7 @@
 #include "geometry_msgs/msg/twist.hpp"
 #include "geometry_msgs/msg/twist_stamped.hpp"
 #include "nav_msgs/msg/odometry.hpp"
+#include "rosgraph_msgs/msg/clock.hpp"
 #include "sensor_msgs/msg/imu.hpp"
 #include "tier4_external_api_msgs/srv/initialize_pose.hpp"
 #include "tier4_vehicle_msgs/msg/actuation_command_stamped.hpp"
@@ -165,6 +166,11 @@ private:
   uint32_t timer_sampling_time_ms_;        //!< @brief timer sampling time
   rclcpp::TimerBase::SharedPtr on_timer_;  //!< @brief timer for simulation
 
+  /* fast-forward mode, in which this node publishes the simulated clock */
+  rclcpp::Publisher<rosgraph_msgs::msg::Clock>::SharedPtr pub_clock_;
+  rclcpp::TimerBase::SharedPtr on_fast_forward_timer_;  //!< @brief wall timer to advance the clock
+  rclcpp::Time fast_forward_time_;                      //!< @brief simulated time to publish
+
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
   rcl_interfaces::msg::SetParametersResult on_parameter(
     const std::vector<rclcpp::Parameter> & parameters);
@@ -314,6 +320,11 @@ private:
    */
   void on_timer();
 
+  /**
+   * @brief wall timer callback to advance the simulated clock by the timer sampling time
+   */
+  void on_fast_forward_timer();
+
   /**
    * @brief initialize vehicle_model_ptr
    */
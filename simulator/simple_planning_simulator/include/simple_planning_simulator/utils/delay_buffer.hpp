@@ -0,0 +1,66 @@
+// Copyright 2024 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__UTILS__DELAY_BUFFER_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__UTILS__DELAY_BUFFER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief fixed size ring buffer to delay the input commands by a number of steps
+ */
+class DelayBuffer
+{
+public:
+  DelayBuffer() = default;
+
+  /**
+   * @brief resize the buffer and fill it with the initial value
+   * @param [in] size number of steps to delay the input
+   * @param [in] initial_value value returned for the first size steps
+   */
+  void reset(const size_t size, const double initial_value = 0.0)
+  {
+    buffer_.assign(size, initial_value);
+    head_ = 0;
+  }
+
+  /**
+   * @brief push the current input and pop the input pushed size steps before
+   * @param [in] input current input
+   * @return delayed input, which is the current input if the size is zero
+   */
+  double push(const double input)
+  {
+    if (buffer_.empty()) {
+      return input;
+    }
+    const double delayed_input = buffer_[head_];
+    buffer_[head_] = input;
+    head_ = (head_ + 1 == buffer_.size()) ? 0 : head_ + 1;
+    return delayed_input;
+  }
+
+  /**
+   * @brief get the number of steps to delay the input
+   */
+  size_t size() const { return buffer_.size(); }
+
+private:
+  std::vector<double> buffer_;
+  size_t head_{0};
+};
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__UTILS__DELAY_BUFFER_HPP_
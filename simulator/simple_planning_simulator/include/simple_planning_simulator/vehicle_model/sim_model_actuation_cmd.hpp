@@ -19,9 +19,9 @@
 #include "eigen3/Eigen/Core"
 #include "eigen3/Eigen/LU"
 #include "simple_planning_simulator/utils/csv_loader.hpp"
+#include "simple_planning_simulator/utils/delay_buffer.hpp"
 #include "simple_planning_simulator/vehicle_model/sim_model_interface.hpp"
 
-#include <deque>
 #include <iostream>
 #include <optional>
 #include <queue>
@@ -204,16 +204,16 @@ private:
   const double steer_rate_lim_;  //!< @brief steering angular velocity limit [rad/s]
   const double wheelbase_;       //!< @brief vehicle wheelbase length [m]
 
-  std::deque<double> accel_input_queue_;  //!< @brief buffer for accel command
-  std::deque<double> brake_input_queue_;  //!< @brief buffer for brake command
-  std::deque<double> steer_input_queue_;  //!< @brief buffer for steering command
-  const double accel_delay_;              //!< @brief time delay for accel command [s]
-  const double accel_time_constant_;      //!< @brief time constant for accel dynamics
-  const double brake_delay_;              //!< @brief time delay for brake command [s]
-  const double brake_time_constant_;      //!< @brief time constant for brake dynamics
-  const double steer_delay_;              //!< @brief time delay for steering command [s]
-  const double steer_time_constant_;      //!< @brief time constant for steering dynamics
-  const double steer_bias_;               //!< @brief steering angle bias [rad]
+  DelayBuffer accel_input_queue_;     //!< @brief buffer for accel command
+  DelayBuffer brake_input_queue_;     //!< @brief buffer for brake command
+  DelayBuffer steer_input_queue_;     //!< @brief buffer for steering command
+  const double accel_delay_;          //!< @brief time delay for accel command [s]
+  const double accel_time_constant_;  //!< @brief time constant for accel dynamics
+  const double brake_delay_;          //!< @brief time delay for brake command [s]
+  const double brake_time_constant_;  //!< @brief time constant for brake dynamics
+  const double steer_delay_;          //!< @brief time delay for steering command [s]
+  const double steer_time_constant_;  //!< @brief time constant for steering dynamics
+  const double steer_bias_;           //!< @brief steering angle bias [rad]
 
   bool convert_accel_cmd_;
   bool convert_brake_cmd_;
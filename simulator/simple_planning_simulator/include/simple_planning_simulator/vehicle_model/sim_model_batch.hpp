@@ -0,0 +1,104 @@
+// Copyright 2024 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_BATCH_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_BATCH_HPP_
+
+#include "simple_planning_simulator/vehicle_model/sim_model_interface.hpp"
+
+#include <Eigen/Core>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief batch of independent vehicles of the same model, which are stepped in parallel without
+ * any ROS node, e.g. for scenario sweeps. The models must not share any state, so the learned
+ * model, which runs a python module, is not supported.
+ */
+class SimModelBatch
+{
+public:
+  using ModelFactory = std::function<std::shared_ptr<SimModelInterface>()>;
+
+  /**
+   * @brief constructor
+   * @param [in] size number of vehicles
+   * @param [in] factory function to create the model of each vehicle
+   * @param [in] num_threads number of threads to step the vehicles, 0 for the hardware concurrency
+   */
+  SimModelBatch(const size_t size, const ModelFactory & factory, const size_t num_threads = 0);
+
+  /**
+   * @brief get the number of vehicles
+   */
+  size_t size() const { return models_.size(); }
+
+  /**
+   * @brief get the model of a vehicle, e.g. to get the states which are not in the arrays
+   */
+  std::shared_ptr<SimModelInterface> getModel(const size_t index) const;
+
+  /**
+   * @brief set the state of a vehicle
+   */
+  void setState(const size_t index, const Eigen::VectorXd & state);
+
+  /**
+   * @brief set the input of a vehicle, which is used from the next update
+   */
+  void setInput(const size_t index, const Eigen::VectorXd & input);
+
+  /**
+   * @brief set the gear of a vehicle
+   */
+  void setGear(const size_t index, const uint8_t gear);
+
+  /**
+   * @brief step all vehicles by dt in parallel and update the state arrays
+   * @param [in] dt delta time [s]
+   */
+  void update(const double dt);
+
+  /**
+   * @brief states of all vehicles as arrays indexed by the vehicle, updated by update()
+   */
+  const std::vector<double> & getX() const { return x_; }
+  const std::vector<double> & getY() const { return y_; }
+  const std::vector<double> & getYaw() const { return yaw_; }
+  const std::vector<double> & getVx() const { return vx_; }
+  const std::vector<double> & getAx() const { return ax_; }
+  const std::vector<double> & getWz() const { return wz_; }
+  const std::vector<double> & getSteer() const { return steer_; }
+
+private:
+  /**
+   * @brief copy the states of the vehicles in [begin, end) to the arrays
+   */
+  void updateStateArrays(const size_t begin, const size_t end);
+
+  std::vector<std::shared_ptr<SimModelInterface>> models_;
+  size_t num_threads_;
+
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> yaw_;
+  std::vector<double> vx_;
+  std::vector<double> ax_;
+  std::vector<double> wz_;
+  std::vector<double> steer_;
+};
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_BATCH_HPP_
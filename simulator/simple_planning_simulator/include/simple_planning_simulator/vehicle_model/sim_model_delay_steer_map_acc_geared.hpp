@@ -19,9 +19,9 @@
 #include "eigen3/Eigen/Core"
 #include "eigen3/Eigen/LU"
 #include "simple_planning_simulator/utils/csv_loader.hpp"
+#include "simple_planning_simulator/utils/delay_buffer.hpp"
 #include "simple_planning_simulator/vehicle_model/sim_model_interface.hpp"
 
-#include <deque>
 #include <iostream>
 #include <queue>
 #include <string>
@@ -129,14 +129,14 @@ private:
   const double steer_rate_lim_;  //!< @brief steering angular velocity limit [rad/s]
   const double wheelbase_;       //!< @brief vehicle wheelbase length [m]
 
-  std::deque<double> acc_input_queue_;    //!< @brief buffer for accel command
-  std::deque<double> steer_input_queue_;  //!< @brief buffer for steering command
-  const double acc_delay_;                //!< @brief time delay for accel command [s]
-  const double acc_time_constant_;        //!< @brief time constant for accel dynamics
-  const double steer_delay_;              //!< @brief time delay for steering command [s]
-  const double steer_time_constant_;      //!< @brief time constant for steering dynamics
-  const double steer_bias_;               //!< @brief steering angle bias [rad]
-  const std::string path_;                //!< @brief conversion map path
+  DelayBuffer acc_input_queue_;       //!< @brief buffer for accel command
+  DelayBuffer steer_input_queue_;     //!< @brief buffer for steering command
+  const double acc_delay_;            //!< @brief time delay for accel command [s]
+  const double acc_time_constant_;    //!< @brief time constant for accel dynamics
+  const double steer_delay_;          //!< @brief time delay for steering command [s]
+  const double steer_time_constant_;  //!< @brief time constant for steering dynamics
+  const double steer_bias_;           //!< @brief steering angle bias [rad]
+  const std::string path_;            //!< @brief conversion map path
 
   /**
    * @brief set queue buffer for input command
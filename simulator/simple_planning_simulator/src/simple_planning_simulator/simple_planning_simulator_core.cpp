@@ -187,6 +187,25 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
     std::bind(&SimplePlanningSimulator::on_timer, this));
 
+  // In the fast-forward mode, this node publishes the simulated clock and advances it by the timer
+  // sampling time faster than real time, so that the vehicle and all nodes using the simulated
+  // clock run faster than real time.
+  if (declare_parameter("fast_forward_mode", false)) {
+    if (!get_parameter("use_sim_time").as_bool()) {
+      RCLCPP_WARN(get_logger(), "fast_forward_mode requires use_sim_time to be true.");
+    }
+    const double real_time_factor = declare_parameter("fast_forward_real_time_factor", 10.0);
+    if (real_time_factor <= 0.0) {
+      throw std::invalid_argument("fast_forward_real_time_factor must be positive.");
+    }
+    const auto wall_period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double, std::milli>(timer_sampling_time_ms_ / real_time_factor));
+    fast_forward_time_ = rclcpp::Clock(RCL_SYSTEM_TIME).now();
+    pub_clock_ = create_publisher<rosgraph_msgs::msg::Clock>("/clock", QoS{1});
+    on_fast_forward_timer_ = create_wall_timer(
+      wall_period, std::bind(&SimplePlanningSimulator::on_fast_forward_timer, this));
+  }
+
   tier4_api_utils::ServiceProxyNodeInterface proxy(this);
   group_api_service_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   srv_set_pose_ = proxy.create_service<tier4_external_api_msgs::srv::InitializePose>(
@@ -489,6 +508,15 @@ void SimplePlanningSimulator::on_timer()
   }
 }
 
+void SimplePlanningSimulator::on_fast_forward_timer()
+{
+  // on_timer() is called by the timer on the simulated clock when the clock is received
+  fast_forward_time_ += rclcpp::Duration(std::chrono::milliseconds(timer_sampling_time_ms_));
+  rosgraph_msgs::msg::Clock clock;
+  clock.clock = fast_forward_time_;
+  pub_clock_->publish(clock);
+}
+
 void SimplePlanningSimulator::on_map(const LaneletMapBin::ConstSharedPtr msg)
 {
   auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
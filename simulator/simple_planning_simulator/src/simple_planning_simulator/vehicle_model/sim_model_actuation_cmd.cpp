@@ -206,17 +206,11 @@ void SimModelActuationCmd::update(const double & dt)
 {
   Eigen::VectorXd delayed_input = Eigen::VectorXd::Zero(dim_u_);
 
-  accel_input_queue_.push_back(input_(IDX_U::ACCEL_DES));
-  delayed_input(IDX_U::ACCEL_DES) = accel_input_queue_.front();
-  accel_input_queue_.pop_front();
+  delayed_input(IDX_U::ACCEL_DES) = accel_input_queue_.push(input_(IDX_U::ACCEL_DES));
 
-  brake_input_queue_.push_back(input_(IDX_U::BRAKE_DES));
-  delayed_input(IDX_U::BRAKE_DES) = brake_input_queue_.front();
-  brake_input_queue_.pop_front();
+  delayed_input(IDX_U::BRAKE_DES) = brake_input_queue_.push(input_(IDX_U::BRAKE_DES));
 
-  steer_input_queue_.push_back(input_(IDX_U::STEER_DES));
-  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.front();
-  steer_input_queue_.pop_front();
+  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.push(input_(IDX_U::STEER_DES));
 
   delayed_input(IDX_U::GEAR) = input_(IDX_U::GEAR);
   delayed_input(IDX_U::SLOPE_ACCX) = input_(IDX_U::SLOPE_ACCX);
@@ -235,17 +229,11 @@ void SimModelActuationCmd::update(const double & dt)
 
 void SimModelActuationCmd::initializeInputQueue(const double & dt)
 {
-  const size_t accel_input_queue_size = static_cast<size_t>(round(accel_delay_ / dt));
-  accel_input_queue_.resize(accel_input_queue_size);
-  std::fill(accel_input_queue_.begin(), accel_input_queue_.end(), 0.0);
+  accel_input_queue_.reset(static_cast<size_t>(round(accel_delay_ / dt)));
 
-  const size_t brake_input_queue_size = static_cast<size_t>(round(brake_delay_ / dt));
-  brake_input_queue_.resize(brake_input_queue_size);
-  std::fill(brake_input_queue_.begin(), brake_input_queue_.end(), 0.0);
+  brake_input_queue_.reset(static_cast<size_t>(round(brake_delay_ / dt)));
 
-  const size_t steer_input_queue_size = static_cast<size_t>(round(steer_delay_ / dt));
-  steer_input_queue_.resize(steer_input_queue_size);
-  std::fill(steer_input_queue_.begin(), steer_input_queue_.end(), 0.0);
+  steer_input_queue_.reset(static_cast<size_t>(round(steer_delay_ / dt)));
 }
 
 Eigen::VectorXd SimModelActuationCmd::calcModel(
@@ -0,0 +1,99 @@
+// Copyright 2024 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "simple_planning_simulator/vehicle_model/sim_model_batch.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+SimModelBatch::SimModelBatch(
+  const size_t size, const ModelFactory & factory, const size_t num_threads)
+: num_threads_(num_threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : num_threads)
+{
+  models_.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    models_.push_back(factory());
+  }
+
+  x_.resize(size);
+  y_.resize(size);
+  yaw_.resize(size);
+  vx_.resize(size);
+  ax_.resize(size);
+  wz_.resize(size);
+  steer_.resize(size);
+  updateStateArrays(0, size);
+}
+
+std::shared_ptr<SimModelInterface> SimModelBatch::getModel(const size_t index) const
+{
+  return models_.at(index);
+}
+
+void SimModelBatch::setState(const size_t index, const Eigen::VectorXd & state)
+{
+  models_.at(index)->setState(state);
+  updateStateArrays(index, index + 1);
+}
+
+void SimModelBatch::setInput(const size_t index, const Eigen::VectorXd & input)
+{
+  models_.at(index)->setInput(input);
+}
+
+void SimModelBatch::setGear(const size_t index, const uint8_t gear)
+{
+  models_.at(index)->setGear(gear);
+}
+
+void SimModelBatch::update(const double dt)
+{
+  const auto update_range = [this, dt](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      models_.at(i)->update(dt);
+    }
+    updateStateArrays(begin, end);
+  };
+
+  // split the vehicles into contiguous ranges, and step the first range in this thread
+  const size_t num_ranges = std::max<size_t>(1, std::min(num_threads_, models_.size()));
+  const size_t range_size = (models_.size() + num_ranges - 1) / num_ranges;
+  std::vector<std::thread> threads;
+  threads.reserve(num_ranges - 1);
+  for (size_t r = 1; r < num_ranges; ++r) {
+    const size_t begin = std::min(r * range_size, models_.size());
+    const size_t end = std::min(begin + range_size, models_.size());
+    threads.emplace_back(update_range, begin, end);
+  }
+  update_range(0, std::min(range_size, models_.size()));
+  for (auto & thread : threads) {
+    thread.join();
+  }
+}
+
+void SimModelBatch::updateStateArrays(const size_t begin, const size_t end)
+{
+  for (size_t i = begin; i < end; ++i) {
+    auto & model = *models_.at(i);
+    x_.at(i) = model.getX();
+    y_.at(i) = model.getY();
+    yaw_.at(i) = model.getYaw();
+    vx_.at(i) = model.getVx();
+    ax_.at(i) = model.getAx();
+    wz_.at(i) = model.getWz();
+    steer_.at(i) = model.getSteer();
+  }
+}
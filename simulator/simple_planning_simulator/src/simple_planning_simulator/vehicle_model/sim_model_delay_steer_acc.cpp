@@ -76,12 +76,8 @@ void SimModelDelaySteerAcc::update(const double & dt)
 {
   Eigen::VectorXd delayed_input = Eigen::VectorXd::Zero(dim_u_);
 
-  acc_input_queue_.push_back(input_(IDX_U::ACCX_DES));
-  delayed_input(IDX_U::ACCX_DES) = acc_input_queue_.front();
-  acc_input_queue_.pop_front();
-  steer_input_queue_.push_back(input_(IDX_U::STEER_DES));
-  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.front();
-  steer_input_queue_.pop_front();
+  delayed_input(IDX_U::ACCX_DES) = acc_input_queue_.push(input_(IDX_U::ACCX_DES));
+  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.push(input_(IDX_U::STEER_DES));
 
   updateRungeKutta(dt, delayed_input);
 
@@ -90,13 +86,9 @@ void SimModelDelaySteerAcc::update(const double & dt)
 
 void SimModelDelaySteerAcc::initializeInputQueue(const double & dt)
 {
-  size_t acc_input_queue_size = static_cast<size_t>(round(acc_delay_ / dt));
-  acc_input_queue_.resize(acc_input_queue_size);
-  std::fill(acc_input_queue_.begin(), acc_input_queue_.end(), 0.0);
+  acc_input_queue_.reset(static_cast<size_t>(round(acc_delay_ / dt)));
 
-  size_t steer_input_queue_size = static_cast<size_t>(round(steer_delay_ / dt));
-  steer_input_queue_.resize(steer_input_queue_size);
-  std::fill(steer_input_queue_.begin(), steer_input_queue_.end(), 0.0);
+  steer_input_queue_.reset(static_cast<size_t>(round(steer_delay_ / dt)));
 }
 
 Eigen::VectorXd SimModelDelaySteerAcc::calcModel(
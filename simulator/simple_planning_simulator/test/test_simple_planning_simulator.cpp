@@ -15,6 +15,9 @@
 #include "ament_index_cpp/get_package_share_directory.hpp"
 #include "gtest/gtest.h"
 #include "simple_planning_simulator/simple_planning_simulator_core.hpp"
+#include "simple_planning_simulator/utils/delay_buffer.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model_batch.hpp"
 #include "tf2/utils.h"
 
 #include "tier4_vehicle_msgs/msg/actuation_command_stamped.hpp"
@@ -445,3 +448,57 @@ INSTANTIATE_TEST_SUITE_P(
     /* Actuation type */
     std::make_tuple(CommandType::Actuation, "ACTUATION_CMD", "steer_map"),
     std::make_tuple(CommandType::Actuation, "ACTUATION_CMD", "vgr")));
+
+TEST(DelayBuffer, DelayInputBySize)
+{
+  DelayBuffer buffer;
+  buffer.reset(3);
+  EXPECT_EQ(buffer.size(), 3u);
+  EXPECT_DOUBLE_EQ(buffer.push(1.0), 0.0);
+  EXPECT_DOUBLE_EQ(buffer.push(2.0), 0.0);
+  EXPECT_DOUBLE_EQ(buffer.push(3.0), 0.0);
+  EXPECT_DOUBLE_EQ(buffer.push(4.0), 1.0);
+  EXPECT_DOUBLE_EQ(buffer.push(5.0), 2.0);
+
+  // no delay
+  buffer.reset(0);
+  EXPECT_DOUBLE_EQ(buffer.push(6.0), 6.0);
+}
+
+TEST(SimModelBatch, SameAsSingleModel)
+{
+  const double dt = 0.025;
+  const auto create_model = [dt]() {
+    return std::make_shared<SimModelDelaySteerAccGeared>(
+      30.0, 0.6, 30.0, 6.28, 2.7, dt, 0.1, 0.1, 0.1, 0.1, 0.0, 0.0, 1.0, 1.0);
+  };
+  constexpr size_t batch_size = 10;
+  SimModelBatch batch(batch_size, create_model, 4);
+  ASSERT_EQ(batch.size(), batch_size);
+
+  // each vehicle accelerates and steers differently
+  std::vector<std::shared_ptr<SimModelInterface>> models;
+  for (size_t i = 0; i < batch_size; ++i) {
+    Eigen::VectorXd input(2);
+    input << 0.1 * static_cast<double>(i), 0.01 * static_cast<double>(i);
+    models.push_back(create_model());
+    models.back()->setInput(input);
+    batch.setInput(i, input);
+  }
+
+  for (int step = 0; step < 200; ++step) {
+    batch.update(dt);
+    for (auto & model : models) {
+      model->update(dt);
+    }
+  }
+
+  for (size_t i = 0; i < batch_size; ++i) {
+    EXPECT_DOUBLE_EQ(batch.getX().at(i), models.at(i)->getX());
+    EXPECT_DOUBLE_EQ(batch.getY().at(i), models.at(i)->getY());
+    EXPECT_DOUBLE_EQ(batch.getYaw().at(i), models.at(i)->getYaw());
+    EXPECT_DOUBLE_EQ(batch.getVx().at(i), models.at(i)->getVx());
+    EXPECT_DOUBLE_EQ(batch.getSteer().at(i), models.at(i)->getSteer());
+  }
+  EXPECT_GT(batch.getX().back(), batch.getX().front());
+}
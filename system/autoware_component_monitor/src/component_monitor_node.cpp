@@ -14,60 +14,66 @@
 
 #include "component_monitor_node.hpp"
 
-#include "unit_conversions.hpp"
-
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_internal_msgs/msg/resource_usage_report.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 
-#include <boost/process.hpp>
+#include <unistd.h>
 
-#include <cctype>
-#include <cstdint>
+#include <algorithm>
 #include <exception>
 #include <functional>
+#include <iomanip>
 #include <sstream>
 #include <string>
-#include <unordered_map>
-#include <utility>
 #include <vector>
 
 namespace autoware::component_monitor
 {
 ComponentMonitor::ComponentMonitor(const rclcpp::NodeOptions & node_options)
-: Node("component_monitor", node_options), publish_rate_(declare_parameter<double>("publish_rate"))
+: Node("component_monitor", node_options),
+  publish_rate_(declare_parameter<double>("publish_rate")),
+  process_stat_file_("/proc/" + std::to_string(getpid()) + "/stat"),
+  meminfo_file_("/proc/meminfo"),
+  clock_ticks_per_second_(sysconf(_SC_CLK_TCK)),
+  page_size_bytes_(static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE))),
+  prev_cpu_ticks_(procfs::parse_process_stat(process_stat_file_.read()).cpu_ticks),
+  prev_sample_time_(std::chrono::steady_clock::now()),
+  prev_thread_sample_time_(prev_sample_time_)
 {
   usage_pub_ =
     create_publisher<ResourceUsageReport>("~/component_system_usage", rclcpp::SensorDataQoS());
-
-  // Make sure top ins installed and is in path
-  const auto path_top = boost::process::search_path("top");
-  if (path_top.empty()) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Couldn't find 'top' in path.");
-    rclcpp::shutdown();
-  }
+  thread_usage_pub_ =
+    create_publisher<DiagnosticArray>("~/thread_system_usage", rclcpp::SensorDataQoS());
 
   // Get the PID of the current process
   int pid = getpid();
 
-  environment_ = boost::this_process::environment();
-  environment_["LC_NUMERIC"] = "en_US.UTF-8";
-
   on_timer_tick_wrapped_ = std::bind(&ComponentMonitor::on_timer_tick, this, pid);
 
   timer_ = rclcpp::create_timer(
     this, get_clock(), rclcpp::Rate(publish_rate_).period(), on_timer_tick_wrapped_);
 }
 
-void ComponentMonitor::on_timer_tick(const int pid) const
+void ComponentMonitor::on_timer_tick(const int pid)
 {
-  if (usage_pub_->get_subscription_count() == 0) return;
+  const bool publish_usage = usage_pub_->get_subscription_count() > 0;
+  const bool publish_thread_usage = thread_usage_pub_->get_subscription_count() > 0;
+  if (!publish_usage && !publish_thread_usage) return;
 
   try {
-    auto usage_msg = pid_to_report(pid);
-    usage_msg.header.stamp = this->now();
-    usage_msg.pid = pid;
-    usage_pub_->publish(usage_msg);
+    if (publish_usage) {
+      auto usage_msg = create_report();
+      usage_msg.header.stamp = this->now();
+      usage_msg.pid = pid;
+      usage_pub_->publish(usage_msg);
+    }
+    if (publish_thread_usage) {
+      auto thread_usage_msg = create_thread_report(pid);
+      thread_usage_msg.header.stamp = this->now();
+      thread_usage_pub_->publish(thread_usage_msg);
+    }
   } catch (std::exception & e) {
     RCLCPP_ERROR(get_logger(), "%s", e.what());
   } catch (...) {
@@ -75,100 +81,86 @@ void ComponentMonitor::on_timer_tick(const int pid) const
   }
 }
 
-ComponentMonitor::ResourceUsageReport ComponentMonitor::pid_to_report(const pid_t & pid) const
+ComponentMonitor::ResourceUsageReport ComponentMonitor::create_report()
 {
-  const auto std_out = run_system_command("top -b -n 1 -E k -p " + std::to_string(pid));
+  const auto process_stat = procfs::parse_process_stat(process_stat_file_.read());
+  const auto meminfo = procfs::parse_meminfo(meminfo_file_.read());
+  const auto sample_time = std::chrono::steady_clock::now();
 
-  const auto fields = parse_lines_into_words(std_out);
+  const double cpu_seconds = static_cast<double>(process_stat.cpu_ticks - prev_cpu_ticks_) /
+                             static_cast<double>(clock_ticks_per_second_);
+  const double wall_seconds =
+    std::chrono::duration<double>(sample_time - prev_sample_time_).count();
+  prev_cpu_ticks_ = process_stat.cpu_ticks;
+  prev_sample_time_ = sample_time;
 
   ResourceUsageReport report;
-  report.cpu_cores_utilized = std::stof(fields.back().at(8)) / 100.0f;
-  report.total_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(3)));
-  report.free_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(5)));
-  report.process_memory_bytes = parse_memory_res(fields.back().at(5));
+  report.cpu_cores_utilized =
+    wall_seconds > 0.0 ? static_cast<float>(cpu_seconds / wall_seconds) : 0.0f;
+  report.total_memory_bytes = meminfo.total_bytes;
+  report.free_memory_bytes = meminfo.free_bytes;
+  report.process_memory_bytes = process_stat.rss_pages * page_size_bytes_;
 
   return report;
 }
 
-std::stringstream ComponentMonitor::run_system_command(const std::string & cmd) const
+ComponentMonitor::DiagnosticArray ComponentMonitor::create_thread_report(const int pid)
 {
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on out_fd");
-  }
-  boost::process::pipe out_pipe{out_fd[0], out_fd[1]};
-  boost::process::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on err_fd");
-  }
-  boost::process::pipe err_pipe{err_fd[0], err_fd[1]};
-  boost::process::ipstream is_err{std::move(err_pipe)};
-
-  boost::process::child c(
-    cmd, environment_, boost::process::std_out > is_out, boost::process::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
-    RCLCPP_ERROR_STREAM(get_logger(), "Error running command: " << os.str());
-  }
-
-  std::stringstream sstream;
-  sstream << is_out.rdbuf();
-  return sstream;
-}
-
-ComponentMonitor::VecVecStr ComponentMonitor::parse_lines_into_words(
-  const std::stringstream & std_out)
-{
-  VecVecStr fields;
-  std::string line;
-  std::istringstream input{std_out.str()};
-
-  while (std::getline(input, line)) {
-    std::istringstream iss_line{line};
-    std::string word;
-    std::vector<std::string> words;
-
-    while (iss_line >> word) {
-      words.push_back(word);
+  const auto thread_ids = procfs::list_thread_ids(pid);
+
+  // remove the threads which have exited
+  for (auto it = thread_samples_.begin(); it != thread_samples_.end();) {
+    if (!std::binary_search(thread_ids.begin(), thread_ids.end(), it->first)) {
+      it = thread_samples_.erase(it);
+    } else {
+      ++it;
     }
-
-    fields.push_back(words);
   }
 
-  return fields;
-}
-
-std::uint64_t ComponentMonitor::parse_memory_res(const std::string & mem_res)
-{
-  // example 1: 12.3g
-  // example 2: 123 (without suffix, just bytes)
-  static const std::unordered_map<char, std::function<std::uint64_t(double)>> unit_map{
-    {'k', unit_conversions::kib_to_bytes<double>}, {'m', unit_conversions::mib_to_bytes<double>},
-    {'g', unit_conversions::gib_to_bytes<double>}, {'t', unit_conversions::tib_to_bytes<double>},
-    {'p', unit_conversions::pib_to_bytes<double>}, {'e', unit_conversions::eib_to_bytes<double>}};
-
-  if (std::isdigit(mem_res.back())) {
-    return std::stoull(mem_res);  // Handle plain bytes without any suffix
-  }
-
-  // Extract the numeric part and the unit suffix
-  double value = std::stod(mem_res.substr(0, mem_res.size() - 1));
-  char suffix = mem_res.back();
+  const auto sample_time = std::chrono::steady_clock::now();
+  const double wall_seconds =
+    std::chrono::duration<double>(sample_time - prev_thread_sample_time_).count();
+  prev_thread_sample_time_ = sample_time;
+
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.name = get_namespace();
+  status.hardware_id = std::to_string(pid);
+  status.message = "CPU cores utilized by each thread";
+  for (const auto tid : thread_ids) {
+    auto & sample = thread_samples_[tid];
+    const bool is_new_thread = !sample.stat_file;
+    procfs::ProcessStat thread_stat;
+    try {
+      if (is_new_thread) {
+        sample.stat_file = std::make_unique<procfs::File>(
+          "/proc/" + std::to_string(pid) + "/task/" + std::to_string(tid) + "/stat");
+      }
+      thread_stat = procfs::parse_process_stat(sample.stat_file->read());
+    } catch (const std::runtime_error &) {
+      // the thread has exited after listing
+      thread_samples_.erase(tid);
+      continue;
+    }
+    if (is_new_thread) {
+      sample.prev_cpu_ticks = thread_stat.cpu_ticks;
+    }
 
-  // Find the appropriate function from the map
-  auto it = unit_map.find(suffix);
-  if (it != unit_map.end()) {
-    const auto & conversion_function = it->second;
-    return conversion_function(value);
+    const double cpu_seconds = static_cast<double>(thread_stat.cpu_ticks - sample.prev_cpu_ticks) /
+                               static_cast<double>(clock_ticks_per_second_);
+    sample.prev_cpu_ticks = thread_stat.cpu_ticks;
+
+    std::ostringstream cores_utilized;
+    cores_utilized << std::fixed << std::setprecision(3)
+                   << (wall_seconds > 0.0 ? cpu_seconds / wall_seconds : 0.0);
+    diagnostic_msgs::msg::KeyValue key_value;
+    key_value.key = std::to_string(tid) + " " + thread_stat.name;
+    key_value.value = cores_utilized.str();
+    status.values.push_back(key_value);
   }
 
-  // Throw an exception or handle the error as needed if the suffix is not recognized
-  throw std::runtime_error("Unsupported unit suffix: " + std::string(1, suffix));
+  DiagnosticArray report;
+  report.status.push_back(status);
+  return report;
 }
 
 }  // namespace autoware::component_monitor
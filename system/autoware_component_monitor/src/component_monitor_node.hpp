@@ -15,16 +15,18 @@
 #ifndef COMPONENT_MONITOR_NODE_HPP_
 #define COMPONENT_MONITOR_NODE_HPP_
 
+#include "procfs.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_internal_msgs/msg/resource_usage_report.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 
-#include <boost/process.hpp>
-
+#include <chrono>
 #include <cstdint>
-#include <sstream>
-#include <string>
-#include <vector>
+#include <functional>
+#include <map>
+#include <memory>
 
 namespace autoware::component_monitor
 {
@@ -35,66 +37,53 @@ public:
 
 private:
   using ResourceUsageReport = autoware_internal_msgs::msg::ResourceUsageReport;
-  using VecVecStr = std::vector<std::vector<std::string>>;
+  using DiagnosticArray = diagnostic_msgs::msg::DiagnosticArray;
+
+  struct ThreadSample
+  {
+    std::unique_ptr<procfs::File> stat_file;
+    std::uint64_t prev_cpu_ticks{0};
+  };
 
   const double publish_rate_;
 
   std::function<void()> on_timer_tick_wrapped_;
 
   rclcpp::Publisher<ResourceUsageReport>::SharedPtr usage_pub_;
+  rclcpp::Publisher<DiagnosticArray>::SharedPtr thread_usage_pub_;
   rclcpp::TimerBase::SharedPtr timer_;
 
-  boost::process::native_environment environment_;
+  procfs::File process_stat_file_;
+  procfs::File meminfo_file_;
+  const long clock_ticks_per_second_;  // NOLINT(runtime/int)
+  const std::uint64_t page_size_bytes_;
 
-  void on_timer_tick(int pid) const;
+  // the previous sample to calculate the CPU usage from
+  std::uint64_t prev_cpu_ticks_;
+  std::chrono::steady_clock::time_point prev_sample_time_;
 
-  /**
-   * @brief Get system usage of the component.
-   *
-   * @details The output of top -b -n 1 -E k -p PID` is like below:
-   *
-   * top - 13:57:26 up  3:14,  1 user,  load average: 1,09, 1,10, 1,04
-   * Tasks:   1 total,   0 running,   1 sleeping,   0 stopped,   0 zombie
-   * %Cpu(s):  0,0 us,  0,8 sy,  0,0 ni, 99,2 id,  0,0 wa,  0,0 hi,  0,0 si,  0,0 st
-   * KiB Mem : 65532208 total, 35117428 free, 17669824 used, 12744956 buff/cache
-   * KiB Swap: 39062524 total, 39062524 free,        0 used. 45520816 avail Mem
-   *
-   *     PID USER      PR  NI    VIRT    RES    SHR S  %CPU  %MEM     TIME+ COMMAND
-   *    3352 meb       20   0 2905940   1,2g  39292 S   0,0   2,0  23:24.01 awesome
-   *
-   * We get 5th and 8th fields, which are RES, %CPU, respectively.
-   */
-  ResourceUsageReport pid_to_report(const pid_t & pid) const;
+  // the threads of the process keyed by the thread id
+  std::map<int, ThreadSample> thread_samples_;
+  std::chrono::steady_clock::time_point prev_thread_sample_time_;
 
-  /**
-   * @brief Run a terminal command and return the standard output.
-   *
-   * @param cmd The terminal command to run
-   * @return  The standard output of the command
-   */
-  std::stringstream run_system_command(const std::string & cmd) const;
+  void on_timer_tick(int pid);
 
   /**
-   * @brief Parses text from a stringstream into separated words by line.
+   * @brief Get system usage of the component.
    *
-   * @param std_out Reference to the input stringstream.
-   * @return Nested vector with each inner vector containing words from one line.
+   * @details /proc/[pid]/stat and /proc/meminfo are read directly instead of running `top`. The
+   * CPU usage is the CPU time of the process divided by the wall time since the previous sample.
    */
-  static VecVecStr parse_lines_into_words(const std::stringstream & std_out);
+  ResourceUsageReport create_report();
 
   /**
-   * @brief Parses a memory resource string and converts it to bytes.
-   *
-   * This function handles memory size strings with suffixes to denote
-   * the units (e.g., "k" for kibibytes, "m" for mebibytes, etc.).
-   * If the string has no suffix, it is interpreted as plain bytes.
-   *
-   * @param mem_res A string representing the memory resource with a unit suffix or just bytes.
-   * @return uint64_t The memory size in bytes.
+   * @brief Get CPU usage of each thread of the component container.
    *
-   * @exception std::runtime_error Thrown if the suffix is not recognized.
+   * @details /proc/[pid]/task/[tid]/stat is read for each thread, so the executor threads of the
+   * container can be told apart by their names and usages. The threads which have exited since
+   * the previous sample are removed, and the new threads are reported from the next sample.
    */
-  static std::uint64_t parse_memory_res(const std::string & mem_res);
+  DiagnosticArray create_thread_report(int pid);
 };
 
 }  // namespace autoware::component_monitor
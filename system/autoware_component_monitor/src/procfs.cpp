@@ -0,0 +1,143 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "procfs.hpp"
+
+#include "unit_conversions.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::component_monitor::procfs
+{
+File::File(const std::string & path) : path_(path), fd_(open(path.c_str(), O_RDONLY | O_CLOEXEC))
+{
+  if (fd_ < 0) {
+    throw std::runtime_error("Failed to open " + path_ + ": " + std::strerror(errno));
+  }
+  buffer_.reserve(4096);
+}
+
+File::~File()
+{
+  close(fd_);
+}
+
+const std::string & File::read()
+{
+  std::size_t size = 0;
+  buffer_.resize(buffer_.capacity());
+  while (true) {
+    const auto n = pread(fd_, buffer_.data() + size, buffer_.size() - size, size);
+    if (n < 0) {
+      throw std::runtime_error("Failed to read " + path_ + ": " + std::strerror(errno));
+    }
+    if (n == 0) {
+      break;
+    }
+    size += static_cast<std::size_t>(n);
+    if (size == buffer_.size()) {
+      buffer_.resize(buffer_.size() * 2);
+    }
+  }
+  buffer_.resize(size);
+  return buffer_;
+}
+
+ProcessStat parse_process_stat(const std::string & content)
+{
+  const auto comm_begin = content.find('(');
+  const auto comm_end = content.rfind(')');
+  if (comm_begin == std::string::npos || comm_end == std::string::npos || comm_end < comm_begin) {
+    throw std::runtime_error("Malformed process stat: " + content);
+  }
+
+  // the fields after the command name start from the 3rd field
+  std::istringstream iss{content.substr(comm_end + 1)};
+  std::string field;
+  ProcessStat stat;
+  stat.name = content.substr(comm_begin + 1, comm_end - comm_begin - 1);
+  for (int i = 3; i <= 24 && iss >> field; ++i) {
+    if (i == 14 || i == 15) {
+      stat.cpu_ticks += std::stoull(field);
+    } else if (i == 24) {
+      stat.rss_pages = std::stoull(field);
+      return stat;
+    }
+  }
+  throw std::runtime_error("Malformed process stat: " + content);
+}
+
+MemInfo parse_meminfo(const std::string & content)
+{
+  std::optional<std::uint64_t> total_kib;
+  std::optional<std::uint64_t> free_kib;
+
+  // each line is like "MemTotal:       65532208 kB"
+  std::istringstream iss{content};
+  std::string line;
+  while ((!total_kib || !free_kib) && std::getline(iss, line)) {
+    std::istringstream iss_line{line};
+    std::string key;
+    std::uint64_t value;
+    if (!(iss_line >> key >> value)) {
+      continue;
+    }
+    if (key == "MemTotal:") {
+      total_kib = value;
+    } else if (key == "MemFree:") {
+      free_kib = value;
+    }
+  }
+  if (!total_kib || !free_kib) {
+    throw std::runtime_error("MemTotal or MemFree is not found in meminfo");
+  }
+
+  return {unit_conversions::kib_to_bytes(*total_kib), unit_conversions::kib_to_bytes(*free_kib)};
+}
+
+std::vector<int> list_thread_ids(const int pid)
+{
+  const auto path = "/proc/" + std::to_string(pid) + "/task";
+  DIR * dir = opendir(path.c_str());
+  if (!dir) {
+    throw std::runtime_error("Failed to open " + path + ": " + std::strerror(errno));
+  }
+
+  std::vector<int> thread_ids;
+  while (const auto * entry = readdir(dir)) {
+    // skip "." and ".."
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    thread_ids.push_back(std::atoi(entry->d_name));
+  }
+  closedir(dir);
+
+  std::sort(thread_ids.begin(), thread_ids.end());
+  return thread_ids;
+}
+
+}  // namespace autoware::component_monitor::procfs
@@ -0,0 +1,95 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PROCFS_HPP_
+#define PROCFS_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace autoware::component_monitor::procfs
+{
+/**
+ * @brief A file in procfs which is opened once and read from the beginning on every sample.
+ *
+ * @details procfs generates the content again when the file is read from the offset 0, so the file
+ * descriptor is reused instead of opening the file for every sample.
+ */
+class File
+{
+public:
+  /**
+   * @exception std::runtime_error Thrown if the file cannot be opened.
+   */
+  explicit File(const std::string & path);
+  ~File();
+
+  File(const File &) = delete;
+  File & operator=(const File &) = delete;
+
+  /**
+   * @brief Read the current content of the file.
+   *
+   * @return The content, which is valid until the next call.
+   * @exception std::runtime_error Thrown if the file cannot be read.
+   */
+  const std::string & read();
+
+private:
+  std::string path_;
+  int fd_;
+  std::string buffer_;
+};
+
+struct ProcessStat
+{
+  std::string name;            // command name, which is the thread name for a thread
+  std::uint64_t cpu_ticks{0};  // utime + stime in clock ticks
+  std::uint64_t rss_pages{0};
+};
+
+struct MemInfo
+{
+  std::uint64_t total_bytes{0};
+  std::uint64_t free_bytes{0};
+};
+
+/**
+ * @brief Parse the content of /proc/[pid]/stat or /proc/[pid]/task/[tid]/stat.
+ *
+ * @details The 2nd field is the command name in parentheses, which may contain spaces, so the
+ * fields are counted from the last ')'. The 14th, 15th and 24th fields are utime, stime and rss.
+ *
+ * @exception std::runtime_error Thrown if the content is malformed.
+ */
+ProcessStat parse_process_stat(const std::string & content);
+
+/**
+ * @brief Parse MemTotal and MemFree of the content of /proc/meminfo.
+ *
+ * @exception std::runtime_error Thrown if either of them is not found.
+ */
+MemInfo parse_meminfo(const std::string & content);
+
+/**
+ * @brief List the ids of the threads of the process in /proc/[pid]/task.
+ *
+ * @exception std::runtime_error Thrown if the directory cannot be opened.
+ */
+std::vector<int> list_thread_ids(int pid);
+
+}  // namespace autoware::component_monitor::procfs
+
+#endif  // PROCFS_HPP_
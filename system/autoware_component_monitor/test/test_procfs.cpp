@@ -0,0 +1,78 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "procfs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace autoware::component_monitor::procfs
+{
+TEST(Procfs, parse_process_stat)
+{
+  // the command name with spaces and parentheses
+  const std::string content =
+    "3352 (my (awesome) node) S 1 3352 3352 0 -1 4194560 1000 0 0 0 120 35 0 0 20 0 12 0 "
+    "5000 2905940000 31457 18446744073709551615 1 1 0 0 0 0 0 4096 0 0 0 0 17 3 0 0 0 0 0\n";
+  const auto stat = parse_process_stat(content);
+  EXPECT_EQ(stat.name, "my (awesome) node");
+  EXPECT_EQ(stat.cpu_ticks, 155U);
+  EXPECT_EQ(stat.rss_pages, 31457U);
+
+  EXPECT_THROW(parse_process_stat("3352 awesome S 1"), std::runtime_error);
+  EXPECT_THROW(parse_process_stat("3352 (awesome) S 1 3352 3352 0"), std::runtime_error);
+}
+
+TEST(Procfs, parse_meminfo)
+{
+  const std::string content =
+    "MemTotal:       65532208 kB\n"
+    "MemFree:        35117428 kB\n"
+    "MemAvailable:   45520816 kB\n"
+    "HugePages_Total:       0\n";
+  const auto meminfo = parse_meminfo(content);
+  EXPECT_EQ(meminfo.total_bytes, 65532208ULL * 1024ULL);
+  EXPECT_EQ(meminfo.free_bytes, 35117428ULL * 1024ULL);
+
+  EXPECT_THROW(parse_meminfo("MemTotal:       65532208 kB\n"), std::runtime_error);
+}
+
+TEST(Procfs, read_file)
+{
+  File file("/proc/self/stat");
+  const auto content = file.read();
+  EXPECT_FALSE(content.empty());
+  EXPECT_NO_THROW(parse_process_stat(content));
+  // the file is read again from the beginning
+  EXPECT_NO_THROW(parse_process_stat(file.read()));
+
+  EXPECT_THROW(File("/proc/non_existent_file"), std::runtime_error);
+}
+
+TEST(Procfs, list_thread_ids)
+{
+  const int pid = getpid();
+  const auto thread_ids = list_thread_ids(pid);
+  // the main thread has the same id as the process
+  EXPECT_NE(std::find(thread_ids.begin(), thread_ids.end(), pid), thread_ids.end());
+  EXPECT_TRUE(std::is_sorted(thread_ids.begin(), thread_ids.end()));
+
+  EXPECT_THROW(list_thread_ids(-1), std::runtime_error);
+}
+}  // namespace autoware::component_monitor::procfs
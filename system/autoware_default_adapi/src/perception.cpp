@@ -14,6 +14,8 @@
 
 #include "perception.hpp"
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::default_adapi
@@ -85,7 +87,9 @@ void PerceptionNode::object_recognize(
     objects.objects.insert(objects.objects.begin(), object);
   }
 
-  pub_object_recognized_->publish(objects);
+  // Move the message to avoid the copy in the intra-process communication.
+  auto message = std::make_unique<DynamicObjectArray::Message>(std::move(objects));
+  pub_object_recognized_->publish(std::move(message));
 }
 
 }  // namespace autoware::default_adapi
@@ -0,0 +1,83 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "statistics.hpp"
+
+#include <autoware/component_interface_utils/statistics.hpp>
+
+#include <string>
+
+namespace autoware::default_adapi
+{
+
+namespace
+{
+
+diagnostic_msgs::msg::KeyValue create_key_value(const std::string & key, const std::string & value)
+{
+  diagnostic_msgs::msg::KeyValue kv;
+  kv.key = key;
+  kv.value = value;
+  return kv;
+}
+
+}  // namespace
+
+StatisticsNode::StatisticsNode(const rclcpp::NodeOptions & options) : Node("statistics", options)
+{
+  pub_diagnostics_ =
+    create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", rclcpp::QoS(10));
+
+  const auto period = rclcpp::Rate(declare_parameter<double>("rate")).period();
+  timer_ = rclcpp::create_timer(this, get_clock(), period, [this]() { on_timer(); });
+}
+
+void StatisticsNode::on_timer()
+{
+  using autoware::component_interface_utils::InterfaceStatistics;
+  using autoware::component_interface_utils::LatencyHistogram;
+
+  diagnostic_msgs::msg::DiagnosticArray array;
+  array.header.stamp = now();
+  for (const auto & entry : InterfaceStatistics::instance().entries()) {
+    const auto & latency = entry.latency;
+    diagnostic_msgs::msg::DiagnosticStatus status;
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+    status.name = "adapi_statistics: " + entry.node + " " + entry.type + " " + entry.name;
+    status.hardware_id = "adapi";
+    status.values.push_back(create_key_value("count", std::to_string(latency.count())));
+    status.values.push_back(create_key_value("errors", std::to_string(entry.errors)));
+    status.values.push_back(create_key_value("mean_ms", std::to_string(latency.mean())));
+    status.values.push_back(create_key_value("p50_ms", std::to_string(latency.quantile(0.50))));
+    status.values.push_back(create_key_value("p90_ms", std::to_string(latency.quantile(0.90))));
+    status.values.push_back(create_key_value("p99_ms", std::to_string(latency.quantile(0.99))));
+    status.values.push_back(create_key_value("max_ms", std::to_string(latency.max())));
+
+    // The buckets are named by their upper bounds, and the last one has no upper bound.
+    const auto & bounds = LatencyHistogram::bounds;
+    const auto & counts = latency.counts();
+    for (size_t i = 0; i < counts.size(); ++i) {
+      const auto key = i < bounds.size() ? "le_" + std::to_string(static_cast<int>(bounds[i]))
+                                         : std::string("le_inf");
+      status.values.push_back(create_key_value(key + "_ms", std::to_string(counts[i])));
+    }
+    array.status.push_back(status);
+  }
+  pub_diagnostics_->publish(array);
+}
+
+}  // namespace autoware::default_adapi
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(autoware::default_adapi::StatisticsNode)
@@ -0,0 +1,39 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef STATISTICS_HPP_
+#define STATISTICS_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+
+namespace autoware::default_adapi
+{
+
+// Publish the latency statistics of the interfaces of the nodes in the same container.
+class StatisticsNode : public rclcpp::Node
+{
+public:
+  explicit StatisticsNode(const rclcpp::NodeOptions & options);
+
+private:
+  void on_timer();
+  rclcpp::TimerBase::SharedPtr timer_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_diagnostics_;
+};
+
+}  // namespace autoware::default_adapi
+
+#endif  // STATISTICS_HPP_
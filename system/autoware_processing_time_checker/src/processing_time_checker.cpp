@@ -16,7 +16,10 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <fstream>
+#include <iomanip>
 #include <string>
 #include <vector>
 
@@ -42,6 +45,9 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
   const double update_rate = declare_parameter<double>("update_rate");
   const auto processing_time_topic_name_list =
     declare_parameter<std::vector<std::string>>("processing_time_topic_name_list");
+  const auto window_size = declare_parameter<int>("window_size");
+  deadline_ms_ = declare_parameter<double>("deadline_ms");
+  output_file_str_ = declare_parameter<std::string>("output_file");
 
   for (const auto & processing_time_topic_name : processing_time_topic_name_list) {
     std::optional<std::string> module_name{std::nullopt};
@@ -65,6 +71,8 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
     // register module name
     if (module_name) {
       module_name_map_.insert_or_assign(processing_time_topic_name, *module_name);
+      statistics_map_.try_emplace(
+        *module_name, static_cast<size_t>(std::max(window_size, 1)), deadline_ms_);
     } else {
       throw std::invalid_argument("The format of the processing time topic name is not correct.");
     }
@@ -80,17 +88,36 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
         processing_time_topic_name, 1,
         [this, &module_name]([[maybe_unused]] const Float64Stamped & msg) {
           processing_time_map_.insert_or_assign(module_name, msg.data);
+          statistics_map_.at(module_name).add(msg.data);
         }));
     // clang-format on
   }
 
   diag_pub_ = create_publisher<DiagnosticArray>("~/metrics", 1);
+  statistics_pub_ = create_publisher<DiagnosticArray>("~/statistics", 1);
 
   const auto period_ns = rclcpp::Rate(update_rate).period();
   timer_ = rclcpp::create_timer(
     this, get_clock(), period_ns, std::bind(&ProcessingTimeChecker::on_timer, this));
 }
 
+ProcessingTimeChecker::~ProcessingTimeChecker()
+{
+  if (output_file_str_.empty()) {
+    return;
+  }
+
+  // the statistics of all the samples since the start in csv
+  std::ofstream f(output_file_str_);
+  f << std::fixed << std::setprecision(3);
+  f << "module,count,p50_ms,p95_ms,p99_ms,max_ms,deadline_ms,deadline_miss_count" << std::endl;
+  for (const auto & [module_name, statistics] : statistics_map_) {
+    const auto all = statistics.summarize_all();
+    f << module_name << "," << all.count << "," << all.p50 << "," << all.p95 << "," << all.p99
+      << "," << all.max << "," << deadline_ms_ << "," << all.deadline_miss_count << std::endl;
+  }
+}
+
 void ProcessingTimeChecker::on_timer()
 {
   // create diagnostic status
@@ -115,6 +142,46 @@ void ProcessingTimeChecker::on_timer()
 
   // publish
   diag_pub_->publish(diag_msg);
+
+  // create and publish the statistics of each module
+  DiagnosticArray statistics_msg;
+  statistics_msg.header.stamp = diag_msg.header.stamp;
+  for (const auto & [module_name, statistics] : statistics_map_) {
+    statistics_msg.status.push_back(create_statistics_status(module_name, statistics));
+  }
+  statistics_pub_->publish(statistics_msg);
+}
+
+DiagnosticStatus ProcessingTimeChecker::create_statistics_status(
+  const std::string & module_name, const ProcessingTimeStatistics & statistics) const
+{
+  const auto window = statistics.summarize_window();
+  const auto all = statistics.summarize_all();
+
+  DiagnosticStatus status;
+  status.name = module_name;
+  // warn while the deadline is missed in the sliding window
+  status.level = window.deadline_miss_count > 0 ? status.WARN : status.OK;
+
+  const auto add_value = [&](const std::string & key, const auto value) {
+    diagnostic_msgs::msg::KeyValue key_value;
+    key_value.key = key;
+    key_value.value = std::to_string(value);
+    status.values.push_back(key_value);
+  };
+  add_value("window_count", window.count);
+  add_value("window_p50_ms", window.p50);
+  add_value("window_p95_ms", window.p95);
+  add_value("window_p99_ms", window.p99);
+  add_value("window_max_ms", window.max);
+  add_value("window_deadline_miss_count", window.deadline_miss_count);
+  add_value("total_count", all.count);
+  add_value("total_p50_ms", all.p50);
+  add_value("total_p95_ms", all.p95);
+  add_value("total_p99_ms", all.p99);
+  add_value("total_max_ms", all.max);
+  add_value("total_deadline_miss_count", all.deadline_miss_count);
+  return status;
 }
 }  // namespace autoware::processing_time_checker
 
@@ -15,6 +15,8 @@
 #ifndef PROCESSING_TIME_CHECKER_HPP_
 #define PROCESSING_TIME_CHECKER_HPP_
 
+#include "processing_time_statistics.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include "diagnostic_msgs/msg/diagnostic_array.hpp"
@@ -34,19 +36,29 @@ class ProcessingTimeChecker : public rclcpp::Node
 {
 public:
   explicit ProcessingTimeChecker(const rclcpp::NodeOptions & node_options);
+  ~ProcessingTimeChecker() override;
 
 private:
   void on_timer();
 
+  DiagnosticStatus create_statistics_status(
+    const std::string & module_name, const ProcessingTimeStatistics & statistics) const;
+
   rclcpp::TimerBase::SharedPtr timer_;
 
   rclcpp::Publisher<DiagnosticArray>::SharedPtr diag_pub_;
+  rclcpp::Publisher<DiagnosticArray>::SharedPtr statistics_pub_;
   std::vector<rclcpp::Subscription<Float64Stamped>::SharedPtr> processing_time_subscribers_;
 
   // topic name - module name
   std::unordered_map<std::string, std::string> module_name_map_{};
   // module name - processing time
   std::unordered_map<std::string, double> processing_time_map_{};
+  // module name - statistics of the processing time
+  std::unordered_map<std::string, ProcessingTimeStatistics> statistics_map_{};
+
+  double deadline_ms_;
+  std::string output_file_str_;
 };
 }  // namespace autoware::processing_time_checker
 
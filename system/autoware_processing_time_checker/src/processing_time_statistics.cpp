@@ -0,0 +1,125 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "processing_time_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace autoware::processing_time_checker
+{
+namespace
+{
+// the range of the histogram and the growth rate of its buckets
+constexpr double min_histogram_ms = 1e-3;
+constexpr double max_histogram_ms = 1e6;
+constexpr double bucket_growth_rate = 1.01;
+
+// the index of the percentile in the sorted samples by the nearest-rank method
+size_t to_rank_index(const double percentile, const size_t count)
+{
+  const auto rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(count)));
+  return std::clamp(rank, size_t{1}, count) - 1;
+}
+}  // namespace
+
+ProcessingTimeStatistics::ProcessingTimeStatistics(
+  const size_t window_size, const double deadline_ms)
+: window_size_(std::max(window_size, size_t{1})), deadline_ms_(deadline_ms)
+{
+}
+
+void ProcessingTimeStatistics::add(const double processing_time_ms)
+{
+  window_.push_back(processing_time_ms);
+  if (window_.size() > window_size_) {
+    window_.pop_front();
+  }
+
+  const size_t bucket_index = to_bucket_index(processing_time_ms);
+  if (histogram_.size() <= bucket_index) {
+    histogram_.resize(bucket_index + 1, 0);
+  }
+  ++histogram_.at(bucket_index);
+
+  ++count_;
+  max_ = std::max(max_, processing_time_ms);
+  if (processing_time_ms > deadline_ms_) {
+    ++deadline_miss_count_;
+  }
+}
+
+ProcessingTimeSummary ProcessingTimeStatistics::summarize_window() const
+{
+  ProcessingTimeSummary summary;
+  summary.count = window_.size();
+  if (window_.empty()) {
+    return summary;
+  }
+
+  std::vector<double> sorted(window_.begin(), window_.end());
+  std::sort(sorted.begin(), sorted.end());
+  summary.p50 = sorted.at(to_rank_index(0.50, sorted.size()));
+  summary.p95 = sorted.at(to_rank_index(0.95, sorted.size()));
+  summary.p99 = sorted.at(to_rank_index(0.99, sorted.size()));
+  summary.max = sorted.back();
+  summary.deadline_miss_count = static_cast<size_t>(std::count_if(
+    sorted.begin(), sorted.end(), [&](const double t) { return t > deadline_ms_; }));
+  return summary;
+}
+
+ProcessingTimeSummary ProcessingTimeStatistics::summarize_all() const
+{
+  ProcessingTimeSummary summary;
+  summary.count = count_;
+  summary.max = max_;
+  summary.deadline_miss_count = deadline_miss_count_;
+  if (count_ == 0) {
+    return summary;
+  }
+
+  // the buckets are scanned once in ascending order of the percentiles
+  const std::vector<std::pair<double, double *>> percentiles = {
+    {0.50, &summary.p50}, {0.95, &summary.p95}, {0.99, &summary.p99}};
+  size_t percentile_index = 0;
+  uint64_t cumulative_count = 0;
+  for (size_t i = 0; i < histogram_.size() && percentile_index < percentiles.size(); ++i) {
+    cumulative_count += histogram_.at(i);
+    while (percentile_index < percentiles.size() &&
+           to_rank_index(percentiles.at(percentile_index).first, count_) < cumulative_count) {
+      // the upper bound of the bucket does not exceed the maximum sample
+      *percentiles.at(percentile_index).second = std::min(to_bucket_upper_bound(i), max_);
+      ++percentile_index;
+    }
+  }
+  return summary;
+}
+
+size_t ProcessingTimeStatistics::to_bucket_index(const double processing_time_ms) const
+{
+  if (!(processing_time_ms > min_histogram_ms)) {
+    return 0;
+  }
+  const double clamped_ms = std::min(processing_time_ms, max_histogram_ms);
+  return static_cast<size_t>(
+    std::ceil(std::log(clamped_ms / min_histogram_ms) / std::log(bucket_growth_rate)));
+}
+
+double ProcessingTimeStatistics::to_bucket_upper_bound(const size_t bucket_index) const
+{
+  return min_histogram_ms * std::pow(bucket_growth_rate, static_cast<double>(bucket_index));
+}
+}  // namespace autoware::processing_time_checker
@@ -0,0 +1,71 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PROCESSING_TIME_STATISTICS_HPP_
+#define PROCESSING_TIME_STATISTICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace autoware::processing_time_checker
+{
+struct ProcessingTimeSummary
+{
+  size_t count{0};
+  double p50{0.0};
+  double p95{0.0};
+  double p99{0.0};
+  double max{0.0};
+  size_t deadline_miss_count{0};
+};
+
+/**
+ * @brief statistics of the processing time of a module
+ * @details the percentiles of the recent samples are calculated exactly from a sliding window.
+ * The percentiles of all the samples are approximated by a histogram whose buckets grow
+ * geometrically, so that the memory does not grow with the running time. The bucket of a
+ * percentile is reported by its upper bound, which is at most 1% larger than the samples in it.
+ */
+class ProcessingTimeStatistics
+{
+public:
+  ProcessingTimeStatistics(const size_t window_size, const double deadline_ms);
+
+  void add(const double processing_time_ms);
+
+  // summary of the samples in the sliding window
+  ProcessingTimeSummary summarize_window() const;
+
+  // summary of all the samples since the start
+  ProcessingTimeSummary summarize_all() const;
+
+private:
+  size_t to_bucket_index(const double processing_time_ms) const;
+  double to_bucket_upper_bound(const size_t bucket_index) const;
+
+  size_t window_size_;
+  double deadline_ms_;
+
+  std::deque<double> window_;
+
+  std::vector<uint64_t> histogram_;
+  size_t count_{0};
+  double max_{0.0};
+  size_t deadline_miss_count_{0};
+};
+}  // namespace autoware::processing_time_checker
+
+#endif  // PROCESSING_TIME_STATISTICS_HPP_
@@ -0,0 +1,64 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "processing_time_statistics.hpp"
+
+#include <gtest/gtest.h>
+
+using autoware::processing_time_checker::ProcessingTimeStatistics;
+
+TEST(processing_time_statistics, empty)
+{
+  const ProcessingTimeStatistics statistics(10, 50.0);
+  EXPECT_EQ(statistics.summarize_window().count, 0U);
+  EXPECT_EQ(statistics.summarize_all().count, 0U);
+  EXPECT_DOUBLE_EQ(statistics.summarize_all().p99, 0.0);
+}
+
+TEST(processing_time_statistics, window)
+{
+  ProcessingTimeStatistics statistics(100, 95.5);
+  // 1, 2, ..., 200 [ms], of which 101, ..., 200 remain in the window
+  for (int i = 1; i <= 200; ++i) {
+    statistics.add(static_cast<double>(i));
+  }
+
+  const auto summary = statistics.summarize_window();
+  EXPECT_EQ(summary.count, 100U);
+  EXPECT_DOUBLE_EQ(summary.p50, 150.0);
+  EXPECT_DOUBLE_EQ(summary.p95, 195.0);
+  EXPECT_DOUBLE_EQ(summary.p99, 199.0);
+  EXPECT_DOUBLE_EQ(summary.max, 200.0);
+  EXPECT_EQ(summary.deadline_miss_count, 100U);
+}
+
+TEST(processing_time_statistics, all)
+{
+  ProcessingTimeStatistics statistics(10, 95.55);
+  for (int i = 1; i <= 1000; ++i) {
+    statistics.add(0.1 * i);
+  }
+
+  const auto summary = statistics.summarize_all();
+  EXPECT_EQ(summary.count, 1000U);
+  EXPECT_DOUBLE_EQ(summary.max, 100.0);
+  EXPECT_EQ(summary.deadline_miss_count, 45U);
+  // the percentiles are approximated within the bucket width of 1%
+  EXPECT_GE(summary.p50, 50.0);
+  EXPECT_LE(summary.p50, 50.0 * 1.01);
+  EXPECT_GE(summary.p95, 95.0);
+  EXPECT_LE(summary.p95, 95.0 * 1.01);
+  EXPECT_GE(summary.p99, 99.0);
+  EXPECT_LE(summary.p99, 100.0);
+}
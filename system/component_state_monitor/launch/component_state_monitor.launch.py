@@ -18,13 +18,10 @@ from pathlib import Path
 
 import launch
 from launch.actions import DeclareLaunchArgument
-from launch.actions import IncludeLaunchDescription
 from launch.actions import OpaqueFunction
 from launch.substitutions import LaunchConfiguration
-from launch.substitutions import PathJoinSubstitution
 from launch_ros.actions import ComposableNodeContainer
 from launch_ros.descriptions import ComposableNode
-from launch_ros.substitutions import FindPackageShare
 import yaml
 
 
@@ -37,13 +34,13 @@ def create_topic_monitor_name(row):
     return "topic_state_monitor_{}: {}".format(row["args"]["node_name_suffix"], diag_name)
 
 
-def create_topic_monitor_node(row):
-    tf_mode = "" if "topic_type" in row["args"] else "_tf"
-    package = FindPackageShare("topic_state_monitor")
-    include = PathJoinSubstitution([package, f"launch/topic_state_monitor{tf_mode}.launch.xml"])
-    diag_name = create_diagnostic_name(row)
-    arguments = [("diag_name", diag_name)] + [(k, str(v)) for k, v in row["args"].items()]
-    return IncludeLaunchDescription(include, launch_arguments=arguments)
+def create_topic_monitor_param(rows):
+    names = [row["args"]["node_name_suffix"] for row in rows]
+    param = {"names": names}
+    for name, row in zip(names, rows):
+        args = {k: v for k, v in row["args"].items() if k != "node_name_suffix"}
+        param[name] = {"diag_name": create_diagnostic_name(row), **args}
+    return param
 
 
 def launch_setup(context, *args, **kwargs):
@@ -51,14 +48,20 @@ def launch_setup(context, *args, **kwargs):
     mode = LaunchConfiguration("mode").perform(context)
     rows = yaml.safe_load(Path(LaunchConfiguration("file").perform(context)).read_text())
     rows = [row for row in rows if mode in row["mode"]]
-    topic_monitor_nodes = [create_topic_monitor_node(row) for row in rows]
     topic_monitor_names = [create_topic_monitor_name(row) for row in rows]
     topic_monitor_param = defaultdict(lambda: defaultdict(list))
     for row in rows:
         topic_monitor_param[row["type"]][row["module"]].append(create_topic_monitor_name(row))
     topic_monitor_param = {name: dict(module) for name, module in topic_monitor_param.items()}
 
-    # create component
+    # create components
+    topic_monitor = ComposableNode(
+        namespace="component_state_monitor",
+        name="topic_state_monitor",
+        package="topic_state_monitor",
+        plugin="topic_state_monitor::MultiTopicStateMonitorNode",
+        parameters=[create_topic_monitor_param(rows)],
+    )
     component = ComposableNode(
         namespace="component_state_monitor",
         name="component",
@@ -71,9 +74,9 @@ def launch_setup(context, *args, **kwargs):
         name="container",
         package="rclcpp_components",
         executable="component_container",
-        composable_node_descriptions=[component],
+        composable_node_descriptions=[topic_monitor, component],
     )
-    return [container, *topic_monitor_nodes]
+    return [container]
 
 
 def generate_launch_description():
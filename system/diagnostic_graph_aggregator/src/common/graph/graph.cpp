@@ -19,7 +19,9 @@
 #include "loader.hpp"
 #include "units.hpp"
 
+#include <functional>
 #include <unordered_map>
+#include <vector>
 
 namespace diagnostic_graph_aggregator
 {
@@ -34,22 +36,86 @@ void Graph::create(const std::string & file, const std::string & id)
   for (const auto & node : nodes_) units_.push_back(node.get());
   for (const auto & diag : diags_) units_.push_back(diag.get());
 
+  // Sort the node units so that the children come before the parents.
+  std::vector<bool> visited(nodes_.size(), false);
+  const std::function<void(NodeUnit *)> visit = [&](NodeUnit * node) {
+    if (visited[node->index()]) return;
+    visited[node->index()] = true;
+    for (const auto & link : node->child_links()) {
+      if (!link->child()->is_leaf()) visit(static_cast<NodeUnit *>(link->child()));
+    }
+    sorted_nodes_.push_back(node);
+  };
+  for (const auto & node : nodes_) visit(node.get());
+
+  node_orders_.resize(nodes_.size());
+  for (size_t i = 0; i < sorted_nodes_.size(); ++i) node_orders_[sorted_nodes_[i]->index()] = i;
+  dirty_nodes_.resize(nodes_.size(), false);
+
+  // Update all node units once so that their levels reflect the initial levels of the children.
+  for (const auto & node : sorted_nodes_) node->update();
+
   id_ = id;
 }
 
 void Graph::update(const rclcpp::Time & stamp)
 {
-  for (const auto & diag : diags_) diag->on_time(stamp);
+  for (const auto & diag : diags_) {
+    if (diag->on_time(stamp)) mark_parents(diag.get());
+  }
+  update_nodes();
 }
 
 bool Graph::update(const rclcpp::Time & stamp, const DiagnosticStatus & status)
+{
+  const auto result = update_diag(stamp, status);
+  update_nodes();
+  return result;
+}
+
+std::vector<DiagnosticStatus> Graph::update(
+  const rclcpp::Time & stamp, const DiagnosticArray & array)
+{
+  // Update the node units once after all diag units in the array are updated.
+  std::vector<DiagnosticStatus> unknowns;
+  for (const auto & status : array.status) {
+    if (!update_diag(stamp, status)) unknowns.push_back(status);
+  }
+  update_nodes();
+  return unknowns;
+}
+
+bool Graph::update_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status)
 {
   const auto iter = names_.find(status.name);
   if (iter == names_.end()) return false;
-  iter->second->on_diag(stamp, status);
+  if (iter->second->on_diag(stamp, status)) mark_parents(iter->second);
   return true;
 }
 
+void Graph::mark_parents(const BaseUnit * unit)
+{
+  for (const auto & parent : unit->parent_units()) {
+    const auto order = node_orders_[parent->index()];
+    if (dirty_nodes_[order]) continue;
+    dirty_nodes_[order] = true;
+    dirty_queue_.push(order);
+  }
+}
+
+void Graph::update_nodes()
+{
+  // Since the parents always come after the children, each node unit is updated at most once.
+  while (!dirty_queue_.empty()) {
+    const auto order = dirty_queue_.top();
+    dirty_queue_.pop();
+    dirty_nodes_[order] = false;
+
+    const auto node = sorted_nodes_[order];
+    if (node->update()) mark_parents(node);
+  }
+}
+
 DiagGraphStruct Graph::create_struct(const rclcpp::Time & stamp) const
 {
   DiagGraphStruct msg;
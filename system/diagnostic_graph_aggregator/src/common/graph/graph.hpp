@@ -19,7 +19,9 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <functional>
 #include <memory>
+#include <queue>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -33,6 +35,7 @@ public:
   void create(const std::string & file, const std::string & id = "");
   void update(const rclcpp::Time & stamp);  // cppcheck-suppress functionConst
   bool update(const rclcpp::Time & stamp, const DiagnosticStatus & status);
+  std::vector<DiagnosticStatus> update(const rclcpp::Time & stamp, const DiagnosticArray & array);
   const auto & nodes() const { return nodes_; }
   const auto & units() const { return units_; }
   DiagGraphStruct create_struct(const rclcpp::Time & stamp) const;
@@ -42,6 +45,10 @@ public:
   ~Graph();  // For unique_ptr members.
 
 private:
+  bool update_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status);
+  void mark_parents(const BaseUnit * unit);
+  void update_nodes();
+
   // Note: keep order correspondence between links and unit children for viewer.
   std::vector<std::unique_ptr<NodeUnit>> nodes_;
   std::vector<std::unique_ptr<DiagUnit>> diags_;
@@ -49,6 +56,12 @@ private:
   std::vector<BaseUnit *> units_;
   std::unordered_map<std::string, DiagUnit *> names_;
   std::string id_;
+
+  // The node units are updated in topological order only when their children have changed.
+  std::vector<NodeUnit *> sorted_nodes_;
+  std::vector<size_t> node_orders_;
+  std::vector<bool> dirty_nodes_;
+  std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> dirty_queue_;
 };
 
 }  // namespace diagnostic_graph_aggregator
@@ -47,23 +47,26 @@ BaseUnit::BaseUnit(const UnitLoader & unit)
   parents_ = unit.parents();
 }
 
+std::vector<NodeUnit *> BaseUnit::parent_units() const
+{
+  // The parent of a link is always a node unit because the diag units have no children.
+  std::vector<NodeUnit *> result;
+  for (const auto & link : parents_) {
+    result.push_back(static_cast<NodeUnit *>(link->parent()));
+  }
+  return result;
+}
+
 bool BaseUnit::update()
 {
   // Update the level of this unit.
   update_status();
 
-  // If the level does not change, it will not affect the parents.
+  // Return whether the parents need to be updated. The graph updates them in topological order.
   const auto curr_level = level();
   if (curr_level == prev_level_) return false;
   prev_level_ = curr_level;
-
-  // If the level changes, the parents also need to be updated.
-  bool result = false;
-  for (const auto & link : parents_) {
-    const auto unit = link->parent();
-    result = result || unit->update();
-  }
-  return result;
+  return true;
 }
 
 NodeUnit::NodeUnit(const UnitLoader & unit) : BaseUnit(unit)
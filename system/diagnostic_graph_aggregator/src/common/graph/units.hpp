@@ -59,8 +59,7 @@ public:
   virtual bool is_leaf() const = 0;
   size_t index() const { return index_; }
   size_t parent_size() const { return parents_.size(); }
-
-protected:
+  std::vector<NodeUnit *> parent_units() const;
   bool update();
 
 private:
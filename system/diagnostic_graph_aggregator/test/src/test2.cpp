@@ -85,6 +85,44 @@ TEST_P(GraphTest, Aggregation)
   EXPECT_EQ(output, param.result);
 }
 
+TEST(GraphUpdate, Array)
+{
+  const auto stamp = rclcpp::Clock().now();
+  Graph graph;
+  graph.create(resource("test2/diamond.yaml"));
+  EXPECT_EQ(get_output(graph, stamp), ERROR);
+
+  // The shared unit is referenced by both paths to the output.
+  graph.update(stamp, create_input({WARN, WARN}));
+  EXPECT_EQ(get_output(graph, stamp), WARN);
+  graph.update(stamp, create_input({OK, WARN}));
+  EXPECT_EQ(get_output(graph, stamp), OK);
+  graph.update(stamp, create_input({ERROR, ERROR}));
+  EXPECT_EQ(get_output(graph, stamp), ERROR);
+
+  // The statuses that do not exist in the graph are returned.
+  auto array = create_input({OK, OK});
+  array.status.push_back(DiagnosticStatus());
+  array.status.back().name = "test: unknown";
+  const auto unknowns = graph.update(stamp, array);
+  ASSERT_EQ(unknowns.size(), 1u);
+  EXPECT_EQ(unknowns.front().name, "test: unknown");
+  EXPECT_EQ(get_output(graph, stamp), OK);
+}
+
+TEST(GraphUpdate, Timeout)
+{
+  const auto stamp = rclcpp::Clock().now();
+  Graph graph;
+  graph.create(resource("test2/and.yaml"));
+
+  graph.update(stamp, create_input({OK, OK}));
+  graph.update(stamp + rclcpp::Duration::from_seconds(0.5));
+  EXPECT_EQ(get_output(graph, stamp), OK);
+  graph.update(stamp + rclcpp::Duration::from_seconds(2.0));
+  EXPECT_EQ(get_output(graph, stamp), ERROR);
+}
+
 // clang-format off
 
 INSTANTIATE_TEST_SUITE_P(And, GraphTest,
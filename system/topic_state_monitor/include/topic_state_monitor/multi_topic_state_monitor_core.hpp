@@ -0,0 +1,69 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+#define TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+
+#include "topic_state_monitor/topic_state_monitor.hpp"
+#include "topic_state_monitor/topic_state_monitor_core.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace topic_state_monitor
+{
+struct MonitoredTopic
+{
+  // Same as the status name of topic_state_monitor_node, i.e. "<node name>: <diag name>".
+  std::string status_name;
+  NodeParam node_param;
+  Param param;
+  TopicStateMonitor topic_state_monitor;
+};
+
+// Monitor many topics in one node instead of running topic_state_monitor_node for each topic.
+class MultiTopicStateMonitorNode : public rclcpp::Node
+{
+public:
+  explicit MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  // Core
+  std::vector<MonitoredTopic> topics_;
+
+  // Subscriber
+  // The messages are received as serialized messages, which are not deserialized.
+  std::vector<rclcpp::GenericSubscription::SharedPtr> sub_topics_;
+  // The transform topics are shared by the monitors of all frames.
+  std::unordered_map<std::string, rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr>
+    sub_transforms_;
+  std::unordered_map<std::string, std::vector<size_t>> transform_topic_indices_;
+  void onTransform(const std::string & topic, const tf2_msgs::msg::TFMessage & msg);
+
+  // Publisher
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_diagnostics_;
+
+  // Timer
+  void onTimer();
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+}  // namespace topic_state_monitor
+
+#endif  // TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
@@ -0,0 +1,137 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "topic_state_monitor/multi_topic_state_monitor_core.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace topic_state_monitor
+{
+MultiTopicStateMonitorNode::MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options)
+: Node("multi_topic_state_monitor", node_options)
+{
+  // Parameter
+  const auto update_rate = declare_parameter("update_rate", 10.0);
+  const auto names = declare_parameter<std::vector<std::string>>("names");
+
+  topics_.reserve(names.size());
+  for (const auto & name : names) {
+    NodeParam node_param;
+    node_param.update_rate = update_rate;
+    node_param.topic = declare_parameter<std::string>(name + ".topic");
+    node_param.transient_local = declare_parameter(name + ".transient_local", false);
+    node_param.best_effort = declare_parameter(name + ".best_effort", false);
+    node_param.diag_name = declare_parameter<std::string>(name + ".diag_name");
+    node_param.is_transform = (node_param.topic == "/tf" || node_param.topic == "/tf_static");
+
+    if (node_param.is_transform) {
+      node_param.frame_id = declare_parameter<std::string>(name + ".frame_id");
+      node_param.child_frame_id = declare_parameter<std::string>(name + ".child_frame_id");
+    } else {
+      node_param.topic_type = declare_parameter<std::string>(name + ".topic_type");
+    }
+
+    Param param;
+    param.warn_rate = declare_parameter(name + ".warn_rate", 0.5);
+    param.error_rate = declare_parameter(name + ".error_rate", 0.1);
+    param.timeout = declare_parameter(name + ".timeout", 1.0);
+    param.window_size = declare_parameter(name + ".window_size", 10);
+
+    // Use the same status name as the node launched by topic_state_monitor.launch.xml.
+    const auto node_name = "topic_state_monitor_" + name;
+    const auto status_name = node_name + ": " + node_param.diag_name;
+
+    auto & topic = topics_.emplace_back(
+      MonitoredTopic{status_name, node_param, param, TopicStateMonitor(*this)});
+    topic.topic_state_monitor.setParam(param);
+  }
+
+  // Subscriber
+  for (size_t i = 0; i < topics_.size(); ++i) {
+    const auto & node_param = topics_.at(i).node_param;
+    rclcpp::QoS qos = rclcpp::QoS{1};
+    if (node_param.transient_local) {
+      qos.transient_local();
+    }
+    if (node_param.best_effort) {
+      qos.best_effort();
+    }
+
+    if (node_param.is_transform) {
+      transform_topic_indices_[node_param.topic].push_back(i);
+      if (sub_transforms_.count(node_param.topic) == 0) {
+        sub_transforms_[node_param.topic] = create_subscription<tf2_msgs::msg::TFMessage>(
+          node_param.topic, qos,
+          [this, topic = node_param.topic](tf2_msgs::msg::TFMessage::ConstSharedPtr msg) {
+            onTransform(topic, *msg);
+          });
+      }
+    } else {
+      sub_topics_.push_back(create_generic_subscription(
+        node_param.topic, node_param.topic_type, qos,
+        [this, i]([[maybe_unused]] std::shared_ptr<rclcpp::SerializedMessage> msg) {
+          topics_.at(i).topic_state_monitor.update();
+        }));
+    }
+  }
+
+  // Publisher
+  pub_diagnostics_ =
+    create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", rclcpp::QoS(1));
+
+  // Timer
+  const auto period_ns = rclcpp::Rate(update_rate).period();
+  timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns, std::bind(&MultiTopicStateMonitorNode::onTimer, this));
+}
+
+void MultiTopicStateMonitorNode::onTransform(
+  const std::string & topic, const tf2_msgs::msg::TFMessage & msg)
+{
+  const auto & indices = transform_topic_indices_.at(topic);
+  for (const auto & transform : msg.transforms) {
+    for (const auto & i : indices) {
+      const auto & node_param = topics_.at(i).node_param;
+      if (
+        transform.header.frame_id == node_param.frame_id &&
+        transform.child_frame_id == node_param.child_frame_id) {
+        topics_.at(i).topic_state_monitor.update();
+      }
+    }
+  }
+}
+
+void MultiTopicStateMonitorNode::onTimer()
+{
+  // Publish the status of all topics in one diagnostic array
+  diagnostic_msgs::msg::DiagnosticArray diagnostics;
+  diagnostics.header.stamp = now();
+  diagnostics.status.reserve(topics_.size());
+  for (const auto & topic : topics_) {
+    diagnostic_updater::DiagnosticStatusWrapper stat;
+    stat.name = topic.status_name;
+    stat.hardware_id = "topic_state_monitor";
+    checkTopicStatus(*this, topic.node_param, topic.param, topic.topic_state_monitor, stat);
+    diagnostics.status.push_back(std::move(stat));
+  }
+  pub_diagnostics_->publish(diagnostics);
+}
+
+}  // namespace topic_state_monitor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(topic_state_monitor::MultiTopicStateMonitorNode)
@@ -134,28 +134,30 @@ void TopicStateMonitorNode::onTimer()
   updater_.force_update();
 }
 
-void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatusWrapper & stat)
+void checkTopicStatus(
+  rclcpp::Node & node, const NodeParam & node_param, const Param & param,
+  const TopicStateMonitor & topic_state_monitor, diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   using diagnostic_msgs::msg::DiagnosticStatus;
 
   // Get information
-  const auto topic_status = topic_state_monitor_->getTopicStatus();
-  const auto last_message_time = topic_state_monitor_->getLastMessageTime();
-  const auto topic_rate = topic_state_monitor_->getTopicRate();
+  const auto topic_status = topic_state_monitor.getTopicStatus();
+  const auto last_message_time = topic_state_monitor.getLastMessageTime();
+  const auto topic_rate = topic_state_monitor.getTopicRate();
 
   // Add topic name
-  if (node_param_.is_transform) {
-    const auto frame = "(" + node_param_.frame_id + " to " + node_param_.child_frame_id + ")";
-    stat.addf("topic", "%s %s", node_param_.topic.c_str(), frame.c_str());
+  if (node_param.is_transform) {
+    const auto frame = "(" + node_param.frame_id + " to " + node_param.child_frame_id + ")";
+    stat.addf("topic", "%s %s", node_param.topic.c_str(), frame.c_str());
   } else {
-    stat.addf("topic", "%s", node_param_.topic.c_str());
+    stat.addf("topic", "%s", node_param.topic.c_str());
   }
 
   const auto print_warn = [&](const std::string & msg) {
-    RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 3000, "%s", msg.c_str());
+    RCLCPP_WARN_THROTTLE(node.get_logger(), *node.get_clock(), 3000, "%s", msg.c_str());
   };
   const auto print_info = [&](const std::string & msg) {
-    RCLCPP_INFO_THROTTLE(get_logger(), *get_clock(), 3000, "%s", msg.c_str());
+    RCLCPP_INFO_THROTTLE(node.get_logger(), *node.get_clock(), 3000, "%s", msg.c_str());
   };
 
   // Judge level
@@ -166,29 +168,29 @@ void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatu
   } else if (topic_status == TopicStatus::NotReceived) {
     level = DiagnosticStatus::ERROR;
     stat.add("status", "NotReceived");
-    print_info(node_param_.topic + " has not received. Set ERROR in diagnostics.");
+    print_info(node_param.topic + " has not received. Set ERROR in diagnostics.");
   } else if (topic_status == TopicStatus::WarnRate) {
     level = DiagnosticStatus::WARN;
     stat.add("status", "WarnRate");
     print_warn(
-      node_param_.topic + " topic rate has dropped to the warning level. Set WARN in diagnostics.");
+      node_param.topic + " topic rate has dropped to the warning level. Set WARN in diagnostics.");
   } else if (topic_status == TopicStatus::ErrorRate) {
     level = DiagnosticStatus::ERROR;
     stat.add("status", "ErrorRate");
     print_warn(
-      node_param_.topic + " topic rate has dropped to the error level. Set ERROR in diagnostics.");
+      node_param.topic + " topic rate has dropped to the error level. Set ERROR in diagnostics.");
   } else if (topic_status == TopicStatus::Timeout) {
     level = DiagnosticStatus::ERROR;
     stat.add("status", "Timeout");
-    print_warn(node_param_.topic + " topic is timeout. Set ERROR in diagnostics.");
+    print_warn(node_param.topic + " topic is timeout. Set ERROR in diagnostics.");
   }
 
   // Add key-value
-  stat.addf("warn_rate", "%.2f [Hz]", param_.warn_rate);
-  stat.addf("error_rate", "%.2f [Hz]", param_.error_rate);
-  stat.addf("timeout", "%.2f [s]", param_.timeout);
+  stat.addf("warn_rate", "%.2f [Hz]", param.warn_rate);
+  stat.addf("error_rate", "%.2f [Hz]", param.error_rate);
+  stat.addf("timeout", "%.2f [s]", param.timeout);
   stat.addf("measured_rate", "%.2f [Hz]", topic_rate);
-  stat.addf("now", "%.2f [s]", this->now().seconds());
+  stat.addf("now", "%.2f [s]", node.now().seconds());
   stat.addf("last_message_time", "%.2f [s]", last_message_time.seconds());
 
   // Create message
@@ -205,6 +207,11 @@ void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatu
   stat.summary(level, msg);
 }
 
+void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  topic_state_monitor::checkTopicStatus(*this, node_param_, param_, *topic_state_monitor_, stat);
+}
+
 }  // namespace topic_state_monitor
 
 #include <rclcpp_components/register_node_macro.hpp>
@@ -0,0 +1,94 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LATENCY_TRACER_NODE_HPP_
+#define LATENCY_TRACER_NODE_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+#include <utils.hpp>
+
+#include <autoware_internal_msgs/msg/published_time.hpp>
+
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace reaction_analyzer
+{
+using autoware_internal_msgs::msg::PublishedTime;
+
+/**
+ * @brief A message published by a stage, with the sensor stamp which it is derived from.
+ */
+struct LineageEvent
+{
+  rclcpp::Time header_stamp;
+  rclcpp::Time published_stamp;
+  rclcpp::Time origin_stamp;
+};
+
+/**
+ * @brief A stage of the traced pipeline and the latencies measured for it.
+ */
+struct TracedStage
+{
+  std::string node_name;
+  std::string time_debug_topic_address;
+  rclcpp::Subscription<PublishedTime>::SharedPtr sub;
+
+  // recent events in the order of their published time
+  std::deque<LineageEvent> history;
+
+  // latency between the published time of this stage and the upstream stage
+  std::vector<double> stage_latencies_ms;
+  // latency between the published time of this stage and the origin sensor stamp
+  std::vector<double> total_latencies_ms;
+  // number of events whose upstream event is found by the header stamp
+  size_t exact_lineage_count{0};
+};
+
+/**
+ * @brief Node which traces the latencies of the pipeline passively during normal driving.
+ *
+ * @details The stages are subscribed in the given order through their published_time topics. The
+ * origin of the first stage is its header stamp. A later stage inherits the origin of the upstream
+ * event with the same header stamp if the stamp is propagated, and otherwise the origin of the
+ * latest upstream event published before it, as the nodes which run on a timer (e.g. control)
+ * process the latest input.
+ */
+class LatencyTracerNode : public rclcpp::Node
+{
+public:
+  explicit LatencyTracerNode(rclcpp::NodeOptions node_options);
+  ~LatencyTracerNode() override;
+
+private:
+  void on_published_time(const size_t stage_index, const PublishedTime::ConstSharedPtr & msg_ptr);
+
+  std::optional<LineageEvent> find_upstream_event(
+    const size_t stage_index, const PublishedTime & msg) const;
+
+  void write_latency_results() const;
+
+  std::string output_file_path_;
+  size_t history_size_;
+
+  std::vector<TracedStage> stages_;
+  mutable std::mutex mutex_;
+};
+}  // namespace reaction_analyzer
+
+#endif  // LATENCY_TRACER_NODE_HPP_
@@ -0,0 +1,179 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_tracer_node.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace reaction_analyzer
+{
+namespace
+{
+double calculate_percentile(const std::vector<double> & sorted_latencies, const double percentile)
+{
+  const auto rank =
+    static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted_latencies.size())));
+  return sorted_latencies.at(std::clamp(rank, size_t{1}, sorted_latencies.size()) - 1);
+}
+
+void write_latency_row(
+  std::ofstream & file, const std::string & label, const std::vector<double> & latencies)
+{
+  if (latencies.empty()) {
+    file << label << ",0,,,,,,,\n";
+    return;
+  }
+  const auto stats = calculate_statistics(latencies);
+  std::vector<double> sorted_latencies = latencies;
+  std::sort(sorted_latencies.begin(), sorted_latencies.end());
+  file << label << "," << latencies.size() << "," << stats.min << "," << stats.max << ","
+       << stats.mean << "," << stats.median << "," << calculate_percentile(sorted_latencies, 0.95)
+       << "," << calculate_percentile(sorted_latencies, 0.99) << "," << stats.std_dev << "\n";
+}
+}  // namespace
+
+LatencyTracerNode::LatencyTracerNode(rclcpp::NodeOptions node_options)
+: Node("latency_tracer_node", node_options)
+{
+  output_file_path_ = declare_parameter<std::string>("output_file_path");
+  if (!does_folder_exist(output_file_path_)) {
+    RCLCPP_ERROR(get_logger(), "Output file path is not valid. Node couldn't be initialized.");
+    return;
+  }
+  history_size_ = static_cast<size_t>(declare_parameter<int64_t>("history_size"));
+
+  // the stages are listed in the order of the pipeline, from the sensor to the actuation
+  const auto stage_names = declare_parameter<std::vector<std::string>>("stage_names");
+  stages_.resize(stage_names.size());
+  for (size_t i = 0; i < stage_names.size(); ++i) {
+    auto & stage = stages_.at(i);
+    stage.node_name = stage_names.at(i);
+    stage.time_debug_topic_address =
+      declare_parameter<std::string>("stages." + stage.node_name + ".time_debug_topic_name");
+    stage.sub = create_subscription<PublishedTime>(
+      stage.time_debug_topic_address, rclcpp::QoS(10),
+      [this, i](const PublishedTime::ConstSharedPtr msg_ptr) { on_published_time(i, msg_ptr); },
+      create_subscription_options(this));
+  }
+}
+
+LatencyTracerNode::~LatencyTracerNode()
+{
+  if (!stages_.empty()) {
+    write_latency_results();
+  }
+}
+
+void LatencyTracerNode::on_published_time(
+  const size_t stage_index, const PublishedTime::ConstSharedPtr & msg_ptr)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto & stage = stages_.at(stage_index);
+  const rclcpp::Time header_stamp(msg_ptr->header.stamp);
+  const rclcpp::Time published_stamp(msg_ptr->published_stamp);
+
+  LineageEvent event{header_stamp, published_stamp, header_stamp};
+  if (stage_index == 0) {
+    stage.stage_latencies_ms.push_back(calculate_time_diff_ms(header_stamp, published_stamp));
+  } else {
+    const auto upstream_event = find_upstream_event(stage_index, *msg_ptr);
+    if (!upstream_event) {
+      // the upstream stage has not published anything related to this message yet
+      return;
+    }
+    if (upstream_event->header_stamp == header_stamp) {
+      ++stage.exact_lineage_count;
+    }
+    event.origin_stamp = upstream_event->origin_stamp;
+    stage.stage_latencies_ms.push_back(
+      calculate_time_diff_ms(upstream_event->published_stamp, published_stamp));
+  }
+  stage.total_latencies_ms.push_back(calculate_time_diff_ms(event.origin_stamp, published_stamp));
+
+  stage.history.push_back(event);
+  if (stage.history.size() > history_size_) {
+    stage.history.pop_front();
+  }
+}
+
+std::optional<LineageEvent> LatencyTracerNode::find_upstream_event(
+  const size_t stage_index, const PublishedTime & msg) const
+{
+  const auto & upstream_history = stages_.at(stage_index - 1).history;
+  const rclcpp::Time header_stamp(msg.header.stamp);
+  const rclcpp::Time published_stamp(msg.published_stamp);
+
+  // prefer the event whose header stamp is propagated to this message
+  const auto exact_it = std::find_if(
+    upstream_history.rbegin(), upstream_history.rend(),
+    [&](const LineageEvent & event) { return event.header_stamp == header_stamp; });
+  if (exact_it != upstream_history.rend()) {
+    return *exact_it;
+  }
+
+  // otherwise, this message is derived from the latest upstream event which had been published
+  const auto latest_it = std::find_if(
+    upstream_history.rbegin(), upstream_history.rend(),
+    [&](const LineageEvent & event) { return event.published_stamp <= published_stamp; });
+  if (latest_it != upstream_history.rend()) {
+    return *latest_it;
+  }
+  return std::nullopt;
+}
+
+void LatencyTracerNode::write_latency_results() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const auto now = std::chrono::system_clock::now();
+  const auto in_time_t = std::chrono::system_clock::to_time_t(now);
+
+  std::stringstream ss;
+  ss << output_file_path_;
+  if (!output_file_path_.empty() && output_file_path_.back() != '/') {
+    ss << "/";  // Ensure the path ends with a slash
+  }
+  ss << "latency_tracer-";
+  ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d-%H-%M-%S");
+  ss << "-latency-results.csv";
+
+  std::ofstream file(ss.str());
+  if (!file.is_open()) {
+    RCLCPP_ERROR(get_logger(), "Failed to open file: %s", ss.str().c_str());
+    return;
+  }
+
+  file << "Node Name,Exact Lineage Count,Latency Type,Count,Min (ms),Max (ms),Mean (ms),"
+          "Median (ms),P95 (ms),P99 (ms),Std Dev (ms)\n";
+  for (const auto & stage : stages_) {
+    const auto prefix = stage.node_name + "," + std::to_string(stage.exact_lineage_count);
+    write_latency_row(file, prefix + ",Node Latency", stage.stage_latencies_ms);
+    write_latency_row(file, prefix + ",Total Latency", stage.total_latencies_ms);
+  }
+  file.close();
+  RCLCPP_INFO(get_logger(), "Results written to: %s", ss.str().c_str());
+}
+}  // namespace reaction_analyzer
+
+#include <rclcpp_components/register_node_macro.hpp>
+
+RCLCPP_COMPONENTS_REGISTER_NODE(reaction_analyzer::LatencyTracerNode)
@@ -47,6 +47,7 @@
 #include "tier4_vehicle_msgs/srv/update_accel_brake_map.hpp"
 #include "visualization_msgs/msg/marker_array.hpp"
 
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <memory>
@@ -85,6 +86,35 @@ struct DataStamped
 };
 using DataStampedPtr = std::shared_ptr<DataStamped>;
 
+/**
+ * @brief average of the latest values in a window, kept with the running sum so that a new value
+ * costs O(1) instead of a pass over the window
+ */
+class MovingAverage
+{
+public:
+  explicit MovingAverage(const std::size_t window_size) : window_size_{window_size} {}
+  void push(const double value)
+  {
+    values_.push_back(value);
+    sum_ += value;
+    while (values_.size() > window_size_) {
+      sum_ -= values_.front();
+      values_.pop_front();
+    }
+  }
+  double average() const
+  {
+    return values_.empty() ? 0.0 : sum_ / static_cast<double>(values_.size());
+  }
+  std::size_t size() const { return values_.size(); }
+
+private:
+  std::size_t window_size_;
+  std::deque<double> values_;
+  double sum_ = 0.0;
+};
+
 class AccelBrakeMapCalibrator : public rclcpp::Node
 {
 private:
@@ -172,7 +202,6 @@ private:
   const std::size_t pedal_vec_max_size_ = 100;
   const double timeout_sec_ = 0.1;
   int max_data_count_;
-  const int max_data_save_num_ = 10000;
   const double map_resolution_ = 0.1;
   const double max_jerk_ = 5.0;
   bool pedal_accel_graph_output_ = false;
@@ -185,14 +214,13 @@ private:
   // for evaluation
   AccelMap new_accel_map_;
   BrakeMap new_brake_map_;
-  std::vector<double> part_original_accel_mse_que_;
-  std::vector<double> full_original_accel_mse_que_;
-  // std::vector<double> full_original_accel_esm_que_;
-  std::vector<double> full_original_accel_l1_que_;
-  std::vector<double> full_original_accel_sq_l1_que_;
-  std::vector<double> new_accel_mse_que_;
-  std::size_t full_mse_que_size_ = 100000;
-  std::size_t part_mse_que_size_ = 3000;
+  const std::size_t full_mse_que_size_ = 100000;
+  const std::size_t part_mse_que_size_ = 3000;
+  MovingAverage part_original_accel_mse_que_{part_mse_que_size_};
+  MovingAverage full_original_accel_mse_que_{full_mse_que_size_};
+  MovingAverage full_original_accel_l1_que_{full_mse_que_size_};
+  MovingAverage full_original_accel_sq_l1_que_{full_mse_que_size_};
+  MovingAverage new_accel_mse_que_{part_mse_que_size_};
   double full_original_accel_rmse_ = 0.0;
   double full_original_accel_error_l1norm_ = 0.0;
   double part_original_accel_rmse_ = 0.0;
@@ -206,7 +234,11 @@ private:
   Map update_brake_map_value_;
   Map accel_offset_covariance_value_;
   Map brake_offset_covariance_value_;
-  std::vector<Map> map_value_data_;
+  // statistics of the measured acceleration on each cell of the unified map (pedal, velocity),
+  // updated per data so that the debug maps do not go through all the data collected so far
+  Eigen::MatrixXd map_data_count_;
+  Eigen::MatrixXd map_data_mean_;
+  Eigen::MatrixXd map_data_m2_;  // sum of the squared differences from the mean
   std::vector<double> accel_vel_index_;
   std::vector<double> brake_vel_index_;
   std::vector<double> accel_pedal_index_;
@@ -248,6 +280,7 @@ private:
     const int brake_pedal_index, const int brake_vel_index, const double measured_acc,
     const double map_acc);
   void update_total_map_offset(const double measured_acc, const double map_acc);
+  void add_map_data(const int unified_pedal_index, const int vel_index, const double measured_acc);
 
   void take_actuation(const std_msgs::msg::Header & header, const double accel, const double brake);
   void take_actuation_command(const ActuationCommandStamped::ConstSharedPtr msg);
@@ -288,7 +321,7 @@ private:
   double calculate_accel_error_l1_norm(
     const double throttle, const double brake, const double vel, AccelMap & accel_map,
     BrakeMap & brake_map);
-  static std::vector<double> get_map_column_from_unified_index(
+  static const std::vector<double> & get_map_column_from_unified_index(
     const Map & accel_map_value, const Map & brake_map_value, const std::size_t index);
   double get_pedal_value_from_unified_index(const std::size_t index);
   int get_unified_index_from_accel_brake_index(const bool accel_map, const std::size_t index);
@@ -302,8 +335,6 @@ private:
     const T base_data, const double back_time, const std::vector<T> & vec);
   DataStampedPtr get_nearest_time_data_from_vec(
     DataStampedPtr base_data, const double back_time, const std::vector<DataStampedPtr> & vec);
-  static double get_average(const std::vector<double> & vec);
-  double get_standard_deviation(const std::vector<double> & vec);
   bool is_timeout(const builtin_interfaces::msg::Time & stamp, const double timeout_sec);
   bool is_timeout(const DataStampedPtr & data_stamped, const double timeout_sec);
 
@@ -328,7 +359,7 @@ private:
   /* Debug */
   void publish_map(
     const Map & accel_map_value, const Map & brake_map_value, const std::string & publish_type);
-  void publish_offset_cov_map(const Map accel_map_value, const Map brake_map_value);
+  void publish_offset_cov_map(const Map & accel_map_value, const Map & brake_map_value);
   void publish_count_map();
   void publish_index();
   bool write_map_to_csv(
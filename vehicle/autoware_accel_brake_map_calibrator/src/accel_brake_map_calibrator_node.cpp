@@ -159,9 +159,12 @@ AccelBrakeMapCalibrator::AccelBrakeMapCalibrator(const rclcpp::NodeOptions & nod
   for (auto & m : brake_offset_covariance_value_) {
     m.resize(brake_map_value_.at(0).size(), covariance_);
   }
-  map_value_data_.resize(accel_map_value_.size() + brake_map_value_.size() - 1);
-  for (auto & m : map_value_data_) {
-    m.resize(accel_map_value_.at(0).size());
+  {
+    const auto unified_map_rows = accel_map_value_.size() + brake_map_value_.size() - 1;
+    const auto unified_map_cols = accel_map_value_.at(0).size();
+    map_data_count_ = Eigen::MatrixXd::Zero(unified_map_rows, unified_map_cols);
+    map_data_mean_ = Eigen::MatrixXd::Zero(unified_map_rows, unified_map_cols);
+    map_data_m2_ = Eigen::MatrixXd::Zero(unified_map_rows, unified_map_cols);
   }
 
   std::copy(accel_map_value_.begin(), accel_map_value_.end(), update_accel_map_value_.begin());
@@ -848,13 +851,27 @@ void AccelBrakeMapCalibrator::execute_update(
   }
 
   // add accel data to map
-  accel_mode
-    ? map_value_data_.at(get_unified_index_from_accel_brake_index(true, accel_pedal_index))
-        .at(accel_vel_index)
-        .emplace_back(measured_acc)
-    : map_value_data_.at(get_unified_index_from_accel_brake_index(false, brake_pedal_index))
-        .at(brake_vel_index)
-        .emplace_back(measured_acc);
+  if (accel_mode) {
+    add_map_data(
+      get_unified_index_from_accel_brake_index(true, accel_pedal_index), accel_vel_index,
+      measured_acc);
+  } else {
+    add_map_data(
+      get_unified_index_from_accel_brake_index(false, brake_pedal_index), brake_vel_index,
+      measured_acc);
+  }
+}
+
+void AccelBrakeMapCalibrator::add_map_data(
+  const int unified_pedal_index, const int vel_index, const double measured_acc)
+{
+  // Welford's online algorithm, which gives the same mean and variance as the batch calculation
+  double & count = map_data_count_(unified_pedal_index, vel_index);
+  double & mean = map_data_mean_(unified_pedal_index, vel_index);
+  count += 1.0;
+  const double delta = measured_acc - mean;
+  mean += delta / count;
+  map_data_m2_(unified_pedal_index, vel_index) += delta * (measured_acc - mean);
 }
 
 bool AccelBrakeMapCalibrator::update_four_cell_around_offset(
@@ -1086,7 +1103,7 @@ void AccelBrakeMapCalibrator::update_total_map_offset(
   }
 }
 
-std::vector<double> AccelBrakeMapCalibrator::get_map_column_from_unified_index(
+const std::vector<double> & AccelBrakeMapCalibrator::get_map_column_from_unified_index(
   const Map & accel_map_value, const Map & brake_map_value, const std::size_t index)
 {
   if (index < brake_map_value.size()) {
@@ -1132,21 +1149,20 @@ void AccelBrakeMapCalibrator::execute_evaluation()
   const double full_orig_accel_sq_error = calculate_accel_squared_error(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  push_data_to_vec(full_orig_accel_sq_error, full_mse_que_size_, &full_original_accel_mse_que_);
-  full_original_accel_rmse_ = get_average(full_original_accel_mse_que_);
+  full_original_accel_mse_que_.push(full_orig_accel_sq_error);
+  full_original_accel_rmse_ = full_original_accel_mse_que_.average();
   // std::cerr << "rmse : " << sqrt(full_original_accel_rmse_) << std::endl;
 
   const double full_orig_accel_l1_error = calculate_accel_error_l1_norm(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
   const double full_orig_accel_sq_l1_error = full_orig_accel_l1_error * full_orig_accel_l1_error;
-  push_data_to_vec(full_orig_accel_l1_error, full_mse_que_size_, &full_original_accel_l1_que_);
-  push_data_to_vec(
-    full_orig_accel_sq_l1_error, full_mse_que_size_, &full_original_accel_sq_l1_que_);
-  full_original_accel_error_l1norm_ = get_average(full_original_accel_l1_que_);
+  full_original_accel_l1_que_.push(full_orig_accel_l1_error);
+  full_original_accel_sq_l1_que_.push(full_orig_accel_sq_l1_error);
+  full_original_accel_error_l1norm_ = full_original_accel_l1_que_.average();
 
   /*calculate l1norm_covariance*/
-  // const double full_original_accel_error_sql1_ = get_average(full_original_accel_sq_l1_que_);
+  // const double full_original_accel_error_sql1_ = full_original_accel_sq_l1_que_.average();
   // std::cerr << "error_l1norm : " << full_original_accel_error_l1norm_ << std::endl;
   // std::cerr << "error_l1_cov : " <<
   // full_original_accel_error_sql1_-full_original_accel_error_l1norm_*full_original_accel_error_l1norm_
@@ -1155,14 +1171,14 @@ void AccelBrakeMapCalibrator::execute_evaluation()
   const double part_orig_accel_sq_error = calculate_accel_squared_error(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  push_data_to_vec(part_orig_accel_sq_error, part_mse_que_size_, &part_original_accel_mse_que_);
-  part_original_accel_rmse_ = get_average(part_original_accel_mse_que_);
+  part_original_accel_mse_que_.push(part_orig_accel_sq_error);
+  part_original_accel_rmse_ = part_original_accel_mse_que_.average();
 
   const double new_accel_sq_error = calculate_accel_squared_error(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     new_accel_map_, new_brake_map_);
-  push_data_to_vec(new_accel_sq_error, part_mse_que_size_, &new_accel_mse_que_);
-  new_accel_rmse_ = get_average(new_accel_mse_que_);
+  new_accel_mse_que_.push(new_accel_sq_error);
+  new_accel_rmse_ = new_accel_mse_que_.average();
 }
 
 double AccelBrakeMapCalibrator::calculate_estimated_acc(
@@ -1256,34 +1272,6 @@ DataStampedPtr AccelBrakeMapCalibrator::get_nearest_time_data_from_vec(
   return nearest_time_data;
 }
 
-double AccelBrakeMapCalibrator::get_average(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += num;
-  }
-  return sum / static_cast<double>(vec.size());
-}
-
-double AccelBrakeMapCalibrator::get_standard_deviation(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  const double ave = get_average(vec);
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += std::pow(num - ave, 2);
-  }
-  return std::sqrt(sum / static_cast<double>(vec.size()));
-}
-
 bool AccelBrakeMapCalibrator::is_timeout(
   const builtin_interfaces::msg::Time & stamp, const double timeout_sec)
 {
@@ -1378,9 +1366,10 @@ void AccelBrakeMapCalibrator::publish_map(
   std::vector<int8_t> int_map_value;
   int_map_value.resize(static_cast<std::vector<int>::size_type>(h * w));
   for (int i = 0; i < h; i++) {
+    const auto & map_column =
+      get_map_column_from_unified_index(accel_map_value_, brake_map_value_, i);
     for (int j = 0; j < w; j++) {
-      const double value =
-        get_map_column_from_unified_index(accel_map_value_, brake_map_value_, i).at(j);
+      const double value = map_column.at(j);
       // convert acc to 0~100 int value
       int8_t int_value =
         static_cast<int8_t>(max_occ_value * ((value - min_accel_) / (max_accel_ - min_accel_)));
@@ -1410,9 +1399,10 @@ void AccelBrakeMapCalibrator::publish_map(
   std::vector<float>::size_type vec_size = static_cast<std::vector<float>::size_type>(h * w);
   std::vector<float> vec(vec_size, 0);
   for (int i = 0; i < h; i++) {
+    const auto & map_column =
+      get_map_column_from_unified_index(accel_map_value_, brake_map_value_, i);
     for (int j = 0; j < w; j++) {
-      vec[i * w + j] = static_cast<float>(
-        get_map_column_from_unified_index(accel_map_value_, brake_map_value_, i).at(j));
+      vec[i * w + j] = static_cast<float>(map_column.at(j));
     }
   }
   float_map.data = vec;
@@ -1424,7 +1414,7 @@ void AccelBrakeMapCalibrator::publish_map(
 }
 
 void AccelBrakeMapCalibrator::publish_offset_cov_map(
-  const Map accel_map_value, const Map brake_map_value)
+  const Map & accel_map_value, const Map & brake_map_value)
 {
   if (accel_map_value.at(0).size() != brake_map_value.at(0).size()) {
     RCLCPP_ERROR_STREAM(
@@ -1450,10 +1440,11 @@ void AccelBrakeMapCalibrator::publish_offset_cov_map(
   float_map.layout.data_offset = 0;
   std::vector<float> vec(h * w, 0);
   for (int i = 0; i < h; i++) {
+    const auto & map_column =
+      get_map_column_from_unified_index(accel_map_value, brake_map_value, i);
     for (int j = 0; j < w; j++) {
       std::vector<float>::size_type index = static_cast<std::vector<float>::size_type>(i * w + j);
-      vec[index] = static_cast<float>(
-        get_map_column_from_unified_index(accel_map_value, brake_map_value, i).at(j));
+      vec[index] = static_cast<float>(map_column.at(j));
     }
   }
   float_map.data = vec;
@@ -1498,19 +1489,18 @@ void AccelBrakeMapCalibrator::publish_count_map()
 
   for (int i = 0; i < h; i++) {
     for (int j = 0; j < w; j++) {
-      const auto data_vec = map_value_data_.at(i).at(j);
-      if (data_vec.empty()) {
+      const double data_count = map_data_count_(i, j);
+      if (data_count == 0.0) {
         // input *UNKNOWN* value
         count_map.at(static_cast<std::vector<int8_t>::size_type>(i * w + j)) = -1;
         ave_map.at(static_cast<std::vector<int8_t>::size_type>(i * w + j)) = -1;
       } else {
-        const auto count_rate =
-          max_occ_value * (static_cast<double>(data_vec.size()) / max_data_count_);
+        const auto count_rate = max_occ_value * (data_count / max_data_count_);
         count_map.at(static_cast<std::vector<int8_t>::size_type>(i * w + j)) = static_cast<int8_t>(
           std::max(std::min(static_cast<int>(max_occ_value), static_cast<int>(count_rate)), 0));
         // calculate average
         {
-          const double average = get_average(data_vec);
+          const double average = map_data_mean_(i, j);
           int8_t int_average = static_cast<int8_t>(
             max_occ_value * ((average - min_accel_) / (max_accel_ - min_accel_)));
           ave_map.at(static_cast<std::vector<int8_t>::size_type>(i * w + j)) =
@@ -1518,7 +1508,7 @@ void AccelBrakeMapCalibrator::publish_count_map()
         }
         // calculate standard deviation
         {
-          const double std_dev = get_standard_deviation(data_vec);
+          const double std_dev = std::sqrt(map_data_m2_(i, j) / data_count);
           const double max_std_dev = 0.2;
           const double min_std_dev = 0.0;
           int8_t int_std_dev = static_cast<uint8_t>(
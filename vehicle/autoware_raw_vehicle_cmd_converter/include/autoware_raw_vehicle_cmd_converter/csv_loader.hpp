@@ -38,6 +38,10 @@ public:
   static std::vector<double> getColumnIndex(const Table & table);
   static double clampValue(
     const double val, const std::vector<double> & ranges, const std::string & name);
+  // the values of each row of the map at the column value, interpolated with the bracket of the
+  // column index searched once for all the rows
+  static std::vector<double> interpolateRows(
+    const std::vector<double> & column_index, const Map & map, const double column_value);
 
 private:
   std::string csv_path_;
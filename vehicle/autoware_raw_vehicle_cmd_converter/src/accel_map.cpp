@@ -39,14 +39,9 @@ bool AccelMap::readAccelMapFromCSV(const std::string & csv_path, const bool vali
 
 bool AccelMap::getThrottle(const double acc, double vel, double & throttle) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(accel_map_.size());
-  for (const std::vector<double> & accelerations : accel_map_) {
-    interpolated_acc_vec.push_back(
-      autoware::interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  const auto interpolated_acc_vec = CSVLoader::interpolateRows(vel_index_, accel_map_, clamped_vel);
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return false => brake sequence
   // When the desired acceleration is greater than the throttle area, return max throttle
@@ -63,14 +58,10 @@ bool AccelMap::getThrottle(const double acc, double vel, double & throttle) cons
 
 bool AccelMap::getAcceleration(const double throttle, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(accel_map_.size());
-  for (const auto & acc_vec : accel_map_) {
-    interpolated_acc_vec.push_back(autoware::interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const auto interpolated_acc_vec = CSVLoader::interpolateRows(vel_index_, accel_map_, clamped_vel);
 
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return min acc
@@ -46,15 +46,10 @@ bool BrakeMap::readBrakeMapFromCSV(const std::string & csv_path, const bool vali
 
 bool BrakeMap::getBrake(const double acc, const double vel, double & brake)
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(brake_map_.size());
-  for (const std::vector<double> & accelerations : brake_map_) {
-    interpolated_acc_vec.push_back(
-      autoware::interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  auto interpolated_acc_vec = CSVLoader::interpolateRows(vel_index_, brake_map_, clamped_vel);
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return max brake on the map
@@ -81,14 +76,10 @@ bool BrakeMap::getBrake(const double acc, const double vel, double & brake)
 
 bool BrakeMap::getAcceleration(const double brake, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  interpolated_acc_vec.reserve(brake_map_.size());
-  for (const auto & acc_vec : brake_map_) {
-    interpolated_acc_vec.push_back(autoware::interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const auto interpolated_acc_vec = CSVLoader::interpolateRows(vel_index_, brake_map_, clamped_vel);
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return min acc
@@ -14,7 +14,11 @@
 
 #include "autoware_raw_vehicle_cmd_converter/csv_loader.hpp"
 
+#include "autoware/interpolation/interpolation_utils.hpp"
+#include "autoware/interpolation/linear_interpolation.hpp"
+
 #include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -146,4 +150,41 @@ double CSVLoader::clampValue(
   return val;
 }
 
+std::vector<double> CSVLoader::interpolateRows(
+  const std::vector<double> & column_index, const Map & map, const double column_value)
+{
+  // the same validation as the lerp of each row
+  if (column_index.size() < 2) {
+    throw std::invalid_argument(
+      "The size of points is less than 2. base_keys.size() = " +
+      std::to_string(column_index.size()));
+  }
+  if (!autoware::interpolation::isIncreasing(column_index)) {
+    throw std::invalid_argument("Either base_keys or query_keys is not sorted.");
+  }
+  constexpr double epsilon = 1e-3;
+  if (
+    column_value < column_index.front() - epsilon || column_index.back() + epsilon < column_value) {
+    throw std::invalid_argument("query_keys is out of base_keys");
+  }
+  const double query_key =
+    std::min(std::max(column_value, column_index.front()), column_index.back());
+
+  // the first segment whose end is not less than the query key
+  const auto segment_end =
+    std::lower_bound(std::next(column_index.begin()), std::prev(column_index.end()), query_key);
+  const size_t key_index = std::distance(column_index.begin(), segment_end) - 1;
+  const double ratio = (query_key - column_index[key_index]) /
+                       (column_index[key_index + 1] - column_index[key_index]);
+
+  std::vector<double> interpolated_values;
+  interpolated_values.reserve(map.size());
+  for (const auto & row : map) {
+    autoware::interpolation::validateKeysAndValues(column_index, row);
+    interpolated_values.push_back(
+      autoware::interpolation::lerp(row[key_index], row[key_index + 1], ratio));
+  }
+  return interpolated_values;
+}
+
 }  // namespace autoware::raw_vehicle_cmd_converter
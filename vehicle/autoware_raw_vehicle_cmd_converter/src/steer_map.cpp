@@ -41,12 +41,8 @@ bool SteerMap::readSteerMapFromCSV(const std::string & csv_path, const bool vali
 void SteerMap::getSteer(const double steer_rate, const double steer, double & output) const
 {
   const double clamped_steer = CSVLoader::clampValue(steer, steer_index_, "steer: steer");
-  std::vector<double> steer_rate_interp = {};
-  steer_rate_interp.reserve(steer_map_.size());
-  for (const auto & steer_rate_vec : steer_map_) {
-    steer_rate_interp.push_back(
-      autoware::interpolation::lerp(steer_index_, steer_rate_vec, clamped_steer));
-  }
+  const auto steer_rate_interp =
+    CSVLoader::interpolateRows(steer_index_, steer_map_, clamped_steer);
 
   const double clamped_steer_rate =
     CSVLoader::clampValue(steer_rate, steer_rate_interp, "steer: steer_rate");
@@ -13,14 +13,18 @@
 // limitations under the License.
 
 #include "ament_index_cpp/get_package_share_directory.hpp"
+#include "autoware/interpolation/linear_interpolation.hpp"
 #include "autoware_raw_vehicle_cmd_converter/accel_map.hpp"
 #include "autoware_raw_vehicle_cmd_converter/brake_map.hpp"
+#include "autoware_raw_vehicle_cmd_converter/csv_loader.hpp"
 #include "autoware_raw_vehicle_cmd_converter/pid.hpp"
 #include "autoware_raw_vehicle_cmd_converter/steer_map.hpp"
 #include "autoware_raw_vehicle_cmd_converter/vgr.hpp"
 #include "gtest/gtest.h"
 
 #include <cmath>
+#include <stdexcept>
+#include <vector>
 
 /*
  * Throttle data: (vel, throttle -> acc)
@@ -50,6 +54,7 @@
 
 using autoware::raw_vehicle_cmd_converter::AccelMap;
 using autoware::raw_vehicle_cmd_converter::BrakeMap;
+using autoware::raw_vehicle_cmd_converter::CSVLoader;
 using autoware::raw_vehicle_cmd_converter::PIDController;
 using autoware::raw_vehicle_cmd_converter::SteerMap;
 using autoware::raw_vehicle_cmd_converter::VGR;
@@ -261,6 +266,28 @@ TEST(ConverterTests, SteerMapCalculation)
   EXPECT_DOUBLE_EQ(calcSteer(5.0, 5.0), 5.0);
 }
 
+TEST(ConverterTests, InterpolateRows)
+{
+  // non uniform column index, and the query on the knots and between them
+  const std::vector<double> column_index{0.0, 1.0, 3.0, 7.0};
+  const autoware::raw_vehicle_cmd_converter::Map map{
+    {0.0, 2.0, 4.0, 8.0}, {-1.0, 5.0, 2.0, 3.0}, {10.0, 10.0, -10.0, 0.0}};
+  for (const double column_value : {0.0, 0.5, 1.0, 2.0, 3.0, 6.5, 7.0}) {
+    const auto interpolated_values = CSVLoader::interpolateRows(column_index, map, column_value);
+    ASSERT_EQ(interpolated_values.size(), map.size());
+    for (size_t i = 0; i < map.size(); ++i) {
+      EXPECT_DOUBLE_EQ(
+        interpolated_values.at(i),
+        autoware::interpolation::lerp(column_index, map.at(i), column_value));
+    }
+  }
+
+  // invalid column index and rows throw as the lerp of each row
+  EXPECT_THROW(CSVLoader::interpolateRows({0.0, 0.0, 1.0, 2.0}, map, 0.5), std::invalid_argument);
+  EXPECT_THROW(CSVLoader::interpolateRows(column_index, {{0.0, 1.0}}, 0.5), std::invalid_argument);
+  EXPECT_THROW(CSVLoader::interpolateRows(column_index, map, 8.0), std::invalid_argument);
+}
+
 TEST(PIDTests, calculateFB)
 {
   PIDController steer_pid;